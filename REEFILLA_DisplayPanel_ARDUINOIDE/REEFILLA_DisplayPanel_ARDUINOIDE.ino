@@ -0,0 +1,173 @@
+#include <Arduino.h>
+#include "panel_port.h"
+#include "lv_port.h"
+#include "ui_main.h"
+#include "ui_task.h"
+#include "can_port.h"
+#include "can_stats.h"
+#include "can_trace.h"
+#include "dbc_bench.h"
+#include "dlog.h"
+#include "dbc_supervise.h"
+#include "dbc_stats.h"
+#include "signal_bus.h"
+#include "product.h"
+#include "rtrace.h"
+#include "task_prof.h"
+
+// ----------------------------------------------------
+// Comandi diagnostici da seriale (un carattere)
+//   s = statistiche di inter-arrivo per ID CAN
+//   r = azzera le statistiche
+//   t = dump binario della traccia CAN (vedi host/can_trace)
+//   w = scrive la traccia CAN sulla partizione flash dedicata
+//   a = filtro HW aperto (tutto il bus nella traccia e nelle statistiche), on/off
+//   b = microbenchmark del decoder DBC (blocca il loop per qualche decina di ms)
+//   l = log differito testo <-> binario (decodifica: host/dlog)
+//   c = supervisione cycle time dei messaggi DBC (ritardi, timeout)
+//   h = trend degli ultimi 10 minuti (min/media/max al minuto)
+//   u = task UI: risvegli, aggiornamenti, latenza dato->pixel, CPU, comandi UI,
+//       lock LVGL (contesa, tempi di tenuta, core e priorità dei task)
+//   d = statistiche dei segnali DBC (media, sd, min/max, p50/p95/p99)
+//   z = azzera la finestra delle statistiche dei segnali
+//   p = iscritti al bus dei segnali (eventi ricevuti/persi, ritardo)
+//   f = dump binario della traccia di rendering (vedi host/rtrace)
+//   k = profilo dei task: CPU per core e per task, stack, heap, loop()
+//   j = profilo dei task in binario a ogni campione, on/off (vedi host/task_prof)
+//   o = overlay del profilo dei task sullo schermo, on/off
+// ----------------------------------------------------
+static void serial_console_poll()
+{
+  while (Serial.available() > 0) {
+    int c = Serial.read();
+    switch (c) {
+      case 's':
+        can_stats_dump(Serial);
+        break;
+      case 'r':
+        can_stats_reset();
+        Serial.println("[console] statistiche CAN azzerate");
+        break;
+      case 't':
+        can_trace_dump_serial(Serial);
+        break;
+      case 'w':
+        can_trace_write_partition();
+        break;
+      case 'a':
+        Serial.println(can_port_filter_is_open() ? "[console] filtro HW dal DBC" : "[console] filtro HW aperto");
+        can_port_set_filter_open(!can_port_filter_is_open());
+        break;
+      case 'b':
+        dbc_bench_run(Serial);
+        break;
+      case 'c':
+        dbc_supervise_dump(Serial);
+        break;
+      case 'h':
+        // Lo storico è del task UI: lo stampa lui
+        ui_task_request(UI_REQ_TREND_DUMP);
+        break;
+      case 'u':
+        ui_task_request(UI_REQ_STATS_DUMP);
+        break;
+      case 'd':
+        dbc_stats_dump(Serial);
+        break;
+      case 'p':
+        signal_bus_dump(Serial);
+        break;
+      case 'z':
+        dbc_stats_reset_window();
+        Serial.println("[console] finestra statistiche DBC azzerata");
+        break;
+      case 'f':
+        rtrace_dump(Serial);
+        break;
+      case 'k':
+        task_prof_dump(Serial);
+        break;
+      case 'j':
+        Serial.println(task_prof_is_streaming() ? "[console] profilo binario off" : "[console] profilo binario on");
+        task_prof_set_stream(!task_prof_is_streaming());
+        break;
+      case 'o':
+        task_prof_overlay_set(!task_prof_overlay_is_visible());
+        ui_task_request(UI_REQ_UPDATE);
+        break;
+      case 'l':
+        Serial.println(dlog_is_binary() ? "[console] log in testo" : "[console] log binario");
+        dlog_set_binary(!dlog_is_binary());
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  delay(500);
+  Serial.println();
+  Serial.println("===== ESP32-S3 4\" PANEL - LVGL + CAN =====");
+  Serial.printf("Prodotto: %s\n", ThisProduct::NAME);
+
+  // Log differito dei task CAN/DBC (prima di avviarli)
+  dlog_init();
+
+  // Traccia di rendering e decodifica CAN (prima dei task che la scrivono)
+  rtrace_init();
+
+  if (!panel_port_init()) {
+    Serial.println("ERRORE: panel_port_init() fallita, mi fermo.");
+    while (true) {
+      delay(1000);
+    }
+  }
+
+  lv_port_init(panel_port_get_lcd(), panel_port_get_touch());
+  ui_main_init();
+  rtrace_lvgl_install();
+
+  // Touch a interrupt se il pannello ha il pin INT, altrimenti a polling
+  const bool touch_irq = lv_port_touch_attach_irq(ui_task_touch_isr);
+  Serial.printf("Touch %s\n", touch_irq ? "a interrupt" : "a polling");
+  ui_task_init(touch_irq);
+
+  // ---- CAN ----
+  if (!can_port_init()) {
+    Serial.println("ERRORE: can_port_init() fallita");
+  } else {
+    if (!can_port_start()) {
+      Serial.println("ERRORE: can_port_start() fallita");
+    } else {
+      Serial.println("CAN avviata (mode NORMAL)");
+    }
+  }
+
+  // Da qui LVGL gira solo nel task UI (ui_task.h)
+  if (!ui_task_start()) {
+    Serial.println("ERRORE: ui_task_start() fallita, mi fermo.");
+    while (true) {
+      delay(1000);
+    }
+  }
+
+  // Profilo dei task (CPU, stack, heap), dopo gli altri task: il primo
+  // campione li vede già tutti
+  if (!task_prof_start()) {
+    Serial.println("ERRORE: task_prof_start() fallita");
+  }
+
+  Serial.println("Setup completato: UI + CAN pronte.");
+}
+
+void loop()
+{
+  // Rendering e aggiornamenti UI sono nel task UI: qui resta la console
+  serial_console_poll();
+  task_prof_loop_tick();
+
+  delay(20);
+}
@@ -381,7 +381,12 @@
 #define LV_FONT_MONTSERRAT_42 0
 #define LV_FONT_MONTSERRAT_44 0
 #define LV_FONT_MONTSERRAT_46 0
+/*REEFILLA: il 48 serve solo al fillee (REEFILLA_PRODUCT da build_opt.h, vedi product.h)*/
+#if defined(REEFILLA_PRODUCT) && REEFILLA_PRODUCT != 1
+#define LV_FONT_MONTSERRAT_48 0
+#else
 #define LV_FONT_MONTSERRAT_48 1
+#endif
 
 /*Demonstrate special features*/
 #define LV_FONT_MONTSERRAT_12_SUBPX      0
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include <type_traits>
+
+#include "cache_line.h"
+
+// ----------------------------------------------------
+// Ring broadcast: un produttore, N lettori indipendenti
+// ----------------------------------------------------
+// Ogni elemento è scritto una volta sola e letto da tutti i lettori: il
+// produttore non sa quanti sono e non li aspetta mai (wait-free), ogni
+// lettore ha il proprio cursore (BroadcastCursor) e legge al suo ritmo.
+//
+// - posizioni "free running" a 32 bit: head = elementi pubblicati, la
+//   posizione p sta nello slot p & (CAPACITY - 1); le differenze sono
+//   modulo 2^32, quindi vanno bene finché un lettore resta indietro di
+//   meno di 2^31 elementi
+// - il produttore prenota le posizioni (claim_), scrive gli slot e solo
+//   dopo pubblica head_: un lettore copia, poi ricontrolla claim_ (come il
+//   Seqlock) e scarta le posizioni che nel frattempo sono state riscritte
+// - un lettore più lento del produttore perde gli elementi più vecchi:
+//   nessun blocco, nessuna copia per lettore lato produttore, e il
+//   cursore conta quanti elementi ha perso (lost) e quante volte (overruns)
+// - gli slot sono parole atomiche: la copia concorrente con la scrittura
+//   non è una data race, le barriere fanno il resto
+//
+// Anche poll() è wait-free: nessun ciclo di retry, se il produttore
+// riscrive tutto quello che il lettore stava copiando poll() ritorna 0 e
+// il cursore è già spostato in avanti (lost aumenta).
+
+// Cursore di un lettore: scritto solo dal lettore, i contatori si possono
+// leggere da qualsiasi task (diagnostica)
+struct alignas(CACHE_LINE_SIZE) BroadcastCursor
+{
+  uint32_t next = 0;   // prossima posizione da leggere
+
+  std::atomic<uint32_t> received{0};   // elementi letti
+  std::atomic<uint32_t> lost{0};       // elementi riscritti prima della lettura
+  std::atomic<uint32_t> overruns{0};   // poll() che hanno perso elementi
+  std::atomic<uint32_t> max_lag{0};    // massimo ritardo visto da poll() [elementi]
+};
+
+template <typename T, size_t CAPACITY>
+class BroadcastRing
+{
+  static_assert(std::is_trivially_copyable<T>::value,
+                "BroadcastRing: T deve essere copiabile con memcpy");
+  static_assert(CAPACITY >= 2 && (CAPACITY & (CAPACITY - 1)) == 0,
+                "BroadcastRing: capacità potenza di 2");
+
+  static constexpr uint32_t MASK  = CAPACITY - 1;
+  static constexpr size_t   WORDS = (sizeof(T) + 3) / 4;
+
+public:
+  static constexpr size_t capacity() { return CAPACITY; }
+
+  // Elementi pubblicati dall'avvio (modulo 2^32)
+  uint32_t published() const
+  {
+    return head_.load(std::memory_order_acquire);
+  }
+
+  // ---------------- lato produttore (uno solo) ----------------
+
+  void publish(const T &item)
+  {
+    publish_n(&item, 1);
+  }
+
+  // Pubblica n elementi (n <= CAPACITY) con un solo store di head
+  void publish_n(const T *items, size_t n)
+  {
+    if (n == 0) {
+      return;
+    }
+    const uint32_t pos = head_.load(std::memory_order_relaxed);
+    claim_.store(pos + (uint32_t)n, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (size_t i = 0; i < n; ++i) {
+      uint32_t buf[WORDS] = {};
+      memcpy(buf, &items[i], sizeof(T));
+      std::atomic<uint32_t> *slot = slots_[(pos + i) & MASK];
+      for (size_t w = 0; w < WORDS; ++w) {
+        slot[w].store(buf[w], std::memory_order_relaxed);
+      }
+    }
+    head_.store(pos + (uint32_t)n, std::memory_order_release);
+  }
+
+  // ---------------- lato lettore ----------------
+
+  // Il lettore riceve solo quello che viene pubblicato da qui in poi.
+  // Azzera anche i contatori del cursore.
+  void attach(BroadcastCursor &c) const
+  {
+    c.next = head_.load(std::memory_order_acquire);
+    c.received.store(0, std::memory_order_relaxed);
+    c.lost.store(0, std::memory_order_relaxed);
+    c.overruns.store(0, std::memory_order_relaxed);
+    c.max_lag.store(0, std::memory_order_relaxed);
+  }
+
+  // Elementi in attesa per il cursore (anche quelli già persi)
+  uint32_t lag(const BroadcastCursor &c) const
+  {
+    return head_.load(std::memory_order_acquire) - c.next;
+  }
+
+  // Copia in out fino a max elementi, dal più vecchio ancora disponibile.
+  // Ritorna quanti ne ha copiati.
+  size_t poll(BroadcastCursor &c, T *out, size_t max) const
+  {
+    const uint32_t head = head_.load(std::memory_order_acquire);
+    uint32_t       avail = head - c.next;
+    if (avail > c.max_lag.load(std::memory_order_relaxed)) {
+      c.max_lag.store(avail, std::memory_order_relaxed);
+    }
+    uint32_t dropped = 0;
+    if (avail > CAPACITY) {
+      // Già riscritti prima ancora di provare a copiarli
+      dropped = avail - (uint32_t)CAPACITY;
+      c.next += dropped;
+      avail   = (uint32_t)CAPACITY;
+    }
+    size_t n = (avail < max) ? avail : max;
+
+    uint32_t buf[WORDS];
+    for (size_t i = 0; i < n; ++i) {
+      const std::atomic<uint32_t> *slot = slots_[(c.next + i) & MASK];
+      for (size_t w = 0; w < WORDS; ++w) {
+        buf[w] = slot[w].load(std::memory_order_relaxed);
+      }
+      memcpy(&out[i], buf, sizeof(T));
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    // La posizione p è intatta se il produttore non ha ancora prenotato
+    // p + CAPACITY: le prime stale posizioni copiate sono da buttare
+    const uint32_t oldest = claim_.load(std::memory_order_relaxed) - (uint32_t)CAPACITY;
+    const int32_t  stale  = (int32_t)(oldest - c.next);
+    if (stale > 0) {
+      const size_t skip = ((size_t)stale < n) ? (size_t)stale : n;
+      memmove(out, out + skip, (n - skip) * sizeof(T));
+      n       -= skip;
+      c.next  += (uint32_t)stale;   // anche oltre la copia
+      dropped += (uint32_t)stale;
+    }
+    c.next += (uint32_t)n;
+
+    bump(c.received, (uint32_t)n);
+    if (dropped) {
+      bump(c.lost, dropped);
+      bump(c.overruns, 1);
+    }
+    return n;
+  }
+
+private:
+  // Contatore scritto da un solo task: niente read-modify-write atomico
+  static void bump(std::atomic<uint32_t> &counter, uint32_t n)
+  {
+    counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+  }
+
+  // Scritti solo dal produttore, letti da tutti
+  alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> head_{0};
+  std::atomic<uint32_t> claim_{0};
+
+  alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> slots_[CAPACITY][WORDS] = {};
+};
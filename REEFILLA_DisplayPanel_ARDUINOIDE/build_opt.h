@@ -0,0 +1 @@
+-DREEFILLA_PRODUCT=1
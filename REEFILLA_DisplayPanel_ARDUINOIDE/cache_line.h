@@ -0,0 +1,9 @@
+#pragma once
+
+// Dimensione della linea di cache usata per separare indici e slot scritti
+// da core diversi (ring, bus dei segnali, code dei comandi) e per allineare
+// i buffer allocati con heap_caps_aligned_alloc.
+// ESP32-S3: 32/64 byte a seconda della config; 64 va bene anche su host.
+#ifndef CACHE_LINE_SIZE
+#define CACHE_LINE_SIZE 64
+#endif
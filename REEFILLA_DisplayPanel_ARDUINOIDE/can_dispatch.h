@@ -0,0 +1,342 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "dbc_signal.h"   // dbc_phf_key / dbc_phf_hash / dbc_phf_reduce
+
+// ----------------------------------------------------
+// Dispatch (ID, esteso) -> indice del messaggio
+// ----------------------------------------------------
+// Strutture intercambiabili con la stessa interfaccia:
+//
+//   static constexpr size_t storage_words(size_t n)  uint32_t di storage per n chiavi
+//   bool build(const uint32_t *keys, size_t n, uint32_t *storage)
+//   int  find(uint32_t id, bool extended) const       indice in keys[] oppure -1
+//
+// Le chiavi sono dbc_phf_key(id, extended) (bit 31 = esteso), tutte diverse.
+// Lo storage è del chiamante (RAM interna, PSRAM o array statico) e deve
+// restare valido finché si usa la struttura. build() gira una volta
+// all'avvio; find() non alloca e non prende lock.
+//
+// - CanDispatchLinear : confronto in sequenza (il vecchio if-chain)
+// - CanDispatchSorted : chiavi ordinate, ricerca binaria senza branch
+//                       (log2(n) passi fissi, selezione con cmov)
+// - CanDispatchHash   : open addressing, hash di Fibonacci, probing lineare,
+//                       load factor <= 0.5
+// - CanDispatchPhf    : hash perfetto minimo costruito a runtime, stesso
+//                       schema di quello generato da host/dbcgen
+
+static constexpr uint32_t CAN_DISPATCH_EMPTY = 0xFFFFFFFFU;   // mai una chiave valida
+
+// ----------------------------------------------------
+// Confronto lineare
+// ----------------------------------------------------
+class CanDispatchLinear
+{
+public:
+  static constexpr size_t storage_words(size_t n) { return n; }
+
+  bool build(const uint32_t *keys, size_t n, uint32_t *storage)
+  {
+    for (size_t i = 0; i < n; ++i) {
+      storage[i] = keys[i];
+    }
+    keys_  = storage;
+    count_ = n;
+    return true;
+  }
+
+  int find(uint32_t id, bool extended) const
+  {
+    const uint32_t key = dbc_phf_key(id, extended);
+    for (size_t i = 0; i < count_; ++i) {
+      if (keys_[i] == key) {
+        return static_cast<int>(i);
+      }
+    }
+    return -1;
+  }
+
+private:
+  const uint32_t *keys_  = nullptr;
+  size_t          count_ = 0;
+};
+
+// ----------------------------------------------------
+// Array ordinato + ricerca binaria senza branch
+// ----------------------------------------------------
+// Layout dello storage: keys[n] ordinate, poi index[n] (posizione originale)
+class CanDispatchSorted
+{
+public:
+  static constexpr size_t storage_words(size_t n) { return 2 * n; }
+
+  bool build(const uint32_t *keys, size_t n, uint32_t *storage)
+  {
+    keys_  = storage;
+    index_ = storage + n;
+    count_ = n;
+
+    // Insertion sort: n piccolo o build una tantum
+    for (size_t i = 0; i < n; ++i) {
+      size_t j = i;
+      while (j > 0 && keys_[j - 1] > keys[i]) {
+        keys_[j]  = keys_[j - 1];
+        index_[j] = index_[j - 1];
+        --j;
+      }
+      keys_[j]  = keys[i];
+      index_[j] = static_cast<uint32_t>(i);
+    }
+    for (size_t i = 1; i < n; ++i) {
+      if (keys_[i] == keys_[i - 1]) {
+        return false;   // chiave duplicata
+      }
+    }
+    return true;
+  }
+
+  int find(uint32_t id, bool extended) const
+  {
+    if (count_ == 0) {
+      return -1;
+    }
+    const uint32_t key  = dbc_phf_key(id, extended);
+    const uint32_t *base = keys_;
+    size_t n = count_;
+    while (n > 1) {
+      const size_t half = n / 2;
+      base = (base[half] <= key) ? base + half : base;   // cmov, niente salto
+      n -= half;
+    }
+    return (*base == key) ? static_cast<int>(index_[base - keys_]) : -1;
+  }
+
+private:
+  uint32_t *keys_  = nullptr;
+  uint32_t *index_ = nullptr;
+  size_t    count_ = 0;
+};
+
+// ----------------------------------------------------
+// Open addressing (stesso hash della last-value cache)
+// ----------------------------------------------------
+// Layout dello storage: slot da 2 word {chiave, indice}, capacità potenza
+// di 2 >= 2n; slot vuoto = CAN_DISPATCH_EMPTY
+class CanDispatchHash
+{
+public:
+  static constexpr size_t capacity_for(size_t n)
+  {
+    size_t cap = 2;
+    while (cap < 2 * n) {
+      cap <<= 1;
+    }
+    return cap;
+  }
+
+  static constexpr size_t storage_words(size_t n) { return 2 * capacity_for(n); }
+
+  bool build(const uint32_t *keys, size_t n, uint32_t *storage)
+  {
+    slots_ = storage;
+    mask_  = static_cast<uint32_t>(capacity_for(n) - 1);
+    shift_ = 32;
+    for (uint32_t m = mask_; m; m >>= 1) {
+      --shift_;
+    }
+    for (size_t s = 0; s <= mask_; ++s) {
+      slots_[2 * s] = CAN_DISPATCH_EMPTY;
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+      uint32_t s = slot_of(keys[i]);
+      while (slots_[2 * s] != CAN_DISPATCH_EMPTY) {
+        if (slots_[2 * s] == keys[i]) {
+          return false;   // chiave duplicata
+        }
+        s = (s + 1) & mask_;
+      }
+      slots_[2 * s]     = keys[i];
+      slots_[2 * s + 1] = static_cast<uint32_t>(i);
+    }
+    return true;
+  }
+
+  int find(uint32_t id, bool extended) const
+  {
+    if (!slots_) {
+      return -1;
+    }
+    const uint32_t key = dbc_phf_key(id, extended);
+    uint32_t s = slot_of(key);
+    while (true) {
+      const uint32_t k = slots_[2 * s];
+      if (k == key) {
+        return static_cast<int>(slots_[2 * s + 1]);
+      }
+      if (k == CAN_DISPATCH_EMPTY) {
+        return -1;
+      }
+      s = (s + 1) & mask_;
+    }
+  }
+
+private:
+  uint32_t slot_of(uint32_t key) const
+  {
+    return (key * 2654435769U) >> shift_;
+  }
+
+  uint32_t *slots_ = nullptr;
+  uint32_t  mask_  = 0;
+  uint32_t  shift_ = 32;
+};
+
+// ----------------------------------------------------
+// Hash perfetto minimo (hash-and-displace)
+// ----------------------------------------------------
+// Costruzione condivisa con host/dbcgen. keys[n] -> seeds[buckets],
+// slot_of[n] (slot di ogni chiave) e slot_keys[n] (chiave in ogni slot).
+// I bucket più affollati vengono sistemati per primi; per ognuno si cerca
+// il primo seed che manda tutte le sue chiavi su slot liberi e distinti.
+// False se un bucket non trova un seed (riprovare con più bucket).
+
+static constexpr uint32_t DBC_PHF_MAX_BUCKET = 32;
+
+inline bool dbc_phf_build(const uint32_t *keys, uint32_t n,
+                          uint16_t *seeds, uint32_t buckets,
+                          uint32_t *slot_of, uint32_t *slot_keys)
+{
+  if (n == 0 || buckets == 0) {
+    return false;
+  }
+
+  // Finché un bucket non è sistemato seeds[b] = PENDING | chiavi nel bucket
+  // (i seed validi stanno sotto PENDING)
+  static constexpr uint16_t PENDING = 0x8000;
+
+  uint32_t max_size = 0;
+  for (uint32_t b = 0; b < buckets; ++b) {
+    seeds[b] = PENDING;
+  }
+  for (uint32_t i = 0; i < n; ++i) {
+    const uint32_t b = dbc_phf_reduce(dbc_phf_hash(keys[i], 0), buckets);
+    const uint32_t size = (++seeds[b]) & ~PENDING;
+    if (size > max_size) {
+      max_size = size;
+    }
+    if (size > DBC_PHF_MAX_BUCKET) {
+      return false;
+    }
+  }
+  for (uint32_t s = 0; s < n; ++s) {
+    slot_keys[s] = CAN_DISPATCH_EMPTY;
+  }
+
+  for (uint32_t size = max_size; size > 0; --size) {
+    for (uint32_t b = 0; b < buckets; ++b) {
+      if (seeds[b] != (PENDING | size)) {
+        continue;
+      }
+
+      uint32_t members[DBC_PHF_MAX_BUCKET];
+      uint32_t count = 0;
+      for (uint32_t i = 0; i < n; ++i) {
+        if (dbc_phf_reduce(dbc_phf_hash(keys[i], 0), buckets) == b) {
+          members[count++] = i;
+        }
+      }
+
+      bool placed = false;
+      for (uint32_t seed = 1; seed < PENDING && !placed; ++seed) {
+        uint32_t slots[DBC_PHF_MAX_BUCKET];
+        bool ok = true;
+        for (uint32_t k = 0; k < count && ok; ++k) {
+          slots[k] = dbc_phf_reduce(dbc_phf_hash(keys[members[k]], seed), n);
+          ok = (slot_keys[slots[k]] == CAN_DISPATCH_EMPTY);
+          for (uint32_t j = 0; j < k && ok; ++j) {
+            ok = (slots[j] != slots[k]);
+          }
+        }
+        if (ok) {
+          for (uint32_t k = 0; k < count; ++k) {
+            slot_keys[slots[k]]  = keys[members[k]];
+            slot_of[members[k]] = slots[k];
+          }
+          seeds[b] = static_cast<uint16_t>(seed);
+          placed = true;
+        }
+      }
+      if (!placed) {
+        return false;
+      }
+    }
+  }
+
+  // Bucket vuoti: seed 0
+  for (uint32_t b = 0; b < buckets; ++b) {
+    if (seeds[b] & PENDING) {
+      seeds[b] = 0;
+    }
+  }
+  return true;
+}
+
+// Numero di bucket di partenza: ~4 chiavi per bucket
+constexpr uint32_t dbc_phf_buckets_for(uint32_t n)
+{
+  return n ? (n + 3) / 4 : 1;
+}
+
+// Layout dello storage: slot_keys[n], index[n], seeds[buckets] (uint16_t
+// impaccati a coppie); i bucket vengono raddoppiati se la costruzione fallisce
+class CanDispatchPhf
+{
+public:
+  static constexpr size_t storage_words(size_t n)
+  {
+    return 2 * n + (static_cast<size_t>(n) + 1) / 2 + 1;
+  }
+
+  bool build(const uint32_t *keys, size_t n, uint32_t *storage)
+  {
+    slot_keys_ = storage;
+    index_     = storage + n;
+    seeds_     = reinterpret_cast<uint16_t *>(storage + 2 * n);
+    count_     = static_cast<uint32_t>(n);
+
+    for (buckets_ = dbc_phf_buckets_for(count_); buckets_ <= count_ + 1; buckets_ *= 2) {
+      // index_ fa da slot_of durante la costruzione, poi viene invertito
+      if (dbc_phf_build(keys, count_, seeds_, buckets_, index_, slot_keys_)) {
+        for (uint32_t i = 0; i < count_; ++i) {
+          slot_keys_[index_[i]] = i;
+        }
+        for (uint32_t s = 0; s < count_; ++s) {
+          index_[s] = slot_keys_[s];
+          slot_keys_[s] = keys[index_[s]];
+        }
+        phf_ = { seeds_, buckets_, slot_keys_, count_ };
+        return true;
+      }
+    }
+    return false;
+  }
+
+  int find(uint32_t id, bool extended) const
+  {
+    if (count_ == 0) {
+      return -1;
+    }
+    const int slot = dbc_phf_find(phf_, id, extended);
+    return (slot >= 0) ? static_cast<int>(index_[slot]) : -1;
+  }
+
+private:
+  uint32_t *slot_keys_ = nullptr;
+  uint32_t *index_     = nullptr;
+  uint16_t *seeds_     = nullptr;
+  uint32_t  buckets_   = 0;
+  uint32_t  count_     = 0;
+  DbcPhf    phf_       = { nullptr, 0, nullptr, 0 };
+};
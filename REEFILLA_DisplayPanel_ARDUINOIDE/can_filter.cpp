@@ -0,0 +1,249 @@
+#include "can_filter.h"
+
+// ----------------------------------------------------
+// Pattern ternario: bit fissi in code, "don't care" in mask
+// ----------------------------------------------------
+
+struct Pattern
+{
+  uint32_t code;
+  uint32_t mask;
+};
+
+// Numero massimo di ID per cui la partizione del dual filter è esaustiva
+// (2^(n-1) combinazioni); oltre si usano solo gli split euristici
+static constexpr size_t DUAL_EXHAUSTIVE_MAX = 16;
+
+// Bit del registro che contengono l'ID, per formato
+static constexpr uint32_t SINGLE_EXT_ID_BITS = 0xFFFFFFF8UL;  // code[31:3]
+static constexpr uint32_t SINGLE_STD_ID_BITS = 0xFFE00000UL;  // code[31:21]
+static constexpr uint32_t DUAL_EXT_ID_BITS   = 0xFFFFU;       // ID[28:13]
+static constexpr uint32_t DUAL_STD_ID_BITS   = 0xFFE0U;       // ID[10:0]
+static constexpr uint32_t DUAL_EXT_LOW_BITS  = 13;            // ID[12:0] non filtrati
+
+static inline uint32_t popcount32(uint32_t v)
+{
+  return (uint32_t)__builtin_popcount(v);
+}
+
+// ----------------------------------------------------
+// Conversione ID -> pattern nel layout del registro
+// ----------------------------------------------------
+
+static Pattern single_pattern(const CanFilterId &fid)
+{
+  if (fid.extended) {
+    return { (uint32_t)((fid.id & 0x1FFFFFFFU) << 3), 0x7U };
+  }
+  return { (fid.id & 0x7FFU) << 21, 0x1FFFFFU };
+}
+
+static Pattern dual_pattern(const CanFilterId &fid)
+{
+  if (fid.extended) {
+    return { (fid.id >> 13) & 0xFFFFU, 0 };
+  }
+  return { (fid.id & 0x7FFU) << 5, 0x1FU };
+}
+
+// Pattern più stretto che copre entrambi
+static inline Pattern merge(const Pattern &a, const Pattern &b)
+{
+  const uint32_t mask = a.mask | b.mask | (a.code ^ b.code);
+  return { a.code & ~mask, mask };
+}
+
+// ----------------------------------------------------
+// Conteggio degli ID accettati
+// ----------------------------------------------------
+
+static uint64_t single_accepted_std(const Pattern &p)
+{
+  return 1ULL << popcount32(p.mask & SINGLE_STD_ID_BITS);
+}
+
+static uint64_t single_accepted_ext(const Pattern &p)
+{
+  return 1ULL << popcount32(p.mask & SINGLE_EXT_ID_BITS);
+}
+
+static uint64_t dual_accepted_std(const Pattern &p)
+{
+  return 1ULL << popcount32(p.mask & DUAL_STD_ID_BITS);
+}
+
+static uint64_t dual_accepted_ext(const Pattern &p)
+{
+  return 1ULL << (popcount32(p.mask & DUAL_EXT_ID_BITS) + DUAL_EXT_LOW_BITS);
+}
+
+// Intersezione di due pattern: vuota se differiscono su un bit fisso per entrambi
+static bool intersect(const Pattern &a, const Pattern &b, Pattern &out)
+{
+  if (((a.code ^ b.code) & ~(a.mask | b.mask)) != 0) {
+    return false;
+  }
+  out.mask = a.mask & b.mask;
+  out.code = (a.code | b.code) & ~out.mask;
+  return true;
+}
+
+// Unione dei due filtri (inclusione-esclusione)
+static void dual_accepted(const Pattern &f1, const Pattern &f2,
+                          uint64_t &acc_std, uint64_t &acc_ext)
+{
+  acc_std = dual_accepted_std(f1) + dual_accepted_std(f2);
+  acc_ext = dual_accepted_ext(f1) + dual_accepted_ext(f2);
+
+  Pattern both;
+  if (intersect(f1, f2, both)) {
+    acc_std -= dual_accepted_std(both);
+    acc_ext -= dual_accepted_ext(both);
+  }
+}
+
+// ----------------------------------------------------
+// Partizione degli ID sui due filtri del dual mode
+// ----------------------------------------------------
+
+struct DualCandidate
+{
+  Pattern  f1;
+  Pattern  f2;
+  uint64_t acc_std;
+  uint64_t acc_ext;
+  bool     valid;
+};
+
+static void dual_consider(DualCandidate &best, const Pattern &f1, const Pattern &f2)
+{
+  uint64_t acc_std, acc_ext;
+  dual_accepted(f1, f2, acc_std, acc_ext);
+  if (!best.valid || acc_std + acc_ext < best.acc_std + best.acc_ext) {
+    best = { f1, f2, acc_std, acc_ext, true };
+  }
+}
+
+// Costruisce i due filtri dalla partizione descritta da una funzione "in gruppo 2?"
+template <typename InSecond>
+static void dual_try_split(DualCandidate &best, const CanFilterId *ids, size_t n,
+                           InSecond in_second)
+{
+  bool has1 = false, has2 = false;
+  Pattern f1 = { 0, 0 }, f2 = { 0, 0 };
+
+  for (size_t i = 0; i < n; ++i) {
+    const Pattern p = dual_pattern(ids[i]);
+    if (in_second(i, p)) {
+      f2 = has2 ? merge(f2, p) : p;
+      has2 = true;
+    } else {
+      f1 = has1 ? merge(f1, p) : p;
+      has1 = true;
+    }
+  }
+
+  // Un gruppo vuoto: il secondo filtro replica il primo
+  if (!has1) f1 = f2;
+  if (!has2) f2 = f1;
+  dual_consider(best, f1, f2);
+}
+
+static DualCandidate dual_synthesize(const CanFilterId *ids, size_t n)
+{
+  DualCandidate best = {};
+
+  if (n <= DUAL_EXHAUSTIVE_MAX) {
+    // Il primo ID resta sempre nel gruppo 1 (le partizioni sono simmetriche)
+    const uint32_t combos = 1UL << (n - 1);
+    for (uint32_t sel = 0; sel < combos; ++sel) {
+      dual_try_split(best, ids, n, [sel](size_t i, const Pattern &) {
+        return i > 0 && ((sel >> (i - 1)) & 1U);
+      });
+    }
+    return best;
+  }
+
+  // Euristica: split su ogni singolo bit del pattern da 16 bit
+  for (uint32_t bit = 0; bit < 16; ++bit) {
+    dual_try_split(best, ids, n, [bit](size_t, const Pattern &p) {
+      return ((p.code >> bit) & 1U) != 0;
+    });
+  }
+  return best;
+}
+
+// ----------------------------------------------------
+// API
+// ----------------------------------------------------
+
+void can_filter_synthesize(const CanFilterId *ids, size_t n, CanFilterReport &out)
+{
+  // ID distinti (n piccolo: va bene il confronto quadratico)
+  uint32_t distinct = 0;
+  for (size_t i = 0; i < n; ++i) {
+    bool dup = false;
+    for (size_t j = 0; j < i && !dup; ++j) {
+      dup = ids[j].id == ids[i].id && ids[j].extended == ids[i].extended;
+    }
+    if (!dup) ++distinct;
+  }
+
+  out.handled_ids = distinct;
+
+  if (n == 0) {
+    out.acceptance_code   = 0;
+    out.acceptance_mask   = 0xFFFFFFFFUL;
+    out.single_filter     = true;
+    out.accepted_std      = 1ULL << 11;
+    out.accepted_ext      = 1ULL << 29;
+    out.false_accept_rate = 1.0f;
+    return;
+  }
+
+  // ---- Single filter ----
+  Pattern single = single_pattern(ids[0]);
+  for (size_t i = 1; i < n; ++i) {
+    single = merge(single, single_pattern(ids[i]));
+  }
+  const uint64_t single_std = single_accepted_std(single);
+  const uint64_t single_ext = single_accepted_ext(single);
+
+  // ---- Dual filter ----
+  const DualCandidate dual = dual_synthesize(ids, n);
+
+  if (dual.valid && dual.acc_std + dual.acc_ext < single_std + single_ext) {
+    out.acceptance_code = (dual.f1.code << 16) | (dual.f2.code & 0xFFFFU);
+    out.acceptance_mask = (dual.f1.mask << 16) | (dual.f2.mask & 0xFFFFU);
+    out.single_filter   = false;
+    out.accepted_std    = dual.acc_std;
+    out.accepted_ext    = dual.acc_ext;
+  } else {
+    out.acceptance_code = single.code;
+    out.acceptance_mask = single.mask;
+    out.single_filter   = true;
+    out.accepted_std    = single_std;
+    out.accepted_ext    = single_ext;
+  }
+
+  const uint64_t accepted = out.accepted_std + out.accepted_ext;
+  out.false_accept_rate = (accepted > distinct)
+                              ? (float)(accepted - distinct) / (float)accepted
+                              : 0.0f;
+}
+
+bool can_filter_accepts(const CanFilterReport &filter, uint32_t id, bool extended)
+{
+  const CanFilterId fid = { id, extended };
+
+  if (filter.single_filter) {
+    const Pattern p = single_pattern(fid);
+    return ((p.code ^ filter.acceptance_code) & ~(p.mask | filter.acceptance_mask)) == 0;
+  }
+
+  const Pattern p  = dual_pattern(fid);
+  const Pattern f1 = { filter.acceptance_code >> 16, filter.acceptance_mask >> 16 };
+  const Pattern f2 = { filter.acceptance_code & 0xFFFFU, filter.acceptance_mask & 0xFFFFU };
+  return ((p.code ^ f1.code) & ~(p.mask | f1.mask)) == 0 ||
+         ((p.code ^ f2.code) & ~(p.mask | f2.mask)) == 0;
+}
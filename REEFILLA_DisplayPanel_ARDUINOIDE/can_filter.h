@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------
+// Sintesi dei filtri di accettazione HW del TWAI
+// ----------------------------------------------------
+// Dato l'insieme di ID gestiti dal decoder calcola il code+mask più stretto
+// per il controller TWAI (single filter oppure dual filter) e riporta quanti
+// ID "in più" riescono comunque a passare.
+//
+// Convenzione ESP-IDF: nel mask un bit a 1 = "don't care".
+// Layout dei registri (single filter):
+//   esteso  : ID[28:0] in code[31:3], RTR in code[2]
+//   standard: ID[10:0] in code[31:21], RTR in code[20], poi byte dati 0/1
+// Dual filter: due filtri da 16 bit (code[31:16] e code[15:0]):
+//   esteso  : solo ID[28:13]
+//   standard: ID[10:0] nei bit [15:5], RTR e nibble dati nei bit [4:0]
+// RTR e byte dati sono sempre lasciati "don't care".
+//
+// Nessuna dipendenza da ESP-IDF/Arduino: compila anche su host.
+
+struct CanFilterId
+{
+  uint32_t id;
+  bool     extended;
+};
+
+struct CanFilterReport
+{
+  uint32_t acceptance_code;
+  uint32_t acceptance_mask;
+  bool     single_filter;
+
+  uint32_t handled_ids;       // ID distinti in ingresso
+  uint64_t accepted_std;      // ID standard (11 bit) che passano il filtro (stima per eccesso)
+  uint64_t accepted_ext;      // ID estesi (29 bit) che passano il filtro (stima per eccesso)
+  float    false_accept_rate; // frazione degli ID accettati che il decoder non gestisce
+};
+
+// Calcola il filtro più stretto per l'insieme di ID.
+// Con n == 0 ritorna il filtro "accetta tutto".
+// Gli ID duplicati sono ammessi (vengono contati una volta sola).
+void can_filter_synthesize(const CanFilterId *ids, size_t n, CanFilterReport &out);
+
+// Ritorna true se il frame passa il filtro descritto dal report
+// (stessa logica del controller, ignorando RTR e byte dati)
+bool can_filter_accepts(const CanFilterReport &filter, uint32_t id, bool extended);
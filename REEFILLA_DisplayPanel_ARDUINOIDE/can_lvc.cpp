@@ -0,0 +1,158 @@
+#include "can_lvc.h"
+
+#include <atomic>
+#include <string.h>
+
+// ----------------------------------------------------
+// STRUTTURA DEGLI SLOT
+// ----------------------------------------------------
+
+static_assert((CAN_LVC_SLOTS & (CAN_LVC_SLOTS - 1)) == 0,
+              "CAN_LVC_SLOTS deve essere una potenza di 2");
+
+// Chiave: ID (29 bit) + bit 31 per i frame estesi
+static constexpr uint32_t LVC_KEY_EMPTY = 0xFFFFFFFFUL;
+static constexpr uint32_t LVC_KEY_EXTD  = 0x80000000UL;
+
+// Il payload è tenuto in parole atomiche: il lettore può copiarlo mentre lo
+// scrittore lo sta modificando, il numero di sequenza dice se la copia è buona.
+//   w[0] = dlc + flag RTR (bit 8), w[1..2] = data, w[3..4] = timestamp_us
+struct LvcSlot
+{
+  uint32_t              key = LVC_KEY_EMPTY;   // scritta solo in fase di registrazione
+  std::atomic<uint32_t> seq{0};                // dispari = scrittura in corso
+  std::atomic<uint32_t> w[5];
+};
+
+static LvcSlot s_slots[CAN_LVC_SLOTS];
+
+// ----------------------------------------------------
+// HELPER
+// ----------------------------------------------------
+
+static inline uint32_t lvc_key(uint32_t id, bool extended)
+{
+  return (id & 0x1FFFFFFFUL) | (extended ? LVC_KEY_EXTD : 0);
+}
+
+static inline uint32_t lvc_hash(uint32_t key)
+{
+  // Hash moltiplicativo (Fibonacci): i bit alti sono i più mescolati
+  return (key * 2654435769U) >> 16;
+}
+
+static LvcSlot *lvc_find(uint32_t key)
+{
+  uint32_t idx = lvc_hash(key);
+  for (uint32_t probe = 0; probe < CAN_LVC_SLOTS; ++probe) {
+    LvcSlot &slot = s_slots[(idx + probe) & (CAN_LVC_SLOTS - 1)];
+    if (slot.key == key) {
+      return &slot;
+    }
+    if (slot.key == LVC_KEY_EMPTY) {
+      return nullptr;
+    }
+  }
+  return nullptr;
+}
+
+static inline uint32_t read_u32(const uint8_t *d)
+{
+  uint32_t v;
+  memcpy(&v, d, sizeof(v));
+  return v;
+}
+
+// ----------------------------------------------------
+// API
+// ----------------------------------------------------
+
+bool can_lvc_register(uint32_t id, bool extended)
+{
+  const uint32_t key = lvc_key(id, extended);
+  uint32_t idx = lvc_hash(key);
+
+  for (uint32_t probe = 0; probe < CAN_LVC_SLOTS; ++probe) {
+    LvcSlot &slot = s_slots[(idx + probe) & (CAN_LVC_SLOTS - 1)];
+    if (slot.key == key) {
+      return true;   // già registrato
+    }
+    if (slot.key == LVC_KEY_EMPTY) {
+      slot.key = key;
+      slot.seq.store(0, std::memory_order_relaxed);
+      return true;
+    }
+  }
+  return false;      // tabella piena
+}
+
+bool can_lvc_store(const CanFrame &frame)
+{
+  LvcSlot *slot = lvc_find(lvc_key(frame.id, frame.extended));
+  if (!slot) {
+    return false;
+  }
+
+  // Un solo scrittore: seq dispari durante la copia
+  const uint32_t seq = slot->seq.load(std::memory_order_relaxed);
+  slot->seq.store(seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  slot->w[0].store((uint32_t)frame.dlc | (frame.rtr ? 0x100U : 0U), std::memory_order_relaxed);
+  slot->w[1].store(read_u32(&frame.data[0]), std::memory_order_relaxed);
+  slot->w[2].store(read_u32(&frame.data[4]), std::memory_order_relaxed);
+  slot->w[3].store((uint32_t)frame.timestamp_us, std::memory_order_relaxed);
+  slot->w[4].store((uint32_t)(frame.timestamp_us >> 32), std::memory_order_relaxed);
+
+  slot->seq.store(seq + 2, std::memory_order_release);
+  return true;
+}
+
+bool can_lvc_read(uint32_t id, bool extended, CanFrame &out, uint32_t *seq)
+{
+  const LvcSlot *slot = lvc_find(lvc_key(id, extended));
+  if (!slot) {
+    return false;
+  }
+
+  uint32_t s1, s2;
+  uint32_t w[5];
+  do {
+    s1 = slot->seq.load(std::memory_order_acquire);
+    if (s1 & 1U) {
+      continue;      // scrittura in corso, riprova
+    }
+    for (int i = 0; i < 5; ++i) {
+      w[i] = slot->w[i].load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    s2 = slot->seq.load(std::memory_order_relaxed);
+  } while ((s1 & 1U) || s1 != s2);
+
+  if (s1 == 0) {
+    return false;    // mai ricevuto
+  }
+
+  out.id           = id;
+  out.extended     = extended;
+  out.rtr          = (w[0] & 0x100U) != 0;
+  out.dlc          = (uint8_t)(w[0] & 0xFFU);
+  memcpy(&out.data[0], &w[1], sizeof(uint32_t));
+  memcpy(&out.data[4], &w[2], sizeof(uint32_t));
+  out.timestamp_us = ((uint64_t)w[4] << 32) | w[3];
+  out.timestamp_ms = (uint32_t)(out.timestamp_us / 1000ULL);
+
+  if (seq) {
+    *seq = s1 / 2;
+  }
+  return true;
+}
+
+uint32_t can_lvc_seq(uint32_t id, bool extended)
+{
+  const LvcSlot *slot = lvc_find(lvc_key(id, extended));
+  if (!slot) {
+    return 0;
+  }
+  return slot->seq.load(std::memory_order_acquire) / 2;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stdint.h>
+#include "can_port.h"   // per la struct CanFrame
+
+// ----------------------------------------------------
+// Last-value cache per ID CAN
+// ----------------------------------------------------
+// Per i messaggi periodici di stato conta solo l'ultimo frame: invece di
+// accodarli tutti, il task RX sovrascrive uno slot per ID e i consumatori
+// leggono quando vogliono. Memoria e CPU restano fisse qualunque sia il
+// carico del bus.
+//
+// - tabella a indirizzamento aperto di dimensione fissa (CAN_LVC_SLOTS)
+// - gli ID vanno registrati prima di avviare il task RX
+// - ogni slot ha un numero di sequenza (seqlock): un solo scrittore (task RX),
+//   lettori lock-free su qualunque core
+
+// Numero di slot della tabella (potenza di 2, almeno il doppio degli ID registrati)
+#ifndef CAN_LVC_SLOTS
+#define CAN_LVC_SLOTS  32
+#endif
+
+// Registra un ID da tenere in cache. Solo in fase di init (non thread-safe).
+bool can_lvc_register(uint32_t id, bool extended);
+
+// Sovrascrive lo slot del frame (solo task RX).
+// Ritorna false se l'ID non è registrato: il frame va gestito altrove.
+bool can_lvc_store(const CanFrame &frame);
+
+// Copia l'ultimo frame ricevuto per l'ID.
+// Ritorna false se l'ID non è registrato o non è mai arrivato nulla.
+// Se seq != nullptr ci scrive il numero di aggiornamenti ricevuti finora.
+bool can_lvc_read(uint32_t id, bool extended, CanFrame &out, uint32_t *seq = nullptr);
+
+// Numero di aggiornamenti ricevuti per l'ID (0 = mai ricevuto / non registrato).
+// Lettura economica per capire se c'è qualcosa di nuovo senza copiare il frame.
+uint32_t can_lvc_seq(uint32_t id, bool extended);
@@ -0,0 +1,523 @@
+#include <Arduino.h>
+#include "can_port.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+
+#include <atomic>
+
+#include "spsc_ring.h"
+#include "can_lvc.h"
+#include "can_filter.h"
+#include "can_stats.h"
+#include "can_trace.h"
+#include "dbc_decoder.h"    // usa la logica DBC
+#include "dlog.h"
+#include "rtrace.h"
+#include "task_config.h"    // CAN_RX_TASK_CORE, CAN_RX_TASK_PRIO, CAN_RX_TASK_STACK
+
+// ----------------------------------------------------
+// CONFIGURAZIONE CAN (TWAI)
+// ----------------------------------------------------
+
+// Pin CAN della Waveshare ESP32-S3 4" (TJA1051 on-board)
+#define CAN_RX_PIN  GPIO_NUM_0   // CANRX
+#define CAN_TX_PIN  GPIO_NUM_6   // CANTX
+
+// Bitrate: 250 kbit/s
+#define CAN_TIMING   TWAI_TIMING_CONFIG_250KBITS()
+
+// Dimensione del ring RX interno (tutti i frame che passano da qui).
+// Deve essere una potenza di 2.
+#ifndef CAN_RX_RING_LEN
+#define CAN_RX_RING_LEN  256
+#endif
+
+// 1 = buffer del ring in PSRAM, 0 = RAM interna (più veloce, ma scarsa)
+#ifndef CAN_RX_RING_IN_PSRAM
+#define CAN_RX_RING_IN_PSRAM  0
+#endif
+
+// Frame massimi raccolti dal driver TWAI per ogni risveglio del task RX
+#define CAN_RX_BATCH  16
+
+// Attesa massima del task RX senza frame: anche a bus muto la supervisione
+// dei cycle time (dbc_check_timeouts) gira almeno con questa cadenza
+#ifndef CAN_RX_IDLE_MS
+#define CAN_RX_IDLE_MS  20
+#endif
+
+// Filtro HW: 1 = calcolato dagli ID gestiti dal DBC, 0 = accetta tutto
+// (utile per sniffare/registrare tutto il bus; a runtime: can_port_set_filter_open)
+#ifndef CAN_HW_FILTER
+#define CAN_HW_FILTER  1
+#endif
+
+// Numero massimo di ID considerati per la sintesi del filtro
+#define CAN_FILTER_MAX_IDS  64
+
+// ----------------------------------------------------
+// STATE INTERNI
+// ----------------------------------------------------
+
+static SpscRing<CanFrame> s_can_rx_ring;
+static CanFrame     *s_can_rx_ring_storage  = nullptr;
+static bool          s_can_driver_installed = false;
+static bool          s_can_started          = false;
+static TaskHandle_t  s_can_rx_task_handle   = nullptr;
+
+// Presa sul ring RX: spenta finché nessuno la chiede (can_port_set_tap)
+static std::atomic<bool> s_can_rx_tap{false};
+
+// Task consumatore in attesa dentro can_port_get_frame() (notifica diretta)
+static std::atomic<TaskHandle_t> s_can_rx_waiter{nullptr};
+
+// Filtro HW attivo e filtro in attesa di essere applicato dal task RX
+static twai_filter_config_t s_filter_active  = TWAI_FILTER_CONFIG_ACCEPT_ALL();
+static twai_filter_config_t s_filter_pending = TWAI_FILTER_CONFIG_ACCEPT_ALL();
+static std::atomic<bool>    s_filter_reload{false};
+
+// Filtro HW aperto a runtime (can_port_set_filter_open): accetta tutto
+static std::atomic<bool>    s_filter_open{false};
+
+// ----------------------------------------------------
+// CONFIGURAZIONE DRIVER
+// ----------------------------------------------------
+
+static twai_general_config_t can_general_config()
+{
+  // Modalità NORMAL per dare ACK ma senza trasmettere (non chiamiamo mai twai_transmit)
+  twai_general_config_t g_config =
+      TWAI_GENERAL_CONFIG_DEFAULT(CAN_TX_PIN, CAN_RX_PIN, TWAI_MODE_NORMAL);
+  return g_config;
+}
+
+// Calcola il filtro HW dagli ID che il DBC gestisce davvero
+static twai_filter_config_t can_filter_from_dbc()
+{
+  twai_filter_config_t f_config = TWAI_FILTER_CONFIG_ACCEPT_ALL();
+
+#if CAN_HW_FILTER
+  if (s_filter_open.load())
+  {
+    Serial.println("[can_port] Filtro HW aperto: accetto tutto il bus");
+    return f_config;
+  }
+
+  CanFilterId ids[CAN_FILTER_MAX_IDS];
+  size_t n = dbc_get_handled_ids(ids, CAN_FILTER_MAX_IDS);
+  if (n == 0 || n > CAN_FILTER_MAX_IDS)
+  {
+    Serial.println("[can_port] Filtro HW: set di ID vuoto o troppo grande, accetto tutto");
+    return f_config;
+  }
+
+  CanFilterReport rep;
+  can_filter_synthesize(ids, n, rep);
+
+  f_config.acceptance_code = rep.acceptance_code;
+  f_config.acceptance_mask = rep.acceptance_mask;
+  f_config.single_filter   = rep.single_filter;
+
+  Serial.printf(
+      "[can_port] Filtro HW %s: code=0x%08lX mask=0x%08lX, %lu ID gestiti, "
+      "accettati std=%llu ext=%llu, falsi positivi=%.4f%%\n",
+      rep.single_filter ? "single" : "dual",
+      (unsigned long)rep.acceptance_code,
+      (unsigned long)rep.acceptance_mask,
+      (unsigned long)rep.handled_ids,
+      (unsigned long long)rep.accepted_std,
+      (unsigned long long)rep.accepted_ext,
+      rep.false_accept_rate * 100.0f);
+#endif
+
+  return f_config;
+}
+
+static bool can_filter_equal(const twai_filter_config_t &a, const twai_filter_config_t &b)
+{
+  return a.acceptance_code == b.acceptance_code &&
+         a.acceptance_mask == b.acceptance_mask &&
+         a.single_filter   == b.single_filter;
+}
+
+// Reinstalla il driver con il filtro in attesa. Il TWAI non permette di
+// cambiare filtro a caldo: stop -> uninstall -> install -> start. Se era
+// avviato il chiamante lo ha già fermato (twai_stop) e ne ha svuotato la
+// coda RX, che twai_driver_uninstall() butta via.
+static bool can_driver_reinstall(bool restart)
+{
+  twai_driver_uninstall();
+
+  twai_general_config_t g_config = can_general_config();
+  twai_timing_config_t  t_config = CAN_TIMING;
+  twai_filter_config_t  f_config = s_filter_pending;
+
+  esp_err_t res = twai_driver_install(&g_config, &t_config, &f_config);
+  if (res != ESP_OK)
+  {
+    DLOG("[can_port] reinstallazione TWAI fallita, err = %d\n", (int)res);
+    return false;
+  }
+  s_filter_active = f_config;
+
+  if (restart)
+  {
+    res = twai_start();
+    if (res != ESP_OK)
+    {
+      DLOG("[can_port] twai_start fallita, err = %d\n", (int)res);
+      return false;
+    }
+  }
+  return true;
+}
+
+// ----------------------------------------------------
+// TASK DI RICEZIONE CAN
+// ----------------------------------------------------
+
+static void can_msg_to_frame(const twai_message_t &msg, CanFrame &frame, uint64_t now_us)
+{
+  frame.id           = msg.identifier;
+  frame.extended     = msg.extd;
+  frame.rtr          = msg.rtr;
+  frame.dlc          = msg.data_length_code;
+  frame.timestamp_us = now_us;
+  frame.timestamp_ms = (uint32_t)(now_us / 1000ULL);
+  memset(frame.data, 0, sizeof(frame.data));
+  memcpy(frame.data, msg.data, msg.data_length_code);
+}
+
+// Un batch: attende al massimo wait il primo frame, poi prende quello che
+// il driver ha già in coda, fino a CAN_RX_BATCH. Ritorna i frame gestiti.
+static size_t can_rx_batch(TickType_t wait)
+{
+  CanFrame batch[CAN_RX_BATCH];
+  size_t n = 0;
+
+  twai_message_t msg;
+  esp_err_t res = twai_receive(&msg, wait);
+
+  if (res == ESP_OK)
+  {
+    // Svuotiamo tutto quello che il driver ha già in coda (senza bloccare),
+    // così un burst viene pubblicato sul ring con un solo store
+    do
+    {
+      // Popoliamo il nostro CanFrame "pulito".
+      // Il TWAI non ha timestamp HW: usiamo il clock a 64 bit in µs appena
+      // il frame esce dal driver (per i frame già in coda è l'istante di
+      // prelievo, la differenza finisce nelle statistiche di jitter)
+      CanFrame &frame = batch[n++];
+      can_msg_to_frame(msg, frame, (uint64_t)esp_timer_get_time());
+
+      // Statistiche di inter-arrivo per ID e traccia grezza in PSRAM
+      can_stats_record(frame);
+      can_trace_record(frame);
+
+      // 1) Messaggi di stato: sovrascriviamo lo slot in last-value cache.
+      //    Tutti gli altri passano al DBC: se l'ID è gestito aggiorna lo stato
+      //    (seqlock), pubblica i segnali cambiati sul bus e li accoda al log
+      //    binario (dlog); qui non si stampa niente
+      if (frame.rtr || !can_lvc_store(frame))
+      {
+        RTRACE_BEGIN(RTRACE_EV_CAN_DECODE, frame.id & 0xFFFFU);
+        dbc_handle_frame(frame);
+        RTRACE_END(RTRACE_EV_CAN_DECODE, 0);
+      }
+    } while (n < CAN_RX_BATCH && twai_receive(&msg, 0) == ESP_OK);
+
+    // Una sola decodifica per messaggio di stato per batch, sull'ultimo valore
+    RTRACE_BEGIN(RTRACE_EV_CAN_LATEST, n);
+    dbc_process_latest();
+    RTRACE_END(RTRACE_EV_CAN_LATEST, 0);
+
+    // 2) Copia dei frame grezzi nel ring, solo se qualcuno l'ha chiesta
+    //    (can_port_set_tap). Se il ring è pieno i frame in eccesso vengono
+    //    contati in overflow.
+    if (s_can_rx_tap.load(std::memory_order_relaxed))
+    {
+      s_can_rx_ring.push_n(batch, n);
+
+      TaskHandle_t waiter = s_can_rx_waiter.load(std::memory_order_acquire);
+      if (waiter)
+      {
+        xTaskNotifyGive(waiter);
+      }
+    }
+  }
+  else if (res == ESP_ERR_TIMEOUT)
+  {
+    // Nessun messaggio entro timeout: ok, resta solo la supervisione sotto
+  }
+  else
+  {
+    DLOG_EVERY(1000, "[can_port] twai_receive errore: %d\n", (int)res);
+    vTaskDelay(pdMS_TO_TICKS(100));
+  }
+  return n;
+}
+
+// Un giro del ciclo RX: un batch, poi supervisione e traccia. Ritorna il
+// numero di frame gestiti.
+static size_t can_rx_poll(TickType_t wait)
+{
+  size_t n = 0;
+
+  // Nuovo filtro HW richiesto da can_port_update_filter(): lo applichiamo
+  // qui, dove nessuno sta usando il driver. Prima fermiamo il controller
+  // (niente frame nuovi) e gestiamo tutto quello che è già in coda, poi
+  // reinstalliamo: si perdono solo i frame passati sul bus a driver fermo.
+  if (s_filter_reload.exchange(false))
+  {
+    DLOG("[can_port] Applico nuovo filtro HW\n");
+    twai_stop();
+    size_t k;
+    while ((k = can_rx_batch(0)) > 0)
+    {
+      n += k;
+    }
+    can_driver_reinstall(true);
+  }
+  else
+  {
+    n = can_rx_batch(wait);
+  }
+
+  // Timeout dei messaggi periodici, con o senza frame in questo giro
+  dbc_check_timeouts((uint64_t)esp_timer_get_time());
+
+  // Chiusura del blocco di traccia corrente, se richiesta da un export
+  can_trace_service();
+  return n;
+}
+
+static void can_rx_task(void *arg)
+{
+  (void)arg;
+  Serial.println("[can_port] RX task avviato");
+
+  while (true)
+  {
+    can_rx_poll(pdMS_TO_TICKS(CAN_RX_IDLE_MS));
+  }
+}
+
+size_t can_port_rx_poll(uint32_t timeout_ms)
+{
+  if (!s_can_started)
+    return 0;
+
+  return can_rx_poll(pdMS_TO_TICKS(timeout_ms));
+}
+
+// ----------------------------------------------------
+// INIZIALIZZAZIONE DRIVER CAN (TWAI)
+// ----------------------------------------------------
+
+bool can_port_init()
+{
+  if (s_can_driver_installed)
+  {
+    Serial.println("[can_port] Driver già installato");
+    return true;
+  }
+
+  Serial.println("[can_port] Inizializzo TWAI (CAN) in NORMAL a 250 kbit/s");
+
+  twai_general_config_t g_config = can_general_config();
+
+  // Timing (250 kbit/s)
+  twai_timing_config_t t_config = CAN_TIMING;
+
+  // Filtro HW: il più stretto possibile per gli ID gestiti dal DBC
+  // (il DBC poi filtra comunque per ID esatto)
+  twai_filter_config_t f_config = can_filter_from_dbc();
+
+  esp_err_t res = twai_driver_install(&g_config, &t_config, &f_config);
+  if (res != ESP_OK)
+  {
+    Serial.printf("[can_port] twai_driver_install fallita, err = %d\n", (int)res);
+    return false;
+  }
+
+  s_can_driver_installed = true;
+  s_filter_active        = f_config;
+
+  // Messaggi di stato del DBC in last-value cache (prima che parta il task RX)
+  dbc_init();
+
+  // Registratore di tracce: se manca la PSRAM si prosegue senza
+  if (!can_trace_init())
+  {
+    Serial.println("[can_port] Registrazione tracce disabilitata");
+  }
+
+  // Ring per la presa sui frame grezzi (can_port_set_tap)
+  static_assert((CAN_RX_RING_LEN & (CAN_RX_RING_LEN - 1)) == 0,
+                "CAN_RX_RING_LEN deve essere una potenza di 2");
+
+  const uint32_t caps = CAN_RX_RING_IN_PSRAM ? MALLOC_CAP_SPIRAM
+                                             : (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  s_can_rx_ring_storage = static_cast<CanFrame *>(
+      heap_caps_aligned_alloc(CACHE_LINE_SIZE, CAN_RX_RING_LEN * sizeof(CanFrame), caps));
+  if (!s_can_rx_ring_storage || !s_can_rx_ring.init(s_can_rx_ring_storage, CAN_RX_RING_LEN))
+  {
+    Serial.println("[can_port] ERRORE: impossibile allocare il ring RX");
+    return false;
+  }
+
+  Serial.println("[can_port] Driver installato con successo");
+  return true;
+}
+
+// ----------------------------------------------------
+// AVVIO DRIVER + TASK RX
+// ----------------------------------------------------
+
+bool can_port_start()
+{
+  if (!s_can_driver_installed)
+  {
+    Serial.println("[can_port] ERRORE: can_port_init() non chiamata");
+    return false;
+  }
+
+  if (s_can_started)
+  {
+    Serial.println("[can_port] CAN già avviata");
+    return true;
+  }
+
+  esp_err_t res = twai_start();
+  if (res != ESP_OK)
+  {
+    Serial.printf("[can_port] twai_start fallita, err = %d\n", (int)res);
+    return false;
+  }
+
+  s_can_started = true;
+  Serial.println("[can_port] TWAI avviata, creo task RX");
+
+  BaseType_t task_res = xTaskCreatePinnedToCore(
+      can_rx_task,
+      "can_rx_task",
+      CAN_RX_TASK_STACK,
+      nullptr,
+      CAN_RX_TASK_PRIO,
+      &s_can_rx_task_handle,
+      TASK_CORE_ID(CAN_RX_TASK_CORE)
+  );
+
+  if (task_res != pdPASS)
+  {
+    Serial.println("[can_port] ERRORE: impossibile creare can_rx_task");
+    return false;
+  }
+
+  return true;
+}
+
+// ----------------------------------------------------
+// AGGIORNAMENTO FILTRO HW
+// ----------------------------------------------------
+
+bool can_port_update_filter()
+{
+  if (!s_can_driver_installed)
+  {
+    return false;
+  }
+
+  twai_filter_config_t f_config = can_filter_from_dbc();
+  if (can_filter_equal(f_config, s_filter_active))
+  {
+    return true;   // stesso set di ID: niente da fare
+  }
+
+  s_filter_pending = f_config;
+
+  if (!s_can_started)
+  {
+    // Driver fermo: possiamo reinstallarlo subito
+    return can_driver_reinstall(false);
+  }
+
+  // Driver avviato: lo fa il task RX al prossimo giro (entro il timeout di twai_receive)
+  s_filter_reload.store(true);
+  return true;
+}
+
+bool can_port_set_filter_open(bool open)
+{
+  s_filter_open.store(open);
+  return can_port_update_filter();
+}
+
+bool can_port_filter_is_open()
+{
+  return s_filter_open.load();
+}
+
+// ----------------------------------------------------
+// API PER LEGGERE I MESSAGGI DAL RING
+// ----------------------------------------------------
+
+void can_port_set_tap(bool enabled)
+{
+  s_can_rx_tap.store(enabled, std::memory_order_relaxed);
+}
+
+bool can_port_tap_enabled()
+{
+  return s_can_rx_tap.load(std::memory_order_relaxed);
+}
+
+size_t can_port_drain(CanFrame *out, size_t max)
+{
+  if (!s_can_rx_ring.valid() || !out || max == 0)
+    return 0;
+
+  return s_can_rx_ring.pop_n(out, max);
+}
+
+bool can_port_get_frame(CanFrame &out, uint32_t timeout_ms)
+{
+  if (!s_can_rx_ring.valid())
+    return false;
+
+  if (s_can_rx_ring.pop(out))
+    return true;
+
+  if (timeout_ms == 0)
+    return false;
+
+  // Ci registriamo come consumatore in attesa e ricontrolliamo il ring,
+  // per non perdere una notifica arrivata tra il primo pop e la registrazione
+  s_can_rx_waiter.store(xTaskGetCurrentTaskHandle(), std::memory_order_release);
+
+  // Una notifica rimasta da prima (o data da altri sull'indice 0) sveglia
+  // senza frame nel ring: si riprova fino alla scadenza
+  const TickType_t start = xTaskGetTickCount();
+  const TickType_t ticks = pdMS_TO_TICKS(timeout_ms);
+  bool got = s_can_rx_ring.pop(out);
+  while (!got)
+  {
+    const TickType_t elapsed = xTaskGetTickCount() - start;
+    if (elapsed >= ticks)
+      break;
+    ulTaskNotifyTake(pdTRUE, ticks - elapsed);
+    got = s_can_rx_ring.pop(out);
+  }
+
+  s_can_rx_waiter.store(nullptr, std::memory_order_release);
+  return got;
+}
+
+uint32_t can_port_get_overflow_count()
+{
+  return s_can_rx_ring.overflow_count();
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <Arduino.h>
+#include "driver/twai.h"
+
+// Frame CAN "pulito" usato dal resto del codice
+struct CanFrame
+{
+  uint32_t id;
+  bool     extended;
+  bool     rtr;
+  uint8_t  dlc;
+  uint8_t  data[8];
+  uint32_t timestamp_ms;   // millis() alla ricezione (= timestamp_us / 1000)
+  uint64_t timestamp_us;   // esp_timer a 64 bit, in microsecondi
+};
+
+// Inizializza il driver CAN (TWAI) a 250 kbit/s
+bool can_port_init();
+
+// Avvia il driver e crea il task RX
+bool can_port_start();
+
+// Esegue un solo giro del ciclo RX nel task chiamante (attesa max timeout_ms).
+// Sul device lo usa solo can_rx_task; serve al driver di replay su host,
+// dove il task RX non viene creato. Ritorna i frame gestiti.
+size_t can_port_rx_poll(uint32_t timeout_ms);
+
+// Ricalcola il filtro HW di accettazione dagli ID gestiti dal DBC
+// (dbc_get_handled_ids) e, se è cambiato, reinstalla il driver.
+// Da chiamare quando cambia l'insieme dei messaggi gestiti. A driver
+// avviato la reinstallazione la fa il task RX al giro successivo, dopo aver
+// gestito i frame già in coda.
+bool can_port_update_filter();
+
+// Filtro HW aperto (accetta tutto il bus, come CAN_HW_FILTER=0) o di nuovo
+// calcolato dal DBC: per registrare con la traccia CAN e vedere nelle
+// statistiche anche i messaggi che il decoder non gestisce (comando 'a').
+bool can_port_set_filter_open(bool open);
+bool can_port_filter_is_open();
+
+// ----------------------------------------------------
+// Presa sui frame grezzi (ring SPSC, spsc_ring.h)
+// ----------------------------------------------------
+// Il firmware non ne ha bisogno: decodifica, statistiche e traccia lavorano
+// nel task RX. Il ring è una presa per un eventuale consumatore (logger,
+// inoltro): spenta di default, nessuna copia e nessun overflow finché un
+// solo task consumatore non la accende e la svuota con le funzioni sotto.
+// Accesa senza nessuno che legga, dopo CAN_RX_RING_LEN frame ogni frame
+// finisce in overflow: il contatore ha senso solo con un consumatore.
+void can_port_set_tap(bool enabled);
+bool can_port_tap_enabled();
+
+// Legge un messaggio dal ring interno (solo messaggi filtrati/gestiti)
+// timeout_ms = 0 -> non blocca, altrimenti aspetta un frame fino a
+// timeout_ms anche se nel frattempo arrivano altre notifiche.
+// Un solo task consumatore: l'attesa usa la task notification (indice 0,
+// azzerata a ogni risveglio), quindi il consumatore non deve essere un task
+// svegliato anche dal bus dei segnali o dai comandi UI.
+bool can_port_get_frame(CanFrame &out, uint32_t timeout_ms = 0);
+
+// Estrae in un colpo fino a max frame dal ring interno (non blocca).
+// Ritorna il numero di frame copiati in out.
+size_t can_port_drain(CanFrame *out, size_t max);
+
+// Frame scartati perché il ring RX era pieno (dall'avvio, solo a presa accesa)
+uint32_t can_port_get_overflow_count();
\ No newline at end of file
@@ -0,0 +1,256 @@
+#include "can_stats.h"
+
+#include <atomic>
+#include <math.h>
+#include <string.h>
+
+#include "seqlock.h"
+
+static_assert((CAN_STATS_SLOTS & (CAN_STATS_SLOTS - 1)) == 0,
+              "CAN_STATS_SLOTS deve essere una potenza di 2");
+
+// ----------------------------------------------------
+// TABELLA
+// ----------------------------------------------------
+
+// Chiave: ID (29 bit) + bit 31 per i frame estesi
+static constexpr uint32_t STATS_KEY_EMPTY = 0xFFFFFFFFUL;
+static constexpr uint32_t STATS_KEY_EXTD  = 0x80000000UL;
+
+// Il task RX aggiorna la sua copia di lavoro e la pubblica nel seqlock a
+// ogni frame: i lettori copiano solo dal seqlock (parole atomiche), mai
+// dalla copia di lavoro
+struct StatsSlot
+{
+  std::atomic<uint32_t> key{STATS_KEY_EMPTY};   // scritta solo dal task RX
+  Seqlock<CanIdStats>   pub;                    // copia per i lettori
+  // Solo task RX
+  CanIdStats            st;
+  double                m2;       // somma dei quadrati degli scarti (Welford)
+  double                mean;     // media del periodo in doppia precisione
+};
+
+static StatsSlot             s_slots[CAN_STATS_SLOTS];
+static std::atomic<uint32_t> s_tracked{0};
+static std::atomic<uint32_t> s_untracked_frames{0};
+
+// Azzeramenti chiesti (can_stats_reset) ed eseguiti dal task RX: se
+// differiscono la tabella è già vuota per i lettori
+static std::atomic<uint32_t> s_reset_requested{0};
+static std::atomic<uint32_t> s_reset_done{0};
+
+static inline bool reset_pending()
+{
+  return s_reset_requested.load(std::memory_order_acquire) !=
+         s_reset_done.load(std::memory_order_acquire);
+}
+
+static inline uint32_t stats_key(uint32_t id, bool extended)
+{
+  return (id & 0x1FFFFFFFUL) | (extended ? STATS_KEY_EXTD : 0);
+}
+
+static inline uint32_t stats_hash(uint32_t key)
+{
+  return (key * 2654435769U) >> 16;
+}
+
+// Cerca lo slot; se create == true inserisce la chiave (solo task RX)
+static StatsSlot *stats_find(uint32_t key, bool create)
+{
+  const uint32_t idx = stats_hash(key);
+  for (uint32_t probe = 0; probe < CAN_STATS_SLOTS; ++probe) {
+    StatsSlot &slot = s_slots[(idx + probe) & (CAN_STATS_SLOTS - 1)];
+    const uint32_t k = slot.key.load(std::memory_order_acquire);
+    if (k == key) {
+      return &slot;
+    }
+    if (k == STATS_KEY_EMPTY) {
+      if (!create) {
+        return nullptr;
+      }
+      // Lasciamo una casella libera: la ricerca si ferma sempre
+      if (s_tracked.load(std::memory_order_relaxed) >= CAN_STATS_SLOTS - 1) {
+        return nullptr;
+      }
+      slot.key.store(key, std::memory_order_release);
+      s_tracked.fetch_add(1, std::memory_order_relaxed);
+      return &slot;
+    }
+  }
+  return nullptr;
+}
+
+static inline uint32_t log2_bucket(uint32_t v)
+{
+  if (v == 0) {
+    return 0;
+  }
+  const uint32_t b = 32U - (uint32_t)__builtin_clz(v);
+  return (b < CAN_STATS_HIST_BUCKETS) ? b : CAN_STATS_HIST_BUCKETS - 1;
+}
+
+// Svuota tutta la tabella, copia di lavoro compresa: un ID che torna dopo
+// l'azzeramento riparte da count = 1, senza il buco come primo periodo
+static void stats_clear_all()
+{
+  for (StatsSlot &slot : s_slots) {
+    if (slot.key.load(std::memory_order_relaxed) == STATS_KEY_EMPTY) {
+      continue;
+    }
+    memset(&slot.st, 0, sizeof(slot.st));
+    slot.m2   = 0.0;
+    slot.mean = 0.0;
+    slot.pub.publish(slot.st);
+    slot.key.store(STATS_KEY_EMPTY, std::memory_order_release);
+  }
+  s_tracked.store(0, std::memory_order_relaxed);
+  s_untracked_frames.store(0, std::memory_order_relaxed);
+}
+
+// ----------------------------------------------------
+// AGGIORNAMENTO (task RX)
+// ----------------------------------------------------
+
+void can_stats_record(const CanFrame &frame)
+{
+  const uint32_t reset = s_reset_requested.load(std::memory_order_acquire);
+  if (reset != s_reset_done.load(std::memory_order_relaxed)) {
+    stats_clear_all();
+    s_reset_done.store(reset, std::memory_order_release);
+  }
+
+  const uint32_t key = stats_key(frame.id, frame.extended);
+  StatsSlot *slot = stats_find(key, true);
+  if (!slot) {
+    s_untracked_frames.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  CanIdStats &st = slot->st;
+  const uint64_t now = frame.timestamp_us;
+
+  if (st.count == 0 || st.id != frame.id || st.extended != frame.extended) {
+    memset(&st, 0, sizeof(st));
+    st.id            = frame.id;
+    st.extended      = frame.extended;
+    st.first_us      = now;
+    st.period_min_us = UINT32_MAX;
+    slot->m2   = 0.0;
+    slot->mean = 0.0;
+  } else {
+    const uint64_t dt64 = now - st.last_us;
+    const uint32_t dt   = (dt64 > UINT32_MAX) ? UINT32_MAX : (uint32_t)dt64;
+
+    if (dt < st.period_min_us) st.period_min_us = dt;
+    if (dt > st.period_max_us) st.period_max_us = dt;
+
+    // Welford sui periodi (count - 1 periodi dopo questo frame)
+    const uint32_t n     = st.count;   // numero di periodi incluso questo
+    const double   delta = (double)dt - slot->mean;
+    slot->mean += delta / (double)n;
+    slot->m2   += delta * ((double)dt - slot->mean);
+
+    st.period_mean_us = (float)slot->mean;
+    st.jitter_us      = (n > 1) ? (float)sqrt(slot->m2 / (double)(n - 1)) : 0.0f;
+
+    const double dev = fabs((double)dt - slot->mean);
+    st.hist[log2_bucket(dev > UINT32_MAX ? UINT32_MAX : (uint32_t)dev)]++;
+  }
+
+  st.last_us = now;
+  st.count++;
+
+  slot->pub.publish(st);
+}
+
+// ----------------------------------------------------
+// LETTURA (qualunque task)
+// ----------------------------------------------------
+
+// Copia consistente di uno slot (seqlock). False se lo slot è vuoto.
+static bool stats_copy(const StatsSlot &slot, CanIdStats &out)
+{
+  if (slot.key.load(std::memory_order_acquire) == STATS_KEY_EMPTY) {
+    return false;
+  }
+  slot.pub.read(out);
+  return out.count != 0;
+}
+
+bool can_stats_get(uint32_t id, bool extended, CanIdStats &out)
+{
+  if (reset_pending()) {
+    return false;
+  }
+  const StatsSlot *slot = stats_find(stats_key(id, extended), false);
+  return slot && stats_copy(*slot, out);
+}
+
+size_t can_stats_snapshot(CanIdStats *out, size_t max)
+{
+  size_t n = 0;
+  if (reset_pending()) {
+    return 0;
+  }
+  for (const StatsSlot &slot : s_slots) {
+    if (n >= max) {
+      break;
+    }
+    if (stats_copy(slot, out[n])) {
+      ++n;
+    }
+  }
+  return n;
+}
+
+CanStatsSummary can_stats_summary()
+{
+  CanStatsSummary sum = {};
+  if (reset_pending()) {
+    return sum;
+  }
+  sum.tracked_ids      = s_tracked.load(std::memory_order_relaxed);
+  sum.untracked_frames = s_untracked_frames.load(std::memory_order_relaxed);
+  return sum;
+}
+
+void can_stats_reset()
+{
+  s_reset_requested.fetch_add(1, std::memory_order_acq_rel);
+}
+
+void can_stats_dump(Print &out)
+{
+  const CanStatsSummary sum = can_stats_summary();
+  out.printf("[can_stats] %lu ID, %lu frame non tracciati\n",
+             (unsigned long)sum.tracked_ids,
+             (unsigned long)sum.untracked_frames);
+  out.printf("[can_stats] ID        n       T_ms    min_ms  max_ms  jit_ms  hist(log2 us: k=n)\n");
+  if (reset_pending()) {
+    return;
+  }
+
+  for (const StatsSlot &slot : s_slots) {
+    CanIdStats st;
+    if (!stats_copy(slot, st)) {
+      continue;
+    }
+
+    out.printf("[can_stats] %08lX%c %-7lu %-7.2f %-7.2f %-7.2f %-7.3f",
+               (unsigned long)st.id,
+               st.extended ? 'x' : ' ',
+               (unsigned long)st.count,
+               st.period_mean_us / 1000.0f,
+               (st.count > 1) ? st.period_min_us / 1000.0f : 0.0f,
+               st.period_max_us / 1000.0f,
+               st.jitter_us / 1000.0f);
+
+    for (uint32_t k = 0; k < CAN_STATS_HIST_BUCKETS; ++k) {
+      if (st.hist[k]) {
+        out.printf(" %lu=%lu", (unsigned long)k, (unsigned long)st.hist[k]);
+      }
+    }
+    out.printf("\n");
+  }
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <Arduino.h>
+#include "can_port.h"   // per la struct CanFrame
+
+// ----------------------------------------------------
+// Statistiche di inter-arrivo per ID CAN
+// ----------------------------------------------------
+// Aggiornate dal task RX su ogni frame (timestamp in µs), in una tabella di
+// dimensione fissa. Servono a vedere cycle time reali, jitter del bus e
+// ritardi di scheduling del task RX senza un analizzatore esterno.
+
+// Numero di ID tracciati (potenza di 2); gli ID oltre il limite sono contati
+// in CanStatsSummary::untracked_frames
+#ifndef CAN_STATS_SLOTS
+#define CAN_STATS_SLOTS  64
+#endif
+
+// Bucket dell'istogramma log2: bucket k = scarto dal periodo medio in
+// [2^(k-1), 2^k) µs (bucket 0 = scarto < 1 µs, ultimo = tutto il resto)
+#define CAN_STATS_HIST_BUCKETS  24
+
+struct CanIdStats
+{
+  uint32_t id;
+  bool     extended;
+  uint32_t count;            // frame ricevuti
+  uint64_t first_us;         // timestamp del primo frame
+  uint64_t last_us;          // timestamp dell'ultimo frame
+  uint32_t period_min_us;    // periodo minimo osservato
+  uint32_t period_max_us;    // periodo massimo osservato
+  float    period_mean_us;   // periodo medio (Welford)
+  float    jitter_us;        // deviazione standard del periodo
+  uint32_t hist[CAN_STATS_HIST_BUCKETS]; // |periodo - media| in log2 µs
+};
+
+struct CanStatsSummary
+{
+  uint32_t tracked_ids;      // ID presenti in tabella
+  uint32_t untracked_frames; // frame di ID che non stavano più in tabella
+};
+
+// Aggiorna le statistiche con un frame (solo task RX)
+void can_stats_record(const CanFrame &frame);
+
+// Copia le statistiche di un ID. False se l'ID non è mai stato visto.
+bool can_stats_get(uint32_t id, bool extended, CanIdStats &out);
+
+// Copia le statistiche di tutti gli ID tracciati (fino a max).
+// Ritorna il numero di elementi scritti.
+size_t can_stats_snapshot(CanIdStats *out, size_t max);
+
+// Riepilogo globale della tabella
+CanStatsSummary can_stats_summary();
+
+// Azzera la tabella. Da subito letture e stampe la vedono vuota; il task RX
+// la svuota davvero al frame successivo (anche a bus fermo).
+void can_stats_reset();
+
+// Stampa compatta: una riga per ID
+void can_stats_dump(Print &out);
@@ -0,0 +1,331 @@
+#include "can_trace.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_heap_caps.h"
+#include "esp_partition.h"
+
+#include <atomic>
+#include <string.h>
+
+// ----------------------------------------------------
+// STATO
+// ----------------------------------------------------
+
+// Cache dell'encoder per il dizionario degli ID: mappa diretta chiave -> indice.
+// Una collisione costa solo un ID letterale in più (il decoder lo riaggiunge).
+#define TRACE_DICT_CACHE  64
+
+struct DictEntry
+{
+  uint32_t key;   // ID | bit 31 per gli estesi
+  uint32_t gen;   // blocco in cui la voce è valida
+  uint8_t  idx;
+};
+
+static uint8_t *s_blocks = nullptr;            // ring in PSRAM
+
+// Sequenza dei blocchi: 0 = in scrittura/vuoto, altrimenti seq del blocco chiuso.
+// Sta in RAM interna e fa da seqlock per chi copia i blocchi.
+static std::atomic<uint32_t> s_block_seq[CAN_TRACE_BLOCKS];
+
+static std::atomic<bool> s_enabled{false};
+static std::atomic<bool> s_seal_request{false};
+
+// Stato del writer (solo task RX)
+static uint32_t  s_cur_block  = 0;
+static uint32_t  s_next_seq   = 1;
+static uint8_t  *s_cur        = nullptr;       // inizio del blocco corrente
+static uint16_t  s_used       = 0;
+static uint16_t  s_count      = 0;
+static uint64_t  s_base_us    = 0;
+static uint64_t  s_last_us    = 0;
+static uint32_t  s_dict_count = 0;
+static DictEntry s_dict_cache[TRACE_DICT_CACHE];
+
+// Contatori
+static std::atomic<uint32_t> s_blocks_sealed{0};
+static std::atomic<uint32_t> s_frames_recorded{0};
+static std::atomic<uint64_t> s_bytes_recorded{0};
+
+// Buffer di copia per l'export (un export alla volta)
+static uint8_t s_export_buf[CAN_TRACE_BLOCK_SIZE];
+
+// ----------------------------------------------------
+// GESTIONE BLOCCHI (task RX)
+// ----------------------------------------------------
+
+static void trace_open_block(uint64_t base_us)
+{
+  // Il blocco diventa "in scrittura" prima di toccarne il contenuto
+  s_block_seq[s_cur_block].store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  s_cur        = s_blocks + (size_t)s_cur_block * CAN_TRACE_BLOCK_SIZE;
+  s_used       = 0;
+  s_count      = 0;
+  s_base_us    = base_us;
+  s_last_us    = base_us;
+  s_dict_count = 0;
+}
+
+static void trace_seal_block()
+{
+  if (s_count == 0) {
+    return;
+  }
+
+  CanTraceBlockHeader hdr;
+  hdr.magic    = CAN_TRACE_MAGIC;
+  hdr.seq      = s_next_seq++;
+  hdr.base_us  = s_base_us;
+  hdr.used     = s_used;
+  hdr.count    = s_count;
+  hdr.reserved = 0;
+  memcpy(s_cur, &hdr, sizeof(hdr));
+
+  // Padding a zero: blocchi deterministici anche su flash
+  memset(s_cur + sizeof(hdr) + s_used, 0, CAN_TRACE_PAYLOAD_SIZE - s_used);
+
+  s_block_seq[s_cur_block].store(hdr.seq, std::memory_order_release);
+  s_blocks_sealed.fetch_add(1, std::memory_order_relaxed);
+
+  s_cur_block = (s_cur_block + 1) % CAN_TRACE_BLOCKS;
+  trace_open_block(s_last_us);
+}
+
+static inline uint32_t dict_slot(uint32_t key)
+{
+  return ((key * 2654435769U) >> 16) & (TRACE_DICT_CACHE - 1);
+}
+
+// ----------------------------------------------------
+// API
+// ----------------------------------------------------
+
+bool can_trace_init()
+{
+  if (s_blocks) {
+    return true;
+  }
+
+  s_blocks = static_cast<uint8_t *>(heap_caps_aligned_alloc(
+      16, (size_t)CAN_TRACE_BLOCKS * CAN_TRACE_BLOCK_SIZE, MALLOC_CAP_SPIRAM));
+  if (!s_blocks) {
+    Serial.println("[can_trace] ERRORE: PSRAM insufficiente per il ring");
+    return false;
+  }
+
+  for (uint32_t i = 0; i < CAN_TRACE_BLOCKS; ++i) {
+    s_block_seq[i].store(0, std::memory_order_relaxed);
+  }
+  memset(s_dict_cache, 0, sizeof(s_dict_cache));
+  s_cur_block = 0;
+  trace_open_block(0);
+
+  s_enabled.store(true, std::memory_order_release);
+  Serial.printf("[can_trace] Ring di %u blocchi da %u byte in PSRAM\n",
+                (unsigned)CAN_TRACE_BLOCKS, (unsigned)CAN_TRACE_BLOCK_SIZE);
+  return true;
+}
+
+void can_trace_set_enabled(bool enabled)
+{
+  s_enabled.store(enabled && s_blocks != nullptr, std::memory_order_release);
+}
+
+void can_trace_record(const CanFrame &frame)
+{
+  if (!s_enabled.load(std::memory_order_relaxed)) {
+    return;
+  }
+
+  if (s_count == 0) {
+    s_base_us = frame.timestamp_us;
+    s_last_us = frame.timestamp_us;
+  }
+
+  // Delta troppo grande (o timestamp all'indietro): si riparte con un blocco nuovo
+  uint64_t delta = frame.timestamp_us - s_last_us;
+  if (frame.timestamp_us < s_last_us || delta > UINT32_MAX ||
+      s_count == UINT16_MAX ||
+      (size_t)s_used + CAN_TRACE_REC_MAX > CAN_TRACE_PAYLOAD_SIZE) {
+    trace_seal_block();
+    s_base_us = frame.timestamp_us;
+    s_last_us = frame.timestamp_us;
+    delta = 0;
+  }
+
+  uint8_t *p     = s_cur + sizeof(CanTraceBlockHeader) + s_used;
+  uint8_t *start = p;
+
+  const uint8_t len = frame.dlc > 8 ? 8 : frame.dlc;
+  uint8_t flags = (frame.dlc & CAN_TRACE_F_DLC_MASK);
+  if (frame.extended) flags |= CAN_TRACE_F_EXT;
+  if (frame.rtr)      flags |= CAN_TRACE_F_RTR;
+
+  // ID: indice di dizionario se già visto in questo blocco, altrimenti letterale
+  const uint32_t key  = (frame.id & 0x1FFFFFFFUL) | (frame.extended ? 0x80000000UL : 0);
+  const uint32_t gen  = s_next_seq;   // identifica il blocco corrente
+  DictEntry     &slot = s_dict_cache[dict_slot(key)];
+  const bool     hit  = slot.gen == gen && slot.key == key;
+
+  if (!hit) {
+    flags |= CAN_TRACE_F_NEW_ID;
+  }
+  *p++ = flags;
+  p += can_trace_put_varint(p, (uint32_t)delta);
+
+  if (hit) {
+    *p++ = slot.idx;
+  } else {
+    p += can_trace_put_varint(p, frame.id & 0x1FFFFFFFUL);
+    if (s_dict_count < CAN_TRACE_DICT_MAX) {
+      slot.key = key;
+      slot.gen = gen;
+      slot.idx = (uint8_t)s_dict_count++;
+    }
+  }
+
+  memcpy(p, frame.data, len);
+  p += len;
+
+  s_used    += (uint16_t)(p - start);
+  s_count++;
+  s_last_us  = frame.timestamp_us;
+
+  s_frames_recorded.fetch_add(1, std::memory_order_relaxed);
+  s_bytes_recorded.fetch_add((uint64_t)(p - start), std::memory_order_relaxed);
+}
+
+void can_trace_service()
+{
+  if (s_seal_request.load(std::memory_order_acquire)) {
+    if (s_blocks) {
+      trace_seal_block();
+    }
+    s_seal_request.store(false, std::memory_order_release);
+  }
+}
+
+CanTraceInfo can_trace_get_info()
+{
+  CanTraceInfo info;
+  info.blocks_total    = CAN_TRACE_BLOCKS;
+  info.blocks_sealed   = s_blocks_sealed.load(std::memory_order_relaxed);
+  info.frames_recorded = s_frames_recorded.load(std::memory_order_relaxed);
+  info.bytes_recorded  = s_bytes_recorded.load(std::memory_order_relaxed);
+  info.enabled         = s_enabled.load(std::memory_order_relaxed);
+  return info;
+}
+
+// ----------------------------------------------------
+// EXPORT
+// ----------------------------------------------------
+
+size_t can_trace_export(CanTraceSink sink, void *ctx, uint32_t wait_ms)
+{
+  if (!s_blocks || !sink) {
+    return 0;
+  }
+
+  // Facciamo chiudere al task RX il blocco in corso (gira almeno ogni secondo)
+  s_seal_request.store(true, std::memory_order_release);
+  const uint32_t t0 = millis();
+  while (s_seal_request.load(std::memory_order_acquire) && millis() - t0 < wait_ms) {
+    vTaskDelay(pdMS_TO_TICKS(10));
+  }
+
+  // Blocco con la seq più bassa = il più vecchio ancora presente
+  uint32_t oldest = 0;
+  uint32_t oldest_seq = UINT32_MAX;
+  for (uint32_t i = 0; i < CAN_TRACE_BLOCKS; ++i) {
+    const uint32_t seq = s_block_seq[i].load(std::memory_order_acquire);
+    if (seq != 0 && seq < oldest_seq) {
+      oldest_seq = seq;
+      oldest = i;
+    }
+  }
+  if (oldest_seq == UINT32_MAX) {
+    return 0;
+  }
+
+  size_t exported = 0;
+  uint32_t last_seq = 0;
+  for (uint32_t k = 0; k < CAN_TRACE_BLOCKS; ++k) {
+    const uint32_t i = (oldest + k) % CAN_TRACE_BLOCKS;
+
+    // Copia sotto seqlock: se il writer riusa il blocco nel frattempo lo saltiamo
+    const uint32_t s1 = s_block_seq[i].load(std::memory_order_acquire);
+    if (s1 == 0 || s1 <= last_seq) {
+      continue;
+    }
+    memcpy(s_export_buf, s_blocks + (size_t)i * CAN_TRACE_BLOCK_SIZE, CAN_TRACE_BLOCK_SIZE);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint32_t s2 = s_block_seq[i].load(std::memory_order_relaxed);
+    if (s1 != s2) {
+      continue;
+    }
+
+    last_seq = s1;
+    if (!sink(s_export_buf, CAN_TRACE_BLOCK_SIZE, ctx)) {
+      break;
+    }
+    ++exported;
+  }
+  return exported;
+}
+
+static bool serial_sink(const uint8_t *block, size_t len, void *ctx)
+{
+  Print *out = static_cast<Print *>(ctx);
+  return out->write(block, len) == len;
+}
+
+size_t can_trace_dump_serial(Print &out)
+{
+  out.printf("\nCTRDUMP BEGIN %u\n", (unsigned)CAN_TRACE_BLOCK_SIZE);
+  const size_t n = can_trace_export(serial_sink, &out);
+  out.printf("\nCTRDUMP END %u\n", (unsigned)n);
+  return n;
+}
+
+struct PartitionSinkCtx
+{
+  const esp_partition_t *part;
+  size_t                 offset;
+};
+
+static bool partition_sink(const uint8_t *block, size_t len, void *ctx)
+{
+  PartitionSinkCtx *pc = static_cast<PartitionSinkCtx *>(ctx);
+  if (pc->offset + len > pc->part->size) {
+    return false;   // partizione piena
+  }
+  if (esp_partition_write(pc->part, pc->offset, block, len) != ESP_OK) {
+    return false;
+  }
+  pc->offset += len;
+  return true;
+}
+
+bool can_trace_write_partition()
+{
+  const esp_partition_t *part = esp_partition_find_first(
+      ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, CAN_TRACE_PARTITION);
+  if (!part) {
+    Serial.println("[can_trace] ERRORE: partizione " CAN_TRACE_PARTITION " non trovata");
+    return false;
+  }
+
+  // Cancelliamo tutta la partizione: i blocchi vuoti (0xFF) non hanno il magic
+  if (esp_partition_erase_range(part, 0, part->size) != ESP_OK) {
+    Serial.println("[can_trace] ERRORE: cancellazione partizione fallita");
+    return false;
+  }
+
+  PartitionSinkCtx ctx = { part, 0 };
+  const size_t n = can_trace_export(partition_sink, &ctx);
+  Serial.printf("[can_trace] %u blocchi scritti su " CAN_TRACE_PARTITION "\n", (unsigned)n);
+  return true;
+}
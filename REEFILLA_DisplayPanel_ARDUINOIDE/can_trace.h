@@ -0,0 +1,63 @@
+#pragma once
+
+#include <Arduino.h>
+#include "can_port.h"          // per la struct CanFrame
+#include "can_trace_format.h"
+
+// ----------------------------------------------------
+// Registratore di tracce CAN in PSRAM
+// ----------------------------------------------------
+// Il task RX accoda ogni frame grezzo in un ring di blocchi da 4 KB in PSRAM
+// (formato compatto, vedi can_trace_format.h). Quando il ring è pieno si
+// sovrascrive il blocco più vecchio. I blocchi chiusi si possono scaricare
+// da seriale o scrivere su una partizione flash (blocchi allineati da 4 KB,
+// come i settori della flash).
+
+// Numero di blocchi nel ring (CAN_TRACE_BLOCKS * 4 KB di PSRAM)
+#ifndef CAN_TRACE_BLOCKS
+#define CAN_TRACE_BLOCKS  512
+#endif
+
+// Partizione dati usata da can_trace_write_partition() (da aggiungere al
+// partitions.csv, es. "cantrace, data, 0x40, , 2M")
+#ifndef CAN_TRACE_PARTITION
+#define CAN_TRACE_PARTITION  "cantrace"
+#endif
+
+struct CanTraceInfo
+{
+  uint32_t blocks_total;      // blocchi del ring
+  uint32_t blocks_sealed;     // blocchi chiusi dall'avvio
+  uint32_t frames_recorded;   // frame scritti dall'avvio
+  uint64_t bytes_recorded;    // byte di record scritti dall'avvio
+  bool     enabled;
+};
+
+// Callback per l'export: riceve un blocco alla volta, in ordine cronologico.
+// Ritorna false per interrompere.
+typedef bool (*CanTraceSink)(const uint8_t *block, size_t len, void *ctx);
+
+// Alloca il ring in PSRAM. False se manca memoria.
+bool can_trace_init();
+
+// Abilita/disabilita la registrazione (default: abilitata dopo init)
+void can_trace_set_enabled(bool enabled);
+
+// Accoda un frame (solo task RX)
+void can_trace_record(const CanFrame &frame);
+
+// Da chiamare nel task RX anche quando il bus è fermo: chiude il blocco
+// corrente se qualcuno ha chiesto un export
+void can_trace_service();
+
+CanTraceInfo can_trace_get_info();
+
+// Chiede la chiusura del blocco corrente (attende al massimo wait_ms) e passa
+// al sink tutti i blocchi chiusi, dal più vecchio. Ritorna i blocchi esportati.
+size_t can_trace_export(CanTraceSink sink, void *ctx, uint32_t wait_ms = 1500);
+
+// Dump binario su seriale: riga "CTRDUMP BEGIN", blocchi grezzi, riga "CTRDUMP END <n>"
+size_t can_trace_dump_serial(Print &out);
+
+// Scrive i blocchi sulla partizione CAN_TRACE_PARTITION (cancellandola prima)
+bool can_trace_write_partition();
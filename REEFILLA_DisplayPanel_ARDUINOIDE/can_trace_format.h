@@ -0,0 +1,182 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// ----------------------------------------------------
+// Formato binario delle tracce CAN (condiviso firmware / host)
+// ----------------------------------------------------
+// La traccia è una sequenza di blocchi da CAN_TRACE_BLOCK_SIZE byte,
+// indipendenti tra loro (si possono decodificare in qualunque ordine e in
+// parallelo). Ogni blocco:
+//
+//   CanTraceBlockHeader (24 byte, little endian)
+//   record... (header.used byte)
+//   padding fino a CAN_TRACE_BLOCK_SIZE
+//
+// Record (da 3 a CAN_TRACE_REC_MAX byte):
+//   byte 0 : dlc (bit 0-3) | EXT (bit 4) | RTR (bit 5) | NEW_ID (bit 6)
+//   varint : delta timestamp in µs dal record precedente (dal base_us per il primo)
+//   ID     : NEW_ID = 1 -> varint con l'ID (entra nel dizionario se c'è posto)
+//            NEW_ID = 0 -> 1 byte, indice nel dizionario del blocco
+//   dati   : dlc byte (max 8)
+//
+// Il dizionario degli ID riparte vuoto a ogni blocco: un frame periodico
+// da 8 byte costa 1 + 1..2 + 1 + 8 = 11-12 byte invece di sizeof(CanFrame).
+
+#define CAN_TRACE_BLOCK_SIZE  4096
+#define CAN_TRACE_MAGIC       0x31525443UL   // "CTR1" in little endian
+#define CAN_TRACE_DICT_MAX    255            // voci massime del dizionario per blocco
+#define CAN_TRACE_REC_MAX     19             // 1 + varint32 (5) + varint32 (5) + 8
+
+#define CAN_TRACE_F_DLC_MASK  0x0F
+#define CAN_TRACE_F_EXT       0x10
+#define CAN_TRACE_F_RTR       0x20
+#define CAN_TRACE_F_NEW_ID    0x40
+
+struct CanTraceBlockHeader
+{
+  uint32_t magic;     // CAN_TRACE_MAGIC
+  uint32_t seq;       // numero progressivo del blocco (da 1)
+  uint64_t base_us;   // timestamp di riferimento del primo record
+  uint16_t used;      // byte di record dopo l'header
+  uint16_t count;     // numero di record
+  uint32_t reserved;  // 0
+};
+
+static_assert(sizeof(CanTraceBlockHeader) == 24, "header traccia: layout inatteso");
+
+#define CAN_TRACE_PAYLOAD_SIZE  (CAN_TRACE_BLOCK_SIZE - sizeof(CanTraceBlockHeader))
+
+// Record decodificato: data punta dentro il blocco (nessuna copia)
+struct CanTraceRecord
+{
+  uint64_t       timestamp_us;
+  uint32_t       id;
+  bool           extended;
+  bool           rtr;
+  uint8_t        dlc;
+  const uint8_t *data;
+};
+
+// ----------------------------------------------------
+// Varint (LEB128, 7 bit per byte)
+// ----------------------------------------------------
+
+static inline size_t can_trace_put_varint(uint8_t *p, uint32_t v)
+{
+  size_t n = 0;
+  while (v >= 0x80U) {
+    p[n++] = (uint8_t)(v | 0x80U);
+    v >>= 7;
+  }
+  p[n++] = (uint8_t)v;
+  return n;
+}
+
+static inline bool can_trace_get_varint(const uint8_t *&p, const uint8_t *end, uint32_t &v)
+{
+  uint32_t result = 0;
+  for (uint32_t shift = 0; shift < 35 && p < end; shift += 7) {
+    const uint8_t b = *p++;
+    result |= (uint32_t)(b & 0x7FU) << shift;
+    if ((b & 0x80U) == 0) {
+      v = result;
+      return true;
+    }
+  }
+  return false;
+}
+
+// ----------------------------------------------------
+// Validazione header e lettura sequenziale di un blocco
+// ----------------------------------------------------
+
+static inline bool can_trace_block_valid(const uint8_t *block, size_t avail)
+{
+  if (avail < sizeof(CanTraceBlockHeader)) {
+    return false;
+  }
+  CanTraceBlockHeader hdr;
+  memcpy(&hdr, block, sizeof(hdr));
+  return hdr.magic == CAN_TRACE_MAGIC &&
+         hdr.seq != 0 &&
+         hdr.used <= CAN_TRACE_PAYLOAD_SIZE &&
+         sizeof(CanTraceBlockHeader) + hdr.used <= avail;
+}
+
+class CanTraceCursor
+{
+public:
+  // block deve essere valido (can_trace_block_valid)
+  explicit CanTraceCursor(const uint8_t *block)
+  {
+    memcpy(&hdr_, block, sizeof(hdr_));
+    p_   = block + sizeof(CanTraceBlockHeader);
+    end_ = p_ + hdr_.used;
+    ts_  = hdr_.base_us;
+  }
+
+  const CanTraceBlockHeader &header() const { return hdr_; }
+
+  // False a fine blocco o se il blocco è corrotto
+  bool next(CanTraceRecord &rec)
+  {
+    if (p_ >= end_) {
+      return false;
+    }
+
+    const uint8_t flags = *p_++;
+    uint32_t delta;
+    if (!can_trace_get_varint(p_, end_, delta)) {
+      return fail();
+    }
+    ts_ += delta;
+
+    const bool ext = (flags & CAN_TRACE_F_EXT) != 0;
+    uint32_t id;
+    if (flags & CAN_TRACE_F_NEW_ID) {
+      if (!can_trace_get_varint(p_, end_, id)) {
+        return fail();
+      }
+      if (dict_count_ < CAN_TRACE_DICT_MAX) {
+        dict_[dict_count_++] = id | (ext ? 0x80000000UL : 0);
+      }
+    } else {
+      if (p_ >= end_ || *p_ >= dict_count_) {
+        return fail();
+      }
+      id = dict_[*p_++] & 0x1FFFFFFFUL;
+    }
+
+    const uint8_t dlc = flags & CAN_TRACE_F_DLC_MASK;
+    const uint8_t len = dlc > 8 ? 8 : dlc;
+    if ((size_t)(end_ - p_) < len) {
+      return fail();
+    }
+
+    rec.timestamp_us = ts_;
+    rec.id           = id;
+    rec.extended     = ext;
+    rec.rtr          = (flags & CAN_TRACE_F_RTR) != 0;
+    rec.dlc          = dlc;
+    rec.data         = p_;
+    p_ += len;
+    return true;
+  }
+
+private:
+  bool fail()
+  {
+    p_ = end_;
+    return false;
+  }
+
+  CanTraceBlockHeader hdr_;
+  const uint8_t *p_;
+  const uint8_t *end_;
+  uint64_t       ts_;
+  uint32_t       dict_[CAN_TRACE_DICT_MAX];
+  uint32_t       dict_count_ = 0;
+};
@@ -0,0 +1,62 @@
+#include "dbc_bench.h"
+#include "dbc_decoder.h"
+#include "dbc_generated.h"
+#include "esp_timer.h"
+
+static uint64_t dbc_bench_esp_timer_ns()
+{
+  return (uint64_t)esp_timer_get_time() * 1000ULL;
+}
+
+struct DbcBenchCase
+{
+  const char *name;
+  uint32_t    id;
+  bool        extended;
+  uint8_t     pages;      // messaggio multiplexato: pagine a rotazione nel byte 0
+};
+
+static const DbcBenchCase s_cases[] = {
+  { "VCU_Display_Status",   0x1088A0F1UL, true,  0 },
+  { "VCU_Display_Status_2", 0x1088A1F1UL, true,  0 },
+  { "VCU_Display_Diag",     0x1088A2F1UL, true,  DBC_MUX_COUNT_VCU_DISPLAY_DIAG },
+  { "ID non gestito",       0x123,        false, 0 },
+};
+
+void dbc_bench_run(Print &out, uint32_t iterations, DbcBenchClock clock_ns)
+{
+  if (!clock_ns) {
+    clock_ns = dbc_bench_esp_timer_ns;
+  }
+  if (iterations == 0) {
+    iterations = 1;
+  }
+
+  out.printf("[dbc_bench] %lu iterazioni per caso\n", (unsigned long)iterations);
+
+  for (const DbcBenchCase &c : s_cases) {
+    CanFrame frame = {};
+    frame.id       = c.id;
+    frame.extended = c.extended;
+    frame.dlc      = 8;
+    for (uint8_t b = 0; b < 8; ++b) {
+      frame.data[b] = (uint8_t)(0x11 * (b + 1));
+    }
+
+    DbcState st;   // stato locale: il benchmark non tocca quello globale
+    uint32_t handled = 0;
+
+    const uint64_t t0 = clock_ns();
+    for (uint32_t i = 0; i < iterations; ++i) {
+      frame.data[0] = (uint8_t)(c.pages ? i % c.pages : i);   // payload diverso a ogni giro
+      frame.data[3] = (uint8_t)(i >> 8);
+      handled += dbc_decode_frame(frame, st) ? 1U : 0U;
+    }
+    const uint64_t t1 = clock_ns();
+
+    out.printf("[dbc_bench] %-22s %8.1f ns/frame (%lu decodificati)\n",
+               c.name,
+               (double)(t1 - t0) / iterations,
+               (unsigned long)handled);
+  }
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <Arduino.h>
+
+// ----------------------------------------------------
+// Microbenchmark del decoder DBC
+// ----------------------------------------------------
+// Misura i ns/frame di dbc_decode_frame() (ricerca del messaggio + motore a
+// tabelle di dbc_signal.h) per ogni messaggio gestito e per un ID ignorato.
+// Gira nel contesto del chiamante e lo blocca per tutta la misura.
+
+// Orologio in ns; nullptr = esp_timer_get_time() (risoluzione 1 µs, basta
+// con qualche migliaio di iterazioni)
+typedef uint64_t (*DbcBenchClock)();
+
+void dbc_bench_run(Print &out, uint32_t iterations = 100000, DbcBenchClock clock_ns = nullptr);
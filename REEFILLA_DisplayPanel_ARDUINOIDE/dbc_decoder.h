@@ -0,0 +1,79 @@
+#pragma once
+
+#include <Arduino.h>
+#include "can_port.h"   // per la struct CanFrame
+#include "can_filter.h" // per CanFilterId
+#include "product.h"
+
+// DbcChange, DBC_CHG_DECODED e DbcState dipendono dal prodotto; l'API qui
+// sotto è la stessa per tutti
+#if REEFILLA_PRODUCT == REEFILLA_PRODUCT_FILLEE
+#include "dbc_state_fillee.h"
+#else
+#include "dbc_state_voltab.h"
+#endif
+
+struct DbcSignal;         // dbc_signal.h
+
+static constexpr uint32_t DBC_CHG_ALL = (1U << DBC_CHG_COUNT) - 1U;
+
+constexpr uint32_t dbc_chg(DbcChange c)
+{
+  return 1U << c;
+}
+
+constexpr bool dbc_valid(const DbcState &s, DbcChange c)
+{
+  return (s.valid_mask >> c) & 1U;
+}
+
+// Costruisce la tabella di dispatch (se DBC_DISPATCH != 0) e registra nella
+// last-value cache (can_lvc) i messaggi periodici di stato.
+// Da chiamare una volta prima di avviare il task RX.
+void dbc_init();
+
+// Decodifica l'ultimo frame dei messaggi di stato in cache, solo se dopo
+// l'ultima chiamata è arrivato qualcosa di nuovo (i frame intermedi si perdono
+// di proposito: conta solo il valore più recente)
+void dbc_process_latest();
+
+// Supervisione dei cycle time: porta la timer wheel a now_us (esp_timer) e
+// invalida i segnali dei messaggi andati in timeout, pubblicando lo stato se
+// qualcosa è cambiato. Solo dal task RX, a ogni giro del ciclo di ricezione.
+void dbc_check_timeouts(uint64_t now_us);
+
+// Gestisce un frame CAN secondo il nostro "DBC"
+// - se il messaggio è riconosciuto, lo decodifica, aggiorna lo stato e lo
+//   accoda al log differito (dlog.h, rate limit DBC_LOG_INTERVAL_MS)
+// - se non è riconosciuto, lo ignora (silenzio)
+void dbc_handle_frame(const CanFrame &frame);
+
+// Decodifica un frame in out senza log e senza toccare lo stato globale
+// (benchmark, replay). False se l'ID non è gestito o il DLC è troppo corto.
+bool dbc_decode_frame(const CanFrame &frame, DbcState &out);
+
+// Decodifica a segnali grezzi per gli strumenti host (tracce di settimane,
+// più thread): stessa dispatch e stessi layout di dbc_handle_frame, ma
+// senza stato né effetti globali. Ogni segnale presente nel frame scrive il
+// raw con segno esteso in raw[DbcChange]; scala e InvalidRawValue sono nel
+// descrittore (dbc_signal_desc). Ritorna i bit scritti, 0 se non gestito.
+uint32_t dbc_decode_raw(const CanFrame &frame, int64_t raw[DBC_CHG_DECODED]);
+
+// Descrittore DBC del segnale decodificato sig, nullptr oltre DBC_CHG_DECODED
+const DbcSignal *dbc_signal_desc(DbcChange sig);
+
+// Copia in out gli ID dei messaggi che il decoder gestisce (per il filtro HW).
+// Ritorna il numero totale di ID gestiti (può essere > max: out troncato).
+size_t dbc_get_handled_ids(CanFilterId *out, size_t max);
+
+// Maschera dei segnali (bit DbcChange) cambiati in s dopo la versione since
+// restituita da un dbc_snapshot() precedente. since = 0: tutti i bit (primo
+// aggiornamento completo). Ogni lettore tiene la propria versione, quindi
+// più consumatori (UI, log, trend) non si rubano i cambiamenti.
+uint32_t dbc_changed_since(const DbcState &s, uint32_t since);
+
+// Copia in out l'ultimo stato pubblicato dal task RX, sempre coerente (mai
+// metà di un frame e metà del successivo), senza mutex: utilizzabile da
+// qualsiasi task/core. Ritorna la versione dello stato, che cresce a ogni
+// frame decodificato (0 = nessun frame ancora, out ha i valori di default).
+uint32_t dbc_snapshot(DbcState &out);
@@ -0,0 +1,616 @@
+#include "product.h"
+#if REEFILLA_PRODUCT == REEFILLA_PRODUCT_FILLEE
+
+#include "dbc_decoder.h"
+#include "can_lvc.h"
+#include "dbc_generated.h"
+#include "can_dispatch.h"
+#include "dlog.h"
+#include "seqlock.h"
+#include "dbc_supervise.h"
+#include "dbc_derived.h"
+#include "dbc_stats.h"
+#include "signal_bus.h"
+
+#include "esp_timer.h"
+
+// ----------------------
+// Messaggi e segnali: generati da ../dbc/fillee/VCU_Display.dbc (host/dbcgen)
+// ----------------------
+
+// Stato globale: scritto solo dal task RX CAN, pubblicato ai lettori
+// (UI sull'altro core) come snapshot coerente dopo ogni decodifica
+static DbcState          g_dbc_state;
+static Seqlock<DbcState> s_snapshot;
+static constexpr int32_t DBC_NO_DATA = -11;
+
+// Log dei messaggi decodificati: al massimo uno ogni DBC_LOG_INTERVAL_MS
+// per messaggio (0 = uno per frame), differito con DLOG
+#ifndef DBC_LOG_INTERVAL_MS
+#define DBC_LOG_INTERVAL_MS 1000
+#endif
+
+// ----------------------
+// Layout dei messaggi: segnale -> campo di DbcState
+// ----------------------
+static constexpr auto LAYOUT_VCU_DISPLAY_STATUS = dbc_layout(
+    dbc_bind(DBC_SIG_VCU_DISPLAY_STATUS_SOC_TOT,                 DBC_FIELD(soc_tot_percent)),
+    dbc_bind(DBC_SIG_VCU_DISPLAY_STATUS_SOC_ACTIVE,              DBC_FIELD(soc_active_percent)),
+    dbc_bind(DBC_SIG_VCU_DISPLAY_STATUS_TIME_TO_FULL,            DBC_FIELD(time_to_full_s)),
+    dbc_bind(DBC_SIG_VCU_DISPLAY_STATUS_TIME_TO_EMPTY,           DBC_FIELD(time_to_empty_s)),
+    dbc_bind(DBC_SIG_VCU_DISPLAY_STATUS_MAIN_STATE_MACHINE_STATE, DBC_FIELD(main_state)));
+
+static constexpr auto LAYOUT_VCU_DISPLAY_STATUS2 = dbc_layout(
+    dbc_bind(DBC_SIG_VCU_DISPLAY_STATUS_2_INV_P_AC_VECT_0, DBC_FIELD(inv_p_ac_w[0])),
+    dbc_bind(DBC_SIG_VCU_DISPLAY_STATUS_2_INV_P_AC_VECT_1, DBC_FIELD(inv_p_ac_w[1])),
+    dbc_bind(DBC_SIG_VCU_DISPLAY_STATUS_2_INV_P_AC_VECT_2, DBC_FIELD(inv_p_ac_w[2])));
+
+// VCU_Display_Diag: un layout per pagina (valore di DiagPage)
+static constexpr auto LAYOUT_DIAG_CELLS = dbc_layout(
+    dbc_bind(DBC_SIG_VCU_DISPLAY_DIAG_CELL_V_MIN, DBC_FIELD(cell_v_min_mv)),
+    dbc_bind(DBC_SIG_VCU_DISPLAY_DIAG_CELL_V_MAX, DBC_FIELD(cell_v_max_mv)),
+    dbc_bind(DBC_SIG_VCU_DISPLAY_DIAG_CELL_T_MIN, DBC_FIELD(cell_t_min_c)),
+    dbc_bind(DBC_SIG_VCU_DISPLAY_DIAG_CELL_T_MAX, DBC_FIELD(cell_t_max_c)));
+
+static constexpr auto LAYOUT_DIAG_FAULTS = dbc_layout(
+    dbc_bind(DBC_SIG_VCU_DISPLAY_DIAG_BMS_FAULT_CODE, DBC_FIELD(bms_fault_code)),
+    dbc_bind(DBC_SIG_VCU_DISPLAY_DIAG_INV_FAULT_CODE, DBC_FIELD(inv_fault_code)),
+    dbc_bind(DBC_SIG_VCU_DISPLAY_DIAG_VCU_UPTIME,     DBC_FIELD(vcu_uptime_s)));
+
+static constexpr auto LAYOUT_DIAG_INVERTER = dbc_layout(
+    dbc_bind(DBC_SIG_VCU_DISPLAY_DIAG_INV_V_DC_VECT_0, DBC_FIELD(inv_v_dc_v[0])),
+    dbc_bind(DBC_SIG_VCU_DISPLAY_DIAG_INV_V_DC_VECT_1, DBC_FIELD(inv_v_dc_v[1])),
+    dbc_bind(DBC_SIG_VCU_DISPLAY_DIAG_INV_V_DC_VECT_2, DBC_FIELD(inv_v_dc_v[2])));
+
+// I bit di DbcChange seguono l'ordine dei binding
+static_assert(DBC_CHG_INV_P_AC_0 - DBC_CHG_SOC_TOT ==
+                  std::tuple_size<decltype(LAYOUT_VCU_DISPLAY_STATUS)>::value &&
+              DBC_CHG_CELL_V_MIN - DBC_CHG_INV_P_AC_0 ==
+                  std::tuple_size<decltype(LAYOUT_VCU_DISPLAY_STATUS2)>::value,
+              "DbcChange non allineato ai layout");
+static_assert(DBC_CHG_BMS_FAULT - DBC_CHG_CELL_V_MIN ==
+                  std::tuple_size<decltype(LAYOUT_DIAG_CELLS)>::value &&
+              DBC_CHG_INV_V_DC_0 - DBC_CHG_BMS_FAULT ==
+                  std::tuple_size<decltype(LAYOUT_DIAG_FAULTS)>::value &&
+              DBC_CHG_DECODED - DBC_CHG_INV_V_DC_0 ==
+                  std::tuple_size<decltype(LAYOUT_DIAG_INVERTER)>::value,
+              "DbcChange non allineato alle pagine di VCU_Display_Diag");
+
+// ----------------------
+// Decoder VCU_Display_Status (0x1088A0F1)
+// ----------------------
+static uint32_t decode_vcu_display_status(const CanFrame &frame, DbcState &st)
+{
+  const uint32_t changed = dbc_decode_layout_changes(LAYOUT_VCU_DISPLAY_STATUS, dbc_load(frame.data),
+                                                     st, DBC_NO_DATA);
+  st.status_lastUpdate_ms = frame.timestamp_ms;
+  return changed << DBC_CHG_SOC_TOT;
+}
+
+static void log_vcu_display_status(const DbcState &st)
+{
+  DLOG_EVERY(DBC_LOG_INTERVAL_MS,
+      "[DBC] Status: SOC_TOT=%d%%, SOC_ACTIVE=%d%%, TTF=%.1f min, TTE=%.1f min, STATE=%d\n",
+      (int)st.soc_tot_percent,
+      (int)st.soc_active_percent,
+      (st.time_to_full_s > 0) ? (st.time_to_full_s / 60.0f) : -1.0f,
+      (st.time_to_empty_s > 0) ? (st.time_to_empty_s / 60.0f) : -1.0f,
+      (int)st.main_state
+  );
+}
+
+static void stats_vcu_display_status(const DbcState &st)
+{
+  dbc_stats_layout(LAYOUT_VCU_DISPLAY_STATUS, st, DBC_CHG_SOC_TOT, DBC_NO_DATA);
+}
+
+// ----------------------
+// Decoder VCU_Display_Status_2 (0x1088A1F1)
+// ----------------------
+static uint32_t decode_vcu_display_status2(const CanFrame &frame, DbcState &st)
+{
+  const uint32_t changed = dbc_decode_layout_changes(LAYOUT_VCU_DISPLAY_STATUS2, dbc_load(frame.data),
+                                                     st, DBC_NO_DATA);
+  st.status2_lastUpdate_ms = frame.timestamp_ms;
+  return changed << DBC_CHG_INV_P_AC_0;
+}
+
+static void log_vcu_display_status2(const DbcState &st)
+{
+  DLOG_EVERY(DBC_LOG_INTERVAL_MS,
+      "[DBC] Status2: P_AC = [%.1f, %.1f, %.1f] kW, E_TOT=%.2f kWh\n",
+      st.inv_p_ac_w[0] / 1000.0f,
+      st.inv_p_ac_w[1] / 1000.0f,
+      st.inv_p_ac_w[2] / 1000.0f,
+      st.derived.energy_tot_wh / 1000.0f
+  );
+}
+
+static void stats_vcu_display_status2(const DbcState &st)
+{
+  dbc_stats_layout(LAYOUT_VCU_DISPLAY_STATUS2, st, DBC_CHG_INV_P_AC_0, DBC_NO_DATA);
+}
+
+// ----------------------
+// Decoder VCU_Display_Diag (0x1088A2F1), multiplexato su DiagPage
+// ----------------------
+
+// Jump table indicizzata da DiagPage: una pagina costa come un messaggio
+// normale, qualunque sia il numero di pagine
+static constexpr auto DIAG_PAGES = dbc_mux_table<DbcState, DBC_MUX_COUNT_VCU_DISPLAY_DIAG>(
+    DBC_SIG_VCU_DISPLAY_DIAG_DIAG_PAGE,
+    dbc_mux_case<DbcState, 0, LAYOUT_DIAG_CELLS,    DBC_CHG_CELL_V_MIN>(),
+    dbc_mux_case<DbcState, 1, LAYOUT_DIAG_FAULTS,   DBC_CHG_BMS_FAULT>(),
+    dbc_mux_case<DbcState, 2, LAYOUT_DIAG_INVERTER, DBC_CHG_INV_V_DC_0>());
+
+static uint32_t decode_vcu_display_diag(const CanFrame &frame, DbcState &st)
+{
+  const DbcPayload p = dbc_load(frame.data);
+  const DbcMuxCase<DbcState> &page = DIAG_PAGES.select(p);
+  uint32_t changed = page.decode(p, st, DBC_NO_DATA);
+
+  // I segnali di una pagina diventano validi al suo primo frame (gli altri
+  // messaggi li valida dbc_apply() al primo frame del messaggio)
+  changed |= page.signals & ~st.valid_mask;
+  st.valid_mask |= page.signals;
+  st.diag_page = page.value;
+  st.diag_lastUpdate_ms = frame.timestamp_ms;
+  return changed;
+}
+
+static uint32_t raw_vcu_display_diag(const DbcPayload &p, int64_t *raw)
+{
+  return DIAG_PAGES.select(p).raw(p, raw);
+}
+
+static void log_vcu_display_diag(const DbcState &st)
+{
+  // Solo la pagina arrivata: un sito (e un limite di frequenza) per pagina
+  switch (st.diag_page) {
+  case 0:
+    DLOG_EVERY(DBC_LOG_INTERVAL_MS, "[DBC] Diag celle: V=%ld..%ld mV, T=%d..%d C\n",
+               (long)st.cell_v_min_mv, (long)st.cell_v_max_mv,
+               (int)st.cell_t_min_c, (int)st.cell_t_max_c);
+    break;
+  case 1:
+    DLOG_EVERY(DBC_LOG_INTERVAL_MS, "[DBC] Diag guasti: BMS=%04lX INV=%04lX, uptime VCU=%ld s\n",
+               (unsigned long)st.bms_fault_code, (unsigned long)st.inv_fault_code,
+               (long)st.vcu_uptime_s);
+    break;
+  default:
+    DLOG_EVERY(DBC_LOG_INTERVAL_MS, "[DBC] Diag inverter: V_DC=[%.1f, %.1f, %.1f] V\n",
+               st.inv_v_dc_v[0], st.inv_v_dc_v[1], st.inv_v_dc_v[2]);
+    break;
+  }
+}
+
+// Statistiche della sola pagina arrivata, con la stessa indicizzazione
+static void stats_vcu_display_diag(const DbcState &st)
+{
+  static constexpr void (*const PAGES[DBC_MUX_COUNT_VCU_DISPLAY_DIAG])(const DbcState &) = {
+    dbc_stats_case<LAYOUT_DIAG_CELLS,    DBC_CHG_CELL_V_MIN, DBC_NO_DATA>,
+    dbc_stats_case<LAYOUT_DIAG_FAULTS,   DBC_CHG_BMS_FAULT,  DBC_NO_DATA>,
+    dbc_stats_case<LAYOUT_DIAG_INVERTER, DBC_CHG_INV_V_DC_0, DBC_NO_DATA>,
+  };
+  if (st.diag_page >= 0 && st.diag_page < (int)DBC_MUX_COUNT_VCU_DISPLAY_DIAG) {
+    PAGES[st.diag_page](st);
+  }
+}
+
+// ----------------------
+// Segnali derivati
+// ----------------------
+
+// Finestra della media mobile delle potenze [s] (caselle da 1 s)
+#ifndef DBC_DERIVED_AVG_S
+#define DBC_DERIVED_AVG_S  60
+#endif
+
+// Finestra della pendenza del SOC [s] (30 caselle)
+#ifndef DBC_DERIVED_SOC_RATE_S
+#define DBC_DERIVED_SOC_RATE_S  300
+#endif
+
+// Distanza massima tra due campioni di potenza integrati [ms]: oltre,
+// il tratto non conta (frame persi, timeout)
+#ifndef DBC_DERIVED_MAX_GAP_MS
+#define DBC_DERIVED_MAX_GAP_MS  1000
+#endif
+
+static TrapezoidIntegrator s_energy[3] = {
+  TrapezoidIntegrator(DBC_DERIVED_MAX_GAP_MS),
+  TrapezoidIntegrator(DBC_DERIVED_MAX_GAP_MS),
+  TrapezoidIntegrator(DBC_DERIVED_MAX_GAP_MS),
+};
+static SlidingWindow<DBC_DERIVED_AVG_S, 1000>                  s_p_avg[3];
+static SlidingWindow<30, DBC_DERIVED_SOC_RATE_S * 1000 / 30> s_soc_window;
+
+template <typename T>
+static uint32_t derived_store(T &field, T value, int bit)
+{
+  if (field == value) {
+    return 0;
+  }
+  field = value;
+  return 1U << bit;
+}
+
+// Energia erogata: integrale della sola potenza positiva
+template <int I>
+static uint32_t derive_energy(DbcState &st, uint64_t t_us, bool *valid)
+{
+  (void)valid;   // contatore: resta valido anche senza campioni
+  const int32_t p = st.inv_p_ac_w[I];
+  if (p == DBC_NO_DATA) {
+    s_energy[I].restart();
+    return 0;
+  }
+  s_energy[I].add(t_us, p > 0 ? (float)p : 0.0f);
+  return derived_store(st.derived.energy_wh[I], (uint32_t)(s_energy[I].total() / 3600.0),
+                       DBC_CHG_ENERGY_0 + I);
+}
+
+static uint32_t derive_energy_tot(DbcState &st, uint64_t t_us, bool *valid)
+{
+  (void)t_us;
+  (void)valid;
+  const uint32_t *e = st.derived.energy_wh;
+  return derived_store(st.derived.energy_tot_wh, e[0] + e[1] + e[2], DBC_CHG_ENERGY_TOT);
+}
+
+template <int I>
+static uint32_t derive_p_avg(DbcState &st, uint64_t t_us, bool *valid)
+{
+  const int32_t p = st.inv_p_ac_w[I];
+  if (p != DBC_NO_DATA) {
+    s_p_avg[I].add(t_us, p);
+  }
+  *valid = s_p_avg[I].count() > 0;
+  return derived_store(st.derived.p_ac_avg_w[I], s_p_avg[I].mean(), DBC_CHG_P_AC_AVG_0 + I);
+}
+
+// Pendenza su almeno mezza finestra: il SOC arriva a passi dell'1 %
+static uint32_t derive_soc_rate(DbcState &st, uint64_t t_us, bool *valid)
+{
+  if (st.soc_active_percent >= 0) {
+    s_soc_window.add(t_us, st.soc_active_percent);
+  }
+  float rate = 0.0f;
+  *valid = s_soc_window.slope_per_hour(DBC_DERIVED_SOC_RATE_S * 1000U / 2, rate);
+  if (!*valid) {
+    return 0;
+  }
+  const float d = fminf(fmaxf(rate * 10.0f, -32768.0f), 32767.0f);
+  return derived_store(st.derived.soc_rate_dpct_h, (int16_t)lroundf(d), DBC_CHG_SOC_RATE);
+}
+
+// Ordine topologico: ENERGY_TOT dopo le tre ENERGY
+static constexpr DbcDerived DBC_DERIVED[] = {
+  { dbc_chg(DBC_CHG_INV_P_AC_0), dbc_chg(DBC_CHG_ENERGY_0),   true,  derive_energy<0> },
+  { dbc_chg(DBC_CHG_INV_P_AC_1), dbc_chg(DBC_CHG_ENERGY_1),   true,  derive_energy<1> },
+  { dbc_chg(DBC_CHG_INV_P_AC_2), dbc_chg(DBC_CHG_ENERGY_2),   true,  derive_energy<2> },
+  { dbc_chg(DBC_CHG_ENERGY_0) | dbc_chg(DBC_CHG_ENERGY_1) | dbc_chg(DBC_CHG_ENERGY_2),
+                                 dbc_chg(DBC_CHG_ENERGY_TOT), true,  derive_energy_tot },
+  { dbc_chg(DBC_CHG_INV_P_AC_0), dbc_chg(DBC_CHG_P_AC_AVG_0), false, derive_p_avg<0> },
+  { dbc_chg(DBC_CHG_INV_P_AC_1), dbc_chg(DBC_CHG_P_AC_AVG_1), false, derive_p_avg<1> },
+  { dbc_chg(DBC_CHG_INV_P_AC_2), dbc_chg(DBC_CHG_P_AC_AVG_2), false, derive_p_avg<2> },
+  { dbc_chg(DBC_CHG_SOC_ACTIVE), dbc_chg(DBC_CHG_SOC_RATE),   false, derive_soc_rate },
+};
+
+// ----------------------
+// Messaggi decodificati
+// ----------------------
+struct DbcHandler
+{
+  DbcMessageIndex msg;
+  uint8_t         min_dlc;
+  uint32_t        signals;   // bit DbcChange dei segnali del messaggio
+  uint32_t        muxed;     // di questi, validati pagina per pagina dal decoder
+  uint32_t      (*decode)(const CanFrame &frame, DbcState &st);   // -> bit DbcChange cambiati
+  uint32_t      (*raw)(const DbcPayload &p, int64_t *raw);        // -> bit DbcChange scritti
+  void          (*log)(const DbcState &st);
+  void          (*stats)(const DbcState &st);   // campioni per dbc_stats.h
+};
+
+static constexpr DbcHandler s_handlers[] = {
+  { DBC_MSG_VCU_DISPLAY_STATUS,   8, dbc_layout_mask(LAYOUT_VCU_DISPLAY_STATUS) << DBC_CHG_SOC_TOT, 0,
+    decode_vcu_display_status,  dbc_raw_layout<LAYOUT_VCU_DISPLAY_STATUS, DBC_CHG_SOC_TOT>,
+    log_vcu_display_status,  stats_vcu_display_status  },
+  { DBC_MSG_VCU_DISPLAY_STATUS_2, 6, dbc_layout_mask(LAYOUT_VCU_DISPLAY_STATUS2) << DBC_CHG_INV_P_AC_0, 0,
+    decode_vcu_display_status2, dbc_raw_layout<LAYOUT_VCU_DISPLAY_STATUS2, DBC_CHG_INV_P_AC_0>,
+    log_vcu_display_status2, stats_vcu_display_status2 },
+  { DBC_MSG_VCU_DISPLAY_DIAG,     8, DIAG_PAGES.signals(), DIAG_PAGES.signals(),
+    decode_vcu_display_diag,    raw_vcu_display_diag,
+    log_vcu_display_diag,    stats_vcu_display_diag    },
+};
+
+// Indice messaggio (slot dell'hash perfetto) -> handler, nullptr se il
+// messaggio è nel DBC ma non viene decodificato
+struct DbcDispatch
+{
+  const DbcHandler *by_msg[DBC_MESSAGE_COUNT];
+};
+
+static constexpr DbcDispatch dbc_make_dispatch()
+{
+  DbcDispatch d = {};
+  for (const DbcHandler &h : s_handlers) {
+    d.by_msg[h.msg] = &h;
+  }
+  return d;
+}
+
+static constexpr DbcDispatch s_dispatch = dbc_make_dispatch();
+
+// Struttura di lookup (ID, esteso) -> indice messaggio (vedi can_dispatch.h):
+//   0 = hash perfetto generato da dbcgen (costante, niente da costruire)
+//   1 = array ordinato con ricerca binaria senza branch
+//   2 = open addressing
+//   3 = hash perfetto costruito a runtime
+// Con 1..3 la struttura viene costruita in dbc_init().
+#ifndef DBC_DISPATCH
+#define DBC_DISPATCH 0
+#endif
+
+#if DBC_DISPATCH == 0
+static void dbc_dispatch_build() {}
+
+static int dbc_dispatch_find(uint32_t id, bool extended)
+{
+  return dbc_message_find(id, extended);
+}
+#else
+#if DBC_DISPATCH == 1
+typedef CanDispatchSorted DbcDispatchIndex;
+#elif DBC_DISPATCH == 2
+typedef CanDispatchHash DbcDispatchIndex;
+#else
+typedef CanDispatchPhf DbcDispatchIndex;
+#endif
+
+static DbcDispatchIndex s_dispatch_index;
+static uint32_t s_dispatch_storage[DbcDispatchIndex::storage_words(DBC_MESSAGE_COUNT)];
+
+// DBC_PHF_KEYS è in ordine di indice messaggio
+static void dbc_dispatch_build()
+{
+  if (!s_dispatch_index.build(DBC_PHF_KEYS, DBC_MESSAGE_COUNT, s_dispatch_storage)) {
+    Serial.println("[DBC] ERRORE: costruzione della tabella di dispatch fallita");
+  }
+}
+
+static int dbc_dispatch_find(uint32_t id, bool extended)
+{
+  return s_dispatch_index.find(id, extended);
+}
+#endif
+
+static const DbcHandler *dbc_find_handler(uint32_t id, bool extended)
+{
+  const int idx = dbc_dispatch_find(id, extended);
+  return (idx >= 0) ? s_dispatch.by_msg[idx] : nullptr;
+}
+
+// ----------------------
+// Segnale -> valore del suo campo (eventi di signal_bus.h)
+// ----------------------
+static constexpr auto s_signal_value = [] {
+  std::array<DbcValueFn<DbcState>, DBC_CHG_COUNT> v = {};
+  dbc_layout_values<LAYOUT_VCU_DISPLAY_STATUS>(DBC_CHG_SOC_TOT, v);
+  dbc_layout_values<LAYOUT_VCU_DISPLAY_STATUS2>(DBC_CHG_INV_P_AC_0, v);
+  dbc_layout_values<LAYOUT_DIAG_CELLS>(DBC_CHG_CELL_V_MIN, v);
+  dbc_layout_values<LAYOUT_DIAG_FAULTS>(DBC_CHG_BMS_FAULT, v);
+  dbc_layout_values<LAYOUT_DIAG_INVERTER>(DBC_CHG_INV_V_DC_0, v);
+  v[DBC_CHG_ENERGY_0]   = [](const DbcState &st) { return (float)st.derived.energy_wh[0]; };
+  v[DBC_CHG_ENERGY_1]   = [](const DbcState &st) { return (float)st.derived.energy_wh[1]; };
+  v[DBC_CHG_ENERGY_2]   = [](const DbcState &st) { return (float)st.derived.energy_wh[2]; };
+  v[DBC_CHG_ENERGY_TOT] = [](const DbcState &st) { return (float)st.derived.energy_tot_wh; };
+  v[DBC_CHG_P_AC_AVG_0] = [](const DbcState &st) { return (float)st.derived.p_ac_avg_w[0]; };
+  v[DBC_CHG_P_AC_AVG_1] = [](const DbcState &st) { return (float)st.derived.p_ac_avg_w[1]; };
+  v[DBC_CHG_P_AC_AVG_2] = [](const DbcState &st) { return (float)st.derived.p_ac_avg_w[2]; };
+  v[DBC_CHG_SOC_RATE]   = [](const DbcState &st) { return (float)st.derived.soc_rate_dpct_h; };
+  for (DbcValueFn<DbcState> f : v) {
+    if (!f) {
+      dbc_signal_out_of_range();   // segnale senza campo: non compila
+    }
+  }
+  return v;
+}();
+
+// Pubblica lo stato globale: ogni segnale in changed prende la versione
+// dello snapshot che sta per uscire, e va sul bus dei segnali con t_us
+static void dbc_publish(uint32_t changed, uint64_t t_us)
+{
+  const uint32_t version = s_snapshot.version() + 1;
+  SignalEvent    events[DBC_CHG_COUNT];
+  size_t         n = 0;
+  while (changed) {
+    const unsigned i = (unsigned)__builtin_ctz(changed);
+    g_dbc_state.change_seq[i] = version;
+    events[n++] = { t_us, s_signal_value[i](g_dbc_state), (uint8_t)i,
+                    (uint8_t)((g_dbc_state.valid_mask >> i) & 1U ? SIGNAL_EV_VALID : 0),
+                    (uint16_t)version };
+    changed &= changed - 1;
+  }
+  s_snapshot.publish(g_dbc_state);
+  signal_bus_publish(events, n);
+}
+
+// Decodifica + log sullo stato globale; false se il DLC è troppo corto
+static bool dbc_apply(const DbcHandler &h, const CanFrame &frame)
+{
+  if (frame.dlc < h.min_dlc) {
+    DLOG_EVERY(1000, "[DBC] %s: DLC < %u, frame ignorato\n",
+               DBC_MESSAGES[h.msg].name, (unsigned)h.min_dlc);
+    return false;
+  }
+  uint32_t changed = h.decode(frame, g_dbc_state);
+
+  // Primo frame o recupero da un timeout: i segnali tornano validi
+  if (dbc_supervise_frame(h.msg, frame.timestamp_us)) {
+    g_dbc_state.valid_mask |= h.signals & ~h.muxed;
+    changed |= h.signals & ~h.muxed;
+  }
+  changed |= dbc_derive(DBC_DERIVED, g_dbc_state, h.signals, frame.timestamp_us);
+  dbc_publish(changed, frame.timestamp_us);
+  h.stats(g_dbc_state);
+  h.log(g_dbc_state);
+  return true;
+}
+
+// ----------------------
+// Messaggi periodici (GenMsgCycleTime) in last-value cache
+// ----------------------
+// Non i multiplexati (VCU_Display_Diag): ogni pagina porta segnali diversi
+// e con un solo slot per ID le pagine arrivate nello stesso batch si
+// sovrascriverebbero, e la supervisione vedrebbe un arrivo solo. Passano
+// tutti da dbc_handle_frame(), frame per frame.
+static uint32_t s_latest_seq[DBC_MESSAGE_COUNT];   // ultimo aggiornamento già decodificato
+
+static bool dbc_is_latest(const DbcHandler &h)
+{
+  return DBC_MESSAGES[h.msg].cycle_ms != 0 && h.muxed == 0;
+}
+
+void dbc_init()
+{
+  dbc_dispatch_build();
+  dbc_supervise_init((uint64_t)esp_timer_get_time());
+
+  for (const DbcHandler &h : s_handlers) {
+    const DbcMessageInfo &m = DBC_MESSAGES[h.msg];
+    if (dbc_is_latest(h) && !can_lvc_register(m.id, m.extended)) {
+      Serial.printf("[DBC] ERRORE: last-value cache piena (ID 0x%08lX)\n", (unsigned long)m.id);
+    }
+  }
+}
+
+void dbc_process_latest()
+{
+  for (const DbcHandler &h : s_handlers) {
+    const DbcMessageInfo &m = DBC_MESSAGES[h.msg];
+    if (!dbc_is_latest(h) || can_lvc_seq(m.id, m.extended) == s_latest_seq[h.msg]) {
+      continue;   // niente di nuovo
+    }
+
+    CanFrame frame;
+    uint32_t seq = 0;
+    if (can_lvc_read(m.id, m.extended, frame, &seq)) {
+      s_latest_seq[h.msg] = seq;
+      dbc_apply(h, frame);
+    }
+  }
+}
+
+// ----------------------
+// Timeout dei messaggi
+// ----------------------
+static uint32_t s_expired;   // segnali invalidati nel tick in corso
+
+static void dbc_on_timeout(DbcMessageIndex msg)
+{
+  const DbcHandler *h = s_dispatch.by_msg[msg];
+  if (h) {
+    g_dbc_state.valid_mask &= ~h->signals;
+    s_expired |= h->signals;
+  }
+}
+
+void dbc_check_timeouts(uint64_t now_us)
+{
+  s_expired = 0;
+  dbc_supervise_tick(now_us, dbc_on_timeout);
+  if (s_expired) {
+    s_expired |= dbc_derive_expire(DBC_DERIVED, g_dbc_state, s_expired);
+    dbc_publish(s_expired, now_us);
+  }
+}
+
+// ----------------------
+// Entry point DBC
+// ----------------------
+void dbc_handle_frame(const CanFrame &frame)
+{
+  if (frame.rtr) {
+    return; // niente RTR per ora
+  }
+
+  const DbcHandler *h = dbc_find_handler(frame.id, frame.extended);
+  if (h) {
+    dbc_apply(*h, frame);
+  }
+  // Altri messaggi: ignorati in silenzio
+}
+
+// Decodifica senza log né effetti sullo stato globale
+bool dbc_decode_frame(const CanFrame &frame, DbcState &out)
+{
+  if (frame.rtr) {
+    return false;
+  }
+  const DbcHandler *h = dbc_find_handler(frame.id, frame.extended);
+  if (!h || frame.dlc < h->min_dlc) {
+    return false;
+  }
+  h->decode(frame, out);
+  return true;
+}
+
+// Segnale decodificato -> descrittore del suo binding
+static constexpr auto s_signal_desc = [] {
+  std::array<const DbcSignal *, DBC_CHG_DECODED> d = {};
+  dbc_layout_desc(LAYOUT_VCU_DISPLAY_STATUS,  DBC_CHG_SOC_TOT, d);
+  dbc_layout_desc(LAYOUT_VCU_DISPLAY_STATUS2, DBC_CHG_INV_P_AC_0, d);
+  dbc_layout_desc(LAYOUT_DIAG_CELLS,    DBC_CHG_CELL_V_MIN, d);
+  dbc_layout_desc(LAYOUT_DIAG_FAULTS,   DBC_CHG_BMS_FAULT,  d);
+  dbc_layout_desc(LAYOUT_DIAG_INVERTER, DBC_CHG_INV_V_DC_0, d);
+  return d;
+}();
+
+uint32_t dbc_decode_raw(const CanFrame &frame, int64_t raw[DBC_CHG_DECODED])
+{
+  if (frame.rtr) {
+    return 0;
+  }
+  const DbcHandler *h = dbc_find_handler(frame.id, frame.extended);
+  if (!h || frame.dlc < h->min_dlc) {
+    return 0;
+  }
+  return h->raw(dbc_load(frame.data), raw);
+}
+
+const DbcSignal *dbc_signal_desc(DbcChange sig)
+{
+  return sig < DBC_CHG_DECODED ? s_signal_desc[sig] : nullptr;
+}
+
+// ID dei messaggi decodificati
+size_t dbc_get_handled_ids(CanFilterId *out, size_t max)
+{
+  const size_t count = sizeof(s_handlers) / sizeof(s_handlers[0]);
+  for (size_t i = 0; i < count && i < max; ++i) {
+    out[i].id       = DBC_MESSAGES[s_handlers[i].msg].id;
+    out[i].extended = DBC_MESSAGES[s_handlers[i].msg].extended;
+  }
+  return count;
+}
+
+// Copia coerente dello stato (seqlock, nessun mutex)
+uint32_t dbc_snapshot(DbcState &out)
+{
+  return s_snapshot.read(out);
+}
+
+uint32_t dbc_changed_since(const DbcState &s, uint32_t since)
+{
+  if (since == 0) {
+    return DBC_CHG_ALL;
+  }
+  uint32_t mask = 0;
+  for (uint32_t i = 0; i < DBC_CHG_COUNT; ++i) {
+    mask |= (uint32_t)(s.change_seq[i] > since) << i;
+  }
+  return mask;
+}
+
+#endif // REEFILLA_PRODUCT == REEFILLA_PRODUCT_FILLEE
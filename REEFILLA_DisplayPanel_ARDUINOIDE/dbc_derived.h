@@ -0,0 +1,219 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "dbc_decoder.h"   // DbcState, bit DbcChange
+
+// ----------------------------------------------------
+// Segnali derivati: calcolo incrementale sui segnali decodificati
+// ----------------------------------------------------
+// Un segnale derivato dichiara gli ingressi (bit DbcChange) e le uscite
+// (campi di DbcState::derived, con i loro bit DbcChange). Dopo ogni frame
+// dbc_derive() esegue solo i derivati con almeno un ingresso appena
+// aggiornato, nell'ordine della tabella: un derivato può usare come
+// ingresso l'uscita di uno precedente (grafo aciclico in ordine topologico).
+//
+// Niente ricerche nello storico: ogni derivato tiene il proprio stato
+// (integratore, finestra scorrevole) e lo aggiorna in O(1) con il nuovo
+// campione e il timestamp vero del frame.
+//
+// Tutto dal task RX CAN, come la decodifica.
+
+// ----------------------------------------------------
+// Integrale a trapezi su timestamp irregolari
+// ----------------------------------------------------
+// Due campioni più distanti di max_gap_ms (bus muto, timeout) non
+// contribuiscono: l'area ricomincia dal campione successivo.
+class TrapezoidIntegrator
+{
+public:
+  explicit constexpr TrapezoidIntegrator(uint32_t max_gap_ms)
+      : max_gap_us_((uint64_t)max_gap_ms * 1000ULL) {}
+
+  // Ritorna l'area aggiunta [unità di v × s]
+  double add(uint64_t t_us, float v)
+  {
+    double area = 0.0;
+    if (has_last_ && t_us > last_us_ && t_us - last_us_ <= max_gap_us_) {
+      area = 0.5 * ((double)v + last_v_) * (double)(t_us - last_us_) * 1e-6;
+      total_ += area;
+    }
+    has_last_ = true;
+    last_us_  = t_us;
+    last_v_   = v;
+    return area;
+  }
+
+  // Il prossimo campione riparte senza area (ingresso non valido)
+  void restart() { has_last_ = false; }
+
+  double total() const { return total_; }
+
+private:
+  uint64_t max_gap_us_;
+  uint64_t last_us_  = 0;
+  float    last_v_   = 0.0f;
+  bool     has_last_ = false;
+  double   total_    = 0.0;
+};
+
+// ----------------------------------------------------
+// Finestra scorrevole a tempo: somma, media e pendenza in O(1)
+// ----------------------------------------------------
+// La finestra è divisa in SLOTS caselle da SLOT_MS: un campione finisce
+// nella casella del suo istante, le caselle uscite dalla finestra vengono
+// sottratte dal totale quando il tempo avanza. Memoria fissa, nessuna
+// deriva (somme intere), costo O(1) ammortizzato per campione.
+template <size_t SLOTS, uint32_t SLOT_MS>
+class SlidingWindow
+{
+  static_assert(SLOTS >= 2, "SlidingWindow: servono almeno 2 caselle");
+
+public:
+  static constexpr uint64_t SPAN_US = (uint64_t)SLOTS * SLOT_MS * 1000ULL;
+
+  void add(uint64_t t_us, int32_t v)
+  {
+    const uint64_t idx = t_us / (SLOT_MS * 1000ULL);
+    if (n_ == 0) {
+      head_ = tail_ = idx;
+    } else if (idx > head_) {
+      // Libera le caselle che la testa sta per riusare (al più un giro)
+      const uint64_t steps = (idx - head_ > SLOTS) ? SLOTS : idx - head_;
+      for (uint64_t k = 1; k <= steps; ++k) {
+        evict(slots_[(head_ + k) % SLOTS]);
+      }
+      head_ = idx;
+      if (n_ == 0 || tail_ + SLOTS <= head_) {
+        advance_tail();
+      }
+    }
+    // idx < head_ (orologio indietro): nel bucket più recente
+
+    Slot &s = slots_[head_ % SLOTS];
+    if (s.n == 0) {
+      s.first_v  = v;
+      s.first_us = t_us;
+    }
+    s.sum += v;
+    s.n++;
+    sum_ += v;
+    n_++;
+    last_v_  = v;
+    last_us_ = t_us;
+  }
+
+  void clear() { *this = SlidingWindow(); }
+
+  uint32_t count() const { return n_; }
+
+  int32_t mean() const
+  {
+    return n_ ? (int32_t)llround((double)sum_ / n_) : 0;
+  }
+
+  // Variazione per ora dal primo campione della finestra all'ultimo.
+  // False se i due campioni distano meno di min_span_ms.
+  bool slope_per_hour(uint32_t min_span_ms, float &out) const
+  {
+    if (n_ == 0) {
+      return false;
+    }
+    const Slot &first = slots_[tail_ % SLOTS];
+    const uint64_t dt = last_us_ - first.first_us;
+    if (dt < (uint64_t)min_span_ms * 1000ULL) {
+      return false;
+    }
+    out = (float)((double)(last_v_ - first.first_v) * 3600e6 / (double)dt);
+    return true;
+  }
+
+private:
+  struct Slot
+  {
+    int64_t  sum      = 0;
+    uint32_t n        = 0;
+    int32_t  first_v  = 0;
+    uint64_t first_us = 0;
+  };
+
+  void evict(Slot &s)
+  {
+    sum_ -= s.sum;
+    n_   -= s.n;
+    s = Slot();
+  }
+
+  // Coda sulla casella non vuota più vecchia dentro la finestra: ogni
+  // casella viene attraversata al più una volta per giro
+  void advance_tail()
+  {
+    if (tail_ + SLOTS <= head_) {
+      tail_ = head_ + 1 - SLOTS;
+    }
+    while (tail_ < head_ && slots_[tail_ % SLOTS].n == 0) {
+      tail_++;
+    }
+  }
+
+  Slot     slots_[SLOTS];
+  uint64_t head_    = 0;   // casella più recente
+  uint64_t tail_    = 0;   // casella non vuota più vecchia
+  int64_t  sum_     = 0;
+  uint32_t n_       = 0;
+  int32_t  last_v_  = 0;
+  uint64_t last_us_ = 0;
+};
+
+// ----------------------------------------------------
+// Grafo dei derivati
+// ----------------------------------------------------
+struct DbcDerived
+{
+  uint32_t inputs;    // bit DbcChange letti
+  uint32_t outputs;   // bit DbcChange scritti
+  bool     hold;      // l'uscita resta valida se un ingresso va in timeout (contatori)
+  // Nuovo campione degli ingressi a t_us: aggiorna st.derived e ritorna
+  // i bit di outputs il cui valore è cambiato. False in *valid se l'uscita
+  // non è (ancora) calcolabile.
+  uint32_t (*update)(DbcState &st, uint64_t t_us, bool *valid);
+};
+
+// Esegue i derivati toccati da updated (bit dei segnali appena ricevuti).
+// Ritorna i bit DbcChange delle uscite cambiate, validità compresa.
+template <size_t N>
+uint32_t dbc_derive(const DbcDerived (&graph)[N], DbcState &st, uint32_t updated, uint64_t t_us)
+{
+  uint32_t changed = 0;
+  for (const DbcDerived &d : graph) {
+    if (!(d.inputs & updated)) {
+      continue;
+    }
+    bool valid = true;
+    changed |= d.update(st, t_us, &valid);
+    const uint32_t was = st.valid_mask & d.outputs;
+    st.valid_mask = valid ? (st.valid_mask | d.outputs) : (st.valid_mask & ~d.outputs);
+    changed |= was ^ (st.valid_mask & d.outputs);
+    updated |= d.outputs;   // a valle nel grafo
+  }
+  return changed;
+}
+
+// Ingressi scaduti (bit expired): invalida le uscite dei derivati che ne
+// dipendono, in cascata, tranne quelle hold. Ritorna i bit invalidati.
+template <size_t N>
+uint32_t dbc_derive_expire(const DbcDerived (&graph)[N], DbcState &st, uint32_t expired)
+{
+  uint32_t invalidated = 0;
+  for (const DbcDerived &d : graph) {
+    if (d.hold || !(d.inputs & expired)) {
+      continue;
+    }
+    invalidated |= st.valid_mask & d.outputs;
+    st.valid_mask &= ~d.outputs;
+    expired |= d.outputs;
+  }
+  return invalidated;
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+// Tabelle generate da host/dbcgen per il DBC del prodotto (product.h)
+#include "product.h"
+#if REEFILLA_PRODUCT == REEFILLA_PRODUCT_FILLEE
+#include "dbc_generated_fillee.h"
+#else
+#include "dbc_generated_voltab.h"
+#endif
@@ -0,0 +1,105 @@
+#pragma once
+
+// ----------------------------------------------------
+// GENERATO da host/dbcgen a partire da VCU_Display.dbc: NON MODIFICARE
+// ----------------------------------------------------
+// Rigenerare con: cmake --build <build-host> --target dbcgen_update
+
+#include "dbc_signal.h"
+
+// ---- Messaggi ----
+
+enum DbcMessageIndex : uint16_t
+{
+  DBC_MSG_VCU_DISPLAY_STATUS_2 = 0,
+  DBC_MSG_VCU_DISPLAY_DIAG = 1,
+  DBC_MSG_VCU_DISPLAY_STATUS = 2,
+  DBC_MESSAGE_COUNT = 3,
+};
+
+constexpr uint32_t DBC_ID_VCU_DISPLAY_STATUS_2 = 0x1088A1F1UL;
+// Diagnostica multiplexata: DiagPage sceglie la pagina, una per frame a rotazione
+constexpr uint32_t DBC_ID_VCU_DISPLAY_DIAG = 0x1088A2F1UL;
+constexpr uint32_t DBC_ID_VCU_DISPLAY_STATUS = 0x1088A0F1UL;
+
+constexpr DbcMessageInfo DBC_MESSAGES[DBC_MESSAGE_COUNT] = {
+  { "VCU_Display_Status_2", 0x1088A1F1UL, true, 8, 100 },
+  { "VCU_Display_Diag", 0x1088A2F1UL, true, 8, 100 },
+  { "VCU_Display_Status", 0x1088A0F1UL, true, 8, 100 },
+};
+
+// ---- Segnali ----
+
+// VCU_Display_Status_2
+constexpr DbcSignal DBC_SIG_VCU_DISPLAY_STATUS_2_INV_GRID_V_AC =
+    dbc_signal("INV_GRID_V_AC", "V", 0, 16, DbcByteOrder::Intel, false, 0.1f, 0.0f);
+constexpr DbcSignal DBC_SIG_VCU_DISPLAY_STATUS_2_INV_P_AC =
+    dbc_signal("INV_P_AC", "W", 16, 16, DbcByteOrder::Intel, true, 1.0f, 0.0f);
+
+// VCU_Display_Diag
+constexpr DbcSignal DBC_SIG_VCU_DISPLAY_DIAG_DIAG_PAGE =
+    dbc_signal("DiagPage", "", 0, 8, DbcByteOrder::Intel, false, 1.0f, 0.0f);
+constexpr DbcSignal DBC_SIG_VCU_DISPLAY_DIAG_CELL_V_MIN =
+    dbc_muxed(dbc_signal("CellV_Min", "mV", 8, 16, DbcByteOrder::Intel, false, 1.0f, 0.0f), 0);
+constexpr DbcSignal DBC_SIG_VCU_DISPLAY_DIAG_CELL_V_MAX =
+    dbc_muxed(dbc_signal("CellV_Max", "mV", 24, 16, DbcByteOrder::Intel, false, 1.0f, 0.0f), 0);
+constexpr DbcSignal DBC_SIG_VCU_DISPLAY_DIAG_CELL_T_MIN =
+    dbc_muxed(dbc_signal("CellT_Min", "C", 40, 8, DbcByteOrder::Intel, true, 1.0f, 0.0f), 0);
+constexpr DbcSignal DBC_SIG_VCU_DISPLAY_DIAG_CELL_T_MAX =
+    dbc_muxed(dbc_signal("CellT_Max", "C", 48, 8, DbcByteOrder::Intel, true, 1.0f, 0.0f), 0);
+constexpr DbcSignal DBC_SIG_VCU_DISPLAY_DIAG_BMS_FAULT_CODE =
+    dbc_muxed(dbc_signal("BMS_FaultCode", "", 8, 16, DbcByteOrder::Intel, false, 1.0f, 0.0f), 1);
+constexpr DbcSignal DBC_SIG_VCU_DISPLAY_DIAG_INV_FAULT_CODE =
+    dbc_muxed(dbc_signal("INV_FaultCode", "", 24, 16, DbcByteOrder::Intel, false, 1.0f, 0.0f), 1);
+constexpr DbcSignal DBC_SIG_VCU_DISPLAY_DIAG_VCU_UPTIME =
+    dbc_muxed(dbc_signal("VCU_Uptime", "s", 40, 24, DbcByteOrder::Intel, false, 1.0f, 0.0f), 1);
+constexpr DbcSignal DBC_SIG_VCU_DISPLAY_DIAG_GRID_FREQ =
+    dbc_muxed(dbc_signal("GridFreq", "Hz", 8, 16, DbcByteOrder::Intel, false, 0.01f, 0.0f), 2);
+constexpr DbcSignal DBC_SIG_VCU_DISPLAY_DIAG_INV_I_AC =
+    dbc_muxed(dbc_signal("INV_I_AC", "A", 24, 16, DbcByteOrder::Intel, true, 0.1f, 0.0f), 2);
+// Valori del multiplexor di VCU_Display_Diag (jump table, vedi dbc_mux_table)
+constexpr size_t DBC_MUX_COUNT_VCU_DISPLAY_DIAG = 3;
+
+// VCU_Display_Status
+constexpr DbcSignal DBC_SIG_VCU_DISPLAY_STATUS_BMS_SOC =
+    dbc_signal("BMS_SOC", "%", 0, 8, DbcByteOrder::Intel, false, 1.0f, 0.0f);
+// TimeToFull in carica, TimeToEmpty in scarica
+constexpr DbcSignal DBC_SIG_VCU_DISPLAY_STATUS_REMAINING_TIME =
+    dbc_signal("RemainingTime", "s", 8, 16, DbcByteOrder::Intel, false, 1.0f, 0.0f);
+constexpr DbcSignal DBC_SIG_VCU_DISPLAY_STATUS_MSM_DEBOUNCED_STATE =
+    dbc_signal("MSM_DebouncedState", "", 24, 8, DbcByteOrder::Intel, false, 1.0f, 0.0f);
+constexpr DbcSignal DBC_SIG_VCU_DISPLAY_STATUS_MAX_BATTERY_TEMP =
+    dbc_signal("MaxBatteryTemp", "C", 32, 8, DbcByteOrder::Intel, true, 1.0f, 0.0f);
+constexpr DbcSignal DBC_SIG_VCU_DISPLAY_STATUS_MAX_INVERTER_TEMP =
+    dbc_signal("MaxInverterTemp", "C", 40, 8, DbcByteOrder::Intel, true, 1.0f, 0.0f);
+constexpr DbcSignal DBC_SIG_VCU_DISPLAY_STATUS_BMS_P_DC =
+    dbc_signal("BMS_P_DC", "W", 48, 16, DbcByteOrder::Intel, true, 1.0f, 0.0f);
+
+// ---- Tabelle VAL_: nullptr se il valore non ha descrizione ----
+
+inline const char *dbc_str_vcu_display_status_msm_debounced_state(int64_t raw)
+{
+  static constexpr const char *const TABLE[3] = {
+    "Standby",
+    "Charging",
+    "Discharging",
+  };
+  return (raw >= 0 && raw <= 2) ? TABLE[raw] : nullptr;
+}
+
+// ---- Hash perfetto minimo (ID, esteso) -> DbcMessageIndex ----
+
+constexpr uint16_t DBC_PHF_SEEDS[] = { 11 };
+
+constexpr uint32_t DBC_PHF_KEYS[DBC_MESSAGE_COUNT] = { 0x9088A1F1U, 0x9088A2F1U, 0x9088A0F1U };
+
+constexpr DbcPhf DBC_PHF = {
+  DBC_PHF_SEEDS, sizeof(DBC_PHF_SEEDS) / sizeof(DBC_PHF_SEEDS[0]),
+  DBC_PHF_KEYS, DBC_MESSAGE_COUNT,
+};
+
+// Indice del messaggio (DbcMessageIndex) oppure -1 se non è nel DBC
+inline int dbc_message_find(uint32_t id, bool extended)
+{
+  return dbc_phf_find(DBC_PHF, id, extended);
+}
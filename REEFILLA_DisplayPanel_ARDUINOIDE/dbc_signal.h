@@ -0,0 +1,482 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <array>
+#include <initializer_list>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// ----------------------------------------------------
+// Motore DBC a tabelle: descrittori di segnale constexpr
+// ----------------------------------------------------
+// Ogni segnale è descritto come nel DBC: start bit, lunghezza, byte order,
+// segno, factor/offset, valore raw invalido e unità. Shift, maschera ed
+// estensione del segno sono calcolati a compile time da dbc_signal().
+//
+// Decodifica di un messaggio:
+// - il payload viene caricato una volta sola in due word da 64 bit
+//   (little endian per Intel, big endian per Motorola, un bswap)
+// - ogni segnale è poi shift + mask (+ due shift per il segno) sulla word
+//   del proprio byte order, senza salti
+// - il layout di un messaggio è una tupla di binding segnale -> campo dello
+//   stato, srotolata a compile time: aggiungere segnali aggiunge istruzioni
+//   ma nessun branch per frame
+//
+// Convenzione start bit (come nel DBC):
+//   Intel    : LSB del segnale, bit = byte * 8 + bit_nel_byte
+//   Motorola : MSB del segnale, stessa numerazione (bit 7 = MSB del byte 0)
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__)
+#error "dbc_signal.h assume una CPU little endian (ESP32 / x86 / ARM)"
+#endif
+
+enum class DbcByteOrder : uint8_t
+{
+  Intel    = 0,   // @1 nel DBC
+  Motorola = 1,   // @0 nel DBC
+};
+
+// Valore raw che il DBC riserva a "dato non disponibile"
+struct DbcInvalid
+{
+  bool     present;
+  uint64_t raw;   // confrontato col raw prima dell'estensione del segno
+};
+
+constexpr DbcInvalid DBC_NO_INVALID = { false, 0 };
+
+constexpr DbcInvalid dbc_invalid(uint64_t raw)
+{
+  return { true, raw };
+}
+
+struct DbcSignal
+{
+  const char  *name;
+  const char  *unit;
+  uint8_t      start_bit;
+  uint8_t      length;
+  DbcByteOrder order;
+  bool         is_signed;
+  float        factor;
+  float        offset;
+  DbcInvalid   invalid;
+
+  // Calcolati da dbc_signal()
+  uint8_t      shift;        // posizione dell'LSB nella word del byte order
+  uint8_t      sign_shift;   // 64 - length se signed, altrimenti 0
+  uint64_t     mask;
+  bool         integral;     // factor/offset interi: niente float in decodifica
+
+  int16_t      mux;          // valore del multiplexor (m<n>), DBC_NOT_MUXED se sempre presente
+};
+
+constexpr int16_t DBC_NOT_MUXED = -1;
+
+// Non constexpr di proposito: se un descrittore è fuori dal payload la
+// chiamata in un contesto constexpr fa fallire la compilazione.
+void dbc_signal_out_of_range();
+
+constexpr DbcSignal dbc_signal(const char *name, const char *unit,
+                               uint8_t start_bit, uint8_t length,
+                               DbcByteOrder order, bool is_signed,
+                               float factor, float offset,
+                               DbcInvalid invalid = DBC_NO_INVALID)
+{
+  // Motorola: posizione dell'MSB contando dall'MSB del byte 0
+  const unsigned msb_be = (start_bit / 8U) * 8U + (7U - start_bit % 8U);
+  const unsigned shift  = (order == DbcByteOrder::Intel)
+                              ? start_bit
+                              : 64U - msb_be - length;
+
+  if (length == 0 || length > 64 ||
+      (order == DbcByteOrder::Intel    && start_bit + length > 64U) ||
+      (order == DbcByteOrder::Motorola && msb_be + length > 64U)) {
+    dbc_signal_out_of_range();
+  }
+
+  return {
+    name, unit, start_bit, length, order, is_signed, factor, offset, invalid,
+    static_cast<uint8_t>(shift),
+    static_cast<uint8_t>(is_signed ? 64U - length : 0U),
+    (length == 64) ? ~0ULL : ((1ULL << length) - 1ULL),
+    factor == static_cast<float>(static_cast<int32_t>(factor)) &&
+        offset == static_cast<float>(static_cast<int32_t>(offset)),
+    DBC_NOT_MUXED,
+  };
+}
+
+// Segnale presente solo quando il multiplexor del messaggio vale value
+constexpr DbcSignal dbc_muxed(DbcSignal s, uint8_t value)
+{
+  s.mux = value;
+  return s;
+}
+
+// ----------------------------------------------------
+// Estrazione
+// ----------------------------------------------------
+
+// Payload caricato una volta per messaggio: word[Intel] = LE, word[Motorola] = BE
+struct DbcPayload
+{
+  uint64_t word[2];
+};
+
+inline DbcPayload dbc_load(const uint8_t data[8])
+{
+  DbcPayload p;
+  memcpy(&p.word[0], data, sizeof(p.word[0]));
+  p.word[1] = __builtin_bswap64(p.word[0]);
+  return p;
+}
+
+// Valore raw (bit grezzi, senza segno)
+inline uint64_t dbc_raw(const DbcSignal &s, const DbcPayload &p)
+{
+  return (p.word[static_cast<uint8_t>(s.order)] >> s.shift) & s.mask;
+}
+
+// Raw con estensione del segno (no-op per i segnali unsigned)
+inline int64_t dbc_raw_signed(const DbcSignal &s, uint64_t raw)
+{
+  return static_cast<int64_t>(raw << s.sign_shift) >> s.sign_shift;
+}
+
+inline bool dbc_is_invalid(const DbcSignal &s, uint64_t raw)
+{
+  return s.invalid.present & (raw == s.invalid.raw);
+}
+
+// Valore fisico in float (diagnostica / log, non usato nel path per frame)
+inline float dbc_phys(const DbcSignal &s, const DbcPayload &p)
+{
+  return static_cast<float>(dbc_raw_signed(s, dbc_raw(s, p))) * s.factor + s.offset;
+}
+
+// ----------------------------------------------------
+// Layout di un messaggio: binding segnale -> campo dello stato
+// ----------------------------------------------------
+
+template <typename Field>
+struct DbcBinding
+{
+  DbcSignal sig;
+  Field     field;   // selettore: [](State &st) -> T & { ... }
+};
+
+template <typename Field>
+constexpr DbcBinding<Field> dbc_bind(const DbcSignal &sig, Field field)
+{
+  return { sig, field };
+}
+
+// Selettore di un campo (anche elemento di array) dello stato
+#define DBC_FIELD(member) [](auto &st) -> auto & { return st.member; }
+
+template <typename... Bindings>
+constexpr std::tuple<Bindings...> dbc_layout(Bindings... bindings)
+{
+  return std::tuple<Bindings...>(bindings...);
+}
+
+template <typename T>
+inline T dbc_scale(const DbcSignal &s, int64_t value)
+{
+  if (s.integral) {
+    return static_cast<T>(value * static_cast<int32_t>(s.factor) +
+                          static_cast<int32_t>(s.offset));
+  }
+  const float phys = static_cast<float>(value) * s.factor + s.offset;
+  if (std::is_integral<T>::value) {
+    return static_cast<T>(phys + (phys >= 0.0f ? 0.5f : -0.5f));
+  }
+  return static_cast<T>(phys);
+}
+
+// Decodifica un segnale nel suo campo. Se il raw è il valore invalido il
+// campo riceve no_data (selezione, non salto).
+template <typename State, typename Field>
+inline void dbc_store(const DbcBinding<Field> &b, const DbcPayload &p,
+                      State &st, int32_t no_data)
+{
+  using T = typename std::remove_reference<decltype(b.field(st))>::type;
+
+  const uint64_t raw   = dbc_raw(b.sig, p);
+  const T        value = dbc_scale<T>(b.sig, dbc_raw_signed(b.sig, raw));
+  b.field(st) = dbc_is_invalid(b.sig, raw) ? static_cast<T>(no_data) : value;
+}
+
+// Decodifica tutti i segnali di un layout
+template <typename State, typename... Bindings>
+inline void dbc_decode_layout(const std::tuple<Bindings...> &layout,
+                              const DbcPayload &p, State &st, int32_t no_data)
+{
+  std::apply([&](const auto &...b) { (dbc_store(b, p, st, no_data), ...); }, layout);
+}
+
+// Come dbc_store, ma dice se il campo ha cambiato valore
+template <typename State, typename Field>
+inline bool dbc_store_changed(const DbcBinding<Field> &b, const DbcPayload &p,
+                              State &st, int32_t no_data)
+{
+  using T = typename std::remove_reference<decltype(b.field(st))>::type;
+
+  const T old = b.field(st);
+  dbc_store(b, p, st, no_data);
+  return b.field(st) != old;
+}
+
+template <typename State, typename Tuple, size_t... I>
+inline uint32_t dbc_decode_changes(const Tuple &layout, const DbcPayload &p, State &st,
+                                   int32_t no_data, std::index_sequence<I...>)
+{
+  return (0U | ... |
+          (static_cast<uint32_t>(dbc_store_changed(std::get<I>(layout), p, st, no_data)) << I));
+}
+
+// Decodifica tutti i segnali di un layout e ritorna la maschera dei campi
+// cambiati: bit i = i-esimo binding del layout (max 32 binding)
+template <typename State, typename... Bindings>
+inline uint32_t dbc_decode_layout_changes(const std::tuple<Bindings...> &layout,
+                                          const DbcPayload &p, State &st, int32_t no_data)
+{
+  static_assert(sizeof...(Bindings) <= 32, "dbc_decode_layout_changes: max 32 segnali");
+  return dbc_decode_changes(layout, p, st, no_data, std::index_sequence_for<Bindings...>());
+}
+
+// Maschera con un bit per ogni binding del layout
+template <typename... Bindings>
+constexpr uint32_t dbc_layout_mask(const std::tuple<Bindings...> &)
+{
+  return (sizeof...(Bindings) >= 32) ? ~0U : ((1U << sizeof...(Bindings)) - 1U);
+}
+
+// Copia del descrittore che restituisce il raw così com'è (factor 1,
+// offset 0): per i campi di stato che tengono l'unità del bus. L'unità del
+// DBC non vale più, resta vuota.
+constexpr DbcSignal dbc_as_raw(const DbcSignal &s)
+{
+  DbcSignal raw = dbc_signal(s.name, "", s.start_bit, s.length, s.order,
+                             s.is_signed, 1.0f, 0.0f, s.invalid);
+  raw.mux = s.mux;
+  return raw;
+}
+
+// ----------------------------------------------------
+// Valori grezzi per segnale (decodifica di tracce sull'host)
+// ----------------------------------------------------
+// Stessi layout della decodifica nello stato, ma senza stato: il raw con
+// segno esteso di ogni binding finisce in raw[FIRST + i], scala e
+// InvalidRawValue si applicano dopo con il descrittore (dbc_layout_desc).
+
+template <const auto &LAYOUT, unsigned FIRST>
+inline uint32_t dbc_raw_layout(const DbcPayload &p, int64_t *raw)
+{
+  std::apply([&](const auto &...b) {
+    unsigned i = FIRST;
+    ((raw[i++] = dbc_raw_signed(b.sig, dbc_raw(b.sig, p))), ...);
+  }, LAYOUT);
+  return dbc_layout_mask(LAYOUT) << FIRST;
+}
+
+inline uint32_t dbc_raw_none(const DbcPayload &, int64_t *)
+{
+  return 0;
+}
+
+// Descrittori dei binding del layout in desc[first + i] (constexpr: per le
+// tabelle segnale -> descrittore)
+template <size_t N, typename... Bindings>
+constexpr void dbc_layout_desc(const std::tuple<Bindings...> &layout, unsigned first,
+                               std::array<const DbcSignal *, N> &desc)
+{
+  std::apply([&](const auto &...b) {
+    unsigned i = first;
+    ((desc[i++] = &b.sig), ...);
+  }, layout);
+}
+
+// ----------------------------------------------------
+// Valore di un campo per segnale (consumatori generici, signal_bus.h)
+// ----------------------------------------------------
+// Una funzione per binding che legge il campo dello stato come float: la
+// tabella segnale -> funzione si costruisce a compile time come quella dei
+// descrittori, i derivati si aggiungono a mano.
+
+template <typename State>
+using DbcValueFn = float (*)(const State &st);
+
+template <const auto &LAYOUT, size_t I, typename State>
+inline float dbc_field_value(const State &st)
+{
+  return static_cast<float>(std::get<I>(LAYOUT).field(st));
+}
+
+template <const auto &LAYOUT, typename State, size_t N, size_t... I>
+constexpr void dbc_layout_values_at(unsigned first, std::array<DbcValueFn<State>, N> &value,
+                                    std::index_sequence<I...>)
+{
+  ((value[first + I] = &dbc_field_value<LAYOUT, I, State>), ...);
+}
+
+// Lettori dei binding del layout in value[first + i]
+template <const auto &LAYOUT, typename State, size_t N>
+constexpr void dbc_layout_values(unsigned first, std::array<DbcValueFn<State>, N> &value)
+{
+  using Layout = typename std::remove_cv<typename std::remove_reference<decltype(LAYOUT)>::type>::type;
+  dbc_layout_values_at<LAYOUT>(first, value, std::make_index_sequence<std::tuple_size<Layout>::value>());
+}
+
+// ----------------------------------------------------
+// Messaggi multiplexati (SG_ ... M / m<n> nel DBC)
+// ----------------------------------------------------
+// Il segnale multiplexor sceglie quale gruppo di segnali c'è nel payload.
+// Ogni gruppo è un layout normale; la tabella DbcMuxTable ha un caso per
+// valore del multiplexor, indicizzato direttamente dal raw: la decodifica
+// è un load del payload, un'estrazione del raw e una chiamata indiretta,
+// senza catene di if qualunque sia il numero di gruppi. Un raw fuori
+// tabella (valore non definito nel DBC) finisce nel caso vuoto in coda.
+//
+// I bit DbcChange dei gruppi sono contigui come per i messaggi normali:
+// il caso sposta la maschera dei cambiamenti di FIRST.
+
+template <typename State>
+struct DbcMuxCase
+{
+  uint32_t (*decode)(const DbcPayload &p, State &st, int32_t no_data);   // -> bit cambiati (già spostati)
+  uint32_t (*raw)(const DbcPayload &p, int64_t *raw);                   // -> bit scritti (dbc_raw_layout)
+  uint32_t signals;   // bit dei segnali del gruppo
+  int16_t  value;     // valore del multiplexor, DBC_NOT_MUXED = caso vuoto
+};
+
+template <typename State, const auto &LAYOUT, unsigned FIRST>
+inline uint32_t dbc_mux_decode(const DbcPayload &p, State &st, int32_t no_data)
+{
+  return dbc_decode_layout_changes(LAYOUT, p, st, no_data) << FIRST;
+}
+
+template <typename State>
+inline uint32_t dbc_mux_decode_none(const DbcPayload &, State &, int32_t)
+{
+  return 0;
+}
+
+// Tutti i segnali del layout appartengono al gruppo value
+template <typename... Bindings>
+constexpr bool dbc_layout_mux_is(const std::tuple<Bindings...> &layout, int16_t value)
+{
+  return std::apply([&](const auto &...b) { return ((b.sig.mux == value) && ...); }, layout);
+}
+
+// Gruppo del valore V: LAYOUT decodificato nei bit da FIRST in su
+template <typename State, uint8_t V, const auto &LAYOUT, unsigned FIRST>
+constexpr DbcMuxCase<State> dbc_mux_case()
+{
+  static_assert(dbc_layout_mux_is(LAYOUT, V), "dbc_mux_case: segnale di un altro gruppo nel layout");
+  return { &dbc_mux_decode<State, LAYOUT, FIRST>, &dbc_raw_layout<LAYOUT, FIRST>,
+           dbc_layout_mask(LAYOUT) << FIRST, V };
+}
+
+template <typename State, size_t N>
+struct DbcMuxTable
+{
+  DbcSignal         selector;
+  DbcMuxCase<State> cases[N + 1];   // indice = valore del multiplexor, cases[N] = vuoto
+
+  const DbcMuxCase<State> &select(const DbcPayload &p) const
+  {
+    const uint64_t raw = dbc_raw(selector, p);
+    return cases[raw < N ? raw : N];
+  }
+
+  // Unione dei bit di tutti i gruppi
+  constexpr uint32_t signals() const
+  {
+    uint32_t mask = 0;
+    for (const DbcMuxCase<State> &c : cases) {
+      mask |= c.signals;
+    }
+    return mask;
+  }
+};
+
+// Jump table di N valori (DBC_MUX_COUNT_<MSG> da dbcgen); i valori senza
+// gruppo decodificano il caso vuoto. Gruppi ripetuti o fuori range non
+// compilano.
+template <typename State, size_t N, typename... Cases>
+constexpr DbcMuxTable<State, N> dbc_mux_table(const DbcSignal &selector, Cases... groups)
+{
+  DbcMuxTable<State, N> t = {};
+  t.selector = selector;
+  for (DbcMuxCase<State> &c : t.cases) {
+    c = { &dbc_mux_decode_none<State>, &dbc_raw_none, 0, DBC_NOT_MUXED };
+  }
+  for (const DbcMuxCase<State> &g : { groups... }) {
+    if (g.value < 0 || (size_t)g.value >= N || t.cases[g.value].value != DBC_NOT_MUXED) {
+      dbc_signal_out_of_range();
+    }
+    t.cases[g.value] = g;
+  }
+  return t;
+}
+
+// ----------------------------------------------------
+// Messaggi e dispatch con hash perfetto minimo
+// ----------------------------------------------------
+// Le tabelle sono generate da host/dbcgen a partire dal .dbc (vedi
+// dbc_generated.h). La chiave di un messaggio è l'ID con il bit 31 a 1 se
+// esteso; l'hash è a due livelli (hash-and-displace): il primo hash sceglie
+// un bucket, il seed del bucket sposta il secondo hash su uno slot libero.
+// Gli slot sono esattamente tanti quanti i messaggi e lo slot è l'indice
+// del messaggio: lookup = 2 hash + 1 confronto, senza cicli né branch
+// dipendenti dal numero di messaggi.
+
+struct DbcMessageInfo
+{
+  const char *name;
+  uint32_t    id;
+  bool        extended;
+  uint8_t     dlc;
+  uint16_t    cycle_ms;   // GenMsgCycleTime, 0 = non periodico
+};
+
+struct DbcPhf
+{
+  const uint16_t *seeds;     // un seed per bucket
+  uint32_t        buckets;
+  const uint32_t *keys;      // chiave del messaggio in ogni slot
+  uint32_t        count;     // slot = messaggi
+};
+
+constexpr uint32_t dbc_phf_key(uint32_t id, bool extended)
+{
+  return extended ? (id | 0x80000000U) : id;
+}
+
+constexpr uint32_t dbc_phf_hash(uint32_t key, uint32_t seed)
+{
+  uint32_t x = (key ^ (seed * 0x9E3779B9U)) * 0x85EBCA6BU;
+  x ^= x >> 13;
+  x *= 0xC2B2AE35U;
+  x ^= x >> 16;
+  return x;
+}
+
+// Riduzione in [0, n) senza divisione
+constexpr uint32_t dbc_phf_reduce(uint32_t h, uint32_t n)
+{
+  return static_cast<uint32_t>((static_cast<uint64_t>(h) * n) >> 32);
+}
+
+// Indice del messaggio oppure -1 se l'ID non è nel DBC
+inline int dbc_phf_find(const DbcPhf &phf, uint32_t id, bool extended)
+{
+  const uint32_t key    = dbc_phf_key(id, extended);
+  const uint32_t bucket = dbc_phf_reduce(dbc_phf_hash(key, 0), phf.buckets);
+  const uint32_t slot   = dbc_phf_reduce(dbc_phf_hash(key, phf.seeds[bucket]), phf.count);
+  return (phf.keys[slot] == key) ? static_cast<int>(slot) : -1;
+}
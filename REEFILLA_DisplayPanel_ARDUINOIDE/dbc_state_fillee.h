@@ -0,0 +1,100 @@
+#pragma once
+
+#include <stdint.h>
+
+// ----------------------------------------------------
+// Segnali e stato decodificato: fillee
+// ----------------------------------------------------
+// Incluso da dbc_decoder.h quando REEFILLA_PRODUCT è fillee (product.h).
+
+// Un bit per segnale decodificato, nell'ordine dei layout di dbc_decoder_fillee.cpp
+enum DbcChange : uint8_t
+{
+  // VCU_Display_Status
+  DBC_CHG_SOC_TOT = 0,
+  DBC_CHG_SOC_ACTIVE,
+  DBC_CHG_TIME_TO_FULL,
+  DBC_CHG_TIME_TO_EMPTY,
+  DBC_CHG_MAIN_STATE,
+  // VCU_Display_Status_2
+  DBC_CHG_INV_P_AC_0,
+  DBC_CHG_INV_P_AC_1,
+  DBC_CHG_INV_P_AC_2,
+  // VCU_Display_Diag (multiplexato): pagina 0
+  DBC_CHG_CELL_V_MIN,
+  DBC_CHG_CELL_V_MAX,
+  DBC_CHG_CELL_T_MIN,
+  DBC_CHG_CELL_T_MAX,
+  // pagina 1
+  DBC_CHG_BMS_FAULT,
+  DBC_CHG_INV_FAULT,
+  DBC_CHG_VCU_UPTIME,
+  // pagina 2
+  DBC_CHG_INV_V_DC_0,
+  DBC_CHG_INV_V_DC_1,
+  DBC_CHG_INV_V_DC_2,
+  // Derivati (DbcState::derived, vedi dbc_derived.h)
+  DBC_CHG_ENERGY_0,
+  DBC_CHG_ENERGY_1,
+  DBC_CHG_ENERGY_2,
+  DBC_CHG_ENERGY_TOT,
+  DBC_CHG_P_AC_AVG_0,
+  DBC_CHG_P_AC_AVG_1,
+  DBC_CHG_P_AC_AVG_2,
+  DBC_CHG_SOC_RATE,
+
+  DBC_CHG_COUNT
+};
+
+// Segnali decodificati dal bus: bit 0 .. DBC_CHG_DECODED - 1 (gli altri sono derivati)
+static constexpr uint8_t DBC_CHG_DECODED = DBC_CHG_ENERGY_0;
+
+// Segnali calcolati dal task RX a partire da quelli decodificati
+// (dbc_decoder_fillee.cpp, tabella DBC_DERIVED). Validi se il bit è in valid_mask.
+struct DbcDerivedState
+{
+  uint32_t energy_wh[3]    = { 0, 0, 0 }; // energia AC erogata per linea dall'avvio [Wh]
+  uint32_t energy_tot_wh   = 0;           // somma delle tre linee [Wh]
+  int32_t  p_ac_avg_w[3]   = { 0, 0, 0 }; // media mobile di INV_P_AC_VECT[*] [W]
+  int16_t  soc_rate_dpct_h = 0;           // variazione di SOC_ACTIVE [0.1 %/h]
+};
+
+// Stato globale decodificato dal "DBC"
+struct DbcState
+{
+  // ================== VCU_Display_Status (0x1088A0F1) ==================
+  int16_t  soc_tot_percent       = -11; // SOC_TOT [%]
+  int16_t  soc_active_percent    = -11; // SOC_ACTIVE [%]
+  int32_t  time_to_full_s        = -11; // TimeToFull [s]
+  int32_t  time_to_empty_s       = -11; // TimeToEmpty [s]
+  int16_t  main_state            = -11; // Main state machine enum
+  uint32_t status_lastUpdate_ms  = 0;   // millis ultima ricezione valida
+
+  // ================== VCU_Display_Status_2 (0x1088A1F1) ==================
+  int32_t  inv_p_ac_w[3]         = { -11, -11, -11 }; // INV_P_AC_VECT[*] [W]
+  uint32_t status2_lastUpdate_ms = 0;   // millis ultima ricezione valida
+
+  // ============ VCU_Display_Diag (0x1088A2F1), multiplexato su DiagPage ============
+  // Ogni pagina è valida (valid_mask) dal suo primo frame
+  int16_t  diag_page             = -11; // DiagPage dell'ultimo frame
+  int32_t  cell_v_min_mv         = -11; // CellV_Min [mV]          (pagina 0)
+  int32_t  cell_v_max_mv         = -11; // CellV_Max [mV]
+  int16_t  cell_t_min_c          = -11; // CellT_Min [C]
+  int16_t  cell_t_max_c          = -11; // CellT_Max [C]
+  int32_t  bms_fault_code        = -11; // BMS_FaultCode           (pagina 1)
+  int32_t  inv_fault_code        = -11; // INV_FaultCode
+  int32_t  vcu_uptime_s          = -11; // VCU_Uptime [s]
+  float    inv_v_dc_v[3]         = { -11, -11, -11 }; // INV_V_DC_VECT[*] [V] (pagina 2)
+  uint32_t diag_lastUpdate_ms    = 0;   // millis ultima ricezione valida
+
+  // ================== Derivati ==================
+  DbcDerivedState derived;
+
+  // Versione dello snapshot in cui ogni segnale ha cambiato valore
+  // (0 = mai), vedi dbc_changed_since()
+  uint32_t change_seq[DBC_CHG_COUNT] = {};
+
+  // Segnali validi (bit DbcChange): messaggio ricevuto e non in timeout
+  // (dbc_supervise.h). Un cambio di validità conta come cambio del segnale.
+  uint32_t valid_mask = 0;
+};
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <stdint.h>
+
+// ----------------------------------------------------
+// Segnali e stato decodificato: voltab
+// ----------------------------------------------------
+// Incluso da dbc_decoder.h quando REEFILLA_PRODUCT è voltab (product.h).
+
+// Un bit per segnale decodificato, nell'ordine dei layout di dbc_decoder_voltab.cpp
+enum DbcChange : uint8_t
+{
+  // VCU_Display_Status
+  DBC_CHG_SOC = 0,
+  DBC_CHG_REMAINING_TIME,
+  DBC_CHG_MSM_STATE,
+  DBC_CHG_MAX_BATT_TEMP,
+  DBC_CHG_MAX_INV_TEMP,
+  DBC_CHG_BMS_P_DC,
+  // VCU_Display_Status_2
+  DBC_CHG_GRID_V_AC,
+  DBC_CHG_INV_P_AC,
+  // VCU_Display_Diag (multiplexato): pagina 0
+  DBC_CHG_CELL_V_MIN,
+  DBC_CHG_CELL_V_MAX,
+  DBC_CHG_CELL_T_MIN,
+  DBC_CHG_CELL_T_MAX,
+  // pagina 1
+  DBC_CHG_BMS_FAULT,
+  DBC_CHG_INV_FAULT,
+  DBC_CHG_VCU_UPTIME,
+  // pagina 2
+  DBC_CHG_GRID_FREQ,
+  DBC_CHG_INV_I_AC,
+  // Derivati (DbcState::derived, vedi dbc_derived.h)
+  DBC_CHG_ENERGY,
+  DBC_CHG_P_AC_AVG,
+  DBC_CHG_SOC_RATE,
+
+  DBC_CHG_COUNT
+};
+
+// Segnali decodificati dal bus: bit 0 .. DBC_CHG_DECODED - 1 (gli altri sono derivati)
+static constexpr uint8_t DBC_CHG_DECODED = DBC_CHG_ENERGY;
+
+// Segnali calcolati dal task RX a partire da quelli decodificati
+// (dbc_decoder_voltab.cpp, tabella DBC_DERIVED). Validi se il bit è in valid_mask.
+struct DbcDerivedState
+{
+  uint32_t energy_wh       = 0;   // energia AC erogata dall'avvio [Wh]
+  int32_t  p_ac_avg_w      = 0;   // media mobile di INV_P_AC [W]
+  int16_t  soc_rate_dpct_h = 0;   // variazione di BMS_SOC [0.1 %/h]
+};
+
+// Stato globale decodificato dal "DBC"
+struct DbcState
+{
+  // ================== VCU_Display_Status (0x1088A0F1) ==================
+  uint8_t  soc_percent           = 0;   // BMS_SOC [% 0..100]
+  uint16_t remaining_time_s      = 0;   // Remaining time [s]
+  uint8_t  msm_state             = 0;   // 0=standby,1=carica,2=scarica
+  int8_t   max_batt_temp_c       = 0;   // [°C]
+  int8_t   max_inv_temp_c        = 0;   // [°C]
+  int16_t  bms_p_dc_w            = 0;   // [W]
+  uint32_t status_lastUpdate_ms  = 0;   // millis ultima ricezione valida
+
+  // ================== VCU_Display_Status_2 (0x1088A1F1) ==================
+  uint16_t grid_v_ac_deciv       = 0;   // INV_GRID_V_AC [0.1 V]
+  int16_t  inv_p_ac_w            = 0;   // INV_P_AC [W]
+  uint32_t status2_lastUpdate_ms = 0;   // millis ultima ricezione valida
+
+  // ============ VCU_Display_Diag (0x1088A2F1), multiplexato su DiagPage ============
+  // Ogni pagina è valida (valid_mask) dal suo primo frame
+  int16_t  diag_page             = 0;   // DiagPage dell'ultimo frame
+  int32_t  cell_v_min_mv         = 0;   // CellV_Min [mV]          (pagina 0)
+  int32_t  cell_v_max_mv         = 0;   // CellV_Max [mV]
+  int16_t  cell_t_min_c          = 0;   // CellT_Min [C]
+  int16_t  cell_t_max_c          = 0;   // CellT_Max [C]
+  int32_t  bms_fault_code        = 0;   // BMS_FaultCode           (pagina 1)
+  int32_t  inv_fault_code        = 0;   // INV_FaultCode
+  int32_t  vcu_uptime_s          = 0;   // VCU_Uptime [s]
+  float    grid_freq_hz          = 0;   // GridFreq [Hz]           (pagina 2)
+  float    inv_i_ac_a            = 0;   // INV_I_AC [A]
+  uint32_t diag_lastUpdate_ms    = 0;   // millis ultima ricezione valida
+
+  // ================== Derivati ==================
+  DbcDerivedState derived;
+
+  // Versione dello snapshot in cui ogni segnale ha cambiato valore
+  // (0 = mai), vedi dbc_changed_since()
+  uint32_t change_seq[DBC_CHG_COUNT] = {};
+
+  // Segnali validi (bit DbcChange): messaggio ricevuto e non in timeout
+  // (dbc_supervise.h). Un cambio di validità conta come cambio del segnale.
+  uint32_t valid_mask = 0;
+};
@@ -0,0 +1,167 @@
+#include "dbc_stats.h"
+#include "online_stats.h"
+#include "seqlock.h"
+
+#include "esp_timer.h"
+
+#include <atomic>
+#include <math.h>
+
+// ----------------------------------------------------
+// STATO PER SEGNALE (solo task RX)
+// ----------------------------------------------------
+
+static constexpr float QUANTILE_P[DBC_STATS_QUANTILES] = { 0.50f, 0.95f, 0.99f };
+
+struct StatsAcc
+{
+  RunningStats rs;
+  P2Quantile   q[DBC_STATS_QUANTILES] = { P2Quantile(QUANTILE_P[0]),
+                                          P2Quantile(QUANTILE_P[1]),
+                                          P2Quantile(QUANTILE_P[2]) };
+
+  void add(float v)
+  {
+    rs.add(v);
+    for (P2Quantile &p : q) {
+      p.add(v);
+    }
+  }
+
+  void reset()
+  {
+    rs.reset();
+    for (P2Quantile &p : q) {
+      p.reset();
+    }
+  }
+
+  DbcSignalStats summary() const
+  {
+    DbcSignalStats s;
+    s.n        = rs.count();
+    s.mean     = rs.mean();
+    s.variance = rs.variance();
+    s.min      = rs.min();
+    s.max      = rs.max();
+    s.p50      = q[0].value();
+    s.p95      = q[1].value();
+    s.p99      = q[2].value();
+    return s;
+  }
+};
+
+// Riassunto pubblicato ai lettori
+struct StatsPublished
+{
+  DbcSignalStats boot;
+  DbcSignalStats window;
+  uint32_t       epoch;   // finestra a cui appartiene window
+};
+
+static StatsAcc                 s_boot[DBC_CHG_DECODED];
+static StatsAcc                 s_window[DBC_CHG_DECODED];
+static uint32_t                 s_window_epoch[DBC_CHG_DECODED];
+static Seqlock<StatsPublished>  s_pub[DBC_CHG_DECODED];
+static std::atomic<const char *> s_name[DBC_CHG_DECODED];
+static std::atomic<const char *> s_unit[DBC_CHG_DECODED];
+
+// Finestra corrente: cambiata da qualsiasi task, applicata dal task RX al
+// prossimo campione di ogni segnale
+static std::atomic<uint32_t> s_epoch{0};
+static std::atomic<uint64_t> s_window_start_us{0};
+
+// ----------------------------------------------------
+// API
+// ----------------------------------------------------
+
+void dbc_stats_add(DbcChange sig, const DbcSignal &desc, float v)
+{
+  if (sig >= DBC_CHG_DECODED || !isfinite(v)) {
+    return;
+  }
+  if (!s_name[sig].load(std::memory_order_relaxed)) {
+    s_unit[sig].store(desc.unit, std::memory_order_relaxed);
+    s_name[sig].store(desc.name, std::memory_order_release);
+  }
+
+  const uint32_t epoch = s_epoch.load(std::memory_order_acquire);
+  if (s_window_epoch[sig] != epoch) {
+    s_window_epoch[sig] = epoch;
+    s_window[sig].reset();
+  }
+
+  s_boot[sig].add(v);
+  s_window[sig].add(v);
+
+  StatsPublished pub;
+  pub.boot   = s_boot[sig].summary();
+  pub.window = s_window[sig].summary();
+  pub.epoch  = epoch;
+  s_pub[sig].publish(pub);
+}
+
+void dbc_stats_reset_window()
+{
+  s_window_start_us.store((uint64_t)esp_timer_get_time(), std::memory_order_relaxed);
+  s_epoch.fetch_add(1, std::memory_order_release);
+}
+
+uint64_t dbc_stats_window_start_us()
+{
+  return s_window_start_us.load(std::memory_order_relaxed);
+}
+
+bool dbc_stats_get(DbcChange sig, DbcStatsScope scope, DbcSignalStats &out)
+{
+  out = DbcSignalStats();
+  if (sig >= DBC_CHG_DECODED) {
+    return false;
+  }
+  StatsPublished pub;
+  if (s_pub[sig].read(pub) == 0) {
+    return false;
+  }
+  if (scope == DbcStatsScope::BOOT) {
+    out = pub.boot;
+  } else if (pub.epoch == s_epoch.load(std::memory_order_acquire)) {
+    out = pub.window;   // altrimenti finestra azzerata, nessun campione ancora
+  }
+  return out.n > 0;
+}
+
+const char *dbc_stats_name(DbcChange sig)
+{
+  return sig < DBC_CHG_DECODED ? s_name[sig].load(std::memory_order_acquire) : nullptr;
+}
+
+const char *dbc_stats_unit(DbcChange sig)
+{
+  return dbc_stats_name(sig) ? s_unit[sig].load(std::memory_order_relaxed) : nullptr;
+}
+
+void dbc_stats_dump(Print &out)
+{
+  const uint64_t window_s =
+      ((uint64_t)esp_timer_get_time() - dbc_stats_window_start_us()) / 1000000ULL;
+  out.printf("[stats] finestra da %lu s\n", (unsigned long)window_s);
+
+  for (uint8_t i = 0; i < DBC_CHG_DECODED; ++i) {
+    const DbcChange sig = static_cast<DbcChange>(i);
+    const char *name = dbc_stats_name(sig);
+    if (!name) {
+      continue;
+    }
+    for (uint8_t scope = 0; scope < 2; ++scope) {
+      DbcSignalStats s;
+      if (!dbc_stats_get(sig, static_cast<DbcStatsScope>(scope), s)) {
+        out.printf("[stats] %-32s %-6s --\n", name, scope ? "win" : "boot");
+        continue;
+      }
+      out.printf("[stats] %-32s %-6s n=%lu media=%.2f sd=%.2f min=%.2f max=%.2f "
+                 "p50=%.2f p95=%.2f p99=%.2f %s\n",
+                 name, scope ? "win" : "boot", (unsigned long)s.n, s.mean, sqrtf(s.variance),
+                 s.min, s.max, s.p50, s.p95, s.p99, dbc_stats_unit(sig));
+    }
+  }
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <Arduino.h>
+#include "dbc_decoder.h"   // DbcChange, DBC_CHG_DECODED
+#include "dbc_signal.h"    // DbcSignal, layout
+
+// ----------------------------------------------------
+// Statistiche online dei segnali decodificati (diagnostica sul campo)
+// ----------------------------------------------------
+// Per ogni segnale decodificato, due insiemi di statistiche (online_stats.h):
+//
+//   DbcStatsScope::BOOT    dall'avvio
+//   DbcStatsScope::WINDOW  dall'ultimo dbc_stats_reset_window()
+//
+// con media, varianza, min/max e p50/p95/p99 stimati con P². Ogni frame
+// decodificato aggiunge un campione per segnale (anche se il valore non è
+// cambiato); i valori "dato non disponibile" non contano.
+//
+// Il task RX aggiorna le statistiche in tempo costante, senza allocazioni,
+// e pubblica un riassunto per segnale in un Seqlock: la lettura
+// (dbc_stats_get) è coerente da qualsiasi task, senza mutex.
+
+// Quantili stimati (P²)
+#define DBC_STATS_QUANTILES  3
+
+enum class DbcStatsScope : uint8_t
+{
+  BOOT = 0,
+  WINDOW,
+};
+
+struct DbcSignalStats
+{
+  uint32_t n;          // campioni
+  float    mean;
+  float    variance;   // campionaria (n - 1)
+  float    min;
+  float    max;
+  float    p50;
+  float    p95;
+  float    p99;
+};
+
+// Nuovo campione v del segnale sig (task RX). desc dà nome e unità.
+void dbc_stats_add(DbcChange sig, const DbcSignal &desc, float v);
+
+// Un campione per ogni binding di un layout già decodificato in st: il
+// binding i è il segnale first + i. Campi a no_data ignorati.
+template <typename State, typename... Bindings>
+inline void dbc_stats_layout(const std::tuple<Bindings...> &layout, const State &st,
+                             DbcChange first, int32_t no_data)
+{
+  uint8_t i = first;
+  std::apply([&](const auto &...b) {
+    ((b.field(st) != no_data ? dbc_stats_add(static_cast<DbcChange>(i), b.sig, (float)b.field(st))
+                             : (void)0,
+      ++i), ...);
+  }, layout);
+}
+
+// Stessa cosa come funzione, per le jump table dei messaggi multiplexati
+template <const auto &LAYOUT, DbcChange FIRST, int32_t NO_DATA>
+void dbc_stats_case(const DbcState &st)
+{
+  dbc_stats_layout(LAYOUT, st, FIRST, NO_DATA);
+}
+
+// Azzera le statistiche WINDOW di tutti i segnali (qualsiasi task): ogni
+// segnale riparte da zero al prossimo campione, dbc_stats_get() le vede
+// vuote da subito.
+void dbc_stats_reset_window();
+
+// Inizio della finestra corrente [µs, esp_timer]
+uint64_t dbc_stats_window_start_us();
+
+// Statistiche di sig (qualsiasi task). False se non ci sono campioni.
+bool dbc_stats_get(DbcChange sig, DbcStatsScope scope, DbcSignalStats &out);
+
+// Nome e unità dal DBC (nullptr finché il segnale non ha campioni)
+const char *dbc_stats_name(DbcChange sig);
+const char *dbc_stats_unit(DbcChange sig);
+
+// Una riga per segnale, dall'avvio e nella finestra
+void dbc_stats_dump(Print &out);
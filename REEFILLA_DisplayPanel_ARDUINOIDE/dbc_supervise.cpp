@@ -0,0 +1,162 @@
+#include "dbc_supervise.h"
+#include "timer_wheel.h"
+#include "dlog.h"
+
+#include <atomic>
+
+// ----------------------------------------------------
+// RUOTA E STATO PER MESSAGGIO
+// ----------------------------------------------------
+
+typedef TimerWheel<DBC_SV_SLOTS, DBC_SV_TICK_MS * 1000U> DbcSvWheel;
+
+static constexpr uint32_t dbc_sv_max_cycle_ms()
+{
+  uint32_t max_ms = 0;
+  for (const DbcMessageInfo &m : DBC_MESSAGES) {
+    if (m.cycle_ms > max_ms) max_ms = m.cycle_ms;
+  }
+  return max_ms;
+}
+
+static_assert((uint64_t)dbc_sv_max_cycle_ms() * DBC_SV_TIMEOUT_CYCLES * 1000U <= DbcSvWheel::SPAN_US,
+              "DBC_SV_SLOTS * DBC_SV_TICK_MS non copre il timeout del messaggio più lento");
+static_assert(DBC_SV_TOLERANCE_PCT > 0 && DBC_SV_TOLERANCE_PCT < 100 &&
+              100 + DBC_SV_TOLERANCE_PCT < DBC_SV_TIMEOUT_CYCLES * 100,
+              "DBC_SV_TOLERANCE_PCT fuori intervallo");
+
+// Contatori letti da altri task (console): atomici, aggiornati solo dal task RX
+struct SvCounters
+{
+  std::atomic<uint8_t>  health{0};
+  std::atomic<uint32_t> frames{0};
+  std::atomic<uint32_t> early{0};
+  std::atomic<uint32_t> late{0};
+  std::atomic<uint32_t> timeouts{0};
+  std::atomic<uint32_t> recoveries{0};
+};
+
+static DbcSvWheel s_wheel;
+static TimerNode  s_timer[DBC_MESSAGE_COUNT];     // indice = DbcMessageIndex
+static uint64_t   s_last_us[DBC_MESSAGE_COUNT];   // ultimo arrivo
+static SvCounters s_cnt[DBC_MESSAGE_COUNT];
+
+static inline void bump(std::atomic<uint32_t> &c)
+{
+  c.store(c.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+static inline DbcMsgHealth health_of(DbcMessageIndex msg)
+{
+  return (DbcMsgHealth)s_cnt[msg].health.load(std::memory_order_relaxed);
+}
+
+static inline void set_health(DbcMessageIndex msg, DbcMsgHealth h)
+{
+  s_cnt[msg].health.store((uint8_t)h, std::memory_order_relaxed);
+}
+
+static inline uint64_t cycle_us(DbcMessageIndex msg, uint32_t percent)
+{
+  return (uint64_t)DBC_MESSAGES[msg].cycle_ms * percent * 10U;
+}
+
+// ----------------------------------------------------
+// API
+// ----------------------------------------------------
+
+void dbc_supervise_init(uint64_t now_us)
+{
+  for (uint16_t i = 0; i < DBC_MESSAGE_COUNT; ++i) {
+    s_wheel.cancel(s_timer[i]);
+    s_last_us[i] = 0;
+    set_health((DbcMessageIndex)i, DbcMsgHealth::NEVER);
+    s_cnt[i].frames.store(0, std::memory_order_relaxed);
+    s_cnt[i].early.store(0, std::memory_order_relaxed);
+    s_cnt[i].late.store(0, std::memory_order_relaxed);
+    s_cnt[i].timeouts.store(0, std::memory_order_relaxed);
+    s_cnt[i].recoveries.store(0, std::memory_order_relaxed);
+  }
+  s_wheel.start(now_us);
+}
+
+bool dbc_supervise_frame(DbcMessageIndex msg, uint64_t ts_us)
+{
+  const DbcMsgHealth prev = health_of(msg);
+  bump(s_cnt[msg].frames);
+
+  if (DBC_MESSAGES[msg].cycle_ms == 0) {
+    set_health(msg, DbcMsgHealth::OK);
+    return prev == DbcMsgHealth::NEVER;
+  }
+
+  if (prev != DbcMsgHealth::NEVER &&
+      ts_us - s_last_us[msg] < cycle_us(msg, 100 - DBC_SV_TOLERANCE_PCT)) {
+    bump(s_cnt[msg].early);
+  }
+  if (prev == DbcMsgHealth::TIMEOUT) {
+    bump(s_cnt[msg].recoveries);
+    DLOG("[DBC] %s: di nuovo ricevuto dopo %lu ms\n", DBC_MESSAGES[msg].name,
+         (unsigned long)((ts_us - s_last_us[msg]) / 1000ULL));
+  }
+
+  s_last_us[msg] = ts_us;
+  set_health(msg, DbcMsgHealth::OK);
+  s_wheel.schedule(s_timer[msg], ts_us + cycle_us(msg, 100 + DBC_SV_TOLERANCE_PCT));
+  return prev == DbcMsgHealth::NEVER || prev == DbcMsgHealth::TIMEOUT;
+}
+
+size_t dbc_supervise_tick(uint64_t now_us, void (*on_timeout)(DbcMessageIndex msg))
+{
+  return s_wheel.advance(now_us, [&](TimerNode &node) {
+    const DbcMessageIndex msg = (DbcMessageIndex)(&node - s_timer);
+
+    if (health_of(msg) == DbcMsgHealth::OK) {
+      // Primo scatto: in ritardo, il timeout parte dall'ultimo arrivo
+      bump(s_cnt[msg].late);
+      set_health(msg, DbcMsgHealth::LATE);
+      s_wheel.schedule(node, s_last_us[msg] + cycle_us(msg, DBC_SV_TIMEOUT_CYCLES * 100U));
+      return;
+    }
+
+    bump(s_cnt[msg].timeouts);
+    set_health(msg, DbcMsgHealth::TIMEOUT);
+    DLOG("[DBC] %s: timeout (nessun frame da %u cicli)\n", DBC_MESSAGES[msg].name,
+         (unsigned)DBC_SV_TIMEOUT_CYCLES);
+    if (on_timeout) {
+      on_timeout(msg);
+    }
+  });
+}
+
+DbcSuperviseStats dbc_supervise_get(DbcMessageIndex msg)
+{
+  const SvCounters &c = s_cnt[msg];
+  DbcSuperviseStats st;
+  st.health     = (DbcMsgHealth)c.health.load(std::memory_order_relaxed);
+  st.frames     = c.frames.load(std::memory_order_relaxed);
+  st.early      = c.early.load(std::memory_order_relaxed);
+  st.late       = c.late.load(std::memory_order_relaxed);
+  st.timeouts   = c.timeouts.load(std::memory_order_relaxed);
+  st.recoveries = c.recoveries.load(std::memory_order_relaxed);
+  return st;
+}
+
+void dbc_supervise_dump(Print &out)
+{
+  static const char *const HEALTH[] = { "mai", "ok", "ritardo", "TIMEOUT" };
+
+  out.printf("[dbc_sv] messaggio              ciclo_ms stato    frame   anticipi ritardi timeout recuperi\n");
+  for (uint16_t i = 0; i < DBC_MESSAGE_COUNT; ++i) {
+    const DbcMessageInfo &m = DBC_MESSAGES[i];
+    if (m.cycle_ms == 0) {
+      continue;
+    }
+    const DbcSuperviseStats st = dbc_supervise_get((DbcMessageIndex)i);
+    out.printf("[dbc_sv] %-22s %-8u %-8s %-7lu %-8lu %-7lu %-7lu %lu\n",
+               m.name, (unsigned)m.cycle_ms, HEALTH[(uint8_t)st.health],
+               (unsigned long)st.frames, (unsigned long)st.early,
+               (unsigned long)st.late, (unsigned long)st.timeouts,
+               (unsigned long)st.recoveries);
+  }
+}
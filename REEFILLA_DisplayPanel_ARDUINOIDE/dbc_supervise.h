@@ -0,0 +1,80 @@
+#pragma once
+
+#include <Arduino.h>
+#include "dbc_generated.h"   // DbcMessageIndex, DBC_MESSAGES (cycle_ms)
+
+// ----------------------------------------------------
+// Supervisione dei cycle time dei messaggi DBC
+// ----------------------------------------------------
+// Ogni messaggio periodico (GenMsgCycleTime != 0) ha un timer in una timer
+// wheel (timer_wheel.h), riprogrammato a ogni arrivo:
+//
+//   arrivo      -> OK, timer a cycle * (100 + DBC_SV_TOLERANCE_PCT) %
+//   scade       -> LATE (conta un ritardo), timer a cycle * DBC_SV_TIMEOUT_CYCLES
+//   scade       -> TIMEOUT: i segnali del messaggio non sono più validi
+//   arrivo dopo TIMEOUT -> OK, conta un recupero
+//
+// Un arrivo prima di cycle * (100 - DBC_SV_TOLERANCE_PCT) % conta come
+// anticipo. Nessun polling per segnale: dbc_supervise_tick() costa
+// O(timer scaduti). I messaggi non periodici sono validi dal primo frame.
+//
+// Tutto dal solo task RX CAN (lo stesso che decodifica e pubblica lo stato);
+// le statistiche si possono leggere da qualsiasi task.
+
+// Granularità della ruota: i timeout scattano con al più un tick di ritardo
+// (più l'attesa massima del task RX senza frame, CAN_RX_IDLE_MS)
+#ifndef DBC_SV_TICK_MS
+#define DBC_SV_TICK_MS  10
+#endif
+
+// Caselle della ruota (potenza di 2); DBC_SV_SLOTS * DBC_SV_TICK_MS deve
+// coprire il timeout più lungo (static_assert in dbc_supervise.cpp)
+#ifndef DBC_SV_SLOTS
+#define DBC_SV_SLOTS  128
+#endif
+
+// Scarto ammesso sul cycle time prima di contare anticipo/ritardo [%]
+#ifndef DBC_SV_TOLERANCE_PCT
+#define DBC_SV_TOLERANCE_PCT  50
+#endif
+
+// Cicli senza frame dopo i quali i segnali diventano non validi
+#ifndef DBC_SV_TIMEOUT_CYCLES
+#define DBC_SV_TIMEOUT_CYCLES  3
+#endif
+
+enum class DbcMsgHealth : uint8_t
+{
+  NEVER = 0,   // mai ricevuto
+  OK,
+  LATE,        // oltre la tolleranza, non ancora in timeout
+  TIMEOUT,
+};
+
+struct DbcSuperviseStats
+{
+  DbcMsgHealth health;
+  uint32_t     frames;       // arrivi visti dal decoder
+  uint32_t     early;        // arrivi in anticipo
+  uint32_t     late;         // cicli oltre la tolleranza
+  uint32_t     timeouts;
+  uint32_t     recoveries;   // arrivi dopo un timeout
+};
+
+// Azzera lo stato e fissa il tempo iniziale della ruota (µs, esp_timer)
+void dbc_supervise_init(uint64_t now_us);
+
+// Arrivo di un frame di msg con timestamp ts_us (task RX).
+// True se i segnali del messaggio tornano validi (primo frame o recupero
+// da un timeout).
+bool dbc_supervise_frame(DbcMessageIndex msg, uint64_t ts_us);
+
+// Porta la ruota a now_us; on_timeout(msg) per ogni messaggio appena andato
+// in timeout (task RX). Ritorna il numero di timer scattati.
+size_t dbc_supervise_tick(uint64_t now_us, void (*on_timeout)(DbcMessageIndex msg));
+
+// Statistiche di un messaggio (qualsiasi task)
+DbcSuperviseStats dbc_supervise_get(DbcMessageIndex msg);
+
+// Una riga per messaggio periodico
+void dbc_supervise_dump(Print &out);
@@ -0,0 +1,275 @@
+#include "dlog.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "mpsc_ring.h"
+#include "task_config.h"   // DLOG_TASK_CORE, DLOG_TASK_PRIO, DLOG_TASK_STACK
+
+// ----------------------------------------------------
+// CONFIGURAZIONE
+// ----------------------------------------------------
+
+// Record formattati per giro e pausa quando il ring è vuoto
+#define DLOG_DRAIN_BATCH  16
+#define DLOG_IDLE_MS      20
+#define DLOG_LINE_MAX     256
+
+static_assert(DLOG_MAX_SITES < 0xFFFF, "DLOG_MAX_SITES: il sito è a 16 bit");
+static_assert(DLOG_FRAME_HDR + 13 + DLOG_MAX_ARGS * (2 + DLOG_STR_MAX) + 1 <= DLOG_FRAME_MAX,
+              "DLOG_FRAME_MAX troppo piccolo per un record");
+
+// ----------------------------------------------------
+// RING MPSC (mpsc_ring.h)
+// ----------------------------------------------------
+// I record sono scritti e formattati direttamente nello slot
+// (reserve/publish, front/pop). I record persi per ring pieno li conta il
+// ring (overflow), quelli persi prima di dlog_init() o per la tabella dei
+// siti s_lost.
+
+static MpscRing<DlogRecord, DLOG_RING_LEN> s_ring;
+static std::atomic<bool>                   s_ready{false};
+
+static std::atomic<uint32_t> s_lost{0};
+static uint32_t              s_lost_reported = 0;
+
+// Siti registrati: id - 1 -> descrittore
+static DlogSite             *s_sites[DLOG_MAX_SITES];
+static std::atomic<uint32_t> s_site_count{0};
+
+// Modalità binaria: siti già definiti sul flusso
+static std::atomic<bool> s_binary{false};
+static std::atomic<bool> s_resend_sites{false};
+static uint32_t          s_site_sent[(DLOG_MAX_SITES + 31) / 32];
+
+static TaskHandle_t s_task_handle = nullptr;
+
+void dlog_count_lost()
+{
+  s_lost.fetch_add(1, std::memory_order_relaxed);
+}
+
+DlogRecord *dlog_reserve(uint32_t &pos)
+{
+  if (!s_ready.load(std::memory_order_acquire)) {
+    dlog_count_lost();
+    return nullptr;
+  }
+
+  // Pieno: il consumatore è indietro di un giro (contato in overflow)
+  return s_ring.reserve(pos);
+}
+
+void dlog_publish(uint32_t pos)
+{
+  s_ring.publish(pos);
+}
+
+bool dlog_site_register(DlogSite &site, uint32_t now_us)
+{
+  // Un solo registrante per sito: gli altri nel frattempo vedono un id
+  // fuori range e scartano il proprio record
+  uint32_t expected = 0;
+  if (!site.id.compare_exchange_strong(expected, 0xFFFFFFFFU, std::memory_order_acq_rel)) {
+    dlog_count_lost();
+    return false;
+  }
+
+  const uint32_t n = s_site_count.fetch_add(1, std::memory_order_relaxed);
+  if (n >= DLOG_MAX_SITES) {
+    dlog_count_lost();
+    return false;   // l'id resta fuori range: il sito non logga più
+  }
+  s_sites[n] = &site;
+  site.last_us.store(now_us, std::memory_order_relaxed);
+  site.id.store(n + 1, std::memory_order_release);
+  return true;
+}
+
+uint32_t dlog_lost_count()
+{
+  return s_lost.load(std::memory_order_relaxed) + s_ring.overflow_count();
+}
+
+// ----------------------------------------------------
+// CONSUMATORE
+// ----------------------------------------------------
+
+// Record -> argomenti tipizzati (le STR restano puntatori del firmware)
+static size_t dlog_unpack(const DlogRecord &r, DlogArg *args)
+{
+  uint8_t w = 0;
+  for (uint8_t i = 0; i < r.nargs; ++i) {
+    DlogArg &a = args[i];
+    a.type = r.type[i];
+    switch (a.type) {
+      case DLOG_ARG_I32:
+        a.i = (int32_t)r.word[w++];
+        break;
+      case DLOG_ARG_U32:
+        a.u = r.word[w++];
+        break;
+      case DLOG_ARG_F32: {
+        float f;
+        memcpy(&f, &r.word[w++], sizeof(f));
+        a.f = f;
+        break;
+      }
+      case DLOG_ARG_STR: {
+        uint64_t bits = r.word[w++];
+        if (sizeof(const char *) > 4) {
+          bits |= (uint64_t)r.word[w++] << 32;
+        }
+        a.s = reinterpret_cast<const char *>((uintptr_t)bits);
+        break;
+      }
+      default:   // I64 / U64 / F64
+        a.u = (uint64_t)r.word[w] | ((uint64_t)r.word[w + 1] << 32);
+        w += 2;
+        break;
+    }
+  }
+  return r.nargs;
+}
+
+static void dlog_emit_text(Print &out, const DlogRecord &r)
+{
+  DlogArg args[DLOG_MAX_ARGS];
+  const size_t nargs = dlog_unpack(r, args);
+  char line[DLOG_LINE_MAX];
+  const size_t len = dlog_format_record(line, sizeof(line), s_sites[r.site - 1]->fmt,
+                                        args, nargs, r.suppressed);
+  out.write((const uint8_t *)line, len);
+}
+
+static void dlog_emit_site(Print &out, uint16_t site)
+{
+  uint8_t frame[DLOG_FRAME_MAX];
+  const char *fmt = s_sites[site - 1]->fmt;
+  size_t n = strlen(fmt);
+  if (n > DLOG_FRAME_MAX - DLOG_FRAME_HDR - 1 - 2) {
+    n = DLOG_FRAME_MAX - DLOG_FRAME_HDR - 1 - 2;
+  }
+  uint8_t *p = frame + DLOG_FRAME_HDR;
+  memcpy(p, &site, 2);
+  memcpy(p + 2, fmt, n);
+  out.write(frame, dlog_frame_close(frame, DLOG_FRAME_SITE, 2 + n));
+}
+
+static void dlog_emit_binary(Print &out, const DlogRecord &r)
+{
+  const uint32_t bit = 1U << ((r.site - 1) % 32);
+  uint32_t &word = s_site_sent[(r.site - 1) / 32];
+  if (!(word & bit)) {
+    dlog_emit_site(out, r.site);
+    word |= bit;
+  }
+
+  DlogArg args[DLOG_MAX_ARGS];
+  const size_t nargs = dlog_unpack(r, args);
+
+  uint8_t frame[DLOG_FRAME_MAX];
+  uint8_t *p = frame + DLOG_FRAME_HDR;
+  memcpy(p, &r.ts_us, 8);
+  memcpy(p + 8, &r.site, 2);
+  memcpy(p + 10, &r.suppressed, 2);
+  p[12] = (uint8_t)nargs;
+  size_t len = 13;
+  for (size_t i = 0; i < nargs; ++i) {
+    len += dlog_put_arg(p + len, args[i]);
+  }
+  out.write(frame, dlog_frame_close(frame, DLOG_FRAME_REC, len));
+}
+
+static void dlog_emit_lost(Print &out, uint32_t lost)
+{
+  if (s_binary.load(std::memory_order_relaxed)) {
+    uint8_t frame[DLOG_FRAME_HDR + 4 + 1];
+    memcpy(frame + DLOG_FRAME_HDR, &lost, 4);
+    out.write(frame, dlog_frame_close(frame, DLOG_FRAME_LOST, 4));
+  } else {
+    out.printf("[dlog] %lu record persi dall'avvio\n", (unsigned long)lost);
+  }
+}
+
+size_t dlog_drain(Print &out, size_t max_records)
+{
+  if (s_resend_sites.exchange(false)) {
+    memset(s_site_sent, 0, sizeof(s_site_sent));
+  }
+  const bool binary = s_binary.load(std::memory_order_relaxed);
+
+  size_t n = 0;
+  while (n < max_records) {
+    const DlogRecord *rec = s_ring.front();
+    if (!rec) {
+      break;   // vuoto (o produttore non ancora pubblicato)
+    }
+
+    if (binary) {
+      dlog_emit_binary(out, *rec);
+    } else {
+      dlog_emit_text(out, *rec);
+    }
+
+    s_ring.pop();
+    n++;
+  }
+
+  const uint32_t lost = dlog_lost_count();
+  if (lost != s_lost_reported) {
+    s_lost_reported = lost;
+    dlog_emit_lost(out, lost);
+  }
+  return n;
+}
+
+// ----------------------------------------------------
+// TASK
+// ----------------------------------------------------
+
+static void dlog_task(void *arg)
+{
+  (void)arg;
+  while (true) {
+    if (dlog_drain(Serial, DLOG_DRAIN_BATCH) == 0) {
+      vTaskDelay(pdMS_TO_TICKS(DLOG_IDLE_MS));
+    }
+  }
+}
+
+bool dlog_init()
+{
+  if (s_ready.load()) {
+    return true;
+  }
+
+  s_ready.store(true, std::memory_order_release);
+
+  BaseType_t res = xTaskCreatePinnedToCore(
+      dlog_task,
+      "dlog_task",
+      DLOG_TASK_STACK,
+      nullptr,
+      DLOG_TASK_PRIO,
+      &s_task_handle,
+      TASK_CORE_ID(DLOG_TASK_CORE)
+  );
+  if (res != pdPASS) {
+    Serial.println("[dlog] ERRORE: impossibile creare dlog_task");
+    return false;
+  }
+  return true;
+}
+
+void dlog_set_binary(bool binary)
+{
+  if (binary) {
+    s_resend_sites.store(true);
+  }
+  s_binary.store(binary);
+}
+
+bool dlog_is_binary()
+{
+  return s_binary.load();
+}
@@ -0,0 +1,210 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include <type_traits>
+#include "esp_timer.h"
+#include "dlog_format.h"
+
+// ----------------------------------------------------
+// Log differito per i path caldi (task RX CAN, decoder DBC)
+// ----------------------------------------------------
+// DLOG(fmt, ...) non formatta e non tocca la seriale: scrive in un ring
+// lock-free (più produttori, un consumatore) un record da 64 byte con
+// timestamp, indice del sito e argomenti grezzi tipizzati a compile time.
+// Il task dlog a bassa priorità svuota il ring e stampa il testo (stessa
+// formattazione di printf) oppure, in modalità binaria, i frame di
+// dlog_format.h da decodificare su host (host/dlog).
+//
+// DLOG_EVERY(ms, fmt, ...) limita il sito a un record ogni ms millisecondi;
+// le chiamate scartate vengono contate e riportate nel record successivo.
+//
+// Vincoli:
+// - argomenti interi, float/double, enum, puntatori e stringhe C
+// - le stringhe sono salvate come puntatore: devono restare valide fino
+//   alla stampa (letterali, tabelle costanti come DBC_MESSAGES[].name)
+// - se il ring è pieno il record viene scartato e contato (dlog_lost_count)
+// - il formato viene comunque controllato da -Wformat come per printf
+
+// Record in coda (potenza di 2)
+#ifndef DLOG_RING_LEN
+#define DLOG_RING_LEN  128
+#endif
+
+// Siti DLOG distinti nel firmware
+#ifndef DLOG_MAX_SITES
+#define DLOG_MAX_SITES  64
+#endif
+
+// 0 = DLOG/DLOG_EVERY compilati via (il formato resta controllato)
+#ifndef DLOG_ENABLED
+#define DLOG_ENABLED  1
+#endif
+
+#define DLOG_MAX_WORDS  10   // argomenti in word da 32 bit (double / 64 bit = 2)
+
+// Sito di log: una variabile statica per ogni DLOG nel sorgente
+struct DlogSite
+{
+  constexpr DlogSite(const char *f, uint32_t interval)
+      : fmt(f), interval_us(interval), id(0), last_us(0), suppressed(0) {}
+
+  const char           *fmt;
+  const uint32_t        interval_us;   // 0 = nessun limite
+  std::atomic<uint32_t> id;            // 1..DLOG_MAX_SITES, 0 = non ancora registrato
+  std::atomic<uint32_t> last_us;       // ultimo record accettato (µs, modulo 2^32)
+  std::atomic<uint32_t> suppressed;    // chiamate scartate dall'ultimo record
+};
+
+// Slot del ring
+struct DlogRecord
+{
+  uint64_t ts_us;
+  uint16_t site;
+  uint16_t suppressed;
+  uint8_t  nargs;
+  uint8_t  type[DLOG_MAX_ARGS];
+  uint32_t word[DLOG_MAX_WORDS];
+};
+
+static_assert(sizeof(DlogRecord) == 64, "DlogRecord: layout inatteso");
+
+// Avvia il task di log (modalità testo). Prima di dlog_init() i record
+// vengono scartati.
+bool dlog_init();
+
+// Modalità binaria: frame dlog_format.h invece del testo. Ogni attivazione
+// riemette le definizioni dei siti.
+void dlog_set_binary(bool binary);
+bool dlog_is_binary();
+
+// Svuota fino a max_records record su out (unico consumatore: il task dlog,
+// oppure il driver di replay su host dove i task non girano). Ritorna il
+// numero di record gestiti.
+size_t dlog_drain(Print &out, size_t max_records);
+
+// Record persi dall'avvio (ring pieno, troppi siti)
+uint32_t dlog_lost_count();
+
+// ----------------------------------------------------
+// Path caldo (inline)
+// ----------------------------------------------------
+
+bool        dlog_site_register(DlogSite &site, uint32_t now_us);
+DlogRecord *dlog_reserve(uint32_t &pos);
+void        dlog_publish(uint32_t pos);
+void        dlog_count_lost();
+
+// Rate limit del sito; false = record da non scrivere
+inline bool dlog_admit(DlogSite &site, uint32_t now_us)
+{
+  const uint32_t id = site.id.load(std::memory_order_acquire);
+  if (id - 1U >= DLOG_MAX_SITES) {
+    if (id == 0) {
+      return dlog_site_register(site, now_us);
+    }
+    dlog_count_lost();   // sito in registrazione o tabella dei siti piena
+    return false;
+  }
+  if (site.interval_us) {
+    if (now_us - site.last_us.load(std::memory_order_relaxed) < site.interval_us) {
+      site.suppressed.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    site.last_us.store(now_us, std::memory_order_relaxed);
+  }
+  return true;
+}
+
+template <typename T>
+constexpr uint8_t dlog_words()
+{
+  if constexpr (std::is_enum<T>::value) {
+    return dlog_words<typename std::underlying_type<T>::type>();
+  } else {
+    return (sizeof(T) > 4) ? 2 : 1;
+  }
+}
+
+template <typename T>
+inline void dlog_put(DlogRecord &r, uint8_t &w, T v)
+{
+  if constexpr (std::is_enum<T>::value) {
+    dlog_put(r, w, static_cast<typename std::underlying_type<T>::type>(v));
+    return;
+  } else {
+    uint8_t type;
+    uint64_t bits;
+    if constexpr (std::is_same<T, float>::value) {
+      type = DLOG_ARG_F32;
+      uint32_t b;
+      memcpy(&b, &v, sizeof(b));
+      bits = b;
+    } else if constexpr (std::is_same<T, double>::value) {
+      type = DLOG_ARG_F64;
+      memcpy(&bits, &v, sizeof(bits));
+    } else if constexpr (std::is_pointer<T>::value) {
+      using C = typename std::remove_cv<typename std::remove_pointer<T>::type>::type;
+      type = std::is_same<C, char>::value ? DLOG_ARG_STR
+                                          : (sizeof(T) > 4 ? DLOG_ARG_U64 : DLOG_ARG_U32);
+      bits = reinterpret_cast<uintptr_t>(v);
+    } else {
+      static_assert(std::is_integral<T>::value, "DLOG: tipo di argomento non supportato");
+      type = (sizeof(T) > 4) ? (std::is_signed<T>::value ? DLOG_ARG_I64 : DLOG_ARG_U64)
+                             : (std::is_signed<T>::value ? DLOG_ARG_I32 : DLOG_ARG_U32);
+      bits = static_cast<uint64_t>(v);
+    }
+    r.type[r.nargs++] = type;
+    r.word[w++] = static_cast<uint32_t>(bits);
+    if (dlog_words<T>() == 2) {
+      r.word[w++] = static_cast<uint32_t>(bits >> 32);
+    }
+  }
+}
+
+template <typename... Args>
+inline void dlog_write(DlogSite &site, Args... args)
+{
+  static_assert(sizeof...(Args) <= DLOG_MAX_ARGS, "DLOG: troppi argomenti");
+  static_assert((0 + ... + dlog_words<Args>()) <= DLOG_MAX_WORDS, "DLOG: argomenti troppo grandi");
+
+  const uint64_t now_us = (uint64_t)esp_timer_get_time();
+  if (!dlog_admit(site, (uint32_t)now_us)) {
+    return;
+  }
+
+  uint32_t pos;
+  DlogRecord *r = dlog_reserve(pos);
+  if (!r) {
+    return;   // ring pieno: contato in dlog_reserve
+  }
+  const uint32_t supp = site.suppressed.exchange(0, std::memory_order_relaxed);
+  r->ts_us      = now_us;
+  r->site       = static_cast<uint16_t>(site.id.load(std::memory_order_relaxed));
+  r->suppressed = static_cast<uint16_t>(supp > 0xFFFFU ? 0xFFFFU : supp);
+  r->nargs      = 0;
+  uint8_t w = 0;
+  (dlog_put(*r, w, args), ...);
+  (void)w;   // DLOG senza argomenti
+  dlog_publish(pos);
+}
+
+// Solo per il controllo del formato a compile time, mai chiamata
+inline void dlog_check_format(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+inline void dlog_check_format(const char *fmt, ...) { (void)fmt; }
+
+#if DLOG_ENABLED
+#define DLOG_EVERY(interval_ms, fmt, ...)                                    \
+  do {                                                                       \
+    if (false) dlog_check_format(fmt, ##__VA_ARGS__);                        \
+    static DlogSite dlog_site_(fmt, (uint32_t)(interval_ms) * 1000U);        \
+    dlog_write(dlog_site_, ##__VA_ARGS__);                                   \
+  } while (0)
+#else
+#define DLOG_EVERY(interval_ms, fmt, ...)                                    \
+  do {                                                                       \
+    if (false) dlog_check_format(fmt, ##__VA_ARGS__);                        \
+  } while (0)
+#endif
+
+#define DLOG(fmt, ...)  DLOG_EVERY(0, fmt, ##__VA_ARGS__)
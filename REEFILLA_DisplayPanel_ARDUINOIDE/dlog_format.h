@@ -0,0 +1,342 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+// ----------------------------------------------------
+// Log differito: formato binario e formattazione (condivisi firmware / host)
+// ----------------------------------------------------
+// Il path caldo non formatta: salva l'indice del sito (la stringa di
+// formato) e gli argomenti grezzi. La formattazione avviene dopo, nel task
+// di log del firmware (modalità testo) oppure su host con dlog_decode
+// (modalità binaria, sulla seriale escono solo i frame qui sotto).
+//
+// Frame (little endian):
+//   0xA5 0x5A | tipo (1) | len (2) | payload (len byte) | checksum (1)
+//   checksum = somma a 8 bit di tipo, len e payload
+//
+// Payload per tipo:
+//   DLOG_FRAME_SITE : sito (2) | stringa di formato (senza terminatore)
+//   DLOG_FRAME_REC  : ts_us (8) | sito (2) | soppressi (2) | nargs (1) | argomenti
+//   DLOG_FRAME_LOST : record persi dall'avvio (4)
+//
+// Argomento: tipo (1) + valore
+//   I32/U32/F32 : 4 byte     I64/U64/F64 : 8 byte
+//   STR         : lunghezza (1) + byte (troncata a DLOG_STR_MAX)
+//
+// Un sito viene definito (SITE) prima del suo primo REC; "soppressi" sono
+// le chiamate scartate dal rate limit del sito dal record precedente.
+
+#define DLOG_SYNC0        0xA5
+#define DLOG_SYNC1        0x5A
+#define DLOG_FRAME_HDR    5      // sync (2) + tipo (1) + len (2)
+#define DLOG_FRAME_MAX    512    // frame intero, checksum compreso
+#define DLOG_MAX_ARGS     8
+#define DLOG_STR_MAX      48
+
+#define DLOG_FRAME_SITE   1
+#define DLOG_FRAME_REC    2
+#define DLOG_FRAME_LOST   3
+
+#define DLOG_ARG_I32      1
+#define DLOG_ARG_U32      2
+#define DLOG_ARG_I64      3
+#define DLOG_ARG_U64      4
+#define DLOG_ARG_F32      5
+#define DLOG_ARG_F64      6
+#define DLOG_ARG_STR      7
+
+// Argomento decodificato (STR punta a una stringa terminata)
+struct DlogArg
+{
+  uint8_t type;
+  union
+  {
+    int64_t     i;
+    uint64_t    u;
+    double      f;
+    const char *s;
+  };
+};
+
+// ----------------------------------------------------
+// Frame
+// ----------------------------------------------------
+
+static inline uint8_t dlog_checksum(const uint8_t *p, size_t n)
+{
+  uint8_t sum = 0;
+  while (n--) {
+    sum = (uint8_t)(sum + *p++);
+  }
+  return sum;
+}
+
+// Scrive header e checksum attorno a payload già in frame[DLOG_FRAME_HDR..].
+// Ritorna la lunghezza totale del frame.
+static inline size_t dlog_frame_close(uint8_t *frame, uint8_t type, size_t payload_len)
+{
+  frame[0] = DLOG_SYNC0;
+  frame[1] = DLOG_SYNC1;
+  frame[2] = type;
+  frame[3] = (uint8_t)(payload_len & 0xFF);
+  frame[4] = (uint8_t)(payload_len >> 8);
+  frame[DLOG_FRAME_HDR + payload_len] = dlog_checksum(frame + 2, 3 + payload_len);
+  return DLOG_FRAME_HDR + payload_len + 1;
+}
+
+static inline size_t dlog_put_arg(uint8_t *p, const DlogArg &a)
+{
+  p[0] = a.type;
+  switch (a.type) {
+    case DLOG_ARG_I32:
+    case DLOG_ARG_U32: {
+      const uint32_t v = (uint32_t)a.u;
+      memcpy(p + 1, &v, 4);
+      return 5;
+    }
+    case DLOG_ARG_F32: {
+      const float v = (float)a.f;
+      memcpy(p + 1, &v, 4);
+      return 5;
+    }
+    case DLOG_ARG_STR: {
+      size_t n = a.s ? strnlen(a.s, DLOG_STR_MAX) : 0;
+      p[1] = (uint8_t)n;
+      memcpy(p + 2, a.s, n);
+      return 2 + n;
+    }
+    default:   // I64 / U64 / F64: stessi 8 byte dell'unione
+      memcpy(p + 1, &a.u, 8);
+      return 9;
+  }
+}
+
+// str_buf (almeno DLOG_STR_MAX + 1 byte) riceve la copia terminata delle STR
+static inline bool dlog_get_arg(const uint8_t *&p, const uint8_t *end, DlogArg &a, char *str_buf)
+{
+  if (p >= end) {
+    return false;
+  }
+  a.type = *p++;
+  switch (a.type) {
+    case DLOG_ARG_I32:
+    case DLOG_ARG_U32:
+    case DLOG_ARG_F32: {
+      if (end - p < 4) {
+        return false;
+      }
+      uint32_t v;
+      memcpy(&v, p, 4);
+      p += 4;
+      if (a.type == DLOG_ARG_I32) {
+        a.i = (int32_t)v;
+      } else if (a.type == DLOG_ARG_U32) {
+        a.u = v;
+      } else {
+        float f;
+        memcpy(&f, &v, 4);
+        a.f = f;
+      }
+      return true;
+    }
+    case DLOG_ARG_I64:
+    case DLOG_ARG_U64:
+    case DLOG_ARG_F64:
+      if (end - p < 8) {
+        return false;
+      }
+      memcpy(&a.u, p, 8);
+      p += 8;
+      return true;
+    case DLOG_ARG_STR: {
+      if (p >= end || *p > DLOG_STR_MAX || end - p < 1 + *p) {
+        return false;
+      }
+      const size_t n = *p++;
+      memcpy(str_buf, p, n);
+      str_buf[n] = '\0';
+      p += n;
+      a.s = str_buf;
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+// ----------------------------------------------------
+// Formattazione printf su argomenti già tipizzati
+// ----------------------------------------------------
+// Le conversioni della stringa di formato vengono riscritte secondo il tipo
+// salvato (i modificatori h/l/ll/z/j/t del sorgente sono ignorati), quindi un
+// %lu con un uint64_t su host o un %d con un int8_t sul firmware danno lo
+// stesso testo. Argomenti mancanti o incompatibili: "<?>".
+
+static inline bool dlog_is_int(const DlogArg &a)
+{
+  return a.type >= DLOG_ARG_I32 && a.type <= DLOG_ARG_U64;
+}
+
+static inline bool dlog_is_wide(const DlogArg &a)
+{
+  return a.type == DLOG_ARG_I64 || a.type == DLOG_ARG_U64;
+}
+
+static inline long long dlog_as_ll(const DlogArg &a)
+{
+  return (a.type == DLOG_ARG_F32 || a.type == DLOG_ARG_F64) ? (long long)a.f : (long long)a.i;
+}
+
+// Ritorna la lunghezza scritta in out (sempre terminato se cap > 0)
+static inline size_t dlog_format(char *out, size_t cap, const char *fmt,
+                                 const DlogArg *args, size_t nargs)
+{
+  if (cap == 0) {
+    return 0;
+  }
+
+  size_t len = 0;
+  size_t next = 0;
+
+  // Oltre cap snprintf non scrive ma conta: len serve solo a troncare
+  auto dst  = [&]() -> char * { return out + ((len < cap) ? len : cap - 1); };
+  auto room = [&]() -> size_t { return (len < cap) ? cap - len : 0; };
+  auto advance = [&](int n) {
+    if (n > 0) {
+      len += (size_t)n;
+    }
+  };
+
+  while (*fmt) {
+    if (*fmt != '%') {
+      const char *pct = strchr(fmt, '%');
+      const size_t n = pct ? (size_t)(pct - fmt) : strlen(fmt);
+      advance(snprintf(dst(), room(), "%.*s", (int)n, fmt));
+      fmt += n;
+      continue;
+    }
+    if (fmt[1] == '%') {
+      advance(snprintf(dst(), room(), "%%"));
+      fmt += 2;
+      continue;
+    }
+
+    // %[flag][larghezza][.precisione][lunghezza]conversione
+    char spec[64];   // flag (8) + 2 x (numero da * + cifre) + conversione: < 48
+    size_t sn = 0;
+    const char *p = fmt + 1;
+    spec[sn++] = '%';
+    while (*p && strchr("-+ #0", *p) && sn < 8) {
+      spec[sn++] = *p++;
+    }
+    for (int part = 0; part < 2; ++part) {
+      if (part == 1) {
+        if (*p != '.') {
+          break;
+        }
+        spec[sn++] = *p++;
+      }
+      if (*p == '*') {
+        // Larghezza / precisione da argomento: diventa un numero nello spec
+        const long long v = (next < nargs) ? dlog_as_ll(args[next]) : 0;
+        next++;
+        p++;
+        sn += (size_t)snprintf(spec + sn, sizeof(spec) - sn, "%d", (int)v);
+      }
+      while (*p >= '0' && *p <= '9' && sn < 24) {
+        spec[sn++] = *p++;
+      }
+    }
+    while (*p && strchr("hlLqjzt", *p)) {
+      p++;
+    }
+    const char conv = *p ? *p++ : '\0';
+    fmt = p;
+
+    if (next >= nargs || conv == '\0') {
+      advance(snprintf(dst(), room(), "<?>"));
+      next++;
+      continue;
+    }
+    const DlogArg &a = args[next++];
+
+    switch (conv) {
+      case 'd': case 'i': case 'u': case 'x': case 'X': case 'o':
+        if (a.type == DLOG_ARG_STR) {
+          advance(snprintf(dst(), room(), "<?>"));
+        } else if (dlog_is_int(a) && !dlog_is_wide(a)) {
+          spec[sn++] = conv;
+          spec[sn] = '\0';
+          advance(snprintf(dst(), room(), spec, (int)a.i));
+        } else {
+          spec[sn++] = 'l';
+          spec[sn++] = 'l';
+          spec[sn++] = conv;
+          spec[sn] = '\0';
+          advance(snprintf(dst(), room(), spec, dlog_as_ll(a)));
+        }
+        break;
+      case 'c':
+        spec[sn++] = 'c';
+        spec[sn] = '\0';
+        advance(snprintf(dst(), room(), spec, (int)dlog_as_ll(a)));
+        break;
+      case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A': {
+        double v;
+        if (a.type == DLOG_ARG_F32 || a.type == DLOG_ARG_F64) {
+          v = a.f;
+        } else if (a.type == DLOG_ARG_U32 || a.type == DLOG_ARG_U64) {
+          v = (double)a.u;
+        } else if (a.type != DLOG_ARG_STR) {
+          v = (double)a.i;
+        } else {
+          advance(snprintf(dst(), room(), "<?>"));
+          break;
+        }
+        spec[sn++] = conv;
+        spec[sn] = '\0';
+        advance(snprintf(dst(), room(), spec, v));
+        break;
+      }
+      case 's':
+        spec[sn++] = 's';
+        spec[sn] = '\0';
+        advance(snprintf(dst(), room(), spec,
+                         (a.type == DLOG_ARG_STR) ? (a.s ? a.s : "(null)") : "<?>"));
+        break;
+      case 'p':
+        advance(snprintf(dst(), room(), "0x%llx", (unsigned long long)a.u));
+        break;
+      default:
+        advance(snprintf(dst(), room(), "<?>"));
+        break;
+    }
+  }
+
+  return (len >= cap) ? cap - 1 : len;   // troncato
+}
+
+// Riga completa di un record: testo formattato più, se il rate limit ha
+// scartato qualcosa, il numero di chiamate soppresse prima dell'a capo
+static inline size_t dlog_format_record(char *out, size_t cap, const char *fmt,
+                                        const DlogArg *args, size_t nargs,
+                                        uint32_t suppressed)
+{
+  size_t len = dlog_format(out, cap, fmt, args, nargs);
+  if (suppressed == 0 || cap == 0) {
+    return len;
+  }
+  const bool newline = (len > 0 && out[len - 1] == '\n');
+  if (newline) {
+    len--;
+  }
+  const int n = snprintf(out + len, cap - len, " (+%lu soppressi)%s",
+                         (unsigned long)suppressed, newline ? "\n" : "");
+  if (n > 0) {
+    len += (size_t)n;
+  }
+  return (len >= cap) ? cap - 1 : len;
+}
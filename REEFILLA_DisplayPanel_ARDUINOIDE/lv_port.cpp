@@ -1,5 +1,11 @@
 #include <Arduino.h>
 #include "lv_port.h"
+#include "product.h"
+#include "rtrace.h"
+
+// lv_conf.h abilita i font grandi solo per i prodotti che li usano
+static_assert(!ThisProduct::LARGE_FONTS || LV_FONT_MONTSERRAT_48,
+              "lv_conf.h: Montserrat 48 disabilitato ma usato dal prodotto");
 
 // Risoluzione del display
 #define LVGL_HOR_RES       480
@@ -32,7 +38,9 @@ static void my_lvgl_flush_cb(lv_disp_drv_t *disp_drv,
   int32_t w  = area->x2 - area->x1 + 1;
   int32_t h  = area->y2 - area->y1 + 1;
 
+  RTRACE_BEGIN(RTRACE_EV_DRAW_BITMAP, h);
   s_lcd->drawBitmap(x1, y1, w, h, (const uint8_t *)color_p);
+  RTRACE_END(RTRACE_EV_DRAW_BITMAP, 0);
 
   lv_disp_flush_ready(disp_drv);
 }
@@ -75,6 +83,7 @@ void lv_port_init(ESP_PanelLcd *lcd, ESP_PanelTouch *touch)
 {
   Serial.println("[lv_port] lv_init()");
   lv_init();
+  lv_port_lock_init();
 
   s_lcd   = lcd;
   s_touch = touch;
@@ -105,3 +114,11 @@ void lv_port_init(ESP_PanelLcd *lcd, ESP_PanelTouch *touch)
   lvgl_indev = lv_indev_drv_register(&lvgl_indev_drv);
   (void)lvgl_indev;
 }
+
+bool lv_port_touch_attach_irq(bool (*isr)())
+{
+  if (!s_touch || !isr || !s_touch->isInterruptEnabled()) {
+    return false;
+  }
+  return s_touch->attachInterruptCallback([isr](void *) { return isr(); }, nullptr);
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <lvgl.h>
+#include <ESP_Panel_Library.h>
+#include "lv_port_lock.h"   // lv_port_lock / lv_port_unlock
+
+// Inizializza LVGL (display + input) usando gli oggetti del pannello, e il
+// lock LVGL.
+void lv_port_init(ESP_PanelLcd *lcd, ESP_PanelTouch *touch);
+
+// Collega l'interrupt del touch a isr (chiamata in ISR, ritorna true se
+// serve un cambio di contesto). False se il touch non ha il pin INT: in
+// quel caso l'indev LVGL resta a polling.
+bool lv_port_touch_attach_irq(bool (*isr)());
@@ -0,0 +1,175 @@
+#include "lv_port_lock.h"
+
+#include "esp_timer.h"
+
+#include <atomic>
+
+#include "task_config.h"
+
+static const uint32_t HIST_EDGES_US[] = LV_LOCK_HIST_EDGES_US;
+static_assert(sizeof(HIST_EDGES_US) / sizeof(HIST_EDGES_US[0]) == LV_LOCK_HIST_BUCKETS - 1,
+              "LV_LOCK_HIST_EDGES_US: un limite per ogni bucket tranne l'ultimo");
+
+// ----------------------------------------------------
+// Stato
+// ----------------------------------------------------
+
+static SemaphoreHandle_t     s_mux = nullptr;
+static std::atomic<uint32_t> s_timeouts{0};   // senza lock: da chiunque
+
+// Solo da chi tiene il lock
+static uint32_t    s_depth   = 0;
+static uint64_t    s_hold_t0 = 0;
+static LvLockStats s_stats;
+
+static uint64_t now_us()
+{
+  return (uint64_t)esp_timer_get_time();
+}
+
+// ----------------------------------------------------
+// Lock
+// ----------------------------------------------------
+
+void lv_port_lock_init()
+{
+  if (s_mux) {
+    return;
+  }
+  s_mux            = xSemaphoreCreateRecursiveMutex();
+  s_stats          = LvLockStats();
+  s_stats.since_us = now_us();
+}
+
+bool lv_port_lock(int timeout_ms)
+{
+  if (!s_mux) {
+    return false;
+  }
+
+  // Prima senza attesa: se riesce non c'era contesa (o il lock era già nostro)
+  if (xSemaphoreTakeRecursive(s_mux, 0) != pdTRUE) {
+    if (timeout_ms == 0) {
+      s_timeouts.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    const uint64_t   w0    = now_us();
+    const TickType_t ticks = (timeout_ms < 0) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    if (xSemaphoreTakeRecursive(s_mux, ticks) != pdTRUE) {
+      s_timeouts.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    const uint32_t wait = (uint32_t)(now_us() - w0);
+    s_stats.contended++;
+    s_stats.wait_us_sum += wait;
+    if (wait > s_stats.wait_us_max) {
+      s_stats.wait_us_max = wait;
+    }
+  }
+
+  if (s_depth++ == 0) {
+    s_stats.acquired++;
+    s_hold_t0 = now_us();
+  } else {
+    s_stats.nested++;
+  }
+  return true;
+}
+
+void lv_port_unlock()
+{
+  if (s_depth == 0) {
+    return;   // unlock senza lock: ignorato
+  }
+  if (--s_depth == 0) {
+    const uint32_t hold = (uint32_t)(now_us() - s_hold_t0);
+    s_stats.hold_us_sum += hold;
+    if (hold > s_stats.hold_us_max) {
+      s_stats.hold_us_max   = hold;
+      s_stats.hold_max_task = pcTaskGetName(nullptr);
+    }
+    if (hold > CAN_RX_LATENCY_BUDGET_US) {
+      s_stats.over_budget++;
+    }
+    size_t b = 0;
+    while (b < LV_LOCK_HIST_BUCKETS - 1 && hold > HIST_EDGES_US[b]) {
+      b++;
+    }
+    s_stats.hold_hist[b]++;
+  }
+  xSemaphoreGiveRecursive(s_mux);
+}
+
+// ----------------------------------------------------
+// Statistiche
+// ----------------------------------------------------
+
+LvLockStats lv_port_lock_get_stats()
+{
+  if (!s_mux) {
+    return LvLockStats();
+  }
+  // Direttamente sul mutex: leggere le statistiche non è una tenuta
+  xSemaphoreTakeRecursive(s_mux, portMAX_DELAY);
+  LvLockStats s = s_stats;
+  xSemaphoreGiveRecursive(s_mux);
+  s.timeouts = s_timeouts.load(std::memory_order_relaxed);
+  return s;
+}
+
+static void print_core(Print &out, int core)
+{
+  if (core < 0) {
+    out.print("qualsiasi");
+  } else {
+    out.printf("%d", core);
+  }
+}
+
+void lv_port_lock_dump(Print &out)
+{
+  if (!s_mux) {
+    return;
+  }
+  const LvLockStats s      = lv_port_lock_get_stats();
+  const uint64_t    now    = now_us();
+  const double      span_s = (now - s.since_us) / 1e6;
+
+  out.print("[lock] task: can_rx core ");
+  print_core(out, CAN_RX_TASK_CORE);
+  out.printf(" prio %d, ui core ", CAN_RX_TASK_PRIO);
+  print_core(out, UI_TASK_CORE);
+  out.printf(" prio %d, dlog core ", UI_TASK_PRIO);
+  print_core(out, DLOG_TASK_CORE);
+  out.printf(" prio %d (RX non usa il lock LVGL)\n", DLOG_TASK_PRIO);
+
+  out.printf("[lock] %.1f s: %lu prese (+%lu ricorsive), contese %lu (attesa media %.2f ms, "
+             "max %.2f ms), timeout %lu\n",
+             span_s, (unsigned long)s.acquired, (unsigned long)s.nested,
+             (unsigned long)s.contended,
+             s.contended ? s.wait_us_sum / 1000.0 / s.contended : 0.0,
+             s.wait_us_max / 1000.0, (unsigned long)s.timeouts);
+  out.printf("[lock] tenuta media %.3f ms, max %.3f ms (%s), %.2f%% del tempo, "
+             "oltre %u us: %lu\n",
+             s.acquired ? s.hold_us_sum / 1000.0 / s.acquired : 0.0, s.hold_us_max / 1000.0,
+             s.hold_max_task ? s.hold_max_task : "-",
+             span_s > 0 ? s.hold_us_sum / 1e4 / span_s : 0.0,
+             (unsigned)CAN_RX_LATENCY_BUDGET_US, (unsigned long)s.over_budget);
+
+  out.print("[lock] tenute:");
+  for (size_t b = 0; b < LV_LOCK_HIST_BUCKETS; ++b) {
+    if (b < LV_LOCK_HIST_BUCKETS - 1) {
+      out.printf(" <=%lu us %lu,", (unsigned long)HIST_EDGES_US[b], (unsigned long)s.hold_hist[b]);
+    } else {
+      out.printf(" oltre %lu\n", (unsigned long)s.hold_hist[b]);
+    }
+  }
+
+  // Azzera (la tenuta in corso, se chi stampa ha il lock, conta nella
+  // finestra nuova)
+  xSemaphoreTakeRecursive(s_mux, portMAX_DELAY);
+  s_stats          = LvLockStats();
+  s_stats.since_us = now;
+  xSemaphoreGiveRecursive(s_mux);
+  s_timeouts.store(0, std::memory_order_relaxed);
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+// ----------------------------------------------------
+// Lock LVGL (mutex ricorsivo) con contesa e tempi di tenuta
+// ----------------------------------------------------
+// Come lvgl_port_lock()/lvgl_port_unlock() dell'esempio LVGL v8 di
+// ESP32_Display_Panel: LVGL non è thread-safe, il task UI fa ogni giro
+// (ui_task_step) con il lock preso e chi altro deve toccare LVGL lo prende
+// allo stesso modo. Ricorsivo: dentro un giro si può richiamare codice che
+// lo prende di nuovo (dump, callback).
+//
+// Sul lock si misura, al livello più esterno:
+// - acquisizioni, contese (lock tenuto da un altro task: quanto si è
+//   aspettato) e timeout
+// - tempo di tenuta: media, massimo con il nome del task, istogramma, e
+//   tenute oltre CAN_RX_LATENCY_BUDGET_US (task_config.h)
+//
+// Il task RX CAN non prende mai questo lock (task_config.h): le tenute
+// dicono quanto un ridisegno lungo blocca gli altri utenti di LVGL, e sono
+// la prova che dal lato RX non c'è niente da aspettare.
+//
+// Le statistiche le scrive solo chi tiene il lock: niente atomici.
+
+// Limiti superiori (µs) dei bucket dell'istogramma delle tenute; l'ultimo
+// bucket prende il resto
+#define LV_LOCK_HIST_EDGES_US  { 100, 500, 1000, 2000, 5000, 10000, 20000 }
+#define LV_LOCK_HIST_BUCKETS   8
+
+struct LvLockStats
+{
+  uint32_t    acquired;          // prese al livello più esterno
+  uint32_t    nested;            // prese ricorsive (lock già del task)
+  uint32_t    contended;         // prese dopo aver aspettato un altro task
+  uint32_t    timeouts;          // lv_port_lock() fallite
+  uint64_t    wait_us_sum;
+  uint32_t    wait_us_max;
+  uint64_t    hold_us_sum;
+  uint32_t    hold_us_max;
+  const char *hold_max_task;     // task della tenuta più lunga
+  uint32_t    over_budget;       // tenute oltre CAN_RX_LATENCY_BUDGET_US
+  uint32_t    hold_hist[LV_LOCK_HIST_BUCKETS];
+  uint64_t    since_us;          // inizio del conteggio (esp_timer)
+};
+
+// Crea il mutex (una volta, prima di avviare i task). La chiamano
+// lv_port_init() sul device e il display headless su host.
+void lv_port_lock_init();
+
+// timeout_ms < 0: aspetta per sempre. False allo scadere del timeout (o se
+// il lock non è stato creato).
+bool lv_port_lock(int timeout_ms = -1);
+void lv_port_unlock();
+
+// Lock per uno scope: LvPortLockGuard g; if (g) { ...LVGL... }
+class LvPortLockGuard
+{
+public:
+  explicit LvPortLockGuard(int timeout_ms = -1) : locked_(lv_port_lock(timeout_ms)) {}
+  ~LvPortLockGuard()
+  {
+    if (locked_) {
+      lv_port_unlock();
+    }
+  }
+  LvPortLockGuard(const LvPortLockGuard &)            = delete;
+  LvPortLockGuard &operator=(const LvPortLockGuard &) = delete;
+
+  explicit operator bool() const { return locked_; }
+
+private:
+  bool locked_;
+};
+
+// Copia coerente delle statistiche (senza contare come acquisizione)
+LvLockStats lv_port_lock_get_stats();
+
+// Contesa, tenute e partizione dei task dall'ultimo dump (poi azzera)
+void lv_port_lock_dump(Print &out);
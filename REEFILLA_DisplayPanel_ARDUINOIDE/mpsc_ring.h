@@ -0,0 +1,152 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include <type_traits>
+
+#include "cache_line.h"
+
+// ----------------------------------------------------
+// Coda limitata lock-free multi-producer / single-consumer
+// ----------------------------------------------------
+// Coda di Vyukov (comandi UI, ring di dlog):
+// - ogni slot ha un numero di sequenza: seq == pos -> libero per il
+//   produttore che ha preso pos, seq == pos + 1 -> pronto per il consumatore
+// - i produttori si contendono enqueue_pos con una CAS (nessun lock, nessuna
+//   sezione critica: un produttore interrotto blocca solo il proprio slot)
+// - il consumatore è uno solo e avanza dequeue_pos senza CAS (atomico solo
+//   per size() letto da altri task)
+// - coda piena: push() ritorna false e l'elemento viene contato in overflow
+// - reserve()/publish() e front()/pop() lavorano direttamente nello slot,
+//   per chi compone o consuma l'elemento senza una copia intermedia
+template <typename T, size_t CAPACITY>
+class MpscRing
+{
+  static_assert(std::is_trivially_copyable<T>::value,
+                "MpscRing: T deve essere copiabile con memcpy");
+  static_assert(CAPACITY >= 2 && (CAPACITY & (CAPACITY - 1)) == 0,
+                "MpscRing: capacità potenza di 2");
+
+  static constexpr uint32_t MASK = CAPACITY - 1;
+
+public:
+  MpscRing()
+  {
+    for (uint32_t i = 0; i < CAPACITY; ++i) {
+      slots_[i].seq.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  static constexpr size_t capacity() { return CAPACITY; }
+
+  // Elementi scartati perché la coda era piena
+  uint32_t overflow_count() const
+  {
+    return overflow_.load(std::memory_order_relaxed);
+  }
+
+  // Elementi in coda (indicativo: i produttori possono essere a metà)
+  uint32_t size() const
+  {
+    return enqueue_pos_.load(std::memory_order_relaxed) -
+           dequeue_pos_.load(std::memory_order_relaxed);
+  }
+
+  // ---------------- lato produttori (qualsiasi task) ----------------
+
+  bool push(const T &item)
+  {
+    uint32_t pos;
+    T *slot = reserve(pos);
+    if (!slot) {
+      return false;
+    }
+    *slot = item;
+    publish(pos);
+    return true;
+  }
+
+  // Prenota uno slot e ne ritorna l'elemento da scrivere (nullptr = coda
+  // piena, contato in overflow). Va sempre chiuso con publish(pos): fino ad
+  // allora il consumatore si ferma a questo slot.
+  T *reserve(uint32_t &pos)
+  {
+    pos = enqueue_pos_.load(std::memory_order_relaxed);
+    while (true) {
+      Slot &slot = slots_[pos & MASK];
+      const int32_t diff = (int32_t)(slot.seq.load(std::memory_order_acquire) - pos);
+      if (diff == 0) {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          return &slot.item;
+        }
+        // pos aggiornato dalla CAS fallita
+      } else if (diff < 0) {
+        overflow_.fetch_add(1, std::memory_order_relaxed);   // pieno
+        return nullptr;
+      } else {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  void publish(uint32_t pos)
+  {
+    slots_[pos & MASK].seq.store(pos + 1, std::memory_order_release);
+  }
+
+  // ---------------- lato consumatore (uno solo) ----------------
+
+  // Estrae fino a max elementi nell'ordine di prenotazione; si ferma al
+  // primo slot prenotato ma non ancora scritto
+  size_t pop_n(T *out, size_t max)
+  {
+    uint32_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+    size_t   n   = 0;
+    while (n < max) {
+      Slot &slot = slots_[pos & MASK];
+      if (slot.seq.load(std::memory_order_acquire) != pos + 1) {
+        break;
+      }
+      out[n++] = slot.item;
+      slot.seq.store(pos + (uint32_t)CAPACITY, std::memory_order_release);
+      pos++;
+    }
+    dequeue_pos_.store(pos, std::memory_order_relaxed);
+    return n;
+  }
+
+  // Prossimo elemento pronto, letto nello slot (nullptr = vuota o
+  // produttore non ancora pubblicato). Resta valido fino a pop().
+  const T *front() const
+  {
+    const uint32_t pos  = dequeue_pos_.load(std::memory_order_relaxed);
+    const Slot    &slot = slots_[pos & MASK];
+    if (slot.seq.load(std::memory_order_acquire) != pos + 1) {
+      return nullptr;
+    }
+    return &slot.item;
+  }
+
+  // Libera lo slot di front()
+  void pop()
+  {
+    const uint32_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+    slots_[pos & MASK].seq.store(pos + (uint32_t)CAPACITY, std::memory_order_release);
+    dequeue_pos_.store(pos + 1, std::memory_order_relaxed);
+  }
+
+private:
+  struct Slot
+  {
+    std::atomic<uint32_t> seq;
+    T                     item;
+  };
+
+  alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> enqueue_pos_{0};
+  std::atomic<uint32_t> overflow_{0};
+
+  alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> dequeue_pos_{0};
+
+  alignas(CACHE_LINE_SIZE) Slot slots_[CAPACITY];
+};
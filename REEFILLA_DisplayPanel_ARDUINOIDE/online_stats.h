@@ -0,0 +1,144 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <math.h>
+
+// ----------------------------------------------------
+// Statistiche in streaming a memoria fissa
+// ----------------------------------------------------
+// - RunningStats: media e varianza con l'algoritmo di Welford (stabile,
+//   niente somme di quadrati che si cancellano), più min/max
+// - P2Quantile: stima di un quantile con l'algoritmo P² (Jain & Chlamtac,
+//   1985): cinque marcatori aggiustati con interpolazione parabolica,
+//   nessun campione memorizzato. Esatto fino a 5 campioni.
+//
+// Costo costante per campione, nessuna allocazione: si possono aggiornare
+// nel path di decodifica. Media e M2 in double (la somma cresce con n per
+// tutto l'uptime); i marcatori P² in float (FPU dell'ESP32-S3).
+
+class RunningStats
+{
+public:
+  void add(float x)
+  {
+    n_++;
+    const double d = (double)x - mean_;
+    mean_ += d / (double)n_;
+    m2_   += d * ((double)x - mean_);
+    if (n_ == 1 || x < min_) min_ = x;
+    if (n_ == 1 || x > max_) max_ = x;
+  }
+
+  void reset() { *this = RunningStats(); }
+
+  uint32_t count() const { return n_; }
+  float    mean() const { return (float)mean_; }
+  float    min() const { return min_; }
+  float    max() const { return max_; }
+
+  // Varianza campionaria (n - 1); 0 con meno di due campioni
+  float variance() const
+  {
+    return n_ > 1 ? (float)(m2_ / (double)(n_ - 1)) : 0.0f;
+  }
+
+private:
+  uint32_t n_    = 0;
+  double   mean_ = 0.0;
+  double   m2_   = 0.0;
+  float    min_  = 0.0f;
+  float    max_  = 0.0f;
+};
+
+class P2Quantile
+{
+public:
+  explicit constexpr P2Quantile(float p = 0.5f) : p_(p) {}
+
+  void add(float x)
+  {
+    if (count_ < 5) {
+      // Primi cinque campioni: ordinati nei marcatori
+      size_t i = count_++;
+      while (i > 0 && q_[i - 1] > x) {
+        q_[i] = q_[i - 1];
+        --i;
+      }
+      q_[i] = x;
+      if (count_ == 5) {
+        for (int k = 0; k < 5; ++k) {
+          n_[k] = k;
+        }
+      }
+      return;
+    }
+    count_++;
+
+    // Cella del nuovo campione; gli estremi si allargano
+    int k;
+    if (x < q_[0]) {
+      q_[0] = x;
+      k = 0;
+    } else if (x >= q_[4]) {
+      q_[4] = x;
+      k = 3;
+    } else {
+      k = 0;
+      while (x >= q_[k + 1]) {
+        ++k;
+      }
+    }
+    for (int i = k + 1; i < 5; ++i) {
+      n_[i]++;
+    }
+
+    // Marcatori centrali verso la posizione desiderata, di un passo.
+    // Posizione desiderata calcolata dal conteggio: sommare l'incremento
+    // in float a ogni campione deriva dopo qualche milione di campioni.
+    const float dn[3] = { p_ * 0.5f, p_, (1.0f + p_) * 0.5f };
+    for (int i = 1; i <= 3; ++i) {
+      const float d = (float)(count_ - 1) * dn[i - 1] - (float)n_[i];
+      if ((d >= 1.0f && n_[i + 1] - n_[i] > 1) || (d <= -1.0f && n_[i - 1] - n_[i] < -1)) {
+        const int s = d >= 0.0f ? 1 : -1;
+        const float qp = parabolic(i, s);
+        q_[i] = (q_[i - 1] < qp && qp < q_[i + 1]) ? qp : linear(i, s);
+        n_[i] += s;
+      }
+    }
+  }
+
+  void reset() { *this = P2Quantile(p_); }
+
+  uint32_t count() const { return count_; }
+
+  float value() const
+  {
+    if (count_ >= 5) {
+      return q_[2];
+    }
+    if (count_ == 0) {
+      return 0.0f;
+    }
+    return q_[(size_t)lroundf(p_ * (float)(count_ - 1))];
+  }
+
+private:
+  float parabolic(int i, int s) const
+  {
+    const float n0 = (float)n_[i - 1], n1 = (float)n_[i], n2 = (float)n_[i + 1];
+    return q_[i] + (float)s / (n2 - n0) *
+                       ((n1 - n0 + (float)s) * (q_[i + 1] - q_[i]) / (n2 - n1) +
+                        (n2 - n1 - (float)s) * (q_[i] - q_[i - 1]) / (n1 - n0));
+  }
+
+  float linear(int i, int s) const
+  {
+    return q_[i] + (float)s * (q_[i + s] - q_[i]) / (float)(n_[i + s] - n_[i]);
+  }
+
+  float    p_;
+  uint32_t count_  = 0;
+  float    q_[5]   = {};   // altezze dei marcatori
+  int32_t  n_[5]   = {};   // posizioni (0-based)
+};
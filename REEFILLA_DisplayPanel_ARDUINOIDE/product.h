@@ -0,0 +1,56 @@
+#pragma once
+
+#include <stdint.h>
+
+// ----------------------------------------------------
+// Prodotto compilato
+// ----------------------------------------------------
+// Un solo sketch per tutti i pannelli: REEFILLA_PRODUCT sceglie il prodotto
+// a compile time. Le parti specifiche (DBC, stato, decoder, UI) sono nei
+// file *_<prodotto>.*: compilano a vuoto per gli altri prodotti, quindi
+// decoder, widget e tabelle non usati non arrivano nemmeno al linker. Il
+// codice comune che deve distinguere usa ProductTraits (if constexpr).
+//
+// Arduino IDE: il prodotto si sceglie in build_opt.h, che l'ESP32 core
+// passa anche alle librerie (lv_conf.h abilita solo i font del prodotto).
+// Host: CMake lo definisce per ogni eseguibile.
+
+#define REEFILLA_PRODUCT_FILLEE  1
+#define REEFILLA_PRODUCT_VOLTAB  2
+
+#ifndef REEFILLA_PRODUCT
+#define REEFILLA_PRODUCT  REEFILLA_PRODUCT_FILLEE
+#endif
+
+#if REEFILLA_PRODUCT != REEFILLA_PRODUCT_FILLEE && REEFILLA_PRODUCT != REEFILLA_PRODUCT_VOLTAB
+#error "REEFILLA_PRODUCT: prodotto sconosciuto"
+#endif
+
+enum class Product : uint8_t
+{
+  FILLEE = REEFILLA_PRODUCT_FILLEE,
+  VOLTAB = REEFILLA_PRODUCT_VOLTAB,
+};
+
+template <Product P>
+struct ProductTraits;
+
+template <>
+struct ProductTraits<Product::FILLEE>
+{
+  static constexpr const char *NAME        = "fillee";
+  static constexpr bool        TREND_PAGE  = true;   // pagina con il grafico dei trend
+  static constexpr bool        DIAG_PAGE   = true;   // pagina statistiche (ui_diag)
+  static constexpr bool        LARGE_FONTS = true;   // Montserrat 48 (lv_conf.h)
+};
+
+template <>
+struct ProductTraits<Product::VOLTAB>
+{
+  static constexpr const char *NAME        = "voltab";
+  static constexpr bool        TREND_PAGE  = false;  // storico solo da console ('h')
+  static constexpr bool        DIAG_PAGE   = false;
+  static constexpr bool        LARGE_FONTS = false;
+};
+
+using ThisProduct = ProductTraits<static_cast<Product>(REEFILLA_PRODUCT)>;
@@ -0,0 +1,429 @@
+#include "rtrace.h"
+
+#if RTRACE_ENABLED
+
+#include <lvgl.h>
+
+#include "esp_heap_caps.h"
+
+// Punti misurati in rtrace_init() per stimare il costo di uno
+#define RTRACE_CALIB_POINTS  1024
+
+// ----------------------------------------------------
+// Ring per core
+// ----------------------------------------------------
+
+std::atomic<bool> rtrace_on{false};
+RtraceCore        rtrace_core[portNUM_PROCESSORS];
+
+static bool     s_ready   = false;
+static uint32_t s_cost_ns = 0;
+static uint64_t s_since_us = 0;
+
+// Chiamate di disegno dall'ultimo dump. Un solo scrittore (il task UI):
+// load + store, senza il costo di un fetch_add a ogni chiamata.
+static std::atomic<uint32_t> s_draws_traced{0};
+static std::atomic<uint32_t> s_draws_counted{0};
+
+static inline void count_add(std::atomic<uint32_t> &c, uint32_t n)
+{
+  c.store(c.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+bool rtrace_init()
+{
+  if (s_ready) {
+    return true;
+  }
+  const size_t bytes = (size_t)RTRACE_RING_LEN * sizeof(RtraceRecord);
+  for (int c = 0; c < portNUM_PROCESSORS; ++c) {
+    void *p = heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM);
+    if (!p) {
+      p = heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    }
+    if (!p) {
+      Serial.println("[rtrace] ERRORE: memoria insufficiente per i ring, traccia disabilitata");
+      return false;
+    }
+    rtrace_core[c].rec = static_cast<RtraceRecord *>(p);
+  }
+  s_ready = true;
+
+  // Costo di un punto, nel ring del core corrente (poi svuotato)
+  rtrace_on.store(true, std::memory_order_relaxed);
+  const uint64_t t0 = (uint64_t)esp_timer_get_time();
+  for (uint32_t i = 0; i < RTRACE_CALIB_POINTS; ++i) {
+    RTRACE_INSTANT(RTRACE_EV_NONE, i);
+  }
+  const uint64_t t1 = (uint64_t)esp_timer_get_time();
+  s_cost_ns = (uint32_t)((t1 - t0) * 1000U / RTRACE_CALIB_POINTS);
+  rtrace_core[xPortGetCoreID()].head.store(0, std::memory_order_relaxed);
+  s_since_us = t1;
+
+  Serial.printf("[rtrace] %u record per core, %u ns per punto\n",
+                (unsigned)RTRACE_RING_LEN, (unsigned)s_cost_ns);
+  return true;
+}
+
+void rtrace_set_enabled(bool enabled)
+{
+  rtrace_on.store(enabled && s_ready, std::memory_order_relaxed);
+}
+
+bool rtrace_is_enabled()
+{
+  return rtrace_on.load(std::memory_order_relaxed);
+}
+
+RtraceStats rtrace_get_stats()
+{
+  RtraceStats s = {};
+  for (int c = 0; c < portNUM_PROCESSORS; ++c) {
+    s.records[c] = rtrace_core[c].head.load(std::memory_order_relaxed);
+  }
+  s.draws_traced  = s_draws_traced.load(std::memory_order_relaxed);
+  s.draws_counted = s_draws_counted.load(std::memory_order_relaxed);
+  s.cost_ns       = s_cost_ns;
+  s.since_us      = s_since_us;
+  return s;
+}
+
+// ----------------------------------------------------
+// Punti dentro LVGL
+// ----------------------------------------------------
+// Tutto dal task UI (LVGL): nessuna sincronizzazione.
+
+static void (*s_refr_timer_cb)(lv_timer_t *)                   = nullptr;
+static void (*s_flush_cb)(lv_disp_drv_t *, const lv_area_t *, lv_color_t *) = nullptr;
+static void (*s_touch_read_cb)(lv_indev_drv_t *, lv_indev_data_t *) = nullptr;
+
+static void (*s_init_buf)(lv_draw_ctx_t *) = nullptr;
+static void (*s_draw_bg)(lv_draw_ctx_t *, const lv_draw_rect_dsc_t *, const lv_area_t *) = nullptr;
+static void (*s_draw_rect)(lv_draw_ctx_t *, const lv_draw_rect_dsc_t *, const lv_area_t *) = nullptr;
+static void (*s_draw_arc)(lv_draw_ctx_t *, const lv_draw_arc_dsc_t *, const lv_point_t *,
+                          uint16_t, uint16_t, uint16_t) = nullptr;
+static lv_res_t (*s_draw_img)(lv_draw_ctx_t *, const lv_draw_img_dsc_t *, const lv_area_t *,
+                              const void *) = nullptr;
+static void (*s_draw_img_decoded)(lv_draw_ctx_t *, const lv_draw_img_dsc_t *, const lv_area_t *,
+                                  const uint8_t *, lv_img_cf_t) = nullptr;
+static void (*s_draw_letter)(lv_draw_ctx_t *, const lv_draw_label_dsc_t *, const lv_point_t *,
+                             uint32_t) = nullptr;
+static void (*s_draw_line)(lv_draw_ctx_t *, const lv_draw_line_dsc_t *, const lv_point_t *,
+                           const lv_point_t *) = nullptr;
+static void (*s_draw_polygon)(lv_draw_ctx_t *, const lv_draw_rect_dsc_t *, const lv_point_t *,
+                              uint16_t) = nullptr;
+
+static bool     s_area_open = false;   // refr_area aperta (BEGIN senza END)
+static uint32_t s_untraced  = 0;       // chiamate di disegno solo contate nella parte corrente
+
+static void refr_timer_cb(lv_timer_t *t)
+{
+  RTRACE_BEGIN(RTRACE_EV_REFR_TIMER, 0);
+  s_refr_timer_cb(t);
+  RTRACE_END(RTRACE_EV_REFR_TIMER, 0);
+}
+
+// Prima istruzione di refr_area_part; la prima parte di un'area apre anche
+// refr_area
+static void init_buf(lv_draw_ctx_t *ctx)
+{
+  if (!s_area_open) {
+    s_area_open = true;
+    RTRACE_BEGIN(RTRACE_EV_REFR_AREA, ctx->buf_area->y1);
+  }
+  RTRACE_BEGIN(RTRACE_EV_REFR_PART, lv_area_get_height(ctx->buf_area));
+  s_untraced = 0;
+  if (s_init_buf) {
+    s_init_buf(ctx);
+  }
+}
+
+// Ultima istruzione di refr_area_part; l'ultima parte chiude refr_area
+static void flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *px)
+{
+  const bool last = drv->draw_buf->last_part;
+  RTRACE_END(RTRACE_EV_REFR_PART, s_untraced);
+  if (rtrace_on.load(std::memory_order_relaxed)) {
+    count_add(s_draws_counted, s_untraced);
+  }
+  RTRACE_BEGIN(RTRACE_EV_FLUSH, lv_area_get_size(area));
+  s_flush_cb(drv, area, px);
+  RTRACE_END(RTRACE_EV_FLUSH, 0);
+  if (last && s_area_open) {
+    s_area_open = false;
+    RTRACE_END(RTRACE_EV_REFR_AREA, 0);
+  }
+}
+
+static void touch_read_cb(lv_indev_drv_t *drv, lv_indev_data_t *data)
+{
+  RTRACE_BEGIN(RTRACE_EV_TOUCH_READ, 0);
+  s_touch_read_cb(drv, data);
+  RTRACE_END(RTRACE_EV_TOUCH_READ, data->state == LV_INDEV_STATE_PRESSED);
+}
+
+// Traccia la chiamata solo con RTRACE_DRAWS e se disegna almeno
+// RTRACE_DRAW_MIN_PX pixel nel buffer corrente; le altre sono solo contate
+static bool draw_traced(const lv_draw_ctx_t *ctx, const lv_area_t *coords)
+{
+#if !RTRACE_DRAWS
+  (void)ctx; (void)coords;
+  s_untraced++;
+  return false;
+#else
+  if (!rtrace_on.load(std::memory_order_relaxed)) {
+    return false;
+  }
+  // Già piccola senza il taglio sul buffer (la maggior parte): niente
+  // intersezione. Area calcolata qui, lv_area_get_size() non è inline.
+  const int32_t w = coords->x2 - coords->x1 + 1;
+  const int32_t h = coords->y2 - coords->y1 + 1;
+  lv_area_t a;
+  if (w * h < RTRACE_DRAW_MIN_PX ||
+      !_lv_area_intersect(&a, coords, ctx->clip_area) ||
+      lv_area_get_size(&a) < RTRACE_DRAW_MIN_PX) {
+    s_untraced++;
+    return false;
+  }
+  count_add(s_draws_traced, 1);
+  return true;
+#endif
+}
+
+static void draw_bg(lv_draw_ctx_t *ctx, const lv_draw_rect_dsc_t *dsc, const lv_area_t *coords)
+{
+  if (!draw_traced(ctx, coords)) {
+    s_draw_bg(ctx, dsc, coords);
+    return;
+  }
+  RTRACE_BEGIN(RTRACE_EV_DRAW_BG, 0);
+  s_draw_bg(ctx, dsc, coords);
+  RTRACE_END(RTRACE_EV_DRAW_BG, 0);
+}
+
+static void draw_rect(lv_draw_ctx_t *ctx, const lv_draw_rect_dsc_t *dsc, const lv_area_t *coords)
+{
+  if (!draw_traced(ctx, coords)) {
+    s_draw_rect(ctx, dsc, coords);
+    return;
+  }
+  RTRACE_BEGIN(RTRACE_EV_DRAW_RECT, 0);
+  s_draw_rect(ctx, dsc, coords);
+  RTRACE_END(RTRACE_EV_DRAW_RECT, 0);
+}
+
+static void draw_arc(lv_draw_ctx_t *ctx, const lv_draw_arc_dsc_t *dsc, const lv_point_t *center,
+                     uint16_t radius, uint16_t start, uint16_t end)
+{
+  const lv_area_t box = { (lv_coord_t)(center->x - radius), (lv_coord_t)(center->y - radius),
+                          (lv_coord_t)(center->x + radius), (lv_coord_t)(center->y + radius) };
+  if (!draw_traced(ctx, &box)) {
+    s_draw_arc(ctx, dsc, center, radius, start, end);
+    return;
+  }
+  RTRACE_BEGIN(RTRACE_EV_DRAW_ARC, radius);
+  s_draw_arc(ctx, dsc, center, radius, start, end);
+  RTRACE_END(RTRACE_EV_DRAW_ARC, 0);
+}
+
+static lv_res_t draw_img(lv_draw_ctx_t *ctx, const lv_draw_img_dsc_t *dsc, const lv_area_t *coords,
+                         const void *src)
+{
+  if (!draw_traced(ctx, coords)) {
+    return s_draw_img(ctx, dsc, coords, src);
+  }
+  RTRACE_BEGIN(RTRACE_EV_DRAW_IMG, 0);
+  const lv_res_t res = s_draw_img(ctx, dsc, coords, src);
+  RTRACE_END(RTRACE_EV_DRAW_IMG, 0);
+  return res;
+}
+
+static void draw_img_decoded(lv_draw_ctx_t *ctx, const lv_draw_img_dsc_t *dsc,
+                             const lv_area_t *coords, const uint8_t *map, lv_img_cf_t cf)
+{
+  if (!draw_traced(ctx, coords)) {
+    s_draw_img_decoded(ctx, dsc, coords, map, cf);
+    return;
+  }
+  RTRACE_BEGIN(RTRACE_EV_DRAW_IMG, 1);
+  s_draw_img_decoded(ctx, dsc, coords, map, cf);
+  RTRACE_END(RTRACE_EV_DRAW_IMG, 1);
+}
+
+static void draw_letter(lv_draw_ctx_t *ctx, const lv_draw_label_dsc_t *dsc, const lv_point_t *pos,
+                        uint32_t letter)
+{
+#if RTRACE_LETTERS
+  RTRACE_BEGIN(RTRACE_EV_DRAW_LETTER, letter);
+  s_draw_letter(ctx, dsc, pos, letter);
+  RTRACE_END(RTRACE_EV_DRAW_LETTER, 0);
+#else
+  s_untraced++;
+  s_draw_letter(ctx, dsc, pos, letter);
+#endif
+}
+
+static void draw_line(lv_draw_ctx_t *ctx, const lv_draw_line_dsc_t *dsc, const lv_point_t *p1,
+                      const lv_point_t *p2)
+{
+  const lv_coord_t w   = dsc->width / 2 + 1;
+  const lv_area_t  box = { (lv_coord_t)(LV_MIN(p1->x, p2->x) - w), (lv_coord_t)(LV_MIN(p1->y, p2->y) - w),
+                           (lv_coord_t)(LV_MAX(p1->x, p2->x) + w), (lv_coord_t)(LV_MAX(p1->y, p2->y) + w) };
+  if (!draw_traced(ctx, &box)) {
+    s_draw_line(ctx, dsc, p1, p2);
+    return;
+  }
+  RTRACE_BEGIN(RTRACE_EV_DRAW_LINE, 0);
+  s_draw_line(ctx, dsc, p1, p2);
+  RTRACE_END(RTRACE_EV_DRAW_LINE, 0);
+}
+
+static void draw_polygon(lv_draw_ctx_t *ctx, const lv_draw_rect_dsc_t *dsc, const lv_point_t *pts,
+                         uint16_t n)
+{
+#if RTRACE_DRAWS
+  if (rtrace_on.load(std::memory_order_relaxed)) {
+    count_add(s_draws_traced, 1);
+  }
+  RTRACE_BEGIN(RTRACE_EV_DRAW_POLYGON, n);
+  s_draw_polygon(ctx, dsc, pts, n);
+  RTRACE_END(RTRACE_EV_DRAW_POLYGON, 0);
+#else
+  s_untraced++;
+  s_draw_polygon(ctx, dsc, pts, n);
+#endif
+}
+
+// Sostituisce fn con wrap se c'è (e se non è già sostituita)
+template <typename F>
+static void hook(F &fn, F &orig, F wrap)
+{
+  if (fn && fn != wrap) {
+    orig = fn;
+    fn   = wrap;
+  }
+}
+
+void rtrace_lvgl_install()
+{
+  lv_disp_t *disp = lv_disp_get_default();
+  if (!s_ready || !disp) {
+    return;
+  }
+
+  if (disp->refr_timer) {
+    hook(disp->refr_timer->timer_cb, s_refr_timer_cb, refr_timer_cb);
+  }
+  hook(disp->driver->flush_cb, s_flush_cb, flush_cb);
+
+  lv_draw_ctx_t *ctx = disp->driver->draw_ctx;
+  if (ctx) {
+    // init_buf è nullptr nel renderer software: si installa comunque
+    if (ctx->init_buf != init_buf) {
+      s_init_buf    = ctx->init_buf;
+      ctx->init_buf = init_buf;
+    }
+    hook(ctx->draw_bg, s_draw_bg, draw_bg);
+    hook(ctx->draw_rect, s_draw_rect, draw_rect);
+    hook(ctx->draw_arc, s_draw_arc, draw_arc);
+    hook(ctx->draw_img, s_draw_img, draw_img);
+    hook(ctx->draw_img_decoded, s_draw_img_decoded, draw_img_decoded);
+    hook(ctx->draw_letter, s_draw_letter, draw_letter);
+    hook(ctx->draw_line, s_draw_line, draw_line);
+    hook(ctx->draw_polygon, s_draw_polygon, draw_polygon);
+  }
+
+  // Il primo indev a puntatore (il touch)
+  for (lv_indev_t *i = lv_indev_get_next(nullptr); i; i = lv_indev_get_next(i)) {
+    if (i->driver->type == LV_INDEV_TYPE_POINTER) {
+      hook(i->driver->read_cb, s_touch_read_cb, touch_read_cb);
+      break;
+    }
+  }
+}
+
+// ----------------------------------------------------
+// Dump
+// ----------------------------------------------------
+
+void rtrace_dump(Print &out)
+{
+  if (!s_ready) {
+    out.println("[rtrace] non inizializzata");
+    return;
+  }
+  const bool was_on = rtrace_on.exchange(false, std::memory_order_relaxed);
+  delay(2);   // un punto a metà sull'altro core finisce di scrivere
+
+  const uint64_t now_us = (uint64_t)esp_timer_get_time();
+  const double   span_s = (now_us - s_since_us) / 1e6;
+  uint32_t       total  = 0;
+
+  out.print("\nRTRDUMP BEGIN\n");
+  for (int c = 0; c < portNUM_PROCESSORS; ++c) {
+    RtraceCore    &core = rtrace_core[c];
+    const uint32_t head = core.head.load(std::memory_order_relaxed);
+    const uint32_t n    = head < RTRACE_RING_LEN ? head : RTRACE_RING_LEN;
+
+    RtraceBlockHeader h = {};
+    h.magic  = RTRACE_MAGIC;
+    h.core   = (uint8_t)c;
+    h.count  = n;
+    h.lost   = head - n;
+    h.now_us = now_us;
+    out.write((const uint8_t *)&h, sizeof(h));
+
+    // Dal più vecchio: fino alla fine del buffer, poi dall'inizio
+    const uint32_t first = (head - n) & (RTRACE_RING_LEN - 1);
+    const uint32_t tail  = (first + n <= RTRACE_RING_LEN) ? n : RTRACE_RING_LEN - first;
+    out.write((const uint8_t *)&core.rec[first], tail * sizeof(RtraceRecord));
+    out.write((const uint8_t *)&core.rec[0], (n - tail) * sizeof(RtraceRecord));
+
+    total += head;
+    core.head.store(0, std::memory_order_relaxed);
+  }
+  out.print("\nRTRDUMP END\n");
+
+  // Costo stimato: punti al secondo x costo di un punto, su un core
+  const double per_s = span_s > 0 ? total / span_s : 0.0;
+  out.printf("[rtrace] %.1f s: %lu punti (%.0f/s), %lu ns per punto -> %.2f%% di un core\n",
+             span_s, (unsigned long)total, per_s, (unsigned long)s_cost_ns,
+             per_s * s_cost_ns / 1e7);
+  out.printf("[rtrace] chiamate di disegno: %lu tracciate, %lu solo contate\n",
+             (unsigned long)s_draws_traced.exchange(0, std::memory_order_relaxed),
+             (unsigned long)s_draws_counted.exchange(0, std::memory_order_relaxed));
+
+  s_since_us = now_us;
+  rtrace_on.store(was_on, std::memory_order_relaxed);
+}
+
+#else   // RTRACE_ENABLED
+
+bool rtrace_init()
+{
+  return false;
+}
+
+void rtrace_lvgl_install() {}
+
+void rtrace_set_enabled(bool enabled)
+{
+  (void)enabled;
+}
+
+bool rtrace_is_enabled()
+{
+  return false;
+}
+
+RtraceStats rtrace_get_stats()
+{
+  return RtraceStats();
+}
+
+void rtrace_dump(Print &out)
+{
+  out.println("[rtrace] compilata via (RTRACE_ENABLED=0)");
+}
+
+#endif  // RTRACE_ENABLED
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "rtrace_format.h"
+
+// ----------------------------------------------------
+// Punti di traccia della pipeline di rendering (e della decodifica CAN)
+// ----------------------------------------------------
+// RTRACE_BEGIN/END/INSTANT(evento, arg) scrivono un record da 8 byte
+// (timestamp esp_timer + evento + fase + argomento) nel ring del core che
+// li esegue: un fetch_add sull'indice del ring, nessun lock. Il ring è un
+// registratore di volo: i record più vecchi vengono sovrascritti.
+//
+// I punti dentro LVGL senza toccare la libreria (rtrace_lvgl_install):
+// - _lv_disp_refr_timer: callback del timer di refresh sostituita
+// - refr_area / refr_area_part: init_buf del draw_ctx (chiamata all'inizio
+//   di ogni refr_area_part) e flush_cb (alla fine; l'area si chiude con
+//   l'ultima parte)
+// - chiamate di disegno: draw_bg/rect/arc/img/line/polygon del draw_ctx
+// - flush_cb del display e read_cb degli indev a puntatore
+// Gli altri sono nel codice: lv_timer_handler (ui_task), drawBitmap
+// (lv_port), decodifica CAN (can_port).
+//
+// Le chiamate di disegno (circa 900 per frame sul cruscotto di
+// host/bench/rtrace_bench, quasi tutte lettere e rettangoli piccoli) di
+// default sono solo contate: il totale esce come argomento della fine di
+// refr_area_part. Con i punti anche solo per quelle grandi la traccia
+// accesa supera l'1% del tempo di un frame; senza ne restano 54 per frame
+// (refr_area_part e flush per ogni draw buffer, più timer e refresh).
+// RTRACE_DRAWS=1 traccia le chiamate che toccano almeno RTRACE_DRAW_MIN_PX
+// pixel del draw buffer (57 per frame a 4096 px, circa +1.3%),
+// RTRACE_LETTERS=1 anche le lettere una per una.
+//
+// Dump: comando 'f' sulla console (formato in rtrace_format.h), poi su host
+//   rtrace_json cattura.bin > trace.json   (chrome://tracing, Perfetto)
+//
+// RTRACE_ENABLED=0 (build_opt.h): macro vuote, nessun hook installato,
+// nessun ring allocato.
+
+#ifndef RTRACE_ENABLED
+#define RTRACE_ENABLED  1
+#endif
+
+// Record per core (potenza di 2): 4096 x 8 byte = 32 KB per core, in PSRAM
+#ifndef RTRACE_RING_LEN
+#define RTRACE_RING_LEN  4096
+#endif
+
+// Chiamate di disegno tracciate (1) o solo contate (0)
+#ifndef RTRACE_DRAWS
+#define RTRACE_DRAWS  0
+#endif
+
+// Con RTRACE_DRAWS: pixel minimi (dentro il draw buffer) per tracciare una
+// chiamata di disegno
+#ifndef RTRACE_DRAW_MIN_PX
+#define RTRACE_DRAW_MIN_PX  4096
+#endif
+
+#ifndef RTRACE_LETTERS
+#define RTRACE_LETTERS  0
+#endif
+
+struct RtraceCore
+{
+  std::atomic<uint32_t> head{0};      // record scritti dall'avvio
+  RtraceRecord         *rec = nullptr;
+};
+
+struct RtraceStats
+{
+  uint32_t records[portNUM_PROCESSORS];   // scritti per core dall'ultimo dump
+  uint32_t draws_traced;                  // chiamate di disegno tracciate
+  uint32_t draws_counted;                 // solo contate (piccole, lettere)
+  uint32_t cost_ns;                       // costo misurato di un punto (rtrace_init)
+  uint64_t since_us;
+};
+
+// Alloca i ring e misura il costo di un punto. Prima dei task che tracciano.
+bool rtrace_init();
+
+// Aggancia i punti dentro LVGL sul display di default e sugli indev a
+// puntatore. Dopo la registrazione di display e indev (lv_port_init).
+void rtrace_lvgl_install();
+
+// Accende/spegne la registrazione (accesa dopo rtrace_init)
+void rtrace_set_enabled(bool enabled);
+bool rtrace_is_enabled();
+
+RtraceStats rtrace_get_stats();
+
+// Dump binario dei ring su out (RTRDUMP BEGIN/END), poi una riga di testo
+// con record al secondo e stima del costo. La registrazione è sospesa
+// durante il dump.
+void rtrace_dump(Print &out);
+
+// ----------------------------------------------------
+// Path caldo (inline)
+// ----------------------------------------------------
+
+#if RTRACE_ENABLED
+
+extern std::atomic<bool> rtrace_on;
+extern RtraceCore        rtrace_core[portNUM_PROCESSORS];
+
+static_assert((RTRACE_RING_LEN & (RTRACE_RING_LEN - 1)) == 0,
+              "RTRACE_RING_LEN deve essere una potenza di 2");
+
+inline void rtrace_emit(uint8_t event, uint8_t phase, uint32_t arg)
+{
+  if (!rtrace_on.load(std::memory_order_relaxed)) {
+    return;
+  }
+  RtraceCore    &c   = rtrace_core[xPortGetCoreID()];
+  const uint32_t pos = c.head.fetch_add(1, std::memory_order_relaxed);
+  RtraceRecord  &r   = c.rec[pos & (RTRACE_RING_LEN - 1)];
+  r.ts_us = (uint32_t)esp_timer_get_time();
+  r.event = event;
+  r.phase = phase;
+  r.arg   = (uint16_t)(arg > 0xFFFFU ? 0xFFFFU : arg);
+}
+
+#define RTRACE_BEGIN(ev, arg)    rtrace_emit((ev), RTRACE_PH_BEGIN, (uint32_t)(arg))
+#define RTRACE_END(ev, arg)      rtrace_emit((ev), RTRACE_PH_END, (uint32_t)(arg))
+#define RTRACE_INSTANT(ev, arg)  rtrace_emit((ev), RTRACE_PH_INSTANT, (uint32_t)(arg))
+
+#else
+
+#define RTRACE_BEGIN(ev, arg)    do {} while (0)
+#define RTRACE_END(ev, arg)      do {} while (0)
+#define RTRACE_INSTANT(ev, arg)  do {} while (0)
+
+#endif
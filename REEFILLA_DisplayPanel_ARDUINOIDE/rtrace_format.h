@@ -0,0 +1,102 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------
+// Traccia della pipeline di rendering: formato (condiviso firmware / host)
+// ----------------------------------------------------
+// Ogni punto di traccia è un record da 8 byte in un ring per core
+// (rtrace.h). Il dump seriale (comando 'f') è:
+//
+//   "\nRTRDUMP BEGIN\n"
+//   per ogni core: RtraceBlockHeader (24 byte) + count RtraceRecord
+//   "\nRTRDUMP END\n"
+//
+// Il timestamp dei record sono i 32 bit bassi di esp_timer (µs, stesso
+// clock sui due core): si ricostruisce a 64 bit all'indietro da now_us
+// dell'header (il ring copre molto meno dei 71 minuti del giro).
+//
+// Record (little endian):
+//   ts_us (4) | evento (1) | fase (1) | argomento (2)
+
+#define RTRACE_MAGIC  0x31525452UL   // "RTR1" in little endian
+
+// Fasi (come "ph" del formato Chrome trace)
+#define RTRACE_PH_BEGIN    'B'
+#define RTRACE_PH_END      'E'
+#define RTRACE_PH_INSTANT  'i'
+
+enum RtraceEvent : uint8_t
+{
+  RTRACE_EV_NONE,
+  RTRACE_EV_TIMER_HANDLER,   // lv_timer_handler()            E: ms al prossimo timer
+  RTRACE_EV_REFR_TIMER,      // _lv_disp_refr_timer()
+  RTRACE_EV_REFR_AREA,       // refr_area (un'area invalidata) B: y1 dell'area
+  RTRACE_EV_REFR_PART,       // refr_area_part (un draw buffer) B: righe, E: disegni non tracciati
+  RTRACE_EV_DRAW_BG,         // draw_ctx->draw_bg (con RTRACE_DRAWS, da RTRACE_DRAW_MIN_PX pixel in su)
+  RTRACE_EV_DRAW_RECT,       // draw_ctx->draw_rect
+  RTRACE_EV_DRAW_ARC,        // draw_ctx->draw_arc
+  RTRACE_EV_DRAW_IMG,        // draw_ctx->draw_img / draw_img_decoded
+  RTRACE_EV_DRAW_LETTER,     // draw_ctx->draw_letter (solo con RTRACE_LETTERS)
+  RTRACE_EV_DRAW_LINE,       // draw_ctx->draw_line
+  RTRACE_EV_DRAW_POLYGON,    // draw_ctx->draw_polygon
+  RTRACE_EV_FLUSH,           // flush_cb del display           B: pixel
+  RTRACE_EV_DRAW_BITMAP,     // ESP_PanelLcd::drawBitmap       B: righe
+  RTRACE_EV_TOUCH_READ,      // read_cb dell'indev touch        E: 1 = premuto
+  RTRACE_EV_CAN_DECODE,      // dbc_handle_frame               B: ID (16 bit bassi)
+  RTRACE_EV_CAN_LATEST,      // dbc_process_latest             B: frame nel batch
+  RTRACE_EV_COUNT
+};
+
+static inline const char *rtrace_event_name(uint8_t ev)
+{
+  static const char *const NAMES[RTRACE_EV_COUNT] = {
+    "none",
+    "lv_timer_handler",
+    "_lv_disp_refr_timer",
+    "refr_area",
+    "refr_area_part",
+    "draw_bg",
+    "draw_rect",
+    "draw_arc",
+    "draw_img",
+    "draw_letter",
+    "draw_line",
+    "draw_polygon",
+    "flush_cb",
+    "drawBitmap",
+    "touch_read",
+    "can_decode",
+    "can_latest",
+  };
+  return (ev < RTRACE_EV_COUNT) ? NAMES[ev] : "?";
+}
+
+struct RtraceRecord
+{
+  uint32_t ts_us;   // esp_timer, 32 bit bassi
+  uint8_t  event;   // RtraceEvent
+  uint8_t  phase;   // RTRACE_PH_*
+  uint16_t arg;
+};
+
+static_assert(sizeof(RtraceRecord) == 8, "RtraceRecord: layout inatteso");
+
+struct RtraceBlockHeader
+{
+  uint32_t magic;      // RTRACE_MAGIC
+  uint8_t  core;
+  uint8_t  reserved[3];
+  uint32_t count;      // record che seguono (i più recenti del ring)
+  uint32_t lost;       // record sovrascritti prima del dump
+  uint64_t now_us;     // esp_timer al dump
+};
+
+static_assert(sizeof(RtraceBlockHeader) == 24, "RtraceBlockHeader: layout inatteso");
+
+// Timestamp a 64 bit di un record, sapendo che è anteriore a now_us
+static inline uint64_t rtrace_unwrap_us(uint32_t ts_us, uint64_t now_us)
+{
+  return now_us - (uint32_t)((uint32_t)now_us - ts_us);
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include <type_traits>
+
+// ----------------------------------------------------
+// Seqlock: pubblicazione di uno snapshot tra core senza mutex
+// ----------------------------------------------------
+// Uno scrittore, lettori qualsiasi (altri task / altro core).
+// - publish() è wait-free: due incrementi di sequenza e una copia, non
+//   aspetta mai i lettori
+// - read() copia il valore e ricontrolla la sequenza: se nel frattempo lo
+//   scrittore ha pubblicato (sequenza dispari o cambiata) riprova. Il
+//   valore restituito è sempre per intero una sola pubblicazione.
+// - il valore è tenuto in parole atomiche (come in can_lvc): la copia
+//   concorrente non è una data race, le barriere fanno il resto
+//
+// Il lettore riprova solo se una pubblicazione si sovrappone alla copia:
+// con lo scrittore su un task a priorità più alta (task RX CAN) o su un
+// altro core i tentativi sono al massimo un paio.
+template <typename T>
+class Seqlock
+{
+  static_assert(std::is_trivially_copyable<T>::value,
+                "Seqlock: T deve essere copiabile con memcpy");
+
+  static constexpr size_t WORDS = (sizeof(T) + 3) / 4;
+
+public:
+  // Solo dallo scrittore
+  void publish(const T &value)
+  {
+    uint32_t buf[WORDS] = {};
+    memcpy(buf, &value, sizeof(T));
+
+    const uint32_t seq = seq_.load(std::memory_order_relaxed);
+    seq_.store(seq + 1, std::memory_order_relaxed);        // dispari: scrittura in corso
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t i = 0; i < WORDS; ++i) {
+      words_[i].store(buf[i], std::memory_order_relaxed);
+    }
+    seq_.store(seq + 2, std::memory_order_release);
+  }
+
+  // Da qualsiasi task. Ritorna la versione letta (numero di pubblicazioni):
+  // 0 = mai pubblicato, out = T() con i suoi valori di default.
+  uint32_t read(T &out) const
+  {
+    uint32_t buf[WORDS];
+    while (true) {
+      const uint32_t seq = seq_.load(std::memory_order_acquire);
+      if (seq == 0) {
+        out = T();
+        return 0;
+      }
+      if (seq & 1U) {
+        continue;   // scrittore a metà copia
+      }
+      for (size_t i = 0; i < WORDS; ++i) {
+        buf[i] = words_[i].load(std::memory_order_relaxed);
+      }
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (seq_.load(std::memory_order_relaxed) == seq) {
+        memcpy(&out, buf, sizeof(T));
+        return seq / 2;
+      }
+    }
+  }
+
+  // Versione corrente senza copiare il valore
+  uint32_t version() const
+  {
+    return seq_.load(std::memory_order_acquire) / 2;
+  }
+
+private:
+  std::atomic<uint32_t> seq_{0};
+  std::atomic<uint32_t> words_[WORDS] = {};
+};
@@ -0,0 +1,176 @@
+#include "sig_history.h"
+
+#include "esp_heap_caps.h"
+
+#include <math.h>
+#include <string.h>
+
+constexpr uint32_t SigHistory::WIDTH_S[SIG_HISTORY_LEVELS];
+constexpr uint32_t SigHistory::LEN[SIG_HISTORY_LEVELS];
+
+static_assert(SigHistory::WIDTH_S[1] % SigHistory::WIDTH_S[0] == 0 &&
+              SigHistory::WIDTH_S[2] % SigHistory::WIDTH_S[1] == 0 &&
+              SigHistory::WIDTH_S[3] % SigHistory::WIDTH_S[2] == 0,
+              "ogni livello deve essere un multiplo intero del precedente");
+
+// ----------------------------------------------------
+// INGESTIONE
+// ----------------------------------------------------
+
+void SigHistory::attach(SigBucket *storage)
+{
+  if (storage) {
+    memset(storage, 0, SIG_HISTORY_BYTES);
+  }
+  for (uint8_t l = 0; l < SIG_HISTORY_LEVELS; ++l) {
+    ring_[l] = storage;
+    open_[l] = SigBucket();
+    if (storage) {
+      storage += LEN[l];
+    }
+  }
+}
+
+// Fonde b nel bucket aperto del livello (idx = indice del bucket aperto)
+void SigHistory::merge(uint8_t level, uint32_t idx, const SigBucket &b)
+{
+  SigBucket &o = open_[level];
+  if (o.tag != 0 && o.tag != idx + 1) {
+    close(level);
+  }
+  if (o.tag == 0) {
+    o     = b;
+    o.tag = idx + 1;
+    return;
+  }
+  o.n   += b.n;
+  o.sum += b.sum;
+  if (b.min < o.min) o.min = b.min;
+  if (b.max > o.max) o.max = b.max;
+}
+
+// Chiude il bucket aperto del livello: nel ring e nel livello sopra
+void SigHistory::close(uint8_t level)
+{
+  SigBucket &o = open_[level];
+  const uint32_t idx = o.tag - 1;
+  ring_[level][idx % LEN[level]] = o;
+
+  if (level + 1 < SIG_HISTORY_LEVELS) {
+    const uint32_t ratio = WIDTH_S[level + 1] / WIDTH_S[level];
+    merge(level + 1, idx / ratio, o);
+  }
+  o.tag = 0;
+}
+
+void SigHistory::add(uint64_t t_ms, float v)
+{
+  if (!attached() || !isfinite(v)) {
+    return;
+  }
+
+  uint32_t idx = (uint32_t)(t_ms / 1000ULL);
+  const SigBucket &o = open_[0];
+  if (o.tag != 0 && idx < o.tag - 1) {
+    idx = o.tag - 1;
+  }
+
+  SigBucket b;
+  b.tag = 0;
+  b.n   = 1;
+  b.min = b.max = b.sum = v;
+  merge(0, idx, b);
+}
+
+// ----------------------------------------------------
+// QUERY
+// ----------------------------------------------------
+
+bool SigHistory::lookup(uint8_t level, uint32_t idx, SigBucket &out) const
+{
+  if (open_[level].tag == idx + 1) {
+    out = open_[level];
+    return true;
+  }
+  const SigBucket &b = ring_[level][idx % LEN[level]];
+  if (b.tag == idx + 1) {
+    out = b;
+    return true;
+  }
+  return false;
+}
+
+SigQuery SigHistory::query(uint64_t now_ms, uint32_t window_s, size_t width_px,
+                           SigPoint *out, size_t max_out) const
+{
+  SigQuery q = {};
+  if (!attached() || window_s == 0 || width_px == 0 || max_out == 0) {
+    return q;
+  }
+  if (width_px > max_out) {
+    width_px = max_out;
+  }
+
+  // Livello più fine con al più un bucket per pixel che copre la finestra;
+  // altrimenti il più grossolano
+  uint8_t level = SIG_HISTORY_LEVELS - 1;
+  for (uint8_t l = 0; l < SIG_HISTORY_LEVELS; ++l) {
+    const uint32_t buckets = (window_s + WIDTH_S[l] - 1) / WIDTH_S[l];
+    if (buckets <= width_px && buckets <= LEN[l]) {
+      level = l;
+      break;
+    }
+  }
+
+  const uint32_t w    = WIDTH_S[level];
+  const uint32_t last = (uint32_t)(now_ms / 1000ULL) / w;
+  uint32_t buckets    = (window_s + w - 1) / w;
+  if (buckets > LEN[level]) buckets = LEN[level];
+  if (buckets > last + 1)   buckets = last + 1;
+
+  // Più bucket per punto solo se il ring ne ha più dei pixel
+  const uint32_t per   = (uint32_t)((buckets + width_px - 1) / width_px);
+  const uint32_t count = (buckets + per - 1) / per;
+  // Appena dopo l'avvio la finestra parte da 0 (gli ultimi punti restano vuoti)
+  const uint32_t first = (last + 1 > count * per) ? last + 1 - count * per : 0;
+
+  for (uint32_t p = 0; p < count; ++p) {
+    SigPoint &pt = out[p];
+    pt = SigPoint();
+    float sum = 0.0f;
+    for (uint32_t k = 0; k < per; ++k) {
+      SigBucket b;
+      if (!lookup(level, first + p * per + k, b)) {
+        continue;
+      }
+      if (pt.n == 0 || b.min < pt.min) pt.min = b.min;
+      if (pt.n == 0 || b.max > pt.max) pt.max = b.max;
+      pt.n += b.n;
+      sum  += b.sum;
+    }
+    pt.mean = pt.n ? sum / pt.n : 0.0f;
+  }
+
+  q.level  = level;
+  q.step_s = w * per;
+  q.t0_s   = first * w;
+  q.count  = count;
+  return q;
+}
+
+// ----------------------------------------------------
+// ALLOCAZIONE
+// ----------------------------------------------------
+
+bool sig_history_init(SigHistory *list, size_t count)
+{
+  SigBucket *storage = static_cast<SigBucket *>(
+      heap_caps_malloc(count * SIG_HISTORY_BYTES, MALLOC_CAP_SPIRAM));
+  if (!storage) {
+    return false;
+  }
+  for (size_t i = 0; i < count; ++i) {
+    list[i].attach(storage + i * SIG_HISTORY_BUCKETS);
+  }
+  return true;
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------
+// Storico multi-risoluzione dei segnali decodificati (trend)
+// ----------------------------------------------------
+// Per ogni segnale, quattro ring di bucket min/max/media a cascata:
+//
+//   livello 0: bucket da 1 s     (SIG_HISTORY_L0_LEN, default 10 min)
+//   livello 1: bucket da 10 s    (SIG_HISTORY_L1_LEN, default 1 h)
+//   livello 2: bucket da 1 min   (SIG_HISTORY_L2_LEN, default 12 h)
+//   livello 3: bucket da 10 min  (SIG_HISTORY_L3_LEN, default 3 giorni)
+//
+// - add() accumula il campione nel bucket aperto del livello 0; quando il
+//   tempo passa al secondo successivo il bucket si chiude nel ring e si
+//   fonde nel bucket aperto del livello sopra, e così via: O(1) ammortizzato
+//   (un livello k si chiude una volta ogni 10/6/10 chiusure del livello k-1)
+// - i buchi (bus muto, segnale non valido) non costano nulla: ogni bucket
+//   porta il proprio indice temporale, uno slot con indice vecchio è vuoto
+// - query() sceglie il livello più fine che copre la finestra con al più un
+//   bucket per pixel; se nessun livello basta, fonde più bucket per pixel
+//
+// La memoria è fissa: SIG_HISTORY_BYTES per segnale, allocati in un solo
+// blocco in PSRAM da sig_history_init(). Un solo task scrive e legge (il
+// task UI), niente sincronizzazione.
+
+#ifndef SIG_HISTORY_L0_LEN
+#define SIG_HISTORY_L0_LEN  600
+#endif
+#ifndef SIG_HISTORY_L1_LEN
+#define SIG_HISTORY_L1_LEN  360
+#endif
+#ifndef SIG_HISTORY_L2_LEN
+#define SIG_HISTORY_L2_LEN  720
+#endif
+#ifndef SIG_HISTORY_L3_LEN
+#define SIG_HISTORY_L3_LEN  432
+#endif
+
+#define SIG_HISTORY_LEVELS  4
+
+struct SigBucket
+{
+  uint32_t tag;   // indice del bucket (tempo / larghezza) + 1, 0 = mai scritto
+  uint32_t n;     // campioni
+  float    min;
+  float    max;
+  float    sum;
+};
+
+static constexpr uint32_t SIG_HISTORY_BUCKETS =
+    SIG_HISTORY_L0_LEN + SIG_HISTORY_L1_LEN + SIG_HISTORY_L2_LEN + SIG_HISTORY_L3_LEN;
+static constexpr size_t SIG_HISTORY_BYTES = SIG_HISTORY_BUCKETS * sizeof(SigBucket);
+
+// Un punto del trend: n == 0 = nessun dato nell'intervallo
+struct SigPoint
+{
+  float    min;
+  float    max;
+  float    mean;
+  uint32_t n;
+};
+
+// Risultato di query(): i punti coprono [t0_s, t0_s + count * step_s)
+struct SigQuery
+{
+  uint8_t  level;    // livello usato
+  uint32_t step_s;   // secondi per punto
+  uint32_t t0_s;     // inizio del primo punto
+  size_t   count;    // punti scritti
+};
+
+class SigHistory
+{
+public:
+  // Larghezza dei bucket di ogni livello [s]
+  static constexpr uint32_t WIDTH_S[SIG_HISTORY_LEVELS] = { 1, 10, 60, 600 };
+  static constexpr uint32_t LEN[SIG_HISTORY_LEVELS] = {
+    SIG_HISTORY_L0_LEN, SIG_HISTORY_L1_LEN, SIG_HISTORY_L2_LEN, SIG_HISTORY_L3_LEN
+  };
+
+  // Collega lo storage (SIG_HISTORY_BUCKETS bucket) e azzera lo storico
+  void attach(SigBucket *storage);
+
+  bool attached() const { return ring_[0] != nullptr; }
+
+  // Campione v all'istante t_ms (non decrescente; un t più vecchio del
+  // bucket aperto finisce nel bucket aperto). Valori non finiti ignorati.
+  void add(uint64_t t_ms, float v);
+
+  // Trend degli ultimi window_s secondi fino a now_ms su width_px pixel:
+  // scrive in out al più max_out punti, dal più vecchio
+  SigQuery query(uint64_t now_ms, uint32_t window_s, size_t width_px,
+                 SigPoint *out, size_t max_out) const;
+
+private:
+  void close(uint8_t level);
+  void merge(uint8_t level, uint32_t idx, const SigBucket &b);
+  bool lookup(uint8_t level, uint32_t idx, SigBucket &out) const;
+
+  SigBucket *ring_[SIG_HISTORY_LEVELS] = {};
+  SigBucket  open_[SIG_HISTORY_LEVELS] = {};   // bucket in corso (tag 0 = vuoto)
+};
+
+// Alloca in PSRAM lo storage di count storici e li collega.
+// False se manca memoria (gli storici restano scollegati e add() non fa nulla).
+bool sig_history_init(SigHistory *list, size_t count);
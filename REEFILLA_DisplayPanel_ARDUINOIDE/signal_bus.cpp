@@ -0,0 +1,84 @@
+#include "signal_bus.h"
+
+#include <atomic>
+
+// ----------------------------------------------------
+// Ring e iscritti
+// ----------------------------------------------------
+
+static SignalBusRing s_ring;
+
+struct Subscriber
+{
+  std::atomic<BroadcastCursor *> cur{nullptr};
+  std::atomic<TaskHandle_t>      notify{nullptr};
+  const char                    *name = nullptr;
+};
+
+static Subscriber            s_subs[SIGNAL_BUS_MAX_SUBSCRIBERS];
+static std::atomic<uint32_t> s_sub_count{0};
+
+// ----------------------------------------------------
+// API
+// ----------------------------------------------------
+
+bool signal_bus_subscribe(BroadcastCursor &cur, const char *name, TaskHandle_t notify)
+{
+  s_ring.attach(cur);
+
+  const uint32_t i = s_sub_count.fetch_add(1, std::memory_order_relaxed);
+  if (i >= SIGNAL_BUS_MAX_SUBSCRIBERS) {
+    return false;
+  }
+  s_subs[i].name = name;
+  s_subs[i].notify.store(notify, std::memory_order_relaxed);
+  s_subs[i].cur.store(&cur, std::memory_order_release);
+  return true;
+}
+
+size_t signal_bus_poll(BroadcastCursor &cur, SignalEvent *out, size_t max)
+{
+  return s_ring.poll(cur, out, max);
+}
+
+void signal_bus_publish(const SignalEvent *events, size_t n)
+{
+  s_ring.publish_n(events, n);
+
+  uint32_t count = s_sub_count.load(std::memory_order_relaxed);
+  if (count > SIGNAL_BUS_MAX_SUBSCRIBERS) {
+    count = SIGNAL_BUS_MAX_SUBSCRIBERS;
+  }
+  for (uint32_t i = 0; i < count; ++i) {
+    if (!s_subs[i].cur.load(std::memory_order_acquire)) {
+      continue;   // iscrizione ancora in corso
+    }
+    TaskHandle_t task = s_subs[i].notify.load(std::memory_order_relaxed);
+    if (task) {
+      xTaskNotifyGive(task);
+    }
+  }
+}
+
+uint32_t signal_bus_published()
+{
+  return s_ring.published();
+}
+
+void signal_bus_dump(Print &out)
+{
+  out.printf("[bus] %lu eventi pubblicati, ring da %u\n",
+             (unsigned long)s_ring.published(), (unsigned)SIGNAL_BUS_CAPACITY);
+
+  for (const Subscriber &s : s_subs) {
+    const BroadcastCursor *c = s.cur.load(std::memory_order_acquire);
+    if (!c) {
+      continue;
+    }
+    out.printf("[bus] %-12s ricevuti=%lu persi=%lu overrun=%lu ritardo max=%lu\n",
+               s.name, (unsigned long)c->received.load(std::memory_order_relaxed),
+               (unsigned long)c->lost.load(std::memory_order_relaxed),
+               (unsigned long)c->overruns.load(std::memory_order_relaxed),
+               (unsigned long)c->max_lag.load(std::memory_order_relaxed));
+  }
+}
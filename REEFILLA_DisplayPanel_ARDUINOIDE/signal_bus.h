@@ -0,0 +1,73 @@
+#pragma once
+
+#include <Arduino.h>
+#include "dbc_decoder.h"      // DbcChange
+#include "broadcast_ring.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+// ----------------------------------------------------
+// Bus dei segnali decodificati (publish / subscribe)
+// ----------------------------------------------------
+// Il task RX pubblica un SignalEvent per ogni segnale cambiato (anche i
+// derivati e i cambi di validità), nello stesso punto in cui pubblica lo
+// snapshot di DbcState. I consumatori (UI, log su flash, telemetria
+// seriale, allarmi...) si iscrivono con un proprio cursore e leggono gli
+// eventi nell'ordine in cui sono stati decodificati, ognuno al suo ritmo.
+//
+// Il ring è uno solo (broadcast_ring.h): il task RX scrive ogni evento una
+// volta, non aspetta nessuno e non sa quanti iscritti ci sono. Un iscritto
+// troppo lento perde gli eventi più vecchi e lo vede nei contatori del suo
+// cursore (lost / overruns / max_lag, comando 'p' sulla console). Chi
+// vuole solo l'ultimo valore continua a usare dbc_snapshot().
+//
+// Un iscritto può farsi svegliare (task notification) a ogni
+// pubblicazione invece di interrogare il ring a intervalli fissi.
+
+// Eventi nel ring: a 10 segnali per frame e 100 frame/s, circa 250 ms di
+// margine per l'iscritto più lento
+#ifndef SIGNAL_BUS_CAPACITY
+#define SIGNAL_BUS_CAPACITY  256
+#endif
+
+// Iscritti elencati da signal_bus_dump()
+#ifndef SIGNAL_BUS_MAX_SUBSCRIBERS
+#define SIGNAL_BUS_MAX_SUBSCRIBERS  8
+#endif
+
+#define SIGNAL_EV_VALID  0x01   // segnale valido (bit in DbcState::valid_mask)
+
+struct SignalEvent
+{
+  uint64_t t_us;    // timestamp del frame (esp_timer), o del tick di timeout
+  float    value;   // campo di DbcState, nelle sue unità
+  uint8_t  sig;     // DbcChange
+  uint8_t  flags;   // SIGNAL_EV_*
+  uint16_t seq;     // 16 bit bassi della versione dello snapshot (dbc_snapshot)
+};
+
+using SignalBusRing = BroadcastRing<SignalEvent, SIGNAL_BUS_CAPACITY>;
+
+// Iscrive un consumatore: riceve gli eventi pubblicati da qui in poi. name
+// (stringa statica) compare in signal_bus_dump(). False se ci sono già
+// SIGNAL_BUS_MAX_SUBSCRIBERS iscritti (il cursore funziona lo stesso, ma
+// non è elencato né svegliato).
+// notify: task a cui dare xTaskNotifyGive() a ogni pubblicazione, cioè a
+// ogni frame decodificato o timeout, anche senza segnali cambiati (lo
+// snapshot è comunque nuovo)
+bool signal_bus_subscribe(BroadcastCursor &cur, const char *name,
+                          TaskHandle_t notify = nullptr);
+
+// Fino a max eventi per il cursore, dal più vecchio; 0 = niente di nuovo
+// (o tutto perso in questo giro: vedi cur.lost)
+size_t signal_bus_poll(BroadcastCursor &cur, SignalEvent *out, size_t max);
+
+// Solo dal task RX (dbc_decoder_<prodotto>.cpp), dopo lo snapshot; n può
+// essere 0 (sveglia comunque gli iscritti con notify)
+void signal_bus_publish(const SignalEvent *events, size_t n);
+
+// Eventi pubblicati dall'avvio
+uint32_t signal_bus_published();
+
+// Una riga per iscritto: ricevuti, persi, overrun, ritardo massimo
+void signal_bus_dump(Print &out);
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+#include "cache_line.h"
+
+// ----------------------------------------------------
+// Ring buffer lock-free single-producer / single-consumer
+// ----------------------------------------------------
+// - capacità potenza di 2, storage fornito dal chiamante (PSRAM o RAM interna)
+// - indici "free running": head/tail crescono sempre, la posizione è idx & mask
+// - head scritto solo dal produttore, tail solo dal consumatore, ognuno
+//   sulla propria linea di cache per evitare false sharing tra i core
+// - se il ring è pieno il frame nuovo viene scartato e contato in overflow
+//   (il produttore non può toccare tail senza rompere l'SPSC)
+// Nessuna dipendenza da FreeRTOS/Arduino: compila anche su host Linux.
+template <typename T>
+class SpscRing
+{
+public:
+  // storage deve contenere esattamente capacity elementi
+  bool init(T *storage, size_t capacity)
+  {
+    if (!storage || capacity < 2 || (capacity & (capacity - 1)) != 0) {
+      return false;
+    }
+    buf_  = storage;
+    mask_ = capacity - 1;
+    head_.store(0, std::memory_order_relaxed);
+    tail_.store(0, std::memory_order_relaxed);
+    overflow_.store(0, std::memory_order_relaxed);
+    prod_tail_cache_ = 0;
+    cons_head_cache_ = 0;
+    return true;
+  }
+
+  bool   valid()    const { return buf_ != nullptr; }
+  size_t capacity() const { return mask_ + 1; }
+
+  // Numero di elementi presenti (indicativo se letto da un terzo thread)
+  size_t size() const
+  {
+    return head_.load(std::memory_order_acquire) -
+           tail_.load(std::memory_order_acquire);
+  }
+
+  // Elementi scartati perché il ring era pieno
+  uint32_t overflow_count() const
+  {
+    return overflow_.load(std::memory_order_relaxed);
+  }
+
+  // ---------------- lato produttore ----------------
+
+  bool push(const T &item)
+  {
+    return push_n(&item, 1) == 1;
+  }
+
+  // Inserisce fino a n elementi con un solo store di head.
+  // Ritorna quanti ne sono entrati; il resto finisce nel contatore overflow.
+  size_t push_n(const T *items, size_t n)
+  {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    size_t free_slots = capacity() - (head - prod_tail_cache_);
+    if (free_slots < n) {
+      prod_tail_cache_ = tail_.load(std::memory_order_acquire);
+      free_slots = capacity() - (head - prod_tail_cache_);
+    }
+
+    const size_t count = (n < free_slots) ? n : free_slots;
+    for (size_t i = 0; i < count; ++i) {
+      buf_[(head + i) & mask_] = items[i];
+    }
+    if (count) {
+      head_.store(head + count, std::memory_order_release);
+    }
+    if (count < n) {
+      overflow_.fetch_add(static_cast<uint32_t>(n - count), std::memory_order_relaxed);
+    }
+    return count;
+  }
+
+  // ---------------- lato consumatore ----------------
+
+  bool pop(T &out)
+  {
+    return pop_n(&out, 1) == 1;
+  }
+
+  // Estrae fino a max elementi con un solo store di tail
+  size_t pop_n(T *out, size_t max)
+  {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    size_t avail = cons_head_cache_ - tail;
+    if (avail < max) {
+      cons_head_cache_ = head_.load(std::memory_order_acquire);
+      avail = cons_head_cache_ - tail;
+    }
+
+    const size_t count = (max < avail) ? max : avail;
+    for (size_t i = 0; i < count; ++i) {
+      out[i] = buf_[(tail + i) & mask_];
+    }
+    if (count) {
+      tail_.store(tail + count, std::memory_order_release);
+    }
+    return count;
+  }
+
+private:
+  // Produttore: head + copia locale di tail
+  alignas(CACHE_LINE_SIZE) std::atomic<size_t> head_{0};
+  size_t prod_tail_cache_ = 0;
+  std::atomic<uint32_t> overflow_{0};
+
+  // Consumatore: tail + copia locale di head
+  alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail_{0};
+  size_t cons_head_cache_ = 0;
+
+  // Dati in sola lettura dopo init()
+  alignas(CACHE_LINE_SIZE) T *buf_ = nullptr;
+  size_t mask_ = 0;
+};
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+// ----------------------------------------------------
+// Partizione dei task sui due core dell'ESP32-S3
+// ----------------------------------------------------
+// Core, priorità e stack di tutti i task dello sketch in un solo posto:
+//
+//   core 0: can_rx_task (5)  > task_prof (3) > dlog_task (1)
+//           RX sempre davanti al profilo e al log
+//   core 1: ui_task (2)      > loop() (1)      rendering LVGL sopra la console
+//
+// Il task RX non prende mai il lock LVGL (lv_port_lock.h): passa i dati
+// alla UI con il bus dei segnali e i comandi UI, quindi un ridisegno lungo
+// può rallentarlo solo se gli ruba la CPU. Per questo, se RX e UI finiscono
+// sullo stesso core (o uno dei due senza affinità), RX deve avere la
+// priorità più alta: controllato sotto a compile time.
+//
+// Tutto sovrascrivibile da build_opt.h (es. -DUI_TASK_CORE=0). Core -1 =
+// nessuna affinità (tskNO_AFFINITY, lo scheduler sceglie).
+
+// ---------------- RX CAN (can_port.cpp) ----------------
+
+#ifndef CAN_RX_TASK_CORE
+#define CAN_RX_TASK_CORE   0
+#endif
+
+#ifndef CAN_RX_TASK_PRIO
+#define CAN_RX_TASK_PRIO   5
+#endif
+
+#ifndef CAN_RX_TASK_STACK
+#define CAN_RX_TASK_STACK  4096
+#endif
+
+// ---------------- log differito (dlog.cpp) ----------------
+
+#ifndef DLOG_TASK_CORE
+#define DLOG_TASK_CORE   0
+#endif
+
+// Sotto il task RX: formatta e stampa solo quando la ricezione è ferma
+#ifndef DLOG_TASK_PRIO
+#define DLOG_TASK_PRIO   1
+#endif
+
+// snprintf con float
+#ifndef DLOG_TASK_STACK
+#define DLOG_TASK_STACK  4096
+#endif
+
+// ---------------- profilo dei task (task_prof.cpp) ----------------
+
+// Sull'altro core rispetto a UI e loop(): il campione arriva puntuale anche
+// quando il core 1 è saturo, che è proprio il caso da misurare
+#ifndef TASK_PROF_TASK_CORE
+#define TASK_PROF_TASK_CORE   0
+#endif
+
+// Sotto il task RX, sopra il log
+#ifndef TASK_PROF_TASK_PRIO
+#define TASK_PROF_TASK_PRIO   3
+#endif
+
+#ifndef TASK_PROF_TASK_STACK
+#define TASK_PROF_TASK_STACK  3072
+#endif
+
+// ---------------- rendering LVGL (ui_task.cpp) ----------------
+
+#ifndef UI_TASK_CORE
+#define UI_TASK_CORE   1
+#endif
+
+// Sopra loop() (priorità 1), sotto il task RX
+#ifndef UI_TASK_PRIO
+#define UI_TASK_PRIO   2
+#endif
+
+#ifndef UI_TASK_STACK
+#define UI_TASK_STACK  8192
+#endif
+
+// Tenuta del lock LVGL oltre la quale un task di pari priorità sullo stesso
+// core perderebbe frame CAN: la coda RX del driver TWAI (5 frame di
+// default) a 250 kbit/s con il bus pieno dura ~2 ms. Solo per il report del
+// lock (lv_port_lock_dump).
+#ifndef CAN_RX_LATENCY_BUDGET_US
+#define CAN_RX_LATENCY_BUDGET_US  2000
+#endif
+
+// ----------------------------------------------------
+// Controlli
+// ----------------------------------------------------
+
+// Stesso core o senza affinità: possono contendersi la CPU
+#define TASK_CORES_SHARED(a, b)  ((a) < 0 || (b) < 0 || (a) == (b))
+
+#if TASK_CORES_SHARED(CAN_RX_TASK_CORE, UI_TASK_CORE) && CAN_RX_TASK_PRIO <= UI_TASK_PRIO
+#error "task_config.h: task RX e UI condividono un core, CAN_RX_TASK_PRIO deve superare UI_TASK_PRIO"
+#endif
+
+#if TASK_CORES_SHARED(CAN_RX_TASK_CORE, DLOG_TASK_CORE) && CAN_RX_TASK_PRIO <= DLOG_TASK_PRIO
+#error "task_config.h: task RX e log condividono un core, CAN_RX_TASK_PRIO deve superare DLOG_TASK_PRIO"
+#endif
+
+#if TASK_CORES_SHARED(CAN_RX_TASK_CORE, TASK_PROF_TASK_CORE) && CAN_RX_TASK_PRIO <= TASK_PROF_TASK_PRIO
+#error "task_config.h: task RX e profilo condividono un core, CAN_RX_TASK_PRIO deve superare TASK_PROF_TASK_PRIO"
+#endif
+
+static_assert(CAN_RX_TASK_CORE < 2 && DLOG_TASK_CORE < 2 && UI_TASK_CORE < 2 &&
+              TASK_PROF_TASK_CORE < 2,
+              "task_config.h: l'ESP32-S3 ha i core 0 e 1 (-1 = nessuna affinità)");
+
+// Core da passare a xTaskCreatePinnedToCore
+#define TASK_CORE_ID(core)  ((core) < 0 ? tskNO_AFFINITY : (BaseType_t)(core))
@@ -0,0 +1,395 @@
+#include "task_prof.h"
+
+#if TASK_PROF_ENABLED
+
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+
+#include <algorithm>
+#include <atomic>
+
+#include "seqlock.h"
+
+#if TASK_PROF_OVERLAY
+#include <lvgl.h>
+#endif
+
+#if !configUSE_TRACE_FACILITY || !configGENERATE_RUN_TIME_STATS
+#error "task_prof.h: servono configUSE_TRACE_FACILITY e configGENERATE_RUN_TIME_STATS (o TASK_PROF_ENABLED=0)"
+#endif
+
+#ifndef configRUN_TIME_COUNTER_TYPE
+#define configRUN_TIME_COUNTER_TYPE  uint32_t
+#endif
+
+typedef configRUN_TIME_COUNTER_TYPE RunTime;
+
+// Task letti da uxTaskGetSystemState (che non ne legge nessuno se sono di
+// più); ne escono al massimo TASK_PROF_MAX_TASKS, i più carichi
+#define TASK_PROF_STATUS_MAX  (2 * TASK_PROF_MAX_TASKS)
+
+// ----------------------------------------------------
+// Stato
+// ----------------------------------------------------
+
+static TaskHandle_t              s_task = nullptr;
+static Seqlock<TaskProfSnapshot> s_snap;
+static std::atomic<bool>         s_stream{false};
+
+// loop(): ultimo giro (32 bit bassi di esp_timer) e intervallo massimo
+// nella finestra, azzerato dal campione
+static std::atomic<uint32_t> s_loop_last_us{0};
+static std::atomic<uint32_t> s_loop_gap_max_us{0};
+
+// Solo da task_prof_sample (un solo chiamante)
+struct PrevRun
+{
+  TaskHandle_t handle;
+  RunTime      run;
+};
+
+static TaskStatus_t     s_status[TASK_PROF_STATUS_MAX];
+static PrevRun          s_prev[TASK_PROF_STATUS_MAX];
+static size_t           s_prev_count = 0;
+static RunTime          s_prev_total = 0;
+static uint64_t         s_prev_us    = 0;
+static bool             s_primed     = false;
+static TaskProfTask     s_tasks[TASK_PROF_STATUS_MAX];
+static TaskProfSnapshot s_work;
+static uint8_t          s_frame[TASK_PROF_FRAME_MAX];
+
+// ----------------------------------------------------
+// Campionamento
+// ----------------------------------------------------
+
+// Stack allo xTaskCreate dei task dello sketch (task_config.h)
+static uint32_t known_stack(const char *name)
+{
+  struct Known
+  {
+    const char *name;
+    uint32_t    bytes;
+  };
+  static const Known TABLE[] = {
+    { "can_rx_task", CAN_RX_TASK_STACK },
+    { "dlog_task",   DLOG_TASK_STACK },
+    { "ui_task",     UI_TASK_STACK },
+    { "task_prof",   TASK_PROF_TASK_STACK },
+  };
+  for (const Known &k : TABLE) {
+    if (strcmp(name, k.name) == 0) {
+      return k.bytes;
+    }
+  }
+  if (strcmp(name, "loopTask") == 0) {
+    return (uint32_t)getArduinoLoopTaskStackSize();
+  }
+  return 0;
+}
+
+static RunTime prev_run(TaskHandle_t handle, bool &found)
+{
+  for (size_t i = 0; i < s_prev_count; ++i) {
+    if (s_prev[i].handle == handle) {
+      found = true;
+      return s_prev[i].run;
+    }
+  }
+  found = false;
+  return 0;
+}
+
+static uint16_t permille(uint64_t part, uint64_t whole)
+{
+  if (whole == 0) {
+    return 0;
+  }
+  const uint64_t p = (part * 1000U + whole / 2) / whole;
+  return (uint16_t)(p > 1000U ? 1000U : p);
+}
+
+static void heap_stats(uint32_t caps, TaskProfHeap &h)
+{
+  h.free     = (uint32_t)heap_caps_get_free_size(caps);
+  h.min_free = (uint32_t)heap_caps_get_minimum_free_size(caps);
+  h.largest  = (uint32_t)heap_caps_get_largest_free_block(caps);
+}
+
+void task_prof_sample()
+{
+  RunTime        total = 0;
+  const size_t   n     = uxTaskGetSystemState(s_status, TASK_PROF_STATUS_MAX, &total);
+  const uint64_t now   = (uint64_t)esp_timer_get_time();
+  const RunTime  span  = (RunTime)(total - s_prev_total);
+
+  TaskProfSnapshot &s = s_work;
+  s           = TaskProfSnapshot();
+  s.t_us      = now;
+  s.window_us = s_primed ? (uint32_t)(now - s_prev_us) : 0;
+
+  // Intervallo di loop() ancora aperto: se loop() è fermo conta lo stesso
+  uint32_t       gap  = s_loop_gap_max_us.exchange(0, std::memory_order_relaxed);
+  const uint32_t last = s_loop_last_us.load(std::memory_order_relaxed);
+  if (last && (uint32_t)now - last > gap) {
+    gap = (uint32_t)now - last;
+  }
+  s.loop_gap_max_us = gap;
+
+  heap_stats(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT, s.internal);
+  heap_stats(MALLOC_CAP_SPIRAM, s.psram);
+
+  // CPU dai contatori di run-time (stesso clock di total), core load dai
+  // task idle
+  TaskHandle_t idle[TASK_PROF_CORES];
+  for (int c = 0; c < TASK_PROF_CORES; ++c) {
+    idle[c] = xTaskGetIdleTaskHandleForCore(c);
+    s.core_load_permille[c] = 0;
+  }
+  for (size_t i = 0; i < n; ++i) {
+    const TaskStatus_t &st = s_status[i];
+    TaskProfTask       &t  = s_tasks[i];
+    bool found;
+    const RunTime before = prev_run(st.xHandle, found);
+    // Task nati nella finestra: tutto il loro run-time è della finestra
+    const RunTime delta  = (RunTime)(st.ulRunTimeCounter - before);
+
+    strncpy(t.name, st.pcTaskName, TASK_PROF_NAME_LEN - 1);
+    t.name[TASK_PROF_NAME_LEN - 1] = '\0';
+#if configTASKLIST_INCLUDE_COREID
+    t.core = (st.xCoreID >= 0 && st.xCoreID < TASK_PROF_CORES) ? (uint8_t)st.xCoreID
+                                                                : TASK_PROF_CORE_ANY;
+#else
+    t.core = TASK_PROF_CORE_ANY;
+#endif
+    t.prio           = (uint8_t)st.uxCurrentPriority;
+    t.cpu_permille   = s_primed ? permille(delta, span) : 0;
+    t.stack_size     = known_stack(st.pcTaskName);
+    t.stack_free_min = (uint32_t)st.usStackHighWaterMark;   // byte su ESP-IDF
+
+    for (int c = 0; c < TASK_PROF_CORES; ++c) {
+      if (st.xHandle == idle[c] && s_primed) {
+        s.core_load_permille[c] = (uint16_t)(1000U - t.cpu_permille);
+      }
+    }
+    s_prev[i] = { st.xHandle, st.ulRunTimeCounter };
+  }
+  s_prev_count = n;
+  s_prev_total = total;
+  s_prev_us    = now;
+  s_primed     = n > 0;
+
+  // I più carichi, poi per nome (ordine stabile da un campione all'altro)
+  std::sort(s_tasks, s_tasks + n, [](const TaskProfTask &a, const TaskProfTask &b) {
+    return a.cpu_permille != b.cpu_permille ? a.cpu_permille > b.cpu_permille
+                                            : strcmp(a.name, b.name) < 0;
+  });
+  s.count = (uint8_t)std::min(n, (size_t)TASK_PROF_MAX_TASKS);
+  if (n == 0) {
+    s.dropped = (uint8_t)std::min(uxTaskGetNumberOfTasks(), (UBaseType_t)0xFF);
+  } else {
+    s.dropped = (uint8_t)(n - s.count);
+  }
+  std::copy(s_tasks, s_tasks + s.count, s.task);
+
+  s_snap.publish(s);
+
+  if (s_stream.load(std::memory_order_relaxed)) {
+    const size_t len = task_prof_encode(s, s_frame);
+    Serial.write(s_frame, len);   // una write: il frame non si mescola al log
+  }
+}
+
+static void task_prof_task(void *arg)
+{
+  (void)arg;
+  TickType_t last = xTaskGetTickCount();
+  while (true) {
+    task_prof_sample();
+    xTaskDelayUntil(&last, pdMS_TO_TICKS(TASK_PROF_PERIOD_MS));
+  }
+}
+
+// ----------------------------------------------------
+// API
+// ----------------------------------------------------
+
+bool task_prof_start()
+{
+  if (s_task) {
+    return true;
+  }
+  BaseType_t res = xTaskCreatePinnedToCore(
+      task_prof_task,
+      "task_prof",
+      TASK_PROF_TASK_STACK,
+      nullptr,
+      TASK_PROF_TASK_PRIO,
+      &s_task,
+      TASK_CORE_ID(TASK_PROF_TASK_CORE)
+  );
+  if (res != pdPASS) {
+    Serial.println("[prof] ERRORE: impossibile creare task_prof");
+    s_task = nullptr;
+    return false;
+  }
+  return true;
+}
+
+void task_prof_loop_tick()
+{
+  const uint32_t now  = (uint32_t)esp_timer_get_time();
+  const uint32_t last = s_loop_last_us.exchange(now ? now : 1, std::memory_order_relaxed);
+  if (!last) {
+    return;
+  }
+  const uint32_t gap = now - last;
+  uint32_t       max = s_loop_gap_max_us.load(std::memory_order_relaxed);
+  while (gap > max &&
+         !s_loop_gap_max_us.compare_exchange_weak(max, gap, std::memory_order_relaxed)) {
+  }
+}
+
+uint32_t task_prof_get(TaskProfSnapshot &out)
+{
+  return s_snap.read(out);
+}
+
+void task_prof_set_stream(bool enabled)
+{
+  s_stream.store(enabled, std::memory_order_relaxed);
+}
+
+bool task_prof_is_streaming()
+{
+  return s_stream.load(std::memory_order_relaxed);
+}
+
+void task_prof_dump(Print &out)
+{
+  TaskProfSnapshot s;
+  if (task_prof_get(s) == 0) {
+    out.println("[prof] nessun campione ancora");
+    return;
+  }
+  out.printf("[prof] finestra %.2f s: core 0 %.1f%%, core 1 %.1f%%, loop() fermo al massimo %.1f ms\n",
+             s.window_us / 1e6, s.core_load_permille[0] / 10.0, s.core_load_permille[1] / 10.0,
+             s.loop_gap_max_us / 1000.0);
+  out.printf("[prof] heap interno: %.1f KB liberi (minimo %.1f, blocco max %.1f)\n",
+             s.internal.free / 1024.0, s.internal.min_free / 1024.0, s.internal.largest / 1024.0);
+  out.printf("[prof] PSRAM: %.1f KB liberi (minimo %.1f, blocco max %.1f)\n",
+             s.psram.free / 1024.0, s.psram.min_free / 1024.0, s.psram.largest / 1024.0);
+  out.println("[prof] task             core prio    CPU   stack  usato  libero");
+  for (uint8_t i = 0; i < s.count; ++i) {
+    const TaskProfTask &t = s.task[i];
+    char core[4];
+    if (t.core == TASK_PROF_CORE_ANY) {
+      strcpy(core, "-");
+    } else {
+      snprintf(core, sizeof(core), "%u", (unsigned)t.core);
+    }
+    char size[12] = "?";
+    char used[12] = "?";
+    if (t.stack_size) {
+      snprintf(size, sizeof(size), "%lu", (unsigned long)t.stack_size);
+      snprintf(used, sizeof(used), "%lu", (unsigned long)(t.stack_size - t.stack_free_min));
+    }
+    out.printf("[prof] %-16s %4s %4u %5.1f%% %7s %6s %7lu%s\n", t.name, core, (unsigned)t.prio,
+               t.cpu_permille / 10.0, size, used, (unsigned long)t.stack_free_min,
+               t.stack_free_min < TASK_PROF_STACK_MARGIN ? "  <- stack quasi pieno" : "");
+  }
+  if (s.dropped) {
+    out.printf("[prof] %u task non mostrati (oltre TASK_PROF_MAX_TASKS)\n", (unsigned)s.dropped);
+  }
+}
+
+// ----------------------------------------------------
+// Overlay
+// ----------------------------------------------------
+
+#if TASK_PROF_OVERLAY
+
+static std::atomic<bool> s_overlay_on{false};
+
+// Solo dal task UI
+static lv_obj_t *s_overlay         = nullptr;
+static uint32_t  s_overlay_version = 0;
+
+static void overlay_text(const TaskProfSnapshot &s, char *buf, size_t len)
+{
+  size_t n = (size_t)snprintf(buf, len, "C0 %u%%  C1 %u%%  loop %lu ms\nRAM %lu/%lu k  PS %lu/%lu k",
+                              (unsigned)((s.core_load_permille[0] + 5) / 10),
+                              (unsigned)((s.core_load_permille[1] + 5) / 10),
+                              (unsigned long)(s.loop_gap_max_us / 1000U),
+                              (unsigned long)(s.internal.free / 1024U),
+                              (unsigned long)(s.internal.largest / 1024U),
+                              (unsigned long)(s.psram.free / 1024U),
+                              (unsigned long)(s.psram.largest / 1024U));
+  for (uint8_t i = 0; i < s.count && i < TASK_PROF_OVERLAY_TASKS && n < len; ++i) {
+    const TaskProfTask &t = s.task[i];
+    n += (size_t)snprintf(buf + n, len - n, "\n%-12.12s %3u.%u%%  %lu", t.name,
+                          (unsigned)(t.cpu_permille / 10), (unsigned)(t.cpu_permille % 10),
+                          (unsigned long)t.stack_free_min);
+  }
+}
+
+void task_prof_overlay_update()
+{
+  if (!s_overlay_on.load(std::memory_order_relaxed)) {
+    if (s_overlay) {
+      lv_obj_del(s_overlay);
+      s_overlay = nullptr;
+    }
+    return;
+  }
+  if (!s_overlay) {
+    s_overlay = lv_label_create(lv_layer_top());
+    lv_obj_set_style_bg_color(s_overlay, lv_color_black(), 0);
+    lv_obj_set_style_bg_opa(s_overlay, LV_OPA_70, 0);
+    lv_obj_set_style_text_color(s_overlay, lv_color_white(), 0);
+    lv_obj_set_style_pad_all(s_overlay, 4, 0);
+    lv_obj_align(s_overlay, LV_ALIGN_TOP_RIGHT, -4, 4);
+    lv_label_set_text(s_overlay, "profilo...");
+    s_overlay_version = 0;
+  }
+  if (s_snap.version() == s_overlay_version) {
+    return;
+  }
+  TaskProfSnapshot s;
+  s_overlay_version = s_snap.read(s);
+  char text[64 + 32 * TASK_PROF_OVERLAY_TASKS];
+  overlay_text(s, text, sizeof(text));
+  lv_label_set_text(s_overlay, text);
+}
+
+void task_prof_overlay_set(bool visible)
+{
+  s_overlay_on.store(visible, std::memory_order_relaxed);
+}
+
+bool task_prof_overlay_is_visible()
+{
+  return s_overlay_on.load(std::memory_order_relaxed);
+}
+
+#else
+
+void task_prof_overlay_update() {}
+void task_prof_overlay_set(bool visible) { (void)visible; }
+bool task_prof_overlay_is_visible() { return false; }
+
+#endif
+
+#else   // TASK_PROF_ENABLED
+
+bool     task_prof_start() { return true; }
+void     task_prof_sample() {}
+void     task_prof_loop_tick() {}
+uint32_t task_prof_get(TaskProfSnapshot &out) { out = TaskProfSnapshot(); return 0; }
+void     task_prof_set_stream(bool enabled) { (void)enabled; }
+bool     task_prof_is_streaming() { return false; }
+void     task_prof_dump(Print &out) { out.println("[prof] compilato via (TASK_PROF_ENABLED=0)"); }
+void     task_prof_overlay_update() {}
+void     task_prof_overlay_set(bool visible) { (void)visible; }
+bool     task_prof_overlay_is_visible() { return false; }
+
+#endif
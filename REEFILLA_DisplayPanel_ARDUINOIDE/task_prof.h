@@ -0,0 +1,84 @@
+#pragma once
+
+#include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "task_config.h"       // TASK_PROF_TASK_CORE, TASK_PROF_TASK_PRIO, TASK_PROF_TASK_STACK
+#include "task_prof_format.h"
+
+// ----------------------------------------------------
+// Profilo dei task FreeRTOS: CPU, stack, heap
+// ----------------------------------------------------
+// Un task (task_config.h) campiona uxTaskGetSystemState() ogni
+// TASK_PROF_PERIOD_MS e dalle differenze dei contatori di run-time calcola:
+// - CPU di ogni task in ‰ del tempo di un core nella finestra
+// - carico di ogni core: 1000 - ‰ del suo task idle
+// - stack minimo libero (high-water mark, byte) e stack totale dei task
+//   dello sketch (da task_config.h; loopTask da arduino-esp32)
+// - heap interno e PSRAM: libero, minimo dall'avvio, blocco più grande
+// - l'intervallo più lungo tra due giri di loop() (task_prof_loop_tick):
+//   se loop() resta senza CPU, per esempio sotto lo scroll del touch, si
+//   vede qui prima che nella sua quota di CPU
+//
+// Lo snapshot è pubblicato con un seqlock (task_prof_get da qualsiasi task)
+// e, se richiesto, esce sulla seriale come frame binario compatto
+// (task_prof_format.h, decodifica con host/task_prof) e in un overlay LVGL
+// sul layer top.
+//
+// Richiede configUSE_TRACE_FACILITY e configGENERATE_RUN_TIME_STATS
+// (attivi nelle librerie precompilate di arduino-esp32): senza, la build si
+// ferma; TASK_PROF_ENABLED=0 in build_opt.h riduce il modulo a stub.
+//
+// Per dimensionare uno stack: "usato" nella tabella del comando 'k' è il
+// massimo dall'avvio; sotto TASK_PROF_STACK_MARGIN byte liberi la riga è
+// segnata.
+
+#ifndef TASK_PROF_ENABLED
+#define TASK_PROF_ENABLED  1
+#endif
+
+#ifndef TASK_PROF_PERIOD_MS
+#define TASK_PROF_PERIOD_MS  1000
+#endif
+
+// Stack libero minimo sotto il quale un task è segnalato nel dump
+#ifndef TASK_PROF_STACK_MARGIN
+#define TASK_PROF_STACK_MARGIN  512
+#endif
+
+// Overlay LVGL compilato (acceso/spento a runtime con task_prof_overlay_set)
+#ifndef TASK_PROF_OVERLAY
+#define TASK_PROF_OVERLAY  1
+#endif
+
+// Task mostrati nell'overlay (i più carichi)
+#ifndef TASK_PROF_OVERLAY_TASKS
+#define TASK_PROF_OVERLAY_TASKS  5
+#endif
+
+// Crea il task di campionamento. Prima dei task da misurare non serve: i
+// task nuovi entrano dal campione successivo.
+bool task_prof_start();
+
+// Un campione: chiude la finestra iniziata dal campione precedente e
+// pubblica lo snapshot. Lo chiama il task; su host il driver.
+void task_prof_sample();
+
+// Da ogni giro di loop()
+void task_prof_loop_tick();
+
+// Ultimo snapshot. Ritorna la versione (0 = nessun campione ancora).
+uint32_t task_prof_get(TaskProfSnapshot &out);
+
+// Frame binario a ogni campione sulla seriale (comando 'j')
+void task_prof_set_stream(bool enabled);
+bool task_prof_is_streaming();
+
+// Tabella testo dell'ultimo snapshot (comando 'k')
+void task_prof_dump(Print &out);
+
+// Overlay: acceso/spento da qualsiasi task (comando 'o'), creato e
+// aggiornato da task_prof_overlay_update() nel task UI
+void task_prof_overlay_set(bool visible);
+bool task_prof_overlay_is_visible();
+void task_prof_overlay_update();
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <initializer_list>
+
+// ----------------------------------------------------
+// Profilo dei task FreeRTOS: snapshot e record binario (condivisi firmware / host)
+// ----------------------------------------------------
+// Uno snapshot per intervallo di campionamento (task_prof.h): CPU per core e
+// per task nella finestra, stack libero minimo (high-water mark) dei task,
+// heap interno e PSRAM.
+//
+// Sulla seriale (comando 'j') ogni snapshot esce come un frame, con lo
+// stesso schema del log binario ma sync diverso (dlog_decode lo salta):
+//   0xA5 0x5C | tipo (1) | len (2) | payload (len byte) | checksum (1)
+//   checksum = somma a 8 bit di tipo, len e payload
+//
+// Payload TASK_PROF_FRAME_SAMPLE (little endian):
+//   t_ms (4) | finestra_ms (2) | carico core 0, 1 in ‰ (2 + 2) |
+//   intervallo massimo di loop() ms (2) |
+//   interno: libero, minimo libero, blocco più grande (4 + 4 + 4) |
+//   PSRAM:   libero, minimo libero, blocco più grande (4 + 4 + 4) |
+//   task (1) | per task:
+//     CPU ‰ di un core (2) | core (1, 0xFF = nessuna affinità) | priorità (1) |
+//     stack totale byte (2, 0 = sconosciuto) | stack minimo libero byte (2) |
+//     lunghezza nome (1) | nome
+
+#define TASK_PROF_SYNC0          0xA5
+#define TASK_PROF_SYNC1          0x5C
+#define TASK_PROF_FRAME_HDR      5      // sync (2) + tipo (1) + len (2)
+#define TASK_PROF_FRAME_SAMPLE   1
+
+#define TASK_PROF_CORES          2
+#define TASK_PROF_MAX_TASKS      24
+#define TASK_PROF_NAME_LEN       16     // configMAX_TASK_NAME_LEN, terminatore compreso
+#define TASK_PROF_CORE_ANY       0xFF
+
+#define TASK_PROF_SAMPLE_HDR     37
+#define TASK_PROF_TASK_HDR       9
+#define TASK_PROF_FRAME_MAX      (TASK_PROF_FRAME_HDR + TASK_PROF_SAMPLE_HDR + \
+                                  TASK_PROF_MAX_TASKS * (TASK_PROF_TASK_HDR + TASK_PROF_NAME_LEN) + 1)
+
+struct TaskProfTask
+{
+  char     name[TASK_PROF_NAME_LEN];
+  uint8_t  core;             // 0, 1 o TASK_PROF_CORE_ANY
+  uint8_t  prio;
+  uint16_t cpu_permille;     // del tempo di un core nella finestra
+  uint32_t stack_size;       // byte allo xTaskCreate (0 = sconosciuto)
+  uint32_t stack_free_min;   // byte mai usati dall'avvio del task
+};
+
+struct TaskProfHeap
+{
+  uint32_t free;
+  uint32_t min_free;         // minimo dall'avvio
+  uint32_t largest;          // blocco libero più grande
+};
+
+struct TaskProfSnapshot
+{
+  uint64_t     t_us;                                 // fine della finestra (esp_timer)
+  uint32_t     window_us;
+  uint16_t     core_load_permille[TASK_PROF_CORES];  // 1000 - idle del core
+  uint32_t     loop_gap_max_us;                      // tra due task_prof_loop_tick()
+  TaskProfHeap internal;
+  TaskProfHeap psram;
+  uint8_t      count;
+  uint8_t      dropped;                              // task oltre TASK_PROF_MAX_TASKS
+  TaskProfTask task[TASK_PROF_MAX_TASKS];
+};
+
+// ----------------------------------------------------
+// Frame
+// ----------------------------------------------------
+
+static inline uint8_t task_prof_checksum(const uint8_t *p, size_t n)
+{
+  uint8_t sum = 0;
+  while (n--) {
+    sum = (uint8_t)(sum + *p++);
+  }
+  return sum;
+}
+
+static inline uint8_t *task_prof_put_le(uint8_t *p, uint32_t v, size_t n)
+{
+  for (size_t i = 0; i < n; ++i) {
+    *p++ = (uint8_t)(v >> (8 * i));
+  }
+  return p;
+}
+
+static inline uint32_t task_prof_get_le(const uint8_t *&p, size_t n)
+{
+  uint32_t v = 0;
+  for (size_t i = 0; i < n; ++i) {
+    v |= (uint32_t)*p++ << (8 * i);
+  }
+  return v;
+}
+
+static inline uint16_t task_prof_clamp16(uint32_t v)
+{
+  return (uint16_t)(v > 0xFFFFU ? 0xFFFFU : v);
+}
+
+// Scrive il frame di s in frame (almeno TASK_PROF_FRAME_MAX byte).
+// Ritorna la lunghezza totale.
+static inline size_t task_prof_encode(const TaskProfSnapshot &s, uint8_t *frame)
+{
+  uint8_t *p = frame + TASK_PROF_FRAME_HDR;
+  p = task_prof_put_le(p, (uint32_t)(s.t_us / 1000U), 4);
+  p = task_prof_put_le(p, task_prof_clamp16(s.window_us / 1000U), 2);
+  for (int c = 0; c < TASK_PROF_CORES; ++c) {
+    p = task_prof_put_le(p, s.core_load_permille[c], 2);
+  }
+  p = task_prof_put_le(p, task_prof_clamp16(s.loop_gap_max_us / 1000U), 2);
+  for (const TaskProfHeap *h : { &s.internal, &s.psram }) {
+    p = task_prof_put_le(p, h->free, 4);
+    p = task_prof_put_le(p, h->min_free, 4);
+    p = task_prof_put_le(p, h->largest, 4);
+  }
+  const uint8_t count = s.count > TASK_PROF_MAX_TASKS ? TASK_PROF_MAX_TASKS : s.count;
+  *p++ = count;
+  for (uint8_t i = 0; i < count; ++i) {
+    const TaskProfTask &t = s.task[i];
+    const size_t n = strnlen(t.name, TASK_PROF_NAME_LEN - 1);
+    p = task_prof_put_le(p, t.cpu_permille, 2);
+    *p++ = t.core;
+    *p++ = t.prio;
+    p = task_prof_put_le(p, task_prof_clamp16(t.stack_size), 2);
+    p = task_prof_put_le(p, task_prof_clamp16(t.stack_free_min), 2);
+    *p++ = (uint8_t)n;
+    memcpy(p, t.name, n);
+    p += n;
+  }
+
+  const size_t len = (size_t)(p - frame) - TASK_PROF_FRAME_HDR;
+  frame[0] = TASK_PROF_SYNC0;
+  frame[1] = TASK_PROF_SYNC1;
+  frame[2] = TASK_PROF_FRAME_SAMPLE;
+  frame[3] = (uint8_t)(len & 0xFF);
+  frame[4] = (uint8_t)(len >> 8);
+  frame[TASK_PROF_FRAME_HDR + len] = task_prof_checksum(frame + 2, 3 + len);
+  return TASK_PROF_FRAME_HDR + len + 1;
+}
+
+// Payload di un frame SAMPLE (già validato dal checksum) -> snapshot.
+// t_us, finestra e intervallo di loop() tornano con la risoluzione del
+// record (ms); dropped è sempre 0.
+static inline bool task_prof_decode(const uint8_t *p, size_t len, TaskProfSnapshot &s)
+{
+  const uint8_t *end = p + len;
+  if (len < TASK_PROF_SAMPLE_HDR) {
+    return false;
+  }
+  s = TaskProfSnapshot();
+  s.t_us      = (uint64_t)task_prof_get_le(p, 4) * 1000U;
+  s.window_us = task_prof_get_le(p, 2) * 1000U;
+  for (int c = 0; c < TASK_PROF_CORES; ++c) {
+    s.core_load_permille[c] = (uint16_t)task_prof_get_le(p, 2);
+  }
+  s.loop_gap_max_us = task_prof_get_le(p, 2) * 1000U;
+  for (TaskProfHeap *h : { &s.internal, &s.psram }) {
+    h->free     = task_prof_get_le(p, 4);
+    h->min_free = task_prof_get_le(p, 4);
+    h->largest  = task_prof_get_le(p, 4);
+  }
+  s.count = *p++;
+  if (s.count > TASK_PROF_MAX_TASKS) {
+    return false;
+  }
+  for (uint8_t i = 0; i < s.count; ++i) {
+    TaskProfTask &t = s.task[i];
+    if (end - p < TASK_PROF_TASK_HDR) {
+      return false;
+    }
+    t.cpu_permille   = (uint16_t)task_prof_get_le(p, 2);
+    t.core           = *p++;
+    t.prio           = *p++;
+    t.stack_size     = task_prof_get_le(p, 2);
+    t.stack_free_min = task_prof_get_le(p, 2);
+    const size_t n   = *p++;
+    if (n >= TASK_PROF_NAME_LEN || (size_t)(end - p) < n) {
+      return false;
+    }
+    memcpy(t.name, p, n);
+    t.name[n] = '\0';
+    p += n;
+  }
+  return p == end;
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ----------------------------------------------------
+// Timer wheel a un livello (hashed timing wheel)
+// ----------------------------------------------------
+// SLOTS caselle da TICK_US ciascuna; un timer con scadenza al tick t sta
+// nella casella t % SLOTS, in una lista doppiamente collegata intrusiva
+// (TimerNode dentro l'oggetto da sorvegliare, niente allocazioni).
+//
+// - schedule()/cancel() sono O(1)
+// - advance() visita solo le caselle dei tick trascorsi e scatta tutti i
+//   timer che trova: le scadenze sono limitate a meno di un giro di ruota
+//   (SLOTS - 1 tick), quindi ogni nodo in una casella visitata è scaduto e
+//   il costo per tick è O(scaduti), senza giri a vuoto sui timer ancora vivi
+// - una scadenza oltre il giro viene anticipata all'ultimo tick utile:
+//   chi usa la ruota deve dimensionare SLOTS * TICK_US sul timeout massimo
+//
+// Un solo task usa la ruota (nessuna sincronizzazione interna).
+
+struct TimerNode
+{
+  TimerNode *prev     = nullptr;
+  TimerNode *next     = nullptr;
+  uint64_t   deadline = 0;   // tick di scadenza (valido se linked())
+
+  bool linked() const { return prev != nullptr; }
+};
+
+template <size_t SLOTS, uint32_t TICK_US>
+class TimerWheel
+{
+  static_assert(SLOTS >= 2 && (SLOTS & (SLOTS - 1)) == 0,
+                "TimerWheel: SLOTS deve essere una potenza di 2");
+  static_assert(TICK_US > 0, "TimerWheel: TICK_US deve essere > 0");
+
+public:
+  // Durata massima di una scadenza senza anticipo
+  static constexpr uint64_t SPAN_US = (uint64_t)(SLOTS - 1) * TICK_US;
+
+  TimerWheel()
+  {
+    for (TimerNode &head : slots_) {
+      head.prev = head.next = &head;
+    }
+  }
+
+  // Fissa il tempo iniziale (prima di qualsiasi schedule)
+  void start(uint64_t now_us)
+  {
+    now_tick_ = now_us / TICK_US;
+  }
+
+  // (Ri)programma node a scadere a deadline_us. Scadenze già passate
+  // scattano al prossimo advance().
+  void schedule(TimerNode &node, uint64_t deadline_us)
+  {
+    cancel(node);
+
+    uint64_t tick = (deadline_us + TICK_US - 1) / TICK_US;
+    if (tick <= now_tick_) {
+      tick = now_tick_ + 1;
+    } else if (tick > now_tick_ + SLOTS - 1) {
+      tick = now_tick_ + SLOTS - 1;   // mai nella casella in corso di svuotamento
+    }
+    node.deadline = tick;
+
+    TimerNode &head = slots_[tick & (SLOTS - 1)];
+    node.prev       = head.prev;
+    node.next       = &head;
+    head.prev->next = &node;
+    head.prev       = &node;
+  }
+
+  void cancel(TimerNode &node)
+  {
+    if (!node.linked()) {
+      return;
+    }
+    node.prev->next = node.next;
+    node.next->prev = node.prev;
+    node.prev = node.next = nullptr;
+  }
+
+  // Porta la ruota a now_us e chiama on_expire(TimerNode&) per ogni timer
+  // scaduto, in ordine di tick. on_expire può riprogrammare il nodo (finisce
+  // in un tick futuro). Ritorna il numero di timer scattati.
+  template <typename F>
+  size_t advance(uint64_t now_us, F &&on_expire)
+  {
+    const uint64_t target = now_us / TICK_US;
+    if (target <= now_tick_) {
+      return 0;
+    }
+
+    // Dopo un'assenza più lunga di un giro basta visitare ogni casella una volta
+    uint64_t tick = (target - now_tick_ > SLOTS) ? target - SLOTS : now_tick_;
+    size_t fired = 0;
+
+    while (tick < target) {
+      now_tick_ = ++tick;
+      TimerNode &head = slots_[tick & (SLOTS - 1)];
+      while (head.next != &head) {
+        TimerNode &node = *head.next;
+        cancel(node);
+        fired++;
+        on_expire(node);
+      }
+    }
+    now_tick_ = target;
+    return fired;
+  }
+
+  uint64_t now_tick() const { return now_tick_; }
+
+private:
+  TimerNode slots_[SLOTS];   // teste delle liste circolari
+  uint64_t  now_tick_ = 0;
+};
@@ -0,0 +1,242 @@
+#include "ui_cmd.h"
+
+#include <atomic>
+
+#include "mpsc_ring.h"
+
+static_assert((UI_CMD_QUEUE_LEN & (UI_CMD_QUEUE_LEN - 1)) == 0,
+              "UI_CMD_QUEUE_LEN deve essere una potenza di 2");
+static_assert(UI_W_COUNT <= 255, "UiWidget: il widget è a 8 bit");
+static_assert(2 + UI_COLOR_COUNT <= 8, "UiColorProp: una chiave per bit in un byte");
+
+// ----------------------------------------------------
+// Coda e widget
+// ----------------------------------------------------
+
+static MpscRing<UiCmd, UI_CMD_QUEUE_LEN> s_queue;
+static std::atomic<TaskHandle_t>         s_notify{nullptr};
+static std::atomic<uint32_t>             s_posted{0};
+static std::atomic<uint32_t>             s_bad_widget{0};
+
+// Solo dal task UI
+static lv_obj_t  *s_obj[UI_W_COUNT];
+static UiCmd      s_batch[UI_CMD_QUEUE_LEN];
+static UiCmdStats s_stats;
+
+// Chiave di coalescenza: un bit per tipo di comando su un widget. Valore e
+// testo sono lo stesso contenuto (l'ultimo dei due vince).
+static uint8_t cmd_key(const UiCmd &c)
+{
+  switch (c.op) {
+    case UI_CMD_SET_VALUE:
+    case UI_CMD_SET_TEXT:
+      return 1U << 0;
+    case UI_CMD_SET_VISIBLE:
+      return 1U << 1;
+    default:
+      return (uint8_t)(1U << (2 + c.prop));
+  }
+}
+
+// ----------------------------------------------------
+// Produttori
+// ----------------------------------------------------
+
+bool ui_cmd_post(const UiCmd &cmd)
+{
+  if (cmd.widget >= UI_W_COUNT ||
+      (cmd.op == UI_CMD_SET_COLOR && cmd.prop >= UI_COLOR_COUNT)) {
+    s_bad_widget.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  if (!s_queue.push(cmd)) {
+    return false;
+  }
+  s_posted.fetch_add(1, std::memory_order_relaxed);
+
+  TaskHandle_t task = s_notify.load(std::memory_order_acquire);
+  if (task) {
+    xTaskNotifyGive(task);
+  }
+  return true;
+}
+
+bool ui_cmd_set_value(UiWidget w, int32_t value)
+{
+  UiCmd c = {};
+  c.widget = w;
+  c.op     = UI_CMD_SET_VALUE;
+  c.value  = value;
+  return ui_cmd_post(c);
+}
+
+bool ui_cmd_set_text(UiWidget w, const char *text)
+{
+  UiCmd c = {};
+  c.widget = w;
+  c.op     = UI_CMD_SET_TEXT;
+  strncpy(c.text, text ? text : "", UI_CMD_TEXT_MAX - 1);
+  return ui_cmd_post(c);
+}
+
+bool ui_cmd_set_visible(UiWidget w, bool visible)
+{
+  UiCmd c = {};
+  c.widget = w;
+  c.op     = UI_CMD_SET_VISIBLE;
+  c.flag   = visible ? 1 : 0;
+  return ui_cmd_post(c);
+}
+
+bool ui_cmd_set_color(UiWidget w, UiColorProp prop, uint32_t rgb)
+{
+  UiCmd c = {};
+  c.widget = w;
+  c.op     = UI_CMD_SET_COLOR;
+  c.prop   = prop;
+  c.rgb    = rgb;
+  return ui_cmd_post(c);
+}
+
+// ----------------------------------------------------
+// Task UI
+// ----------------------------------------------------
+
+// Come set_label_text di ui_main: ogni set invalida, anche a testo uguale
+static void label_set(lv_obj_t *label, const char *text)
+{
+  if (strcmp(lv_label_get_text(label), text) != 0) {
+    lv_label_set_text(label, text);
+  }
+}
+
+static void apply(lv_obj_t *obj, const UiCmd &c)
+{
+  switch (c.op) {
+    case UI_CMD_SET_VALUE:
+      if (lv_obj_check_type(obj, &lv_label_class)) {
+        char buf[12];
+        snprintf(buf, sizeof(buf), "%ld", (long)c.value);
+        label_set(obj, buf);
+      } else if (lv_obj_check_type(obj, &lv_arc_class)) {
+        if (lv_arc_get_value(obj) != c.value) {
+          lv_arc_set_value(obj, (int16_t)c.value);
+        }
+      } else if (lv_obj_has_class(obj, &lv_bar_class)) {   // anche lo slider
+        if (lv_bar_get_value(obj) != c.value) {
+          lv_bar_set_value(obj, c.value, LV_ANIM_OFF);
+        }
+      }
+      break;
+
+    case UI_CMD_SET_TEXT:
+      if (lv_obj_check_type(obj, &lv_label_class)) {
+        char buf[UI_CMD_TEXT_MAX];
+        memcpy(buf, c.text, sizeof(buf));
+        buf[UI_CMD_TEXT_MAX - 1] = '\0';
+        label_set(obj, buf);
+      }
+      break;
+
+    case UI_CMD_SET_VISIBLE:
+      if (lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN) == (c.flag != 0)) {
+        if (c.flag) {
+          lv_obj_clear_flag(obj, LV_OBJ_FLAG_HIDDEN);
+        } else {
+          lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+        }
+      }
+      break;
+
+    case UI_CMD_SET_COLOR: {
+      // set_style invalida sempre: solo se il colore cambia davvero
+      const lv_color_t col = lv_color_hex(c.rgb);
+      if (c.prop == UI_COLOR_BG) {
+        if (lv_obj_get_style_bg_color(obj, LV_PART_MAIN).full != col.full) {
+          lv_obj_set_style_bg_color(obj, col, LV_PART_MAIN);
+        }
+      } else if (c.prop == UI_COLOR_TEXT) {
+        if (lv_obj_get_style_text_color(obj, LV_PART_MAIN).full != col.full) {
+          lv_obj_set_style_text_color(obj, col, LV_PART_MAIN);
+        }
+      } else if (lv_obj_get_style_arc_color(obj, LV_PART_INDICATOR).full != col.full) {
+        lv_obj_set_style_arc_color(obj, col, LV_PART_INDICATOR);
+      }
+      break;
+    }
+
+    default:
+      break;
+  }
+}
+
+void ui_cmd_bind(UiWidget w, lv_obj_t *obj)
+{
+  if (w < UI_W_COUNT) {
+    s_obj[w] = obj;
+  }
+}
+
+void ui_cmd_set_notify(TaskHandle_t task)
+{
+  s_notify.store(task, std::memory_order_release);
+}
+
+size_t ui_cmd_drain()
+{
+  const size_t n = s_queue.pop_n(s_batch, UI_CMD_QUEUE_LEN);
+  if (n == 0) {
+    return 0;
+  }
+  if (n > s_stats.max_batch) {
+    s_stats.max_batch = (uint32_t)n;
+  }
+
+  // Dal più recente: il primo comando visto per (widget, tipo) è quello da
+  // applicare, i più vecchi sono superati (op = 0xFF)
+  uint8_t seen[UI_W_COUNT] = {};
+  for (size_t i = n; i-- > 0;) {
+    UiCmd        &c   = s_batch[i];
+    const uint8_t key = cmd_key(c);
+    if (seen[c.widget] & key) {
+      c.op = 0xFF;
+      s_stats.coalesced++;
+    } else {
+      seen[c.widget] |= key;
+    }
+  }
+
+  // Nell'ordine di arrivo
+  for (size_t i = 0; i < n; ++i) {
+    const UiCmd &c = s_batch[i];
+    if (c.op == 0xFF) {
+      continue;
+    }
+    lv_obj_t *obj = s_obj[c.widget];
+    if (!obj) {
+      s_stats.unbound++;
+      continue;
+    }
+    apply(obj, c);
+    s_stats.applied++;
+  }
+  return n;
+}
+
+UiCmdStats ui_cmd_get_stats()
+{
+  UiCmdStats s = s_stats;
+  s.posted  = s_posted.load(std::memory_order_relaxed);
+  s.dropped = s_queue.overflow_count() + s_bad_widget.load(std::memory_order_relaxed);
+  return s;
+}
+
+void ui_cmd_dump(Print &out)
+{
+  const UiCmdStats s = ui_cmd_get_stats();
+  out.printf("[ui_cmd] accodati %lu, scartati %lu, applicati %lu, superati %lu, "
+             "senza widget %lu, max %lu per giro (coda da %u)\n",
+             (unsigned long)s.posted, (unsigned long)s.dropped, (unsigned long)s.applied,
+             (unsigned long)s.coalesced, (unsigned long)s.unbound,
+             (unsigned long)s.max_batch, (unsigned)UI_CMD_QUEUE_LEN);
+}
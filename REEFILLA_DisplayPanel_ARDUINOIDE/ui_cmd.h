@@ -0,0 +1,103 @@
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "ui_main.h"   // UiWidget
+
+// ----------------------------------------------------
+// Comandi UI da qualsiasi task (coda MPSC verso il task LVGL)
+// ----------------------------------------------------
+// LVGL non è thread-safe: gli altri task (RX CAN, log, allarmi...) non
+// toccano mai i widget, ma accodano comandi tipizzati (valore, testo,
+// visibilità, colore) in una coda limitata lock-free (mpsc_ring.h). Niente
+// lock LVGL e niente allocazioni: lv_async_call creerebbe un lv_timer per
+// ogni chiamata.
+//
+// Il task UI svuota la coda una volta per giro, prima di
+// lv_timer_handler(), e applica solo l'ultimo comando di ogni tipo per
+// ogni widget: 50 valori arrivati tra due frame costano un solo
+// lv_label_set_text. L'ordine tra tipi diversi e tra widget diversi resta
+// quello di arrivo.
+//
+// I comandi si sommano a ui_main_update(), che scrive gli stessi widget
+// dallo snapshot: vince l'ultimo che scrive. Pensati per widget che non
+// dipendono dallo snapshot o per forzature temporanee (allarmi).
+//
+// Coda piena: il comando viene scartato e contato (ui_cmd_dump, comando
+// 'u' sulla console insieme alle statistiche del task UI).
+
+// Comandi in coda (potenza di 2): un frame a 30 ms di margine anche con
+// qualche produttore a 1 kHz
+#ifndef UI_CMD_QUEUE_LEN
+#define UI_CMD_QUEUE_LEN  128
+#endif
+
+// Testo massimo di UI_CMD_SET_TEXT (terminatore compreso, il resto si tronca)
+#ifndef UI_CMD_TEXT_MAX
+#define UI_CMD_TEXT_MAX  24
+#endif
+
+enum UiCmdOp : uint8_t
+{
+  UI_CMD_SET_VALUE,   // arco/barra/slider: valore; label: numero come testo
+  UI_CMD_SET_TEXT,    // label
+  UI_CMD_SET_VISIBLE, // LV_OBJ_FLAG_HIDDEN
+  UI_CMD_SET_COLOR,   // colore di uno stile (UiColorProp)
+};
+
+enum UiColorProp : uint8_t
+{
+  UI_COLOR_BG,        // sfondo (LV_PART_MAIN)
+  UI_COLOR_TEXT,      // testo (LV_PART_MAIN)
+  UI_COLOR_ARC,       // arco dell'indicatore (LV_PART_INDICATOR)
+  UI_COLOR_COUNT
+};
+
+struct UiCmd
+{
+  uint8_t widget;   // UiWidget
+  uint8_t op;       // UiCmdOp
+  uint8_t prop;     // UiColorProp (UI_CMD_SET_COLOR)
+  uint8_t flag;     // visibile (UI_CMD_SET_VISIBLE)
+  union {
+    int32_t  value;
+    uint32_t rgb;   // 0xRRGGBB
+    char     text[UI_CMD_TEXT_MAX];
+  };
+};
+
+struct UiCmdStats
+{
+  uint32_t posted;      // accodati
+  uint32_t dropped;     // coda piena o widget fuori range
+  uint32_t applied;     // applicati ai widget
+  uint32_t coalesced;   // superati da un comando più recente dello stesso tipo
+  uint32_t unbound;     // per widget non collegati
+  uint32_t max_batch;   // massimo di comandi in un giro
+};
+
+// ---------------- produttori (qualsiasi task, non da ISR) ----------------
+
+bool ui_cmd_post(const UiCmd &cmd);
+bool ui_cmd_set_value(UiWidget w, int32_t value);
+bool ui_cmd_set_text(UiWidget w, const char *text);
+bool ui_cmd_set_visible(UiWidget w, bool visible);
+bool ui_cmd_set_color(UiWidget w, UiColorProp prop, uint32_t rgb);
+
+// ---------------- task UI ----------------
+
+// Collega un widget a un oggetto LVGL (in ui_main_init)
+void ui_cmd_bind(UiWidget w, lv_obj_t *obj);
+
+// Task da svegliare a ogni comando accodato (ui_task_start)
+void ui_cmd_set_notify(TaskHandle_t task);
+
+// Svuota la coda (al massimo UI_CMD_QUEUE_LEN comandi) e applica l'ultimo
+// comando di ogni tipo per widget. Ritorna i comandi estratti.
+size_t ui_cmd_drain();
+
+UiCmdStats ui_cmd_get_stats();
+
+void ui_cmd_dump(Print &out);
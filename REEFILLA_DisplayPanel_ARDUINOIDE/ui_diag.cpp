@@ -0,0 +1,166 @@
+#include "ui_diag.h"
+#include "dbc_stats.h"
+#include "product.h"
+
+#include "esp_timer.h"
+
+#include <math.h>
+#include <string.h>
+
+// ----------------------------------------------------
+// Pagina diagnostica
+// ----------------------------------------------------
+
+#define DIAG_TABLE_W     470
+#define DIAG_TABLE_H     330
+#define DIAG_NAME_COL_W  120
+
+static const char *const COL_TITLE[] = { "Segnale", "media", "sd", "min", "max", "p50", "p95", "p99" };
+static constexpr uint16_t COLS = sizeof(COL_TITLE) / sizeof(COL_TITLE[0]);
+
+static const char *SCOPE_MAP[] = { "Dall'avvio", "Finestra", "" };
+
+static lv_obj_t      *s_table        = nullptr;
+static lv_obj_t      *s_label_window = nullptr;
+static DbcStatsScope  s_scope        = DbcStatsScope::BOOT;
+
+// Valori compatti: la colonna è stretta
+static void format_value(char *buf, size_t len, float v)
+{
+  if (fabsf(v) >= 100.0f) {
+    snprintf(buf, len, "%.0f", v);
+  } else {
+    snprintf(buf, len, "%.1f", v);
+  }
+}
+
+static void set_cell(uint16_t row, uint16_t col, const char *text)
+{
+  const char *old = lv_table_get_cell_value(s_table, row, col);
+  if (!old || strcmp(old, text) != 0) {
+    lv_table_set_cell_value(s_table, row, col, text);
+  }
+}
+
+static void scope_event_cb(lv_event_t *e)
+{
+  lv_obj_t *btns = lv_event_get_target(e);
+  s_scope = lv_btnmatrix_get_selected_btn(btns) == 1 ? DbcStatsScope::WINDOW : DbcStatsScope::BOOT;
+  ui_diag_update();
+}
+
+static void reset_event_cb(lv_event_t *e)
+{
+  (void)e;
+  dbc_stats_reset_window();
+  ui_diag_update();
+}
+
+static void diag_create_page(lv_obj_t *page)
+{
+  lv_obj_t *title = lv_label_create(page);
+  lv_label_set_text(title, "DIAGNOSTICA");
+  lv_obj_set_style_text_font(title, &lv_font_montserrat_28, 0);
+  lv_obj_set_style_text_color(title, lv_color_white(), 0);
+  lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 12);
+
+  s_table = lv_table_create(page);
+  lv_obj_set_size(s_table, DIAG_TABLE_W, DIAG_TABLE_H);
+  lv_obj_align(s_table, LV_ALIGN_TOP_MID, 0, 56);
+  lv_obj_set_scroll_dir(s_table, LV_DIR_VER);
+  lv_obj_set_style_pad_all(s_table, 0, 0);
+  lv_obj_set_style_pad_all(s_table, 3, LV_PART_ITEMS);
+  lv_obj_set_style_text_align(s_table, LV_TEXT_ALIGN_RIGHT, LV_PART_ITEMS);
+
+  lv_table_set_col_cnt(s_table, COLS);
+  lv_table_set_row_cnt(s_table, 1 + DBC_CHG_DECODED);
+  lv_table_set_col_width(s_table, 0, DIAG_NAME_COL_W);
+  for (uint16_t c = 1; c < COLS; ++c) {
+    lv_table_set_col_width(s_table, c, (DIAG_TABLE_W - DIAG_NAME_COL_W) / (COLS - 1));
+  }
+  for (uint16_t c = 0; c < COLS; ++c) {
+    lv_table_set_cell_value(s_table, 0, c, COL_TITLE[c]);
+  }
+  for (uint16_t r = 1; r <= DBC_CHG_DECODED; ++r) {
+    for (uint16_t c = 0; c < COLS; ++c) {
+      lv_table_set_cell_value(s_table, r, c, "--");
+    }
+  }
+
+  // Dall'avvio / finestra
+  lv_obj_t *btns = lv_btnmatrix_create(page);
+  lv_btnmatrix_set_map(btns, SCOPE_MAP);
+  lv_btnmatrix_set_btn_ctrl_all(btns, LV_BTNMATRIX_CTRL_CHECKABLE);
+  lv_btnmatrix_set_one_checked(btns, true);
+  lv_btnmatrix_set_btn_ctrl(btns, 0, LV_BTNMATRIX_CTRL_CHECKED);
+  lv_obj_set_size(btns, 300, 56);
+  lv_obj_align(btns, LV_ALIGN_BOTTOM_LEFT, 5, -10);
+  lv_obj_add_event_cb(btns, scope_event_cb, LV_EVENT_VALUE_CHANGED, nullptr);
+
+  lv_obj_t *reset = lv_btn_create(page);
+  lv_obj_set_size(reset, 160, 56);
+  lv_obj_align(reset, LV_ALIGN_BOTTOM_RIGHT, -5, -10);
+  lv_obj_add_event_cb(reset, reset_event_cb, LV_EVENT_CLICKED, nullptr);
+  lv_obj_t *reset_label = lv_label_create(reset);
+  lv_label_set_text(reset_label, "Azzera finestra");
+  lv_obj_center(reset_label);
+
+  s_label_window = lv_label_create(page);
+  lv_label_set_text(s_label_window, "");
+  lv_obj_set_style_text_color(s_label_window, lv_color_white(), 0);
+  lv_obj_align_to(s_label_window, s_table, LV_ALIGN_OUT_BOTTOM_RIGHT, 0, 4);
+}
+
+// ----------------------------------------------------
+// API
+// ----------------------------------------------------
+
+void ui_diag_init(lv_obj_t *page)
+{
+  if constexpr (!ThisProduct::DIAG_PAGE) {
+    return;   // la tabella e i suoi callback restano fuori dal binario
+  }
+  if (page) {
+    diag_create_page(page);
+  }
+}
+
+void ui_diag_update()
+{
+  if (!s_table || !lv_obj_is_visible(s_table)) {
+    return;
+  }
+
+  char buf[48];
+  const uint64_t window_s =
+      ((uint64_t)esp_timer_get_time() - dbc_stats_window_start_us()) / 1000000ULL;
+  snprintf(buf, sizeof(buf), "finestra: %lu min %02lu s",
+           (unsigned long)(window_s / 60), (unsigned long)(window_s % 60));
+  if (strcmp(lv_label_get_text(s_label_window), buf) != 0) {
+    lv_label_set_text(s_label_window, buf);
+  }
+
+  for (uint8_t i = 0; i < DBC_CHG_DECODED; ++i) {
+    const DbcChange sig = static_cast<DbcChange>(i);
+    const uint16_t row = 1 + i;
+    const char *name = dbc_stats_name(sig);
+    if (!name) {
+      continue;   // nessun frame ancora
+    }
+
+    DbcSignalStats s;
+    const bool any = dbc_stats_get(sig, s_scope, s);
+    snprintf(buf, sizeof(buf), "%s\nn=%lu", name, (unsigned long)s.n);
+    set_cell(row, 0, buf);
+
+    const float v[COLS - 1] = { s.mean, sqrtf(s.variance), s.min, s.max, s.p50, s.p95, s.p99 };
+    for (uint16_t c = 1; c < COLS; ++c) {
+      if (any) {
+        format_value(buf, sizeof(buf), v[c - 1]);
+        set_cell(row, c, buf);
+      } else {
+        set_cell(row, c, "--");
+      }
+    }
+  }
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+// ----------------------------------------------------
+// Pagina diagnostica: statistiche online dei segnali (dbc_stats.h)
+// ----------------------------------------------------
+// Una riga per segnale decodificato con media, deviazione standard,
+// min/max e p50/p95/p99, dall'avvio o nella finestra azzerabile dal
+// pulsante della pagina (o da console, dbc_stats_reset_window()).
+//
+// Tutto dal task UI (ui_task.h).
+
+// Crea la pagina dentro page (nullptr = nessuna pagina, solo console)
+void ui_diag_init(lv_obj_t *page);
+
+// Ridisegna la tabella (solo se la pagina è visibile)
+void ui_diag_update();
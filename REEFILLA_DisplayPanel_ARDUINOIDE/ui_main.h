@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdint.h>
+
+// Inizializza la UI principale (schermata iniziale)
+void ui_main_init();
+
+// Aggiorna la UI con i dati correnti del DBC (da chiamare periodicamente)
+void ui_main_update();
+
+// Widget raggiungibili da altri task con i comandi di ui_cmd.h. Ogni
+// prodotto collega in ui_main_init() quelli che ha (ui_cmd_bind); i
+// comandi per un widget non collegato vengono scartati.
+enum UiWidget : uint8_t
+{
+  UI_W_SOC_VALUE,    // valore SOC (label)
+  UI_W_SOC_GAUGE,    // SOC grafico (arco o barra)
+  UI_W_STATE,        // stato / modalità della macchina
+  UI_W_TIME,         // tempo rimanente
+  UI_W_WARN_ICON,    // icona di avviso
+  UI_W_STOP_ICON,    // icona di arresto
+  UI_W_LINE_0,       // valori delle righe/card secondarie
+  UI_W_LINE_1,
+  UI_W_LINE_2,
+  UI_W_COUNT
+};
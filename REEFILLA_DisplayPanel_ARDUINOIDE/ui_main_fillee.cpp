@@ -1,10 +1,16 @@
+#include "product.h"
+#if REEFILLA_PRODUCT == REEFILLA_PRODUCT_FILLEE
+
 #include <lvgl.h>
 #include <Arduino.h>
-#include <ctype.h>
 #include <string.h>
 
 #include "ui_main.h"
-#include "dbc_decoder.h"   // per dbc_get_state()
+#include "dbc_decoder.h"   // per dbc_snapshot()
+#include "dbc_generated.h" // stringhe delle tabelle VAL_
+#include "ui_trend.h"
+#include "ui_diag.h"
+#include "ui_cmd.h"
 
 // -----------------------
 // Oggetti LVGL
@@ -34,164 +40,161 @@ static lv_obj_t *label_line_unit[3]  = { nullptr, nullptr, nullptr };
 static constexpr int32_t DATA_UNAVAILABLE = -11;
 static const char *UNAVAILABLE_TEXT = "-11";
 
-// ----------------------------------------------------
-// Helper: stringa stato principale
-// ----------------------------------------------------
-static const char *state_to_str(int16_t state)
+// Cambia il testo solo se diverso: ogni lv_label_set_text invalida l'area
+// della label e la fa ridisegnare anche a testo identico
+static void set_label_text(lv_obj_t *label, const char *text)
 {
-  switch (state)
-  {
-    case 0: return "TURN ON";
-    case 1: return "WAKE BMS";
-    case 2: return "RECOVERY";
-    case 3: return "RUN CHARGE";
-    case 4: return "RUN DISCH";
-    case 5: return "RUN STBY";
-    case 6: return "ERROR";
-    default: return "UNKNOWN";
+  if (label && strcmp(lv_label_get_text(label), text) != 0) {
+    lv_label_set_text(label, text);
   }
 }
 
 // ----------------------------------------------------
 // FUNZIONE PUBBLICA: aggiorna la UI dai dati DBC
 // ----------------------------------------------------
+// Solo i widget legati a segnali cambiati dall'aggiornamento precedente
+// vengono toccati (dbc_changed_since); il primo giro li aggiorna tutti.
 void ui_main_update()
 {
-  const DbcState &s = dbc_get_state();
-  const bool status_valid  = s.status_lastUpdate_ms  != 0;
-  const bool status2_valid = s.status2_lastUpdate_ms != 0;
+  static uint32_t seen_version = 0;
+
+  // Pagine trend e diagnostica: cambiano con il tempo anche senza frame nuovi
+  ui_trend_update();
+  ui_diag_update();
+
+  DbcState s;
+  const uint32_t version = dbc_snapshot(s);
+  const uint32_t changed = dbc_changed_since(s, seen_version);
+  seen_version = version;
+  if (!changed) {
+    return;
+  }
 
   // ---------- SOC centrale ----------
-  auto clamp_soc = [](int16_t value) -> uint8_t {
-    if (value < 0) return 0;
-    if (value > 100) return 100;
-    return static_cast<uint8_t>(value);
-  };
-
-  // Usa sempre SOC_ACTIVE come valore principale.
-  const bool soc_active_valid = status_valid && s.soc_active_percent >= 0;
-  const bool soc_valid = soc_active_valid;
-
-  uint8_t soc = 0;
-  if (soc_active_valid) {
-    soc = clamp_soc(s.soc_active_percent);
-  }
+  if (changed & dbc_chg(DBC_CHG_SOC_ACTIVE)) {
+    auto clamp_soc = [](int16_t value) -> uint8_t {
+      if (value < 0) return 0;
+      if (value > 100) return 100;
+      return static_cast<uint8_t>(value);
+    };
+
+    // Usa sempre SOC_ACTIVE come valore principale.
+    // Non valido = mai ricevuto o messaggio in timeout (dbc_supervise.h)
+    const bool soc_active_valid = dbc_valid(s, DBC_CHG_SOC_ACTIVE) && s.soc_active_percent >= 0;
+    const bool soc_valid = soc_active_valid;
+
+    uint8_t soc = 0;
+    if (soc_active_valid) {
+      soc = clamp_soc(s.soc_active_percent);
+    }
 
-  lv_color_t accent_col;
-  if (!soc_valid) {
-    accent_col = lv_palette_main(LV_PALETTE_BLUE);
-  } else if (soc < 10) {
-    accent_col = lv_palette_main(LV_PALETTE_RED);
-  } else if (soc < 40) {
-    accent_col = lv_palette_main(LV_PALETTE_YELLOW);
-  } else {
-    accent_col = lv_palette_main(LV_PALETTE_BLUE);
-  }
+    lv_color_t accent_col;
+    if (!soc_valid) {
+      accent_col = lv_palette_main(LV_PALETTE_BLUE);
+    } else if (soc < 10) {
+      accent_col = lv_palette_main(LV_PALETTE_RED);
+    } else if (soc < 40) {
+      accent_col = lv_palette_main(LV_PALETTE_YELLOW);
+    } else {
+      accent_col = lv_palette_main(LV_PALETTE_BLUE);
+    }
 
-  if (soc_arc_fg) {
-    lv_arc_set_value(soc_arc_fg, soc);
-    lv_obj_set_style_arc_color(soc_arc_fg, accent_col, LV_PART_INDICATOR);
-  }
+    if (soc_arc_fg) {
+      lv_arc_set_value(soc_arc_fg, soc);
+      // set_style invalida sempre: solo se il colore cambia davvero
+      if (lv_obj_get_style_arc_color(soc_arc_fg, LV_PART_INDICATOR).full != accent_col.full) {
+        lv_obj_set_style_arc_color(soc_arc_fg, accent_col, LV_PART_INDICATOR);
+      }
+    }
 
-  if (label_soc_value) {
     if (!soc_valid) {
-      lv_label_set_text(label_soc_value, UNAVAILABLE_TEXT);
+      set_label_text(label_soc_value, UNAVAILABLE_TEXT);
     } else {
       char buf[16];
       snprintf(buf, sizeof(buf), "%u", static_cast<unsigned>(soc));
-      lv_label_set_text(label_soc_value, buf);
+      set_label_text(label_soc_value, buf);
     }
   }
 
-  if (label_soc_percent) {
-    lv_label_set_text(label_soc_percent, "%");
-  }
-
-  if (label_soc_state) {
-    if (!status_valid || s.main_state < 0) {
-      lv_label_set_text(label_soc_state, UNAVAILABLE_TEXT);
-    } else {
-      const char *mode = state_to_str(s.main_state);
-      char buf[32];
-      size_t len = strlen(mode);
-      if (len >= sizeof(buf)) len = sizeof(buf) - 1;
-      for (size_t i = 0; i < len; ++i) {
-        buf[i] = toupper((unsigned char)mode[i]);
+  // ---------- Stato e icone ----------
+  const bool state_valid = dbc_valid(s, DBC_CHG_MAIN_STATE);
+
+  if (changed & dbc_chg(DBC_CHG_MAIN_STATE)) {
+    if (!state_valid || s.main_state < 0) {
+      set_label_text(label_soc_state, UNAVAILABLE_TEXT);
+    } else if (label_soc_state) {
+      // Stringhe della tabella VAL_ già maiuscole e statiche: niente copia
+      const char *mode = dbc_str_vcu_display_status_main_state_machine_state(s.main_state);
+      if (!mode) {
+        mode = "UNKNOWN";
+      }
+      if (lv_label_get_text(label_soc_state) != mode) {
+        lv_label_set_text_static(label_soc_state, mode);
       }
-      buf[len] = '\0';
-      lv_label_set_text(label_soc_state, buf);
     }
-  }
 
-  auto set_icon_visible = [](lv_obj_t *obj, bool visible) {
-    if (!obj) return;
-    if (visible) {
-      lv_obj_clear_flag(obj, LV_OBJ_FLAG_HIDDEN);
-    } else {
-      lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
-    }
-  };
+    auto set_icon_visible = [](lv_obj_t *obj, bool visible) {
+      if (!obj) return;
+      if (visible) {
+        lv_obj_clear_flag(obj, LV_OBJ_FLAG_HIDDEN);
+      } else {
+        lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+      }
+    };
 
-  const bool warn_visible = status_valid && (s.main_state == 2);
-  const bool stop_visible = status_valid && (s.main_state == 6);
+    const bool warn_visible = state_valid && (s.main_state == 2);
+    const bool stop_visible = state_valid && (s.main_state == 6);
 
-  set_icon_visible(icon_warn, warn_visible);
-  set_icon_visible(icon_stop, stop_visible);
+    set_icon_visible(icon_warn, warn_visible);
+    set_icon_visible(icon_stop, stop_visible);
+  }
 
   // ---------- Tempo rimanente ----------
-  auto pick_time_s = [&]() -> int32_t {
-    if (!status_valid) return DATA_UNAVAILABLE;
+  if (changed & (dbc_chg(DBC_CHG_MAIN_STATE) |
+                 dbc_chg(DBC_CHG_TIME_TO_FULL) |
+                 dbc_chg(DBC_CHG_TIME_TO_EMPTY))) {
+    auto pick_time_s = [&]() -> int32_t {
+      if (!state_valid) return DATA_UNAVAILABLE;
 
-    const bool ttf_valid = s.time_to_full_s >= 0;
-    const bool tte_valid = s.time_to_empty_s >= 0;
+      const bool ttf_valid = dbc_valid(s, DBC_CHG_TIME_TO_FULL) && s.time_to_full_s >= 0;
+      const bool tte_valid = dbc_valid(s, DBC_CHG_TIME_TO_EMPTY) && s.time_to_empty_s >= 0;
 
-    if (s.main_state == 3 && ttf_valid) return s.time_to_full_s;
-    if (s.main_state == 4 && tte_valid) return s.time_to_empty_s;
-    if (tte_valid) return s.time_to_empty_s;
-    if (ttf_valid) return s.time_to_full_s;
-    return DATA_UNAVAILABLE;
-  };
+      if (s.main_state == 3 && ttf_valid) return s.time_to_full_s;
+      if (s.main_state == 4 && tte_valid) return s.time_to_empty_s;
+      if (tte_valid) return s.time_to_empty_s;
+      if (ttf_valid) return s.time_to_full_s;
+      return DATA_UNAVAILABLE;
+    };
 
-  int32_t time_s = pick_time_s();
+    int32_t time_s = pick_time_s();
 
-  if (label_time_value) {
     if (time_s < 0) {
-      lv_label_set_text(label_time_value, UNAVAILABLE_TEXT);
+      set_label_text(label_time_value, UNAVAILABLE_TEXT);
     } else {
       char buf[16];
       uint32_t total_sec = static_cast<uint32_t>(time_s);
       uint32_t minutes = total_sec / 60U;
       uint32_t seconds = total_sec % 60U;
       snprintf(buf, sizeof(buf), "%u%02u", (unsigned)minutes, (unsigned)seconds);
-      lv_label_set_text(label_time_value, buf);
+      set_label_text(label_time_value, buf);
     }
   }
 
-  if (label_time_unit) {
-    lv_label_set_text(label_time_unit, "min");
-  }
-
   // ---------- Linee inferiori (placeholder: valori attuali) ----------
-  auto set_line_value = [&](int idx, bool valid, int32_t value) {
-    if (!label_line_value[idx]) return;
+  // Le unità ("min", "%", "W") sono fisse e impostate in ui_main_init()
+  for (int i = 0; i < 3; ++i) {
+    const DbcChange sig = static_cast<DbcChange>(DBC_CHG_INV_P_AC_0 + i);
+    if (!(changed & dbc_chg(sig))) {
+      continue;
+    }
+    const bool valid = dbc_valid(s, sig) && s.inv_p_ac_w[i] != DATA_UNAVAILABLE;
     if (!valid) {
-      lv_label_set_text(label_line_value[idx], UNAVAILABLE_TEXT);
-      return;
+      set_label_text(label_line_value[i], UNAVAILABLE_TEXT);
+      continue;
     }
     char buf[16];
-    snprintf(buf, sizeof(buf), "%d", value);
-    lv_label_set_text(label_line_value[idx], buf);
-  };
-
-  for (int i = 0; i < 3; ++i) {
-    bool valid = status2_valid && s.inv_p_ac_w[i] != DATA_UNAVAILABLE;
-    set_line_value(i, valid, s.inv_p_ac_w[i]);
-  }
-
-  for (int i = 0; i < 3; ++i) {
-    if (label_line_unit[i]) {
-      lv_label_set_text(label_line_unit[i], "W");
-    }
+    snprintf(buf, sizeof(buf), "%d", (int)s.inv_p_ac_w[i]);
+    set_label_text(label_line_value[i], buf);
   }
 }
 
@@ -237,10 +240,15 @@ void ui_main_init()
   lv_obj_set_style_bg_opa(page_secondary, LV_OPA_TRANSP, 0);
   lv_obj_set_scrollbar_mode(page_secondary, LV_SCROLLBAR_MODE_OFF);
   lv_obj_set_scroll_dir(page_secondary, LV_DIR_NONE);
-  lv_obj_t *page2_label = lv_label_create(page_secondary);
-  lv_label_set_text(page2_label, "COMING SOON");
-  lv_obj_set_style_text_color(page2_label, lv_color_white(), 0);
-  lv_obj_center(page2_label);
+  ui_trend_init(page_secondary);
+
+  lv_obj_t *page_diag = lv_obj_create(pages);
+  lv_obj_remove_style_all(page_diag);
+  lv_obj_set_size(page_diag, lv_pct(100), lv_pct(100));
+  lv_obj_set_style_bg_opa(page_diag, LV_OPA_TRANSP, 0);
+  lv_obj_set_scrollbar_mode(page_diag, LV_SCROLLBAR_MODE_OFF);
+  lv_obj_set_scroll_dir(page_diag, LV_DIR_NONE);
+  ui_diag_init(page_diag);
 
   // --------- Riga superiore: testo tempo, valore, icone ---------
   lv_obj_t *top_row = lv_obj_create(page_main);
@@ -435,5 +443,18 @@ void ui_main_init()
     lv_label_set_text(label_line_unit[i], "W");
   }
 
+  // Widget raggiungibili con i comandi di ui_cmd.h
+  ui_cmd_bind(UI_W_SOC_VALUE, label_soc_value);
+  ui_cmd_bind(UI_W_SOC_GAUGE, soc_arc_fg);
+  ui_cmd_bind(UI_W_STATE, label_soc_state);
+  ui_cmd_bind(UI_W_TIME, label_time_value);
+  ui_cmd_bind(UI_W_WARN_ICON, icon_warn);
+  ui_cmd_bind(UI_W_STOP_ICON, icon_stop);
+  for (int i = 0; i < 3; ++i) {
+    ui_cmd_bind(static_cast<UiWidget>(UI_W_LINE_0 + i), label_line_value[i]);
+  }
+
   Serial.println("[ui_main] UI stile gauge pronta");
 }
+
+#endif // REEFILLA_PRODUCT == REEFILLA_PRODUCT_FILLEE
@@ -1,8 +1,14 @@
+#include "product.h"
+#if REEFILLA_PRODUCT == REEFILLA_PRODUCT_VOLTAB
+
 #include <lvgl.h>
 #include <Arduino.h>
 
 #include "ui_main.h"
-#include "dbc_decoder.h"   // per dbc_get_state()
+#include "dbc_decoder.h"   // per dbc_snapshot()
+#include "dbc_generated.h" // stringhe delle tabelle VAL_
+#include "ui_trend.h"
+#include "ui_cmd.h"
 
 // -----------------------
 // Oggetti LVGL
@@ -36,37 +42,51 @@ static lv_obj_t *label_temp_inv  = nullptr;
 static lv_obj_t *label_p_dc      = nullptr;
 static lv_obj_t *label_p_ac      = nullptr;
 
-// ----------------------------------------------------
-// Helper: stringa modalità MSM
-// ----------------------------------------------------
-static const char *mode_to_str(uint8_t msm_state)
+// Testo al posto dei valori di segnali mai ricevuti o in timeout
+// (come sul pannello fillee)
+static const char *UNAVAILABLE_TEXT = "-11";
+
+// Cambia il testo solo se diverso: ogni lv_label_set_text invalida l'area
+// della label e la fa ridisegnare anche a testo identico
+static void set_label_text(lv_obj_t *label, const char *text)
 {
-  switch (msm_state)
-  {
-    case 0: return "Standby";
-    case 1: return "Charging";
-    case 2: return "Discharging";
-    default: return "Unknown";
+  if (label && strcmp(lv_label_get_text(label), text) != 0) {
+    lv_label_set_text(label, text);
   }
 }
 
 // ----------------------------------------------------
 // FUNZIONE PUBBLICA: aggiorna la UI dai dati DBC
 // ----------------------------------------------------
+// Solo i widget legati a segnali cambiati dall'aggiornamento precedente
+// vengono toccati (dbc_changed_since); il primo giro li aggiorna tutti.
 void ui_main_update()
 {
-  const DbcState &s = dbc_get_state();
+  static uint32_t seen_version = 0;
+
+  DbcState s;
+  const uint32_t version = dbc_snapshot(s);
+  const uint32_t changed = dbc_changed_since(s, seen_version);
+  seen_version = version;
+  if (!changed) {
+    return;
+  }
 
   // ---------- SOC centrale ----------
-  {
-    uint8_t soc = s.soc_percent;
+  if (changed & dbc_chg(DBC_CHG_SOC)) {
+    // Non valido = mai ricevuto o messaggio in timeout (dbc_supervise.h):
+    // barra vuota e colori grigi
+    const bool soc_valid = dbc_valid(s, DBC_CHG_SOC);
+    uint8_t soc = soc_valid ? s.soc_percent : 0;
     if (soc > 100) soc = 100;
 
     if (soc_bar) {
       lv_bar_set_value(soc_bar, soc, LV_ANIM_OFF);
 
       lv_color_t col;
-      if (soc < 10) {
+      if (!soc_valid) {
+        col = lv_palette_main(LV_PALETTE_GREY);
+      } else if (soc < 10) {
         col = lv_palette_main(LV_PALETTE_RED);
       } else if (soc < 40) {
         col = lv_palette_main(LV_PALETTE_YELLOW);
@@ -74,70 +94,108 @@ void ui_main_update()
         col = lv_palette_main(LV_PALETTE_GREEN);
       }
 
-      // colore barra
-      lv_obj_set_style_bg_color(soc_bar, col, LV_PART_INDICATOR);
-
-      // bordo card centrale
-      if (central_card) {
-        lv_obj_set_style_border_color(central_card, col, 0);
-      }
-
-      // colore testi SOC
-      if (label_soc_big) {
-        lv_obj_set_style_text_color(label_soc_big, col, 0);
-      }
-      if (label_soc_title) {
-        lv_obj_set_style_text_color(label_soc_title, col, 0);
+      // set_style invalida sempre: i colori solo quando cambia la fascia
+      if (lv_obj_get_style_bg_color(soc_bar, LV_PART_INDICATOR).full != col.full) {
+        // colore barra
+        lv_obj_set_style_bg_color(soc_bar, col, LV_PART_INDICATOR);
+
+        // bordo card centrale
+        if (central_card) {
+          lv_obj_set_style_border_color(central_card, col, 0);
+        }
+
+        // colore testi SOC
+        if (label_soc_big) {
+          lv_obj_set_style_text_color(label_soc_big, col, 0);
+        }
+        if (label_soc_title) {
+          lv_obj_set_style_text_color(label_soc_title, col, 0);
+        }
       }
     }
 
-    if (label_soc_big) {
-      char buf[32];
+    char buf[32];
+    if (soc_valid) {
       snprintf(buf, sizeof(buf), "%u %%", (unsigned)soc);
-      lv_label_set_text(label_soc_big, buf);
+    } else {
+      snprintf(buf, sizeof(buf), "%s %%", UNAVAILABLE_TEXT);
     }
+    set_label_text(label_soc_big, buf);
   }
 
   // ---------- Top-left: mode + grid ----------
-  {
+  if (changed & dbc_chg(DBC_CHG_MSM_STATE)) {
     char buf[64];
+    const char *mode = dbc_valid(s, DBC_CHG_MSM_STATE)
+                           ? dbc_str_vcu_display_status_msm_debounced_state(s.msm_state)
+                           : UNAVAILABLE_TEXT;
+    snprintf(buf, sizeof(buf), "Mode: %s", mode ? mode : "Unknown");
+    set_label_text(label_mode, buf);
+  }
 
-    snprintf(buf, sizeof(buf), "Mode: %s", mode_to_str(s.msm_state));
-    lv_label_set_text(label_mode, buf);
-
-    float v_grid = s.grid_v_ac_deciv / 10.0f;
-    snprintf(buf, sizeof(buf), "Grid: %.1f V", v_grid);
-    lv_label_set_text(label_v_grid, buf);
+  if (changed & dbc_chg(DBC_CHG_GRID_V_AC)) {
+    char buf[64];
+    if (dbc_valid(s, DBC_CHG_GRID_V_AC)) {
+      float v_grid = s.grid_v_ac_deciv / 10.0f;
+      snprintf(buf, sizeof(buf), "Grid: %.1f V", v_grid);
+    } else {
+      snprintf(buf, sizeof(buf), "Grid: %s V", UNAVAILABLE_TEXT);
+    }
+    set_label_text(label_v_grid, buf);
   }
 
   // ---------- Top-right: remaining time ----------
-  {
+  if (changed & dbc_chg(DBC_CHG_REMAINING_TIME)) {
     char buf[64];
-    float rem_min = s.remaining_time_s / 60.0f;
-    snprintf(buf, sizeof(buf), "Remaining: %.1f min", rem_min);
-    lv_label_set_text(label_rem_time, buf);
+    if (dbc_valid(s, DBC_CHG_REMAINING_TIME)) {
+      float rem_min = s.remaining_time_s / 60.0f;
+      snprintf(buf, sizeof(buf), "Remaining: %.1f min", rem_min);
+    } else {
+      snprintf(buf, sizeof(buf), "Remaining: %s min", UNAVAILABLE_TEXT);
+    }
+    set_label_text(label_rem_time, buf);
   }
 
   // ---------- Bottom-left: temperature ----------
-  {
+  if (changed & dbc_chg(DBC_CHG_MAX_BATT_TEMP)) {
     char buf[64];
+    if (dbc_valid(s, DBC_CHG_MAX_BATT_TEMP)) {
+      snprintf(buf, sizeof(buf), "Batt Temp: %d C", (int)s.max_batt_temp_c);
+    } else {
+      snprintf(buf, sizeof(buf), "Batt Temp: %s C", UNAVAILABLE_TEXT);
+    }
+    set_label_text(label_temp_batt, buf);
+  }
 
-    snprintf(buf, sizeof(buf), "Batt Temp: %d C", (int)s.max_batt_temp_c);
-    lv_label_set_text(label_temp_batt, buf);
-
-    snprintf(buf, sizeof(buf), "Inv Temp:  %d C", (int)s.max_inv_temp_c);
-    lv_label_set_text(label_temp_inv, buf);
+  if (changed & dbc_chg(DBC_CHG_MAX_INV_TEMP)) {
+    char buf[64];
+    if (dbc_valid(s, DBC_CHG_MAX_INV_TEMP)) {
+      snprintf(buf, sizeof(buf), "Inv Temp:  %d C", (int)s.max_inv_temp_c);
+    } else {
+      snprintf(buf, sizeof(buf), "Inv Temp:  %s C", UNAVAILABLE_TEXT);
+    }
+    set_label_text(label_temp_inv, buf);
   }
 
   // ---------- Bottom-right: potenze ----------
-  {
+  if (changed & dbc_chg(DBC_CHG_BMS_P_DC)) {
     char buf[64];
+    if (dbc_valid(s, DBC_CHG_BMS_P_DC)) {
+      snprintf(buf, sizeof(buf), "P_DC: %d W", (int)s.bms_p_dc_w);
+    } else {
+      snprintf(buf, sizeof(buf), "P_DC: %s W", UNAVAILABLE_TEXT);
+    }
+    set_label_text(label_p_dc, buf);
+  }
 
-    snprintf(buf, sizeof(buf), "P_DC: %d W", (int)s.bms_p_dc_w);
-    lv_label_set_text(label_p_dc, buf);
-
-    snprintf(buf, sizeof(buf), "P_AC: %d W", (int)s.inv_p_ac_w);
-    lv_label_set_text(label_p_ac, buf);
+  if (changed & dbc_chg(DBC_CHG_INV_P_AC)) {
+    char buf[64];
+    if (dbc_valid(s, DBC_CHG_INV_P_AC)) {
+      snprintf(buf, sizeof(buf), "P_AC: %d W", (int)s.inv_p_ac_w);
+    } else {
+      snprintf(buf, sizeof(buf), "P_AC: %s W", UNAVAILABLE_TEXT);
+    }
+    set_label_text(label_p_ac, buf);
   }
 }
 
@@ -279,5 +337,19 @@ void ui_main_init()
   lv_label_set_text(label_p_ac, "P_AC: --- W");
   lv_obj_set_style_text_align(label_p_ac, LV_TEXT_ALIGN_CENTER, 0);
 
+  // Storico dei segnali (niente pagina grafici su questo pannello)
+  ui_trend_init(nullptr);
+
+  // Widget raggiungibili con i comandi di ui_cmd.h (niente icone qui)
+  ui_cmd_bind(UI_W_SOC_VALUE, label_soc_big);
+  ui_cmd_bind(UI_W_SOC_GAUGE, soc_bar);
+  ui_cmd_bind(UI_W_STATE, label_mode);
+  ui_cmd_bind(UI_W_TIME, label_rem_time);
+  ui_cmd_bind(UI_W_LINE_0, label_p_dc);
+  ui_cmd_bind(UI_W_LINE_1, label_p_ac);
+  ui_cmd_bind(UI_W_LINE_2, label_temp_batt);
+
   Serial.println("[ui_main] UI card pronta (bordo spesso, SoC grande)");
-}
\ No newline at end of file
+}
+
+#endif // REEFILLA_PRODUCT == REEFILLA_PRODUCT_VOLTAB
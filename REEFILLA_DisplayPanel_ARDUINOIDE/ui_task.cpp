@@ -0,0 +1,338 @@
+#include "ui_task.h"
+
+#include "esp_timer.h"
+
+#include <atomic>
+
+#include "lv_port_lock.h"
+#include "rtrace.h"
+#include "signal_bus.h"
+#include "task_prof.h"
+#include "ui_cmd.h"
+#include "ui_main.h"
+#include "ui_trend.h"
+
+// Clock (µs) del tempo di CPU dei giri. Su host il driver di replay tiene
+// fermo il clock virtuale durante un giro: lì si usa il tempo reale
+// (host_wall_time_us, shim di esp_timer.h).
+#ifndef UI_TASK_BUSY_CLOCK
+#define UI_TASK_BUSY_CLOCK  esp_timer_get_time
+#endif
+
+// ----------------------------------------------------
+// Stato del task
+// ----------------------------------------------------
+
+static TaskHandle_t          s_task        = nullptr;
+static std::atomic<uint32_t> s_requests{0};
+static std::atomic<bool>     s_touch_pending{false};
+
+// Solo dal task UI (s_stats: scritto sotto il lock LVGL)
+static BroadcastCursor s_bus;
+static UiTaskStats     s_stats;
+static lv_timer_t     *s_slow_timer     = nullptr;
+static lv_indev_t     *s_touch          = nullptr;   // indev a interrupt (nullptr = polling)
+static uint32_t        s_last_tick_ms   = 0;
+static uint32_t        s_last_update_ms = 0;
+static uint32_t        s_seen_lost      = 0;
+static bool            s_data_pending   = false;
+static uint64_t        s_pending_since  = 0;         // t_us del primo evento non ancora a schermo
+
+// ----------------------------------------------------
+// Aggiornamento UI
+// ----------------------------------------------------
+
+static void ui_update()
+{
+  ui_main_update();
+  s_stats.updates++;
+  s_last_update_ms = millis();
+  s_data_pending   = false;
+  // Il giro periodico serve solo se per UI_TASK_SLOW_UPDATE_MS non ne passa
+  // uno a eventi
+  if (s_slow_timer) {
+    lv_timer_reset(s_slow_timer);
+  }
+}
+
+static void slow_update_cb(lv_timer_t *t)
+{
+  (void)t;
+  ui_update();
+}
+
+// ----------------------------------------------------
+// Touch a interrupt
+// ----------------------------------------------------
+// Il timer di lettura dell'indev gira solo dall'interrupt al rilascio; lo
+// scroll "a inerzia" dopo il rilascio è gestito dalle letture, quindi il
+// timer resta attivo finché c'è un oggetto in scroll.
+
+static void touch_resume()
+{
+  if (s_touch && s_touch->driver->read_timer) {
+    lv_timer_resume(s_touch->driver->read_timer);
+    lv_timer_ready(s_touch->driver->read_timer);
+  }
+}
+
+static void touch_idle_check()
+{
+  if (!s_touch || !s_touch->driver->read_timer || s_touch_pending.load(std::memory_order_relaxed)) {
+    return;
+  }
+  if (s_touch->proc.state == LV_INDEV_STATE_RELEASED && !s_touch->proc.types.pointer.scroll_obj) {
+    lv_timer_pause(s_touch->driver->read_timer);
+  }
+}
+
+// ----------------------------------------------------
+// Task
+// ----------------------------------------------------
+
+// Chiamata da LVGL alla fine di ogni ridisegno con aree invalidate
+static uint32_t s_refreshes = 0;
+
+static void refr_monitor_cb(lv_disp_drv_t *drv, uint32_t time_ms, uint32_t px)
+{
+  (void)drv; (void)time_ms; (void)px;
+  s_refreshes++;
+}
+
+// Un giro con il lock preso. In dumps le richieste di stampa, da servire
+// dopo aver rilasciato il lock.
+static uint32_t step_locked(uint32_t &dumps)
+{
+  const uint64_t busy0 = (uint64_t)UI_TASK_BUSY_CLOCK();
+  const uint64_t t0    = (uint64_t)esp_timer_get_time();
+  const uint32_t now   = millis();
+  lv_tick_inc(now - s_last_tick_ms);
+  s_last_tick_ms = now;
+  s_stats.steps++;
+
+  const uint32_t req = s_requests.exchange(0, std::memory_order_acquire);
+  dumps = req & (UI_REQ_TREND_DUMP | UI_REQ_STATS_DUMP);
+
+  if (s_touch_pending.exchange(false, std::memory_order_acquire)) {
+    s_stats.touch_irqs++;
+    touch_resume();
+  }
+
+  // Segnali cambiati: gli eventi contano solo come "c'è qualcosa di nuovo",
+  // i valori li prende ui_main_update() dallo snapshot. Anche gli eventi
+  // persi (UI in ritardo) sono dati nuovi.
+  SignalEvent ev[16];
+  size_t      n;
+  while ((n = signal_bus_poll(s_bus, ev, 16)) > 0) {
+    if (!s_data_pending) {
+      s_data_pending  = true;
+      s_pending_since = ev[0].t_us;
+    }
+    s_stats.events += (uint32_t)n;
+  }
+  const uint32_t lost = s_bus.lost.load(std::memory_order_relaxed);
+  if (lost != s_seen_lost) {
+    s_seen_lost = lost;
+    if (!s_data_pending) {
+      s_data_pending  = true;
+      s_pending_since = t0;
+    }
+  }
+
+  // Storico dei segnali: un campione per ogni frame decodificato
+  ui_trend_sample();
+
+  uint32_t wait        = LV_NO_TIMER_READY;
+  uint64_t shown_since = 0;
+  if (s_data_pending || (req & UI_REQ_UPDATE)) {
+    const uint32_t since = now - s_last_update_ms;
+    if ((req & UI_REQ_UPDATE) || since >= UI_TASK_MIN_UPDATE_MS) {
+      shown_since = s_data_pending ? s_pending_since : 0;
+      ui_update();
+    } else {
+      wait = UI_TASK_MIN_UPDATE_MS - since;
+    }
+  }
+
+  // Comandi degli altri task, dopo ui_main_update: se scrivono lo stesso
+  // widget vincono loro
+  ui_cmd_drain();
+
+  // Overlay del profilo dei task (se acceso): solo a campione nuovo
+  task_prof_overlay_update();
+
+  const uint32_t refreshes = s_refreshes;
+  RTRACE_BEGIN(RTRACE_EV_TIMER_HANDLER, 0);
+  const uint32_t next      = lv_timer_handler();
+  RTRACE_END(RTRACE_EV_TIMER_HANDLER, next);
+  touch_idle_check();
+
+  const uint64_t t1 = (uint64_t)esp_timer_get_time();
+  if (s_refreshes != refreshes) {
+    s_stats.refreshes++;
+    // Latenza dato -> pixel: dal frame al ridisegno che lo mostra
+    if (shown_since && t1 >= shown_since) {
+      const uint32_t us = (uint32_t)(t1 - shown_since);
+      s_stats.latency_count++;
+      s_stats.latency_sum_us += us;
+      if (us > s_stats.latency_max_us) {
+        s_stats.latency_max_us = us;
+      }
+    }
+  }
+  s_stats.busy_us += (uint64_t)UI_TASK_BUSY_CLOCK() - busy0;
+
+  return (next < wait) ? next : wait;
+}
+
+uint32_t ui_task_step(bool notified)
+{
+  lv_port_lock(-1);
+  if (notified) {
+    s_stats.notified++;
+  } else {
+    s_stats.timed++;
+  }
+  uint32_t dumps = 0;
+  const uint32_t ms = step_locked(dumps);
+  lv_port_unlock();
+
+  // Le stampe sulla seriale sono lente: fuori dal lock, così gli altri
+  // utenti di LVGL non le aspettano. Storico e contatori sono del task UI.
+  if (dumps & UI_REQ_TREND_DUMP) {
+    ui_trend_dump(Serial);
+  }
+  if (dumps & UI_REQ_STATS_DUMP) {
+    ui_task_dump(Serial);
+  }
+  return ms;
+}
+
+static void ui_task(void *arg)
+{
+  (void)arg;
+
+  // Via libera da ui_task_start() quando il cursore sul bus è pronto
+  ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+  bool notified = true;
+  while (true) {
+    const uint32_t ms = ui_task_step(notified);
+    const TickType_t ticks = (ms == LV_NO_TIMER_READY) ? portMAX_DELAY : pdMS_TO_TICKS(ms);
+    notified = ulTaskNotifyTake(pdTRUE, ticks) != 0;
+  }
+}
+
+// ----------------------------------------------------
+// API
+// ----------------------------------------------------
+
+void ui_task_init(bool touch_irq)
+{
+  s_last_tick_ms   = millis();
+  s_last_update_ms = s_last_tick_ms;
+  s_stats          = UiTaskStats();
+  s_stats.since_us = (uint64_t)esp_timer_get_time();
+
+  s_slow_timer = lv_timer_create(slow_update_cb, UI_TASK_SLOW_UPDATE_MS, nullptr);
+
+  lv_disp_t *disp = lv_disp_get_default();
+  if (disp && !disp->driver->monitor_cb) {
+    disp->driver->monitor_cb = refr_monitor_cb;
+  }
+
+  if (touch_irq) {
+    for (lv_indev_t *i = lv_indev_get_next(nullptr); i; i = lv_indev_get_next(i)) {
+      if (i->driver->type == LV_INDEV_TYPE_POINTER && i->driver->read_timer) {
+        s_touch = i;
+        lv_timer_pause(i->driver->read_timer);
+        break;
+      }
+    }
+  }
+}
+
+bool ui_task_start()
+{
+  BaseType_t res = xTaskCreatePinnedToCore(
+      ui_task,
+      "ui_task",
+      UI_TASK_STACK,
+      nullptr,
+      UI_TASK_PRIO,
+      &s_task,
+      TASK_CORE_ID(UI_TASK_CORE)
+  );
+  if (res != pdPASS) {
+    Serial.println("[ui_task] ERRORE: impossibile creare ui_task");
+    s_task = nullptr;
+    return false;
+  }
+
+  // Il task RX sveglia la UI a ogni pubblicazione, gli altri task con i
+  // comandi UI
+  signal_bus_subscribe(s_bus, "ui", s_task);
+  ui_cmd_set_notify(s_task);
+  s_seen_lost = 0;
+  xTaskNotifyGive(s_task);
+  return true;
+}
+
+TaskHandle_t ui_task_handle()
+{
+  return s_task;
+}
+
+void ui_task_request(uint32_t requests)
+{
+  s_requests.fetch_or(requests, std::memory_order_release);
+  if (s_task) {
+    xTaskNotifyGive(s_task);
+  }
+}
+
+bool IRAM_ATTR ui_task_touch_isr()
+{
+  s_touch_pending.store(true, std::memory_order_release);
+  if (!s_task) {
+    return false;
+  }
+  BaseType_t woken = pdFALSE;
+  vTaskNotifyGiveFromISR(s_task, &woken);
+  return woken == pdTRUE;
+}
+
+UiTaskStats ui_task_get_stats()
+{
+  LvPortLockGuard lock;
+  return s_stats;
+}
+
+void ui_task_dump(Print &out)
+{
+  // Copia e azzeramento sotto il lock, stampa fuori
+  UiTaskStats s;
+  uint64_t    now_us;
+  {
+    LvPortLockGuard lock;
+    now_us           = (uint64_t)esp_timer_get_time();
+    s                = s_stats;
+    s_stats          = UiTaskStats();
+    s_stats.since_us = now_us;
+  }
+  const double span_s = (now_us - s.since_us) / 1e6;
+  const double per_s  = span_s > 0 ? 1.0 / span_s : 0.0;
+
+  out.printf("[ui] %.1f s: %lu giri (%.1f/s), risvegli %lu da notifica + %lu da timer, "
+             "touch %lu, eventi %lu\n",
+             span_s, (unsigned long)s.steps, s.steps * per_s, (unsigned long)s.notified,
+             (unsigned long)s.timed, (unsigned long)s.touch_irqs, (unsigned long)s.events);
+  out.printf("[ui] ui_main_update %lu (%.1f/s), ridisegni %lu, CPU %.2f%%\n",
+             (unsigned long)s.updates, s.updates * per_s, (unsigned long)s.refreshes,
+             span_s > 0 ? s.busy_us / 1e4 / span_s : 0.0);
+  out.printf("[ui] latenza dato->pixel: media %.1f ms, max %.1f ms (%lu campioni)\n",
+             s.latency_count ? s.latency_sum_us / 1000.0 / s.latency_count : 0.0,
+             s.latency_max_us / 1000.0, (unsigned long)s.latency_count);
+  ui_cmd_dump(out);
+  lv_port_lock_dump(out);
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "task_config.h"   // UI_TASK_CORE, UI_TASK_PRIO, UI_TASK_STACK
+
+// ----------------------------------------------------
+// Task di rendering LVGL (a eventi)
+// ----------------------------------------------------
+// Al posto di loop() con delay(5): un task dedicato che dorme esattamente
+// quanto chiede lv_timer_handler() (anche per sempre, se nessun timer LVGL
+// è attivo) e viene svegliato prima da una task notification quando:
+//
+// - il task RX pubblica un frame decodificato (signal_bus.h, anche senza
+//   segnali cambiati: serve al campionamento dei trend)
+// - il touch genera un interrupt (ui_task_touch_isr)
+// - un altro task chiede qualcosa alla UI (ui_task_request) o le manda un
+//   comando (ui_cmd.h, svuotati una volta per giro)
+//
+// ui_main_update() parte appena arrivano segnali cambiati, al massimo una
+// volta ogni UI_TASK_MIN_UPDATE_MS (un frame), più un giro ogni
+// UI_TASK_SLOW_UPDATE_MS per le pagine che cambiano con il tempo (trend,
+// diagnostica). Con lo schermo fermo il task non si sveglia più ogni 5 ms.
+//
+// Con il touch a interrupt il timer di lettura dell'indev LVGL resta in
+// pausa finché non arriva un interrupt e torna in pausa al rilascio (a
+// scroll finito). Senza pin INT l'indev resta a polling ogni
+// LV_INDEV_DEF_READ_PERIOD.
+//
+// Ogni giro tiene il lock LVGL (lv_port_lock.h): dopo ui_task_start() gli
+// altri task toccano LVGL solo dentro lv_port_lock()/lv_port_unlock(), e
+// preferibilmente non lo toccano affatto (comandi UI, ui_task_request).
+
+// Distanza minima tra due ui_main_update() a eventi (= LV_DISP_DEF_REFR_PERIOD)
+#ifndef UI_TASK_MIN_UPDATE_MS
+#define UI_TASK_MIN_UPDATE_MS  30
+#endif
+
+// Aggiornamento periodico anche senza dati nuovi
+#ifndef UI_TASK_SLOW_UPDATE_MS
+#define UI_TASK_SLOW_UPDATE_MS  1000
+#endif
+
+// Richieste da altri task (bit, si accumulano fino al giro successivo)
+enum UiRequest : uint32_t
+{
+  UI_REQ_UPDATE     = 1U << 0,   // ui_main_update() subito
+  UI_REQ_TREND_DUMP = 1U << 1,   // ui_trend_dump(Serial) dal task UI
+  UI_REQ_STATS_DUMP = 1U << 2,   // ui_task_dump(Serial) dal task UI
+};
+
+struct UiTaskStats
+{
+  uint32_t steps;           // giri (ui_task_step)
+  uint32_t notified;        // risvegli da notifica (dati, touch, richieste)
+  uint32_t timed;           // risvegli allo scadere di un timer LVGL
+  uint32_t touch_irqs;      // interrupt del touch
+  uint32_t events;          // eventi del bus ricevuti
+  uint32_t updates;         // ui_main_update()
+  uint32_t refreshes;       // giri in cui LVGL ha ridisegnato
+  uint32_t latency_count;   // campioni di latenza dato -> pixel
+  uint64_t latency_sum_us;
+  uint32_t latency_max_us;
+  uint64_t busy_us;         // tempo dei giri con il lock preso
+  uint64_t since_us;        // inizio del conteggio (esp_timer)
+};
+
+// Prepara il task (tick, timer periodico, cursore sul bus). touch_irq: il
+// touch sveglia il task con ui_task_touch_isr() (lv_port_touch_attach_irq).
+// Dopo ui_main_init(), prima di ui_task_start().
+void ui_task_init(bool touch_irq);
+
+// Crea il task su UI_TASK_CORE. Da qui in poi LVGL è suo.
+bool ui_task_start();
+
+// Un giro del task sotto il lock LVGL: tick, richieste, dati nuovi, comandi
+// UI, lv_timer_handler(); i dump richiesti li stampa dopo aver rilasciato il
+// lock. notified: il giro segue una notifica (false = scaduta l'attesa),
+// conta nei risvegli.
+// Ritorna quanti ms dormire (LV_NO_TIMER_READY = fino alla prossima
+// notifica). Sul device lo chiama solo il task; su host il driver di replay.
+uint32_t ui_task_step(bool notified);
+
+// Handle del task (nullptr prima di ui_task_start)
+TaskHandle_t ui_task_handle();
+
+// Da qualsiasi task: accoda richieste (UiRequest) e sveglia il task
+void ui_task_request(uint32_t requests);
+
+// Dall'interrupt del touch. Ritorna true se serve un cambio di contesto.
+bool ui_task_touch_isr();
+
+// Copia sotto il lock LVGL: da qualsiasi task, aspetta la fine del giro in
+// corso
+UiTaskStats ui_task_get_stats();
+
+// Risvegli, aggiornamenti, latenza e CPU dall'ultimo dump (poi azzera),
+// più i contatori dei comandi UI (ui_cmd_dump) e del lock LVGL
+// (lv_port_lock_dump). Dal task UI (UI_REQ_STATS_DUMP), senza il lock:
+// lo prende solo per copiare i contatori.
+void ui_task_dump(Print &out);
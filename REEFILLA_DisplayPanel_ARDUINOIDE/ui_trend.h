@@ -0,0 +1,26 @@
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+// ----------------------------------------------------
+// Trend dei segnali decodificati (sig_history.h)
+// ----------------------------------------------------
+// Alcuni segnali di DbcState vengono registrati a ogni nuovo frame in uno
+// storico multi-risoluzione in PSRAM. L'elenco dei segnali e la pagina con
+// il grafico dipendono dal prodotto (ui_trend_<prodotto>.cpp).
+//
+// Tutto dal task UI (ui_task.h).
+
+// Alloca gli storici; se page != nullptr ci crea dentro la pagina dei trend
+void ui_trend_init(lv_obj_t *page);
+
+// Registra i segnali dei frame arrivati dall'ultima chiamata. Da chiamare
+// a ogni giro del task UI, che si sveglia a ogni frame decodificato.
+void ui_trend_sample();
+
+// Ridisegna il grafico (solo se la pagina è visibile e i punti cambiano)
+void ui_trend_update();
+
+// Ultimi 10 minuti di ogni segnale, un punto al minuto (min/media/max)
+void ui_trend_dump(Print &out);
@@ -0,0 +1,266 @@
+#include "product.h"
+#if REEFILLA_PRODUCT == REEFILLA_PRODUCT_FILLEE
+
+#include "ui_trend.h"
+#include "dbc_decoder.h"
+#include "sig_history.h"
+
+#include "esp_timer.h"
+
+#include <math.h>
+
+// ----------------------------------------------------
+// Segnali registrati
+// ----------------------------------------------------
+enum TrendSignal : uint8_t
+{
+  TREND_SOC = 0,     // SOC_ACTIVE [%]
+  TREND_P_AC_0,      // INV_P_AC_VECT[0..2] [W]
+  TREND_P_AC_1,
+  TREND_P_AC_2,
+
+  TREND_COUNT
+};
+
+static const char *const TREND_NAME[TREND_COUNT] = { "SOC %", "LINE 1 W", "LINE 2 W", "LINE 3 W" };
+
+static SigHistory s_hist[TREND_COUNT];
+
+// ----------------------------------------------------
+// Pagina trend
+// ----------------------------------------------------
+
+// Finestre selezionabili dai pulsanti
+static const uint32_t WINDOW_S[] = { 600, 3600, 12 * 3600, 72 * 3600 };
+static const char *WINDOW_MAP[]  = { "10 min", "1 h", "12 h", "3 g", "" };
+
+// Larghezza utile del grafico [px]: al più un punto per pixel
+#define TREND_CHART_W  420
+#define TREND_CHART_H  300
+
+static lv_obj_t          *s_chart = nullptr;
+static lv_chart_series_t *s_series[TREND_COUNT];
+static lv_obj_t          *s_label_range = nullptr;
+static uint8_t            s_window = 0;
+static bool               s_force  = true;   // ridisegno alla prossima update
+
+static SigPoint s_points[TREND_CHART_W];
+
+static lv_color_t trend_color(uint8_t sig)
+{
+  switch (sig) {
+    case TREND_SOC:    return lv_color_white();
+    case TREND_P_AC_0: return lv_color_hex(0xFFC857);
+    case TREND_P_AC_1: return lv_color_hex(0xF05454);
+    default:           return lv_palette_lighten(LV_PALETTE_CYAN, 2);
+  }
+}
+
+static void window_event_cb(lv_event_t *e)
+{
+  lv_obj_t *btns = lv_event_get_target(e);
+  const uint16_t sel = lv_btnmatrix_get_selected_btn(btns);
+  if (sel < sizeof(WINDOW_S) / sizeof(WINDOW_S[0]) && sel != s_window) {
+    s_window = (uint8_t)sel;
+    s_force  = true;
+    ui_trend_update();
+  }
+}
+
+static void trend_create_page(lv_obj_t *page)
+{
+  lv_obj_t *title = lv_label_create(page);
+  lv_label_set_text(title, "TREND");
+  lv_obj_set_style_text_font(title, &lv_font_montserrat_28, 0);
+  lv_obj_set_style_text_color(title, lv_color_white(), 0);
+  lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 12);
+
+  s_chart = lv_chart_create(page);
+  lv_obj_set_size(s_chart, TREND_CHART_W, TREND_CHART_H);
+  lv_obj_align(s_chart, LV_ALIGN_CENTER, 0, -6);
+  lv_chart_set_type(s_chart, LV_CHART_TYPE_LINE);
+  lv_chart_set_div_line_count(s_chart, 5, 6);
+  lv_chart_set_range(s_chart, LV_CHART_AXIS_PRIMARY_Y, 0, 100);
+  lv_chart_set_range(s_chart, LV_CHART_AXIS_SECONDARY_Y, -10, 10);
+  lv_chart_set_point_count(s_chart, 2);
+  lv_obj_set_style_bg_color(s_chart, lv_color_hex(0x007E81), 0);
+  lv_obj_set_style_bg_opa(s_chart, LV_OPA_COVER, 0);
+  lv_obj_set_style_border_width(s_chart, 0, 0);
+  lv_obj_set_style_line_color(s_chart, lv_color_hex(0x00B2A9), LV_PART_MAIN);
+  lv_obj_set_style_size(s_chart, 0, LV_PART_INDICATOR);   // niente pallini sui punti
+  lv_obj_set_style_line_width(s_chart, 2, LV_PART_ITEMS);
+  lv_obj_clear_flag(s_chart, LV_OBJ_FLAG_SCROLLABLE);
+
+  // SOC sull'asse principale (0..100), potenze sul secondario (autoscala)
+  for (uint8_t i = 0; i < TREND_COUNT; ++i) {
+    s_series[i] = lv_chart_add_series(s_chart, trend_color(i),
+                                      i == TREND_SOC ? LV_CHART_AXIS_PRIMARY_Y
+                                                     : LV_CHART_AXIS_SECONDARY_Y);
+    lv_chart_set_all_value(s_chart, s_series[i], LV_CHART_POINT_NONE);
+  }
+
+  // Legenda
+  lv_obj_t *legend = lv_obj_create(page);
+  lv_obj_remove_style_all(legend);
+  lv_obj_set_size(legend, TREND_CHART_W, LV_SIZE_CONTENT);
+  lv_obj_align_to(legend, s_chart, LV_ALIGN_OUT_TOP_MID, 0, -4);
+  lv_obj_set_flex_flow(legend, LV_FLEX_FLOW_ROW);
+  lv_obj_set_flex_align(legend, LV_FLEX_ALIGN_SPACE_EVENLY, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+  for (uint8_t i = 0; i < TREND_COUNT; ++i) {
+    lv_obj_t *l = lv_label_create(legend);
+    lv_label_set_text(l, TREND_NAME[i]);
+    lv_obj_set_style_text_color(l, trend_color(i), 0);
+  }
+
+  // Scala delle potenze
+  s_label_range = lv_label_create(page);
+  lv_label_set_text(s_label_range, "");
+  lv_obj_set_style_text_color(s_label_range, lv_color_white(), 0);
+  lv_obj_align_to(s_label_range, s_chart, LV_ALIGN_OUT_BOTTOM_RIGHT, 0, 4);
+
+  // Finestra temporale
+  lv_obj_t *btns = lv_btnmatrix_create(page);
+  lv_btnmatrix_set_map(btns, WINDOW_MAP);
+  lv_btnmatrix_set_btn_ctrl_all(btns, LV_BTNMATRIX_CTRL_CHECKABLE);
+  lv_btnmatrix_set_one_checked(btns, true);
+  lv_btnmatrix_set_btn_ctrl(btns, 0, LV_BTNMATRIX_CTRL_CHECKED);
+  lv_obj_set_size(btns, TREND_CHART_W, 56);
+  lv_obj_align(btns, LV_ALIGN_BOTTOM_MID, 0, -10);
+  lv_obj_add_event_cb(btns, window_event_cb, LV_EVENT_VALUE_CHANGED, nullptr);
+}
+
+// ----------------------------------------------------
+// API
+// ----------------------------------------------------
+
+void ui_trend_init(lv_obj_t *page)
+{
+  if (!sig_history_init(s_hist, TREND_COUNT)) {
+    Serial.println("[ui_trend] ERRORE: PSRAM insufficiente per lo storico");
+  } else {
+    Serial.printf("[ui_trend] Storico di %u segnali, %u KB in PSRAM\n",
+                  (unsigned)TREND_COUNT, (unsigned)(TREND_COUNT * SIG_HISTORY_BYTES / 1024));
+  }
+  if (page) {
+    trend_create_page(page);
+  }
+}
+
+void ui_trend_sample()
+{
+  static uint32_t seen_version  = 0;
+  static uint32_t seen_status   = 0;
+  static uint32_t seen_status2  = 0;
+
+  DbcState s;
+  const uint32_t version = dbc_snapshot(s);
+  if (version == seen_version) {
+    return;
+  }
+  seen_version = version;
+
+  const uint64_t now_ms = (uint64_t)esp_timer_get_time() / 1000ULL;
+
+  // Un campione per frame ricevuto; i segnali non validi lasciano un buco
+  if (s.status_lastUpdate_ms != seen_status) {
+    seen_status = s.status_lastUpdate_ms;
+    if (dbc_valid(s, DBC_CHG_SOC_ACTIVE) && s.soc_active_percent >= 0) {
+      s_hist[TREND_SOC].add(now_ms, s.soc_active_percent);
+    }
+  }
+  if (s.status2_lastUpdate_ms != seen_status2) {
+    seen_status2 = s.status2_lastUpdate_ms;
+    for (uint8_t i = 0; i < 3; ++i) {
+      if (dbc_valid(s, static_cast<DbcChange>(DBC_CHG_INV_P_AC_0 + i)) && s.inv_p_ac_w[i] != -11) {
+        s_hist[TREND_P_AC_0 + i].add(now_ms, (float)s.inv_p_ac_w[i]);
+      }
+    }
+  }
+}
+
+void ui_trend_update()
+{
+  if (!s_chart || !lv_obj_is_visible(s_chart)) {
+    return;
+  }
+
+  const uint64_t now_ms = (uint64_t)esp_timer_get_time() / 1000ULL;
+  const uint32_t window = WINDOW_S[s_window];
+  bool changed = s_force;
+  s_force = false;
+
+  // Potenze in 100 W sull'asse secondario (lv_coord_t è a 16 bit)
+  int32_t p_min = INT32_MAX;
+  int32_t p_max = INT32_MIN;
+
+  for (uint8_t i = 0; i < TREND_COUNT; ++i) {
+    const SigQuery q = s_hist[i].query(now_ms, window, TREND_CHART_W, s_points, TREND_CHART_W);
+    if (q.count == 0) {
+      continue;
+    }
+    if (lv_chart_get_point_count(s_chart) != q.count) {
+      lv_chart_set_point_count(s_chart, (uint16_t)q.count);
+      changed = true;
+    }
+
+    lv_coord_t *y = lv_chart_get_y_array(s_chart, s_series[i]);
+    for (size_t p = 0; p < q.count; ++p) {
+      lv_coord_t v = LV_CHART_POINT_NONE;
+      if (s_points[p].n) {
+        if (i == TREND_SOC) {
+          v = (lv_coord_t)lroundf(s_points[p].mean);
+        } else {
+          const int32_t d = lroundf(s_points[p].mean / 100.0f);
+          v = (lv_coord_t)d;
+          if (d < p_min) p_min = d;
+          if (d > p_max) p_max = d;
+        }
+      }
+      if (y[p] != v) {
+        y[p] = v;
+        changed = true;
+      }
+    }
+  }
+
+  if (p_min <= p_max) {
+    // Scala a passi di 1 kW, mai più stretta di ±1 kW
+    const int32_t lo = ((p_min < -10 ? p_min : -10) - 9) / 10 * 10;
+    const int32_t hi = ((p_max > 10 ? p_max : 10) + 9) / 10 * 10;
+    static int32_t s_lo = 0, s_hi = 0;
+    if (lo != s_lo || hi != s_hi) {
+      s_lo = lo;
+      s_hi = hi;
+      lv_chart_set_range(s_chart, LV_CHART_AXIS_SECONDARY_Y, (lv_coord_t)lo, (lv_coord_t)hi);
+      char buf[48];
+      snprintf(buf, sizeof(buf), "P: %ld .. %ld kW", (long)(lo / 10), (long)(hi / 10));
+      lv_label_set_text(s_label_range, buf);
+      changed = false;   // set_range ha già ridisegnato
+    }
+  }
+
+  if (changed) {
+    lv_chart_refresh(s_chart);
+  }
+}
+
+void ui_trend_dump(Print &out)
+{
+  const uint64_t now_ms = (uint64_t)esp_timer_get_time() / 1000ULL;
+  SigPoint pts[10];
+
+  for (uint8_t i = 0; i < TREND_COUNT; ++i) {
+    const SigQuery q = s_hist[i].query(now_ms, 600, 10, pts, 10);
+    out.printf("[trend] %-9s", TREND_NAME[i]);
+    for (size_t p = 0; p < q.count; ++p) {
+      if (pts[p].n) {
+        out.printf(" %.0f[%.0f..%.0f]", pts[p].mean, pts[p].min, pts[p].max);
+      } else {
+        out.printf(" --");
+      }
+    }
+    out.printf("\n");
+  }
+}
+
+#endif // REEFILLA_PRODUCT == REEFILLA_PRODUCT_FILLEE
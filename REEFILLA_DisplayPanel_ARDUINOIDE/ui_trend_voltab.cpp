@@ -0,0 +1,99 @@
+#include "product.h"
+#if REEFILLA_PRODUCT == REEFILLA_PRODUCT_VOLTAB
+
+#include "ui_trend.h"
+#include "dbc_decoder.h"
+#include "sig_history.h"
+
+#include "esp_timer.h"
+
+// ----------------------------------------------------
+// Segnali registrati
+// ----------------------------------------------------
+// Questo pannello non ha ancora una pagina per i grafici: lo storico si
+// legge con ui_trend_dump() (comando 'h' sulla console).
+enum TrendSignal : uint8_t
+{
+  TREND_SOC = 0,     // BMS_SOC [%]
+  TREND_GRID_V,      // INV_GRID_V_AC [V]
+  TREND_P_AC,        // INV_P_AC [W]
+
+  TREND_COUNT
+};
+
+static const char *const TREND_NAME[TREND_COUNT] = { "SOC %", "Grid V", "P_AC W" };
+
+static SigHistory s_hist[TREND_COUNT];
+
+// ----------------------------------------------------
+// API
+// ----------------------------------------------------
+
+void ui_trend_init(lv_obj_t *page)
+{
+  (void)page;
+  if (!sig_history_init(s_hist, TREND_COUNT)) {
+    Serial.println("[ui_trend] ERRORE: PSRAM insufficiente per lo storico");
+  } else {
+    Serial.printf("[ui_trend] Storico di %u segnali, %u KB in PSRAM\n",
+                  (unsigned)TREND_COUNT, (unsigned)(TREND_COUNT * SIG_HISTORY_BYTES / 1024));
+  }
+}
+
+void ui_trend_sample()
+{
+  static uint32_t seen_version  = 0;
+  static uint32_t seen_status   = 0;
+  static uint32_t seen_status2  = 0;
+
+  DbcState s;
+  const uint32_t version = dbc_snapshot(s);
+  if (version == seen_version) {
+    return;
+  }
+  seen_version = version;
+
+  const uint64_t now_ms = (uint64_t)esp_timer_get_time() / 1000ULL;
+
+  // Un campione per frame ricevuto; i segnali non validi lasciano un buco
+  if (s.status_lastUpdate_ms != seen_status) {
+    seen_status = s.status_lastUpdate_ms;
+    if (dbc_valid(s, DBC_CHG_SOC)) {
+      s_hist[TREND_SOC].add(now_ms, s.soc_percent);
+    }
+  }
+  if (s.status2_lastUpdate_ms != seen_status2) {
+    seen_status2 = s.status2_lastUpdate_ms;
+    if (dbc_valid(s, DBC_CHG_GRID_V_AC)) {
+      s_hist[TREND_GRID_V].add(now_ms, s.grid_v_ac_deciv / 10.0f);
+    }
+    if (dbc_valid(s, DBC_CHG_INV_P_AC)) {
+      s_hist[TREND_P_AC].add(now_ms, s.inv_p_ac_w);
+    }
+  }
+}
+
+void ui_trend_update()
+{
+}
+
+void ui_trend_dump(Print &out)
+{
+  const uint64_t now_ms = (uint64_t)esp_timer_get_time() / 1000ULL;
+  SigPoint pts[10];
+
+  for (uint8_t i = 0; i < TREND_COUNT; ++i) {
+    const SigQuery q = s_hist[i].query(now_ms, 600, 10, pts, 10);
+    out.printf("[trend] %-9s", TREND_NAME[i]);
+    for (size_t p = 0; p < q.count; ++p) {
+      if (pts[p].n) {
+        out.printf(" %.1f[%.1f..%.1f]", pts[p].mean, pts[p].min, pts[p].max);
+      } else {
+        out.printf(" --");
+      }
+    }
+    out.printf("\n");
+  }
+}
+
+#endif // REEFILLA_PRODUCT == REEFILLA_PRODUCT_VOLTAB
@@ -1,7 +0,0 @@
-#pragma once
-
-// Inizializza la UI principale (schermata iniziale)
-void ui_main_init();
-
-// Aggiorna la UI con i dati correnti del DBC (da chiamare periodicamente)
-void ui_main_update();
\ No newline at end of file
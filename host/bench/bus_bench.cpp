@@ -0,0 +1,208 @@
+// ----------------------------------------------------
+// Benchmark del bus dei segnali (BroadcastRing) con 1..8 iscritti
+// ----------------------------------------------------
+// Un produttore pubblica SignalEvent a blocchi di BATCH (come i segnali
+// cambiati di un frame) nel ring di signal_bus.h; N thread iscritti li
+// leggono ciascuno con il proprio cursore. Per ogni N:
+//
+// - costo del produttore per evento, costruzione compresa (non deve
+//   crescere con N)
+// - eventi ricevuti, persi, overrun e ritardo massimo per iscritto
+// - controlli: ogni evento letto è intero (campi coerenti con la sua
+//   posizione), le posizioni crescono sempre, e i buchi nella sequenza
+//   sono esattamente gli eventi contati in lost; a fine prova
+//   ricevuti + persi = pubblicati per ogni iscritto
+//
+// Senza EVENTI_AL_SECONDO il produttore va al massimo e gli iscritti
+// perdono eventi di sicuro (misura del caso peggiore); con un ritmo
+// realistico (es. 20000) e un core per iscritto non deve perderne
+// nessuno (con meno core decide lo scheduler dell'host).
+//
+// Uso: reefilla_bus_bench [SECONDI_PER_PROVA] [EVENTI_AL_SECONDO]
+
+#include <Arduino.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "host_hal.h"
+#include "signal_bus.h"
+
+using Clock = std::chrono::steady_clock;
+
+static constexpr size_t   BATCH           = 8;
+static constexpr size_t   POLL_MAX        = 64;
+static constexpr unsigned MAX_SUBSCRIBERS = 8;
+
+// Evento k: tutti i campi derivati da k, per riconoscere le copie miste
+static SignalEvent make_event(uint64_t k)
+{
+  SignalEvent e;
+  e.t_us  = k;
+  e.value = (float)(k & 0xFFFFU);
+  e.sig   = (uint8_t)(k % 31U);
+  e.flags = (uint8_t)(k & 1U);
+  e.seq   = (uint16_t)(k * 7U);
+  return e;
+}
+
+static bool event_ok(const SignalEvent &e)
+{
+  const SignalEvent x = make_event(e.t_us);
+  return e.value == x.value && e.sig == x.sig && e.flags == x.flags && e.seq == x.seq;
+}
+
+struct SubResult
+{
+  uint64_t received = 0;
+  uint64_t torn     = 0;   // copie miste
+  uint64_t order    = 0;   // posizioni non crescenti
+  uint64_t gaps     = 0;   // eventi mancanti nella sequenza letta
+  uint64_t expected = 0;   // posizione successiva all'ultima letta
+};
+
+struct RunResult
+{
+  uint64_t published   = 0;
+  double   producer_ns = 0;   // per evento
+  uint64_t lost        = 0;
+  uint64_t overruns    = 0;
+  uint32_t max_lag     = 0;
+  uint64_t received    = 0;
+  bool     ok          = true;
+};
+
+static RunResult run(unsigned subscribers, double seconds, double rate)
+{
+  std::unique_ptr<SignalBusRing>   ring(new SignalBusRing());
+  std::vector<BroadcastCursor>     cur(subscribers);
+  std::vector<SubResult>           res(subscribers);
+  std::atomic<bool>                stop{false};
+  std::atomic<unsigned>            ready{0};
+
+  for (BroadcastCursor &c : cur) {
+    ring->attach(c);
+  }
+
+  std::vector<std::thread> threads;
+  for (unsigned s = 0; s < subscribers; ++s) {
+    threads.emplace_back([&, s] {
+      BroadcastCursor &c = cur[s];
+      SubResult       &r = res[s];
+      SignalEvent      ev[POLL_MAX];
+      ready.fetch_add(1);
+
+      while (true) {
+        const bool   stopping = stop.load(std::memory_order_acquire);
+        const size_t n        = ring->poll(c, ev, POLL_MAX);
+        for (size_t i = 0; i < n; ++i) {
+          const uint64_t k = ev[i].t_us;
+          r.torn  += !event_ok(ev[i]);
+          r.order += k < r.expected;
+          if (k > r.expected) {
+            r.gaps += k - r.expected;
+          }
+          r.expected = k + 1;
+        }
+        r.received += n;
+        if (n == 0) {
+          if (stopping && ring->lag(c) == 0) {
+            break;
+          }
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  while (ready.load() < subscribers) {
+    std::this_thread::yield();
+  }
+
+  // Produttore sul thread principale
+  RunResult out;
+  SignalEvent batch[BATCH];
+  uint64_t    k      = 0;
+  double      busy_s = 0;
+  const int   reps   = rate > 0 ? 1 : 64;   // a ritmo libero l'orologio si legge ogni 64 batch
+  const Clock::time_point t0  = Clock::now();
+  const Clock::time_point end = t0 + std::chrono::duration_cast<Clock::duration>(
+                                         std::chrono::duration<double>(seconds));
+  while (Clock::now() < end) {
+    if (rate > 0) {
+      const auto due = t0 + std::chrono::duration_cast<Clock::duration>(
+                                std::chrono::duration<double>(k / rate));
+      while (Clock::now() < due) {
+        std::this_thread::yield();
+      }
+    }
+    const Clock::time_point p0 = Clock::now();
+    for (int rep = 0; rep < reps; ++rep) {
+      for (size_t i = 0; i < BATCH; ++i) {
+        batch[i] = make_event(k + i);
+      }
+      ring->publish_n(batch, BATCH);
+      k += BATCH;
+    }
+    busy_s += std::chrono::duration<double>(Clock::now() - p0).count();
+  }
+  stop.store(true, std::memory_order_release);
+  for (std::thread &t : threads) {
+    t.join();
+  }
+
+  out.published   = k;
+  out.producer_ns = k ? busy_s * 1e9 / k : 0.0;
+  for (unsigned s = 0; s < subscribers; ++s) {
+    const BroadcastCursor &c = cur[s];
+    const SubResult       &r = res[s];
+    const uint64_t lost = c.lost.load();
+    const uint64_t gaps = r.gaps + (k - r.expected);   // persi in coda, dopo l'ultimo letto
+    out.lost     += lost;
+    out.overruns += c.overruns.load();
+    out.received += r.received;
+    if (c.max_lag.load() > out.max_lag) {
+      out.max_lag = c.max_lag.load();
+    }
+    if (r.torn || r.order || gaps != lost || r.received + lost != k ||
+        c.received.load() != r.received) {
+      printf("  iscritto %u: ricevuti %llu, persi %llu (buchi %llu), misti %llu, fuori ordine %llu\n",
+             s, (unsigned long long)r.received, (unsigned long long)lost,
+             (unsigned long long)gaps, (unsigned long long)r.torn, (unsigned long long)r.order);
+      out.ok = false;
+    }
+  }
+  return out;
+}
+
+int main(int argc, char **argv)
+{
+  const double seconds = (argc > 1) ? atof(argv[1]) : 1.0;
+  const double rate    = (argc > 2) ? atof(argv[2]) : 0.0;
+
+  host_serial_set_enabled(false);
+  printf("[bus_bench] ring da %u eventi da %u byte, %s, %.1f s per prova, %u core\n",
+         (unsigned)SignalBusRing::capacity(), (unsigned)sizeof(SignalEvent),
+         rate > 0 ? "ritmo fisso" : "produttore a ritmo libero", seconds,
+         std::thread::hardware_concurrency());
+  if (rate > 0) {
+    printf("[bus_bench] %.0f eventi/s\n", rate);
+  }
+
+  bool ok = true;
+  for (unsigned n = 1; n <= MAX_SUBSCRIBERS; ++n) {
+    const RunResult r = run(n, seconds, rate);
+    printf("[bus_bench] %u iscritti: %10llu pubblicati, produttore %6.1f ns/evento, "
+           "ricevuti %5.1f%%, persi %llu in %llu overrun, ritardo max %lu%s\n",
+           n, (unsigned long long)r.published, r.producer_ns,
+           r.published ? 100.0 * r.received / ((double)r.published * n) : 0.0,
+           (unsigned long long)r.lost, (unsigned long long)r.overruns,
+           (unsigned long)r.max_lag, r.ok ? "" : "  ERRORE");
+    ok = ok && r.ok;
+  }
+
+  printf("%s\n", ok ? "OK: nessun evento misto, perdite tutte contate" : "ERRORE");
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,214 @@
+// ----------------------------------------------------
+// Verifica della sintesi dei filtri HW (can_filter.h) su host
+// ----------------------------------------------------
+// Per insiemi di ID casuali (standard, estesi, misti e un gruppo J1939 con
+// il prefisso in comune come i messaggi VCU) da 1, 2, 16, 17 (primo oltre
+// la partizione esaustiva del dual filter) e 64 ID (CAN_FILTER_MAX_IDS):
+//
+// - ogni ID dell'insieme passa can_filter_accepts() e il TWAI finto di
+//   host/shim, che applica code+mask con il layout dei registri
+// - accepted_std e accepted_ext del report sono uguali al conteggio a
+//   forza bruta di can_filter_accepts() su tutti i 2^11 ID standard e tutti
+//   i 2^29 ID estesi, e false_accept_rate torna con quei conteggi
+// - sui 2^11 ID standard, con RTR e byte dati casuali, nessun frame passa
+//   il TWAI finto senza passare can_filter_accepts(): RTR e dati sono
+//   ignorati di proposito, quindi il contrario (accettato dal report,
+//   scartato dal controller per i dati) è ammesso
+//
+// Il conteggio degli estesi è il grosso del tempo (circa un secondo e
+// mezzo per caso); --quick lo fa solo sui casi da 1 e 2 ID.
+//
+// Uso: reefilla_can_filter_check [--quick] [SEME]
+
+#include <Arduino.h>
+
+#include <math.h>
+#include <stdlib.h>
+
+#include <vector>
+
+#include "host_hal.h"
+#include "can_filter.h"
+
+enum class Kind { STD, EXT, MIXED, J1939 };
+
+static const char *kind_name(Kind k)
+{
+  switch (k) {
+    case Kind::STD:   return "std";
+    case Kind::EXT:   return "ext";
+    case Kind::MIXED: return "misti";
+    default:          return "j1939";
+  }
+}
+
+static unsigned s_checks = 0;
+static unsigned s_errors = 0;
+
+static void check(bool ok, const char *what, const char *kind, size_t n, unsigned long long got,
+                  unsigned long long want)
+{
+  s_checks++;
+  if (!ok) {
+    s_errors++;
+    printf("[can_filter_check] ERRORE %s %zu ID, %s: %llu invece di %llu\n", kind, n, what, got,
+           want);
+  }
+}
+
+static uint32_t s_rng = 1;
+
+static uint32_t rnd()
+{
+  s_rng ^= s_rng << 13;
+  s_rng ^= s_rng >> 17;
+  s_rng ^= s_rng << 5;
+  return s_rng;
+}
+
+static std::vector<CanFilterId> make_ids(Kind kind, size_t n)
+{
+  std::vector<CanFilterId> ids;
+  for (size_t i = 0; i < n; ++i) {
+    bool ext = kind == Kind::EXT || kind == Kind::J1939 || (kind == Kind::MIXED && (rnd() & 1U));
+    uint32_t id;
+    if (kind == Kind::J1939) {
+      // Priorità e PGN 0x88xx fissi, PS e sorgente variabili
+      id = 0x10880000UL | (rnd() & 0xFFFFU);
+    } else {
+      id = ext ? rnd() & 0x1FFFFFFFU : rnd() & 0x7FFU;
+    }
+    ids.push_back({ id, ext });
+  }
+  // Un duplicato: deve contare una volta sola in handled_ids
+  if (n > 2) {
+    ids.back() = ids.front();
+  }
+  return ids;
+}
+
+// Prova un frame sul TWAI finto con il filtro installato
+static bool twai_accepts(uint32_t id, bool extended, bool rtr = false, uint8_t d0 = 0,
+                         uint8_t d1 = 0)
+{
+  twai_message_t msg = {};
+  msg.identifier       = id;
+  msg.extd             = extended;
+  msg.rtr              = rtr;
+  msg.data_length_code = 8;
+  msg.data[0]          = d0;
+  msg.data[1]          = d1;
+  const bool ok = host_twai_push(msg);
+  twai_message_t out;
+  while (twai_receive(&out, 0) == ESP_OK) {
+  }
+  return ok;
+}
+
+static void twai_install(const CanFilterReport &rep)
+{
+  twai_stop();
+  twai_driver_uninstall();
+  const twai_general_config_t g = {};
+  const twai_timing_config_t  t = {};
+  twai_filter_config_t f;
+  f.acceptance_code = rep.acceptance_code;
+  f.acceptance_mask = rep.acceptance_mask;
+  f.single_filter   = rep.single_filter;
+  twai_driver_install(&g, &t, &f);
+  twai_start();
+}
+
+static void run_case(Kind kind, size_t n, bool count_ext)
+{
+  const char *kn = kind_name(kind);
+  const std::vector<CanFilterId> ids = make_ids(kind, n);
+
+  CanFilterReport rep;
+  can_filter_synthesize(ids.data(), ids.size(), rep);
+  twai_install(rep);
+
+  size_t distinct = 0;
+  for (size_t i = 0; i < ids.size(); ++i) {
+    bool dup = false;
+    for (size_t j = 0; j < i; ++j) {
+      dup = dup || (ids[j].id == ids[i].id && ids[j].extended == ids[i].extended);
+    }
+    distinct += dup ? 0 : 1;
+  }
+  check(rep.handled_ids == distinct, "handled_ids", kn, n, rep.handled_ids, distinct);
+
+  // Ogni ID gestito passa il filtro
+  unsigned missed = 0, missed_twai = 0;
+  for (const CanFilterId &fid : ids) {
+    missed      += can_filter_accepts(rep, fid.id, fid.extended) ? 0 : 1;
+    missed_twai += twai_accepts(fid.id, fid.extended) ? 0 : 1;
+  }
+  check(missed == 0, "ID gestiti scartati (can_filter_accepts)", kn, n, missed, 0);
+  check(missed_twai == 0, "ID gestiti scartati (TWAI finto)", kn, n, missed_twai, 0);
+
+  // Standard: forza bruta su tutti gli ID; il TWAI finto non ne accetta
+  // nessuno in più (RTR e dati a caso, 4 prove per ID)
+  uint64_t acc_std = 0;
+  unsigned extra = 0;
+  for (uint32_t id = 0; id < (1U << 11); ++id) {
+    const bool a = can_filter_accepts(rep, id, false);
+    acc_std += a ? 1 : 0;
+    for (int k = 0; k < 4 && !a; ++k) {
+      const uint32_t r = rnd();
+      extra += twai_accepts(id, false, r & 1U, (uint8_t)(r >> 8), (uint8_t)(r >> 16)) ? 1 : 0;
+    }
+  }
+  check(acc_std == rep.accepted_std, "accepted_std", kn, n, rep.accepted_std, acc_std);
+  check(extra == 0, "frame std accettati dal TWAI finto e non dal report", kn, n, extra, 0);
+
+  if (count_ext) {
+    uint64_t acc_ext = 0;
+    for (uint32_t id = 0; id < (1UL << 29); ++id) {
+      acc_ext += can_filter_accepts(rep, id, true) ? 1 : 0;
+    }
+    check(acc_ext == rep.accepted_ext, "accepted_ext", kn, n, rep.accepted_ext, acc_ext);
+
+    const uint64_t acc  = acc_std + acc_ext;
+    const double   rate = acc > distinct ? (double)(acc - distinct) / (double)acc : 0.0;
+    s_checks++;
+    if (fabs(rate - rep.false_accept_rate) > 1e-6) {
+      s_errors++;
+      printf("[can_filter_check] ERRORE %s %zu ID, false_accept_rate: %.7f invece di %.7f\n", kn,
+             n, rep.false_accept_rate, rate);
+    }
+  }
+
+  printf("%6s %4zu %7s  code=0x%08lX mask=0x%08lX  std %6llu  ext %10llu  falsi %.4f%%%s\n", kn,
+         n, rep.single_filter ? "single" : "dual", (unsigned long)rep.acceptance_code,
+         (unsigned long)rep.acceptance_mask, (unsigned long long)rep.accepted_std,
+         (unsigned long long)rep.accepted_ext, rep.false_accept_rate * 100.0f,
+         count_ext ? "" : "  (ext non contati)");
+}
+
+int main(int argc, char **argv)
+{
+  bool quick = false;
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "--quick")) {
+      quick = true;
+    } else {
+      s_rng = (uint32_t)strtoul(argv[i], nullptr, 0);
+    }
+  }
+  if (s_rng == 0) {
+    s_rng = 1;
+  }
+  printf("[can_filter_check] seme %lu\n", (unsigned long)s_rng);
+
+  static const size_t SIZES[] = { 1, 2, 16, 17, 64 };
+  static const Kind   KINDS[] = { Kind::STD, Kind::EXT, Kind::MIXED, Kind::J1939 };
+  for (Kind kind : KINDS) {
+    for (size_t n : SIZES) {
+      run_case(kind, n, !quick || n <= 2);
+    }
+  }
+
+  printf("[can_filter_check] %u controlli, %u errori\n", s_checks, s_errors);
+  return s_errors ? 1 : 0;
+}
@@ -0,0 +1,226 @@
+// ----------------------------------------------------
+// Verifiche del percorso RX di can_port sul TWAI finto (host/shim)
+// ----------------------------------------------------
+// Il task RX su host non gira: la verifica accoda i frame nel TWAI finto
+// (host_twai_push, che applica il filtro installato) e chiama
+// can_port_rx_poll() come farebbe il task.
+//
+// 1) Cambio di filtro HW con frame in coda: con più di due batch di frame
+//    gestiti ancora nel driver si apre il filtro (can_port_set_filter_open)
+//    e poi lo si richiude. La reinstallazione del driver non deve perdere
+//    nessun frame in coda; un ID non gestito passa solo a filtro aperto.
+// 2) Pagine del multiplexato VCU_Display_Diag una dietro l'altra nello
+//    stesso batch (più una pagina ripetuta): ogni pagina deve essere
+//    decodificata (segnali validi e cambiati) e contata dalla supervisione,
+//    non solo l'ultima come farebbe la last-value cache.
+// 3) Presa sul ring (can_port_get_frame): con una notifica rimasta da prima
+//    e il ring vuoto l'attesa deve durare tutto il timeout, non tornare
+//    subito; un frame già nel ring torna senza attesa.
+//
+// Uso: reefilla_can_port_check
+
+#include <Arduino.h>
+
+#include "host_hal.h"
+#include "can_port.h"
+#include "can_filter.h"
+#include "dbc_decoder.h"
+#include "dbc_supervise.h"
+
+static unsigned s_checks = 0;
+static unsigned s_errors = 0;
+
+static void check(const char *what, long got, long want)
+{
+  s_checks++;
+  if (got != want) {
+    s_errors++;
+    printf("[can_port_check] ERRORE %s: %ld invece di %ld\n", what, got, want);
+  }
+}
+
+static uint64_t s_now_us = 1000000;
+
+static bool push(uint32_t id, bool extended, const uint8_t *data = nullptr)
+{
+  twai_message_t msg = {};
+  msg.identifier       = id;
+  msg.extd             = extended;
+  msg.data_length_code = 8;
+  if (data) {
+    memcpy(msg.data, data, 8);
+  }
+  return host_twai_push(msg);
+}
+
+// Giri del task RX finché il driver ha frame in coda
+static size_t poll_all()
+{
+  size_t n = 0;
+  do {
+    n += can_port_rx_poll(0);
+  } while (host_twai_pending() > 0);
+  return n;
+}
+
+// Frame gestiti accodati in fila, a rotazione sugli ID del DBC
+static long queue_handled(const CanFilterId *ids, size_t n_ids, size_t count)
+{
+  long queued = 0;
+  for (size_t i = 0; i < count; ++i) {
+    const CanFilterId &fid = ids[i % n_ids];
+    queued += push(fid.id, fid.extended) ? 1 : 0;
+  }
+  return queued;
+}
+
+// ----------------------------------------------------
+// 1) Cambio di filtro con frame in coda
+// ----------------------------------------------------
+
+static void check_filter_reload()
+{
+  CanFilterId ids[64];
+  const size_t n_ids = dbc_get_handled_ids(ids, 64);
+
+  // Un ID standard che il filtro dal DBC scarta
+  uint32_t other = 0x7FF;
+  while (other > 0 && push(other, false)) {
+    poll_all();
+    other--;
+  }
+  check("ID non gestito trovato", other > 0, 1);
+
+  const size_t QUEUED = 40;   // più di due batch (CAN_RX_BATCH = 16)
+
+  // Apertura: i frame in coda passano tutti prima della reinstallazione
+  long queued = queue_handled(ids, n_ids, QUEUED);
+  check("frame accodati a filtro dal DBC", queued, QUEUED);
+  check("can_port_set_filter_open(true)", can_port_set_filter_open(true), 1);
+  s_now_us += 10000;
+  host_clock_set_us(s_now_us);
+  check("frame gestiti attraverso l'apertura", (long)poll_all(), queued);
+  check("ID non gestito a filtro aperto", push(other, false), 1);
+  check("frame non gestito ricevuto", (long)poll_all(), 1);
+
+  // Chiusura: in coda anche frame che il nuovo filtro scarterebbe
+  queued = queue_handled(ids, n_ids, QUEUED);
+  queued += push(other, false) ? 1 : 0;
+  check("frame accodati a filtro aperto", queued, QUEUED + 1);
+  check("can_port_set_filter_open(false)", can_port_set_filter_open(false), 1);
+  s_now_us += 10000;
+  host_clock_set_us(s_now_us);
+  check("frame gestiti attraverso la chiusura", (long)poll_all(), queued);
+  check("ID non gestito di nuovo scartato", push(other, false), 0);
+
+  // Stesso filtro: niente reinstallazione
+  check("can_port_update_filter() senza cambi", can_port_update_filter(), 1);
+  check("frame in coda dopo l'aggiornamento", (long)host_twai_pending(), 0);
+
+  printf("[can_port_check] filtro HW: %zu ID gestiti, ID 0x%03lX scartato dal DBC, "
+         "%zu frame in coda attraverso apertura e chiusura\n",
+         n_ids, (unsigned long)other, QUEUED);
+}
+
+// ----------------------------------------------------
+// 2) Pagine multiplexate nello stesso batch
+// ----------------------------------------------------
+
+static void check_mux_batch()
+{
+  const DbcMessageInfo &m = DBC_MESSAGES[DBC_MSG_VCU_DISPLAY_DIAG];
+
+  // Pagine 0, 1, 2 e di nuovo 0 con valori diversi, mai "invalid"
+  static const uint8_t PAGES[] = { 0, 1, 2, 0 };
+  const size_t N = sizeof(PAGES) / sizeof(PAGES[0]);
+  uint8_t  data[N][8];
+  uint32_t bits[N];
+  for (size_t i = 0; i < N; ++i) {
+    data[i][0] = PAGES[i];
+    for (int b = 1; b < 8; ++b) {
+      data[i][b] = (uint8_t)(0x10 * (i + 1) + b);
+    }
+    CanFrame f = {};
+    f.id       = m.id;
+    f.extended = m.extended;
+    f.dlc      = 8;
+    memcpy(f.data, data[i], 8);
+    int64_t raw[DBC_CHG_DECODED];
+    bits[i] = dbc_decode_raw(f, raw);
+  }
+
+  DbcState before;
+  const uint32_t version = dbc_snapshot(before);
+  const uint32_t frames  = dbc_supervise_get(DBC_MSG_VCU_DISPLAY_DIAG).frames;
+
+  s_now_us += 100000;
+  host_clock_set_us(s_now_us);
+  long queued = 0;
+  for (size_t i = 0; i < N; ++i) {
+    queued += push(m.id, m.extended, data[i]) ? 1 : 0;
+  }
+  check("pagine accodate", queued, (long)N);
+  check("pagine gestite in un giro", (long)can_port_rx_poll(0), (long)N);
+
+  DbcState after;
+  dbc_snapshot(after);
+  const uint32_t changed = dbc_changed_since(after, version);
+  char what[64];
+  for (size_t i = 0; i < N; ++i) {
+    snprintf(what, sizeof(what), "pagina %u: segnali validi", (unsigned)PAGES[i]);
+    check(what, (long)(after.valid_mask & bits[i]), (long)bits[i]);
+    snprintf(what, sizeof(what), "pagina %u: segnali cambiati", (unsigned)PAGES[i]);
+    check(what, (long)(changed & bits[i]), (long)bits[i]);
+  }
+  check("arrivi visti dalla supervisione",
+        (long)(dbc_supervise_get(DBC_MSG_VCU_DISPLAY_DIAG).frames - frames), (long)N);
+
+  printf("[can_port_check] %s: %zu pagine in un solo batch\n", m.name, N);
+}
+
+// ----------------------------------------------------
+// 3) Attesa sul ring con una notifica rimasta
+// ----------------------------------------------------
+
+static void check_get_frame_wait()
+{
+  CanFrame f;
+  const uint32_t TIMEOUT_MS = 50;
+
+  can_port_set_tap(true);
+  xTaskNotifyGive(xTaskGetCurrentTaskHandle());   // notifica rimasta
+  uint64_t t0 = host_clock_us();
+  check("frame dal ring vuoto", can_port_get_frame(f, TIMEOUT_MS), 0);
+  check("attesa a ring vuoto (ms)", (long)((host_clock_us() - t0) / 1000), TIMEOUT_MS);
+
+  CanFilterId ids[1];
+  dbc_get_handled_ids(ids, 1);
+  push(ids[0].id, ids[0].extended);
+  check("frame nel ring", (long)can_port_rx_poll(0), 1);
+  t0 = host_clock_us();
+  check("frame dal ring pieno", can_port_get_frame(f, TIMEOUT_MS), 1);
+  check("ID del frame dal ring", (long)f.id, (long)ids[0].id);
+  check("attesa a ring pieno (ms)", (long)((host_clock_us() - t0) / 1000), 0);
+  host_task_notify_take(xTaskGetCurrentTaskHandle());
+  can_port_set_tap(false);
+
+  printf("[can_port_check] ring RX: attesa di %lu ms con notifica rimasta\n",
+         (unsigned long)TIMEOUT_MS);
+}
+
+int main()
+{
+  host_serial_set_enabled(false);
+  host_clock_set_us(s_now_us);
+  if (!can_port_init() || !can_port_start()) {
+    fprintf(stderr, "can_port: inizializzazione fallita\n");
+    return 1;
+  }
+
+  check_filter_reload();
+  check_mux_batch();
+  check_get_frame_wait();
+
+  printf("[can_port_check] %u controlli, %u errori\n", s_checks, s_errors);
+  return s_errors ? 1 : 0;
+}
@@ -0,0 +1,95 @@
+// ----------------------------------------------------
+// Verifiche dell'azzeramento delle statistiche di inter-arrivo (can_stats)
+// ----------------------------------------------------
+// Il task RX su host non gira: la verifica chiama can_stats_record() come
+// farebbe lui, con i timestamp dei frame scelti a mano.
+//
+// 1) Bus fermo: dopo can_stats_reset(), senza nessun frame, letture e
+//    riepilogo vedono già la tabella vuota.
+// 2) Stesso ID dopo l'azzeramento: riparte da count = 1, senza il buco
+//    dall'ultimo frame di prima come periodo; i frame successivi contano
+//    solo i periodi nuovi.
+// 3) Un ID visto solo prima dell'azzeramento non torna in tabella.
+//
+// Uso: reefilla_can_stats_check
+
+#include <Arduino.h>
+
+#include "host_hal.h"
+#include "can_stats.h"
+
+static unsigned s_checks = 0;
+static unsigned s_errors = 0;
+
+static void check(const char *what, long got, long want)
+{
+  s_checks++;
+  if (got != want) {
+    s_errors++;
+    printf("[can_stats_check] ERRORE %s: %ld invece di %ld\n", what, got, want);
+  }
+}
+
+static void record(uint32_t id, bool extended, uint64_t t_us)
+{
+  CanFrame f = {};
+  f.id           = id;
+  f.extended     = extended;
+  f.dlc          = 8;
+  f.timestamp_us = t_us;
+  f.timestamp_ms = (uint32_t)(t_us / 1000U);
+  can_stats_record(f);
+}
+
+int main()
+{
+  host_serial_set_enabled(false);
+
+  const uint32_t ID       = 0x123;
+  const uint32_t OTHER_ID = 0x18FF0010;
+  const uint64_t PERIOD   = 100000;   // 100 ms
+  uint64_t t = 1000000;
+
+  // Prima dell'azzeramento: 10 frame a 100 ms e un ID esteso
+  for (int i = 0; i < 10; ++i, t += PERIOD) {
+    record(ID, false, t);
+  }
+  record(OTHER_ID, true, t);
+  CanIdStats st;
+  check("ID visto prima dell'azzeramento", can_stats_get(ID, false, st), 1);
+  check("frame prima dell'azzeramento", (long)st.count, 10);
+  check("periodo prima dell'azzeramento (us)", (long)st.period_max_us, (long)PERIOD);
+
+  // 1) Azzeramento a bus fermo
+  can_stats_reset();
+  CanIdStats all[4];
+  check("ID letto dopo l'azzeramento", can_stats_get(ID, false, st), 0);
+  check("snapshot dopo l'azzeramento", (long)can_stats_snapshot(all, 4), 0);
+  check("ID tracciati dopo l'azzeramento", (long)can_stats_summary().tracked_ids, 0);
+
+  // 2) Stesso ID dopo 48 s di silenzio
+  t += 48000000;
+  record(ID, false, t);
+  check("ID dopo l'azzeramento", can_stats_get(ID, false, st), 1);
+  check("frame dopo l'azzeramento", (long)st.count, 1);
+  check("periodo massimo dopo l'azzeramento (us)", (long)st.period_max_us, 0);
+  check("periodo medio dopo l'azzeramento (us)", (long)st.period_mean_us, 0);
+  check("primo frame dopo l'azzeramento (us)", (long)(st.first_us - t), 0);
+
+  t += PERIOD;
+  record(ID, false, t);
+  check("ID al secondo frame", can_stats_get(ID, false, st), 1);
+  check("frame al secondo frame", (long)st.count, 2);
+  check("periodo minimo al secondo frame (us)", (long)st.period_min_us, (long)PERIOD);
+  check("periodo massimo al secondo frame (us)", (long)st.period_max_us, (long)PERIOD);
+  check("periodo medio al secondo frame (us)", (long)st.period_mean_us, (long)PERIOD);
+
+  // 3) L'ID esteso non è più arrivato
+  check("ID esteso dopo l'azzeramento", can_stats_get(OTHER_ID, true, st), 0);
+  check("snapshot finale", (long)can_stats_snapshot(all, 4), 1);
+  check("ID tracciati alla fine", (long)can_stats_summary().tracked_ids, 1);
+
+  printf("[can_stats_check] azzeramento a bus fermo, ID di nuovo dopo 48 s\n");
+  printf("[can_stats_check] %u controlli, %u errori\n", s_checks, s_errors);
+  return s_errors ? 1 : 0;
+}
@@ -0,0 +1,28 @@
+// ----------------------------------------------------
+// Microbenchmark del decoder DBC su host
+// ----------------------------------------------------
+// Stesso codice del comando 'b' della console seriale (dbc_bench.cpp), con
+// un orologio reale al posto del clock virtuale dell'HAL finto.
+//
+// Uso: reefilla_dbc_bench [ITERAZIONI]
+
+#include <Arduino.h>
+
+#include <chrono>
+
+#include "dbc_bench.h"
+#include "dbc_decoder.h"
+
+static uint64_t host_now_ns()
+{
+  return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int main(int argc, char **argv)
+{
+  const uint32_t iterations = (argc > 1) ? (uint32_t)strtoul(argv[1], nullptr, 0) : 10000000U;
+  dbc_init();
+  dbc_bench_run(Serial, iterations, host_now_ns);
+  return 0;
+}
@@ -0,0 +1,199 @@
+// ----------------------------------------------------
+// Benchmark del lock LVGL (lv_port_lock.h) con render lunghi
+// ----------------------------------------------------
+// Tre thread come i task del device, sul clock reale (host_clock_set_real):
+//
+// - "ui" (thread principale): un frame ogni 30 ms sotto il lock, come
+//   ui_task_step: comandi UI, widget cambiati, lv_timer_handler(); un frame
+//   su RENDER_FULL_EVERY ridisegna tutto lo schermo (il render lungo)
+// - "rx": come can_rx_task, un giro ogni RX_PERIOD_US che passa un valore
+//   alla UI con ui_cmd_set_value (nessun lock); misura di quanto ogni giro
+//   parte in ritardo rispetto alla scadenza
+// - "console": ogni 5 ms legge un widget dentro lv_port_lock(20 ms), con una
+//   presa ricorsiva, e ogni tanto prova lv_port_lock(0)
+//
+// Il thread RX parte da solo per IDLE_MS: il ritardo a vuoto è il rumore dei
+// timer dell'host, da confrontare con quello sotto carico.
+//
+// Alla fine il dump del lock (contese, tenute, istogramma), il ritardo del
+// giro RX a confronto con la tenuta massima, e il controllo dei contatori:
+// prese = frame + prese della console, ricorsive e timeout come contati dai
+// thread.
+//
+// Uso: reefilla_lv_lock_bench [SECONDI]
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "host_hal.h"
+#include "headless_display.h"
+#include "lv_port_lock.h"
+#include "ui_cmd.h"
+
+using Clock = std::chrono::steady_clock;
+
+static constexpr unsigned LABELS            = 48;
+static constexpr unsigned FRAME_MS          = 30;
+static constexpr unsigned RENDER_FULL_EVERY = 10;
+static constexpr unsigned RX_PERIOD_US      = 1000;
+static constexpr unsigned CONSOLE_PERIOD_MS = 5;
+static constexpr unsigned IDLE_MS           = 1000;
+
+static lv_obj_t *s_labels[LABELS];
+static lv_obj_t *s_arc;
+
+struct Late
+{
+  uint32_t p99;
+  uint32_t max;
+  size_t   n;
+};
+
+static Late late_stats(std::vector<uint32_t> &v)
+{
+  std::sort(v.begin(), v.end());
+  const size_t n = v.size();
+  return { n ? v[n * 99 / 100] : 0, n ? v.back() : 0, n };
+}
+
+int main(int argc, char **argv)
+{
+  const double seconds = (argc > 1) ? atof(argv[1]) : 3.0;
+
+  host_clock_set_real(true);
+  headless_display_init();
+
+  for (unsigned i = 0; i < LABELS; ++i) {
+    s_labels[i] = lv_label_create(lv_scr_act());
+    lv_obj_set_pos(s_labels[i], 10 + 120 * (lv_coord_t)(i % 4), 10 + 38 * (lv_coord_t)(i / 4));
+    lv_label_set_text(s_labels[i], "0");
+  }
+  s_arc = lv_arc_create(lv_scr_act());
+  lv_obj_set_size(s_arc, 200, 200);
+  lv_obj_center(s_arc);
+  ui_cmd_bind(UI_W_SOC_VALUE, s_labels[0]);
+  ui_cmd_bind(UI_W_SOC_GAUGE, s_arc);
+  lv_timer_handler();
+
+  printf("[lv_lock_bench] %.1f s, frame ogni %u ms (pieno ogni %u), RX ogni %u us, "
+         "console ogni %u ms\n",
+         seconds, FRAME_MS, RENDER_FULL_EVERY, RX_PERIOD_US, CONSOLE_PERIOD_MS);
+
+  std::atomic<bool> stop{false};
+
+  // ---------------- rx ----------------
+  std::vector<uint32_t> idle_late_us, rx_late_us;
+  idle_late_us.reserve(IDLE_MS * 1000 / RX_PERIOD_US + 16);
+  rx_late_us.reserve((size_t)(seconds * 1e6 / RX_PERIOD_US) + 16);
+  std::atomic<bool> rx_rt{false};
+  std::atomic<bool> loaded{false};
+  std::thread rx([&] {
+    // Come CAN_RX_TASK_PRIO > UI_TASK_PRIO: se il sistema lo consente
+    // (root / CAP_SYS_NICE) il thread RX passa a SCHED_FIFO sopra gli altri
+    sched_param sp = {};
+    sp.sched_priority = 1;
+    rx_rt.store(pthread_setschedparam(pthread_self(), SCHED_FIFO, &sp) == 0);
+    Clock::time_point due = Clock::now();
+    int32_t v = 0;
+    while (!stop.load(std::memory_order_relaxed)) {
+      due += std::chrono::microseconds(RX_PERIOD_US);
+      std::this_thread::sleep_until(due);
+      const auto late = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - due);
+      const uint32_t us = (uint32_t)std::max<int64_t>(0, late.count());
+      (loaded.load(std::memory_order_relaxed) ? rx_late_us : idle_late_us).push_back(us);
+      ui_cmd_set_value(UI_W_SOC_VALUE, ++v);
+      ui_cmd_set_value(UI_W_SOC_GAUGE, v % 100);
+    }
+  });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(IDLE_MS));
+  loaded.store(true);
+
+  // ---------------- console ----------------
+  uint32_t con_ok = 0, con_fail = 0, try_ok = 0, try_fail = 0;
+  std::thread console([&] {
+    uint32_t n = 0;
+    while (!stop.load(std::memory_order_relaxed)) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(CONSOLE_PERIOD_MS));
+      if (++n % 8 == 0) {
+        if (lv_port_lock(0)) {
+          try_ok++;
+          lv_port_unlock();
+        } else {
+          try_fail++;
+        }
+        continue;
+      }
+      LvPortLockGuard g(20);
+      if (!g) {
+        con_fail++;
+        continue;
+      }
+      con_ok++;
+      LvPortLockGuard nested;   // ricorsiva: già del thread
+      (void)lv_label_get_text(s_labels[LABELS - 1]);
+    }
+  });
+
+  // ---------------- ui ----------------
+  uint32_t       frames  = 0;
+  uint32_t       last_ms = millis();
+  const auto     end     = Clock::now() + std::chrono::duration_cast<Clock::duration>(
+                                              std::chrono::duration<double>(seconds));
+  Clock::time_point next = Clock::now();
+  while (Clock::now() < end) {
+    lv_port_lock(-1);
+    const uint32_t now = millis();
+    lv_tick_inc(now - last_ms);
+    last_ms = now;
+    ui_cmd_drain();
+    char buf[12];
+    for (unsigned i = 1; i < LABELS; ++i) {
+      snprintf(buf, sizeof(buf), "%lu", (unsigned long)(frames * LABELS + i));
+      lv_label_set_text(s_labels[i], buf);
+    }
+    if (frames % RENDER_FULL_EVERY == 0) {
+      lv_obj_invalidate(lv_scr_act());
+    }
+    lv_timer_handler();
+    lv_port_unlock();
+    frames++;
+
+    next += std::chrono::milliseconds(FRAME_MS);
+    std::this_thread::sleep_until(next);
+  }
+  stop.store(true);
+  rx.join();
+  console.join();
+
+  const LvLockStats s = lv_port_lock_get_stats();
+  lv_port_lock_dump(Serial);
+
+  const Late idle = late_stats(idle_late_us);
+  const Late busy = late_stats(rx_late_us);
+  printf("[lv_lock_bench] RX %s, %u core: ritardo a vuoto p99 %lu us, max %lu us (%lu giri)\n",
+         rx_rt.load() ? "SCHED_FIFO" : "a priorità normale", std::thread::hardware_concurrency(),
+         (unsigned long)idle.p99, (unsigned long)idle.max, (unsigned long)idle.n);
+  printf("[lv_lock_bench] RX con %lu frame: ritardo p99 %lu us, max %lu us (%lu giri), "
+         "tenuta max del lock %lu us\n",
+         (unsigned long)frames, (unsigned long)busy.p99, (unsigned long)busy.max,
+         (unsigned long)busy.n, (unsigned long)s.hold_us_max);
+  printf("[lv_lock_bench] console: %lu prese, %lu timeout; lv_port_lock(0): %lu prese, %lu fallite\n",
+         (unsigned long)con_ok, (unsigned long)con_fail, (unsigned long)try_ok,
+         (unsigned long)try_fail);
+
+  const bool ok = s.acquired == frames + con_ok + try_ok && s.nested == con_ok &&
+                  s.timeouts == con_fail + try_fail;
+  printf("%s\n", ok ? "OK: prese, ricorsive e timeout coerenti con i thread"
+                    : "ERRORE: contatori del lock incoerenti");
+  return ok ? 0 : 1;
+}
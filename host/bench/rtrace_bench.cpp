@@ -0,0 +1,234 @@
+// ----------------------------------------------------
+// Costo dei punti di traccia di rendering (rtrace.h)
+// ----------------------------------------------------
+// Display headless 480x480 con etichette, archi, barre e un grafico, tutto
+// aggiornato a ogni frame come un cruscotto con il CAN attivo. Ogni frame è
+// un giro di lv_timer_handler() con i punti di ui_task_step, sul clock
+// reale (host_clock_set_real).
+//
+// Misura il tempo CPU per frame a coppie di blocchi (di default un frame)
+// con la registrazione spenta e accesa (ordine alternato tra un giro e l'altro) e riporta la mediana
+// della quota in più per coppia: su una macchina rumorosa le mediane dei
+// due tempi presi da soli si spostano più della differenza da misurare.
+// Riporta anche i punti e le chiamate di disegno tracciate e solo contate
+// per frame. Obiettivo: meno dell'1%. La build con RTRACE_ENABLED=0
+// (reefilla_rtrace_bench_off) dà il riferimento senza nessun punto
+// compilato, quella con RTRACE_DRAWS=1 (reefilla_rtrace_bench_draws) il
+// costo delle chiamate di disegno tracciate.
+//
+// Alla fine, con la registrazione accesa e un thread "RX" sul core 0 che
+// traccia decodifiche CAN finte, scrive il dump come lo manderebbe il
+// comando 'f' (RTRDUMP BEGIN/END) in FILE, da convertire con rtrace_json.
+//
+// Uso: reefilla_rtrace_bench [FRAME_PER_BLOCCO] [FILE]
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <time.h>
+
+#include "host_hal.h"
+#include "headless_display.h"
+#include "rtrace.h"
+
+using Clock = std::chrono::steady_clock;
+
+static constexpr unsigned LABELS  = 24;
+static constexpr unsigned ROUNDS  = 1001;
+static constexpr unsigned FRAME_MS = 30;
+
+static lv_obj_t          *s_labels[LABELS];
+static lv_obj_t          *s_arcs[2];
+static lv_obj_t          *s_bars[2];
+static lv_obj_t          *s_chart;
+static lv_chart_series_t *s_series;
+static uint32_t           s_frame = 0;
+
+class NullPrint : public Print
+{
+public:
+  size_t write(uint8_t c) override { (void)c; return 1; }
+  size_t write(const uint8_t *buf, size_t len) override { (void)buf; return len; }
+};
+
+class FilePrint : public Print
+{
+public:
+  explicit FilePrint(FILE *f) : f_(f) {}
+  size_t write(uint8_t c) override { return fputc(c, f_) == EOF ? 0 : 1; }
+  size_t write(const uint8_t *buf, size_t len) override { return fwrite(buf, 1, len, f_); }
+
+private:
+  FILE *f_;
+};
+
+static void build_screen()
+{
+  lv_obj_t *scr = lv_scr_act();
+  for (unsigned i = 0; i < LABELS; ++i) {
+    s_labels[i] = lv_label_create(scr);
+    lv_obj_set_pos(s_labels[i], 10 + 160 * (lv_coord_t)(i % 3), 10 + 22 * (lv_coord_t)(i / 3));
+  }
+  for (unsigned i = 0; i < 2; ++i) {
+    s_arcs[i] = lv_arc_create(scr);
+    lv_obj_set_size(s_arcs[i], 140, 140);
+    lv_obj_set_pos(s_arcs[i], 20 + 170 * (lv_coord_t)i, 190);
+    s_bars[i] = lv_bar_create(scr);
+    lv_obj_set_size(s_bars[i], 200, 16);
+    lv_obj_set_pos(s_bars[i], 20 + 230 * (lv_coord_t)i, 345);
+  }
+  s_chart = lv_chart_create(scr);
+  lv_obj_set_size(s_chart, 440, 100);
+  lv_obj_set_pos(s_chart, 20, 370);
+  lv_chart_set_point_count(s_chart, 60);
+  s_series = lv_chart_add_series(s_chart, lv_palette_main(LV_PALETTE_RED), LV_CHART_AXIS_PRIMARY_Y);
+}
+
+// Un frame come ui_task_step: valori nuovi, poi lv_timer_handler()
+static void frame()
+{
+  s_frame++;
+  char buf[24];
+  for (unsigned i = 0; i < LABELS; ++i) {
+    snprintf(buf, sizeof(buf), "SIG_%02u %5lu", i, (unsigned long)(s_frame * 7 + i * 13) % 10000);
+    lv_label_set_text(s_labels[i], buf);
+  }
+  for (unsigned i = 0; i < 2; ++i) {
+    lv_arc_set_value(s_arcs[i], (int16_t)((s_frame + 40 * i) % 100));
+    lv_bar_set_value(s_bars[i], (int32_t)((s_frame * 3 + 50 * i) % 100), LV_ANIM_OFF);
+  }
+  lv_chart_set_next_value(s_chart, s_series, (lv_coord_t)(50 + (int)(s_frame * 17 % 50)));
+
+  lv_tick_inc(FRAME_MS);
+  RTRACE_BEGIN(RTRACE_EV_TIMER_HANDLER, 0);
+  const uint32_t next = lv_timer_handler();
+  RTRACE_END(RTRACE_EV_TIMER_HANDLER, next);
+  (void)next;   // RTRACE_ENABLED=0
+}
+
+// Tempo di CPU del thread: non conta le prelazioni da altri processi, che
+// su una macchina carica spostano i blocchi più del costo dei punti
+static double thread_cpu_us()
+{
+  timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static double block_us_per_frame(unsigned frames)
+{
+  const double t0 = thread_cpu_us();
+  for (unsigned i = 0; i < frames; ++i) {
+    frame();
+  }
+  return (thread_cpu_us() - t0) / frames;
+}
+
+static double median(std::vector<double> v)
+{
+  std::sort(v.begin(), v.end());
+  return v[v.size() / 2];
+}
+
+int main(int argc, char **argv)
+{
+  const unsigned    frames = (argc > 1) ? (unsigned)atoi(argv[1]) : 1;
+  const char *const path   = (argc > 2) ? argv[2] : "rtrace_bench.bin";
+
+  host_clock_set_real(true);
+  host_task_set_core(1);   // il task UI
+  headless_display_init();
+  build_screen();
+  lv_timer_handler();
+
+  rtrace_init();
+  rtrace_lvgl_install();
+  for (unsigned i = 0; i < 20; ++i) {   // riscaldamento (cache dei glifi)
+    frame();
+  }
+
+  std::vector<double> off, on, extra;
+  const RtraceStats before = rtrace_get_stats();
+  for (unsigned r = 0; r < ROUNDS; ++r) {
+    double t_off, t_on;
+    if (r & 1U) {
+      rtrace_set_enabled(true);
+      t_on = block_us_per_frame(frames);
+      rtrace_set_enabled(false);
+      t_off = block_us_per_frame(frames);
+    } else {
+      rtrace_set_enabled(false);
+      t_off = block_us_per_frame(frames);
+      rtrace_set_enabled(true);
+      t_on = block_us_per_frame(frames);
+    }
+    off.push_back(t_off);
+    on.push_back(t_on);
+    extra.push_back((t_on - t_off) / t_off);
+  }
+  rtrace_set_enabled(false);
+
+#if RTRACE_ENABLED
+  const RtraceStats after  = rtrace_get_stats();
+  const double      n      = (double)ROUNDS * frames;
+  const double      points = (after.records[1] - before.records[1]) / n;
+  const double      off_us = median(off), on_us = median(on), pct = 100.0 * median(extra);
+  printf("[rtrace_bench] %u frame per blocco, %u coppie: spenta %.1f us/frame, accesa %.1f "
+         "us/frame, mediana per coppia %+.2f%% (obiettivo < 1%%)\n",
+         frames, ROUNDS, off_us, on_us, pct);
+  printf("[rtrace_bench] %.0f punti/frame (%.1f ns/punto in più); chiamate di disegno "
+         "%.0f tracciate e %.0f solo contate per frame (RTRACE_DRAWS=%d)\n",
+         points, points > 0 ? pct / 100.0 * off_us * 1000.0 / points : 0.0,
+         (after.draws_traced - before.draws_traced) / n,
+         (after.draws_counted - before.draws_counted) / n, RTRACE_DRAWS);
+#else
+  (void)before;
+  printf("[rtrace_bench] compilata via (RTRACE_ENABLED=0): %.1f us/frame (mediana di %u blocchi "
+         "da %u frame)\n", median(off), ROUNDS, frames);
+  return 0;
+#endif
+
+  // Cattura: un frame ogni FRAME_MS con un "RX" sul core 0
+  std::atomic<bool> stop{false};
+  std::thread rx([&] {
+    host_task_set_core(0);
+    uint32_t id = 0x100;
+    while (!stop.load(std::memory_order_relaxed)) {
+      RTRACE_BEGIN(RTRACE_EV_CAN_DECODE, id);
+      const Clock::time_point t0 = Clock::now();
+      while (Clock::now() - t0 < std::chrono::microseconds(20)) {
+      }
+      RTRACE_END(RTRACE_EV_CAN_DECODE, 0);
+      id = (id == 0x10F) ? 0x100 : id + 1;
+      std::this_thread::sleep_for(std::chrono::microseconds(500));
+    }
+  });
+  NullPrint discard;
+  rtrace_dump(discard);   // svuota i ring dai record delle misure
+  rtrace_set_enabled(true);
+  Clock::time_point next = Clock::now();
+  for (unsigned i = 0; i < 20; ++i) {
+    frame();
+    next += std::chrono::milliseconds(FRAME_MS);
+    std::this_thread::sleep_until(next);
+  }
+  stop.store(true);
+  rx.join();
+
+  FILE *f = fopen(path, "wb");
+  if (!f) {
+    fprintf(stderr, "rtrace_bench: impossibile scrivere %s\n", path);
+    return 1;
+  }
+  FilePrint fp(f);
+  rtrace_dump(fp);
+  fclose(f);
+  printf("[rtrace_bench] dump in %s (rtrace_json %s > trace.json)\n", path, path);
+  return 0;
+}
@@ -0,0 +1,178 @@
+// ----------------------------------------------------
+// Stress test del seqlock di DbcState (dbc_snapshot) su host
+// ----------------------------------------------------
+// Uno scrittore e un lettore su thread separati, senza pause:
+//
+// 1) Seqlock<Pattern> diretto: lo scrittore pubblica record in cui tutte le
+//    parole valgono k; il lettore verifica che ogni copia abbia un solo k e
+//    che le versioni non tornino indietro.
+// 2) Percorso vero del firmware: lo scrittore passa a dbc_handle_frame()
+//    frame di VCU_Display_Status con payload e timestamp derivati da k; il
+//    lettore prende dbc_snapshot(), ricava k dal timestamp e confronta lo
+//    snapshot con dbc_decode_frame() dello stesso frame.
+//
+// Qualunque snapshot "misto" (campi di due pubblicazioni) è un errore.
+//
+// Uso: reefilla_snapshot_stress [SECONDI_PER_FASE]
+
+#include <Arduino.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "host_hal.h"
+#include "dbc_decoder.h"
+#include "dbc_generated.h"
+#include "seqlock.h"
+
+using Clock = std::chrono::steady_clock;
+
+struct StressResult
+{
+  uint64_t writes = 0;
+  uint64_t reads  = 0;
+  uint64_t torn   = 0;
+  uint64_t stale  = 0;   // versione tornata indietro
+};
+
+static void report(const char *phase, const StressResult &r, double seconds)
+{
+  printf("[%s] %llu pubblicazioni, %llu letture (%.1f M/s), %llu snapshot misti, %llu versioni all'indietro\n",
+         phase, (unsigned long long)r.writes, (unsigned long long)r.reads,
+         seconds > 0 ? r.reads / seconds / 1e6 : 0.0,
+         (unsigned long long)r.torn, (unsigned long long)r.stale);
+}
+
+// Scrittore e lettore in parallelo per seconds secondi
+template <typename Writer, typename Reader>
+static StressResult run_pair(double seconds, Writer writer, Reader reader)
+{
+  StressResult r;
+  std::atomic<bool> stop{false};
+
+  std::thread w([&] {
+    uint64_t k = 0;
+    while (!stop.load(std::memory_order_relaxed)) {
+      writer(++k);
+    }
+    r.writes = k;
+  });
+
+  const Clock::time_point end = Clock::now() + std::chrono::duration_cast<Clock::duration>(
+                                                   std::chrono::duration<double>(seconds));
+  uint32_t last_version = 0;
+  while (Clock::now() < end) {
+    for (int i = 0; i < 1024; ++i) {
+      uint32_t version = 0;
+      if (!reader(version)) {
+        r.torn++;
+      }
+      if (version < last_version) {
+        r.stale++;
+      }
+      last_version = version;
+      r.reads++;
+    }
+  }
+  stop.store(true);
+  w.join();
+  return r;
+}
+
+// ----------------------------------------------------
+// Fase 1: Seqlock diretto
+// ----------------------------------------------------
+
+struct Pattern
+{
+  uint32_t word[24];   // più grande di DbcState: copia più lunga, più sovrapposizioni
+};
+
+static bool stress_seqlock(double seconds)
+{
+  static Seqlock<Pattern> lock;
+
+  const StressResult r = run_pair(
+      seconds,
+      [&](uint64_t k) {
+        Pattern p;
+        for (uint32_t &w : p.word) {
+          w = (uint32_t)k;
+        }
+        lock.publish(p);
+      },
+      [&](uint32_t &version) {
+        Pattern p;
+        version = lock.read(p);
+        for (uint32_t w : p.word) {
+          if (w != p.word[0]) {
+            return false;
+          }
+        }
+        return true;
+      });
+
+  report("seqlock", r, seconds);
+  return r.torn == 0 && r.stale == 0;
+}
+
+// ----------------------------------------------------
+// Fase 2: dbc_handle_frame -> dbc_snapshot
+// ----------------------------------------------------
+
+static void make_frame(uint64_t k, CanFrame &f)
+{
+  const DbcMessageInfo &m = DBC_MESSAGES[DBC_MSG_VCU_DISPLAY_STATUS];
+  memset(&f, 0, sizeof(f));
+  f.id           = m.id;
+  f.extended     = m.extended;
+  f.dlc          = 8;
+  f.timestamp_ms = (uint32_t)k;   // chiave per ricostruire il frame dal lato lettore
+  for (int b = 0; b < 8; ++b) {
+    f.data[b] = (uint8_t)((k * 0x9E3779B1U) >> (b * 3));
+  }
+}
+
+static bool stress_decoder(double seconds)
+{
+  const StressResult r = run_pair(
+      seconds,
+      [&](uint64_t k) {
+        CanFrame f;
+        make_frame(k, f);
+        dbc_handle_frame(f);
+      },
+      [&](uint32_t &version) {
+        DbcState snap{};
+        version = dbc_snapshot(snap);
+        if (version == 0) {
+          return true;
+        }
+        CanFrame f;
+        make_frame(snap.status_lastUpdate_ms, f);
+        DbcState expected{};
+        dbc_decode_frame(f, expected);
+        memcpy(expected.change_seq, snap.change_seq, sizeof(snap.change_seq));   // non dipendono dal frame
+        expected.valid_mask = snap.valid_mask;
+        expected.derived    = snap.derived;      // dipendono dalla storia dei frame
+        return memcmp(&snap, &expected, sizeof(DbcState)) == 0;
+      });
+
+  report("dbc_snapshot", r, seconds);
+  return r.torn == 0 && r.stale == 0;
+}
+
+int main(int argc, char **argv)
+{
+  const double seconds = (argc > 1) ? atof(argv[1]) : 2.0;
+
+  host_serial_set_enabled(false);
+  dbc_init();
+
+  const bool ok_lock = stress_seqlock(seconds);
+  const bool ok_dbc  = stress_decoder(seconds);
+
+  printf("%s\n", (ok_lock && ok_dbc) ? "OK: nessuno snapshot misto" : "ERRORE: snapshot misti");
+  return (ok_lock && ok_dbc) ? 0 : 1;
+}
@@ -0,0 +1,202 @@
+// ----------------------------------------------------
+// Benchmark del ring SPSC (spsc_ring.h) del task RX CAN
+// ----------------------------------------------------
+// Un thread produttore inserisce elementi grandi come un CanFrame a raffiche
+// di push_n (1..CAN_RX_BATCH, come i batch del task RX); un thread
+// consumatore li estrae con pop_n fino a POP_MAX alla volta. Tre prove per
+// capacità:
+//
+// - max: consumatore sempre in giro, produttore al massimo (throughput)
+// - lento: il consumatore dorme 1 ms tra due svuotamenti, come un task
+//   svegliato dal tick (il ring deve assorbire le raffiche)
+// - fermo: consumatore assente per metà prova (overflow atteso: il ring
+//   scarta i frame nuovi, mai quelli già dentro)
+//
+// Con un solo core i due thread si alternano e la prova max misura solo il
+// produttore: i numeri di throughput hanno senso da 2 core in su.
+//
+// Riporta elementi al secondo, dimensione media dei pop_n, overflow e i
+// controlli: ogni elemento letto è intero, le sequenze crescono sempre e
+// i buchi sono esattamente gli elementi contati in overflow.
+//
+// Uso: reefilla_spsc_bench [SECONDI_PER_PROVA]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "spsc_ring.h"
+
+using Clock = std::chrono::steady_clock;
+
+static constexpr size_t CAN_RX_BATCH = 16;   // come can_port.cpp
+static constexpr size_t POP_MAX      = 64;
+
+// Stessa dimensione di CanFrame (32 byte), campi derivati dalla sequenza
+struct Item
+{
+  uint64_t seq;
+  uint32_t id;
+  uint8_t  dlc;
+  uint8_t  data[8];
+  uint8_t  pad[7];
+  uint32_t check;
+};
+
+static_assert(sizeof(Item) == 32, "Item: dimensione di un CanFrame");
+
+static Item make_item(uint64_t seq)
+{
+  Item it = {};
+  it.seq = seq;
+  it.id  = (uint32_t)(seq * 2654435761U) & 0x7FFU;
+  it.dlc = (uint8_t)(seq & 7U) + 1;
+  for (int i = 0; i < 8; ++i) {
+    it.data[i] = (uint8_t)(seq >> (i * 3));
+  }
+  it.check = (uint32_t)seq ^ it.id ^ 0xA5A5A5A5U;
+  return it;
+}
+
+static bool item_ok(const Item &it)
+{
+  const Item x = make_item(it.seq);
+  return it.id == x.id && it.dlc == x.dlc && memcmp(it.data, x.data, 8) == 0 && it.check == x.check;
+}
+
+enum class Mode { MAX, SLOW, STALL };
+
+static const char *mode_name(Mode m)
+{
+  return m == Mode::MAX ? "max" : m == Mode::SLOW ? "lento" : "fermo";
+}
+
+struct Result
+{
+  uint64_t pushed   = 0;   // offerti al ring (entrati + overflow)
+  uint64_t popped   = 0;
+  uint64_t pops     = 0;   // pop_n con almeno un elemento
+  uint64_t overflow = 0;
+  uint64_t torn     = 0;
+  uint64_t order    = 0;
+  uint64_t gaps     = 0;   // sequenze mai arrivate al consumatore
+  double   seconds  = 0;
+};
+
+static Result run(size_t capacity, Mode mode, double seconds)
+{
+  std::unique_ptr<Item[]> storage(new Item[capacity]);
+  SpscRing<Item> ring;
+  ring.init(storage.get(), capacity);
+
+  Result            r;
+  std::atomic<bool> stop{false};
+  std::atomic<bool> producer_done{false};
+
+  uint64_t expected = 0;
+  std::thread consumer([&] {
+    Item out[POP_MAX];
+    const Clock::time_point t0 = Clock::now();
+    while (true) {
+      if (mode == Mode::STALL &&
+          Clock::now() - t0 < std::chrono::duration<double>(seconds / 2)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        continue;
+      }
+      const size_t n = ring.pop_n(out, POP_MAX);
+      if (n == 0) {
+        if (producer_done.load(std::memory_order_acquire) && ring.size() == 0) {
+          break;
+        }
+        if (mode != Mode::MAX) {
+          std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        continue;
+      }
+      r.pops++;
+      r.popped += n;
+      for (size_t i = 0; i < n; ++i) {
+        if (!item_ok(out[i])) {
+          r.torn++;
+        }
+        if (out[i].seq < expected) {
+          r.order++;
+        } else {
+          r.gaps  += out[i].seq - expected;
+          expected = out[i].seq + 1;
+        }
+      }
+      if (mode == Mode::SLOW) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+    }
+  });
+
+  Item     batch[CAN_RX_BATCH];
+  uint64_t seq  = 0;
+  uint32_t rng  = 12345;
+  const Clock::time_point t0 = Clock::now();
+  while (!stop.load(std::memory_order_relaxed)) {
+    for (int k = 0; k < 64; ++k) {
+      rng = rng * 1664525U + 1013904223U;
+      const size_t n = 1 + (rng >> 24) % CAN_RX_BATCH;
+      for (size_t i = 0; i < n; ++i) {
+        batch[i] = make_item(seq + i);
+      }
+      ring.push_n(batch, n);
+      seq += n;
+      if (mode != Mode::MAX) {
+        // Ritmo da bus pieno: una raffica ogni ~100 us
+        const Clock::time_point tb = Clock::now();
+        while (Clock::now() - tb < std::chrono::microseconds(100)) {
+        }
+      }
+    }
+    if (Clock::now() - t0 >= std::chrono::duration<double>(seconds)) {
+      stop.store(true);
+    }
+  }
+  r.seconds = std::chrono::duration<double>(Clock::now() - t0).count();
+  producer_done.store(true, std::memory_order_release);
+  consumer.join();
+
+  r.pushed   = seq;
+  r.gaps    += seq - expected;   // scartati dopo l'ultimo letto
+  r.overflow = ring.overflow_count();
+  return r;
+}
+
+int main(int argc, char **argv)
+{
+  const double seconds = (argc > 1) ? atof(argv[1]) : 1.0;
+  bool ok = true;
+
+  printf("[spsc_bench] elemento %zu byte, push_n 1..%zu, pop_n fino a %zu, %.1f s per prova, "
+         "%u core\n", sizeof(Item), CAN_RX_BATCH, POP_MAX, seconds,
+         std::thread::hardware_concurrency());
+  printf("%9s %6s %12s %12s %10s %10s %6s %6s %6s\n", "capacità", "prova", "offerti/s",
+         "letti/s", "pop medio", "overflow", "rotti", "ordine", "conto");
+  static const size_t CAPACITY[] = { 64, 256, 1024 };   // 256 = CAN_RX_RING_LEN
+  static const Mode    MODE[]     = { Mode::MAX, Mode::SLOW, Mode::STALL };
+  for (size_t capacity : CAPACITY) {
+    for (Mode mode : MODE) {
+      const Result r = run(capacity, mode, seconds);
+      // Ogni elemento offerto è stato letto o contato in overflow, e i
+      // buchi visti dal consumatore sono solo quelli
+      const bool count_ok = r.popped + r.overflow == r.pushed && r.gaps == r.overflow;
+      const bool run_ok   = count_ok && r.torn == 0 && r.order == 0;
+      ok = ok && run_ok;
+      printf("%9zu %6s %12.0f %12.0f %10.1f %10llu %6llu %6llu %6s\n", capacity, mode_name(mode),
+             r.pushed / r.seconds, r.popped / r.seconds, r.pops ? (double)r.popped / r.pops : 0.0,
+             (unsigned long long)r.overflow, (unsigned long long)r.torn,
+             (unsigned long long)r.order, count_ok ? "ok" : "ERR");
+    }
+  }
+  printf("[spsc_bench] %s\n", ok ? "tutti i controlli superati" : "ERRORE: controlli falliti");
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,153 @@
+// ----------------------------------------------------
+// Profilo dei task (task_prof.h) su uno scenario noto
+// ----------------------------------------------------
+// I task su host non girano: il driver fa avanzare il clock virtuale a
+// fette da 1 ms e assegna il run-time di ogni fetta ai task finti
+// (host_task_add_run_time) secondo il carico della fase, il resto agli idle
+// dei due core. Due fasi come sul device:
+//
+// - ferma: UI a eventi, loop() ogni 20 ms
+// - scroll: il task UI (priorità 2) tiene il core 1 quasi pieno e loop()
+//   (priorità 1) gira solo negli spazi che gli lascia, ogni ~300 ms; il
+//   task RX lavora di più e il suo stack arriva più in fondo
+//
+// A ogni finestra chiama task_prof_sample() come il task di campionamento,
+// confronta CPU per task, carico dei core, loop() fermo e stack con quello
+// assegnato (±1‰) e scrive il frame del campione come il comando 'j' in
+// FILE, da leggere con task_prof_decode.
+//
+// Uso: reefilla_task_prof_bench [SECONDI_PER_FASE] [FILE]
+
+#include <Arduino.h>
+
+#include <stdlib.h>
+
+#include "host_hal.h"
+#include "task_prof.h"
+
+struct Load
+{
+  const char  *name;
+  TaskHandle_t task;
+  int          core;
+  UBaseType_t  prio;
+  uint32_t     stack;
+  uint16_t     permille[2];      // ferma, scroll
+  uint32_t     stack_used[2];
+};
+
+static void dummy_task(void *arg)
+{
+  (void)arg;
+}
+
+static Load s_loads[] = {
+  { "can_rx_task", nullptr, 0, CAN_RX_TASK_PRIO, CAN_RX_TASK_STACK, {  40,  90 }, { 1900, 2900 } },
+  { "dlog_task",   nullptr, 0, DLOG_TASK_PRIO,   DLOG_TASK_STACK,   {  10,  25 }, { 1400, 1500 } },
+  { "ui_task",     nullptr, 1, UI_TASK_PRIO,     UI_TASK_STACK,     { 120, 950 }, { 4100, 5300 } },
+  { "loopTask",    nullptr, 1, 1,                8192,              {  10,   5 }, { 2200, 2200 } },
+};
+
+static const char *const PHASE_NAME[] = { "ferma", "scroll" };
+static const uint32_t    LOOP_EVERY_MS[] = { 20, 300 };
+
+static unsigned s_checks = 0;
+static unsigned s_errors = 0;
+
+static void check(const char *what, long got, long want, long tol)
+{
+  s_checks++;
+  if (labs(got - want) > tol) {
+    s_errors++;
+    printf("[task_prof_bench] ERRORE %s: %ld invece di %ld\n", what, got, want);
+  }
+}
+
+static const TaskProfTask *find(const TaskProfSnapshot &s, const char *name)
+{
+  for (uint8_t i = 0; i < s.count; ++i) {
+    if (strcmp(s.task[i].name, name) == 0) {
+      return &s.task[i];
+    }
+  }
+  return nullptr;
+}
+
+int main(int argc, char **argv)
+{
+  const unsigned    seconds = (argc > 1) ? (unsigned)atoi(argv[1]) : 5;
+  const char *const path    = (argc > 2) ? argv[2] : "task_prof_bench.bin";
+
+  FILE *f = fopen(path, "wb");
+  if (!f) {
+    fprintf(stderr, "task_prof_bench: impossibile scrivere %s\n", path);
+    return 1;
+  }
+
+  for (Load &l : s_loads) {
+    xTaskCreatePinnedToCore(dummy_task, l.name, l.stack, nullptr, l.prio, &l.task, l.core);
+  }
+  task_prof_start();
+  host_clock_set_us(1000000);
+  task_prof_sample();   // apre la prima finestra
+
+  uint8_t  frame[TASK_PROF_FRAME_MAX];
+  uint64_t now_us = 1000000;
+  uint32_t loop_last_ms = 0;
+  for (int phase = 0; phase < 2; ++phase) {
+    for (const Load &l : s_loads) {
+      host_task_set_stack_used(l.task, l.stack_used[phase]);
+    }
+    for (unsigned sec = 0; sec < seconds; ++sec) {
+      uint32_t gap_max_ms = 0;
+      for (unsigned ms = 0; ms < TASK_PROF_PERIOD_MS; ++ms) {
+        uint32_t busy[2] = { 0, 0 };
+        for (const Load &l : s_loads) {
+          // ‰ come µs per fetta da 1 ms
+          host_task_add_run_time(l.task, l.permille[phase]);
+          busy[l.core] += l.permille[phase];
+        }
+        for (int c = 0; c < 2; ++c) {
+          host_task_add_run_time(xTaskGetIdleTaskHandleForCore(c), 1000U - busy[c]);
+        }
+        now_us += 1000;
+        host_clock_set_us(now_us);
+
+        const uint32_t now_ms = (uint32_t)(now_us / 1000U);
+        if (now_ms - loop_last_ms >= LOOP_EVERY_MS[phase]) {
+          if (loop_last_ms && now_ms - loop_last_ms > gap_max_ms) {
+            gap_max_ms = now_ms - loop_last_ms;
+          }
+          loop_last_ms = now_ms;
+          task_prof_loop_tick();
+        }
+      }
+      task_prof_sample();
+
+      TaskProfSnapshot s;
+      task_prof_get(s);
+      fwrite(frame, 1, task_prof_encode(s, frame), f);
+
+      uint32_t load[2] = { 0, 0 };
+      for (const Load &l : s_loads) {
+        const TaskProfTask *t = find(s, l.name);
+        check(l.name, t ? t->cpu_permille : -1, l.permille[phase], 1);
+        check(l.name, t ? (long)(t->stack_size - t->stack_free_min) : -1, l.stack_used[phase], 0);
+        load[l.core] += l.permille[phase];
+      }
+      check("carico core 0", s.core_load_permille[0], load[0], 1);
+      check("carico core 1", s.core_load_permille[1], load[1], 1);
+      // Il campione vede anche l'intervallo ancora aperto di loop()
+      const uint32_t open_ms = (uint32_t)(now_us / 1000U) - loop_last_ms;
+      check("loop() fermo", (long)(s.loop_gap_max_us / 1000U),
+            (long)(gap_max_ms > open_ms ? gap_max_ms : open_ms), 1);
+    }
+    printf("[task_prof_bench] fase %s, ultimo campione:\n", PHASE_NAME[phase]);
+    task_prof_dump(Serial);
+  }
+  fclose(f);
+
+  printf("[task_prof_bench] %u controlli, %u errori; campioni in %s (task_prof_decode %s)\n",
+         s_checks, s_errors, path, path);
+  return s_errors ? 1 : 0;
+}
@@ -0,0 +1,257 @@
+// ----------------------------------------------------
+// Benchmark della coda dei comandi UI (ui_cmd.h) con 1..4 produttori
+// ----------------------------------------------------
+// I produttori girano su thread separati e accodano valori crescenti,
+// ognuno sui propri widget; il thread principale fa il task UI: a ogni giro
+// ui_cmd_drain() e lv_timer_handler() sul display headless. Per ogni N:
+//
+// - costo di ui_cmd_set_value per il produttore (con la contesa sulla CAS)
+// - costo del drain per comando estratto, quota superata dalla
+//   coalescenza, comandi scartati per coda piena
+// - controlli: il valore mostrato da ogni widget non torna mai indietro,
+//   a fine prova è l'ultimo accodato dal suo produttore, e
+//   applicati + superati = accodati
+//
+// In coda al test, un confronto a thread singolo con lv_async_call (un
+// lv_timer allocato per ogni chiamata), il modo "standard" di LVGL per
+// far arrivare lavoro al task UI.
+//
+// Uso: reefilla_ui_cmd_bench [SECONDI_PER_PROVA] [COMANDI_AL_SECONDO_PER_PRODUTTORE]
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "host_hal.h"
+#include "headless_display.h"
+#include "ui_cmd.h"
+
+using Clock = std::chrono::steady_clock;
+
+static constexpr unsigned MAX_PRODUCERS = 4;
+static constexpr unsigned WIDGETS_EACH  = 2;   // widget per produttore
+static constexpr uint32_t ASYNC_CMDS    = 20000;
+static constexpr uint32_t ASYNC_BATCH   = 50;
+
+static_assert(MAX_PRODUCERS * WIDGETS_EACH <= UI_W_COUNT, "troppi widget per il bench");
+
+static lv_obj_t *s_labels[UI_W_COUNT];
+
+static int32_t label_value(unsigned w)
+{
+  return (int32_t)atol(lv_label_get_text(s_labels[w]));
+}
+
+struct RunResult
+{
+  uint64_t   posted      = 0;
+  uint64_t   rejected    = 0;   // ui_cmd_set_value == false (coda piena)
+  double     post_ns     = 0;   // per comando, media sui produttori
+  double     drain_ns    = 0;   // per comando estratto
+  uint64_t   drains      = 0;
+  UiCmdStats stats       = {};
+  bool       ok          = true;
+};
+
+static RunResult run(unsigned producers, double seconds, double rate)
+{
+  for (unsigned w = 0; w < UI_W_COUNT; ++w) {
+    lv_label_set_text(s_labels[w], "0");
+  }
+  const UiCmdStats before = ui_cmd_get_stats();
+
+  std::atomic<bool>     stop{false};
+  std::atomic<unsigned> done{0};
+  std::vector<int32_t>  last(producers * WIDGETS_EACH, 0);
+  std::vector<uint64_t> posted(producers, 0), rejected(producers, 0);
+  std::vector<double>   busy_s(producers, 0.0);
+
+  std::vector<std::thread> threads;
+  for (unsigned p = 0; p < producers; ++p) {
+    threads.emplace_back([&, p] {
+      const Clock::time_point t0 = Clock::now();
+      int32_t v = 0;
+      while (!stop.load(std::memory_order_relaxed)) {
+        if (rate > 0) {
+          const auto due = t0 + std::chrono::duration_cast<Clock::duration>(
+                                    std::chrono::duration<double>(posted[p] / rate));
+          while (Clock::now() < due && !stop.load(std::memory_order_relaxed)) {
+            std::this_thread::yield();
+          }
+        }
+        ++v;
+        const unsigned w = p * WIDGETS_EACH + (unsigned)v % WIDGETS_EACH;
+        const Clock::time_point c0 = Clock::now();
+        const bool ok = ui_cmd_set_value((UiWidget)w, v);
+        busy_s[p] += std::chrono::duration<double>(Clock::now() - c0).count();
+        if (ok) {
+          posted[p]++;
+          last[w] = v;
+        } else {
+          rejected[p]++;   // coda piena: il valore si perde, si passa al prossimo
+          std::this_thread::yield();
+        }
+      }
+      done.fetch_add(1);
+    });
+  }
+
+  // Task UI: svuota e ridisegna finché i produttori non hanno finito e la
+  // coda è vuota
+  RunResult out;
+  std::vector<int32_t> shown(producers * WIDGETS_EACH, 0);
+  double drain_s = 0;
+  uint64_t drained = 0;
+  const Clock::time_point end = Clock::now() + std::chrono::duration_cast<Clock::duration>(
+                                                   std::chrono::duration<double>(seconds));
+  while (true) {
+    if (Clock::now() >= end) {
+      stop.store(true);
+    }
+    const Clock::time_point d0 = Clock::now();
+    const size_t n = ui_cmd_drain();
+    drain_s += std::chrono::duration<double>(Clock::now() - d0).count();
+    drained += n;
+    out.drains += n ? 1 : 0;
+    lv_tick_inc(1);
+    lv_timer_handler();
+
+    for (unsigned w = 0; w < shown.size(); ++w) {
+      const int32_t v = label_value(w);
+      if (v < shown[w]) {
+        printf("  widget %u: valore tornato indietro (%ld -> %ld)\n", w, (long)shown[w], (long)v);
+        out.ok = false;
+      }
+      shown[w] = v;
+    }
+    if (done.load() == producers && n == 0) {
+      break;
+    }
+  }
+  for (std::thread &t : threads) {
+    t.join();
+  }
+  ui_cmd_drain();
+
+  const UiCmdStats after = ui_cmd_get_stats();
+  out.stats.posted    = after.posted - before.posted;
+  out.stats.dropped   = after.dropped - before.dropped;
+  out.stats.applied   = after.applied - before.applied;
+  out.stats.coalesced = after.coalesced - before.coalesced;
+  out.stats.unbound   = after.unbound - before.unbound;
+  out.stats.max_batch = after.max_batch;
+
+  double post_s = 0;
+  for (unsigned p = 0; p < producers; ++p) {
+    out.posted   += posted[p];
+    out.rejected += rejected[p];
+    post_s       += busy_s[p];
+  }
+  out.post_ns  = (out.posted + out.rejected) ? post_s * 1e9 / (out.posted + out.rejected) : 0.0;
+  out.drain_ns = drained ? drain_s * 1e9 / drained : 0.0;
+
+  for (unsigned w = 0; w < last.size(); ++w) {
+    if (label_value(w) != last[w]) {
+      printf("  widget %u: mostra %ld, ultimo accodato %ld\n", w, (long)label_value(w), (long)last[w]);
+      out.ok = false;
+    }
+  }
+  if (out.stats.posted != out.posted || out.stats.dropped != out.rejected ||
+      out.stats.applied + out.stats.coalesced != out.stats.posted || out.stats.unbound) {
+    printf("  contatori incoerenti: accodati %lu/%llu, scartati %lu/%llu, applicati %lu, superati %lu\n",
+           (unsigned long)out.stats.posted, (unsigned long long)out.posted,
+           (unsigned long)out.stats.dropped, (unsigned long long)out.rejected,
+           (unsigned long)out.stats.applied, (unsigned long)out.stats.coalesced);
+    out.ok = false;
+  }
+  return out;
+}
+
+// ----------------------------------------------------
+// Confronto con lv_async_call (thread singolo)
+// ----------------------------------------------------
+
+static void async_set_cb(void *arg)
+{
+  char buf[12];
+  snprintf(buf, sizeof(buf), "%ld", (long)(intptr_t)arg);
+  if (strcmp(lv_label_get_text(s_labels[0]), buf) != 0) {
+    lv_label_set_text(s_labels[0], buf);
+  }
+}
+
+static double async_ns_per_cmd()
+{
+  const Clock::time_point t0 = Clock::now();
+  for (uint32_t i = 1; i <= ASYNC_CMDS; ++i) {
+    lv_async_call(async_set_cb, (void *)(intptr_t)i);
+    if (i % ASYNC_BATCH == 0) {
+      lv_timer_handler();
+    }
+  }
+  lv_timer_handler();
+  return std::chrono::duration<double>(Clock::now() - t0).count() * 1e9 / ASYNC_CMDS;
+}
+
+static double ui_cmd_ns_per_cmd()
+{
+  const Clock::time_point t0 = Clock::now();
+  for (uint32_t i = 1; i <= ASYNC_CMDS; ++i) {
+    ui_cmd_set_value(UI_W_SOC_VALUE, (int32_t)i);
+    if (i % ASYNC_BATCH == 0) {
+      ui_cmd_drain();
+      lv_timer_handler();
+    }
+  }
+  ui_cmd_drain();
+  lv_timer_handler();
+  return std::chrono::duration<double>(Clock::now() - t0).count() * 1e9 / ASYNC_CMDS;
+}
+
+int main(int argc, char **argv)
+{
+  const double seconds = (argc > 1) ? atof(argv[1]) : 1.0;
+  const double rate    = (argc > 2) ? atof(argv[2]) : 0.0;
+
+  host_serial_set_enabled(false);
+  headless_display_init();
+  for (unsigned w = 0; w < UI_W_COUNT; ++w) {
+    s_labels[w] = lv_label_create(lv_scr_act());
+    lv_obj_set_pos(s_labels[w], 10, 10 + 40 * (lv_coord_t)w);
+    ui_cmd_bind((UiWidget)w, s_labels[w]);
+  }
+
+  printf("[ui_cmd_bench] coda da %u comandi da %u byte, %s, %.1f s per prova, %u core\n",
+         (unsigned)UI_CMD_QUEUE_LEN, (unsigned)sizeof(UiCmd),
+         rate > 0 ? "ritmo fisso" : "produttori a ritmo libero", seconds,
+         std::thread::hardware_concurrency());
+  if (rate > 0) {
+    printf("[ui_cmd_bench] %.0f comandi/s per produttore\n", rate);
+  }
+
+  bool ok = true;
+  for (unsigned n = 1; n <= MAX_PRODUCERS; ++n) {
+    const RunResult r = run(n, seconds, rate);
+    printf("[ui_cmd_bench] %u produttori: %9llu accodati, post %6.1f ns, drain %6.1f ns/comando, "
+           "superati %5.1f%%, scartati %llu, max %lu per giro%s\n",
+           n, (unsigned long long)r.posted, r.post_ns, r.drain_ns,
+           r.posted ? 100.0 * r.stats.coalesced / r.posted : 0.0,
+           (unsigned long long)r.rejected, (unsigned long)r.stats.max_batch,
+           r.ok ? "" : "  ERRORE");
+    ok = ok && r.ok;
+  }
+
+  const double async_ns = async_ns_per_cmd();
+  const double cmd_ns   = ui_cmd_ns_per_cmd();
+  printf("[ui_cmd_bench] thread singolo, %u comandi a blocchi di %u: lv_async_call %.1f ns/comando, "
+         "ui_cmd %.1f ns/comando\n",
+         (unsigned)ASYNC_CMDS, (unsigned)ASYNC_BATCH, async_ns, cmd_ns);
+
+  printf("%s\n", ok ? "OK: valori mai all'indietro, ultimo valore sempre mostrato, contatori coerenti"
+                    : "ERRORE");
+  return ok ? 0 : 1;
+}
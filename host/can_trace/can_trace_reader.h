@@ -0,0 +1,138 @@
+#pragma once
+
+// ----------------------------------------------------
+// Lettore host (Linux) delle tracce CAN registrate dal firmware
+// ----------------------------------------------------
+// Mappa il file in memoria (mmap, anche multi-GB) e itera blocchi e frame
+// senza copie: CanTraceRecord::data punta direttamente dentro il file.
+// Accetta sia i dump da partizione flash (blocchi contigui) sia le catture
+// della seriale ("CTRDUMP BEGIN" ... "CTRDUMP END"): i blocchi vengono
+// riconosciuti dal magic e validati, tutto il resto è saltato.
+//
+// Uso:
+//   CanTraceFile trace;
+//   if (!trace.open("bus.ctr")) ...
+//   trace.for_each_frame([](const CanTraceRecord &r) { ... });
+//
+// Il formato è definito in can_trace_format.h (nella cartella dello sketch,
+// da aggiungere agli include path).
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "can_trace_format.h"
+
+class CanTraceFile
+{
+public:
+  CanTraceFile() = default;
+  CanTraceFile(const CanTraceFile &) = delete;
+  CanTraceFile &operator=(const CanTraceFile &) = delete;
+  ~CanTraceFile() { close(); }
+
+  bool open(const char *path)
+  {
+    close();
+
+    const int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+      return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+      ::close(fd);
+      return false;
+    }
+
+    void *p = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED) {
+      return false;
+    }
+
+    madvise(p, (size_t)st.st_size, MADV_SEQUENTIAL);
+    base_ = static_cast<const uint8_t *>(p);
+    size_ = (size_t)st.st_size;
+    return true;
+  }
+
+  void close()
+  {
+    if (base_) {
+      munmap(const_cast<uint8_t *>(base_), size_);
+    }
+    base_ = nullptr;
+    size_ = 0;
+  }
+
+  const uint8_t *data() const { return base_; }
+  size_t         size() const { return size_; }
+
+  // Prossimo blocco valido a partire da offset (incluso).
+  // Ritorna il puntatore al blocco, oppure nullptr a fine file.
+  const uint8_t *find_block(size_t &offset) const
+  {
+    while (offset + sizeof(CanTraceBlockHeader) <= size_) {
+      const uint8_t *p = base_ + offset;
+
+      // Allineamento veloce per i file di soli blocchi, scansione byte per
+      // byte solo dove c'è testo della seriale in mezzo
+      uint32_t magic;
+      memcpy(&magic, p, sizeof(magic));
+      if (magic == CAN_TRACE_MAGIC && can_trace_block_valid(p, size_ - offset)) {
+        return p;
+      }
+
+      const void *next = memchr(p + 1, (int)(CAN_TRACE_MAGIC & 0xFFU),
+                                size_ - offset - 1);
+      if (!next) {
+        offset = size_;
+        return nullptr;
+      }
+      offset = (size_t)(static_cast<const uint8_t *>(next) - base_);
+    }
+    return nullptr;
+  }
+
+  // Chiama fn(const uint8_t *block) per ogni blocco valido, in ordine di file
+  template <typename Fn>
+  size_t for_each_block(Fn fn) const
+  {
+    size_t count = 0;
+    size_t offset = 0;
+    while (const uint8_t *block = find_block(offset)) {
+      fn(block);
+      ++count;
+      // Un blocco può essere troncato solo in coda al file
+      offset += CAN_TRACE_BLOCK_SIZE;
+    }
+    return count;
+  }
+
+  // Chiama fn(const CanTraceRecord &) per ogni frame. Ritorna i frame letti.
+  template <typename Fn>
+  uint64_t for_each_frame(Fn fn) const
+  {
+    uint64_t frames = 0;
+    for_each_block([&](const uint8_t *block) {
+      CanTraceCursor cur(block);
+      CanTraceRecord rec;
+      while (cur.next(rec)) {
+        fn(rec);
+        ++frames;
+      }
+    });
+    return frames;
+  }
+
+private:
+  const uint8_t *base_ = nullptr;
+  size_t         size_ = 0;
+};
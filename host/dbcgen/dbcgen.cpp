@@ -0,0 +1,767 @@
+// ----------------------------------------------------
+// dbcgen: .dbc -> header C++ di descrittori constexpr
+// ----------------------------------------------------
+// Legge un file DBC (BO_, SG_, CM_, BA_ GenMsgCycleTime / InvalidRawValue,
+// VAL_) e genera un header con:
+// - tabella dei messaggi (DbcMessageInfo) in ordine di slot dell'hash
+//   perfetto, con indici DBC_MSG_*
+// - un DbcSignal constexpr per ogni segnale (DBC_SIG_<MSG>_<SEGNALE>); i
+//   segnali multiplexati (m<n>) portano il loro valore (dbc_muxed) e ogni
+//   messaggio multiplexato ha DBC_MUX_COUNT_<MSG> (valori della jump table)
+// - le stringhe delle tabelle VAL_ (dbc_str_<msg>_<segnale>(raw))
+// - il perfect hash (ID, esteso) -> indice messaggio (vedi dbc_signal.h)
+//
+// L'header generato è versionato insieme allo sketch (Arduino IDE non
+// esegue generatori): la build host lo rigenera in modalità --check e
+// fallisce se non è allineato al .dbc.
+//
+// Uso:
+//   dbcgen [--check] input.dbc output.h
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "can_dispatch.h"
+
+// ----------------------------------------------------
+// Modello
+// ----------------------------------------------------
+
+struct Signal
+{
+  std::string name;
+  unsigned    start_bit = 0;
+  unsigned    length    = 0;
+  bool        motorola  = false;
+  bool        is_signed = false;
+  double      factor    = 1.0;
+  double      offset    = 0.0;
+  double      min       = 0.0;
+  double      max       = 0.0;
+  std::string unit;
+  std::string comment;
+  bool        has_invalid = false;
+  uint64_t    invalid_raw = 0;
+  bool        mux_switch  = false;   // "M"
+  int         mux_value   = -1;      // "m<n>"
+  std::vector<std::pair<int64_t, std::string>> values;   // VAL_
+};
+
+struct Message
+{
+  uint32_t    raw_id   = 0;   // come nel DBC (bit 31 = esteso)
+  uint32_t    id       = 0;
+  bool        extended = false;
+  std::string name;
+  unsigned    dlc      = 0;
+  std::string sender;
+  std::string comment;
+  unsigned    cycle_ms = 0;
+  std::vector<Signal> signals;
+};
+
+// ----------------------------------------------------
+// Tokenizer
+// ----------------------------------------------------
+
+struct Token
+{
+  enum Kind { Ident, Number, String, Punct } kind;
+  std::string text;
+  int line;
+};
+
+[[noreturn]] static void fail(const char *msg, int line)
+{
+  fprintf(stderr, "dbcgen: riga %d: %s\n", line, msg);
+  exit(1);
+}
+
+static std::vector<Token> tokenize(const std::string &src)
+{
+  std::vector<Token> out;
+  int line = 1;
+  size_t i = 0;
+
+  while (i < src.size()) {
+    const char c = src[i];
+    if (c == '\n') {
+      line++;
+      i++;
+    } else if (isspace((unsigned char)c)) {
+      i++;
+    } else if (c == '"') {
+      std::string s;
+      const int start_line = line;
+      i++;
+      while (i < src.size() && src[i] != '"') {
+        if (src[i] == '\\' && i + 1 < src.size()) {
+          i++;
+        }
+        if (src[i] == '\n') {
+          line++;
+        }
+        s += src[i++];
+      }
+      if (i >= src.size()) {
+        fail("stringa non terminata", start_line);
+      }
+      i++;
+      out.push_back({ Token::String, s, start_line });
+    } else if (isdigit((unsigned char)c) ||
+               ((c == '-' || c == '.') && i + 1 < src.size() &&
+                (isdigit((unsigned char)src[i + 1]) || src[i + 1] == '.'))) {
+      size_t j = i + 1;
+      while (j < src.size() &&
+             (isalnum((unsigned char)src[j]) || src[j] == '.' ||
+              ((src[j] == '-' || src[j] == '+') && (src[j - 1] == 'e' || src[j - 1] == 'E')))) {
+        j++;
+      }
+      out.push_back({ Token::Number, src.substr(i, j - i), line });
+      i = j;
+    } else if (isalpha((unsigned char)c) || c == '_') {
+      size_t j = i + 1;
+      while (j < src.size() && (isalnum((unsigned char)src[j]) || src[j] == '_')) {
+        j++;
+      }
+      out.push_back({ Token::Ident, src.substr(i, j - i), line });
+      i = j;
+    } else {
+      out.push_back({ Token::Punct, std::string(1, c), line });
+      i++;
+    }
+  }
+  return out;
+}
+
+// ----------------------------------------------------
+// Parser
+// ----------------------------------------------------
+
+class Parser
+{
+public:
+  explicit Parser(std::vector<Token> toks) : t_(std::move(toks)) {}
+
+  std::vector<Message> parse()
+  {
+    while (!eof()) {
+      const Token &tok = peek();
+      if (tok.kind == Token::Ident && tok.text == "NS_") {
+        skip_ns();
+      } else if (tok.kind == Token::Ident && tok.text == "BO_") {
+        parse_message();
+      } else if (tok.kind == Token::Ident && tok.text == "SG_") {
+        parse_signal();
+      } else if (tok.kind == Token::Ident && tok.text == "CM_") {
+        parse_comment();
+      } else if (tok.kind == Token::Ident && tok.text == "BA_") {
+        parse_attribute();
+      } else if (tok.kind == Token::Ident && tok.text == "VAL_") {
+        parse_values();
+      } else if (tok.kind == Token::Ident &&
+                 (tok.text == "BA_DEF_" || tok.text == "BA_DEF_DEF_" ||
+                  tok.text == "VAL_TABLE_" || tok.text == "SIG_VALTYPE_" ||
+                  tok.text == "BO_TX_BU_" || tok.text == "SG_MUL_VAL_")) {
+        skip_statement();
+      } else {
+        skip_line();   // VERSION, BS_, BU_, ...
+      }
+    }
+    return std::move(msgs_);
+  }
+
+private:
+  bool eof() const { return pos_ >= t_.size(); }
+  const Token &peek() const { return t_[pos_]; }
+
+  const Token &next()
+  {
+    if (eof()) {
+      fail("fine file inattesa", t_.empty() ? 0 : t_.back().line);
+    }
+    return t_[pos_++];
+  }
+
+  const Token &expect(Token::Kind kind, const char *what)
+  {
+    const Token &tok = next();
+    if (tok.kind != kind) {
+      char buf[128];
+      snprintf(buf, sizeof(buf), "atteso %s, trovato '%s'", what, tok.text.c_str());
+      fail(buf, tok.line);
+    }
+    return tok;
+  }
+
+  void expect_punct(char c)
+  {
+    const Token &tok = next();
+    if (tok.kind != Token::Punct || tok.text[0] != c) {
+      char buf[64];
+      snprintf(buf, sizeof(buf), "atteso '%c', trovato '%s'", c, tok.text.c_str());
+      fail(buf, tok.line);
+    }
+  }
+
+  double number()
+  {
+    return strtod(expect(Token::Number, "numero").text.c_str(), nullptr);
+  }
+
+  uint64_t unsigned_number()
+  {
+    return strtoull(expect(Token::Number, "numero").text.c_str(), nullptr, 0);
+  }
+
+  void skip_line()
+  {
+    const int line = next().line;
+    while (!eof() && peek().line == line) {
+      pos_++;
+    }
+  }
+
+  void skip_statement()
+  {
+    while (!eof() && !(peek().kind == Token::Punct && peek().text == ";")) {
+      pos_++;
+    }
+    if (!eof()) {
+      pos_++;
+    }
+  }
+
+  // NS_ : seguito dall'elenco indentato delle keyword, fino a BS_
+  void skip_ns()
+  {
+    pos_++;
+    while (!eof() && !(peek().kind == Token::Ident && peek().text == "BS_")) {
+      pos_++;
+    }
+  }
+
+  Message *find(uint32_t raw_id, int line)
+  {
+    for (Message &m : msgs_) {
+      if (m.raw_id == raw_id) {
+        return &m;
+      }
+    }
+    fail("messaggio non definito", line);
+  }
+
+  Signal *find(Message &m, const std::string &name, int line)
+  {
+    for (Signal &s : m.signals) {
+      if (s.name == name) {
+        return &s;
+      }
+    }
+    fail("segnale non definito", line);
+  }
+
+  // BO_ <id> <nome>: <dlc> <trasmettitore>
+  void parse_message()
+  {
+    const int line = next().line;
+    Message m;
+    m.raw_id   = (uint32_t)unsigned_number();
+    m.extended = (m.raw_id & 0x80000000U) != 0;
+    m.id       = m.raw_id & 0x7FFFFFFFU;
+    m.name     = expect(Token::Ident, "nome messaggio").text;
+    expect_punct(':');
+    m.dlc      = (unsigned)unsigned_number();
+    if (!eof() && peek().line == line && peek().kind == Token::Ident) {
+      m.sender = next().text;
+    }
+    if (m.dlc > 8) {
+      fail("DLC > 8 non supportato (solo CAN classico)", line);
+    }
+    msgs_.push_back(m);
+  }
+
+  // SG_ <nome> [M|m<n>] : <start>|<len>@<ordine><segno> (<f>,<o>) [<min>|<max>] "<unità>" <ricevitori>
+  void parse_signal()
+  {
+    const int line = next().line;
+    if (msgs_.empty()) {
+      fail("SG_ fuori da un BO_", line);
+    }
+
+    Signal s;
+    s.name = expect(Token::Ident, "nome segnale").text;
+    if (peek().kind == Token::Ident) {
+      const std::string mux = next().text;
+      if (mux == "M") {
+        s.mux_switch = true;
+      } else if (mux.size() > 1 && mux[0] == 'm' && isdigit((unsigned char)mux[1])) {
+        s.mux_value = atoi(mux.c_str() + 1);
+        if (mux.back() == 'M') {
+          fail("multiplexing esteso non supportato", line);
+        }
+      } else {
+        fail("indicatore di multiplexing non valido", line);
+      }
+    }
+    expect_punct(':');
+    s.start_bit = (unsigned)unsigned_number();
+    expect_punct('|');
+    s.length = (unsigned)unsigned_number();
+    expect_punct('@');
+
+    // "1+" / "0-": il tokenizer può leggere "1" o "0" come numero
+    const Token &order = expect(Token::Number, "byte order");
+    s.motorola = (order.text == "0");
+    const Token &sign = expect(Token::Punct, "segno");
+    s.is_signed = (sign.text == "-");
+
+    expect_punct('(');
+    s.factor = number();
+    expect_punct(',');
+    s.offset = number();
+    expect_punct(')');
+    expect_punct('[');
+    s.min = number();
+    expect_punct('|');
+    s.max = number();
+    expect_punct(']');
+    s.unit = expect(Token::String, "unità").text;
+
+    while (!eof() && peek().line == line) {
+      pos_++;   // ricevitori
+    }
+
+    if (s.length == 0 || s.length > 64) {
+      fail("lunghezza segnale non valida", line);
+    }
+    msgs_.back().signals.push_back(s);
+  }
+
+  // CM_ [BO_ <id> | SG_ <id> <segnale>] "<testo>";
+  void parse_comment()
+  {
+    const int line = next().line;
+    if (peek().kind == Token::Ident && peek().text == "BO_") {
+      pos_++;
+      Message *m = find((uint32_t)unsigned_number(), line);
+      m->comment = expect(Token::String, "commento").text;
+    } else if (peek().kind == Token::Ident && peek().text == "SG_") {
+      pos_++;
+      Message *m = find((uint32_t)unsigned_number(), line);
+      Signal *s  = find(*m, expect(Token::Ident, "segnale").text, line);
+      s->comment = expect(Token::String, "commento").text;
+    }
+    skip_statement();
+  }
+
+  // BA_ "GenMsgCycleTime" BO_ <id> <ms>;
+  // BA_ "InvalidRawValue" SG_ <id> <segnale> <raw>;
+  void parse_attribute()
+  {
+    const int line = next().line;
+    const std::string name = expect(Token::String, "nome attributo").text;
+
+    if (name == "GenMsgCycleTime" && peek().kind == Token::Ident && peek().text == "BO_") {
+      pos_++;
+      Message *m = find((uint32_t)unsigned_number(), line);
+      m->cycle_ms = (unsigned)unsigned_number();
+      if (m->cycle_ms > 65535) {
+        fail("GenMsgCycleTime fuori range", line);
+      }
+    } else if (name == "InvalidRawValue" && peek().kind == Token::Ident && peek().text == "SG_") {
+      pos_++;
+      Message *m = find((uint32_t)unsigned_number(), line);
+      Signal *s  = find(*m, expect(Token::Ident, "segnale").text, line);
+      s->has_invalid = true;
+      s->invalid_raw = unsigned_number();
+    }
+    skip_statement();
+  }
+
+  // VAL_ <id> <segnale> <valore> "<testo>" ... ;
+  void parse_values()
+  {
+    const int line = next().line;
+    Message *m = find((uint32_t)unsigned_number(), line);
+    Signal *s  = find(*m, expect(Token::Ident, "segnale").text, line);
+    while (!eof() && peek().kind == Token::Number) {
+      const int64_t v = strtoll(next().text.c_str(), nullptr, 0);
+      s->values.push_back({ v, expect(Token::String, "descrizione").text });
+    }
+    expect_punct(';');
+    std::sort(s->values.begin(), s->values.end());
+  }
+
+  std::vector<Token>   t_;
+  size_t               pos_ = 0;
+  std::vector<Message> msgs_;
+};
+
+// ----------------------------------------------------
+// Hash perfetto minimo (costruzione in can_dispatch.h)
+// ----------------------------------------------------
+
+struct Phf
+{
+  std::vector<uint16_t> seeds;
+  std::vector<uint32_t> slot_of;   // indice messaggio -> slot
+};
+
+static bool build_phf(const std::vector<uint32_t> &keys, Phf &out)
+{
+  const uint32_t n = (uint32_t)keys.size();
+  std::vector<uint32_t> slot_keys(n);
+  out.slot_of.assign(n, 0);
+
+  for (uint32_t buckets = dbc_phf_buckets_for(n); buckets <= n + 1; buckets *= 2) {
+    out.seeds.assign(buckets, 0);
+    if (dbc_phf_build(keys.data(), n, out.seeds.data(), buckets,
+                      out.slot_of.data(), slot_keys.data())) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// ----------------------------------------------------
+// Generazione
+// ----------------------------------------------------
+
+// CamelCase -> SNAKE_CASE maiuscolo
+static std::string upper_snake(const std::string &s)
+{
+  std::string out;
+  for (size_t i = 0; i < s.size(); ++i) {
+    const char c = s[i];
+    if (isupper((unsigned char)c) && i > 0 && s[i - 1] != '_' &&
+        (islower((unsigned char)s[i - 1]) ||
+         (i + 1 < s.size() && islower((unsigned char)s[i + 1]) && isupper((unsigned char)s[i - 1])))) {
+      out += '_';
+    }
+    out += (char)toupper((unsigned char)c);
+  }
+  return out;
+}
+
+static std::string lower_snake(const std::string &s)
+{
+  std::string out = upper_snake(s);
+  for (char &c : out) {
+    c = (char)tolower((unsigned char)c);
+  }
+  return out;
+}
+
+static std::string c_string(const std::string &s)
+{
+  std::string out = "\"";
+  for (char c : s) {
+    if (c == '"' || c == '\\') {
+      out += '\\';
+    }
+    out += c;
+  }
+  return out + "\"";
+}
+
+static std::string c_float(double v)
+{
+  char buf[64];
+  snprintf(buf, sizeof(buf), "%.9g", v);
+  std::string s = buf;
+  if (s.find_first_of(".eEn") == std::string::npos) {
+    s += ".0";
+  }
+  return s + "f";
+}
+
+static std::string c_comment(const std::string &s)
+{
+  std::string out;
+  for (char c : s) {
+    out += (c == '\n' || c == '\r') ? ' ' : c;
+  }
+  return out;
+}
+
+static std::string generate(const std::vector<Message> &msgs, const std::vector<uint16_t> &seeds,
+                            const std::string &source)
+{
+  std::ostringstream o;
+  char buf[256];
+
+  o << "#pragma once\n\n"
+    << "// ----------------------------------------------------\n"
+    << "// GENERATO da host/dbcgen a partire da " << source << ": NON MODIFICARE\n"
+    << "// ----------------------------------------------------\n"
+    << "// Rigenerare con: cmake --build <build-host> --target dbcgen_update\n\n"
+    << "#include \"dbc_signal.h\"\n\n";
+
+  // ---- Indici dei messaggi (= slot dell'hash perfetto) ----
+  o << "// ---- Messaggi ----\n\n"
+    << "enum DbcMessageIndex : uint16_t\n{\n";
+  for (size_t i = 0; i < msgs.size(); ++i) {
+    o << "  DBC_MSG_" << upper_snake(msgs[i].name) << " = " << i << ",\n";
+  }
+  o << "  DBC_MESSAGE_COUNT = " << msgs.size() << ",\n};\n\n";
+
+  for (const Message &m : msgs) {
+    if (!m.comment.empty()) {
+      o << "// " << c_comment(m.comment) << "\n";
+    }
+    snprintf(buf, sizeof(buf), "constexpr uint32_t DBC_ID_%s = 0x%08lXUL;\n",
+             upper_snake(m.name).c_str(), (unsigned long)m.id);
+    o << buf;
+  }
+  o << "\n";
+
+  o << "constexpr DbcMessageInfo DBC_MESSAGES[DBC_MESSAGE_COUNT] = {\n";
+  for (const Message &m : msgs) {
+    snprintf(buf, sizeof(buf), "  { %s, 0x%08lXUL, %s, %u, %u },\n",
+             c_string(m.name).c_str(), (unsigned long)m.id,
+             m.extended ? "true" : "false", m.dlc, m.cycle_ms);
+    o << buf;
+  }
+  o << "};\n\n";
+
+  // ---- Segnali ----
+  o << "// ---- Segnali ----\n";
+  for (const Message &m : msgs) {
+    o << "\n// " << m.name << "\n";
+    for (const Signal &s : m.signals) {
+      if (!s.comment.empty()) {
+        o << "// " << c_comment(s.comment) << "\n";
+      }
+      o << "constexpr DbcSignal DBC_SIG_" << upper_snake(m.name) << "_" << upper_snake(s.name)
+        << " =\n    " << (s.mux_value >= 0 ? "dbc_muxed(" : "") << "dbc_signal(" << c_string(s.name) << ", " << c_string(s.unit) << ", "
+        << s.start_bit << ", " << s.length << ", "
+        << (s.motorola ? "DbcByteOrder::Motorola" : "DbcByteOrder::Intel") << ", "
+        << (s.is_signed ? "true" : "false") << ", "
+        << c_float(s.factor) << ", " << c_float(s.offset);
+      if (s.has_invalid) {
+        snprintf(buf, sizeof(buf), ", dbc_invalid(0x%llX)", (unsigned long long)s.invalid_raw);
+        o << buf;
+      }
+      o << ")";
+      if (s.mux_value >= 0) {
+        o << ", " << s.mux_value << ")";
+      }
+      o << ";\n";
+    }
+
+    int mux_max = -1;
+    for (const Signal &s : m.signals) {
+      mux_max = std::max(mux_max, s.mux_value);
+    }
+    if (mux_max >= 0) {
+      o << "// Valori del multiplexor di " << m.name << " (jump table, vedi dbc_mux_table)\n"
+        << "constexpr size_t DBC_MUX_COUNT_" << upper_snake(m.name) << " = " << (mux_max + 1) << ";\n";
+    }
+  }
+  o << "\n";
+
+  // ---- Tabelle VAL_ ----
+  bool any_values = false;
+  for (const Message &m : msgs) {
+    for (const Signal &s : m.signals) {
+      if (s.values.empty()) {
+        continue;
+      }
+      if (!any_values) {
+        o << "// ---- Tabelle VAL_: nullptr se il valore non ha descrizione ----\n\n";
+        any_values = true;
+      }
+
+      const std::string fn = "dbc_str_" + lower_snake(m.name) + "_" + lower_snake(s.name);
+      const int64_t lo = s.values.front().first;
+      const int64_t hi = s.values.back().first;
+
+      if (lo >= 0 && hi < 256) {
+        // Tabella diretta indicizzata dal raw
+        o << "inline const char *" << fn << "(int64_t raw)\n{\n"
+          << "  static constexpr const char *const TABLE[" << (hi + 1) << "] = {\n";
+        size_t k = 0;
+        for (int64_t v = 0; v <= hi; ++v) {
+          if (k < s.values.size() && s.values[k].first == v) {
+            o << "    " << c_string(s.values[k].second) << ",\n";
+            k++;
+          } else {
+            o << "    nullptr,\n";
+          }
+        }
+        o << "  };\n"
+          << "  return (raw >= 0 && raw <= " << hi << ") ? TABLE[raw] : nullptr;\n"
+          << "}\n\n";
+      } else {
+        o << "inline const char *" << fn << "(int64_t raw)\n{\n"
+          << "  switch (raw) {\n";
+        for (const auto &v : s.values) {
+          o << "    case " << v.first << ": return " << c_string(v.second) << ";\n";
+        }
+        o << "    default: return nullptr;\n  }\n}\n\n";
+      }
+    }
+  }
+
+  // ---- Hash perfetto ----
+  std::vector<uint32_t> keys;
+  for (const Message &m : msgs) {
+    keys.push_back(dbc_phf_key(m.id, m.extended));
+  }
+
+  o << "// ---- Hash perfetto minimo (ID, esteso) -> DbcMessageIndex ----\n\n"
+    << "constexpr uint16_t DBC_PHF_SEEDS[] = {";
+  for (size_t b = 0; b < seeds.size(); ++b) {
+    o << (b ? ", " : " ") << seeds[b];
+  }
+  o << " };\n\n"
+    << "constexpr uint32_t DBC_PHF_KEYS[DBC_MESSAGE_COUNT] = {";
+  for (size_t i = 0; i < keys.size(); ++i) {
+    snprintf(buf, sizeof(buf), "%s0x%08lXU", i ? ", " : " ", (unsigned long)keys[i]);
+    o << buf;
+  }
+  o << " };\n\n"
+    << "constexpr DbcPhf DBC_PHF = {\n"
+    << "  DBC_PHF_SEEDS, sizeof(DBC_PHF_SEEDS) / sizeof(DBC_PHF_SEEDS[0]),\n"
+    << "  DBC_PHF_KEYS, DBC_MESSAGE_COUNT,\n"
+    << "};\n\n"
+    << "// Indice del messaggio (DbcMessageIndex) oppure -1 se non è nel DBC\n"
+    << "inline int dbc_message_find(uint32_t id, bool extended)\n{\n"
+    << "  return dbc_phf_find(DBC_PHF, id, extended);\n"
+    << "}\n";
+
+  return o.str();
+}
+
+// I messaggi vengono riordinati per slot: così lo slot è l'indice
+static std::vector<Message> order_by_slot(const std::vector<Message> &msgs, const Phf &phf)
+{
+  std::vector<Message> out(msgs.size());
+  for (size_t i = 0; i < msgs.size(); ++i) {
+    out[phf.slot_of[i]] = msgs[i];
+  }
+  return out;
+}
+
+static bool read_file(const char *path, std::string &out)
+{
+  std::ifstream f(path, std::ios::binary);
+  if (!f) {
+    return false;
+  }
+  std::stringstream ss;
+  ss << f.rdbuf();
+  out = ss.str();
+  return true;
+}
+
+int main(int argc, char **argv)
+{
+  bool check = false;
+  int  arg   = 1;
+  if (arg < argc && !strcmp(argv[arg], "--check")) {
+    check = true;
+    arg++;
+  }
+  if (argc - arg != 2) {
+    fprintf(stderr, "uso: dbcgen [--check] input.dbc output.h\n");
+    return 2;
+  }
+  const char *in_path  = argv[arg];
+  const char *out_path = argv[arg + 1];
+
+  std::string src;
+  if (!read_file(in_path, src)) {
+    fprintf(stderr, "dbcgen: impossibile leggere %s\n", in_path);
+    return 1;
+  }
+
+  std::vector<Message> msgs = Parser(tokenize(src)).parse();
+  if (msgs.empty()) {
+    fprintf(stderr, "dbcgen: nessun messaggio in %s\n", in_path);
+    return 1;
+  }
+  if (msgs.size() > 0xFFFF) {
+    fprintf(stderr, "dbcgen: troppi messaggi (%zu)\n", msgs.size());
+    return 1;
+  }
+  for (size_t i = 0; i < msgs.size(); ++i) {
+    for (size_t j = i + 1; j < msgs.size(); ++j) {
+      if (msgs[i].raw_id == msgs[j].raw_id) {
+        fprintf(stderr, "dbcgen: ID duplicato %s / %s\n", msgs[i].name.c_str(), msgs[j].name.c_str());
+        return 1;
+      }
+    }
+  }
+
+  // Multiplexing semplice: un solo multiplexor per messaggio, da al più
+  // 8 bit (la jump table ha un caso per valore)
+  for (const Message &m : msgs) {
+    const Signal *mux = nullptr;
+    int mux_max = -1;
+    for (const Signal &s : m.signals) {
+      if (s.mux_switch) {
+        if (mux) {
+          fprintf(stderr, "dbcgen: %s: più di un multiplexor\n", m.name.c_str());
+          return 1;
+        }
+        mux = &s;
+      }
+      mux_max = std::max(mux_max, s.mux_value);
+    }
+    if (mux_max >= 0 && !mux) {
+      fprintf(stderr, "dbcgen: %s: segnali m<n> senza multiplexor M\n", m.name.c_str());
+      return 1;
+    }
+    if (mux && (mux->length > 8 || mux_max > 255)) {
+      fprintf(stderr, "dbcgen: %s: multiplexor oltre 8 bit non supportato\n", m.name.c_str());
+      return 1;
+    }
+  }
+
+  // Nel commento solo il nome del file: l'header non dipende dal percorso
+  std::string source = in_path;
+  const size_t slash = source.find_last_of('/');
+  if (slash != std::string::npos) {
+    source = source.substr(slash + 1);
+  }
+
+  std::vector<uint32_t> keys;
+  for (const Message &m : msgs) {
+    keys.push_back(dbc_phf_key(m.id, m.extended));
+  }
+  Phf phf;
+  if (!build_phf(keys, phf)) {
+    fprintf(stderr, "dbcgen: impossibile costruire l'hash perfetto\n");
+    return 1;
+  }
+
+  const std::string text = generate(order_by_slot(msgs, phf), phf.seeds, source);
+
+  if (check) {
+    std::string current;
+    if (!read_file(out_path, current) || current != text) {
+      fprintf(stderr, "dbcgen: %s non è allineato a %s (target dbcgen_update)\n", out_path, in_path);
+      return 1;
+    }
+    return 0;
+  }
+
+  std::ofstream f(out_path, std::ios::binary);
+  f << text;
+  if (!f) {
+    fprintf(stderr, "dbcgen: impossibile scrivere %s\n", out_path);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,202 @@
+// ----------------------------------------------------
+// Decoder del log binario (dlog) catturato dalla seriale
+// ----------------------------------------------------
+// Cerca i frame di dlog_format.h nel flusso, ne verifica il checksum e
+// stampa una riga di testo per record, con la stessa formattazione del
+// firmware in modalità testo e il timestamp del device davanti. I byte che
+// non sono frame (testo stampato con Serial, dump di altri comandi) passano
+// così come sono, a meno di --frames-only.
+//
+// Uso:
+//   dlog_decode [--frames-only] [cattura.bin | -]
+//
+// Esempio di cattura: comando 'l' sulla console, poi
+//   cat /dev/ttyACM0 > cattura.bin
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "dlog_format.h"
+
+static bool read_all(FILE *f, std::vector<uint8_t> &buf)
+{
+  uint8_t chunk[65536];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) {
+    buf.insert(buf.end(), chunk, chunk + n);
+  }
+  return !ferror(f);
+}
+
+class DlogDecoder
+{
+public:
+  explicit DlogDecoder(bool pass_text) : pass_text_(pass_text) {}
+
+  void run(const uint8_t *p, const uint8_t *end)
+  {
+    while (p < end) {
+      size_t len = frame_len(p, end);
+      if (len == 0) {
+        if (pass_text_) {
+          fputc(*p, stdout);
+        }
+        p++;
+        continue;
+      }
+      handle(p[2], p + DLOG_FRAME_HDR, p + len - 1);
+      p += len;
+    }
+  }
+
+  void report() const
+  {
+    size_t sites = 0;
+    for (const std::string &fmt : sites_) {
+      sites += !fmt.empty();
+    }
+    fprintf(stderr, "dlog_decode: %llu record, %zu siti, %llu frame corrotti, %u record persi\n",
+            (unsigned long long)records_, sites, (unsigned long long)bad_, lost_);
+  }
+
+private:
+  // Lunghezza del frame valido che inizia in p, 0 se non è un frame
+  size_t frame_len(const uint8_t *p, const uint8_t *end)
+  {
+    if (end - p < DLOG_FRAME_HDR + 1 || p[0] != DLOG_SYNC0 || p[1] != DLOG_SYNC1) {
+      return 0;
+    }
+    const size_t payload = (size_t)p[3] | ((size_t)p[4] << 8);
+    const size_t total   = DLOG_FRAME_HDR + payload + 1;
+    if (p[2] < DLOG_FRAME_SITE || p[2] > DLOG_FRAME_LOST || total > DLOG_FRAME_MAX ||
+        (size_t)(end - p) < total) {
+      return 0;
+    }
+    if (dlog_checksum(p + 2, 3 + payload) != p[total - 1]) {
+      bad_++;
+      return 0;
+    }
+    return total;
+  }
+
+  void handle(uint8_t type, const uint8_t *p, const uint8_t *end)
+  {
+    switch (type) {
+      case DLOG_FRAME_SITE: {
+        if (end - p < 2) {
+          bad_++;
+          return;
+        }
+        const uint16_t site = (uint16_t)(p[0] | (p[1] << 8));
+        if (sites_.size() <= site) {
+          sites_.resize(site + 1);
+        }
+        sites_[site].assign((const char *)p + 2, (size_t)(end - p - 2));
+        break;
+      }
+      case DLOG_FRAME_REC:
+        record(p, end);
+        break;
+      case DLOG_FRAME_LOST: {
+        if (end - p < 4) {
+          bad_++;
+          return;
+        }
+        uint32_t lost;
+        memcpy(&lost, p, 4);
+        printf("[dlog] %u record persi dall'avvio\n", lost);
+        lost_ = lost;
+        break;
+      }
+    }
+  }
+
+  void record(const uint8_t *p, const uint8_t *end)
+  {
+    if (end - p < 13) {
+      bad_++;
+      return;
+    }
+    uint64_t ts_us;
+    uint16_t site, suppressed;
+    memcpy(&ts_us, p, 8);
+    memcpy(&site, p + 8, 2);
+    memcpy(&suppressed, p + 10, 2);
+    const uint8_t nargs = p[12];
+    p += 13;
+
+    DlogArg args[DLOG_MAX_ARGS];
+    char strings[DLOG_MAX_ARGS][DLOG_STR_MAX + 1];
+    if (nargs > DLOG_MAX_ARGS) {
+      bad_++;
+      return;
+    }
+    for (uint8_t i = 0; i < nargs; ++i) {
+      if (!dlog_get_arg(p, end, args[i], strings[i])) {
+        bad_++;
+        return;
+      }
+    }
+
+    printf("[%12.6f] ", ts_us / 1e6);
+    if (site >= sites_.size() || sites_[site].empty()) {
+      printf("<sito %u non definito: cattura iniziata dopo la definizione>\n", site);
+    } else {
+      char line[1024] = "";
+      const size_t len = dlog_format_record(line, sizeof(line), sites_[site].c_str(),
+                                            args, nargs, suppressed);
+      fwrite(line, 1, len, stdout);
+      if (len == 0 || line[len - 1] != '\n') {
+        fputc('\n', stdout);
+      }
+    }
+    records_++;
+  }
+
+  bool                     pass_text_;
+  std::vector<std::string> sites_;
+  uint64_t                 records_ = 0;
+  uint64_t                 bad_     = 0;
+  uint32_t                 lost_    = 0;
+};
+
+int main(int argc, char **argv)
+{
+  bool        pass_text = true;
+  const char *path      = "-";
+
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "--frames-only")) {
+      pass_text = false;
+    } else if (argv[i][0] != '-' || !strcmp(argv[i], "-")) {
+      path = argv[i];
+    } else {
+      fprintf(stderr, "uso: dlog_decode [--frames-only] [cattura.bin | -]\n");
+      return 2;
+    }
+  }
+
+  FILE *f = !strcmp(path, "-") ? stdin : fopen(path, "rb");
+  if (!f) {
+    fprintf(stderr, "impossibile aprire %s\n", path);
+    return 1;
+  }
+  std::vector<uint8_t> buf;
+  const bool ok = read_all(f, buf);
+  if (f != stdin) {
+    fclose(f);
+  }
+  if (!ok) {
+    fprintf(stderr, "errore di lettura su %s\n", path);
+    return 1;
+  }
+
+  DlogDecoder dec(pass_text);
+  dec.run(buf.data(), buf.data() + buf.size());
+  dec.report();
+  return 0;
+}
@@ -0,0 +1,26 @@
+// ----------------------------------------------------
+// lv_conf.h per la build host
+// ----------------------------------------------------
+// Riprende la configurazione del device e cambia solo quello che serve su
+// Linux: heap LVGL più grande (puntatori a 64 bit) e i font usati dalle UI
+// di entrambi i prodotti (la libreria lvgl è una sola per tutti gli
+// eseguibili, quindi qui non conta REEFILLA_PRODUCT).
+
+#ifndef LV_CONF_HOST_H
+#define LV_CONF_HOST_H
+
+#include "../REEFILLA_DisplayPanel_ARDUINOIDE/Utilities/DaMettereInArduino-libraries/lv_conf.h"
+
+#undef  LV_MEM_SIZE
+#define LV_MEM_SIZE (512U * 1024U)
+
+#undef  LV_FONT_MONTSERRAT_20
+#define LV_FONT_MONTSERRAT_20 1
+#undef  LV_FONT_MONTSERRAT_28
+#define LV_FONT_MONTSERRAT_28 1
+#undef  LV_FONT_MONTSERRAT_32
+#define LV_FONT_MONTSERRAT_32 1
+#undef  LV_FONT_MONTSERRAT_48
+#define LV_FONT_MONTSERRAT_48 1
+
+#endif /*LV_CONF_HOST_H*/
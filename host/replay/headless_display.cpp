@@ -0,0 +1,47 @@
+#include "headless_display.h"
+
+#include <lvgl.h>
+
+#include "lv_port_lock.h"
+
+#define LVGL_HOR_RES    480
+#define LVGL_VER_RES    480
+#define LVGL_BUF_LINES  40
+
+static lv_color_t           s_buf[LVGL_HOR_RES * LVGL_BUF_LINES];
+static lv_disp_draw_buf_t   s_draw_buf;
+static lv_disp_drv_t        s_disp_drv;
+static HeadlessDisplayStats s_stats;
+
+static void headless_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p)
+{
+  (void)color_p;
+
+  s_stats.flushes++;
+  s_stats.pixels += (uint64_t)lv_area_get_width(area) * (uint64_t)lv_area_get_height(area);
+  if (lv_disp_flush_is_last(drv)) {
+    s_stats.refreshes++;
+  }
+
+  lv_disp_flush_ready(drv);
+}
+
+void headless_display_init()
+{
+  lv_init();
+  lv_port_lock_init();   // come lv_port_init()
+
+  lv_disp_draw_buf_init(&s_draw_buf, s_buf, NULL, LVGL_HOR_RES * LVGL_BUF_LINES);
+
+  lv_disp_drv_init(&s_disp_drv);
+  s_disp_drv.hor_res  = LVGL_HOR_RES;
+  s_disp_drv.ver_res  = LVGL_VER_RES;
+  s_disp_drv.flush_cb = headless_flush_cb;
+  s_disp_drv.draw_buf = &s_draw_buf;
+  lv_disp_drv_register(&s_disp_drv);
+}
+
+HeadlessDisplayStats headless_display_get_stats()
+{
+  return s_stats;
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+// ----------------------------------------------------
+// Display LVGL "headless" per la build host
+// ----------------------------------------------------
+// Stessa risoluzione e stesso draw buffer di lv_port.cpp (480x480, 40 righe),
+// ma la flush non disegna: conta aree e pixel per le metriche di rendering.
+
+#include <stdint.h>
+
+struct HeadlessDisplayStats
+{
+  uint64_t flushes;        // chiamate alla flush callback
+  uint64_t pixels;         // pixel passati alla flush
+  uint64_t refreshes;      // refresh completati (ultima flush di un ciclo)
+};
+
+void headless_display_init();
+
+HeadlessDisplayStats headless_display_get_stats();
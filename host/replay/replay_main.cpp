@@ -0,0 +1,531 @@
+// ----------------------------------------------------
+// Driver di replay deterministico: CAN -> DBC -> UI su Linux
+// ----------------------------------------------------
+// Esegue i sorgenti veri dello sketch (can_port, dbc_decoder, ui_main) sopra
+// l'HAL finto di host/shim. Il tempo è virtuale: ogni frame viene consegnato
+// al TWAI finto con il suo timestamp e tra un frame e l'altro gira la UI
+// con uno dei due scheduler:
+//
+// - event (default): ui_task.h come sul device, il passo del task UI gira
+//   quando arriva una notifica (frame decodificato) o scade l'attesa
+//   restituita da lv_timer_handler()
+// - poll: il vecchio loop() (lv_tick_inc, ui_trend_sample, ui_main_update
+//   ogni 1000 ms, lv_timer_handler, delay(5)), per il confronto
+//
+// In entrambi i casi il report dà risvegli e CPU della UI per secondo
+// virtuale e la latenza dato -> pixel (dal timestamp del frame con il primo
+// segnale cambiato al ridisegno dopo ui_main_update(); gli aggiornamenti
+// che non cambiano pixel, es. pagina non visibile, non contano).
+// A parità di traccia l'esecuzione è sempre identica; la velocità cambia
+// solo il pacing rispetto al tempo reale.
+//
+// Uso:
+//   reefilla_replay [--speed 1|N|max] [--scheduler event|poll] [--log [--log-binary]]
+//                   (--trace file.ctr | --synthetic SECONDI [--static] [--dropout T0:DURATA])
+//
+// --log-binary: il log differito esce nel formato binario del device, da
+// passare a dlog_decode (reefilla_replay --log --log-binary ... | dlog_decode)
+// --static: traffico sintetico con i valori VCU sempre uguali (bus fermo),
+// per misurare quanto ridisegna la UI quando non cambia nulla
+// --dropout T0:DURATA: niente messaggi VCU da T0 per DURATA secondi, per
+// vedere timeout e recupero della supervisione dei cycle time
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "host_hal.h"
+#include "headless_display.h"
+#include "can_trace_reader.h"
+
+#include "can_port.h"
+#include "dbc_decoder.h"
+#include "dbc_supervise.h"
+#include "dbc_stats.h"
+#include "signal_bus.h"
+#include "dlog.h"
+#include "ui_main.h"
+#include "ui_task.h"
+#include "ui_trend.h"
+
+using Clock = std::chrono::steady_clock;
+
+// Periodo del loop() dello sketch (delay(5)) e cadenza di ui_main_update()
+// con lo scheduler poll. Con event il passo da 5 ms resta per i task RX
+// (risvegli a vuoto) e dlog.
+static constexpr uint64_t LOOP_PERIOD_US = 5000;
+static constexpr uint64_t UI_PERIOD_US   = 1000000;
+
+// ----------------------------------------------------
+// Metriche
+// ----------------------------------------------------
+
+struct Metric
+{
+  uint64_t count    = 0;
+  uint64_t total_ns = 0;
+  uint64_t max_ns   = 0;
+
+  void add(uint64_t ns)
+  {
+    count++;
+    total_ns += ns;
+    if (ns > max_ns) max_ns = ns;
+  }
+
+  double avg_us() const { return count ? total_ns / 1000.0 / count : 0.0; }
+  double max_us() const { return max_ns / 1000.0; }
+};
+
+static inline uint64_t elapsed_ns(Clock::time_point t0)
+{
+  return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - t0).count();
+}
+
+// ----------------------------------------------------
+// Replayer
+// ----------------------------------------------------
+
+class Replayer
+{
+public:
+  Replayer(double speed, bool event) : speed_(speed), event_(event) {}
+
+  void feed(uint64_t ts_us, uint32_t id, bool ext, bool rtr, uint8_t dlc, const uint8_t *data)
+  {
+    if (!started_) {
+      start(ts_us);
+    }
+
+    // Il loop dello sketch gira fino all'istante del frame
+    run_loop_until(ts_us);
+
+    pace(ts_us);
+    host_clock_set_us(ts_us);
+
+    twai_message_t msg = {};
+    msg.identifier       = id;
+    msg.extd             = ext;
+    msg.rtr              = rtr;
+    msg.data_length_code = dlc > 8 ? 8 : dlc;
+    memcpy(msg.data, data, msg.data_length_code);
+    frames_in_++;
+
+    if (host_twai_push(msg)) {
+      const Clock::time_point t0 = Clock::now();
+      frames_rx_ += can_port_rx_poll(0);
+      rx_.add(elapsed_ns(t0));
+    }
+    last_ts_ = ts_us;
+
+    // Il task UI si sveglia subito (priorità più alta di loop())
+    if (event_ && host_task_notify_take(ui_task_handle())) {
+      ui_step(ts_us, true);
+    }
+  }
+
+  void finish()
+  {
+    if (started_) {
+      // Ancora un secondo di UI per mostrare gli ultimi dati
+      run_loop_until(last_ts_ + UI_PERIOD_US + LOOP_PERIOD_US);
+    }
+  }
+
+  void report()
+  {
+    const double wall_s    = std::chrono::duration<double>(Clock::now() - wall_start_).count();
+    const double virtual_s = (host_clock_us() - first_ts_) / 1e6;
+    const double rx_s      = rx_.total_ns / 1e9;
+    const HeadlessDisplayStats ds = headless_display_get_stats();
+
+    printf("\n===== reefilla_replay =====\n");
+    printf("tempo virtuale     : %.3f s (reale %.3f s, %.1fx)\n",
+           virtual_s, wall_s, wall_s > 0 ? virtual_s / wall_s : 0.0);
+    printf("frame in ingresso  : %llu (scartati dal filtro HW: %llu)\n",
+           (unsigned long long)frames_in_, (unsigned long long)host_twai_rejected());
+    printf("frame decodificati : %llu, %.0f frame/s (%.3f us/frame nel path RX)\n",
+           (unsigned long long)frames_rx_,
+           rx_s > 0 ? frames_rx_ / rx_s : 0.0,
+           frames_rx_ ? rx_.total_ns / 1000.0 / frames_rx_ : 0.0);
+    if (can_port_tap_enabled()) {
+      printf("overflow ring RX   : %lu\n", (unsigned long)can_port_get_overflow_count());
+    } else {
+      printf("ring RX            : presa spenta (nessun consumatore)\n");
+    }
+    if (event_) {
+      const UiTaskStats us = ui_task_get_stats();
+      printf("ui_main_update     : %lu chiamate (a eventi e periodiche), %lu passi del task UI\n",
+             (unsigned long)us.updates, (unsigned long)us.steps);
+    } else {
+      printf("ui_main_update     : %llu chiamate, media %.2f us, max %.2f us\n",
+             (unsigned long long)ui_.count, ui_.avg_us(), ui_.max_us());
+      printf("lv_timer_handler   : %llu chiamate, media %.2f us, max %.2f us\n",
+             (unsigned long long)lvgl_.count, lvgl_.avg_us(), lvgl_.max_us());
+    }
+    printf("scheduler UI       : %s, %llu risvegli (%.1f/s), CPU %.3f ms per secondo virtuale\n",
+           event_ ? "event" : "poll", (unsigned long long)ui_cpu_.count,
+           virtual_s > 0 ? ui_cpu_.count / virtual_s : 0.0,
+           virtual_s > 0 ? ui_cpu_.total_ns / 1e6 / virtual_s : 0.0);
+    printf("latenza dato->pixel: media %.1f ms, max %.1f ms (%llu aggiornamenti con ridisegno)\n",
+           latency_.count ? latency_.total_ns / 1e6 / latency_.count : 0.0,
+           latency_.max_ns / 1e6, (unsigned long long)latency_.count);
+    for (uint16_t i = 0; i < DBC_MESSAGE_COUNT; ++i) {
+      const DbcSuperviseStats sv = dbc_supervise_get((DbcMessageIndex)i);
+      if (sv.frames == 0) {
+        continue;
+      }
+      printf("supervisione       : %-22s %lu frame, %lu anticipi, %lu ritardi, %lu timeout, %lu recuperi\n",
+             DBC_MESSAGES[i].name, (unsigned long)sv.frames, (unsigned long)sv.early,
+             (unsigned long)sv.late, (unsigned long)sv.timeouts, (unsigned long)sv.recoveries);
+    }
+    fflush(stdout);
+    dbc_stats_dump(Serial);
+    signal_bus_dump(Serial);
+    if (event_) {
+      ui_task_dump(Serial);
+    }
+    printf("render             : %llu refresh, media %.2f us/refresh, max %.2f us, %llu flush, %llu pixel (%.0f pixel/s)\n",
+           (unsigned long long)render_.count, render_.avg_us(), render_.max_us(),
+           (unsigned long long)ds.flushes, (unsigned long long)ds.pixels,
+           virtual_s > 0 ? ds.pixels / virtual_s : 0.0);
+  }
+
+private:
+  void start(uint64_t ts_us)
+  {
+    started_    = true;
+    first_ts_   = ts_us;
+    next_loop_  = ts_us;
+    last_loop_  = ts_us;
+    next_ui_    = ts_us + UI_PERIOD_US;
+    next_wake_  = ts_us;   // notifica di ui_task_start()
+    wake_notified_ = true;
+    wall_start_ = Clock::now();
+    host_clock_set_us(ts_us);
+    signal_bus_subscribe(bus_, "replay");
+  }
+
+  // Attende il tempo reale corrispondente a t_us (niente in modalità max)
+  void pace(uint64_t t_us)
+  {
+    if (speed_ <= 0.0) {
+      return;
+    }
+    const auto target = wall_start_ + std::chrono::microseconds(
+        (int64_t)((t_us - first_ts_) / speed_));
+    std::this_thread::sleep_until(target);
+  }
+
+  void run_loop_until(uint64_t t_us)
+  {
+    while (true) {
+      const bool     ui   = event_ && next_wake_ <= next_loop_;
+      const uint64_t next = ui ? next_wake_ : next_loop_;
+      if (next > t_us) {
+        break;
+      }
+      pace(next);
+      host_clock_set_us(next);
+      if (ui) {
+        ui_step(next, wake_notified_);
+      } else {
+        loop_step(next);
+        next_loop_ += LOOP_PERIOD_US;
+      }
+    }
+  }
+
+  // Corpo di loop() dello sketch (con event, solo la parte dei task RX e dlog)
+  void loop_step(uint64_t now_us)
+  {
+    if (!event_) {
+      ui_work(now_us, [&] { poll_ui(now_us); });
+    }
+
+    // Al posto dei risvegli a vuoto del task RX (CAN_RX_IDLE_MS): la
+    // supervisione dei timeout gira anche a bus muto
+    can_port_rx_poll(0);
+
+    // Al posto del task dlog (i task non girano su host)
+    dlog_drain(Serial, SIZE_MAX);
+
+    // Timeout pubblicati dal task RX: svegliano il task UI
+    if (event_ && host_task_notify_take(ui_task_handle())) {
+      next_wake_     = now_us;
+      wake_notified_ = true;
+    }
+  }
+
+  // Vecchio loop(): UI a polling ogni LOOP_PERIOD_US
+  void poll_ui(uint64_t now_us)
+  {
+    lv_tick_inc((uint32_t)((now_us - last_loop_) / 1000ULL));
+    last_loop_ = now_us;
+
+    ui_trend_sample();
+
+    if (now_us >= next_ui_) {
+      next_ui_ += UI_PERIOD_US;
+      const Clock::time_point t0 = Clock::now();
+      ui_main_update();
+      ui_.add(elapsed_ns(t0));
+      updates_++;
+    }
+
+    const uint64_t refreshes = headless_display_get_stats().refreshes;
+    const Clock::time_point t0 = Clock::now();
+    lv_timer_handler();
+    const uint64_t ns = elapsed_ns(t0);
+    lvgl_.add(ns);
+    if (headless_display_get_stats().refreshes != refreshes) {
+      render_.add(ns);
+    }
+  }
+
+  // Un passo del task UI (ui_task.h) e il prossimo risveglio: l'attesa che
+  // chiede lv_timer_handler(), o nessuno fino alla prossima notifica.
+  // notified: svegliato da una notifica e non dallo scadere dell'attesa.
+  void ui_step(uint64_t now_us, bool notified)
+  {
+    uint32_t ms = 0;
+    ui_work(now_us, [&] {
+      const uint64_t refreshes = headless_display_get_stats().refreshes;
+      const Clock::time_point t0 = Clock::now();
+      ms = ui_task_step(notified);
+      if (headless_display_get_stats().refreshes != refreshes) {
+        render_.add(elapsed_ns(t0));
+      }
+    });
+    host_task_notify_take(ui_task_handle());   // ulTaskNotifyTake(pdTRUE, ...)
+
+    // Attesa 0 = di nuovo subito sul device; qui almeno un tick per avanzare
+    next_wake_ = (ms == LV_NO_TIMER_READY) ? UINT64_MAX
+                                           : now_us + 1000ULL * (ms ? ms : 1);
+    wake_notified_ = false;
+  }
+
+  // Misura un giro della UI: CPU e latenza dato -> pixel
+  template <typename F>
+  void ui_work(uint64_t now_us, F &&step)
+  {
+    SignalEvent events[32];
+    size_t      n;
+    while ((n = signal_bus_poll(bus_, events, 32)) > 0) {
+      if (!pending_us_) {
+        pending_us_ = events[0].t_us;
+      }
+    }
+
+    const uint64_t updates   = event_ ? ui_task_get_stats().updates : updates_;
+    const uint64_t refreshes = headless_display_get_stats().refreshes;
+    const Clock::time_point t0 = Clock::now();
+    step();
+    ui_cpu_.add(elapsed_ns(t0));
+
+    if ((event_ ? ui_task_get_stats().updates : updates_) != updates) {
+      if (pending_us_ && headless_display_get_stats().refreshes != refreshes) {
+        latency_.add((now_us - pending_us_) * 1000ULL);
+      }
+      pending_us_ = 0;
+    }
+  }
+
+  double   speed_;
+  bool     event_;
+  bool     started_   = false;
+  uint64_t first_ts_  = 0;
+  uint64_t last_ts_   = 0;
+  uint64_t next_loop_ = 0;
+  uint64_t last_loop_ = 0;
+  uint64_t next_ui_   = 0;
+  uint64_t next_wake_ = UINT64_MAX;
+  bool     wake_notified_ = false;   // next_wake_ viene da una notifica
+  uint64_t updates_   = 0;
+  uint64_t pending_us_ = 0;   // primo evento del bus non ancora passato da ui_main_update
+  uint64_t frames_in_ = 0;
+  uint64_t frames_rx_ = 0;
+  Clock::time_point wall_start_;
+
+  Metric rx_;
+  Metric ui_;
+  Metric lvgl_;
+  Metric render_;
+  Metric ui_cpu_;
+  Metric latency_;   // in tempo virtuale
+
+  BroadcastCursor bus_;
+};
+
+// ----------------------------------------------------
+// Traffico sintetico
+// ----------------------------------------------------
+// VCU_Display_Status / _2 ogni 100 ms con valori che cambiano (o fissi con
+// frozen), VCU_Display_Diag ogni 100 ms a pagine 0, 1, 2 a rotazione, più
+// BACKGROUND_IDS messaggi standard non gestiti con periodi da
+// 10 a 100 ms. Nella finestra [gap_from_us, gap_to_us) la VCU tace.
+
+static constexpr uint32_t BACKGROUND_IDS = 40;
+
+static void replay_synthetic(Replayer &rp, double seconds, bool frozen,
+                             uint64_t gap_from_us, uint64_t gap_to_us)
+{
+  struct Source
+  {
+    uint32_t id;
+    bool     ext;
+    uint64_t period_us;
+    uint64_t next_us;
+  };
+
+  std::vector<Source> src;
+  src.push_back({ 0x1088A0F1UL, true, 100000, 0 });
+  src.push_back({ 0x1088A1F1UL, true, 100000, 50000 });
+  src.push_back({ 0x1088A2F1UL, true, 100000, 25000 });
+  for (uint32_t i = 0; i < BACKGROUND_IDS; ++i) {
+    src.push_back({ 0x100 + i * 7, false, 10000ULL * (1 + i % 10), 1000ULL * i });
+  }
+
+  const uint64_t end_us = (uint64_t)(seconds * 1e6);
+  uint32_t n = 0;
+
+  while (true) {
+    // Sorgente con la scadenza più vicina
+    Source *next = &src[0];
+    for (Source &s : src) {
+      if (s.next_us < next->next_us) next = &s;
+    }
+    if (next->next_us >= end_us) {
+      break;
+    }
+
+    uint8_t d[8];
+    const uint32_t k = n++;
+    const bool vcu = next->ext;
+    if (next->id == 0x1088A0F1UL) {
+      const uint32_t t_s = frozen ? 0 : (uint32_t)(next->next_us / 1000000ULL);
+      d[0] = (uint8_t)(100 - (t_s / 60) % 100);   // SOC che scende di 1% al minuto
+      d[1] = d[0];
+      d[2] = (uint8_t)(t_s & 0xFF); d[3] = 0;
+      d[4] = (uint8_t)(600 - (t_s % 600)) ; d[5] = 0;
+      d[6] = (uint8_t)((t_s / 30) % 7);
+      d[7] = 0;
+    } else if (next->id == 0x1088A2F1UL) {
+      const uint32_t page = (uint32_t)(next->next_us / next->period_us) % 3;
+      const uint32_t v = frozen ? 0 : (k >> 4);
+      d[0] = (uint8_t)page;
+      for (int b = 1; b < 8; ++b) {
+        d[b] = (uint8_t)(v * 13 + b * 29 + page * 7);
+      }
+    } else {
+      for (int b = 0; b < 8; ++b) {
+        d[b] = (uint8_t)(((frozen && vcu) ? 0 : k) * 31 + b * 17);
+      }
+    }
+
+    if (!vcu || next->next_us < gap_from_us || next->next_us >= gap_to_us) {
+      rp.feed(next->next_us, next->id, next->ext, false, 8, d);
+    }
+    next->next_us += next->period_us;
+  }
+}
+
+// ----------------------------------------------------
+// main
+// ----------------------------------------------------
+
+static void usage()
+{
+  fprintf(stderr,
+          "uso: reefilla_replay [--speed 1|N|max] [--scheduler event|poll] [--log [--log-binary]] "
+          "(--trace file.ctr | --synthetic SECONDI [--static] [--dropout T0:DURATA])\n");
+}
+
+int main(int argc, char **argv)
+{
+  double      speed     = 0.0;   // 0 = massima velocità
+  const char *trace     = nullptr;
+  double      synthetic = 0.0;
+  bool        log       = false;
+  bool        frozen    = false;
+  bool        event     = true;
+  double      gap_from  = 0.0;
+  double      gap_len   = 0.0;
+
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "--speed") && i + 1 < argc) {
+      const char *v = argv[++i];
+      speed = !strcmp(v, "max") ? 0.0 : atof(v);
+    } else if (!strcmp(argv[i], "--trace") && i + 1 < argc) {
+      trace = argv[++i];
+    } else if (!strcmp(argv[i], "--synthetic") && i + 1 < argc) {
+      synthetic = atof(argv[++i]);
+    } else if (!strcmp(argv[i], "--scheduler") && i + 1 < argc) {
+      const char *v = argv[++i];
+      if (strcmp(v, "event") && strcmp(v, "poll")) {
+        usage();
+        return 2;
+      }
+      event = !strcmp(v, "event");
+    } else if (!strcmp(argv[i], "--log")) {
+      log = true;
+    } else if (!strcmp(argv[i], "--static")) {
+      frozen = true;
+    } else if (!strcmp(argv[i], "--dropout") && i + 1 < argc) {
+      if (sscanf(argv[++i], "%lf:%lf", &gap_from, &gap_len) != 2 || gap_len <= 0.0) {
+        usage();
+        return 2;
+      }
+    } else if (!strcmp(argv[i], "--log-binary")) {
+      dlog_set_binary(true);
+    } else {
+      usage();
+      return 2;
+    }
+  }
+  if (!trace && synthetic <= 0.0) {
+    usage();
+    return 2;
+  }
+
+  // Stessa sequenza di setup() dello sketch, con il display headless
+  host_serial_set_enabled(log);
+  dlog_init();
+  headless_display_init();
+  ui_main_init();
+  if (event) {
+    ui_task_init(false);
+  }
+  if (!can_port_init() || !can_port_start()) {
+    fprintf(stderr, "can_port: inizializzazione fallita\n");
+    return 1;
+  }
+  if (event && !ui_task_start()) {
+    fprintf(stderr, "ui_task: avvio fallito\n");
+    return 1;
+  }
+
+  Replayer rp(speed, event);
+
+  if (trace) {
+    CanTraceFile file;
+    if (!file.open(trace)) {
+      fprintf(stderr, "impossibile aprire %s\n", trace);
+      return 1;
+    }
+    file.for_each_frame([&](const CanTraceRecord &r) {
+      rp.feed(r.timestamp_us, r.id, r.extended, r.rtr, r.dlc, r.data);
+    });
+  } else {
+    replay_synthetic(rp, synthetic, frozen,
+                     (uint64_t)(gap_from * 1e6), (uint64_t)((gap_from + gap_len) * 1e6));
+  }
+
+  rp.finish();
+  host_serial_set_enabled(true);
+  rp.report();
+  return 0;
+}
@@ -0,0 +1,238 @@
+// ----------------------------------------------------
+// Traccia di rendering (rtrace) -> Chrome trace JSON
+// ----------------------------------------------------
+// Cerca nel flusso catturato dalla seriale i blocchi di rtrace_format.h
+// (uno per core per ogni dump 'f', riconosciuti dal magic e validati; il
+// resto è saltato), accoppia inizio e fine di ogni punto per core e scrive
+// su stdout un JSON da aprire con chrome://tracing o ui.perfetto.dev:
+//
+// - un "thread" per core, eventi completi ("X") con durata e argomenti
+// - gli istanti come eventi "i"
+// - le fini senza inizio (inizio sovrascritto nel ring) sono scartate, gli
+//   inizi senza fine (fine dopo il dump) restano aperti ("B")
+//
+// Su stderr un riepilogo per evento: numero, tempo totale, media, massimo,
+// quota della durata della traccia.
+//
+// Uso:
+//   rtrace_json [cattura.bin | -] > trace.json
+//
+// Esempio di cattura: comando 'f' sulla console, con
+//   cat /dev/ttyACM0 > cattura.bin
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "rtrace_format.h"
+
+#define MAX_CORES     8
+#define MAX_RECORDS   (1U << 22)
+#define MAX_DEPTH     64
+
+static bool read_all(FILE *f, std::vector<uint8_t> &buf)
+{
+  uint8_t chunk[65536];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) {
+    buf.insert(buf.end(), chunk, chunk + n);
+  }
+  return !ferror(f);
+}
+
+struct Span
+{
+  uint64_t ts_us;
+  uint64_t dur_us;
+  uint8_t  core;
+  uint8_t  event;
+  char     phase;    // 'X', 'B' (senza fine) o 'i'
+  uint16_t arg_begin;
+  uint16_t arg_end;
+};
+
+struct EventSummary
+{
+  uint64_t count  = 0;
+  uint64_t sum_us = 0;
+  uint64_t max_us = 0;
+};
+
+class RtraceConverter
+{
+public:
+  void run(const uint8_t *p, const uint8_t *end)
+  {
+    while (p + sizeof(RtraceBlockHeader) <= end) {
+      RtraceBlockHeader h;
+      memcpy(&h, p, sizeof(h));
+      if (h.magic != RTRACE_MAGIC || h.core >= MAX_CORES || h.count > MAX_RECORDS ||
+          (size_t)(end - p) < sizeof(h) + (size_t)h.count * sizeof(RtraceRecord)) {
+        p++;
+        continue;
+      }
+      block(h, p + sizeof(h));
+      p += sizeof(h) + (size_t)h.count * sizeof(RtraceRecord);
+    }
+  }
+
+  void write_json(FILE *out)
+  {
+    std::sort(spans_.begin(), spans_.end(),
+              [](const Span &a, const Span &b) { return a.ts_us < b.ts_us; });
+    const uint64_t t0 = spans_.empty() ? 0 : spans_.front().ts_us;
+
+    fprintf(out, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    fprintf(out, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":\"ESP32-S3\"}}");
+    for (unsigned c = 0; c < MAX_CORES; ++c) {
+      if (cores_seen_ & (1U << c)) {
+        fprintf(out, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,"
+                     "\"args\":{\"name\":\"core %u\"}}", c, c);
+      }
+    }
+    for (const Span &s : spans_) {
+      fprintf(out, ",\n{\"name\":\"%s\",\"ph\":\"%c\",\"pid\":0,\"tid\":%u,\"ts\":%llu",
+              rtrace_event_name(s.event), s.phase, (unsigned)s.core,
+              (unsigned long long)(s.ts_us - t0));
+      if (s.phase == 'X') {
+        fprintf(out, ",\"dur\":%llu", (unsigned long long)s.dur_us);
+      } else if (s.phase == 'i') {
+        fprintf(out, ",\"s\":\"t\"");
+      }
+      fprintf(out, ",\"args\":{\"begin\":%u,\"end\":%u}}", s.arg_begin, s.arg_end);
+    }
+    fprintf(out, "\n]}\n");
+  }
+
+  void report(FILE *out) const
+  {
+    uint64_t first = UINT64_MAX, last = 0;
+    for (const Span &s : spans_) {
+      first = std::min(first, s.ts_us);
+      last  = std::max(last, s.ts_us + s.dur_us);
+    }
+    const double span_us = (last > first) ? (double)(last - first) : 0.0;
+
+    fprintf(out, "[rtrace_json] %zu blocchi, %llu record (%llu sovrascritti prima del dump, "
+                 "%llu fini senza inizio), %.1f ms di traccia\n",
+            blocks_, (unsigned long long)records_, (unsigned long long)lost_,
+            (unsigned long long)orphans_, span_us / 1000.0);
+    for (unsigned c = 0; c < MAX_CORES; ++c) {
+      for (unsigned e = 1; e < RTRACE_EV_COUNT; ++e) {
+        const EventSummary &s = summary_[c][e];
+        if (!s.count) {
+          continue;
+        }
+        fprintf(out, "  core %u %-20s %8llu  tot %9.2f ms  media %8.1f us  max %8llu us  %5.1f%%\n",
+                c, rtrace_event_name((uint8_t)e), (unsigned long long)s.count, s.sum_us / 1000.0,
+                (double)s.sum_us / s.count, (unsigned long long)s.max_us,
+                span_us > 0 ? 100.0 * s.sum_us / span_us : 0.0);
+      }
+    }
+  }
+
+  bool empty() const { return blocks_ == 0; }
+
+private:
+  struct Open
+  {
+    uint64_t ts_us;
+    uint8_t  event;
+    uint16_t arg;
+  };
+
+  void block(const RtraceBlockHeader &h, const uint8_t *p)
+  {
+    blocks_++;
+    records_ += h.count;
+    lost_    += h.lost;
+    cores_seen_ |= 1U << h.core;
+
+    Open   stack[MAX_DEPTH];
+    size_t depth = 0;
+    for (uint32_t i = 0; i < h.count; ++i) {
+      RtraceRecord r;
+      memcpy(&r, p + (size_t)i * sizeof(r), sizeof(r));
+      if (r.event == RTRACE_EV_NONE || r.event >= RTRACE_EV_COUNT) {
+        continue;
+      }
+      const uint64_t ts = rtrace_unwrap_us(r.ts_us, h.now_us);
+
+      if (r.phase == RTRACE_PH_BEGIN) {
+        if (depth < MAX_DEPTH) {
+          stack[depth++] = { ts, r.event, r.arg };
+        }
+      } else if (r.phase == RTRACE_PH_END) {
+        // L'inizio più recente dello stesso evento; quelli sopra (punti di
+        // un task interrotto sullo stesso core) restano aperti
+        size_t k = depth;
+        while (k > 0 && stack[k - 1].event != r.event) {
+          k--;
+        }
+        if (k == 0) {
+          orphans_++;
+          continue;
+        }
+        const Open o = stack[k - 1];
+        memmove(&stack[k - 1], &stack[k], (depth - k) * sizeof(Open));
+        depth--;
+        const uint64_t dur = ts >= o.ts_us ? ts - o.ts_us : 0;
+        spans_.push_back({ o.ts_us, dur, h.core, r.event, 'X', o.arg, r.arg });
+        EventSummary &s = summary_[h.core][r.event];
+        s.count++;
+        s.sum_us += dur;
+        s.max_us  = std::max(s.max_us, dur);
+      } else if (r.phase == RTRACE_PH_INSTANT) {
+        spans_.push_back({ ts, 0, h.core, r.event, 'i', r.arg, 0 });
+      }
+    }
+    for (size_t k = 0; k < depth; ++k) {
+      spans_.push_back({ stack[k].ts_us, 0, h.core, stack[k].event, 'B', stack[k].arg, 0 });
+    }
+  }
+
+  std::vector<Span> spans_;
+  EventSummary      summary_[MAX_CORES][RTRACE_EV_COUNT];
+  size_t            blocks_     = 0;
+  uint64_t          records_    = 0;
+  uint64_t          lost_       = 0;
+  uint64_t          orphans_    = 0;
+  unsigned          cores_seen_ = 0;
+};
+
+int main(int argc, char **argv)
+{
+  const char *path = (argc > 1) ? argv[1] : "-";
+  if (argc > 2 || strcmp(path, "--help") == 0) {
+    fprintf(stderr, "uso: rtrace_json [cattura.bin | -] > trace.json\n");
+    return 2;
+  }
+
+  FILE *f = (strcmp(path, "-") == 0) ? stdin : fopen(path, "rb");
+  if (!f) {
+    fprintf(stderr, "rtrace_json: impossibile aprire %s\n", path);
+    return 1;
+  }
+  std::vector<uint8_t> buf;
+  const bool ok = read_all(f, buf);
+  if (f != stdin) {
+    fclose(f);
+  }
+  if (!ok) {
+    fprintf(stderr, "rtrace_json: errore di lettura\n");
+    return 1;
+  }
+
+  RtraceConverter conv;
+  conv.run(buf.data(), buf.data() + buf.size());
+  if (conv.empty()) {
+    fprintf(stderr, "rtrace_json: nessun blocco RTRDUMP trovato\n");
+    return 1;
+  }
+  conv.write_json(stdout);
+  conv.report(stderr);
+  return 0;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+// ----------------------------------------------------
+// Shim Arduino per la build host (Linux)
+// ----------------------------------------------------
+// Solo quello che usano i sorgenti dello sketch compilati su host:
+// Print/Serial, millis()/delay() sul clock virtuale di host_hal.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <limits.h>
+
+class Print
+{
+public:
+  virtual ~Print() = default;
+
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buf, size_t len)
+  {
+    size_t n = 0;
+    while (len--) {
+      n += write(*buf++);
+    }
+    return n;
+  }
+
+  size_t printf(const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+  size_t print(const char *s)   { return write((const uint8_t *)s, strlen(s)); }
+  size_t println(const char *s) { return print(s) + println(); }
+  size_t println()              { return write((const uint8_t *)"\n", 1); }
+};
+
+// Seriale su stdout (disattivabile: vedi host_serial_set_enabled)
+class HostSerial : public Print
+{
+public:
+  void   begin(unsigned long baud) { (void)baud; }
+  int    available() { return 0; }
+  int    read() { return -1; }
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *buf, size_t len) override;
+};
+
+extern HostSerial Serial;
+
+// Stack di loopTask (SET_LOOP_TASK_STACK_SIZE su arduino-esp32)
+size_t getArduinoLoopTaskStackSize();
+
+uint32_t millis();
+uint32_t micros();
+void     delay(uint32_t ms);
+
+// Niente IRAM su host
+#define IRAM_ATTR
@@ -0,0 +1,68 @@
+#pragma once
+
+// ----------------------------------------------------
+// TWAI finto per la build host
+// ----------------------------------------------------
+// twai_receive() legge da una coda riempita con host_twai_push(); non blocca
+// mai (il tempo è virtuale). Install/start/stop ritornano sempre ESP_OK.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+
+#define TWAI_FRAME_MAX_DLC  8
+
+typedef enum {
+  TWAI_MODE_NORMAL,
+  TWAI_MODE_NO_ACK,
+  TWAI_MODE_LISTEN_ONLY,
+} twai_mode_t;
+
+typedef struct {
+  union {
+    struct {
+      uint32_t extd: 1;
+      uint32_t rtr: 1;
+      uint32_t ss: 1;
+      uint32_t self: 1;
+      uint32_t dlc_non_comp: 1;
+      uint32_t reserved: 27;
+    };
+    uint32_t flags;
+  };
+  uint32_t identifier;
+  uint8_t  data_length_code;
+  uint8_t  data[TWAI_FRAME_MAX_DLC];
+} twai_message_t;
+
+typedef struct {
+  twai_mode_t mode;
+  int         tx_io;
+  int         rx_io;
+} twai_general_config_t;
+
+typedef struct {
+  uint32_t brp;
+} twai_timing_config_t;
+
+typedef struct {
+  uint32_t acceptance_code;
+  uint32_t acceptance_mask;
+  bool     single_filter;
+} twai_filter_config_t;
+
+#define GPIO_NUM_0  0
+#define GPIO_NUM_6  6
+
+#define TWAI_GENERAL_CONFIG_DEFAULT(tx, rx, op_mode)  { (op_mode), (tx), (rx) }
+#define TWAI_TIMING_CONFIG_250KBITS()                 { 16 }
+#define TWAI_FILTER_CONFIG_ACCEPT_ALL()               { 0, 0xFFFFFFFF, true }
+
+esp_err_t twai_driver_install(const twai_general_config_t *g_config,
+                              const twai_timing_config_t *t_config,
+                              const twai_filter_config_t *f_config);
+esp_err_t twai_driver_uninstall();
+esp_err_t twai_start();
+esp_err_t twai_stop();
+esp_err_t twai_receive(twai_message_t *message, TickType_t ticks_to_wait);
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Su host le capability vengono ignorate: tutto arriva dall'heap normale
+#define MALLOC_CAP_8BIT      (1 << 2)
+#define MALLOC_CAP_DMA       (1 << 3)
+#define MALLOC_CAP_SPIRAM    (1 << 10)
+#define MALLOC_CAP_INTERNAL  (1 << 11)
+#define MALLOC_CAP_DEFAULT   (1 << 12)
+
+void *heap_caps_malloc(size_t size, uint32_t caps);
+void *heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps);
+void  heap_caps_free(void *ptr);
+
+// Statistiche: quelle impostate dal driver (host_heap_set), non l'heap reale
+size_t heap_caps_get_free_size(uint32_t caps);
+size_t heap_caps_get_minimum_free_size(uint32_t caps);
+size_t heap_caps_get_largest_free_block(uint32_t caps);
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <stdint.h>
+
+// Clock virtuale in µs (impostato dal driver di replay)
+int64_t esp_timer_get_time();
+
+// Solo host: tempo reale in µs, per misurare la durata di un passo mentre il
+// clock virtuale è fermo (UI_TASK_BUSY_CLOCK)
+int64_t host_wall_time_us();
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <stdint.h>
+
+// Tick a 1 kHz come sul device
+typedef uint32_t TickType_t;
+typedef int      BaseType_t;
+typedef unsigned UBaseType_t;
+
+#define pdMS_TO_TICKS(ms)  ((TickType_t)(ms))
+#define portMAX_DELAY      ((TickType_t)0xFFFFFFFFUL)
+#define pdTRUE             1
+#define pdFALSE            0
+#define pdPASS             1
+#define pdFAIL             0
+
+// Due core come l'ESP32-S3; su host il core del thread lo sceglie il
+// benchmark (host_task_set_core), di default 0
+#define portNUM_PROCESSORS  2
+BaseType_t xPortGetCoreID();
+
+// Statistiche dei task come nelle librerie di arduino-esp32
+// (uxTaskGetSystemState, contatori di run-time in µs di esp_timer)
+#define configUSE_TRACE_FACILITY         1
+#define configGENERATE_RUN_TIME_STATS    1
+#define configTASKLIST_INCLUDE_COREID    1
+#define configRUN_TIME_COUNTER_TYPE      uint32_t
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "FreeRTOS.h"
+
+// ----------------------------------------------------
+// Mutex ricorsivi FreeRTOS su host
+// ----------------------------------------------------
+// Veri (std::recursive_timed_mutex): i task dello sketch non girano su
+// host, ma i benchmark possono usare più thread.
+
+typedef struct HostSemaphore *SemaphoreHandle_t;
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex();
+BaseType_t        xSemaphoreTakeRecursive(SemaphoreHandle_t sem, TickType_t ticks);
+BaseType_t        xSemaphoreGiveRecursive(SemaphoreHandle_t sem);
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "FreeRTOS.h"
+
+// ----------------------------------------------------
+// Task FreeRTOS finti
+// ----------------------------------------------------
+// Su host i task non vengono avviati: il driver di replay chiama i singoli
+// passi (es. can_port_rx_poll) nel proprio thread, in modo deterministico.
+
+typedef struct HostTask *TaskHandle_t;
+
+#define tskNO_AFFINITY  ((BaseType_t)0x7FFFFFFF)
+typedef void (*TaskFunction_t)(void *);
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack,
+                                   void *arg, UBaseType_t prio, TaskHandle_t *handle,
+                                   BaseType_t core);
+void         vTaskDelay(TickType_t ticks);
+TaskHandle_t xTaskGetCurrentTaskHandle();
+const char  *pcTaskGetName(TaskHandle_t task);   // nullptr = task corrente
+uint32_t     ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks);
+BaseType_t   xTaskNotifyGive(TaskHandle_t task);
+void         vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *woken);
+TickType_t   xTaskGetTickCount();
+BaseType_t   xTaskDelayUntil(TickType_t *prev_wake, TickType_t period);
+
+// Stato dei task: su host i task creati, "main" e i due idle, con run-time
+// e stack usato impostati dal driver (host_hal.h)
+typedef enum
+{
+  eRunning = 0,
+  eReady,
+  eBlocked,
+  eSuspended,
+  eDeleted,
+  eInvalid
+} eTaskState;
+
+typedef struct
+{
+  TaskHandle_t                xHandle;
+  const char                 *pcTaskName;
+  UBaseType_t                 xTaskNumber;
+  eTaskState                  eCurrentState;
+  UBaseType_t                 uxCurrentPriority;
+  UBaseType_t                 uxBasePriority;
+  configRUN_TIME_COUNTER_TYPE ulRunTimeCounter;
+  uint8_t                    *pxStackBase;
+  uint32_t                    usStackHighWaterMark;   // byte, come su ESP-IDF
+  BaseType_t                  xCoreID;
+} TaskStatus_t;
+
+UBaseType_t  uxTaskGetSystemState(TaskStatus_t *status, UBaseType_t max,
+                                  configRUN_TIME_COUNTER_TYPE *total_run_time);
+UBaseType_t  uxTaskGetNumberOfTasks();
+TaskHandle_t xTaskGetIdleTaskHandleForCore(BaseType_t core);
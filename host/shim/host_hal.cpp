@@ -0,0 +1,522 @@
+#include "host_hal.h"
+
+#include <Arduino.h>
+#include <stdarg.h>
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "esp_heap_caps.h"
+#include "esp_partition.h"
+#include "esp_timer.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+// ----------------------------------------------------
+// Clock virtuale
+// ----------------------------------------------------
+
+static uint64_t          s_clock_us = 0;
+static std::atomic<bool> s_clock_real{false};
+
+static const std::chrono::steady_clock::time_point s_clock_t0 = std::chrono::steady_clock::now();
+
+static uint64_t clock_now_us()
+{
+  if (s_clock_real.load(std::memory_order_relaxed)) {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - s_clock_t0).count();
+  }
+  return s_clock_us;
+}
+
+void host_clock_set_us(uint64_t us)
+{
+  s_clock_us = us;
+}
+
+uint64_t host_clock_us()
+{
+  return clock_now_us();
+}
+
+void host_clock_set_real(bool real)
+{
+  s_clock_real.store(real, std::memory_order_relaxed);
+}
+
+int64_t esp_timer_get_time()
+{
+  return (int64_t)clock_now_us();
+}
+
+int64_t host_wall_time_us()
+{
+  return (int64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - s_clock_t0).count();
+}
+
+uint32_t millis()
+{
+  return (uint32_t)(clock_now_us() / 1000ULL);
+}
+
+uint32_t micros()
+{
+  return (uint32_t)clock_now_us();
+}
+
+void delay(uint32_t ms)
+{
+  if (s_clock_real.load(std::memory_order_relaxed)) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+    return;
+  }
+  s_clock_us += (uint64_t)ms * 1000ULL;
+}
+
+size_t getArduinoLoopTaskStackSize()
+{
+  return 8192;
+}
+
+// ----------------------------------------------------
+// Serial
+// ----------------------------------------------------
+
+HostSerial Serial;
+static bool s_serial_enabled = true;
+
+void host_serial_set_enabled(bool enabled)
+{
+  s_serial_enabled = enabled;
+}
+
+size_t HostSerial::write(uint8_t c)
+{
+  if (s_serial_enabled) {
+    fputc(c, stdout);
+  }
+  return 1;
+}
+
+size_t HostSerial::write(const uint8_t *buf, size_t len)
+{
+  if (s_serial_enabled) {
+    fwrite(buf, 1, len, stdout);
+  }
+  return len;
+}
+
+size_t Print::printf(const char *fmt, ...)
+{
+  char buf[256];
+  va_list ap;
+  va_start(ap, fmt);
+  int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+  va_end(ap);
+  if (n < 0) {
+    return 0;
+  }
+  if ((size_t)n >= sizeof(buf)) {
+    n = sizeof(buf) - 1;
+  }
+  return write((const uint8_t *)buf, (size_t)n);
+}
+
+// ----------------------------------------------------
+// Task FreeRTOS (mai eseguiti su host)
+// ----------------------------------------------------
+
+struct HostTask
+{
+  uint32_t    notify_count;
+  const char *name;
+  uint32_t    stack;
+  UBaseType_t prio;
+  BaseType_t  core;
+  uint32_t    run_time_us;
+  uint32_t    stack_used;
+};
+
+static HostTask s_main_task = { 0, "main", 8192, 1, 1, 0, 0 };
+static HostTask s_idle_tasks[portNUM_PROCESSORS] = {
+  { 0, "IDLE0", 1536, 0, 0, 0, 0 },
+  { 0, "IDLE1", 1536, 0, 1, 0, 0 },
+};
+static HostTask s_fake_tasks[8];
+static size_t   s_fake_task_count = 0;
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack,
+                                   void *arg, UBaseType_t prio, TaskHandle_t *handle,
+                                   BaseType_t core)
+{
+  (void)fn; (void)arg;
+  if (s_fake_task_count >= sizeof(s_fake_tasks) / sizeof(s_fake_tasks[0])) {
+    return pdFAIL;
+  }
+  HostTask *t = &s_fake_tasks[s_fake_task_count++];
+  *t = { 0, name, stack, prio, core, 0, 0 };
+  if (handle) {
+    *handle = t;
+  }
+  return pdPASS;
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+  (void)ticks;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle()
+{
+  return &s_main_task;
+}
+
+static thread_local int s_core = 0;
+
+void host_task_set_core(int core)
+{
+  s_core = core;
+}
+
+BaseType_t xPortGetCoreID()
+{
+  return s_core;
+}
+
+const char *pcTaskGetName(TaskHandle_t task)
+{
+  return (task ? task : &s_main_task)->name;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks)
+{
+  const uint32_t n = s_main_task.notify_count;
+  if (n) {
+    s_main_task.notify_count = clear_on_exit ? 0 : n - 1;
+  } else if (ticks != portMAX_DELAY) {
+    // Nessuno notifica durante l'attesa: scade (tick = 1 ms)
+    delay(ticks);
+  }
+  return n;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+  if (task) {
+    task->notify_count++;
+  }
+  return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *woken)
+{
+  xTaskNotifyGive(task);
+  if (woken) {
+    *woken = pdTRUE;
+  }
+}
+
+TickType_t xTaskGetTickCount()
+{
+  return (TickType_t)(clock_now_us() / 1000U);
+}
+
+BaseType_t xTaskDelayUntil(TickType_t *prev_wake, TickType_t period)
+{
+  *prev_wake += period;
+  return pdTRUE;
+}
+
+static void task_status(HostTask *t, UBaseType_t number, TaskStatus_t &st)
+{
+  st = TaskStatus_t();
+  st.xHandle              = t;
+  st.pcTaskName           = t->name;
+  st.xTaskNumber          = number;
+  st.eCurrentState        = eBlocked;
+  st.uxCurrentPriority    = t->prio;
+  st.uxBasePriority       = t->prio;
+  st.ulRunTimeCounter     = t->run_time_us;
+  st.usStackHighWaterMark = t->stack > t->stack_used ? t->stack - t->stack_used : 0;
+  st.xCoreID              = t->core;
+}
+
+UBaseType_t uxTaskGetNumberOfTasks()
+{
+  return (UBaseType_t)(1 + portNUM_PROCESSORS + s_fake_task_count);
+}
+
+UBaseType_t uxTaskGetSystemState(TaskStatus_t *status, UBaseType_t max,
+                                 configRUN_TIME_COUNTER_TYPE *total_run_time)
+{
+  const UBaseType_t n = uxTaskGetNumberOfTasks();
+  if (max < n) {
+    return 0;   // come FreeRTOS: nessun task se l'array è corto
+  }
+  UBaseType_t i = 0;
+  task_status(&s_main_task, i, status[i]);
+  i++;
+  for (HostTask &t : s_idle_tasks) {
+    task_status(&t, i, status[i]);
+    i++;
+  }
+  for (size_t k = 0; k < s_fake_task_count; ++k) {
+    task_status(&s_fake_tasks[k], i, status[i]);
+    i++;
+  }
+  if (total_run_time) {
+    *total_run_time = (configRUN_TIME_COUNTER_TYPE)clock_now_us();
+  }
+  return n;
+}
+
+TaskHandle_t xTaskGetIdleTaskHandleForCore(BaseType_t core)
+{
+  return (core >= 0 && core < portNUM_PROCESSORS) ? &s_idle_tasks[core] : nullptr;
+}
+
+void host_task_add_run_time(TaskHandle_t task, uint32_t us)
+{
+  (task ? task : &s_main_task)->run_time_us += us;
+}
+
+void host_task_set_stack_used(TaskHandle_t task, uint32_t bytes)
+{
+  HostTask *t = task ? task : &s_main_task;
+  if (bytes > t->stack_used) {
+    t->stack_used = bytes;   // high-water mark: non scende mai
+  }
+}
+
+uint32_t host_task_notify_take(TaskHandle_t task)
+{
+  if (!task) {
+    return 0;
+  }
+  const uint32_t n = task->notify_count;
+  task->notify_count = 0;
+  return n;
+}
+
+// ----------------------------------------------------
+// Mutex ricorsivi
+// ----------------------------------------------------
+
+struct HostSemaphore
+{
+  std::recursive_timed_mutex mutex;
+};
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex()
+{
+  return new HostSemaphore();
+}
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t sem, TickType_t ticks)
+{
+  if (ticks == portMAX_DELAY) {
+    sem->mutex.lock();
+    return pdTRUE;
+  }
+  return sem->mutex.try_lock_for(std::chrono::milliseconds(ticks)) ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t sem)
+{
+  sem->mutex.unlock();
+  return pdTRUE;
+}
+
+// ----------------------------------------------------
+// Heap
+// ----------------------------------------------------
+
+void *heap_caps_malloc(size_t size, uint32_t caps)
+{
+  (void)caps;
+  return malloc(size);
+}
+
+void *heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps)
+{
+  (void)caps;
+  void *p = nullptr;
+  if (alignment < sizeof(void *)) {
+    alignment = sizeof(void *);
+  }
+  return posix_memalign(&p, alignment, size) == 0 ? p : nullptr;
+}
+
+void heap_caps_free(void *ptr)
+{
+  free(ptr);
+}
+
+struct HostHeap
+{
+  size_t free;
+  size_t min_free;
+  size_t largest;
+};
+
+// Default vicini a un ESP32-S3 con 8 MB di PSRAM appena avviato
+static HostHeap s_heap_internal = { 200 * 1024, 180 * 1024, 110 * 1024 };
+static HostHeap s_heap_psram    = { 8000 * 1024, 7900 * 1024, 7900 * 1024 };
+
+static const HostHeap &host_heap(uint32_t caps)
+{
+  return (caps & MALLOC_CAP_SPIRAM) ? s_heap_psram : s_heap_internal;
+}
+
+void host_heap_set(bool psram, size_t free, size_t min_free, size_t largest)
+{
+  (psram ? s_heap_psram : s_heap_internal) = { free, min_free, largest };
+}
+
+size_t heap_caps_get_free_size(uint32_t caps)
+{
+  return host_heap(caps).free;
+}
+
+size_t heap_caps_get_minimum_free_size(uint32_t caps)
+{
+  return host_heap(caps).min_free;
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps)
+{
+  return host_heap(caps).largest;
+}
+
+// ----------------------------------------------------
+// Partizioni (assenti)
+// ----------------------------------------------------
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type,
+                                                esp_partition_subtype_t subtype,
+                                                const char *label)
+{
+  (void)type; (void)subtype; (void)label;
+  return nullptr;
+}
+
+esp_err_t esp_partition_write(const esp_partition_t *part, size_t dst_offset,
+                              const void *src, size_t size)
+{
+  (void)part; (void)dst_offset; (void)src; (void)size;
+  return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t esp_partition_erase_range(const esp_partition_t *part, size_t offset, size_t size)
+{
+  (void)part; (void)offset; (void)size;
+  return ESP_ERR_NOT_FOUND;
+}
+
+// ----------------------------------------------------
+// TWAI
+// ----------------------------------------------------
+
+static std::deque<twai_message_t> s_twai_rx;
+static twai_filter_config_t       s_twai_filter = TWAI_FILTER_CONFIG_ACCEPT_ALL();
+static bool                       s_twai_installed = false;
+static bool                       s_twai_running   = false;
+static uint64_t                   s_twai_rejected  = 0;
+
+// Stessa logica del controller (registri come da TRM ESP32-S3)
+static bool twai_filter_match(const twai_message_t &m)
+{
+  const uint32_t code = s_twai_filter.acceptance_code;
+  const uint32_t mask = s_twai_filter.acceptance_mask;
+  const uint32_t d0   = m.data_length_code > 0 ? m.data[0] : 0;
+  const uint32_t d1   = m.data_length_code > 1 ? m.data[1] : 0;
+
+  if (s_twai_filter.single_filter) {
+    const uint32_t word = m.extd
+        ? (m.identifier << 3) | ((uint32_t)m.rtr << 2)
+        : (m.identifier << 21) | ((uint32_t)m.rtr << 20) | (d0 << 8) | d1;
+    return ((word ^ code) & ~mask) == 0;
+  }
+
+  // Dual filter: estesi sui bit ID[28:13], standard su ID + RTR + nibble alto di data[0]
+  const uint32_t half = m.extd
+      ? (m.identifier >> 13) & 0xFFFFU
+      : ((m.identifier & 0x7FFU) << 5) | ((uint32_t)m.rtr << 4) | (d0 >> 4);
+  const bool f1 = ((half ^ (code >> 16)) & ~(mask >> 16) & 0xFFFFU) == 0;
+  const bool f2 = ((half ^ code) & ~mask & 0xFFFFU) == 0;
+  return f1 || f2;
+}
+
+bool host_twai_push(const twai_message_t &msg)
+{
+  if (!s_twai_running || !twai_filter_match(msg)) {
+    s_twai_rejected++;
+    return false;
+  }
+  s_twai_rx.push_back(msg);
+  return true;
+}
+
+size_t host_twai_pending()
+{
+  return s_twai_rx.size();
+}
+
+uint64_t host_twai_rejected()
+{
+  return s_twai_rejected;
+}
+
+esp_err_t twai_driver_install(const twai_general_config_t *g_config,
+                              const twai_timing_config_t *t_config,
+                              const twai_filter_config_t *f_config)
+{
+  (void)g_config; (void)t_config;
+  if (s_twai_installed) {
+    return ESP_ERR_INVALID_STATE;
+  }
+  s_twai_filter    = *f_config;
+  s_twai_installed = true;
+  return ESP_OK;
+}
+
+esp_err_t twai_driver_uninstall()
+{
+  if (!s_twai_installed || s_twai_running) {
+    return ESP_ERR_INVALID_STATE;
+  }
+  s_twai_installed = false;
+  s_twai_rx.clear();
+  return ESP_OK;
+}
+
+esp_err_t twai_start()
+{
+  if (!s_twai_installed) {
+    return ESP_ERR_INVALID_STATE;
+  }
+  s_twai_running = true;
+  return ESP_OK;
+}
+
+esp_err_t twai_stop()
+{
+  s_twai_running = false;
+  return ESP_OK;
+}
+
+esp_err_t twai_receive(twai_message_t *message, TickType_t ticks_to_wait)
+{
+  (void)ticks_to_wait;   // tempo virtuale: non si aspetta mai
+  if (s_twai_rx.empty()) {
+    return ESP_ERR_TIMEOUT;
+  }
+  *message = s_twai_rx.front();
+  s_twai_rx.pop_front();
+  return ESP_OK;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+// ----------------------------------------------------
+// Controllo dell'HAL finto da parte del driver di replay
+// ----------------------------------------------------
+
+#include <stddef.h>
+#include <stdint.h>
+#include "driver/twai.h"
+#include "freertos/task.h"
+
+// Clock virtuale (µs): esp_timer_get_time(), millis(), micros()
+void     host_clock_set_us(uint64_t us);
+uint64_t host_clock_us();
+
+// Clock reale (steady_clock) al posto di quello virtuale, per i benchmark
+// con più thread: host_clock_set_us() non ha più effetto e delay() dorme
+void     host_clock_set_real(bool real);
+
+// Accoda un frame nel TWAI finto, applicando il filtro di accettazione
+// installato come farebbe il controller. False se il filtro lo scarta.
+bool     host_twai_push(const twai_message_t &msg);
+size_t   host_twai_pending();
+uint64_t host_twai_rejected();
+
+// Abilita/disabilita l'uscita di Serial su stdout (default: abilitata)
+void host_serial_set_enabled(bool enabled);
+
+// Notifiche arrivate a un task finto (xTaskNotifyGive) dall'ultima
+// chiamata, azzerate: il driver di replay decide così quando far girare
+// il passo del task al posto dello scheduler
+uint32_t host_task_notify_take(TaskHandle_t task);
+
+// Core riportato da xPortGetCoreID() al thread chiamante (default 0), per i
+// benchmark che simulano i task dei due core con più thread
+void host_task_set_core(int core);
+
+// Run-time (µs) e stack usato (byte) riportati da uxTaskGetSystemState()
+// per un task finto: il driver li fa crescere al posto dello scheduler.
+// nullptr = "main"; xTaskGetIdleTaskHandleForCore() dà gli idle.
+void host_task_add_run_time(TaskHandle_t task, uint32_t us);
+void host_task_set_stack_used(TaskHandle_t task, uint32_t bytes);
+
+// Heap riportato da heap_caps_get_*_size per MALLOC_CAP_SPIRAM o interno
+void host_heap_set(bool psram, size_t free, size_t min_free, size_t largest);
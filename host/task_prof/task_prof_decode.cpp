@@ -0,0 +1,230 @@
+// ----------------------------------------------------
+// Decoder del profilo dei task (task_prof) catturato dalla seriale
+// ----------------------------------------------------
+// Cerca i frame di task_prof_format.h nel flusso (comando 'j'), ne verifica
+// il checksum e stampa per ogni campione carico dei core, intervallo
+// massimo di loop(), heap e una riga per task; con --csv una riga per task
+// per campione, da aprire in un foglio di calcolo. Il resto del flusso
+// (testo, frame dlog) è saltato.
+//
+// Su stderr un riepilogo di tutta la cattura: carico medio/massimo dei
+// core, loop() fermo al massimo, heap minimo e, per task, CPU media/massima
+// e stack massimo usato: il numero da guardare per dimensionare uno stack.
+//
+// Uso:
+//   task_prof_decode [--csv] [cattura.bin | -]
+//
+// Esempio di cattura: comando 'j' sulla console, poi
+//   cat /dev/ttyACM0 > cattura.bin
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "task_prof_format.h"
+
+static bool read_all(FILE *f, std::vector<uint8_t> &buf)
+{
+  uint8_t chunk[65536];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) {
+    buf.insert(buf.end(), chunk, chunk + n);
+  }
+  return !ferror(f);
+}
+
+struct TaskSummary
+{
+  uint64_t samples      = 0;
+  uint64_t cpu_sum      = 0;   // ‰
+  uint16_t cpu_max      = 0;
+  uint32_t stack_size   = 0;
+  uint32_t free_min     = UINT32_MAX;
+  uint8_t  core         = TASK_PROF_CORE_ANY;
+};
+
+class TaskProfDecoder
+{
+public:
+  explicit TaskProfDecoder(bool csv) : csv_(csv)
+  {
+    if (csv_) {
+      printf("t_s,task,core,prio,cpu_pct,stack,stack_free_min\n");
+    }
+  }
+
+  void run(const uint8_t *p, const uint8_t *end)
+  {
+    while (p < end) {
+      const size_t len = frame_len(p, end);
+      if (len == 0) {
+        p++;
+        continue;
+      }
+      TaskProfSnapshot s;
+      if (!task_prof_decode(p + TASK_PROF_FRAME_HDR, len - TASK_PROF_FRAME_HDR - 1, s)) {
+        bad_++;
+      } else {
+        sample(s);
+      }
+      p += len;
+    }
+  }
+
+  void report() const
+  {
+    fprintf(stderr, "[task_prof_decode] %llu campioni, %llu frame corrotti\n",
+            (unsigned long long)samples_, (unsigned long long)bad_);
+    if (!samples_) {
+      return;
+    }
+    for (int c = 0; c < TASK_PROF_CORES; ++c) {
+      fprintf(stderr, "  core %d: carico medio %.1f%%, massimo %.1f%%\n", c,
+              load_samples_ ? load_sum_[c] / 10.0 / load_samples_ : 0.0, load_max_[c] / 10.0);
+    }
+    fprintf(stderr, "  loop() fermo al massimo %u ms\n", loop_gap_max_ms_);
+    fprintf(stderr, "  heap interno minimo %.1f KB (blocco max minimo %.1f KB), "
+                    "PSRAM minima %.1f KB\n",
+            internal_min_ / 1024.0, internal_largest_min_ / 1024.0, psram_min_ / 1024.0);
+    fprintf(stderr, "  %-16s core  CPU media  CPU max   stack  usato max  libero min\n", "task");
+    for (const auto &kv : tasks_) {
+      const TaskSummary &t = kv.second;
+      char core[4] = "-";
+      if (t.core != TASK_PROF_CORE_ANY) {
+        snprintf(core, sizeof(core), "%u", (unsigned)t.core);
+      }
+      char size[12] = "?";
+      char used[12] = "?";
+      if (t.stack_size) {
+        snprintf(size, sizeof(size), "%u", t.stack_size);
+        snprintf(used, sizeof(used), "%u", t.stack_size - t.free_min);
+      }
+      fprintf(stderr, "  %-16s %4s %9.1f%% %7.1f%% %7s %10s %11u\n", kv.first.c_str(), core,
+              t.cpu_sum / 10.0 / t.samples, t.cpu_max / 10.0, size, used, t.free_min);
+    }
+  }
+
+private:
+  // Lunghezza del frame valido che inizia in p, 0 se non è un frame
+  size_t frame_len(const uint8_t *p, const uint8_t *end)
+  {
+    if (end - p < TASK_PROF_FRAME_HDR + 1 || p[0] != TASK_PROF_SYNC0 || p[1] != TASK_PROF_SYNC1) {
+      return 0;
+    }
+    const size_t payload = (size_t)p[3] | ((size_t)p[4] << 8);
+    const size_t total   = TASK_PROF_FRAME_HDR + payload + 1;
+    if (p[2] != TASK_PROF_FRAME_SAMPLE || total > TASK_PROF_FRAME_MAX || (size_t)(end - p) < total) {
+      return 0;
+    }
+    if (task_prof_checksum(p + 2, 3 + payload) != p[total - 1]) {
+      bad_++;
+      return 0;
+    }
+    return total;
+  }
+
+  void sample(const TaskProfSnapshot &s)
+  {
+    samples_++;
+    const double t_s = s.t_us / 1e6;
+    if (csv_) {
+      for (uint8_t i = 0; i < s.count; ++i) {
+        const TaskProfTask &t = s.task[i];
+        printf("%.3f,%s,%d,%u,%.1f,%u,%u\n", t_s, t.name,
+               t.core == TASK_PROF_CORE_ANY ? -1 : (int)t.core, (unsigned)t.prio,
+               t.cpu_permille / 10.0, t.stack_size, t.stack_free_min);
+      }
+    } else {
+      printf("[%10.3f] finestra %u ms: core 0 %.1f%%, core 1 %.1f%%, loop() fermo al massimo %u ms\n",
+             t_s, s.window_us / 1000U, s.core_load_permille[0] / 10.0,
+             s.core_load_permille[1] / 10.0, s.loop_gap_max_us / 1000U);
+      printf("             interno %u (min %u, blocco %u), PSRAM %u (min %u, blocco %u)\n",
+             s.internal.free, s.internal.min_free, s.internal.largest, s.psram.free,
+             s.psram.min_free, s.psram.largest);
+      for (uint8_t i = 0; i < s.count; ++i) {
+        const TaskProfTask &t = s.task[i];
+        printf("             %-16s core %c prio %2u  %5.1f%%  stack %5u libero %5u\n", t.name,
+               t.core == TASK_PROF_CORE_ANY ? '-' : (char)('0' + t.core), (unsigned)t.prio,
+               t.cpu_permille / 10.0, t.stack_size, t.stack_free_min);
+      }
+    }
+
+    // Il primo campione dopo l'avvio ha finestra 0 (nessun carico)
+    if (s.window_us) {
+      load_samples_++;
+      for (int c = 0; c < TASK_PROF_CORES; ++c) {
+        load_sum_[c] += s.core_load_permille[c];
+        load_max_[c]  = std::max(load_max_[c], s.core_load_permille[c]);
+      }
+    }
+    loop_gap_max_ms_      = std::max(loop_gap_max_ms_, s.loop_gap_max_us / 1000U);
+    internal_min_         = std::min(internal_min_, s.internal.min_free);
+    internal_largest_min_ = std::min(internal_largest_min_, s.internal.largest);
+    psram_min_            = std::min(psram_min_, s.psram.min_free);
+
+    for (uint8_t i = 0; i < s.count; ++i) {
+      const TaskProfTask &t = s.task[i];
+      TaskSummary &sum = tasks_[t.name];
+      sum.samples++;
+      sum.cpu_sum   += t.cpu_permille;
+      sum.cpu_max    = std::max(sum.cpu_max, t.cpu_permille);
+      sum.stack_size = t.stack_size;
+      sum.free_min   = std::min(sum.free_min, t.stack_free_min);
+      sum.core       = t.core;
+    }
+  }
+
+  bool                               csv_;
+  std::map<std::string, TaskSummary> tasks_;
+  uint64_t                           samples_              = 0;
+  uint64_t                           bad_                  = 0;
+  uint64_t                           load_samples_         = 0;
+  uint64_t                           load_sum_[TASK_PROF_CORES] = {};
+  uint16_t                           load_max_[TASK_PROF_CORES] = {};
+  uint32_t                           loop_gap_max_ms_      = 0;
+  uint32_t                           internal_min_         = UINT32_MAX;
+  uint32_t                           internal_largest_min_ = UINT32_MAX;
+  uint32_t                           psram_min_            = UINT32_MAX;
+};
+
+int main(int argc, char **argv)
+{
+  bool        csv  = false;
+  const char *path = "-";
+
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "--csv")) {
+      csv = true;
+    } else if (argv[i][0] != '-' || !strcmp(argv[i], "-")) {
+      path = argv[i];
+    } else {
+      fprintf(stderr, "uso: task_prof_decode [--csv] [cattura.bin | -]\n");
+      return 2;
+    }
+  }
+
+  FILE *f = !strcmp(path, "-") ? stdin : fopen(path, "rb");
+  if (!f) {
+    fprintf(stderr, "impossibile aprire %s\n", path);
+    return 1;
+  }
+  std::vector<uint8_t> buf;
+  const bool ok = read_all(f, buf);
+  if (f != stdin) {
+    fclose(f);
+  }
+  if (!ok) {
+    fprintf(stderr, "errore di lettura su %s\n", path);
+    return 1;
+  }
+
+  TaskProfDecoder dec(csv);
+  dec.run(buf.data(), buf.data() + buf.size());
+  dec.report();
+  return 0;
+}
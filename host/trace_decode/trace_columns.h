@@ -0,0 +1,85 @@
+#pragma once
+
+// ----------------------------------------------------
+// Formato a colonne delle tracce decodificate (reefilla_trace_decode)
+// ----------------------------------------------------
+// Una cartella per traccia, un file <NomeSegnale>.col per segnale
+// decodificato dal firmware, più columns.txt con l'elenco leggibile.
+// Ogni file (little endian):
+//
+//   TraceColumnHeader (88 byte)
+//   count campioni, ciascuno:
+//     varint : zigzag(timestamp_us - timestamp_us precedente)
+//     varint : zigzag(raw - raw precedente)
+//   (il primo campione fa la differenza da 0)
+//
+// Il raw è quello del bus con segno esteso, come lo vede il firmware prima
+// di scala e InvalidRawValue: valore fisico = raw * factor + offset, dato
+// non disponibile se TRACE_COL_F_INVALID e raw == invalid_raw. Un segnale
+// che non cambia costa 1 byte di valore più 1..3 di tempo per campione.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define TRACE_COL_MAGIC    0x314C4352UL   // "RCL1" in little endian
+#define TRACE_COL_VERSION  1
+
+#define TRACE_COL_F_SIGNED   0x01
+#define TRACE_COL_F_INVALID  0x02   // invalid_raw valido (InvalidRawValue nel DBC)
+
+#define TRACE_COL_VARINT_MAX  10    // varint di 64 bit
+
+struct TraceColumnHeader
+{
+  uint32_t magic;         // TRACE_COL_MAGIC
+  uint16_t version;       // TRACE_COL_VERSION
+  uint8_t  flags;         // TRACE_COL_F_*
+  uint8_t  reserved;      // 0
+  float    factor;
+  float    offset;
+  int64_t  invalid_raw;   // raw con segno esteso
+  uint64_t count;         // campioni
+  char     name[40];      // terminati da '\0'
+  char     unit[16];
+};
+
+static_assert(sizeof(TraceColumnHeader) == 88, "header colonna: layout inatteso");
+
+// ----------------------------------------------------
+// Varint (LEB128) a 64 bit e zigzag
+// ----------------------------------------------------
+
+static inline uint64_t trace_col_zigzag(int64_t v)
+{
+  return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+}
+
+static inline int64_t trace_col_unzigzag(uint64_t v)
+{
+  return (int64_t)(v >> 1) ^ -(int64_t)(v & 1);
+}
+
+static inline size_t trace_col_put_varint(uint8_t *p, uint64_t v)
+{
+  size_t n = 0;
+  while (v >= 0x80U) {
+    p[n++] = (uint8_t)(v | 0x80U);
+    v >>= 7;
+  }
+  p[n++] = (uint8_t)v;
+  return n;
+}
+
+static inline bool trace_col_get_varint(const uint8_t *&p, const uint8_t *end, uint64_t &v)
+{
+  uint64_t result = 0;
+  for (uint32_t shift = 0; shift < 70 && p < end; shift += 7) {
+    const uint8_t b = *p++;
+    result |= (uint64_t)(b & 0x7FU) << shift;
+    if ((b & 0x80U) == 0) {
+      v = result;
+      return true;
+    }
+  }
+  return false;
+}
@@ -0,0 +1,592 @@
+// ----------------------------------------------------
+// Decodifica massiva di tracce CAN in colonne, su tutti i core
+// ----------------------------------------------------
+// Decodifica le tracce registrate dal firmware (.ctr, anche settimane di
+// bus) con lo stesso codice del device: dbc_decode_raw() di
+// dbc_decoder_<prodotto>.cpp, stessa dispatch e stessi layout. I file sono
+// mappati in memoria (can_trace_reader.h); i blocchi da 4 KB della traccia
+// sono indipendenti, quindi gruppi di blocchi consecutivi (chunk) vengono
+// decodificati in parallelo, un thread per core. Un solo writer accoda i
+// chunk alle colonne in ordine di file, con al più WINDOW_PER_THREAD chunk
+// per thread in memoria: l'uscita non dipende dal numero di thread.
+//
+// L'uscita è una cartella con un file per segnale (trace_columns.h).
+//
+// Uso:
+//   reefilla_trace_decode [--threads N] [--chunk-blocks N] -o CARTELLA file.ctr...
+//   reefilla_trace_decode --generate file.ctr MB
+//
+// --generate scrive una traccia sintetica di circa MB megabyte (messaggi
+// VCU a 100 ms più 40 ID di sfondo), per misurare il throughput.
+
+#include <Arduino.h>
+
+#include <sys/stat.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "host_hal.h"
+#include "can_trace_reader.h"
+#include "trace_columns.h"
+
+#include "dbc_decoder.h"
+#include "dbc_generated.h"
+
+using Clock = std::chrono::steady_clock;
+
+static constexpr size_t DEFAULT_CHUNK_BLOCKS = 256;   // 1 MB di traccia per chunk
+static constexpr size_t WINDOW_PER_THREAD    = 4;
+
+static double seconds_since(Clock::time_point t0)
+{
+  return std::chrono::duration<double>(Clock::now() - t0).count();
+}
+
+// ----------------------------------------------------
+// Buffer di byte a crescita geometrica (senza azzeramento come vector)
+// ----------------------------------------------------
+
+class ByteBuf
+{
+public:
+  ByteBuf() = default;
+  ByteBuf(const ByteBuf &) = delete;
+  ByteBuf &operator=(const ByteBuf &) = delete;
+  ~ByteBuf() { free(p_); }
+
+  // Spazio per almeno n byte dopo la fine: scrivere, poi commit()
+  uint8_t *reserve(size_t n)
+  {
+    if (size_ + n > cap_) {
+      cap_ = (size_ + n) * 2 > 4096 ? (size_ + n) * 2 : 4096;
+      p_   = static_cast<uint8_t *>(realloc(p_, cap_));
+      if (!p_) {
+        fprintf(stderr, "memoria esaurita\n");
+        exit(1);
+      }
+    }
+    return p_ + size_;
+  }
+
+  void commit(size_t n) { size_ += n; }
+
+  const uint8_t *data() const { return p_; }
+  size_t         size() const { return size_; }
+
+private:
+  uint8_t *p_    = nullptr;
+  size_t   size_ = 0;
+  size_t   cap_  = 0;
+};
+
+// ----------------------------------------------------
+// Chunk: colonne parziali di un gruppo di blocchi
+// ----------------------------------------------------
+// Il primo campione resta fuori dal buffer: la sua differenza dipende
+// dall'ultimo campione del chunk precedente, nota solo al writer.
+
+struct ColumnChunk
+{
+  uint64_t count     = 0;
+  uint64_t first_ts  = 0;
+  int64_t  first_raw = 0;
+  uint64_t last_ts   = 0;
+  int64_t  last_raw  = 0;
+  ByteBuf  tail;   // campioni dal secondo in poi
+
+  void add(uint64_t ts, int64_t raw)
+  {
+    if (count++ == 0) {
+      first_ts  = ts;
+      first_raw = raw;
+    } else {
+      uint8_t *p = tail.reserve(2 * TRACE_COL_VARINT_MAX);
+      size_t   n = trace_col_put_varint(p, trace_col_zigzag((int64_t)(ts - last_ts)));
+      n += trace_col_put_varint(p + n, trace_col_zigzag(raw - last_raw));
+      tail.commit(n);
+    }
+    last_ts  = ts;
+    last_raw = raw;
+  }
+};
+
+struct Chunk
+{
+  ColumnChunk col[DBC_CHG_DECODED];
+  uint64_t    frames  = 0;
+  uint64_t    decoded = 0;   // frame di messaggi gestiti
+  uint64_t    corrupt = 0;   // blocchi terminati prima di header.count
+  bool        done    = false;
+};
+
+static void decode_chunk(const uint8_t *const *blocks, size_t n_blocks, Chunk &out)
+{
+  int64_t  raw[DBC_CHG_DECODED];
+  CanFrame frame = {};
+
+  for (size_t b = 0; b < n_blocks; ++b) {
+    CanTraceCursor cur(blocks[b]);
+    CanTraceRecord rec;
+    uint32_t       n = 0;
+
+    while (cur.next(rec)) {
+      ++n;
+      frame.id           = rec.id;
+      frame.extended     = rec.extended;
+      frame.rtr          = rec.rtr;
+      frame.dlc          = rec.dlc;
+      frame.timestamp_us = rec.timestamp_us;
+      frame.timestamp_ms = (uint32_t)(rec.timestamp_us / 1000ULL);
+      memset(frame.data, 0, sizeof(frame.data));
+      memcpy(frame.data, rec.data, rec.dlc > 8 ? 8 : rec.dlc);
+
+      uint32_t mask = dbc_decode_raw(frame, raw);
+      out.decoded += mask != 0;
+      while (mask) {
+        const unsigned c = (unsigned)__builtin_ctz(mask);
+        out.col[c].add(rec.timestamp_us, raw[c]);
+        mask &= mask - 1;
+      }
+    }
+    out.frames  += n;
+    out.corrupt += n < cur.header().count;
+  }
+}
+
+// ----------------------------------------------------
+// Writer: un file per segnale, chunk accodati in ordine
+// ----------------------------------------------------
+
+class ColumnWriter
+{
+public:
+  ~ColumnWriter() { close(); }
+
+  bool open(const std::string &dir)
+  {
+    dir_ = dir;
+    mkdir(dir.c_str(), 0755);
+    for (uint8_t i = 0; i < DBC_CHG_DECODED; ++i) {
+      Column &c = col_[i];
+      const DbcSignal *s = dbc_signal_desc(static_cast<DbcChange>(i));
+
+      c.hdr = TraceColumnHeader();
+      c.hdr.magic       = TRACE_COL_MAGIC;
+      c.hdr.version     = TRACE_COL_VERSION;
+      c.hdr.flags       = (s->is_signed ? TRACE_COL_F_SIGNED : 0) |
+                          (s->invalid.present ? TRACE_COL_F_INVALID : 0);
+      c.hdr.factor      = s->factor;
+      c.hdr.offset      = s->offset;
+      c.hdr.invalid_raw = s->invalid.present ? dbc_raw_signed(*s, s->invalid.raw) : 0;
+      snprintf(c.hdr.name, sizeof(c.hdr.name), "%s", s->name);
+      snprintf(c.hdr.unit, sizeof(c.hdr.unit), "%s", s->unit);
+
+      const std::string path = dir + "/" + s->name + ".col";
+      c.f = fopen(path.c_str(), "wb");
+      if (!c.f) {
+        fprintf(stderr, "impossibile creare %s\n", path.c_str());
+        return false;
+      }
+      setvbuf(c.f, nullptr, _IOFBF, 1 << 20);
+      fwrite(&c.hdr, sizeof(c.hdr), 1, c.f);   // count riscritto da close()
+    }
+    return true;
+  }
+
+  void append(const Chunk &chunk)
+  {
+    for (uint8_t i = 0; i < DBC_CHG_DECODED; ++i) {
+      const ColumnChunk &cc = chunk.col[i];
+      Column            &c  = col_[i];
+      if (cc.count == 0) {
+        continue;
+      }
+      uint8_t head[2 * TRACE_COL_VARINT_MAX];
+      size_t  n = trace_col_put_varint(head, trace_col_zigzag((int64_t)(cc.first_ts - c.last_ts)));
+      n += trace_col_put_varint(head + n, trace_col_zigzag(cc.first_raw - c.last_raw));
+      fwrite(head, 1, n, c.f);
+      fwrite(cc.tail.data(), 1, cc.tail.size(), c.f);
+
+      c.hdr.count += cc.count;
+      c.bytes     += n + cc.tail.size();
+      c.last_ts    = cc.last_ts;
+      c.last_raw   = cc.last_raw;
+    }
+  }
+
+  // Riscrive i conteggi negli header e l'indice columns.txt
+  bool close()
+  {
+    bool ok = true;
+    FILE *index = dir_.empty() ? nullptr : fopen((dir_ + "/columns.txt").c_str(), "w");
+    if (index) {
+      fprintf(index, "# nome unità factor offset campioni byte\n");
+    }
+    for (Column &c : col_) {
+      if (!c.f) {
+        continue;
+      }
+      fseek(c.f, 0, SEEK_SET);
+      fwrite(&c.hdr, sizeof(c.hdr), 1, c.f);
+      ok &= fclose(c.f) == 0;
+      c.f = nullptr;
+      if (index) {
+        fprintf(index, "%s %s %g %g %llu %llu\n", c.hdr.name, c.hdr.unit[0] ? c.hdr.unit : "-",
+                c.hdr.factor, c.hdr.offset, (unsigned long long)c.hdr.count,
+                (unsigned long long)c.bytes);
+      }
+    }
+    if (index) {
+      fclose(index);
+    }
+    dir_.clear();
+    return ok;
+  }
+
+  uint64_t samples() const
+  {
+    uint64_t n = 0;
+    for (const Column &c : col_) n += c.hdr.count;
+    return n;
+  }
+
+  uint64_t bytes() const
+  {
+    uint64_t n = 0;
+    for (const Column &c : col_) n += sizeof(TraceColumnHeader) + c.bytes;
+    return n;
+  }
+
+private:
+  struct Column
+  {
+    FILE             *f        = nullptr;
+    TraceColumnHeader hdr      = {};
+    uint64_t          bytes    = 0;
+    uint64_t          last_ts  = 0;
+    int64_t           last_raw = 0;
+  };
+
+  std::string dir_;
+  Column      col_[DBC_CHG_DECODED];
+};
+
+// ----------------------------------------------------
+// Decodifica parallela
+// ----------------------------------------------------
+
+struct Totals
+{
+  uint64_t frames  = 0;
+  uint64_t decoded = 0;
+  uint64_t corrupt = 0;
+};
+
+static Totals decode_parallel(const std::vector<const uint8_t *> &blocks, size_t chunk_blocks,
+                              unsigned threads, ColumnWriter &writer)
+{
+  const size_t n_chunks = (blocks.size() + chunk_blocks - 1) / chunk_blocks;
+  const size_t window   = (size_t)threads * WINDOW_PER_THREAD;
+
+  std::vector<std::unique_ptr<Chunk>> chunks(n_chunks);
+  std::mutex              mu;
+  std::condition_variable cv_space;   // writer -> worker: c'è posto nella finestra
+  std::condition_variable cv_done;    // worker -> writer: chunk pronto
+  size_t next    = 0;
+  size_t written = 0;
+
+  auto worker = [&]() {
+    for (;;) {
+      size_t i;
+      {
+        std::unique_lock<std::mutex> lk(mu);
+        cv_space.wait(lk, [&] { return next >= n_chunks || next < written + window; });
+        if (next >= n_chunks) {
+          return;
+        }
+        i = next++;
+      }
+      std::unique_ptr<Chunk> c(new Chunk());
+      const size_t first = i * chunk_blocks;
+      const size_t count = std::min(chunk_blocks, blocks.size() - first);
+      decode_chunk(&blocks[first], count, *c);
+      {
+        std::lock_guard<std::mutex> lk(mu);
+        c->done   = true;
+        chunks[i] = std::move(c);
+      }
+      cv_done.notify_one();
+    }
+  };
+
+  std::vector<std::thread> pool;
+  for (unsigned t = 0; t < threads; ++t) {
+    pool.emplace_back(worker);
+  }
+
+  Totals tot;
+  for (size_t i = 0; i < n_chunks; ++i) {
+    std::unique_ptr<Chunk> c;
+    {
+      std::unique_lock<std::mutex> lk(mu);
+      cv_done.wait(lk, [&] { return chunks[i] && chunks[i]->done; });
+      c = std::move(chunks[i]);
+    }
+    writer.append(*c);
+    tot.frames  += c->frames;
+    tot.decoded += c->decoded;
+    tot.corrupt += c->corrupt;
+    c.reset();
+    {
+      std::lock_guard<std::mutex> lk(mu);
+      written = i + 1;
+    }
+    cv_space.notify_all();
+  }
+
+  for (std::thread &t : pool) {
+    t.join();
+  }
+  return tot;
+}
+
+// ----------------------------------------------------
+// Traccia sintetica (--generate)
+// ----------------------------------------------------
+// Stesso formato di can_trace.cpp: dizionario degli ID per blocco, delta
+// di tempo in varint, blocchi contigui come in un dump di partizione.
+
+class TraceFileWriter
+{
+public:
+  explicit TraceFileWriter(FILE *f) : f_(f) {}
+
+  void add(uint64_t ts_us, uint32_t id, bool ext, const uint8_t data[8])
+  {
+    if (count_ == 0 || ts_us < last_us_ || ts_us - last_us_ > UINT32_MAX ||
+        count_ == UINT16_MAX || (size_t)used_ + CAN_TRACE_REC_MAX > CAN_TRACE_PAYLOAD_SIZE) {
+      seal();
+      base_us_ = ts_us;
+      last_us_ = ts_us;
+    }
+
+    uint8_t *p = block_ + sizeof(CanTraceBlockHeader) + used_;
+    uint8_t *start = p;
+    const uint32_t key = id | (ext ? 0x80000000UL : 0);
+    uint32_t idx = 0;
+    while (idx < n_dict_ && dict_[idx] != key) {
+      ++idx;
+    }
+
+    uint8_t flags = 8 | (ext ? CAN_TRACE_F_EXT : 0);
+    if (idx == n_dict_) {
+      flags |= CAN_TRACE_F_NEW_ID;
+    }
+    *p++ = flags;
+    p += can_trace_put_varint(p, (uint32_t)(ts_us - last_us_));
+    if (idx == n_dict_) {
+      p += can_trace_put_varint(p, id);
+      if (n_dict_ < CAN_TRACE_DICT_MAX) {
+        dict_[n_dict_++] = key;
+      }
+    } else {
+      *p++ = (uint8_t)idx;
+    }
+    memcpy(p, data, 8);
+    p += 8;
+
+    used_ += (uint16_t)(p - start);
+    count_++;
+    last_us_ = ts_us;
+  }
+
+  uint64_t seal()
+  {
+    if (count_ > 0) {
+      CanTraceBlockHeader hdr = {};
+      hdr.magic   = CAN_TRACE_MAGIC;
+      hdr.seq     = ++seq_;
+      hdr.base_us = base_us_;
+      hdr.used    = used_;
+      hdr.count   = count_;
+      memcpy(block_, &hdr, sizeof(hdr));
+      memset(block_ + sizeof(hdr) + used_, 0xFF, CAN_TRACE_PAYLOAD_SIZE - used_);
+      fwrite(block_, 1, CAN_TRACE_BLOCK_SIZE, f_);
+      bytes_ += CAN_TRACE_BLOCK_SIZE;
+    }
+    used_   = 0;
+    count_  = 0;
+    n_dict_ = 0;
+    return bytes_;
+  }
+
+  uint64_t bytes() const { return bytes_; }
+
+private:
+  FILE    *f_;
+  uint8_t  block_[CAN_TRACE_BLOCK_SIZE];
+  uint16_t used_    = 0;
+  uint16_t count_   = 0;
+  uint32_t seq_     = 0;
+  uint64_t base_us_ = 0;
+  uint64_t last_us_ = 0;
+  uint32_t dict_[CAN_TRACE_DICT_MAX];
+  uint32_t n_dict_  = 0;
+  uint64_t bytes_   = 0;
+};
+
+static int generate(const char *path, double mb)
+{
+  FILE *f = fopen(path, "wb");
+  if (!f) {
+    fprintf(stderr, "impossibile creare %s\n", path);
+    return 1;
+  }
+
+  struct Source
+  {
+    uint32_t id;
+    bool     ext;
+    uint64_t period_us;
+    uint64_t next_us;
+  };
+  std::vector<Source> src;
+  for (uint16_t i = 0; i < DBC_MESSAGE_COUNT; ++i) {
+    src.push_back({ DBC_MESSAGES[i].id, DBC_MESSAGES[i].extended,
+                    1000ULL * (DBC_MESSAGES[i].cycle_ms ? DBC_MESSAGES[i].cycle_ms : 100), 7000ULL * i });
+  }
+  for (uint32_t i = 0; i < 40; ++i) {
+    src.push_back({ 0x100 + i * 7, false, 10000ULL * (1 + i % 10), 1000ULL * i });
+  }
+
+  TraceFileWriter w(f);
+  const uint64_t limit = (uint64_t)(mb * 1024.0 * 1024.0);
+  uint64_t frames = 0;
+  uint32_t rng = 0x12345678U;
+  uint8_t  d[8];
+
+  while (w.bytes() < limit) {
+    Source *next = &src[0];
+    for (Source &s : src) {
+      if (s.next_us < next->next_us) next = &s;
+    }
+    for (uint8_t &b : d) {
+      rng ^= rng << 13; rng ^= rng >> 17; rng ^= rng << 5;
+      b = (uint8_t)rng;
+    }
+    // Valori VCU lenti (come un bus vero), multiplexor a rotazione
+    if (next->ext) {
+      const uint32_t t = (uint32_t)(next->next_us / 1000000ULL);
+      d[0] = (uint8_t)(next->next_us / next->period_us % 3);
+      d[1] = (uint8_t)t;
+      d[2] = (uint8_t)(t >> 3);
+    }
+    w.add(next->next_us, next->id, next->ext, d);
+    next->next_us += next->period_us;
+    ++frames;
+  }
+  w.seal();
+  fclose(f);
+  printf("%s: %llu frame, %.1f MB\n", path, (unsigned long long)frames, w.bytes() / 1048576.0);
+  return 0;
+}
+
+// ----------------------------------------------------
+// main
+// ----------------------------------------------------
+
+static void usage()
+{
+  fprintf(stderr,
+          "uso: reefilla_trace_decode [--threads N] [--chunk-blocks N] -o CARTELLA file.ctr...\n"
+          "     reefilla_trace_decode --generate file.ctr MB\n");
+}
+
+int main(int argc, char **argv)
+{
+  unsigned    threads      = std::thread::hardware_concurrency();
+  size_t      chunk_blocks = DEFAULT_CHUNK_BLOCKS;
+  const char *out_dir      = nullptr;
+  std::vector<const char *> inputs;
+
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "--generate") && i + 2 < argc) {
+      return generate(argv[i + 1], atof(argv[i + 2]));
+    } else if (!strcmp(argv[i], "--threads") && i + 1 < argc) {
+      threads = (unsigned)strtoul(argv[++i], nullptr, 0);
+    } else if (!strcmp(argv[i], "--chunk-blocks") && i + 1 < argc) {
+      chunk_blocks = (size_t)strtoul(argv[++i], nullptr, 0);
+    } else if (!strcmp(argv[i], "-o") && i + 1 < argc) {
+      out_dir = argv[++i];
+    } else if (argv[i][0] == '-') {
+      usage();
+      return 2;
+    } else {
+      inputs.push_back(argv[i]);
+    }
+  }
+  if (!out_dir || inputs.empty() || chunk_blocks == 0) {
+    usage();
+    return 2;
+  }
+  if (threads == 0) {
+    threads = 1;
+  }
+
+  host_serial_set_enabled(false);
+  dbc_init();   // indice di dispatch: poi solo letture, condivisibile tra i thread
+  host_serial_set_enabled(true);
+
+  // Mappatura e indice dei blocchi validi, in ordine di file
+  const Clock::time_point t_scan = Clock::now();
+  std::vector<std::unique_ptr<CanTraceFile>> files;
+  std::vector<const uint8_t *> blocks;
+  uint64_t input_bytes = 0;
+  for (const char *path : inputs) {
+    std::unique_ptr<CanTraceFile> f(new CanTraceFile());
+    if (!f->open(path)) {
+      fprintf(stderr, "impossibile aprire %s\n", path);
+      return 1;
+    }
+    input_bytes += f->size();
+    f->for_each_block([&](const uint8_t *block) { blocks.push_back(block); });
+    files.push_back(std::move(f));
+  }
+  const double scan_s = seconds_since(t_scan);
+
+  ColumnWriter writer;
+  if (!writer.open(out_dir)) {
+    return 1;
+  }
+
+  const Clock::time_point t_dec = Clock::now();
+  const Totals tot = decode_parallel(blocks, chunk_blocks, threads, writer);
+  const double dec_s = seconds_since(t_dec);
+  const uint64_t samples = writer.samples();
+  const uint64_t out_bytes = writer.bytes();
+  if (!writer.close()) {
+    fprintf(stderr, "errore di scrittura in %s\n", out_dir);
+    return 1;
+  }
+
+  printf("input              : %zu file, %.1f MB, %zu blocchi (%llu corrotti)\n",
+         inputs.size(), input_bytes / 1048576.0, blocks.size(), (unsigned long long)tot.corrupt);
+  printf("frame              : %llu, %llu di messaggi decodificati\n",
+         (unsigned long long)tot.frames, (unsigned long long)tot.decoded);
+  printf("colonne            : %u segnali, %llu campioni, %.1f MB (%.2f byte/campione)\n",
+         (unsigned)DBC_CHG_DECODED, (unsigned long long)samples, out_bytes / 1048576.0,
+         samples ? (double)out_bytes / samples : 0.0);
+  printf("thread             : %u, chunk da %zu blocchi\n", threads, chunk_blocks);
+  printf("indice blocchi     : %.3f s\n", scan_s);
+  printf("decodifica         : %.3f s, %.1f M frame/s, %.0f MB/s\n", dec_s,
+         dec_s > 0 ? tot.frames / dec_s / 1e6 : 0.0,
+         dec_s > 0 ? input_bytes / dec_s / 1048576.0 : 0.0);
+  return 0;
+}
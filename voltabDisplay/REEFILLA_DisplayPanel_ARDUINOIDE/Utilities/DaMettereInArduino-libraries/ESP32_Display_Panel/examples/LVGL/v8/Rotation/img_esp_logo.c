@@ -1,426 +0,0 @@
-/*
- * SPDX-FileCopyrightText: 2021-2022 Espressif Systems (Shanghai) CO LTD
- *
- * SPDX-License-Identifier: Unlicense OR CC0-1.0
- */
-
-// NOTE: The logo in this file is registered trademark by Espressif Systems (Shanghai) CO LTD.
-
-#include "lvgl.h"
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_ESP_LOGO
-#define LV_ATTRIBUTE_IMG_ESP_LOGO
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_ESP_LOGO uint8_t img_esp_logo_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-    /*Pixel format: Blue: 2 bit, Green: 3 bit, Red: 3 bit, Alpha 8 bit */
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xe9, 0xb8, 0xe9, 0xe3, 0xe9, 0xf8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf8, 0xe9, 0xef, 0xe9, 0xdf, 0xe9, 0xd7, 0xe9, 0xc3, 0xe9, 0x9c, 0xe9, 0x78, 0xe9, 0x54, 0xe9, 0x2b, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x37, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xec, 0xe9, 0xaf, 0xe9, 0x6f, 0xe9, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x8f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe0, 0xe9, 0x88, 0xe9, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x3b, 0xe9, 0xa3, 0xe9, 0xf7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xc7, 0xe9, 0x57, 0xed, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x0f, 0xe9, 0x68, 0xe9, 0xcf, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xdc, 0xe9, 0x68, 0xe8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x08, 0xe9, 0x7c, 0xe9, 0xdb, 0xe9, 0xb3, 0xe9, 0x83, 0xe9, 0x54, 0xe9, 0x24, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x43, 0xe9, 0xb4, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe4, 0xe9, 0x5b, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x53, 0xe9, 0xe0, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf3, 0xe9, 0xb8, 0xe9, 0x74, 0xe9, 0x2f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x28, 0xe9, 0xa0, 0xe9, 0xfc, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xc3, 0xe9, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x37, 0xe9, 0xc8, 0xe9, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x14, 0xe9, 0xa7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe7, 0xe9, 0xa3, 0xe9, 0x58, 0xe5, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x28, 0xe9, 0xa8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfb, 0xe9, 0x8b, 0xe9, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x2b, 0xe9, 0xec, 0xe9, 0xff, 0xe9, 0xdc, 0xe9, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x43, 0xe9, 0xe8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf3, 0xe9, 0xa3, 0xe9, 0x47, 0xed, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x30, 0xe9, 0xbf, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xc8, 0xe9, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x1f, 0xe9, 0xe4, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe0, 0xe9, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xe9, 0x7b, 0xe9, 0xfc, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe7, 0xe9, 0x8c, 0xe9, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x57, 0xe9, 0xe3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf0, 0xe9, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x13, 0xe9, 0xd8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x08, 0xe9, 0xab, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfc, 0xe9, 0xab, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x0b, 0xe9, 0x87, 0xe9, 0xfb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xe9, 0xb0, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xaf, 0xed, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x10, 0xe9, 0xc0, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xc0, 0xe9, 0x4c, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x2f, 0xe9, 0xcf, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x9c, 0xe9, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x77, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xbc, 0xe5, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x8b, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xc7, 0xe9, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x07, 0xe9, 0x87, 0xe9, 0xfc, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xac, 0xe5, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x38, 0xe9, 0xfb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd4, 0xe5, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x8f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xb3, 0xe9, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x3f, 0xe9, 0xe4, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xaf, 0xed, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x10, 0xe9, 0xe0, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf4, 0xe9, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x8f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf8, 0xe9, 0x8f, 0xe9, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x14, 0xe9, 0xb7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x9b, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x8f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe0, 0xe9, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x03, 0xe9, 0x83, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x34, 0xe9, 0xfc, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x8f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x98, 0xe9, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x54, 0xe9, 0xf7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x03, 0xe9, 0xcb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe4, 0xe9, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x8f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe0, 0xe9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x38, 0xe9, 0xe8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xef, 0xe9, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x68, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x67, 0xe9, 0xbc, 0xe9, 0xcc, 0xe9, 0xdb, 0xe9, 0xe4, 0xe9, 0xf0, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfc, 0xe9, 0x78, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x23, 0xe9, 0xdf, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xc8, 0xe5, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x0c, 0xe9, 0xec, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x0b, 0xe9, 0x30, 0xe9, 0x58, 0xe9, 0x80, 0xe9, 0xa7, 0xe9, 0xcf, 0xe9, 0xfc, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xac, 0xe9, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x1b, 0xe9, 0xd7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x74, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfb, 0xe9, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x0c, 0xe9, 0x44, 0xe9, 0x88, 0xe9, 0xcc, 0xe9, 0xfc, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd8, 0xe9, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x13, 0xe9, 0xc8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfb, 0xe9, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x07, 0xe9, 0xe4, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x17, 0xe9, 0x64, 0xe9, 0xc3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf0, 0xe9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x0f, 0xe9, 0xcc, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xc3, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x64, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfb, 0xe9, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x1c, 0xe9, 0x77, 0xe9, 0xdb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf8, 0xe9, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x14, 0xe9, 0xd7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0x03, 0xe9, 0xdb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xe9, 0x47, 0xe9, 0xc3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfb, 0xe9, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x1c, 0xe9, 0xdf, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe4, 0xe5, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x44, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x33, 0xe9, 0x68, 0xe9, 0x8b, 0xe9, 0x9c, 0xe9, 0xab, 0xe9, 0xa8, 0xe9, 0x98, 0xe9, 0x80, 0xe9, 0x5c, 0xe9, 0x30, 0xe9, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x3c, 0xe9, 0xb8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x27, 0xe9, 0xef, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa0, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x13, 0xe9, 0x7f, 0xe9, 0xdb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf7, 0xe9, 0xc8, 0xe9, 0x97, 0xe9, 0x5f, 0xe9, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x34, 0xe9, 0xc0, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x3f, 0xe9, 0xf8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xdc, 0xe9, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xe9, 0x08, 0xe9, 0xf0, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x07, 0xe9, 0x7b, 0xe9, 0xef, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfc, 0xe9, 0xc8, 0xe9, 0x7b, 0xe9, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x54, 0xe9, 0xe8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x60, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xe9, 0x58, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf0, 0xe9, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x27, 0xe9, 0xcf, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd7, 0xe9, 0x77, 0xe9, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x10, 0xe9, 0x90, 0xe9, 0xfc, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfc, 0xe9, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x90, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xe9, 0xb3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x47, 0xe9, 0xf4, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf4, 0xe9, 0x9f, 0xe9, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x37, 0xe9, 0xdf, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf7, 0xe9, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x04, 0xe9, 0xc4, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x24, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xe9, 0x04, 0xe9, 0xf3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x48, 0xe9, 0xf7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfc, 0xe9, 0xab, 0xe9, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x0f, 0xe9, 0xa8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xef, 0xe9, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x1c, 0xe9, 0xec, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x7f, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xe9, 0x38, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf0, 0xed, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x30, 0xe9, 0xf7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfc, 0xe9, 0xa3, 0xe9, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x67, 0xe9, 0xf8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd0, 0xe9, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x4f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd8, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xe9, 0x78, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x0c, 0xe9, 0xdb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf3, 0xe9, 0x6f, 0xed, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x34, 0xe9, 0xe7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x9c, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x2c, 0x00, 0x00,
-    0x00, 0x00, 0xe9, 0xb8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x8b, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xcc, 0xe9, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x20, 0xe9, 0xd8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x0f, 0xe9, 0xe0, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x6c, 0x00, 0x00,
-    0xed, 0x03, 0xe9, 0xf3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x20, 0xe9, 0xf8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfb, 0xe9, 0x73, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x17, 0xe9, 0xcc, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf8, 0xe9, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x43, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xac, 0x00, 0x00,
-    0xe9, 0x23, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf0, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x8f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xb3, 0xe9, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x0c, 0xe9, 0xb8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd4, 0xe8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa0, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xec, 0xe0, 0x03,
-    0xe9, 0x48, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x07, 0xe9, 0xef, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe0, 0xe9, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x07, 0xe9, 0xbb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x18, 0xe9, 0xf0, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x28,
-    0xe9, 0x6f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x44, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf3, 0xe9, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x0f, 0xe9, 0xcf, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfb, 0xe9, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x73, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x50,
-    0xe9, 0x93, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x88, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf8, 0xe9, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x18, 0xe9, 0xdc, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0xe5, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x04, 0xe9, 0xd4, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x77,
-    0xe9, 0xb8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xb7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xef, 0xe9, 0xb7, 0xe9, 0xbf, 0xe9, 0xe7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x24, 0xe9, 0xe8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x4f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x9c,
-    0xe9, 0xcb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xdb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xc8, 0xe9, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x0f, 0xe9, 0x37, 0xe9, 0x74, 0xe9, 0xb7, 0xe9, 0xf4, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x3f, 0xe9, 0xfc, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xef, 0xe9, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xe9, 0xc8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xc0,
-    0xe9, 0xd7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xe8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x04, 0xe9, 0x48, 0xe9, 0xa7, 0xe9, 0xf7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfc, 0xe9, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x7f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x44, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3,
-    0xe9, 0xe3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xf0, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x0f, 0xe9, 0x68, 0xe9, 0xdf, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf8, 0xe9, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x03, 0xe9, 0xb8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfb, 0xe9, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc0, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xdf,
-    0xe9, 0xef, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xe0, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x04, 0xe9, 0x60, 0xe9, 0xdb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xec, 0xe9, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x17, 0xe9, 0xe7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x4c, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xec,
-    0xe9, 0xfb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xec, 0xe9, 0x4f, 0xed, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x04, 0xe9, 0x78, 0xe9, 0xf4, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xcc, 0xe9, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x48, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xe9, 0xd7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf3,
-    0xe9, 0xf8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x98, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xef, 0xe9, 0xbf, 0xe9, 0x93, 0xe9, 0x67, 0xe9, 0x37, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x20, 0xe9, 0xb7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xac, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x64, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xbb,
-    0xe9, 0xeb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x63, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe7, 0xe9, 0x94, 0xe9, 0x43, 0xed, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xe9, 0x74, 0xe9, 0xfb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x1c, 0xe9, 0xf3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfb, 0xe9, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x08, 0xe9, 0xec, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xab,
-    0xe9, 0xdc, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x17, 0xe9, 0xfc, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe7, 0xe9, 0x73, 0xe5, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x3b, 0xe9, 0xe4, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xeb, 0xe9, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x77, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x90, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x9b,
-    0xe9, 0xcf, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xbb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xeb, 0xe9, 0x78, 0xe5, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x1f, 0xe9, 0xd8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x04, 0xe9, 0xd4, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf0, 0xe9, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x2c, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x8b,
-    0xe9, 0xc0, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x48, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe0, 0xe9, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x14, 0xe9, 0xcb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x54, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xcb, 0xe9, 0xff, 0xe9, 0xc3, 0xe9, 0x40,
-    0xe9, 0xab, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x94, 0xe5, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x0f, 0xe9, 0xcf, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xdb, 0xe9, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x03, 0xe9, 0xd4, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x34, 0xe9, 0x20, 0x00, 0x00, 0x00, 0x00,
-    0xe9, 0x84, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x30, 0xe9, 0xfb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xdb, 0xe9, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x18, 0xe9, 0xdc, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x5f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xe9, 0x5c, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x7b, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xef, 0xe9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x24, 0xe9, 0xec, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe7, 0xe5, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0x03, 0xe9, 0xdb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xe9, 0x34, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xe9, 0xa7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf8, 0xe9, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x4c, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x67, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xe5, 0x0c, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xef, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x07, 0xe9, 0xa8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x8f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe7, 0xe5, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x0f, 0xe9, 0xf4, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xe9, 0xdf, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0x03, 0xe9, 0x8f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf8, 0xe9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x07, 0xe9, 0xd0, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa4, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xe9, 0x9f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x4b, 0xe9, 0xe3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf0, 0xe9, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x3b, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x48, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xe9, 0x5c, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x0b, 0xe9, 0x78, 0xe9, 0xe7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0xe5, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x9f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x03, 0xe9, 0xe4, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf7, 0xe9, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xe9, 0x18, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xec, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x04, 0xe9, 0x50, 0xe9, 0x93, 0xe9, 0xc0, 0xe9, 0xef, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x17, 0xe9, 0xf4, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x8c, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xe9, 0xd7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x1f, 0xe9, 0x54, 0xe9, 0x98, 0xe9, 0xdb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfc, 0xe9, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x8f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xdf, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x43, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xe9, 0x8f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x3c, 0xe9, 0xb3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x1c, 0xe9, 0xf8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x08, 0xe9, 0xf7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xe9, 0x34, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xec, 0xe5, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x34, 0xe9, 0xd7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x9f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xbf, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x0b, 0xe9, 0x98, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd7, 0xed, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x3c, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x7c, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x74, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x83, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xe9, 0xdf, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfb, 0xe5, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x3b, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x1b, 0xe9, 0xfc, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfc, 0xe9, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x84, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x83, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x07, 0xe9, 0xfc, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xaf, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x10, 0xe9, 0x33, 0xe9, 0x2b, 0xe5, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xe9, 0xb7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfb, 0xe9, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x3b, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xdb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x30, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfb, 0xe9, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x40, 0xe9, 0xbb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf8, 0xe9, 0xb0, 0xe9, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x1b, 0xe9, 0xec, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x04, 0xe9, 0xf3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xb4, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf8, 0xe9, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xb7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x80, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfb, 0xe9, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x74, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xb7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x8c, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x38, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf8, 0xe9, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x7c, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x0c, 0xe9, 0xec, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xef, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x7f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf7, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x64, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xdb, 0xe9, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xbf, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x20, 0xe9, 0xfb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe3, 0xe9, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x88, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x57, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x40, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfc, 0xe9, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x2c, 0xe9, 0xfb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x84, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x3c, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x30, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x2c, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x8f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe3, 0xe5, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc0, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x04, 0xe9, 0xf0, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x0b, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x20, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xc7, 0xe5, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x0c, 0xe9, 0xe4, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xcb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xbf, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xf7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x13, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe8, 0xe9, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x54, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xbc, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xeb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x04, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf7, 0xe9, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf3, 0xe9, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x7f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x90, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xdc, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xf7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfc, 0xe9, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x0c, 0xe9, 0xdb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd0, 0xe9, 0x0b, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x24, 0xe9, 0xfc, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe3, 0xe5, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x8c, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xd7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x3f, 0xe9, 0x44, 0xe9, 0x44, 0xe9, 0x44, 0xe9, 0x44, 0xe9, 0x44, 0xe9, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x2c, 0xe9, 0xf7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xbb, 0xe5, 0x07, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x8b, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfc, 0xe9, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa0, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xe3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x67, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xa4, 0xe0, 0x03, 0x00, 0x00, 0xed, 0x03, 0xe9, 0x97, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfc, 0xe9, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xbb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xec, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x93, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x53, 0xe9, 0xc7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xc3, 0xe9, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xe9, 0xef, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xf8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x03, 0xe9, 0xa7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x1f, 0xe9, 0x34, 0xe9, 0x40, 0xe9, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x2c, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x14, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x5b, 0xe9, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x04, 0xe9, 0xb7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x9f, 0xe9, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x87, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x38, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x6f, 0xe9, 0xff, 0xe9, 0xe8, 0xe9, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x0c, 0xe9, 0xc8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xab, 0xe5, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x04, 0xe9, 0xe4, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x5c, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xe9, 0x8c, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe7, 0xe9, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x0c, 0xe9, 0xbb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xbc, 0xe9, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x6c, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x8f, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x08, 0xe9, 0xa4, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xef, 0xe9, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x07, 0xe9, 0xa7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe3, 0xe9, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x03, 0xe9, 0xdc, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xcc, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x27, 0xe9, 0xd0, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe4, 0xe9, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xe9, 0x8b, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfb, 0xe9, 0x80, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x1c, 0xe9, 0xb3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x0f, 0xe9, 0xfc, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x5f, 0xe9, 0xf3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd4, 0xe9, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x67, 0xe9, 0xf7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xbb, 0xe9, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x58, 0xe9, 0xe8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xeb, 0xe9, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x04, 0xe9, 0x40, 0xe9, 0x88, 0xe9, 0xd0, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf4, 0xe9, 0x9b, 0xe9, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x17, 0xe9, 0xa4, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xb8, 0xe9, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x2b, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf8, 0xe9, 0x90, 0xe5, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x13, 0xe9, 0xa0, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x1b, 0xe9, 0x60, 0xe9, 0xa8, 0xe9, 0xec, 0xe9, 0xff, 0xe9, 0xfb, 0xe9, 0xb8, 0xe9, 0x63, 0xe9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x03, 0xe9, 0x5f, 0xe9, 0xeb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfb, 0xe9, 0x80, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x0c, 0xe9, 0xa3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xdc, 0xe9, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x33, 0xe9, 0x73, 0xe9, 0xab, 0xe9, 0xe3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfc, 0xe9, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0x03, 0xe9, 0x34, 0xe9, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x3b, 0xe9, 0xcf, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xdb, 0xe9, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x53, 0xe9, 0xe3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xcb, 0xe9, 0x50, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x17, 0xe9, 0x38, 0xe9, 0x54, 0xe9, 0x73, 0xe9, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x40, 0xe9, 0xbb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xfc, 0xe9, 0x9b, 0xe9, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x0c, 0xe9, 0x8b, 0xe9, 0xfb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd4, 0xe9, 0x5c, 0xe5, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x03, 0xe9, 0x4c, 0xe9, 0xc7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xc7, 0xe9, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x2b, 0xe9, 0xbb, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xec, 0xe9, 0x97, 0xe9, 0x3b, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x2f, 0xe9, 0x8b, 0xe9, 0xe3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe7, 0xe9, 0x5f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x38, 0xe9, 0xb4, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xdc, 0xe9, 0x87, 0xe9, 0x43, 0xe9, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x04, 0xe9, 0x3b, 0xe9, 0x7c, 0xe9, 0xd3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xe3, 0xe9, 0x74, 0xe5, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x30, 0xe9, 0xab, 0xe9, 0xfc, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf8, 0xe9, 0xc0, 0xe9, 0x80, 0xe9, 0x4b, 0xe9, 0x24, 0xe9, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x03, 0xe9, 0x1f, 0xe9, 0x44, 0xe9, 0x77, 0xe9, 0xb7, 0xe9, 0xf3, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xd3, 0xe9, 0x5f, 0xe5, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x18, 0xe9, 0x73, 0xe9, 0xd0, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf8, 0xe9, 0xd8, 0xe9, 0xb3, 0xe9, 0x9b, 0xe9, 0x90, 0xe9, 0x84, 0xe9, 0x77, 0xe9, 0x68, 0xe9, 0x77, 0xe9, 0x83, 0xe9, 0x8f, 0xe9, 0x98, 0xe9, 0xaf, 0xe9, 0xd0, 0xe9, 0xf7, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf0, 0xe9, 0xa3, 0xe9, 0x47, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x2c, 0xe9, 0x8b, 0xe9, 0xd4, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xf4, 0xe9, 0xa8, 0xe9, 0x50, 0xe8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x17, 0xe9, 0x58, 0xe9, 0x98, 0xe9, 0xd8, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xec, 0xe9, 0xb3, 0xe9, 0x74, 0xe9, 0x3b, 0xe5, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x0b, 0xe9, 0x30, 0xe9, 0x57, 0xe9, 0x7f, 0xe9, 0xa7, 0xe9, 0xbc, 0xe9, 0xcc, 0xe9, 0xdb, 0xe9, 0xe7, 0xe9, 0xf0, 0xe9, 0xff, 0xe9, 0xef, 0xe9, 0xef, 0xe9, 0xdf, 0xe9, 0xdc, 0xe9, 0xcc, 0xe9, 0xaf, 0xe9, 0x8c, 0xe9, 0x6c, 0xe9, 0x4b, 0xe9, 0x27, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-    /*Pixel format: Blue: 5 bit, Green: 6 bit, Red: 5 bit, Alpha 8 bit*/
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0xa5, 0xe9, 0xb8, 0xa5, 0xe9, 0xe3, 0xa5, 0xe9, 0xf8, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf8, 0xa5, 0xe9, 0xef, 0xa5, 0xe9, 0xdf, 0xa5, 0xe9, 0xd7, 0xa5, 0xe9, 0xc3, 0xa5, 0xe9, 0x9c, 0xa6, 0xe9, 0x78, 0xa5, 0xe9, 0x54, 0xa5, 0xe9, 0x2b, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x37, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xec, 0xa5, 0xe9, 0xaf, 0xa5, 0xe9, 0x6f, 0xa5, 0xe9, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x8f, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xe0, 0xa5, 0xe9, 0x88, 0xa6, 0xe1, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x3b, 0xa5, 0xe9, 0xa3, 0xa5, 0xe9, 0xf7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xc7, 0xa5, 0xe9, 0x57, 0xab, 0xfa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xf1, 0x0f, 0xa5, 0xe9, 0x68, 0xa6, 0xe9, 0xcf, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xdc, 0xa5, 0xe9, 0x68, 0x04, 0xe2, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xe1, 0x08, 0xa5, 0xe9, 0x7c, 0xa5, 0xe9, 0xdb, 0xa5, 0xe9, 0xb3, 0xa6, 0xe9, 0x83, 0xa5, 0xe9, 0x54, 0x85, 0xe9, 0x24, 0x00, 0xf8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x43, 0xa5, 0xe9, 0xb4, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0xe4, 0xa6, 0xe9, 0x5b, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x53, 0xa5, 0xe9, 0xe0, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf3, 0xa5, 0xe9, 0xb8, 0xa5, 0xe9, 0x74, 0xc5, 0xe9, 0x2f, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x28, 0xa6, 0xe9, 0xa0, 0xa5, 0xe9, 0xfc, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xc3, 0xc5, 0xe9, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x37, 0xa5, 0xe9, 0xc8, 0x85, 0xe9, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x14, 0xa5, 0xe9, 0xa7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xe7, 0xa5, 0xe9, 0xa3, 0xa5, 0xe9, 0x58, 0x66, 0xe9, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x28, 0xa5, 0xe9, 0xa8, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xfb, 0xa5, 0xe9, 0x8b, 0xa6, 0xf9, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x2b, 0xa5, 0xe9, 0xec, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xdc, 0xa6, 0xe9, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x43, 0xa5, 0xe9, 0xe8, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf3, 0xa5, 0xe9, 0xa3, 0xc5, 0xe9, 0x47, 0xab, 0xfa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe1, 0x30, 0xa5, 0xe9, 0xbf, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xc8, 0xa6, 0xe9, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xe9, 0x1f, 0xa5, 0xe9, 0xe4, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xe0, 0x86, 0xe9, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0xa5, 0xe9, 0x7b, 0xa5, 0xe9, 0xfc, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xe7, 0xa5, 0xe9, 0x8c, 0xa5, 0xe9, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x57, 0xa5, 0xe9, 0xe3, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf0, 0xa5, 0xe9, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe1, 0x13, 0xa5, 0xe9, 0xd8, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe2, 0x08, 0xa6, 0xe9, 0xab, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xfc, 0xa5, 0xe9, 0xab, 0xa5, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xe9, 0x0b, 0xa5, 0xe9, 0x87, 0xa5, 0xe9, 0xfb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0xa6, 0xe9, 0xb0, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xaf, 0xab, 0xfa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xe1, 0x10, 0xa5, 0xe9, 0xc0, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xc0, 0xa5, 0xe9, 0x4c, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xe9, 0x2f, 0xa6, 0xe9, 0xcf, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x9c, 0x08, 0xfa, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x77, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0xbc, 0x24, 0xd9, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x8b, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xc7, 0xa5, 0xe9, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xd9, 0x07, 0xa5, 0xe9, 0x87, 0xa5, 0xe9, 0xfc, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xac, 0x24, 0xd9, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x38, 0xa5, 0xe9, 0xfb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xd4, 0x65, 0xe9, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x8f, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xb3, 0x85, 0xe9, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x3f, 0xa6, 0xe9, 0xe4, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xaf, 0xab, 0xfa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xe1, 0x10, 0xa5, 0xe9, 0xe0, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf4, 0xa5, 0xe9, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x8f, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf8, 0xa6, 0xe9, 0x8f, 0xe5, 0xe9, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xe9, 0x14, 0xa6, 0xe9, 0xb7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x9b, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x8f, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xe0, 0xa6, 0xe9, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x03, 0xa5, 0xe9, 0x83, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x34, 0xa5, 0xe9, 0xfc, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x8f, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x98, 0xe5, 0xe9, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x54, 0xa5, 0xe9, 0xf7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x03, 0xa5, 0xe9, 0xcb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0xe4, 0xc4, 0xf1, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x8f, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xe0, 0xc5, 0xe9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe9, 0x38, 0xa5, 0xe9, 0xe8, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xef, 0xa6, 0xe9, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x68, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x67, 0xa6, 0xe9, 0xbc, 0xa5, 0xe9, 0xcc, 0xa5, 0xe9, 0xdb, 0xa6, 0xe9, 0xe4, 0xa5, 0xe9, 0xf0, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xfc, 0xa6, 0xe9, 0x78, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x23, 0xa5, 0xe9, 0xdf, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xc8, 0x65, 0xd9, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xe9, 0x0c, 0xa5, 0xe9, 0xec, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xe9, 0x0b, 0xa5, 0xe9, 0x30, 0xa5, 0xe9, 0x58, 0xa5, 0xe9, 0x80, 0xa5, 0xe9, 0xa7, 0xa5, 0xe9, 0xcf, 0xa5, 0xe9, 0xfc, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xac, 0xe5, 0xe9, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe1, 0x1b, 0xa5, 0xe9, 0xd7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x74, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xfb, 0xa6, 0xe9, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xe9, 0x0c, 0xa6, 0xe9, 0x44, 0xa5, 0xe9, 0x88, 0xa5, 0xe9, 0xcc, 0xa5, 0xe9, 0xfc, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xd8, 0xa5, 0xe9, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xe1, 0x13, 0xa5, 0xe9, 0xc8, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xfb, 0xa5, 0xe9, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xd9, 0x07, 0xa6, 0xe9, 0xe4, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe9, 0x17, 0xa5, 0xe9, 0x64, 0xa5, 0xe9, 0xc3, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf0, 0xc5, 0xe9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xf1, 0x0f, 0xa5, 0xe9, 0xcc, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xc3, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x64, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xfb, 0xc6, 0xe9, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x1c, 0xa6, 0xe9, 0x77, 0xa5, 0xe9, 0xdb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf8, 0xa5, 0xe9, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xe9, 0x14, 0xa5, 0xe9, 0xd7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0xfa, 0x03, 0xa5, 0xe9, 0xdb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0xa5, 0xe9, 0x47, 0xa5, 0xe9, 0xc3, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xfb, 0xa6, 0xe9, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x1c, 0xa5, 0xe9, 0xdf, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xe4, 0x24, 0xd9, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x44, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x33, 0xa5, 0xe9, 0x68, 0xa5, 0xe9, 0x8b, 0xa5, 0xe9, 0x9c, 0xa5, 0xe9, 0xab, 0xa5, 0xe9, 0xa8, 0xa5, 0xe9, 0x98, 0xa5, 0xe9, 0x80, 0xa5, 0xe9, 0x5c, 0xa5, 0xe1, 0x30, 0xa6, 0xf9, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x3c, 0xa5, 0xe9, 0xb8, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x27, 0xa5, 0xe9, 0xef, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0xa0, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xe1, 0x13, 0xa5, 0xe9, 0x7f, 0xa5, 0xe9, 0xdb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf7, 0xa5, 0xe9, 0xc8, 0xa5, 0xe9, 0x97, 0xa5, 0xe9, 0x5f, 0xc6, 0xe9, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x34, 0xa5, 0xe9, 0xc0, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x3f, 0xa5, 0xe9, 0xf8, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xdc, 0x08, 0xfa, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xe1, 0x08, 0xa5, 0xe9, 0xf0, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xd9, 0x07, 0xa5, 0xe9, 0x7b, 0xa5, 0xe9, 0xef, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xfc, 0xa6, 0xe9, 0xc8, 0xa5, 0xe9, 0x7b, 0xa5, 0xe9, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x54, 0xa5, 0xe9, 0xe8, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x60, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x58, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf0, 0xc7, 0xe1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x27, 0xa6, 0xe9, 0xcf, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xd7, 0xa6, 0xe9, 0x77, 0xa5, 0xe1, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xe1, 0x10, 0xa5, 0xe9, 0x90, 0xa5, 0xe9, 0xfc, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xfc, 0xa5, 0xe9, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x90, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xb3, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xe9, 0x47, 0xa5, 0xe9, 0xf4, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf4, 0xa5, 0xe9, 0x9f, 0xc5, 0xe9, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x37, 0xa5, 0xe9, 0xdf, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf7, 0xa6, 0xe9, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xf9, 0x04, 0xa5, 0xe9, 0xc4, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xc5, 0xe9, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xa6, 0xf9, 0x04, 0xa5, 0xe9, 0xf3, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x48, 0xa5, 0xe9, 0xf7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xfc, 0xa5, 0xe9, 0xab, 0xa6, 0xe9, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf1, 0x0f, 0xa5, 0xe9, 0xa8, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xef, 0xa6, 0xe9, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x1c, 0xa5, 0xe9, 0xec, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xa6, 0xe9, 0x38, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf0, 0xab, 0xfa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe1, 0x30, 0xa5, 0xe9, 0xf7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xfc, 0xa5, 0xe9, 0xa3, 0xc6, 0xe1, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x67, 0xa5, 0xe9, 0xf8, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xd0, 0xa6, 0xe9, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x4f, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xa5, 0xe9, 0x78, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xe9, 0x0c, 0xa5, 0xe9, 0xdb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf3, 0xa5, 0xe9, 0x6f, 0xab, 0xfa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x34, 0xa5, 0xe9, 0xe7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x9c, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x2c, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xa5, 0xe9, 0xb8, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x8b, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xcc, 0xc6, 0xe9, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe9, 0x20, 0xa5, 0xe9, 0xd8, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf1, 0x0f, 0xa5, 0xe9, 0xe0, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x6c, 0x00, 0x00, 0x00,
-    0xab, 0xfa, 0x03, 0xa5, 0xe9, 0xf3, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x20, 0xa5, 0xe9, 0xf8, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xfb, 0xa5, 0xe9, 0x73, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe9, 0x17, 0xa5, 0xe9, 0xcc, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf8, 0xa6, 0xe9, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x43, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xac, 0x00, 0x00, 0x00,
-    0xa6, 0xe9, 0x23, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf0, 0x00, 0xf8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x8f, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xb3, 0xc5, 0xe1, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xe9, 0x0c, 0xa5, 0xe9, 0xb8, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xd4, 0x04, 0xe2, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xa0, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xec, 0x00, 0xf8, 0x03,
-    0xa6, 0xe9, 0x48, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xd9, 0x07, 0xa5, 0xe9, 0xef, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xe0, 0xa5, 0xe9, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xd9, 0x07, 0xa5, 0xe9, 0xbb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x18, 0xa5, 0xe9, 0xf0, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x28,
-    0xa5, 0xe9, 0x6f, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x44, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf3, 0xa5, 0xe9, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf1, 0x0f, 0xa6, 0xe9, 0xcf, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xfb, 0xa5, 0xe9, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x73, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x50,
-    0xa5, 0xe9, 0x93, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x88, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf8, 0xa6, 0xe9, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x18, 0xa5, 0xe9, 0xdc, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xd3, 0x65, 0xd9, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xf9, 0x04, 0xa5, 0xe9, 0xd4, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x77,
-    0xa5, 0xe9, 0xb8, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xb7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xef, 0xa5, 0xe9, 0xb7, 0xa5, 0xe9, 0xbf, 0xa5, 0xe9, 0xe7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xe9, 0x24, 0xa5, 0xe9, 0xe8, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x4f, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x9c,
-    0xa5, 0xe9, 0xcb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xc6, 0xe9, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xdb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0xc8, 0xc5, 0xe1, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf1, 0x0f, 0xa5, 0xe9, 0x37, 0xa5, 0xe9, 0x74, 0xa6, 0xe9, 0xb7, 0xa5, 0xe9, 0xf4, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x3f, 0xa5, 0xe9, 0xfc, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xef, 0xa5, 0xe9, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0xa5, 0xe9, 0xc8, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xc0,
-    0xa5, 0xe9, 0xd7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xc5, 0xe9, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xe8, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xc6, 0xe9, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xf9, 0x04, 0xa6, 0xe9, 0x48, 0xa6, 0xe9, 0xa7, 0xa5, 0xe9, 0xf7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xfc, 0xa5, 0xe9, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x7f, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x44, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xd3,
-    0xa5, 0xe9, 0xe3, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xf0, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xc6, 0xe9, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xf1, 0x0f, 0xa5, 0xe9, 0x68, 0xa5, 0xe9, 0xdf, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf8, 0xa5, 0xe9, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x03, 0xa5, 0xe9, 0xb8, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xfb, 0xa6, 0xe1, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xc0, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xdf,
-    0xa5, 0xe9, 0xef, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xe6, 0xe1, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xe0, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xf9, 0x04, 0xa6, 0xe9, 0x60, 0xa5, 0xe9, 0xdb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xec, 0xc6, 0xe9, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xe9, 0x17, 0xa5, 0xe9, 0xe7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x4c, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xec,
-    0xa5, 0xe9, 0xfb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xf9, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0xc8, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xec, 0xa5, 0xe9, 0x4f, 0xab, 0xfa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xf9, 0x04, 0xa5, 0xe9, 0x78, 0xa5, 0xe9, 0xf4, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xcc, 0xc7, 0xe1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x48, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0xa5, 0xe9, 0xd7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf3,
-    0xa5, 0xe9, 0xf8, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xf9, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x98, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xef, 0xa5, 0xe9, 0xbf, 0xa5, 0xe9, 0x93, 0xa6, 0xe9, 0x67, 0xa5, 0xe9, 0x37, 0x00, 0xf8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe9, 0x20, 0xa5, 0xe9, 0xb7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xac, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x64, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xbb,
-    0xa5, 0xe9, 0xeb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xe6, 0xe1, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x63, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xe7, 0xa5, 0xe9, 0x94, 0xa5, 0xe9, 0x43, 0xab, 0xfa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0xa5, 0xe9, 0x74, 0xa5, 0xe9, 0xfb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x1c, 0xa5, 0xe9, 0xf3, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xfb, 0xa5, 0xe9, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe2, 0x08, 0xa5, 0xe9, 0xec, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0xab,
-    0xa5, 0xe9, 0xdc, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xe9, 0x17, 0xa5, 0xe9, 0xfc, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xe7, 0xa6, 0xe9, 0x73, 0x66, 0xe9, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x3b, 0xa5, 0xe9, 0xe4, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xeb, 0x86, 0xe9, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x77, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x90, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x9b,
-    0xa6, 0xe9, 0xcf, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xc5, 0xe9, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xbb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xeb, 0xa6, 0xe9, 0x78, 0x65, 0xe9, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x1f, 0xa5, 0xe9, 0xd8, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xf9, 0x04, 0xa5, 0xe9, 0xd4, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf0, 0xc4, 0xf1, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x2c, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x8b,
-    0xa5, 0xe9, 0xc0, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x48, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xe0, 0xa6, 0xe9, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xe9, 0x14, 0xa5, 0xe9, 0xcb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x54, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xcb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xc3, 0xa5, 0xe9, 0x40,
-    0xa5, 0xe9, 0xab, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0xc8, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x94, 0x66, 0xe9, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf1, 0x0f, 0xa6, 0xe9, 0xcf, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xdb, 0xa6, 0xf9, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x03, 0xa6, 0xe9, 0xd4, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x34, 0xc6, 0xe9, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xa5, 0xe9, 0x84, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe1, 0x30, 0xa5, 0xe9, 0xfb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xdb, 0xa6, 0xe9, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x18, 0xa5, 0xe9, 0xdc, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x5f, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xa5, 0xe9, 0x5c, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x7b, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xef, 0xa5, 0xe9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xe9, 0x24, 0xa5, 0xe9, 0xec, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xe7, 0x66, 0xe9, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0xfa, 0x03, 0xa5, 0xe9, 0xdb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xa5, 0xe9, 0x34, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0xa6, 0xe9, 0xa7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf8, 0xa5, 0xe9, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x4c, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x67, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x65, 0xe9, 0x0c, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xef, 0x00, 0xf8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xd9, 0x07, 0xa5, 0xe9, 0xa8, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x8f, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xe7, 0x65, 0xd9, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xf1, 0x0f, 0xa5, 0xe9, 0xf4, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xa5, 0xe9, 0xdf, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xc5, 0xe9, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0xfa, 0x03, 0xa6, 0xe9, 0x8f, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf8, 0xc5, 0xe9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xd9, 0x07, 0xa5, 0xe9, 0xd0, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xa4, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xa5, 0xe9, 0x9f, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x4b, 0xa5, 0xe9, 0xe3, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf0, 0xa6, 0xe9, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x3b, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x48, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xa5, 0xe9, 0x5c, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x0b, 0xa5, 0xe9, 0x78, 0xa5, 0xe9, 0xe7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xd3, 0x24, 0xd9, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x9f, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xc6, 0xe9, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x03, 0xa5, 0xe9, 0xe4, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf7, 0xa6, 0xe9, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xa5, 0xe9, 0x18, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xec, 0x00, 0xf8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xf9, 0x04, 0xa5, 0xe9, 0x50, 0xa5, 0xe9, 0x93, 0xa5, 0xe9, 0xc0, 0xa5, 0xe9, 0xef, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe9, 0x17, 0xa5, 0xe9, 0xf4, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x8c, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xd7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xe9, 0x1f, 0xa5, 0xe9, 0x54, 0xa5, 0xe9, 0x98, 0xa5, 0xe9, 0xdb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xfc, 0xa6, 0xe9, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x8f, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xdf, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x43, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x8f, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x3c, 0xa5, 0xe9, 0xb3, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xd3, 0x00, 0xf8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe1, 0x1c, 0xa5, 0xe9, 0xf8, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xc6, 0xe9, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe2, 0x08, 0xa5, 0xe9, 0xf7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x34, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xec, 0x24, 0xd9, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x34, 0xa5, 0xe9, 0xd7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x9f, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xbf, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf0, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xd3, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x0b, 0xa5, 0xe9, 0x98, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xd7, 0xab, 0xfa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x3c, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x7c, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x74, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x83, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0xa5, 0xe9, 0xdf, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xfb, 0x66, 0xe9, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x3b, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xe9, 0x1b, 0xa5, 0xe9, 0xfc, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xfc, 0xa6, 0xe1, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x84, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x83, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xd9, 0x07, 0xa5, 0xe9, 0xfc, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xaf, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xe1, 0x10, 0xc6, 0xe9, 0x33, 0xa5, 0xe9, 0x2b, 0x66, 0xe9, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0xa5, 0xe9, 0xb7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xfb, 0xc5, 0xe9, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x3b, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xdb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x30, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xfb, 0xa5, 0xe9, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x40, 0xa5, 0xe9, 0xbb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf8, 0xa5, 0xe9, 0xb0, 0xa5, 0xe1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe1, 0x1b, 0xa5, 0xe9, 0xec, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xf9, 0x04, 0xa5, 0xe9, 0xf3, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xb4, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf8, 0xc5, 0xe9, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0xb7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x80, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xfb, 0xa6, 0xe9, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x74, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0xb7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x8c, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x38, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf8, 0xa6, 0xe9, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x7c, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xe9, 0x0c, 0xa5, 0xe9, 0xec, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xef, 0x00, 0xf8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x7f, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf7, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x64, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xdb, 0xa6, 0xe9, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xbf, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x20, 0xa5, 0xe9, 0xfb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xe3, 0xc7, 0xe1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x88, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x57, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xc6, 0xe1, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x40, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xfc, 0xa5, 0xe9, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x2c, 0xa5, 0xe9, 0xfb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x84, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x3c, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe1, 0x30, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x2c, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x8f, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xe3, 0x66, 0xe9, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xc0, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xf9, 0x04, 0xa5, 0xe9, 0xf0, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x0b, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe9, 0x20, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xc7, 0x65, 0xd9, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xe9, 0x0c, 0xa5, 0xe9, 0xe4, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xcb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xbf, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xf7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe1, 0x13, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xe8, 0x85, 0xe9, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x54, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xbc, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xa7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xeb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xf9, 0x04, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf7, 0xa6, 0xe9, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xa8, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf3, 0xa6, 0xe9, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x7f, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x90, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xdc, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xf7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xfc, 0xa5, 0xe9, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xe9, 0x0c, 0xa5, 0xe9, 0xdb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xd0, 0xa6, 0xe9, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xe9, 0x24, 0xa5, 0xe9, 0xfc, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xe3, 0x65, 0xd9, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x8c, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xd7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x3f, 0xa6, 0xe9, 0x44, 0xa6, 0xe9, 0x44, 0xa6, 0xe9, 0x44, 0xa6, 0xe9, 0x44, 0xa6, 0xe9, 0x44, 0xa6, 0xe9, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x2c, 0xa5, 0xe9, 0xf7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xbb, 0x65, 0xd9, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x8b, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xfc, 0xa6, 0xe9, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0xa0, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xe3, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x67, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xa4, 0x00, 0xf8, 0x03, 0x00, 0x00, 0x00, 0xab, 0xfa, 0x03, 0xa5, 0xe9, 0x97, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xfc, 0xa5, 0xe9, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xbb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xec, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x93, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x53, 0xa5, 0xe9, 0xc7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xc3, 0xa6, 0xe9, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0xa5, 0xe9, 0xef, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xf8, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x03, 0xa5, 0xe9, 0xa7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x1f, 0xa5, 0xe9, 0x34, 0xa5, 0xe9, 0x40, 0xa5, 0xe9, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x2c, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xe9, 0x14, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x5b, 0xa6, 0xe9, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xf9, 0x04, 0xa6, 0xe9, 0xb7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x9f, 0x08, 0xfa, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x87, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x38, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xc6, 0xe9, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x6f, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xe8, 0xc5, 0xe9, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xe9, 0x0c, 0xa6, 0xe9, 0xc8, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xab, 0x24, 0xd9, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xf9, 0x04, 0xa5, 0xe9, 0xe4, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x5c, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0xa5, 0xe9, 0x8c, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xe7, 0xa6, 0xe9, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0xe9, 0x0c, 0xa5, 0xe9, 0xbb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0xbc, 0xa5, 0xe1, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x6c, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x8f, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xe1, 0x08, 0xa5, 0xe9, 0xa4, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xef, 0xa6, 0xe9, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xd9, 0x07, 0xa6, 0xe9, 0xa7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xe3, 0xa5, 0xe9, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x03, 0xa5, 0xe9, 0xdc, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0xcc, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x27, 0xa5, 0xe9, 0xd0, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0xe4, 0xa5, 0xe9, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0xa5, 0xe9, 0x8b, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xfb, 0xa5, 0xe9, 0x80, 0x00, 0xf8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x1c, 0xa5, 0xe9, 0xb3, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xf1, 0x0f, 0xa5, 0xe9, 0xfc, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x5f, 0xa5, 0xe9, 0xf3, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa6, 0xe9, 0xd4, 0xa5, 0xe9, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x67, 0xa5, 0xe9, 0xf7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xbb, 0xa5, 0xe9, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x58, 0xa5, 0xe9, 0xe8, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xeb, 0x08, 0xfa, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xfa, 0x04, 0xc5, 0xe9, 0x40, 0xa6, 0xe9, 0x88, 0xa5, 0xe9, 0xd0, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf4, 0xa6, 0xe9, 0x9b, 0xa6, 0xe9, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe9, 0x17, 0xa5, 0xe9, 0xa4, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xb8, 0xa6, 0xf1, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xe9, 0x2b, 0xa5, 0xe9, 0xd3, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf8, 0xa5, 0xe9, 0x90, 0x66, 0xe9, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xe1, 0x13, 0xa6, 0xe9, 0xa0, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xe9, 0x1b, 0xa6, 0xe9, 0x60, 0xa5, 0xe9, 0xa8, 0xa5, 0xe9, 0xec, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xfb, 0xa5, 0xe9, 0xb8, 0xa5, 0xe9, 0x63, 0xe6, 0xe1, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x03, 0xa5, 0xe9, 0x5f, 0xa5, 0xe9, 0xeb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xfb, 0xa5, 0xe9, 0x80, 0x00, 0xf8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xe9, 0x0c, 0xa5, 0xe9, 0xa3, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xdc, 0xa5, 0xe9, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x33, 0xa6, 0xe9, 0x73, 0xa5, 0xe9, 0xab, 0xa5, 0xe9, 0xe3, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xfc, 0xa6, 0xe9, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0xfa, 0x03, 0xa5, 0xe9, 0x34, 0xa5, 0xe1, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x3b, 0xa6, 0xe9, 0xcf, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xdb, 0xa5, 0xe9, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x53, 0xa5, 0xe9, 0xe3, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xcb, 0xa5, 0xe9, 0x50, 0x00, 0xf8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xe9, 0x17, 0xc6, 0xe9, 0x38, 0xa6, 0xe9, 0x54, 0xa6, 0xe9, 0x73, 0xa6, 0xe9, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xe9, 0x40, 0xa5, 0xe9, 0xbb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xfc, 0xa5, 0xe9, 0x9b, 0xe5, 0xe9, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xe9, 0x0c, 0xa5, 0xe9, 0x8b, 0xa5, 0xe9, 0xfb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xd4, 0xa5, 0xe9, 0x5c, 0x65, 0xd9, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x03, 0xa5, 0xe9, 0x4c, 0xa5, 0xe9, 0xc7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xc7, 0xa5, 0xe9, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xe9, 0x2b, 0xa5, 0xe9, 0xbb, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xec, 0xa5, 0xe9, 0x97, 0xa5, 0xe9, 0x3b, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xe9, 0x2f, 0xa5, 0xe9, 0x8b, 0xa5, 0xe9, 0xe3, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xe7, 0xa5, 0xe9, 0x5f, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x38, 0xa5, 0xe9, 0xb4, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xdc, 0xa5, 0xe9, 0x87, 0xa5, 0xe9, 0x43, 0xc7, 0xe1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xfa, 0x04, 0xa5, 0xe9, 0x3b, 0xa5, 0xe9, 0x7c, 0xa5, 0xe9, 0xd3, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xe3, 0xa5, 0xe9, 0x74, 0x65, 0xe9, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe1, 0x30, 0xa5, 0xe9, 0xab, 0xa5, 0xe9, 0xfc, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf8, 0xa5, 0xe9, 0xc0, 0xa5, 0xe9, 0x80, 0xa6, 0xe9, 0x4b, 0x85, 0xe9, 0x24, 0x08, 0xfa, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x03, 0x85, 0xe9, 0x1f, 0xa5, 0xe9, 0x44, 0xa6, 0xe9, 0x77, 0xa6, 0xe9, 0xb7, 0xa5, 0xe9, 0xf3, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xd3, 0xa5, 0xe9, 0x5f, 0x65, 0xd9, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x18, 0xa5, 0xe9, 0x73, 0xa5, 0xe9, 0xd0, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf8, 0xa5, 0xe9, 0xd8, 0xa5, 0xe9, 0xb3, 0xa5, 0xe9, 0x9b, 0xa5, 0xe9, 0x90, 0xa5, 0xe9, 0x84, 0xa6, 0xe9, 0x77, 0xa5, 0xe9, 0x68, 0xa6, 0xe9, 0x77, 0xa5, 0xe9, 0x83, 0xa5, 0xe9, 0x8f, 0xa5, 0xe9, 0x98, 0xa5, 0xe9, 0xaf, 0xa5, 0xe9, 0xd0, 0xa5, 0xe9, 0xf7, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf0, 0xa5, 0xe9, 0xa3, 0xc5, 0xe9, 0x47, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xe9, 0x2c, 0xa5, 0xe9, 0x8b, 0xa6, 0xe9, 0xd4, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xf4, 0xa5, 0xe9, 0xa8, 0xa5, 0xe9, 0x50, 0x04, 0xe2, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xe9, 0x17, 0xa5, 0xe9, 0x58, 0xa5, 0xe9, 0x98, 0xa5, 0xe9, 0xd8, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xec, 0xa5, 0xe9, 0xb3, 0xa5, 0xe9, 0x74, 0xa5, 0xe9, 0x3b, 0x65, 0xd9, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xe9, 0x0b, 0xa5, 0xe9, 0x30, 0xa5, 0xe9, 0x57, 0xa6, 0xe9, 0x7f, 0xa6, 0xe9, 0xa7, 0xa6, 0xe9, 0xbc, 0xa5, 0xe9, 0xcc, 0xa5, 0xe9, 0xdb, 0xa5, 0xe9, 0xe7, 0xa5, 0xe9, 0xf0, 0xa5, 0xe9, 0xff, 0xa5, 0xe9, 0xef, 0xa5, 0xe9, 0xef, 0xa5, 0xe9, 0xdf, 0xa5, 0xe9, 0xdc, 0xa5, 0xe9, 0xcc, 0xa5, 0xe9, 0xaf, 0xa5, 0xe9, 0x8c, 0xa6, 0xe9, 0x6c, 0xa6, 0xe9, 0x4b, 0xa6, 0xe1, 0x27, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-    /*Pixel format:  Blue: 5 bit Green: 6 bit, Red: 5 bit, Alpha 8 bit  BUT the 2  color bytes are swapped*/
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xe9, 0xa5, 0xb8, 0xe9, 0xa5, 0xe3, 0xe9, 0xa5, 0xf8, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf8, 0xe9, 0xa5, 0xef, 0xe9, 0xa5, 0xdf, 0xe9, 0xa5, 0xd7, 0xe9, 0xa5, 0xc3, 0xe9, 0xa5, 0x9c, 0xe9, 0xa6, 0x78, 0xe9, 0xa5, 0x54, 0xe9, 0xa5, 0x2b, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x37, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xec, 0xe9, 0xa5, 0xaf, 0xe9, 0xa5, 0x6f, 0xe9, 0xa5, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x8f, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xe0, 0xe9, 0xa5, 0x88, 0xe1, 0xa6, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x3b, 0xe9, 0xa5, 0xa3, 0xe9, 0xa5, 0xf7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xc7, 0xe9, 0xa5, 0x57, 0xfa, 0xab, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xa6, 0x0f, 0xe9, 0xa5, 0x68, 0xe9, 0xa6, 0xcf, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xdc, 0xe9, 0xa5, 0x68, 0xe2, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xc7, 0x08, 0xe9, 0xa5, 0x7c, 0xe9, 0xa5, 0xdb, 0xe9, 0xa5, 0xb3, 0xe9, 0xa6, 0x83, 0xe9, 0xa5, 0x54, 0xe9, 0x85, 0x24, 0xf8, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x43, 0xe9, 0xa5, 0xb4, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0xe4, 0xe9, 0xa6, 0x5b, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x53, 0xe9, 0xa5, 0xe0, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf3, 0xe9, 0xa5, 0xb8, 0xe9, 0xa5, 0x74, 0xe9, 0xc5, 0x2f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x28, 0xe9, 0xa6, 0xa0, 0xe9, 0xa5, 0xfc, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xc3, 0xe9, 0xc5, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x37, 0xe9, 0xa5, 0xc8, 0xe9, 0x85, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x14, 0xe9, 0xa5, 0xa7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xe7, 0xe9, 0xa5, 0xa3, 0xe9, 0xa5, 0x58, 0xe9, 0x66, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x28, 0xe9, 0xa5, 0xa8, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xfb, 0xe9, 0xa5, 0x8b, 0xf9, 0xa6, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x2b, 0xe9, 0xa5, 0xec, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xdc, 0xe9, 0xa6, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x43, 0xe9, 0xa5, 0xe8, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf3, 0xe9, 0xa5, 0xa3, 0xe9, 0xc5, 0x47, 0xfa, 0xab, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa5, 0x30, 0xe9, 0xa5, 0xbf, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xc8, 0xe9, 0xa6, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x85, 0x1f, 0xe9, 0xa5, 0xe4, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xe0, 0xe9, 0x86, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xe9, 0xa5, 0x7b, 0xe9, 0xa5, 0xfc, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xe7, 0xe9, 0xa5, 0x8c, 0xe9, 0xa5, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x57, 0xe9, 0xa5, 0xe3, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf0, 0xe9, 0xa5, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa5, 0x13, 0xe9, 0xa5, 0xd8, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x04, 0x08, 0xe9, 0xa6, 0xab, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xfc, 0xe9, 0xa5, 0xab, 0xe9, 0xa5, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x66, 0x0b, 0xe9, 0xa5, 0x87, 0xe9, 0xa5, 0xfb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xe9, 0xa6, 0xb0, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xaf, 0xfa, 0xab, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x86, 0x10, 0xe9, 0xa5, 0xc0, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xc0, 0xe9, 0xa5, 0x4c, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc5, 0x2f, 0xe9, 0xa6, 0xcf, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x9c, 0xfa, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x77, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0xbc, 0xd9, 0x24, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x8b, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xc7, 0xe9, 0xa5, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x24, 0x07, 0xe9, 0xa5, 0x87, 0xe9, 0xa5, 0xfc, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xac, 0xd9, 0x24, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x38, 0xe9, 0xa5, 0xfb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xd4, 0xe9, 0x65, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x8f, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xb3, 0xe9, 0x85, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x3f, 0xe9, 0xa6, 0xe4, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xaf, 0xfa, 0xab, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xe6, 0x10, 0xe9, 0xa5, 0xe0, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf4, 0xe9, 0xa5, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x8f, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf8, 0xe9, 0xa6, 0x8f, 0xe9, 0xe5, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x86, 0x14, 0xe9, 0xa6, 0xb7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x9b, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x8f, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xe0, 0xe9, 0xa6, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x03, 0xe9, 0xa5, 0x83, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x34, 0xe9, 0xa5, 0xfc, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x8f, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x98, 0xe9, 0xe5, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x54, 0xe9, 0xa5, 0xf7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x03, 0xe9, 0xa5, 0xcb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0xe4, 0xf1, 0xc4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x8f, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xe0, 0xe9, 0xc5, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc6, 0x38, 0xe9, 0xa5, 0xe8, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xef, 0xe9, 0xa6, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x68, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x67, 0xe9, 0xa6, 0xbc, 0xe9, 0xa5, 0xcc, 0xe9, 0xa5, 0xdb, 0xe9, 0xa6, 0xe4, 0xe9, 0xa5, 0xf0, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xfc, 0xe9, 0xa6, 0x78, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x23, 0xe9, 0xa5, 0xdf, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xc8, 0xd9, 0x65, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xe5, 0x0c, 0xe9, 0xa5, 0xec, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x66, 0x0b, 0xe9, 0xa5, 0x30, 0xe9, 0xa5, 0x58, 0xe9, 0xa5, 0x80, 0xe9, 0xa5, 0xa7, 0xe9, 0xa5, 0xcf, 0xe9, 0xa5, 0xfc, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xac, 0xe9, 0xe5, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xc6, 0x1b, 0xe9, 0xa5, 0xd7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x74, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xfb, 0xe9, 0xa6, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x65, 0x0c, 0xe9, 0xa6, 0x44, 0xe9, 0xa5, 0x88, 0xe9, 0xa5, 0xcc, 0xe9, 0xa5, 0xfc, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xd8, 0xe9, 0xa5, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xc5, 0x13, 0xe9, 0xa5, 0xc8, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xfb, 0xe9, 0xa5, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x24, 0x07, 0xe9, 0xa6, 0xe4, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc6, 0x17, 0xe9, 0xa5, 0x64, 0xe9, 0xa5, 0xc3, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf0, 0xe9, 0xc5, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xa6, 0x0f, 0xe9, 0xa5, 0xcc, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xc3, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x64, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xfb, 0xe9, 0xc6, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x1c, 0xe9, 0xa6, 0x77, 0xe9, 0xa5, 0xdb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf8, 0xe9, 0xa5, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x86, 0x14, 0xe9, 0xa5, 0xd7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xab, 0x03, 0xe9, 0xa5, 0xdb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xe9, 0xa5, 0x47, 0xe9, 0xa5, 0xc3, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xfb, 0xe9, 0xa6, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x1c, 0xe9, 0xa5, 0xdf, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xe4, 0xd9, 0x24, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x44, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x33, 0xe9, 0xa5, 0x68, 0xe9, 0xa5, 0x8b, 0xe9, 0xa5, 0x9c, 0xe9, 0xa5, 0xab, 0xe9, 0xa5, 0xa8, 0xe9, 0xa5, 0x98, 0xe9, 0xa5, 0x80, 0xe9, 0xa5, 0x5c, 0xe1, 0xa5, 0x30, 0xf9, 0xa6, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x3c, 0xe9, 0xa5, 0xb8, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x27, 0xe9, 0xa5, 0xef, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0xa0, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xc5, 0x13, 0xe9, 0xa5, 0x7f, 0xe9, 0xa5, 0xdb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf7, 0xe9, 0xa5, 0xc8, 0xe9, 0xa5, 0x97, 0xe9, 0xa5, 0x5f, 0xe9, 0xc6, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x34, 0xe9, 0xa5, 0xc0, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x3f, 0xe9, 0xa5, 0xf8, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xdc, 0xfa, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xc7, 0x08, 0xe9, 0xa5, 0xf0, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x24, 0x07, 0xe9, 0xa5, 0x7b, 0xe9, 0xa5, 0xef, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xfc, 0xe9, 0xa6, 0xc8, 0xe9, 0xa5, 0x7b, 0xe9, 0xa5, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x54, 0xe9, 0xa5, 0xe8, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x60, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x58, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf0, 0xe1, 0xc7, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x27, 0xe9, 0xa6, 0xcf, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xd7, 0xe9, 0xa6, 0x77, 0xe1, 0xa5, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x86, 0x10, 0xe9, 0xa5, 0x90, 0xe9, 0xa5, 0xfc, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xfc, 0xe9, 0xa5, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x90, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xb3, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc5, 0x47, 0xe9, 0xa5, 0xf4, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf4, 0xe9, 0xa5, 0x9f, 0xe9, 0xc5, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x37, 0xe9, 0xa5, 0xdf, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf7, 0xe9, 0xa6, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xa6, 0x04, 0xe9, 0xa5, 0xc4, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xc5, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xf9, 0xa6, 0x04, 0xe9, 0xa5, 0xf3, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x48, 0xe9, 0xa5, 0xf7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xfc, 0xe9, 0xa5, 0xab, 0xe9, 0xa6, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xc4, 0x0f, 0xe9, 0xa5, 0xa8, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xef, 0xe9, 0xa6, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x1c, 0xe9, 0xa5, 0xec, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xe9, 0xa6, 0x38, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf0, 0xfa, 0xab, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa5, 0x30, 0xe9, 0xa5, 0xf7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xfc, 0xe9, 0xa5, 0xa3, 0xe1, 0xc6, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x67, 0xe9, 0xa5, 0xf8, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xd0, 0xe9, 0xa6, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x4f, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xe9, 0xa5, 0x78, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xe5, 0x0c, 0xe9, 0xa5, 0xdb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf3, 0xe9, 0xa5, 0x6f, 0xfa, 0xab, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x34, 0xe9, 0xa5, 0xe7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x9c, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x2c, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xe9, 0xa5, 0xb8, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x8b, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xcc, 0xe9, 0xc6, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc6, 0x20, 0xe9, 0xa5, 0xd8, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xc4, 0x0f, 0xe9, 0xa5, 0xe0, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x6c, 0x00, 0x00, 0x00,
-    0xfa, 0xab, 0x03, 0xe9, 0xa5, 0xf3, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x20, 0xe9, 0xa5, 0xf8, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xfb, 0xe9, 0xa5, 0x73, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc6, 0x17, 0xe9, 0xa5, 0xcc, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf8, 0xe9, 0xa6, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x43, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xac, 0x00, 0x00, 0x00,
-    0xe9, 0xa6, 0x23, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf0, 0xf8, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x8f, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xb3, 0xe1, 0xc5, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x65, 0x0c, 0xe9, 0xa5, 0xb8, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xd4, 0xe2, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xa0, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xec, 0xf8, 0x00, 0x03,
-    0xe9, 0xa6, 0x48, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x65, 0x07, 0xe9, 0xa5, 0xef, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xe0, 0xe9, 0xa5, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x65, 0x07, 0xe9, 0xa5, 0xbb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x18, 0xe9, 0xa5, 0xf0, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x28,
-    0xe9, 0xa5, 0x6f, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x44, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf3, 0xe9, 0xa5, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xc4, 0x0f, 0xe9, 0xa6, 0xcf, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xfb, 0xe9, 0xa5, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x73, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x50,
-    0xe9, 0xa5, 0x93, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x88, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf8, 0xe9, 0xa6, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x18, 0xe9, 0xa5, 0xdc, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xd3, 0xd9, 0x65, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xa6, 0x04, 0xe9, 0xa5, 0xd4, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x77,
-    0xe9, 0xa5, 0xb8, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xb7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xef, 0xe9, 0xa5, 0xb7, 0xe9, 0xa5, 0xbf, 0xe9, 0xa5, 0xe7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x85, 0x24, 0xe9, 0xa5, 0xe8, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x4f, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x9c,
-    0xe9, 0xa5, 0xcb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xc6, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xdb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0xc8, 0xe1, 0xc5, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xc4, 0x0f, 0xe9, 0xa5, 0x37, 0xe9, 0xa5, 0x74, 0xe9, 0xa6, 0xb7, 0xe9, 0xa5, 0xf4, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x3f, 0xe9, 0xa5, 0xfc, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xef, 0xe9, 0xa5, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xe9, 0xa5, 0xc8, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xc0,
-    0xe9, 0xa5, 0xd7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xc5, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xe8, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xc6, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xa6, 0x04, 0xe9, 0xa6, 0x48, 0xe9, 0xa6, 0xa7, 0xe9, 0xa5, 0xf7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xfc, 0xe9, 0xa5, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x7f, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x44, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xd3,
-    0xe9, 0xa5, 0xe3, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xf0, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xc6, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xa6, 0x0f, 0xe9, 0xa5, 0x68, 0xe9, 0xa5, 0xdf, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf8, 0xe9, 0xa5, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x03, 0xe9, 0xa5, 0xb8, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xfb, 0xe1, 0xa6, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xc0, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xdf,
-    0xe9, 0xa5, 0xef, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe1, 0xe6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xe0, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xa6, 0x04, 0xe9, 0xa6, 0x60, 0xe9, 0xa5, 0xdb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xec, 0xe9, 0xc6, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc5, 0x17, 0xe9, 0xa5, 0xe7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x4c, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xec,
-    0xe9, 0xa5, 0xfb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xf9, 0xa6, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0xc8, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xec, 0xe9, 0xa5, 0x4f, 0xfa, 0xab, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xa6, 0x04, 0xe9, 0xa5, 0x78, 0xe9, 0xa5, 0xf4, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xcc, 0xe1, 0xc7, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x48, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xe9, 0xa5, 0xd7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf3,
-    0xe9, 0xa5, 0xf8, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xf9, 0xa6, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x98, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xef, 0xe9, 0xa5, 0xbf, 0xe9, 0xa5, 0x93, 0xe9, 0xa6, 0x67, 0xe9, 0xa5, 0x37, 0xf8, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc6, 0x20, 0xe9, 0xa5, 0xb7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xac, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x64, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xbb,
-    0xe9, 0xa5, 0xeb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe1, 0xe6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x63, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xe7, 0xe9, 0xa5, 0x94, 0xe9, 0xa5, 0x43, 0xfa, 0xab, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xe9, 0xa5, 0x74, 0xe9, 0xa5, 0xfb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x1c, 0xe9, 0xa5, 0xf3, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xfb, 0xe9, 0xa5, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x04, 0x08, 0xe9, 0xa5, 0xec, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0xab,
-    0xe9, 0xa5, 0xdc, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc5, 0x17, 0xe9, 0xa5, 0xfc, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xe7, 0xe9, 0xa6, 0x73, 0xe9, 0x66, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x3b, 0xe9, 0xa5, 0xe4, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xeb, 0xe9, 0x86, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x77, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x90, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x9b,
-    0xe9, 0xa6, 0xcf, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xc5, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xbb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xeb, 0xe9, 0xa6, 0x78, 0xe9, 0x65, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x1f, 0xe9, 0xa5, 0xd8, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xa6, 0x04, 0xe9, 0xa5, 0xd4, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf0, 0xf1, 0xc4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x2c, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x8b,
-    0xe9, 0xa5, 0xc0, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x48, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xe0, 0xe9, 0xa6, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x86, 0x14, 0xe9, 0xa5, 0xcb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x54, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xcb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xc3, 0xe9, 0xa5, 0x40,
-    0xe9, 0xa5, 0xab, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0xc8, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x94, 0xe9, 0x66, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xc4, 0x0f, 0xe9, 0xa6, 0xcf, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xdb, 0xf9, 0xa6, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x03, 0xe9, 0xa6, 0xd4, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x34, 0xe9, 0xc6, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xe9, 0xa5, 0x84, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa5, 0x30, 0xe9, 0xa5, 0xfb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xdb, 0xe9, 0xa6, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x18, 0xe9, 0xa5, 0xdc, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x5f, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xe9, 0xa5, 0x5c, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x7b, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xef, 0xe9, 0xa5, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc5, 0x24, 0xe9, 0xa5, 0xec, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xe7, 0xe9, 0x66, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xab, 0x03, 0xe9, 0xa5, 0xdb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xe9, 0xa5, 0x34, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xe9, 0xa6, 0xa7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf8, 0xe9, 0xa5, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x4c, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x67, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xe9, 0x65, 0x0c, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xef, 0xf8, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x65, 0x07, 0xe9, 0xa5, 0xa8, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x8f, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xe7, 0xd9, 0x65, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xc4, 0x0f, 0xe9, 0xa5, 0xf4, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xe9, 0xa5, 0xdf, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xc5, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xab, 0x03, 0xe9, 0xa6, 0x8f, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf8, 0xe9, 0xc5, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x65, 0x07, 0xe9, 0xa5, 0xd0, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xa4, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xe9, 0xa5, 0x9f, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x4b, 0xe9, 0xa5, 0xe3, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf0, 0xe9, 0xa6, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x3b, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x48, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xe9, 0xa5, 0x5c, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x0b, 0xe9, 0xa5, 0x78, 0xe9, 0xa5, 0xe7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xd3, 0xd9, 0x24, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x9f, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xc6, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x03, 0xe9, 0xa5, 0xe4, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf7, 0xe9, 0xa6, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0xe9, 0xa5, 0x18, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xec, 0xf8, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xa6, 0x04, 0xe9, 0xa5, 0x50, 0xe9, 0xa5, 0x93, 0xe9, 0xa5, 0xc0, 0xe9, 0xa5, 0xef, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc6, 0x17, 0xe9, 0xa5, 0xf4, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x8c, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xd7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x85, 0x1f, 0xe9, 0xa5, 0x54, 0xe9, 0xa5, 0x98, 0xe9, 0xa5, 0xdb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xfc, 0xe9, 0xa6, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x8f, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xdf, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x43, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x8f, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x3c, 0xe9, 0xa5, 0xb3, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xd3, 0xf8, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xc6, 0x1c, 0xe9, 0xa5, 0xf8, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xc6, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x04, 0x08, 0xe9, 0xa5, 0xf7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x34, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xec, 0xd9, 0x24, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x34, 0xe9, 0xa5, 0xd7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x9f, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xbf, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf0, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xd3, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x0b, 0xe9, 0xa5, 0x98, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xd7, 0xfa, 0xab, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x3c, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x7c, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x74, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x83, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xe9, 0xa5, 0xdf, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xfb, 0xe9, 0x66, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x3b, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x85, 0x1b, 0xe9, 0xa5, 0xfc, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xfc, 0xe1, 0xa6, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x84, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x83, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x24, 0x07, 0xe9, 0xa5, 0xfc, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xaf, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xe6, 0x10, 0xe9, 0xc6, 0x33, 0xe9, 0xa5, 0x2b, 0xe9, 0x66, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xe9, 0xa5, 0xb7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xfb, 0xe9, 0xc5, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x3b, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xdb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x30, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xfb, 0xe9, 0xa5, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x40, 0xe9, 0xa5, 0xbb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf8, 0xe9, 0xa5, 0xb0, 0xe1, 0xa5, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xc6, 0x1b, 0xe9, 0xa5, 0xec, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xa6, 0x04, 0xe9, 0xa5, 0xf3, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xb4, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf8, 0xe9, 0xc5, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0xb7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x80, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xfb, 0xe9, 0xa6, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x74, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0xb7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x8c, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x38, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf8, 0xe9, 0xa6, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x7c, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x65, 0x0c, 0xe9, 0xa5, 0xec, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xef, 0xf8, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x7f, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf7, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x64, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xdb, 0xe9, 0xa6, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xbf, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x20, 0xe9, 0xa5, 0xfb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xe3, 0xe1, 0xc7, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x88, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x57, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe1, 0xc6, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x40, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xfc, 0xe9, 0xa5, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x2c, 0xe9, 0xa5, 0xfb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x84, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x3c, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa5, 0x30, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x2c, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x8f, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xe3, 0xe9, 0x66, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xc0, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xa6, 0x04, 0xe9, 0xa5, 0xf0, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x0b, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc6, 0x20, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xc7, 0xd9, 0x65, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xe5, 0x0c, 0xe9, 0xa5, 0xe4, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xcb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xbf, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xf7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa5, 0x13, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xe8, 0xe9, 0x85, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x54, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xbc, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xa7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xeb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xa6, 0x04, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf7, 0xe9, 0xa6, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xa8, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf3, 0xe9, 0xa6, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x7f, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x90, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xdc, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xf7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xfc, 0xe9, 0xa5, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xe5, 0x0c, 0xe9, 0xa5, 0xdb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xd0, 0xe9, 0xa6, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x85, 0x24, 0xe9, 0xa5, 0xfc, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xe3, 0xd9, 0x65, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x8c, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xd7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x3f, 0xe9, 0xa6, 0x44, 0xe9, 0xa6, 0x44, 0xe9, 0xa6, 0x44, 0xe9, 0xa6, 0x44, 0xe9, 0xa6, 0x44, 0xe9, 0xa6, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x2c, 0xe9, 0xa5, 0xf7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xbb, 0xd9, 0x65, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x8b, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xfc, 0xe9, 0xa6, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0xa0, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xe3, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x67, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xa4, 0xf8, 0x00, 0x03, 0x00, 0x00, 0x00, 0xfa, 0xab, 0x03, 0xe9, 0xa5, 0x97, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xfc, 0xe9, 0xa5, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xbb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xec, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x93, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x53, 0xe9, 0xa5, 0xc7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xc3, 0xe9, 0xa6, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xe9, 0xa5, 0xef, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xf8, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x03, 0xe9, 0xa5, 0xa7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x1f, 0xe9, 0xa5, 0x34, 0xe9, 0xa5, 0x40, 0xe9, 0xa5, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x2c, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x86, 0x14, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x5b, 0xe9, 0xa6, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xa6, 0x04, 0xe9, 0xa6, 0xb7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x9f, 0xfa, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x87, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x38, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xc6, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x6f, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xe8, 0xe9, 0xc5, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x65, 0x0c, 0xe9, 0xa6, 0xc8, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xab, 0xd9, 0x24, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xa6, 0x04, 0xe9, 0xa5, 0xe4, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x5c, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xe9, 0xa5, 0x8c, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xe7, 0xe9, 0xa6, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xe5, 0x0c, 0xe9, 0xa5, 0xbb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0xbc, 0xe1, 0xa5, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x6c, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x8f, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xc7, 0x08, 0xe9, 0xa5, 0xa4, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xef, 0xe9, 0xa6, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x65, 0x07, 0xe9, 0xa6, 0xa7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xe3, 0xe9, 0xa5, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x03, 0xe9, 0xa5, 0xdc, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0xcc, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x27, 0xe9, 0xa5, 0xd0, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0xe4, 0xe9, 0xa5, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xe9, 0xa5, 0x8b, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xfb, 0xe9, 0xa5, 0x80, 0xf8, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x1c, 0xe9, 0xa5, 0xb3, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xa6, 0x0f, 0xe9, 0xa5, 0xfc, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x5f, 0xe9, 0xa5, 0xf3, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa6, 0xd4, 0xe9, 0xa5, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x67, 0xe9, 0xa5, 0xf7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xbb, 0xe9, 0xa5, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x58, 0xe9, 0xa5, 0xe8, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xeb, 0xfa, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x08, 0x04, 0xe9, 0xc5, 0x40, 0xe9, 0xa6, 0x88, 0xe9, 0xa5, 0xd0, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf4, 0xe9, 0xa6, 0x9b, 0xe9, 0xa6, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc6, 0x17, 0xe9, 0xa5, 0xa4, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xb8, 0xf1, 0xa6, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc5, 0x2b, 0xe9, 0xa5, 0xd3, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf8, 0xe9, 0xa5, 0x90, 0xe9, 0x66, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xc5, 0x13, 0xe9, 0xa6, 0xa0, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x85, 0x1b, 0xe9, 0xa6, 0x60, 0xe9, 0xa5, 0xa8, 0xe9, 0xa5, 0xec, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xfb, 0xe9, 0xa5, 0xb8, 0xe9, 0xa5, 0x63, 0xe1, 0xe6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x03, 0xe9, 0xa5, 0x5f, 0xe9, 0xa5, 0xeb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xfb, 0xe9, 0xa5, 0x80, 0xf8, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x65, 0x0c, 0xe9, 0xa5, 0xa3, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xdc, 0xe9, 0xa5, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x33, 0xe9, 0xa6, 0x73, 0xe9, 0xa5, 0xab, 0xe9, 0xa5, 0xe3, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xfc, 0xe9, 0xa6, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xab, 0x03, 0xe9, 0xa5, 0x34, 0xe1, 0xa5, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x3b, 0xe9, 0xa6, 0xcf, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xdb, 0xe9, 0xa5, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x53, 0xe9, 0xa5, 0xe3, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xcb, 0xe9, 0xa5, 0x50, 0xf8, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc5, 0x17, 0xe9, 0xc6, 0x38, 0xe9, 0xa6, 0x54, 0xe9, 0xa6, 0x73, 0xe9, 0xa6, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc5, 0x40, 0xe9, 0xa5, 0xbb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xfc, 0xe9, 0xa5, 0x9b, 0xe9, 0xe5, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x65, 0x0c, 0xe9, 0xa5, 0x8b, 0xe9, 0xa5, 0xfb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xd4, 0xe9, 0xa5, 0x5c, 0xd9, 0x65, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x03, 0xe9, 0xa5, 0x4c, 0xe9, 0xa5, 0xc7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xc7, 0xe9, 0xa5, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc5, 0x2b, 0xe9, 0xa5, 0xbb, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xec, 0xe9, 0xa5, 0x97, 0xe9, 0xa5, 0x3b, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc5, 0x2f, 0xe9, 0xa5, 0x8b, 0xe9, 0xa5, 0xe3, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xe7, 0xe9, 0xa5, 0x5f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x38, 0xe9, 0xa5, 0xb4, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xdc, 0xe9, 0xa5, 0x87, 0xe9, 0xa5, 0x43, 0xe1, 0xc7, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x08, 0x04, 0xe9, 0xa5, 0x3b, 0xe9, 0xa5, 0x7c, 0xe9, 0xa5, 0xd3, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xe3, 0xe9, 0xa5, 0x74, 0xe9, 0x65, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xa5, 0x30, 0xe9, 0xa5, 0xab, 0xe9, 0xa5, 0xfc, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf8, 0xe9, 0xa5, 0xc0, 0xe9, 0xa5, 0x80, 0xe9, 0xa6, 0x4b, 0xe9, 0x85, 0x24, 0xfa, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x03, 0xe9, 0x85, 0x1f, 0xe9, 0xa5, 0x44, 0xe9, 0xa6, 0x77, 0xe9, 0xa6, 0xb7, 0xe9, 0xa5, 0xf3, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xd3, 0xe9, 0xa5, 0x5f, 0xd9, 0x65, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa5, 0x18, 0xe9, 0xa5, 0x73, 0xe9, 0xa5, 0xd0, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf8, 0xe9, 0xa5, 0xd8, 0xe9, 0xa5, 0xb3, 0xe9, 0xa5, 0x9b, 0xe9, 0xa5, 0x90, 0xe9, 0xa5, 0x84, 0xe9, 0xa6, 0x77, 0xe9, 0xa5, 0x68, 0xe9, 0xa6, 0x77, 0xe9, 0xa5, 0x83, 0xe9, 0xa5, 0x8f, 0xe9, 0xa5, 0x98, 0xe9, 0xa5, 0xaf, 0xe9, 0xa5, 0xd0, 0xe9, 0xa5, 0xf7, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf0, 0xe9, 0xa5, 0xa3, 0xe9, 0xc5, 0x47, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xa6, 0x2c, 0xe9, 0xa5, 0x8b, 0xe9, 0xa6, 0xd4, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xf4, 0xe9, 0xa5, 0xa8, 0xe9, 0xa5, 0x50, 0xe2, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xc5, 0x17, 0xe9, 0xa5, 0x58, 0xe9, 0xa5, 0x98, 0xe9, 0xa5, 0xd8, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xec, 0xe9, 0xa5, 0xb3, 0xe9, 0xa5, 0x74, 0xe9, 0xa5, 0x3b, 0xd9, 0x65, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x66, 0x0b, 0xe9, 0xa5, 0x30, 0xe9, 0xa5, 0x57, 0xe9, 0xa6, 0x7f, 0xe9, 0xa6, 0xa7, 0xe9, 0xa6, 0xbc, 0xe9, 0xa5, 0xcc, 0xe9, 0xa5, 0xdb, 0xe9, 0xa5, 0xe7, 0xe9, 0xa5, 0xf0, 0xe9, 0xa5, 0xff, 0xe9, 0xa5, 0xef, 0xe9, 0xa5, 0xef, 0xe9, 0xa5, 0xdf, 0xe9, 0xa5, 0xdc, 0xe9, 0xa5, 0xcc, 0xe9, 0xa5, 0xaf, 0xe9, 0xa5, 0x8c, 0xe9, 0xa6, 0x6c, 0xe9, 0xa6, 0x4b, 0xe1, 0xa6, 0x27, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 32
-    /*Pixel format:  Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha: 8 bit*/
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x2c, 0x34, 0xe8, 0xb8, 0x2c, 0x35, 0xe7, 0xe3, 0x2c, 0x35, 0xe7, 0xf8, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf8, 0x2c, 0x35, 0xe7, 0xef, 0x2b, 0x35, 0xe7, 0xdf, 0x2c, 0x35, 0xe7, 0xd7, 0x2b, 0x35, 0xe7, 0xc3, 0x2c, 0x36, 0xe7, 0x9c, 0x2d, 0x35, 0xe8, 0x78, 0x2b, 0x34, 0xe7, 0x54, 0x2a, 0x35, 0xe7, 0x2b, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x34, 0xe7, 0x37, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xec, 0x2c, 0x34, 0xe8, 0xaf, 0x2c, 0x35, 0xe8, 0x6f, 0x2b, 0x36, 0xe9, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe8, 0x8f, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x36, 0xe7, 0xe0, 0x2b, 0x35, 0xe7, 0x88, 0x2f, 0x36, 0xe4, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x34, 0xe5, 0x3b, 0x2c, 0x35, 0xe8, 0xa3, 0x2c, 0x35, 0xe7, 0xf7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xc7, 0x2c, 0x35, 0xe8, 0x57, 0x55, 0x55, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xee, 0x0f, 0x2c, 0x36, 0xe6, 0x68, 0x2d, 0x35, 0xe7, 0xcf, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xdc, 0x2c, 0x36, 0xe6, 0x68, 0x20, 0x40, 0xdf, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x39, 0xe3, 0x08, 0x2b, 0x35, 0xe6, 0x7c, 0x2c, 0x35, 0xe6, 0xdb, 0x2c, 0x35, 0xe7, 0xb3, 0x2d, 0x35, 0xe8, 0x83, 0x2b, 0x34, 0xe7, 0x54, 0x2b, 0x32, 0xea, 0x24, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x36, 0xe8, 0x43, 0x2c, 0x34, 0xe7, 0xb4, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x35, 0xe7, 0xe4, 0x2d, 0x35, 0xe6, 0x5b, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe6, 0x53, 0x2c, 0x36, 0xe7, 0xe0, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x36, 0xe7, 0xf3, 0x2c, 0x34, 0xe8, 0xb8, 0x2c, 0x35, 0xe7, 0x74, 0x2c, 0x37, 0xe9, 0x2f, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x33, 0xe6, 0x28, 0x2d, 0x35, 0xe7, 0xa0, 0x2c, 0x35, 0xe7, 0xfc, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x35, 0xe7, 0xc3, 0x2c, 0x37, 0xe9, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x33, 0xe8, 0x37, 0x2c, 0x35, 0xe7, 0xc8, 0x27, 0x31, 0xeb, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x33, 0xe6, 0x14, 0x2c, 0x35, 0xe7, 0xa7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xe7, 0x2c, 0x36, 0xe7, 0xa3, 0x2b, 0x34, 0xe8, 0x58, 0x2e, 0x2e, 0xe8, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x33, 0xe6, 0x28, 0x2c, 0x35, 0xe7, 0xa8, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xfb, 0x2c, 0x36, 0xe7, 0x8b, 0x33, 0x33, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x35, 0xe7, 0x2b, 0x2c, 0x35, 0xe7, 0xec, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xdc, 0x2d, 0x35, 0xe9, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x35, 0xe8, 0x43, 0x2c, 0x35, 0xe7, 0xe8, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x36, 0xe7, 0xf3, 0x2c, 0x36, 0xe7, 0xa3, 0x2c, 0x37, 0xe6, 0x47, 0x55, 0x55, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x35, 0xe4, 0x30, 0x2c, 0x34, 0xe7, 0xbf, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xc8, 0x2d, 0x35, 0xe9, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x31, 0xe6, 0x1f, 0x2c, 0x35, 0xe8, 0xe4, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xe0, 0x31, 0x31, 0xe7, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x2c, 0x34, 0xe8, 0x7b, 0x2c, 0x35, 0xe7, 0xfc, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xe7, 0x2c, 0x35, 0xe7, 0x8c, 0x2c, 0x33, 0xe9, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0x57, 0x2c, 0x35, 0xe7, 0xe3, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf0, 0x2c, 0x35, 0xe8, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x36, 0xe4, 0x13, 0x2c, 0x35, 0xe7, 0xd8, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x40, 0xdf, 0x08, 0x2d, 0x36, 0xe7, 0xab, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xfc, 0x2c, 0x35, 0xe7, 0xab, 0x2b, 0x34, 0xe7, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x2e, 0xe8, 0x0b, 0x2b, 0x35, 0xe6, 0x87, 0x2c, 0x35, 0xe7, 0xfb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x35, 0xe7, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x2d, 0x35, 0xe7, 0xb0, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x34, 0xe8, 0xaf, 0x55, 0x55, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0xdf, 0x10, 0x2c, 0x35, 0xe7, 0xc0, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xc0, 0x2c, 0x36, 0xe8, 0x4c, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x37, 0xe9, 0x2f, 0x2d, 0x35, 0xe7, 0xcf, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x36, 0xe7, 0x9c, 0x40, 0x40, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x36, 0xe7, 0x77, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x35, 0xe7, 0xbc, 0x24, 0x24, 0xdb, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0x8b, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xc7, 0x2b, 0x34, 0xe5, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0xdb, 0x07, 0x2c, 0x35, 0xe6, 0x87, 0x2c, 0x35, 0xe7, 0xfc, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xac, 0x24, 0x24, 0xdb, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x36, 0xe9, 0x38, 0x2c, 0x35, 0xe7, 0xfb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xd4, 0x2b, 0x2b, 0xea, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x36, 0xe8, 0x8f, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xb3, 0x2b, 0x32, 0xea, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe6, 0x3f, 0x2d, 0x35, 0xe7, 0xe4, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x34, 0xe8, 0xaf, 0x55, 0x55, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x3c, 0xe1, 0x10, 0x2c, 0x36, 0xe7, 0xe0, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf4, 0x2a, 0x35, 0xe7, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x36, 0xe8, 0x8f, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf8, 0x2d, 0x35, 0xe8, 0x8f, 0x27, 0x3b, 0xeb, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x31, 0xe7, 0x14, 0x2d, 0x35, 0xe7, 0xb7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x34, 0xe7, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe8, 0x9b, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x34, 0xe8, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x36, 0xe8, 0x8f, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x36, 0xe7, 0xe0, 0x2d, 0x35, 0xe9, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x2b, 0x35, 0xe7, 0x83, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x34, 0xe7, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x36, 0xe6, 0x34, 0x2c, 0x35, 0xe7, 0xfc, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x36, 0xe8, 0x8f, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x35, 0xe8, 0x98, 0x27, 0x3b, 0xeb, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x36, 0xe7, 0x54, 0x2c, 0x35, 0xe7, 0xf7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x34, 0xe8, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x2c, 0x35, 0xe7, 0xcb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x35, 0xe7, 0xe4, 0x24, 0x37, 0xed, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x36, 0xe8, 0x8f, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x36, 0xe7, 0xe0, 0x2b, 0x37, 0xe7, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x37, 0xe8, 0x38, 0x2c, 0x35, 0xe7, 0xe8, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe8, 0xef, 0x2e, 0x36, 0xe8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0x68, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x34, 0xe8, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x34, 0xe6, 0x67, 0x2d, 0x35, 0xe7, 0xbc, 0x2c, 0x35, 0xe7, 0xcc, 0x2c, 0x35, 0xe6, 0xdb, 0x2d, 0x35, 0xe7, 0xe4, 0x2c, 0x35, 0xe7, 0xf0, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xfc, 0x2d, 0x35, 0xe8, 0x78, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe9, 0x23, 0x2c, 0x35, 0xe7, 0xdf, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xc8, 0x2b, 0x2b, 0xd5, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x3b, 0xeb, 0x0c, 0x2c, 0x35, 0xe7, 0xec, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x35, 0xe7, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x2e, 0xe8, 0x0b, 0x2a, 0x34, 0xe5, 0x30, 0x2b, 0x34, 0xe8, 0x58, 0x2c, 0x36, 0xe7, 0x80, 0x2c, 0x35, 0xe7, 0xa7, 0x2c, 0x35, 0xe8, 0xcf, 0x2c, 0x35, 0xe7, 0xfc, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xac, 0x27, 0x3b, 0xeb, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x39, 0xe3, 0x1b, 0x2c, 0x34, 0xe7, 0xd7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x34, 0xe7, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0x74, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xfb, 0x2d, 0x33, 0xe8, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0xea, 0x0c, 0x2d, 0x35, 0xe9, 0x44, 0x2b, 0x35, 0xe7, 0x88, 0x2c, 0x35, 0xe7, 0xcc, 0x2c, 0x35, 0xe7, 0xfc, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x35, 0xe7, 0xd8, 0x2a, 0x35, 0xe7, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x39, 0xe3, 0x13, 0x2c, 0x35, 0xe7, 0xc8, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xfb, 0x2b, 0x36, 0xe9, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0xdb, 0x07, 0x2d, 0x35, 0xe7, 0xe4, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x35, 0xe7, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x3a, 0xe8, 0x17, 0x2b, 0x35, 0xe6, 0x64, 0x2c, 0x36, 0xe7, 0xc3, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf0, 0x2b, 0x37, 0xe7, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xee, 0x0f, 0x2c, 0x35, 0xe7, 0xcc, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x36, 0xe7, 0xc3, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x35, 0xe6, 0x64, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xfb, 0x30, 0x38, 0xe7, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe5, 0x1c, 0x2d, 0x36, 0xe7, 0x77, 0x2c, 0x35, 0xe6, 0xdb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf8, 0x2b, 0x34, 0xe7, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x31, 0xe7, 0x14, 0x2c, 0x34, 0xe7, 0xd7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe6, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xff, 0x03, 0x2c, 0x35, 0xe6, 0xdb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x34, 0xe7, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x2b, 0x36, 0xe6, 0x47, 0x2b, 0x35, 0xe7, 0xc3, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xfb, 0x2d, 0x35, 0xe7, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe5, 0x1c, 0x2b, 0x35, 0xe7, 0xdf, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe8, 0xe4, 0x24, 0x24, 0xdb, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x34, 0xe9, 0x44, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2e, 0x34, 0xe8, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x33, 0xe6, 0x33, 0x2c, 0x36, 0xe6, 0x68, 0x2c, 0x35, 0xe7, 0x8b, 0x2c, 0x36, 0xe7, 0x9c, 0x2c, 0x35, 0xe7, 0xab, 0x2c, 0x35, 0xe7, 0xa8, 0x2b, 0x35, 0xe8, 0x98, 0x2b, 0x35, 0xe7, 0x80, 0x2c, 0x35, 0xe6, 0x5c, 0x2b, 0x35, 0xe4, 0x30, 0x33, 0x33, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x36, 0xe6, 0x3c, 0x2c, 0x35, 0xe7, 0xb8, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x36, 0xe6, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x34, 0xe5, 0x27, 0x2c, 0x35, 0xe7, 0xef, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x35, 0xe6, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe7, 0xa0, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x39, 0xe3, 0x13, 0x2c, 0x34, 0xe7, 0x7f, 0x2c, 0x35, 0xe6, 0xdb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf7, 0x2c, 0x35, 0xe7, 0xc8, 0x2c, 0x35, 0xe7, 0x97, 0x2b, 0x36, 0xe7, 0x5f, 0x2e, 0x3a, 0xe8, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x35, 0xe7, 0x34, 0x2c, 0x35, 0xe7, 0xc0, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe8, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe6, 0x3f, 0x2c, 0x35, 0xe7, 0xf8, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xdc, 0x40, 0x40, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x39, 0xe3, 0x08, 0x2c, 0x35, 0xe7, 0xf0, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x34, 0xe6, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0xdb, 0x07, 0x2c, 0x36, 0xe6, 0x7b, 0x2c, 0x35, 0xe8, 0xef, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xfc, 0x2d, 0x36, 0xe7, 0xc8, 0x2c, 0x36, 0xe6, 0x7b, 0x2b, 0x36, 0xe9, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x36, 0xe7, 0x54, 0x2c, 0x35, 0xe7, 0xe8, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x35, 0xe7, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe7, 0x60, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x34, 0xe8, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x34, 0xe8, 0x58, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf0, 0x39, 0x39, 0xe3, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x34, 0xe5, 0x27, 0x2d, 0x35, 0xe7, 0xcf, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x34, 0xe7, 0xd7, 0x2d, 0x36, 0xe7, 0x77, 0x28, 0x36, 0xe4, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0xdf, 0x10, 0x2c, 0x35, 0xe6, 0x90, 0x2c, 0x35, 0xe7, 0xfc, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xfc, 0x2c, 0x35, 0xe6, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe6, 0x90, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0xb3, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x35, 0xe8, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x37, 0xe6, 0x47, 0x2c, 0x35, 0xe7, 0xf4, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf4, 0x2c, 0x35, 0xe7, 0x9f, 0x2b, 0x37, 0xe7, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x33, 0xe8, 0x37, 0x2c, 0x35, 0xe7, 0xdf, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf7, 0x2e, 0x36, 0xe6, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xff, 0x04, 0x2c, 0x35, 0xe6, 0xc4, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x29, 0x37, 0xea, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xff, 0x04, 0x2c, 0x36, 0xe7, 0xf3, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x35, 0xe6, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x35, 0xe6, 0x48, 0x2c, 0x35, 0xe7, 0xf7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xfc, 0x2c, 0x35, 0xe7, 0xab, 0x2d, 0x33, 0xe6, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x37, 0xed, 0x0f, 0x2c, 0x35, 0xe7, 0xa8, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xef, 0x2d, 0x35, 0xe9, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe5, 0x1c, 0x2c, 0x35, 0xe7, 0xec, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x35, 0xe7, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2d, 0x36, 0xe9, 0x38, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf0, 0x55, 0x55, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x35, 0xe4, 0x30, 0x2c, 0x35, 0xe7, 0xf7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xfc, 0x2c, 0x35, 0xe8, 0xa3, 0x2f, 0x39, 0xe3, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe6, 0x67, 0x2c, 0x35, 0xe7, 0xf8, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe6, 0xd0, 0x33, 0x33, 0xe6, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x34, 0xe8, 0x4f, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x35, 0xe7, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe8, 0x78, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x35, 0xe7, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x3b, 0xeb, 0x0c, 0x2c, 0x36, 0xe7, 0xdb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf3, 0x2c, 0x35, 0xe8, 0x6f, 0x55, 0x55, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x36, 0xe6, 0x34, 0x2c, 0x35, 0xe7, 0xe7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x35, 0xe7, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x36, 0xe7, 0x9c, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2e, 0x34, 0xe8, 0x2c, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0xb8, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x34, 0xe6, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x36, 0xe7, 0x8b, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xcc, 0x2d, 0x37, 0xe6, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x38, 0xe7, 0x20, 0x2b, 0x35, 0xe7, 0xd8, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x35, 0xe7, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x37, 0xed, 0x0f, 0x2c, 0x35, 0xe7, 0xe0, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x34, 0xe7, 0x6c, 0x00, 0x00, 0x00, 0x00,
-    0x55, 0x55, 0xff, 0x03, 0x2c, 0x36, 0xe7, 0xf3, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2a, 0x34, 0xe5, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x36, 0xe8, 0x20, 0x2c, 0x35, 0xe7, 0xf8, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xfb, 0x2c, 0x35, 0xe7, 0x73, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x3a, 0xe8, 0x17, 0x2c, 0x35, 0xe7, 0xcc, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf8, 0x2e, 0x33, 0xe6, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x35, 0xe8, 0x43, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xac, 0x00, 0x00, 0x00, 0x00,
-    0x2d, 0x35, 0xe9, 0x23, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf0, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x36, 0xe8, 0x8f, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xb3, 0x2b, 0x39, 0xe3, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0xea, 0x0c, 0x2c, 0x35, 0xe7, 0xb8, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xd4, 0x20, 0x40, 0xdf, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x34, 0xe7, 0xa0, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xec, 0x00, 0x00, 0xff, 0x03,
-    0x2d, 0x34, 0xe7, 0x48, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x36, 0xe7, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0xd5, 0x07, 0x2c, 0x35, 0xe8, 0xef, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xe0, 0x2a, 0x34, 0xe5, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0xd5, 0x07, 0x2c, 0x35, 0xe6, 0xbb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x35, 0xe8, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x35, 0xea, 0x18, 0x2c, 0x35, 0xe7, 0xf0, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x33, 0xe6, 0x28,
-    0x2c, 0x35, 0xe8, 0x6f, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x36, 0xe7, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe9, 0x44, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x36, 0xe7, 0xf3, 0x2b, 0x35, 0xe6, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x37, 0xed, 0x0f, 0x2d, 0x35, 0xe7, 0xcf, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xfb, 0x2c, 0x36, 0xe6, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x36, 0xe6, 0x73, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x36, 0xe6, 0x50,
-    0x2b, 0x36, 0xe7, 0x93, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x35, 0xe6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x35, 0xe7, 0x88, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf8, 0x2d, 0x36, 0xe8, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x33, 0xeb, 0x18, 0x2c, 0x35, 0xe7, 0xdc, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xd3, 0x2b, 0x2b, 0xd5, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xff, 0x04, 0x2c, 0x35, 0xe7, 0xd4, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x36, 0xe7, 0x77,
-    0x2c, 0x35, 0xe7, 0xb8, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x35, 0xe7, 0xb7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe8, 0xef, 0x2b, 0x35, 0xe7, 0xb7, 0x2c, 0x34, 0xe7, 0xbf, 0x2c, 0x35, 0xe7, 0xe7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x34, 0xe7, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x32, 0xea, 0x24, 0x2c, 0x35, 0xe7, 0xe8, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x34, 0xe8, 0x4f, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x34, 0xe6, 0x9c,
-    0x2c, 0x35, 0xe7, 0xcb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2e, 0x37, 0xe8, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x36, 0xe7, 0xdb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x36, 0xe7, 0xc8, 0x2b, 0x39, 0xe3, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x37, 0xed, 0x0f, 0x2a, 0x33, 0xe8, 0x37, 0x2c, 0x35, 0xe7, 0x74, 0x2d, 0x35, 0xe7, 0xb7, 0x2c, 0x35, 0xe7, 0xf4, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x35, 0xe7, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe7, 0x3f, 0x2c, 0x35, 0xe7, 0xfc, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe8, 0xef, 0x26, 0x33, 0xe6, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x2c, 0x35, 0xe7, 0xc8, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xc0,
-    0x2c, 0x35, 0xe7, 0xd7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x37, 0xe7, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0xe8, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2e, 0x37, 0xe8, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xff, 0x04, 0x2d, 0x34, 0xe7, 0x48, 0x2d, 0x34, 0xe6, 0xa7, 0x2c, 0x35, 0xe7, 0xf7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xfc, 0x2c, 0x35, 0xe6, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe7, 0x7f, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe6, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x34, 0xe9, 0x44, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xd3,
-    0x2c, 0x35, 0xe7, 0xe3, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x33, 0xe6, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0xf0, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2e, 0x3a, 0xe8, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xee, 0x0f, 0x2c, 0x35, 0xe7, 0x68, 0x2c, 0x35, 0xe7, 0xdf, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf8, 0x2b, 0x36, 0xe8, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x2c, 0x34, 0xe8, 0xb8, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xfb, 0x2f, 0x36, 0xe4, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0xc0, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x35, 0xe7, 0xdf,
-    0x2c, 0x35, 0xe8, 0xef, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x3c, 0xe1, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x36, 0xe7, 0xe0, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x35, 0xe6, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xff, 0x04, 0x2d, 0x35, 0xe7, 0x60, 0x2c, 0x35, 0xe6, 0xdb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xec, 0x30, 0x38, 0xe7, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x37, 0xe9, 0x17, 0x2c, 0x35, 0xe7, 0xe7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe8, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x36, 0xe8, 0x4c, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xec,
-    0x2c, 0x35, 0xe7, 0xfb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x33, 0x33, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x36, 0xe7, 0xc8, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xec, 0x2b, 0x34, 0xe8, 0x4f, 0x55, 0x55, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xff, 0x04, 0x2c, 0x35, 0xe8, 0x78, 0x2c, 0x35, 0xe7, 0xf4, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xcc, 0x39, 0x39, 0xe3, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x34, 0xe7, 0x48, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x33, 0xe8, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x2c, 0x35, 0xe7, 0xd7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x36, 0xe7, 0xf3,
-    0x2c, 0x35, 0xe7, 0xf8, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x33, 0x33, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x35, 0xe8, 0x98, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xef, 0x2c, 0x35, 0xe7, 0xbf, 0x2b, 0x36, 0xe7, 0x93, 0x2d, 0x35, 0xe6, 0x67, 0x2b, 0x34, 0xe7, 0x37, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x38, 0xe7, 0x20, 0x2b, 0x35, 0xe7, 0xb7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x35, 0xe7, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0xac, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x35, 0xe7, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x35, 0xe6, 0x64, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe6, 0xbb,
-    0x2c, 0x35, 0xe7, 0xeb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x3c, 0xe1, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x34, 0xe8, 0x63, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xe7, 0x2c, 0x35, 0xe7, 0x94, 0x2b, 0x36, 0xe8, 0x43, 0x55, 0x55, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x2c, 0x35, 0xe7, 0x74, 0x2c, 0x35, 0xe7, 0xfb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x34, 0xe8, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe5, 0x1c, 0x2c, 0x36, 0xe7, 0xf3, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xfb, 0x2c, 0x35, 0xe5, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x40, 0xdf, 0x08, 0x2c, 0x35, 0xe7, 0xec, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x36, 0xe7, 0xab,
-    0x2c, 0x35, 0xe7, 0xdc, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe5, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x37, 0xe9, 0x17, 0x2c, 0x35, 0xe7, 0xfc, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xe7, 0x2d, 0x36, 0xe6, 0x73, 0x2e, 0x2e, 0xe8, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x34, 0xe5, 0x3b, 0x2c, 0x35, 0xe8, 0xe4, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xeb, 0x31, 0x31, 0xe7, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x36, 0xe7, 0x77, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x34, 0xe7, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe6, 0x90, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe6, 0x9b,
-    0x2d, 0x35, 0xe7, 0xcf, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x37, 0xe7, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe6, 0xbb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xeb, 0x2d, 0x35, 0xe8, 0x78, 0x2b, 0x2b, 0xea, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x33, 0xe6, 0x1f, 0x2c, 0x35, 0xe7, 0xd8, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xff, 0x04, 0x2c, 0x35, 0xe7, 0xd4, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf0, 0x24, 0x37, 0xed, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x33, 0xe8, 0x2c, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0x8b,
-    0x2c, 0x35, 0xe7, 0xc0, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2a, 0x33, 0xe8, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x34, 0xe7, 0x48, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xe0, 0x2d, 0x35, 0xe9, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x31, 0xe7, 0x14, 0x2c, 0x35, 0xe7, 0xcb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x34, 0xe8, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x36, 0xe7, 0x54, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x35, 0xe6, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0xcb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x36, 0xe7, 0xc3, 0x2c, 0x34, 0xe7, 0x40,
-    0x2c, 0x35, 0xe7, 0xab, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x36, 0xe7, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x36, 0xe7, 0xc8, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x35, 0xe7, 0x94, 0x2e, 0x2e, 0xe8, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x37, 0xed, 0x0f, 0x2d, 0x35, 0xe7, 0xcf, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe6, 0xdb, 0x33, 0x33, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x2d, 0x35, 0xe7, 0xd4, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x35, 0xe7, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x36, 0xe6, 0x34, 0x30, 0x38, 0xe7, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2c, 0x34, 0xe8, 0x84, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x36, 0xe6, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x35, 0xe4, 0x30, 0x2c, 0x35, 0xe7, 0xfb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe6, 0xdb, 0x2d, 0x33, 0xe6, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x35, 0xea, 0x18, 0x2c, 0x35, 0xe7, 0xdc, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x36, 0xe7, 0x5f, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2e, 0x36, 0xe8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2c, 0x35, 0xe6, 0x5c, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x34, 0xe7, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x36, 0xe6, 0x7b, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xef, 0x2c, 0x34, 0xe7, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x37, 0xea, 0x24, 0x2c, 0x35, 0xe7, 0xec, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xe7, 0x2e, 0x2e, 0xe8, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xff, 0x03, 0x2c, 0x35, 0xe6, 0xdb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x36, 0xe6, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2c, 0x36, 0xe6, 0x34, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x2d, 0x34, 0xe6, 0xa7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf8, 0x2c, 0x34, 0xe6, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x36, 0xe8, 0x4c, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x35, 0xe8, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x34, 0xe6, 0x67, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x2b, 0x2b, 0xea, 0x0c, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe8, 0xef, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0xd5, 0x07, 0x2c, 0x35, 0xe7, 0xa8, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x34, 0xe6, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x36, 0xe8, 0x8f, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xe7, 0x2b, 0x2b, 0xd5, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x37, 0xed, 0x0f, 0x2c, 0x35, 0xe7, 0xf4, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x36, 0xe9, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0xdf, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x37, 0xe9, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xff, 0x03, 0x2d, 0x35, 0xe8, 0x8f, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf8, 0x2b, 0x37, 0xe7, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0xd5, 0x07, 0x2c, 0x35, 0xe6, 0xd0, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x34, 0xe8, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x35, 0xe6, 0xa4, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x36, 0xe7, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2b, 0x35, 0xe7, 0x9f, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe8, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x36, 0xe7, 0x4b, 0x2c, 0x35, 0xe7, 0xe3, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf0, 0x2e, 0x34, 0xe8, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe9, 0x3b, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x35, 0xe6, 0x48, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe6, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe6, 0x5c, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe8, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xe6, 0x0b, 0x2c, 0x35, 0xe8, 0x78, 0x2c, 0x35, 0xe7, 0xe7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xd3, 0x24, 0x24, 0xdb, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x35, 0xe7, 0x9f, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x37, 0xe6, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x2c, 0x35, 0xe8, 0xe4, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf7, 0x33, 0x33, 0xe6, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x29, 0x33, 0xeb, 0x18, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xec, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xff, 0x04, 0x2c, 0x36, 0xe6, 0x50, 0x2b, 0x36, 0xe7, 0x93, 0x2c, 0x35, 0xe7, 0xc0, 0x2c, 0x35, 0xe8, 0xef, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x3a, 0xe8, 0x17, 0x2c, 0x35, 0xe7, 0xf4, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0x8c, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x36, 0xe6, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x34, 0xe7, 0xd7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x34, 0xe5, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x31, 0xe6, 0x1f, 0x2b, 0x34, 0xe7, 0x54, 0x2c, 0x36, 0xe8, 0x98, 0x2c, 0x36, 0xe7, 0xdb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xfc, 0x2d, 0x35, 0xe6, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe8, 0x8f, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xdf, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x35, 0xe8, 0x43, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe8, 0x8f, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x34, 0xe7, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x33, 0xe6, 0x3c, 0x2c, 0x35, 0xe7, 0xb3, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xd3, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x37, 0xe4, 0x1c, 0x2c, 0x35, 0xe7, 0xf8, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x37, 0xe6, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x40, 0xdf, 0x08, 0x2c, 0x35, 0xe7, 0xf7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x36, 0xe7, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x36, 0xe6, 0x34, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xec, 0x24, 0x24, 0xdb, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x35, 0xe7, 0x34, 0x2c, 0x35, 0xe7, 0xd7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x36, 0xe7, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0x9f, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe6, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x34, 0xe7, 0xbf, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf0, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0xd3, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x36, 0xe6, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xe6, 0x0b, 0x2c, 0x36, 0xe8, 0x98, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x34, 0xe7, 0xd7, 0x55, 0x55, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x36, 0xe6, 0x3c, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe7, 0x7c, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x33, 0xe9, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x34, 0xe7, 0x74, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x34, 0xe8, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x35, 0xe7, 0x83, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x34, 0xe6, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x2c, 0x35, 0xe7, 0xdf, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xfb, 0x2e, 0x2e, 0xe8, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe9, 0x3b, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x34, 0xe6, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x31, 0xeb, 0x1b, 0x2c, 0x35, 0xe7, 0xfc, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xfc, 0x2f, 0x36, 0xe4, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x34, 0xe8, 0x84, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe8, 0x83, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x36, 0xe8, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x24, 0xdb, 0x07, 0x2c, 0x35, 0xe7, 0xfc, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x35, 0xe7, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe8, 0xaf, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x36, 0xe7, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x3c, 0xe1, 0x10, 0x2d, 0x37, 0xe6, 0x33, 0x2a, 0x35, 0xe7, 0x2b, 0x2e, 0x2e, 0xe8, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x2b, 0x35, 0xe7, 0xb7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xfb, 0x2c, 0x37, 0xe9, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe9, 0x3b, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x35, 0xe7, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x36, 0xe7, 0xdb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x36, 0xe8, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x34, 0xe5, 0x30, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xfb, 0x2b, 0x33, 0xe6, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x34, 0xe7, 0x40, 0x2c, 0x35, 0xe6, 0xbb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf8, 0x2b, 0x36, 0xe6, 0xb0, 0x2b, 0x35, 0xe4, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x39, 0xe3, 0x1b, 0x2c, 0x35, 0xe7, 0xec, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe8, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xff, 0x04, 0x2c, 0x36, 0xe7, 0xf3, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x35, 0xe7, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x34, 0xe7, 0xb4, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf8, 0x29, 0x37, 0xea, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe7, 0xb7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe6, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x36, 0xe7, 0x80, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xfb, 0x2d, 0x35, 0xe6, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0x74, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x36, 0xe7, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe7, 0xb7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x35, 0xe7, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0x8c, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x35, 0xe8, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x36, 0xe9, 0x38, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf8, 0x2e, 0x34, 0xe5, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe7, 0x7c, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x34, 0xe8, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0xea, 0x0c, 0x2c, 0x35, 0xe7, 0xec, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xef, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x34, 0xe7, 0x7f, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf7, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x35, 0xe6, 0x64, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe6, 0xdb, 0x33, 0x33, 0xe6, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x34, 0xe7, 0xbf, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x34, 0xe8, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x36, 0xe8, 0x20, 0x2c, 0x35, 0xe7, 0xfb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xe3, 0x39, 0x39, 0xe3, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x35, 0xe7, 0x88, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2e, 0x34, 0xe8, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe8, 0x57, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2e, 0x37, 0xe4, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x34, 0xe7, 0x40, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xfc, 0x2b, 0x34, 0xe5, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x33, 0xe8, 0x2c, 0x2c, 0x35, 0xe7, 0xfb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x34, 0xe6, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x34, 0xe8, 0x84, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x36, 0xe7, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x33, 0xe6, 0x3c, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x36, 0xe8, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x35, 0xe4, 0x30, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x35, 0xe6, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x33, 0xe8, 0x2c, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x34, 0xe7, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x36, 0xe8, 0x8f, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xe3, 0x2e, 0x2e, 0xe8, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0xc0, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe6, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xff, 0x04, 0x2c, 0x35, 0xe7, 0xf0, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x35, 0xe7, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xe6, 0x0b, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x36, 0xe6, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x38, 0xe7, 0x20, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xc7, 0x2b, 0x2b, 0xd5, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x3b, 0xeb, 0x0c, 0x2c, 0x35, 0xe8, 0xe4, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x34, 0xe6, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0xcb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0xbf, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x34, 0xe6, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0xf7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe6, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x36, 0xe4, 0x13, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xe8, 0x27, 0x31, 0xeb, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x36, 0xe7, 0x54, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x34, 0xe6, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x35, 0xe7, 0xbc, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0xa7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x36, 0xe7, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0xeb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x36, 0xe6, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xff, 0x04, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf7, 0x2d, 0x36, 0xe9, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0xa8, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x36, 0xe7, 0xf3, 0x2e, 0x34, 0xe5, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x34, 0xe7, 0x7f, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x36, 0xe8, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe6, 0x90, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0xdc, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x34, 0xe7, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0xf7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xfc, 0x2c, 0x36, 0xe6, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x3b, 0xeb, 0x0c, 0x2c, 0x35, 0xe6, 0xdb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x34, 0xe7, 0xd0, 0x33, 0x33, 0xe6, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x32, 0xea, 0x24, 0x2c, 0x35, 0xe7, 0xfc, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xe3, 0x2b, 0x2b, 0xd5, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0x8c, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe6, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x34, 0xe7, 0xd7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x36, 0xe6, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe7, 0x3f, 0x2d, 0x35, 0xe9, 0x44, 0x2d, 0x35, 0xe9, 0x44, 0x2d, 0x35, 0xe9, 0x44, 0x2d, 0x35, 0xe9, 0x44, 0x2d, 0x35, 0xe9, 0x44, 0x2e, 0x33, 0xe6, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x33, 0xe8, 0x2c, 0x2c, 0x35, 0xe7, 0xf7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe6, 0xbb, 0x2b, 0x2b, 0xd5, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0x8b, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xfc, 0x2d, 0x36, 0xe7, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe7, 0xa0, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x34, 0xe7, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0xe3, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x34, 0xe6, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x34, 0xe6, 0x67, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x35, 0xe6, 0xa4, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xff, 0x03, 0x2c, 0x34, 0xe7, 0x97, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xfc, 0x2c, 0x35, 0xe8, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe6, 0xbb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0xec, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x35, 0xe6, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x36, 0xe7, 0x93, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x34, 0xe7, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe6, 0x53, 0x2c, 0x35, 0xe7, 0xc7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x36, 0xe7, 0xc3, 0x2d, 0x35, 0xe7, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x2c, 0x35, 0xe7, 0xef, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x35, 0xe8, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0xf8, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x36, 0xe8, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x2c, 0x35, 0xe7, 0xa7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x35, 0xe7, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x33, 0xe6, 0x1f, 0x2b, 0x35, 0xe7, 0x34, 0x2c, 0x34, 0xe7, 0x40, 0x2b, 0x35, 0xea, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x33, 0xe8, 0x2c, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x31, 0xe7, 0x14, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x34, 0xe8, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe6, 0x5b, 0x2e, 0x34, 0xe5, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xff, 0x04, 0x2d, 0x35, 0xe7, 0xb7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0x9f, 0x40, 0x40, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x35, 0xe6, 0x87, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x34, 0xe8, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x36, 0xe9, 0x38, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2e, 0x37, 0xe8, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe8, 0x6f, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xe8, 0x2b, 0x37, 0xe7, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0xea, 0x0c, 0x2d, 0x36, 0xe7, 0xc8, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xab, 0x24, 0x24, 0xdb, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xff, 0x04, 0x2c, 0x35, 0xe8, 0xe4, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x29, 0x33, 0xeb, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x34, 0xe6, 0x5c, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x26, 0x33, 0xe6, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x2b, 0x34, 0xe7, 0x8c, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xe7, 0x2e, 0x34, 0xe5, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x3b, 0xeb, 0x0c, 0x2c, 0x35, 0xe6, 0xbb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x35, 0xe7, 0xbc, 0x28, 0x36, 0xe4, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x36, 0xe8, 0x6c, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe6, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe8, 0x8f, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe8, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x39, 0xe3, 0x08, 0x2b, 0x35, 0xe6, 0xa4, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe8, 0xef, 0x2e, 0x36, 0xe6, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0xd5, 0x07, 0x2d, 0x34, 0xe6, 0xa7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xe3, 0x2b, 0x33, 0xe6, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x2c, 0x35, 0xe7, 0xdc, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x35, 0xe8, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe7, 0xcc, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x34, 0xe5, 0x27, 0x2c, 0x34, 0xe7, 0xd0, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x35, 0xe7, 0xe4, 0x2b, 0x36, 0xe9, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x2c, 0x36, 0xe7, 0x8b, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xfb, 0x2c, 0x36, 0xe7, 0x80, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x35, 0xe5, 0x1c, 0x2c, 0x35, 0xe7, 0xb3, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x36, 0xe6, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0xee, 0x0f, 0x2c, 0x35, 0xe7, 0xfc, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x36, 0xe8, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x36, 0xe7, 0x5f, 0x2c, 0x36, 0xe7, 0xf3, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2d, 0x35, 0xe7, 0xd4, 0x2c, 0x35, 0xe5, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x35, 0xe6, 0x67, 0x2c, 0x35, 0xe7, 0xf7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe6, 0xbb, 0x2c, 0x33, 0xe9, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x34, 0xe8, 0x58, 0x2c, 0x35, 0xe7, 0xe8, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xeb, 0x40, 0x40, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0xff, 0x04, 0x2b, 0x37, 0xe7, 0x40, 0x2d, 0x34, 0xe7, 0x88, 0x2c, 0x35, 0xe6, 0xd0, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf4, 0x2d, 0x35, 0xe8, 0x9b, 0x2d, 0x33, 0xe8, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x3a, 0xe8, 0x17, 0x2c, 0x35, 0xe8, 0xa4, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xb8, 0x33, 0x33, 0xee, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x37, 0xe7, 0x2b, 0x2c, 0x35, 0xe7, 0xd3, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf8, 0x2c, 0x35, 0xe6, 0x90, 0x2e, 0x2e, 0xe8, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x39, 0xe3, 0x13, 0x2d, 0x35, 0xe7, 0xa0, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2b, 0x36, 0xe8, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x31, 0xeb, 0x1b, 0x2d, 0x35, 0xe7, 0x60, 0x2c, 0x35, 0xe7, 0xa8, 0x2c, 0x35, 0xe7, 0xec, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xfb, 0x2c, 0x35, 0xe7, 0xb8, 0x2c, 0x36, 0xe8, 0x63, 0x2d, 0x3c, 0xe1, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x2b, 0x36, 0xe7, 0x5f, 0x2c, 0x35, 0xe7, 0xeb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xfb, 0x2c, 0x36, 0xe7, 0x80, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0xea, 0x0c, 0x2c, 0x36, 0xe7, 0xa3, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xdc, 0x2b, 0x35, 0xe8, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x33, 0xe6, 0x33, 0x2d, 0x36, 0xe6, 0x73, 0x2c, 0x35, 0xe7, 0xab, 0x2c, 0x35, 0xe7, 0xe3, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xfc, 0x2e, 0x36, 0xe8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xff, 0x03, 0x2b, 0x35, 0xe7, 0x34, 0x28, 0x36, 0xe4, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x34, 0xe5, 0x3b, 0x2d, 0x35, 0xe7, 0xcf, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe6, 0xdb, 0x2c, 0x36, 0xe6, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x34, 0xe6, 0x53, 0x2c, 0x35, 0xe7, 0xe3, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xcb, 0x2c, 0x36, 0xe6, 0x50, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x37, 0xe9, 0x17, 0x2e, 0x37, 0xe8, 0x38, 0x2d, 0x36, 0xe7, 0x54, 0x2d, 0x36, 0xe6, 0x73, 0x2d, 0x34, 0xe7, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x37, 0xe7, 0x40, 0x2c, 0x35, 0xe6, 0xbb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xfc, 0x2c, 0x35, 0xe6, 0x9b, 0x27, 0x3b, 0xeb, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x2b, 0xea, 0x0c, 0x2c, 0x36, 0xe7, 0x8b, 0x2c, 0x35, 0xe7, 0xfb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xd4, 0x2c, 0x34, 0xe6, 0x5c, 0x2b, 0x2b, 0xd5, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x2b, 0x35, 0xe8, 0x4c, 0x2c, 0x35, 0xe7, 0xc7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xc7, 0x2b, 0x35, 0xe7, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x37, 0xe7, 0x2b, 0x2c, 0x35, 0xe6, 0xbb, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xec, 0x2c, 0x35, 0xe7, 0x97, 0x2c, 0x35, 0xe9, 0x3b, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x37, 0xe9, 0x2f, 0x2c, 0x36, 0xe7, 0x8b, 0x2c, 0x35, 0xe7, 0xe3, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xe7, 0x2b, 0x36, 0xe7, 0x5f, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x36, 0xe9, 0x38, 0x2c, 0x34, 0xe7, 0xb4, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xdc, 0x2c, 0x35, 0xe6, 0x87, 0x2b, 0x36, 0xe8, 0x43, 0x39, 0x39, 0xe3, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0xff, 0x04, 0x2c, 0x35, 0xe9, 0x3b, 0x2b, 0x35, 0xe6, 0x7c, 0x2c, 0x35, 0xe7, 0xd3, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xe3, 0x2c, 0x35, 0xe7, 0x74, 0x2b, 0x2b, 0xea, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x35, 0xe4, 0x30, 0x2c, 0x35, 0xe7, 0xab, 0x2c, 0x35, 0xe7, 0xfc, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf8, 0x2c, 0x35, 0xe7, 0xc0, 0x2c, 0x36, 0xe7, 0x80, 0x2d, 0x34, 0xe7, 0x4b, 0x2b, 0x32, 0xea, 0x24, 0x40, 0x40, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x29, 0x31, 0xe6, 0x1f, 0x2c, 0x34, 0xe9, 0x44, 0x2d, 0x36, 0xe7, 0x77, 0x2d, 0x35, 0xe7, 0xb7, 0x2c, 0x36, 0xe7, 0xf3, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xd3, 0x2b, 0x36, 0xe7, 0x5f, 0x2b, 0x2b, 0xd5, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x33, 0xeb, 0x18, 0x2c, 0x35, 0xe7, 0x73, 0x2c, 0x35, 0xe6, 0xd0, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf8, 0x2c, 0x35, 0xe7, 0xd8, 0x2c, 0x35, 0xe7, 0xb3, 0x2c, 0x35, 0xe6, 0x9b, 0x2c, 0x35, 0xe6, 0x90, 0x2c, 0x34, 0xe8, 0x84, 0x2d, 0x36, 0xe7, 0x77, 0x2c, 0x36, 0xe6, 0x68, 0x2d, 0x36, 0xe7, 0x77, 0x2b, 0x35, 0xe7, 0x83, 0x2b, 0x36, 0xe8, 0x8f, 0x2b, 0x35, 0xe8, 0x98, 0x2c, 0x34, 0xe8, 0xaf, 0x2c, 0x34, 0xe7, 0xd0, 0x2c, 0x35, 0xe7, 0xf7, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf0, 0x2c, 0x36, 0xe7, 0xa3, 0x2c, 0x37, 0xe6, 0x47, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x33, 0xe8, 0x2c, 0x2c, 0x36, 0xe7, 0x8b, 0x2d, 0x35, 0xe7, 0xd4, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xf4, 0x2c, 0x35, 0xe7, 0xa8, 0x2c, 0x36, 0xe6, 0x50, 0x20, 0x40, 0xdf, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x37, 0xe9, 0x17, 0x2b, 0x34, 0xe8, 0x58, 0x2b, 0x35, 0xe8, 0x98, 0x2b, 0x35, 0xe7, 0xd8, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe7, 0xec, 0x2c, 0x35, 0xe7, 0xb3, 0x2c, 0x34, 0xe7, 0x74, 0x2c, 0x35, 0xe9, 0x3b, 0x2b, 0x2b, 0xd5, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x2e, 0xe8, 0x0b, 0x2a, 0x34, 0xe5, 0x30, 0x2c, 0x35, 0xe8, 0x57, 0x2d, 0x35, 0xe7, 0x7f, 0x2d, 0x34, 0xe6, 0xa7, 0x2d, 0x35, 0xe7, 0xbc, 0x2c, 0x35, 0xe7, 0xcc, 0x2c, 0x35, 0xe6, 0xdb, 0x2c, 0x35, 0xe7, 0xe7, 0x2c, 0x35, 0xe7, 0xf0, 0x2c, 0x35, 0xe7, 0xff, 0x2c, 0x35, 0xe8, 0xef, 0x2c, 0x35, 0xe7, 0xef, 0x2c, 0x35, 0xe7, 0xdf, 0x2c, 0x35, 0xe7, 0xdc, 0x2c, 0x35, 0xe7, 0xcc, 0x2c, 0x34, 0xe8, 0xaf, 0x2b, 0x34, 0xe7, 0x8c, 0x2d, 0x34, 0xe7, 0x6c, 0x2d, 0x34, 0xe7, 0x4b, 0x2f, 0x36, 0xe4, 0x27, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-#endif
-};
-
-const lv_img_dsc_t img_esp_logo = {
-    .header.always_zero = 0,
-    .header.w = 96,
-    .header.h = 96,
-    .data_size = 9216 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-    .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-    .data = img_esp_logo_map,
-};
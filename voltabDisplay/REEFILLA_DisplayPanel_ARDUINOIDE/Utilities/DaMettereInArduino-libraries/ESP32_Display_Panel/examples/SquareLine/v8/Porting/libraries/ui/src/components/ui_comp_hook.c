@@ -1,5 +0,0 @@
-// This file was generated by SquareLine Studio
-// SquareLine Studio version: SquareLine Studio 1.3.2
-// LVGL version: 8.3.6
-// Project name: Porting
-
@@ -1,3178 +0,0 @@
-/*******************************************************************************
- * Size: 28 px
- * Bpp: 4
- * Opts: --bpp 4 --size 28 --font /home/lvhaiyu/SquareLine/assets/AlimamaShuHeiTi-Bold.ttf -o /home/lvhaiyu/SquareLine/assets/ui_font_FontNumber28bp4.c --format lvgl -r 0x20-0x7f --symbols 星期一二三四五六日℃晴多云阴小雨中雨大雨暴雨小雪大雪℃ --no-compress --no-prefilter
- ******************************************************************************/
-
-#include "../ui.h"
-
-#ifndef UI_FONT_FONTNUMBER28BP4
-#define UI_FONT_FONTNUMBER28BP4 1
-#endif
-
-#if UI_FONT_FONTNUMBER28BP4
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0xf, 0xff, 0xf6, 0xf, 0xff, 0xf5, 0xf, 0xff,
-    0xf5, 0xe, 0xff, 0xf4, 0xe, 0xff, 0xf3, 0xd,
-    0xff, 0xf3, 0xc, 0xff, 0xf2, 0xc, 0xff, 0xf2,
-    0xb, 0xff, 0xf1, 0xb, 0xff, 0xf0, 0xa, 0xff,
-    0xf0, 0x9, 0xff, 0xf0, 0x9, 0xff, 0xe0, 0x4,
-    0x88, 0x70, 0x0, 0x0, 0x0, 0x1c, 0xcc, 0xc6,
-    0x1f, 0xff, 0xf8, 0x1f, 0xff, 0xf8, 0x1f, 0xff,
-    0xf8, 0x1f, 0xff, 0xf8,
-
-    /* U+0022 "\"" */
-    0x69, 0x99, 0x14, 0x99, 0x93, 0xaf, 0xff, 0x17,
-    0xff, 0xf5, 0x9f, 0xff, 0x6, 0xff, 0xf3, 0x8f,
-    0xfe, 0x4, 0xff, 0xf2, 0x6f, 0xfd, 0x3, 0xff,
-    0xf1, 0x5f, 0xfc, 0x1, 0xff, 0xf0, 0x3f, 0xfa,
-    0x0, 0xff, 0xe0, 0x2f, 0xf9, 0x0, 0xef, 0xd0,
-    0xf, 0xf7, 0x0, 0xdf, 0xb0,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0x6f, 0xff, 0x0, 0x2, 0xff, 0xf2,
-    0x0, 0x0, 0x9, 0xff, 0xc0, 0x0, 0x5f, 0xff,
-    0x0, 0x0, 0x0, 0xcf, 0xf9, 0x0, 0x8, 0xff,
-    0xc0, 0x0, 0x0, 0xf, 0xff, 0x60, 0x0, 0xbf,
-    0xf9, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x69, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x9f, 0xfb, 0x0,
-    0x5, 0xff, 0xf0, 0x0, 0x0, 0xb, 0xff, 0x90,
-    0x0, 0x7f, 0xfd, 0x0, 0x0, 0x0, 0xdf, 0xf7,
-    0x0, 0xa, 0xff, 0xb0, 0x0, 0x0, 0xf, 0xff,
-    0x50, 0x0, 0xcf, 0xf9, 0x0, 0x0, 0x1, 0xff,
-    0xf3, 0x0, 0xe, 0xff, 0x70, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x69, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0xb, 0xff, 0x90, 0x0, 0x8f, 0xfc, 0x0, 0x0,
-    0x0, 0xef, 0xf6, 0x0, 0xa, 0xff, 0xa0, 0x0,
-    0x0, 0xf, 0xff, 0x30, 0x0, 0xdf, 0xf7, 0x0,
-    0x0, 0x3, 0xff, 0xf1, 0x0, 0xf, 0xff, 0x40,
-    0x0, 0x0, 0x5f, 0xfe, 0x0, 0x2, 0xff, 0xf2,
-    0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0xcf, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0x40, 0x0, 0x0, 0x0, 0x2,
-    0x9d, 0xff, 0xff, 0xed, 0xb7, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0x4f, 0xff, 0xf8,
-    0xef, 0x98, 0x9b, 0xd0, 0x7, 0xff, 0xf6, 0xc,
-    0xf4, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x30, 0xcf,
-    0x40, 0x0, 0x0, 0x7, 0xff, 0xf6, 0xc, 0xf4,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf8, 0xdf, 0x40,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xfc, 0x72,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x10, 0x0, 0x1, 0x9e, 0xff, 0xff, 0xff, 0xfe,
-    0x10, 0x0, 0x0, 0x3, 0xdf, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0xc, 0xf4, 0x7f, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0xcf, 0x40, 0xbf, 0xff, 0x0,
-    0x0, 0x0, 0xc, 0xf4, 0xa, 0xff, 0xf1, 0x20,
-    0x0, 0x0, 0xcf, 0x40, 0xef, 0xff, 0x9, 0xfd,
-    0xba, 0x9e, 0xfb, 0xef, 0xff, 0xd0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x4a, 0xde, 0xff,
-    0xff, 0xfd, 0xa4, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x20, 0x0,
-    0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x0, 0x6d, 0xff, 0xb3, 0x0, 0x0, 0x0, 0xcf,
-    0xf6, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x5f, 0xfd, 0x0, 0x0, 0xe, 0xff, 0xbc,
-    0xff, 0x90, 0x0, 0xd, 0xff, 0x50, 0x0, 0x1,
-    0xff, 0x80, 0xd, 0xfd, 0x0, 0x6, 0xff, 0xc0,
-    0x0, 0x0, 0x3f, 0xf5, 0x0, 0xaf, 0xf0, 0x0,
-    0xef, 0xf4, 0x0, 0x0, 0x4, 0xff, 0x50, 0x9,
-    0xff, 0x0, 0x8f, 0xfb, 0x0, 0x0, 0x0, 0x3f,
-    0xf6, 0x0, 0xaf, 0xe0, 0x1f, 0xff, 0x20, 0x0,
-    0x0, 0x1, 0xff, 0xb1, 0x2e, 0xfc, 0x9, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0x72, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xd0, 0xbf, 0xf8, 0x19, 0xef, 0xd8,
-    0x0, 0x0, 0x17, 0xa9, 0x60, 0x3f, 0xfe, 0x1c,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0x74, 0xff, 0xeb, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xd0, 0x8f, 0xf2, 0x4, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0xdf, 0xf5, 0xa, 0xff,
-    0x0, 0x1f, 0xf8, 0x0, 0x0, 0x0, 0x6f, 0xfc,
-    0x0, 0xbf, 0xe0, 0x0, 0xff, 0x90, 0x0, 0x0,
-    0xe, 0xff, 0x40, 0xa, 0xff, 0x0, 0x1f, 0xf8,
-    0x0, 0x0, 0x8, 0xff, 0xb0, 0x0, 0x8f, 0xf2,
-    0x4, 0xff, 0x60, 0x0, 0x1, 0xff, 0xf2, 0x0,
-    0x4, 0xff, 0xeb, 0xef, 0xf2, 0x0, 0x0, 0x9f,
-    0xfa, 0x0, 0x0, 0xd, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x2f, 0xff, 0x10, 0x0, 0x0, 0x19, 0xef,
-    0xe8, 0x0,
-
-    /* U+0026 "&" */
-    0x0, 0x0, 0x3, 0xae, 0xff, 0xc7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xb2, 0x5f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xf3, 0x0, 0xef, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0x50, 0x1f, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xfc, 0x2d, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xf6, 0x0, 0x11, 0x10, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xf4, 0x0, 0x4f, 0xff, 0x60, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xd1, 0x6, 0xff, 0xf4,
-    0x0, 0x7f, 0xff, 0xf6, 0xef, 0xff, 0xb0, 0x9f,
-    0xff, 0x10, 0xe, 0xff, 0xf4, 0x3, 0xff, 0xff,
-    0x9f, 0xff, 0xe0, 0x3, 0xff, 0xfd, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x5f, 0xff, 0xd0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x20, 0x3, 0xff,
-    0xff, 0x30, 0x0, 0xd, 0xff, 0xff, 0x80, 0x0,
-    0xe, 0xff, 0xff, 0x96, 0x8e, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xbf, 0xff, 0xe1, 0x0, 0x0, 0x39, 0xdf,
-    0xfe, 0xb7, 0x20, 0x9f, 0xff, 0xb0,
-
-    /* U+0027 "'" */
-    0x69, 0x99, 0x1a, 0xff, 0xf1, 0x9f, 0xff, 0x8,
-    0xff, 0xe0, 0x6f, 0xfd, 0x5, 0xff, 0xc0, 0x3f,
-    0xfa, 0x2, 0xff, 0x90, 0xf, 0xf7, 0x0,
-
-    /* U+0028 "(" */
-    0x0, 0x0, 0xbc, 0xcc, 0x10, 0x0, 0x7f, 0xff,
-    0xa0, 0x0, 0xe, 0xff, 0xf3, 0x0, 0x6, 0xff,
-    0xfb, 0x0, 0x0, 0xdf, 0xff, 0x50, 0x0, 0x4f,
-    0xff, 0xf0, 0x0, 0x9, 0xff, 0xf9, 0x0, 0x0,
-    0xff, 0xff, 0x40, 0x0, 0x3f, 0xff, 0xf1, 0x0,
-    0x7, 0xff, 0xfd, 0x0, 0x0, 0xaf, 0xff, 0xa0,
-    0x0, 0xc, 0xff, 0xf8, 0x0, 0x0, 0xef, 0xff,
-    0x70, 0x0, 0xf, 0xff, 0xf5, 0x0, 0x0, 0xff,
-    0xff, 0x50, 0x0, 0xf, 0xff, 0xf6, 0x0, 0x0,
-    0xdf, 0xff, 0x80, 0x0, 0xc, 0xff, 0xf9, 0x0,
-    0x0, 0x9f, 0xff, 0xc0, 0x0, 0x6, 0xff, 0xff,
-    0x0, 0x0, 0x1f, 0xff, 0xf3, 0x0, 0x0, 0xcf,
-    0xff, 0x80, 0x0, 0x7, 0xff, 0xfd, 0x0, 0x0,
-    0x1f, 0xff, 0xf3, 0x0, 0x0, 0xaf, 0xff, 0x90,
-    0x0, 0x2, 0xff, 0xff, 0x10, 0x0, 0xa, 0xff,
-    0xf9, 0x0, 0x0, 0x1f, 0xff, 0xf1,
-
-    /* U+0029 ")" */
-    0xa, 0xcc, 0xc2, 0x0, 0x0, 0x7, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0x20, 0x0, 0x0,
-    0x8f, 0xff, 0xa0, 0x0, 0x0, 0x1f, 0xff, 0xf1,
-    0x0, 0x0, 0xc, 0xff, 0xf6, 0x0, 0x0, 0x6,
-    0xff, 0xfc, 0x0, 0x0, 0x1, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0xdf, 0xff, 0x70, 0x0, 0x0, 0x9f,
-    0xff, 0xb0, 0x0, 0x0, 0x6f, 0xff, 0xe0, 0x0,
-    0x0, 0x4f, 0xff, 0xf0, 0x0, 0x0, 0x3f, 0xff,
-    0xf2, 0x0, 0x0, 0x2f, 0xff, 0xf2, 0x0, 0x0,
-    0x1f, 0xff, 0xf3, 0x0, 0x0, 0x3f, 0xff, 0xf2,
-    0x0, 0x0, 0x4f, 0xff, 0xf1, 0x0, 0x0, 0x5f,
-    0xff, 0xf0, 0x0, 0x0, 0x9f, 0xff, 0xc0, 0x0,
-    0x0, 0xcf, 0xff, 0x90, 0x0, 0x0, 0xff, 0xff,
-    0x50, 0x0, 0x4, 0xff, 0xff, 0x0, 0x0, 0xa,
-    0xff, 0xfa, 0x0, 0x0, 0xf, 0xff, 0xf3, 0x0,
-    0x0, 0x6f, 0xff, 0xd0, 0x0, 0x0, 0xdf, 0xff,
-    0x50, 0x0, 0x5, 0xff, 0xfc, 0x0, 0x0, 0xd,
-    0xff, 0xf4, 0x0, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x0, 0x2f, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xf0, 0x0, 0x0, 0x3, 0x81, 0xe,
-    0xfd, 0x1, 0x92, 0x0, 0x8f, 0xf8, 0xdf, 0xc9,
-    0xff, 0x70, 0xd, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0xac, 0xff, 0xff, 0xff, 0xfc, 0x90, 0x0,
-    0x0, 0xcf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xaf,
-    0xfe, 0xff, 0x90, 0x0, 0x0, 0x9f, 0xff, 0x2f,
-    0xff, 0x80, 0x0, 0x6, 0xff, 0x80, 0x9f, 0xf6,
-    0x0, 0x0, 0x3, 0xc0, 0x1, 0xc2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfe, 0x0, 0x0, 0x0,
-    0x2b, 0xbb, 0xbb, 0xef, 0xff, 0xbb, 0xbb, 0xb4,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0xaf, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xfe, 0x0, 0x0, 0x0,
-
-    /* U+002C "," */
-    0x0, 0x7, 0x99, 0x91, 0x0, 0x1f, 0xff, 0xe0,
-    0x0, 0x5f, 0xff, 0x80, 0x0, 0x9f, 0xff, 0x20,
-    0x0, 0xef, 0xfc, 0x0, 0x3, 0xff, 0xf6, 0x0,
-    0x7, 0xff, 0xf1, 0x0, 0xc, 0xff, 0xa0, 0x0,
-    0xf, 0xff, 0x40, 0x0,
-
-    /* U+002D "-" */
-    0x5, 0x55, 0x55, 0x55, 0x52, 0x2f, 0xff, 0xff,
-    0xff, 0xf7, 0x2f, 0xff, 0xff, 0xff, 0xf7, 0x2f,
-    0xff, 0xff, 0xff, 0xf7,
-
-    /* U+002E "." */
-    0x8c, 0xcc, 0xab, 0xff, 0xfe, 0xbf, 0xff, 0xeb,
-    0xff, 0xfe, 0xbf, 0xff, 0xe0,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x9f, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xf7, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x8, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x8f, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf8, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x7f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xf8, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0x90, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0x40, 0x0, 0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x0, 0x7c, 0xef, 0xea, 0x40, 0x0, 0x0,
-    0x2, 0xef, 0xff, 0xff, 0xff, 0x90, 0x0, 0x1,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x8f,
-    0xff, 0xfa, 0x8d, 0xff, 0xff, 0x10, 0xf, 0xff,
-    0xf6, 0x0, 0xd, 0xff, 0xf7, 0x4, 0xff, 0xfe,
-    0x0, 0x0, 0x6f, 0xff, 0xc0, 0x7f, 0xff, 0xa0,
-    0x0, 0x2, 0xff, 0xff, 0xa, 0xff, 0xf7, 0x0,
-    0x0, 0xf, 0xff, 0xf2, 0xbf, 0xff, 0x60, 0x0,
-    0x0, 0xef, 0xff, 0x3b, 0xff, 0xf5, 0x0, 0x0,
-    0xd, 0xff, 0xf4, 0xbf, 0xff, 0x50, 0x0, 0x0,
-    0xdf, 0xff, 0x4b, 0xff, 0xf6, 0x0, 0x0, 0xe,
-    0xff, 0xf3, 0xaf, 0xff, 0x70, 0x0, 0x0, 0xff,
-    0xff, 0x27, 0xff, 0xfa, 0x0, 0x0, 0x2f, 0xff,
-    0xf0, 0x4f, 0xff, 0xe0, 0x0, 0x6, 0xff, 0xfc,
-    0x0, 0xff, 0xff, 0x60, 0x0, 0xdf, 0xff, 0x70,
-    0x8, 0xff, 0xff, 0xa8, 0xdf, 0xff, 0xf1, 0x0,
-    0x1e, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x2e, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x7, 0xce, 0xfe, 0xa4, 0x0, 0x0,
-
-    /* U+0031 "1" */
-    0x0, 0x5, 0xef, 0xff, 0x10, 0x3c, 0xff, 0xff,
-    0xf1, 0x7f, 0xff, 0xff, 0xff, 0x1b, 0xff, 0xff,
-    0xff, 0xf1, 0xbf, 0xfc, 0xff, 0xff, 0x1b, 0xc4,
-    0x1f, 0xff, 0xf1, 0x20, 0x1, 0xff, 0xff, 0x10,
-    0x0, 0x1f, 0xff, 0xf1, 0x0, 0x1, 0xff, 0xff,
-    0x10, 0x0, 0x1f, 0xff, 0xf1, 0x0, 0x1, 0xff,
-    0xff, 0x10, 0x0, 0x1f, 0xff, 0xf1, 0x0, 0x1,
-    0xff, 0xff, 0x10, 0x0, 0x1f, 0xff, 0xf1, 0x0,
-    0x1, 0xff, 0xff, 0x10, 0x0, 0x1f, 0xff, 0xf1,
-    0x0, 0x1, 0xff, 0xff, 0x10, 0x0, 0x1f, 0xff,
-    0xf1, 0x0, 0x1, 0xff, 0xff, 0x10, 0x0, 0x1f,
-    0xff, 0xf1,
-
-    /* U+0032 "2" */
-    0x0, 0x5, 0xad, 0xff, 0xda, 0x40, 0x0, 0x5,
-    0xef, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x1f, 0xff, 0xec,
-    0xce, 0xff, 0xff, 0xf4, 0x1f, 0xb4, 0x0, 0x0,
-    0x7f, 0xff, 0xf9, 0x16, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x1d, 0xff, 0xff, 0xa7, 0x77, 0x77, 0x76, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd,
-
-    /* U+0033 "3" */
-    0x0, 0x28, 0xce, 0xff, 0xda, 0x40, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x7, 0xfd, 0xa8,
-    0x8a, 0xff, 0xff, 0xf0, 0x4, 0x30, 0x0, 0x0,
-    0x3f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x13, 0xbf, 0xff,
-    0xa0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xfc, 0x10,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x4,
-    0x44, 0x69, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xfb, 0x1d, 0x50, 0x0, 0x0, 0x3f, 0xff, 0xf8,
-    0x1f, 0xff, 0xb9, 0x9b, 0xff, 0xff, 0xf2, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x1e, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x59, 0xdf,
-    0xfe, 0xc7, 0x10, 0x0,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xfa, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0x79, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0xaf, 0xfe, 0x9, 0xff, 0xf8, 0x0,
-    0x0, 0x2, 0xff, 0xf7, 0x9, 0xff, 0xf8, 0x0,
-    0x0, 0xb, 0xff, 0xe0, 0x9, 0xff, 0xf8, 0x0,
-    0x0, 0x4f, 0xff, 0x60, 0x9, 0xff, 0xf8, 0x0,
-    0x0, 0xcf, 0xfd, 0x0, 0x9, 0xff, 0xf8, 0x0,
-    0x5, 0xff, 0xf5, 0x0, 0x9, 0xff, 0xf8, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x7, 0x77, 0x77, 0x77, 0x7d, 0xff, 0xfb, 0x73,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf8, 0x0,
-
-    /* U+0035 "5" */
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x4f,
-    0xff, 0xe7, 0x77, 0x77, 0x76, 0x0, 0x5, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfc,
-    0x33, 0x10, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xe8, 0x10, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x30, 0x0, 0x7f, 0xfc, 0xaa, 0xdf,
-    0xff, 0xfe, 0x10, 0x4, 0x50, 0x0, 0x0, 0x5f,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xfe,
-    0x2, 0x82, 0x0, 0x0, 0x3, 0xef, 0xff, 0xb0,
-    0x3f, 0xfd, 0x98, 0x7a, 0xff, 0xff, 0xf4, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x37,
-    0xbd, 0xef, 0xed, 0x82, 0x0, 0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x0, 0x5, 0xbe, 0xff, 0xec, 0x80, 0x0,
-    0x0, 0x3d, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x1e,
-    0xff, 0xff, 0xc9, 0x79, 0xce, 0x0, 0x9, 0xff,
-    0xfc, 0x30, 0x0, 0x0, 0x10, 0x0, 0xff, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x97,
-    0xce, 0xfe, 0xb5, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0xa, 0xff, 0xff, 0xe5, 0x36,
-    0xef, 0xff, 0xb0, 0xbf, 0xff, 0xf2, 0x0, 0x5,
-    0xff, 0xff, 0xa, 0xff, 0xfc, 0x0, 0x0, 0xf,
-    0xff, 0xf2, 0xaf, 0xff, 0xa0, 0x0, 0x0, 0xef,
-    0xff, 0x27, 0xff, 0xfb, 0x0, 0x0, 0xf, 0xff,
-    0xf2, 0x4f, 0xff, 0xe0, 0x0, 0x1, 0xff, 0xff,
-    0x0, 0xff, 0xff, 0x60, 0x0, 0x8f, 0xff, 0xc0,
-    0x9, 0xff, 0xff, 0xb8, 0xbf, 0xff, 0xf6, 0x0,
-    0x1e, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x3e, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x0, 0x0,
-    0x17, 0xce, 0xfe, 0xb6, 0x0, 0x0,
-
-    /* U+0037 "7" */
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3, 0x77,
-    0x77, 0x77, 0x77, 0xef, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0x60, 0x0, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x4, 0xad, 0xff, 0xec, 0x81, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0xff,
-    0xff, 0xd8, 0x7a, 0xff, 0xff, 0x90, 0x3f, 0xff,
-    0xf1, 0x0, 0x7, 0xff, 0xfb, 0x2, 0xff, 0xfd,
-    0x0, 0x0, 0x5f, 0xff, 0x90, 0xd, 0xff, 0xf8,
-    0x10, 0x3d, 0xff, 0xf4, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x3b, 0xff, 0xff,
-    0xff, 0xe7, 0x0, 0x0, 0x5, 0xdf, 0xff, 0xff,
-    0xfe, 0x91, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd2, 0x4, 0xff, 0xff, 0xa3, 0x25, 0xef,
-    0xff, 0xb0, 0x9f, 0xff, 0xa0, 0x0, 0x2, 0xff,
-    0xff, 0x2c, 0xff, 0xf5, 0x0, 0x0, 0xd, 0xff,
-    0xf4, 0xcf, 0xff, 0x60, 0x0, 0x0, 0xef, 0xff,
-    0x5b, 0xff, 0xfd, 0x0, 0x0, 0x5f, 0xff, 0xf3,
-    0x6f, 0xff, 0xfe, 0x98, 0xaf, 0xff, 0xfe, 0x0,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x1,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x5a, 0xdf, 0xfe, 0xc7, 0x10, 0x0,
-
-    /* U+0039 "9" */
-    0x0, 0x2, 0x9d, 0xff, 0xda, 0x40, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0xff,
-    0xff, 0xe8, 0x9d, 0xff, 0xff, 0x10, 0x6f, 0xff,
-    0xe1, 0x0, 0xc, 0xff, 0xf7, 0x9, 0xff, 0xf8,
-    0x0, 0x0, 0x5f, 0xff, 0xc0, 0xbf, 0xff, 0x60,
-    0x0, 0x3, 0xff, 0xff, 0xb, 0xff, 0xf7, 0x0,
-    0x0, 0x3f, 0xff, 0xf1, 0x9f, 0xff, 0xa0, 0x0,
-    0x7, 0xff, 0xff, 0x26, 0xff, 0xff, 0x61, 0x16,
-    0xff, 0xff, 0xf2, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x10, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x4c, 0xff, 0xff, 0xc7, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x22, 0x0, 0x4f, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xf6,
-    0x0, 0x21, 0x0, 0x0, 0x1a, 0xff, 0xff, 0x10,
-    0x6, 0xfa, 0x77, 0xaf, 0xff, 0xff, 0x80, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x3a,
-    0xde, 0xff, 0xc8, 0x20, 0x0, 0x0,
-
-    /* U+003A ":" */
-    0xaf, 0xff, 0xfa, 0xff, 0xff, 0xaf, 0xff, 0xfa,
-    0xff, 0xff, 0x7c, 0xcc, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xcc, 0xcb, 0xaf, 0xff,
-    0xfa, 0xff, 0xff, 0xaf, 0xff, 0xfa, 0xff, 0xff,
-
-    /* U+003B ";" */
-    0x0, 0x9f, 0xff, 0xf0, 0x9, 0xff, 0xff, 0x0,
-    0x9f, 0xff, 0xf0, 0x9, 0xff, 0xff, 0x0, 0x7c,
-    0xcc, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xfb, 0x0, 0x9f, 0xff, 0x50, 0xd, 0xff,
-    0xe0, 0x2, 0xff, 0xf9, 0x0, 0x7f, 0xff, 0x30,
-    0xb, 0xff, 0xd0, 0x0, 0xff, 0xf7, 0x0, 0x4f,
-    0xff, 0x10, 0x4, 0x99, 0x60, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x85,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xaf, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xdf, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x29, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x5b, 0xff, 0xff, 0xff, 0xf9, 0x30,
-    0x1, 0x7e, 0xff, 0xff, 0xff, 0xc6, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0x93, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xfc, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xfe, 0x71, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xff, 0xff, 0xff, 0xb4, 0x0, 0x0, 0x0,
-    0x0, 0x6d, 0xff, 0xff, 0xff, 0xe7, 0x10, 0x0,
-    0x0, 0x0, 0x3a, 0xff, 0xff, 0xff, 0xfa, 0x40,
-    0x0, 0x0, 0x0, 0x17, 0xef, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xcf, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x9f, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x64,
-
-    /* U+003D "=" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x2e, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe5,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-
-    /* U+003E ">" */
-    0x29, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfc, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xfe, 0x81, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xa4, 0x0, 0x0, 0x0,
-    0x1, 0x8e, 0xff, 0xff, 0xff, 0xd6, 0x0, 0x0,
-    0x0, 0x0, 0x5b, 0xff, 0xff, 0xff, 0xf9, 0x20,
-    0x0, 0x0, 0x0, 0x28, 0xef, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xbf, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xdf, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x39, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x6c, 0xff, 0xff, 0xff, 0xe7, 0x10,
-    0x3, 0x9f, 0xff, 0xff, 0xff, 0xb5, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0x92, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xfd, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xfa, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x28, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+003F "?" */
-    0x8c, 0xef, 0xfe, 0xda, 0x50, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x5e, 0xca, 0x9a, 0xdf, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xb0, 0x0, 0x0, 0x9, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xa0, 0x0,
-    0x0, 0x3f, 0xff, 0xf6, 0x0, 0x0, 0x4f, 0xff,
-    0xfd, 0x0, 0x0, 0x3f, 0xff, 0xfd, 0x10, 0x0,
-    0xd, 0xff, 0xfa, 0x0, 0x0, 0x1, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0x40, 0x0, 0x0,
-    0x1, 0x77, 0x71, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xbb, 0xb8, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xd0, 0x0, 0x0, 0xb, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xd0, 0x0,
-    0x0, 0xb, 0xff, 0xfd, 0x0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x0, 0x27, 0xbe, 0xff, 0xec,
-    0x83, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xfe, 0x96, 0x44, 0x68, 0xdf, 0xff, 0xf4, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xfd, 0x0, 0x0, 0x2f, 0xff, 0xf3,
-    0x0, 0x0, 0x10, 0x0, 0x0, 0x3f, 0xff, 0x50,
-    0x0, 0xaf, 0xff, 0x40, 0x2, 0xbf, 0xfd, 0x3c,
-    0xdb, 0xa, 0xff, 0xa0, 0x1, 0xff, 0xfa, 0x0,
-    0x4f, 0xff, 0xff, 0xef, 0xfb, 0x4, 0xff, 0xe0,
-    0x6, 0xff, 0xf2, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x1, 0xff, 0xf0, 0xa, 0xff, 0xd0, 0x9,
-    0xff, 0xf5, 0x8, 0xff, 0xf5, 0x0, 0xff, 0xf0,
-    0xd, 0xff, 0x90, 0xe, 0xff, 0x90, 0x2, 0xff,
-    0xf2, 0x0, 0xff, 0xf0, 0xf, 0xff, 0x70, 0x3f,
-    0xff, 0x30, 0x3, 0xff, 0xf0, 0x2, 0xff, 0xe0,
-    0xf, 0xff, 0x60, 0x4f, 0xff, 0x0, 0x7, 0xff,
-    0xc0, 0x4, 0xff, 0xa0, 0xf, 0xff, 0x70, 0x5f,
-    0xff, 0x10, 0xd, 0xff, 0xb0, 0x9, 0xff, 0x60,
-    0xe, 0xff, 0x90, 0x3f, 0xff, 0xb6, 0xcf, 0xff,
-    0xe2, 0x3f, 0xff, 0x0, 0xb, 0xff, 0xd0, 0xe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x7, 0xff, 0xf3, 0x4, 0xff, 0xff, 0xfb, 0x3e,
-    0xff, 0xff, 0x90, 0x0, 0x2, 0xff, 0xfc, 0x0,
-    0x39, 0xba, 0x60, 0x2, 0x8b, 0xa5, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff,
-    0xa5, 0x21, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xdf, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x17, 0xcf, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x12, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xef, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xfd, 0x9f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xf9, 0x5f, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf5, 0x1f,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xf1, 0xc, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xc0, 0x8, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0x80, 0x4, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x6, 0xff, 0xff, 0x40, 0x0,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0x0, 0x0, 0xcf, 0xff, 0xf0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0xdf, 0xff, 0xf7,
-    0x77, 0x77, 0x7d, 0xff, 0xff, 0x10, 0x1, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x7, 0xff, 0xff, 0x60,
-    0x6, 0xff, 0xff, 0x70, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xb0, 0xa, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf0, 0xf, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xf4, 0x4f, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf8,
-
-    /* U+0042 "B" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x81, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd0, 0x5, 0xff, 0xff, 0x40, 0x1, 0x5e, 0xff,
-    0xff, 0x40, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x6f,
-    0xff, 0xf7, 0x5, 0xff, 0xff, 0x40, 0x0, 0x2,
-    0xff, 0xff, 0x70, 0x5f, 0xff, 0xf4, 0x0, 0x0,
-    0x4f, 0xff, 0xf3, 0x5, 0xff, 0xff, 0x40, 0x0,
-    0x1d, 0xff, 0xfa, 0x0, 0x5f, 0xff, 0xfd, 0xcc,
-    0xdf, 0xff, 0xfa, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x91, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe2, 0x5, 0xff, 0xff,
-    0x40, 0x0, 0x26, 0xef, 0xff, 0xd0, 0x5f, 0xff,
-    0xf4, 0x0, 0x0, 0x3, 0xff, 0xff, 0x65, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0xf, 0xff, 0xfa, 0x5f,
-    0xff, 0xf4, 0x0, 0x0, 0x1, 0xff, 0xff, 0xb5,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0xaf, 0xff, 0xf9,
-    0x5f, 0xff, 0xfa, 0x88, 0x88, 0xdf, 0xff, 0xff,
-    0x45, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc1, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb,
-    0x50, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x0, 0x38, 0xce, 0xff, 0xec, 0x95,
-    0x0, 0x0, 0x4, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x9, 0xff, 0xff, 0xff, 0xeb, 0xab,
-    0xdf, 0xfc, 0x5, 0xff, 0xff, 0xfc, 0x30, 0x0,
-    0x0, 0x4, 0x60, 0xdf, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x59,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xcb, 0xbd, 0xff,
-    0xc0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x5d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x4, 0x8c, 0xef, 0xff,
-    0xdb, 0x61,
-
-    /* U+0044 "D" */
-    0x5f, 0xff, 0xff, 0xff, 0xfe, 0xc8, 0x20, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x10, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd1, 0x0, 0x5f, 0xff, 0xfb, 0x99, 0xad,
-    0xff, 0xff, 0xfc, 0x0, 0x5f, 0xff, 0xf4, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0x50, 0x5f, 0xff, 0xf4,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xc0, 0x5f, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf1, 0x5f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf5,
-    0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xf7, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xf8, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf8, 0x5f, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xf7, 0x5f, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xf5, 0x5f, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xf2, 0x5f, 0xff,
-    0xf4, 0x0, 0x0, 0x8, 0xff, 0xff, 0xd0, 0x5f,
-    0xff, 0xf4, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x70,
-    0x5f, 0xff, 0xfb, 0x99, 0xae, 0xff, 0xff, 0xfd,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe2, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x10, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xfe,
-    0xc8, 0x30, 0x0, 0x0,
-
-    /* U+0045 "E" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x75,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x75, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x5f, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x5, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x5, 0xff, 0xff, 0xcb, 0xbb, 0xbb,
-    0xbb, 0x20, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x65,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x75, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-
-    /* U+0046 "F" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x5f, 0xff, 0xfe,
-    0xee, 0xee, 0xee, 0xe9, 0x5f, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x5f, 0xff, 0xfc,
-    0xaa, 0xaa, 0xaa, 0x50, 0x5f, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0x0, 0x38, 0xce, 0xff, 0xec, 0x95,
-    0x0, 0x0, 0x0, 0x2b, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x6f, 0xff, 0xff, 0xfd,
-    0xa9, 0xab, 0xef, 0xc0, 0x2, 0xff, 0xff, 0xf9,
-    0x20, 0x0, 0x0, 0x1, 0x30, 0xc, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xe0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xf5, 0xdf, 0xff, 0xc0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xf5, 0xdf, 0xff, 0xc0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xf5, 0xcf, 0xff, 0xe0, 0x0, 0x0,
-    0x7, 0xad, 0xff, 0xf5, 0xaf, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xf5, 0x5f, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xf5, 0xe, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x9, 0xff, 0xf5, 0x6,
-    0xff, 0xff, 0xfc, 0x40, 0x0, 0x9, 0xff, 0xf5,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xdc, 0xdf, 0xff,
-    0xf5, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x5d, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x48, 0xce,
-    0xff, 0xfd, 0xb7, 0x10,
-
-    /* U+0048 "H" */
-    0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xf7, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xf7, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xf7, 0x5f, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf7, 0x5f, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xf7, 0x5f, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xf7, 0x5f, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf7, 0x5f,
-    0xff, 0xfe, 0xee, 0xee, 0xee, 0xef, 0xff, 0xf7,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x5f, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf7, 0x5f, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xf7, 0x5f, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xf7, 0x5f, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf7, 0x5f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf7,
-    0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xf7, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xf7, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xf7, 0x5f, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf7,
-
-    /* U+0049 "I" */
-    0x3f, 0xff, 0xf6, 0x3f, 0xff, 0xf6, 0x3f, 0xff,
-    0xf6, 0x3f, 0xff, 0xf6, 0x3f, 0xff, 0xf6, 0x3f,
-    0xff, 0xf6, 0x3f, 0xff, 0xf6, 0x3f, 0xff, 0xf6,
-    0x3f, 0xff, 0xf6, 0x3f, 0xff, 0xf6, 0x3f, 0xff,
-    0xf6, 0x3f, 0xff, 0xf6, 0x3f, 0xff, 0xf6, 0x3f,
-    0xff, 0xf6, 0x3f, 0xff, 0xf6, 0x3f, 0xff, 0xf6,
-    0x3f, 0xff, 0xf6, 0x3f, 0xff, 0xf6, 0x3f, 0xff,
-    0xf6, 0x3f, 0xff, 0xf6,
-
-    /* U+004A "J" */
-    0x0, 0x1, 0xff, 0xff, 0x90, 0x0, 0x1f, 0xff,
-    0xf9, 0x0, 0x1, 0xff, 0xff, 0x90, 0x0, 0x1f,
-    0xff, 0xf9, 0x0, 0x1, 0xff, 0xff, 0x90, 0x0,
-    0x1f, 0xff, 0xf9, 0x0, 0x1, 0xff, 0xff, 0x90,
-    0x0, 0x1f, 0xff, 0xf9, 0x0, 0x1, 0xff, 0xff,
-    0x90, 0x0, 0x1f, 0xff, 0xf9, 0x0, 0x1, 0xff,
-    0xff, 0x90, 0x0, 0x1f, 0xff, 0xf9, 0x0, 0x1,
-    0xff, 0xff, 0x90, 0x0, 0x1f, 0xff, 0xf9, 0x0,
-    0x1, 0xff, 0xff, 0x90, 0x0, 0x1f, 0xff, 0xf9,
-    0x0, 0x1, 0xff, 0xff, 0x80, 0x0, 0x2f, 0xff,
-    0xf8, 0x0, 0x6, 0xff, 0xff, 0x60, 0x4, 0xef,
-    0xff, 0xf3, 0x9f, 0xff, 0xff, 0xfd, 0x9, 0xff,
-    0xff, 0xff, 0x40, 0x9f, 0xff, 0xff, 0x50, 0x9,
-    0xff, 0xe9, 0x20, 0x0, 0x23, 0x10, 0x0, 0x0,
-    0x0,
-
-    /* U+004B "K" */
-    0x5f, 0xff, 0xf4, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0x70, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x3f, 0xff,
-    0xfc, 0x0, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0xdf,
-    0xff, 0xf2, 0x0, 0x5f, 0xff, 0xf4, 0x0, 0x9,
-    0xff, 0xff, 0x60, 0x0, 0x5f, 0xff, 0xf4, 0x0,
-    0x4f, 0xff, 0xfb, 0x0, 0x0, 0x5f, 0xff, 0xf4,
-    0x1, 0xef, 0xff, 0xe1, 0x0, 0x0, 0x5f, 0xff,
-    0xf4, 0xa, 0xff, 0xff, 0x50, 0x0, 0x0, 0x5f,
-    0xff, 0xf4, 0x5f, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xd1,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xfe, 0xef, 0xff,
-    0xfc, 0x10, 0x0, 0x0, 0x5f, 0xff, 0xf4, 0x7,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x5f, 0xff, 0xf4,
-    0x0, 0x7f, 0xff, 0xf8, 0x0, 0x0, 0x5f, 0xff,
-    0xf4, 0x0, 0xa, 0xff, 0xff, 0x50, 0x0, 0x5f,
-    0xff, 0xf4, 0x0, 0x0, 0xdf, 0xff, 0xe1, 0x0,
-    0x5f, 0xff, 0xf4, 0x0, 0x0, 0x2f, 0xff, 0xfb,
-    0x0, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0x50, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xe0, 0x5f, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xf8,
-
-    /* U+004C "L" */
-    0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xfe, 0xee, 0xee, 0xee, 0xe3, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3,
-
-    /* U+004D "M" */
-    0x5f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0x35, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xf3, 0x5f,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0x35, 0xff, 0xff, 0xdf, 0xff, 0x50,
-    0x0, 0x8f, 0xff, 0xef, 0xff, 0xf3, 0x5f, 0xff,
-    0xf8, 0xff, 0xf8, 0x0, 0xb, 0xff, 0xf9, 0xff,
-    0xff, 0x35, 0xff, 0xff, 0x5f, 0xff, 0xb0, 0x0,
-    0xef, 0xff, 0x6f, 0xff, 0xf3, 0x5f, 0xff, 0xf2,
-    0xff, 0xfe, 0x0, 0x1f, 0xff, 0xe4, 0xff, 0xff,
-    0x35, 0xff, 0xff, 0x2d, 0xff, 0xf1, 0x4, 0xff,
-    0xfb, 0x4f, 0xff, 0xf3, 0x5f, 0xff, 0xf2, 0x9f,
-    0xff, 0x40, 0x7f, 0xff, 0x84, 0xff, 0xff, 0x35,
-    0xff, 0xff, 0x26, 0xff, 0xf7, 0x9, 0xff, 0xf4,
-    0x4f, 0xff, 0xf3, 0x5f, 0xff, 0xf2, 0x3f, 0xff,
-    0xa0, 0xcf, 0xff, 0x14, 0xff, 0xff, 0x35, 0xff,
-    0xff, 0x20, 0xff, 0xfd, 0xf, 0xff, 0xe0, 0x4f,
-    0xff, 0xf3, 0x5f, 0xff, 0xf2, 0xc, 0xff, 0xf3,
-    0xff, 0xfa, 0x4, 0xff, 0xff, 0x35, 0xff, 0xff,
-    0x20, 0x9f, 0xff, 0x9f, 0xff, 0x70, 0x4f, 0xff,
-    0xf3, 0x5f, 0xff, 0xf2, 0x6, 0xff, 0xfe, 0xff,
-    0xf4, 0x4, 0xff, 0xff, 0x35, 0xff, 0xff, 0x20,
-    0x3f, 0xff, 0xff, 0xff, 0x10, 0x4f, 0xff, 0xf3,
-    0x5f, 0xff, 0xf2, 0x0, 0xff, 0xff, 0xff, 0xd0,
-    0x4, 0xff, 0xff, 0x35, 0xff, 0xff, 0x20, 0xc,
-    0xff, 0xff, 0xfa, 0x0, 0x4f, 0xff, 0xf3, 0x5f,
-    0xff, 0xf2, 0x0, 0x9f, 0xff, 0xff, 0x70, 0x4,
-    0xff, 0xff, 0x35, 0xff, 0xff, 0x20, 0x6, 0xff,
-    0xff, 0xf3, 0x0, 0x4f, 0xff, 0xf3,
-
-    /* U+004E "N" */
-    0x5f, 0xff, 0xff, 0xff, 0x30, 0x0, 0xe, 0xff,
-    0xfa, 0x5f, 0xff, 0xff, 0xff, 0x70, 0x0, 0xe,
-    0xff, 0xfa, 0x5f, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0xe, 0xff, 0xfa, 0x5f, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0xe, 0xff, 0xfa, 0x5f, 0xff, 0xfd, 0xff,
-    0xf6, 0x0, 0xe, 0xff, 0xfa, 0x5f, 0xff, 0xf8,
-    0xff, 0xfa, 0x0, 0xe, 0xff, 0xfa, 0x5f, 0xff,
-    0xf4, 0xff, 0xff, 0x0, 0xe, 0xff, 0xfa, 0x5f,
-    0xff, 0xf3, 0xaf, 0xff, 0x40, 0xe, 0xff, 0xfa,
-    0x5f, 0xff, 0xf3, 0x6f, 0xff, 0x90, 0xe, 0xff,
-    0xfa, 0x5f, 0xff, 0xf3, 0x1f, 0xff, 0xd0, 0xe,
-    0xff, 0xfa, 0x5f, 0xff, 0xf3, 0xc, 0xff, 0xf2,
-    0xe, 0xff, 0xfa, 0x5f, 0xff, 0xf3, 0x7, 0xff,
-    0xf7, 0xe, 0xff, 0xfa, 0x5f, 0xff, 0xf3, 0x2,
-    0xff, 0xfc, 0xe, 0xff, 0xfa, 0x5f, 0xff, 0xf3,
-    0x0, 0xdf, 0xff, 0x1e, 0xff, 0xfa, 0x5f, 0xff,
-    0xf3, 0x0, 0x9f, 0xff, 0x5e, 0xff, 0xfa, 0x5f,
-    0xff, 0xf3, 0x0, 0x4f, 0xff, 0xbf, 0xff, 0xfa,
-    0x5f, 0xff, 0xf3, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xfa, 0x5f, 0xff, 0xf3, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xfa, 0x5f, 0xff, 0xf3, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xfa, 0x5f, 0xff, 0xf3, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xfa,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x1, 0x7b, 0xef, 0xfe, 0xc8, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x1d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xfe, 0xaa, 0xdf, 0xff, 0xff,
-    0xe1, 0x0, 0x7, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x4e, 0xff, 0xff, 0xb0, 0x0, 0xef, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x20, 0x5f,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf8, 0x9, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xc0, 0xcf, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xd, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xf0, 0xdf, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xc, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xf0, 0xaf, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfd,
-    0x7, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xa0, 0x1f, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0xf5, 0x0, 0xaf, 0xff,
-    0xfe, 0x30, 0x0, 0x2, 0xcf, 0xff, 0xfd, 0x0,
-    0x1, 0xef, 0xff, 0xff, 0xc9, 0x9b, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x1, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x28, 0xce, 0xff, 0xec, 0x94, 0x0,
-    0x0, 0x0,
-
-    /* U+0050 "P" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xa4, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x5, 0xff, 0xff, 0xdd, 0xdd, 0xdf, 0xff,
-    0xff, 0xf2, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0x75, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0xa, 0xff, 0xfa, 0x5f, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xa5, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0xb, 0xff, 0xf9, 0x5f, 0xff, 0xf4, 0x0,
-    0x0, 0x29, 0xff, 0xff, 0x65, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x5f, 0xff,
-    0xfe, 0xdd, 0xdd, 0xcb, 0x71, 0x0, 0x5, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x0, 0x6a, 0xdf, 0xfe, 0xc8, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xa1, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xfd, 0x98, 0xbf, 0xff, 0xff,
-    0xf2, 0x0, 0x6, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x2b, 0xff, 0xff, 0xc0, 0x0, 0xef, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0x50, 0x5f,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xfb, 0x9, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xf0, 0xcf, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0x3d, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xf4, 0xdf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0x4c, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xf3, 0xaf, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0x16, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xd0, 0x1f, 0xff, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xf7, 0x0, 0x8f, 0xff,
-    0xfe, 0x40, 0x0, 0x1, 0xaf, 0xff, 0xfe, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xda, 0xac, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x17, 0xbe, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xf3, 0x0, 0x0,
-
-    /* U+0052 "R" */
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x81, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x5, 0xff, 0xff, 0x85, 0x55, 0x58, 0xff,
-    0xff, 0xb0, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0x5, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0xb, 0xff, 0xf2, 0x5f, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0x25, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x2f, 0xff, 0xf0, 0x5f, 0xff, 0xf8, 0x55,
-    0x55, 0x8e, 0xff, 0xfb, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x50, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe8, 0x20, 0x0, 0x5f, 0xff,
-    0xf4, 0xc, 0xff, 0xff, 0x30, 0x0, 0x5, 0xff,
-    0xff, 0x40, 0x1d, 0xff, 0xfe, 0x10, 0x0, 0x5f,
-    0xff, 0xf4, 0x0, 0x2f, 0xff, 0xfc, 0x0, 0x5,
-    0xff, 0xff, 0x40, 0x0, 0x6f, 0xff, 0xf7, 0x0,
-    0x5f, 0xff, 0xf4, 0x0, 0x0, 0xcf, 0xff, 0xf1,
-    0x5, 0xff, 0xff, 0x40, 0x0, 0x3, 0xff, 0xff,
-    0xa0, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0x25, 0xff, 0xff, 0x40, 0x0, 0x0, 0x2f,
-    0xff, 0xfa,
-
-    /* U+0053 "S" */
-    0x0, 0x6, 0xbe, 0xff, 0xed, 0xa6, 0x10, 0x0,
-    0x2d, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x6, 0xff,
-    0xff, 0xfb, 0x9a, 0xcf, 0xfa, 0x0, 0xaf, 0xff,
-    0xe1, 0x0, 0x0, 0x3, 0x50, 0xb, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xe2,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf7,
-    0x10, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xb5, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xfe, 0x60, 0x0, 0x0, 0x1, 0x7d, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x3, 0xaf, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xe0, 0x81, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xf, 0xfa, 0x40, 0x0, 0x2, 0xef, 0xff, 0xd0,
-    0xff, 0xff, 0xfd, 0xbc, 0xff, 0xff, 0xf8, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x10, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x30, 0x0, 0x5,
-    0xad, 0xef, 0xfe, 0xc7, 0x0, 0x0,
-
-    /* U+0054 "T" */
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x7e, 0xee, 0xef, 0xff, 0xff, 0xee, 0xee, 0xe2,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0,
-
-    /* U+0055 "U" */
-    0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xfe, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xfe, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xfe, 0x5f, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xfe, 0x5f, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xfe, 0x5f, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xfe, 0x5f, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfe, 0x5f,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfe,
-    0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xfe, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xfe, 0x5f, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xfe, 0x5f, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xfe, 0x4f, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xfd, 0x2f, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xfc, 0xf, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0xaf, 0xff, 0xf8, 0xa,
-    0xff, 0xff, 0xf8, 0x32, 0x4b, 0xff, 0xff, 0xf3,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x3, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x5, 0xad, 0xff,
-    0xec, 0x82, 0x0, 0x0,
-
-    /* U+0056 "V" */
-    0x9f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xfa, 0x4f, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xf5, 0xf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xf1, 0xa, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x2, 0xff, 0xff, 0xc0,
-    0x5, 0xff, 0xff, 0x80, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0x70, 0x1, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0x20, 0x0, 0xcf, 0xff, 0xf1,
-    0x0, 0x0, 0xf, 0xff, 0xfd, 0x0, 0x0, 0x7f,
-    0xff, 0xf6, 0x0, 0x0, 0x4f, 0xff, 0xf8, 0x0,
-    0x0, 0x2f, 0xff, 0xfa, 0x0, 0x0, 0x9f, 0xff,
-    0xf4, 0x0, 0x0, 0xd, 0xff, 0xfe, 0x0, 0x0,
-    0xdf, 0xff, 0xe0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0x30, 0x2, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0x80, 0x6, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xc0, 0xa, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf1, 0xf,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xf5, 0x3f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xfa, 0x8f, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xfe, 0xdf, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-
-    /* U+0057 "W" */
-    0x7f, 0xff, 0xf5, 0x0, 0x0, 0x2f, 0xff, 0xf4,
-    0x0, 0x0, 0x3f, 0xff, 0xf9, 0x3f, 0xff, 0xf8,
-    0x0, 0x0, 0x5f, 0xff, 0xf7, 0x0, 0x0, 0x6f,
-    0xff, 0xf5, 0xf, 0xff, 0xfb, 0x0, 0x0, 0x8f,
-    0xff, 0xfa, 0x0, 0x0, 0x9f, 0xff, 0xf1, 0xb,
-    0xff, 0xfe, 0x0, 0x0, 0xbf, 0xff, 0xfd, 0x0,
-    0x0, 0xcf, 0xff, 0xd0, 0x8, 0xff, 0xff, 0x10,
-    0x0, 0xef, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-    0xa0, 0x4, 0xff, 0xff, 0x40, 0x1, 0xff, 0xff,
-    0xff, 0x30, 0x2, 0xff, 0xff, 0x60, 0x0, 0xff,
-    0xff, 0x70, 0x4, 0xff, 0xff, 0xff, 0x60, 0x5,
-    0xff, 0xff, 0x20, 0x0, 0xcf, 0xff, 0x90, 0x7,
-    0xff, 0xec, 0xff, 0x80, 0x8, 0xff, 0xfe, 0x0,
-    0x0, 0x8f, 0xff, 0xc0, 0xa, 0xff, 0xb9, 0xff,
-    0xb0, 0xb, 0xff, 0xfa, 0x0, 0x0, 0x5f, 0xff,
-    0xf0, 0xd, 0xff, 0x97, 0xff, 0xe0, 0xd, 0xff,
-    0xf7, 0x0, 0x0, 0x1f, 0xff, 0xf2, 0xf, 0xff,
-    0x64, 0xff, 0xf1, 0xf, 0xff, 0xf3, 0x0, 0x0,
-    0xd, 0xff, 0xf5, 0x3f, 0xff, 0x31, 0xff, 0xf4,
-    0x3f, 0xff, 0xf0, 0x0, 0x0, 0x9, 0xff, 0xf8,
-    0x6f, 0xff, 0x10, 0xff, 0xf7, 0x6f, 0xff, 0xb0,
-    0x0, 0x0, 0x5, 0xff, 0xfb, 0x9f, 0xfe, 0x0,
-    0xcf, 0xfa, 0x9f, 0xff, 0x70, 0x0, 0x0, 0x1,
-    0xff, 0xfe, 0xcf, 0xfb, 0x0, 0x9f, 0xfd, 0xcf,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xf9, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xf6, 0x0, 0x4f,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xf3, 0x0, 0x1f, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf1,
-    0x0, 0xf, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xe0, 0x0, 0xc, 0xff,
-    0xff, 0xf1, 0x0, 0x0,
-
-    /* U+0058 "X" */
-    0x3f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xfa, 0x0, 0x8f, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xfe, 0x10, 0x0, 0xdf, 0xff,
-    0xf6, 0x0, 0x0, 0x1e, 0xff, 0xff, 0x40, 0x0,
-    0x2, 0xff, 0xff, 0xf2, 0x0, 0xa, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x7, 0xff, 0xff, 0xc0, 0x5,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0x71, 0xef, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xcf, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xff, 0xfd, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf8,
-    0x2f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xfd, 0x0, 0x6f, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x1e, 0xff, 0xff, 0x30, 0x0, 0xcf, 0xff,
-    0xf7, 0x0, 0x0, 0xb, 0xff, 0xff, 0x80, 0x0,
-    0x2, 0xff, 0xff, 0xf3, 0x0, 0x6, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xd0, 0x2,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0x80,
-
-    /* U+0059 "Y" */
-    0x7f, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xf9, 0xe, 0xff, 0xff, 0x10, 0x0, 0x0, 0xef,
-    0xff, 0xf1, 0x5, 0xff, 0xff, 0x90, 0x0, 0x6,
-    0xff, 0xff, 0x70, 0x0, 0xcf, 0xff, 0xf1, 0x0,
-    0xe, 0xff, 0xfe, 0x0, 0x0, 0x4f, 0xff, 0xf8,
-    0x0, 0x6f, 0xff, 0xf6, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0x10, 0xdf, 0xff, 0xd0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0x75, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xed, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xf6, 0x0, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf2, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf2, 0x8, 0xee, 0xee, 0xee, 0xee,
-    0xef, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xd1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xfe, 0xee, 0xee, 0xee, 0xee,
-    0xe6, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6,
-
-    /* U+005B "[" */
-    0xf, 0xff, 0xff, 0xfa, 0xf, 0xff, 0xff, 0xfa,
-    0xf, 0xff, 0xff, 0xfa, 0xf, 0xff, 0xff, 0xfa,
-    0xf, 0xff, 0xf3, 0x32, 0xf, 0xff, 0xf0, 0x0,
-    0xf, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xf0, 0x0,
-    0xf, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xf0, 0x0,
-    0xf, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xf0, 0x0,
-    0xf, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xf0, 0x0,
-    0xf, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xf0, 0x0,
-    0xf, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xf0, 0x0,
-    0xf, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xf0, 0x0,
-    0xf, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xf0, 0x0,
-    0xf, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xf3, 0x32,
-    0xf, 0xff, 0xff, 0xfa, 0xf, 0xff, 0xff, 0xfa,
-    0xf, 0xff, 0xff, 0xfa, 0xf, 0xff, 0xff, 0xfa,
-
-    /* U+005C "\\" */
-    0x6f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf9,
-
-    /* U+005D "]" */
-    0x6f, 0xff, 0xff, 0xf5, 0x6f, 0xff, 0xff, 0xf5,
-    0x6f, 0xff, 0xff, 0xf5, 0x6f, 0xff, 0xff, 0xf5,
-    0x13, 0x3d, 0xff, 0xf5, 0x0, 0xc, 0xff, 0xf5,
-    0x0, 0xc, 0xff, 0xf5, 0x0, 0xc, 0xff, 0xf5,
-    0x0, 0xc, 0xff, 0xf5, 0x0, 0xc, 0xff, 0xf5,
-    0x0, 0xc, 0xff, 0xf5, 0x0, 0xc, 0xff, 0xf5,
-    0x0, 0xc, 0xff, 0xf5, 0x0, 0xc, 0xff, 0xf5,
-    0x0, 0xc, 0xff, 0xf5, 0x0, 0xc, 0xff, 0xf5,
-    0x0, 0xc, 0xff, 0xf5, 0x0, 0xc, 0xff, 0xf5,
-    0x0, 0xc, 0xff, 0xf5, 0x0, 0xc, 0xff, 0xf5,
-    0x0, 0xc, 0xff, 0xf5, 0x0, 0xc, 0xff, 0xf5,
-    0x0, 0xc, 0xff, 0xf5, 0x13, 0x3d, 0xff, 0xf5,
-    0x6f, 0xff, 0xff, 0xf5, 0x6f, 0xff, 0xff, 0xf5,
-    0x6f, 0xff, 0xff, 0xf5, 0x6f, 0xff, 0xff, 0xf5,
-
-    /* U+005E "^" */
-    0x0, 0x0, 0x4f, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x6, 0xff,
-    0xfd, 0xff, 0xa0, 0x0, 0x0, 0xd, 0xff, 0xa6,
-    0xff, 0xf1, 0x0, 0x0, 0x3f, 0xff, 0x41, 0xff,
-    0xf6, 0x0, 0x0, 0x9f, 0xfe, 0x0, 0xbf, 0xfd,
-    0x0, 0x0, 0xff, 0xf8, 0x0, 0x5f, 0xff, 0x30,
-    0x5, 0xff, 0xf3, 0x0, 0xe, 0xff, 0x90, 0xc,
-    0xff, 0xd0, 0x0, 0x9, 0xff, 0xf0, 0x2f, 0xff,
-    0x70, 0x0, 0x3, 0xff, 0xf6,
-
-    /* U+005F "_" */
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff,
-
-    /* U+0060 "`" */
-    0x1, 0x11, 0x10, 0x0, 0xa, 0xff, 0xf7, 0x0,
-    0x0, 0xaf, 0xff, 0x20, 0x0, 0xa, 0xff, 0xb0,
-    0x0, 0x0, 0x9f, 0xf5,
-
-    /* U+0061 "a" */
-    0x0, 0x0, 0x3a, 0xef, 0xeb, 0x58, 0xff, 0xff,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x1f, 0xff, 0xff, 0xb6, 0x7c, 0xff,
-    0xff, 0xf0, 0x8, 0xff, 0xff, 0x70, 0x0, 0x8,
-    0xff, 0xff, 0x0, 0xdf, 0xff, 0xc0, 0x0, 0x0,
-    0x3f, 0xff, 0xf0, 0xf, 0xff, 0xf5, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0x1, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x3f, 0xff, 0xf0, 0x1f, 0xff, 0xf2, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x0, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x3f, 0xff, 0xf0, 0xd, 0xff, 0xfb,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0x0, 0x8f, 0xff,
-    0xf7, 0x0, 0x0, 0x8f, 0xff, 0xf0, 0x2, 0xff,
-    0xff, 0xfb, 0x66, 0xbf, 0xff, 0xff, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x3, 0x9d, 0xff, 0xd8, 0x1d, 0xff, 0xf5,
-
-    /* U+0062 "b" */
-    0x9, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xfe, 0x18, 0xdf,
-    0xeb, 0x50, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x9f, 0xff, 0xfd,
-    0x75, 0x8f, 0xff, 0xff, 0x60, 0x9, 0xff, 0xfd,
-    0x0, 0x0, 0x2e, 0xff, 0xfd, 0x0, 0x9f, 0xff,
-    0x60, 0x0, 0x0, 0x6f, 0xff, 0xf2, 0x9, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0xff, 0xff, 0x50, 0x9f,
-    0xff, 0x60, 0x0, 0x0, 0xd, 0xff, 0xf6, 0x9,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0xdf, 0xff, 0x70,
-    0x9f, 0xff, 0x60, 0x0, 0x0, 0xf, 0xff, 0xf5,
-    0x9, 0xff, 0xf6, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0x20, 0x9f, 0xff, 0xc0, 0x0, 0x2, 0xef, 0xff,
-    0xd0, 0x9, 0xff, 0xff, 0xd7, 0x58, 0xff, 0xff,
-    0xf6, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x10, 0x0, 0xff, 0xff, 0x36, 0xbe, 0xfe,
-    0xb5, 0x0, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x0, 0x3, 0x8c, 0xef, 0xec, 0x83, 0x0,
-    0x1, 0xaf, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x1e,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xcf, 0xff,
-    0xff, 0xda, 0xab, 0xec, 0x6, 0xff, 0xff, 0xc2,
-    0x0, 0x0, 0x2, 0xc, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xfe, 0x20, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xe6, 0x0, 0x0, 0x7, 0x0, 0xbf, 0xff, 0xff,
-    0xfc, 0xbc, 0xff, 0x0, 0x1d, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x2, 0x7c, 0xef, 0xec, 0x94,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xf0, 0x0, 0x0, 0x3a, 0xef, 0xea,
-    0x38, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xef, 0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x1f, 0xff, 0xff,
-    0xb6, 0x6b, 0xff, 0xff, 0xf0, 0x8, 0xff, 0xff,
-    0x70, 0x0, 0x8, 0xff, 0xff, 0x0, 0xdf, 0xff,
-    0xb0, 0x0, 0x0, 0xf, 0xff, 0xf0, 0xf, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0xff, 0xff, 0x1, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0xf, 0xff, 0xf0, 0x1f,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0xff, 0xff, 0x0,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0xf, 0xff, 0xf0,
-    0xd, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x0, 0x8f, 0xff, 0xf6, 0x0, 0x0, 0x8f, 0xff,
-    0xf0, 0x2, 0xff, 0xff, 0xfa, 0x56, 0xbf, 0xff,
-    0xff, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x2, 0x9d, 0xff, 0xd8,
-    0x1d, 0xff, 0xf5,
-
-    /* U+0065 "e" */
-    0x0, 0x0, 0x18, 0xce, 0xfe, 0xc8, 0x10, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x2f, 0xff, 0xfe, 0x75, 0x7d, 0xff,
-    0xff, 0x20, 0x9, 0xff, 0xfe, 0x10, 0x0, 0xb,
-    0xff, 0xf9, 0x0, 0xef, 0xff, 0xa3, 0x33, 0x33,
-    0x6f, 0xff, 0xe0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x2b, 0x20, 0x0, 0xef,
-    0xff, 0xfe, 0x97, 0x68, 0xcf, 0xf2, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x2, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x49, 0xce, 0xff, 0xeb, 0x61, 0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x0, 0x6b, 0xef, 0xff, 0x90, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x1f, 0xff, 0xfe, 0x88, 0x50,
-    0x0, 0x2f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xf5, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x68, 0x9f,
-    0xff, 0xfb, 0x88, 0x80, 0x0, 0x2f, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xf5, 0x0, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x0, 0x3a, 0xef, 0xeb, 0x69, 0xff, 0xfc,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x1, 0xff, 0xff, 0xfb, 0x67, 0xcf, 0xff, 0xfc,
-    0x8, 0xff, 0xff, 0x70, 0x0, 0x9, 0xff, 0xfc,
-    0xd, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xff, 0xfc,
-    0xf, 0xff, 0xf5, 0x0, 0x0, 0x0, 0xff, 0xfc,
-    0x1f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0xff, 0xfc,
-    0x1f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0xff, 0xfc,
-    0xf, 0xff, 0xf5, 0x0, 0x0, 0x0, 0xff, 0xfc,
-    0xd, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xff, 0xfc,
-    0x8, 0xff, 0xff, 0x70, 0x0, 0x8, 0xff, 0xfc,
-    0x2, 0xff, 0xff, 0xfb, 0x66, 0xbf, 0xff, 0xfc,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x3a, 0xef, 0xfc, 0x6b, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xfa,
-    0x6, 0xb7, 0x32, 0x10, 0x16, 0xff, 0xff, 0xf7,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x1, 0x59, 0xcd, 0xef, 0xfe, 0xc8, 0x20, 0x0,
-
-    /* U+0068 "h" */
-    0x9f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xe0,
-    0x39, 0xef, 0xea, 0x20, 0x9, 0xff, 0xfe, 0x9f,
-    0xff, 0xff, 0xff, 0x30, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x9, 0xff, 0xff, 0xfd, 0x9c,
-    0xff, 0xff, 0xf2, 0x9f, 0xff, 0xf6, 0x0, 0x8,
-    0xff, 0xff, 0x49, 0xff, 0xfe, 0x0, 0x0, 0x2f,
-    0xff, 0xf5, 0x9f, 0xff, 0xe0, 0x0, 0x2, 0xff,
-    0xff, 0x59, 0xff, 0xfe, 0x0, 0x0, 0x2f, 0xff,
-    0xf5, 0x9f, 0xff, 0xe0, 0x0, 0x2, 0xff, 0xff,
-    0x59, 0xff, 0xfe, 0x0, 0x0, 0x2f, 0xff, 0xf5,
-    0x9f, 0xff, 0xe0, 0x0, 0x2, 0xff, 0xff, 0x59,
-    0xff, 0xfe, 0x0, 0x0, 0x2f, 0xff, 0xf5, 0x9f,
-    0xff, 0xe0, 0x0, 0x2, 0xff, 0xff, 0x59, 0xff,
-    0xfe, 0x0, 0x0, 0x2f, 0xff, 0xf5, 0x9f, 0xff,
-    0xe0, 0x0, 0x2, 0xff, 0xff, 0x59, 0xff, 0xfe,
-    0x0, 0x0, 0x2f, 0xff, 0xf5,
-
-    /* U+0069 "i" */
-    0x3f, 0xff, 0xf4, 0x3f, 0xff, 0xf4, 0x3f, 0xff,
-    0xf4, 0x3f, 0xff, 0xf4, 0x2a, 0xaa, 0xa2, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf4, 0x3f, 0xff, 0xf4,
-    0x3f, 0xff, 0xf4, 0x3f, 0xff, 0xf4, 0x3f, 0xff,
-    0xf4, 0x3f, 0xff, 0xf4, 0x3f, 0xff, 0xf4, 0x3f,
-    0xff, 0xf4, 0x3f, 0xff, 0xf4, 0x3f, 0xff, 0xf4,
-    0x3f, 0xff, 0xf4, 0x3f, 0xff, 0xf4, 0x3f, 0xff,
-    0xf4, 0x3f, 0xff, 0xf4, 0x3f, 0xff, 0xf4, 0x3f,
-    0xff, 0xf4,
-
-    /* U+006A "j" */
-    0x0, 0x0, 0xff, 0xff, 0x70, 0x0, 0xf, 0xff,
-    0xf7, 0x0, 0x0, 0xff, 0xff, 0x70, 0x0, 0xf,
-    0xff, 0xf7, 0x0, 0x0, 0xaa, 0xaa, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0x70,
-    0x0, 0xf, 0xff, 0xf7, 0x0, 0x0, 0xff, 0xff,
-    0x70, 0x0, 0xf, 0xff, 0xf7, 0x0, 0x0, 0xff,
-    0xff, 0x70, 0x0, 0xf, 0xff, 0xf7, 0x0, 0x0,
-    0xff, 0xff, 0x70, 0x0, 0xf, 0xff, 0xf7, 0x0,
-    0x0, 0xff, 0xff, 0x70, 0x0, 0xf, 0xff, 0xf7,
-    0x0, 0x0, 0xff, 0xff, 0x70, 0x0, 0xf, 0xff,
-    0xf7, 0x0, 0x0, 0xff, 0xff, 0x70, 0x0, 0xf,
-    0xff, 0xf7, 0x0, 0x0, 0xff, 0xff, 0x70, 0x0,
-    0xf, 0xff, 0xf7, 0x0, 0x2, 0xff, 0xff, 0x60,
-    0x0, 0x6f, 0xff, 0xf4, 0x0, 0x4e, 0xff, 0xff,
-    0x7, 0xef, 0xff, 0xff, 0xa0, 0x9f, 0xff, 0xff,
-    0xe1, 0x9, 0xff, 0xff, 0xd2, 0x0, 0x8f, 0xda,
-    0x50, 0x0, 0x0,
-
-    /* U+006B "k" */
-    0x9f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xe0,
-    0x0, 0x4f, 0xff, 0xf5, 0x9, 0xff, 0xfe, 0x0,
-    0xe, 0xff, 0xfa, 0x0, 0x9f, 0xff, 0xe0, 0x9,
-    0xff, 0xfe, 0x10, 0x9, 0xff, 0xfe, 0x3, 0xff,
-    0xff, 0x50, 0x0, 0x9f, 0xff, 0xe0, 0xdf, 0xff,
-    0xa0, 0x0, 0x9, 0xff, 0xff, 0xbf, 0xff, 0xe1,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x0,
-    0x9, 0xff, 0xfe, 0x1d, 0xff, 0xfc, 0x0, 0x0,
-    0x9f, 0xff, 0xe0, 0x1e, 0xff, 0xf6, 0x0, 0x9,
-    0xff, 0xfe, 0x0, 0x5f, 0xff, 0xe0, 0x0, 0x9f,
-    0xff, 0xe0, 0x0, 0xcf, 0xff, 0x80, 0x9, 0xff,
-    0xfe, 0x0, 0x4, 0xff, 0xff, 0x0, 0x9f, 0xff,
-    0xe0, 0x0, 0xd, 0xff, 0xf7, 0x9, 0xff, 0xfe,
-    0x0, 0x0, 0x5f, 0xff, 0xd0,
-
-    /* U+006C "l" */
-    0x9f, 0xff, 0xe0, 0x0, 0x9f, 0xff, 0xe0, 0x0,
-    0x9f, 0xff, 0xe0, 0x0, 0x9f, 0xff, 0xe0, 0x0,
-    0x9f, 0xff, 0xe0, 0x0, 0x9f, 0xff, 0xe0, 0x0,
-    0x9f, 0xff, 0xe0, 0x0, 0x9f, 0xff, 0xe0, 0x0,
-    0x9f, 0xff, 0xe0, 0x0, 0x9f, 0xff, 0xe0, 0x0,
-    0x9f, 0xff, 0xe0, 0x0, 0x9f, 0xff, 0xe0, 0x0,
-    0x9f, 0xff, 0xe0, 0x0, 0x9f, 0xff, 0xe0, 0x0,
-    0x9f, 0xff, 0xe0, 0x0, 0x9f, 0xff, 0xe0, 0x0,
-    0x9f, 0xff, 0xf0, 0x0, 0x8f, 0xff, 0xf6, 0x0,
-    0x5f, 0xff, 0xff, 0xe8, 0xe, 0xff, 0xff, 0xfa,
-    0x5, 0xff, 0xff, 0xfa, 0x0, 0x3b, 0xef, 0xfa,
-
-    /* U+006D "m" */
-    0x9f, 0xff, 0xe0, 0x3a, 0xef, 0xe9, 0x10, 0x18,
-    0xcf, 0xfc, 0x50, 0x9, 0xff, 0xfe, 0xaf, 0xff,
-    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0x60, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x9, 0xff, 0xff, 0xfc, 0x9c, 0xff,
-    0xff, 0xff, 0xaa, 0xff, 0xff, 0xf4, 0x9f, 0xff,
-    0xf5, 0x0, 0xb, 0xff, 0xff, 0x10, 0x5, 0xff,
-    0xff, 0x69, 0xff, 0xfe, 0x0, 0x0, 0x7f, 0xff,
-    0xf0, 0x0, 0x1f, 0xff, 0xf7, 0x9f, 0xff, 0xe0,
-    0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff,
-    0x79, 0xff, 0xfe, 0x0, 0x0, 0x7f, 0xff, 0xf0,
-    0x0, 0xf, 0xff, 0xf7, 0x9f, 0xff, 0xe0, 0x0,
-    0x7, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x79,
-    0xff, 0xfe, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0,
-    0xf, 0xff, 0xf7, 0x9f, 0xff, 0xe0, 0x0, 0x7,
-    0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0x79, 0xff,
-    0xfe, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0xf,
-    0xff, 0xf7, 0x9f, 0xff, 0xe0, 0x0, 0x7, 0xff,
-    0xff, 0x0, 0x0, 0xff, 0xff, 0x79, 0xff, 0xfe,
-    0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0xf, 0xff,
-    0xf7, 0x9f, 0xff, 0xe0, 0x0, 0x7, 0xff, 0xff,
-    0x0, 0x0, 0xff, 0xff, 0x79, 0xff, 0xfe, 0x0,
-    0x0, 0x7f, 0xff, 0xf0, 0x0, 0xf, 0xff, 0xf7,
-
-    /* U+006E "n" */
-    0x9f, 0xff, 0xe0, 0x28, 0xdf, 0xfb, 0x40, 0x9,
-    0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0x60, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0xff,
-    0xff, 0xfe, 0xaa, 0xff, 0xff, 0xf6, 0x9f, 0xff,
-    0xf9, 0x0, 0x4, 0xff, 0xff, 0x99, 0xff, 0xfe,
-    0x0, 0x0, 0xe, 0xff, 0xf9, 0x9f, 0xff, 0xe0,
-    0x0, 0x0, 0xef, 0xff, 0x99, 0xff, 0xfe, 0x0,
-    0x0, 0xe, 0xff, 0xf9, 0x9f, 0xff, 0xe0, 0x0,
-    0x0, 0xef, 0xff, 0x99, 0xff, 0xfe, 0x0, 0x0,
-    0xe, 0xff, 0xf9, 0x9f, 0xff, 0xe0, 0x0, 0x0,
-    0xef, 0xff, 0x99, 0xff, 0xfe, 0x0, 0x0, 0xe,
-    0xff, 0xf9, 0x9f, 0xff, 0xe0, 0x0, 0x0, 0xef,
-    0xff, 0x99, 0xff, 0xfe, 0x0, 0x0, 0xe, 0xff,
-    0xf9, 0x9f, 0xff, 0xe0, 0x0, 0x0, 0xef, 0xff,
-    0x99, 0xff, 0xfe, 0x0, 0x0, 0xe, 0xff, 0xf9,
-
-    /* U+006F "o" */
-    0x0, 0x0, 0x17, 0xbe, 0xff, 0xda, 0x40, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xc1,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd1, 0x0, 0x2f, 0xff, 0xff, 0x96, 0x7c, 0xff,
-    0xff, 0xa0, 0x9, 0xff, 0xff, 0x40, 0x0, 0xb,
-    0xff, 0xff, 0x20, 0xdf, 0xff, 0xa0, 0x0, 0x0,
-    0x1f, 0xff, 0xf6, 0xf, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0x92, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0xb, 0xff, 0xfa, 0x1f, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xa0, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0xe, 0xff, 0xf8, 0xc, 0xff, 0xfd,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0x50, 0x7f, 0xff,
-    0xf6, 0x0, 0x0, 0xcf, 0xff, 0xf0, 0x1, 0xef,
-    0xff, 0xfa, 0x67, 0xdf, 0xff, 0xf8, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x3, 0xef, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x5b, 0xdf, 0xed, 0x93, 0x0, 0x0,
-
-    /* U+0070 "p" */
-    0x9, 0xff, 0xfe, 0x6, 0xbf, 0xfd, 0x92, 0x0,
-    0x0, 0x9, 0xff, 0xfe, 0xcf, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x9, 0xff, 0xff, 0xfb, 0x66,
-    0xcf, 0xff, 0xfe, 0x0, 0x9, 0xff, 0xff, 0x60,
-    0x0, 0x9, 0xff, 0xff, 0x60, 0x9, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xb0, 0x9, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xe0, 0x9,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf0,
-    0x9, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xf0, 0x9, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xe0, 0x9, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xb0, 0x9, 0xff, 0xff, 0x60, 0x0,
-    0x9, 0xff, 0xff, 0x60, 0x9, 0xff, 0xff, 0xfa,
-    0x66, 0xcf, 0xff, 0xfe, 0x10, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x9, 0xff,
-    0xff, 0xef, 0xff, 0xff, 0xff, 0x50, 0x0, 0x9,
-    0xff, 0xfe, 0x7, 0xcf, 0xfd, 0x92, 0x0, 0x0,
-    0x9, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x0, 0x3a, 0xef, 0xeb, 0x50, 0xff, 0xff,
-    0x70, 0x0, 0x7, 0xff, 0xff, 0xff, 0xfb, 0xff,
-    0xff, 0x70, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x70, 0x1, 0xff, 0xff, 0xfb, 0x67,
-    0xcf, 0xff, 0xff, 0x70, 0x8, 0xff, 0xff, 0x70,
-    0x0, 0x8, 0xff, 0xff, 0x70, 0xd, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x70, 0xf, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0xff, 0xff, 0x70, 0x1f,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0xff, 0xff, 0x70,
-    0x1f, 0xff, 0xf2, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x70, 0xf, 0xff, 0xf5, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x70, 0xd, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0x70, 0x8, 0xff, 0xff, 0x70, 0x0,
-    0x8, 0xff, 0xff, 0x70, 0x2, 0xff, 0xff, 0xfb,
-    0x66, 0xbf, 0xff, 0xff, 0x70, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x3a, 0xef, 0xfc, 0x60, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xe0,
-
-    /* U+0072 "r" */
-    0x9f, 0xff, 0xe0, 0x7d, 0xfd, 0x9f, 0xff, 0xec,
-    0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0x9f,
-    0xff, 0xff, 0xea, 0x9a, 0x9f, 0xff, 0xf8, 0x0,
-    0x0, 0x9f, 0xff, 0xe0, 0x0, 0x0, 0x9f, 0xff,
-    0xe0, 0x0, 0x0, 0x9f, 0xff, 0xe0, 0x0, 0x0,
-    0x9f, 0xff, 0xe0, 0x0, 0x0, 0x9f, 0xff, 0xe0,
-    0x0, 0x0, 0x9f, 0xff, 0xe0, 0x0, 0x0, 0x9f,
-    0xff, 0xe0, 0x0, 0x0, 0x9f, 0xff, 0xe0, 0x0,
-    0x0, 0x9f, 0xff, 0xe0, 0x0, 0x0, 0x9f, 0xff,
-    0xe0, 0x0, 0x0, 0x9f, 0xff, 0xe0, 0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x3, 0x9d, 0xff, 0xdb, 0x82, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x6, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0xdf, 0xff, 0xe8, 0x79,
-    0xcf, 0xa0, 0xf, 0xff, 0xf6, 0x0, 0x0, 0x14,
-    0x0, 0xdf, 0xff, 0xd2, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xfb, 0x50, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xe7, 0x0, 0x0, 0x4, 0xcf, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x17, 0xdf, 0xff,
-    0xf6, 0x3, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xa0,
-    0xfa, 0x30, 0x0, 0xc, 0xff, 0xfb, 0xf, 0xff,
-    0xeb, 0xac, 0xff, 0xff, 0x90, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0xd, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x3, 0x8b, 0xdf, 0xfe, 0xa3, 0x0,
-
-    /* U+0074 "t" */
-    0x0, 0x6f, 0xff, 0xc0, 0x0, 0x0, 0x6f, 0xff,
-    0xc0, 0x0, 0x0, 0x6f, 0xff, 0xc0, 0x0, 0x0,
-    0x6f, 0xff, 0xc0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xfb, 0x9f, 0xff, 0xff, 0xff, 0xfb, 0x9f, 0xff,
-    0xff, 0xff, 0xfb, 0x58, 0xbf, 0xff, 0xe8, 0x85,
-    0x0, 0x6f, 0xff, 0xc0, 0x0, 0x0, 0x6f, 0xff,
-    0xc0, 0x0, 0x0, 0x6f, 0xff, 0xc0, 0x0, 0x0,
-    0x6f, 0xff, 0xc0, 0x0, 0x0, 0x6f, 0xff, 0xc0,
-    0x0, 0x0, 0x6f, 0xff, 0xc0, 0x0, 0x0, 0x6f,
-    0xff, 0xc0, 0x0, 0x0, 0x6f, 0xff, 0xe0, 0x0,
-    0x0, 0x5f, 0xff, 0xfb, 0x96, 0x0, 0x2f, 0xff,
-    0xff, 0xf9, 0x0, 0xb, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x8d, 0xff, 0xe8,
-
-    /* U+0075 "u" */
-    0xaf, 0xff, 0xd0, 0x0, 0x0, 0xef, 0xff, 0x90,
-    0xaf, 0xff, 0xd0, 0x0, 0x0, 0xef, 0xff, 0x90,
-    0xaf, 0xff, 0xd0, 0x0, 0x0, 0xef, 0xff, 0x90,
-    0xaf, 0xff, 0xd0, 0x0, 0x0, 0xef, 0xff, 0x90,
-    0xaf, 0xff, 0xd0, 0x0, 0x0, 0xef, 0xff, 0x90,
-    0xaf, 0xff, 0xd0, 0x0, 0x0, 0xef, 0xff, 0x90,
-    0xaf, 0xff, 0xd0, 0x0, 0x0, 0xef, 0xff, 0x90,
-    0xaf, 0xff, 0xd0, 0x0, 0x0, 0xef, 0xff, 0x90,
-    0xaf, 0xff, 0xd0, 0x0, 0x0, 0xef, 0xff, 0x90,
-    0xaf, 0xff, 0xd0, 0x0, 0x0, 0xef, 0xff, 0x90,
-    0xaf, 0xff, 0xe0, 0x0, 0x0, 0xef, 0xff, 0x90,
-    0x9f, 0xff, 0xf2, 0x0, 0x8, 0xff, 0xff, 0x90,
-    0x7f, 0xff, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0x90,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x8, 0xff, 0xff, 0xff, 0xf9, 0x8f, 0xff, 0xa0,
-    0x0, 0x5c, 0xff, 0xd8, 0x20, 0x4f, 0xff, 0xf0,
-
-    /* U+0076 "v" */
-    0xbf, 0xff, 0xc0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x66, 0xff, 0xff, 0x10, 0x0, 0x0, 0x5f, 0xff,
-    0xf2, 0x1f, 0xff, 0xf5, 0x0, 0x0, 0xa, 0xff,
-    0xfd, 0x0, 0xdf, 0xff, 0xa0, 0x0, 0x0, 0xef,
-    0xff, 0x80, 0x8, 0xff, 0xfe, 0x0, 0x0, 0x3f,
-    0xff, 0xf3, 0x0, 0x3f, 0xff, 0xf2, 0x0, 0x7,
-    0xff, 0xfe, 0x0, 0x0, 0xef, 0xff, 0x70, 0x0,
-    0xbf, 0xff, 0xa0, 0x0, 0x9, 0xff, 0xfb, 0x0,
-    0xf, 0xff, 0xf5, 0x0, 0x0, 0x5f, 0xff, 0xf0,
-    0x4, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x40, 0x9f, 0xff, 0xb0, 0x0, 0x0, 0xb, 0xff,
-    0xf9, 0xd, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xd2, 0xff, 0xff, 0x20, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0x8f, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-
-    /* U+0077 "w" */
-    0x7f, 0xff, 0xf0, 0x0, 0x0, 0xcf, 0xff, 0x70,
-    0x0, 0x5, 0xff, 0xff, 0x12, 0xff, 0xff, 0x20,
-    0x0, 0xf, 0xff, 0xfa, 0x0, 0x0, 0x8f, 0xff,
-    0xc0, 0xe, 0xff, 0xf6, 0x0, 0x3, 0xff, 0xff,
-    0xe0, 0x0, 0xc, 0xff, 0xf8, 0x0, 0x9f, 0xff,
-    0xa0, 0x0, 0x7f, 0xff, 0xff, 0x10, 0x0, 0xff,
-    0xff, 0x30, 0x5, 0xff, 0xfd, 0x0, 0xa, 0xff,
-    0xff, 0xf4, 0x0, 0x3f, 0xff, 0xf0, 0x0, 0xf,
-    0xff, 0xf1, 0x0, 0xef, 0xff, 0xff, 0x80, 0x7,
-    0xff, 0xfa, 0x0, 0x0, 0xcf, 0xff, 0x50, 0x1f,
-    0xff, 0x8f, 0xfb, 0x0, 0xbf, 0xff, 0x60, 0x0,
-    0x7, 0xff, 0xf8, 0x4, 0xff, 0xe4, 0xff, 0xf0,
-    0xe, 0xff, 0xf1, 0x0, 0x0, 0x3f, 0xff, 0xc0,
-    0x8f, 0xfa, 0x1f, 0xff, 0x22, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xb, 0xff, 0x70, 0xdf,
-    0xf6, 0x6f, 0xff, 0x80, 0x0, 0x0, 0xa, 0xff,
-    0xf4, 0xff, 0xf4, 0xa, 0xff, 0x99, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xaf, 0xff, 0x10,
-    0x7f, 0xfd, 0xdf, 0xff, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xe0, 0x4, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xfa,
-    0x0, 0xf, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0x70, 0x0, 0xdf, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf4, 0x0, 0xa, 0xff, 0xff, 0xd0, 0x0, 0x0,
-
-    /* U+0078 "x" */
-    0x2f, 0xff, 0xf6, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0x10, 0x6f, 0xff, 0xf1, 0x0, 0x1, 0xff, 0xff,
-    0x60, 0x0, 0xcf, 0xff, 0xa0, 0x0, 0xbf, 0xff,
-    0xb0, 0x0, 0x2, 0xff, 0xff, 0x40, 0x5f, 0xff,
-    0xf1, 0x0, 0x0, 0x6, 0xff, 0xfe, 0x1e, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0xb, 0xff, 0xfe, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xf5, 0xff, 0xff, 0x40, 0x0, 0x0, 0x1e,
-    0xff, 0xf7, 0x8, 0xff, 0xfe, 0x10, 0x0, 0xa,
-    0xff, 0xfd, 0x0, 0xd, 0xff, 0xfa, 0x0, 0x5,
-    0xff, 0xff, 0x30, 0x0, 0x4f, 0xff, 0xf4, 0x1,
-    0xef, 0xff, 0x90, 0x0, 0x0, 0x9f, 0xff, 0xe1,
-
-    /* U+0079 "y" */
-    0xcf, 0xff, 0xb0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0x16, 0xff, 0xff, 0x10, 0x0, 0x0, 0xcf, 0xff,
-    0xd0, 0x1f, 0xff, 0xf7, 0x0, 0x0, 0xf, 0xff,
-    0xf8, 0x0, 0xaf, 0xff, 0xc0, 0x0, 0x4, 0xff,
-    0xff, 0x40, 0x4, 0xff, 0xff, 0x20, 0x0, 0x8f,
-    0xff, 0xf0, 0x0, 0xe, 0xff, 0xf8, 0x0, 0xc,
-    0xff, 0xfa, 0x0, 0x0, 0x8f, 0xff, 0xe0, 0x1,
-    0xff, 0xff, 0x60, 0x0, 0x2, 0xff, 0xff, 0x30,
-    0x5f, 0xff, 0xf1, 0x0, 0x0, 0xc, 0xff, 0xf9,
-    0x9, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xe0, 0xdf, 0xff, 0x80, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0x6f, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xfe, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x56, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x17, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x6b, 0xdf, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xc3, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xfe, 0xb8, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x4, 0x88, 0x88,
-    0x88, 0xcf, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x1e, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xd1,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xfe, 0x20, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x88,
-    0x88, 0x88, 0x86, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-
-    /* U+007B "{" */
-    0x0, 0x0, 0x1, 0x69, 0xa2, 0x0, 0x0, 0x6f,
-    0xff, 0xf3, 0x0, 0x4, 0xff, 0xff, 0xf3, 0x0,
-    0xb, 0xff, 0xff, 0xf3, 0x0, 0xf, 0xff, 0xf7,
-    0x0, 0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0, 0x1f,
-    0xff, 0xf0, 0x0, 0x0, 0x1f, 0xff, 0xf0, 0x0,
-    0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0, 0x1f, 0xff,
-    0xf0, 0x0, 0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0,
-    0x2f, 0xff, 0xe0, 0x0, 0x1, 0x9f, 0xff, 0xb0,
-    0x0, 0x1f, 0xff, 0xfe, 0x30, 0x0, 0x1f, 0xff,
-    0xc2, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x30, 0x0,
-    0x1, 0x9f, 0xff, 0xc0, 0x0, 0x0, 0x2f, 0xff,
-    0xe0, 0x0, 0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0,
-    0x1f, 0xff, 0xf0, 0x0, 0x0, 0x1f, 0xff, 0xf0,
-    0x0, 0x0, 0x1f, 0xff, 0xf0, 0x0, 0x0, 0x1f,
-    0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0xf3, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xc2, 0x0, 0x7, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0xbf, 0xff, 0xf3, 0x0,
-    0x0, 0x5, 0xbe, 0xf2,
-
-    /* U+007C "|" */
-    0x7c, 0xca, 0x9f, 0xfe, 0x9f, 0xfe, 0x9f, 0xfe,
-    0x9f, 0xfe, 0x9f, 0xfe, 0x9f, 0xfe, 0x9f, 0xfe,
-    0x9f, 0xfe, 0x9f, 0xfe, 0x9f, 0xfe, 0x9f, 0xfe,
-    0x9f, 0xfe, 0x9f, 0xfe, 0x9f, 0xfe, 0x9f, 0xfe,
-    0x9f, 0xfe, 0x9f, 0xfe, 0x9f, 0xfe, 0x9f, 0xfe,
-    0x9f, 0xfe, 0x9f, 0xfe, 0x9f, 0xfe, 0x9f, 0xfe,
-    0x9f, 0xfe, 0x9f, 0xfe, 0x9f, 0xfe, 0x9f, 0xfe,
-
-    /* U+007D "}" */
-    0x4a, 0x85, 0x0, 0x0, 0x6, 0xff, 0xfe, 0x30,
-    0x0, 0x6f, 0xff, 0xfe, 0x10, 0x6, 0xff, 0xff,
-    0xf8, 0x0, 0x1, 0xaf, 0xff, 0xc0, 0x0, 0x4,
-    0xff, 0xfd, 0x0, 0x0, 0x3f, 0xff, 0xe0, 0x0,
-    0x3, 0xff, 0xfe, 0x0, 0x0, 0x3f, 0xff, 0xe0,
-    0x0, 0x3, 0xff, 0xfe, 0x0, 0x0, 0x3f, 0xff,
-    0xe0, 0x0, 0x2, 0xff, 0xff, 0x0, 0x0, 0xe,
-    0xff, 0xf7, 0x10, 0x0, 0x5f, 0xff, 0xfe, 0x0,
-    0x0, 0x4d, 0xff, 0xe0, 0x0, 0x6f, 0xff, 0xfe,
-    0x0, 0xf, 0xff, 0xf6, 0x0, 0x2, 0xff, 0xff,
-    0x0, 0x0, 0x3f, 0xff, 0xe0, 0x0, 0x3, 0xff,
-    0xfe, 0x0, 0x0, 0x3f, 0xff, 0xe0, 0x0, 0x3,
-    0xff, 0xfe, 0x0, 0x0, 0x3f, 0xff, 0xe0, 0x0,
-    0x7, 0xff, 0xfd, 0x0, 0x4c, 0xff, 0xff, 0xa0,
-    0x6, 0xff, 0xff, 0xf4, 0x0, 0x6f, 0xff, 0xf8,
-    0x0, 0x6, 0xfd, 0xa4, 0x0, 0x0,
-
-    /* U+007E "~" */
-    0x1, 0x9d, 0xff, 0xc6, 0x0, 0x0, 0x0, 0x1,
-    0x1f, 0xff, 0xff, 0xff, 0xd5, 0x0, 0x2, 0xa6,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xdf, 0xf6,
-    0x3f, 0xfe, 0xce, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x3c, 0x30, 0x0, 0x3c, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x5b, 0xef, 0xea, 0x30,
-
-    /* U+4E00 "一" */
-    0xad, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xd4, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+4E09 "三" */
-    0x4, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x30, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x5, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xab, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xb9, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-
-    /* U+4E2D "中" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x89, 0x99, 0x99, 0x99,
-    0x99, 0xff, 0xfd, 0x99, 0x99, 0x99, 0x99, 0x96,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0xef, 0xfb, 0x0, 0x0, 0x0, 0xef, 0xfc,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0xef, 0xfb, 0x0,
-    0x0, 0x0, 0xef, 0xfc, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0xef, 0xfb, 0x0, 0x0, 0x0, 0xef, 0xfc,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0xef, 0xfb, 0x0,
-    0x0, 0x0, 0xef, 0xfc, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0xef, 0xfb, 0x0, 0x0, 0x0, 0xef, 0xfc,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0xef, 0xfb, 0x0,
-    0x0, 0x0, 0xef, 0xfc, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0xef, 0xfb, 0x0, 0x0, 0x0, 0xef, 0xfc,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0xef, 0xfb, 0x0,
-    0x0, 0x0, 0xef, 0xfc, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0xef, 0xfb, 0x0, 0x0, 0x0, 0xef, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x89, 0x99, 0x99, 0x99,
-    0x99, 0xff, 0xfd, 0x99, 0x99, 0x99, 0x99, 0x96,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+4E8C "二" */
-    0x4, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdb, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x8a, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xa4,
-
-    /* U+4E91 "云" */
-    0x0, 0x78, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x83, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x79, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x93, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0xac, 0xcc, 0x20, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0xbf, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xf1, 0x0, 0x0,
-    0x5, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xf7, 0x0, 0x7, 0x9e, 0xff, 0xfd,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x9b, 0xff, 0xfd,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb0, 0xc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-
-    /* U+4E94 "五" */
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x59, 0x99, 0x99, 0x99, 0xbf,
-    0xff, 0xb9, 0x99, 0x99, 0x99, 0x99, 0x95, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x48, 0x88, 0x8f, 0xff, 0xe8, 0x88,
-    0x88, 0x88, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0xef, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0x80, 0x0, 0x0, 0x0, 0xef, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0xef, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0xef, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xfb, 0x0, 0x0, 0x1a, 0xaa,
-    0xaa, 0xab, 0xff, 0xfc, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xff, 0xfe, 0xaa, 0xa1, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf2, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-
-    /* U+516D "六" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x1a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xa6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xee,
-    0xeb, 0x0, 0x0, 0x0, 0x5e, 0xee, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xf4, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0x50, 0x0, 0x0,
-    0x5, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xc0, 0x0, 0x0, 0xc, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xf3,
-    0x0, 0x0, 0x3f, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xfa, 0x0, 0x0, 0xaf,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x10, 0x2, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x80,
-    0xa, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf1, 0x2f, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xf8,
-
-    /* U+56DB "四" */
-    0x89, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x98, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x11, 0x1f, 0xff, 0x91, 0x19, 0xff,
-    0xe1, 0x11, 0xaf, 0xff, 0xff, 0xf9, 0x0, 0xf,
-    0xff, 0x80, 0x9, 0xff, 0xe0, 0x0, 0xaf, 0xff,
-    0xff, 0xf9, 0x0, 0x1f, 0xff, 0x80, 0x9, 0xff,
-    0xe0, 0x0, 0xaf, 0xff, 0xff, 0xf9, 0x0, 0x2f,
-    0xff, 0x60, 0x9, 0xff, 0xe0, 0x0, 0xaf, 0xff,
-    0xff, 0xf9, 0x0, 0x5f, 0xff, 0x50, 0x9, 0xff,
-    0xe0, 0x0, 0xaf, 0xff, 0xff, 0xf9, 0x0, 0x8f,
-    0xff, 0x20, 0x9, 0xff, 0xe0, 0x0, 0xaf, 0xff,
-    0xff, 0xf9, 0x0, 0xcf, 0xff, 0x0, 0x9, 0xff,
-    0xe0, 0x0, 0xaf, 0xff, 0xff, 0xf9, 0x1, 0xff,
-    0xfc, 0x0, 0x9, 0xff, 0xe0, 0x0, 0xaf, 0xff,
-    0xff, 0xf9, 0x6, 0xff, 0xf7, 0x0, 0x9, 0xff,
-    0xe0, 0x0, 0xaf, 0xff, 0xff, 0xf9, 0xd, 0xff,
-    0xf2, 0x0, 0x9, 0xff, 0xf7, 0x77, 0xdf, 0xff,
-    0xff, 0xf9, 0x6f, 0xff, 0xc0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xef, 0xff,
-    0x50, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x77, 0x73,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xfe, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe,
-    0xff, 0xfd, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xef, 0xfe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-
-    /* U+591A "多" */
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x5,
-    0xef, 0xff, 0xf9, 0x77, 0x77, 0x77, 0x7a, 0xff,
-    0xfe, 0x0, 0x0, 0x6d, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x1, 0xdf, 0xff, 0x50, 0x0, 0xf,
-    0xff, 0xff, 0xe4, 0xaf, 0xff, 0x50, 0x3, 0xef,
-    0xff, 0xb0, 0x0, 0x0, 0xff, 0xff, 0x91, 0x1,
-    0xff, 0xfe, 0x28, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0xf, 0xe9, 0x20, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xc1, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0,
-    0x14, 0x9f, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x35, 0x67, 0x9b, 0xef, 0xff, 0xff, 0xff,
-    0xfc, 0x30, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf, 0xfe,
-    0xdb, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xc8, 0x88, 0x88, 0x88,
-    0x8e, 0xff, 0xfb, 0x0, 0x0, 0x5d, 0xff, 0xff,
-    0xf8, 0x66, 0x40, 0x0, 0x5, 0xff, 0xff, 0x30,
-    0x2, 0xef, 0xff, 0xff, 0xc3, 0xff, 0xff, 0x20,
-    0x4, 0xff, 0xff, 0x90, 0x0, 0x3f, 0xff, 0xff,
-    0x90, 0x7, 0xff, 0xfb, 0x7, 0xff, 0xff, 0xd0,
-    0x0, 0x3, 0xff, 0xfb, 0x30, 0x0, 0xd, 0xff,
-    0xfd, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x3e, 0x93,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x47, 0xbf,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x3, 0x67,
-    0x8a, 0xce, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x30,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa4, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xa5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xdb, 0x97,
-    0x41, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+5927 "大" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x1f, 0xff, 0xa1, 0x11, 0x11,
-    0x11, 0x11, 0x10, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x79, 0x99, 0x99, 0x99, 0x99, 0x9f,
-    0xff, 0xe9, 0x99, 0x99, 0x99, 0x99, 0x93, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xae, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0x17, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf7,
-    0x0, 0xdf, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xb0, 0x0, 0x3f, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff,
-    0xfd, 0x10, 0x0, 0x5, 0xff, 0xff, 0xfa, 0x10,
-    0x0, 0x4, 0xcf, 0xff, 0xff, 0xd1, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xf9, 0x10, 0xbf, 0xff,
-    0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x4, 0xef,
-    0xff, 0xff, 0xf5, 0xdf, 0xff, 0xfe, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xf7,
-    0xdf, 0xff, 0x81, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3c, 0xff, 0xf7, 0xdd, 0x71, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x39, 0xe7, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-
-    /* U+5C0F "小" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x46, 0x66, 0x0, 0x1, 0xff, 0xfa, 0x0, 0x1,
-    0x11, 0x10, 0x0, 0x0, 0x0, 0xd, 0xff, 0xe0,
-    0x0, 0x1f, 0xff, 0xa0, 0x0, 0xef, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xfc, 0x0, 0x1, 0xff,
-    0xfa, 0x0, 0xa, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xa0, 0x0, 0x1f, 0xff, 0xa0, 0x0,
-    0x6f, 0xff, 0x50, 0x0, 0x0, 0x4, 0xff, 0xf7,
-    0x0, 0x1, 0xff, 0xfa, 0x0, 0x1, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0x50, 0x0, 0x1f,
-    0xff, 0xa0, 0x0, 0xd, 0xff, 0xd0, 0x0, 0x0,
-    0xb, 0xff, 0xf2, 0x0, 0x1, 0xff, 0xfa, 0x0,
-    0x0, 0x9f, 0xff, 0x0, 0x0, 0x0, 0xef, 0xfe,
-    0x0, 0x0, 0x1f, 0xff, 0xa0, 0x0, 0x6, 0xff,
-    0xf4, 0x0, 0x0, 0x1f, 0xff, 0xb0, 0x0, 0x1,
-    0xff, 0xfa, 0x0, 0x0, 0x2f, 0xff, 0x70, 0x0,
-    0x5, 0xff, 0xf8, 0x0, 0x0, 0x1f, 0xff, 0xa0,
-    0x0, 0x0, 0xef, 0xfa, 0x0, 0x0, 0xaf, 0xff,
-    0x40, 0x0, 0x1, 0xff, 0xfa, 0x0, 0x0, 0xc,
-    0xff, 0xd0, 0x0, 0xe, 0xff, 0xf0, 0x0, 0x0,
-    0x1f, 0xff, 0xa0, 0x0, 0x0, 0x9f, 0xff, 0x0,
-    0x2, 0xff, 0xfc, 0x0, 0x0, 0x1, 0xff, 0xfa,
-    0x0, 0x0, 0x6, 0xff, 0xf3, 0x0, 0x7f, 0xff,
-    0x80, 0x0, 0x0, 0x1f, 0xff, 0xa0, 0x0, 0x0,
-    0x3f, 0xff, 0x60, 0xc, 0xff, 0xf3, 0x0, 0x0,
-    0x1, 0xff, 0xfa, 0x0, 0x0, 0x1, 0xff, 0xf8,
-    0x2, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xa0, 0x0, 0x0, 0xe, 0xff, 0xa0, 0x7f, 0xff,
-    0xa0, 0x0, 0x0, 0x1, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0xcf, 0xfd, 0x8, 0xbb, 0xb4, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xa0, 0x0, 0x0, 0x9, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x1, 0xaa, 0xaa, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+65E5 "日" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x2f, 0xff, 0xda, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xab, 0xff, 0xfa, 0x2f, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfa, 0x2f,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xfa, 0x2f, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfa, 0x2f, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfa,
-    0x2f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfa, 0x2f, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfa, 0x2f, 0xff,
-    0xdb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xff,
-    0xfa, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x2f, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xfa, 0x2f, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfa,
-    0x2f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xfa, 0x2f, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xfa, 0x2f, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xfa, 0x2f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xfa, 0x2f, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xfa, 0x2f,
-    0xff, 0xda, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xff, 0xfa, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa,
-
-    /* U+661F "星" */
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xe0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x5, 0xff, 0xfa, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0xdf, 0xfe, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xe0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x4, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xec, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0x30, 0x0, 0x7, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xfd, 0xdd, 0xdd,
-    0xef, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xd9, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x6f, 0xff, 0xb5, 0x55, 0x55,
-    0x5a, 0xff, 0xf6, 0x55, 0x55, 0x55, 0x55, 0x30,
-    0x9, 0xaa, 0xa2, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0xcd, 0xdd, 0xdd, 0xdd, 0xde, 0xff,
-    0xfe, 0xdd, 0xdd, 0xdd, 0xd6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x12, 0x22, 0x22, 0x22,
-    0x22, 0x29, 0xff, 0xf4, 0x22, 0x22, 0x22, 0x22,
-    0x20, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0xd, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x60,
-
-    /* U+6674 "晴" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0x10, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa0, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xab, 0xbb,
-    0xbd, 0xff, 0xfb, 0xbb, 0xbb, 0x70, 0x2f, 0xff,
-    0x55, 0x6f, 0xff, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0x10, 0x0, 0x0, 0x2, 0xff, 0xf0, 0x2, 0xff,
-    0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x2f, 0xff, 0x0, 0x2f, 0xff, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x2, 0xff,
-    0xf0, 0x2, 0xff, 0xf0, 0x2b, 0xbb, 0xbd, 0xff,
-    0xfb, 0xbb, 0xba, 0x0, 0x2f, 0xff, 0x0, 0x2f,
-    0xff, 0x14, 0x44, 0x44, 0x9f, 0xff, 0x54, 0x44,
-    0x44, 0x2, 0xff, 0xf0, 0x2, 0xff, 0xf6, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x2f,
-    0xff, 0x99, 0x9f, 0xff, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0xff, 0xff,
-    0xff, 0xf2, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
-    0x55, 0x50, 0x2f, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x90, 0x2,
-    0xff, 0xfa, 0xaa, 0xff, 0xf0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x2f, 0xff, 0x0,
-    0x2f, 0xff, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x2, 0xff, 0xf0, 0x2, 0xff, 0xf0,
-    0x1f, 0xff, 0x71, 0x11, 0x11, 0xcf, 0xfc, 0x0,
-    0x2f, 0xff, 0x0, 0x2f, 0xff, 0x1, 0xff, 0xfb,
-    0x88, 0x88, 0x8e, 0xff, 0xc0, 0x2, 0xff, 0xf0,
-    0x2, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x2f, 0xff, 0x0, 0x2f, 0xff,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x2, 0xff, 0xf0, 0x2, 0xff, 0xf0, 0x1f, 0xff,
-    0x71, 0x11, 0x11, 0xcf, 0xfc, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0x1, 0xff, 0xfc, 0x99, 0x99,
-    0x9e, 0xff, 0xc0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x66,
-    0x66, 0x66, 0x66, 0x60, 0x1f, 0xff, 0x70, 0x0,
-    0x0, 0xbf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xf7, 0x0, 0x0, 0xb, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0x70, 0x0, 0x0, 0xbf, 0xfc, 0x0,
-
-    /* U+66B4 "暴" */
-    0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0xef, 0xfd, 0x77, 0x77, 0x77,
-    0x77, 0x77, 0x77, 0x77, 0xdf, 0xfe, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0xef, 0xfc, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0x44, 0x44, 0xcf, 0xfe, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x11, 0x11, 0x5f, 0xff, 0x61, 0x11, 0x16,
-    0xff, 0xf5, 0x11, 0x11, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x9,
-    0xcc, 0xcc, 0xdf, 0xff, 0xdc, 0xcc, 0xcd, 0xff,
-    0xfd, 0xcc, 0xcc, 0x90, 0x35, 0x55, 0x55, 0x8f,
-    0xff, 0x85, 0x55, 0x58, 0xff, 0xf8, 0x55, 0x55,
-    0x53, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x48, 0x8a, 0xff, 0xfb, 0x88,
-    0x8e, 0xff, 0xd8, 0x88, 0xbf, 0xff, 0xa8, 0x84,
-    0x0, 0x4e, 0xff, 0xff, 0xd0, 0xd, 0xff, 0xb0,
-    0xd, 0xff, 0xff, 0xe4, 0x0, 0x3a, 0xff, 0xff,
-    0xff, 0xf4, 0xd, 0xff, 0xb0, 0x4f, 0xff, 0xff,
-    0xff, 0xa3, 0xff, 0xff, 0xf4, 0xef, 0xfb, 0xd,
-    0xff, 0xb0, 0xbf, 0xfe, 0x4f, 0xff, 0xff, 0xff,
-    0xfc, 0x20, 0x36, 0x69, 0x5d, 0xff, 0xb5, 0x96,
-    0x63, 0x2, 0xcf, 0xff, 0xfe, 0x60, 0x25, 0x9c,
-    0xff, 0xcd, 0xff, 0xbc, 0xff, 0xc9, 0x52, 0x6,
-    0xef, 0x47, 0xbe, 0xff, 0xff, 0xff, 0xcd, 0xff,
-    0xbc, 0xff, 0xff, 0xff, 0xeb, 0x74, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0xbd, 0xff, 0xbb, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0xd, 0xff, 0xff, 0xb8, 0x41,
-    0xd, 0xff, 0xb0, 0x14, 0x8b, 0xff, 0xff, 0xd0,
-    0xa, 0x95, 0x20, 0x0, 0x0, 0xd, 0xff, 0xb0,
-    0x0, 0x0, 0x2, 0x59, 0xa0,
-
-    /* U+671F "期" */
-    0x3, 0xff, 0xf4, 0x0, 0xf, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x25, 0xff, 0xf7,
-    0x33, 0x3f, 0xff, 0x93, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x7f, 0xff, 0x99, 0x99, 0xff,
-    0xf6, 0x3, 0xff, 0xf4, 0x0, 0xf, 0xff, 0x70,
-    0x7f, 0xff, 0x0, 0x1, 0xff, 0xf6, 0x3, 0xff,
-    0xf4, 0x0, 0xf, 0xff, 0x70, 0x7f, 0xff, 0x0,
-    0x1, 0xff, 0xf6, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x7f, 0xff, 0x0, 0x1, 0xff, 0xf6,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x7f,
-    0xff, 0xdd, 0xdd, 0xff, 0xf6, 0x3, 0xff, 0xfe,
-    0xee, 0xef, 0xff, 0x70, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x3, 0xff, 0xf4, 0x0, 0xf, 0xff,
-    0x70, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x3,
-    0xff, 0xf4, 0x0, 0xf, 0xff, 0x70, 0x7f, 0xff,
-    0xaa, 0xaa, 0xff, 0xf6, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x70, 0x7f, 0xff, 0x0, 0x1, 0xff,
-    0xf6, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x7f, 0xff, 0x0, 0x1, 0xff, 0xf6, 0x3, 0xff,
-    0xfe, 0xee, 0xef, 0xff, 0x70, 0x7f, 0xff, 0x0,
-    0x1, 0xff, 0xf6, 0x3, 0xff, 0xf4, 0x0, 0xf,
-    0xff, 0x70, 0x7f, 0xff, 0xbb, 0xbb, 0xff, 0xf6,
-    0x3, 0xff, 0xf4, 0x0, 0xf, 0xff, 0x70, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xaf, 0xff, 0xcc, 0xcc, 0xff, 0xf6, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xfd,
-    0x0, 0x1, 0xff, 0xf6, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0xcf, 0xfb, 0x0, 0x1, 0xff,
-    0xf6, 0x3, 0xcc, 0xc6, 0x0, 0x4c, 0xcc, 0x40,
-    0xef, 0xfa, 0x0, 0x1, 0xff, 0xf6, 0x8, 0xff,
-    0xf4, 0x0, 0x2f, 0xff, 0xa0, 0xff, 0xf8, 0x0,
-    0x1, 0xff, 0xf6, 0xc, 0xff, 0xf0, 0x0, 0xe,
-    0xff, 0xe3, 0xff, 0xf6, 0x0, 0x1, 0xff, 0xf6,
-    0x1f, 0xff, 0xb0, 0x0, 0x9, 0xff, 0xf9, 0xff,
-    0xf3, 0x0, 0x1, 0xff, 0xf6, 0x5f, 0xff, 0x70,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x1,
-    0xff, 0xf6,
-
-    /* U+9634 "阴" */
-    0x1, 0x11, 0x11, 0x11, 0x11, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xf, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xb0, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xf, 0xff, 0xc8, 0x8f,
-    0xff, 0xa0, 0xaf, 0xff, 0x99, 0x99, 0x9c, 0xff,
-    0xf1, 0xf, 0xff, 0x90, 0x1f, 0xff, 0x80, 0xaf,
-    0xff, 0x0, 0x0, 0x8, 0xff, 0xf1, 0xf, 0xff,
-    0x90, 0x4f, 0xff, 0x60, 0xaf, 0xff, 0x0, 0x0,
-    0x8, 0xff, 0xf1, 0xf, 0xff, 0x90, 0x7f, 0xff,
-    0x20, 0xaf, 0xff, 0x0, 0x0, 0x8, 0xff, 0xf1,
-    0xf, 0xff, 0x90, 0xbf, 0xff, 0x0, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0xf, 0xff, 0x90,
-    0xff, 0xfb, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xf, 0xff, 0x95, 0xff, 0xf6, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xf,
-    0xff, 0x98, 0xff, 0xf3, 0x0, 0xaf, 0xff, 0x77,
-    0x77, 0x7c, 0xff, 0xf1, 0xf, 0xff, 0x92, 0xff,
-    0xf9, 0x0, 0xaf, 0xff, 0x0, 0x0, 0x8, 0xff,
-    0xf1, 0xf, 0xff, 0x90, 0xaf, 0xff, 0x0, 0xaf,
-    0xff, 0x0, 0x0, 0x8, 0xff, 0xf1, 0xf, 0xff,
-    0x90, 0x4f, 0xff, 0x40, 0xbf, 0xfe, 0x0, 0x0,
-    0x8, 0xff, 0xf1, 0xf, 0xff, 0x90, 0xf, 0xff,
-    0x80, 0xbf, 0xff, 0x88, 0x88, 0x8c, 0xff, 0xf1,
-    0xf, 0xff, 0x90, 0xe, 0xff, 0x90, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0xf, 0xff, 0x90,
-    0xe, 0xff, 0xa0, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xf, 0xff, 0x90, 0xf, 0xff, 0x90,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xf,
-    0xff, 0x90, 0x2f, 0xff, 0x71, 0xff, 0xf8, 0x0,
-    0x0, 0x8, 0xff, 0xf1, 0xf, 0xff, 0x90, 0x6f,
-    0xff, 0x34, 0xff, 0xf6, 0x0, 0x0, 0x8, 0xff,
-    0xf1, 0xf, 0xff, 0x90, 0xdf, 0xfe, 0x7, 0xff,
-    0xf3, 0x0, 0x0, 0x8, 0xff, 0xf1, 0xf, 0xff,
-    0x95, 0xff, 0xf7, 0xb, 0xff, 0xf0, 0x0, 0x0,
-    0x8, 0xff, 0xf1, 0xf, 0xff, 0x90, 0x0, 0x0,
-    0xf, 0xff, 0xd0, 0x0, 0x0, 0x8, 0xff, 0xf1,
-    0xf, 0xff, 0x90, 0x0, 0x0, 0x5f, 0xff, 0x90,
-    0x0, 0x0, 0x8, 0xff, 0xf1, 0xf, 0xff, 0x90,
-    0x0, 0x0, 0xaf, 0xff, 0x50, 0x0, 0x0, 0x8,
-    0xff, 0xf1,
-
-    /* U+96E8 "雨" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78,
-    0x88, 0x88, 0x88, 0x88, 0x8e, 0xff, 0xe8, 0x88,
-    0x88, 0x88, 0x88, 0x87, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x15, 0x55, 0x55, 0x55, 0x55, 0x5d, 0xff,
-    0xd5, 0x55, 0x55, 0x55, 0x55, 0x51, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x4f, 0xff, 0x41,
-    0x11, 0x11, 0x1c, 0xff, 0xc1, 0x11, 0x11, 0x14,
-    0xff, 0xf4, 0x4f, 0xff, 0x36, 0xcc, 0xa0, 0xc,
-    0xff, 0xc0, 0xbc, 0xc5, 0x3, 0xff, 0xf4, 0x4f,
-    0xff, 0x35, 0xff, 0xf0, 0xc, 0xff, 0xc0, 0xbf,
-    0xfa, 0x3, 0xff, 0xf4, 0x4f, 0xff, 0x31, 0xff,
-    0xf4, 0xc, 0xff, 0xc0, 0x7f, 0xfe, 0x3, 0xff,
-    0xf4, 0x4f, 0xff, 0x30, 0xef, 0xf8, 0xc, 0xff,
-    0xc0, 0x3f, 0xff, 0x23, 0xff, 0xf4, 0x4f, 0xff,
-    0x30, 0xaf, 0xfb, 0xc, 0xff, 0xc0, 0xf, 0xff,
-    0x63, 0xff, 0xf4, 0x4f, 0xff, 0x30, 0x6f, 0xff,
-    0xc, 0xff, 0xc0, 0xc, 0xff, 0x93, 0xff, 0xf4,
-    0x4f, 0xff, 0x30, 0x14, 0x44, 0xc, 0xff, 0xc0,
-    0x2, 0x44, 0x33, 0xff, 0xf4, 0x4f, 0xff, 0x38,
-    0xff, 0xd0, 0xc, 0xff, 0xc0, 0xdf, 0xf7, 0x3,
-    0xff, 0xf4, 0x4f, 0xff, 0x35, 0xff, 0xf1, 0xc,
-    0xff, 0xc0, 0xaf, 0xfb, 0x3, 0xff, 0xf4, 0x4f,
-    0xff, 0x31, 0xff, 0xf4, 0xc, 0xff, 0xc0, 0x7f,
-    0xfe, 0x3, 0xff, 0xf4, 0x4f, 0xff, 0x30, 0xdf,
-    0xf8, 0xc, 0xff, 0xc0, 0x3f, 0xff, 0x23, 0xff,
-    0xf4, 0x4f, 0xff, 0x30, 0xaf, 0xfb, 0xc, 0xff,
-    0xc0, 0xf, 0xff, 0x63, 0xff, 0xf4, 0x4f, 0xff,
-    0x30, 0x6f, 0xff, 0xc, 0xff, 0xc0, 0xc, 0xff,
-    0x93, 0xff, 0xf4, 0x4f, 0xff, 0x30, 0x13, 0x33,
-    0xc, 0xff, 0xc0, 0x2, 0x33, 0x23, 0xff, 0xf4,
-    0x4f, 0xff, 0x30, 0x0, 0x0, 0xc, 0xff, 0xc0,
-    0x0, 0x0, 0x3, 0xff, 0xf4,
-
-    /* U+96EA "雪" */
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x2,
-    0x23, 0x33, 0x33, 0x33, 0x3f, 0xff, 0xa3, 0x33,
-    0x33, 0x33, 0x32, 0x20, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x7f, 0xff,
-    0x55, 0x55, 0x55, 0x5f, 0xff, 0xb5, 0x55, 0x55,
-    0x56, 0xff, 0xf5, 0x7f, 0xff, 0x7f, 0xff, 0xff,
-    0x8e, 0xff, 0x8d, 0xff, 0xff, 0xf6, 0xff, 0xf5,
-    0x7f, 0xff, 0x7f, 0xff, 0xff, 0x8e, 0xff, 0x8e,
-    0xff, 0xff, 0xf7, 0xff, 0xf5, 0x7f, 0xff, 0x12,
-    0x22, 0x22, 0x1e, 0xff, 0x82, 0x22, 0x22, 0x22,
-    0xff, 0xf5, 0x7f, 0xff, 0x7f, 0xff, 0xff, 0x8e,
-    0xff, 0x8e, 0xff, 0xff, 0xf7, 0xff, 0xf5, 0x38,
-    0x88, 0x7f, 0xff, 0xff, 0x8e, 0xff, 0x8e, 0xff,
-    0xff, 0xf6, 0x88, 0x83, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0x44, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0xa, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x10, 0xa, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,
-    0x1, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0xbf, 0xff, 0x10, 0x0, 0x8, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xef,
-    0xff, 0x10, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x1, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xbf, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0x10, 0xa, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x10, 0xa, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10,
-    0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x10
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 116, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 167, .box_w = 6, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 60, .adv_w = 186, .box_w = 10, .box_h = 9, .ofs_x = 1, .ofs_y = 15},
-    {.bitmap_index = 105, .adv_w = 269, .box_w = 17, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 275, .adv_w = 264, .box_w = 15, .box_h = 28, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 485, .adv_w = 373, .box_w = 21, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 695, .adv_w = 295, .box_w = 19, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 885, .adv_w = 103, .box_w = 5, .box_h = 9, .ofs_x = 1, .ofs_y = 15},
-    {.bitmap_index = 908, .adv_w = 177, .box_w = 9, .box_h = 28, .ofs_x = 2, .ofs_y = -4},
-    {.bitmap_index = 1034, .adv_w = 177, .box_w = 10, .box_h = 28, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 1174, .adv_w = 207, .box_w = 13, .box_h = 12, .ofs_x = 0, .ofs_y = 10},
-    {.bitmap_index = 1252, .adv_w = 259, .box_w = 16, .box_h = 16, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 1380, .adv_w = 147, .box_w = 8, .box_h = 9, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 1416, .adv_w = 197, .box_w = 10, .box_h = 4, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 1436, .adv_w = 147, .box_w = 5, .box_h = 5, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1449, .adv_w = 224, .box_w = 12, .box_h = 22, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 1581, .adv_w = 264, .box_w = 15, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1731, .adv_w = 188, .box_w = 9, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1821, .adv_w = 264, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1961, .adv_w = 264, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2101, .adv_w = 264, .box_w = 16, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2261, .adv_w = 264, .box_w = 15, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2411, .adv_w = 264, .box_w = 15, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2561, .adv_w = 246, .box_w = 15, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2711, .adv_w = 264, .box_w = 15, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2861, .adv_w = 264, .box_w = 15, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3011, .adv_w = 181, .box_w = 5, .box_h = 16, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 3051, .adv_w = 181, .box_w = 7, .box_h = 20, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 3121, .adv_w = 259, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 3257, .adv_w = 259, .box_w = 16, .box_h = 11, .ofs_x = 0, .ofs_y = 5},
-    {.bitmap_index = 3345, .adv_w = 259, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 1},
-    {.bitmap_index = 3481, .adv_w = 201, .box_w = 11, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3591, .adv_w = 383, .box_w = 24, .box_h = 24, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 3879, .adv_w = 325, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4079, .adv_w = 302, .box_w = 17, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4249, .adv_w = 306, .box_w = 17, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4419, .adv_w = 315, .box_w = 18, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4599, .adv_w = 261, .box_w = 15, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4749, .adv_w = 248, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4889, .adv_w = 315, .box_w = 18, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5069, .adv_w = 322, .box_w = 18, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5249, .adv_w = 130, .box_w = 6, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5309, .adv_w = 148, .box_w = 9, .box_h = 25, .ofs_x = -1, .ofs_y = -5},
-    {.bitmap_index = 5422, .adv_w = 302, .box_w = 18, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5602, .adv_w = 234, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5742, .adv_w = 398, .box_w = 23, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5972, .adv_w = 325, .box_w = 18, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6152, .adv_w = 355, .box_w = 21, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6362, .adv_w = 297, .box_w = 17, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6532, .adv_w = 359, .box_w = 21, .box_h = 22, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 6763, .adv_w = 296, .box_w = 17, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6933, .adv_w = 254, .box_w = 15, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7083, .adv_w = 251, .box_w = 16, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7243, .adv_w = 329, .box_w = 18, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7423, .adv_w = 322, .box_w = 20, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7623, .adv_w = 418, .box_w = 26, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 7883, .adv_w = 327, .box_w = 21, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8093, .adv_w = 290, .box_w = 18, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8273, .adv_w = 292, .box_w = 18, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 8453, .adv_w = 148, .box_w = 8, .box_h = 28, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 8565, .adv_w = 226, .box_w = 14, .box_h = 25, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 8740, .adv_w = 148, .box_w = 8, .box_h = 28, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 8852, .adv_w = 259, .box_w = 14, .box_h = 11, .ofs_x = 1, .ofs_y = 10},
-    {.bitmap_index = 8929, .adv_w = 224, .box_w = 14, .box_h = 3, .ofs_x = 0, .ofs_y = -6},
-    {.bitmap_index = 8950, .adv_w = 194, .box_w = 8, .box_h = 5, .ofs_x = 1, .ofs_y = 19},
-    {.bitmap_index = 8970, .adv_w = 277, .box_w = 17, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9106, .adv_w = 277, .box_w = 17, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9293, .adv_w = 237, .box_w = 14, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9405, .adv_w = 277, .box_w = 17, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9592, .adv_w = 272, .box_w = 17, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9728, .adv_w = 179, .box_w = 12, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 9860, .adv_w = 275, .box_w = 16, .box_h = 23, .ofs_x = 0, .ofs_y = -7},
-    {.bitmap_index = 10044, .adv_w = 267, .box_w = 15, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10209, .adv_w = 128, .box_w = 6, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10275, .adv_w = 142, .box_w = 9, .box_h = 29, .ofs_x = -1, .ofs_y = -7},
-    {.bitmap_index = 10406, .adv_w = 246, .box_w = 15, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10571, .adv_w = 142, .box_w = 8, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10659, .adv_w = 397, .box_w = 23, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10843, .adv_w = 272, .box_w = 15, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10963, .adv_w = 281, .box_w = 17, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11099, .adv_w = 284, .box_w = 18, .box_h = 23, .ofs_x = 0, .ofs_y = -7},
-    {.bitmap_index = 11306, .adv_w = 286, .box_w = 18, .box_h = 23, .ofs_x = 0, .ofs_y = -7},
-    {.bitmap_index = 11513, .adv_w = 183, .box_w = 10, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11593, .adv_w = 215, .box_w = 13, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11697, .adv_w = 164, .box_w = 10, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11797, .adv_w = 271, .box_w = 16, .box_h = 16, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11925, .adv_w = 267, .box_w = 17, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12061, .adv_w = 394, .box_w = 25, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12261, .adv_w = 271, .box_w = 17, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12397, .adv_w = 260, .box_w = 17, .box_h = 23, .ofs_x = 0, .ofs_y = -7},
-    {.bitmap_index = 12593, .adv_w = 231, .box_w = 14, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12705, .adv_w = 156, .box_w = 10, .box_h = 28, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 12845, .adv_w = 100, .box_w = 4, .box_h = 28, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 12901, .adv_w = 156, .box_w = 9, .box_h = 28, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 13027, .adv_w = 259, .box_w = 16, .box_h = 6, .ofs_x = 0, .ofs_y = 7},
-    {.bitmap_index = 13075, .adv_w = 448, .box_w = 26, .box_h = 5, .ofs_x = 1, .ofs_y = 8},
-    {.bitmap_index = 13140, .adv_w = 448, .box_w = 26, .box_h = 24, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 13452, .adv_w = 448, .box_w = 24, .box_h = 26, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 13764, .adv_w = 448, .box_w = 26, .box_h = 23, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 14063, .adv_w = 448, .box_w = 26, .box_h = 24, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 14375, .adv_w = 448, .box_w = 28, .box_h = 25, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 14725, .adv_w = 448, .box_w = 26, .box_h = 26, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 15063, .adv_w = 448, .box_w = 24, .box_h = 24, .ofs_x = 2, .ofs_y = -2},
-    {.bitmap_index = 15351, .adv_w = 448, .box_w = 25, .box_h = 26, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 15676, .adv_w = 448, .box_w = 26, .box_h = 27, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 16027, .adv_w = 448, .box_w = 27, .box_h = 26, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 16378, .adv_w = 448, .box_w = 22, .box_h = 25, .ofs_x = 3, .ofs_y = -3},
-    {.bitmap_index = 16653, .adv_w = 448, .box_w = 27, .box_h = 25, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 16991, .adv_w = 448, .box_w = 27, .box_h = 26, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 17342, .adv_w = 448, .box_w = 26, .box_h = 25, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 17667, .adv_w = 448, .box_w = 26, .box_h = 26, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 18005, .adv_w = 448, .box_w = 26, .box_h = 26, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 18343, .adv_w = 448, .box_w = 26, .box_h = 25, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 18668, .adv_w = 448, .box_w = 26, .box_h = 25, .ofs_x = 1, .ofs_y = -3}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_1[] = {
-    0x0, 0x9, 0x2d, 0x8c, 0x91, 0x94, 0x36d, 0x8db,
-    0xb1a, 0xb27, 0xe0f, 0x17e5, 0x181f, 0x1874, 0x18b4, 0x191f,
-    0x4834, 0x48e8, 0x48ea
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 19968, .range_length = 18667, .glyph_id_start = 96,
-        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 19, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-/*-----------------
- *    KERNING
- *----------------*/
-
-
-/*Pair left and right glyphs for kerning*/
-static const uint8_t kern_pair_glyph_ids[] =
-{
-    7, 43,
-    9, 75,
-    19, 21,
-    19, 23,
-    19, 26,
-    21, 26,
-    34, 43,
-    34, 53,
-    34, 55,
-    34, 56,
-    34, 58,
-    34, 66,
-    34, 68,
-    34, 70,
-    34, 72,
-    34, 80,
-    34, 82,
-    36, 43,
-    37, 43,
-    37, 53,
-    37, 55,
-    37, 56,
-    37, 57,
-    37, 58,
-    37, 59,
-    38, 43,
-    39, 15,
-    39, 34,
-    39, 66,
-    39, 68,
-    39, 70,
-    39, 72,
-    39, 80,
-    39, 82,
-    40, 43,
-    41, 43,
-    42, 43,
-    44, 43,
-    44, 48,
-    44, 66,
-    44, 68,
-    44, 70,
-    44, 72,
-    44, 80,
-    44, 82,
-    45, 34,
-    45, 43,
-    45, 48,
-    45, 53,
-    45, 55,
-    45, 56,
-    45, 58,
-    46, 43,
-    47, 43,
-    48, 43,
-    48, 53,
-    48, 55,
-    48, 56,
-    48, 57,
-    48, 58,
-    48, 59,
-    49, 15,
-    49, 34,
-    49, 57,
-    50, 43,
-    50, 53,
-    50, 55,
-    50, 56,
-    50, 57,
-    50, 58,
-    50, 59,
-    51, 43,
-    51, 58,
-    51, 66,
-    51, 68,
-    51, 70,
-    51, 72,
-    51, 80,
-    51, 82,
-    53, 15,
-    53, 34,
-    53, 40,
-    53, 48,
-    53, 50,
-    53, 66,
-    53, 68,
-    53, 70,
-    53, 72,
-    53, 75,
-    53, 78,
-    53, 79,
-    53, 80,
-    53, 81,
-    53, 82,
-    53, 83,
-    53, 84,
-    53, 86,
-    55, 15,
-    55, 34,
-    55, 40,
-    55, 48,
-    55, 50,
-    55, 66,
-    55, 68,
-    55, 70,
-    55, 72,
-    55, 75,
-    55, 78,
-    55, 79,
-    55, 80,
-    55, 81,
-    55, 82,
-    55, 83,
-    55, 84,
-    55, 86,
-    56, 15,
-    56, 34,
-    56, 40,
-    56, 48,
-    56, 50,
-    56, 66,
-    56, 68,
-    56, 70,
-    56, 72,
-    56, 75,
-    56, 78,
-    56, 79,
-    56, 80,
-    56, 81,
-    56, 82,
-    56, 83,
-    56, 84,
-    56, 86,
-    57, 15,
-    57, 40,
-    57, 43,
-    57, 48,
-    57, 50,
-    57, 66,
-    57, 68,
-    57, 70,
-    57, 72,
-    57, 80,
-    57, 82,
-    57, 84,
-    58, 15,
-    58, 34,
-    58, 40,
-    58, 48,
-    58, 50,
-    58, 66,
-    58, 68,
-    58, 69,
-    58, 70,
-    58, 72,
-    58, 75,
-    58, 78,
-    58, 79,
-    58, 80,
-    58, 81,
-    58, 82,
-    58, 83,
-    58, 84,
-    58, 85,
-    58, 86,
-    59, 40,
-    59, 43,
-    59, 48,
-    59, 50,
-    60, 43,
-    60, 75,
-    61, 43,
-    61, 75,
-    66, 43,
-    67, 53,
-    67, 55,
-    67, 56,
-    67, 57,
-    67, 58,
-    67, 87,
-    67, 88,
-    67, 89,
-    67, 90,
-    68, 43,
-    69, 43,
-    70, 53,
-    70, 55,
-    70, 56,
-    70, 57,
-    70, 58,
-    70, 87,
-    70, 88,
-    70, 89,
-    70, 90,
-    72, 43,
-    76, 43,
-    76, 66,
-    76, 68,
-    76, 70,
-    76, 72,
-    76, 80,
-    76, 82,
-    77, 43,
-    79, 43,
-    80, 43,
-    80, 53,
-    80, 55,
-    80, 56,
-    80, 57,
-    80, 58,
-    80, 87,
-    80, 88,
-    80, 89,
-    80, 90,
-    81, 53,
-    81, 55,
-    81, 56,
-    81, 57,
-    81, 58,
-    81, 87,
-    81, 88,
-    81, 89,
-    81, 90,
-    82, 43,
-    82, 75,
-    83, 66,
-    83, 68,
-    83, 70,
-    83, 72,
-    83, 80,
-    83, 82,
-    84, 53,
-    84, 55,
-    84, 56,
-    84, 57,
-    84, 58,
-    85, 43,
-    86, 43,
-    88, 66,
-    88, 68,
-    88, 70,
-    88, 72,
-    88, 80,
-    88, 82,
-    89, 43,
-    89, 66,
-    89, 68,
-    89, 70,
-    89, 72,
-    89, 80,
-    89, 82,
-    90, 66,
-    90, 68,
-    90, 70,
-    90, 72,
-    90, 80,
-    90, 82,
-    91, 43,
-    92, 43,
-    92, 75
-};
-
-/* Kerning between the respective left and right glyphs
- * 4.4 format which needs to scaled with `kern_scale`*/
-static const int8_t kern_pair_values[] =
-{
-    22, 18, -9, -9, -9, -4, 9, -27,
-    -31, -22, -27, -9, -9, -9, -9, -9,
-    -9, 9, -9, -9, -4, -4, -13, -13,
-    -4, 9, -45, -18, -9, -9, -9, -9,
-    -9, -9, 9, 9, 9, 13, -18, -18,
-    -18, -18, -18, -18, -18, 4, 13, -9,
-    -45, -31, -22, -45, 9, 9, -9, -9,
-    -4, -4, -13, -13, -4, -49, -13, -9,
-    -9, -9, -4, -4, -13, -13, -4, 13,
-    -4, -4, -4, -4, -4, -4, -4, -54,
-    -27, -9, -9, -9, -27, -27, -27, -27,
-    -18, -18, -18, -27, -18, -27, -18, -22,
-    -18, -36, -31, -4, -4, -4, -18, -18,
-    -18, -13, -13, -9, -9, -18, -9, -18,
-    -9, -9, -9, -27, -22, -4, -4, -4,
-    -13, -13, -13, -13, -13, -9, -9, -13,
-    -9, -13, -9, -9, -9, -9, -13, 13,
-    -13, -13, -18, -18, -18, -18, -18, -18,
-    -13, -45, -27, -13, -13, -13, -40, -40,
-    -40, -40, -40, -18, -18, -18, -40, -18,
-    -40, -18, -31, -18, -18, -4, 13, -4,
-    -4, 22, 18, 22, 18, 9, -27, -13,
-    -13, -18, -40, -9, -4, -9, -9, 9,
-    9, -27, -13, -13, -18, -40, -9, -4,
-    -9, -9, 9, 9, -9, -9, -9, -9,
-    -9, -9, 13, 4, -9, -27, -18, -13,
-    -18, -40, -9, -4, -9, -9, -27, -13,
-    -13, -18, -40, -9, -4, -9, -9, 9,
-    18, -9, -9, -9, -9, -9, -9, -22,
-    -9, -9, -13, -31, 9, 4, -4, -4,
-    -4, -4, -4, -4, 9, -4, -4, -4,
-    -4, -4, -4, -4, -4, -4, -4, -4,
-    -4, 9, 22, 18
-};
-
-/*Collect the kern pair's data in one place*/
-static const lv_font_fmt_txt_kern_pair_t kern_pairs =
-{
-    .glyph_ids = kern_pair_glyph_ids,
-    .values = kern_pair_values,
-    .pair_cnt = 260,
-    .glyph_ids_size = 0
-};
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LV_VERSION_CHECK(8, 0, 0)
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = &kern_pairs,
-    .kern_scale = 16,
-    .cmap_num = 2,
-    .bpp = 4,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LV_VERSION_CHECK(8, 0, 0)
-    .cache = &cache
-#endif
-};
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LV_VERSION_CHECK(8, 0, 0)
-const lv_font_t ui_font_FontNumber28bp4 = {
-#else
-lv_font_t ui_font_FontNumber28bp4 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 31,          /*The maximum line height required by the font*/
-    .base_line = 7,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -3,
-    .underline_thickness = 1,
-#endif
-    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-};
-
-
-
-#endif /*#if UI_FONT_FONTNUMBER28BP4*/
-
@@ -1,3864 +0,0 @@
-/*******************************************************************************
- * Size: 36 px
- * Bpp: 4
- * Opts: --bpp 4 --size 36 --font /home/lvhaiyu/SquareLine/assets/AlimamaShuHeiTi-Bold.ttf -o /home/lvhaiyu/SquareLine/assets/ui_font_FontNumber36bp4.c --format lvgl -r 0x20-0x7f --symbols 星期一二三四五六日 --no-compress --no-prefilter
- ******************************************************************************/
-
-#include "../ui.h"
-
-#ifndef UI_FONT_FONTNUMBER36BP4
-#define UI_FONT_FONTNUMBER36BP4 1
-#endif
-
-#if UI_FONT_FONTNUMBER36BP4
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0x3f, 0xff, 0xff, 0x82, 0xff, 0xff, 0xf7, 0x1f,
-    0xff, 0xff, 0x71, 0xff, 0xff, 0xf6, 0xf, 0xff,
-    0xff, 0x50, 0xff, 0xff, 0xf5, 0xf, 0xff, 0xff,
-    0x40, 0xef, 0xff, 0xf3, 0xe, 0xff, 0xff, 0x30,
-    0xdf, 0xff, 0xf2, 0xc, 0xff, 0xff, 0x10, 0xcf,
-    0xff, 0xf1, 0xb, 0xff, 0xff, 0x0, 0xaf, 0xff,
-    0xf0, 0xa, 0xff, 0xff, 0x0, 0x9f, 0xff, 0xe0,
-    0x7, 0xee, 0xec, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf9, 0x4f, 0xff,
-    0xff, 0xa4, 0xff, 0xff, 0xfa, 0x4f, 0xff, 0xff,
-    0xa4, 0xff, 0xff, 0xfa, 0x4f, 0xff, 0xff, 0xa0,
-
-    /* U+0022 "\"" */
-    0x4b, 0xbb, 0xb7, 0x7, 0xbb, 0xbb, 0x45, 0xff,
-    0xff, 0x80, 0x9f, 0xff, 0xf4, 0x3f, 0xff, 0xf7,
-    0x8, 0xff, 0xff, 0x32, 0xff, 0xff, 0x50, 0x6f,
-    0xff, 0xf1, 0xf, 0xff, 0xf4, 0x5, 0xff, 0xff,
-    0x0, 0xff, 0xff, 0x30, 0x4f, 0xff, 0xe0, 0xd,
-    0xff, 0xf1, 0x2, 0xff, 0xfd, 0x0, 0xcf, 0xff,
-    0x0, 0x1f, 0xff, 0xc0, 0xa, 0xff, 0xe0, 0x0,
-    0xff, 0xfa, 0x0, 0x9f, 0xfd, 0x0, 0xe, 0xff,
-    0x90, 0x7, 0xff, 0xc0, 0x0, 0xcf, 0xf7, 0x0,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0x0, 0xff, 0xff, 0x40, 0x0, 0xc,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0x10, 0x0, 0xf, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xfd, 0x0, 0x0, 0x2f, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xfa, 0x0, 0x0,
-    0x5f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xf7, 0x0, 0x0, 0x8f, 0xff, 0xb0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x6c, 0xcc, 0xef, 0xff, 0xfc, 0xcc, 0xcd, 0xff,
-    0xff, 0xcc, 0xc0, 0x0, 0x0, 0xaf, 0xff, 0xa0,
-    0x0, 0x5, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0x80, 0x0, 0x7, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0x60, 0x0, 0x9,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0x40, 0x0, 0xb, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0x10, 0x0, 0xe, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0x0, 0x0,
-    0xf, 0xff, 0xf4, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x5b, 0xbf,
-    0xff, 0xfc, 0xbb, 0xbb, 0xef, 0xff, 0xdb, 0xbb,
-    0xb0, 0x0, 0x1f, 0xff, 0xf2, 0x0, 0x0, 0xdf,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf0,
-    0x0, 0x0, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xc0, 0x0, 0x2, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xa0, 0x0, 0x5,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0x70, 0x0, 0x7, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0x50, 0x0, 0xa, 0xff, 0xf9,
-    0x0, 0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x0, 0xbe, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5a, 0xdf, 0xff, 0xff, 0xed, 0xb9, 0x40, 0x0,
-    0x2, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x1, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0xd, 0xff, 0xff, 0xc6,
-    0xcf, 0xf3, 0x46, 0x8b, 0xc0, 0x0, 0xff, 0xff,
-    0xe0, 0xc, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xfb, 0x0, 0xcf, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xc0, 0xc, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0x20, 0xcf, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x9d,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x61, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x30, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x2, 0x7c, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xfe, 0x18, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xe0, 0xa, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0xc, 0xfe, 0x0, 0x6f, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xe0, 0x7,
-    0xff, 0xff, 0x60, 0x30, 0x0, 0x0, 0xc, 0xfe,
-    0x0, 0xdf, 0xff, 0xf4, 0x2f, 0xfd, 0xa9, 0x87,
-    0xdf, 0xf9, 0xef, 0xff, 0xff, 0x12, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd3, 0x0, 0x6, 0x9c, 0xde, 0xff, 0xff, 0xff,
-    0xda, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xfe, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x0, 0x4b, 0xef, 0xeb, 0x40, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xfc, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf3,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x7f, 0xff, 0xa0, 0x0, 0x0, 0x6f,
-    0xff, 0x95, 0x8f, 0xff, 0x80, 0x0, 0x1, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x9f, 0xfc, 0x0, 0xb,
-    0xff, 0xb0, 0x0, 0x9, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xbf, 0xf9, 0x0, 0x8, 0xff, 0xc0, 0x0,
-    0x2f, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xcf, 0xf8,
-    0x0, 0x8, 0xff, 0xd0, 0x0, 0xbf, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0xbf, 0xf9, 0x0, 0x8, 0xff,
-    0xc0, 0x4, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xfc, 0x0, 0xb, 0xff, 0xb0, 0xd, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0x95,
-    0x8f, 0xff, 0x80, 0x6f, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0xef, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xf8, 0x8, 0xff, 0xf9, 0x4,
-    0xbe, 0xfe, 0xa2, 0x0, 0x0, 0x4b, 0xef, 0xeb,
-    0x40, 0x2f, 0xff, 0xf1, 0x7f, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0x72, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xfe, 0x7, 0xff, 0xf9,
-    0x6a, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xf5, 0xb, 0xff, 0xb0, 0x0, 0xdf, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xc0, 0xd,
-    0xff, 0x80, 0x0, 0xaf, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0x30, 0xe, 0xff, 0x70, 0x0,
-    0x9f, 0xfb, 0x0, 0x0, 0x0, 0x7, 0xff, 0xfa,
-    0x0, 0xe, 0xff, 0x70, 0x0, 0x9f, 0xfb, 0x0,
-    0x0, 0x0, 0x1e, 0xff, 0xf2, 0x0, 0xd, 0xff,
-    0x80, 0x0, 0xaf, 0xfa, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0x90, 0x0, 0xb, 0xff, 0xb0, 0x0, 0xdf,
-    0xf8, 0x0, 0x0, 0x2, 0xff, 0xfe, 0x10, 0x0,
-    0x8, 0xff, 0xf9, 0x5a, 0xff, 0xf5, 0x0, 0x0,
-    0xb, 0xff, 0xf7, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x4f, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0xcf, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x4, 0xbe, 0xfe, 0xa3, 0x0,
-
-    /* U+0026 "&" */
-    0x0, 0x0, 0x0, 0x4, 0x9d, 0xef, 0xec, 0x71,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf,
-    0xff, 0xff, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xfb, 0x0, 0x6f, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xf4, 0x0, 0xf, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xf4, 0x0, 0x1f, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xf9, 0x0, 0xaf, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0x6c, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xb1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x3, 0xee, 0xee, 0x50,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x5, 0xff, 0xff, 0x40, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x8, 0xff, 0xff, 0x30,
-    0x2, 0xff, 0xff, 0xfc, 0x3d, 0xff, 0xff, 0xf3,
-    0xc, 0xff, 0xff, 0x0, 0xa, 0xff, 0xff, 0xd0,
-    0x1, 0xef, 0xff, 0xfe, 0x5f, 0xff, 0xfb, 0x0,
-    0xf, 0xff, 0xff, 0x50, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x2f, 0xff, 0xff, 0x20,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x1f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0xf, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x1d, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xfd, 0x64, 0x59, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x7f, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x16, 0xbd, 0xff, 0xec, 0x95, 0x10,
-    0xa, 0xff, 0xff, 0xd1,
-
-    /* U+0027 "'" */
-    0x4b, 0xbb, 0xb7, 0x5f, 0xff, 0xf8, 0x3f, 0xff,
-    0xf7, 0x2f, 0xff, 0xf5, 0xf, 0xff, 0xf4, 0xf,
-    0xff, 0xf3, 0xd, 0xff, 0xf1, 0xc, 0xff, 0xf0,
-    0xa, 0xff, 0xe0, 0x9, 0xff, 0xd0, 0x7, 0xff,
-    0xc0,
-
-    /* U+0028 "(" */
-    0x0, 0x0, 0x2, 0xbb, 0xbb, 0xb0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0x90, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0xbf, 0xff, 0xf9, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x6f, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xf9, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0xf, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0x30, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0x70, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xe0,
-
-    /* U+0029 ")" */
-    0x7b, 0xbb, 0xb7, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0xa, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0x20, 0x0, 0x0, 0xbf,
-    0xff, 0xf9, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x8f, 0xff, 0xfd, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0xe, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0xaf, 0xff, 0xfd, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0xff, 0xff, 0xf7, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0xcf, 0xff, 0xfb,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0xbf, 0xff, 0xfd, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0xcf, 0xff, 0xfc, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x70, 0x0,
-    0x5, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0x0, 0x0, 0xd, 0xff, 0xff, 0xb0, 0x0,
-    0x1, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0x10, 0x0, 0xc, 0xff, 0xff, 0xb0, 0x0,
-    0x2, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x9f, 0xff,
-    0xfd, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x50, 0x0,
-    0x8, 0xff, 0xff, 0xd0, 0x0, 0x1, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x8f, 0xff, 0xfb, 0x0, 0x0,
-    0x0,
-
-    /* U+002A "*" */
-    0x0, 0x0, 0xc, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0x40, 0x0, 0x0, 0x1,
-    0x0, 0x8, 0xff, 0xf2, 0x0, 0x1, 0x0, 0xdc,
-    0x40, 0x6f, 0xff, 0x0, 0x7e, 0x70, 0x2f, 0xff,
-    0xd8, 0xff, 0xe8, 0xff, 0xfc, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x25, 0x7b, 0xff,
-    0xff, 0xf9, 0x64, 0x10, 0x0, 0x1, 0xdf, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xef,
-    0xff, 0x70, 0x0, 0x0, 0xcf, 0xff, 0xc2, 0xff,
-    0xff, 0x60, 0x0, 0x3e, 0xff, 0xf4, 0xa, 0xff,
-    0xfb, 0x0, 0x0, 0x1b, 0xfc, 0x0, 0x2f, 0xf7,
-    0x0, 0x0, 0x0, 0x7, 0x30, 0x0, 0x73, 0x0,
-    0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x0, 0xb, 0xdd, 0xd9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x9, 0x99, 0x99, 0x99, 0xff, 0xff,
-    0xe9, 0x99, 0x99, 0x97, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+002C "," */
-    0x0, 0xa, 0xbb, 0xbb, 0x20, 0x2, 0xff, 0xff,
-    0xe0, 0x0, 0x7f, 0xff, 0xf8, 0x0, 0xc, 0xff,
-    0xff, 0x20, 0x1, 0xff, 0xff, 0xc0, 0x0, 0x5f,
-    0xff, 0xf5, 0x0, 0xa, 0xff, 0xff, 0x0, 0x0,
-    0xef, 0xff, 0x90, 0x0, 0x3f, 0xff, 0xf3, 0x0,
-    0x8, 0xff, 0xfd, 0x0, 0x0, 0xcf, 0xff, 0x70,
-    0x0, 0x0,
-
-    /* U+002D "-" */
-    0x23, 0x33, 0x33, 0x33, 0x33, 0x31, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xf6,
-
-    /* U+002E "." */
-    0xf, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xfd, 0xf,
-    0xff, 0xff, 0xd0, 0xff, 0xff, 0xfd, 0xf, 0xff,
-    0xff, 0xd0, 0xff, 0xff, 0xfd,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x88, 0x85, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0x60, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0x60, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x0, 0x2, 0x7c, 0xef, 0xed, 0x83, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0x95, 0x7e, 0xff, 0xff, 0xf2, 0x0,
-    0x5f, 0xff, 0xff, 0x50, 0x0, 0x2f, 0xff, 0xff,
-    0x90, 0xb, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x8f,
-    0xff, 0xfe, 0x0, 0xef, 0xff, 0xf6, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf2, 0x1f, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0x54, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf7, 0x5f,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0x86, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xf9, 0x6f, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xa6, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xf9, 0x5f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0x84, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf7,
-    0x1f, 0xff, 0xff, 0x30, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0x50, 0xef, 0xff, 0xf6, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf2, 0xb, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x8f, 0xff, 0xfe, 0x0, 0x5f, 0xff, 0xff,
-    0x50, 0x0, 0x2f, 0xff, 0xff, 0x90, 0x0, 0xef,
-    0xff, 0xff, 0x96, 0x8e, 0xff, 0xff, 0xf2, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x2, 0x7c,
-    0xef, 0xed, 0x93, 0x0, 0x0, 0x0,
-
-    /* U+0031 "1" */
-    0x0, 0x0, 0x19, 0xff, 0xff, 0xa0, 0x0, 0x7f,
-    0xff, 0xff, 0xfa, 0x5, 0xdf, 0xff, 0xff, 0xff,
-    0xa4, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xa5, 0xff, 0xff, 0xef, 0xff,
-    0xfa, 0x5f, 0xf9, 0x1a, 0xff, 0xff, 0xa4, 0x91,
-    0x0, 0xaf, 0xff, 0xfa, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0xaf, 0xff, 0xfa, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xa0, 0x0, 0x0, 0xaf,
-    0xff, 0xfa, 0x0, 0x0, 0xa, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0xaf, 0xff, 0xfa, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0xaf, 0xff, 0xfa,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0xaf, 0xff, 0xfa, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0xaf, 0xff, 0xfa, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xa0, 0x0, 0x0, 0xaf, 0xff,
-    0xfa, 0x0, 0x0, 0xa, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0xaf, 0xff, 0xfa, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xa0,
-
-    /* U+0032 "2" */
-    0x0, 0x0, 0x16, 0xad, 0xff, 0xec, 0x93, 0x0,
-    0x0, 0x0, 0x2, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x20, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x30, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x8, 0xff,
-    0xff, 0xda, 0xac, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x8f, 0xe7, 0x10, 0x0, 0x1, 0xbf, 0xff, 0xff,
-    0xb0, 0x8, 0x80, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x4, 0xef,
-    0xff, 0xff, 0xa5, 0x55, 0x55, 0x55, 0x55, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x10,
-
-    /* U+0033 "3" */
-    0x0, 0x15, 0x9c, 0xef, 0xfe, 0xc8, 0x30, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x10, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd1, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0xc, 0xfe, 0xa7, 0x55,
-    0x7c, 0xff, 0xff, 0xff, 0x0, 0x8, 0x40, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x38, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff,
-    0xe6, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff,
-    0xff, 0xd4, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x1, 0x22,
-    0x23, 0x5a, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf0, 0x30, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xf0, 0x8d, 0x60, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xb0, 0x8f, 0xff, 0xc9, 0x87,
-    0x9d, 0xff, 0xff, 0xff, 0x40, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x4d,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x27, 0xad, 0xef, 0xed, 0xb5, 0x10, 0x0,
-    0x0,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xbe, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xf3,
-    0xef, 0xff, 0xf5, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xfa, 0xe, 0xff, 0xff, 0x50, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0x10, 0xef, 0xff, 0xf5, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0x80, 0xe, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0xaf, 0xff, 0xe1, 0x0, 0xef, 0xff,
-    0xf5, 0x0, 0x0, 0x3f, 0xff, 0xf7, 0x0, 0xe,
-    0xff, 0xff, 0x50, 0x0, 0xc, 0xff, 0xfd, 0x0,
-    0x0, 0xef, 0xff, 0xf5, 0x0, 0x5, 0xff, 0xff,
-    0x50, 0x0, 0xe, 0xff, 0xff, 0x50, 0x0, 0xef,
-    0xff, 0xc0, 0x0, 0x0, 0xef, 0xff, 0xf5, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x35, 0x55,
-    0x55, 0x55, 0x55, 0x5f, 0xff, 0xff, 0x95, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0x50, 0x0,
-
-    /* U+0035 "5" */
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x8, 0xff, 0xff, 0xd5,
-    0x55, 0x55, 0x55, 0x54, 0x0, 0x8, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xd8, 0x98, 0x52, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb1, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0xb, 0xe9, 0x52, 0x10,
-    0x28, 0xff, 0xff, 0xff, 0x60, 0x2, 0x0, 0x0,
-    0x0, 0x0, 0x2e, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xf2, 0x98, 0x20, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xe0, 0xaf, 0xfd, 0xa7, 0x65,
-    0x7c, 0xff, 0xff, 0xff, 0x70, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x1, 0x69, 0xbd, 0xff, 0xfe, 0xc7, 0x20, 0x0,
-    0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x0, 0x0, 0x4, 0x9c, 0xef, 0xfd, 0xc9,
-    0x50, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xfc, 0x86, 0x56, 0x8c, 0xe0, 0x0,
-    0xd, 0xff, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf3, 0x59, 0xce,
-    0xed, 0xa5, 0x0, 0x0, 0xc, 0xff, 0xff, 0xef,
-    0xff, 0xff, 0xff, 0xfd, 0x10, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x3, 0xff, 0xff, 0xff, 0xd4, 0x0, 0x5e, 0xff,
-    0xff, 0xe0, 0x4f, 0xff, 0xff, 0xe1, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x35, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xf6, 0x4f, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0xc, 0xff, 0xff, 0x73, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf8,
-    0x1f, 0xff, 0xff, 0x40, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0x70, 0xef, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xf6, 0xa, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0x30, 0x5f, 0xff, 0xff,
-    0x50, 0x0, 0xa, 0xff, 0xff, 0xe0, 0x0, 0xef,
-    0xff, 0xff, 0xa6, 0x6b, 0xff, 0xff, 0xf8, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x10, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x20, 0x0, 0x0, 0x0, 0x2, 0x7c,
-    0xef, 0xfd, 0xa5, 0x0, 0x0, 0x0,
-
-    /* U+0037 "7" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x51, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x51, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x5, 0x55,
-    0x55, 0x55, 0x55, 0x55, 0xef, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x0, 0x5, 0xad, 0xef, 0xfe, 0xb7, 0x20,
-    0x0, 0x0, 0x0, 0x5e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x7, 0xff,
-    0xff, 0xfc, 0x75, 0x6a, 0xff, 0xff, 0xfc, 0x0,
-    0xaf, 0xff, 0xfc, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xe0, 0xb, 0xff, 0xff, 0x80, 0x0, 0x0, 0x4f,
-    0xff, 0xfe, 0x0, 0x8f, 0xff, 0xfb, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xb0, 0x2, 0xff, 0xff, 0xfa,
-    0x42, 0x39, 0xff, 0xff, 0xf4, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x3d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x40, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0xc, 0xff, 0xff,
-    0xf8, 0x20, 0x26, 0xef, 0xff, 0xfe, 0x2, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf6,
-    0x6f, 0xff, 0xfe, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0x97, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xfb, 0x7f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xa4, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf8, 0xf, 0xff,
-    0xff, 0xfd, 0x76, 0x7b, 0xff, 0xff, 0xff, 0x30,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd1, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x16, 0xad,
-    0xff, 0xfe, 0xb7, 0x10, 0x0, 0x0,
-
-    /* U+0039 "9" */
-    0x0, 0x0, 0x5, 0xad, 0xef, 0xec, 0x83, 0x0,
-    0x0, 0x0, 0x0, 0x3d, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x10, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x1e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x9, 0xff,
-    0xff, 0xfc, 0x76, 0x8f, 0xff, 0xff, 0xf2, 0x0,
-    0xef, 0xff, 0xfa, 0x0, 0x0, 0x1d, 0xff, 0xff,
-    0x80, 0x2f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x5f,
-    0xff, 0xfe, 0x4, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xf2, 0x5f, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0x44, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf6, 0x2f,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0x70, 0xef, 0xff, 0xff, 0x61, 0x2, 0x9f, 0xff,
-    0xff, 0xf8, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x1e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x2d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x6, 0xbe, 0xff, 0xeb, 0x71, 0xef, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf6, 0x0, 0x6, 0x10, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0x10, 0x0, 0xbf,
-    0xb6, 0x55, 0x8d, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x60, 0x0, 0x0, 0x0, 0x49, 0xcd, 0xef,
-    0xfd, 0xa5, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+003A ":" */
-    0xbf, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xf3, 0xbf,
-    0xff, 0xff, 0x3b, 0xff, 0xff, 0xf3, 0xbf, 0xff,
-    0xff, 0x3a, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xf3,
-    0xbf, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xf3, 0xbf,
-    0xff, 0xff, 0x3b, 0xff, 0xff, 0xf3,
-
-    /* U+003B ";" */
-    0x0, 0xa, 0xff, 0xff, 0xf4, 0x0, 0xa, 0xff,
-    0xff, 0xf4, 0x0, 0xa, 0xff, 0xff, 0xf4, 0x0,
-    0xa, 0xff, 0xff, 0xf4, 0x0, 0xa, 0xff, 0xff,
-    0xf4, 0x0, 0x9, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xbb, 0xbb, 0xb0, 0x0, 0x6,
-    0xff, 0xff, 0xa0, 0x0, 0xb, 0xff, 0xff, 0x40,
-    0x0, 0xf, 0xff, 0xfe, 0x0, 0x0, 0x4f, 0xff,
-    0xf8, 0x0, 0x0, 0x9f, 0xff, 0xf2, 0x0, 0x0,
-    0xef, 0xff, 0xc0, 0x0, 0x2, 0xff, 0xff, 0x50,
-    0x0, 0x7, 0xff, 0xff, 0x0, 0x0, 0xc, 0xff,
-    0xf9, 0x0, 0x0, 0x1f, 0xff, 0xf3, 0x0, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x17, 0xdc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xaf, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6d, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x29, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x5, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xc5, 0x0, 0x2, 0x8e, 0xff, 0xff, 0xff, 0xff,
-    0xe9, 0x20, 0x0, 0x5b, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x50, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xfe, 0x82, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xd7, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xfb, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xe9, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff,
-    0xc6, 0x0, 0x0, 0x0, 0x0, 0x17, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0x93, 0x0, 0x0, 0x0, 0x0,
-    0x4a, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x71, 0x0,
-    0x0, 0x0, 0x1, 0x7e, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x30, 0x0, 0x0, 0x0, 0x4, 0xbf, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x28, 0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5c, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x9f, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4,
-
-    /* U+003D "=" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xda, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc,
-
-    /* U+003E ">" */
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xc6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xfe, 0x92, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfb,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xe8, 0x10, 0x0, 0x0, 0x0, 0x7,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x0, 0x0,
-    0x0, 0x0, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x71, 0x0, 0x0, 0x0, 0x0, 0x6c, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x30, 0x0, 0x0, 0x0, 0x3,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xcf, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0xef, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6c,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3a,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x17,
-    0xdf, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x4,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x0, 0x1,
-    0x8e, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x30, 0x0,
-    0x5b, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x60, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xa3, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xd7, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xfb, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xfe, 0x81,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+003F "?" */
-    0x49, 0xce, 0xff, 0xff, 0xdb, 0x71, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xa, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x9d, 0xa9,
-    0x88, 0xae, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xd2,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xdd, 0xdd, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xad, 0xdd, 0xdd, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x27, 0xad, 0xef,
-    0xfe, 0xca, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xfd,
-    0x84, 0x21, 0x23, 0x59, 0xef, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xd4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x20, 0x0,
-    0x1e, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf9, 0x0, 0xa, 0xff,
-    0xff, 0x90, 0x0, 0x6, 0xbe, 0xd8, 0x5, 0x88,
-    0x80, 0x6f, 0xff, 0xf0, 0x2, 0xff, 0xff, 0xc0,
-    0x0, 0x2d, 0xff, 0xff, 0xfb, 0xcf, 0xfe, 0x0,
-    0xef, 0xff, 0x40, 0x9f, 0xff, 0xf3, 0x0, 0x2e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0xa, 0xff,
-    0xf7, 0xe, 0xff, 0xfb, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x7f, 0xff, 0x93,
-    0xff, 0xff, 0x50, 0x7, 0xff, 0xff, 0x91, 0x1b,
-    0xff, 0xff, 0x40, 0x5, 0xff, 0xf9, 0x6f, 0xff,
-    0xf0, 0x0, 0xdf, 0xff, 0xc0, 0x0, 0x4f, 0xff,
-    0xf1, 0x0, 0x5f, 0xff, 0x89, 0xff, 0xfd, 0x0,
-    0x2f, 0xff, 0xf5, 0x0, 0x3, 0xff, 0xfe, 0x0,
-    0x6, 0xff, 0xf7, 0xaf, 0xff, 0xc0, 0x5, 0xff,
-    0xff, 0x0, 0x0, 0x5f, 0xff, 0xb0, 0x0, 0x7f,
-    0xff, 0x6b, 0xff, 0xfb, 0x0, 0x6f, 0xff, 0xe0,
-    0x0, 0xa, 0xff, 0xf9, 0x0, 0xa, 0xff, 0xf2,
-    0xaf, 0xff, 0xb0, 0x7, 0xff, 0xfe, 0x0, 0x1,
-    0xff, 0xff, 0x70, 0x0, 0xef, 0xfe, 0x9, 0xff,
-    0xfc, 0x0, 0x6f, 0xff, 0xf5, 0x1, 0xcf, 0xff,
-    0xf9, 0x0, 0x6f, 0xff, 0x80, 0x8f, 0xff, 0xf0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x9f, 0xff, 0xf1, 0x5, 0xff, 0xff, 0x30, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x1f, 0xff, 0xfa, 0x0, 0x2e, 0xff,
-    0xff, 0xff, 0xa0, 0xcf, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0xbf, 0xff, 0xf3, 0x0, 0x19, 0xdf, 0xeb,
-    0x50, 0x0, 0x7d, 0xfe, 0xb3, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff,
-    0xff, 0x96, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xaf, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x15, 0x9c, 0xef, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xed, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xa9, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x54,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0x10, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfd, 0x0, 0xcf, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf8, 0x0, 0x7f,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xf4, 0x0, 0x3f, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xf0,
-    0x0, 0xf, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xb0, 0x0, 0xa, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0x70, 0x0, 0x6, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x85, 0x55,
-    0x57, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x40, 0x7, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0x90, 0xc, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xd0,
-    0x1f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xf2,
-
-    /* U+0042 "B" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xa5,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x20, 0x0, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x20, 0xd,
-    0xff, 0xff, 0xfc, 0xcc, 0xcd, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x1,
-    0xcf, 0xff, 0xff, 0xf0, 0xd, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x30, 0xdf,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xf3, 0xd, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0x10, 0xdf, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x90, 0xd, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x4e, 0xff, 0xff, 0xd0,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb1, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x10, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x30,
-    0xd, 0xff, 0xff, 0xf8, 0x88, 0x88, 0xad, 0xff,
-    0xff, 0xff, 0x30, 0xdf, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xfe, 0xd, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf6,
-    0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xbd, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xfc, 0xdf, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xbd,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf9, 0xdf, 0xff, 0xff, 0x66, 0x66, 0x66,
-    0x9f, 0xff, 0xff, 0xff, 0x4d, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe1, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc1, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd9, 0x40, 0x0, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x0, 0x0, 0x5, 0x9c, 0xef, 0xff,
-    0xeb, 0x95, 0x10, 0x0, 0x0, 0x0, 0x29, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xda, 0x99, 0x9b, 0xef, 0xfd, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0x92, 0x0, 0x0, 0x0,
-    0x1, 0x68, 0x1, 0xff, 0xff, 0xff, 0xe3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xc5, 0x0,
-    0x0, 0x0, 0x3, 0x9c, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0xaa, 0xac, 0xff, 0xfd, 0x0,
-    0x1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x15, 0x9c, 0xef, 0xff,
-    0xed, 0xb7, 0x30,
-
-    /* U+0044 "D" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xc8, 0x40,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x60, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0xdf, 0xff, 0xff, 0x87,
-    0x77, 0x8d, 0xff, 0xff, 0xff, 0xfa, 0x0, 0xdf,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0x40, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xb0, 0xdf, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf2,
-    0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xf6, 0xdf, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xf9, 0xdf, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xfb, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xfc, 0xdf, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfd, 0xdf,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xfc, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xfb, 0xdf, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfa,
-    0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xf6, 0xdf, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xf3, 0xdf, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xd0, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0x60, 0xdf, 0xff, 0xff, 0x87,
-    0x77, 0x9d, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe1, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x10, 0x0, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x70, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xc8, 0x40,
-    0x0, 0x0, 0x0,
-
-    /* U+0045 "E" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xec, 0xdf, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x50, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x50, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0xdf, 0xff,
-    0xff, 0xa9, 0x99, 0x99, 0x99, 0x99, 0x30, 0xdf,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xec, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe,
-
-    /* U+0046 "F" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xdf, 0xff, 0xff, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xcd, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0xd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0xdf,
-    0xff, 0xff, 0x99, 0x99, 0x99, 0x99, 0x93, 0xd,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x8b, 0xef, 0xff,
-    0xdb, 0x85, 0x10, 0x0, 0x0, 0x0, 0x0, 0x7e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x4, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xc9, 0x88, 0x9a, 0xcf,
-    0xfd, 0x0, 0x4, 0xff, 0xff, 0xff, 0xe7, 0x10,
-    0x0, 0x0, 0x0, 0x3, 0x50, 0x0, 0xef, 0xff,
-    0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0x87, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xf8, 0x8f, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0x88, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xf8, 0x7f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x28, 0x8b, 0xff, 0xff, 0x84, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8,
-    0x1f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x80, 0xaf, 0xff, 0xff, 0xe2,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf8, 0x3,
-    0xff, 0xff, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0x80, 0x9, 0xff, 0xff, 0xff, 0xfa,
-    0x40, 0x0, 0x0, 0x7f, 0xff, 0xf8, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0xcb, 0xce, 0xff,
-    0xff, 0x80, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x2, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd4, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0x9c, 0xef, 0xff, 0xed, 0xb7, 0x30, 0x0,
-
-    /* U+0048 "H" */
-    0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfb, 0xdf, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfb, 0xdf, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfb, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfb, 0xdf, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfb, 0xdf,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfb, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xfb, 0xdf, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfb,
-    0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfb, 0xdf, 0xff, 0xff, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xff, 0xff, 0xfb, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xfb, 0xdf, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfb,
-    0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfb, 0xdf, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfb, 0xdf, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfb, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xfb, 0xdf, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfb, 0xdf,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfb, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xfb, 0xdf, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfb,
-    0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfb,
-
-    /* U+0049 "I" */
-    0xbf, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xf3, 0xbf,
-    0xff, 0xff, 0x3b, 0xff, 0xff, 0xf3, 0xbf, 0xff,
-    0xff, 0x3b, 0xff, 0xff, 0xf3, 0xbf, 0xff, 0xff,
-    0x3b, 0xff, 0xff, 0xf3, 0xbf, 0xff, 0xff, 0x3b,
-    0xff, 0xff, 0xf3, 0xbf, 0xff, 0xff, 0x3b, 0xff,
-    0xff, 0xf3, 0xbf, 0xff, 0xff, 0x3b, 0xff, 0xff,
-    0xf3, 0xbf, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xf3,
-    0xbf, 0xff, 0xff, 0x3b, 0xff, 0xff, 0xf3, 0xbf,
-    0xff, 0xff, 0x3b, 0xff, 0xff, 0xf3, 0xbf, 0xff,
-    0xff, 0x3b, 0xff, 0xff, 0xf3, 0xbf, 0xff, 0xff,
-    0x3b, 0xff, 0xff, 0xf3, 0xbf, 0xff, 0xff, 0x30,
-
-    /* U+004A "J" */
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xb0, 0x0, 0x3,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xb0, 0x0, 0x3, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xb0, 0x0, 0x3, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xb0, 0x0,
-    0x3, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xb0, 0x0, 0x3, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xb0, 0x0, 0x3, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xb0,
-    0x0, 0x3, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xb0, 0x0, 0x3, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xb0, 0x0, 0x3,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xb0, 0x0, 0x3, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xb0, 0x0, 0x4, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x90, 0x0,
-    0xd, 0xff, 0xff, 0xf7, 0x0, 0x2a, 0xff, 0xff,
-    0xff, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xbf,
-    0xff, 0xff, 0xff, 0xf5, 0xb, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0xbf, 0xff, 0xff, 0xf6, 0x0, 0xb,
-    0xff, 0xfc, 0x71, 0x0, 0x0, 0x33, 0x20, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+004B "K" */
-    0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0x90, 0xd, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xd0, 0x0, 0xdf,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xf2, 0x0, 0xd, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x1e, 0xff, 0xff, 0xf7, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x10, 0x0, 0xb, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xf1, 0x0, 0x6, 0xff,
-    0xff, 0xfe, 0x10, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0x10, 0x2, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xf1, 0x0, 0xcf, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x10,
-    0x8f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xf1, 0x3f, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf1,
-    0x3, 0xef, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0x10, 0x2, 0xef, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf1, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0x10, 0x0, 0x5, 0xff, 0xff, 0xfe,
-    0x10, 0x0, 0xd, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xfb, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf6,
-    0x0, 0xd, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xe1, 0x0, 0xdf, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xa0,
-    0xd, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0x40, 0xdf, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfd, 0x0,
-
-    /* U+004C "L" */
-    0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0x4d, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x4d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x40,
-
-    /* U+004D "M" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xdf, 0xff, 0xff, 0xdf, 0xff, 0xf5, 0x0, 0x0,
-    0x6f, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xdf, 0xff,
-    0xfe, 0x9f, 0xff, 0xf8, 0x0, 0x0, 0x9f, 0xff,
-    0xf9, 0xef, 0xff, 0xfd, 0xdf, 0xff, 0xfe, 0x6f,
-    0xff, 0xfb, 0x0, 0x0, 0xcf, 0xff, 0xf5, 0xef,
-    0xff, 0xfd, 0xdf, 0xff, 0xfe, 0x2f, 0xff, 0xfe,
-    0x0, 0x0, 0xff, 0xff, 0xf2, 0xef, 0xff, 0xfd,
-    0xdf, 0xff, 0xfe, 0xf, 0xff, 0xff, 0x10, 0x2,
-    0xff, 0xff, 0xf0, 0xef, 0xff, 0xfd, 0xdf, 0xff,
-    0xfe, 0xc, 0xff, 0xff, 0x40, 0x5, 0xff, 0xff,
-    0xb0, 0xef, 0xff, 0xfd, 0xdf, 0xff, 0xfe, 0x8,
-    0xff, 0xff, 0x70, 0x8, 0xff, 0xff, 0x80, 0xef,
-    0xff, 0xfd, 0xdf, 0xff, 0xfe, 0x5, 0xff, 0xff,
-    0xa0, 0xb, 0xff, 0xff, 0x50, 0xef, 0xff, 0xfd,
-    0xdf, 0xff, 0xfe, 0x2, 0xff, 0xff, 0xd0, 0xe,
-    0xff, 0xff, 0x10, 0xef, 0xff, 0xfd, 0xdf, 0xff,
-    0xfe, 0x0, 0xef, 0xff, 0xf1, 0x1f, 0xff, 0xfe,
-    0x0, 0xef, 0xff, 0xfd, 0xdf, 0xff, 0xfe, 0x0,
-    0xbf, 0xff, 0xf4, 0x4f, 0xff, 0xfa, 0x0, 0xef,
-    0xff, 0xfd, 0xdf, 0xff, 0xfe, 0x0, 0x8f, 0xff,
-    0xf7, 0x7f, 0xff, 0xf7, 0x0, 0xef, 0xff, 0xfd,
-    0xdf, 0xff, 0xfe, 0x0, 0x4f, 0xff, 0xfa, 0xaf,
-    0xff, 0xf4, 0x0, 0xef, 0xff, 0xfd, 0xdf, 0xff,
-    0xfe, 0x0, 0x1f, 0xff, 0xfd, 0xdf, 0xff, 0xf0,
-    0x0, 0xef, 0xff, 0xfd, 0xdf, 0xff, 0xfe, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0xef,
-    0xff, 0xfd, 0xdf, 0xff, 0xfe, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0xef, 0xff, 0xfd,
-    0xdf, 0xff, 0xfe, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0xef, 0xff, 0xfd, 0xdf, 0xff,
-    0xfe, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0xef, 0xff, 0xfd, 0xdf, 0xff, 0xfe, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0xef,
-    0xff, 0xfd, 0xdf, 0xff, 0xfe, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0xef, 0xff, 0xfd,
-    0xdf, 0xff, 0xfe, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0xef, 0xff, 0xfd,
-
-    /* U+004E "N" */
-    0xdf, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0xef, 0xff, 0xff, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xdf,
-    0xff, 0xff, 0xef, 0xff, 0xf4, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xdf, 0xff, 0xff, 0x8f, 0xff, 0xf9,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xdf, 0xff, 0xff,
-    0x3f, 0xff, 0xfe, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xdf, 0xff, 0xff, 0xe, 0xff, 0xff, 0x30, 0x0,
-    0xef, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x9, 0xff,
-    0xff, 0x80, 0x0, 0xef, 0xff, 0xff, 0xdf, 0xff,
-    0xff, 0x4, 0xff, 0xff, 0xd0, 0x0, 0xef, 0xff,
-    0xff, 0xdf, 0xff, 0xff, 0x0, 0xef, 0xff, 0xf2,
-    0x0, 0xef, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x0,
-    0xaf, 0xff, 0xf7, 0x0, 0xef, 0xff, 0xff, 0xdf,
-    0xff, 0xff, 0x0, 0x5f, 0xff, 0xfb, 0x0, 0xef,
-    0xff, 0xff, 0xdf, 0xff, 0xff, 0x0, 0xf, 0xff,
-    0xff, 0x10, 0xef, 0xff, 0xff, 0xdf, 0xff, 0xff,
-    0x0, 0xb, 0xff, 0xff, 0x50, 0xef, 0xff, 0xff,
-    0xdf, 0xff, 0xff, 0x0, 0x6, 0xff, 0xff, 0xa0,
-    0xef, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x0, 0x1,
-    0xff, 0xff, 0xf0, 0xef, 0xff, 0xff, 0xdf, 0xff,
-    0xff, 0x0, 0x0, 0xcf, 0xff, 0xf4, 0xef, 0xff,
-    0xff, 0xdf, 0xff, 0xff, 0x0, 0x0, 0x7f, 0xff,
-    0xfa, 0xef, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf,
-    0xff, 0xff, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xdf, 0xff, 0xff, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xdf, 0xff, 0xff, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xff, 0xff,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x0, 0x0, 0x49, 0xce, 0xff, 0xed,
-    0xb7, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x1e,
-    0xff, 0xff, 0xff, 0xfc, 0x88, 0x9e, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xc2, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xc0, 0x0, 0xaf,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0x30, 0xf, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf8, 0x3, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xc0, 0x6f,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0x7, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xf0, 0x8f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x18,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xf1, 0x7f, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0x5, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xd0,
-    0x1f, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xfa, 0x0, 0xdf, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0x50, 0x6, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xe0,
-    0x0, 0xe, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x3, 0xdf, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0xea, 0x76, 0x8c, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0x4e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x59, 0xce, 0xff, 0xfd, 0xb8, 0x30, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0050 "P" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc8,
-    0x20, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xd,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0xdf, 0xff, 0xff, 0xcc, 0xcc, 0xcc,
-    0xef, 0xff, 0xff, 0xff, 0x1d, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x2c, 0xff, 0xff, 0xf6, 0xdf,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x1e, 0xff,
-    0xff, 0x9d, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xfb, 0xdf, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xbd, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
-    0xfa, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x2,
-    0xcf, 0xff, 0xff, 0x6d, 0xff, 0xff, 0xfc, 0xcc,
-    0xcc, 0xce, 0xff, 0xff, 0xff, 0xf1, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xec, 0x82, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x0, 0x0, 0x38, 0xbe, 0xff, 0xfd,
-    0xa6, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0xfa, 0x76, 0x7b, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xa1, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xf6,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xe0, 0x0, 0x9f,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0x60, 0xe, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xfc, 0x3, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf0, 0x6f,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0x38, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf5, 0x8f, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x58,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xf5, 0x7f, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0x44, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf1,
-    0x1f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xfe, 0x0, 0xcf, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0x80, 0x5, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf2,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0x91, 0x0, 0x0,
-    0x2, 0xbf, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xfb, 0x98, 0x9c, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0x2d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x48, 0xbe, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0x88, 0x88, 0x20,
-    0x0, 0x0,
-
-    /* U+0052 "R" */
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xa6,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe4, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0xdf, 0xff, 0xff, 0x32,
-    0x22, 0x22, 0x5b, 0xff, 0xff, 0xf8, 0x0, 0xdf,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xfd, 0x0, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0x0, 0xdf, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x0,
-    0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0x0, 0xdf, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xfd, 0x0, 0xdf, 0xff,
-    0xff, 0x32, 0x22, 0x23, 0x5b, 0xff, 0xff, 0xf8,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc6, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0x10, 0x9f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0x10, 0xa, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x10, 0x0,
-    0xbf, 0xff, 0xff, 0x80, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x10, 0x0, 0x1e, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x4, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0x90, 0x0, 0xdf,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xf3, 0x0, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xfc, 0x0, 0xdf, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x40,
-    0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xc0,
-
-    /* U+0053 "S" */
-    0x0, 0x0, 0x27, 0xce, 0xff, 0xfe, 0xc9, 0x61,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0xe, 0xff,
-    0xff, 0xff, 0xa8, 0x89, 0xbe, 0xff, 0x90, 0x4,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x2, 0x66,
-    0x0, 0x6f, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xe3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xfa, 0x30, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xd8, 0x30, 0x0, 0x0,
-    0x0, 0x4, 0xef, 0xff, 0xff, 0xff, 0xff, 0xc5,
-    0x0, 0x0, 0x0, 0x1, 0x8e, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x10, 0x0, 0x0, 0x0, 0x4, 0x9e,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xcf, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xf4, 0x9a, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0x4a, 0xff, 0xc6, 0x20,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xf1, 0xaf, 0xff,
-    0xff, 0xec, 0xaa, 0xdf, 0xff, 0xff, 0xfc, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x7d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x3, 0x7a, 0xde,
-    0xff, 0xfe, 0xb6, 0x10, 0x0, 0x0,
-
-    /* U+0054 "T" */
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x5e, 0xee, 0xee, 0xef, 0xff, 0xff, 0xfe, 0xee,
-    0xee, 0xe7, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0,
-
-    /* U+0055 "U" */
-    0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0x4d, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xf4, 0xdf,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0x4d, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xf4, 0xdf, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0x4d, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xf4, 0xdf, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0x4d, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xf4, 0xdf, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x4d,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xf4, 0xdf, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x4d, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xf4, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0x4d, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xf4, 0xdf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0x4c, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf4,
-    0xbf, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0x29, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf0, 0x4f,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xfb, 0x0, 0xef, 0xff, 0xff, 0xfd, 0x73,
-    0x24, 0xaf, 0xff, 0xff, 0xff, 0x50, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x0,
-    0x0, 0x0, 0x4, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x38,
-    0xce, 0xff, 0xed, 0xa6, 0x10, 0x0, 0x0, 0x0,
-
-    /* U+0056 "V" */
-    0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xf5, 0x2f, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xf0, 0xd, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xb0, 0x8,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x60, 0x3, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0xef, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0x10, 0x0, 0x4, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0x60, 0x0, 0x8, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xb0, 0x0,
-    0xd, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x2f, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xf4, 0x0, 0x6f, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xf8, 0x0, 0xbf,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfd, 0x0, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0x24, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0x69, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xbd, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0057 "W" */
-    0x5f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xe0, 0x1f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xa0, 0xd, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0x60, 0x9, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0x30, 0x5, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0xff, 0xff, 0xfe, 0x0, 0x1, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x3, 0xff, 0xff, 0xfb, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x6, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0x20, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x9, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0x50, 0x0, 0x8f, 0xff,
-    0xef, 0xff, 0xf2, 0x0, 0xc, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0x80, 0x0, 0xbf,
-    0xff, 0x9f, 0xff, 0xf5, 0x0, 0xf, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xb0, 0x0,
-    0xef, 0xff, 0x6c, 0xff, 0xf8, 0x0, 0x2f, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0xa, 0xff, 0xff, 0xe0,
-    0x1, 0xff, 0xff, 0x39, 0xff, 0xfb, 0x0, 0x5f,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xf1, 0x5, 0xff, 0xff, 0x7, 0xff, 0xfe, 0x0,
-    0x8f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xf4, 0x8, 0xff, 0xfe, 0x4, 0xff, 0xff,
-    0x10, 0xbf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xf7, 0xb, 0xff, 0xfb, 0x1, 0xff,
-    0xff, 0x40, 0xef, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xfa, 0xe, 0xff, 0xf8, 0x0,
-    0xef, 0xff, 0x71, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xfe, 0x1f, 0xff, 0xf5,
-    0x0, 0xcf, 0xff, 0xa4, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x5f, 0xff,
-    0xf3, 0x0, 0x9f, 0xff, 0xd7, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xbf,
-    0xff, 0xf0, 0x0, 0x6f, 0xff, 0xfb, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0xe, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0,
-
-    /* U+0058 "X" */
-    0x2f, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xf6, 0x6, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0xaf, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xfe, 0x10, 0x0,
-    0x1e, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x3, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf3, 0x0,
-    0xd, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xfd, 0x0, 0x9f, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0x95, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xff, 0xff, 0xa6, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfe,
-    0x10, 0xbf, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xf5, 0x0, 0x1e, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x5, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xfe, 0x10, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x1e, 0xff,
-    0xff, 0xfc, 0x0, 0x3, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0x80,
-    0xd, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xf3,
-
-    /* U+0059 "Y" */
-    0x5f, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xb0, 0xcf, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf2, 0x3,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xf9, 0x0, 0xa, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x2f,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xa0, 0x0,
-    0x4f, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0xff, 0x20, 0xc, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xf9, 0x4, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xf2, 0xcf, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xdf, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x2d, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xde, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xfe,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe5, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6,
-
-    /* U+005B "[" */
-    0x7f, 0xff, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff,
-    0xff, 0xf2, 0x7f, 0xff, 0xff, 0xff, 0xf2, 0x7f,
-    0xff, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff, 0xff,
-    0xf2, 0x7f, 0xff, 0xfc, 0x44, 0x40, 0x7f, 0xff,
-    0xfb, 0x0, 0x0, 0x7f, 0xff, 0xfb, 0x0, 0x0,
-    0x7f, 0xff, 0xfb, 0x0, 0x0, 0x7f, 0xff, 0xfb,
-    0x0, 0x0, 0x7f, 0xff, 0xfb, 0x0, 0x0, 0x7f,
-    0xff, 0xfb, 0x0, 0x0, 0x7f, 0xff, 0xfb, 0x0,
-    0x0, 0x7f, 0xff, 0xfb, 0x0, 0x0, 0x7f, 0xff,
-    0xfb, 0x0, 0x0, 0x7f, 0xff, 0xfb, 0x0, 0x0,
-    0x7f, 0xff, 0xfb, 0x0, 0x0, 0x7f, 0xff, 0xfb,
-    0x0, 0x0, 0x7f, 0xff, 0xfb, 0x0, 0x0, 0x7f,
-    0xff, 0xfb, 0x0, 0x0, 0x7f, 0xff, 0xfb, 0x0,
-    0x0, 0x7f, 0xff, 0xfb, 0x0, 0x0, 0x7f, 0xff,
-    0xfb, 0x0, 0x0, 0x7f, 0xff, 0xfb, 0x0, 0x0,
-    0x7f, 0xff, 0xfb, 0x0, 0x0, 0x7f, 0xff, 0xfb,
-    0x0, 0x0, 0x7f, 0xff, 0xfb, 0x0, 0x0, 0x7f,
-    0xff, 0xfb, 0x0, 0x0, 0x7f, 0xff, 0xfb, 0x0,
-    0x0, 0x7f, 0xff, 0xfc, 0x44, 0x40, 0x7f, 0xff,
-    0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff, 0xff, 0xf2,
-    0x7f, 0xff, 0xff, 0xff, 0xf2, 0x7f, 0xff, 0xff,
-    0xff, 0xf2, 0x7f, 0xff, 0xff, 0xff, 0xf2,
-
-    /* U+005C "\\" */
-    0x4f, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf8,
-
-    /* U+005D "]" */
-    0x3f, 0xff, 0xff, 0xff, 0xf6, 0x3f, 0xff, 0xff,
-    0xff, 0xf6, 0x3f, 0xff, 0xff, 0xff, 0xf6, 0x3f,
-    0xff, 0xff, 0xff, 0xf6, 0x3f, 0xff, 0xff, 0xff,
-    0xf6, 0x4, 0x44, 0xef, 0xff, 0xf6, 0x0, 0x0,
-    0xdf, 0xff, 0xf6, 0x0, 0x0, 0xdf, 0xff, 0xf6,
-    0x0, 0x0, 0xdf, 0xff, 0xf6, 0x0, 0x0, 0xdf,
-    0xff, 0xf6, 0x0, 0x0, 0xdf, 0xff, 0xf6, 0x0,
-    0x0, 0xdf, 0xff, 0xf6, 0x0, 0x0, 0xdf, 0xff,
-    0xf6, 0x0, 0x0, 0xdf, 0xff, 0xf6, 0x0, 0x0,
-    0xdf, 0xff, 0xf6, 0x0, 0x0, 0xdf, 0xff, 0xf6,
-    0x0, 0x0, 0xdf, 0xff, 0xf6, 0x0, 0x0, 0xdf,
-    0xff, 0xf6, 0x0, 0x0, 0xdf, 0xff, 0xf6, 0x0,
-    0x0, 0xdf, 0xff, 0xf6, 0x0, 0x0, 0xdf, 0xff,
-    0xf6, 0x0, 0x0, 0xdf, 0xff, 0xf6, 0x0, 0x0,
-    0xdf, 0xff, 0xf6, 0x0, 0x0, 0xdf, 0xff, 0xf6,
-    0x0, 0x0, 0xdf, 0xff, 0xf6, 0x0, 0x0, 0xdf,
-    0xff, 0xf6, 0x0, 0x0, 0xdf, 0xff, 0xf6, 0x0,
-    0x0, 0xdf, 0xff, 0xf6, 0x0, 0x0, 0xdf, 0xff,
-    0xf6, 0x4, 0x44, 0xef, 0xff, 0xf6, 0x3f, 0xff,
-    0xff, 0xff, 0xf6, 0x3f, 0xff, 0xff, 0xff, 0xf6,
-    0x3f, 0xff, 0xff, 0xff, 0xf6, 0x3f, 0xff, 0xff,
-    0xff, 0xf6, 0x3f, 0xff, 0xff, 0xff, 0xf6,
-
-    /* U+005E "^" */
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xdf, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf2, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0xe, 0xff, 0xf9, 0xb,
-    0xff, 0xfc, 0x0, 0x0, 0x5, 0xff, 0xff, 0x30,
-    0x5f, 0xff, 0xf2, 0x0, 0x0, 0xbf, 0xff, 0xd0,
-    0x0, 0xff, 0xff, 0x90, 0x0, 0x1f, 0xff, 0xf7,
-    0x0, 0x9, 0xff, 0xfe, 0x0, 0x8, 0xff, 0xff,
-    0x10, 0x0, 0x3f, 0xff, 0xf5, 0x0, 0xef, 0xff,
-    0xb0, 0x0, 0x0, 0xdf, 0xff, 0xc0, 0x4f, 0xff,
-    0xf5, 0x0, 0x0, 0x7, 0xff, 0xff, 0x2a, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf8,
-
-    /* U+005F "_" */
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-
-    /* U+0060 "`" */
-    0x11, 0x11, 0x11, 0x0, 0x0, 0x3e, 0xff, 0xff,
-    0x30, 0x0, 0x2, 0xef, 0xff, 0xd0, 0x0, 0x0,
-    0x2e, 0xff, 0xf8, 0x0, 0x0, 0x2, 0xdf, 0xff,
-    0x30, 0x0, 0x0, 0x1d, 0xff, 0xc0,
-
-    /* U+0061 "a" */
-    0x0, 0x0, 0x5, 0xae, 0xff, 0xd9, 0x34, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x2d, 0xff, 0xff, 0xff,
-    0xff, 0xdf, 0xff, 0xff, 0x70, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0xa, 0xff, 0xff, 0xff, 0xb5, 0x35,
-    0xaf, 0xff, 0xff, 0xf7, 0x1, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x70, 0x7f,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xf7, 0xa, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0x70, 0xdf, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xf7, 0xe, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0x70, 0xef, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xf7, 0xd, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0x70, 0xbf, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf7,
-    0x7, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0x70, 0x2f, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xf7, 0x0, 0xaf, 0xff,
-    0xff, 0xfa, 0x42, 0x5a, 0xff, 0xff, 0xff, 0x70,
-    0x1, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x3, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x2, 0xcf,
-    0xff, 0xff, 0xff, 0xfe, 0xdf, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x5a, 0xdf, 0xfe, 0xb6, 0x15, 0xff,
-    0xff, 0xf0,
-
-    /* U+0062 "b" */
-    0x3f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x90,
-    0x6b, 0xef, 0xeb, 0x71, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xfc, 0xdf, 0xff, 0xff, 0xff, 0xe5, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x3f, 0xff,
-    0xff, 0xfc, 0x63, 0x38, 0xff, 0xff, 0xff, 0xe0,
-    0x3, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x3, 0xef,
-    0xff, 0xff, 0x60, 0x3f, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xfb, 0x3, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xf0,
-    0x3f, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0x13, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x23,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf1, 0x3f, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0x3, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xb0, 0x3f,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x2e, 0xff, 0xff,
-    0xf6, 0x3, 0xff, 0xff, 0xff, 0xc5, 0x23, 0x8f,
-    0xff, 0xff, 0xfe, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x7f, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0xb, 0xff, 0xff, 0xa0, 0x5a,
-    0xdf, 0xfe, 0xc7, 0x10, 0x0, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x0, 0x0, 0x38, 0xce, 0xff, 0xec, 0x95,
-    0x10, 0x0, 0x3, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x4, 0xff, 0xff, 0xff, 0xfe, 0xb9,
-    0x9a, 0xcf, 0xc0, 0xdf, 0xff, 0xff, 0xd4, 0x0,
-    0x0, 0x0, 0x13, 0x4f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xfe, 0x30, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0x81, 0x0, 0x0, 0x2, 0xa0,
-    0x4f, 0xff, 0xff, 0xff, 0xfd, 0xa9, 0xad, 0xff,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x2a, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x2, 0x7b, 0xdf, 0xff,
-    0xda, 0x61,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x5, 0xae,
-    0xff, 0xc7, 0x14, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x2d, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xff,
-    0x70, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x1e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0xa, 0xff,
-    0xff, 0xff, 0xa4, 0x35, 0xaf, 0xff, 0xff, 0xf7,
-    0x1, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0x70, 0x7f, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xf7, 0xa, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x70,
-    0xdf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xf7, 0xe, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0x70, 0xef, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf7, 0xd,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0x70, 0xbf, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xf7, 0x7, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0x70, 0x2f,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xf7, 0x0, 0xbf, 0xff, 0xff, 0xfa, 0x42, 0x4a,
-    0xff, 0xff, 0xff, 0x70, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xfe,
-    0xdf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x5b, 0xef,
-    0xfe, 0xb6, 0x15, 0xff, 0xff, 0xf0,
-
-    /* U+0065 "e" */
-    0x0, 0x0, 0x3, 0x8c, 0xef, 0xfe, 0xb8, 0x20,
-    0x0, 0x0, 0x0, 0x2, 0xbf, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x10, 0x0, 0x0, 0x3e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x2, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x10,
-    0xb, 0xff, 0xff, 0xfc, 0x52, 0x25, 0xcf, 0xff,
-    0xff, 0x90, 0x2f, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xf1, 0x7f, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xf5, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xcf, 0xff,
-    0xfd, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10,
-    0xaf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x20, 0xe, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x4d, 0x70, 0x7, 0xff,
-    0xff, 0xff, 0xd8, 0x54, 0x46, 0x9d, 0xff, 0x70,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x5d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x30, 0x0, 0x0,
-    0x0, 0x38, 0xbd, 0xef, 0xfe, 0xb8, 0x30, 0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x0, 0x1, 0x7b, 0xef, 0xff, 0xf9, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0x76, 0x64, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0x46, 0x69, 0xff, 0xff, 0xfa, 0x66,
-    0x66, 0x10, 0x0, 0x5f, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x70,
-    0x0, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x0, 0x5, 0xae, 0xff, 0xd9, 0x35, 0xff,
-    0xff, 0xf4, 0x0, 0x2, 0xdf, 0xff, 0xff, 0xff,
-    0xfe, 0xff, 0xff, 0xf4, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x1, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0xa, 0xff, 0xff, 0xff, 0xb5, 0x35, 0xbf, 0xff,
-    0xff, 0xf4, 0x1f, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf4, 0x7f, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xf4, 0xaf, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf4,
-    0xdf, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xf4, 0xef, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xf4, 0xef, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xf4, 0xdf, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf4,
-    0xbf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xf4, 0x7f, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xf4, 0x2f, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf4, 0xa, 0xff,
-    0xff, 0xff, 0xa4, 0x25, 0xaf, 0xff, 0xff, 0xf4,
-    0x1, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x4e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x2, 0xdf, 0xff,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x5, 0xae, 0xff, 0xda, 0x46, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf1, 0xd, 0xa7, 0x43, 0x21,
-    0x0, 0x39, 0xff, 0xff, 0xff, 0xd0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x20, 0x0, 0x0, 0x47,
-    0xac, 0xdf, 0xff, 0xfe, 0xb8, 0x20, 0x0, 0x0,
-
-    /* U+0068 "h" */
-    0x3f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x90,
-    0x6, 0xbe, 0xfe, 0xc6, 0x0, 0x3, 0xff, 0xff,
-    0xf9, 0x5e, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0x3f, 0xff, 0xff, 0xff, 0xd8, 0x8d,
-    0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0xa, 0xff, 0xff, 0xfa, 0x3f, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xb3, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfb,
-    0x3f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xb3, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xfb, 0x3f, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xb3, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xfb, 0x3f, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xb3,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfb, 0x3f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xb3, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xfb, 0x3f, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xb3, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x1, 0xff, 0xff, 0xfb, 0x3f,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xb3, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfb,
-
-    /* U+0069 "i" */
-    0xbf, 0xff, 0xff, 0xb, 0xff, 0xff, 0xf0, 0xbf,
-    0xff, 0xff, 0xb, 0xff, 0xff, 0xf0, 0xbf, 0xff,
-    0xff, 0x9, 0xcc, 0xcc, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xb,
-    0xff, 0xff, 0xf0, 0xbf, 0xff, 0xff, 0xb, 0xff,
-    0xff, 0xf0, 0xbf, 0xff, 0xff, 0xb, 0xff, 0xff,
-    0xf0, 0xbf, 0xff, 0xff, 0xb, 0xff, 0xff, 0xf0,
-    0xbf, 0xff, 0xff, 0xb, 0xff, 0xff, 0xf0, 0xbf,
-    0xff, 0xff, 0xb, 0xff, 0xff, 0xf0, 0xbf, 0xff,
-    0xff, 0xb, 0xff, 0xff, 0xf0, 0xbf, 0xff, 0xff,
-    0xb, 0xff, 0xff, 0xf0, 0xbf, 0xff, 0xff, 0xb,
-    0xff, 0xff, 0xf0, 0xbf, 0xff, 0xff, 0xb, 0xff,
-    0xff, 0xf0,
-
-    /* U+006A "j" */
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0x90, 0x0, 0x2,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0x90, 0x0, 0x2, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0x90, 0x0, 0x1, 0xcc, 0xcc,
-    0xc7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0x90, 0x0, 0x2, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0x90, 0x0, 0x2, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x90,
-    0x0, 0x2, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0x90, 0x0, 0x2, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0x90, 0x0, 0x2,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0x90, 0x0, 0x2, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0x90, 0x0, 0x2, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x90, 0x0,
-    0x2, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0x90, 0x0, 0x2, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0x90, 0x0, 0x3, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x70,
-    0x0, 0xc, 0xff, 0xff, 0xf5, 0x0, 0x2a, 0xff,
-    0xff, 0xff, 0x19, 0xef, 0xff, 0xff, 0xff, 0xa0,
-    0xbf, 0xff, 0xff, 0xff, 0xf2, 0xb, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0xbf, 0xff, 0xff, 0xc2, 0x0,
-    0xb, 0xed, 0xb8, 0x20, 0x0, 0x0,
-
-    /* U+006B "k" */
-    0x3f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x90,
-    0x0, 0x6, 0xff, 0xff, 0xf9, 0x3, 0xff, 0xff,
-    0xf9, 0x0, 0x1, 0xff, 0xff, 0xfd, 0x0, 0x3f,
-    0xff, 0xff, 0x90, 0x0, 0xbf, 0xff, 0xff, 0x30,
-    0x3, 0xff, 0xff, 0xf9, 0x0, 0x5f, 0xff, 0xff,
-    0x80, 0x0, 0x3f, 0xff, 0xff, 0x90, 0x1e, 0xff,
-    0xff, 0xd0, 0x0, 0x3, 0xff, 0xff, 0xf9, 0x9,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x94, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd1, 0x0, 0x0, 0x3, 0xff, 0xff, 0xfc,
-    0xaf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x90, 0x7f, 0xff, 0xff, 0x60, 0x0, 0x3,
-    0xff, 0xff, 0xf9, 0x0, 0x9f, 0xff, 0xff, 0x20,
-    0x0, 0x3f, 0xff, 0xff, 0x90, 0x0, 0xdf, 0xff,
-    0xfb, 0x0, 0x3, 0xff, 0xff, 0xf9, 0x0, 0x4,
-    0xff, 0xff, 0xf4, 0x0, 0x3f, 0xff, 0xff, 0x90,
-    0x0, 0xb, 0xff, 0xff, 0xc0, 0x3, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x40, 0x3f,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0xbf, 0xff, 0xfb,
-    0x3, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xf2,
-
-    /* U+006C "l" */
-    0x3f, 0xff, 0xff, 0x90, 0x0, 0x3, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x90, 0x0,
-    0x3, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x90, 0x0, 0x3, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x90, 0x0, 0x3, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x90,
-    0x0, 0x3, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x90, 0x0, 0x3, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x90, 0x0, 0x3,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x90, 0x0, 0x3, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x90, 0x0, 0x3, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x90, 0x0,
-    0x3, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x90, 0x0, 0x2, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xf5, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xfe, 0xc1, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0x10, 0x1e, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x3e, 0xff, 0xff, 0xff, 0x10, 0x0, 0x18, 0xcf,
-    0xff, 0xf1,
-
-    /* U+006D "m" */
-    0x3f, 0xff, 0xff, 0x90, 0x6, 0xbe, 0xfe, 0xb5,
-    0x0, 0x1, 0x7c, 0xef, 0xea, 0x30, 0x0, 0x3f,
-    0xff, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x8f, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0x3f, 0xff, 0xff, 0xff,
-    0xc8, 0x8d, 0xff, 0xff, 0xff, 0xfc, 0x89, 0xef,
-    0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xe5, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0x60, 0x0, 0x2f, 0xff,
-    0xff, 0xf1, 0x3f, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x50, 0x0, 0xb, 0xff, 0xff,
-    0xf2, 0x3f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0x50, 0x0, 0xa, 0xff, 0xff, 0xf2,
-    0x3f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0x50, 0x0, 0xa, 0xff, 0xff, 0xf2, 0x3f,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0x50, 0x0, 0xa, 0xff, 0xff, 0xf2, 0x3f, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x50,
-    0x0, 0xa, 0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x50, 0x0,
-    0xa, 0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0x50, 0x0, 0xa,
-    0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0x50, 0x0, 0xa, 0xff,
-    0xff, 0xf2, 0x3f, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0x50, 0x0, 0xa, 0xff, 0xff,
-    0xf2, 0x3f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0x50, 0x0, 0xa, 0xff, 0xff, 0xf2,
-    0x3f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0x50, 0x0, 0xa, 0xff, 0xff, 0xf2, 0x3f,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0x50, 0x0, 0xa, 0xff, 0xff, 0xf2, 0x3f, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x50,
-    0x0, 0xa, 0xff, 0xff, 0xf2, 0x3f, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x50, 0x0,
-    0xa, 0xff, 0xff, 0xf2,
-
-    /* U+006E "n" */
-    0x3f, 0xff, 0xff, 0x90, 0x4, 0x9d, 0xff, 0xd8,
-    0x10, 0x0, 0x3f, 0xff, 0xff, 0x93, 0xcf, 0xff,
-    0xff, 0xff, 0xe3, 0x0, 0x3f, 0xff, 0xff, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x10, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x3f, 0xff, 0xff, 0xff, 0xf9, 0x7a, 0xff, 0xff,
-    0xff, 0xe0, 0x3f, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xf0, 0x3f, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf0,
-    0x3f, 0xff, 0xff, 0x90, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xf0, 0x3f, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xf0, 0x3f, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf0,
-    0x3f, 0xff, 0xff, 0x90, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xf0, 0x3f, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xf0, 0x3f, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf0,
-    0x3f, 0xff, 0xff, 0x90, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xf0, 0x3f, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xf0, 0x3f, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf0,
-
-    /* U+006F "o" */
-    0x0, 0x0, 0x2, 0x7b, 0xdf, 0xfe, 0xd9, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x2e, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0xa, 0xff, 0xff, 0xff, 0x84, 0x35,
-    0xcf, 0xff, 0xff, 0xf3, 0x2, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xb0, 0x7f,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xb, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xf4, 0xdf, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x6e, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf7, 0xef, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xf5, 0xaf, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0x36, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xf9, 0x0, 0x8f, 0xff,
-    0xff, 0xf9, 0x43, 0x6d, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x1, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x16, 0xbd, 0xff, 0xec, 0x94, 0x0,
-    0x0, 0x0,
-
-    /* U+0070 "p" */
-    0x3f, 0xff, 0xff, 0x90, 0x28, 0xdf, 0xfd, 0xa5,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf9, 0x9f, 0xff,
-    0xff, 0xff, 0xfc, 0x20, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x10, 0x3f, 0xff, 0xff, 0xff, 0xa5, 0x35,
-    0xbf, 0xff, 0xff, 0xf9, 0x3, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf1, 0x3f,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0x63, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfa, 0x3f, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xc3, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xfd, 0x3f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfc, 0x3f, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xa3, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xf6, 0x3f, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff,
-    0xff, 0xfa, 0x53, 0x4b, 0xff, 0xff, 0xff, 0x90,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe1, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x0, 0x3f, 0xff, 0xff,
-    0xac, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x0, 0x3,
-    0xff, 0xff, 0xf9, 0x4, 0xad, 0xff, 0xea, 0x50,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x0, 0x5, 0xae, 0xff, 0xd8, 0x20, 0x9f,
-    0xff, 0xff, 0x20, 0x0, 0x2d, 0xff, 0xff, 0xff,
-    0xff, 0x9a, 0xff, 0xff, 0xf2, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf2, 0xa, 0xff, 0xff, 0xff, 0xb5, 0x35,
-    0xbf, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf2, 0x7f,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0x2a, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf2, 0xdf, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x2e, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xf2, 0xef, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0x2d, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xf2, 0xbf, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0x27, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xf2, 0x2f, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0x20, 0xaf, 0xff,
-    0xff, 0xfa, 0x43, 0x5a, 0xff, 0xff, 0xff, 0xf2,
-    0x1, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x20, 0x4, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x2, 0xdf,
-    0xff, 0xff, 0xff, 0xfb, 0xbf, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x5a, 0xef, 0xfd, 0xa4, 0x9, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfc,
-
-    /* U+0072 "r" */
-    0x3f, 0xff, 0xff, 0x90, 0x4a, 0xef, 0xd1, 0x3f,
-    0xff, 0xff, 0x9a, 0xff, 0xff, 0xf1, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x3f, 0xff, 0xff, 0xff,
-    0xea, 0x87, 0x91, 0x3f, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x1, 0x6b, 0xdf, 0xfe, 0xc9, 0x61, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x8f, 0xff, 0xff, 0xc6, 0x56, 0x9d, 0xff, 0x0,
-    0xaf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x28, 0x0,
-    0x9f, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xf9, 0x30, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xfd, 0x81, 0x0, 0x0,
-    0x1, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x0,
-    0x0, 0x5, 0xdf, 0xff, 0xff, 0xff, 0xfe, 0x20,
-    0x0, 0x0, 0x2, 0x7d, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xff, 0xf3,
-    0x72, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xf5,
-    0xbf, 0xb4, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf6,
-    0xbf, 0xff, 0xfc, 0x98, 0xbf, 0xff, 0xff, 0xf3,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x4c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x0,
-    0x0, 0x26, 0x9c, 0xef, 0xff, 0xc7, 0x10, 0x0,
-
-    /* U+0074 "t" */
-    0x0, 0xb, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xb0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x73, 0x66, 0xdf, 0xff, 0xfd, 0x66,
-    0x62, 0x0, 0xb, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xfb, 0x88,
-    0x30, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x4, 0xbe,
-    0xff, 0xed, 0x40,
-
-    /* U+0075 "u" */
-    0x3f, 0xff, 0xff, 0x80, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xf0, 0x3f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xf0, 0x3f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf0,
-    0x3f, 0xff, 0xff, 0x80, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xf0, 0x3f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xf0, 0x3f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf0,
-    0x3f, 0xff, 0xff, 0x80, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xf0, 0x3f, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xf0, 0x3f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf0,
-    0x3f, 0xff, 0xff, 0x80, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xf0, 0x3f, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xe0,
-    0x0, 0x2, 0xaf, 0xff, 0xff, 0xf0, 0x1f, 0xff,
-    0xff, 0xfd, 0x77, 0xbf, 0xff, 0xff, 0xff, 0xf0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0xff, 0xff, 0xf1, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xfc, 0x32, 0xff, 0xff, 0xf3, 0x0, 0x2,
-    0xae, 0xfe, 0xd9, 0x30, 0x0, 0xdf, 0xff, 0xf8,
-
-    /* U+0076 "v" */
-    0xaf, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xf2, 0x5f, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xd0, 0x1f, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0x80, 0xb, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x30, 0x6, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfe, 0x0, 0x1,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0xdf, 0xff, 0xfd, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0x20, 0x0, 0xa, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x60, 0x0, 0xe, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xb0,
-    0x0, 0x3f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xf0, 0x0, 0x7f, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf4, 0x0, 0xcf,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xf8, 0x1, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xfd, 0x5, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x19,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0x6e, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xef, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0,
-
-    /* U+0077 "w" */
-    0x4f, 0xff, 0xff, 0x50, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0xa, 0xff, 0xff, 0xf0,
-    0xf, 0xff, 0xff, 0x90, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xb0,
-    0xb, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x60,
-    0x7, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x20,
-    0x2, 0xff, 0xff, 0xf4, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x9f, 0xff, 0xfd, 0x0,
-    0x0, 0xdf, 0xff, 0xf8, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0xdf, 0xff, 0xf8, 0x0,
-    0x0, 0x9f, 0xff, 0xfc, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x1, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0x0, 0x6, 0xff, 0xfb,
-    0xff, 0xff, 0x10, 0x4, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0x30, 0xa, 0xff, 0xf7,
-    0xdf, 0xff, 0x50, 0x8, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0x70, 0xd, 0xff, 0xf4,
-    0x9f, 0xff, 0x80, 0xc, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xb0, 0x1f, 0xff, 0xf0,
-    0x6f, 0xff, 0xc0, 0xf, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xe0, 0x4f, 0xff, 0xd0,
-    0x3f, 0xff, 0xf0, 0x4f, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xf2, 0x8f, 0xff, 0xa0,
-    0xf, 0xff, 0xf3, 0x7f, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xf6, 0xcf, 0xff, 0x60,
-    0xc, 0xff, 0xf7, 0xbf, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xfa, 0xff, 0xff, 0x30,
-    0x9, 0xff, 0xfa, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-
-    /* U+0078 "x" */
-    0xe, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xb0, 0x4, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0x10, 0x0, 0x8f,
-    0xff, 0xff, 0x30, 0x0, 0x5, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xd0, 0x0, 0x1e,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf7, 0x0, 0xaf, 0xff, 0xfe, 0x10, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x25, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xce,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0x58,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xfb, 0x0, 0xdf, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xf1, 0x0, 0x3f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x60,
-    0x0, 0x9, 0xff, 0xff, 0xf3, 0x0, 0x2, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0xef, 0xff, 0xfd,
-    0x0, 0xc, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0x90,
-
-    /* U+0079 "y" */
-    0xcf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xc6, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xf7, 0xf, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x20,
-    0x9f, 0xff, 0xff, 0x30, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xd0, 0x2, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf8, 0x0, 0xc, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x40, 0x0,
-    0x5f, 0xff, 0xff, 0x50, 0x0, 0xd, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0xef, 0xff, 0xfb, 0x0, 0x1,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xf1, 0x0, 0x6f, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0x70, 0xa, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xfd, 0x0, 0xef,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xf3, 0x3f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0x97, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xcf, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x55, 0x5f,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4c, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x1a, 0xbc, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xf9, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xed, 0xb9, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x16, 0x66, 0x66, 0x66, 0x67, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xfc, 0x66, 0x66, 0x66, 0x66, 0x64,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa,
-
-    /* U+007B "{" */
-    0x0, 0x0, 0x0, 0x4, 0x79, 0x80, 0x0, 0x0,
-    0x7e, 0xff, 0xfd, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xd0, 0x0, 0x6f, 0xff, 0xff, 0xfd, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0xd0, 0x1, 0xff, 0xff, 0xfa,
-    0x10, 0x0, 0x3f, 0xff, 0xff, 0x10, 0x0, 0x3,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x5f, 0xff,
-    0xfe, 0x0, 0x0, 0x3d, 0xff, 0xff, 0xa0, 0x0,
-    0xdf, 0xff, 0xff, 0xe2, 0x0, 0xd, 0xff, 0xfe,
-    0x91, 0x0, 0x0, 0xdf, 0xff, 0xfb, 0x30, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0xbf,
-    0xff, 0xfb, 0x0, 0x0, 0x5, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xf5, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xfc, 0x80, 0x0, 0xaf, 0xff, 0xff, 0xfd,
-    0x0, 0x2, 0xef, 0xff, 0xff, 0xd0, 0x0, 0x3,
-    0xdf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x5a, 0xde,
-    0xc0,
-
-    /* U+007C "|" */
-    0x2b, 0xbb, 0xb3, 0x3f, 0xff, 0xf4, 0x3f, 0xff,
-    0xf4, 0x3f, 0xff, 0xf4, 0x3f, 0xff, 0xf4, 0x3f,
-    0xff, 0xf4, 0x3f, 0xff, 0xf4, 0x3f, 0xff, 0xf4,
-    0x3f, 0xff, 0xf4, 0x3f, 0xff, 0xf4, 0x3f, 0xff,
-    0xf4, 0x3f, 0xff, 0xf4, 0x3f, 0xff, 0xf4, 0x3f,
-    0xff, 0xf4, 0x3f, 0xff, 0xf4, 0x3f, 0xff, 0xf4,
-    0x3f, 0xff, 0xf4, 0x3f, 0xff, 0xf4, 0x3f, 0xff,
-    0xf4, 0x3f, 0xff, 0xf4, 0x3f, 0xff, 0xf4, 0x3f,
-    0xff, 0xf4, 0x3f, 0xff, 0xf4, 0x3f, 0xff, 0xf4,
-    0x3f, 0xff, 0xf4, 0x3f, 0xff, 0xf4, 0x3f, 0xff,
-    0xf4, 0x3f, 0xff, 0xf4, 0x3f, 0xff, 0xf4, 0x3f,
-    0xff, 0xf4, 0x3f, 0xff, 0xf4, 0x3f, 0xff, 0xf4,
-    0x3f, 0xff, 0xf4, 0x3f, 0xff, 0xf4, 0x3f, 0xff,
-    0xf4,
-
-    /* U+007D "}" */
-    0x29, 0x86, 0x20, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xfc, 0x30, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x3e,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf8, 0x10,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x4, 0xaf, 0xff, 0xf6, 0x0, 0x0, 0x8, 0xef,
-    0xff, 0xf6, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xe5,
-    0x0, 0x3, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xd0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xc0, 0x0, 0x2b, 0xef, 0xff, 0xff,
-    0x90, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x3f, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x3f, 0xec, 0x82, 0x0,
-    0x0, 0x0,
-
-    /* U+007E "~" */
-    0x0, 0x48, 0xaa, 0x95, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xcf, 0xff, 0xff, 0xfe, 0x70, 0x0,
-    0x0, 0x0, 0x6, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xd4, 0x0, 0x0, 0x4c, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xbc, 0xef, 0xfc, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf,
-    0xe8, 0x30, 0x3, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0xa1, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xae, 0xff, 0xc8, 0x10,
-
-    /* U+4E00 "一" */
-    0x1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x10, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x2e, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xe2,
-
-    /* U+4E09 "三" */
-    0x0, 0x9a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa4,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x1, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x90, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
-    0x22, 0x20, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf5, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf5, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x79, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x93,
-
-    /* U+4E8C "二" */
-    0x0, 0x4d, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd4,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf3, 0x2e, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xe2,
-
-    /* U+4E94 "五" */
-    0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x89, 0x99, 0x99,
-    0x99, 0x99, 0xbf, 0xff, 0xfc, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x98, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3a, 0xaa, 0xaa,
-    0xac, 0xff, 0xff, 0xca, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xa5, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xf8,
-    0x0, 0x0, 0xab, 0xbb, 0xbb, 0xbb, 0xbf, 0xff,
-    0xfe, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbf, 0xff,
-    0xfd, 0xbb, 0xba, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-
-    /* U+516D "六" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-    0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe0, 0xa, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xee, 0xee, 0x80, 0x0, 0x0,
-    0x0, 0x9, 0xee, 0xee, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x8, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x7f, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xf6, 0x0, 0x0, 0xef,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xfe, 0x0, 0x7,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0x60,
-    0xe, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xe0,
-
-    /* U+56DB "四" */
-    0x59, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x91,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x8f, 0xff, 0xf1, 0x0, 0x8, 0xff, 0xff, 0x10,
-    0x8, 0xff, 0xff, 0x10, 0x0, 0x9f, 0xff, 0xf1,
-    0x8f, 0xff, 0xf1, 0x0, 0x9, 0xff, 0xff, 0x0,
-    0x8, 0xff, 0xff, 0x0, 0x0, 0x9f, 0xff, 0xf1,
-    0x8f, 0xff, 0xf1, 0x0, 0xa, 0xff, 0xff, 0x0,
-    0x8, 0xff, 0xff, 0x0, 0x0, 0x9f, 0xff, 0xf1,
-    0x8f, 0xff, 0xf1, 0x0, 0xb, 0xff, 0xfe, 0x0,
-    0x8, 0xff, 0xff, 0x0, 0x0, 0x9f, 0xff, 0xf1,
-    0x8f, 0xff, 0xf1, 0x0, 0xc, 0xff, 0xfd, 0x0,
-    0x8, 0xff, 0xff, 0x0, 0x0, 0x9f, 0xff, 0xf1,
-    0x8f, 0xff, 0xf1, 0x0, 0xf, 0xff, 0xfb, 0x0,
-    0x8, 0xff, 0xff, 0x0, 0x0, 0x9f, 0xff, 0xf1,
-    0x8f, 0xff, 0xf1, 0x0, 0x2f, 0xff, 0xf9, 0x0,
-    0x8, 0xff, 0xff, 0x0, 0x0, 0x9f, 0xff, 0xf1,
-    0x8f, 0xff, 0xf1, 0x0, 0x5f, 0xff, 0xf6, 0x0,
-    0x8, 0xff, 0xff, 0x0, 0x0, 0x9f, 0xff, 0xf1,
-    0x8f, 0xff, 0xf1, 0x0, 0x9f, 0xff, 0xf3, 0x0,
-    0x8, 0xff, 0xff, 0x0, 0x0, 0x9f, 0xff, 0xf1,
-    0x8f, 0xff, 0xf1, 0x0, 0xef, 0xff, 0xf0, 0x0,
-    0x8, 0xff, 0xff, 0x0, 0x0, 0x9f, 0xff, 0xf1,
-    0x8f, 0xff, 0xf1, 0x4, 0xff, 0xff, 0xb0, 0x0,
-    0x8, 0xff, 0xff, 0x0, 0x0, 0x9f, 0xff, 0xf1,
-    0x8f, 0xff, 0xf1, 0xa, 0xff, 0xff, 0x60, 0x0,
-    0x8, 0xff, 0xff, 0x0, 0x0, 0x9f, 0xff, 0xf1,
-    0x8f, 0xff, 0xf1, 0x2f, 0xff, 0xff, 0x10, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x8f, 0xff, 0xf1, 0xbf, 0xff, 0xfa, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x8f, 0xff, 0xf5, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x8f, 0xff, 0xfe, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x4, 0x99, 0x99, 0x99, 0x99, 0xdf, 0xff, 0xf1,
-    0x8f, 0xff, 0xf3, 0x22, 0x22, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf1,
-    0x8f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf0,
-    0x8f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf0,
-    0x8f, 0xff, 0xf2, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x9f, 0xff, 0xf0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x49, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90,
-
-    /* U+65E5 "日" */
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x1f, 0xff, 0xfe, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbf, 0xff, 0xfb, 0x1f, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xfb, 0x1f, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xfb, 0x1f, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfb,
-    0x1f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xfb, 0x1f, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xfb, 0x1f, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xfb, 0x1f, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfb,
-    0x1f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xfb, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff,
-    0xfe, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
-    0xaa, 0xaf, 0xff, 0xfb, 0x1f, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xfb, 0x1f, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfb,
-    0x1f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xfb, 0x1f, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xfb, 0x1f, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xfb, 0x1f, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xfb,
-    0x1f, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xfb, 0x1f, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xfb, 0x1f, 0xff, 0xfe, 0xcc,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcf,
-    0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa,
-
-    /* U+661F "星" */
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xec,
-    0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xce,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xa1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x1a, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xa1, 0x11, 0x11, 0x11,
-    0x11, 0x11, 0x11, 0x11, 0x1a, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0x0, 0x0, 0x0, 0x1,
-    0x99, 0x99, 0x60, 0x0, 0x0, 0x6, 0x99, 0x99,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0x92, 0x22, 0x22, 0x2b, 0xff,
-    0xff, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x10,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0x7, 0xff, 0xff, 0xfe, 0xee,
-    0xee, 0xee, 0xef, 0xff, 0xff, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0x50, 0x4f, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0xbe, 0xff, 0xff, 0xbb,
-    0xbb, 0xbb, 0xbb, 0xbb, 0x80, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-
-    /* U+671F "期" */
-    0x0, 0x9f, 0xff, 0xe0, 0x0, 0x5, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2a, 0xff, 0xfe, 0x22, 0x22, 0x6f, 0xff,
-    0xf4, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xb9, 0x99,
-    0x9f, 0xff, 0xf9, 0x0, 0x9f, 0xff, 0xe0, 0x0,
-    0x5, 0xff, 0xff, 0x20, 0x3f, 0xff, 0xf4, 0x0,
-    0x0, 0xef, 0xff, 0x90, 0x9, 0xff, 0xfe, 0x0,
-    0x0, 0x5f, 0xff, 0xf2, 0x3, 0xff, 0xff, 0x40,
-    0x0, 0xe, 0xff, 0xf9, 0x0, 0x9f, 0xff, 0xfa,
-    0xaa, 0xab, 0xff, 0xff, 0x20, 0x3f, 0xff, 0xf4,
-    0x0, 0x0, 0xef, 0xff, 0x90, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0x3, 0xff, 0xff,
-    0x63, 0x33, 0x3e, 0xff, 0xf9, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x9f,
-    0xff, 0xe0, 0x0, 0x5, 0xff, 0xff, 0x20, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x9,
-    0xff, 0xfe, 0x0, 0x0, 0x5f, 0xff, 0xf2, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x9f, 0xff, 0xe0, 0x0, 0x5, 0xff, 0xff, 0x20,
-    0x3f, 0xff, 0xf9, 0x66, 0x66, 0xff, 0xff, 0x90,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x3, 0xff, 0xff, 0x40, 0x0, 0xe, 0xff, 0xf9,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x20, 0x3f, 0xff, 0xf4, 0x0, 0x0, 0xef, 0xff,
-    0x90, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x3, 0xff, 0xff, 0x40, 0x0, 0xe, 0xff,
-    0xf9, 0x0, 0x9f, 0xff, 0xfa, 0xaa, 0xab, 0xff,
-    0xff, 0x20, 0x3f, 0xff, 0xf4, 0x0, 0x0, 0xef,
-    0xff, 0x90, 0x9, 0xff, 0xfe, 0x0, 0x0, 0x5f,
-    0xff, 0xf2, 0x3, 0xff, 0xff, 0xee, 0xee, 0xef,
-    0xff, 0xf9, 0x0, 0x9f, 0xff, 0xe0, 0x0, 0x5,
-    0xff, 0xff, 0x20, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0x65,
-    0x55, 0x5f, 0xff, 0xf9, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xf0,
-    0x0, 0x0, 0xef, 0xff, 0x92, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x39, 0xff, 0xfe,
-    0x0, 0x0, 0xe, 0xff, 0xf9, 0x0, 0x1, 0x11,
-    0x10, 0x0, 0x1, 0x11, 0x11, 0x0, 0xaf, 0xff,
-    0xd0, 0x0, 0x0, 0xef, 0xff, 0x90, 0xb, 0xff,
-    0xff, 0x20, 0x0, 0xdf, 0xff, 0xf1, 0xc, 0xff,
-    0xfb, 0x0, 0x0, 0xe, 0xff, 0xf9, 0x0, 0xff,
-    0xff, 0xe0, 0x0, 0x8, 0xff, 0xff, 0x50, 0xef,
-    0xff, 0x90, 0x0, 0x0, 0xef, 0xff, 0x90, 0x4f,
-    0xff, 0xf9, 0x0, 0x0, 0x4f, 0xff, 0xf9, 0x1f,
-    0xff, 0xf7, 0x0, 0x0, 0xe, 0xff, 0xf9, 0x9,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0xff, 0xff, 0xe5,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0xef, 0xff, 0x90,
-    0xdf, 0xff, 0xf1, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xaf, 0xff, 0xf2, 0x0, 0x0, 0xe, 0xff, 0xf9,
-    0x2f, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0x90
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 150, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 214, .box_w = 7, .box_h = 25, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 88, .adv_w = 240, .box_w = 13, .box_h = 11, .ofs_x = 1, .ofs_y = 18},
-    {.bitmap_index = 160, .adv_w = 346, .box_w = 22, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 435, .adv_w = 340, .box_w = 19, .box_h = 34, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 758, .adv_w = 479, .box_w = 26, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1083, .adv_w = 380, .box_w = 24, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1383, .adv_w = 132, .box_w = 6, .box_h = 11, .ofs_x = 1, .ofs_y = 18},
-    {.bitmap_index = 1416, .adv_w = 228, .box_w = 12, .box_h = 35, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 1626, .adv_w = 228, .box_w = 11, .box_h = 35, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 1819, .adv_w = 266, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = 14},
-    {.bitmap_index = 1924, .adv_w = 334, .box_w = 19, .box_h = 19, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 2105, .adv_w = 190, .box_w = 9, .box_h = 11, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 2155, .adv_w = 253, .box_w = 12, .box_h = 5, .ofs_x = 2, .ofs_y = 9},
-    {.bitmap_index = 2185, .adv_w = 190, .box_w = 7, .box_h = 6, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 2206, .adv_w = 289, .box_w = 14, .box_h = 28, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 2402, .adv_w = 340, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2640, .adv_w = 242, .box_w = 11, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2778, .adv_w = 340, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3016, .adv_w = 340, .box_w = 18, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3241, .adv_w = 340, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3479, .adv_w = 340, .box_w = 18, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3704, .adv_w = 340, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3942, .adv_w = 317, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4180, .adv_w = 340, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4418, .adv_w = 340, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4656, .adv_w = 233, .box_w = 7, .box_h = 20, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 4726, .adv_w = 233, .box_w = 10, .box_h = 24, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 4846, .adv_w = 334, .box_w = 19, .box_h = 22, .ofs_x = 1, .ofs_y = 1},
-    {.bitmap_index = 5055, .adv_w = 334, .box_w = 19, .box_h = 14, .ofs_x = 1, .ofs_y = 5},
-    {.bitmap_index = 5188, .adv_w = 334, .box_w = 19, .box_h = 22, .ofs_x = 1, .ofs_y = 1},
-    {.bitmap_index = 5397, .adv_w = 259, .box_w = 15, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5585, .adv_w = 492, .box_w = 29, .box_h = 30, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 6020, .adv_w = 418, .box_w = 26, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6345, .adv_w = 388, .box_w = 21, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 6608, .adv_w = 394, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6883, .adv_w = 405, .box_w = 22, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7158, .adv_w = 335, .box_w = 18, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7383, .adv_w = 319, .box_w = 17, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7596, .adv_w = 406, .box_w = 23, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 7884, .adv_w = 414, .box_w = 22, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8159, .adv_w = 168, .box_w = 7, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8247, .adv_w = 190, .box_w = 11, .box_h = 31, .ofs_x = -1, .ofs_y = -6},
-    {.bitmap_index = 8418, .adv_w = 388, .box_w = 23, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8706, .adv_w = 301, .box_w = 17, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 8919, .adv_w = 511, .box_w = 28, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9269, .adv_w = 418, .box_w = 22, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 9544, .adv_w = 457, .box_w = 27, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 9882, .adv_w = 381, .box_w = 21, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10145, .adv_w = 461, .box_w = 27, .box_h = 28, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 10523, .adv_w = 380, .box_w = 22, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 10798, .adv_w = 327, .box_w = 19, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11036, .adv_w = 323, .box_w = 20, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11286, .adv_w = 423, .box_w = 23, .box_h = 25, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11574, .adv_w = 414, .box_w = 26, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 11899, .adv_w = 537, .box_w = 34, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12324, .adv_w = 420, .box_w = 26, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12649, .adv_w = 373, .box_w = 23, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 12937, .adv_w = 376, .box_w = 22, .box_h = 25, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 13212, .adv_w = 191, .box_w = 10, .box_h = 35, .ofs_x = 2, .ofs_y = -5},
-    {.bitmap_index = 13387, .adv_w = 291, .box_w = 18, .box_h = 31, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 13666, .adv_w = 191, .box_w = 10, .box_h = 35, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 13841, .adv_w = 334, .box_w = 17, .box_h = 14, .ofs_x = 2, .ofs_y = 12},
-    {.bitmap_index = 13960, .adv_w = 288, .box_w = 18, .box_h = 4, .ofs_x = 0, .ofs_y = -7},
-    {.bitmap_index = 13996, .adv_w = 249, .box_w = 10, .box_h = 6, .ofs_x = 2, .ofs_y = 24},
-    {.bitmap_index = 14026, .adv_w = 357, .box_w = 21, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14236, .adv_w = 357, .box_w = 21, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14530, .adv_w = 305, .box_w = 17, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14700, .adv_w = 357, .box_w = 21, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 14994, .adv_w = 350, .box_w = 20, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15194, .adv_w = 230, .box_w = 15, .box_h = 28, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 15404, .adv_w = 353, .box_w = 20, .box_h = 28, .ofs_x = 1, .ofs_y = -8},
-    {.bitmap_index = 15684, .adv_w = 344, .box_w = 19, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 15950, .adv_w = 165, .box_w = 7, .box_h = 28, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 16048, .adv_w = 183, .box_w = 11, .box_h = 36, .ofs_x = -1, .ofs_y = -8},
-    {.bitmap_index = 16246, .adv_w = 316, .box_w = 19, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16512, .adv_w = 183, .box_w = 11, .box_h = 28, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16666, .adv_w = 511, .box_w = 30, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 16966, .adv_w = 350, .box_w = 20, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17166, .adv_w = 361, .box_w = 21, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 17376, .adv_w = 365, .box_w = 21, .box_h = 28, .ofs_x = 1, .ofs_y = -8},
-    {.bitmap_index = 17670, .adv_w = 367, .box_w = 21, .box_h = 28, .ofs_x = 1, .ofs_y = -8},
-    {.bitmap_index = 17964, .adv_w = 235, .box_w = 14, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18104, .adv_w = 276, .box_w = 16, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18264, .adv_w = 211, .box_w = 13, .box_h = 25, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18427, .adv_w = 349, .box_w = 20, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 18627, .adv_w = 344, .box_w = 22, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 18847, .adv_w = 507, .box_w = 32, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19167, .adv_w = 349, .box_w = 22, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 19387, .adv_w = 335, .box_w = 21, .box_h = 28, .ofs_x = 0, .ofs_y = -8},
-    {.bitmap_index = 19681, .adv_w = 297, .box_w = 17, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 19851, .adv_w = 201, .box_w = 11, .box_h = 35, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 20044, .adv_w = 129, .box_w = 6, .box_h = 35, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 20149, .adv_w = 201, .box_w = 12, .box_h = 35, .ofs_x = 0, .ofs_y = -5},
-    {.bitmap_index = 20359, .adv_w = 334, .box_w = 19, .box_h = 8, .ofs_x = 1, .ofs_y = 8},
-    {.bitmap_index = 20435, .adv_w = 576, .box_w = 34, .box_h = 6, .ofs_x = 1, .ofs_y = 11},
-    {.bitmap_index = 20537, .adv_w = 576, .box_w = 34, .box_h = 31, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 21064, .adv_w = 576, .box_w = 34, .box_h = 29, .ofs_x = 1, .ofs_y = -2},
-    {.bitmap_index = 21557, .adv_w = 576, .box_w = 34, .box_h = 31, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 22084, .adv_w = 576, .box_w = 34, .box_h = 33, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 22645, .adv_w = 576, .box_w = 32, .box_h = 31, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 23141, .adv_w = 576, .box_w = 28, .box_h = 31, .ofs_x = 4, .ofs_y = -3},
-    {.bitmap_index = 23575, .adv_w = 576, .box_w = 34, .box_h = 32, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 24119, .adv_w = 576, .box_w = 33, .box_h = 33, .ofs_x = 1, .ofs_y = -4}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_1[] = {
-    0x0, 0x9, 0x8c, 0x94, 0x36d, 0x8db, 0x17e5, 0x181f,
-    0x191f
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 19968, .range_length = 6432, .glyph_id_start = 96,
-        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 9, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-/*-----------------
- *    KERNING
- *----------------*/
-
-
-/*Pair left and right glyphs for kerning*/
-static const uint8_t kern_pair_glyph_ids[] =
-{
-    7, 43,
-    9, 75,
-    19, 21,
-    19, 23,
-    19, 26,
-    21, 26,
-    34, 43,
-    34, 53,
-    34, 55,
-    34, 56,
-    34, 58,
-    34, 66,
-    34, 68,
-    34, 70,
-    34, 72,
-    34, 80,
-    34, 82,
-    36, 43,
-    37, 43,
-    37, 53,
-    37, 55,
-    37, 56,
-    37, 57,
-    37, 58,
-    37, 59,
-    38, 43,
-    39, 15,
-    39, 34,
-    39, 66,
-    39, 68,
-    39, 70,
-    39, 72,
-    39, 80,
-    39, 82,
-    40, 43,
-    41, 43,
-    42, 43,
-    44, 43,
-    44, 48,
-    44, 66,
-    44, 68,
-    44, 70,
-    44, 72,
-    44, 80,
-    44, 82,
-    45, 34,
-    45, 43,
-    45, 48,
-    45, 53,
-    45, 55,
-    45, 56,
-    45, 58,
-    46, 43,
-    47, 43,
-    48, 43,
-    48, 53,
-    48, 55,
-    48, 56,
-    48, 57,
-    48, 58,
-    48, 59,
-    49, 15,
-    49, 34,
-    49, 57,
-    50, 43,
-    50, 53,
-    50, 55,
-    50, 56,
-    50, 57,
-    50, 58,
-    50, 59,
-    51, 43,
-    51, 58,
-    51, 66,
-    51, 68,
-    51, 70,
-    51, 72,
-    51, 80,
-    51, 82,
-    53, 15,
-    53, 34,
-    53, 40,
-    53, 48,
-    53, 50,
-    53, 66,
-    53, 68,
-    53, 70,
-    53, 72,
-    53, 75,
-    53, 78,
-    53, 79,
-    53, 80,
-    53, 81,
-    53, 82,
-    53, 83,
-    53, 84,
-    53, 86,
-    55, 15,
-    55, 34,
-    55, 40,
-    55, 48,
-    55, 50,
-    55, 66,
-    55, 68,
-    55, 70,
-    55, 72,
-    55, 75,
-    55, 78,
-    55, 79,
-    55, 80,
-    55, 81,
-    55, 82,
-    55, 83,
-    55, 84,
-    55, 86,
-    56, 15,
-    56, 34,
-    56, 40,
-    56, 48,
-    56, 50,
-    56, 66,
-    56, 68,
-    56, 70,
-    56, 72,
-    56, 75,
-    56, 78,
-    56, 79,
-    56, 80,
-    56, 81,
-    56, 82,
-    56, 83,
-    56, 84,
-    56, 86,
-    57, 15,
-    57, 40,
-    57, 43,
-    57, 48,
-    57, 50,
-    57, 66,
-    57, 68,
-    57, 70,
-    57, 72,
-    57, 80,
-    57, 82,
-    57, 84,
-    58, 15,
-    58, 34,
-    58, 40,
-    58, 48,
-    58, 50,
-    58, 66,
-    58, 68,
-    58, 69,
-    58, 70,
-    58, 72,
-    58, 75,
-    58, 78,
-    58, 79,
-    58, 80,
-    58, 81,
-    58, 82,
-    58, 83,
-    58, 84,
-    58, 85,
-    58, 86,
-    59, 40,
-    59, 43,
-    59, 48,
-    59, 50,
-    60, 43,
-    60, 75,
-    61, 43,
-    61, 75,
-    66, 43,
-    67, 53,
-    67, 55,
-    67, 56,
-    67, 57,
-    67, 58,
-    67, 87,
-    67, 88,
-    67, 89,
-    67, 90,
-    68, 43,
-    69, 43,
-    70, 53,
-    70, 55,
-    70, 56,
-    70, 57,
-    70, 58,
-    70, 87,
-    70, 88,
-    70, 89,
-    70, 90,
-    72, 43,
-    76, 43,
-    76, 66,
-    76, 68,
-    76, 70,
-    76, 72,
-    76, 80,
-    76, 82,
-    77, 43,
-    79, 43,
-    80, 43,
-    80, 53,
-    80, 55,
-    80, 56,
-    80, 57,
-    80, 58,
-    80, 87,
-    80, 88,
-    80, 89,
-    80, 90,
-    81, 53,
-    81, 55,
-    81, 56,
-    81, 57,
-    81, 58,
-    81, 87,
-    81, 88,
-    81, 89,
-    81, 90,
-    82, 43,
-    82, 75,
-    83, 66,
-    83, 68,
-    83, 70,
-    83, 72,
-    83, 80,
-    83, 82,
-    84, 53,
-    84, 55,
-    84, 56,
-    84, 57,
-    84, 58,
-    85, 43,
-    86, 43,
-    88, 66,
-    88, 68,
-    88, 70,
-    88, 72,
-    88, 80,
-    88, 82,
-    89, 43,
-    89, 66,
-    89, 68,
-    89, 70,
-    89, 72,
-    89, 80,
-    89, 82,
-    90, 66,
-    90, 68,
-    90, 70,
-    90, 72,
-    90, 80,
-    90, 82,
-    91, 43,
-    92, 43,
-    92, 75
-};
-
-/* Kerning between the respective left and right glyphs
- * 4.4 format which needs to scaled with `kern_scale`*/
-static const int8_t kern_pair_values[] =
-{
-    29, 23, -12, -12, -12, -6, 12, -35,
-    -40, -29, -35, -12, -12, -12, -12, -12,
-    -12, 12, -12, -12, -6, -6, -17, -17,
-    -6, 12, -58, -23, -12, -12, -12, -12,
-    -12, -12, 12, 12, 12, 17, -23, -23,
-    -23, -23, -23, -23, -23, 6, 17, -12,
-    -58, -40, -29, -58, 12, 12, -12, -12,
-    -6, -6, -17, -17, -6, -63, -17, -12,
-    -12, -12, -6, -6, -17, -17, -6, 17,
-    -6, -6, -6, -6, -6, -6, -6, -69,
-    -35, -12, -12, -12, -35, -35, -35, -35,
-    -23, -23, -23, -35, -23, -35, -23, -29,
-    -23, -46, -40, -6, -6, -6, -23, -23,
-    -23, -17, -17, -12, -12, -23, -12, -23,
-    -12, -12, -12, -35, -29, -6, -6, -6,
-    -17, -17, -17, -17, -17, -12, -12, -17,
-    -12, -17, -12, -12, -12, -12, -17, 17,
-    -17, -17, -23, -23, -23, -23, -23, -23,
-    -17, -58, -35, -17, -17, -17, -52, -52,
-    -52, -52, -52, -23, -23, -23, -52, -23,
-    -52, -23, -40, -23, -23, -6, 17, -6,
-    -6, 29, 23, 29, 23, 12, -35, -17,
-    -17, -23, -52, -12, -6, -12, -12, 12,
-    12, -35, -17, -17, -23, -52, -12, -6,
-    -12, -12, 12, 12, -12, -12, -12, -12,
-    -12, -12, 17, 6, -12, -35, -23, -17,
-    -23, -52, -12, -6, -12, -12, -35, -17,
-    -17, -23, -52, -12, -6, -12, -12, 12,
-    23, -12, -12, -12, -12, -12, -12, -29,
-    -12, -12, -17, -40, 12, 6, -6, -6,
-    -6, -6, -6, -6, 12, -6, -6, -6,
-    -6, -6, -6, -6, -6, -6, -6, -6,
-    -6, 12, 29, 23
-};
-
-/*Collect the kern pair's data in one place*/
-static const lv_font_fmt_txt_kern_pair_t kern_pairs =
-{
-    .glyph_ids = kern_pair_glyph_ids,
-    .values = kern_pair_values,
-    .pair_cnt = 260,
-    .glyph_ids_size = 0
-};
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LV_VERSION_CHECK(8, 0, 0)
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = &kern_pairs,
-    .kern_scale = 16,
-    .cmap_num = 2,
-    .bpp = 4,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LV_VERSION_CHECK(8, 0, 0)
-    .cache = &cache
-#endif
-};
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LV_VERSION_CHECK(8, 0, 0)
-const lv_font_t ui_font_FontNumber36bp4 = {
-#else
-lv_font_t ui_font_FontNumber36bp4 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 38,          /*The maximum line height required by the font*/
-    .base_line = 8,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -4,
-    .underline_thickness = 2,
-#endif
-    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-};
-
-
-
-#endif /*#if UI_FONT_FONTNUMBER36BP4*/
-
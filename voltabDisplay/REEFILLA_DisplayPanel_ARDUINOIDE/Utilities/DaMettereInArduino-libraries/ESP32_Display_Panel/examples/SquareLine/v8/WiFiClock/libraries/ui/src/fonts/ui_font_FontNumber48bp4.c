@@ -1,5361 +0,0 @@
-/*******************************************************************************
- * Size: 48 px
- * Bpp: 4
- * Opts: --bpp 4 --size 48 --font /home/lvhaiyu/SquareLine/assets/AlimamaShuHeiTi-Bold.ttf -o /home/lvhaiyu/SquareLine/assets/ui_font_FontNumber48bp4.c --format lvgl -r 0x20-0x7f --no-compress --no-prefilter
- ******************************************************************************/
-
-#include "../ui.h"
-
-#ifndef UI_FONT_FONTNUMBER48BP4
-#define UI_FONT_FONTNUMBER48BP4 1
-#endif
-
-#if UI_FONT_FONTNUMBER48BP4
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0xe, 0xff, 0xff, 0xff, 0xb0, 0xef, 0xff, 0xff,
-    0xfa, 0xd, 0xff, 0xff, 0xff, 0x90, 0xdf, 0xff,
-    0xff, 0xf9, 0xc, 0xff, 0xff, 0xff, 0x80, 0xbf,
-    0xff, 0xff, 0xf7, 0xb, 0xff, 0xff, 0xff, 0x70,
-    0xaf, 0xff, 0xff, 0xf6, 0x9, 0xff, 0xff, 0xff,
-    0x60, 0x9f, 0xff, 0xff, 0xf5, 0x8, 0xff, 0xff,
-    0xff, 0x40, 0x7f, 0xff, 0xff, 0xf4, 0x7, 0xff,
-    0xff, 0xff, 0x30, 0x6f, 0xff, 0xff, 0xf2, 0x6,
-    0xff, 0xff, 0xff, 0x20, 0x5f, 0xff, 0xff, 0xf1,
-    0x4, 0xff, 0xff, 0xff, 0x0, 0x4f, 0xff, 0xff,
-    0xf0, 0x3, 0xff, 0xff, 0xff, 0x0, 0x2f, 0xff,
-    0xff, 0xf0, 0x2, 0xff, 0xff, 0xfe, 0x0, 0x1f,
-    0xff, 0xff, 0xd0, 0x0, 0xcc, 0xcc, 0xca, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xd0, 0xff, 0xff, 0xff, 0xfd, 0xf, 0xff,
-    0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xfd, 0xf,
-    0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xfd,
-    0xf, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff,
-    0xfd,
-
-    /* U+0022 "\"" */
-    0x67, 0x77, 0x77, 0x60, 0x6, 0x77, 0x77, 0x76,
-    0xcf, 0xff, 0xff, 0xc0, 0xd, 0xff, 0xff, 0xfc,
-    0xbf, 0xff, 0xff, 0xb0, 0xc, 0xff, 0xff, 0xfb,
-    0xaf, 0xff, 0xff, 0x90, 0xb, 0xff, 0xff, 0xf9,
-    0x8f, 0xff, 0xff, 0x80, 0x9, 0xff, 0xff, 0xf8,
-    0x7f, 0xff, 0xff, 0x70, 0x8, 0xff, 0xff, 0xf6,
-    0x5f, 0xff, 0xff, 0x50, 0x6, 0xff, 0xff, 0xf5,
-    0x4f, 0xff, 0xff, 0x40, 0x5, 0xff, 0xff, 0xf4,
-    0x2f, 0xff, 0xff, 0x20, 0x3, 0xff, 0xff, 0xf2,
-    0x1f, 0xff, 0xff, 0x10, 0x2, 0xff, 0xff, 0xf1,
-    0xf, 0xff, 0xff, 0x0, 0x0, 0xff, 0xff, 0xf0,
-    0xe, 0xff, 0xfe, 0x0, 0x0, 0xff, 0xff, 0xe0,
-    0xd, 0xff, 0xfd, 0x0, 0x0, 0xef, 0xff, 0xd0,
-    0xb, 0xff, 0xfc, 0x0, 0x0, 0xcf, 0xff, 0xb0,
-    0xa, 0xff, 0xfa, 0x0, 0x0, 0xbf, 0xff, 0xa0,
-
-    /* U+0023 "#" */
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x4, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x15, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x15,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x10, 0x11, 0x11, 0x3f,
-    0xff, 0xff, 0x91, 0x11, 0x11, 0x1c, 0xff, 0xff,
-    0xf1, 0x11, 0x10, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0xef, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x15, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf1, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x1f, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0x50, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0x80, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8c, 0xcb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x8b,
-    0xef, 0xff, 0xff, 0xff, 0xec, 0xa8, 0x51, 0x0,
-    0x0, 0x2, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x1, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0xe, 0xff, 0xff, 0xff, 0xfd, 0xef, 0xff, 0xbc,
-    0xdf, 0xff, 0xfc, 0x0, 0x2f, 0xff, 0xff, 0xfc,
-    0x20, 0xaf, 0xfe, 0x0, 0x0, 0x25, 0x89, 0x0,
-    0x5f, 0xff, 0xff, 0xf3, 0x0, 0xaf, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf0,
-    0x0, 0xaf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xf0, 0x0, 0xaf, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf0,
-    0x0, 0xaf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xf7, 0x0, 0xaf, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0x92, 0xaf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xeb, 0x61, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb3, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x4a,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xfe, 0x6d, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe, 0x0,
-    0x8f, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xfe, 0x0, 0xd, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe, 0x0,
-    0x9, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xfe, 0x0, 0x8, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe, 0x0,
-    0xa, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xfe, 0x0, 0x1f, 0xff, 0xff, 0xfb,
-    0x8f, 0xc9, 0x64, 0x31, 0x10, 0xaf, 0xfe, 0x26,
-    0xef, 0xff, 0xff, 0xf8, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x30, 0x0,
-    0x4, 0x7a, 0xcd, 0xef, 0xff, 0xff, 0xff, 0xfd,
-    0xb7, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x0, 0x0, 0x2, 0x57, 0x75, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xbf, 0xff, 0xff, 0xfc,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0x81, 0x6, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xfc, 0x0,
-    0x0, 0xbf, 0xff, 0xe0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xf8, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xf6, 0x0, 0x0, 0x5f, 0xff, 0xf1,
-    0x0, 0x0, 0x9f, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xf6, 0x0, 0x0, 0x5f,
-    0xff, 0xf1, 0x0, 0x2, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xf6, 0x0,
-    0x0, 0x5f, 0xff, 0xf1, 0x0, 0xa, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xf7, 0x0, 0x0, 0x6f, 0xff, 0xf0, 0x0, 0x3f,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xfa, 0x0, 0x0, 0x8f, 0xff, 0xf0,
-    0x0, 0xcf, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xfe, 0x10, 0x0, 0xdf,
-    0xff, 0xc0, 0x5, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xe9,
-    0x8d, 0xff, 0xff, 0x80, 0xd, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x6f, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0xef, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x8, 0xff, 0xff, 0xe1, 0x0, 0x5a, 0xef,
-    0xfd, 0x93, 0x0, 0x0, 0x0, 0x0, 0x4a, 0xdf,
-    0xfe, 0xa4, 0x0, 0x1f, 0xff, 0xff, 0x70, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xfd,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xf5, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xc0, 0x9, 0xff, 0xff, 0xd9,
-    0x9e, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0x40, 0xd, 0xff,
-    0xfd, 0x0, 0x2, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xfb, 0x0,
-    0xf, 0xff, 0xf7, 0x0, 0x0, 0xaf, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xf2, 0x0, 0x2f, 0xff, 0xf5, 0x0, 0x0, 0x8f,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0x90, 0x0, 0x2f, 0xff, 0xf4, 0x0,
-    0x0, 0x7f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0x10, 0x0, 0x3f, 0xff,
-    0xf4, 0x0, 0x0, 0x7f, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xff, 0xf8, 0x0, 0x0,
-    0x2f, 0xff, 0xf4, 0x0, 0x0, 0x8f, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x1f, 0xff, 0xf6, 0x0, 0x0, 0x9f,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0xf, 0xff, 0xf9, 0x0,
-    0x0, 0xdf, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0x61, 0x17, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xdf, 0xff, 0xff, 0xfb, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x67, 0x75, 0x10, 0x0, 0x0,
-
-    /* U+0026 "&" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x67, 0x76,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xbf, 0xff, 0xff, 0xff,
-    0xfb, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0x30, 0x4, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0xb, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0xb, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xf9, 0x0, 0x2, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf1, 0x1, 0xdf, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xa6, 0xef, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xe4, 0x0, 0x0, 0x3c, 0xcc, 0xcc, 0xa0, 0x0,
-    0x0, 0x4, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xb0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2,
-    0x0, 0xb, 0xff, 0xff, 0xf9, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0xef, 0xff, 0xff, 0x60, 0x0, 0xcf, 0xff,
-    0xff, 0xfd, 0x10, 0x7f, 0xff, 0xff, 0xff, 0xa0,
-    0x3f, 0xff, 0xff, 0xf2, 0x0, 0x3f, 0xff, 0xff,
-    0xfe, 0x10, 0x0, 0xaf, 0xff, 0xff, 0xff, 0x7b,
-    0xff, 0xff, 0xff, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0xcf, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0xd, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0xc, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x34,
-    0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x0,
-    0x0, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x9f, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x6, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xa5,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x14, 0x67, 0x76, 0x42, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0027 "'" */
-    0x67, 0x77, 0x77, 0x6c, 0xff, 0xff, 0xfc, 0xbf,
-    0xff, 0xff, 0xba, 0xff, 0xff, 0xf9, 0x8f, 0xff,
-    0xff, 0x87, 0xff, 0xff, 0xf7, 0x5f, 0xff, 0xff,
-    0x54, 0xff, 0xff, 0xf4, 0x2f, 0xff, 0xff, 0x21,
-    0xff, 0xff, 0xf1, 0xf, 0xff, 0xff, 0x0, 0xef,
-    0xff, 0xe0, 0xd, 0xff, 0xfd, 0x0, 0xbf, 0xff,
-    0xc0, 0xa, 0xff, 0xfa, 0x0,
-
-    /* U+0028 "(" */
-    0x0, 0x0, 0x0, 0x7, 0xdd, 0xdd, 0xdd, 0x50,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0x60,
-
-    /* U+0029 ")" */
-    0x2d, 0xdd, 0xdd, 0xdb, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+002A "*" */
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x20,
-    0x0, 0x5, 0xff, 0xff, 0x80, 0x0, 0x2, 0x0,
-    0x0, 0xfc, 0x40, 0x3, 0xff, 0xff, 0x60, 0x3,
-    0xbf, 0x30, 0x5, 0xff, 0xfc, 0x41, 0xff, 0xff,
-    0x33, 0xbf, 0xff, 0x80, 0xa, 0xff, 0xff, 0xfc,
-    0xff, 0xff, 0xcf, 0xff, 0xff, 0xd0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x38, 0xad, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xdb, 0x84, 0x0, 0x0, 0x2, 0x9f,
-    0xff, 0xff, 0xfb, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xfc, 0x9f,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x2e, 0xff, 0xff,
-    0xf3, 0x1f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xb0, 0x8, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x2, 0xcf, 0xff, 0x30, 0x1, 0xff, 0xfd,
-    0x30, 0x0, 0x0, 0x0, 0x8, 0xfa, 0x0, 0x0,
-    0x8f, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x42,
-    0x0, 0x0, 0x6, 0x0, 0x0, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x66, 0x66, 0x65,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x13, 0x33, 0x33, 0x33, 0x35, 0xff, 0xff, 0xff,
-    0x33, 0x33, 0x33, 0x33, 0x31, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+002C "," */
-    0x0, 0x0, 0x37, 0x77, 0x77, 0x73, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xf2, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0x70, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x5, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x7f, 0xff, 0xff, 0x30,
-    0x0, 0x0,
-
-    /* U+002D "-" */
-    0x8a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9d,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe,
-
-    /* U+002E "." */
-    0x1f, 0xff, 0xff, 0xff, 0xd1, 0xff, 0xff, 0xff,
-    0xfd, 0x1f, 0xff, 0xff, 0xff, 0xd1, 0xff, 0xff,
-    0xff, 0xfd, 0x1f, 0xff, 0xff, 0xff, 0xd1, 0xff,
-    0xff, 0xff, 0xfd, 0x1f, 0xff, 0xff, 0xff, 0xd1,
-    0xff, 0xff, 0xff, 0xfd,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x67, 0x76, 0x41,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xaf, 0xff, 0xff, 0xff, 0xfc, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xc7, 0x6a, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0xef, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0x30, 0x2f, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xf7, 0x5, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xa0, 0x8f, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xfd, 0xa, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf0, 0xbf,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xd, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xf1,
-    0xdf, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xff, 0x2e, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xf3, 0xef, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0x3d, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xf2, 0xdf, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0x1b, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xf0, 0xaf, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x8,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xd0, 0x5f, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xfa,
-    0x2, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0x70, 0xe, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x9f, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0xc, 0xff, 0xff, 0xff, 0xfc,
-    0x76, 0xaf, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3a, 0xff, 0xff, 0xff,
-    0xff, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x36, 0x77, 0x64, 0x10, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0031 "1" */
-    0x0, 0x0, 0x0, 0x6e, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x3c, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x1a,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0xcf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xf8,
-    0xcf, 0xff, 0xb2, 0x8f, 0xff, 0xff, 0xf8, 0xcf,
-    0xb3, 0x0, 0x8f, 0xff, 0xff, 0xf8, 0x83, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xf8,
-
-    /* U+0032 "2" */
-    0x0, 0x0, 0x0, 0x0, 0x25, 0x67, 0x65, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xae,
-    0xff, 0xff, 0xff, 0xff, 0xc5, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd3, 0x0, 0x0, 0x4, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xfc, 0xce, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0xb, 0xff, 0xfd, 0x72,
-    0x0, 0x0, 0x17, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0xb, 0xfd, 0x50, 0x0, 0x0, 0x0, 0x0, 0x2e,
-    0xff, 0xff, 0xff, 0xf0, 0xb, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xf2,
-    0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff,
-    0xe2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xef, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xe3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xd1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xfc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xff,
-    0xff, 0xed, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd6,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7,
-
-    /* U+0033 "3" */
-    0x0, 0x0, 0x0, 0x24, 0x67, 0x76, 0x52, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x6a, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xa3, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x10, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x10, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0xb, 0xff, 0xfe,
-    0xb8, 0x66, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0xbf, 0xb4, 0x0, 0x0, 0x0, 0x2, 0xdf,
-    0xff, 0xff, 0xff, 0x10, 0x7, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x13, 0x7d, 0xff, 0xff, 0xff, 0xe1,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x91, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe2, 0x0, 0x0, 0x0, 0x9, 0x99, 0x99, 0x9b,
-    0xef, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4d, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xf5, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x4b, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xf1, 0xbf, 0xe9, 0x30, 0x0, 0x0, 0x0,
-    0x19, 0xff, 0xff, 0xff, 0xfd, 0xb, 0xff, 0xff,
-    0xfc, 0xa9, 0x88, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0x60, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd2, 0x0, 0x5, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x38, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0x56, 0x77,
-    0x65, 0x20, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xed,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xfd, 0xd, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xf4, 0xd, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xc0, 0xd, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x30,
-    0xd, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xfb, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xf2, 0x0, 0xd, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xa0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0xd, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x5, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0x20, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x4d,
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xff,
-    0xff, 0xff, 0xed, 0xd6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x20, 0x0,
-
-    /* U+0035 "5" */
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xdb, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xfb, 0x56, 0x65, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x50, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0xa, 0xff, 0xff, 0xeb, 0xaa, 0xbe, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0xaf, 0xa5, 0x10, 0x0,
-    0x0, 0x5, 0xef, 0xff, 0xff, 0xff, 0xb0, 0x3,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf9, 0x72, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0x5e, 0xfb,
-    0x50, 0x0, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xff,
-    0xff, 0xe0, 0xef, 0xff, 0xfc, 0x97, 0x66, 0x7b,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x20, 0xe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x0,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x10, 0x0, 0x0, 0x48, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0xa3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0x45, 0x67, 0x77, 0x53, 0x0, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x56, 0x77,
-    0x75, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0xea, 0x76, 0x67, 0xaf, 0xfd, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xfe, 0x50, 0x0, 0x0,
-    0x0, 0x5, 0xa0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xb0, 0x0, 0x3,
-    0x44, 0x32, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xf7, 0x28, 0xdf, 0xff, 0xff, 0xfe, 0xa2,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xe6, 0x10, 0x16, 0xef, 0xff, 0xff, 0xff,
-    0x30, 0xcf, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xf8, 0xc, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xb0, 0xbf, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfe, 0xb, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xf0, 0xaf, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x7,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xf0, 0x5f, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x2, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xe0, 0xe, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xfa, 0x0, 0x9f, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0x70, 0x3, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xf2, 0x0, 0xc, 0xff, 0xff, 0xff, 0xfd,
-    0x76, 0x7c, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3a, 0xff, 0xff, 0xff,
-    0xff, 0xe8, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x36, 0x77, 0x65, 0x20, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0037 "7" */
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x5d, 0xdd, 0xdd, 0xdd,
-    0xdd, 0xdd, 0xdd, 0xde, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x46, 0x77, 0x65,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x17, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x20, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xf9, 0x76, 0x8d, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xfc,
-    0x10, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0xdf, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xff, 0x30, 0x0, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0xef, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0xbf, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xb3, 0x0,
-    0x29, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe7, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0x82, 0x0,
-    0x15, 0xdf, 0xff, 0xff, 0xff, 0x40, 0x7, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0xb0, 0xb, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xf0,
-    0xe, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xf3, 0xf, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xf4, 0xf, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf4, 0xd,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xf2, 0xb, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xff, 0xff,
-    0xf0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x66,
-    0x7b, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x3c,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4a, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x56, 0x77, 0x65, 0x30,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0039 "9" */
-    0x0, 0x0, 0x0, 0x0, 0x14, 0x67, 0x76, 0x41,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xdf, 0xff, 0xff, 0xff, 0xfc, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x7, 0xff, 0xff, 0xff, 0xfd,
-    0x86, 0x7b, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0xef, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xd0,
-    0x7, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0x20, 0xaf, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xf6, 0xb, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x90, 0xcf, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xfc, 0xc, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xe0, 0xbf,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0x9, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xf0,
-    0x6f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0x3, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff,
-    0xf0, 0xd, 0xff, 0xff, 0xff, 0xfd, 0x86, 0x7a,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x2,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x1, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x8f, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x38, 0xce, 0xff, 0xec, 0x94, 0x4,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1e, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x88,
-    0x10, 0x0, 0x0, 0x0, 0x3c, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x9, 0xff, 0xb7, 0x55, 0x68,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x35, 0x67, 0x76, 0x52, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+003A ":" */
-    0x3f, 0xff, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xff,
-    0xfa, 0x3f, 0xff, 0xff, 0xff, 0xa3, 0xff, 0xff,
-    0xff, 0xfa, 0x3f, 0xff, 0xff, 0xff, 0xa3, 0xff,
-    0xff, 0xff, 0xfa, 0x3f, 0xff, 0xff, 0xff, 0xa3,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xa3, 0xff, 0xff,
-    0xff, 0xfa, 0x3f, 0xff, 0xff, 0xff, 0xa3, 0xff,
-    0xff, 0xff, 0xfa, 0x3f, 0xff, 0xff, 0xff, 0xa3,
-    0xff, 0xff, 0xff, 0xfa, 0x3f, 0xff, 0xff, 0xff,
-    0xa3, 0xff, 0xff, 0xff, 0xfa,
-
-    /* U+003B ";" */
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x3, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x3, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x37, 0x77,
-    0x77, 0x73, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0xd, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x4, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0xd, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0x30, 0x0, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xd6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x39, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5c, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0x8e, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x17, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x3a,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x71,
-    0x0, 0x0, 0x0, 0x6d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x30, 0x0, 0x0, 0x2, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x0,
-    0x0, 0x0, 0x5, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x93, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xc6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xc6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xf9, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5c, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x29, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x71, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x7e,
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5b, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x29, 0xef, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xcf, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xa5,
-
-    /* U+003D "=" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x58, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x83, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x58, 0x88, 0x88, 0x88,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0x83, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-
-    /* U+003E ">" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9c, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xfe, 0x81, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xd7, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x18, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x82, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4a, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x17, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x7d, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3a,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x7d, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xaf, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x17, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4b,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x1, 0x8e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd7, 0x10, 0x0, 0x0, 0x5, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x0,
-    0x0, 0x0, 0x28, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x81, 0x0, 0x0, 0x0, 0x4b, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x50, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xa3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xfe, 0x71, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xfb, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x88, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+003F "?" */
-    0x4, 0x8a, 0xde, 0xff, 0xff, 0xed, 0xb8, 0x30,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x40, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x2c, 0x85, 0x43, 0x22,
-    0x35, 0xbf, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x3e, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xee,
-    0xee, 0xee, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0x56, 0x77, 0x66, 0x42, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x16, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x41, 0x0,
-    0x12, 0x48, 0xbf, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xf9,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x29, 0xff,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xef, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x18, 0xdf, 0xfc, 0x70, 0x18,
-    0x88, 0x85, 0x5, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xa5, 0xff, 0xff, 0x90, 0xd, 0xff,
-    0xff, 0xd0, 0x0, 0x6f, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff,
-    0xf6, 0x0, 0x7f, 0xff, 0xff, 0x10, 0xd, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x2, 0xff, 0xff,
-    0xf4, 0x2, 0xff, 0xff, 0xff, 0x10, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0xf, 0xff, 0xff, 0x60, 0x7f, 0xff, 0xff,
-    0xa0, 0x0, 0xe, 0xff, 0xff, 0xfd, 0x65, 0x8f,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0xef, 0xff, 0xf7,
-    0xb, 0xff, 0xff, 0xf5, 0x0, 0x7, 0xff, 0xff,
-    0xfd, 0x10, 0x0, 0x9f, 0xff, 0xff, 0xa0, 0x0,
-    0xd, 0xff, 0xff, 0x70, 0xef, 0xff, 0xff, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0x40, 0x0, 0x5, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0xcf, 0xff, 0xf7, 0x1f,
-    0xff, 0xff, 0xe0, 0x0, 0x1f, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0x50, 0x0, 0xd,
-    0xff, 0xff, 0x62, 0xff, 0xff, 0xfb, 0x0, 0x5,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0xef, 0xff, 0xf4, 0x3f, 0xff,
-    0xff, 0xa0, 0x0, 0x7f, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0x24, 0xff, 0xff, 0xf9, 0x0, 0x9, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0xc, 0xff, 0xff, 0xd0,
-    0x0, 0x2, 0xff, 0xff, 0xf0, 0x4f, 0xff, 0xff,
-    0x90, 0x0, 0x9f, 0xff, 0xff, 0x20, 0x0, 0x1,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x6f, 0xff, 0xfb,
-    0x4, 0xff, 0xff, 0xfa, 0x0, 0x9, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xa0, 0x0,
-    0xb, 0xff, 0xff, 0x60, 0x3f, 0xff, 0xff, 0xc0,
-    0x0, 0x7f, 0xff, 0xff, 0xb0, 0x0, 0x6f, 0xff,
-    0xff, 0xfd, 0x0, 0x3, 0xff, 0xff, 0xf1, 0x1,
-    0xff, 0xff, 0xfe, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xda, 0xdf, 0xff, 0xff, 0xff, 0xf7, 0x3, 0xdf,
-    0xff, 0xf9, 0x0, 0xe, 0xff, 0xff, 0xf2, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x10, 0x0, 0xbf,
-    0xff, 0xff, 0x60, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x6, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x6f, 0xff, 0xff, 0xfd, 0x40, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x27, 0x99, 0x85, 0x0, 0x0, 0x0, 0x16, 0x89,
-    0x84, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0xfe, 0x93, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,
-    0x98, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4a, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x37,
-    0xac, 0xdf, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xfb, 0xf, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0x60, 0xaf, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xf2, 0x6, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xfe, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0x90, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0x10, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xed,
-    0xdd, 0xdd, 0xdd, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0x90, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xf2, 0x0, 0xaf,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0x70, 0xe,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xfb, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xf0,
-    0x8f, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0x5c, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff,
-    0xf9,
-
-    /* U+0042 "B" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xda, 0x60, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xfd, 0x11, 0x11, 0x12,
-    0x6d, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0x10, 0x2, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0x50, 0x2, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0x10, 0x2,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xf2, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x3a, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x10, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x30, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xfb, 0xbb, 0xbb, 0xcd, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x20, 0x2, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x4b, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xf8,
-    0x2, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xf0, 0x2f,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0x42, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xf6, 0x2f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0x62, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xf4, 0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0x22,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x4c, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x2f, 0xff,
-    0xff, 0xff, 0xfe, 0xee, 0xee, 0xee, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x10, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xda, 0x71, 0x0, 0x0, 0x0,
-
-    /* U+0043 "C" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x46, 0x77, 0x76, 0x52, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x6b, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x94, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe4, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x2d,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x3, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x2e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xcb, 0xab, 0xce, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x30, 0x0, 0x0, 0x0, 0x14, 0x8c, 0xf7,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x12, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xb1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x75, 0x0, 0x1, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x51, 0x0, 0x0, 0x0,
-    0x15, 0xaf, 0xf7, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xec, 0xcc, 0xde, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x1, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x6b, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc7, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x46, 0x77, 0x77,
-    0x64, 0x20, 0x0, 0x0,
-
-    /* U+0044 "D" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xda, 0x73, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe7, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe5, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x15, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0x30, 0x2f,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x2f, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xff, 0xf0, 0x2f, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xf3, 0x2f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xf6, 0x2f, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xf9, 0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xfb, 0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xfc,
-    0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xfc, 0x2f,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xfc, 0x2f, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xfc, 0x2f, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xfb, 0x2f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xf9, 0x2f, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xf7, 0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xf4, 0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xf0,
-    0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x2f,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0x50, 0x2f, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x15, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe8, 0x10, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xda,
-    0x73, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0045 "E" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x2f, 0xff, 0xff, 0xff, 0xea,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x52,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xfd, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x31, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x70, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x2, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xfe, 0xaa, 0xaa,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa5, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf8,
-
-    /* U+0046 "F" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
-    0x2f, 0xff, 0xff, 0xff, 0xe9, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x91, 0x2f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xd2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x46, 0x77, 0x76, 0x42, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xae, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc8, 0x40, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xba, 0x99,
-    0xac, 0xef, 0xff, 0xf7, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x61, 0x0, 0x0, 0x0,
-    0x0, 0x14, 0x8d, 0x60, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0xf, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x1f,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0xdf, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x11, 0x5f, 0xff, 0xff, 0xf6, 0xa, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0x60, 0x6f, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xf6, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0x60, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xf6, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0x91, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xf6, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x62, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xef, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x2, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x2a, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x6b, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc7, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x67,
-    0x77, 0x66, 0x42, 0x0, 0x0, 0x0,
-
-    /* U+0048 "H" */
-    0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xfa, 0x2f,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xfa, 0x2f, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xfa, 0x2f, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xfa, 0x2f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xfa, 0x2f, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xfa, 0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xfa, 0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xfa,
-    0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xfa, 0x2f,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xfa, 0x2f, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xfa, 0x2f, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xfa, 0x2f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xfa, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x2f, 0xff, 0xff,
-    0xff, 0xe9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9b,
-    0xff, 0xff, 0xff, 0xfa, 0x2f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xfa, 0x2f, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xfa, 0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xfa, 0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xfa,
-    0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xfa, 0x2f,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xfa, 0x2f, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xfa, 0x2f, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xfa, 0x2f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
-    0xff, 0xff, 0xfa, 0x2f, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xfa, 0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xfa, 0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xfa,
-    0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xfa, 0x2f,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xfa,
-
-    /* U+0049 "I" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-
-    /* U+004A "J" */
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x26, 0xef, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd1, 0x0, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x10,
-    0x0, 0xff, 0xff, 0xff, 0xfd, 0x50, 0x0, 0x0,
-    0xff, 0xfe, 0xb8, 0x30, 0x0, 0x0, 0x0, 0x21,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+004B "K" */
-    0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0x30, 0x2,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xfe, 0x10, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xc0, 0xc,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xfe, 0x8a, 0xff,
-    0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xc0, 0x1, 0xcf, 0xff, 0xff, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x1, 0xcf, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x2, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xf5, 0x2,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xe0,
-
-    /* U+004C "L" */
-    0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xfe, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x99, 0x93, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x62, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x62, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x62, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-
-    /* U+004D "M" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x2f, 0xff, 0xff, 0xff, 0x8f, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xfa, 0xef, 0xff, 0xff, 0xfc, 0x2f, 0xff, 0xff,
-    0xff, 0x8c, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xf6, 0xef, 0xff, 0xff, 0xfc,
-    0x2f, 0xff, 0xff, 0xff, 0x89, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf3, 0xef,
-    0xff, 0xff, 0xfc, 0x2f, 0xff, 0xff, 0xff, 0x85,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xf0, 0xef, 0xff, 0xff, 0xfc, 0x2f, 0xff,
-    0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xd0, 0xef, 0xff, 0xff,
-    0xfc, 0x2f, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x90,
-    0xef, 0xff, 0xff, 0xfc, 0x2f, 0xff, 0xff, 0xff,
-    0x80, 0xbf, 0xff, 0xff, 0xf0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0x60, 0xef, 0xff, 0xff, 0xfc, 0x2f,
-    0xff, 0xff, 0xff, 0x80, 0x8f, 0xff, 0xff, 0xf2,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0x30, 0xef, 0xff,
-    0xff, 0xfc, 0x2f, 0xff, 0xff, 0xff, 0x80, 0x5f,
-    0xff, 0xff, 0xf5, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0x0, 0xef, 0xff, 0xff, 0xfc, 0x2f, 0xff, 0xff,
-    0xff, 0x80, 0x2f, 0xff, 0xff, 0xf8, 0x0, 0xe,
-    0xff, 0xff, 0xfc, 0x0, 0xef, 0xff, 0xff, 0xfc,
-    0x2f, 0xff, 0xff, 0xff, 0x80, 0xe, 0xff, 0xff,
-    0xfb, 0x0, 0x2f, 0xff, 0xff, 0xf9, 0x0, 0xef,
-    0xff, 0xff, 0xfc, 0x2f, 0xff, 0xff, 0xff, 0x80,
-    0xb, 0xff, 0xff, 0xfe, 0x0, 0x5f, 0xff, 0xff,
-    0xf5, 0x0, 0xef, 0xff, 0xff, 0xfc, 0x2f, 0xff,
-    0xff, 0xff, 0x80, 0x8, 0xff, 0xff, 0xff, 0x10,
-    0x8f, 0xff, 0xff, 0xf2, 0x0, 0xef, 0xff, 0xff,
-    0xfc, 0x2f, 0xff, 0xff, 0xff, 0x80, 0x5, 0xff,
-    0xff, 0xff, 0x40, 0xbf, 0xff, 0xff, 0xf0, 0x0,
-    0xef, 0xff, 0xff, 0xfc, 0x2f, 0xff, 0xff, 0xff,
-    0x80, 0x1, 0xff, 0xff, 0xff, 0x70, 0xef, 0xff,
-    0xff, 0xc0, 0x0, 0xef, 0xff, 0xff, 0xfc, 0x2f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0xef, 0xff, 0xff,
-    0xa1, 0xff, 0xff, 0xff, 0x80, 0x0, 0xef, 0xff,
-    0xff, 0xfc, 0x2f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0xbf, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0xef, 0xff, 0xff, 0xfc, 0x2f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x7f, 0xff, 0xff, 0xf7, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0xef, 0xff, 0xff, 0xfc,
-    0x2f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x4f, 0xff,
-    0xff, 0xfd, 0xff, 0xff, 0xfe, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xfc, 0x2f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xfc, 0x2f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0xe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xfc, 0x2f, 0xff, 0xff, 0xff, 0x80, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xfc, 0x2f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0xef, 0xff, 0xff, 0xfc, 0x2f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xfc, 0x2f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xfc, 0x2f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0xef, 0xff, 0xff, 0xfc,
-    0x2f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xfc, 0x2f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xfc,
-
-    /* U+004E "N" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xfe, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xfe, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xfe, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xfe, 0x2f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xfe, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xfe, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xfe, 0x2f, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xfe,
-    0x2f, 0xff, 0xff, 0xff, 0xac, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xfe, 0x2f,
-    0xff, 0xff, 0xff, 0xa7, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xfe, 0x2f, 0xff,
-    0xff, 0xff, 0xa2, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xfe, 0x2f, 0xff, 0xff,
-    0xff, 0xa0, 0xdf, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xfe, 0x2f, 0xff, 0xff, 0xff,
-    0xa0, 0x8f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xfe, 0x2f, 0xff, 0xff, 0xff, 0xa0,
-    0x4f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xfe, 0x2f, 0xff, 0xff, 0xff, 0xa0, 0xe,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xfe, 0x2f, 0xff, 0xff, 0xff, 0xa0, 0xa, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0xdf, 0xff, 0xff, 0xfe,
-    0x2f, 0xff, 0xff, 0xff, 0xa0, 0x5, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0xdf, 0xff, 0xff, 0xfe, 0x2f,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0xdf, 0xff, 0xff, 0xfe, 0x2f, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0xbf, 0xff, 0xff, 0xf0,
-    0x0, 0xdf, 0xff, 0xff, 0xfe, 0x2f, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x6f, 0xff, 0xff, 0xf5, 0x0,
-    0xdf, 0xff, 0xff, 0xfe, 0x2f, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x1f, 0xff, 0xff, 0xf9, 0x0, 0xdf,
-    0xff, 0xff, 0xfe, 0x2f, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0xc, 0xff, 0xff, 0xfe, 0x0, 0xdf, 0xff,
-    0xff, 0xfe, 0x2f, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0x30, 0xdf, 0xff, 0xff,
-    0xfe, 0x2f, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0x80, 0xdf, 0xff, 0xff, 0xfe,
-    0x2f, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xd0, 0xdf, 0xff, 0xff, 0xfe, 0x2f,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xf1, 0xdf, 0xff, 0xff, 0xfe, 0x2f, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xf7, 0xef, 0xff, 0xff, 0xfe, 0x2f, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x2f, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x2f, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x2f, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x2f, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x2f, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x2f,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-
-    /* U+004F "O" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x35,
-    0x67, 0x76, 0x53, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x17,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x72, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x19, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb9, 0x9b, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x60, 0x0, 0x0,
-    0x5, 0xef, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x0,
-    0x0, 0x0, 0x0, 0x1c, 0xff, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xfe,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0x10,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0x60, 0x9, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0xa0, 0xc, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xd0, 0xe, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xf0,
-    0xf, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xf0, 0xf, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0xf1, 0x1f, 0xff, 0xff, 0xff,
-    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xf2, 0xf, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xf1,
-    0xf, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xf0, 0xd, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xe0, 0xb, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xc0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0xef, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x30,
-    0x0, 0x0, 0x2, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x98, 0x89, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x1d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3b, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x28, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x67, 0x76,
-    0x53, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0050 "P" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xec, 0x94, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x60, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb1, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x2f,
-    0xff, 0xff, 0xff, 0xe7, 0x77, 0x77, 0x77, 0x79,
-    0xdf, 0xff, 0xff, 0xff, 0xf9, 0x2, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xe0, 0x2f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0x12, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xf3, 0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0x42,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xf4, 0x2f, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0x32, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xf2, 0x2f, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xfe, 0x2, 0xff, 0xff, 0xff, 0xfe, 0x77, 0x77,
-    0x77, 0x77, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0x10, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xc9, 0x50, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-    0x67, 0x76, 0x53, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x61, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x97, 0x68, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xff, 0xff, 0xff, 0xfd, 0x40, 0x0, 0x0,
-    0x1, 0x9f, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff,
-    0xe1, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0x60,
-    0x4, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0xb0, 0x8, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xff, 0xf0, 0xb, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xf2, 0xe, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xf5,
-    0xf, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xf6, 0xf, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xf7, 0x1f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xf8, 0xf, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xf7,
-    0xf, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0xf6, 0xd, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xf4, 0xa, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xf1, 0x7, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xe0,
-    0x2, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0xdf, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xdf, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x40,
-    0x0, 0x0, 0x1, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0xb9, 0x9a, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x16, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x25, 0x67, 0x77,
-    0xef, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-
-    /* U+0052 "R" */
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0xda, 0x72, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x10, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x10,
-    0x2, 0xff, 0xff, 0xff, 0xfe, 0x99, 0x99, 0x99,
-    0x9a, 0xcf, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x2c, 0xff, 0xff, 0xff, 0xe0, 0x2, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0x20, 0x2f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xf4, 0x2, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0x60, 0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf6, 0x2,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0x50, 0x2f, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xf2, 0x2, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf, 0xff,
-    0xff, 0xfe, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xea,
-    0xaa, 0xaa, 0xaa, 0xad, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa2, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x20, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xc0, 0x4,
-    0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xfe, 0x10, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xff, 0xff, 0xff, 0x50, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xf1, 0x2, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0x80,
-    0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xfe, 0x2, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xf7,
-
-    /* U+0053 "S" */
-    0x0, 0x0, 0x0, 0x0, 0x14, 0x67, 0x87, 0x66,
-    0x41, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x20,
-    0x0, 0x0, 0x0, 0x3d, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x98, 0x9a, 0xdf, 0xff, 0xff, 0x60, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xb2, 0x0, 0x0, 0x0,
-    0x3, 0x7b, 0xf6, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x20,
-    0x0, 0xdf, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xa3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x61, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xe6, 0x0, 0x0, 0x0, 0x0, 0x1, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x3a, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x7e, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xa1, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xfb, 0x2f, 0x91, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xa2, 0xff, 0xf9, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xf8, 0x2f, 0xff,
-    0xff, 0xd8, 0x40, 0x0, 0x0, 0x2a, 0xff, 0xff,
-    0xff, 0xff, 0x42, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xcc, 0xef, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x2f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x10, 0x0, 0x7, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x49, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0x56, 0x77, 0x87, 0x64, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0054 "T" */
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x3f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0x19, 0x99, 0x99, 0x99, 0x9d, 0xff, 0xff,
-    0xff, 0xfc, 0x99, 0x99, 0x99, 0x99, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0055 "U" */
-    0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0x62,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xf6, 0x2f,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0x62, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xf6, 0x2f, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0x62, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xf6, 0x2f, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0x62, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xf6, 0x2f, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0x62, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xf6, 0x2f, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0x62, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xf6, 0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0x62, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xf6, 0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0x62, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xf6,
-    0x2f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0x62,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xf6, 0x2f,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0x62, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xf6, 0x1f, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0x60, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xf5, 0xf, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0x40, 0xef, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xf2, 0xa, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xff, 0xa0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x30, 0x0, 0x0, 0x19, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc9, 0x78, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x4e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x8c, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x93, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x45, 0x67, 0x75,
-    0x41, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0056 "V" */
-    0x5f, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xfd, 0x1f, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xf8, 0xc, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0xf3, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xe0, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xff, 0x90, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xf2, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xf6, 0x0, 0xe,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xfb, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xff, 0x40, 0xcf, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xff, 0xd5, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0057 "W" */
-    0x2f, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xb0, 0xa, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xff, 0x30, 0x3, 0xff, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0x20, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0x9f, 0xff, 0xff, 0x50, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0xc, 0xff, 0xff, 0xf4,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0xff, 0xff, 0xfd, 0xf, 0xff,
-    0xff, 0xb0, 0x0, 0xe, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x2f, 0xff, 0xff, 0xb0, 0xef, 0xff, 0xfe,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0x10, 0x5,
-    0xff, 0xff, 0xf8, 0xb, 0xff, 0xff, 0xf1, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x8f, 0xff,
-    0xff, 0x50, 0x8f, 0xff, 0xff, 0x40, 0x7, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0x70, 0xb, 0xff, 0xff, 0xf2,
-    0x5, 0xff, 0xff, 0xf7, 0x0, 0xaf, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xfa, 0x0, 0xef, 0xff, 0xff, 0x0, 0x3f,
-    0xff, 0xff, 0xa0, 0xd, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xd0, 0x1f, 0xff, 0xff, 0xd0, 0x0, 0xff, 0xff,
-    0xfd, 0x0, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0x4,
-    0xff, 0xff, 0xfa, 0x0, 0xd, 0xff, 0xff, 0xf0,
-    0x3f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xf3, 0x7f, 0xff,
-    0xff, 0x70, 0x0, 0xbf, 0xff, 0xff, 0x36, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0x6a, 0xff, 0xff, 0xf5,
-    0x0, 0x8, 0xff, 0xff, 0xf6, 0x9f, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xf9, 0xdf, 0xff, 0xff, 0x20, 0x0,
-    0x5f, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xdf, 0xff, 0xff, 0xf0, 0x0, 0x3, 0xff,
-    0xff, 0xfd, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0058 "X" */
-    0xe, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0xfe, 0x10, 0x3f, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xff, 0xff, 0xff, 0xf4, 0x4, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff, 0xe2,
-    0xef, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x7f, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x1, 0xef, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xff, 0xc0,
-
-    /* U+0059 "Y" */
-    0x3f, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0xbf, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xff, 0xc0, 0x2,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0x40, 0x3f, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xfc, 0xb, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xf7, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf6, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x60, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x5,
-    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-    0xcf, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xd1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
-    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
-    0xff, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x99, 0x99,
-    0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd,
-
-    /* U+005B "[" */
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xaf, 0xff, 0xff, 0xf6, 0x22, 0x21,
-    0xaf, 0xff, 0xff, 0xf5, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xf5, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xf5, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xf5, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xf5, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xf5, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xf5, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xf5, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xf6, 0x22, 0x21,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xfd,
-
-    /* U+005C "\\" */
-    0x2f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xf6,
-
-    /* U+005D "]" */
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x12, 0x22, 0x8f, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xf8, 0x12, 0x22, 0x8f, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8,
-
-    /* U+005E "^" */
-    0x0, 0x0, 0x0, 0x0, 0x78, 0x88, 0x88, 0x85,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xfb, 0xdf, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xf5, 0x8f, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xe0, 0x2f, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0x90, 0xc, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0x30, 0x6, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xf7, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf9, 0x0,
-    0x2, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0x0, 0x9, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x60,
-    0xe, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xd0,
-
-    /* U+005F "_" */
-    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0xee, 0xee, 0xee, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff,
-
-    /* U+0060 "`" */
-    0x8, 0xee, 0xee, 0xee, 0xa0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xfe, 0x10, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0x80,
-
-    /* U+0061 "a" */
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x57, 0x76, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x18, 0xef, 0xff, 0xff, 0xfe, 0x71, 0x6f,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xaf, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0xcf, 0xff, 0xff,
-    0xff, 0xfe, 0x73, 0x35, 0x9e, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x4, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x1, 0xcf, 0xff, 0xff, 0xff, 0x50,
-    0xa, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0,
-    0x0, 0x1e, 0xff, 0xff, 0xff, 0x50, 0xf, 0xff,
-    0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0x50, 0x3f, 0xff, 0xff, 0xff,
-    0x80, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0x50, 0x6f, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0x50,
-    0x7f, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0x50, 0x8f, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0x50, 0x8f, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0x50, 0x7f, 0xff, 0xff, 0xfe, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0x50,
-    0x6f, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0x50, 0x3f, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0x50, 0xf, 0xff, 0xff, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0x50, 0xb, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xff, 0x50,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x1, 0xcf, 0xff, 0xff, 0xff, 0x50, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0xfd, 0x62, 0x24, 0x9e, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x5, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x18,
-    0xef, 0xff, 0xff, 0xff, 0xc6, 0x1, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x2, 0x57,
-    0x76, 0x51, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0062 "b" */
-    0x9, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x4, 0x67, 0x65, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xf1, 0x29, 0xff, 0xff,
-    0xff, 0xfd, 0x60, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x30, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xff, 0xd8, 0x42, 0x38, 0xff, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x9, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff, 0x60,
-    0x9, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xa0, 0x9, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xe0, 0x9, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xf1, 0x9, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xf2,
-    0x9, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xf3, 0x9, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0xf3, 0x9, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0xf3, 0x9, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xf1,
-    0x9, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xf0, 0x9, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0xb0, 0x9, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xff,
-    0xff, 0x60, 0x9, 0xff, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xff, 0x10,
-    0x9, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x31, 0x27,
-    0xef, 0xff, 0xff, 0xff, 0xf9, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xe1, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xfd, 0x1, 0x7e, 0xff, 0xff, 0xff, 0xfd,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x25, 0x67, 0x75, 0x20, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x46, 0x77,
-    0x65, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0x9e, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x72, 0x0,
-    0x0, 0x0, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xca, 0xaa, 0xbe, 0xff,
-    0xa0, 0xe, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x0,
-    0x0, 0x0, 0x1, 0x67, 0x7, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xfb,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0xef,
-    0xff, 0xff, 0xff, 0xff, 0x93, 0x0, 0x0, 0x0,
-    0x4a, 0xf0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xdb, 0xbd, 0xff, 0xff, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x1, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x18,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x14, 0x67, 0x77, 0x63,
-    0x10, 0x0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x2, 0x57,
-    0x76, 0x20, 0x0, 0x6f, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x18, 0xef, 0xff, 0xff, 0xfe,
-    0x70, 0x6f, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xaf,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xfd, 0x62, 0x24, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x4, 0xff, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x1, 0xcf, 0xff, 0xff,
-    0xff, 0x50, 0xa, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xff, 0x50,
-    0xf, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x50, 0x3f, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0x50, 0x6f, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0x50, 0x7f, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x50,
-    0x8f, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x50, 0x8f, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0x50, 0x7f, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0x50, 0x6f, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0x50,
-    0x3f, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x50, 0xf, 0xff,
-    0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0x50, 0xb, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0x50, 0x5, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0xdf, 0xff, 0xff, 0xff, 0xfd, 0x52, 0x14,
-    0x8e, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc9, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x19, 0xef, 0xff, 0xff, 0xff, 0xc5, 0x1,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0x67, 0x76, 0x41, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0065 "e" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x35, 0x67, 0x65,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xe6, 0x31,
-    0x25, 0xbf, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x3e,
-    0xff, 0xff, 0xff, 0x90, 0xc, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0x0, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf3, 0x4f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x76, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xa6, 0xff, 0xff, 0xff, 0xf7, 0x77,
-    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x74,
-    0x5f, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4d, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xbf, 0xf0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x75, 0x34, 0x56, 0xae, 0xff, 0xff,
-    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x1b, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0x6, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4a, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x61, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x14, 0x56, 0x77, 0x65, 0x20, 0x0,
-    0x0, 0x0,
-
-    /* U+0066 "f" */
-    0x0, 0x0, 0x0, 0x0, 0x38, 0xbd, 0xff, 0xff,
-    0xfe, 0x20, 0x0, 0x0, 0x1, 0xbf, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff, 0xee,
-    0xf3, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xea, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x57, 0x76, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0x8e, 0xff, 0xff, 0xff, 0xe8, 0x17, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xbf, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xfe, 0x73,
-    0x35, 0xaf, 0xff, 0xff, 0xff, 0xff, 0x0, 0x4f,
-    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x1c,
-    0xff, 0xff, 0xff, 0xf0, 0xa, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff,
-    0xff, 0x0, 0xff, 0xff, 0xff, 0xfe, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf0, 0x3f,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0x6, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x8,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xf0, 0x8f, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xf0,
-    0x6f, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0x3, 0xff, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xf0, 0xf, 0xff, 0xff, 0xff, 0xe1,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0xff, 0xf0, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x1, 0xcf,
-    0xff, 0xff, 0xff, 0x0, 0xd, 0xff, 0xff, 0xff,
-    0xff, 0xd6, 0x22, 0x49, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x18, 0xef, 0xff, 0xff, 0xff, 0xb4,
-    0x8f, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x35, 0x77, 0x64, 0x10, 0xb, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xdf, 0xff, 0xff, 0xff, 0xc0, 0x4, 0xb8, 0x53,
-    0x10, 0x0, 0x0, 0x0, 0x6, 0xef, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x5f, 0xff, 0xff, 0xfe, 0xcc,
-    0xbc, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe5, 0x0, 0x0, 0x3, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-    0x91, 0x0, 0x0, 0x0, 0x0, 0x3, 0x58, 0xac,
-    0xde, 0xff, 0xfe, 0xdb, 0x85, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0068 "h" */
-    0x9f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x5a, 0xde, 0xfe, 0xb6,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xf1, 0x8,
-    0xef, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0x5e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x50, 0x9, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0x83, 0x2,
-    0x6e, 0xff, 0xff, 0xff, 0xff, 0x29, 0xff, 0xff,
-    0xff, 0xfa, 0x10, 0x0, 0x0, 0x1e, 0xff, 0xff,
-    0xff, 0xf3, 0x9f, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0x49, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xf4, 0x9f, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0x49,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xf4, 0x9f, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0x49, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xf4, 0x9f, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0x49, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xf4, 0x9f, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0x49, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xf4, 0x9f,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x6f,
-    0xff, 0xff, 0xff, 0x49, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xf4,
-    0x9f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0x49, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xf4, 0x9f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0x49, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xf4, 0x9f, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0x49, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xf4,
-
-    /* U+0069 "i" */
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb,
-    0xff, 0xff, 0xff, 0xfb, 0xcd, 0xdd, 0xdd, 0xd9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb,
-    0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb,
-
-    /* U+006A "j" */
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0xbd, 0xdd, 0xdd, 0xda,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x2, 0xbf, 0xff, 0xff, 0xff, 0xf2, 0x89, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x50, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xd1, 0x0, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x10,
-    0x0, 0xff, 0xff, 0xff, 0xfb, 0x40, 0x0, 0x0,
-    0xee, 0xdc, 0x96, 0x10, 0x0, 0x0, 0x0,
-
-    /* U+006B "k" */
-    0x9f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xc0, 0x9f, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xfe, 0x20,
-    0x9f, 0xff, 0xff, 0xff, 0x10, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x6f, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0x10, 0x3, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0x10, 0xd, 0xff, 0xff, 0xff, 0xe1, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0x10, 0xaf, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0x16, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0x10, 0x4f, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0x10, 0x6, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0xbf, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x1f, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x7, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xf6, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xfd, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xff, 0x50, 0x9f, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xc0,
-    0x9f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf3, 0x9f, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xfa,
-
-    /* U+006C "l" */
-    0x9f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x9, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x9, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x9, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x9, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xe1,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x75,
-    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x2, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x5, 0xef, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x6b, 0xef, 0xff, 0xfc,
-
-    /* U+006D "m" */
-    0x9f, 0xff, 0xff, 0xff, 0x10, 0x1, 0x6a, 0xde,
-    0xfd, 0xb5, 0x0, 0x0, 0x0, 0x48, 0xce, 0xfe,
-    0xc8, 0x20, 0x0, 0x9, 0xff, 0xff, 0xff, 0xf1,
-    0x19, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x20, 0x5,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x70, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x9f, 0xff, 0xff,
-    0xff, 0xfe, 0x83, 0x2, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xb5, 0x11, 0x4d, 0xff, 0xff, 0xff, 0xff,
-    0x19, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x1e,
-    0xff, 0xff, 0xff, 0xf2, 0x9f, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0x29,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xf2, 0x9f, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0x29, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xf2, 0x9f, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0x29, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0xf2, 0x9f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xff, 0x29, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xf2,
-    0x9f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0x29, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xf2, 0x9f,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xef,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0x29, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xf2, 0x9f, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xef, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0x29, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xf2, 0x9f, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0x29, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xf2, 0x9f, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0x29,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xf2,
-
-    /* U+006E "n" */
-    0x9f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x38, 0xce,
-    0xfe, 0xd9, 0x30, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xf1, 0x5, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0x2b, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x9, 0xff, 0xff,
-    0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xc5, 0x10, 0x3a, 0xff, 0xff, 0xff, 0xff, 0xa9,
-    0xff, 0xff, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xfb, 0x9f, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xb9, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xfb, 0x9f, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xb9, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xfb, 0x9f, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xb9, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xfb, 0x9f,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xb9, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xfb,
-    0x9f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xb9, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xfb, 0x9f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xb9, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xfb, 0x9f, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xb9, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xfb, 0x9f, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xb9,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xfb, 0x9f, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xb9, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xfb,
-
-    /* U+006F "o" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x25, 0x67, 0x76,
-    0x52, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xae, 0xff, 0xff, 0xff, 0xff, 0xea,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xff, 0xfb, 0x63, 0x35, 0xaf, 0xff, 0xff, 0xff,
-    0xfe, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0xb, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xd0, 0xf, 0xff,
-    0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xf1, 0x4f, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xf5, 0x6f, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xf7,
-    0x7f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xf8, 0x8f, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xfa, 0x8f, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xf9, 0x7f, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf9,
-    0x5f, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xf7, 0x2f, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xf4, 0xe, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0xf0, 0x9, 0xff, 0xff, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xa0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0xfd, 0x63, 0x36, 0xcf, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x1e, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe1, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xe3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0x8d, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-    0x67, 0x76, 0x52, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0070 "p" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x46,
-    0x76, 0x41, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0x10, 0x2a, 0xff, 0xff, 0xff,
-    0xfc, 0x50, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xf1, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xc2, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x84, 0x34, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x3e, 0xff,
-    0xff, 0xff, 0xfe, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x9f, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0x90, 0x9, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xfd, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xf0, 0x9, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x5f, 0xff, 0xff, 0xff, 0x10, 0x9f, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xf2, 0x9, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0x20, 0x9f, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0xf1,
-    0x9, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xff, 0xd0, 0x9, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff,
-    0xff, 0x50, 0x9, 0xff, 0xff, 0xff, 0xff, 0x70,
-    0x0, 0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x32,
-    0x38, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0x5e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xf1, 0x7, 0xdf,
-    0xff, 0xff, 0xff, 0xc6, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x25, 0x67,
-    0x65, 0x10, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x57, 0x75, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x8e, 0xff, 0xff, 0xff, 0xe7, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x47, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0xcf, 0xff, 0xff, 0xff, 0xfe, 0x73, 0x35, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x1c, 0xff,
-    0xff, 0xff, 0xff, 0x30, 0xa, 0xff, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0xff, 0xff, 0xff, 0xfe, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0x30, 0x3f, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xf3, 0x6,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0x30, 0x7f, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xf3, 0x8, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0x30, 0x8f, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xf3, 0x7, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x30,
-    0x6f, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xf3, 0x3, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0x30, 0xf, 0xff, 0xff,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0xbf, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xff, 0x30, 0x5, 0xff, 0xff, 0xff, 0xff, 0xa0,
-    0x0, 0x0, 0x1, 0xcf, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x22,
-    0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf3, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x8f, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x18, 0xef, 0xff, 0xff,
-    0xff, 0xb4, 0x7, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x35, 0x77, 0x64, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+0072 "r" */
-    0x9f, 0xff, 0xff, 0xff, 0x10, 0x5, 0xbe, 0xfe,
-    0x99, 0xff, 0xff, 0xff, 0xf1, 0x5e, 0xff, 0xff,
-    0xfd, 0x9f, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff,
-    0xff, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfd, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x9f, 0xff, 0xff, 0xff, 0xff,
-    0xc6, 0x21, 0x1, 0x39, 0xff, 0xff, 0xff, 0xfe,
-    0x40, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xf1,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x0, 0x0, 0x0, 0x1, 0x45, 0x77, 0x65, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x7c, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x82, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0xcf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xfa, 0x65, 0x67, 0xbf, 0xff,
-    0xf0, 0x3, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x4, 0x9e, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x10, 0x1, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xe, 0xff, 0xff, 0xff, 0xfe, 0x71, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0xff, 0xfb, 0x50, 0x0, 0x0, 0x0, 0x0, 0xaf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x20, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x4c, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
-    0x3, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0x7e, 0xff, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xfa, 0x34, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xd5,
-    0xfb, 0x30, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xfd, 0x5f, 0xff, 0xd7, 0x30, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xff,
-    0xec, 0xa9, 0xcf, 0xff, 0xff, 0xff, 0xfa, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x45, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xc0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x1, 0x8e,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2,
-    0x0, 0x0, 0x4, 0x8d, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24,
-    0x67, 0x77, 0x52, 0x0, 0x0, 0x0,
-
-    /* U+0074 "t" */
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x95, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x95, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x95, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xff, 0xe9, 0x89, 0x40, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x1, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x14, 0x67, 0x77,
-    0x65, 0x10,
-
-    /* U+0075 "u" */
-    0xaf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xb0, 0xaf, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xb0, 0xaf, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xb0, 0xaf,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xb0, 0xaf, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xb0, 0xaf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xb0, 0xaf, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xb0, 0xaf, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xb0,
-    0xaf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xb0, 0xaf, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xb0, 0xaf, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xb0, 0xaf,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0xb0, 0xaf, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xb0, 0xaf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0xb0, 0xaf, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xb0, 0xaf, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xb0,
-    0xaf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0xb0, 0xaf, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xb0, 0xaf, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0xb0, 0x9f,
-    0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x5d, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0x7f, 0xff, 0xff, 0xff,
-    0xfe, 0x98, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xb0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0xc, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xb0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x95, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4,
-    0x1, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x2, 0xaf,
-    0xff, 0xff, 0xff, 0xb5, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xf7, 0x0, 0x0, 0x1, 0x56, 0x76, 0x41,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+0076 "v" */
-    0x9f, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x44, 0xff,
-    0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xff, 0xe0, 0xf, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0xaf, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0x50, 0x5, 0xff, 0xff, 0xff, 0xf5, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0xbf, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0x50, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xf1, 0x0,
-    0x0, 0x6, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xff, 0xff, 0xfa, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xe0, 0x0, 0x4, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x8f, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xf8,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xc0, 0x2,
-    0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xff, 0x10, 0x7f, 0xff,
-    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xff, 0xff, 0xf6, 0xb, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xa0, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xff, 0x5f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xfe,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+0077 "w" */
-    0x2f, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xf5, 0xd, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xf1, 0x8, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xc0, 0x3,
-    0xff, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x1f,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xff, 0x70, 0x0, 0xef, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0xaf, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0xcf, 0xff,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0x50, 0x0, 0x3,
-    0xff, 0xff, 0xfe, 0xff, 0xff, 0x80, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x7, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x7, 0xff, 0xff, 0xc9,
-    0xff, 0xff, 0xb0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xb0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0xb, 0xff, 0xff, 0x96, 0xff, 0xff, 0xf0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0xef, 0xff, 0xff, 0xf1, 0x0, 0xe, 0xff,
-    0xff, 0x63, 0xff, 0xff, 0xf3, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xf5, 0x0, 0x2f, 0xff, 0xff, 0x30, 0xff,
-    0xff, 0xf6, 0x0, 0x1f, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf8, 0x0,
-    0x6f, 0xff, 0xff, 0x0, 0xcf, 0xff, 0xfa, 0x0,
-    0x5f, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xfc, 0x0, 0xaf, 0xff, 0xfc,
-    0x0, 0x9f, 0xff, 0xfe, 0x0, 0x8f, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0x0, 0xdf, 0xff, 0xf9, 0x0, 0x6f, 0xff,
-    0xff, 0x10, 0xcf, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0x41, 0xff,
-    0xff, 0xf6, 0x0, 0x2f, 0xff, 0xff, 0x50, 0xff,
-    0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0x85, 0xff, 0xff, 0xf2, 0x0,
-    0xf, 0xff, 0xff, 0x94, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xc8, 0xff, 0xff, 0xf0, 0x0, 0xc, 0xff, 0xff,
-    0xc8, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8f, 0xff, 0xff, 0xfd, 0xff, 0xff,
-    0xc0, 0x0, 0x9, 0xff, 0xff, 0xfd, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+0078 "x" */
-    0xb, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0xff, 0xfc, 0x0, 0x1e,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0x10, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0x50, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0x20, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xf6, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0xf2, 0x1, 0xef,
-    0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xb, 0xff, 0xff, 0xff, 0xc0, 0xaf, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xdf, 0xff, 0xff, 0xfd, 0xff, 0xff,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xfd, 0xc, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0x30, 0x2f, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x10, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xe0, 0x0,
-    0x0, 0xdf, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x2, 0xff,
-    0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0xcf, 0xff, 0xff,
-    0xfe, 0x10, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff,
-    0xff, 0xd0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0x90,
-
-    /* U+0079 "y" */
-    0xcf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xfb, 0x6f, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xf6, 0xe, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xff, 0xf2, 0x9, 0xff, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xd0,
-    0x2, 0xff, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x5f, 0xff, 0xff, 0xff, 0x80, 0x0, 0xbf,
-    0xff, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff,
-    0xfe, 0x0, 0x0, 0xe, 0xff, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xf1, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0xb, 0xff,
-    0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0x30, 0x0, 0x4f, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0x90, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0xff, 0xff, 0xf0, 0x0, 0xdf, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
-    0xff, 0xff, 0xf6, 0x1, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xfc, 0x6, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0x2a,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xa, 0xcc, 0xce, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x9, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xff,
-    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x17, 0xff, 0xff, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x14, 0x56, 0x9c,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xfa,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7f, 0xed, 0xc9, 0x74, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+007A "z" */
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x30, 0x8f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x30, 0x8f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x30, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xfd, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0xfe,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xef, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xff, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xfe, 0xee, 0xee, 0xee, 0xee, 0xee,
-    0xee, 0x89, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x99, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf9, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf9,
-
-    /* U+007B "{" */
-    0x0, 0x0, 0x0, 0x0, 0x4, 0x8b, 0xde, 0xb0,
-    0x0, 0x0, 0x0, 0x5e, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x7f, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0,
-    0x1f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xbf,
-    0xff, 0xff, 0xff, 0x95, 0x30, 0x0, 0xe, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xf1, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0xf0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x1, 0x4e,
-    0xff, 0xff, 0xff, 0x80, 0x0, 0x6, 0xff, 0xff,
-    0xff, 0xff, 0xe1, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xc2, 0x0, 0x0, 0x6, 0xff, 0xff, 0xfc,
-    0x40, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff,
-    0x90, 0x0, 0x0, 0x6, 0xff, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x3, 0x6e, 0xff, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xfc,
-    0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x0,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0xf0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xff, 0x95, 0x30, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff,
-    0xff, 0xc0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x0, 0x4, 0x8b, 0xee,
-    0xb0,
-
-    /* U+007C "|" */
-    0x8e, 0xee, 0xee, 0x59, 0xff, 0xff, 0xf5, 0x9f,
-    0xff, 0xff, 0x59, 0xff, 0xff, 0xf5, 0x9f, 0xff,
-    0xff, 0x59, 0xff, 0xff, 0xf5, 0x9f, 0xff, 0xff,
-    0x59, 0xff, 0xff, 0xf5, 0x9f, 0xff, 0xff, 0x59,
-    0xff, 0xff, 0xf5, 0x9f, 0xff, 0xff, 0x59, 0xff,
-    0xff, 0xf5, 0x9f, 0xff, 0xff, 0x59, 0xff, 0xff,
-    0xf5, 0x9f, 0xff, 0xff, 0x59, 0xff, 0xff, 0xf5,
-    0x9f, 0xff, 0xff, 0x59, 0xff, 0xff, 0xf5, 0x9f,
-    0xff, 0xff, 0x59, 0xff, 0xff, 0xf5, 0x9f, 0xff,
-    0xff, 0x59, 0xff, 0xff, 0xf5, 0x9f, 0xff, 0xff,
-    0x59, 0xff, 0xff, 0xf5, 0x9f, 0xff, 0xff, 0x59,
-    0xff, 0xff, 0xf5, 0x9f, 0xff, 0xff, 0x59, 0xff,
-    0xff, 0xf5, 0x9f, 0xff, 0xff, 0x59, 0xff, 0xff,
-    0xf5, 0x9f, 0xff, 0xff, 0x59, 0xff, 0xff, 0xf5,
-    0x9f, 0xff, 0xff, 0x59, 0xff, 0xff, 0xf5, 0x9f,
-    0xff, 0xff, 0x59, 0xff, 0xff, 0xf5, 0x9f, 0xff,
-    0xff, 0x59, 0xff, 0xff, 0xf5, 0x9f, 0xff, 0xff,
-    0x59, 0xff, 0xff, 0xf5, 0x9f, 0xff, 0xff, 0x59,
-    0xff, 0xff, 0xf5, 0x9f, 0xff, 0xff, 0x59, 0xff,
-    0xff, 0xf5, 0x9f, 0xff, 0xff, 0x59, 0xff, 0xff,
-    0xf5, 0x9f, 0xff, 0xff, 0x50,
-
-    /* U+007D "}" */
-    0xee, 0xdb, 0x72, 0x0, 0x0, 0x0, 0x0, 0xf,
-    0xff, 0xff, 0xfc, 0x30, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0x46, 0xaf, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xb0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xfc, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xd0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xd0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0xf, 0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xfc, 0x30, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x3,
-    0xcf, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x6e, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x2, 0xcf,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0xfd, 0x52, 0x0, 0x0, 0xf, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xfd, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xfc, 0x0, 0x0, 0x0, 0x5, 0xff,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x9f, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x46, 0xaf, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff,
-    0xf4, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0xf, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xfd, 0x30, 0x0, 0x0,
-    0x0, 0xee, 0xdb, 0x83, 0x0, 0x0, 0x0, 0x0,
-    0x0,
-
-    /* U+007E "~" */
-    0x0, 0x0, 0x3, 0x44, 0x31, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3b, 0xff,
-    0xff, 0xff, 0xd7, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x66, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0,
-    0x0, 0x0, 0x2b, 0xf6, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xc7, 0x56, 0x8c, 0xff,
-    0xf6, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x9f, 0xfb, 0x62, 0x0, 0x27,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
-    0x9d, 0x30, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf3, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3c, 0xff, 0xff, 0xff, 0xff,
-    0xfc, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x38, 0xce, 0xff, 0xd9, 0x40, 0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 200, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 286, .box_w = 9, .box_h = 34, .ofs_x = 4, .ofs_y = 0},
-    {.bitmap_index = 153, .adv_w = 319, .box_w = 16, .box_h = 15, .ofs_x = 2, .ofs_y = 25},
-    {.bitmap_index = 273, .adv_w = 461, .box_w = 29, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 766, .adv_w = 453, .box_w = 24, .box_h = 46, .ofs_x = 2, .ofs_y = -7},
-    {.bitmap_index = 1318, .adv_w = 639, .box_w = 36, .box_h = 36, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 1966, .adv_w = 506, .box_w = 31, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 2524, .adv_w = 176, .box_w = 7, .box_h = 15, .ofs_x = 2, .ofs_y = 25},
-    {.bitmap_index = 2577, .adv_w = 304, .box_w = 15, .box_h = 47, .ofs_x = 3, .ofs_y = -7},
-    {.bitmap_index = 2930, .adv_w = 304, .box_w = 15, .box_h = 47, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 3283, .adv_w = 355, .box_w = 20, .box_h = 19, .ofs_x = 1, .ofs_y = 19},
-    {.bitmap_index = 3473, .adv_w = 445, .box_w = 26, .box_h = 26, .ofs_x = 1, .ofs_y = 3},
-    {.bitmap_index = 3811, .adv_w = 253, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = -6},
-    {.bitmap_index = 3901, .adv_w = 338, .box_w = 15, .box_h = 6, .ofs_x = 3, .ofs_y = 12},
-    {.bitmap_index = 3946, .adv_w = 253, .box_w = 9, .box_h = 8, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 3982, .adv_w = 385, .box_w = 20, .box_h = 37, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 4352, .adv_w = 453, .box_w = 25, .box_h = 36, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 4802, .adv_w = 323, .box_w = 14, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5040, .adv_w = 453, .box_w = 24, .box_h = 35, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 5460, .adv_w = 453, .box_w = 23, .box_h = 36, .ofs_x = 3, .ofs_y = -1},
-    {.bitmap_index = 5874, .adv_w = 453, .box_w = 26, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 6316, .adv_w = 453, .box_w = 23, .box_h = 35, .ofs_x = 3, .ofs_y = -1},
-    {.bitmap_index = 6719, .adv_w = 453, .box_w = 25, .box_h = 36, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 7169, .adv_w = 422, .box_w = 24, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 7577, .adv_w = 453, .box_w = 26, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 8045, .adv_w = 453, .box_w = 25, .box_h = 36, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 8495, .adv_w = 310, .box_w = 9, .box_h = 26, .ofs_x = 5, .ofs_y = 0},
-    {.bitmap_index = 8612, .adv_w = 310, .box_w = 12, .box_h = 33, .ofs_x = 2, .ofs_y = -7},
-    {.bitmap_index = 8810, .adv_w = 445, .box_w = 26, .box_h = 29, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 9187, .adv_w = 445, .box_w = 26, .box_h = 19, .ofs_x = 1, .ofs_y = 7},
-    {.bitmap_index = 9434, .adv_w = 445, .box_w = 26, .box_h = 29, .ofs_x = 1, .ofs_y = 2},
-    {.bitmap_index = 9811, .adv_w = 345, .box_w = 20, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 10151, .adv_w = 656, .box_w = 39, .box_h = 40, .ofs_x = 1, .ofs_y = -5},
-    {.bitmap_index = 10931, .adv_w = 557, .box_w = 33, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 11492, .adv_w = 518, .box_w = 29, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 11985, .adv_w = 525, .box_w = 30, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 12525, .adv_w = 540, .box_w = 30, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 13035, .adv_w = 447, .box_w = 25, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 13460, .adv_w = 425, .box_w = 24, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 13868, .adv_w = 541, .box_w = 31, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 14426, .adv_w = 552, .box_w = 30, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 14936, .adv_w = 223, .box_w = 8, .box_h = 34, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 15072, .adv_w = 253, .box_w = 14, .box_h = 42, .ofs_x = -1, .ofs_y = -8},
-    {.bitmap_index = 15366, .adv_w = 517, .box_w = 31, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 15893, .adv_w = 401, .box_w = 23, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 16284, .adv_w = 682, .box_w = 38, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 16930, .adv_w = 557, .box_w = 30, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 17440, .adv_w = 609, .box_w = 36, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 18088, .adv_w = 508, .box_w = 29, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 18581, .adv_w = 615, .box_w = 36, .box_h = 39, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 19283, .adv_w = 507, .box_w = 29, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 19776, .adv_w = 436, .box_w = 25, .box_h = 36, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 20226, .adv_w = 430, .box_w = 27, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 20685, .adv_w = 564, .box_w = 31, .box_h = 35, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 21228, .adv_w = 551, .box_w = 34, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 21806, .adv_w = 717, .box_w = 45, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 22571, .adv_w = 561, .box_w = 35, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 23166, .adv_w = 498, .box_w = 31, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 23693, .adv_w = 501, .box_w = 29, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 24186, .adv_w = 254, .box_w = 12, .box_h = 47, .ofs_x = 3, .ofs_y = -7},
-    {.bitmap_index = 24468, .adv_w = 388, .box_w = 24, .box_h = 42, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 24972, .adv_w = 254, .box_w = 12, .box_h = 47, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 25254, .adv_w = 445, .box_w = 24, .box_h = 19, .ofs_x = 2, .ofs_y = 17},
-    {.bitmap_index = 25482, .adv_w = 384, .box_w = 24, .box_h = 5, .ofs_x = 0, .ofs_y = -10},
-    {.bitmap_index = 25542, .adv_w = 333, .box_w = 13, .box_h = 7, .ofs_x = 2, .ofs_y = 32},
-    {.bitmap_index = 25588, .adv_w = 475, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 25980, .adv_w = 475, .box_w = 28, .box_h = 39, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 26526, .adv_w = 407, .box_w = 23, .box_h = 28, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 26848, .adv_w = 475, .box_w = 28, .box_h = 39, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 27394, .adv_w = 466, .box_w = 27, .box_h = 28, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 27772, .adv_w = 307, .box_w = 19, .box_h = 38, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 28133, .adv_w = 471, .box_w = 27, .box_h = 38, .ofs_x = 1, .ofs_y = -11},
-    {.bitmap_index = 28646, .adv_w = 458, .box_w = 25, .box_h = 38, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 29121, .adv_w = 220, .box_w = 8, .box_h = 38, .ofs_x = 3, .ofs_y = 0},
-    {.bitmap_index = 29273, .adv_w = 243, .box_w = 14, .box_h = 49, .ofs_x = -1, .ofs_y = -11},
-    {.bitmap_index = 29616, .adv_w = 422, .box_w = 24, .box_h = 38, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 30072, .adv_w = 244, .box_w = 13, .box_h = 38, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 30319, .adv_w = 681, .box_w = 39, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 30826, .adv_w = 466, .box_w = 25, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 31151, .adv_w = 482, .box_w = 28, .box_h = 28, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 31543, .adv_w = 486, .box_w = 29, .box_h = 38, .ofs_x = 1, .ofs_y = -11},
-    {.bitmap_index = 32094, .adv_w = 490, .box_w = 29, .box_h = 38, .ofs_x = 1, .ofs_y = -11},
-    {.bitmap_index = 32645, .adv_w = 313, .box_w = 17, .box_h = 26, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 32866, .adv_w = 368, .box_w = 21, .box_h = 28, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 33160, .adv_w = 281, .box_w = 17, .box_h = 35, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 33458, .adv_w = 465, .box_w = 26, .box_h = 27, .ofs_x = 2, .ofs_y = -1},
-    {.bitmap_index = 33809, .adv_w = 458, .box_w = 29, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 34186, .adv_w = 676, .box_w = 42, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 34732, .adv_w = 465, .box_w = 29, .box_h = 26, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 35109, .adv_w = 446, .box_w = 28, .box_h = 37, .ofs_x = 0, .ofs_y = -11},
-    {.bitmap_index = 35627, .adv_w = 396, .box_w = 23, .box_h = 26, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 35926, .adv_w = 268, .box_w = 15, .box_h = 47, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 36279, .adv_w = 172, .box_w = 7, .box_h = 47, .ofs_x = 2, .ofs_y = -7},
-    {.bitmap_index = 36444, .adv_w = 268, .box_w = 15, .box_h = 47, .ofs_x = 1, .ofs_y = -7},
-    {.bitmap_index = 36797, .adv_w = 445, .box_w = 26, .box_h = 11, .ofs_x = 1, .ofs_y = 11}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    }
-};
-
-/*-----------------
- *    KERNING
- *----------------*/
-
-
-/*Pair left and right glyphs for kerning*/
-static const uint8_t kern_pair_glyph_ids[] =
-{
-    7, 43,
-    9, 75,
-    19, 21,
-    19, 23,
-    19, 26,
-    21, 26,
-    34, 43,
-    34, 53,
-    34, 55,
-    34, 56,
-    34, 58,
-    34, 66,
-    34, 68,
-    34, 70,
-    34, 72,
-    34, 80,
-    34, 82,
-    36, 43,
-    37, 43,
-    37, 53,
-    37, 55,
-    37, 56,
-    37, 57,
-    37, 58,
-    37, 59,
-    38, 43,
-    39, 15,
-    39, 34,
-    39, 66,
-    39, 68,
-    39, 70,
-    39, 72,
-    39, 80,
-    39, 82,
-    40, 43,
-    41, 43,
-    42, 43,
-    44, 43,
-    44, 48,
-    44, 66,
-    44, 68,
-    44, 70,
-    44, 72,
-    44, 80,
-    44, 82,
-    45, 34,
-    45, 43,
-    45, 48,
-    45, 53,
-    45, 55,
-    45, 56,
-    45, 58,
-    46, 43,
-    47, 43,
-    48, 43,
-    48, 53,
-    48, 55,
-    48, 56,
-    48, 57,
-    48, 58,
-    48, 59,
-    49, 15,
-    49, 34,
-    49, 57,
-    50, 43,
-    50, 53,
-    50, 55,
-    50, 56,
-    50, 57,
-    50, 58,
-    50, 59,
-    51, 43,
-    51, 58,
-    51, 66,
-    51, 68,
-    51, 70,
-    51, 72,
-    51, 80,
-    51, 82,
-    53, 15,
-    53, 34,
-    53, 40,
-    53, 48,
-    53, 50,
-    53, 66,
-    53, 68,
-    53, 70,
-    53, 72,
-    53, 75,
-    53, 78,
-    53, 79,
-    53, 80,
-    53, 81,
-    53, 82,
-    53, 83,
-    53, 84,
-    53, 86,
-    55, 15,
-    55, 34,
-    55, 40,
-    55, 48,
-    55, 50,
-    55, 66,
-    55, 68,
-    55, 70,
-    55, 72,
-    55, 75,
-    55, 78,
-    55, 79,
-    55, 80,
-    55, 81,
-    55, 82,
-    55, 83,
-    55, 84,
-    55, 86,
-    56, 15,
-    56, 34,
-    56, 40,
-    56, 48,
-    56, 50,
-    56, 66,
-    56, 68,
-    56, 70,
-    56, 72,
-    56, 75,
-    56, 78,
-    56, 79,
-    56, 80,
-    56, 81,
-    56, 82,
-    56, 83,
-    56, 84,
-    56, 86,
-    57, 15,
-    57, 40,
-    57, 43,
-    57, 48,
-    57, 50,
-    57, 66,
-    57, 68,
-    57, 70,
-    57, 72,
-    57, 80,
-    57, 82,
-    57, 84,
-    58, 15,
-    58, 34,
-    58, 40,
-    58, 48,
-    58, 50,
-    58, 66,
-    58, 68,
-    58, 69,
-    58, 70,
-    58, 72,
-    58, 75,
-    58, 78,
-    58, 79,
-    58, 80,
-    58, 81,
-    58, 82,
-    58, 83,
-    58, 84,
-    58, 85,
-    58, 86,
-    59, 40,
-    59, 43,
-    59, 48,
-    59, 50,
-    60, 43,
-    60, 75,
-    61, 43,
-    61, 75,
-    66, 43,
-    67, 53,
-    67, 55,
-    67, 56,
-    67, 57,
-    67, 58,
-    67, 87,
-    67, 88,
-    67, 89,
-    67, 90,
-    68, 43,
-    69, 43,
-    70, 53,
-    70, 55,
-    70, 56,
-    70, 57,
-    70, 58,
-    70, 87,
-    70, 88,
-    70, 89,
-    70, 90,
-    72, 43,
-    76, 43,
-    76, 66,
-    76, 68,
-    76, 70,
-    76, 72,
-    76, 80,
-    76, 82,
-    77, 43,
-    79, 43,
-    80, 43,
-    80, 53,
-    80, 55,
-    80, 56,
-    80, 57,
-    80, 58,
-    80, 87,
-    80, 88,
-    80, 89,
-    80, 90,
-    81, 53,
-    81, 55,
-    81, 56,
-    81, 57,
-    81, 58,
-    81, 87,
-    81, 88,
-    81, 89,
-    81, 90,
-    82, 43,
-    82, 75,
-    83, 66,
-    83, 68,
-    83, 70,
-    83, 72,
-    83, 80,
-    83, 82,
-    84, 53,
-    84, 55,
-    84, 56,
-    84, 57,
-    84, 58,
-    85, 43,
-    86, 43,
-    88, 66,
-    88, 68,
-    88, 70,
-    88, 72,
-    88, 80,
-    88, 82,
-    89, 43,
-    89, 66,
-    89, 68,
-    89, 70,
-    89, 72,
-    89, 80,
-    89, 82,
-    90, 66,
-    90, 68,
-    90, 70,
-    90, 72,
-    90, 80,
-    90, 82,
-    91, 43,
-    92, 43,
-    92, 75
-};
-
-/* Kerning between the respective left and right glyphs
- * 4.4 format which needs to scaled with `kern_scale`*/
-static const int8_t kern_pair_values[] =
-{
-    38, 31, -15, -15, -15, -8, 15, -46,
-    -54, -38, -46, -15, -15, -15, -15, -15,
-    -15, 15, -15, -15, -8, -8, -23, -23,
-    -8, 15, -77, -31, -15, -15, -15, -15,
-    -15, -15, 15, 15, 15, 23, -31, -31,
-    -31, -31, -31, -31, -31, 8, 23, -15,
-    -77, -54, -38, -77, 15, 15, -15, -15,
-    -8, -8, -23, -23, -8, -84, -23, -15,
-    -15, -15, -8, -8, -23, -23, -8, 23,
-    -8, -8, -8, -8, -8, -8, -8, -92,
-    -46, -15, -15, -15, -46, -46, -46, -46,
-    -31, -31, -31, -46, -31, -46, -31, -38,
-    -31, -61, -54, -8, -8, -8, -31, -31,
-    -31, -23, -23, -15, -15, -31, -15, -31,
-    -15, -15, -15, -46, -38, -8, -8, -8,
-    -23, -23, -23, -23, -23, -15, -15, -23,
-    -15, -23, -15, -15, -15, -15, -23, 23,
-    -23, -23, -31, -31, -31, -31, -31, -31,
-    -23, -77, -46, -23, -23, -23, -69, -69,
-    -69, -69, -69, -31, -31, -31, -69, -31,
-    -69, -31, -54, -31, -31, -8, 23, -8,
-    -8, 38, 31, 38, 31, 15, -46, -23,
-    -23, -31, -69, -15, -8, -15, -15, 15,
-    15, -46, -23, -23, -31, -69, -15, -8,
-    -15, -15, 15, 15, -15, -15, -15, -15,
-    -15, -15, 23, 8, -15, -46, -31, -23,
-    -31, -69, -15, -8, -15, -15, -46, -23,
-    -23, -31, -69, -15, -8, -15, -15, 15,
-    31, -15, -15, -15, -15, -15, -15, -38,
-    -15, -15, -23, -54, 15, 8, -8, -8,
-    -8, -8, -8, -8, 15, -8, -8, -8,
-    -8, -8, -8, -8, -8, -8, -8, -8,
-    -8, 15, 38, 31
-};
-
-/*Collect the kern pair's data in one place*/
-static const lv_font_fmt_txt_kern_pair_t kern_pairs =
-{
-    .glyph_ids = kern_pair_glyph_ids,
-    .values = kern_pair_values,
-    .pair_cnt = 260,
-    .glyph_ids_size = 0
-};
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LV_VERSION_CHECK(8, 0, 0)
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = &kern_pairs,
-    .kern_scale = 16,
-    .cmap_num = 1,
-    .bpp = 4,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LV_VERSION_CHECK(8, 0, 0)
-    .cache = &cache
-#endif
-};
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LV_VERSION_CHECK(8, 0, 0)
-const lv_font_t ui_font_FontNumber48bp4 = {
-#else
-lv_font_t ui_font_FontNumber48bp4 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 51,          /*The maximum line height required by the font*/
-    .base_line = 11,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -5,
-    .underline_thickness = 2,
-#endif
-    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-};
-
-
-
-#endif /*#if UI_FONT_FONTNUMBER48BP4*/
-
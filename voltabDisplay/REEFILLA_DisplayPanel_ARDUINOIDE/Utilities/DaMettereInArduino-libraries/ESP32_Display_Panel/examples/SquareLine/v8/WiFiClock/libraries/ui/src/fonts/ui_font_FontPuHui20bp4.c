@@ -1,2069 +0,0 @@
-/*******************************************************************************
- * Size: 20 px
- * Bpp: 4
- * Opts: --bpp 4 --size 20 --font /home/lvhaiyu/SquareLine/assets/Alibaba_PuHuiTi_2.0_55_Regular_85_Bold.ttf -o /home/lvhaiyu/SquareLine/assets/ui_font_FontPuHui20bp4.c --format lvgl -r 0x20-0x7f --symbols 晴多云阴小雨中雨大雨暴雨小雪大雪℃ --no-compress --no-prefilter
- ******************************************************************************/
-
-#include "../ui.h"
-
-#ifndef UI_FONT_FONTPUHUI20BP4
-#define UI_FONT_FONTPUHUI20BP4 1
-#endif
-
-#if UI_FONT_FONTPUHUI20BP4
-
-/*-----------------
- *    BITMAPS
- *----------------*/
-
-/*Store the image of the glyphs*/
-static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
-    /* U+0020 " " */
-
-    /* U+0021 "!" */
-    0xcf, 0xf2, 0xbf, 0xf1, 0xbf, 0xf1, 0xaf, 0xf0,
-    0x9f, 0xf0, 0x9f, 0xf0, 0x8f, 0xe0, 0x7f, 0xd0,
-    0x7f, 0xd0, 0x0, 0x0, 0x2, 0x10, 0xcf, 0xf2,
-    0xef, 0xf4, 0xaf, 0xe1,
-
-    /* U+0022 "\"" */
-    0xff, 0x96, 0xff, 0x3d, 0xf8, 0x4f, 0xf2, 0xcf,
-    0x73, 0xff, 0x1b, 0xf5, 0x1f, 0xf0, 0x9f, 0x40,
-    0xfe, 0x7, 0xe2, 0xd, 0xc0,
-
-    /* U+0023 "#" */
-    0x0, 0x9, 0xfa, 0x0, 0x7f, 0xc0, 0x0, 0xc,
-    0xf7, 0x0, 0xaf, 0x90, 0x0, 0xf, 0xf4, 0x0,
-    0xdf, 0x60, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xfb,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x7f,
-    0xc0, 0x6, 0xfd, 0x0, 0x0, 0xaf, 0x90, 0x8,
-    0xfa, 0x0, 0x0, 0xdf, 0x60, 0xb, 0xf8, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xbf, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x5, 0xfe, 0x0, 0x3f,
-    0xf0, 0x0, 0x7, 0xfc, 0x0, 0x5f, 0xd0, 0x0,
-    0xa, 0xf9, 0x0, 0x8f, 0xb0, 0x0, 0xc, 0xf7,
-    0x0, 0xaf, 0x80, 0x0,
-
-    /* U+0024 "$" */
-    0x0, 0x0, 0x74, 0x0, 0x0, 0x0, 0x0, 0xf8,
-    0x0, 0x0, 0x4, 0xce, 0xff, 0xed, 0x70, 0x3f,
-    0xff, 0xff, 0xff, 0xb0, 0xaf, 0xe4, 0xf9, 0x35,
-    0x50, 0xcf, 0x90, 0xf8, 0x0, 0x0, 0xcf, 0xb0,
-    0xf8, 0x0, 0x0, 0x9f, 0xfc, 0xf9, 0x0, 0x0,
-    0x1d, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x5a, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0xfa, 0xaf, 0xf5, 0x0,
-    0x0, 0xf8, 0xf, 0xf8, 0x0, 0x0, 0xf8, 0xf,
-    0xf8, 0xa8, 0x65, 0xfb, 0xaf, 0xf6, 0xef, 0xff,
-    0xff, 0xff, 0xe0, 0x9c, 0xef, 0xff, 0xea, 0x20,
-    0x0, 0x0, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xf8,
-    0x0, 0x0, 0x0, 0x0, 0xf8, 0x0, 0x0,
-
-    /* U+0025 "%" */
-    0x8, 0xef, 0xb2, 0x0, 0x1, 0xec, 0x0, 0x6,
-    0xfb, 0x8f, 0xc0, 0x0, 0x8f, 0x30, 0x0, 0xaf,
-    0x10, 0xbf, 0x0, 0x2f, 0xb0, 0x0, 0xb, 0xf0,
-    0xa, 0xf1, 0xa, 0xf2, 0x0, 0x0, 0xaf, 0x0,
-    0xaf, 0x13, 0xf9, 0x0, 0x0, 0x7, 0xf7, 0x3e,
-    0xe0, 0xcf, 0x10, 0x0, 0x0, 0x1c, 0xff, 0xf5,
-    0x5f, 0x70, 0x1, 0x0, 0x0, 0x3, 0x31, 0xd,
-    0xe0, 0x7f, 0xfe, 0x50, 0x0, 0x0, 0x6, 0xf5,
-    0x3f, 0xb5, 0xdf, 0x10, 0x0, 0x1, 0xec, 0x7,
-    0xf4, 0x7, 0xf4, 0x0, 0x0, 0x8f, 0x30, 0x8f,
-    0x30, 0x6f, 0x50, 0x0, 0x2f, 0xa0, 0x7, 0xf4,
-    0x7, 0xf4, 0x0, 0xa, 0xf2, 0x0, 0x3f, 0xa4,
-    0xcf, 0x10, 0x3, 0xf9, 0x0, 0x0, 0x6d, 0xfc,
-    0x40,
-
-    /* U+0026 "&" */
-    0x0, 0x2, 0xbe, 0xfc, 0x40, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x8f, 0xf4,
-    0x1e, 0xf8, 0x0, 0x0, 0x9, 0xff, 0x0, 0xdf,
-    0x90, 0x0, 0x0, 0x6f, 0xf4, 0x6f, 0xf4, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x3d, 0xff, 0xf4, 0x2, 0x99, 0x10, 0x4f, 0xff,
-    0xff, 0x90, 0x5f, 0xf1, 0x1f, 0xfc, 0x1a, 0xff,
-    0x6a, 0xfd, 0x6, 0xff, 0x40, 0xc, 0xff, 0xff,
-    0x70, 0x7f, 0xf6, 0x0, 0x1e, 0xff, 0xd0, 0x3,
-    0xff, 0xf7, 0x69, 0xff, 0xff, 0x83, 0xa, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x7, 0xdf, 0xec,
-    0x80, 0x5c, 0xf9,
-
-    /* U+0027 "'" */
-    0xff, 0x9d, 0xf8, 0xcf, 0x7b, 0xf5, 0x9f, 0x47,
-    0xe2,
-
-    /* U+0028 "(" */
-    0x0, 0xd, 0xfd, 0x0, 0x7, 0xff, 0x40, 0x1,
-    0xff, 0xb0, 0x0, 0x7f, 0xf4, 0x0, 0xe, 0xfe,
-    0x0, 0x3, 0xff, 0x90, 0x0, 0x7f, 0xf5, 0x0,
-    0xa, 0xff, 0x20, 0x0, 0xbf, 0xf1, 0x0, 0xc,
-    0xff, 0x0, 0x0, 0xbf, 0xf1, 0x0, 0xa, 0xff,
-    0x20, 0x0, 0x8f, 0xf5, 0x0, 0x4, 0xff, 0x90,
-    0x0, 0xf, 0xfd, 0x0, 0x0, 0x8f, 0xf4, 0x0,
-    0x2, 0xff, 0xa0, 0x0, 0x8, 0xff, 0x30, 0x0,
-    0xe, 0xfc, 0x0,
-
-    /* U+0029 ")" */
-    0x1e, 0xfb, 0x0, 0x0, 0x6f, 0xf5, 0x0, 0x0,
-    0xef, 0xe0, 0x0, 0x7, 0xff, 0x50, 0x0, 0x1f,
-    0xfb, 0x0, 0x0, 0xcf, 0xf0, 0x0, 0x9, 0xff,
-    0x40, 0x0, 0x6f, 0xf7, 0x0, 0x4, 0xff, 0x80,
-    0x0, 0x3f, 0xf9, 0x0, 0x4, 0xff, 0x80, 0x0,
-    0x6f, 0xf6, 0x0, 0x9, 0xff, 0x30, 0x0, 0xdf,
-    0xf0, 0x0, 0x2f, 0xfb, 0x0, 0x8, 0xff, 0x40,
-    0x0, 0xef, 0xd0, 0x0, 0x8f, 0xf4, 0x0, 0x1f,
-    0xfa, 0x0, 0x0,
-
-    /* U+002A "*" */
-    0x0, 0x8, 0xfa, 0x0, 0x0, 0x40, 0x6f, 0x80,
-    0x40, 0xf, 0xea, 0xfb, 0xdf, 0x13, 0xef, 0xff,
-    0xff, 0xe4, 0x0, 0x3f, 0xff, 0x40, 0x0, 0x1d,
-    0xf9, 0xfe, 0x20, 0x3, 0xed, 0xb, 0xf4, 0x0,
-    0x1, 0x30, 0x22, 0x0,
-
-    /* U+002B "+" */
-    0x0, 0x0, 0x6f, 0xd0, 0x0, 0x0, 0x0, 0x6,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xd0, 0x0,
-    0x0, 0x0, 0x6, 0xfd, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0xe6, 0xff, 0xff, 0xff, 0xff,
-    0xfe, 0x14, 0x44, 0x8f, 0xe4, 0x44, 0x30, 0x0,
-    0x6, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xd0,
-    0x0, 0x0, 0x0, 0x6, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x14, 0x30, 0x0, 0x0,
-
-    /* U+002C "," */
-    0x0, 0x7c, 0xc0, 0xb, 0xfc, 0x0, 0xff, 0x80,
-    0x4f, 0xf2, 0xa, 0xfa, 0x2, 0xff, 0x20,
-
-    /* U+002D "-" */
-    0x12, 0x22, 0x22, 0x1a, 0xff, 0xff, 0xf7, 0xaf,
-    0xff, 0xff, 0x70,
-
-    /* U+002E "." */
-    0x4, 0x51, 0x5f, 0xfd, 0x6f, 0xfe, 0x3e, 0xf9,
-
-    /* U+002F "/" */
-    0x0, 0x0, 0x7, 0xf8, 0x0, 0x0, 0xd, 0xf2,
-    0x0, 0x0, 0x3f, 0xc0, 0x0, 0x0, 0x8f, 0x70,
-    0x0, 0x0, 0xef, 0x10, 0x0, 0x4, 0xfb, 0x0,
-    0x0, 0xa, 0xf5, 0x0, 0x0, 0xf, 0xf0, 0x0,
-    0x0, 0x5f, 0xa0, 0x0, 0x0, 0xbf, 0x40, 0x0,
-    0x1, 0xfe, 0x0, 0x0, 0x7, 0xf8, 0x0, 0x0,
-    0xc, 0xf3, 0x0, 0x0, 0x2f, 0xd0, 0x0, 0x0,
-    0x8f, 0x70, 0x0, 0x0,
-
-    /* U+0030 "0" */
-    0x0, 0x8, 0xdf, 0xec, 0x50, 0x0, 0xc, 0xff,
-    0xff, 0xff, 0x70, 0x6, 0xff, 0xc5, 0x6e, 0xff,
-    0x10, 0xcf, 0xf1, 0x0, 0x4f, 0xf7, 0xf, 0xfc,
-    0x0, 0x0, 0xff, 0xa1, 0xff, 0xa0, 0x0, 0xe,
-    0xfc, 0x1f, 0xf9, 0x0, 0x0, 0xdf, 0xd1, 0xff,
-    0x90, 0x0, 0xd, 0xfd, 0x1f, 0xfa, 0x0, 0x0,
-    0xef, 0xc0, 0xff, 0xc0, 0x0, 0xf, 0xfa, 0xc,
-    0xff, 0x10, 0x4, 0xff, 0x70, 0x6f, 0xfc, 0x66,
-    0xef, 0xf1, 0x0, 0xcf, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x8d, 0xff, 0xc5, 0x0,
-
-    /* U+0031 "1" */
-    0x4, 0x7a, 0xef, 0xf1, 0x1f, 0xff, 0xff, 0xf1,
-    0x1f, 0xda, 0xdf, 0xf1, 0x0, 0x0, 0xaf, 0xf1,
-    0x0, 0x0, 0xaf, 0xf1, 0x0, 0x0, 0xaf, 0xf1,
-    0x0, 0x0, 0xaf, 0xf1, 0x0, 0x0, 0xaf, 0xf1,
-    0x0, 0x0, 0xaf, 0xf1, 0x0, 0x0, 0xaf, 0xf1,
-    0x0, 0x0, 0xaf, 0xf1, 0x0, 0x0, 0xaf, 0xf1,
-    0x0, 0x0, 0xaf, 0xf1, 0x0, 0x0, 0xaf, 0xf1,
-
-    /* U+0032 "2" */
-    0xa, 0xdf, 0xfe, 0xb5, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x70, 0x19, 0x64, 0x48, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0xaf, 0xf3, 0x0, 0x0, 0x0, 0x8f,
-    0xf3, 0x0, 0x0, 0x0, 0xdf, 0xf1, 0x0, 0x0,
-    0x7, 0xff, 0xa0, 0x0, 0x0, 0x5f, 0xfe, 0x10,
-    0x0, 0x5, 0xff, 0xe2, 0x0, 0x0, 0x7f, 0xfe,
-    0x20, 0x0, 0xa, 0xff, 0xc1, 0x0, 0x0, 0xcf,
-    0xfd, 0x55, 0x55, 0x53, 0xff, 0xff, 0xff, 0xff,
-    0xfa, 0xff, 0xff, 0xff, 0xff, 0xfa,
-
-    /* U+0033 "3" */
-    0xb, 0xef, 0xfd, 0xa3, 0x0, 0x1f, 0xff, 0xff,
-    0xff, 0x30, 0x7, 0x43, 0x4a, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0xdf, 0xe0, 0x0, 0x0, 0x0, 0xef,
-    0xd0, 0x0, 0x11, 0x3a, 0xff, 0x60, 0x1, 0xff,
-    0xff, 0xe6, 0x0, 0x1, 0xff, 0xff, 0xfb, 0x20,
-    0x0, 0x0, 0x26, 0xff, 0xd0, 0x0, 0x0, 0x0,
-    0x9f, 0xf3, 0x0, 0x0, 0x0, 0xaf, 0xf3, 0x56,
-    0x44, 0x5a, 0xff, 0xf0, 0xaf, 0xff, 0xff, 0xff,
-    0x60, 0x7e, 0xff, 0xfd, 0x93, 0x0,
-
-    /* U+0034 "4" */
-    0x0, 0x0, 0x2, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0x60, 0x0, 0x0, 0x7f, 0xff, 0xf6,
-    0x0, 0x0, 0x2f, 0xf7, 0xff, 0x60, 0x0, 0xd,
-    0xf9, 0x3f, 0xf6, 0x0, 0x8, 0xfe, 0x3, 0xff,
-    0x60, 0x3, 0xff, 0x40, 0x3f, 0xf6, 0x0, 0xdf,
-    0xa0, 0x3, 0xff, 0x60, 0x6f, 0xf5, 0x44, 0x7f,
-    0xf8, 0x47, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f,
-    0xff, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x3,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x3f, 0xf6, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0x60,
-
-    /* U+0035 "5" */
-    0x7, 0xff, 0xff, 0xff, 0xa0, 0x9, 0xff, 0xff,
-    0xff, 0xa0, 0xb, 0xfc, 0x44, 0x44, 0x20, 0xe,
-    0xf8, 0x0, 0x0, 0x0, 0xf, 0xf6, 0x0, 0x0,
-    0x0, 0x2f, 0xfe, 0xff, 0xc7, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xa0, 0x13, 0x10, 0x26, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x7f, 0xf7, 0x0, 0x0, 0x0,
-    0x5f, 0xf7, 0x0, 0x0, 0x0, 0x9f, 0xf6, 0x36,
-    0x44, 0x5a, 0xff, 0xf1, 0x5f, 0xff, 0xff, 0xff,
-    0x50, 0x4d, 0xff, 0xfd, 0x92, 0x0,
-
-    /* U+0036 "6" */
-    0x0, 0x0, 0x7, 0xbe, 0xe0, 0x0, 0x0, 0x4e,
-    0xff, 0xfe, 0x0, 0x0, 0x4f, 0xff, 0xb7, 0x50,
-    0x0, 0xe, 0xfd, 0x20, 0x0, 0x0, 0x5, 0xff,
-    0x30, 0x0, 0x0, 0x0, 0xaf, 0xd8, 0xdf, 0xfa,
-    0x10, 0xe, 0xff, 0xff, 0xff, 0xfe, 0x10, 0xff,
-    0xf6, 0x11, 0x8f, 0xf7, 0xf, 0xfa, 0x0, 0x0,
-    0xef, 0xb0, 0xff, 0x90, 0x0, 0xc, 0xfb, 0xd,
-    0xfc, 0x0, 0x0, 0xef, 0xa0, 0x8f, 0xf8, 0x33,
-    0xbf, 0xf5, 0x0, 0xdf, 0xff, 0xff, 0xfb, 0x0,
-    0x1, 0x8d, 0xff, 0xd7, 0x0,
-
-    /* U+0037 "7" */
-    0xef, 0xff, 0xff, 0xff, 0xf6, 0xef, 0xff, 0xff,
-    0xff, 0xf6, 0x44, 0x44, 0x44, 0x8f, 0xf6, 0x0,
-    0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0, 0x2, 0xff,
-    0x90, 0x0, 0x0, 0x9, 0xff, 0x20, 0x0, 0x0,
-    0x1f, 0xfa, 0x0, 0x0, 0x0, 0x8f, 0xf3, 0x0,
-    0x0, 0x0, 0xff, 0xc0, 0x0, 0x0, 0x7, 0xff,
-    0x40, 0x0, 0x0, 0xe, 0xfd, 0x0, 0x0, 0x0,
-    0x6f, 0xf6, 0x0, 0x0, 0x0, 0xdf, 0xe0, 0x0,
-    0x0, 0x5, 0xff, 0x80, 0x0, 0x0,
-
-    /* U+0038 "8" */
-    0x0, 0x19, 0xdf, 0xfd, 0x70, 0x0, 0x1e, 0xff,
-    0xff, 0xff, 0xb0, 0x8, 0xff, 0x62, 0x2a, 0xff,
-    0x30, 0xbf, 0xc0, 0x0, 0xf, 0xf6, 0xa, 0xfc,
-    0x0, 0x0, 0xff, 0x50, 0x4f, 0xf6, 0x11, 0x9f,
-    0xf1, 0x0, 0x7f, 0xff, 0xff, 0xd3, 0x0, 0xa,
-    0xff, 0xff, 0xfe, 0x70, 0xa, 0xfe, 0x40, 0x16,
-    0xff, 0x60, 0xff, 0x70, 0x0, 0xb, 0xfc, 0x1f,
-    0xf7, 0x0, 0x0, 0xbf, 0xd0, 0xef, 0xe6, 0x33,
-    0x8f, 0xfa, 0x6, 0xff, 0xff, 0xff, 0xff, 0x30,
-    0x4, 0xbe, 0xff, 0xd9, 0x20,
-
-    /* U+0039 "9" */
-    0x0, 0x19, 0xdf, 0xfc, 0x50, 0x0, 0x1e, 0xff,
-    0xff, 0xff, 0x80, 0x9, 0xff, 0x83, 0x4c, 0xff,
-    0x20, 0xef, 0xa0, 0x0, 0x1f, 0xf7, 0xf, 0xf7,
-    0x0, 0x0, 0xdf, 0xa0, 0xff, 0x90, 0x0, 0xe,
-    0xfb, 0xc, 0xff, 0x50, 0x19, 0xff, 0xa0, 0x4f,
-    0xff, 0xff, 0xff, 0xf9, 0x0, 0x3b, 0xef, 0xc7,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x6f, 0xf2, 0x0,
-    0x0, 0x0, 0x4f, 0xfc, 0x0, 0x0, 0x68, 0xcf,
-    0xff, 0x30, 0x0, 0x3f, 0xff, 0xfe, 0x40, 0x0,
-    0x2, 0xfe, 0xb6, 0x0, 0x0,
-
-    /* U+003A ":" */
-    0x6f, 0xf6, 0xaf, 0xfa, 0x9f, 0xf9, 0x5, 0x50,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0x50,
-    0x9f, 0xf9, 0xaf, 0xfa, 0x6f, 0xf6,
-
-    /* U+003B ";" */
-    0x6, 0xff, 0x60, 0xaf, 0xfa, 0x9, 0xff, 0x90,
-    0x5, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x60, 0x5f,
-    0xf3, 0x9, 0xfe, 0x0, 0xef, 0x70, 0x4f, 0xf1,
-    0x9, 0xc6, 0x0,
-
-    /* U+003C "<" */
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x60, 0x0, 0x0,
-    0x0, 0x4b, 0xfe, 0x0, 0x0, 0x17, 0xdf, 0xff,
-    0xa0, 0x4, 0xaf, 0xff, 0xe8, 0x20, 0x3d, 0xff,
-    0xfb, 0x50, 0x0, 0x6, 0xfe, 0x71, 0x0, 0x0,
-    0x0, 0x6f, 0xe7, 0x10, 0x0, 0x0, 0x3, 0xdf,
-    0xff, 0xb5, 0x0, 0x0, 0x0, 0x4a, 0xff, 0xfe,
-    0x82, 0x0, 0x0, 0x1, 0x7d, 0xff, 0xfa, 0x0,
-    0x0, 0x0, 0x4, 0xbf, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x16,
-
-    /* U+003D "=" */
-    0x14, 0x44, 0x44, 0x44, 0x44, 0x36, 0xff, 0xff,
-    0xff, 0xff, 0xfe, 0x6f, 0xff, 0xff, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1, 0x44, 0x44, 0x44, 0x44,
-    0x43, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xff,
-    0xff, 0xff, 0xff, 0xfe,
-
-    /* U+003E ">" */
-    0x34, 0x0, 0x0, 0x0, 0x0, 0x6, 0xfd, 0x71,
-    0x0, 0x0, 0x0, 0x4e, 0xff, 0xfa, 0x40, 0x0,
-    0x0, 0x5, 0xbf, 0xff, 0xd7, 0x10, 0x0, 0x0,
-    0x28, 0xef, 0xff, 0x90, 0x0, 0x0, 0x0, 0x4b,
-    0xfe, 0x0, 0x0, 0x0, 0x4, 0xbf, 0xe0, 0x0,
-    0x2, 0x8e, 0xff, 0xf9, 0x0, 0x5b, 0xff, 0xfd,
-    0x71, 0x4, 0xef, 0xff, 0xa4, 0x0, 0x0, 0x6f,
-    0xd7, 0x10, 0x0, 0x0, 0x3, 0x40, 0x0, 0x0,
-    0x0, 0x0,
-
-    /* U+003F "?" */
-    0x2c, 0xef, 0xfe, 0xa2, 0x3, 0xff, 0xff, 0xff,
-    0xe0, 0x28, 0x65, 0x7f, 0xff, 0x40, 0x0, 0x0,
-    0x8f, 0xf5, 0x0, 0x0, 0x9, 0xff, 0x40, 0x0,
-    0x4, 0xff, 0xe0, 0x0, 0x5, 0xff, 0xe3, 0x0,
-    0x0, 0xff, 0xd2, 0x0, 0x0, 0x3f, 0xf2, 0x0,
-    0x0, 0x1, 0x77, 0x0, 0x0, 0x0, 0x2, 0x20,
-    0x0, 0x0, 0x8, 0xff, 0x60, 0x0, 0x0, 0xaf,
-    0xf8, 0x0, 0x0, 0x6, 0xff, 0x40, 0x0,
-
-    /* U+0040 "@" */
-    0x0, 0x0, 0x2, 0x8c, 0xff, 0xec, 0x71, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xe5,
-    0x0, 0x0, 0xc, 0xff, 0x93, 0x0, 0x3, 0xaf,
-    0xf4, 0x0, 0x9, 0xfe, 0x30, 0x0, 0x0, 0x0,
-    0x8f, 0xd0, 0x4, 0xff, 0x30, 0x2a, 0xfe, 0x6f,
-    0xb0, 0xef, 0x30, 0xaf, 0x90, 0x1e, 0xfe, 0xef,
-    0xf8, 0xb, 0xf6, 0xf, 0xf3, 0xa, 0xfb, 0x0,
-    0xef, 0x50, 0x9f, 0x72, 0xff, 0x0, 0xff, 0x20,
-    0xd, 0xf2, 0xa, 0xf6, 0x3f, 0xe0, 0x2f, 0xf0,
-    0x1, 0xff, 0x0, 0xdf, 0x32, 0xff, 0x2, 0xff,
-    0x10, 0x9f, 0xf1, 0x3f, 0xd0, 0xf, 0xf2, 0xd,
-    0xfe, 0xdf, 0xef, 0xef, 0xf5, 0x0, 0xcf, 0x80,
-    0x2c, 0xfe, 0x71, 0xbf, 0xd5, 0x0, 0x5, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0x93, 0x0, 0x0, 0x25, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x1, 0x8c, 0xef, 0xfe, 0xb8, 0x0, 0x0,
-
-    /* U+0041 "A" */
-    0x0, 0x0, 0xe, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0xaf, 0xfd, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0xf, 0xfb, 0x6f, 0xf5, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x51, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xcf,
-    0xf0, 0xb, 0xff, 0x10, 0x0, 0x0, 0x2f, 0xf9,
-    0x0, 0x5f, 0xf7, 0x0, 0x0, 0x7, 0xff, 0x40,
-    0x0, 0xff, 0xd0, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x3f, 0xff, 0xff, 0xff,
-    0xff, 0xf8, 0x0, 0x9, 0xff, 0x75, 0x55, 0x55,
-    0xef, 0xe0, 0x0, 0xff, 0xd0, 0x0, 0x0, 0x9,
-    0xff, 0x40, 0x5f, 0xf8, 0x0, 0x0, 0x0, 0x4f,
-    0xfa, 0xb, 0xff, 0x20, 0x0, 0x0, 0x0, 0xef,
-    0xf1,
-
-    /* U+0042 "B" */
-    0x6f, 0xff, 0xff, 0xec, 0x70, 0x6, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x6f, 0xf9, 0x44, 0x7f, 0xff,
-    0x16, 0xff, 0x60, 0x0, 0xaf, 0xf3, 0x6f, 0xf6,
-    0x0, 0x9, 0xff, 0x26, 0xff, 0x70, 0x14, 0xef,
-    0xd0, 0x6f, 0xff, 0xff, 0xff, 0xb1, 0x6, 0xff,
-    0xff, 0xff, 0xff, 0x80, 0x6f, 0xf6, 0x0, 0x2b,
-    0xff, 0x56, 0xff, 0x60, 0x0, 0x3f, 0xf9, 0x6f,
-    0xf6, 0x0, 0x4, 0xff, 0x96, 0xff, 0x94, 0x46,
-    0xdf, 0xf6, 0x6f, 0xff, 0xff, 0xff, 0xfd, 0x16,
-    0xff, 0xff, 0xff, 0xd8, 0x10,
-
-    /* U+0043 "C" */
-    0x0, 0x5, 0xbe, 0xff, 0xeb, 0x0, 0x1c, 0xff,
-    0xff, 0xff, 0xf1, 0xb, 0xff, 0xfa, 0x77, 0x8c,
-    0x13, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x8f, 0xf9,
-    0x0, 0x0, 0x0, 0xa, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0xcf, 0xf4, 0x0, 0x0, 0x0, 0xc, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0xbf, 0xf5, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0x90, 0x0, 0x0, 0x0, 0x4f,
-    0xff, 0x20, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xa8,
-    0x89, 0xc3, 0x2, 0xef, 0xff, 0xff, 0xff, 0x30,
-    0x0, 0x7c, 0xef, 0xfd, 0xa1,
-
-    /* U+0044 "D" */
-    0x6f, 0xff, 0xff, 0xec, 0x81, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xff, 0x40, 0x6f, 0xfa, 0x66, 0x8e,
-    0xff, 0xe1, 0x6f, 0xf6, 0x0, 0x0, 0xcf, 0xf7,
-    0x6f, 0xf6, 0x0, 0x0, 0x4f, 0xfb, 0x6f, 0xf6,
-    0x0, 0x0, 0xf, 0xfd, 0x6f, 0xf6, 0x0, 0x0,
-    0xf, 0xfe, 0x6f, 0xf6, 0x0, 0x0, 0xf, 0xfe,
-    0x6f, 0xf6, 0x0, 0x0, 0xf, 0xfd, 0x6f, 0xf6,
-    0x0, 0x0, 0x5f, 0xfa, 0x6f, 0xf6, 0x0, 0x1,
-    0xdf, 0xf6, 0x6f, 0xfa, 0x67, 0x9e, 0xff, 0xe0,
-    0x6f, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x6f, 0xff,
-    0xff, 0xeb, 0x70, 0x0,
-
-    /* U+0045 "E" */
-    0x6f, 0xff, 0xff, 0xff, 0xf0, 0x6f, 0xff, 0xff,
-    0xff, 0xf0, 0x6f, 0xfa, 0x77, 0x77, 0x60, 0x6f,
-    0xf6, 0x0, 0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0,
-    0x0, 0x6f, 0xf9, 0x55, 0x55, 0x30, 0x6f, 0xff,
-    0xff, 0xff, 0x80, 0x6f, 0xff, 0xff, 0xff, 0x80,
-    0x6f, 0xf6, 0x0, 0x0, 0x0, 0x6f, 0xf6, 0x0,
-    0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0x0, 0x6f,
-    0xfa, 0x77, 0x77, 0x71, 0x6f, 0xff, 0xff, 0xff,
-    0xf4, 0x6f, 0xff, 0xff, 0xff, 0xf4,
-
-    /* U+0046 "F" */
-    0x6f, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff,
-    0xff, 0x6f, 0xfa, 0x77, 0x77, 0x66, 0xff, 0x60,
-    0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0x6, 0xff,
-    0x60, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xff, 0x86,
-    0xff, 0xff, 0xff, 0xf8, 0x6f, 0xfa, 0x77, 0x77,
-    0x36, 0xff, 0x60, 0x0, 0x0, 0x6f, 0xf6, 0x0,
-    0x0, 0x6, 0xff, 0x60, 0x0, 0x0, 0x6f, 0xf6,
-    0x0, 0x0, 0x6, 0xff, 0x60, 0x0, 0x0,
-
-    /* U+0047 "G" */
-    0x0, 0x5, 0xae, 0xff, 0xec, 0x70, 0x1, 0xcf,
-    0xff, 0xff, 0xff, 0xd0, 0xb, 0xff, 0xfa, 0x77,
-    0x8a, 0xb0, 0x3f, 0xff, 0x30, 0x0, 0x0, 0x0,
-    0x8f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0xf4, 0x0, 0xaf,
-    0xff, 0xf7, 0xcf, 0xf4, 0x0, 0xaf, 0xff, 0xf7,
-    0xbf, 0xf5, 0x0, 0x35, 0x7f, 0xf7, 0x9f, 0xf9,
-    0x0, 0x0, 0x3f, 0xf7, 0x4f, 0xff, 0x20, 0x0,
-    0x3f, 0xf7, 0xd, 0xff, 0xe9, 0x76, 0x9f, 0xf7,
-    0x2, 0xef, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x7,
-    0xbe, 0xff, 0xec, 0x93,
-
-    /* U+0048 "H" */
-    0x6f, 0xf6, 0x0, 0x0, 0xd, 0xff, 0x6f, 0xf6,
-    0x0, 0x0, 0xd, 0xff, 0x6f, 0xf6, 0x0, 0x0,
-    0xd, 0xff, 0x6f, 0xf6, 0x0, 0x0, 0xd, 0xff,
-    0x6f, 0xf6, 0x0, 0x0, 0xd, 0xff, 0x6f, 0xfa,
-    0x55, 0x55, 0x5e, 0xff, 0x6f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x6f, 0xf6, 0x0, 0x0, 0xd, 0xff, 0x6f, 0xf6,
-    0x0, 0x0, 0xd, 0xff, 0x6f, 0xf6, 0x0, 0x0,
-    0xd, 0xff, 0x6f, 0xf6, 0x0, 0x0, 0xd, 0xff,
-    0x6f, 0xf6, 0x0, 0x0, 0xd, 0xff, 0x6f, 0xf6,
-    0x0, 0x0, 0xd, 0xff,
-
-    /* U+0049 "I" */
-    0x6f, 0xf6, 0x6f, 0xf6, 0x6f, 0xf6, 0x6f, 0xf6,
-    0x6f, 0xf6, 0x6f, 0xf6, 0x6f, 0xf6, 0x6f, 0xf6,
-    0x6f, 0xf6, 0x6f, 0xf6, 0x6f, 0xf6, 0x6f, 0xf6,
-    0x6f, 0xf6, 0x6f, 0xf6,
-
-    /* U+004A "J" */
-    0x0, 0x6, 0xff, 0x60, 0x0, 0x6f, 0xf6, 0x0,
-    0x6, 0xff, 0x60, 0x0, 0x6f, 0xf6, 0x0, 0x6,
-    0xff, 0x60, 0x0, 0x6f, 0xf6, 0x0, 0x6, 0xff,
-    0x60, 0x0, 0x6f, 0xf6, 0x0, 0x6, 0xff, 0x60,
-    0x0, 0x6f, 0xf6, 0x0, 0x6, 0xff, 0x60, 0x0,
-    0x6f, 0xf6, 0x0, 0x6, 0xff, 0x60, 0x0, 0x6f,
-    0xf6, 0x0, 0x9, 0xff, 0x43, 0x47, 0xff, 0xf1,
-    0xbf, 0xff, 0xf7, 0xa, 0xff, 0xc5, 0x0,
-
-    /* U+004B "K" */
-    0x6f, 0xf6, 0x0, 0x1, 0xef, 0xf4, 0x6f, 0xf6,
-    0x0, 0xb, 0xff, 0x80, 0x6f, 0xf6, 0x0, 0x7f,
-    0xfb, 0x0, 0x6f, 0xf6, 0x3, 0xff, 0xe1, 0x0,
-    0x6f, 0xf6, 0xd, 0xff, 0x30, 0x0, 0x6f, 0xf9,
-    0xaf, 0xf7, 0x0, 0x0, 0x6f, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x6f, 0xf6, 0x7f, 0xfc, 0x0, 0x0, 0x6f, 0xf6,
-    0xb, 0xff, 0x80, 0x0, 0x6f, 0xf6, 0x1, 0xef,
-    0xf4, 0x0, 0x6f, 0xf6, 0x0, 0x5f, 0xfe, 0x10,
-    0x6f, 0xf6, 0x0, 0x9, 0xff, 0xb0, 0x6f, 0xf6,
-    0x0, 0x0, 0xdf, 0xf7,
-
-    /* U+004C "L" */
-    0x6f, 0xf6, 0x0, 0x0, 0x0, 0x6f, 0xf6, 0x0,
-    0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0x0, 0x6f,
-    0xf6, 0x0, 0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0,
-    0x0, 0x6f, 0xf6, 0x0, 0x0, 0x0, 0x6f, 0xf6,
-    0x0, 0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0x0,
-    0x6f, 0xf6, 0x0, 0x0, 0x0, 0x6f, 0xf6, 0x0,
-    0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0x0, 0x6f,
-    0xfa, 0x77, 0x77, 0x70, 0x6f, 0xff, 0xff, 0xff,
-    0xf0, 0x6f, 0xff, 0xff, 0xff, 0xf0,
-
-    /* U+004D "M" */
-    0x6f, 0xff, 0xf5, 0x0, 0x0, 0xbf, 0xff, 0xd6,
-    0xff, 0xff, 0xa0, 0x0, 0x1f, 0xff, 0xfd, 0x6f,
-    0xff, 0xfe, 0x0, 0x6, 0xff, 0xff, 0xd6, 0xff,
-    0xaf, 0xf4, 0x0, 0xbf, 0xbe, 0xfd, 0x6f, 0xf5,
-    0xff, 0x90, 0x1f, 0xf5, 0xef, 0xd6, 0xff, 0x5a,
-    0xfe, 0x5, 0xff, 0x1e, 0xfd, 0x6f, 0xf5, 0x4f,
-    0xf3, 0xbf, 0xb0, 0xef, 0xd6, 0xff, 0x50, 0xff,
-    0x8f, 0xf5, 0xe, 0xfd, 0x6f, 0xf5, 0xa, 0xff,
-    0xff, 0x10, 0xef, 0xd6, 0xff, 0x50, 0x4f, 0xff,
-    0xb0, 0xe, 0xfd, 0x6f, 0xf5, 0x0, 0xff, 0xf5,
-    0x0, 0xef, 0xd6, 0xff, 0x50, 0x3, 0x44, 0x0,
-    0xe, 0xfd, 0x6f, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0xef, 0xd6, 0xff, 0x50, 0x0, 0x0, 0x0, 0xe,
-    0xfd,
-
-    /* U+004E "N" */
-    0x6f, 0xff, 0xf2, 0x0, 0x4, 0xff, 0x86, 0xff,
-    0xff, 0x90, 0x0, 0x4f, 0xf8, 0x6f, 0xff, 0xff,
-    0x10, 0x4, 0xff, 0x86, 0xff, 0xaf, 0xf8, 0x0,
-    0x4f, 0xf8, 0x6f, 0xf6, 0xdf, 0xe0, 0x4, 0xff,
-    0x86, 0xff, 0x65, 0xff, 0x60, 0x4f, 0xf8, 0x6f,
-    0xf6, 0xd, 0xfd, 0x4, 0xff, 0x86, 0xff, 0x60,
-    0x6f, 0xf5, 0x4f, 0xf8, 0x6f, 0xf6, 0x0, 0xef,
-    0xc4, 0xff, 0x86, 0xff, 0x60, 0x7, 0xff, 0x8f,
-    0xf8, 0x6f, 0xf6, 0x0, 0xf, 0xff, 0xff, 0x86,
-    0xff, 0x60, 0x0, 0x8f, 0xff, 0xf8, 0x6f, 0xf6,
-    0x0, 0x1, 0xff, 0xff, 0x86, 0xff, 0x60, 0x0,
-    0x9, 0xff, 0xf8,
-
-    /* U+004F "O" */
-    0x0, 0x18, 0xce, 0xfe, 0xc8, 0x10, 0x0, 0x3e,
-    0xff, 0xff, 0xff, 0xfe, 0x20, 0xd, 0xff, 0xc6,
-    0x56, 0xdf, 0xfc, 0x5, 0xff, 0xc0, 0x0, 0x0,
-    0xdf, 0xf3, 0x9f, 0xf6, 0x0, 0x0, 0x7, 0xff,
-    0x7b, 0xff, 0x30, 0x0, 0x0, 0x5f, 0xfa, 0xcf,
-    0xf2, 0x0, 0x0, 0x4, 0xff, 0xac, 0xff, 0x20,
-    0x0, 0x0, 0x4f, 0xfa, 0xbf, 0xf3, 0x0, 0x0,
-    0x5, 0xff, 0xa9, 0xff, 0x60, 0x0, 0x0, 0x7f,
-    0xf7, 0x5f, 0xfc, 0x0, 0x0, 0xd, 0xff, 0x30,
-    0xdf, 0xfc, 0x76, 0x7d, 0xff, 0xc0, 0x3, 0xef,
-    0xff, 0xff, 0xff, 0xe2, 0x0, 0x1, 0x8d, 0xef,
-    0xec, 0x81, 0x0,
-
-    /* U+0050 "P" */
-    0x6f, 0xff, 0xff, 0xec, 0x70, 0x6, 0xff, 0xff,
-    0xff, 0xff, 0xb0, 0x6f, 0xf9, 0x45, 0x8f, 0xff,
-    0x46, 0xff, 0x60, 0x0, 0x8f, 0xf7, 0x6f, 0xf6,
-    0x0, 0x5, 0xff, 0x86, 0xff, 0x60, 0x0, 0x6f,
-    0xf7, 0x6f, 0xf6, 0x0, 0x3d, 0xff, 0x46, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0x6f, 0xff, 0xff, 0xff,
-    0xa1, 0x6, 0xff, 0x94, 0x32, 0x0, 0x0, 0x6f,
-    0xf6, 0x0, 0x0, 0x0, 0x6, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x6f, 0xf6, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0x60, 0x0, 0x0, 0x0,
-
-    /* U+0051 "Q" */
-    0x0, 0x18, 0xce, 0xfe, 0xc8, 0x10, 0x0, 0x3e,
-    0xff, 0xff, 0xff, 0xfe, 0x20, 0xd, 0xff, 0xc6,
-    0x56, 0xdf, 0xfc, 0x5, 0xff, 0xc0, 0x0, 0x0,
-    0xdf, 0xf4, 0x9f, 0xf6, 0x0, 0x0, 0x7, 0xff,
-    0x7b, 0xff, 0x30, 0x0, 0x0, 0x5f, 0xfa, 0xcf,
-    0xf2, 0x0, 0x0, 0x4, 0xff, 0xac, 0xff, 0x20,
-    0x0, 0x0, 0x4f, 0xfa, 0xbf, 0xf3, 0x0, 0x0,
-    0x5, 0xff, 0x99, 0xff, 0x60, 0x0, 0x0, 0x7f,
-    0xf7, 0x5f, 0xfc, 0x0, 0x0, 0xd, 0xff, 0x30,
-    0xdf, 0xfc, 0x76, 0x7d, 0xff, 0xc0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xd2, 0x0, 0x1, 0x8d, 0xef,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xfa, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x78, 0x82, 0x0,
-
-    /* U+0052 "R" */
-    0x6f, 0xff, 0xff, 0xeb, 0x50, 0x0, 0x6f, 0xff,
-    0xff, 0xff, 0xf9, 0x0, 0x6f, 0xf9, 0x44, 0x7f,
-    0xff, 0x20, 0x6f, 0xf6, 0x0, 0x8, 0xff, 0x50,
-    0x6f, 0xf6, 0x0, 0x6, 0xff, 0x60, 0x6f, 0xf6,
-    0x0, 0x8, 0xff, 0x50, 0x6f, 0xf7, 0x22, 0x5e,
-    0xff, 0x10, 0x6f, 0xff, 0xff, 0xff, 0xf9, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0x50, 0x0, 0x6f, 0xf6,
-    0x9, 0xff, 0x60, 0x0, 0x6f, 0xf6, 0x0, 0xef,
-    0xf2, 0x0, 0x6f, 0xf6, 0x0, 0x4f, 0xfd, 0x0,
-    0x6f, 0xf6, 0x0, 0x9, 0xff, 0xa0, 0x6f, 0xf6,
-    0x0, 0x0, 0xdf, 0xf6,
-
-    /* U+0053 "S" */
-    0x2, 0x9d, 0xff, 0xec, 0x60, 0x2f, 0xff, 0xff,
-    0xff, 0xb0, 0xaf, 0xfb, 0x66, 0x79, 0x80, 0xcf,
-    0xf0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0x0, 0x0,
-    0x0, 0x9f, 0xfe, 0x84, 0x0, 0x0, 0x1d, 0xff,
-    0xff, 0xf9, 0x10, 0x0, 0x5a, 0xef, 0xff, 0xd0,
-    0x0, 0x0, 0x4, 0xdf, 0xf4, 0x0, 0x0, 0x0,
-    0x6f, 0xf6, 0x0, 0x0, 0x0, 0x8f, 0xf5, 0xca,
-    0x87, 0x79, 0xff, 0xf2, 0xef, 0xff, 0xff, 0xff,
-    0x90, 0x8c, 0xef, 0xfe, 0xb6, 0x0,
-
-    /* U+0054 "T" */
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xff, 0xff,
-    0xff, 0xff, 0xf9, 0x47, 0x77, 0xff, 0xe7, 0x77,
-    0x40, 0x0, 0xf, 0xfe, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xe0, 0x0, 0x0, 0x0, 0xf, 0xfe, 0x0,
-    0x0, 0x0, 0x0, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0xf, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xff, 0xe0,
-    0x0, 0x0, 0x0, 0xf, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xf, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0xf, 0xfe, 0x0, 0x0,
-
-    /* U+0055 "U" */
-    0x7f, 0xf5, 0x0, 0x0, 0xd, 0xff, 0x7f, 0xf5,
-    0x0, 0x0, 0xd, 0xff, 0x7f, 0xf5, 0x0, 0x0,
-    0xd, 0xff, 0x7f, 0xf5, 0x0, 0x0, 0xd, 0xff,
-    0x7f, 0xf5, 0x0, 0x0, 0xd, 0xff, 0x7f, 0xf5,
-    0x0, 0x0, 0xd, 0xff, 0x7f, 0xf5, 0x0, 0x0,
-    0xd, 0xff, 0x7f, 0xf5, 0x0, 0x0, 0xd, 0xff,
-    0x7f, 0xf5, 0x0, 0x0, 0xd, 0xff, 0x6f, 0xf6,
-    0x0, 0x0, 0xe, 0xfe, 0x5f, 0xfb, 0x0, 0x0,
-    0x3f, 0xfd, 0x1f, 0xff, 0xb7, 0x79, 0xef, 0xf8,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0, 0x3a,
-    0xdf, 0xfe, 0xc6, 0x0,
-
-    /* U+0056 "V" */
-    0x8f, 0xf8, 0x0, 0x0, 0x0, 0xaf, 0xf3, 0x3f,
-    0xfd, 0x0, 0x0, 0x0, 0xff, 0xe0, 0xd, 0xff,
-    0x20, 0x0, 0x5, 0xff, 0x80, 0x8, 0xff, 0x70,
-    0x0, 0xa, 0xff, 0x30, 0x3, 0xff, 0xc0, 0x0,
-    0xf, 0xfd, 0x0, 0x0, 0xdf, 0xf1, 0x0, 0x4f,
-    0xf7, 0x0, 0x0, 0x8f, 0xf6, 0x0, 0x9f, 0xf2,
-    0x0, 0x0, 0x2f, 0xfb, 0x0, 0xef, 0xc0, 0x0,
-    0x0, 0xd, 0xff, 0x4, 0xff, 0x70, 0x0, 0x0,
-    0x7, 0xff, 0x59, 0xff, 0x10, 0x0, 0x0, 0x2,
-    0xff, 0xae, 0xfc, 0x0, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xb0,
-    0x0, 0x0,
-
-    /* U+0057 "W" */
-    0x7f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0x44, 0xff, 0xa0, 0x0, 0x29, 0x99, 0x10,
-    0x0, 0xcf, 0xf1, 0xf, 0xfd, 0x0, 0x7, 0xff,
-    0xf5, 0x0, 0xf, 0xfd, 0x0, 0xdf, 0xf0, 0x0,
-    0xbf, 0xff, 0x90, 0x3, 0xff, 0x90, 0x9, 0xff,
-    0x30, 0xe, 0xff, 0xfc, 0x0, 0x6f, 0xf6, 0x0,
-    0x6f, 0xf6, 0x3, 0xff, 0x8f, 0xf0, 0x9, 0xff,
-    0x20, 0x3, 0xff, 0x90, 0x6f, 0xd3, 0xff, 0x40,
-    0xdf, 0xe0, 0x0, 0xf, 0xfd, 0xa, 0xf9, 0xf,
-    0xf8, 0xf, 0xfb, 0x0, 0x0, 0xcf, 0xf0, 0xef,
-    0x50, 0xbf, 0xb3, 0xff, 0x70, 0x0, 0x8, 0xff,
-    0x6f, 0xf1, 0x7, 0xff, 0x6f, 0xf3, 0x0, 0x0,
-    0x5f, 0xfd, 0xfd, 0x0, 0x3f, 0xfd, 0xff, 0x0,
-    0x0, 0x1, 0xff, 0xff, 0x90, 0x0, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0xe, 0xff, 0xf5, 0x0, 0xb,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0xaf, 0xff, 0x10,
-    0x0, 0x7f, 0xff, 0x50, 0x0,
-
-    /* U+0058 "X" */
-    0x1f, 0xff, 0x30, 0x0, 0x8, 0xff, 0xb0, 0x7,
-    0xff, 0xb0, 0x0, 0x1f, 0xff, 0x10, 0x0, 0xdf,
-    0xf4, 0x0, 0xaf, 0xf7, 0x0, 0x0, 0x4f, 0xfd,
-    0x3, 0xff, 0xd0, 0x0, 0x0, 0xb, 0xff, 0x6c,
-    0xff, 0x30, 0x0, 0x0, 0x2, 0xff, 0xff, 0xf9,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xf1, 0x0,
-    0x0, 0x0, 0x0, 0xaf, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x4, 0xff, 0xdf, 0xfd, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0x3a, 0xff, 0x70, 0x0, 0x0, 0x8f,
-    0xf9, 0x2, 0xff, 0xf1, 0x0, 0x2, 0xff, 0xf1,
-    0x0, 0x9f, 0xfa, 0x0, 0xb, 0xff, 0x70, 0x0,
-    0x1f, 0xff, 0x30, 0x5f, 0xfd, 0x0, 0x0, 0x7,
-    0xff, 0xd0,
-
-    /* U+0059 "Y" */
-    0xaf, 0xfa, 0x0, 0x0, 0x7, 0xff, 0xa1, 0xff,
-    0xf2, 0x0, 0x1, 0xff, 0xf1, 0x6, 0xff, 0xb0,
-    0x0, 0x9f, 0xf7, 0x0, 0xd, 0xff, 0x40, 0x2f,
-    0xfd, 0x0, 0x0, 0x3f, 0xfc, 0xb, 0xff, 0x30,
-    0x0, 0x0, 0xaf, 0xf9, 0xff, 0x90, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xe0, 0x0,
-    0x0, 0x0, 0x0, 0xe, 0xfe, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
-    0xe0, 0x0, 0x0,
-
-    /* U+005A "Z" */
-    0x8f, 0xff, 0xff, 0xff, 0xff, 0x90, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x48, 0x88, 0x88, 0x8f,
-    0xff, 0x70, 0x0, 0x0, 0x0, 0xaf, 0xfb, 0x0,
-    0x0, 0x0, 0x7, 0xff, 0xd1, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0x30, 0x0, 0x0, 0x1, 0xef, 0xf5,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x9f, 0xfc, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xe1, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0xdf, 0xfd, 0x88, 0x88, 0x88, 0x80,
-    0xef, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xf1,
-
-    /* U+005B "[" */
-    0x9f, 0xff, 0xf9, 0xff, 0xff, 0x9f, 0xf4, 0x39,
-    0xff, 0x10, 0x9f, 0xf1, 0x9, 0xff, 0x10, 0x9f,
-    0xf1, 0x9, 0xff, 0x10, 0x9f, 0xf1, 0x9, 0xff,
-    0x10, 0x9f, 0xf1, 0x9, 0xff, 0x10, 0x9f, 0xf1,
-    0x9, 0xff, 0x10, 0x9f, 0xf1, 0x9, 0xff, 0x10,
-    0x9f, 0xf4, 0x39, 0xff, 0xff, 0x9f, 0xff, 0xf0,
-
-    /* U+005C "\\" */
-    0x7f, 0x90, 0x0, 0x0, 0x0, 0x1f, 0xf1, 0x0,
-    0x0, 0x0, 0x9, 0xf7, 0x0, 0x0, 0x0, 0x2,
-    0xfe, 0x0, 0x0, 0x0, 0x0, 0xbf, 0x50, 0x0,
-    0x0, 0x0, 0x4f, 0xc0, 0x0, 0x0, 0x0, 0xd,
-    0xf3, 0x0, 0x0, 0x0, 0x6, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0xef, 0x10, 0x0, 0x0, 0x0, 0x8f,
-    0x80, 0x0, 0x0, 0x0, 0x1f, 0xe0, 0x0, 0x0,
-    0x0, 0xa, 0xf6, 0x0, 0x0, 0x0, 0x3, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0xcf, 0x40, 0x0, 0x0,
-    0x0, 0x5f, 0xb0, 0x0, 0x0, 0x0, 0xe, 0xf2,
-    0x0, 0x0, 0x0, 0x7, 0xf9,
-
-    /* U+005D "]" */
-    0x8f, 0xff, 0xf1, 0x8f, 0xff, 0xf1, 0x13, 0xbf,
-    0xf1, 0x0, 0xaf, 0xf1, 0x0, 0xaf, 0xf1, 0x0,
-    0xaf, 0xf1, 0x0, 0xaf, 0xf1, 0x0, 0xaf, 0xf1,
-    0x0, 0xaf, 0xf1, 0x0, 0xaf, 0xf1, 0x0, 0xaf,
-    0xf1, 0x0, 0xaf, 0xf1, 0x0, 0xaf, 0xf1, 0x0,
-    0xaf, 0xf1, 0x0, 0xaf, 0xf1, 0x0, 0xaf, 0xf1,
-    0x13, 0xbf, 0xf1, 0x8f, 0xff, 0xf1, 0x8f, 0xff,
-    0xf1,
-
-    /* U+005E "^" */
-    0x0, 0x6, 0x88, 0x20, 0x0, 0x0, 0x2f, 0xff,
-    0xa0, 0x0, 0x0, 0x8f, 0xaf, 0xf1, 0x0, 0x0,
-    0xef, 0x2b, 0xf7, 0x0, 0x5, 0xfc, 0x5, 0xfd,
-    0x0, 0xc, 0xf6, 0x0, 0xef, 0x40, 0x2f, 0xf0,
-    0x0, 0x8f, 0xa0, 0x9f, 0xa0, 0x0, 0x2f, 0xf1,
-
-    /* U+005F "_" */
-    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xff, 0xff, 0xff,
-    0xff, 0xff,
-
-    /* U+0060 "`" */
-    0x4c, 0xc5, 0x0, 0x7f, 0xe1, 0x0, 0x6f, 0xa0,
-
-    /* U+0061 "a" */
-    0x0, 0x7, 0xef, 0xfe, 0xa3, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xf3, 0x0, 0x4, 0x54, 0x59, 0xff,
-    0xa0, 0x0, 0x0, 0x0, 0xf, 0xfc, 0x0, 0x5a,
-    0xdd, 0xdd, 0xff, 0xc0, 0x8f, 0xff, 0xff, 0xff,
-    0xfc, 0xf, 0xfd, 0x20, 0x0, 0xef, 0xc1, 0xff,
-    0x90, 0x0, 0xf, 0xfc, 0xf, 0xfc, 0x0, 0x1b,
-    0xff, 0xc0, 0xaf, 0xff, 0xef, 0xff, 0xfc, 0x0,
-    0x8d, 0xfe, 0xb3, 0xbf, 0xc0,
-
-    /* U+0062 "b" */
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x7, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x30, 0x0, 0x0, 0x0, 0x7f, 0xf4,
-    0x9e, 0xfe, 0xa1, 0x7, 0xff, 0xdf, 0xff, 0xff,
-    0xe0, 0x7f, 0xfe, 0x51, 0x2c, 0xff, 0x77, 0xff,
-    0x60, 0x0, 0x2f, 0xfa, 0x7f, 0xf2, 0x0, 0x0,
-    0xff, 0xc7, 0xff, 0x10, 0x0, 0xf, 0xfd, 0x7f,
-    0xf2, 0x0, 0x0, 0xff, 0xc7, 0xff, 0x60, 0x0,
-    0x3f, 0xfa, 0x7f, 0xfe, 0x51, 0x3c, 0xff, 0x57,
-    0xff, 0xcf, 0xff, 0xff, 0xd0, 0x7f, 0xf1, 0x9e,
-    0xfe, 0xa1, 0x0,
-
-    /* U+0063 "c" */
-    0x0, 0x8, 0xdf, 0xfe, 0xb0, 0x0, 0xdf, 0xff,
-    0xff, 0xf0, 0x8, 0xff, 0xc5, 0x34, 0x70, 0xd,
-    0xff, 0x10, 0x0, 0x0, 0xf, 0xfc, 0x0, 0x0,
-    0x0, 0xf, 0xfb, 0x0, 0x0, 0x0, 0xf, 0xfc,
-    0x0, 0x0, 0x0, 0xd, 0xff, 0x10, 0x0, 0x0,
-    0x8, 0xff, 0xc6, 0x45, 0x70, 0x0, 0xdf, 0xff,
-    0xff, 0xf1, 0x0, 0x8, 0xdf, 0xfe, 0xb0,
-
-    /* U+0064 "d" */
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf4,
-    0x0, 0x2b, 0xef, 0xd7, 0x6f, 0xf4, 0x1, 0xff,
-    0xff, 0xff, 0xdf, 0xf4, 0x9, 0xff, 0xa2, 0x17,
-    0xff, 0xf4, 0xd, 0xff, 0x0, 0x0, 0xaf, 0xf4,
-    0xf, 0xfc, 0x0, 0x0, 0x6f, 0xf4, 0xf, 0xfb,
-    0x0, 0x0, 0x4f, 0xf4, 0xf, 0xfc, 0x0, 0x0,
-    0x5f, 0xf4, 0xe, 0xfe, 0x0, 0x0, 0x8f, 0xf4,
-    0xa, 0xff, 0x70, 0x3, 0xef, 0xf4, 0x2, 0xff,
-    0xfe, 0xef, 0xdf, 0xf4, 0x0, 0x3b, 0xef, 0xe8,
-    0x3f, 0xf4,
-
-    /* U+0065 "e" */
-    0x0, 0x18, 0xdf, 0xfe, 0x91, 0x0, 0xd, 0xff,
-    0xff, 0xff, 0xe0, 0x8, 0xff, 0x82, 0x16, 0xff,
-    0x60, 0xdf, 0xd0, 0x0, 0xd, 0xfa, 0xf, 0xfd,
-    0x67, 0x9a, 0xef, 0xc0, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0xf, 0xfc, 0x44, 0x44, 0x44, 0x20, 0xdf,
-    0xe0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xc4, 0x23,
-    0x59, 0x20, 0x1d, 0xff, 0xff, 0xff, 0xf3, 0x0,
-    0x18, 0xdf, 0xfe, 0xc8, 0x10,
-
-    /* U+0066 "f" */
-    0x0, 0x7, 0xdf, 0xf5, 0x0, 0x8f, 0xff, 0xf5,
-    0x0, 0xdf, 0xe2, 0x0, 0x0, 0xff, 0xb0, 0x0,
-    0xbf, 0xff, 0xff, 0xd0, 0xbf, 0xff, 0xff, 0xd0,
-    0x11, 0xff, 0xb1, 0x10, 0x0, 0xff, 0xb0, 0x0,
-    0x0, 0xff, 0xb0, 0x0, 0x0, 0xff, 0xb0, 0x0,
-    0x0, 0xff, 0xb0, 0x0, 0x0, 0xff, 0xb0, 0x0,
-    0x0, 0xff, 0xb0, 0x0, 0x0, 0xff, 0xb0, 0x0,
-    0x0, 0xff, 0xb0, 0x0,
-
-    /* U+0067 "g" */
-    0x0, 0x2a, 0xef, 0xe8, 0x5f, 0xf5, 0x1, 0xef,
-    0xff, 0xff, 0xdf, 0xf5, 0x8, 0xff, 0xa2, 0x15,
-    0xff, 0xf5, 0xd, 0xff, 0x0, 0x0, 0x8f, 0xf5,
-    0xf, 0xfc, 0x0, 0x0, 0x4f, 0xf5, 0xf, 0xfc,
-    0x0, 0x0, 0x3f, 0xf5, 0xf, 0xfc, 0x0, 0x0,
-    0x4f, 0xf5, 0xd, 0xff, 0x0, 0x0, 0x7f, 0xf5,
-    0x9, 0xff, 0x91, 0x4, 0xef, 0xf5, 0x2, 0xff,
-    0xff, 0xff, 0xdf, 0xf5, 0x0, 0x3b, 0xef, 0xe8,
-    0x7f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf2,
-    0x0, 0x33, 0x21, 0x39, 0xff, 0xd0, 0x0, 0x8f,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x6d, 0xff, 0xfd,
-    0x81, 0x0,
-
-    /* U+0068 "h" */
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x7, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x30, 0x0, 0x0, 0x0, 0x7f, 0xf4,
-    0x8e, 0xfe, 0xa1, 0x7, 0xff, 0xef, 0xff, 0xff,
-    0xb0, 0x7f, 0xff, 0x74, 0x6f, 0xff, 0x7, 0xff,
-    0x60, 0x0, 0x9f, 0xf2, 0x7f, 0xf3, 0x0, 0x8,
-    0xff, 0x37, 0xff, 0x30, 0x0, 0x8f, 0xf3, 0x7f,
-    0xf3, 0x0, 0x8, 0xff, 0x37, 0xff, 0x30, 0x0,
-    0x8f, 0xf3, 0x7f, 0xf3, 0x0, 0x8, 0xff, 0x37,
-    0xff, 0x30, 0x0, 0x8f, 0xf3, 0x7f, 0xf3, 0x0,
-    0x8, 0xff, 0x30,
-
-    /* U+0069 "i" */
-    0x7f, 0xe2, 0xaf, 0xf5, 0x5d, 0xc1, 0x0, 0x0,
-    0x8f, 0xf2, 0x8f, 0xf2, 0x8f, 0xf2, 0x8f, 0xf2,
-    0x8f, 0xf2, 0x8f, 0xf2, 0x8f, 0xf2, 0x8f, 0xf2,
-    0x8f, 0xf2, 0x8f, 0xf2, 0x8f, 0xf2,
-
-    /* U+006A "j" */
-    0x0, 0x7, 0xfe, 0x20, 0x0, 0xaf, 0xf5, 0x0,
-    0x5, 0xdc, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0x20, 0x0, 0x8f, 0xf2, 0x0, 0x8, 0xff,
-    0x20, 0x0, 0x8f, 0xf2, 0x0, 0x8, 0xff, 0x20,
-    0x0, 0x8f, 0xf2, 0x0, 0x8, 0xff, 0x20, 0x0,
-    0x8f, 0xf2, 0x0, 0x8, 0xff, 0x20, 0x0, 0x8f,
-    0xf2, 0x0, 0x8, 0xff, 0x20, 0x0, 0x8f, 0xf1,
-    0x1, 0x2d, 0xff, 0x2, 0xff, 0xff, 0xa0, 0x1f,
-    0xfe, 0x90, 0x0,
-
-    /* U+006B "k" */
-    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x7, 0xff, 0x30,
-    0x0, 0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0x0,
-    0x7, 0xff, 0x30, 0x0, 0x0, 0x0, 0x7f, 0xf3,
-    0x0, 0x8f, 0xf8, 0x7, 0xff, 0x30, 0x4f, 0xfb,
-    0x0, 0x7f, 0xf3, 0x1e, 0xfe, 0x10, 0x7, 0xff,
-    0x3c, 0xff, 0x30, 0x0, 0x7f, 0xff, 0xff, 0x50,
-    0x0, 0x7, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x7f,
-    0xf5, 0xef, 0xf1, 0x0, 0x7, 0xff, 0x35, 0xff,
-    0xb0, 0x0, 0x7f, 0xf3, 0xb, 0xff, 0x60, 0x7,
-    0xff, 0x30, 0x2f, 0xff, 0x20, 0x7f, 0xf3, 0x0,
-    0x7f, 0xfc, 0x0,
-
-    /* U+006C "l" */
-    0x8f, 0xf3, 0x8, 0xff, 0x30, 0x8f, 0xf3, 0x8,
-    0xff, 0x30, 0x8f, 0xf3, 0x8, 0xff, 0x30, 0x8f,
-    0xf3, 0x8, 0xff, 0x30, 0x8f, 0xf3, 0x8, 0xff,
-    0x30, 0x8f, 0xf3, 0x8, 0xff, 0x30, 0x7f, 0xf7,
-    0x24, 0xff, 0xfb, 0x8, 0xef, 0xa0,
-
-    /* U+006D "m" */
-    0x7f, 0xf5, 0xbe, 0xfd, 0x70, 0x9e, 0xfe, 0xa1,
-    0x7, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff,
-    0xb0, 0x7f, 0xfc, 0x20, 0x7f, 0xff, 0x71, 0x2c,
-    0xff, 0x27, 0xff, 0x40, 0x0, 0xff, 0xc0, 0x0,
-    0x6f, 0xf4, 0x7f, 0xf3, 0x0, 0xf, 0xfb, 0x0,
-    0x5, 0xff, 0x57, 0xff, 0x30, 0x0, 0xff, 0xb0,
-    0x0, 0x5f, 0xf5, 0x7f, 0xf3, 0x0, 0xf, 0xfb,
-    0x0, 0x5, 0xff, 0x57, 0xff, 0x30, 0x0, 0xff,
-    0xb0, 0x0, 0x5f, 0xf5, 0x7f, 0xf3, 0x0, 0xf,
-    0xfb, 0x0, 0x5, 0xff, 0x57, 0xff, 0x30, 0x0,
-    0xff, 0xb0, 0x0, 0x5f, 0xf5, 0x7f, 0xf3, 0x0,
-    0xf, 0xfb, 0x0, 0x5, 0xff, 0x50,
-
-    /* U+006E "n" */
-    0x7f, 0xf5, 0x9e, 0xfe, 0xa1, 0x7, 0xff, 0xff,
-    0xff, 0xff, 0xb0, 0x7f, 0xfd, 0x30, 0x2e, 0xff,
-    0x7, 0xff, 0x50, 0x0, 0x9f, 0xf2, 0x7f, 0xf3,
-    0x0, 0x8, 0xff, 0x37, 0xff, 0x30, 0x0, 0x8f,
-    0xf3, 0x7f, 0xf3, 0x0, 0x8, 0xff, 0x37, 0xff,
-    0x30, 0x0, 0x8f, 0xf3, 0x7f, 0xf3, 0x0, 0x8,
-    0xff, 0x37, 0xff, 0x30, 0x0, 0x8f, 0xf3, 0x7f,
-    0xf3, 0x0, 0x8, 0xff, 0x30,
-
-    /* U+006F "o" */
-    0x0, 0x18, 0xdf, 0xfe, 0xa3, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xff, 0x40, 0x8, 0xff, 0x92, 0x15,
-    0xff, 0xe0, 0xd, 0xfe, 0x0, 0x0, 0x9f, 0xf3,
-    0xf, 0xfc, 0x0, 0x0, 0x6f, 0xf5, 0xf, 0xfb,
-    0x0, 0x0, 0x5f, 0xf6, 0xf, 0xfc, 0x0, 0x0,
-    0x6f, 0xf5, 0xd, 0xfe, 0x0, 0x0, 0x9f, 0xf3,
-    0x8, 0xff, 0x92, 0x15, 0xff, 0xe0, 0x1, 0xdf,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x18, 0xdf, 0xfe,
-    0xa3, 0x0,
-
-    /* U+0070 "p" */
-    0x7f, 0xf5, 0xae, 0xfe, 0xa1, 0x7, 0xff, 0xef,
-    0xef, 0xff, 0xe0, 0x7f, 0xfd, 0x10, 0xa, 0xff,
-    0x77, 0xff, 0x50, 0x0, 0x1f, 0xfa, 0x7f, 0xf2,
-    0x0, 0x0, 0xff, 0xc7, 0xff, 0x10, 0x0, 0xf,
-    0xfd, 0x7f, 0xf2, 0x0, 0x0, 0xff, 0xc7, 0xff,
-    0x60, 0x0, 0x3f, 0xfa, 0x7f, 0xfe, 0x51, 0x3c,
-    0xff, 0x57, 0xff, 0xdf, 0xff, 0xff, 0xd0, 0x7f,
-    0xf4, 0x9e, 0xfe, 0xa1, 0x7, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0x0, 0x7,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x7f, 0xf3, 0x0,
-    0x0, 0x0, 0x0,
-
-    /* U+0071 "q" */
-    0x0, 0x2b, 0xef, 0xd7, 0x6f, 0xf4, 0x1, 0xff,
-    0xff, 0xff, 0xdf, 0xf4, 0x9, 0xff, 0xa2, 0x17,
-    0xff, 0xf4, 0xd, 0xff, 0x0, 0x0, 0xaf, 0xf4,
-    0xf, 0xfc, 0x0, 0x0, 0x6f, 0xf4, 0xf, 0xfb,
-    0x0, 0x0, 0x4f, 0xf4, 0xf, 0xfc, 0x0, 0x0,
-    0x6f, 0xf4, 0xe, 0xff, 0x0, 0x0, 0x9f, 0xf4,
-    0xa, 0xff, 0xa2, 0x26, 0xff, 0xf4, 0x2, 0xff,
-    0xff, 0xff, 0xdf, 0xf4, 0x0, 0x3b, 0xef, 0xd7,
-    0x6f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xf4, 0x0, 0x0, 0x0, 0x0,
-    0x6f, 0xf4,
-
-    /* U+0072 "r" */
-    0x7f, 0xf3, 0x8e, 0x97, 0xff, 0xbf, 0xf9, 0x7f,
-    0xff, 0xa4, 0x17, 0xff, 0xa0, 0x0, 0x7f, 0xf4,
-    0x0, 0x7, 0xff, 0x30, 0x0, 0x7f, 0xf3, 0x0,
-    0x7, 0xff, 0x30, 0x0, 0x7f, 0xf3, 0x0, 0x7,
-    0xff, 0x30, 0x0, 0x7f, 0xf3, 0x0, 0x0,
-
-    /* U+0073 "s" */
-    0x5, 0xcf, 0xfe, 0xd3, 0x6f, 0xff, 0xff, 0xf4,
-    0xcf, 0xe2, 0x12, 0x41, 0xdf, 0xd0, 0x0, 0x0,
-    0x9f, 0xfe, 0xa5, 0x0, 0x9, 0xff, 0xff, 0xd2,
-    0x0, 0x4, 0x9f, 0xf9, 0x0, 0x0, 0xd, 0xfb,
-    0x74, 0x22, 0x4f, 0xfa, 0xff, 0xff, 0xff, 0xf4,
-    0xbe, 0xff, 0xeb, 0x40,
-
-    /* U+0074 "t" */
-    0x2, 0x88, 0x30, 0x0, 0x4f, 0xf6, 0x0, 0x4,
-    0xff, 0x60, 0xb, 0xff, 0xff, 0xfb, 0xbf, 0xff,
-    0xff, 0xb1, 0x6f, 0xf8, 0x21, 0x4, 0xff, 0x60,
-    0x0, 0x4f, 0xf6, 0x0, 0x4, 0xff, 0x60, 0x0,
-    0x4f, 0xf6, 0x0, 0x4, 0xff, 0x60, 0x0, 0x3f,
-    0xfb, 0x21, 0x0, 0xef, 0xff, 0xa0, 0x3, 0xcf,
-    0xf9,
-
-    /* U+0075 "u" */
-    0x9f, 0xf2, 0x0, 0xa, 0xff, 0x9, 0xff, 0x20,
-    0x0, 0xaf, 0xf0, 0x9f, 0xf2, 0x0, 0xa, 0xff,
-    0x9, 0xff, 0x20, 0x0, 0xaf, 0xf0, 0x9f, 0xf2,
-    0x0, 0xa, 0xff, 0x9, 0xff, 0x20, 0x0, 0xaf,
-    0xf0, 0x9f, 0xf2, 0x0, 0xa, 0xff, 0x8, 0xff,
-    0x30, 0x0, 0xbf, 0xf0, 0x6f, 0xfa, 0x11, 0x7f,
-    0xff, 0x1, 0xff, 0xff, 0xff, 0xef, 0xf0, 0x4,
-    0xcf, 0xfd, 0x77, 0xff, 0x0,
-
-    /* U+0076 "v" */
-    0xbf, 0xf3, 0x0, 0x0, 0xcf, 0xf1, 0x5f, 0xf8,
-    0x0, 0x1, 0xff, 0xb0, 0xf, 0xfd, 0x0, 0x6,
-    0xff, 0x60, 0xa, 0xff, 0x20, 0xb, 0xff, 0x0,
-    0x4, 0xff, 0x70, 0x1f, 0xfa, 0x0, 0x0, 0xef,
-    0xc0, 0x5f, 0xf4, 0x0, 0x0, 0x8f, 0xf1, 0xbf,
-    0xe0, 0x0, 0x0, 0x3f, 0xf7, 0xff, 0x90, 0x0,
-    0x0, 0xd, 0xff, 0xff, 0x30, 0x0, 0x0, 0x7,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf7,
-    0x0, 0x0,
-
-    /* U+0077 "w" */
-    0x8f, 0xf5, 0x0, 0xf, 0xff, 0x50, 0x0, 0xef,
-    0xd3, 0xff, 0x80, 0x3, 0xff, 0xf9, 0x0, 0x2f,
-    0xf9, 0xf, 0xfc, 0x0, 0x7f, 0xff, 0xd0, 0x5,
-    0xff, 0x40, 0xbf, 0xf0, 0xb, 0xfb, 0xff, 0x10,
-    0x9f, 0xf0, 0x7, 0xff, 0x30, 0xff, 0x4f, 0xf5,
-    0xc, 0xfc, 0x0, 0x2f, 0xf6, 0x3f, 0xf0, 0xbf,
-    0x90, 0xff, 0x70, 0x0, 0xef, 0xa7, 0xfc, 0x7,
-    0xfd, 0x4f, 0xf3, 0x0, 0xa, 0xfd, 0xbf, 0x80,
-    0x3f, 0xf9, 0xff, 0x0, 0x0, 0x6f, 0xff, 0xf4,
-    0x0, 0xff, 0xff, 0xb0, 0x0, 0x1, 0xff, 0xff,
-    0x0, 0xb, 0xff, 0xf6, 0x0, 0x0, 0xd, 0xff,
-    0xc0, 0x0, 0x7f, 0xff, 0x20, 0x0,
-
-    /* U+0078 "x" */
-    0x4f, 0xfd, 0x0, 0x3, 0xff, 0xd0, 0x9, 0xff,
-    0x70, 0xc, 0xff, 0x30, 0x0, 0xef, 0xf1, 0x6f,
-    0xf8, 0x0, 0x0, 0x4f, 0xfa, 0xef, 0xd0, 0x0,
-    0x0, 0xa, 0xff, 0xff, 0x40, 0x0, 0x0, 0x3,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x7f, 0xf8, 0xdf, 0xf2, 0x0,
-    0x2, 0xff, 0xd0, 0x4f, 0xfb, 0x0, 0xc, 0xff,
-    0x40, 0xb, 0xff, 0x60, 0x7f, 0xfa, 0x0, 0x2,
-    0xff, 0xf1,
-
-    /* U+0079 "y" */
-    0xaf, 0xf3, 0x0, 0x0, 0xbf, 0xf1, 0x4f, 0xf9,
-    0x0, 0x1, 0xff, 0xb0, 0xe, 0xfe, 0x0, 0x5,
-    0xff, 0x50, 0x8, 0xff, 0x40, 0xa, 0xff, 0x0,
-    0x2, 0xff, 0x90, 0xf, 0xfa, 0x0, 0x0, 0xbf,
-    0xe0, 0x4f, 0xf4, 0x0, 0x0, 0x5f, 0xf4, 0x9f,
-    0xe0, 0x0, 0x0, 0xe, 0xf9, 0xef, 0x80, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0x30, 0x0, 0x0, 0x3,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xf1, 0x0, 0x0,
-    0x2, 0x6d, 0xff, 0x80, 0x0, 0x0, 0x8, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x8, 0xec, 0x70, 0x0,
-    0x0, 0x0,
-
-    /* U+007A "z" */
-    0xa, 0xff, 0xff, 0xff, 0xf9, 0xa, 0xff, 0xff,
-    0xff, 0xf9, 0x2, 0x33, 0x34, 0xff, 0xf4, 0x0,
-    0x0, 0xc, 0xff, 0x70, 0x0, 0x0, 0x9f, 0xfa,
-    0x0, 0x0, 0x6, 0xff, 0xc0, 0x0, 0x0, 0x3f,
-    0xfe, 0x10, 0x0, 0x1, 0xef, 0xf3, 0x0, 0x0,
-    0xc, 0xff, 0xa4, 0x44, 0x44, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xf, 0xff, 0xff, 0xff, 0xff,
-
-    /* U+007B "{" */
-    0x0, 0x5, 0xcf, 0x40, 0x6, 0xff, 0xf5, 0x0,
-    0xcf, 0xf2, 0x0, 0xd, 0xfc, 0x0, 0x0, 0xef,
-    0xc0, 0x0, 0xe, 0xfc, 0x0, 0x0, 0xef, 0xc0,
-    0x0, 0x2f, 0xfa, 0x0, 0x4f, 0xfd, 0x20, 0x4,
-    0xff, 0xc1, 0x0, 0x3, 0xff, 0x90, 0x0, 0xe,
-    0xfc, 0x0, 0x0, 0xef, 0xc0, 0x0, 0xe, 0xfc,
-    0x0, 0x0, 0xef, 0xc0, 0x0, 0xd, 0xfc, 0x0,
-    0x0, 0xbf, 0xf2, 0x0, 0x4, 0xff, 0xf5, 0x0,
-    0x5, 0xcf, 0x40,
-
-    /* U+007C "|" */
-    0xff, 0x5f, 0xf5, 0xff, 0x5f, 0xf5, 0xff, 0x5f,
-    0xf5, 0xff, 0x5f, 0xf5, 0xff, 0x5f, 0xf5, 0xff,
-    0x5f, 0xf5, 0xff, 0x5f, 0xf5, 0xff, 0x5f, 0xf5,
-    0xff, 0x5f, 0xf5, 0xff, 0x50,
-
-    /* U+007D "}" */
-    0x8e, 0xb4, 0x0, 0x8, 0xff, 0xf3, 0x0, 0x4,
-    0xff, 0x90, 0x0, 0xf, 0xfb, 0x0, 0x0, 0xff,
-    0xb0, 0x0, 0xf, 0xfb, 0x0, 0x0, 0xff, 0xb0,
-    0x0, 0xe, 0xfd, 0x10, 0x0, 0x4e, 0xff, 0x10,
-    0x3, 0xdf, 0xf1, 0x0, 0xdf, 0xe1, 0x0, 0xf,
-    0xfb, 0x0, 0x0, 0xff, 0xb0, 0x0, 0xf, 0xfb,
-    0x0, 0x0, 0xff, 0xb0, 0x0, 0xf, 0xfa, 0x0,
-    0x5, 0xff, 0x80, 0x8, 0xff, 0xf2, 0x0, 0x8e,
-    0xb3, 0x0, 0x0,
-
-    /* U+007E "~" */
-    0x1, 0xbf, 0xd6, 0x0, 0x2c, 0xa0, 0xcf, 0xff,
-    0xfb, 0x28, 0xfb, 0x3f, 0xe2, 0x6f, 0xff, 0xff,
-    0x44, 0xc9, 0x0, 0x2a, 0xfe, 0x60,
-
-    /* U+2103 "℃" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3c, 0xff, 0x90, 0x0, 0x0, 0x6c,
-    0xff, 0xff, 0xc1, 0x2f, 0xff, 0xff, 0xb0, 0x1,
-    0xcf, 0xff, 0xff, 0xff, 0x29, 0xfd, 0x25, 0xff,
-    0x30, 0xbf, 0xff, 0x96, 0x67, 0xa2, 0xbf, 0x70,
-    0xd, 0xf6, 0x3f, 0xff, 0x20, 0x0, 0x0, 0x9,
-    0xfc, 0x25, 0xff, 0x37, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x2f, 0xff, 0xff, 0xc0, 0xaf, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x4d, 0xff, 0xa1, 0xb, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9f, 0xf8, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xe1, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xd7, 0x44, 0x69, 0x40, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1a, 0xef, 0xff, 0xfd, 0x30, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x12, 0x21, 0x0,
-
-    /* U+4E2D "中" */
-    0x0, 0x0, 0x0, 0x1, 0x10, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0, 0x0, 0x0,
-    0xde, 0xee, 0xee, 0xef, 0xfe, 0xee, 0xee, 0xe4,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0xff, 0x95, 0x55, 0x8f, 0xf5, 0x55, 0x5f, 0xf5,
-    0xff, 0x50, 0x0, 0x4f, 0xf0, 0x0, 0xe, 0xf5,
-    0xff, 0x50, 0x0, 0x4f, 0xf0, 0x0, 0xe, 0xf5,
-    0xff, 0x50, 0x0, 0x4f, 0xf0, 0x0, 0xe, 0xf5,
-    0xff, 0x50, 0x0, 0x4f, 0xf0, 0x0, 0xe, 0xf5,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x33, 0x33, 0x33, 0x6f, 0xf3, 0x33, 0x33, 0x31,
-    0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xf0, 0x0, 0x0, 0x0,
-
-    /* U+4E91 "云" */
-    0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x33, 0x33, 0x33, 0x33, 0x33,
-    0x33, 0x31, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x33, 0x33, 0x33,
-    0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0xef, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xde,
-    0xee, 0xee, 0xff, 0xfe, 0xee, 0xee, 0xee, 0xe3,
-    0x0, 0x0, 0x4, 0xff, 0x70, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xd, 0xfd, 0x0, 0x4e, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf4, 0x0, 0xbf,
-    0xf2, 0x0, 0x0, 0x0, 0x3, 0xff, 0xa0, 0x0,
-    0x1e, 0xfd, 0x0, 0x0, 0x0, 0x1e, 0xfe, 0x10,
-    0x0, 0x5, 0xff, 0x90, 0x0, 0x1, 0xcf, 0xf3,
-    0x2, 0x35, 0x68, 0xff, 0xf4, 0x0, 0xe, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0, 0xd,
-    0xff, 0xff, 0xfe, 0xdb, 0xa9, 0x79, 0xff, 0x80,
-    0x5, 0x75, 0x31, 0x0, 0x0, 0x0, 0x0, 0xce,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x21, 0x0,
-
-    /* U+591A "多" */
-    0x0, 0x0, 0x0, 0x3, 0x80, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xfd, 0xdd,
-    0xdd, 0xdd, 0x60, 0x0, 0x3, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x70, 0x2, 0xaf, 0xff, 0x90,
-    0x0, 0x0, 0x6f, 0xfd, 0x20, 0xd, 0xff, 0xef,
-    0xfb, 0x0, 0x2b, 0xff, 0xb1, 0x0, 0x4, 0xd4,
-    0x6, 0xf8, 0x3a, 0xff, 0xe6, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0x9d, 0xff, 0xf9, 0x10, 0x0, 0x0,
-    0x0, 0x37, 0xbf, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x4e, 0xff, 0xff, 0xba, 0xff, 0xd1, 0x11,
-    0x11, 0x10, 0x1e, 0xe9, 0x52, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xf3, 0x1, 0x1, 0x8f, 0xff, 0xcc,
-    0xcc, 0xcc, 0xff, 0xf3, 0x2, 0x8f, 0xff, 0xf8,
-    0x0, 0x0, 0x9, 0xff, 0x80, 0xf, 0xff, 0xcb,
-    0xff, 0xc1, 0x3, 0xdf, 0xf7, 0x0, 0x8, 0xa3,
-    0x0, 0x4e, 0xc3, 0xbf, 0xfd, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x18, 0xef, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x3, 0x7c, 0xff, 0xfe, 0x81, 0x0, 0x0,
-    0x0, 0x6b, 0xef, 0xff, 0xfc, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xfe, 0xa6, 0x10, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x6, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+5927 "大" */
-    0x0, 0x0, 0x0, 0x0, 0x5d, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x6, 0xff, 0x0, 0x0, 0x0, 0x0, 0x2, 0x66,
-    0x66, 0x66, 0xaf, 0xf6, 0x66, 0x66, 0x66, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf0, 0x5, 0xdd, 0xdd, 0xdd, 0xef, 0xfd, 0xdd,
-    0xdd, 0xdd, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
-    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xdf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3f, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xc, 0xfe, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0x68, 0xfe, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xc0, 0xd,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0x6, 0xff, 0xe1,
-    0x0, 0x2f, 0xfd, 0x20, 0x0, 0x0, 0xa, 0xff,
-    0xe2, 0x0, 0x0, 0x4f, 0xff, 0x60, 0x0, 0x5e,
-    0xff, 0xd2, 0x0, 0x0, 0x0, 0x3e, 0xff, 0xc3,
-    0xb, 0xff, 0xb1, 0x0, 0x0, 0x0, 0x0, 0x2d,
-    0xff, 0x80, 0x1e, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x8, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+5C0F "小" */
-    0x0, 0x0, 0x0, 0x0, 0x16, 0x60, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
-    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0,
-    0xec, 0x30, 0x4f, 0xf0, 0x2d, 0xf1, 0x0, 0x0,
-    0x0, 0x3f, 0xf2, 0x4, 0xff, 0x0, 0xef, 0x80,
-    0x0, 0x0, 0x7, 0xfd, 0x0, 0x4f, 0xf0, 0x8,
-    0xfe, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x4, 0xff,
-    0x0, 0x2f, 0xf4, 0x0, 0x0, 0x1f, 0xf3, 0x0,
-    0x4f, 0xf0, 0x0, 0xcf, 0xb0, 0x0, 0x7, 0xfe,
-    0x0, 0x4, 0xff, 0x0, 0x6, 0xff, 0x10, 0x0,
-    0xdf, 0x80, 0x0, 0x4f, 0xf0, 0x0, 0xf, 0xf7,
-    0x0, 0x3f, 0xf2, 0x0, 0x4, 0xff, 0x0, 0x0,
-    0xaf, 0xd0, 0xa, 0xfc, 0x0, 0x0, 0x4f, 0xf0,
-    0x0, 0x4, 0xff, 0x30, 0xff, 0x50, 0x0, 0x4,
-    0xff, 0x0, 0x0, 0xe, 0xf9, 0x2, 0xa0, 0x0,
-    0x0, 0x4f, 0xf0, 0x0, 0x0, 0x9a, 0x20, 0x0,
-    0x0, 0x24, 0x5b, 0xff, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xfe, 0xb3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0,
-
-    /* U+6674 "晴" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xe0,
-    0x0, 0x0, 0xa, 0xaa, 0xaa, 0x27, 0x77, 0x7f,
-    0xf7, 0x77, 0x60, 0x1f, 0xff, 0xff, 0x4f, 0xff,
-    0xff, 0xff, 0xff, 0xd0, 0x1f, 0xe7, 0xef, 0x12,
-    0x22, 0x2f, 0xf2, 0x22, 0x20, 0x1f, 0xc0, 0xef,
-    0x1c, 0xff, 0xff, 0xff, 0xff, 0x60, 0x1f, 0xc0,
-    0xef, 0x16, 0x88, 0x8f, 0xf8, 0x88, 0x30, 0x1f,
-    0xc0, 0xef, 0x9a, 0xaa, 0xaf, 0xfa, 0xaa, 0xa5,
-    0x1f, 0xd2, 0xef, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x1f, 0xff, 0xff, 0x21, 0x22, 0x22, 0x22,
-    0x22, 0x10, 0x1f, 0xff, 0xff, 0x1c, 0xff, 0xff,
-    0xff, 0xff, 0x20, 0x1f, 0xc0, 0xef, 0x1c, 0xf9,
-    0x77, 0x77, 0xef, 0x20, 0x1f, 0xc0, 0xef, 0x1c,
-    0xff, 0xff, 0xff, 0xff, 0x20, 0x1f, 0xc0, 0xef,
-    0x1c, 0xfb, 0xaa, 0xaa, 0xff, 0x20, 0x1f, 0xd2,
-    0xef, 0x1c, 0xf9, 0x77, 0x77, 0xef, 0x20, 0x1f,
-    0xff, 0xff, 0x1c, 0xff, 0xff, 0xff, 0xff, 0x20,
-    0x1f, 0xff, 0xff, 0x1c, 0xf5, 0x22, 0x22, 0xdf,
-    0x20, 0x1, 0x11, 0x11, 0xc, 0xf3, 0x0, 0x4c,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0xa, 0xd2, 0x0,
-    0x1f, 0xe8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0,
-
-    /* U+66B4 "暴" */
-    0x0, 0xb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb,
-    0x70, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0xf, 0xf4, 0x33, 0x33,
-    0x33, 0x33, 0x9f, 0xa0, 0x0, 0x0, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0xf,
-    0xf7, 0x66, 0x66, 0x66, 0x66, 0xaf, 0xa0, 0x0,
-    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0xb, 0xbc, 0xff, 0xbb, 0xbd, 0xff,
-    0xbb, 0x70, 0x0, 0x7, 0xaa, 0xbf, 0xfa, 0xaa,
-    0xcf, 0xea, 0xaa, 0x30, 0x0, 0x8b, 0xbc, 0xff,
-    0xbb, 0xbd, 0xff, 0xbb, 0xb4, 0x0, 0x37, 0x77,
-    0x9f, 0xf7, 0x77, 0xaf, 0xe7, 0x77, 0x70, 0x7,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x10, 0x0, 0x18, 0xff, 0x51, 0xb9, 0x1a, 0xfe,
-    0x50, 0x0, 0x1, 0x6d, 0xff, 0xfa, 0x1f, 0xe3,
-    0xdf, 0xff, 0xb5, 0x0, 0xff, 0xf8, 0x2c, 0xf3,
-    0xfe, 0xaf, 0x93, 0xbf, 0xfb, 0x9, 0x81, 0x16,
-    0xbf, 0x8f, 0xed, 0xfa, 0x51, 0x29, 0x50, 0x6,
-    0xcf, 0xfd, 0x97, 0xfe, 0x7c, 0xff, 0xfb, 0x20,
-    0x0, 0x8c, 0x83, 0xe, 0xff, 0xd0, 0x2, 0x7d,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x8e, 0xb4, 0x0,
-    0x0, 0x3, 0x0,
-
-    /* U+9634 "阴" */
-    0x22, 0x22, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xff, 0xff, 0xff, 0x3e, 0xff, 0xff, 0xff, 0xf3,
-    0xff, 0xee, 0xff, 0x3e, 0xff, 0xff, 0xff, 0xf3,
-    0xff, 0x1, 0xff, 0x1e, 0xf1, 0x0, 0xd, 0xf3,
-    0xff, 0x7, 0xfb, 0xe, 0xf0, 0x0, 0xd, 0xf3,
-    0xff, 0xc, 0xf5, 0xe, 0xf3, 0x22, 0x2d, 0xf3,
-    0xff, 0x1f, 0xf0, 0xe, 0xff, 0xff, 0xff, 0xf3,
-    0xff, 0x4f, 0xf2, 0xe, 0xfe, 0xee, 0xef, 0xf3,
-    0xff, 0x8, 0xfb, 0xe, 0xf0, 0x0, 0xd, 0xf3,
-    0xff, 0x0, 0xef, 0x2e, 0xf0, 0x0, 0xd, 0xf3,
-    0xff, 0x0, 0x9f, 0x6f, 0xfe, 0xee, 0xef, 0xf3,
-    0xff, 0x1, 0xcf, 0x7f, 0xff, 0xff, 0xff, 0xf3,
-    0xff, 0xbf, 0xff, 0x8f, 0xc2, 0x22, 0x2d, 0xf3,
-    0xff, 0x7f, 0xf9, 0x8f, 0x90, 0x0, 0xd, 0xf3,
-    0xff, 0x13, 0x0, 0xef, 0x40, 0x0, 0xd, 0xf3,
-    0xff, 0x0, 0xa, 0xfd, 0x0, 0x3, 0x5f, 0xf2,
-    0xff, 0x0, 0x8f, 0xf4, 0x0, 0xe, 0xff, 0xf1,
-    0xff, 0x0, 0x8f, 0x80, 0x0, 0xa, 0xfe, 0x70,
-    0x0, 0x0, 0x3, 0x0, 0x0, 0x1, 0x0, 0x0,
-
-    /* U+96E8 "雨" */
-    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
-    0x10, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x7, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0x11, 0x11, 0x18,
-    0xfa, 0x11, 0x11, 0x11, 0x0, 0xf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xf,
-    0xf2, 0x20, 0x7, 0xfa, 0x21, 0x0, 0xff, 0x20,
-    0xf, 0xf5, 0xf9, 0x7, 0xfa, 0xce, 0x40, 0xff,
-    0x20, 0xf, 0xf5, 0xef, 0xd9, 0xfa, 0x9f, 0xf6,
-    0xff, 0x20, 0xf, 0xf2, 0x1b, 0xe8, 0xfa, 0x4,
-    0xe5, 0xff, 0x20, 0xf, 0xf2, 0x20, 0x37, 0xfa,
-    0x20, 0x10, 0xff, 0x20, 0xf, 0xf7, 0xf7, 0x7,
-    0xfa, 0xdd, 0x30, 0xff, 0x20, 0xf, 0xf8, 0xff,
-    0xb8, 0xfb, 0xcf, 0xf4, 0xff, 0x20, 0xf, 0xf2,
-    0x3e, 0xc7, 0xfa, 0x8, 0xf3, 0xff, 0x20, 0xf,
-    0xf2, 0x1, 0x37, 0xfa, 0x0, 0x20, 0xff, 0x20,
-    0xf, 0xf2, 0x0, 0x7, 0xfa, 0x0, 0x8b, 0xff,
-    0x10, 0xf, 0xf2, 0x0, 0x7, 0xfa, 0x0, 0xaf,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x24, 0x20, 0x0,
-
-    /* U+96EA "雪" */
-    0x0, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
-    0x0, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x11, 0x11, 0x11, 0xff, 0x21,
-    0x11, 0x11, 0x0, 0x9, 0x99, 0x99, 0x99, 0xff,
-    0xa9, 0x99, 0x99, 0x91, 0x1f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf2, 0x1f, 0xe2, 0x77,
-    0x72, 0xff, 0x37, 0x77, 0x2e, 0xf2, 0x1f, 0xe4,
-    0xee, 0xe4, 0xff, 0x4e, 0xee, 0x4e, 0xf2, 0x8,
-    0x71, 0x66, 0x62, 0xff, 0x36, 0x66, 0x17, 0x81,
-    0x0, 0x4, 0xff, 0xf4, 0xff, 0x5f, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x33, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x0, 0x0, 0x9b, 0xbb, 0xbb, 0xbb,
-    0xbb, 0xbb, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0x0, 0x0, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x3a,
-    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0x0,
-    0x1, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xff,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x0
-};
-
-
-/*---------------------
- *  GLYPH DESCRIPTION
- *--------------------*/
-
-static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
-    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
-    {.bitmap_index = 0, .adv_w = 82, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 0, .adv_w = 118, .box_w = 4, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 28, .adv_w = 132, .box_w = 7, .box_h = 6, .ofs_x = 1, .ofs_y = 9},
-    {.bitmap_index = 49, .adv_w = 192, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 133, .adv_w = 188, .box_w = 10, .box_h = 19, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 228, .adv_w = 266, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 333, .adv_w = 205, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 424, .adv_w = 75, .box_w = 3, .box_h = 6, .ofs_x = 1, .ofs_y = 9},
-    {.bitmap_index = 433, .adv_w = 124, .box_w = 7, .box_h = 19, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 500, .adv_w = 124, .box_w = 7, .box_h = 19, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 567, .adv_w = 146, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 7},
-    {.bitmap_index = 603, .adv_w = 184, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 664, .adv_w = 104, .box_w = 5, .box_h = 6, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 679, .adv_w = 141, .box_w = 7, .box_h = 3, .ofs_x = 1, .ofs_y = 5},
-    {.bitmap_index = 690, .adv_w = 104, .box_w = 4, .box_h = 4, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 698, .adv_w = 160, .box_w = 8, .box_h = 15, .ofs_x = 1, .ofs_y = -1},
-    {.bitmap_index = 758, .adv_w = 188, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 835, .adv_w = 188, .box_w = 8, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 891, .adv_w = 188, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 961, .adv_w = 188, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1031, .adv_w = 188, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1108, .adv_w = 188, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1178, .adv_w = 188, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1255, .adv_w = 188, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 1325, .adv_w = 188, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1402, .adv_w = 188, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1479, .adv_w = 128, .box_w = 4, .box_h = 11, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 1501, .adv_w = 128, .box_w = 5, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 1536, .adv_w = 184, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1602, .adv_w = 184, .box_w = 11, .box_h = 8, .ofs_x = 0, .ofs_y = 2},
-    {.bitmap_index = 1646, .adv_w = 184, .box_w = 11, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1712, .adv_w = 143, .box_w = 9, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1775, .adv_w = 274, .box_w = 17, .box_h = 16, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 1911, .adv_w = 228, .box_w = 15, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2016, .adv_w = 206, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2093, .adv_w = 193, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2170, .adv_w = 227, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2254, .adv_w = 180, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2324, .adv_w = 172, .box_w = 9, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2387, .adv_w = 221, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2471, .adv_w = 233, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2555, .adv_w = 96, .box_w = 4, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2583, .adv_w = 95, .box_w = 7, .box_h = 18, .ofs_x = -2, .ofs_y = -4},
-    {.bitmap_index = 2646, .adv_w = 208, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2730, .adv_w = 168, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2800, .adv_w = 279, .box_w = 15, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2905, .adv_w = 242, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2996, .adv_w = 239, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3087, .adv_w = 201, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3164, .adv_w = 239, .box_w = 13, .box_h = 17, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 3275, .adv_w = 206, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3359, .adv_w = 184, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3429, .adv_w = 175, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3506, .adv_w = 232, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3590, .adv_w = 219, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3688, .adv_w = 301, .box_w = 19, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3821, .adv_w = 216, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 3919, .adv_w = 208, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4010, .adv_w = 206, .box_w = 12, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4094, .adv_w = 104, .box_w = 5, .box_h = 19, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 4142, .adv_w = 162, .box_w = 10, .box_h = 17, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 4227, .adv_w = 104, .box_w = 6, .box_h = 19, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 4284, .adv_w = 184, .box_w = 10, .box_h = 8, .ofs_x = 1, .ofs_y = 6},
-    {.bitmap_index = 4324, .adv_w = 160, .box_w = 10, .box_h = 2, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 4334, .adv_w = 134, .box_w = 5, .box_h = 3, .ofs_x = 1, .ofs_y = 12},
-    {.bitmap_index = 4342, .adv_w = 197, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4403, .adv_w = 205, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4486, .adv_w = 159, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4541, .adv_w = 205, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4631, .adv_w = 187, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4692, .adv_w = 114, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 4752, .adv_w = 205, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 4842, .adv_w = 203, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4925, .adv_w = 91, .box_w = 4, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4955, .adv_w = 91, .box_w = 7, .box_h = 19, .ofs_x = -2, .ofs_y = -4},
-    {.bitmap_index = 5022, .adv_w = 179, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5105, .adv_w = 96, .box_w = 5, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5143, .adv_w = 300, .box_w = 17, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5237, .adv_w = 203, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5298, .adv_w = 198, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5364, .adv_w = 205, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 5447, .adv_w = 205, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 5537, .adv_w = 127, .box_w = 7, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5576, .adv_w = 156, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5620, .adv_w = 113, .box_w = 7, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5669, .adv_w = 201, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 5730, .adv_w = 182, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5796, .adv_w = 277, .box_w = 17, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5890, .adv_w = 185, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 5956, .adv_w = 182, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 6046, .adv_w = 173, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 6101, .adv_w = 109, .box_w = 7, .box_h = 19, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 6168, .adv_w = 69, .box_w = 3, .box_h = 19, .ofs_x = 1, .ofs_y = -4},
-    {.bitmap_index = 6197, .adv_w = 109, .box_w = 7, .box_h = 19, .ofs_x = 0, .ofs_y = -4},
-    {.bitmap_index = 6264, .adv_w = 184, .box_w = 11, .box_h = 4, .ofs_x = 0, .ofs_y = 4},
-    {.bitmap_index = 6286, .adv_w = 307, .box_w = 19, .box_h = 16, .ofs_x = 0, .ofs_y = -1},
-    {.bitmap_index = 6438, .adv_w = 315, .box_w = 16, .box_h = 19, .ofs_x = 2, .ofs_y = -2},
-    {.bitmap_index = 6590, .adv_w = 315, .box_w = 18, .box_h = 18, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 6752, .adv_w = 315, .box_w = 18, .box_h = 20, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 6932, .adv_w = 315, .box_w = 19, .box_h = 19, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 7113, .adv_w = 315, .box_w = 19, .box_h = 19, .ofs_x = 0, .ofs_y = -3},
-    {.bitmap_index = 7294, .adv_w = 315, .box_w = 18, .box_h = 20, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 7474, .adv_w = 315, .box_w = 19, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
-    {.bitmap_index = 7645, .adv_w = 315, .box_w = 16, .box_h = 19, .ofs_x = 2, .ofs_y = -3},
-    {.bitmap_index = 7797, .adv_w = 315, .box_w = 18, .box_h = 19, .ofs_x = 1, .ofs_y = -3},
-    {.bitmap_index = 7968, .adv_w = 315, .box_w = 18, .box_h = 18, .ofs_x = 1, .ofs_y = -2}
-};
-
-/*---------------------
- *  CHARACTER MAPPING
- *--------------------*/
-
-static const uint16_t unicode_list_1[] = {
-    0x0, 0x2d2a, 0x2d8e, 0x3817, 0x3824, 0x3b0c, 0x4571, 0x45b1,
-    0x7531, 0x75e5, 0x75e7
-};
-
-/*Collect the unicode lists and glyph_id offsets*/
-static const lv_font_fmt_txt_cmap_t cmaps[] =
-{
-    {
-        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
-        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
-    },
-    {
-        .range_start = 8451, .range_length = 30184, .glyph_id_start = 96,
-        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 11, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
-    }
-};
-
-/*-----------------
- *    KERNING
- *----------------*/
-
-
-/*Pair left and right glyphs for kerning*/
-static const uint8_t kern_pair_glyph_ids[] =
-{
-    3, 3,
-    3, 8,
-    3, 13,
-    3, 15,
-    8, 3,
-    8, 8,
-    8, 13,
-    8, 15,
-    9, 75,
-    13, 3,
-    13, 8,
-    13, 18,
-    13, 24,
-    13, 26,
-    15, 3,
-    15, 8,
-    15, 18,
-    15, 24,
-    15, 26,
-    16, 16,
-    18, 13,
-    18, 15,
-    18, 27,
-    18, 28,
-    24, 13,
-    24, 15,
-    24, 27,
-    24, 28,
-    27, 18,
-    27, 24,
-    28, 18,
-    28, 24,
-    34, 3,
-    34, 8,
-    34, 36,
-    34, 40,
-    34, 48,
-    34, 50,
-    34, 53,
-    34, 54,
-    34, 55,
-    34, 56,
-    34, 58,
-    34, 71,
-    34, 77,
-    34, 85,
-    34, 87,
-    34, 90,
-    35, 36,
-    35, 40,
-    35, 48,
-    35, 50,
-    35, 53,
-    35, 55,
-    35, 57,
-    35, 58,
-    37, 13,
-    37, 15,
-    37, 34,
-    37, 53,
-    37, 55,
-    37, 56,
-    37, 57,
-    37, 58,
-    37, 59,
-    37, 66,
-    38, 75,
-    39, 13,
-    39, 15,
-    39, 34,
-    39, 66,
-    39, 73,
-    39, 76,
-    40, 55,
-    40, 58,
-    43, 43,
-    44, 34,
-    44, 36,
-    44, 40,
-    44, 48,
-    44, 50,
-    44, 53,
-    44, 54,
-    44, 55,
-    44, 56,
-    44, 58,
-    44, 68,
-    44, 69,
-    44, 70,
-    44, 72,
-    44, 77,
-    44, 80,
-    44, 82,
-    44, 84,
-    44, 85,
-    44, 86,
-    44, 87,
-    44, 88,
-    44, 90,
-    45, 3,
-    45, 8,
-    45, 34,
-    45, 36,
-    45, 40,
-    45, 48,
-    45, 50,
-    45, 53,
-    45, 54,
-    45, 55,
-    45, 56,
-    45, 58,
-    45, 87,
-    45, 88,
-    45, 90,
-    48, 13,
-    48, 15,
-    48, 34,
-    48, 53,
-    48, 55,
-    48, 56,
-    48, 57,
-    48, 58,
-    48, 59,
-    48, 66,
-    49, 13,
-    49, 15,
-    49, 34,
-    49, 53,
-    49, 55,
-    49, 56,
-    49, 57,
-    49, 58,
-    49, 59,
-    49, 66,
-    50, 13,
-    50, 15,
-    50, 34,
-    50, 43,
-    50, 53,
-    50, 55,
-    50, 56,
-    50, 57,
-    50, 58,
-    50, 59,
-    50, 66,
-    51, 36,
-    51, 40,
-    51, 48,
-    51, 50,
-    51, 53,
-    51, 54,
-    51, 55,
-    51, 56,
-    51, 57,
-    51, 58,
-    51, 68,
-    51, 69,
-    51, 70,
-    51, 72,
-    51, 80,
-    51, 82,
-    51, 85,
-    51, 86,
-    51, 87,
-    51, 89,
-    51, 90,
-    52, 13,
-    52, 15,
-    52, 52,
-    52, 53,
-    52, 55,
-    52, 56,
-    52, 58,
-    52, 85,
-    52, 87,
-    52, 88,
-    52, 89,
-    52, 90,
-    53, 3,
-    53, 8,
-    53, 13,
-    53, 15,
-    53, 34,
-    53, 36,
-    53, 40,
-    53, 48,
-    53, 50,
-    53, 52,
-    53, 66,
-    53, 68,
-    53, 69,
-    53, 70,
-    53, 72,
-    53, 74,
-    53, 75,
-    53, 78,
-    53, 79,
-    53, 80,
-    53, 81,
-    53, 82,
-    53, 83,
-    53, 84,
-    53, 85,
-    53, 86,
-    53, 87,
-    53, 88,
-    53, 89,
-    53, 90,
-    53, 91,
-    54, 34,
-    54, 57,
-    54, 89,
-    55, 13,
-    55, 15,
-    55, 27,
-    55, 28,
-    55, 34,
-    55, 36,
-    55, 40,
-    55, 48,
-    55, 50,
-    55, 52,
-    55, 66,
-    55, 68,
-    55, 69,
-    55, 70,
-    55, 72,
-    55, 73,
-    55, 76,
-    55, 80,
-    55, 82,
-    55, 84,
-    55, 87,
-    55, 90,
-    56, 13,
-    56, 15,
-    56, 27,
-    56, 28,
-    56, 34,
-    56, 36,
-    56, 40,
-    56, 48,
-    56, 50,
-    56, 66,
-    56, 68,
-    56, 69,
-    56, 70,
-    56, 72,
-    56, 80,
-    56, 82,
-    56, 84,
-    57, 34,
-    57, 36,
-    57, 40,
-    57, 48,
-    57, 50,
-    57, 53,
-    57, 54,
-    57, 55,
-    57, 56,
-    57, 58,
-    57, 68,
-    57, 69,
-    57, 70,
-    57, 72,
-    57, 77,
-    57, 80,
-    57, 82,
-    57, 84,
-    57, 85,
-    57, 86,
-    57, 87,
-    57, 88,
-    57, 90,
-    58, 3,
-    58, 8,
-    58, 13,
-    58, 15,
-    58, 27,
-    58, 28,
-    58, 34,
-    58, 36,
-    58, 40,
-    58, 48,
-    58, 50,
-    58, 52,
-    58, 66,
-    58, 68,
-    58, 69,
-    58, 70,
-    58, 71,
-    58, 72,
-    58, 73,
-    58, 74,
-    58, 76,
-    58, 78,
-    58, 79,
-    58, 80,
-    58, 81,
-    58, 82,
-    58, 83,
-    58, 84,
-    58, 85,
-    58, 86,
-    58, 87,
-    58, 89,
-    58, 90,
-    58, 91,
-    59, 36,
-    59, 40,
-    59, 48,
-    59, 50,
-    60, 75,
-    66, 53,
-    66, 55,
-    66, 58,
-    66, 87,
-    66, 88,
-    66, 90,
-    67, 13,
-    67, 15,
-    67, 53,
-    67, 55,
-    67, 56,
-    67, 57,
-    67, 58,
-    67, 87,
-    67, 89,
-    67, 90,
-    70, 13,
-    70, 15,
-    70, 53,
-    70, 58,
-    70, 75,
-    71, 3,
-    71, 8,
-    71, 10,
-    71, 11,
-    71, 13,
-    71, 15,
-    71, 32,
-    71, 53,
-    71, 55,
-    71, 56,
-    71, 57,
-    71, 58,
-    71, 62,
-    71, 66,
-    71, 68,
-    71, 69,
-    71, 70,
-    71, 71,
-    71, 72,
-    71, 73,
-    71, 74,
-    71, 75,
-    71, 76,
-    71, 77,
-    71, 80,
-    71, 82,
-    71, 84,
-    71, 85,
-    71, 87,
-    71, 90,
-    71, 94,
-    73, 53,
-    73, 58,
-    73, 87,
-    73, 88,
-    73, 90,
-    74, 3,
-    74, 8,
-    74, 10,
-    74, 32,
-    74, 53,
-    74, 62,
-    74, 94,
-    75, 53,
-    76, 53,
-    76, 54,
-    76, 56,
-    76, 66,
-    76, 68,
-    76, 69,
-    76, 70,
-    76, 72,
-    76, 77,
-    76, 80,
-    76, 82,
-    76, 86,
-    77, 71,
-    77, 85,
-    77, 87,
-    77, 88,
-    77, 90,
-    78, 53,
-    78, 58,
-    78, 87,
-    78, 88,
-    78, 90,
-    79, 53,
-    79, 58,
-    79, 87,
-    79, 88,
-    79, 90,
-    80, 13,
-    80, 15,
-    80, 53,
-    80, 55,
-    80, 56,
-    80, 57,
-    80, 58,
-    80, 87,
-    80, 89,
-    80, 90,
-    81, 13,
-    81, 15,
-    81, 53,
-    81, 55,
-    81, 56,
-    81, 57,
-    81, 58,
-    81, 87,
-    81, 89,
-    81, 90,
-    82, 53,
-    82, 58,
-    82, 75,
-    83, 3,
-    83, 8,
-    83, 13,
-    83, 15,
-    83, 66,
-    83, 68,
-    83, 69,
-    83, 70,
-    83, 71,
-    83, 80,
-    83, 82,
-    83, 85,
-    83, 87,
-    83, 90,
-    84, 53,
-    84, 55,
-    84, 56,
-    84, 57,
-    84, 58,
-    84, 87,
-    84, 89,
-    84, 90,
-    85, 71,
-    85, 85,
-    86, 53,
-    86, 58,
-    87, 13,
-    87, 15,
-    87, 53,
-    87, 57,
-    87, 66,
-    87, 68,
-    87, 69,
-    87, 70,
-    87, 80,
-    87, 82,
-    88, 13,
-    88, 15,
-    88, 53,
-    88, 57,
-    88, 66,
-    89, 53,
-    89, 54,
-    89, 56,
-    89, 66,
-    89, 68,
-    89, 69,
-    89, 70,
-    89, 72,
-    89, 77,
-    89, 80,
-    89, 82,
-    89, 86,
-    90, 13,
-    90, 15,
-    90, 53,
-    90, 57,
-    90, 66,
-    90, 68,
-    90, 69,
-    90, 70,
-    90, 80,
-    90, 82,
-    91, 53,
-    92, 73,
-    92, 75,
-    92, 76
-};
-
-/* Kerning between the respective left and right glyphs
- * 4.4 format which needs to scaled with `kern_scale`*/
-static const int8_t kern_pair_values[] =
-{
-    -1, -7, -54, -54, -1, -7, -54, -54,
-    19, -51, -51, -45, -19, -10, -51, -51,
-    -45, -19, -10, -38, -26, -26, -29, -29,
-    -51, -51, -26, -26, -22, -16, -22, -16,
-    -32, -32, -5, -5, -5, -5, -26, -2,
-    -23, -8, -29, -6, -3, -6, -6, -6,
-    -2, -2, -2, -2, -11, -6, -6, -10,
-    -16, -16, -6, -12, -10, -3, -8, -13,
-    -6, -7, 3, -45, -45, -13, -16, 3,
-    3, -6, -11, 7, -3, -8, -8, -8,
-    -8, -3, -10, -7, -7, -13, -10, -10,
-    -10, -10, -10, -10, -10, -3, -5, -11,
-    -19, -13, -19, -29, -29, 6, -13, -13,
-    -13, -13, -20, -3, -22, -10, -32, -16,
-    -10, -16, -16, -16, -6, -12, -10, -3,
-    -8, -13, -6, -7, -58, -58, -19, -5,
-    -2, -2, -16, -6, -10, -19, -16, -16,
-    -6, 7, -12, -10, -3, -8, -13, -6,
-    -7, -4, -4, -4, -4, -13, -3, -9,
-    -5, -6, -16, -6, -6, -6, -6, -6,
-    -6, -6, -2, -3, 6, -3, -6, -6,
-    -3, -6, -10, -5, -10, -3, -6, -3,
-    -3, -6, 9, 9, -46, -46, -26, -6,
-    -6, -6, -6, -3, -26, -16, -16, -16,
-    -16, -6, -3, -16, -16, -16, -10, -16,
-    -16, -19, 6, -20, -7, -3, -7, -7,
-    -16, -2, -3, -3, -45, -45, -16, -16,
-    -24, -10, -10, -10, -10, -5, -19, -10,
-    -10, -10, -10, 5, 5, -10, -10, -10,
-    -5, -5, -22, -22, -7, -7, -12, -3,
-    -3, -3, -3, -13, -6, -6, -6, -6,
-    -6, -6, -6, -3, -8, -8, -8, -8,
-    -3, -10, -7, -7, -13, -10, -10, -10,
-    -10, -10, -10, -10, -3, -5, -11, -19,
-    -13, -19, 6, 6, -51, -51, -19, -19,
-    -29, -13, -13, -13, -13, -3, -35, -19,
-    -19, -19, -6, -19, 3, -3, 3, -16,
-    -16, -19, -13, -19, -16, -22, -3, -13,
-    -13, -16, -13, -16, -6, -6, -6, -6,
-    26, -19, -10, -25, -5, -5, -5, -13,
-    -13, -16, -12, -6, -10, -19, -3, -6,
-    -3, -6, -6, -13, -13, 6, 12, 12,
-    6, 22, -6, -6, 13, 13, 10, 10,
-    10, 6, 12, -6, -3, -3, -3, 5,
-    -7, -2, -3, -3, -2, -3, -3, -3,
-    -3, 5, 2, 2, 12, -10, -7, -5,
-    -2, -5, 9, 9, 9, 12, -6, 19,
-    16, -6, -7, -3, -6, -6, -6, -6,
-    -6, -5, -6, -6, -6, -5, -6, -2,
-    -3, -2, -3, -10, -7, -5, -2, -5,
-    -10, -7, -5, -2, -5, -13, -13, -16,
-    -12, -6, -10, -19, -3, -6, -3, -13,
-    -13, -16, -12, -6, -10, -19, -3, -6,
-    -3, -3, -3, 6, 9, 9, -30, -30,
-    -14, -3, -3, -3, 3, -3, -3, 6,
-    2, 2, -16, -10, -6, -3, -19, -3,
-    -3, -3, 3, 2, -13, -3, -27, -27,
-    -7, -7, -12, -3, -3, -3, -3, -3,
-    -18, -18, -3, -7, -11, -7, -3, -6,
-    -6, -6, -6, -6, -5, -6, -6, -6,
-    -5, -27, -27, -7, -7, -12, -3, -3,
-    -3, -3, -3, -16, 9, 22, 9
-};
-
-/*Collect the kern pair's data in one place*/
-static const lv_font_fmt_txt_kern_pair_t kern_pairs =
-{
-    .glyph_ids = kern_pair_glyph_ids,
-    .values = kern_pair_values,
-    .pair_cnt = 495,
-    .glyph_ids_size = 0
-};
-
-/*--------------------
- *  ALL CUSTOM DATA
- *--------------------*/
-
-#if LV_VERSION_CHECK(8, 0, 0)
-/*Store all the custom data of the font*/
-static  lv_font_fmt_txt_glyph_cache_t cache;
-static const lv_font_fmt_txt_dsc_t font_dsc = {
-#else
-static lv_font_fmt_txt_dsc_t font_dsc = {
-#endif
-    .glyph_bitmap = glyph_bitmap,
-    .glyph_dsc = glyph_dsc,
-    .cmaps = cmaps,
-    .kern_dsc = &kern_pairs,
-    .kern_scale = 16,
-    .cmap_num = 2,
-    .bpp = 4,
-    .kern_classes = 0,
-    .bitmap_format = 0,
-#if LV_VERSION_CHECK(8, 0, 0)
-    .cache = &cache
-#endif
-};
-
-
-/*-----------------
- *  PUBLIC FONT
- *----------------*/
-
-/*Initialize a public general font descriptor*/
-#if LV_VERSION_CHECK(8, 0, 0)
-const lv_font_t ui_font_FontPuHui20bp4 = {
-#else
-lv_font_t ui_font_FontPuHui20bp4 = {
-#endif
-    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
-    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
-    .line_height = 21,          /*The maximum line height required by the font*/
-    .base_line = 4,             /*Baseline measured from the bottom of the line*/
-#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
-    .subpx = LV_FONT_SUBPX_NONE,
-#endif
-#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
-    .underline_position = -1,
-    .underline_thickness = 1,
-#endif
-    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
-};
-
-
-
-#endif /*#if UI_FONT_FONTPUHUI20BP4*/
-
@@ -1,238 +0,0 @@
-#ifdef __has_include
-    #if __has_include("lvgl.h")
-        #ifndef LV_LVGL_H_INCLUDE_SIMPLE
-            #define LV_LVGL_H_INCLUDE_SIMPLE
-        #endif
-    #endif
-#endif
-
-#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
-    #include "lvgl.h"
-#else
-    #include "lvgl/lvgl.h"
-#endif
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_UI_IMG_SETTINGS_ICON_PNG
-#define LV_ATTRIBUTE_IMG_UI_IMG_SETTINGS_ICON_PNG
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_UI_IMG_SETTINGS_ICON_PNG uint8_t ui_img_settings_icon_png_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x02, 0x93, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x06, 0x92, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x1b, 0x92, 0x85, 0x92, 0xe1, 0x92, 0xb2, 0xb7, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x03, 0x92, 0xb3, 0x92, 0xe1, 0x92, 0x84, 0x92, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x12, 0x92, 0x93, 0x92, 0xf7, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xae, 0x92, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x13, 0x92, 0xb0, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xf7, 0x92, 0x92, 0x92, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x54, 0x92, 0xe8, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xe8, 0x92, 0x84, 0x92, 0x32, 0x92, 0x10, 0x92, 0x10, 0x92, 0x33, 0x92, 0x85, 0x92, 0xe8, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xe8, 0x92, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x03, 0x92, 0x88, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x99, 0x76, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x1b, 0x92, 0xfd, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xfc, 0x92, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xbf, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x95, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x87, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xa7, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xb6, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0xb7, 0xff, 0x96, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x04, 0x92, 0xe4, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xb7, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xe3, 0x92, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x55, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x19, 0x92, 0xe7, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xe7, 0x92, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x21, 0x92, 0xcf, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x77, 0xff, 0x53, 0xff, 0x2f, 0xff, 0x2f, 0xff, 0x53, 0xff, 0x97, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xce, 0x92, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x17, 0x92, 0x7b, 0x92, 0xef, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x2f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x2f, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xee, 0x92, 0x7a, 0x72, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x60, 0x92, 0xe2, 0x92, 0xfe, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xfe, 0x92, 0xe2, 0x92, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xa4, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x2f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xd1, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xe8, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x53, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xf8, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xf9, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xec, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x53, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xd1, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x8a, 0x92, 0xe0, 0x92, 0xfb, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x2f, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xfb, 0x72, 0xe0, 0x72, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x17, 0x92, 0x77, 0x92, 0xef, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xef, 0x72, 0x76, 0x72, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x21, 0x92, 0xce, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xcc, 0x72, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x17, 0x92, 0xe5, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0x53, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x53, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xe8, 0x72, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x55, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x05, 0x92, 0xe6, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xe6, 0x92, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xa4, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x8a, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x96, 0xff, 0xb7, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xb7, 0xff, 0x96, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x95, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xc3, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x22, 0x92, 0xfb, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xfc, 0x72, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x76, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x03, 0x92, 0x8d, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xee, 0x92, 0x84, 0x72, 0x37, 0x92, 0x12, 0x92, 0x12, 0x72, 0x37, 0x72, 0x85, 0x72, 0xee, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0x8d, 0x6d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x4f, 0x92, 0xe8, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xb6, 0x92, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x0f, 0x72, 0xb7, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xe7, 0x72, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x13, 0x92, 0x8d, 0x92, 0xf7, 0x92, 0xff, 0x92, 0xff, 0x92, 0xaf, 0x6f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x04, 0x72, 0xb1, 0x72, 0xff, 0x72, 0xff, 0x72, 0xf7, 0x72, 0x8c, 0x72, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x1a, 0x92, 0x7e, 0x92, 0xcd, 0x92, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x17, 0x72, 0xce, 0x72, 0x7f, 0x72, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x02, 0x15, 0x84, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x06, 0x10, 0x84, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x8c, 0x1b, 0x93, 0x8c, 0x85, 0x73, 0x8c, 0xe1, 0x73, 0x8c, 0xb2, 0x75, 0xad, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xad, 0x03, 0x72, 0x84, 0xb3, 0x72, 0x84, 0xe1, 0x52, 0x84, 0x84, 0x52, 0x84, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x84, 0x12, 0x93, 0x8c, 0x93, 0x93, 0x8c, 0xf7, 0x93, 0x8c, 0xff, 0x93, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xae, 0x94, 0x84, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x8c, 0x13, 0x72, 0x84, 0xb0, 0x72, 0x84, 0xff, 0x72, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xf7, 0x52, 0x84, 0x92, 0x53, 0x7c, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x8c, 0x54, 0x73, 0x8c, 0xe8, 0x93, 0x8c, 0xff, 0x93, 0x8c, 0xff, 0x93, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xe8, 0x73, 0x8c, 0x84, 0x73, 0x8c, 0x32, 0x92, 0x84, 0x10, 0x92, 0x84, 0x10, 0x73, 0x84, 0x33, 0x73, 0x84, 0x85, 0x72, 0x84, 0xe8, 0x72, 0x84, 0xff, 0x72, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xe8, 0x52, 0x84, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xad, 0x03, 0x93, 0x8c, 0x88, 0x93, 0x8c, 0xff, 0x93, 0x8c, 0xff, 0x93, 0x8c, 0xff, 0x93, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x72, 0x84, 0xff, 0x72, 0x84, 0xff, 0x72, 0x84, 0xff, 0x72, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x32, 0x84, 0x99, 0xd3, 0x6c, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x8c, 0x1b, 0x93, 0x8c, 0xfd, 0x93, 0x8c, 0xff, 0x93, 0x8c, 0xff, 0x93, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x72, 0x84, 0xff, 0x72, 0x84, 0xff, 0x72, 0x84, 0xff, 0x72, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x32, 0x84, 0xfc, 0x32, 0x7c, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x8c, 0xbf, 0x93, 0x8c, 0xff, 0x93, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x72, 0x84, 0xff, 0x72, 0x84, 0xff, 0x72, 0x84, 0xff, 0x72, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x8c, 0x95, 0x93, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x72, 0x84, 0xff, 0x72, 0x84, 0xff, 0x72, 0x84, 0xff, 0x72, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x32, 0x84, 0xff, 0x32, 0x84, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x8c, 0x87, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x72, 0x84, 0xff, 0x72, 0x84, 0xff, 0x72, 0x84, 0xff, 0x72, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x32, 0x84, 0xff, 0x32, 0x84, 0xff, 0x32, 0x7c, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x84, 0xa7, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x72, 0x84, 0xff, 0xd4, 0x94, 0xff, 0x35, 0xa5, 0xff, 0x76, 0xad, 0xff, 0x76, 0xad, 0xff, 0x35, 0xa5, 0xff, 0xd4, 0x94, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x32, 0x84, 0xff, 0x32, 0x84, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x04, 0x73, 0x8c, 0xe4, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x93, 0x8c, 0xff, 0x76, 0xad, 0xff, 0x59, 0xce, 0xff, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0x9a, 0xd6, 0xff, 0x96, 0xad, 0xff, 0x72, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x32, 0x84, 0xff, 0x32, 0x84, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xe3, 0x10, 0x84, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x8c, 0x55, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0xf4, 0x9c, 0xff, 0x59, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfc, 0xe6, 0xff, 0xfc, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0xdb, 0xde, 0xff, 0xf4, 0x9c, 0xff, 0x32, 0x84, 0xff, 0x32, 0x84, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x8c, 0x19, 0x73, 0x8c, 0xe7, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x35, 0xa5, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfc, 0xe6, 0xff, 0xfc, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x35, 0xa5, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0x31, 0x7c, 0xe7, 0x32, 0x7c, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x84, 0x21, 0x73, 0x8c, 0xcf, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0xf4, 0x9c, 0xff, 0x7a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0x7a, 0xce, 0xff, 0xf8, 0x74, 0xff, 0xd6, 0x3b, 0xff, 0x35, 0x1b, 0xff, 0x35, 0x1b, 0xff, 0xd6, 0x3b, 0xff, 0xf8, 0x74, 0xff, 0xdc, 0xd6, 0xff, 0x3c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xf4, 0x94, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0x31, 0x7c, 0xff, 0x31, 0x7c, 0xff, 0x11, 0x7c, 0xce, 0x31, 0x7c, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x8c, 0x17, 0x73, 0x8c, 0x7b, 0x73, 0x8c, 0xef, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x93, 0x8c, 0xff, 0x59, 0xce, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0x99, 0x95, 0xff, 0x55, 0x1b, 0xff, 0x15, 0x13, 0xff, 0x15, 0x13, 0xff, 0x15, 0x13, 0xff, 0x15, 0x13, 0xff, 0x14, 0x13, 0xff, 0x14, 0x13, 0xff, 0x35, 0x1b, 0xff, 0xda, 0xa5, 0xff, 0x3d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x1c, 0xe7, 0xff, 0x32, 0x84, 0xff, 0x32, 0x7c, 0xff, 0x31, 0x7c, 0xff, 0x31, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x7c, 0xee, 0xf1, 0x73, 0x7a, 0xf1, 0x73, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x8c, 0x60, 0x73, 0x8c, 0xe2, 0x73, 0x8c, 0xfe, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x76, 0xad, 0xff, 0x9a, 0xd6, 0xff, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0x99, 0x95, 0xff, 0x15, 0x13, 0xff, 0x15, 0x13, 0xff, 0x15, 0x13, 0xff, 0x15, 0x13, 0xff, 0x15, 0x13, 0xff, 0x14, 0x13, 0xff, 0x14, 0x13, 0xff, 0xf4, 0x12, 0xff, 0xf4, 0x12, 0xff, 0xf4, 0x12, 0xff, 0xda, 0xa5, 0xff, 0x5d, 0xef, 0xff, 0x7d, 0xef, 0xff, 0x7d, 0xef, 0xff, 0xb7, 0xb5, 0xff, 0x31, 0x7c, 0xff, 0x31, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x74, 0xff, 0xf1, 0x73, 0xfe, 0xf1, 0x73, 0xe2, 0xf1, 0x73, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x8c, 0xa4, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x72, 0x84, 0xff, 0x59, 0xce, 0xff, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0x7a, 0xce, 0xff, 0x55, 0x1b, 0xff, 0x15, 0x13, 0xff, 0x15, 0x13, 0xff, 0x15, 0x13, 0xff, 0x15, 0x13, 0xff, 0x14, 0x13, 0xff, 0x14, 0x13, 0xff, 0xf4, 0x12, 0xff, 0xf4, 0x12, 0xff, 0xf4, 0x12, 0xff, 0xf4, 0x12, 0xff, 0x14, 0x23, 0xff, 0x1d, 0xdf, 0xff, 0x7d, 0xef, 0xff, 0x7e, 0xf7, 0xff, 0x1c, 0xe7, 0xff, 0x31, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x74, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf0, 0x73, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x8c, 0xd1, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x72, 0x84, 0xff, 0xd4, 0x94, 0xff, 0xba, 0xd6, 0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xf8, 0x74, 0xff, 0x15, 0x13, 0xff, 0x15, 0x13, 0xff, 0x15, 0x13, 0xff, 0x15, 0x13, 0xff, 0x14, 0x13, 0xff, 0x14, 0x13, 0xff, 0xf4, 0x12, 0xff, 0xf4, 0x12, 0xff, 0xf4, 0x12, 0xff, 0xf4, 0x12, 0xff, 0xd3, 0x12, 0xff, 0xd3, 0x12, 0xff, 0x18, 0x85, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xb3, 0x8c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x74, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf0, 0x73, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x8c, 0xe8, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x72, 0x84, 0xff, 0x72, 0x84, 0xff, 0x35, 0xa5, 0xff, 0xbb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xd6, 0x33, 0xff, 0x15, 0x13, 0xff, 0x15, 0x13, 0xff, 0x15, 0x13, 0xff, 0x14, 0x13, 0xff, 0x14, 0x13, 0xff, 0xf4, 0x12, 0xff, 0xf4, 0x12, 0xff, 0xf4, 0x12, 0xff, 0xf4, 0x12, 0xff, 0xd3, 0x12, 0xff, 0xd3, 0x12, 0xff, 0xd3, 0x12, 0xff, 0xb5, 0x43, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0x56, 0xa5, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x74, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xd0, 0x73, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x8c, 0xf8, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x72, 0x84, 0xff, 0x72, 0x84, 0xff, 0x72, 0x84, 0xff, 0x76, 0xad, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0x35, 0x1b, 0xff, 0x15, 0x13, 0xff, 0x15, 0x13, 0xff, 0x14, 0x13, 0xff, 0x14, 0x13, 0xff, 0xf4, 0x12, 0xff, 0xf4, 0x12, 0xff, 0xf4, 0x12, 0xff, 0xf4, 0x12, 0xff, 0xd3, 0x12, 0xff, 0xd3, 0x12, 0xff, 0xd3, 0x12, 0xff, 0xd3, 0x12, 0xff, 0x13, 0x23, 0xff, 0x9e, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xb7, 0xb5, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x74, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x6b, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x8c, 0xf9, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x72, 0x84, 0xff, 0x72, 0x84, 0xff, 0x72, 0x84, 0xff, 0x72, 0x84, 0xff, 0x76, 0xad, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0x35, 0x1b, 0xff, 0x15, 0x13, 0xff, 0x14, 0x13, 0xff, 0x14, 0x13, 0xff, 0xf4, 0x12, 0xff, 0xf4, 0x12, 0xff, 0xf4, 0x12, 0xff, 0xf4, 0x12, 0xff, 0xd3, 0x12, 0xff, 0xd3, 0x12, 0xff, 0xd3, 0x12, 0xff, 0xd3, 0x12, 0xff, 0xd3, 0x1a, 0xff, 0xf3, 0x22, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0xb7, 0xb5, 0xff, 0x11, 0x74, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x6b, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x84, 0xec, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x72, 0x84, 0xff, 0x72, 0x84, 0xff, 0x72, 0x84, 0xff, 0x72, 0x84, 0xff, 0x52, 0x84, 0xff, 0x35, 0xa5, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xde, 0xff, 0xfc, 0xe6, 0xff, 0xd6, 0x3b, 0xff, 0x14, 0x13, 0xff, 0x14, 0x13, 0xff, 0xf4, 0x12, 0xff, 0xf4, 0x12, 0xff, 0xf4, 0x12, 0xff, 0xf4, 0x12, 0xff, 0xd3, 0x12, 0xff, 0xd3, 0x12, 0xff, 0xd3, 0x12, 0xff, 0xd3, 0x12, 0xff, 0xd3, 0x1a, 0xff, 0xb2, 0x1a, 0xff, 0xb4, 0x43, 0xff, 0xbe, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x56, 0xa5, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x6b, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x84, 0xd1, 0x73, 0x8c, 0xff, 0x73, 0x8c, 0xff, 0x72, 0x84, 0xff, 0x72, 0x84, 0xff, 0x72, 0x84, 0xff, 0x72, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0xd4, 0x94, 0xff, 0xfb, 0xde, 0xff, 0xfc, 0xe6, 0xff, 0xfc, 0xe6, 0xff, 0xf8, 0x74, 0xff, 0x14, 0x13, 0xff, 0xf4, 0x12, 0xff, 0xf4, 0x12, 0xff, 0xf4, 0x12, 0xff, 0xf4, 0x12, 0xff, 0xd3, 0x12, 0xff, 0xd3, 0x12, 0xff, 0xd3, 0x12, 0xff, 0xd3, 0x12, 0xff, 0xd3, 0x1a, 0xff, 0xb2, 0x1a, 0xff, 0xb2, 0x1a, 0xff, 0x38, 0x85, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x93, 0x8c, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x6b, 0xff, 0xb0, 0x6b, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x84, 0x8a, 0x72, 0x8c, 0xe0, 0x72, 0x84, 0xfb, 0x72, 0x84, 0xff, 0x72, 0x84, 0xff, 0x72, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x9a, 0xd6, 0xff, 0xfc, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0xdc, 0xd6, 0xff, 0x35, 0x1b, 0xff, 0xf4, 0x12, 0xff, 0xf4, 0x12, 0xff, 0xf4, 0x12, 0xff, 0xd3, 0x12, 0xff, 0xd3, 0x12, 0xff, 0xd3, 0x12, 0xff, 0xd3, 0x12, 0xff, 0xd3, 0x1a, 0xff, 0xb2, 0x1a, 0xff, 0xb2, 0x1a, 0xff, 0xf3, 0x22, 0xff, 0x5e, 0xef, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x5d, 0xef, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x6b, 0xfb, 0xd0, 0x6b, 0xe0, 0xb0, 0x6b, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x8c, 0x17, 0x53, 0x84, 0x77, 0x52, 0x84, 0xef, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x96, 0xad, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0xda, 0xa5, 0xff, 0xf4, 0x12, 0xff, 0xf4, 0x12, 0xff, 0xd3, 0x12, 0xff, 0xd3, 0x12, 0xff, 0xd3, 0x12, 0xff, 0xd3, 0x12, 0xff, 0xd3, 0x1a, 0xff, 0xb2, 0x1a, 0xff, 0xb2, 0x1a, 0xff, 0xb2, 0x1a, 0xff, 0x1a, 0xb6, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xb5, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x6b, 0xef, 0xd0, 0x73, 0x76, 0xf1, 0x73, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x84, 0x21, 0x52, 0x84, 0xce, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x72, 0x84, 0xff, 0xdb, 0xde, 0xff, 0x3c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0xda, 0xa5, 0xff, 0x14, 0x23, 0xff, 0xd3, 0x12, 0xff, 0xd3, 0x12, 0xff, 0xd3, 0x12, 0xff, 0xd3, 0x1a, 0xff, 0xb2, 0x1a, 0xff, 0xb2, 0x1a, 0xff, 0xf3, 0x22, 0xff, 0x1a, 0xb6, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xef, 0xff, 0x11, 0x7c, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xb0, 0x6b, 0xcc, 0xd0, 0x6b, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x8c, 0x17, 0x52, 0x84, 0xe5, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0xd4, 0x94, 0xff, 0x1c, 0xe7, 0xff, 0x3d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x1d, 0xdf, 0xff, 0x18, 0x85, 0xff, 0xb5, 0x43, 0xff, 0xf3, 0x22, 0xff, 0xf3, 0x22, 0xff, 0xb4, 0x43, 0xff, 0x38, 0x85, 0xff, 0x5e, 0xef, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xd4, 0x94, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x6b, 0xe8, 0xd0, 0x73, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x84, 0x55, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x32, 0x84, 0xff, 0x35, 0xa5, 0xff, 0x3d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x7d, 0xef, 0xff, 0x7d, 0xef, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x36, 0xa5, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x73, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x6c, 0x05, 0x52, 0x84, 0xe6, 0x52, 0x84, 0xff, 0x52, 0x84, 0xff, 0x32, 0x84, 0xff, 0x32, 0x84, 0xff, 0x32, 0x7c, 0xff, 0xf4, 0x94, 0xff, 0x1c, 0xe7, 0xff, 0x7d, 0xef, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xef, 0xff, 0xd4, 0x94, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x73, 0xe6, 0x10, 0x84, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x84, 0xa4, 0x52, 0x84, 0xff, 0x32, 0x84, 0xff, 0x32, 0x84, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x84, 0xff, 0xb7, 0xb5, 0xff, 0x1c, 0xe7, 0xff, 0x9e, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xbe, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x5d, 0xef, 0xff, 0xb7, 0xb5, 0xff, 0x11, 0x7c, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x6b, 0xff, 0xb0, 0x6b, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x84, 0x8a, 0x32, 0x84, 0xff, 0x32, 0x84, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0x31, 0x7c, 0xff, 0x31, 0x7c, 0xff, 0xb3, 0x8c, 0xff, 0x56, 0xa5, 0xff, 0xb7, 0xb5, 0xff, 0xb7, 0xb5, 0xff, 0x76, 0xa5, 0xff, 0x93, 0x8c, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x6b, 0xff, 0xd0, 0x6b, 0xff, 0xb0, 0x6b, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x7c, 0x95, 0x32, 0x84, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0x31, 0x7c, 0xff, 0x31, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x74, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x6b, 0xff, 0xd0, 0x6b, 0xff, 0xb0, 0x6b, 0xff, 0xb0, 0x6b, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x84, 0xc3, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0x31, 0x7c, 0xff, 0x31, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x74, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x6b, 0xff, 0xd0, 0x6b, 0xff, 0xb0, 0x6b, 0xff, 0xb0, 0x6b, 0xff, 0xb0, 0x6b, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x84, 0x22, 0x32, 0x7c, 0xfb, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0x31, 0x7c, 0xff, 0x31, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x74, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x6b, 0xff, 0xd0, 0x6b, 0xff, 0xb0, 0x6b, 0xff, 0xb0, 0x6b, 0xff, 0xb0, 0x6b, 0xff, 0xb0, 0x6b, 0xfc, 0x90, 0x63, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x7c, 0x76, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0x31, 0x7c, 0xff, 0x31, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x74, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xf1, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x73, 0xff, 0xd0, 0x6b, 0xff, 0xd0, 0x6b, 0xff, 0xb0, 0x6b, 0xff, 0xb0, 0x6b, 0xff, 0xb0, 0x6b, 0xff, 0xb0, 0x6b, 0xff, 0xb0, 0x6b, 0xff, 0x8f, 0x63, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x5d, 0x03, 0x31, 0x7c, 0x8d, 0x32, 0x7c, 0xff, 0x32, 0x7c, 0xff, 0x31, 0x7c, 0xff, 0x31, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x74, 0xee, 0x11, 0x74, 0x84, 0xf1, 0x73, 0x37, 0x10, 0x74, 0x12, 0x10, 0x74, 0x12, 0xd0, 0x73, 0x37, 0xd0, 0x73, 0x85, 0xd0, 0x73, 0xee, 0xd0, 0x73, 0xff, 0xd0, 0x6b, 0xff, 0xd0, 0x6b, 0xff, 0xb0, 0x6b, 0xff, 0xb0, 0x6b, 0xff, 0xb0, 0x6b, 0xff, 0xb0, 0x6b, 0xff, 0xb0, 0x6b, 0xff, 0x90, 0x63, 0x8d, 0xab, 0x5a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x7c, 0x4f, 0x11, 0x7c, 0xe8, 0x31, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0x11, 0x74, 0xb6, 0xd1, 0x7b, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x6b, 0x0f, 0xd0, 0x6b, 0xb7, 0xd0, 0x6b, 0xff, 0xb0, 0x6b, 0xff, 0xb0, 0x6b, 0xff, 0xb0, 0x6b, 0xff, 0xb0, 0x6b, 0xff, 0x90, 0x6b, 0xe7, 0x8f, 0x6b, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x7c, 0x13, 0x11, 0x7c, 0x8d, 0x11, 0x7c, 0xf7, 0x11, 0x7c, 0xff, 0x11, 0x7c, 0xff, 0xf1, 0x73, 0xaf, 0xb5, 0x5a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0x04, 0xb0, 0x6b, 0xb1, 0xb0, 0x6b, 0xff, 0xb0, 0x6b, 0xff, 0xb0, 0x6b, 0xf7, 0xb0, 0x6b, 0x8c, 0x90, 0x63, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x7c, 0x1a, 0xf1, 0x73, 0x7e, 0xf1, 0x73, 0xcd, 0x11, 0x7c, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x6b, 0x17, 0xb0, 0x6b, 0xce, 0xb0, 0x6b, 0x7f, 0xd0, 0x63, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x02, 0x84, 0x15, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x06, 0x84, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x93, 0x1b, 0x8c, 0x93, 0x85, 0x8c, 0x73, 0xe1, 0x8c, 0x73, 0xb2, 0xad, 0x75, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x75, 0x03, 0x84, 0x72, 0xb3, 0x84, 0x72, 0xe1, 0x84, 0x52, 0x84, 0x84, 0x52, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x94, 0x12, 0x8c, 0x93, 0x93, 0x8c, 0x93, 0xf7, 0x8c, 0x93, 0xff, 0x8c, 0x93, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xae, 0x84, 0x94, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x53, 0x13, 0x84, 0x72, 0xb0, 0x84, 0x72, 0xff, 0x84, 0x72, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xf7, 0x84, 0x52, 0x92, 0x7c, 0x53, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x93, 0x54, 0x8c, 0x73, 0xe8, 0x8c, 0x93, 0xff, 0x8c, 0x93, 0xff, 0x8c, 0x93, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xe8, 0x8c, 0x73, 0x84, 0x8c, 0x73, 0x32, 0x84, 0x92, 0x10, 0x84, 0x92, 0x10, 0x84, 0x73, 0x33, 0x84, 0x73, 0x85, 0x84, 0x72, 0xe8, 0x84, 0x72, 0xff, 0x84, 0x72, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xe8, 0x84, 0x52, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x75, 0x03, 0x8c, 0x93, 0x88, 0x8c, 0x93, 0xff, 0x8c, 0x93, 0xff, 0x8c, 0x93, 0xff, 0x8c, 0x93, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x84, 0x72, 0xff, 0x84, 0x72, 0xff, 0x84, 0x72, 0xff, 0x84, 0x72, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x32, 0x99, 0x6c, 0xd3, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x93, 0x1b, 0x8c, 0x93, 0xfd, 0x8c, 0x93, 0xff, 0x8c, 0x93, 0xff, 0x8c, 0x93, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x84, 0x72, 0xff, 0x84, 0x72, 0xff, 0x84, 0x72, 0xff, 0x84, 0x72, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x32, 0xfc, 0x7c, 0x32, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x93, 0xbf, 0x8c, 0x93, 0xff, 0x8c, 0x93, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x84, 0x72, 0xff, 0x84, 0x72, 0xff, 0x84, 0x72, 0xff, 0x84, 0x72, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x92, 0x95, 0x8c, 0x93, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x84, 0x72, 0xff, 0x84, 0x72, 0xff, 0x84, 0x72, 0xff, 0x84, 0x72, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x32, 0xff, 0x84, 0x32, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x93, 0x87, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x84, 0x72, 0xff, 0x84, 0x72, 0xff, 0x84, 0x72, 0xff, 0x84, 0x72, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x32, 0xff, 0x84, 0x32, 0xff, 0x7c, 0x32, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x73, 0xa7, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x84, 0x72, 0xff, 0x94, 0xd4, 0xff, 0xa5, 0x35, 0xff, 0xad, 0x76, 0xff, 0xad, 0x76, 0xff, 0xa5, 0x35, 0xff, 0x94, 0xd4, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x32, 0xff, 0x84, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x04, 0x8c, 0x73, 0xe4, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x93, 0xff, 0xad, 0x76, 0xff, 0xce, 0x59, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xfb, 0xff, 0xd6, 0x9a, 0xff, 0xad, 0x96, 0xff, 0x84, 0x72, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x32, 0xff, 0x84, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xe3, 0x84, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x73, 0x55, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x9c, 0xf4, 0xff, 0xce, 0x59, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xfb, 0xff, 0xe6, 0xfc, 0xff, 0xe6, 0xfc, 0xff, 0xe7, 0x1c, 0xff, 0xde, 0xdb, 0xff, 0x9c, 0xf4, 0xff, 0x84, 0x32, 0xff, 0x84, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x93, 0x19, 0x8c, 0x73, 0xe7, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0xa5, 0x35, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xfb, 0xff, 0xe6, 0xfc, 0xff, 0xe6, 0xfc, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xe7, 0x1c, 0xff, 0xa5, 0x35, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x31, 0xe7, 0x7c, 0x32, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x72, 0x21, 0x8c, 0x73, 0xcf, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x9c, 0xf4, 0xff, 0xd6, 0x7a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0xce, 0x7a, 0xff, 0x74, 0xf8, 0xff, 0x3b, 0xd6, 0xff, 0x1b, 0x35, 0xff, 0x1b, 0x35, 0xff, 0x3b, 0xd6, 0xff, 0x74, 0xf8, 0xff, 0xd6, 0xdc, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0x94, 0xf4, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x31, 0xff, 0x7c, 0x31, 0xff, 0x7c, 0x11, 0xce, 0x7c, 0x31, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x92, 0x17, 0x8c, 0x73, 0x7b, 0x8c, 0x73, 0xef, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x93, 0xff, 0xce, 0x59, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0x95, 0x99, 0xff, 0x1b, 0x55, 0xff, 0x13, 0x15, 0xff, 0x13, 0x15, 0xff, 0x13, 0x15, 0xff, 0x13, 0x15, 0xff, 0x13, 0x14, 0xff, 0x13, 0x14, 0xff, 0x1b, 0x35, 0xff, 0xa5, 0xda, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xe7, 0x1c, 0xff, 0x84, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x31, 0xff, 0x7c, 0x31, 0xff, 0x7c, 0x11, 0xff, 0x7c, 0x11, 0xff, 0x7c, 0x11, 0xee, 0x73, 0xf1, 0x7a, 0x73, 0xf1, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x73, 0x60, 0x8c, 0x73, 0xe2, 0x8c, 0x73, 0xfe, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0xad, 0x76, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0x95, 0x99, 0xff, 0x13, 0x15, 0xff, 0x13, 0x15, 0xff, 0x13, 0x15, 0xff, 0x13, 0x15, 0xff, 0x13, 0x15, 0xff, 0x13, 0x14, 0xff, 0x13, 0x14, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xf4, 0xff, 0xa5, 0xda, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x7d, 0xff, 0xb5, 0xb7, 0xff, 0x7c, 0x31, 0xff, 0x7c, 0x31, 0xff, 0x7c, 0x11, 0xff, 0x7c, 0x11, 0xff, 0x7c, 0x11, 0xff, 0x7c, 0x11, 0xff, 0x74, 0x11, 0xff, 0x73, 0xf1, 0xfe, 0x73, 0xf1, 0xe2, 0x73, 0xf1, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x73, 0xa4, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x84, 0x72, 0xff, 0xce, 0x59, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0xce, 0x7a, 0xff, 0x1b, 0x55, 0xff, 0x13, 0x15, 0xff, 0x13, 0x15, 0xff, 0x13, 0x15, 0xff, 0x13, 0x15, 0xff, 0x13, 0x14, 0xff, 0x13, 0x14, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xf4, 0xff, 0x23, 0x14, 0xff, 0xdf, 0x1d, 0xff, 0xef, 0x7d, 0xff, 0xf7, 0x7e, 0xff, 0xe7, 0x1c, 0xff, 0x7c, 0x31, 0xff, 0x7c, 0x11, 0xff, 0x7c, 0x11, 0xff, 0x7c, 0x11, 0xff, 0x7c, 0x11, 0xff, 0x74, 0x11, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf0, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x93, 0xd1, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x84, 0x72, 0xff, 0x94, 0xd4, 0xff, 0xd6, 0xba, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0x74, 0xf8, 0xff, 0x13, 0x15, 0xff, 0x13, 0x15, 0xff, 0x13, 0x15, 0xff, 0x13, 0x15, 0xff, 0x13, 0x14, 0xff, 0x13, 0x14, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xd3, 0xff, 0x12, 0xd3, 0xff, 0x85, 0x18, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0x8c, 0xb3, 0xff, 0x7c, 0x11, 0xff, 0x7c, 0x11, 0xff, 0x7c, 0x11, 0xff, 0x74, 0x11, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf0, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x73, 0xe8, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x84, 0x72, 0xff, 0x84, 0x72, 0xff, 0xa5, 0x35, 0xff, 0xde, 0xbb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0x33, 0xd6, 0xff, 0x13, 0x15, 0xff, 0x13, 0x15, 0xff, 0x13, 0x15, 0xff, 0x13, 0x14, 0xff, 0x13, 0x14, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xd3, 0xff, 0x12, 0xd3, 0xff, 0x12, 0xd3, 0xff, 0x43, 0xb5, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0xbe, 0xff, 0xa5, 0x56, 0xff, 0x7c, 0x11, 0xff, 0x7c, 0x11, 0xff, 0x74, 0x11, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xd0, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x73, 0xf8, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x84, 0x72, 0xff, 0x84, 0x72, 0xff, 0x84, 0x72, 0xff, 0xad, 0x76, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0x1b, 0x35, 0xff, 0x13, 0x15, 0xff, 0x13, 0x15, 0xff, 0x13, 0x14, 0xff, 0x13, 0x14, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xd3, 0xff, 0x12, 0xd3, 0xff, 0x12, 0xd3, 0xff, 0x12, 0xd3, 0xff, 0x23, 0x13, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xb5, 0xb7, 0xff, 0x7c, 0x11, 0xff, 0x74, 0x11, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xd0, 0xff, 0x6b, 0xd0, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x73, 0xf9, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x84, 0x72, 0xff, 0x84, 0x72, 0xff, 0x84, 0x72, 0xff, 0x84, 0x72, 0xff, 0xad, 0x76, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xfb, 0xff, 0x1b, 0x35, 0xff, 0x13, 0x15, 0xff, 0x13, 0x14, 0xff, 0x13, 0x14, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xd3, 0xff, 0x12, 0xd3, 0xff, 0x12, 0xd3, 0xff, 0x12, 0xd3, 0xff, 0x1a, 0xd3, 0xff, 0x22, 0xf3, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xff, 0xbf, 0xff, 0xb5, 0xb7, 0xff, 0x74, 0x11, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xd0, 0xff, 0x73, 0xd0, 0xff, 0x6b, 0xd0, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x73, 0xec, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x84, 0x72, 0xff, 0x84, 0x72, 0xff, 0x84, 0x72, 0xff, 0x84, 0x72, 0xff, 0x84, 0x52, 0xff, 0xa5, 0x35, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xfb, 0xff, 0xe6, 0xfc, 0xff, 0x3b, 0xd6, 0xff, 0x13, 0x14, 0xff, 0x13, 0x14, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xd3, 0xff, 0x12, 0xd3, 0xff, 0x12, 0xd3, 0xff, 0x12, 0xd3, 0xff, 0x1a, 0xd3, 0xff, 0x1a, 0xb2, 0xff, 0x43, 0xb4, 0xff, 0xf7, 0xbe, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xa5, 0x56, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xd0, 0xff, 0x73, 0xd0, 0xff, 0x73, 0xd0, 0xff, 0x6b, 0xd0, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x72, 0xd1, 0x8c, 0x73, 0xff, 0x8c, 0x73, 0xff, 0x84, 0x72, 0xff, 0x84, 0x72, 0xff, 0x84, 0x72, 0xff, 0x84, 0x72, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x94, 0xd4, 0xff, 0xde, 0xfb, 0xff, 0xe6, 0xfc, 0xff, 0xe6, 0xfc, 0xff, 0x74, 0xf8, 0xff, 0x13, 0x14, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xd3, 0xff, 0x12, 0xd3, 0xff, 0x12, 0xd3, 0xff, 0x12, 0xd3, 0xff, 0x1a, 0xd3, 0xff, 0x1a, 0xb2, 0xff, 0x1a, 0xb2, 0xff, 0x85, 0x38, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0x8c, 0x93, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xd0, 0xff, 0x73, 0xd0, 0xff, 0x73, 0xd0, 0xff, 0x6b, 0xd0, 0xff, 0x6b, 0xb0, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x73, 0x8a, 0x8c, 0x72, 0xe0, 0x84, 0x72, 0xfb, 0x84, 0x72, 0xff, 0x84, 0x72, 0xff, 0x84, 0x72, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0xd6, 0x9a, 0xff, 0xe6, 0xfc, 0xff, 0xe7, 0x1c, 0xff, 0xd6, 0xdc, 0xff, 0x1b, 0x35, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xd3, 0xff, 0x12, 0xd3, 0xff, 0x12, 0xd3, 0xff, 0x12, 0xd3, 0xff, 0x1a, 0xd3, 0xff, 0x1a, 0xb2, 0xff, 0x1a, 0xb2, 0xff, 0x22, 0xf3, 0xff, 0xef, 0x5e, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xef, 0x5d, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xd0, 0xff, 0x73, 0xd0, 0xff, 0x73, 0xd0, 0xff, 0x6b, 0xd0, 0xfb, 0x6b, 0xd0, 0xe0, 0x6b, 0xb0, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x92, 0x17, 0x84, 0x53, 0x77, 0x84, 0x52, 0xef, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0xad, 0x96, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xa5, 0xda, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xf4, 0xff, 0x12, 0xd3, 0xff, 0x12, 0xd3, 0xff, 0x12, 0xd3, 0xff, 0x12, 0xd3, 0xff, 0x1a, 0xd3, 0xff, 0x1a, 0xb2, 0xff, 0x1a, 0xb2, 0xff, 0x1a, 0xb2, 0xff, 0xb6, 0x1a, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xb5, 0xb7, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xd0, 0xff, 0x73, 0xd0, 0xff, 0x6b, 0xd0, 0xef, 0x73, 0xd0, 0x76, 0x73, 0xf1, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x72, 0x21, 0x84, 0x52, 0xce, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x72, 0xff, 0xde, 0xdb, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xa5, 0xda, 0xff, 0x23, 0x14, 0xff, 0x12, 0xd3, 0xff, 0x12, 0xd3, 0xff, 0x12, 0xd3, 0xff, 0x1a, 0xd3, 0xff, 0x1a, 0xb2, 0xff, 0x1a, 0xb2, 0xff, 0x22, 0xf3, 0xff, 0xb6, 0x1a, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7e, 0xff, 0x7c, 0x11, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xd0, 0xff, 0x73, 0xd0, 0xff, 0x6b, 0xb0, 0xcc, 0x6b, 0xd0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x32, 0x17, 0x84, 0x52, 0xe5, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x94, 0xd4, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xdf, 0x1d, 0xff, 0x85, 0x18, 0xff, 0x43, 0xb5, 0xff, 0x22, 0xf3, 0xff, 0x22, 0xf3, 0xff, 0x43, 0xb4, 0xff, 0x85, 0x38, 0xff, 0xef, 0x5e, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x94, 0xd4, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xd0, 0xff, 0x73, 0xd0, 0xff, 0x6b, 0xd0, 0xe8, 0x73, 0xd0, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x52, 0x55, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x32, 0xff, 0xa5, 0x35, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x7d, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xa5, 0x36, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xd0, 0xff, 0x73, 0xd0, 0xff, 0x73, 0xd0, 0xff, 0x73, 0xd0, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xd3, 0x05, 0x84, 0x52, 0xe6, 0x84, 0x52, 0xff, 0x84, 0x52, 0xff, 0x84, 0x32, 0xff, 0x84, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x94, 0xf4, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x7d, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7e, 0xff, 0x94, 0xd4, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xd0, 0xff, 0x73, 0xd0, 0xff, 0x73, 0xd0, 0xff, 0x73, 0xd0, 0xe6, 0x84, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x52, 0xa4, 0x84, 0x52, 0xff, 0x84, 0x32, 0xff, 0x84, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x84, 0x32, 0xff, 0xb5, 0xb7, 0xff, 0xe7, 0x1c, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0xbe, 0xff, 0xf7, 0xbe, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xef, 0x5d, 0xff, 0xb5, 0xb7, 0xff, 0x7c, 0x11, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xd0, 0xff, 0x73, 0xd0, 0xff, 0x73, 0xd0, 0xff, 0x6b, 0xd0, 0xff, 0x6b, 0xb0, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x52, 0x8a, 0x84, 0x32, 0xff, 0x84, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x31, 0xff, 0x7c, 0x31, 0xff, 0x8c, 0xb3, 0xff, 0xa5, 0x56, 0xff, 0xb5, 0xb7, 0xff, 0xb5, 0xb7, 0xff, 0xa5, 0x76, 0xff, 0x8c, 0x93, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xd0, 0xff, 0x73, 0xd0, 0xff, 0x73, 0xd0, 0xff, 0x6b, 0xd0, 0xff, 0x6b, 0xd0, 0xff, 0x6b, 0xb0, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x32, 0x95, 0x84, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x31, 0xff, 0x7c, 0x31, 0xff, 0x7c, 0x11, 0xff, 0x7c, 0x11, 0xff, 0x7c, 0x11, 0xff, 0x7c, 0x11, 0xff, 0x74, 0x11, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xd0, 0xff, 0x73, 0xd0, 0xff, 0x73, 0xd0, 0xff, 0x6b, 0xd0, 0xff, 0x6b, 0xd0, 0xff, 0x6b, 0xb0, 0xff, 0x6b, 0xb0, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x32, 0xc3, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x31, 0xff, 0x7c, 0x31, 0xff, 0x7c, 0x11, 0xff, 0x7c, 0x11, 0xff, 0x7c, 0x11, 0xff, 0x7c, 0x11, 0xff, 0x74, 0x11, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xd0, 0xff, 0x73, 0xd0, 0xff, 0x73, 0xd0, 0xff, 0x6b, 0xd0, 0xff, 0x6b, 0xd0, 0xff, 0x6b, 0xb0, 0xff, 0x6b, 0xb0, 0xff, 0x6b, 0xb0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x52, 0x22, 0x7c, 0x32, 0xfb, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x31, 0xff, 0x7c, 0x31, 0xff, 0x7c, 0x11, 0xff, 0x7c, 0x11, 0xff, 0x7c, 0x11, 0xff, 0x7c, 0x11, 0xff, 0x74, 0x11, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xd0, 0xff, 0x73, 0xd0, 0xff, 0x73, 0xd0, 0xff, 0x6b, 0xd0, 0xff, 0x6b, 0xd0, 0xff, 0x6b, 0xb0, 0xff, 0x6b, 0xb0, 0xff, 0x6b, 0xb0, 0xff, 0x6b, 0xb0, 0xfc, 0x63, 0x90, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x32, 0x76, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x31, 0xff, 0x7c, 0x31, 0xff, 0x7c, 0x11, 0xff, 0x7c, 0x11, 0xff, 0x7c, 0x11, 0xff, 0x7c, 0x11, 0xff, 0x74, 0x11, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xf1, 0xff, 0x73, 0xd0, 0xff, 0x73, 0xd0, 0xff, 0x73, 0xd0, 0xff, 0x6b, 0xd0, 0xff, 0x6b, 0xd0, 0xff, 0x6b, 0xb0, 0xff, 0x6b, 0xb0, 0xff, 0x6b, 0xb0, 0xff, 0x6b, 0xb0, 0xff, 0x6b, 0xb0, 0xff, 0x63, 0x8f, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x75, 0x03, 0x7c, 0x31, 0x8d, 0x7c, 0x32, 0xff, 0x7c, 0x32, 0xff, 0x7c, 0x31, 0xff, 0x7c, 0x31, 0xff, 0x7c, 0x11, 0xff, 0x7c, 0x11, 0xff, 0x7c, 0x11, 0xff, 0x7c, 0x11, 0xff, 0x74, 0x11, 0xee, 0x74, 0x11, 0x84, 0x73, 0xf1, 0x37, 0x74, 0x10, 0x12, 0x74, 0x10, 0x12, 0x73, 0xd0, 0x37, 0x73, 0xd0, 0x85, 0x73, 0xd0, 0xee, 0x73, 0xd0, 0xff, 0x6b, 0xd0, 0xff, 0x6b, 0xd0, 0xff, 0x6b, 0xb0, 0xff, 0x6b, 0xb0, 0xff, 0x6b, 0xb0, 0xff, 0x6b, 0xb0, 0xff, 0x6b, 0xb0, 0xff, 0x63, 0x90, 0x8d, 0x5a, 0xab, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x31, 0x4f, 0x7c, 0x11, 0xe8, 0x7c, 0x31, 0xff, 0x7c, 0x11, 0xff, 0x7c, 0x11, 0xff, 0x7c, 0x11, 0xff, 0x7c, 0x11, 0xff, 0x74, 0x11, 0xb6, 0x7b, 0xd1, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0xd1, 0x0f, 0x6b, 0xd0, 0xb7, 0x6b, 0xd0, 0xff, 0x6b, 0xb0, 0xff, 0x6b, 0xb0, 0xff, 0x6b, 0xb0, 0xff, 0x6b, 0xb0, 0xff, 0x6b, 0x90, 0xe7, 0x6b, 0x8f, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x51, 0x13, 0x7c, 0x11, 0x8d, 0x7c, 0x11, 0xf7, 0x7c, 0x11, 0xff, 0x7c, 0x11, 0xff, 0x73, 0xf1, 0xaf, 0x5a, 0xb5, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x10, 0x04, 0x6b, 0xb0, 0xb1, 0x6b, 0xb0, 0xff, 0x6b, 0xb0, 0xff, 0x6b, 0xb0, 0xf7, 0x6b, 0xb0, 0x8c, 0x63, 0x90, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x11, 0x1a, 0x73, 0xf1, 0x7e, 0x73, 0xf1, 0xcd, 0x7c, 0x11, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x8f, 0x17, 0x6b, 0xb0, 0xce, 0x6b, 0xb0, 0x7f, 0x63, 0xd0, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-#if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x02, 0xaa, 0x7f, 0x7f, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x06, 0x7f, 0x7f, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x8e, 0x84, 0x1b, 0x96, 0x8e, 0x86, 0x85, 0x94, 0x8d, 0x85, 0xe1, 0x94, 0x8c, 0x87, 0xb2, 0xaa, 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x03, 0x91, 0x8c, 0x83, 0xb3, 0x93, 0x8a, 0x82, 0xe1, 0x93, 0x89, 0x81, 0x84, 0x93, 0x89, 0x7f, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0x8e, 0x7f, 0x12, 0x95, 0x8e, 0x86, 0x93, 0x94, 0x8e, 0x86, 0xf7, 0x95, 0x8e, 0x86, 0xff, 0x95, 0x8e, 0x86, 0xff, 0x95, 0x8d, 0x85, 0xff, 0x95, 0x8d, 0x85, 0xae, 0x9c, 0x8e, 0x7f, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x86, 0x86, 0x13, 0x92, 0x8b, 0x82, 0xb0, 0x93, 0x8a, 0x82, 0xff, 0x92, 0x8a, 0x81, 0xff, 0x92, 0x89, 0x81, 0xff, 0x90, 0x89, 0x80, 0xf7, 0x8f, 0x88, 0x7f, 0x92, 0x96, 0x87, 0x78, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x8f, 0x86, 0x54, 0x95, 0x8d, 0x86, 0xe8, 0x95, 0x8e, 0x86, 0xff, 0x95, 0x8e, 0x86, 0xff, 0x95, 0x8e, 0x86, 0xff, 0x95, 0x8d, 0x85, 0xff, 0x95, 0x8d, 0x85, 0xff, 0x95, 0x8d, 0x85, 0xff, 0x95, 0x8c, 0x84, 0xe8, 0x95, 0x8d, 0x85, 0x84, 0x94, 0x8a, 0x85, 0x32, 0x8f, 0x8f, 0x7f, 0x10, 0x8f, 0x8f, 0x7f, 0x10, 0x96, 0x8c, 0x82, 0x33, 0x94, 0x8a, 0x82, 0x85, 0x93, 0x8a, 0x82, 0xe8, 0x93, 0x8a, 0x82, 0xff, 0x92, 0x8a, 0x81, 0xff, 0x92, 0x89, 0x81, 0xff, 0x91, 0x89, 0x80, 0xff, 0x91, 0x89, 0x80, 0xff, 0x90, 0x88, 0x7f, 0xff, 0x8f, 0x88, 0x80, 0xe8, 0x90, 0x87, 0x7e, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x03, 0x96, 0x8e, 0x85, 0x88, 0x96, 0x8e, 0x86, 0xff, 0x95, 0x8e, 0x86, 0xff, 0x95, 0x8e, 0x86, 0xff, 0x95, 0x8e, 0x86, 0xff, 0x95, 0x8d, 0x85, 0xff, 0x95, 0x8d, 0x85, 0xff, 0x95, 0x8d, 0x85, 0xff, 0x95, 0x8d, 0x85, 0xff, 0x94, 0x8d, 0x85, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x93, 0x8b, 0x83, 0xff, 0x93, 0x8b, 0x83, 0xff, 0x93, 0x8a, 0x82, 0xff, 0x92, 0x8a, 0x81, 0xff, 0x92, 0x89, 0x81, 0xff, 0x91, 0x89, 0x80, 0xff, 0x91, 0x89, 0x80, 0xff, 0x90, 0x88, 0x7f, 0xff, 0x90, 0x88, 0x7f, 0xff, 0x90, 0x87, 0x7e, 0xff, 0x8f, 0x87, 0x7e, 0xff, 0x8f, 0x85, 0x7d, 0x99, 0x99, 0x99, 0x66, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x8e, 0x84, 0x1b, 0x96, 0x8e, 0x86, 0xfd, 0x95, 0x8e, 0x86, 0xff, 0x95, 0x8e, 0x86, 0xff, 0x95, 0x8e, 0x86, 0xff, 0x95, 0x8d, 0x85, 0xff, 0x95, 0x8d, 0x85, 0xff, 0x95, 0x8d, 0x85, 0xff, 0x95, 0x8d, 0x85, 0xff, 0x94, 0x8d, 0x85, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x93, 0x8b, 0x83, 0xff, 0x93, 0x8b, 0x83, 0xff, 0x93, 0x8a, 0x82, 0xff, 0x92, 0x8a, 0x81, 0xff, 0x92, 0x89, 0x81, 0xff, 0x91, 0x89, 0x80, 0xff, 0x91, 0x89, 0x80, 0xff, 0x90, 0x88, 0x7f, 0xff, 0x90, 0x88, 0x7f, 0xff, 0x90, 0x87, 0x7e, 0xff, 0x8f, 0x87, 0x7e, 0xff, 0x8f, 0x86, 0x7d, 0xff, 0x8d, 0x85, 0x7d, 0xfc, 0x8e, 0x84, 0x7b, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x8e, 0x86, 0xbf, 0x95, 0x8e, 0x86, 0xff, 0x95, 0x8e, 0x86, 0xff, 0x95, 0x8d, 0x85, 0xff, 0x95, 0x8d, 0x85, 0xff, 0x95, 0x8d, 0x85, 0xff, 0x95, 0x8d, 0x85, 0xff, 0x94, 0x8d, 0x85, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x93, 0x8b, 0x83, 0xff, 0x93, 0x8b, 0x83, 0xff, 0x93, 0x8a, 0x82, 0xff, 0x92, 0x8a, 0x81, 0xff, 0x92, 0x89, 0x81, 0xff, 0x91, 0x89, 0x80, 0xff, 0x91, 0x89, 0x80, 0xff, 0x90, 0x88, 0x7f, 0xff, 0x90, 0x88, 0x7f, 0xff, 0x90, 0x87, 0x7e, 0xff, 0x8f, 0x87, 0x7e, 0xff, 0x8f, 0x86, 0x7d, 0xff, 0x8e, 0x86, 0x7d, 0xff, 0x8e, 0x86, 0x7c, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x8e, 0x85, 0x95, 0x95, 0x8e, 0x86, 0xff, 0x95, 0x8d, 0x85, 0xff, 0x95, 0x8d, 0x85, 0xff, 0x95, 0x8d, 0x85, 0xff, 0x95, 0x8d, 0x85, 0xff, 0x94, 0x8d, 0x85, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x93, 0x8b, 0x83, 0xff, 0x93, 0x8b, 0x83, 0xff, 0x93, 0x8a, 0x82, 0xff, 0x92, 0x8a, 0x81, 0xff, 0x92, 0x89, 0x81, 0xff, 0x91, 0x89, 0x80, 0xff, 0x91, 0x89, 0x80, 0xff, 0x90, 0x88, 0x7f, 0xff, 0x90, 0x88, 0x7f, 0xff, 0x90, 0x87, 0x7e, 0xff, 0x8f, 0x87, 0x7e, 0xff, 0x8f, 0x86, 0x7d, 0xff, 0x8e, 0x86, 0x7d, 0xff, 0x8e, 0x85, 0x7c, 0xff, 0x8d, 0x85, 0x7c, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x8e, 0x86, 0x87, 0x95, 0x8d, 0x85, 0xff, 0x95, 0x8d, 0x85, 0xff, 0x95, 0x8d, 0x85, 0xff, 0x95, 0x8d, 0x85, 0xff, 0x94, 0x8d, 0x85, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x93, 0x8b, 0x83, 0xff, 0x93, 0x8b, 0x83, 0xff, 0x93, 0x8a, 0x82, 0xff, 0x92, 0x8a, 0x81, 0xff, 0x92, 0x89, 0x81, 0xff, 0x91, 0x89, 0x80, 0xff, 0x91, 0x89, 0x80, 0xff, 0x90, 0x88, 0x7f, 0xff, 0x90, 0x88, 0x7f, 0xff, 0x90, 0x87, 0x7e, 0xff, 0x8f, 0x87, 0x7e, 0xff, 0x8f, 0x86, 0x7d, 0xff, 0x8e, 0x86, 0x7d, 0xff, 0x8e, 0x85, 0x7c, 0xff, 0x8e, 0x85, 0x7c, 0xff, 0x8e, 0x84, 0x7b, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x8c, 0x83, 0xa7, 0x95, 0x8d, 0x85, 0xff, 0x95, 0x8d, 0x85, 0xff, 0x95, 0x8d, 0x85, 0xff, 0x94, 0x8d, 0x85, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x93, 0x8b, 0x83, 0xff, 0x9e, 0x97, 0x90, 0xff, 0xaa, 0xa4, 0x9f, 0xff, 0xb0, 0xab, 0xa6, 0xff, 0xb1, 0xac, 0xa7, 0xff, 0xaa, 0xa5, 0x9f, 0xff, 0x9e, 0x97, 0x8f, 0xff, 0x90, 0x88, 0x7f, 0xff, 0x90, 0x88, 0x7f, 0xff, 0x90, 0x87, 0x7e, 0xff, 0x8f, 0x87, 0x7e, 0xff, 0x8f, 0x86, 0x7d, 0xff, 0x8e, 0x86, 0x7d, 0xff, 0x8e, 0x85, 0x7c, 0xff, 0x8e, 0x85, 0x7c, 0xff, 0x8d, 0x84, 0x7b, 0xff, 0x8d, 0x83, 0x7a, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x04, 0x94, 0x8c, 0x85, 0xe4, 0x95, 0x8d, 0x85, 0xff, 0x95, 0x8d, 0x85, 0xff, 0x94, 0x8d, 0x85, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x95, 0x8e, 0x86, 0xff, 0xaf, 0xaa, 0xa6, 0xff, 0xc8, 0xc7, 0xc6, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd2, 0xd1, 0xcf, 0xff, 0xb3, 0xae, 0xa9, 0xff, 0x92, 0x8a, 0x81, 0xff, 0x8f, 0x86, 0x7d, 0xff, 0x8e, 0x86, 0x7d, 0xff, 0x8e, 0x85, 0x7c, 0xff, 0x8e, 0x85, 0x7c, 0xff, 0x8d, 0x84, 0x7b, 0xff, 0x8d, 0x84, 0x7a, 0xff, 0x8c, 0x85, 0x7a, 0xe3, 0x7f, 0x7f, 0x7f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x8d, 0x84, 0x55, 0x95, 0x8d, 0x85, 0xff, 0x95, 0x8d, 0x85, 0xff, 0x94, 0x8d, 0x85, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0xa1, 0x9b, 0x95, 0xff, 0xc8, 0xc7, 0xc6, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xda, 0xda, 0xda, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xd7, 0xd6, 0xd5, 0xff, 0xa1, 0x9b, 0x94, 0xff, 0x8e, 0x85, 0x7c, 0xff, 0x8e, 0x85, 0x7c, 0xff, 0x8d, 0x84, 0x7b, 0xff, 0x8d, 0x84, 0x7a, 0xff, 0x8c, 0x84, 0x7a, 0xff, 0x8c, 0x83, 0x79, 0xff, 0x8d, 0x84, 0x78, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x8f, 0x85, 0x19, 0x95, 0x8d, 0x84, 0xe7, 0x95, 0x8d, 0x85, 0xff, 0x94, 0x8d, 0x85, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0xa7, 0xa2, 0x9c, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xda, 0xda, 0xda, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xaa, 0xa4, 0x9e, 0xff, 0x8d, 0x84, 0x7b, 0xff, 0x8d, 0x84, 0x7a, 0xff, 0x8c, 0x84, 0x7a, 0xff, 0x8c, 0x83, 0x79, 0xff, 0x8c, 0x83, 0x79, 0xff, 0x8b, 0x82, 0x78, 0xe7, 0x8f, 0x85, 0x7a, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x8b, 0x83, 0x21, 0x95, 0x8c, 0x85, 0xcf, 0x95, 0x8d, 0x85, 0xff, 0x94, 0x8d, 0x85, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0xa1, 0x9b, 0x95, 0xff, 0xcd, 0xcd, 0xcd, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd2, 0xcc, 0xc5, 0xff, 0xbe, 0x9a, 0x6f, 0xff, 0xb0, 0x77, 0x34, 0xff, 0xa7, 0x65, 0x16, 0xff, 0xa7, 0x64, 0x16, 0xff, 0xae, 0x77, 0x35, 0xff, 0xc0, 0x9c, 0x73, 0xff, 0xdc, 0xd6, 0xcf, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xa1, 0x9a, 0x92, 0xff, 0x8c, 0x84, 0x7a, 0xff, 0x8c, 0x83, 0x79, 0xff, 0x8c, 0x83, 0x79, 0xff, 0x8b, 0x82, 0x78, 0xff, 0x8b, 0x82, 0x78, 0xff, 0x89, 0x7f, 0x76, 0xce, 0x8b, 0x83, 0x74, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x90, 0x85, 0x17, 0x95, 0x8d, 0x85, 0x7b, 0x95, 0x8c, 0x85, 0xef, 0x95, 0x8d, 0x85, 0xff, 0x94, 0x8d, 0x85, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x95, 0x8e, 0x86, 0xff, 0xc8, 0xc7, 0xc6, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xc7, 0xaf, 0x93, 0xff, 0xa9, 0x66, 0x17, 0xff, 0xa6, 0x60, 0x0e, 0xff, 0xa5, 0x60, 0x0e, 0xff, 0xa5, 0x5f, 0x0e, 0xff, 0xa4, 0x5f, 0x0e, 0xff, 0xa3, 0x5e, 0x0e, 0xff, 0xa1, 0x5e, 0x0f, 0xff, 0xa4, 0x64, 0x1a, 0xff, 0xcd, 0xb7, 0x9e, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xdf, 0xde, 0xdc, 0xff, 0x8e, 0x85, 0x7c, 0xff, 0x8c, 0x83, 0x79, 0xff, 0x8b, 0x82, 0x78, 0xff, 0x8b, 0x82, 0x78, 0xff, 0x8a, 0x81, 0x77, 0xff, 0x89, 0x80, 0x76, 0xff, 0x89, 0x7f, 0x74, 0xee, 0x88, 0x7d, 0x73, 0x7a, 0x85, 0x7a, 0x6f, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x8d, 0x85, 0x60, 0x94, 0x8d, 0x85, 0xe2, 0x94, 0x8c, 0x84, 0xfe, 0x95, 0x8d, 0x85, 0xff, 0x95, 0x8d, 0x85, 0xff, 0x94, 0x8d, 0x85, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0xaf, 0xaa, 0xa6, 0xff, 0xd1, 0xd1, 0xd1, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xc7, 0xaf, 0x93, 0xff, 0xa7, 0x61, 0x0e, 0xff, 0xa6, 0x60, 0x0e, 0xff, 0xa5, 0x60, 0x0e, 0xff, 0xa5, 0x5f, 0x0e, 0xff, 0xa4, 0x5f, 0x0e, 0xff, 0xa3, 0x5e, 0x0e, 0xff, 0xa1, 0x5e, 0x0f, 0xff, 0xa0, 0x5d, 0x0f, 0xff, 0x9f, 0x5c, 0x10, 0xff, 0x9d, 0x5c, 0x11, 0xff, 0xce, 0xb9, 0xa1, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xea, 0xea, 0xea, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xb8, 0xb3, 0xad, 0xff, 0x8b, 0x82, 0x78, 0xff, 0x8b, 0x82, 0x78, 0xff, 0x8a, 0x81, 0x77, 0xff, 0x89, 0x80, 0x76, 0xff, 0x89, 0x7f, 0x75, 0xff, 0x88, 0x7e, 0x74, 0xff, 0x87, 0x7e, 0x73, 0xff, 0x86, 0x7d, 0x72, 0xfe, 0x86, 0x7c, 0x70, 0xe2, 0x85, 0x7a, 0x70, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x8d, 0x86, 0xa4, 0x95, 0x8d, 0x85, 0xff, 0x95, 0x8d, 0x85, 0xff, 0x95, 0x8d, 0x85, 0xff, 0x94, 0x8d, 0x85, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x93, 0x8b, 0x83, 0xff, 0xc9, 0xc8, 0xc6, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd2, 0xcc, 0xc5, 0xff, 0xa9, 0x66, 0x17, 0xff, 0xa6, 0x60, 0x0e, 0xff, 0xa5, 0x60, 0x0e, 0xff, 0xa5, 0x5f, 0x0e, 0xff, 0xa4, 0x5f, 0x0e, 0xff, 0xa3, 0x5e, 0x0e, 0xff, 0xa1, 0x5e, 0x0f, 0xff, 0xa0, 0x5d, 0x0f, 0xff, 0x9f, 0x5c, 0x10, 0xff, 0x9d, 0x5b, 0x10, 0xff, 0x9c, 0x5a, 0x11, 0xff, 0x9f, 0x61, 0x1e, 0xff, 0xe4, 0xde, 0xd8, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xed, 0xed, 0xed, 0xff, 0xe1, 0xdf, 0xde, 0xff, 0x8b, 0x82, 0x78, 0xff, 0x8a, 0x81, 0x77, 0xff, 0x89, 0x80, 0x76, 0xff, 0x89, 0x7f, 0x75, 0xff, 0x88, 0x7e, 0x74, 0xff, 0x87, 0x7e, 0x73, 0xff, 0x87, 0x7d, 0x72, 0xff, 0x86, 0x7c, 0x71, 0xff, 0x85, 0x7b, 0x70, 0xff, 0x83, 0x7c, 0x6f, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x8e, 0x84, 0xd1, 0x95, 0x8d, 0x85, 0xff, 0x95, 0x8d, 0x85, 0xff, 0x94, 0x8d, 0x85, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x93, 0x8b, 0x83, 0xff, 0x9e, 0x97, 0x90, 0xff, 0xd3, 0xd3, 0xd3, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xbe, 0x9a, 0x6f, 0xff, 0xa6, 0x60, 0x0e, 0xff, 0xa5, 0x60, 0x0e, 0xff, 0xa5, 0x5f, 0x0e, 0xff, 0xa4, 0x5f, 0x0e, 0xff, 0xa3, 0x5e, 0x0e, 0xff, 0xa1, 0x5e, 0x0f, 0xff, 0xa0, 0x5d, 0x0f, 0xff, 0x9f, 0x5c, 0x10, 0xff, 0x9d, 0x5b, 0x10, 0xff, 0x9c, 0x5a, 0x11, 0xff, 0x9a, 0x59, 0x12, 0xff, 0x99, 0x59, 0x12, 0xff, 0xc0, 0xa0, 0x7d, 0xff, 0xed, 0xed, 0xed, 0xff, 0xef, 0xef, 0xef, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0x9b, 0x94, 0x8b, 0xff, 0x89, 0x80, 0x76, 0xff, 0x89, 0x7f, 0x75, 0xff, 0x88, 0x7e, 0x74, 0xff, 0x87, 0x7e, 0x73, 0xff, 0x87, 0x7d, 0x72, 0xff, 0x86, 0x7c, 0x71, 0xff, 0x85, 0x7b, 0x70, 0xff, 0x84, 0x7b, 0x6f, 0xff, 0x83, 0x7a, 0x6d, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x8c, 0x84, 0xe8, 0x95, 0x8d, 0x85, 0xff, 0x94, 0x8d, 0x85, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x93, 0x8b, 0x83, 0xff, 0x93, 0x8b, 0x83, 0xff, 0xaa, 0xa4, 0x9f, 0xff, 0xd4, 0xd4, 0xd4, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xaf, 0x76, 0x33, 0xff, 0xa5, 0x60, 0x0e, 0xff, 0xa5, 0x5f, 0x0e, 0xff, 0xa4, 0x5f, 0x0e, 0xff, 0xa3, 0x5e, 0x0e, 0xff, 0xa1, 0x5e, 0x0f, 0xff, 0xa0, 0x5d, 0x0f, 0xff, 0x9f, 0x5c, 0x10, 0xff, 0x9d, 0x5b, 0x10, 0xff, 0x9c, 0x5a, 0x11, 0xff, 0x9a, 0x59, 0x12, 0xff, 0x99, 0x59, 0x12, 0xff, 0x97, 0x58, 0x13, 0xff, 0xa7, 0x74, 0x3d, 0xff, 0xef, 0xef, 0xef, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xae, 0xa8, 0xa2, 0xff, 0x89, 0x7f, 0x75, 0xff, 0x88, 0x7e, 0x74, 0xff, 0x87, 0x7e, 0x73, 0xff, 0x87, 0x7d, 0x72, 0xff, 0x86, 0x7c, 0x71, 0xff, 0x85, 0x7b, 0x70, 0xff, 0x84, 0x7b, 0x6f, 0xff, 0x84, 0x7a, 0x6e, 0xff, 0x83, 0x79, 0x6d, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x8c, 0x84, 0xf8, 0x94, 0x8d, 0x85, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x93, 0x8b, 0x83, 0xff, 0x93, 0x8b, 0x83, 0xff, 0x93, 0x8a, 0x82, 0xff, 0xb0, 0xab, 0xa6, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xa7, 0x65, 0x17, 0xff, 0xa5, 0x5f, 0x0e, 0xff, 0xa4, 0x5f, 0x0e, 0xff, 0xa3, 0x5e, 0x0e, 0xff, 0xa1, 0x5e, 0x0f, 0xff, 0xa0, 0x5d, 0x0f, 0xff, 0x9f, 0x5c, 0x10, 0xff, 0x9d, 0x5b, 0x10, 0xff, 0x9c, 0x5a, 0x11, 0xff, 0x9a, 0x59, 0x12, 0xff, 0x99, 0x59, 0x12, 0xff, 0x97, 0x58, 0x13, 0xff, 0x96, 0x57, 0x13, 0xff, 0x98, 0x5e, 0x1f, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xb9, 0xb4, 0xae, 0xff, 0x88, 0x7e, 0x74, 0xff, 0x87, 0x7e, 0x73, 0xff, 0x87, 0x7d, 0x72, 0xff, 0x86, 0x7c, 0x71, 0xff, 0x85, 0x7b, 0x70, 0xff, 0x84, 0x7b, 0x6f, 0xff, 0x84, 0x7a, 0x6e, 0xff, 0x83, 0x79, 0x6d, 0xff, 0x81, 0x78, 0x6b, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x8d, 0x85, 0xf9, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x93, 0x8b, 0x83, 0xff, 0x93, 0x8b, 0x83, 0xff, 0x93, 0x8a, 0x82, 0xff, 0x92, 0x8a, 0x81, 0xff, 0xb1, 0xac, 0xa8, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xda, 0xda, 0xda, 0xff, 0xa8, 0x65, 0x18, 0xff, 0xa4, 0x5f, 0x0e, 0xff, 0xa3, 0x5e, 0x0e, 0xff, 0xa1, 0x5e, 0x0f, 0xff, 0xa0, 0x5d, 0x0f, 0xff, 0x9f, 0x5c, 0x10, 0xff, 0x9d, 0x5b, 0x10, 0xff, 0x9c, 0x5a, 0x11, 0xff, 0x9a, 0x59, 0x12, 0xff, 0x99, 0x59, 0x12, 0xff, 0x97, 0x58, 0x13, 0xff, 0x96, 0x57, 0x13, 0xff, 0x94, 0x56, 0x14, 0xff, 0x97, 0x5d, 0x20, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xb9, 0xb4, 0xae, 0xff, 0x87, 0x7e, 0x73, 0xff, 0x87, 0x7d, 0x72, 0xff, 0x86, 0x7c, 0x71, 0xff, 0x85, 0x7b, 0x70, 0xff, 0x84, 0x7b, 0x6f, 0xff, 0x84, 0x7a, 0x6e, 0xff, 0x83, 0x79, 0x6d, 0xff, 0x82, 0x78, 0x6c, 0xff, 0x81, 0x77, 0x6b, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x8c, 0x83, 0xec, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x93, 0x8b, 0x83, 0xff, 0x93, 0x8b, 0x83, 0xff, 0x93, 0x8a, 0x82, 0xff, 0x92, 0x8a, 0x81, 0xff, 0x92, 0x89, 0x81, 0xff, 0xaa, 0xa5, 0x9f, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xda, 0xda, 0xda, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xaf, 0x77, 0x35, 0xff, 0xa3, 0x5e, 0x0e, 0xff, 0xa1, 0x5e, 0x0f, 0xff, 0xa0, 0x5d, 0x0f, 0xff, 0x9f, 0x5c, 0x10, 0xff, 0x9d, 0x5b, 0x10, 0xff, 0x9c, 0x5a, 0x11, 0xff, 0x9a, 0x59, 0x12, 0xff, 0x99, 0x59, 0x12, 0xff, 0x97, 0x58, 0x13, 0xff, 0x96, 0x57, 0x13, 0xff, 0x94, 0x56, 0x14, 0xff, 0x92, 0x55, 0x14, 0xff, 0xa3, 0x73, 0x40, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xaf, 0xa9, 0xa2, 0xff, 0x87, 0x7d, 0x72, 0xff, 0x86, 0x7c, 0x71, 0xff, 0x85, 0x7b, 0x70, 0xff, 0x84, 0x7b, 0x6f, 0xff, 0x84, 0x7a, 0x6e, 0xff, 0x83, 0x79, 0x6d, 0xff, 0x82, 0x78, 0x6c, 0xff, 0x82, 0x77, 0x6c, 0xff, 0x81, 0x77, 0x6b, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x8c, 0x83, 0xd1, 0x94, 0x8c, 0x84, 0xff, 0x94, 0x8c, 0x84, 0xff, 0x93, 0x8b, 0x83, 0xff, 0x93, 0x8b, 0x83, 0xff, 0x93, 0x8a, 0x82, 0xff, 0x92, 0x8a, 0x81, 0xff, 0x92, 0x89, 0x81, 0xff, 0x91, 0x89, 0x80, 0xff, 0x9e, 0x97, 0x8f, 0xff, 0xda, 0xda, 0xda, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xc0, 0x9c, 0x73, 0xff, 0xa1, 0x5e, 0x0f, 0xff, 0xa0, 0x5d, 0x0f, 0xff, 0x9f, 0x5c, 0x10, 0xff, 0x9d, 0x5b, 0x10, 0xff, 0x9c, 0x5a, 0x11, 0xff, 0x9a, 0x59, 0x12, 0xff, 0x99, 0x59, 0x12, 0xff, 0x97, 0x58, 0x13, 0xff, 0x96, 0x57, 0x13, 0xff, 0x94, 0x56, 0x14, 0xff, 0x92, 0x55, 0x14, 0xff, 0x90, 0x54, 0x15, 0xff, 0xc0, 0xa2, 0x83, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0x99, 0x91, 0x88, 0xff, 0x86, 0x7c, 0x71, 0xff, 0x85, 0x7b, 0x70, 0xff, 0x84, 0x7b, 0x6f, 0xff, 0x84, 0x7a, 0x6e, 0xff, 0x83, 0x79, 0x6d, 0xff, 0x82, 0x78, 0x6c, 0xff, 0x82, 0x77, 0x6c, 0xff, 0x81, 0x77, 0x6b, 0xff, 0x7f, 0x74, 0x69, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x8c, 0x83, 0x8a, 0x93, 0x8c, 0x84, 0xe0, 0x93, 0x8b, 0x83, 0xfb, 0x93, 0x8b, 0x83, 0xff, 0x93, 0x8a, 0x82, 0xff, 0x92, 0x8a, 0x81, 0xff, 0x92, 0x89, 0x81, 0xff, 0x91, 0x89, 0x80, 0xff, 0x91, 0x89, 0x80, 0xff, 0x90, 0x88, 0x7f, 0xff, 0xd1, 0xd0, 0xcf, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xdc, 0xd6, 0xcf, 0xff, 0xa4, 0x64, 0x1a, 0xff, 0x9f, 0x5c, 0x10, 0xff, 0x9d, 0x5b, 0x10, 0xff, 0x9c, 0x5a, 0x11, 0xff, 0x9a, 0x59, 0x12, 0xff, 0x99, 0x59, 0x12, 0xff, 0x97, 0x58, 0x13, 0xff, 0x96, 0x57, 0x13, 0xff, 0x94, 0x56, 0x14, 0xff, 0x92, 0x55, 0x14, 0xff, 0x90, 0x54, 0x15, 0xff, 0x94, 0x5c, 0x22, 0xff, 0xed, 0xe8, 0xe4, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xe9, 0xe8, 0xe6, 0xff, 0x86, 0x7c, 0x71, 0xff, 0x85, 0x7b, 0x70, 0xff, 0x84, 0x7b, 0x6f, 0xff, 0x84, 0x7a, 0x6e, 0xff, 0x83, 0x79, 0x6d, 0xff, 0x82, 0x78, 0x6c, 0xff, 0x82, 0x77, 0x6c, 0xff, 0x81, 0x76, 0x6a, 0xfb, 0x7f, 0x76, 0x69, 0xe0, 0x7f, 0x74, 0x69, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x90, 0x85, 0x17, 0x94, 0x89, 0x83, 0x77, 0x92, 0x89, 0x81, 0xef, 0x92, 0x89, 0x81, 0xff, 0x91, 0x89, 0x80, 0xff, 0x91, 0x89, 0x80, 0xff, 0x90, 0x88, 0x7f, 0xff, 0x90, 0x88, 0x7f, 0xff, 0xb3, 0xaf, 0xaa, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xcd, 0xb7, 0x9e, 0xff, 0x9d, 0x5c, 0x11, 0xff, 0x9c, 0x5a, 0x11, 0xff, 0x9a, 0x59, 0x12, 0xff, 0x99, 0x59, 0x12, 0xff, 0x97, 0x58, 0x13, 0xff, 0x96, 0x57, 0x13, 0xff, 0x94, 0x56, 0x14, 0xff, 0x92, 0x55, 0x14, 0xff, 0x90, 0x54, 0x15, 0xff, 0x8e, 0x54, 0x16, 0xff, 0xd3, 0xc0, 0xad, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xbb, 0xb5, 0xaf, 0xff, 0x85, 0x7b, 0x70, 0xff, 0x84, 0x7b, 0x6f, 0xff, 0x84, 0x7a, 0x6e, 0xff, 0x83, 0x79, 0x6d, 0xff, 0x82, 0x78, 0x6c, 0xff, 0x82, 0x77, 0x6b, 0xef, 0x82, 0x77, 0x6c, 0x76, 0x85, 0x7a, 0x6f, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x8b, 0x83, 0x21, 0x90, 0x89, 0x7f, 0xce, 0x91, 0x89, 0x80, 0xff, 0x90, 0x88, 0x7f, 0xff, 0x90, 0x88, 0x7f, 0xff, 0x90, 0x87, 0x7e, 0xff, 0x92, 0x8a, 0x81, 0xff, 0xd7, 0xd6, 0xd5, 0xff, 0xe2, 0xe2, 0xe2, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xce, 0xb9, 0xa1, 0xff, 0x9f, 0x61, 0x1e, 0xff, 0x99, 0x59, 0x12, 0xff, 0x97, 0x58, 0x13, 0xff, 0x96, 0x57, 0x13, 0xff, 0x94, 0x56, 0x14, 0xff, 0x92, 0x55, 0x14, 0xff, 0x90, 0x54, 0x15, 0xff, 0x94, 0x5c, 0x22, 0xff, 0xd3, 0xc0, 0xad, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xec, 0xeb, 0xea, 0xff, 0x88, 0x7f, 0x74, 0xff, 0x84, 0x7b, 0x6f, 0xff, 0x84, 0x7a, 0x6e, 0xff, 0x83, 0x79, 0x6d, 0xff, 0x82, 0x78, 0x6c, 0xff, 0x82, 0x75, 0x6b, 0xcc, 0x7f, 0x78, 0x68, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x85, 0x85, 0x17, 0x8f, 0x87, 0x7e, 0xe5, 0x90, 0x88, 0x7f, 0xff, 0x90, 0x87, 0x7e, 0xff, 0x8f, 0x87, 0x7e, 0xff, 0x8f, 0x86, 0x7d, 0xff, 0x9f, 0x98, 0x91, 0xff, 0xe1, 0xe1, 0xe0, 0xff, 0xe5, 0xe5, 0xe5, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xe4, 0xde, 0xd8, 0xff, 0xc0, 0xa0, 0x7d, 0xff, 0xa7, 0x74, 0x3d, 0xff, 0x98, 0x5d, 0x1e, 0xff, 0x96, 0x5c, 0x1e, 0xff, 0xa3, 0x73, 0x40, 0xff, 0xc0, 0xa2, 0x83, 0xff, 0xed, 0xe8, 0xe4, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0x9f, 0x97, 0x8f, 0xff, 0x84, 0x7b, 0x6f, 0xff, 0x84, 0x7a, 0x6e, 0xff, 0x83, 0x79, 0x6d, 0xff, 0x82, 0x78, 0x6c, 0xff, 0x81, 0x76, 0x6b, 0xe8, 0x7f, 0x76, 0x6c, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x87, 0x7e, 0x55, 0x90, 0x87, 0x7e, 0xff, 0x8f, 0x87, 0x7e, 0xff, 0x8f, 0x86, 0x7d, 0xff, 0x8e, 0x86, 0x7d, 0xff, 0x8e, 0x85, 0x7c, 0xff, 0xaa, 0xa4, 0x9e, 0xff, 0xe4, 0xe4, 0xe4, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xea, 0xea, 0xea, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xed, 0xed, 0xed, 0xff, 0xef, 0xef, 0xef, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xac, 0xa5, 0x9e, 0xff, 0x84, 0x7b, 0x6f, 0xff, 0x84, 0x7a, 0x6e, 0xff, 0x83, 0x79, 0x6d, 0xff, 0x82, 0x78, 0x6c, 0xff, 0x82, 0x77, 0x6c, 0xff, 0x81, 0x78, 0x6c, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0x66, 0x05, 0x8f, 0x87, 0x7e, 0xe6, 0x8f, 0x86, 0x7d, 0xff, 0x8e, 0x86, 0x7d, 0xff, 0x8e, 0x85, 0x7c, 0xff, 0x8e, 0x85, 0x7c, 0xff, 0x8d, 0x84, 0x7b, 0xff, 0xa1, 0x9a, 0x92, 0xff, 0xdf, 0xde, 0xdc, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xed, 0xed, 0xed, 0xff, 0xef, 0xef, 0xef, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xec, 0xeb, 0xea, 0xff, 0x9f, 0x97, 0x8e, 0xff, 0x84, 0x7b, 0x6f, 0xff, 0x84, 0x7a, 0x6e, 0xff, 0x83, 0x79, 0x6d, 0xff, 0x82, 0x78, 0x6c, 0xff, 0x82, 0x77, 0x6c, 0xff, 0x80, 0x76, 0x6c, 0xe6, 0x7f, 0x7f, 0x7f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x86, 0x7c, 0xa4, 0x8e, 0x86, 0x7d, 0xff, 0x8e, 0x85, 0x7c, 0xff, 0x8e, 0x85, 0x7c, 0xff, 0x8d, 0x84, 0x7b, 0xff, 0x8d, 0x84, 0x7a, 0xff, 0x8c, 0x84, 0x7a, 0xff, 0x8e, 0x85, 0x7c, 0xff, 0xb7, 0xb2, 0xad, 0xff, 0xe1, 0xdf, 0xde, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xea, 0xe8, 0xe7, 0xff, 0xbb, 0xb5, 0xaf, 0xff, 0x88, 0x7f, 0x74, 0xff, 0x84, 0x7b, 0x6f, 0xff, 0x84, 0x7a, 0x6e, 0xff, 0x83, 0x79, 0x6d, 0xff, 0x82, 0x78, 0x6c, 0xff, 0x82, 0x77, 0x6c, 0xff, 0x81, 0x77, 0x6b, 0xff, 0x80, 0x75, 0x6a, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x87, 0x7e, 0x8a, 0x8e, 0x85, 0x7c, 0xff, 0x8e, 0x85, 0x7c, 0xff, 0x8d, 0x84, 0x7b, 0xff, 0x8d, 0x84, 0x7a, 0xff, 0x8c, 0x84, 0x7a, 0xff, 0x8c, 0x83, 0x79, 0xff, 0x8c, 0x83, 0x79, 0xff, 0x8b, 0x82, 0x78, 0xff, 0x8b, 0x82, 0x78, 0xff, 0x9b, 0x93, 0x8b, 0xff, 0xaf, 0xa9, 0xa2, 0xff, 0xb9, 0xb4, 0xae, 0xff, 0xb9, 0xb3, 0xae, 0xff, 0xaf, 0xaa, 0xa2, 0xff, 0x99, 0x91, 0x88, 0xff, 0x86, 0x7c, 0x71, 0xff, 0x85, 0x7b, 0x70, 0xff, 0x84, 0x7b, 0x6f, 0xff, 0x84, 0x7a, 0x6e, 0xff, 0x83, 0x79, 0x6d, 0xff, 0x82, 0x78, 0x6c, 0xff, 0x82, 0x77, 0x6c, 0xff, 0x81, 0x77, 0x6b, 0xff, 0x80, 0x76, 0x6a, 0xff, 0x80, 0x75, 0x68, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x85, 0x7b, 0x95, 0x8e, 0x85, 0x7c, 0xff, 0x8d, 0x84, 0x7b, 0xff, 0x8d, 0x84, 0x7a, 0xff, 0x8c, 0x84, 0x7a, 0xff, 0x8c, 0x83, 0x79, 0xff, 0x8c, 0x83, 0x79, 0xff, 0x8b, 0x82, 0x78, 0xff, 0x8b, 0x82, 0x78, 0xff, 0x8a, 0x81, 0x77, 0xff, 0x89, 0x80, 0x76, 0xff, 0x89, 0x7f, 0x75, 0xff, 0x88, 0x7e, 0x74, 0xff, 0x87, 0x7e, 0x73, 0xff, 0x87, 0x7d, 0x72, 0xff, 0x86, 0x7c, 0x71, 0xff, 0x85, 0x7b, 0x70, 0xff, 0x84, 0x7b, 0x6f, 0xff, 0x84, 0x7a, 0x6e, 0xff, 0x83, 0x79, 0x6d, 0xff, 0x82, 0x78, 0x6c, 0xff, 0x82, 0x77, 0x6c, 0xff, 0x81, 0x77, 0x6b, 0xff, 0x80, 0x76, 0x6a, 0xff, 0x80, 0x75, 0x69, 0xff, 0x7f, 0x73, 0x69, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x85, 0x7c, 0xc3, 0x8d, 0x84, 0x7b, 0xff, 0x8d, 0x84, 0x7a, 0xff, 0x8c, 0x84, 0x7a, 0xff, 0x8c, 0x83, 0x79, 0xff, 0x8c, 0x83, 0x79, 0xff, 0x8b, 0x82, 0x78, 0xff, 0x8b, 0x82, 0x78, 0xff, 0x8a, 0x81, 0x77, 0xff, 0x89, 0x80, 0x76, 0xff, 0x89, 0x7f, 0x75, 0xff, 0x88, 0x7e, 0x74, 0xff, 0x87, 0x7e, 0x73, 0xff, 0x87, 0x7d, 0x72, 0xff, 0x86, 0x7c, 0x71, 0xff, 0x85, 0x7b, 0x70, 0xff, 0x84, 0x7b, 0x6f, 0xff, 0x84, 0x7a, 0x6e, 0xff, 0x83, 0x79, 0x6d, 0xff, 0x82, 0x78, 0x6c, 0xff, 0x82, 0x77, 0x6c, 0xff, 0x81, 0x77, 0x6b, 0xff, 0x80, 0x76, 0x6a, 0xff, 0x80, 0x75, 0x69, 0xff, 0x7f, 0x74, 0x68, 0xff, 0x7e, 0x74, 0x68, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x87, 0x7f, 0x22, 0x8d, 0x84, 0x7a, 0xfb, 0x8d, 0x84, 0x7a, 0xff, 0x8c, 0x84, 0x7a, 0xff, 0x8c, 0x83, 0x79, 0xff, 0x8c, 0x83, 0x79, 0xff, 0x8b, 0x82, 0x78, 0xff, 0x8b, 0x82, 0x78, 0xff, 0x8a, 0x81, 0x77, 0xff, 0x89, 0x80, 0x76, 0xff, 0x89, 0x7f, 0x75, 0xff, 0x88, 0x7e, 0x74, 0xff, 0x87, 0x7e, 0x73, 0xff, 0x87, 0x7d, 0x72, 0xff, 0x86, 0x7c, 0x71, 0xff, 0x85, 0x7b, 0x70, 0xff, 0x84, 0x7b, 0x6f, 0xff, 0x84, 0x7a, 0x6e, 0xff, 0x83, 0x79, 0x6d, 0xff, 0x82, 0x78, 0x6c, 0xff, 0x82, 0x77, 0x6c, 0xff, 0x81, 0x77, 0x6b, 0xff, 0x80, 0x76, 0x6a, 0xff, 0x80, 0x75, 0x69, 0xff, 0x7f, 0x74, 0x68, 0xff, 0x7e, 0x73, 0x67, 0xff, 0x7e, 0x73, 0x66, 0xfc, 0x7f, 0x71, 0x63, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x84, 0x7b, 0x76, 0x8d, 0x84, 0x7a, 0xff, 0x8c, 0x84, 0x7a, 0xff, 0x8c, 0x83, 0x79, 0xff, 0x8c, 0x83, 0x79, 0xff, 0x8b, 0x82, 0x78, 0xff, 0x8b, 0x82, 0x78, 0xff, 0x8a, 0x81, 0x77, 0xff, 0x89, 0x80, 0x76, 0xff, 0x89, 0x7f, 0x75, 0xff, 0x88, 0x7e, 0x74, 0xff, 0x87, 0x7e, 0x73, 0xff, 0x87, 0x7d, 0x72, 0xff, 0x86, 0x7c, 0x71, 0xff, 0x85, 0x7b, 0x70, 0xff, 0x84, 0x7b, 0x6f, 0xff, 0x84, 0x7a, 0x6e, 0xff, 0x83, 0x79, 0x6d, 0xff, 0x82, 0x78, 0x6c, 0xff, 0x82, 0x77, 0x6c, 0xff, 0x81, 0x77, 0x6b, 0xff, 0x80, 0x76, 0x6a, 0xff, 0x80, 0x75, 0x69, 0xff, 0x7f, 0x74, 0x68, 0xff, 0x7e, 0x73, 0x67, 0xff, 0x7e, 0x73, 0x66, 0xff, 0x7d, 0x72, 0x65, 0xff, 0x7b, 0x70, 0x63, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x55, 0x03, 0x8b, 0x84, 0x79, 0x8d, 0x8c, 0x83, 0x79, 0xff, 0x8c, 0x83, 0x79, 0xff, 0x8b, 0x82, 0x78, 0xff, 0x8b, 0x82, 0x78, 0xff, 0x8a, 0x81, 0x77, 0xff, 0x89, 0x80, 0x76, 0xff, 0x89, 0x7f, 0x75, 0xff, 0x88, 0x7e, 0x74, 0xff, 0x87, 0x7e, 0x72, 0xee, 0x87, 0x7e, 0x70, 0x84, 0x86, 0x7d, 0x6f, 0x37, 0x7f, 0x7f, 0x71, 0x12, 0x7f, 0x7f, 0x71, 0x12, 0x82, 0x79, 0x6f, 0x37, 0x82, 0x79, 0x6d, 0x85, 0x81, 0x78, 0x6c, 0xee, 0x82, 0x77, 0x6c, 0xff, 0x81, 0x77, 0x6b, 0xff, 0x80, 0x76, 0x6a, 0xff, 0x80, 0x75, 0x69, 0xff, 0x7f, 0x74, 0x68, 0xff, 0x7e, 0x73, 0x67, 0xff, 0x7e, 0x73, 0x66, 0xff, 0x7d, 0x72, 0x65, 0xff, 0x7d, 0x70, 0x63, 0x8d, 0x55, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x84, 0x77, 0x4f, 0x8a, 0x81, 0x77, 0xe8, 0x8b, 0x82, 0x78, 0xff, 0x8a, 0x81, 0x77, 0xff, 0x89, 0x80, 0x76, 0xff, 0x89, 0x7f, 0x75, 0xff, 0x88, 0x7e, 0x74, 0xff, 0x87, 0x7e, 0x71, 0xb6, 0x88, 0x77, 0x77, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x77, 0x66, 0x0f, 0x82, 0x76, 0x6b, 0xb7, 0x80, 0x76, 0x6a, 0xff, 0x80, 0x75, 0x69, 0xff, 0x7f, 0x74, 0x68, 0xff, 0x7e, 0x73, 0x67, 0xff, 0x7e, 0x73, 0x66, 0xff, 0x7c, 0x71, 0x64, 0xe7, 0x7b, 0x71, 0x64, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x86, 0x79, 0x13, 0x89, 0x80, 0x77, 0x8d, 0x89, 0x80, 0x75, 0xf7, 0x89, 0x7f, 0x75, 0xff, 0x88, 0x7e, 0x74, 0xff, 0x88, 0x7d, 0x73, 0xaf, 0xaa, 0x55, 0x55, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x7f, 0x04, 0x80, 0x75, 0x69, 0xb1, 0x7f, 0x74, 0x68, 0xff, 0x7e, 0x73, 0x67, 0xff, 0x7d, 0x72, 0x66, 0xf7, 0x7e, 0x73, 0x64, 0x8c, 0x7f, 0x71, 0x63, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x7f, 0x76, 0x1a, 0x88, 0x7d, 0x73, 0x7e, 0x88, 0x7c, 0x72, 0xcd, 0x8b, 0x80, 0x74, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0x6f, 0x64, 0x17, 0x7e, 0x73, 0x66, 0xce, 0x7e, 0x72, 0x66, 0x7f, 0x7f, 0x76, 0x62, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-#endif
-};
-
-const lv_img_dsc_t ui_img_settings_icon_png = {
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .header.always_zero = 0,
-  .header.reserved = 0,
-  .header.w = 48,
-  .header.h = 48,
-  .data_size = 2304 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .data = ui_img_settings_icon_png_map,
-};
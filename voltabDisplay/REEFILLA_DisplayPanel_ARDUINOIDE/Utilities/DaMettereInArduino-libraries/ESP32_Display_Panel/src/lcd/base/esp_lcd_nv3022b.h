@@ -1,75 +0,0 @@
-/*
- * SPDX-FileCopyrightText: 2022-2023 Espressif Systems (Shanghai) CO LTD
- *
- * SPDX-License-Identifier: Apache-2.0
- */
-#pragma once
-
-#include "esp_lcd_panel_vendor.h"
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-#define ESP_LCD_NV3022B_VER_MAJOR    (0)
-#define ESP_LCD_NV3022B_VER_MINOR    (0)
-#define ESP_LCD_NV3022B_VER_PATCH    (1)
-
-/**
- * @brief Create LCD panel for model nv3022b
- *
- * @note  Vendor specific initialization can be different between manufacturers, should consult the LCD supplier for initialization sequence code.
- *
- * @param[in] io LCD panel IO handle
- * @param[in] panel_dev_config general panel device configuration
- * @param[out] ret_panel Returned LCD panel handle
- * @return
- *          - ESP_ERR_INVALID_ARG   if parameter is invalid
- *          - ESP_ERR_NO_MEM        if out of memory
- *          - ESP_OK                on success
- */
-esp_err_t esp_lcd_new_panel_nv3022b(const esp_lcd_panel_io_handle_t io, const esp_lcd_panel_dev_config_t *panel_dev_config, esp_lcd_panel_handle_t *ret_panel);
-
-/**
- * @brief LCD panel bus configuration structure
- *
- * @param[in] sclk SPI clock pin number
- * @param[in] mosi SPI MOSI pin number
- * @param[in] max_trans_sz Maximum transfer size in bytes
- *
- */
-#define NV3022B_PANEL_BUS_SPI_CONFIG(sclk, mosi, max_trans_sz)  \
-    {                                                           \
-        .sclk_io_num = sclk,                                    \
-        .mosi_io_num = mosi,                                    \
-        .miso_io_num = -1,                                      \
-        .quadhd_io_num = -1,                                    \
-        .quadwp_io_num = -1,                                    \
-        .max_transfer_sz = max_trans_sz,                        \
-    }
-
-/**
- * @brief LCD panel IO configuration structure
- *
- * @param[in] cs SPI chip select pin number
- * @param[in] dc SPI data/command pin number
- * @param[in] cb Callback function when SPI transfer is done
- * @param[in] cb_ctx Callback function context
- *
- */
-#define NV3022B_PANEL_IO_SPI_CONFIG(cs, dc, callback, callback_ctx) \
-    {                                                               \
-        .cs_gpio_num = cs,                                          \
-        .dc_gpio_num = dc,                                          \
-        .spi_mode = 0,                                              \
-        .pclk_hz = 40 * 1000 * 1000,                                \
-        .trans_queue_depth = 10,                                    \
-        .on_color_trans_done = callback,                            \
-        .user_ctx = callback_ctx,                                   \
-        .lcd_cmd_bits = 8,                                          \
-        .lcd_param_bits = 8,                                        \
-    }
-
-#ifdef __cplusplus
-}
-#endif
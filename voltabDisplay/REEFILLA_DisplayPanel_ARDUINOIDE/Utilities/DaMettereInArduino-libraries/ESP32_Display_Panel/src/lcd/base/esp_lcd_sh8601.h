@@ -1,90 +0,0 @@
-/*
- * SPDX-FileCopyrightText: 2023 Espressif Systems (Shanghai) CO LTD
- *
- * SPDX-License-Identifier: Apache-2.0
- */
-
-#pragma once
-
-#include <stdint.h>
-
-#include "esp_lcd_panel_vendor.h"
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-#define ESP_LCD_SH8601_VER_MAJOR    (1)
-#define ESP_LCD_SH8601_VER_MINOR    (0)
-#define ESP_LCD_SH8601_VER_PATCH    (0)
-
-/**
- * @brief Create LCD panel for model SH8601
- *
- * @param[in]  io LCD panel IO handle
- * @param[in]  panel_dev_config General panel device configuration (Use `vendor_config` to select QSPI interface or override default initialization commands)
- * @param[out] ret_panel Returned LCD panel handle
- * @return
- *      - ESP_OK: Success
- *      - Otherwise: Fail
- */
-esp_err_t esp_lcd_new_panel_sh8601(const esp_lcd_panel_io_handle_t io, const esp_lcd_panel_dev_config_t *panel_dev_config, esp_lcd_panel_handle_t *ret_panel);
-
-/**
- * @brief LCD panel bus configuration structure
- *
- */
-#define SH8601_PANEL_BUS_SPI_CONFIG(sclk, mosi, max_trans_sz)   \
-    {                                                           \
-        .sclk_io_num = sclk,                                    \
-        .mosi_io_num = mosi,                                    \
-        .miso_io_num = -1,                                      \
-        .quadhd_io_num = -1,                                    \
-        .quadwp_io_num = -1,                                    \
-        .max_transfer_sz = max_trans_sz,                        \
-    }
-#define SH8601_PANEL_BUS_QSPI_CONFIG(sclk, d0, d1, d2, d3, max_trans_sz) \
-    {                                                           \
-        .sclk_io_num = sclk,                                    \
-        .data0_io_num = d0,                                     \
-        .data1_io_num = d1,                                     \
-        .data2_io_num = d2,                                     \
-        .data3_io_num = d3,                                     \
-        .max_transfer_sz = max_trans_sz,                        \
-    }
-
-/**
- * @brief LCD panel IO configuration structure
- *
- */
-#define SH8601_PANEL_IO_SPI_CONFIG(cs, dc, cb, cb_ctx)          \
-    {                                                           \
-        .cs_gpio_num = cs,                                      \
-        .dc_gpio_num = dc,                                      \
-        .spi_mode = 0,                                          \
-        .pclk_hz = 40 * 1000 * 1000,                            \
-        .trans_queue_depth = 10,                                \
-        .on_color_trans_done = cb,                              \
-        .user_ctx = cb_ctx,                                     \
-        .lcd_cmd_bits = 8,                                      \
-        .lcd_param_bits = 8,                                    \
-    }
-#define SH8601_PANEL_IO_QSPI_CONFIG(cs, cb, cb_ctx)             \
-    {                                                           \
-        .cs_gpio_num = cs,                                      \
-        .dc_gpio_num = -1,                                      \
-        .spi_mode = 0,                                          \
-        .pclk_hz = 40 * 1000 * 1000,                            \
-        .trans_queue_depth = 10,                                \
-        .on_color_trans_done = cb,                              \
-        .user_ctx = cb_ctx,                                     \
-        .lcd_cmd_bits = 32,                                     \
-        .lcd_param_bits = 8,                                    \
-        .flags = {                                              \
-            .quad_mode = true,                                  \
-        },                                                      \
-    }
-
-#ifdef __cplusplus
-}
-#endif
@@ -1,17 +0,0 @@
-/*
- * SPDX-FileCopyrightText: 2023 Espressif Systems (Shanghai) CO LTD
- *
- * SPDX-License-Identifier: Apache-2.0
- */
-
-#ifndef ESP_IOEXPANDER_LIBRARY_H
-#define ESP_IOEXPANDER_LIBRARY_H
-
-#include "ESP_IOExpander.h"
-
-#include "chip/TCA95xx_8bit.h"
-#include "chip/TCA95xx_16bit.h"
-#include "chip/HT8574.h"
-#include "chip/CH422G.h"
-
-#endif
@@ -1,26 +0,0 @@
-/*
- * SPDX-FileCopyrightText: 2023 Espressif Systems (Shanghai) CO LTD
- *
- * SPDX-License-Identifier: Apache-2.0
- */
-
-#include <stddef.h>
-
-namespace esp_io_expander {
-
-const char *path_to_file_name(const char *path)
-{
-    size_t i = 0;
-    size_t pos = 0;
-    char *p = (char *)path;
-    while (*p) {
-        i++;
-        if (*p == '/' || *p == '\\') {
-            pos = i;
-        }
-        p++;
-    }
-    return path + pos;
-}
-
-}
@@ -1,437 +0,0 @@
-#include "../../../lvgl.h"
-
-#if LV_USE_DEMO_BENCHMARK
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMG_COGWHEEL_RGB
-#define LV_ATTRIBUTE_IMG_IMG_COGWHEEL_RGB
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_IMG_COGWHEEL_RGB uint8_t img_benchmark_cogwheel_rgb_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x72, 0x72, 0x72, 0x72, 0x72, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x92, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x72, 0x72, 0x6e, 0x72, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x97, 0x93, 0x93, 0x92, 0x92, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x6e, 0x6e, 0x6e, 0x72, 0x72, 0x72, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x93, 0x72, 0x92, 0x92, 0x92, 0x72, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x92, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x72, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x72, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x92, 0xff, 0xff, 0xff, 0xff, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x72, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0x93, 0xbb, 0xff, 0xff, 0xff, 0xdb, 0x97, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x92, 0xbb, 0xdf, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x72, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0x92, 0x92, 0x92, 0x72, 0x72, 0x92, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x72, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x92, 0x72, 0x72, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x97, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x72, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x72, 0x6e, 0x72, 0x4e, 0x72, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x97, 0x93, 0x93, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x72, 0xdb, 0xff, 0xff, 0xff, 0xff, 0x92, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x6e, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x97, 0x97, 0x97, 0x93, 0x93, 0x97, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x97, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x72, 0x72, 0xdf, 0xff, 0x92, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x6e, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x97, 0x93, 0x97, 0x97, 0x97, 0x97, 0x93, 0x97, 0xb7, 0xff, 0xff, 0xdb, 0x97, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x92, 0x92, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x93, 0x97, 0x97, 0x97, 0x97, 0x97, 0x93, 0x93, 0x93, 0x97, 0x97, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x72, 0x72, 0x6e, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x6e, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x93, 0x97, 0x97, 0x97, 0x97, 0x93, 0x93, 0x97, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x72, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x97, 0x93, 0x97, 0x97, 0x97, 0x93, 0x97, 0x97, 0x97, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x6e, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x6e, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x93, 0x93, 0x97, 0x97, 0x97, 0x97, 0x97, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x6e, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x4e, 0x6e, 0x6e, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x93, 0x93, 0x97, 0x97, 0x97, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x72, 0x92, 0xdb, 0xff, 0xff, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0xdb, 0xff, 0xff, 0xff, 0x92, 0x72, 0x4e, 0x4e, 0x4e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x93, 0x97, 0x97, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x6e, 0x92, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x97, 0x93, 0x92, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x97, 0x93, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x97, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x92, 0x6e, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x6e, 0x6e, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x6e, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xdb, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x72, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0xb7, 0xdb, 0xdb, 0xdb, 0xbb, 0x72, 0x6e, 0x4e, 0x4e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x72, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0x72, 0x6e, 0x4e, 0x4e, 0x72, 0x72, 0x6e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x93, 0x93, 0x97, 0x97, 0xb7, 0xb7, 0xdb, 0xbb, 0x97, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x4e, 0x4e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0x92, 0x93, 0x93, 0x93, 0x93, 0x93, 0x97, 0x97, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x6e, 0xdb, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x97, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x6e, 0x72, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x92, 0x92, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0x72, 0x72, 0x92, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x4e, 0x6e, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xdf, 0x92, 0x92, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0x72, 0x92, 0x92, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xdf, 0x92, 0x92, 0x92, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x72, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x92, 0x72, 0x92, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x4e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xdb, 0x92, 0x72, 0x92, 0x92, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x92, 0x93, 0x93, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0x72, 0x92, 0x92, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x6e, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x93, 0x72, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x93, 0x93, 0x72, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x72, 0x92, 0x92, 0x92, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x97, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x93, 0x92, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x92, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x92, 0x93, 0x93, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x93, 0x92, 0x92, 0x92, 0x92, 0x93, 0x92, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x92, 0x93, 0x93, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x92, 0x92, 0x92, 0x92, 0x93, 0x92, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x72, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0x93, 0x93, 0x93, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x72, 0x6e, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x93, 0x93, 0x93, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0x92, 0x92, 0x92, 0x92, 0x92, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x6e, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x72, 0x6e, 0x6e, 0xb7, 0xb7, 0x92, 0x72, 0x6e, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x92, 0x92, 0x6e, 0x6e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x93, 0x97, 0x92, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x72, 0x92, 0x92, 0x92, 0x92, 0x72, 0x72, 0x6e, 0x4e, 0x4e, 0x6e, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x72, 0x6e, 0x96, 0xff, 0xff, 0xff, 0x92, 0x92, 0x96, 0xb7, 0xb7, 0xbb, 0xbb, 0x97, 0x92, 0x92, 0xbb, 0xff, 0xff, 0xb7, 0x6e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x93, 0x97, 0x93, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x72, 0x92, 0x92, 0x92, 0x92, 0x72, 0x72, 0x6e, 0x4e, 0x4e, 0x6e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0x72, 0x72, 0x72, 0x97, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x72, 0x6e, 0x6e, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x93, 0x97, 0x93, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x72, 0x92, 0x92, 0x92, 0x92, 0x72, 0x6e, 0x4e, 0x6e, 0x6e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0x72, 0x72, 0x72, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x92, 0x6e, 0x72, 0x72, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x93, 0x97, 0x97, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0x72, 0x72, 0x6e, 0x92, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x97, 0x92, 0x72, 0x92, 0x92, 0x92, 0x92, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x72, 0x72, 0x72, 0x72, 0x72, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x72, 0x72, 0x72, 0x72, 0x6e, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0x92, 0x93, 0x93, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x92, 0xff,
-  0xff, 0xff, 0xb7, 0x97, 0x97, 0x93, 0x92, 0x92, 0x72, 0x72, 0x92, 0x92, 0x92, 0x72, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x92, 0x97, 0xdb, 0xff, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdf, 0xdb, 0x97, 0x92, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0x6e, 0x72, 0x72, 0x72, 0x6e, 0x72, 0x92, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x97, 0x92, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0xff,
-  0xff, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x92, 0x92, 0x92, 0x92, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x72, 0x6e, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0xff,
-  0xff, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x72, 0x6e, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0xdb,
-  0xff, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x72, 0x6e, 0x6e, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x92,
-  0xff, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x92,
-  0xff, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x4e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0xdb,
-  0xff, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x6e, 0x92, 0xff,
-  0xff, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0x92, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x97, 0x92, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0x92, 0x96, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xb7, 0x92, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x72, 0x92, 0xdf, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xdb, 0x97, 0x97, 0x93, 0x92, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x72, 0x72, 0x72, 0x72, 0x72, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4d, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0x72, 0x72, 0x72, 0x72, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x6e, 0x6e, 0x6e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x72, 0x72, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xdf, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x6e, 0x6e, 0x6e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x6e, 0x6e, 0x72, 0xff, 0xff, 0xff, 0x92, 0x72, 0x92, 0xbb, 0xbb, 0xbb, 0xbb, 0x97, 0x72, 0x92, 0xff, 0xff, 0xff, 0xb7, 0x72, 0x6e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x72, 0x6e, 0x72, 0x92, 0xb7, 0x92, 0x6e, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x92, 0xb7, 0xb7, 0x93, 0x72, 0x6e, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x4e, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0x72, 0x72, 0x72, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x72, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x4e, 0x4e, 0x4e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x92, 0x72, 0x6e, 0x6e, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x72, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x6e, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x92, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x72, 0x72, 0x72, 0x72, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x72, 0x72, 0x92, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x72, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x72, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x6e, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0x72, 0x92, 0x92, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0xdb, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xdb, 0x72, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x6e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x92, 0x92, 0x92, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x96, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x72, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x6e, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x93, 0x92, 0x93, 0x92, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0xb7, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x72, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x93, 0x93, 0x93, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xdb, 0x72, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x72, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x92, 0x93, 0x93, 0x92, 0x72, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x72, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x93, 0x93, 0x93, 0x93, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x72, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x93, 0x93, 0x97, 0x93, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x92, 0xff, 0xff, 0xb7, 0x92, 0x92, 0x72, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x6e, 0x72, 0x72, 0x72, 0x92, 0x92, 0xb7, 0x92, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x93, 0x93, 0x97, 0x97, 0x92, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xdb, 0xdb, 0xdb, 0xdb, 0xff, 0xff, 0xdb, 0x92, 0x72, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x97, 0x93, 0x97, 0x97, 0x93, 0x72, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x92, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x93, 0x97, 0x97, 0x97, 0x93, 0x72, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0x6e, 0x6e, 0x72, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x97, 0x97, 0x97, 0x97, 0x97, 0x93, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0x72, 0x72, 0x6e, 0x72, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x97, 0x93, 0x97, 0x97, 0x97, 0x93, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x93, 0x93, 0x93, 0x97, 0x97, 0x97, 0x93, 0x72, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x97, 0x93, 0x93, 0x93, 0x93, 0x97, 0x97, 0x93, 0x92, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x92, 0x97, 0xdb, 0xff, 0xff, 0xff, 0xff, 0x92, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0xdb, 0xff, 0xff, 0xff, 0xdb, 0x97, 0x93, 0x92, 0x93, 0x93, 0x93, 0x97, 0x93, 0x93, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x97, 0xdb, 0xdb, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x92, 0x97, 0x93, 0x72, 0x72, 0x72, 0x92, 0x93, 0x93, 0x93, 0x93, 0x92, 0x72, 0x6e, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x72, 0x92, 0x92, 0x92, 0x92, 0x72, 0x92, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x92, 0x92, 0x93, 0x93, 0x93, 0x92, 0x92, 0x72, 0x72, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0x72, 0x72, 0x92, 0x92, 0x92, 0x92, 0x93, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0x72, 0x72, 0x92, 0x92, 0x92, 0x92, 0x92, 0x72, 0x72, 0x6e, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4d, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x92, 0x93, 0x92, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0x72, 0x92, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x6e, 0x4e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x72, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x92, 0xdb, 0xdb, 0x72, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x72, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x6e, 0x4e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x92, 0xb6, 0xb7, 0x92, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x4e, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x4e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0x92, 0x6e, 0x4e, 0x4e, 0x4e, 0x72, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x6e, 0x4e, 0x6e, 0x4e, 0x6e, 0x72, 0x92, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x6e, 0x72, 0x92, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x72, 0x6e, 0x72, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x6e, 0x4e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xbb, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x72, 0x4e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x6e, 0x4e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x6e, 0x4e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x6e, 0x72, 0x72, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x6e, 0x92, 0x92, 0x92, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x4e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x6e, 0x92, 0xdb, 0xff, 0xff, 0xb7, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x92, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x72, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x6e, 0x4e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x6e, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x6e, 0x4e, 0x6e, 0x6e, 0x6e, 0x6e, 0x4e, 0x4e, 0x6e, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x92, 0x72, 0x6e, 0x6e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x72, 0x92, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x92, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x6e, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x72, 0x92, 0x92, 0x92, 0x92, 0x72, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xf6, 0x94, 0xf3, 0x73, 0xd2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xb1, 0x63, 0x33, 0x74, 0xbb, 0xd6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x54, 0x7c, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xb1, 0x63, 0xb1, 0x63, 0x74, 0x84, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x33, 0x74, 0xd2, 0x6b, 0xf2, 0x6b, 0x13, 0x74, 0xf2, 0x6b, 0xf2, 0x6b, 0xb1, 0x63, 0x13, 0x74, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xbb, 0xd6, 0x16, 0x9d, 0xfc, 0xde, 0xfc, 0xe6, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0xfc, 0xe6, 0xd6, 0x8c, 0x34, 0x74, 0xf9, 0xb5, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0x54, 0x7c, 0xd2, 0x6b, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0xf2, 0x6b, 0xd2, 0x6b, 0x13, 0x74, 0xfc, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xbb, 0xd6, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x63, 0x12, 0x74, 0xd5, 0x8c, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x7b, 0xce, 0xd6, 0x8c, 0x95, 0x84, 0x54, 0x7c, 0x33, 0x74, 0x54, 0x7c, 0x39, 0xbe, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x39, 0xc6, 0x53, 0x7c, 0xf2, 0x6b, 0x13, 0x74, 0x13, 0x74, 0xf3, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xf2, 0x73, 0x94, 0x8c, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x73, 0x7c, 0x70, 0x5b, 0x90, 0x5b, 0x90, 0x63, 0xb1, 0x63, 0xd1, 0x6b, 0x12, 0x74, 0x73, 0x84, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x19, 0xbe, 0x75, 0x7c, 0x14, 0x74, 0x34, 0x74, 0x54, 0x7c, 0x54, 0x7c, 0x13, 0x74, 0x75, 0x84, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xf6, 0x94, 0x33, 0x74, 0xf2, 0x6b, 0x13, 0x74, 0xf3, 0x6b, 0xf3, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0x12, 0x7c, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x77, 0xa5, 0xd1, 0x6b, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x70, 0x5b, 0x4f, 0x5b, 0x90, 0x63, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0xd6, 0x8c, 0x34, 0x74, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x34, 0x74, 0x54, 0x7c, 0x7a, 0xce, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x95, 0x84, 0x33, 0x74, 0xf2, 0x6b, 0x13, 0x74, 0x13, 0x74, 0xf3, 0x73, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0x12, 0x7c, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x32, 0x74, 0x70, 0x5b, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x70, 0x5b, 0x90, 0x63, 0xbb, 0xd6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x78, 0xa5, 0x54, 0x7c, 0x54, 0x7c, 0x75, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x34, 0x74, 0x54, 0x7c, 0xfc, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x74, 0x7c, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x12, 0x74, 0xf2, 0x6b, 0xd2, 0x6b, 0xf2, 0x73, 0xdb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x5a, 0xc6, 0xf2, 0x6b, 0xb1, 0x63, 0xd1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x5b, 0xb1, 0x6b, 0x76, 0xa5, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xf9, 0xb5, 0x54, 0x7c, 0x54, 0x7c, 0x75, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x13, 0x74, 0x98, 0xad, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0x3a, 0xc6, 0x33, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x6c, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0x53, 0x84, 0xdb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0x12, 0x74, 0xb1, 0x63, 0xd1, 0x6b, 0xd1, 0x6b, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x63, 0xd1, 0x6b, 0x35, 0xa5, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xb8, 0xad, 0x54, 0x7c, 0x54, 0x7c, 0x75, 0x7c, 0x74, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x34, 0x74, 0x54, 0x7c, 0xd8, 0xb5, 0xdb, 0xde, 0xdb, 0xde, 0xbb, 0xd6, 0xf9, 0xb5, 0xb5, 0x84, 0x33, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0xf2, 0x73, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0x53, 0x7c, 0xd8, 0xb5, 0x9a, 0xd6, 0x94, 0x84, 0xb1, 0x63, 0xb1, 0x63, 0xd1, 0x6b, 0xd1, 0x6b, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x63, 0xd1, 0x73, 0x97, 0xb5, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x9b, 0xce, 0x95, 0x84, 0x54, 0x7c, 0x75, 0x7c, 0x74, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x33, 0x74, 0x34, 0x7c, 0x54, 0x7c, 0x33, 0x74, 0x13, 0x6c, 0x33, 0x74, 0x33, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0xf2, 0x73, 0xf2, 0x73, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xb1, 0x63, 0xd1, 0x6b, 0xb1, 0x63, 0xf2, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xb1, 0x6b, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x63, 0xd0, 0x73, 0xfb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x57, 0xa5, 0x74, 0x7c, 0x54, 0x7c, 0x75, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x34, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x33, 0x74, 0x13, 0x74, 0x33, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd1, 0x6b, 0xd2, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb0, 0x63, 0x11, 0x84, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xd8, 0xb5, 0xfc, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x7a, 0xce, 0x75, 0x7c, 0x54, 0x7c, 0x55, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x34, 0x74, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb0, 0x63, 0xf1, 0x7b, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x19, 0xc6, 0x53, 0x7c, 0xb1, 0x63, 0xf1, 0x6b, 0xf8, 0xbd, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1a, 0xbe, 0x17, 0x95, 0x38, 0x9d, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x98, 0xa5, 0x75, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x34, 0x74, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x63, 0xd1, 0x6b, 0x19, 0xc6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xf5, 0x94, 0xd1, 0x6b, 0x4f, 0x5b, 0xf1, 0x6b, 0x0e, 0x53, 0xb0, 0x63, 0x97, 0xad, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xb9, 0xad, 0xb6, 0x8c, 0x75, 0x7c, 0x75, 0x7c, 0xb6, 0x8c, 0xdc, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x3a, 0xc6, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x74, 0x34, 0x74, 0x34, 0x74, 0x34, 0x74, 0x33, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x63, 0x12, 0x74, 0x19, 0xbe, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x53, 0x7c, 0x90, 0x63, 0x4f, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x90, 0x5b, 0x2f, 0x53, 0x90, 0x63, 0x36, 0x9d, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xb9, 0xad, 0xd6, 0x8c, 0x96, 0x84, 0xb6, 0x84, 0x96, 0x84, 0x75, 0x7c, 0xb6, 0x84, 0x1a, 0xbe, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x7b, 0xce, 0xb6, 0x8c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x84, 0x75, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x34, 0x74, 0x33, 0x74, 0x33, 0x74, 0x13, 0x74, 0xf2, 0x6b, 0xd2, 0x6b, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0xf2, 0x6b, 0xd2, 0x6b, 0xb1, 0x63, 0xb1, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x63, 0xb1, 0x63, 0xf2, 0x73, 0x9b, 0xd6, 0xfc, 0xde, 0x12, 0x74, 0x90, 0x63, 0x4f, 0x53, 0x70, 0x5b, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x0e, 0x53, 0x90, 0x63, 0xb8, 0xb5, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x3a, 0xbe, 0xd6, 0x8c, 0x96, 0x84, 0xb6, 0x84, 0xb6, 0x84, 0x96, 0x84, 0x96, 0x84, 0x75, 0x7c, 0xb6, 0x84, 0x98, 0xa5, 0x1c, 0xe7, 0xfc, 0xe6, 0x7a, 0xce, 0xb6, 0x8c, 0x75, 0x7c, 0x75, 0x7c, 0x95, 0x84, 0x75, 0x7c, 0x75, 0x7c, 0x55, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x13, 0x74, 0xf2, 0x6b, 0xb1, 0x63, 0x70, 0x5b, 0x4f, 0x5b, 0x2e, 0x53, 0x6f, 0x5b, 0xf2, 0x6b, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0xf2, 0x6b, 0xb1, 0x63, 0x4f, 0x5b, 0x2e, 0x53, 0x4f, 0x5b, 0x6f, 0x5b, 0x90, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xd2, 0x6b, 0xd2, 0x6b, 0xd1, 0x6b, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x70, 0x5b, 0x70, 0x5b, 0x12, 0x74, 0x12, 0x74, 0x70, 0x5b, 0x4f, 0x5b, 0x70, 0x63, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x6f, 0x5b, 0x2f, 0x53, 0x94, 0x8c, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x78, 0xa5, 0x96, 0x84, 0xb6, 0x84, 0xb6, 0x84, 0x96, 0x84, 0x96, 0x84, 0x96, 0x84, 0x96, 0x84, 0x75, 0x7c, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x75, 0x7c, 0x95, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x54, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x54, 0x7c, 0x33, 0x74, 0xf2, 0x6b, 0xb1, 0x63, 0x90, 0x63, 0x6f, 0x5b, 0x2e, 0x53, 0xed, 0x4a, 0xed, 0x4a, 0xed, 0x4a, 0x2e, 0x53, 0xd2, 0x6b, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0xf2, 0x6b, 0x90, 0x5b, 0x0e, 0x4b, 0xed, 0x4a, 0xed, 0x4a, 0x0e, 0x4b, 0x2e, 0x53, 0x4f, 0x53, 0x6f, 0x5b, 0x70, 0x5b, 0x91, 0x63, 0xb1, 0x63, 0xd1, 0x6b, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x4f, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x90, 0x63, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x4f, 0x53, 0x6f, 0x5b, 0x36, 0xa5, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x98, 0xad, 0x75, 0x7c, 0x96, 0x84, 0x96, 0x84, 0x96, 0x84, 0x96, 0x84, 0x96, 0x84, 0x96, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x75, 0x7c, 0x95, 0x84, 0x75, 0x84, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x54, 0x7c, 0x33, 0x74, 0xf2, 0x6b, 0x90, 0x63, 0x2f, 0x53, 0x0d, 0x4b, 0x0d, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0xed, 0x4a, 0x2e, 0x53, 0xd2, 0x6b, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0xf2, 0x6b, 0x90, 0x63, 0x2e, 0x53, 0xed, 0x4a, 0xed, 0x4a, 0x0d, 0x4b, 0x0d, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x53, 0x2f, 0x53, 0x70, 0x5b, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x70, 0x5b, 0x70, 0x5b, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x6f, 0x5b, 0x2f, 0x53, 0x90, 0x6b, 0x97, 0xb5, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xbb, 0xd6, 0xb6, 0x84, 0x75, 0x7c, 0x96, 0x84, 0x96, 0x84, 0x96, 0x84, 0x96, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x75, 0x7c, 0x75, 0x84, 0x75, 0x84, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x54, 0x7c, 0xf2, 0x6b, 0x70, 0x5b, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0xed, 0x4a, 0x0d, 0x4b, 0x0d, 0x4b, 0x0e, 0x4b, 0x0e, 0x53, 0x0e, 0x53, 0xed, 0x4a, 0x2f, 0x53, 0xd2, 0x6b, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0xf2, 0x6b, 0x90, 0x63, 0x2e, 0x53, 0xed, 0x4a, 0xed, 0x4a, 0xed, 0x4a, 0xed, 0x4a, 0x0d, 0x4b, 0x0d, 0x4b, 0x0e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x4f, 0x5b, 0x70, 0x5b, 0x90, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0xd0, 0x7b, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x7b, 0xce, 0x75, 0x7c, 0x75, 0x7c, 0x96, 0x84, 0x96, 0x84, 0x96, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x95, 0x84, 0x75, 0x7c, 0x13, 0x74, 0x91, 0x63, 0x4f, 0x53, 0x0e, 0x53, 0xed, 0x4a, 0xed, 0x4a, 0x0e, 0x4b, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0xed, 0x4a, 0xed, 0x4a, 0x0e, 0x53, 0x4e, 0x63, 0x8f, 0x6b, 0xf2, 0x6b, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0xd2, 0x6b, 0x4f, 0x5b, 0xcc, 0x4a, 0xed, 0x52, 0x6f, 0x5b, 0x4e, 0x5b, 0xed, 0x4a, 0xcd, 0x42, 0xed, 0x4a, 0x0e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x4f, 0x5b, 0x4f, 0x5b, 0x70, 0x5b, 0x90, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x2f, 0x53, 0x6f, 0x6b, 0x35, 0xad, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x5a, 0xc6, 0x75, 0x84, 0x75, 0x7c, 0x96, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x75, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x54, 0x7c, 0xf2, 0x6b, 0x6f, 0x5b, 0x0d, 0x4b, 0xed, 0x4a, 0x0d, 0x4b, 0x0e, 0x53, 0x0e, 0x4b, 0x0d, 0x4b, 0xed, 0x4a, 0xed, 0x52, 0x0e, 0x5b, 0x8f, 0x6b, 0x52, 0x84, 0xd8, 0xbd, 0xfc, 0xe6, 0xdb, 0xde, 0x53, 0x7c, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0xb1, 0x6b, 0x0e, 0x5b, 0x4e, 0x6b, 0x59, 0xce, 0xfc, 0xde, 0xfc, 0xde, 0xdb, 0xde, 0x73, 0x84, 0xd1, 0x6b, 0x2e, 0x53, 0xee, 0x4a, 0x0e, 0x53, 0x2f, 0x53, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x70, 0x5b, 0x90, 0x63, 0xb1, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x4f, 0x5b, 0x2e, 0x5b, 0xb0, 0x7b, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0xf7, 0x8c, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x75, 0x7c, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x54, 0x7c, 0xb1, 0x63, 0x2e, 0x53, 0x0d, 0x4b, 0x0d, 0x4b, 0x0e, 0x4b, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x4e, 0x63, 0xd0, 0x73, 0x52, 0x8c, 0xfb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xf6, 0x94, 0x13, 0x74, 0xf2, 0x6b, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x91, 0x63, 0x90, 0x6b, 0xb7, 0xbd, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xdb, 0xde, 0x73, 0x84, 0xb0, 0x6b, 0x4f, 0x5b, 0x2f, 0x53, 0x2f, 0x53, 0x4f, 0x5b, 0x4f, 0x5b, 0x6f, 0x5b, 0x70, 0x5b, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x0e, 0x53, 0x4f, 0x6b, 0xf8, 0xc5, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0xf7, 0x94, 0x95, 0x7c, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x33, 0x74, 0x90, 0x63, 0x0e, 0x53, 0x0d, 0x4b, 0x0d, 0x4b, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0xee, 0x52, 0x2e, 0x63, 0xf0, 0x7b, 0x9a, 0xd6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x16, 0x95, 0x13, 0x74, 0xf2, 0x6b, 0x13, 0x74, 0x13, 0x74, 0x13, 0x6c, 0xb1, 0x63, 0xd1, 0x73, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x9a, 0xd6, 0xb1, 0x6b, 0x4f, 0x53, 0x4f, 0x53, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x2e, 0x53, 0xf1, 0x7b, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0xf6, 0x94, 0x75, 0x7c, 0x75, 0x7c, 0x95, 0x84, 0x95, 0x84, 0x75, 0x7c, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x33, 0x74, 0x90, 0x5b, 0x0e, 0x4b, 0xed, 0x4a, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0xed, 0x4a, 0x2e, 0x5b, 0xb0, 0x73, 0xba, 0xd6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xf6, 0x94, 0x13, 0x74, 0xf2, 0x6b, 0xf3, 0x6b, 0xf3, 0x6b, 0xf2, 0x6b, 0xb1, 0x6b, 0xd1, 0x73, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x7a, 0xce, 0xf1, 0x6b, 0x2f, 0x53, 0x4f, 0x5b, 0x90, 0x63, 0x70, 0x5b, 0x70, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x6f, 0x5b, 0x2f, 0x53, 0x12, 0x74, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x3a, 0xc6, 0xb5, 0x84, 0x75, 0x7c, 0x95, 0x84, 0x95, 0x84, 0x75, 0x7c, 0x75, 0x7c, 0x95, 0x84, 0x95, 0x84, 0x13, 0x74, 0x70, 0x5b, 0x0e, 0x4b, 0x0d, 0x4b, 0x0e, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x0d, 0x53, 0x6f, 0x63, 0x31, 0x8c, 0xbb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x16, 0x95, 0x13, 0x74, 0xf2, 0x6b, 0x13, 0x6c, 0x13, 0x6c, 0xf2, 0x6b, 0xd1, 0x6b, 0xf1, 0x73, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x9a, 0xce, 0x32, 0x74, 0x70, 0x5b, 0x70, 0x5b, 0xb0, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x4f, 0x53, 0xb0, 0x63, 0x97, 0xad, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0xb6, 0x8c, 0x75, 0x7c, 0x75, 0x84, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x95, 0x84, 0x95, 0x84, 0x33, 0x74, 0x70, 0x5b, 0x0d, 0x4b, 0x0d, 0x4b, 0x0e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x8f, 0x6b, 0xf8, 0xc5, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x16, 0x95, 0x13, 0x74, 0xf2, 0x6b, 0x13, 0x6c, 0x13, 0x6c, 0xf2, 0x6b, 0xd1, 0x6b, 0xf1, 0x7b, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x36, 0x9d, 0x90, 0x63, 0x90, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x63, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x2f, 0x53, 0x90, 0x63, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xdb, 0xde, 0xf8, 0xbd, 0xd8, 0xb5, 0x77, 0xad, 0xfc, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xd9, 0xad, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x95, 0x84, 0x95, 0x84, 0x34, 0x74, 0x90, 0x5b, 0x0e, 0x4b, 0x0d, 0x4b, 0x0e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0xed, 0x52, 0xf0, 0x7b, 0xba, 0xd6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x16, 0x95, 0x13, 0x74, 0xf2, 0x6b, 0x13, 0x74, 0xf2, 0x73, 0xf2, 0x6b, 0xd1, 0x6b, 0xf1, 0x7b, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x39, 0xc6, 0xf2, 0x6b, 0x70, 0x5b, 0xb1, 0x63, 0xd1, 0x63, 0xd1, 0x63, 0xb1, 0x63, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x2f, 0x53, 0x4f, 0x5b, 0x56, 0xa5, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x97, 0xad, 0x11, 0x74, 0x70, 0x63, 0x2e, 0x53, 0x0e, 0x4b, 0x12, 0x74, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x17, 0x95, 0x37, 0x9d, 0xdb, 0xde, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x3a, 0xc6, 0x75, 0x7c, 0x75, 0x7c, 0x95, 0x84, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x95, 0x84, 0x54, 0x74, 0xb0, 0x63, 0x0e, 0x53, 0xed, 0x4a, 0x0e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0d, 0x5b, 0xf0, 0x83, 0xba, 0xd6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x16, 0x95, 0x13, 0x74, 0xf2, 0x6b, 0x13, 0x6c, 0xf2, 0x6b, 0xf2, 0x6b, 0xb1, 0x6b, 0xf1, 0x7b, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x39, 0xc6, 0xf2, 0x73, 0x91, 0x63, 0xd1, 0x6b, 0xd2, 0x6b, 0xd1, 0x6b, 0x91, 0x63, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x6f, 0x5b, 0x4f, 0x5b, 0x6f, 0x5b, 0xb0, 0x63, 0xb0, 0x63, 0x6f, 0x5b, 0x0e, 0x53, 0x0e, 0x53, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x4f, 0x5b, 0x93, 0x84, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0xb6, 0x8c, 0x54, 0x7c, 0x75, 0x7c, 0x95, 0x84, 0xd6, 0x8c, 0x16, 0x95, 0x57, 0xa5, 0x3a, 0xc6, 0xb8, 0xad, 0xd6, 0x8c, 0x75, 0x7c, 0x75, 0x84, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x54, 0x7c, 0xd1, 0x63, 0x0e, 0x53, 0xed, 0x4a, 0x0e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0xed, 0x52, 0xf1, 0x83, 0xbb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x16, 0x95, 0x13, 0x74, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xb1, 0x6b, 0xf1, 0x7b, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x39, 0xc6, 0x12, 0x74, 0xd1, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0x90, 0x63, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x6f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0xed, 0x4a, 0xd0, 0x6b, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xdc, 0xde, 0x95, 0x84, 0x34, 0x74, 0x75, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x75, 0x84, 0xb5, 0x84, 0x95, 0x84, 0x75, 0x7c, 0x75, 0x84, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x84, 0x75, 0x7c, 0xf2, 0x6b, 0x2f, 0x53, 0x0d, 0x4b, 0x0e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0d, 0x53, 0xf0, 0x7b, 0xbb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xf6, 0x94, 0x13, 0x74, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xb1, 0x6b, 0xf1, 0x7b, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x39, 0xc6, 0xf2, 0x73, 0xd1, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd1, 0x6b, 0x90, 0x63, 0x70, 0x5b, 0x6f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0xee, 0x4a, 0x4f, 0x53, 0x39, 0xc6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0xb5, 0x8c, 0x54, 0x7c, 0x54, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x74, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x34, 0x74, 0x70, 0x5b, 0xed, 0x4a, 0x0e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0d, 0x53, 0x8f, 0x73, 0x9a, 0xd6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x16, 0x95, 0x13, 0x74, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xb1, 0x6b, 0xf1, 0x7b, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xd5, 0x8c, 0xb2, 0x63, 0xf2, 0x6b, 0x13, 0x74, 0xf2, 0x73, 0xd1, 0x6b, 0x70, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x2f, 0x5b, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0xf1, 0x6b, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x34, 0x74, 0x34, 0x74, 0x54, 0x7c, 0x74, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x55, 0x7c, 0x74, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x54, 0x7c, 0x75, 0x7c, 0x54, 0x7c, 0xb1, 0x63, 0x2e, 0x53, 0x0d, 0x4b, 0x2e, 0x53, 0x2e, 0x53, 0xed, 0x4a, 0x4e, 0x6b, 0x18, 0xc6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xf6, 0x94, 0x13, 0x74, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xb1, 0x6b, 0xf1, 0x73, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x94, 0x84, 0xf2, 0x6b, 0xf3, 0x6b, 0x13, 0x74, 0xf2, 0x6b, 0x91, 0x63, 0x70, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x2f, 0x5b, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x4f, 0x5b, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xbb, 0xd6, 0x34, 0x74, 0x34, 0x74, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x75, 0x7c, 0x74, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x75, 0x7c, 0x13, 0x74, 0x2f, 0x53, 0x0d, 0x4b, 0x0e, 0x53, 0x2e, 0x53, 0x0e, 0x4b, 0x2e, 0x63, 0x72, 0x94, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x16, 0x95, 0x13, 0x74, 0xd2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xb1, 0x6b, 0xf1, 0x73, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xdb, 0xde, 0x13, 0x74, 0xf2, 0x6b, 0x13, 0x74, 0x13, 0x74, 0xf2, 0x6b, 0x70, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x4b, 0x2e, 0x53, 0x52, 0x84, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x9b, 0xd6, 0x34, 0x74, 0x34, 0x74, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x74, 0x7c, 0x54, 0x74, 0xb1, 0x63, 0x0e, 0x53, 0x0d, 0x4b, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x11, 0x84, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x16, 0x95, 0x13, 0x74, 0xd2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xb1, 0x6b, 0xf1, 0x73, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x16, 0x95, 0x33, 0x74, 0x13, 0x74, 0x33, 0x74, 0x13, 0x74, 0xb1, 0x63, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x0e, 0x53, 0x2e, 0x5b, 0x11, 0x7c, 0xdb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x39, 0xbe, 0x54, 0x7c, 0x13, 0x74, 0x34, 0x74, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x74, 0x7c, 0xf2, 0x6b, 0x4f, 0x5b, 0x0e, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x4e, 0x6b, 0xbb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x94, 0x84, 0xf2, 0x6b, 0xd2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xb1, 0x63, 0xf2, 0x73, 0xdb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x74, 0x84, 0xf3, 0x6b, 0x34, 0x74, 0x34, 0x74, 0xf2, 0x6b, 0x70, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0xee, 0x52, 0x4f, 0x63, 0x56, 0xad, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0x77, 0xa5, 0x74, 0x7c, 0x13, 0x74, 0x34, 0x74, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0xb1, 0x63, 0x0d, 0x4b, 0x0e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x2e, 0x5b, 0x11, 0x84, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0xdb, 0xde, 0xd5, 0x94, 0x13, 0x74, 0xd2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd1, 0x6b, 0xd2, 0x6b, 0x73, 0x84, 0xdb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xf9, 0xbd, 0x13, 0x74, 0x34, 0x74, 0x54, 0x7c, 0x33, 0x74, 0xb1, 0x63, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x2f, 0x53, 0x2f, 0x53, 0x4f, 0x53, 0x2e, 0x53, 0xed, 0x52, 0x8f, 0x73, 0xf8, 0xbd, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x7a, 0xce, 0x95, 0x84, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x13, 0x74, 0x70, 0x5b, 0x0e, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x6f, 0x6b, 0xdb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfb, 0xde, 0x94, 0x84, 0x53, 0x7c, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0x13, 0x74, 0x94, 0x84, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xb5, 0x8c, 0x34, 0x74, 0x54, 0x7c, 0x75, 0x7c, 0xf2, 0x6b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x2f, 0x5b, 0x2f, 0x53, 0x4f, 0x53, 0x0e, 0x5b, 0x2d, 0x6b, 0xf8, 0xc5, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x7a, 0xce, 0x95, 0x84, 0x34, 0x7c, 0x34, 0x74, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0xd1, 0x6b, 0x4f, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x5b, 0x11, 0x84, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x19, 0xbe, 0x33, 0x74, 0xd2, 0x63, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xb1, 0x63, 0x91, 0x63, 0xf2, 0x73, 0x7a, 0xce, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x9b, 0xce, 0x34, 0x74, 0x54, 0x7c, 0x75, 0x84, 0x13, 0x74, 0x90, 0x63, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x2f, 0x5b, 0x2f, 0x53, 0x6f, 0x5b, 0x0e, 0x53, 0x96, 0xb5, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xdc, 0xde, 0x95, 0x84, 0x54, 0x7c, 0x34, 0x74, 0x34, 0x7c, 0x34, 0x74, 0x54, 0x7c, 0x33, 0x74, 0x90, 0x5b, 0x0e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x4e, 0x63, 0xb7, 0xbd, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0xb5, 0x8c, 0xd1, 0x63, 0xb1, 0x63, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x73, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd2, 0x6b, 0xf2, 0x6b, 0x70, 0x5b, 0xb1, 0x63, 0xb4, 0x8c, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x54, 0x7c, 0x55, 0x7c, 0x95, 0x84, 0x54, 0x7c, 0xd2, 0x6b, 0x4f, 0x5b, 0x2f, 0x53, 0x4f, 0x5b, 0x2f, 0x53, 0x2f, 0x53, 0x70, 0x5b, 0x4f, 0x5b, 0xbb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xbb, 0xd6, 0x54, 0x7c, 0x54, 0x7c, 0x34, 0x74, 0x34, 0x74, 0x34, 0x74, 0x54, 0x7c, 0x13, 0x74, 0x4f, 0x5b, 0x0d, 0x4b, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0xd0, 0x7b, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x16, 0x95, 0x91, 0x63, 0xd1, 0x6b, 0xb1, 0x6b, 0x12, 0x74, 0xf2, 0x73, 0xd2, 0x6b, 0xd2, 0x6b, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x91, 0x63, 0xb1, 0x63, 0xd1, 0x6b, 0xd2, 0x6b, 0xb1, 0x63, 0x90, 0x63, 0x6f, 0x5b, 0xd1, 0x6b, 0x90, 0x63, 0x97, 0xad, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xb6, 0x8c, 0x75, 0x7c, 0x95, 0x84, 0x95, 0x84, 0x13, 0x74, 0x4f, 0x5b, 0x2e, 0x53, 0x4f, 0x5b, 0x2f, 0x53, 0x2f, 0x53, 0x4f, 0x5b, 0x0e, 0x53, 0xd7, 0xb5, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xbb, 0xd6, 0x13, 0x74, 0x54, 0x7c, 0x33, 0x74, 0x34, 0x74, 0x34, 0x74, 0x33, 0x74, 0xf2, 0x6b, 0x4f, 0x5b, 0x0e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x5b, 0x55, 0xad, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x39, 0xbe, 0xf2, 0x6b, 0x6f, 0x5b, 0x6f, 0x5b, 0x15, 0x95, 0x77, 0xa5, 0x74, 0x7c, 0xd2, 0x6b, 0x91, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0xb1, 0x63, 0xd1, 0x6b, 0xb1, 0x6b, 0x91, 0x63, 0x91, 0x63, 0xd1, 0x73, 0x32, 0x7c, 0x73, 0x84, 0x6f, 0x63, 0x50, 0x5b, 0xd1, 0x6b, 0xbb, 0xd6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xdb, 0xde, 0x95, 0x84, 0x75, 0x7c, 0xb6, 0x84, 0x54, 0x74, 0x4f, 0x5b, 0x2e, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x2f, 0x53, 0x4f, 0x53, 0x0e, 0x4b, 0x11, 0x7c, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x5a, 0xc6, 0xf3, 0x6b, 0x54, 0x7c, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0x13, 0x74, 0xb1, 0x63, 0x4f, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x4e, 0x63, 0xfb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xdc, 0xde, 0x33, 0x7c, 0xb2, 0x63, 0x6f, 0x5b, 0x93, 0x84, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x73, 0x84, 0x32, 0x7c, 0xb4, 0x8c, 0x97, 0xad, 0x76, 0xad, 0x97, 0xad, 0xd8, 0xb5, 0xf5, 0x94, 0x12, 0x74, 0x32, 0x7c, 0x97, 0xb5, 0xfc, 0xe6, 0xfc, 0xe6, 0xf5, 0x94, 0x90, 0x63, 0x70, 0x5b, 0x32, 0x74, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xb6, 0x8c, 0x75, 0x7c, 0xb6, 0x8c, 0x75, 0x7c, 0x90, 0x63, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x4f, 0x53, 0x0e, 0x53, 0xb0, 0x6b, 0xdb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x16, 0x95, 0xd2, 0x6b, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0x13, 0x74, 0x90, 0x63, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0xaf, 0x73, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x94, 0x84, 0xf2, 0x6b, 0xf2, 0x6b, 0x91, 0x63, 0xd4, 0x94, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x9a, 0xd6, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x9a, 0xce, 0xfc, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x16, 0x9d, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x76, 0xa5, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xf7, 0x8c, 0x75, 0x7c, 0xd7, 0x8c, 0x95, 0x84, 0xd2, 0x6b, 0x4f, 0x5b, 0x2e, 0x53, 0x2e, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x0e, 0x53, 0x4f, 0x5b, 0x52, 0x84, 0xfc, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xb5, 0x8c, 0xf3, 0x6b, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0x34, 0x74, 0xf2, 0x6b, 0x70, 0x5b, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0xf1, 0x7b, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xdb, 0xde, 0x13, 0x74, 0x13, 0x74, 0xf2, 0x6b, 0xb2, 0x63, 0x53, 0x7c, 0xbb, 0xd6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x5a, 0xc6, 0x33, 0x74, 0x90, 0x5b, 0x90, 0x63, 0x90, 0x63, 0xd1, 0x6b, 0xdb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x17, 0x95, 0x75, 0x7c, 0xd6, 0x8c, 0x96, 0x84, 0x13, 0x74, 0x70, 0x5b, 0x2e, 0x53, 0x2e, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x4e, 0x53, 0xf1, 0x6b, 0xd0, 0x6b, 0xd1, 0x6b, 0x6f, 0x5b, 0x73, 0x84, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0xfc, 0xde, 0x19, 0xbe, 0x95, 0x84, 0x33, 0x74, 0x13, 0x74, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0xf2, 0x6b, 0x90, 0x5b, 0x4f, 0x5b, 0x70, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x12, 0x84, 0xdb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x39, 0xc6, 0xd2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xb1, 0x63, 0x12, 0x74, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x53, 0x7c, 0x91, 0x63, 0x90, 0x63, 0xb1, 0x63, 0x90, 0x63, 0x50, 0x5b, 0x77, 0xad, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0x95, 0x84, 0x34, 0x74, 0x75, 0x7c, 0x54, 0x7c, 0xf2, 0x6b, 0x70, 0x5b, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0xed, 0x4a, 0xed, 0x4a, 0xed, 0x4a, 0x0d, 0x4b, 0xed, 0x4a, 0x4e, 0x53, 0x32, 0x7c, 0xfc, 0xe6,
-  0xfc, 0xe6, 0x1c, 0xe7, 0x77, 0xa5, 0xf6, 0x94, 0xd5, 0x8c, 0x74, 0x84, 0x53, 0x7c, 0x33, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x33, 0x74, 0x13, 0x74, 0xd2, 0x6b, 0xd1, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd1, 0x6b, 0x12, 0x74, 0xb5, 0x8c, 0x5a, 0xc6, 0xdb, 0xd6, 0x9b, 0xce, 0x9b, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x9b, 0xd6, 0x19, 0xbe, 0xb5, 0x8c, 0x33, 0x74, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0x70, 0x5b, 0x90, 0x63, 0x9a, 0xd6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x12, 0x74, 0x70, 0x5b, 0x90, 0x63, 0xb1, 0x63, 0x90, 0x63, 0x70, 0x5b, 0xd1, 0x6b, 0x73, 0x84, 0xd5, 0x94, 0xf5, 0x94, 0xd5, 0x8c, 0xd5, 0x8c, 0xd4, 0x8c, 0xd4, 0x8c, 0xd4, 0x8c, 0xd4, 0x8c, 0xd4, 0x8c, 0xd4, 0x8c, 0xb4, 0x8c, 0xb4, 0x8c, 0xd4, 0x8c, 0x53, 0x7c, 0xb1, 0x63, 0x91, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x70, 0x5b, 0x4f, 0x5b, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0d, 0x53, 0xcd, 0x42, 0x0d, 0x4b, 0xfc, 0xe6,
-  0x1c, 0xe7, 0x13, 0x74, 0xf2, 0x6b, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0xf3, 0x6b, 0xf3, 0x6b, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0x13, 0x74, 0xf3, 0x6b, 0xf3, 0x6b, 0x13, 0x74, 0x13, 0x6c, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0x70, 0x5b, 0x90, 0x63, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x57, 0x9d, 0xb1, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x6f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x2f, 0x53, 0x2f, 0x5b, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0xcd, 0x42, 0x6f, 0x5b, 0xfc, 0xe6,
-  0xfc, 0xde, 0x13, 0x74, 0xb2, 0x63, 0xf2, 0x6b, 0xf2, 0x6b, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0x70, 0x5b, 0xb0, 0x6b, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x98, 0xad, 0xf2, 0x6b, 0x70, 0x5b, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x70, 0x5b, 0x70, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0xcd, 0x42, 0x2e, 0x53, 0xf8, 0xbd,
-  0xfc, 0xde, 0x53, 0x7c, 0xd2, 0x6b, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0x70, 0x5b, 0xd0, 0x73, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xd9, 0xb5, 0x13, 0x74, 0x70, 0x5b, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x6f, 0x5b, 0x6f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0xed, 0x4a, 0x0e, 0x53, 0x52, 0x84,
-  0x1c, 0xe7, 0x74, 0x7c, 0xd2, 0x6b, 0xf2, 0x6b, 0x13, 0x74, 0x13, 0x6c, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0x70, 0x63, 0xd1, 0x73, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xb9, 0xad, 0xf2, 0x6b, 0x70, 0x5b, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x6f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0xed, 0x4a, 0xed, 0x4a, 0x31, 0x84,
-  0x1c, 0xe7, 0x53, 0x7c, 0xd2, 0x63, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x12, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x6c, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x63, 0xb2, 0x63, 0xb2, 0x63, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0x90, 0x63, 0xf1, 0x73, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x78, 0xa5, 0xd2, 0x6b, 0x70, 0x5b, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x50, 0x5b, 0x4f, 0x5b, 0x4f, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0d, 0x4b, 0xed, 0x4a, 0xed, 0x4a, 0xed, 0x4a, 0xcd, 0x4a, 0x4e, 0x5b, 0x59, 0xc6,
-  0x1c, 0xe7, 0xf2, 0x6b, 0xb1, 0x63, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf3, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf3, 0x6b, 0x13, 0x74, 0x13, 0x74, 0x12, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x12, 0x6c, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x73, 0xf2, 0x73, 0x12, 0x6c, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0x91, 0x63, 0xf2, 0x73, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0xb5, 0x8c, 0x91, 0x63, 0x70, 0x5b, 0x90, 0x63, 0x70, 0x5b, 0x70, 0x5b, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x6f, 0x5b, 0x6f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x8f, 0x63, 0x32, 0x84, 0x1c, 0xe7,
-  0x1c, 0xe7, 0x74, 0x84, 0xd2, 0x6b, 0xb1, 0x63, 0xd2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x73, 0x13, 0x74, 0xf2, 0x6b, 0x90, 0x63, 0x90, 0x5b, 0x90, 0x5b, 0x90, 0x5b, 0x70, 0x5b, 0x4f, 0x63, 0xb0, 0x73, 0x73, 0x84, 0x5a, 0xce, 0xfc, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xfc, 0xde, 0x5a, 0xce, 0xb4, 0x8c, 0x12, 0x74, 0xd1, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd1, 0x6b, 0x91, 0x5b, 0x12, 0x74, 0xbb, 0xd6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xf2, 0x73, 0x4f, 0x5b, 0x90, 0x63, 0x90, 0x63, 0x70, 0x5b, 0x70, 0x5b, 0x4f, 0x5b, 0x4f, 0x63, 0xb0, 0x73, 0x32, 0x84, 0xb4, 0x8c, 0x19, 0xbe, 0x7a, 0xce, 0x5a, 0xce, 0x5a, 0xce, 0x5a, 0xce, 0x5a, 0xce, 0x5a, 0xce, 0x7a, 0xce, 0x59, 0xc6, 0x36, 0xa5, 0x32, 0x7c, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x4f, 0x5b, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0xcd, 0x52, 0xed, 0x52, 0x8f, 0x6b, 0x72, 0x8c, 0x9a, 0xd6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0x1c, 0xe7, 0x39, 0xc6, 0xd5, 0x8c, 0x94, 0x84, 0x94, 0x84, 0x74, 0x84, 0x53, 0x7c, 0xf2, 0x73, 0xf2, 0x73, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0x13, 0x74, 0xd1, 0x6b, 0x4f, 0x53, 0x0e, 0x4b, 0x0e, 0x53, 0x0d, 0x4b, 0xcd, 0x4a, 0x6f, 0x6b, 0x19, 0xc6, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x5a, 0xce, 0xb1, 0x63, 0xd1, 0x6b, 0xd2, 0x6b, 0xd1, 0x6b, 0x91, 0x63, 0x12, 0x7c, 0xfc, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x53, 0x7c, 0x90, 0x63, 0x70, 0x5b, 0x90, 0x63, 0x70, 0x5b, 0x90, 0x63, 0x6f, 0x63, 0xf0, 0x83, 0xfb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xdb, 0xde, 0xf2, 0x73, 0x91, 0x63, 0xd1, 0x6b, 0xb1, 0x63, 0x70, 0x63, 0x4f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0xed, 0x4a, 0xac, 0x52, 0xd0, 0x7b, 0xdb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x1c, 0xe7, 0xfc, 0xe6, 0x1c, 0xe7, 0x7a, 0xce, 0x74, 0x84, 0xf2, 0x73, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd1, 0x6b, 0x4f, 0x5b, 0x0e, 0x4b, 0x0d, 0x4b, 0xed, 0x4a, 0xed, 0x4a, 0x73, 0x8c, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xdb, 0xde, 0xf2, 0x73, 0xd1, 0x6b, 0xd1, 0x6b, 0xb1, 0x63, 0xd1, 0x6b, 0x97, 0xad, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0x12, 0x74, 0x4f, 0x5b, 0x70, 0x5b, 0x90, 0x63, 0x70, 0x63, 0xf1, 0x7b, 0xdb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x33, 0x7c, 0x91, 0x63, 0xf2, 0x6b, 0xd1, 0x6b, 0x90, 0x5b, 0x4f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0xed, 0x4a, 0x6e, 0x6b, 0xbb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xdb, 0xde, 0x74, 0x7c, 0xb1, 0x63, 0xf2, 0x6b, 0xd2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0x70, 0x5b, 0x0e, 0x53, 0x0d, 0x4b, 0xed, 0x4a, 0xed, 0x4a, 0x52, 0x8c, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0xb4, 0x8c, 0xb1, 0x63, 0xb1, 0x63, 0x70, 0x5b, 0x12, 0x74, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0x9b, 0xd6, 0x16, 0x95, 0xfc, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x3a, 0xc6, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x15, 0x95, 0x70, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0xd1, 0x73, 0xdb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x33, 0x74, 0xb1, 0x63, 0xf2, 0x6b, 0xd1, 0x6b, 0x6f, 0x5b, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x4b, 0x0d, 0x53, 0x11, 0x84, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x39, 0xc6, 0x91, 0x63, 0xf2, 0x73, 0xd2, 0x6b, 0xd2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0x90, 0x63, 0x2e, 0x53, 0xed, 0x4a, 0xed, 0x4a, 0xed, 0x4a, 0xd0, 0x73, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0x12, 0x74, 0x70, 0x5b, 0x70, 0x5b, 0x11, 0x74, 0xdb, 0xde, 0xfc, 0xe6, 0x1c, 0xe7, 0x33, 0x7c, 0xd2, 0x6b, 0x53, 0x7c, 0x98, 0xad, 0xb8, 0xad, 0xb8, 0xad, 0xb8, 0xb5, 0xb5, 0x8c, 0x13, 0x74, 0x33, 0x7c, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x37, 0x9d, 0xd2, 0x6b, 0x2f, 0x53, 0xd1, 0x6b, 0xbb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xdb, 0xde, 0x13, 0x74, 0xd2, 0x6b, 0xf2, 0x6b, 0xd1, 0x63, 0x4f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0xed, 0x4a, 0xed, 0x52, 0x93, 0x94, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xbb, 0xd6, 0xb1, 0x6b, 0x12, 0x74, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xb1, 0x63, 0x2e, 0x53, 0xed, 0x4a, 0xed, 0x4a, 0xed, 0x4a, 0x8f, 0x63, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x9b, 0xd6, 0xb1, 0x63, 0x50, 0x5b, 0xd1, 0x6b, 0x74, 0x84, 0xf5, 0x94, 0x33, 0x7c, 0x70, 0x5b, 0x90, 0x63, 0xb1, 0x63, 0xd2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xb1, 0x63, 0x4f, 0x5b, 0x4f, 0x5b, 0x12, 0x74, 0x36, 0x9d, 0x36, 0x9d, 0x74, 0x84, 0xb1, 0x63, 0x70, 0x5b, 0x59, 0xc6, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xd5, 0x8c, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xb1, 0x63, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0xed, 0x4a, 0x4e, 0x63, 0x9a, 0xd6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xbb, 0xd6, 0x12, 0x74, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd1, 0x6b, 0x4f, 0x53, 0xed, 0x4a, 0x0d, 0x4b, 0xed, 0x4a, 0x2e, 0x53, 0xfc, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x19, 0xc6, 0xb1, 0x63, 0xf2, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xb1, 0x63, 0x90, 0x63, 0xb1, 0x63, 0x90, 0x63, 0x70, 0x5b, 0x90, 0x5b, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x90, 0x63, 0x70, 0x5b, 0x70, 0x5b, 0xb1, 0x63, 0xd1, 0x6b, 0xd1, 0x6b, 0xb1, 0x63, 0x7a, 0xce, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x33, 0x74, 0xf2, 0x6b, 0x13, 0x74, 0xf2, 0x6b, 0x91, 0x63, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0xed, 0x4a, 0xb0, 0x6b, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0xb4, 0x8c, 0xb1, 0x63, 0xd1, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd1, 0x6b, 0x6f, 0x5b, 0x0e, 0x4b, 0x0d, 0x4b, 0xed, 0x4a, 0xcd, 0x4a, 0xd8, 0xb5, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x36, 0x9d, 0xd1, 0x6b, 0x70, 0x5b, 0xb1, 0x63, 0x90, 0x63, 0xb0, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x70, 0x5b, 0x70, 0x5b, 0x6f, 0x5b, 0xb0, 0x63, 0x56, 0xa5, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfb, 0xde, 0xf2, 0x6b, 0xf2, 0x6b, 0x13, 0x74, 0xd2, 0x6b, 0x70, 0x5b, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0xed, 0x4a, 0x6f, 0x5b, 0x59, 0xce, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x94, 0x84, 0xb1, 0x63, 0xd1, 0x6b, 0xd2, 0x6b, 0xd1, 0x6b, 0xd2, 0x6b, 0xd1, 0x6b, 0x90, 0x63, 0x2e, 0x53, 0x0d, 0x4b, 0xed, 0x4a, 0xcd, 0x42, 0xf1, 0x73, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x7a, 0xce, 0x12, 0x74, 0x90, 0x63, 0x2f, 0x53, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x90, 0x5b, 0x4f, 0x5b, 0x90, 0x63, 0x59, 0xc6, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xf6, 0x94, 0xf2, 0x6b, 0x13, 0x74, 0x13, 0x74, 0xb1, 0x63, 0x4f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x53, 0xd0, 0x6b, 0x7a, 0xce, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0xf8, 0xbd, 0xf2, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd2, 0x6b, 0xb1, 0x63, 0x4f, 0x5b, 0x0d, 0x4b, 0xed, 0x4a, 0xed, 0x4a, 0x0e, 0x53, 0xf5, 0x94, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xb8, 0xb5, 0x32, 0x7c, 0xf2, 0x73, 0xb1, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x70, 0x5b, 0x70, 0x63, 0x6f, 0x5b, 0xd1, 0x73, 0xdb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0x54, 0x7c, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x90, 0x63, 0x0e, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0d, 0x4b, 0xed, 0x4a, 0x8f, 0x63, 0x39, 0xc6, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x19, 0xbe, 0x53, 0x7c, 0xd1, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0x70, 0x5b, 0x0e, 0x4b, 0x0d, 0x4b, 0x0e, 0x4b, 0xcd, 0x4a, 0xf1, 0x6b, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x1c, 0xe7, 0x9a, 0xd6, 0xd1, 0x6b, 0x70, 0x5b, 0x90, 0x5b, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x70, 0x5b, 0x4f, 0x5b, 0x4f, 0x63, 0xf1, 0x7b, 0xdb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xf6, 0x94, 0x13, 0x6c, 0x33, 0x74, 0x33, 0x74, 0xf2, 0x6b, 0x70, 0x5b, 0x0e, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0d, 0x4b, 0xcd, 0x42, 0xed, 0x4a, 0x4e, 0x53, 0xf1, 0x6b, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xbb, 0xd6, 0x94, 0x84, 0xd2, 0x6b, 0x70, 0x5b, 0xb1, 0x63, 0xd1, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xb1, 0x63, 0xd1, 0x6b, 0xd1, 0x6b, 0x90, 0x63, 0x2f, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0xed, 0x4a, 0x6f, 0x5b, 0x9a, 0xd6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x53, 0x7c, 0x90, 0x63, 0x70, 0x5b, 0x90, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x4f, 0x5b, 0x2e, 0x5b, 0x8f, 0x73, 0xdb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xbb, 0xd6, 0x54, 0x7c, 0x13, 0x74, 0x54, 0x74, 0x33, 0x74, 0xb1, 0x63, 0x2f, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4b, 0x0d, 0x4b, 0xac, 0x42, 0xcd, 0x42, 0x7a, 0xce, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x39, 0xc6, 0xd1, 0x6b, 0x70, 0x5b, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x70, 0x5b, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0xf1, 0x73, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0xb4, 0x8c, 0x90, 0x63, 0x70, 0x5b, 0x90, 0x63, 0x70, 0x5b, 0x70, 0x5b, 0x2f, 0x5b, 0x4f, 0x63, 0x76, 0xb5, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x95, 0x84, 0x34, 0x74, 0x54, 0x7c, 0x54, 0x7c, 0x13, 0x74, 0x70, 0x5b, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0xed, 0x4a, 0xed, 0x4a, 0x93, 0x8c, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0xd1, 0x6b, 0x90, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x63, 0x4f, 0x5b, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x39, 0xc6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x94, 0x84, 0x90, 0x63, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x2f, 0x5b, 0x90, 0x6b, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xbb, 0xd6, 0x54, 0x7c, 0x34, 0x74, 0x54, 0x7c, 0x34, 0x74, 0xd1, 0x63, 0x2f, 0x53, 0x0e, 0x4b, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0xed, 0x4a, 0x0e, 0x4b, 0x76, 0xa5, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x32, 0x74, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x5b, 0x4f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0xb0, 0x63, 0x59, 0xc6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x94, 0x84, 0x90, 0x63, 0x50, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x4f, 0x5b, 0xb0, 0x6b, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xdb, 0xde, 0x95, 0x84, 0x54, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x13, 0x74, 0x4f, 0x5b, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0d, 0x4b, 0x0d, 0x4b, 0x0d, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0xed, 0x4a, 0x2e, 0x5b, 0xbb, 0xd6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x7a, 0xce, 0xd1, 0x6b, 0x70, 0x5b, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x6f, 0x5b, 0x2e, 0x53, 0x4f, 0x53, 0x4f, 0x5b, 0x0e, 0x4b, 0xf1, 0x73, 0x9a, 0xce, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x94, 0x84, 0x90, 0x63, 0x4f, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x4f, 0x5b, 0xb0, 0x6b, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xf6, 0x8c, 0x34, 0x74, 0x75, 0x7c, 0x75, 0x84, 0x34, 0x7c, 0xb1, 0x63, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0xed, 0x4a, 0xcd, 0x42, 0xcd, 0x42, 0xcd, 0x42, 0xed, 0x4a, 0x0e, 0x4b, 0xed, 0x4a, 0xed, 0x4a, 0xb0, 0x73, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x12, 0x74, 0x70, 0x5b, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x70, 0x63, 0x4f, 0x5b, 0x2f, 0x53, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x11, 0x74, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x94, 0x84, 0x90, 0x63, 0x4f, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x4f, 0x5b, 0xb0, 0x6b, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x17, 0x95, 0x75, 0x7c, 0x75, 0x7c, 0x95, 0x84, 0x75, 0x7c, 0xf2, 0x6b, 0x4f, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0xed, 0x4a, 0x2e, 0x5b, 0x90, 0x63, 0xb0, 0x63, 0x6f, 0x5b, 0x0e, 0x53, 0xed, 0x4a, 0xcd, 0x42, 0x4f, 0x5b, 0x93, 0x94, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x94, 0x84, 0x90, 0x63, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x90, 0x5b, 0x70, 0x5b, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x63, 0x90, 0x63, 0x70, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x53, 0x4f, 0x5b, 0xd8, 0xb5, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x94, 0x84, 0x90, 0x63, 0x4f, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x4f, 0x5b, 0xb0, 0x6b, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x19, 0xbe, 0x75, 0x7c, 0x75, 0x7c, 0x95, 0x84, 0x75, 0x84, 0x33, 0x74, 0x70, 0x5b, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0xcd, 0x4a, 0xed, 0x5a, 0x52, 0x8c, 0xdb, 0xde, 0xfc, 0xde, 0x56, 0xa5, 0x52, 0x7c, 0x11, 0x74, 0xd0, 0x6b, 0x32, 0x7c, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x12, 0x74, 0x70, 0x5b, 0x90, 0x63, 0xb1, 0x63, 0xd1, 0x6b, 0xf1, 0x73, 0x73, 0x8c, 0x15, 0xa5, 0xf1, 0x73, 0x90, 0x63, 0x90, 0x63, 0xb1, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x70, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x70, 0x5b, 0x4f, 0x5b, 0x90, 0x63, 0x56, 0xa5, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x94, 0x84, 0x90, 0x5b, 0x4f, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x4f, 0x5b, 0xb0, 0x6b, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x98, 0xad, 0x95, 0x84, 0x95, 0x84, 0xb5, 0x84, 0x95, 0x84, 0x34, 0x74, 0x90, 0x5b, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0d, 0x4b, 0x2e, 0x5b, 0x35, 0xad, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x57, 0xa5, 0xd8, 0xb5, 0xf8, 0xbd, 0xd8, 0xbd, 0x39, 0xce, 0x1c, 0xe7, 0x1c, 0xe7, 0x9a, 0xd6, 0x74, 0x84, 0x90, 0x63, 0x70, 0x5b, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x70, 0x5b, 0x6f, 0x5b, 0x70, 0x5b, 0x90, 0x63, 0x4f, 0x5b, 0x90, 0x63, 0x15, 0x9d, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x94, 0x84, 0x90, 0x5b, 0x4f, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0xb0, 0x6b, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0xd9, 0xb5, 0x96, 0x84, 0x95, 0x84, 0xb6, 0x84, 0xb6, 0x84, 0x54, 0x7c, 0xb1, 0x63, 0x2e, 0x53, 0x0d, 0x4b, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4b, 0xed, 0x52, 0xf0, 0x7b, 0xfb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0xf2, 0x73, 0x70, 0x5b, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x32, 0x7c, 0x7a, 0xce, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x93, 0x84, 0x70, 0x5b, 0x4f, 0x5b, 0x70, 0x5b, 0x6f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0xb0, 0x6b, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xf7, 0x8c, 0x75, 0x7c, 0x96, 0x84, 0xb6, 0x84, 0xb6, 0x84, 0x75, 0x7c, 0xb1, 0x6b, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0xed, 0x4a, 0x4e, 0x6b, 0x59, 0xce, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x39, 0xc6, 0xd1, 0x6b, 0x70, 0x5b, 0x70, 0x5b, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x70, 0x5b, 0x70, 0x5b, 0x90, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x90, 0x63, 0x12, 0x74, 0x5a, 0xc6, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x93, 0x84, 0x70, 0x5b, 0x4f, 0x53, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x2f, 0x5b, 0xb0, 0x6b, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x5a, 0xc6, 0xd6, 0x8c, 0x96, 0x84, 0x96, 0x84, 0xd6, 0x8c, 0xb6, 0x84, 0x75, 0x7c, 0xd1, 0x63, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0xed, 0x4a, 0xed, 0x52, 0xf0, 0x83, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x77, 0xa5, 0x70, 0x5b, 0x70, 0x5b, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x90, 0x63, 0x90, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x70, 0x5b, 0xf2, 0x6b, 0x77, 0xa5, 0xfc, 0xe6, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x73, 0x84, 0x70, 0x5b, 0x4f, 0x53, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x2f, 0x5b, 0xb0, 0x6b, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0x57, 0x9d, 0x96, 0x84, 0x75, 0x7c, 0x96, 0x84, 0xb6, 0x8c, 0xd7, 0x8c, 0x75, 0x7c, 0xb1, 0x63, 0x2e, 0x53, 0x0d, 0x4b, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0xcd, 0x4a, 0x2e, 0x5b, 0x7a, 0xd6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x19, 0xbe, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x90, 0x5b, 0x90, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x91, 0x63, 0xd2, 0x6b, 0xd8, 0xb5, 0x1c, 0xe7, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x93, 0x84, 0x70, 0x5b, 0x4f, 0x53, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x2e, 0x5b, 0x90, 0x6b, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x1c, 0xe7, 0x5a, 0xc6, 0x75, 0x7c, 0x75, 0x7c, 0x95, 0x84, 0xb6, 0x84, 0xb6, 0x84, 0x96, 0x84, 0x54, 0x7c, 0xb1, 0x63, 0x0e, 0x53, 0x0d, 0x4b, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0xcd, 0x42, 0x4f, 0x5b, 0xbb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x73, 0x84, 0x4f, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x90, 0x63, 0x90, 0x63, 0xb1, 0x63, 0xd1, 0x6b, 0xd1, 0x6b, 0xb1, 0x63, 0xb1, 0x6b, 0xd2, 0x6b, 0x12, 0x74, 0x74, 0x84, 0xdb, 0xde, 0x1c, 0xe7, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x73, 0x84, 0x70, 0x5b, 0x4f, 0x53, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x53, 0x2e, 0x53, 0x90, 0x6b, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x1c, 0xe7, 0xbb, 0xd6, 0xb6, 0x8c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x95, 0x7c, 0x96, 0x84, 0xb6, 0x84, 0x95, 0x84, 0x33, 0x74, 0x70, 0x5b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4b, 0xed, 0x4a, 0x0e, 0x4b, 0xf1, 0x6b, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xf8, 0xbd, 0x90, 0x63, 0x4f, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x90, 0x5b, 0x90, 0x63, 0xb1, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xb1, 0x63, 0xd2, 0x6b, 0x74, 0x7c, 0xf6, 0x94, 0x7a, 0xce, 0xdb, 0xde, 0xfc, 0xe6, 0x1c, 0xe7, 0x1c, 0xe7, 0x32, 0x7c, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x2f, 0x53, 0x0e, 0x53, 0x90, 0x6b, 0x39, 0xc6, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xde, 0x19, 0xbe, 0xd6, 0x8c, 0x75, 0x7c, 0x34, 0x74, 0x34, 0x74, 0x75, 0x7c, 0x95, 0x84, 0x96, 0x84, 0x95, 0x84, 0x54, 0x7c, 0xd1, 0x6b, 0x6f, 0x5b, 0x0e, 0x53, 0x0d, 0x4b, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x52, 0x7c, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xdb, 0xde, 0x90, 0x63, 0x2f, 0x53, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x90, 0x63, 0xb1, 0x63, 0xd1, 0x6b, 0xf2, 0x6b, 0xf2, 0x73, 0x13, 0x74, 0x13, 0x74, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0x13, 0x74, 0x95, 0x84, 0xf9, 0xb5, 0xf9, 0xbd, 0xb1, 0x6b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x2f, 0x53, 0x4f, 0x5b, 0x90, 0x63, 0x53, 0x7c, 0xd5, 0x8c, 0x95, 0x84, 0x13, 0x74, 0xf3, 0x6b, 0x13, 0x74, 0x34, 0x74, 0x54, 0x7c, 0x75, 0x84, 0x95, 0x84, 0x75, 0x84, 0x54, 0x7c, 0xf2, 0x6b, 0x90, 0x63, 0x2e, 0x53, 0x0d, 0x4b, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0d, 0x4b, 0xed, 0x4a, 0x4e, 0x53, 0x56, 0xa5, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfb, 0xde, 0x32, 0x74, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x6f, 0x5b, 0x6f, 0x5b, 0x6f, 0x5b, 0x70, 0x5b, 0x90, 0x63, 0xb1, 0x63, 0xd2, 0x6b, 0x12, 0x6c, 0x13, 0x74, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0x34, 0x74, 0x13, 0x6c, 0x70, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x2f, 0x53, 0x4f, 0x5b, 0x91, 0x63, 0xf2, 0x6b, 0x13, 0x74, 0x13, 0x74, 0x33, 0x74, 0x34, 0x74, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x34, 0x74, 0xf2, 0x6b, 0xb1, 0x63, 0x4f, 0x53, 0x0e, 0x4b, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0d, 0x4b, 0xac, 0x42, 0xb3, 0x8c, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xf5, 0x94, 0x70, 0x5b, 0x6f, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x6f, 0x5b, 0x6f, 0x5b, 0x6f, 0x5b, 0x6f, 0x5b, 0x6f, 0x5b, 0x6f, 0x5b, 0x6f, 0x5b, 0x90, 0x63, 0xd1, 0x6b, 0xf2, 0x6b, 0x13, 0x74, 0x33, 0x74, 0x33, 0x74, 0x34, 0x74, 0x34, 0x74, 0x54, 0x7c, 0x13, 0x74, 0x90, 0x5b, 0x2f, 0x53, 0x4f, 0x5b, 0x4f, 0x5b, 0x2f, 0x53, 0x2e, 0x53, 0x4f, 0x5b, 0x91, 0x63, 0xf2, 0x6b, 0x13, 0x74, 0x13, 0x74, 0x33, 0x74, 0x34, 0x74, 0x34, 0x74, 0x34, 0x74, 0x13, 0x74, 0xd2, 0x6b, 0x70, 0x5b, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0d, 0x4b, 0xed, 0x4a, 0xed, 0x4a, 0xed, 0x4a, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0d, 0x4b, 0x8c, 0x3a, 0x90, 0x63, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x73, 0x84, 0x2f, 0x53, 0x4f, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x6f, 0x5b, 0x6f, 0x5b, 0x6f, 0x5b, 0x4f, 0x5b, 0x4f, 0x53, 0x4f, 0x53, 0x4f, 0x5b, 0x4f, 0x5b, 0x6f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x70, 0x5b, 0x90, 0x5b, 0x90, 0x63, 0xd1, 0x6b, 0xf2, 0x6b, 0x13, 0x74, 0x54, 0x7c, 0x75, 0x7c, 0x54, 0x7c, 0x90, 0x63, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x4f, 0x5b, 0x91, 0x63, 0x13, 0x74, 0x33, 0x74, 0x13, 0x74, 0xf2, 0x6b, 0xf2, 0x6b, 0xb1, 0x63, 0x90, 0x63, 0x6f, 0x5b, 0x4f, 0x5b, 0x2e, 0x53, 0x0e, 0x4b, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4b, 0xed, 0x4a, 0xed, 0x52, 0x2e, 0x5b, 0x0e, 0x53, 0xed, 0x42, 0x0d, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0d, 0x4b, 0xed, 0x4a, 0x32, 0x7c, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x36, 0x9d, 0x70, 0x5b, 0x2f, 0x53, 0x70, 0x5b, 0x6f, 0x5b, 0x6f, 0x5b, 0x6f, 0x5b, 0x4f, 0x5b, 0x70, 0x5b, 0x4f, 0x53, 0x2e, 0x5b, 0x6f, 0x63, 0x90, 0x63, 0x4f, 0x53, 0x2f, 0x53, 0x6f, 0x5b, 0x6f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x6f, 0x5b, 0x90, 0x63, 0xb1, 0x63, 0xd1, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0x70, 0x5b, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2f, 0x53, 0x70, 0x5b, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x4f, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0xed, 0x4a, 0x2e, 0x63, 0xd0, 0x7b, 0x39, 0xc6, 0x9a, 0xce, 0x11, 0x74, 0x0e, 0x4b, 0xcd, 0x42, 0x0e, 0x53, 0x0e, 0x4b, 0x0d, 0x4b, 0xcd, 0x42, 0xb0, 0x6b, 0x18, 0xc6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x73, 0x84, 0x70, 0x5b, 0x2f, 0x53, 0x4f, 0x5b, 0x6f, 0x5b, 0x4f, 0x5b, 0x4f, 0x53, 0x2f, 0x53, 0x6f, 0x63, 0xb0, 0x7b, 0xd4, 0x9c, 0x15, 0x9d, 0x53, 0x84, 0xb0, 0x63, 0x4f, 0x5b, 0x2f, 0x53, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x53, 0x4f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x53, 0xed, 0x52, 0x4e, 0x63, 0x52, 0x8c, 0xdb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0x32, 0x7c, 0x2e, 0x53, 0xed, 0x4a, 0xcd, 0x42, 0x0d, 0x4b, 0xb0, 0x6b, 0x76, 0xad, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x73, 0x84, 0x90, 0x63, 0x0e, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x6f, 0x5b, 0xd0, 0x73, 0x72, 0x94, 0xfc, 0xe6, 0x1c, 0xe7, 0xfc, 0xe6, 0x1c, 0xe7, 0x19, 0xc6, 0xf1, 0x73, 0x2e, 0x53, 0x2f, 0x53, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0d, 0x4b, 0xcc, 0x52, 0x6f, 0x73, 0x59, 0xce, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x7a, 0xce, 0x4e, 0x5b, 0xb0, 0x6b, 0x11, 0x74, 0x39, 0xc6, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x36, 0x9d, 0xb0, 0x63, 0x4f, 0x5b, 0xd1, 0x6b, 0x73, 0x8c, 0xfb, 0xde, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x53, 0x7c, 0x4f, 0x5b, 0x2e, 0x53, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0xcc, 0x4a, 0x4e, 0x6b, 0x59, 0xce, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x19, 0xbe, 0xb7, 0xb5, 0x39, 0xc6, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x97, 0xad, 0x90, 0x63, 0x0e, 0x4b, 0x2f, 0x53, 0x4f, 0x5b, 0x4f, 0x5b, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0d, 0x4b, 0xed, 0x52, 0xb3, 0x94, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x36, 0x9d, 0x90, 0x63, 0x0e, 0x4b, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4b, 0x0d, 0x4b, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0xed, 0x4a, 0x0e, 0x53, 0x55, 0xa5, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x32, 0x74, 0x4f, 0x5b, 0x0e, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0xed, 0x4a, 0xed, 0x4a, 0x0d, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0xed, 0x4a, 0x0d, 0x4b, 0x35, 0x9d, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x90, 0x63, 0x2e, 0x53, 0x2f, 0x53, 0x4f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x4f, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0xed, 0x52, 0x4f, 0x63, 0xb0, 0x6b, 0x90, 0x63, 0x2e, 0x53, 0x2e, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0xed, 0x4a, 0x2e, 0x5b, 0x8f, 0x6b, 0xd0, 0x73, 0x52, 0x84, 0x72, 0x84, 0x6f, 0x63, 0xcd, 0x42, 0x0e, 0x4b, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0xed, 0x4a, 0xcd, 0x42, 0x73, 0x84, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xdb, 0xde, 0x4f, 0x53, 0x0e, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x0e, 0x53, 0xed, 0x5a, 0xb0, 0x7b, 0x7a, 0xd6, 0xfb, 0xde, 0xdb, 0xde, 0x97, 0xad, 0x6f, 0x5b, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0xed, 0x52, 0x2e, 0x5b, 0xd0, 0x73, 0x9a, 0xd6, 0xdb, 0xde, 0xdb, 0xde, 0xfc, 0xe6, 0x1c, 0xe7, 0x18, 0xbe, 0x0d, 0x4b, 0xed, 0x4a, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0d, 0x4b, 0xcd, 0x42, 0x90, 0x63, 0x9a, 0xd6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0xd4, 0x8c, 0x2e, 0x53, 0x0e, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x8f, 0x73, 0xbb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0xd0, 0x6b, 0x2e, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0xed, 0x4a, 0xcd, 0x52, 0xd0, 0x7b, 0xfb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x11, 0x74, 0xed, 0x4a, 0xed, 0x4a, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0xed, 0x4a, 0xed, 0x42, 0x4f, 0x5b, 0x35, 0xa5, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xb7, 0xb5, 0x2e, 0x53, 0xcd, 0x4a, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x4b, 0x6f, 0x63, 0xf8, 0xc5, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x31, 0x74, 0x4e, 0x53, 0x0e, 0x4b, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0xed, 0x4a, 0x2e, 0x63, 0x56, 0xad, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x39, 0xc6, 0x0e, 0x53, 0xcd, 0x42, 0x0e, 0x4b, 0x0d, 0x4b, 0xed, 0x4a, 0xcd, 0x42, 0xcd, 0x42, 0xb0, 0x6b, 0xdb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x32, 0x7c, 0x6f, 0x5b, 0xee, 0x4a, 0xed, 0x4a, 0x0e, 0x4b, 0x0e, 0x53, 0xee, 0x4a, 0x2e, 0x5b, 0x31, 0x84, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x93, 0x84, 0x4f, 0x5b, 0xed, 0x4a, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0xed, 0x4a, 0x6f, 0x63, 0xfc, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x11, 0x74, 0xcd, 0x42, 0xac, 0x42, 0xcd, 0x42, 0x0d, 0x53, 0x4e, 0x5b, 0xf1, 0x73, 0xbb, 0xd6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x59, 0xc6, 0x52, 0x7c, 0xd0, 0x6b, 0x6f, 0x5b, 0x2e, 0x53, 0x6f, 0x5b, 0x52, 0x84, 0xdb, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0xf5, 0x94, 0x6f, 0x5b, 0xed, 0x4a, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x53, 0x6f, 0x6b, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0xdb, 0xd6, 0x52, 0x7c, 0xb0, 0x63, 0x11, 0x74, 0xb3, 0x8c, 0xbb, 0xd6, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x15, 0x9d, 0x11, 0x74, 0x9a, 0xd6, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x36, 0x9d, 0x4f, 0x5b, 0xac, 0x42, 0xed, 0x4a, 0xed, 0x4a, 0xed, 0x4a, 0x0d, 0x4b, 0xed, 0x4a, 0x0e, 0x53, 0xd0, 0x73, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x8f, 0x5b, 0xcd, 0x42, 0xed, 0x4a, 0xed, 0x4a, 0xed, 0x4a, 0xed, 0x4a, 0xcd, 0x42, 0x4e, 0x5b, 0x93, 0x8c, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0xd8, 0xb5, 0x11, 0x74, 0x52, 0x7c, 0x52, 0x7c, 0x52, 0x7c, 0x32, 0x7c, 0xd0, 0x6b, 0x73, 0x84, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-  0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Red: 5 bit, Green: 6 bit, Blue: 5 bit BUT the 2 bytes are swapped*/
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x94, 0xf6, 0x73, 0xf3, 0x6b, 0xd2, 0x6b, 0xf2, 0x6b, 0xf2, 0x63, 0xb1, 0x74, 0x33, 0xd6, 0xbb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x7c, 0x54, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x63, 0xb1, 0x63, 0xb1, 0x84, 0x74, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x74, 0x33, 0x6b, 0xd2, 0x6b, 0xf2, 0x74, 0x13, 0x6b, 0xf2, 0x6b, 0xf2, 0x63, 0xb1, 0x74, 0x13, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xd6, 0xbb, 0x9d, 0x16, 0xde, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xe6, 0xfc, 0x8c, 0xd6, 0x74, 0x34, 0xb5, 0xf9, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xfc, 0x7c, 0x54, 0x6b, 0xd2, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x6b, 0xf2, 0x6b, 0xd2, 0x74, 0x13, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xd6, 0xbb, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x74, 0x12, 0x8c, 0xd5, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xce, 0x7b, 0x8c, 0xd6, 0x84, 0x95, 0x7c, 0x54, 0x74, 0x33, 0x7c, 0x54, 0xbe, 0x39, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xc6, 0x39, 0x7c, 0x53, 0x6b, 0xf2, 0x74, 0x13, 0x74, 0x13, 0x6b, 0xf3, 0x6b, 0xf2, 0x6b, 0xd2, 0x73, 0xf2, 0x8c, 0x94, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x7c, 0x73, 0x5b, 0x70, 0x5b, 0x90, 0x63, 0x90, 0x63, 0xb1, 0x6b, 0xd1, 0x74, 0x12, 0x84, 0x73, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xbe, 0x19, 0x7c, 0x75, 0x74, 0x14, 0x74, 0x34, 0x7c, 0x54, 0x7c, 0x54, 0x74, 0x13, 0x84, 0x75, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x94, 0xf6, 0x74, 0x33, 0x6b, 0xf2, 0x74, 0x13, 0x6b, 0xf3, 0x6b, 0xf3, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x7c, 0x12, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xa5, 0x77, 0x6b, 0xd1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x5b, 0x70, 0x5b, 0x4f, 0x63, 0x90, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x8c, 0xd6, 0x74, 0x34, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x74, 0x34, 0x7c, 0x54, 0xce, 0x7a, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x84, 0x95, 0x74, 0x33, 0x6b, 0xf2, 0x74, 0x13, 0x74, 0x13, 0x73, 0xf3, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x7c, 0x12, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x74, 0x32, 0x5b, 0x70, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x5b, 0x70, 0x63, 0x90, 0xd6, 0xbb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xa5, 0x78, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x75, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x74, 0x34, 0x7c, 0x54, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x7c, 0x74, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x12, 0x6b, 0xf2, 0x6b, 0xd2, 0x73, 0xf2, 0xde, 0xdb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xc6, 0x5a, 0x6b, 0xf2, 0x63, 0xb1, 0x63, 0xd1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x5b, 0x90, 0x6b, 0xb1, 0xa5, 0x76, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xb5, 0xf9, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x75, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x74, 0x13, 0xad, 0x98, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xfc, 0xc6, 0x3a, 0x74, 0x33, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x6c, 0x13, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x84, 0x53, 0xde, 0xdb, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xfc, 0x74, 0x12, 0x63, 0xb1, 0x6b, 0xd1, 0x6b, 0xd1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x6b, 0xd1, 0xa5, 0x35, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xad, 0xb8, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x75, 0x7c, 0x74, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x74, 0x34, 0x7c, 0x54, 0xb5, 0xd8, 0xde, 0xdb, 0xde, 0xdb, 0xd6, 0xbb, 0xb5, 0xf9, 0x84, 0xb5, 0x74, 0x33, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x73, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x7c, 0x53, 0xb5, 0xd8, 0xd6, 0x9a, 0x84, 0x94, 0x63, 0xb1, 0x63, 0xb1, 0x6b, 0xd1, 0x6b, 0xd1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x73, 0xd1, 0xb5, 0x97, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xce, 0x9b, 0x84, 0x95, 0x7c, 0x54, 0x7c, 0x75, 0x7c, 0x74, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x74, 0x33, 0x7c, 0x34, 0x7c, 0x54, 0x74, 0x33, 0x6c, 0x13, 0x74, 0x33, 0x74, 0x33, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x73, 0xf2, 0x73, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x63, 0xb1, 0x6b, 0xd1, 0x63, 0xb1, 0x6b, 0xf2, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x73, 0xd0, 0xde, 0xfb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xa5, 0x57, 0x7c, 0x74, 0x7c, 0x54, 0x7c, 0x75, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x34, 0x7c, 0x54, 0x7c, 0x54, 0x74, 0x33, 0x74, 0x13, 0x74, 0x33, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd1, 0x6b, 0xd2, 0x6b, 0xd1, 0x6b, 0xd1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb0, 0x84, 0x11, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xb5, 0xd8, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xce, 0x7a, 0x7c, 0x75, 0x7c, 0x54, 0x7c, 0x55, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x74, 0x34, 0x74, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd1, 0x6b, 0xd1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb0, 0x7b, 0xf1, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xc6, 0x19, 0x7c, 0x53, 0x63, 0xb1, 0x6b, 0xf1, 0xbd, 0xf8, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xbe, 0x1a, 0x95, 0x17, 0x9d, 0x38, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xa5, 0x98, 0x7c, 0x75, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x74, 0x34, 0x74, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd1, 0x6b, 0xd1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x6b, 0xd1, 0xc6, 0x19, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x94, 0xf5, 0x6b, 0xd1, 0x5b, 0x4f, 0x6b, 0xf1, 0x53, 0x0e, 0x63, 0xb0, 0xad, 0x97, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xad, 0xb9, 0x8c, 0xb6, 0x7c, 0x75, 0x7c, 0x75, 0x8c, 0xb6, 0xde, 0xdc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xc6, 0x3a, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x74, 0x54, 0x74, 0x34, 0x74, 0x34, 0x74, 0x34, 0x74, 0x33, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd1, 0x6b, 0xd1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x74, 0x12, 0xbe, 0x19, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x7c, 0x53, 0x63, 0x90, 0x5b, 0x4f, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x90, 0x53, 0x2f, 0x63, 0x90, 0x9d, 0x36, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xad, 0xb9, 0x8c, 0xd6, 0x84, 0x96, 0x84, 0xb6, 0x84, 0x96, 0x7c, 0x75, 0x84, 0xb6, 0xbe, 0x1a, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xce, 0x7b, 0x8c, 0xb6, 0x7c, 0x75, 0x7c, 0x75, 0x84, 0x75, 0x7c, 0x75, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x74, 0x34, 0x74, 0x33, 0x74, 0x33, 0x74, 0x13, 0x6b, 0xf2, 0x6b, 0xd2, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x6b, 0xf2, 0x6b, 0xd2, 0x63, 0xb1, 0x6b, 0xb1, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x63, 0xb1, 0x73, 0xf2, 0xd6, 0x9b, 0xde, 0xfc, 0x74, 0x12, 0x63, 0x90, 0x53, 0x4f, 0x5b, 0x70, 0x5b, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x53, 0x0e, 0x63, 0x90, 0xb5, 0xb8, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xbe, 0x3a, 0x8c, 0xd6, 0x84, 0x96, 0x84, 0xb6, 0x84, 0xb6, 0x84, 0x96, 0x84, 0x96, 0x7c, 0x75, 0x84, 0xb6, 0xa5, 0x98, 0xe7, 0x1c, 0xe6, 0xfc, 0xce, 0x7a, 0x8c, 0xb6, 0x7c, 0x75, 0x7c, 0x75, 0x84, 0x95, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x55, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x74, 0x13, 0x6b, 0xf2, 0x63, 0xb1, 0x5b, 0x70, 0x5b, 0x4f, 0x53, 0x2e, 0x5b, 0x6f, 0x6b, 0xf2, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x6b, 0xf2, 0x63, 0xb1, 0x5b, 0x4f, 0x53, 0x2e, 0x5b, 0x4f, 0x5b, 0x6f, 0x63, 0x90, 0x63, 0xb1, 0x63, 0xb1, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x5b, 0x70, 0x5b, 0x70, 0x74, 0x12, 0x74, 0x12, 0x5b, 0x70, 0x5b, 0x4f, 0x63, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x6f, 0x53, 0x2f, 0x8c, 0x94, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xa5, 0x78, 0x84, 0x96, 0x84, 0xb6, 0x84, 0xb6, 0x84, 0x96, 0x84, 0x96, 0x84, 0x96, 0x84, 0x96, 0x7c, 0x75, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x7c, 0x75, 0x7c, 0x95, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x54, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x54, 0x74, 0x33, 0x6b, 0xf2, 0x63, 0xb1, 0x63, 0x90, 0x5b, 0x6f, 0x53, 0x2e, 0x4a, 0xed, 0x4a, 0xed, 0x4a, 0xed, 0x53, 0x2e, 0x6b, 0xd2, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x6b, 0xf2, 0x5b, 0x90, 0x4b, 0x0e, 0x4a, 0xed, 0x4a, 0xed, 0x4b, 0x0e, 0x53, 0x2e, 0x53, 0x4f, 0x5b, 0x6f, 0x5b, 0x70, 0x63, 0x91, 0x63, 0xb1, 0x6b, 0xd1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x4f, 0x5b, 0x70, 0x5b, 0x70, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x53, 0x4f, 0x5b, 0x6f, 0xa5, 0x36, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xad, 0x98, 0x7c, 0x75, 0x84, 0x96, 0x84, 0x96, 0x84, 0x96, 0x84, 0x96, 0x84, 0x96, 0x84, 0x96, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x7c, 0x75, 0x84, 0x95, 0x84, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x54, 0x74, 0x33, 0x6b, 0xf2, 0x63, 0x90, 0x53, 0x2f, 0x4b, 0x0d, 0x4b, 0x0d, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4a, 0xed, 0x53, 0x2e, 0x6b, 0xd2, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x6b, 0xf2, 0x63, 0x90, 0x53, 0x2e, 0x4a, 0xed, 0x4a, 0xed, 0x4b, 0x0d, 0x4b, 0x0d, 0x4b, 0x0e, 0x4b, 0x0e, 0x53, 0x0e, 0x53, 0x2f, 0x5b, 0x70, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x6f, 0x53, 0x2f, 0x6b, 0x90, 0xb5, 0x97, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xd6, 0xbb, 0x84, 0xb6, 0x7c, 0x75, 0x84, 0x96, 0x84, 0x96, 0x84, 0x96, 0x84, 0x96, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x7c, 0x75, 0x84, 0x75, 0x84, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x54, 0x6b, 0xf2, 0x5b, 0x70, 0x53, 0x2e, 0x53, 0x0e, 0x4b, 0x0e, 0x4a, 0xed, 0x4b, 0x0d, 0x4b, 0x0d, 0x4b, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4a, 0xed, 0x53, 0x2f, 0x6b, 0xd2, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x6b, 0xf2, 0x63, 0x90, 0x53, 0x2e, 0x4a, 0xed, 0x4a, 0xed, 0x4a, 0xed, 0x4a, 0xed, 0x4b, 0x0d, 0x4b, 0x0d, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x2e, 0x5b, 0x4f, 0x5b, 0x70, 0x63, 0x90, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x4f, 0x5b, 0x4f, 0x7b, 0xd0, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xce, 0x7b, 0x7c, 0x75, 0x7c, 0x75, 0x84, 0x96, 0x84, 0x96, 0x84, 0x96, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x7c, 0x95, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x84, 0x95, 0x7c, 0x75, 0x74, 0x13, 0x63, 0x91, 0x53, 0x4f, 0x53, 0x0e, 0x4a, 0xed, 0x4a, 0xed, 0x4b, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4a, 0xed, 0x4a, 0xed, 0x53, 0x0e, 0x63, 0x4e, 0x6b, 0x8f, 0x6b, 0xf2, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x6b, 0xd2, 0x5b, 0x4f, 0x4a, 0xcc, 0x52, 0xed, 0x5b, 0x6f, 0x5b, 0x4e, 0x4a, 0xed, 0x42, 0xcd, 0x4a, 0xed, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x70, 0x63, 0x90, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x53, 0x2f, 0x6b, 0x6f, 0xad, 0x35, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xc6, 0x5a, 0x84, 0x75, 0x7c, 0x75, 0x84, 0x96, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x75, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x7c, 0x54, 0x6b, 0xf2, 0x5b, 0x6f, 0x4b, 0x0d, 0x4a, 0xed, 0x4b, 0x0d, 0x53, 0x0e, 0x4b, 0x0e, 0x4b, 0x0d, 0x4a, 0xed, 0x52, 0xed, 0x5b, 0x0e, 0x6b, 0x8f, 0x84, 0x52, 0xbd, 0xd8, 0xe6, 0xfc, 0xde, 0xdb, 0x7c, 0x53, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x6b, 0xb1, 0x5b, 0x0e, 0x6b, 0x4e, 0xce, 0x59, 0xde, 0xfc, 0xde, 0xfc, 0xde, 0xdb, 0x84, 0x73, 0x6b, 0xd1, 0x53, 0x2e, 0x4a, 0xee, 0x53, 0x0e, 0x53, 0x2f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x70, 0x63, 0x90, 0x63, 0xb1, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x4f, 0x5b, 0x2e, 0x7b, 0xb0, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x8c, 0xf7, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x7c, 0x75, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x7c, 0x54, 0x63, 0xb1, 0x53, 0x2e, 0x4b, 0x0d, 0x4b, 0x0d, 0x4b, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x63, 0x4e, 0x73, 0xd0, 0x8c, 0x52, 0xde, 0xfb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x94, 0xf6, 0x74, 0x13, 0x6b, 0xf2, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x63, 0x91, 0x6b, 0x90, 0xbd, 0xb7, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xdb, 0x84, 0x73, 0x6b, 0xb0, 0x5b, 0x4f, 0x53, 0x2f, 0x53, 0x2f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x6f, 0x5b, 0x70, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x53, 0x0e, 0x6b, 0x4f, 0xc5, 0xf8, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x94, 0xf7, 0x7c, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x74, 0x33, 0x63, 0x90, 0x53, 0x0e, 0x4b, 0x0d, 0x4b, 0x0d, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x52, 0xee, 0x63, 0x2e, 0x7b, 0xf0, 0xd6, 0x9a, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x95, 0x16, 0x74, 0x13, 0x6b, 0xf2, 0x74, 0x13, 0x74, 0x13, 0x6c, 0x13, 0x63, 0xb1, 0x73, 0xd1, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xd6, 0x9a, 0x6b, 0xb1, 0x53, 0x4f, 0x53, 0x4f, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x63, 0x70, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x53, 0x2e, 0x7b, 0xf1, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x94, 0xf6, 0x7c, 0x75, 0x7c, 0x75, 0x84, 0x95, 0x84, 0x95, 0x7c, 0x75, 0x84, 0x95, 0x84, 0x95, 0x84, 0x95, 0x74, 0x33, 0x5b, 0x90, 0x4b, 0x0e, 0x4a, 0xed, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4a, 0xed, 0x5b, 0x2e, 0x73, 0xb0, 0xd6, 0xba, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x94, 0xf6, 0x74, 0x13, 0x6b, 0xf2, 0x6b, 0xf3, 0x6b, 0xf3, 0x6b, 0xf2, 0x6b, 0xb1, 0x73, 0xd1, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xce, 0x7a, 0x6b, 0xf1, 0x53, 0x2f, 0x5b, 0x4f, 0x63, 0x90, 0x5b, 0x70, 0x63, 0x70, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x6f, 0x53, 0x2f, 0x74, 0x12, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xc6, 0x3a, 0x84, 0xb5, 0x7c, 0x75, 0x84, 0x95, 0x84, 0x95, 0x7c, 0x75, 0x7c, 0x75, 0x84, 0x95, 0x84, 0x95, 0x74, 0x13, 0x5b, 0x70, 0x4b, 0x0e, 0x4b, 0x0d, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x0d, 0x63, 0x6f, 0x8c, 0x31, 0xde, 0xbb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x95, 0x16, 0x74, 0x13, 0x6b, 0xf2, 0x6c, 0x13, 0x6c, 0x13, 0x6b, 0xf2, 0x6b, 0xd1, 0x73, 0xf1, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xce, 0x9a, 0x74, 0x32, 0x5b, 0x70, 0x5b, 0x70, 0x63, 0xb0, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x53, 0x4f, 0x63, 0xb0, 0xad, 0x97, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x8c, 0xb6, 0x7c, 0x75, 0x84, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x84, 0x95, 0x84, 0x95, 0x74, 0x33, 0x5b, 0x70, 0x4b, 0x0d, 0x4b, 0x0d, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x6b, 0x8f, 0xc5, 0xf8, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x95, 0x16, 0x74, 0x13, 0x6b, 0xf2, 0x6c, 0x13, 0x6c, 0x13, 0x6b, 0xf2, 0x6b, 0xd1, 0x7b, 0xf1, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x9d, 0x36, 0x63, 0x90, 0x63, 0x90, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x53, 0x2f, 0x63, 0x90, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xdb, 0xbd, 0xf8, 0xb5, 0xd8, 0xad, 0x77, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xad, 0xd9, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x84, 0x95, 0x84, 0x95, 0x74, 0x34, 0x5b, 0x90, 0x4b, 0x0e, 0x4b, 0x0d, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x2e, 0x52, 0xed, 0x7b, 0xf0, 0xd6, 0xba, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x95, 0x16, 0x74, 0x13, 0x6b, 0xf2, 0x74, 0x13, 0x73, 0xf2, 0x6b, 0xf2, 0x6b, 0xd1, 0x7b, 0xf1, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xc6, 0x39, 0x6b, 0xf2, 0x5b, 0x70, 0x63, 0xb1, 0x63, 0xd1, 0x63, 0xd1, 0x63, 0xb1, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x53, 0x2f, 0x5b, 0x4f, 0xa5, 0x56, 0xc6, 0x39, 0xc6, 0x39, 0xc6, 0x39, 0xad, 0x97, 0x74, 0x11, 0x63, 0x70, 0x53, 0x2e, 0x4b, 0x0e, 0x74, 0x12, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x95, 0x17, 0x9d, 0x37, 0xde, 0xdb, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xc6, 0x3a, 0x7c, 0x75, 0x7c, 0x75, 0x84, 0x95, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x84, 0x95, 0x74, 0x54, 0x63, 0xb0, 0x53, 0x0e, 0x4a, 0xed, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x2e, 0x5b, 0x0d, 0x83, 0xf0, 0xd6, 0xba, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x95, 0x16, 0x74, 0x13, 0x6b, 0xf2, 0x6c, 0x13, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xb1, 0x7b, 0xf1, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xc6, 0x39, 0x73, 0xf2, 0x63, 0x91, 0x6b, 0xd1, 0x6b, 0xd2, 0x6b, 0xd1, 0x63, 0x91, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x6f, 0x5b, 0x4f, 0x5b, 0x6f, 0x63, 0xb0, 0x63, 0xb0, 0x5b, 0x6f, 0x53, 0x0e, 0x53, 0x0e, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x4f, 0x84, 0x93, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x8c, 0xb6, 0x7c, 0x54, 0x7c, 0x75, 0x84, 0x95, 0x8c, 0xd6, 0x95, 0x16, 0xa5, 0x57, 0xc6, 0x3a, 0xad, 0xb8, 0x8c, 0xd6, 0x7c, 0x75, 0x84, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x54, 0x63, 0xd1, 0x53, 0x0e, 0x4a, 0xed, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x2e, 0x52, 0xed, 0x83, 0xf1, 0xde, 0xbb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x95, 0x16, 0x74, 0x13, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xb1, 0x7b, 0xf1, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xc6, 0x39, 0x74, 0x12, 0x6b, 0xd1, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x6f, 0x5b, 0x4f, 0x5b, 0x4f, 0x53, 0x4f, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x4a, 0xed, 0x6b, 0xd0, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xdc, 0x84, 0x95, 0x74, 0x34, 0x7c, 0x75, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x84, 0x75, 0x84, 0xb5, 0x84, 0x95, 0x7c, 0x75, 0x84, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x84, 0x75, 0x7c, 0x75, 0x6b, 0xf2, 0x53, 0x2f, 0x4b, 0x0d, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0d, 0x7b, 0xf0, 0xde, 0xbb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x94, 0xf6, 0x74, 0x13, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xb1, 0x7b, 0xf1, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xc6, 0x39, 0x73, 0xf2, 0x6b, 0xd1, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd1, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x6f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x4a, 0xee, 0x53, 0x4f, 0xc6, 0x39, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x8c, 0xb5, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x74, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x74, 0x34, 0x5b, 0x70, 0x4a, 0xed, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0d, 0x73, 0x8f, 0xd6, 0x9a, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x95, 0x16, 0x74, 0x13, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xb1, 0x7b, 0xf1, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x8c, 0xd5, 0x63, 0xb2, 0x6b, 0xf2, 0x74, 0x13, 0x73, 0xf2, 0x6b, 0xd1, 0x5b, 0x70, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x0e, 0x53, 0x2e, 0x6b, 0xf1, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x74, 0x34, 0x74, 0x34, 0x7c, 0x54, 0x7c, 0x74, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x55, 0x7c, 0x74, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x54, 0x7c, 0x75, 0x7c, 0x54, 0x63, 0xb1, 0x53, 0x2e, 0x4b, 0x0d, 0x53, 0x2e, 0x53, 0x2e, 0x4a, 0xed, 0x6b, 0x4e, 0xc6, 0x18, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x94, 0xf6, 0x74, 0x13, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xb1, 0x73, 0xf1, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x84, 0x94, 0x6b, 0xf2, 0x6b, 0xf3, 0x74, 0x13, 0x6b, 0xf2, 0x63, 0x91, 0x5b, 0x70, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x5b, 0x4f, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xd6, 0xbb, 0x74, 0x34, 0x74, 0x34, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x75, 0x7c, 0x74, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x75, 0x74, 0x13, 0x53, 0x2f, 0x4b, 0x0d, 0x53, 0x0e, 0x53, 0x2e, 0x4b, 0x0e, 0x63, 0x2e, 0x94, 0x72, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x95, 0x16, 0x74, 0x13, 0x6b, 0xd2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xb1, 0x73, 0xf1, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xdb, 0x74, 0x13, 0x6b, 0xf2, 0x74, 0x13, 0x74, 0x13, 0x6b, 0xf2, 0x5b, 0x70, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x4b, 0x0e, 0x53, 0x2e, 0x84, 0x52, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xd6, 0x9b, 0x74, 0x34, 0x74, 0x34, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x74, 0x74, 0x54, 0x63, 0xb1, 0x53, 0x0e, 0x4b, 0x0d, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x84, 0x11, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x95, 0x16, 0x74, 0x13, 0x6b, 0xd2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xb1, 0x73, 0xf1, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x95, 0x16, 0x74, 0x33, 0x74, 0x13, 0x74, 0x33, 0x74, 0x13, 0x63, 0xb1, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x0e, 0x5b, 0x2e, 0x7c, 0x11, 0xde, 0xdb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xbe, 0x39, 0x7c, 0x54, 0x74, 0x13, 0x74, 0x34, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x74, 0x6b, 0xf2, 0x5b, 0x4f, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x0e, 0x6b, 0x4e, 0xde, 0xbb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x84, 0x94, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x63, 0xb1, 0x73, 0xf2, 0xde, 0xdb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x84, 0x74, 0x6b, 0xf3, 0x74, 0x34, 0x74, 0x34, 0x6b, 0xf2, 0x5b, 0x70, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x52, 0xee, 0x63, 0x4f, 0xad, 0x56, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xfc, 0xa5, 0x77, 0x7c, 0x74, 0x74, 0x13, 0x74, 0x34, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x63, 0xb1, 0x4b, 0x0d, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x0e, 0x5b, 0x2e, 0x84, 0x11, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xde, 0xdb, 0x94, 0xd5, 0x74, 0x13, 0x6b, 0xd2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd1, 0x6b, 0xd2, 0x84, 0x73, 0xde, 0xdb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xbd, 0xf9, 0x74, 0x13, 0x74, 0x34, 0x7c, 0x54, 0x74, 0x33, 0x63, 0xb1, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x4f, 0x53, 0x2e, 0x52, 0xed, 0x73, 0x8f, 0xbd, 0xf8, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xce, 0x7a, 0x84, 0x95, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x74, 0x13, 0x5b, 0x70, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x0e, 0x6b, 0x6f, 0xde, 0xdb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xfb, 0x84, 0x94, 0x7c, 0x53, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xf2, 0x6b, 0xd2, 0x74, 0x13, 0x84, 0x94, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x8c, 0xb5, 0x74, 0x34, 0x7c, 0x54, 0x7c, 0x75, 0x6b, 0xf2, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x2f, 0x53, 0x2f, 0x53, 0x4f, 0x5b, 0x0e, 0x6b, 0x2d, 0xc5, 0xf8, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xce, 0x7a, 0x84, 0x95, 0x7c, 0x34, 0x74, 0x34, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x6b, 0xd1, 0x53, 0x4f, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x2e, 0x5b, 0x0e, 0x84, 0x11, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xbe, 0x19, 0x74, 0x33, 0x63, 0xd2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x63, 0xb1, 0x63, 0x91, 0x73, 0xf2, 0xce, 0x7a, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xce, 0x9b, 0x74, 0x34, 0x7c, 0x54, 0x84, 0x75, 0x74, 0x13, 0x63, 0x90, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x2f, 0x53, 0x2f, 0x5b, 0x6f, 0x53, 0x0e, 0xb5, 0x96, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xdc, 0x84, 0x95, 0x7c, 0x54, 0x74, 0x34, 0x7c, 0x34, 0x74, 0x34, 0x7c, 0x54, 0x74, 0x33, 0x5b, 0x90, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x63, 0x4e, 0xbd, 0xb7, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x8c, 0xb5, 0x63, 0xd1, 0x63, 0xb1, 0x6b, 0xf2, 0x6b, 0xf2, 0x73, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd2, 0x6b, 0xf2, 0x5b, 0x70, 0x63, 0xb1, 0x8c, 0xb4, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x7c, 0x54, 0x7c, 0x55, 0x84, 0x95, 0x7c, 0x54, 0x6b, 0xd2, 0x5b, 0x4f, 0x53, 0x2f, 0x5b, 0x4f, 0x53, 0x2f, 0x53, 0x2f, 0x5b, 0x70, 0x5b, 0x4f, 0xde, 0xbb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xd6, 0xbb, 0x7c, 0x54, 0x7c, 0x54, 0x74, 0x34, 0x74, 0x34, 0x74, 0x34, 0x7c, 0x54, 0x74, 0x13, 0x5b, 0x4f, 0x4b, 0x0d, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x7b, 0xd0, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x95, 0x16, 0x63, 0x91, 0x6b, 0xd1, 0x6b, 0xb1, 0x74, 0x12, 0x73, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x91, 0x63, 0xb1, 0x6b, 0xd1, 0x6b, 0xd2, 0x63, 0xb1, 0x63, 0x90, 0x5b, 0x6f, 0x6b, 0xd1, 0x63, 0x90, 0xad, 0x97, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x8c, 0xb6, 0x7c, 0x75, 0x84, 0x95, 0x84, 0x95, 0x74, 0x13, 0x5b, 0x4f, 0x53, 0x2e, 0x5b, 0x4f, 0x53, 0x2f, 0x53, 0x2f, 0x5b, 0x4f, 0x53, 0x0e, 0xb5, 0xd7, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xd6, 0xbb, 0x74, 0x13, 0x7c, 0x54, 0x74, 0x33, 0x74, 0x34, 0x74, 0x34, 0x74, 0x33, 0x6b, 0xf2, 0x5b, 0x4f, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x2e, 0x5b, 0x0e, 0xad, 0x55, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xbe, 0x39, 0x6b, 0xf2, 0x5b, 0x6f, 0x5b, 0x6f, 0x95, 0x15, 0xa5, 0x77, 0x7c, 0x74, 0x6b, 0xd2, 0x63, 0x91, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0xb1, 0x6b, 0xd1, 0x6b, 0xb1, 0x63, 0x91, 0x63, 0x91, 0x73, 0xd1, 0x7c, 0x32, 0x84, 0x73, 0x63, 0x6f, 0x5b, 0x50, 0x6b, 0xd1, 0xd6, 0xbb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xdb, 0x84, 0x95, 0x7c, 0x75, 0x84, 0xb6, 0x74, 0x54, 0x5b, 0x4f, 0x53, 0x2e, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x2f, 0x53, 0x4f, 0x4b, 0x0e, 0x7c, 0x11, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xc6, 0x5a, 0x6b, 0xf3, 0x7c, 0x54, 0x74, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0x13, 0x63, 0xb1, 0x53, 0x4f, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x2e, 0x63, 0x4e, 0xde, 0xfb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xdc, 0x7c, 0x33, 0x63, 0xb2, 0x5b, 0x6f, 0x84, 0x93, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x84, 0x73, 0x7c, 0x32, 0x8c, 0xb4, 0xad, 0x97, 0xad, 0x76, 0xad, 0x97, 0xb5, 0xd8, 0x94, 0xf5, 0x74, 0x12, 0x7c, 0x32, 0xb5, 0x97, 0xe6, 0xfc, 0xe6, 0xfc, 0x94, 0xf5, 0x63, 0x90, 0x5b, 0x70, 0x74, 0x32, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x8c, 0xb6, 0x7c, 0x75, 0x8c, 0xb6, 0x7c, 0x75, 0x63, 0x90, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x4f, 0x53, 0x0e, 0x6b, 0xb0, 0xde, 0xdb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x95, 0x16, 0x6b, 0xd2, 0x74, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0x13, 0x63, 0x90, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x73, 0xaf, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x84, 0x94, 0x6b, 0xf2, 0x6b, 0xf2, 0x63, 0x91, 0x94, 0xd4, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xd6, 0x9a, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xce, 0x9a, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x9d, 0x16, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0xa5, 0x76, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x8c, 0xf7, 0x7c, 0x75, 0x8c, 0xd7, 0x84, 0x95, 0x6b, 0xd2, 0x5b, 0x4f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x0e, 0x5b, 0x4f, 0x84, 0x52, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xfc, 0x8c, 0xb5, 0x6b, 0xf3, 0x74, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0x34, 0x6b, 0xf2, 0x5b, 0x70, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x7b, 0xf1, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xdb, 0x74, 0x13, 0x74, 0x13, 0x6b, 0xf2, 0x63, 0xb2, 0x7c, 0x53, 0xd6, 0xbb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xc6, 0x5a, 0x74, 0x33, 0x5b, 0x90, 0x63, 0x90, 0x63, 0x90, 0x6b, 0xd1, 0xde, 0xdb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x95, 0x17, 0x7c, 0x75, 0x8c, 0xd6, 0x84, 0x96, 0x74, 0x13, 0x5b, 0x70, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x4e, 0x6b, 0xf1, 0x6b, 0xd0, 0x6b, 0xd1, 0x5b, 0x6f, 0x84, 0x73, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xde, 0xfc, 0xbe, 0x19, 0x84, 0x95, 0x74, 0x33, 0x74, 0x13, 0x74, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0x33, 0x6b, 0xf2, 0x5b, 0x90, 0x5b, 0x4f, 0x5b, 0x70, 0x5b, 0x4f, 0x5b, 0x4f, 0x84, 0x12, 0xde, 0xdb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xc6, 0x39, 0x6b, 0xd2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x63, 0xb1, 0x74, 0x12, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x7c, 0x53, 0x63, 0x91, 0x63, 0x90, 0x63, 0xb1, 0x63, 0x90, 0x5b, 0x50, 0xad, 0x77, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xfc, 0x84, 0x95, 0x74, 0x34, 0x7c, 0x75, 0x7c, 0x54, 0x6b, 0xf2, 0x5b, 0x70, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x4a, 0xed, 0x4a, 0xed, 0x4a, 0xed, 0x4b, 0x0d, 0x4a, 0xed, 0x53, 0x4e, 0x7c, 0x32, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe7, 0x1c, 0xa5, 0x77, 0x94, 0xf6, 0x8c, 0xd5, 0x84, 0x74, 0x7c, 0x53, 0x74, 0x33, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x33, 0x74, 0x13, 0x6b, 0xd2, 0x6b, 0xd1, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd1, 0x74, 0x12, 0x8c, 0xb5, 0xc6, 0x5a, 0xd6, 0xdb, 0xce, 0x9b, 0xce, 0x9b, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xce, 0x7a, 0xd6, 0x9b, 0xbe, 0x19, 0x8c, 0xb5, 0x74, 0x33, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x5b, 0x70, 0x63, 0x90, 0xd6, 0x9a, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x74, 0x12, 0x5b, 0x70, 0x63, 0x90, 0x63, 0xb1, 0x63, 0x90, 0x5b, 0x70, 0x6b, 0xd1, 0x84, 0x73, 0x94, 0xd5, 0x94, 0xf5, 0x8c, 0xd5, 0x8c, 0xd5, 0x8c, 0xd4, 0x8c, 0xd4, 0x8c, 0xd4, 0x8c, 0xd4, 0x8c, 0xd4, 0x8c, 0xd4, 0x8c, 0xb4, 0x8c, 0xb4, 0x8c, 0xd4, 0x7c, 0x53, 0x63, 0xb1, 0x63, 0x91, 0x63, 0xb1, 0x63, 0xb1, 0x5b, 0x70, 0x5b, 0x4f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0d, 0x42, 0xcd, 0x4b, 0x0d, 0xe6, 0xfc,
-  0xe7, 0x1c, 0x74, 0x13, 0x6b, 0xf2, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x6b, 0xf3, 0x6b, 0xf3, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0x13, 0x6b, 0xf3, 0x6b, 0xf3, 0x74, 0x13, 0x6c, 0x13, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x5b, 0x70, 0x63, 0x90, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x9d, 0x57, 0x63, 0xb1, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x6f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x53, 0x2f, 0x5b, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x42, 0xcd, 0x5b, 0x6f, 0xe6, 0xfc,
-  0xde, 0xfc, 0x74, 0x13, 0x63, 0xb2, 0x6b, 0xf2, 0x6b, 0xf2, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x5b, 0x70, 0x6b, 0xb0, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xad, 0x98, 0x6b, 0xf2, 0x5b, 0x70, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x53, 0x4f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x42, 0xcd, 0x53, 0x2e, 0xbd, 0xf8,
-  0xde, 0xfc, 0x7c, 0x53, 0x6b, 0xd2, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x5b, 0x70, 0x73, 0xd0, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xb5, 0xd9, 0x74, 0x13, 0x5b, 0x70, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x6f, 0x5b, 0x6f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4a, 0xed, 0x53, 0x0e, 0x84, 0x52,
-  0xe7, 0x1c, 0x7c, 0x74, 0x6b, 0xd2, 0x6b, 0xf2, 0x74, 0x13, 0x6c, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x63, 0x70, 0x73, 0xd1, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xad, 0xb9, 0x6b, 0xf2, 0x5b, 0x70, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x6f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4a, 0xed, 0x4a, 0xed, 0x84, 0x31,
-  0xe7, 0x1c, 0x7c, 0x53, 0x63, 0xd2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x12, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x6c, 0x13, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x63, 0xd2, 0x63, 0xb2, 0x63, 0xb2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x63, 0x90, 0x73, 0xf1, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xa5, 0x78, 0x6b, 0xd2, 0x5b, 0x70, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x90, 0x5b, 0x70, 0x5b, 0x50, 0x5b, 0x4f, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x4b, 0x0d, 0x4a, 0xed, 0x4a, 0xed, 0x4a, 0xed, 0x4a, 0xcd, 0x5b, 0x4e, 0xc6, 0x59,
-  0xe7, 0x1c, 0x6b, 0xf2, 0x63, 0xb1, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf3, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf3, 0x74, 0x13, 0x74, 0x13, 0x74, 0x12, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x6c, 0x12, 0x6b, 0xf2, 0x6b, 0xf2, 0x73, 0xf2, 0x73, 0xf2, 0x6c, 0x12, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x63, 0x91, 0x73, 0xf2, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x8c, 0xb5, 0x63, 0x91, 0x5b, 0x70, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x6f, 0x5b, 0x6f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x4b, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x2e, 0x63, 0x8f, 0x84, 0x32, 0xe7, 0x1c,
-  0xe7, 0x1c, 0x84, 0x74, 0x6b, 0xd2, 0x63, 0xb1, 0x6b, 0xd2, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x73, 0xf2, 0x74, 0x13, 0x6b, 0xf2, 0x63, 0x90, 0x5b, 0x90, 0x5b, 0x90, 0x5b, 0x90, 0x5b, 0x70, 0x63, 0x4f, 0x73, 0xb0, 0x84, 0x73, 0xce, 0x5a, 0xde, 0xfc, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xfc, 0xce, 0x5a, 0x8c, 0xb4, 0x74, 0x12, 0x6b, 0xd1, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd1, 0x5b, 0x91, 0x74, 0x12, 0xd6, 0xbb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xfc, 0x73, 0xf2, 0x5b, 0x4f, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x4f, 0x63, 0x4f, 0x73, 0xb0, 0x84, 0x32, 0x8c, 0xb4, 0xbe, 0x19, 0xce, 0x7a, 0xce, 0x5a, 0xce, 0x5a, 0xce, 0x5a, 0xce, 0x5a, 0xce, 0x5a, 0xce, 0x7a, 0xc6, 0x59, 0xa5, 0x36, 0x7c, 0x32, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x4f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x52, 0xcd, 0x52, 0xed, 0x6b, 0x8f, 0x8c, 0x72, 0xd6, 0x9a, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe7, 0x1c, 0xc6, 0x39, 0x8c, 0xd5, 0x84, 0x94, 0x84, 0x94, 0x84, 0x74, 0x7c, 0x53, 0x73, 0xf2, 0x73, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x74, 0x13, 0x6b, 0xd1, 0x53, 0x4f, 0x4b, 0x0e, 0x53, 0x0e, 0x4b, 0x0d, 0x4a, 0xcd, 0x6b, 0x6f, 0xc6, 0x19, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xce, 0x5a, 0x63, 0xb1, 0x6b, 0xd1, 0x6b, 0xd2, 0x6b, 0xd1, 0x63, 0x91, 0x7c, 0x12, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x7c, 0x53, 0x63, 0x90, 0x5b, 0x70, 0x63, 0x90, 0x5b, 0x70, 0x63, 0x90, 0x63, 0x6f, 0x83, 0xf0, 0xde, 0xfb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xdb, 0x73, 0xf2, 0x63, 0x91, 0x6b, 0xd1, 0x63, 0xb1, 0x63, 0x70, 0x53, 0x4f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x4a, 0xed, 0x52, 0xac, 0x7b, 0xd0, 0xde, 0xdb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xe7, 0x1c, 0xe6, 0xfc, 0xe7, 0x1c, 0xce, 0x7a, 0x84, 0x74, 0x73, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd1, 0x5b, 0x4f, 0x4b, 0x0e, 0x4b, 0x0d, 0x4a, 0xed, 0x4a, 0xed, 0x8c, 0x73, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xdb, 0x73, 0xf2, 0x6b, 0xd1, 0x6b, 0xd1, 0x63, 0xb1, 0x6b, 0xd1, 0xad, 0x97, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xfc, 0x74, 0x12, 0x5b, 0x4f, 0x5b, 0x70, 0x63, 0x90, 0x63, 0x70, 0x7b, 0xf1, 0xde, 0xdb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x7c, 0x33, 0x63, 0x91, 0x6b, 0xf2, 0x6b, 0xd1, 0x5b, 0x90, 0x53, 0x4f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x2e, 0x4a, 0xed, 0x6b, 0x6e, 0xde, 0xbb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xdb, 0x7c, 0x74, 0x63, 0xb1, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xd2, 0x5b, 0x70, 0x53, 0x0e, 0x4b, 0x0d, 0x4a, 0xed, 0x4a, 0xed, 0x8c, 0x52, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x8c, 0xb4, 0x63, 0xb1, 0x63, 0xb1, 0x5b, 0x70, 0x74, 0x12, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xd6, 0x9b, 0x95, 0x16, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xc6, 0x3a, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x95, 0x15, 0x5b, 0x70, 0x5b, 0x4f, 0x5b, 0x4f, 0x73, 0xd1, 0xde, 0xdb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x74, 0x33, 0x63, 0xb1, 0x6b, 0xf2, 0x6b, 0xd1, 0x5b, 0x6f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x4b, 0x0e, 0x53, 0x0d, 0x84, 0x11, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xc6, 0x39, 0x63, 0x91, 0x73, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xf2, 0x6b, 0xd2, 0x63, 0x90, 0x53, 0x2e, 0x4a, 0xed, 0x4a, 0xed, 0x4a, 0xed, 0x73, 0xd0, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xfc, 0x74, 0x12, 0x5b, 0x70, 0x5b, 0x70, 0x74, 0x11, 0xde, 0xdb, 0xe6, 0xfc, 0xe7, 0x1c, 0x7c, 0x33, 0x6b, 0xd2, 0x7c, 0x53, 0xad, 0x98, 0xad, 0xb8, 0xad, 0xb8, 0xb5, 0xb8, 0x8c, 0xb5, 0x74, 0x13, 0x7c, 0x33, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x9d, 0x37, 0x6b, 0xd2, 0x53, 0x2f, 0x6b, 0xd1, 0xde, 0xbb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xdb, 0x74, 0x13, 0x6b, 0xd2, 0x6b, 0xf2, 0x63, 0xd1, 0x53, 0x4f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x4a, 0xed, 0x52, 0xed, 0x94, 0x93, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xd6, 0xbb, 0x6b, 0xb1, 0x74, 0x12, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x63, 0xb1, 0x53, 0x2e, 0x4a, 0xed, 0x4a, 0xed, 0x4a, 0xed, 0x63, 0x8f, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xd6, 0x9b, 0x63, 0xb1, 0x5b, 0x50, 0x6b, 0xd1, 0x84, 0x74, 0x94, 0xf5, 0x7c, 0x33, 0x5b, 0x70, 0x63, 0x90, 0x63, 0xb1, 0x6b, 0xd2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x63, 0xb1, 0x5b, 0x4f, 0x5b, 0x4f, 0x74, 0x12, 0x9d, 0x36, 0x9d, 0x36, 0x84, 0x74, 0x63, 0xb1, 0x5b, 0x70, 0xc6, 0x59, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x8c, 0xd5, 0x6b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x63, 0xb1, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x4a, 0xed, 0x63, 0x4e, 0xd6, 0x9a, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xd6, 0xbb, 0x74, 0x12, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd1, 0x53, 0x4f, 0x4a, 0xed, 0x4b, 0x0d, 0x4a, 0xed, 0x53, 0x2e, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xc6, 0x19, 0x63, 0xb1, 0x6b, 0xf2, 0x6b, 0xd1, 0x6b, 0xd1, 0x63, 0xb1, 0x63, 0x90, 0x63, 0xb1, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x90, 0x5b, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x63, 0xb1, 0x6b, 0xd1, 0x6b, 0xd1, 0x63, 0xb1, 0xce, 0x7a, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x74, 0x33, 0x6b, 0xf2, 0x74, 0x13, 0x6b, 0xf2, 0x63, 0x91, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x4a, 0xed, 0x6b, 0xb0, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x8c, 0xb4, 0x63, 0xb1, 0x6b, 0xd1, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd1, 0x5b, 0x6f, 0x4b, 0x0e, 0x4b, 0x0d, 0x4a, 0xed, 0x4a, 0xcd, 0xb5, 0xd8, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x9d, 0x36, 0x6b, 0xd1, 0x5b, 0x70, 0x63, 0xb1, 0x63, 0x90, 0x63, 0xb0, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x6f, 0x63, 0xb0, 0xa5, 0x56, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xfb, 0x6b, 0xf2, 0x6b, 0xf2, 0x74, 0x13, 0x6b, 0xd2, 0x5b, 0x70, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4a, 0xed, 0x5b, 0x6f, 0xce, 0x59, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x84, 0x94, 0x63, 0xb1, 0x6b, 0xd1, 0x6b, 0xd2, 0x6b, 0xd1, 0x6b, 0xd2, 0x6b, 0xd1, 0x63, 0x90, 0x53, 0x2e, 0x4b, 0x0d, 0x4a, 0xed, 0x42, 0xcd, 0x73, 0xf1, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xce, 0x7a, 0x74, 0x12, 0x63, 0x90, 0x53, 0x2f, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x90, 0x5b, 0x90, 0x5b, 0x4f, 0x63, 0x90, 0xc6, 0x59, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x94, 0xf6, 0x6b, 0xf2, 0x74, 0x13, 0x74, 0x13, 0x63, 0xb1, 0x53, 0x4f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x53, 0x0e, 0x6b, 0xd0, 0xce, 0x7a, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xbd, 0xf8, 0x6b, 0xf2, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd2, 0x63, 0xb1, 0x5b, 0x4f, 0x4b, 0x0d, 0x4a, 0xed, 0x4a, 0xed, 0x53, 0x0e, 0x94, 0xf5, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xb5, 0xb8, 0x7c, 0x32, 0x73, 0xf2, 0x63, 0xb1, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x70, 0x63, 0x70, 0x5b, 0x6f, 0x73, 0xd1, 0xde, 0xdb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xfc, 0x7c, 0x54, 0x74, 0x13, 0x74, 0x13, 0x74, 0x13, 0x63, 0x90, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0d, 0x4a, 0xed, 0x63, 0x8f, 0xc6, 0x39, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xbe, 0x19, 0x7c, 0x53, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd1, 0x5b, 0x70, 0x4b, 0x0e, 0x4b, 0x0d, 0x4b, 0x0e, 0x4a, 0xcd, 0x6b, 0xf1, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xe7, 0x1c, 0xd6, 0x9a, 0x6b, 0xd1, 0x5b, 0x70, 0x5b, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x4f, 0x63, 0x4f, 0x7b, 0xf1, 0xde, 0xdb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x94, 0xf6, 0x6c, 0x13, 0x74, 0x33, 0x74, 0x33, 0x6b, 0xf2, 0x5b, 0x70, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0d, 0x42, 0xcd, 0x4a, 0xed, 0x53, 0x4e, 0x6b, 0xf1, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xd6, 0xbb, 0x84, 0x94, 0x6b, 0xd2, 0x5b, 0x70, 0x63, 0xb1, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd1, 0x6b, 0xd1, 0x63, 0xb1, 0x6b, 0xd1, 0x6b, 0xd1, 0x63, 0x90, 0x53, 0x2f, 0x53, 0x0e, 0x53, 0x0e, 0x4a, 0xed, 0x5b, 0x6f, 0xd6, 0x9a, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x7c, 0x53, 0x63, 0x90, 0x5b, 0x70, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x90, 0x5b, 0x4f, 0x5b, 0x2e, 0x73, 0x8f, 0xde, 0xdb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xd6, 0xbb, 0x7c, 0x54, 0x74, 0x13, 0x74, 0x54, 0x74, 0x33, 0x63, 0xb1, 0x53, 0x2f, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0d, 0x42, 0xac, 0x42, 0xcd, 0xce, 0x7a, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xc6, 0x39, 0x6b, 0xd1, 0x5b, 0x70, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x5b, 0x70, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x2e, 0x73, 0xf1, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x8c, 0xb4, 0x63, 0x90, 0x5b, 0x70, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x2f, 0x63, 0x4f, 0xb5, 0x76, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x84, 0x95, 0x74, 0x34, 0x7c, 0x54, 0x7c, 0x54, 0x74, 0x13, 0x5b, 0x70, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4a, 0xed, 0x4a, 0xed, 0x8c, 0x93, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x6b, 0xd1, 0x63, 0x90, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x5b, 0x4f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x2e, 0xc6, 0x39, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x84, 0x94, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x2f, 0x6b, 0x90, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xd6, 0xbb, 0x7c, 0x54, 0x74, 0x34, 0x7c, 0x54, 0x74, 0x34, 0x63, 0xd1, 0x53, 0x2f, 0x4b, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4a, 0xed, 0x4b, 0x0e, 0xa5, 0x76, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x74, 0x32, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x5b, 0x90, 0x53, 0x4f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x63, 0xb0, 0xc6, 0x59, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x84, 0x94, 0x63, 0x90, 0x5b, 0x50, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x4f, 0x6b, 0xb0, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xdb, 0x84, 0x95, 0x7c, 0x54, 0x7c, 0x74, 0x7c, 0x74, 0x74, 0x13, 0x5b, 0x4f, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4b, 0x0d, 0x4b, 0x0d, 0x4b, 0x0d, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4a, 0xed, 0x5b, 0x2e, 0xd6, 0xbb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xce, 0x7a, 0x6b, 0xd1, 0x5b, 0x70, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x5b, 0x6f, 0x53, 0x2e, 0x53, 0x4f, 0x5b, 0x4f, 0x4b, 0x0e, 0x73, 0xf1, 0xce, 0x9a, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x84, 0x94, 0x63, 0x90, 0x5b, 0x4f, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x4f, 0x6b, 0xb0, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x8c, 0xf6, 0x74, 0x34, 0x7c, 0x75, 0x84, 0x75, 0x7c, 0x34, 0x63, 0xb1, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4a, 0xed, 0x42, 0xcd, 0x42, 0xcd, 0x42, 0xcd, 0x4a, 0xed, 0x4b, 0x0e, 0x4a, 0xed, 0x4a, 0xed, 0x73, 0xb0, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x74, 0x12, 0x5b, 0x70, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x70, 0x5b, 0x4f, 0x53, 0x2f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x74, 0x11, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x84, 0x94, 0x63, 0x90, 0x5b, 0x4f, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x4f, 0x6b, 0xb0, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x95, 0x17, 0x7c, 0x75, 0x7c, 0x75, 0x84, 0x95, 0x7c, 0x75, 0x6b, 0xf2, 0x53, 0x4f, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4a, 0xed, 0x5b, 0x2e, 0x63, 0x90, 0x63, 0xb0, 0x5b, 0x6f, 0x53, 0x0e, 0x4a, 0xed, 0x42, 0xcd, 0x5b, 0x4f, 0x94, 0x93, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x84, 0x94, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x90, 0x5b, 0x70, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x53, 0x4f, 0x5b, 0x4f, 0xb5, 0xd8, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x84, 0x94, 0x63, 0x90, 0x5b, 0x4f, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x4f, 0x6b, 0xb0, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xbe, 0x19, 0x7c, 0x75, 0x7c, 0x75, 0x84, 0x95, 0x84, 0x75, 0x74, 0x33, 0x5b, 0x70, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4a, 0xcd, 0x5a, 0xed, 0x8c, 0x52, 0xde, 0xdb, 0xde, 0xfc, 0xa5, 0x56, 0x7c, 0x52, 0x74, 0x11, 0x6b, 0xd0, 0x7c, 0x32, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x74, 0x12, 0x5b, 0x70, 0x63, 0x90, 0x63, 0xb1, 0x6b, 0xd1, 0x73, 0xf1, 0x8c, 0x73, 0xa5, 0x15, 0x73, 0xf1, 0x63, 0x90, 0x63, 0x90, 0x63, 0xb1, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x70, 0x5b, 0x4f, 0x63, 0x90, 0xa5, 0x56, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x84, 0x94, 0x5b, 0x90, 0x5b, 0x4f, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x4f, 0x6b, 0xb0, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xad, 0x98, 0x84, 0x95, 0x84, 0x95, 0x84, 0xb5, 0x84, 0x95, 0x74, 0x34, 0x5b, 0x90, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4b, 0x0d, 0x5b, 0x2e, 0xad, 0x35, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xa5, 0x57, 0xb5, 0xd8, 0xbd, 0xf8, 0xbd, 0xd8, 0xce, 0x39, 0xe7, 0x1c, 0xe7, 0x1c, 0xd6, 0x9a, 0x84, 0x74, 0x63, 0x90, 0x5b, 0x70, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x6f, 0x5b, 0x70, 0x63, 0x90, 0x5b, 0x4f, 0x63, 0x90, 0x9d, 0x15, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x84, 0x94, 0x5b, 0x90, 0x5b, 0x4f, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x4f, 0x5b, 0x4f, 0x6b, 0xb0, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xb5, 0xd9, 0x84, 0x96, 0x84, 0x95, 0x84, 0xb6, 0x84, 0xb6, 0x7c, 0x54, 0x63, 0xb1, 0x53, 0x2e, 0x4b, 0x0d, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x52, 0xed, 0x7b, 0xf0, 0xe6, 0xfb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x73, 0xf2, 0x5b, 0x70, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x7c, 0x32, 0xce, 0x7a, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x84, 0x93, 0x5b, 0x70, 0x5b, 0x4f, 0x5b, 0x70, 0x5b, 0x6f, 0x5b, 0x4f, 0x5b, 0x4f, 0x6b, 0xb0, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xfc, 0x8c, 0xf7, 0x7c, 0x75, 0x84, 0x96, 0x84, 0xb6, 0x84, 0xb6, 0x7c, 0x75, 0x6b, 0xb1, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4a, 0xed, 0x6b, 0x4e, 0xce, 0x59, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xc6, 0x39, 0x6b, 0xd1, 0x5b, 0x70, 0x5b, 0x70, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x90, 0x63, 0x90, 0x74, 0x12, 0xc6, 0x5a, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x84, 0x93, 0x5b, 0x70, 0x53, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x2f, 0x6b, 0xb0, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xc6, 0x5a, 0x8c, 0xd6, 0x84, 0x96, 0x84, 0x96, 0x8c, 0xd6, 0x84, 0xb6, 0x7c, 0x75, 0x63, 0xd1, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4a, 0xed, 0x52, 0xed, 0x83, 0xf0, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xa5, 0x77, 0x5b, 0x70, 0x5b, 0x70, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x63, 0x90, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x63, 0x90, 0x63, 0x90, 0x63, 0xb1, 0x63, 0xb1, 0x5b, 0x70, 0x6b, 0xf2, 0xa5, 0x77, 0xe6, 0xfc, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x84, 0x73, 0x5b, 0x70, 0x53, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x2f, 0x6b, 0xb0, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xfc, 0x9d, 0x57, 0x84, 0x96, 0x7c, 0x75, 0x84, 0x96, 0x8c, 0xb6, 0x8c, 0xd7, 0x7c, 0x75, 0x63, 0xb1, 0x53, 0x2e, 0x4b, 0x0d, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4a, 0xcd, 0x5b, 0x2e, 0xd6, 0x7a, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xbe, 0x19, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x90, 0x63, 0x90, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x91, 0x6b, 0xd2, 0xb5, 0xd8, 0xe7, 0x1c, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x84, 0x93, 0x5b, 0x70, 0x53, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x2e, 0x6b, 0x90, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xe7, 0x1c, 0xc6, 0x5a, 0x7c, 0x75, 0x7c, 0x75, 0x84, 0x95, 0x84, 0xb6, 0x84, 0xb6, 0x84, 0x96, 0x7c, 0x54, 0x63, 0xb1, 0x53, 0x0e, 0x4b, 0x0d, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x42, 0xcd, 0x5b, 0x4f, 0xde, 0xbb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x84, 0x73, 0x5b, 0x4f, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x63, 0x90, 0x63, 0x90, 0x63, 0xb1, 0x6b, 0xd1, 0x6b, 0xd1, 0x63, 0xb1, 0x6b, 0xb1, 0x6b, 0xd2, 0x74, 0x12, 0x84, 0x74, 0xde, 0xdb, 0xe7, 0x1c, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x84, 0x73, 0x5b, 0x70, 0x53, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x53, 0x4f, 0x53, 0x2e, 0x6b, 0x90, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xe7, 0x1c, 0xd6, 0xbb, 0x8c, 0xb6, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x75, 0x7c, 0x95, 0x84, 0x96, 0x84, 0xb6, 0x84, 0x95, 0x74, 0x33, 0x5b, 0x70, 0x4b, 0x0e, 0x4b, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4a, 0xed, 0x4b, 0x0e, 0x6b, 0xf1, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xbd, 0xf8, 0x63, 0x90, 0x5b, 0x4f, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x90, 0x63, 0x90, 0x6b, 0xb1, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x6b, 0xd2, 0x63, 0xb1, 0x6b, 0xd2, 0x7c, 0x74, 0x94, 0xf6, 0xce, 0x7a, 0xde, 0xdb, 0xe6, 0xfc, 0xe7, 0x1c, 0xe7, 0x1c, 0x7c, 0x32, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x53, 0x2f, 0x53, 0x0e, 0x6b, 0x90, 0xc6, 0x39, 0xe7, 0x1c, 0xe6, 0xfc, 0xde, 0xfc, 0xbe, 0x19, 0x8c, 0xd6, 0x7c, 0x75, 0x74, 0x34, 0x74, 0x34, 0x7c, 0x75, 0x84, 0x95, 0x84, 0x96, 0x84, 0x95, 0x7c, 0x54, 0x6b, 0xd1, 0x5b, 0x6f, 0x53, 0x0e, 0x4b, 0x0d, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x7c, 0x52, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xdb, 0x63, 0x90, 0x53, 0x2f, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x63, 0x90, 0x63, 0xb1, 0x6b, 0xd1, 0x6b, 0xf2, 0x73, 0xf2, 0x74, 0x13, 0x74, 0x13, 0x6b, 0xf2, 0x6b, 0xd2, 0x6b, 0xd2, 0x74, 0x13, 0x84, 0x95, 0xb5, 0xf9, 0xbd, 0xf9, 0x6b, 0xb1, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x53, 0x2f, 0x5b, 0x4f, 0x63, 0x90, 0x7c, 0x53, 0x8c, 0xd5, 0x84, 0x95, 0x74, 0x13, 0x6b, 0xf3, 0x74, 0x13, 0x74, 0x34, 0x7c, 0x54, 0x84, 0x75, 0x84, 0x95, 0x84, 0x75, 0x7c, 0x54, 0x6b, 0xf2, 0x63, 0x90, 0x53, 0x2e, 0x4b, 0x0d, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0d, 0x4a, 0xed, 0x53, 0x4e, 0xa5, 0x56, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xfb, 0x74, 0x32, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x6f, 0x5b, 0x6f, 0x5b, 0x6f, 0x5b, 0x70, 0x63, 0x90, 0x63, 0xb1, 0x6b, 0xd2, 0x6c, 0x12, 0x74, 0x13, 0x74, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0x33, 0x74, 0x34, 0x6c, 0x13, 0x5b, 0x70, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x53, 0x2f, 0x5b, 0x4f, 0x63, 0x91, 0x6b, 0xf2, 0x74, 0x13, 0x74, 0x13, 0x74, 0x33, 0x74, 0x34, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x7c, 0x54, 0x74, 0x34, 0x6b, 0xf2, 0x63, 0xb1, 0x53, 0x4f, 0x4b, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0d, 0x42, 0xac, 0x8c, 0xb3, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x94, 0xf5, 0x5b, 0x70, 0x5b, 0x6f, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x6f, 0x5b, 0x6f, 0x5b, 0x6f, 0x5b, 0x6f, 0x5b, 0x6f, 0x5b, 0x6f, 0x5b, 0x6f, 0x63, 0x90, 0x6b, 0xd1, 0x6b, 0xf2, 0x74, 0x13, 0x74, 0x33, 0x74, 0x33, 0x74, 0x34, 0x74, 0x34, 0x7c, 0x54, 0x74, 0x13, 0x5b, 0x90, 0x53, 0x2f, 0x5b, 0x4f, 0x5b, 0x4f, 0x53, 0x2f, 0x53, 0x2e, 0x5b, 0x4f, 0x63, 0x91, 0x6b, 0xf2, 0x74, 0x13, 0x74, 0x13, 0x74, 0x33, 0x74, 0x34, 0x74, 0x34, 0x74, 0x34, 0x74, 0x13, 0x6b, 0xd2, 0x5b, 0x70, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4b, 0x0d, 0x4a, 0xed, 0x4a, 0xed, 0x4a, 0xed, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0d, 0x3a, 0x8c, 0x63, 0x90, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x84, 0x73, 0x53, 0x2f, 0x5b, 0x4f, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x70, 0x5b, 0x6f, 0x5b, 0x6f, 0x5b, 0x6f, 0x5b, 0x4f, 0x53, 0x4f, 0x53, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x6f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x70, 0x5b, 0x90, 0x63, 0x90, 0x6b, 0xd1, 0x6b, 0xf2, 0x74, 0x13, 0x7c, 0x54, 0x7c, 0x75, 0x7c, 0x54, 0x63, 0x90, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x5b, 0x4f, 0x63, 0x91, 0x74, 0x13, 0x74, 0x33, 0x74, 0x13, 0x6b, 0xf2, 0x6b, 0xf2, 0x63, 0xb1, 0x63, 0x90, 0x5b, 0x6f, 0x5b, 0x4f, 0x53, 0x2e, 0x4b, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4a, 0xed, 0x52, 0xed, 0x5b, 0x2e, 0x53, 0x0e, 0x42, 0xed, 0x4b, 0x0d, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0d, 0x4a, 0xed, 0x7c, 0x32, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0x9d, 0x36, 0x5b, 0x70, 0x53, 0x2f, 0x5b, 0x70, 0x5b, 0x6f, 0x5b, 0x6f, 0x5b, 0x6f, 0x5b, 0x4f, 0x5b, 0x70, 0x53, 0x4f, 0x5b, 0x2e, 0x63, 0x6f, 0x63, 0x90, 0x53, 0x4f, 0x53, 0x2f, 0x5b, 0x6f, 0x5b, 0x6f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x6f, 0x63, 0x90, 0x63, 0xb1, 0x6b, 0xd1, 0x6b, 0xf2, 0x6b, 0xd2, 0x5b, 0x70, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2f, 0x5b, 0x70, 0x63, 0xb1, 0x63, 0xb1, 0x63, 0x90, 0x5b, 0x90, 0x5b, 0x70, 0x53, 0x4f, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4a, 0xed, 0x63, 0x2e, 0x7b, 0xd0, 0xc6, 0x39, 0xce, 0x9a, 0x74, 0x11, 0x4b, 0x0e, 0x42, 0xcd, 0x53, 0x0e, 0x4b, 0x0e, 0x4b, 0x0d, 0x42, 0xcd, 0x6b, 0xb0, 0xc6, 0x18, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x84, 0x73, 0x5b, 0x70, 0x53, 0x2f, 0x5b, 0x4f, 0x5b, 0x6f, 0x5b, 0x4f, 0x53, 0x4f, 0x53, 0x2f, 0x63, 0x6f, 0x7b, 0xb0, 0x9c, 0xd4, 0x9d, 0x15, 0x84, 0x53, 0x63, 0xb0, 0x5b, 0x4f, 0x53, 0x2f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x53, 0x0e, 0x52, 0xed, 0x63, 0x4e, 0x8c, 0x52, 0xde, 0xdb, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xfc, 0x7c, 0x32, 0x53, 0x2e, 0x4a, 0xed, 0x42, 0xcd, 0x4b, 0x0d, 0x6b, 0xb0, 0xad, 0x76, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x84, 0x73, 0x63, 0x90, 0x53, 0x0e, 0x53, 0x2f, 0x53, 0x2f, 0x5b, 0x6f, 0x73, 0xd0, 0x94, 0x72, 0xe6, 0xfc, 0xe7, 0x1c, 0xe6, 0xfc, 0xe7, 0x1c, 0xc6, 0x19, 0x73, 0xf1, 0x53, 0x2e, 0x53, 0x2f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4b, 0x0d, 0x52, 0xcc, 0x73, 0x6f, 0xce, 0x59, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xce, 0x7a, 0x5b, 0x4e, 0x6b, 0xb0, 0x74, 0x11, 0xc6, 0x39, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x9d, 0x36, 0x63, 0xb0, 0x5b, 0x4f, 0x6b, 0xd1, 0x8c, 0x73, 0xde, 0xfb, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x7c, 0x53, 0x5b, 0x4f, 0x53, 0x2e, 0x5b, 0x4f, 0x5b, 0x4f, 0x5b, 0x4f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4a, 0xcc, 0x6b, 0x4e, 0xce, 0x59, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xbe, 0x19, 0xb5, 0xb7, 0xc6, 0x39, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xad, 0x97, 0x63, 0x90, 0x4b, 0x0e, 0x53, 0x2f, 0x5b, 0x4f, 0x5b, 0x4f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0d, 0x52, 0xed, 0x94, 0xb3, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x9d, 0x36, 0x63, 0x90, 0x4b, 0x0e, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0d, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4a, 0xed, 0x53, 0x0e, 0xa5, 0x55, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x74, 0x32, 0x5b, 0x4f, 0x53, 0x0e, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4a, 0xed, 0x4a, 0xed, 0x53, 0x0d, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4a, 0xed, 0x4b, 0x0d, 0x9d, 0x35, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x63, 0x90, 0x53, 0x2e, 0x53, 0x2f, 0x53, 0x4f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x4f, 0x53, 0x2e, 0x53, 0x0e, 0x52, 0xed, 0x63, 0x4f, 0x6b, 0xb0, 0x63, 0x90, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x4a, 0xed, 0x5b, 0x2e, 0x6b, 0x8f, 0x73, 0xd0, 0x84, 0x52, 0x84, 0x72, 0x63, 0x6f, 0x42, 0xcd, 0x4b, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4a, 0xed, 0x42, 0xcd, 0x84, 0x73, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xde, 0xdb, 0x53, 0x4f, 0x53, 0x0e, 0x53, 0x4f, 0x53, 0x4f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x0e, 0x5a, 0xed, 0x7b, 0xb0, 0xd6, 0x7a, 0xde, 0xfb, 0xde, 0xdb, 0xad, 0x97, 0x5b, 0x6f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x52, 0xed, 0x5b, 0x2e, 0x73, 0xd0, 0xd6, 0x9a, 0xde, 0xdb, 0xde, 0xdb, 0xe6, 0xfc, 0xe7, 0x1c, 0xbe, 0x18, 0x4b, 0x0d, 0x4a, 0xed, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0d, 0x42, 0xcd, 0x63, 0x90, 0xd6, 0x9a, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x8c, 0xd4, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x2f, 0x53, 0x2f, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x73, 0x8f, 0xde, 0xbb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x6b, 0xd0, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4a, 0xed, 0x52, 0xcd, 0x7b, 0xd0, 0xde, 0xfb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x74, 0x11, 0x4a, 0xed, 0x4a, 0xed, 0x4b, 0x0e, 0x4b, 0x0e, 0x4b, 0x0e, 0x4a, 0xed, 0x42, 0xed, 0x5b, 0x4f, 0xa5, 0x35, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xb5, 0xb7, 0x53, 0x2e, 0x4a, 0xcd, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x53, 0x2e, 0x4b, 0x0e, 0x63, 0x6f, 0xc5, 0xf8, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x74, 0x31, 0x53, 0x4e, 0x4b, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4a, 0xed, 0x63, 0x2e, 0xad, 0x56, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xc6, 0x39, 0x53, 0x0e, 0x42, 0xcd, 0x4b, 0x0e, 0x4b, 0x0d, 0x4a, 0xed, 0x42, 0xcd, 0x42, 0xcd, 0x6b, 0xb0, 0xde, 0xdb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x7c, 0x32, 0x5b, 0x6f, 0x4a, 0xee, 0x4a, 0xed, 0x4b, 0x0e, 0x53, 0x0e, 0x4a, 0xee, 0x5b, 0x2e, 0x84, 0x31, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x84, 0x93, 0x5b, 0x4f, 0x4a, 0xed, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x4a, 0xed, 0x63, 0x6f, 0xde, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x74, 0x11, 0x42, 0xcd, 0x42, 0xac, 0x42, 0xcd, 0x53, 0x0d, 0x5b, 0x4e, 0x73, 0xf1, 0xd6, 0xbb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xc6, 0x59, 0x7c, 0x52, 0x6b, 0xd0, 0x5b, 0x6f, 0x53, 0x2e, 0x5b, 0x6f, 0x84, 0x52, 0xde, 0xdb, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x94, 0xf5, 0x5b, 0x6f, 0x4a, 0xed, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x53, 0x0e, 0x4b, 0x0e, 0x53, 0x0e, 0x6b, 0x6f, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xd6, 0xdb, 0x7c, 0x52, 0x63, 0xb0, 0x74, 0x11, 0x8c, 0xb3, 0xd6, 0xbb, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0x9d, 0x15, 0x74, 0x11, 0xd6, 0x9a, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x9d, 0x36, 0x5b, 0x4f, 0x42, 0xac, 0x4a, 0xed, 0x4a, 0xed, 0x4a, 0xed, 0x4b, 0x0d, 0x4a, 0xed, 0x53, 0x0e, 0x73, 0xd0, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0x5b, 0x8f, 0x42, 0xcd, 0x4a, 0xed, 0x4a, 0xed, 0x4a, 0xed, 0x4a, 0xed, 0x42, 0xcd, 0x5b, 0x4e, 0x8c, 0x93, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xb5, 0xd8, 0x74, 0x11, 0x7c, 0x52, 0x7c, 0x52, 0x7c, 0x52, 0x7c, 0x32, 0x6b, 0xd0, 0x84, 0x73, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-  0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc, 0xe6, 0xfc,
-#endif
-#if LV_COLOR_DEPTH == 32
-  /*Pixel format: Fix 0xFF: 8 bit, Red: 8 bit, Green: 8 bit, Blue: 8 bit*/
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xad, 0x9b, 0x8f, 0xff, 0x95, 0x7e, 0x6d, 0xff, 0x90, 0x7a, 0x67, 0xff, 0x92, 0x7c, 0x69, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x8c, 0x75, 0x63, 0xff, 0x97, 0x83, 0x72, 0xff, 0xd8, 0xd4, 0xd1, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0x9e, 0x8a, 0x79, 0xff, 0x8f, 0x78, 0x65, 0xff, 0x90, 0x79, 0x66, 0xff, 0x91, 0x7a, 0x67, 0xff, 0x8f, 0x79, 0x66, 0xff, 0x8c, 0x75, 0x63, 0xff, 0x8c, 0x76, 0x64, 0xff, 0x9f, 0x8c, 0x7d, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xde, 0xdd, 0xff, 0x9a, 0x85, 0x74, 0xff, 0x90, 0x79, 0x66, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x8c, 0x76, 0x63, 0xff, 0x95, 0x7f, 0x6e, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xd7, 0xd4, 0xd2, 0xff, 0xae, 0xa2, 0x96, 0xff, 0xde, 0xdd, 0xdc, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xdf, 0xde, 0xdd, 0xff, 0xaf, 0x9a, 0x8b, 0xff, 0x9d, 0x85, 0x73, 0xff, 0xc6, 0xbb, 0xb2, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xdc, 0xdb, 0xff, 0x9d, 0x88, 0x77, 0xff, 0x91, 0x7a, 0x68, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x93, 0x7e, 0x6c, 0xff, 0x8d, 0x78, 0x65, 0xff, 0x95, 0x80, 0x6f, 0xff, 0xde, 0xdd, 0xdc, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xd6, 0xd3, 0xd0, 0xff, 0x87, 0x74, 0x61, 0xff, 0x85, 0x73, 0x60, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x90, 0x80, 0x6f, 0xff, 0xa7, 0x9a, 0x8c, 0xff, 0xde, 0xdd, 0xdd, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xd5, 0xcd, 0xc8, 0xff, 0xad, 0x97, 0x87, 0xff, 0xa7, 0x90, 0x7f, 0xff, 0xa2, 0x8a, 0x78, 0xff, 0x9c, 0x83, 0x71, 0xff, 0xa0, 0x89, 0x77, 0xff, 0xcc, 0xc3, 0xbc, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xcc, 0xc4, 0xbd, 0xff, 0x9c, 0x88, 0x77, 0xff, 0x92, 0x7c, 0x69, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7e, 0x6c, 0xff, 0x93, 0x7e, 0x6c, 0xff, 0x91, 0x7a, 0x68, 0xff, 0x92, 0x7e, 0x6e, 0xff, 0x9f, 0x92, 0x89, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xde, 0xff, 0x9c, 0x8b, 0x7c, 0xff, 0x82, 0x6e, 0x5b, 0xff, 0x82, 0x6f, 0x5c, 0xff, 0x82, 0x70, 0x5d, 0xff, 0x85, 0x73, 0x61, 0xff, 0x89, 0x77, 0x65, 0xff, 0x8f, 0x7f, 0x6e, 0xff, 0x9c, 0x8e, 0x7f, 0xff, 0xdf, 0xdf, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xcc, 0xc0, 0xb9, 0xff, 0xa6, 0x8d, 0x7b, 0xff, 0x9d, 0x82, 0x6f, 0xff, 0x9f, 0x85, 0x72, 0xff, 0x9f, 0x87, 0x75, 0xff, 0xa0, 0x8a, 0x78, 0xff, 0x9b, 0x82, 0x6f, 0xff, 0xa5, 0x8e, 0x7d, 0xff, 0xdf, 0xdf, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xad, 0x9b, 0x8d, 0xff, 0x9a, 0x84, 0x73, 0xff, 0x94, 0x7d, 0x6a, 0xff, 0x95, 0x80, 0x6d, 0xff, 0x95, 0x7e, 0x6c, 0xff, 0x95, 0x7e, 0x6c, 0xff, 0x93, 0x7e, 0x6c, 0xff, 0x92, 0x7c, 0x69, 0xff, 0x91, 0x7c, 0x6c, 0xff, 0x92, 0x82, 0x79, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xb6, 0xab, 0xa1, 0xff, 0x8a, 0x77, 0x65, 0xff, 0x88, 0x73, 0x61, 0xff, 0x88, 0x75, 0x63, 0xff, 0x87, 0x75, 0x63, 0xff, 0x85, 0x73, 0x61, 0xff, 0x81, 0x6e, 0x5b, 0xff, 0x7c, 0x69, 0x56, 0xff, 0x82, 0x6f, 0x5d, 0xff, 0xdf, 0xdf, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe1, 0xe1, 0xe0, 0xff, 0xaf, 0x99, 0x89, 0xff, 0xa0, 0x84, 0x72, 0xff, 0xa4, 0x89, 0x78, 0xff, 0xa3, 0x8a, 0x79, 0xff, 0xa2, 0x8a, 0x78, 0xff, 0xa2, 0x8a, 0x78, 0xff, 0x9e, 0x85, 0x73, 0xff, 0xa0, 0x87, 0x76, 0xff, 0xd1, 0xcb, 0xc6, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xa5, 0x91, 0x82, 0xff, 0x99, 0x83, 0x71, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x95, 0x80, 0x6e, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7e, 0x6d, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x93, 0x7d, 0x6a, 0xff, 0x90, 0x7b, 0x6a, 0xff, 0x8f, 0x7f, 0x75, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0x94, 0x83, 0x72, 0xff, 0x84, 0x6e, 0x5b, 0xff, 0x8a, 0x76, 0x64, 0xff, 0x89, 0x76, 0x63, 0xff, 0x87, 0x75, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x7f, 0x6c, 0x59, 0xff, 0x83, 0x70, 0x5e, 0xff, 0xd6, 0xd3, 0xd0, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xbd, 0xad, 0xa3, 0xff, 0xa2, 0x88, 0x77, 0xff, 0xa4, 0x8a, 0x79, 0xff, 0xa5, 0x8b, 0x79, 0xff, 0xa3, 0x8a, 0x78, 0xff, 0xa2, 0x8a, 0x78, 0xff, 0xa1, 0x88, 0x77, 0xff, 0x9e, 0x86, 0x73, 0xff, 0x9f, 0x89, 0x77, 0xff, 0xde, 0xdd, 0xdc, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xa1, 0x8c, 0x7c, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x94, 0x7f, 0x6d, 0xff, 0x93, 0x7d, 0x6b, 0xff, 0x8e, 0x79, 0x68, 0xff, 0x8e, 0x7d, 0x72, 0xff, 0xd9, 0xd8, 0xd7, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xce, 0xc9, 0xc4, 0xff, 0x90, 0x7d, 0x6b, 0xff, 0x88, 0x73, 0x60, 0xff, 0x8a, 0x77, 0x64, 0xff, 0x89, 0x76, 0x63, 0xff, 0x87, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x81, 0x6f, 0x5c, 0xff, 0x87, 0x76, 0x66, 0xff, 0xb3, 0xab, 0xa4, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xc7, 0xbb, 0xb2, 0xff, 0xa4, 0x8a, 0x79, 0xff, 0xa4, 0x89, 0x78, 0xff, 0xa5, 0x8b, 0x79, 0xff, 0xa3, 0x8a, 0x78, 0xff, 0xa1, 0x8a, 0x77, 0xff, 0xa1, 0x89, 0x77, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x9a, 0x81, 0x6e, 0xff, 0xbe, 0xb1, 0xa8, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xdd, 0xdc, 0xff, 0xcd, 0xc6, 0xbf, 0xff, 0x99, 0x83, 0x72, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6c, 0xff, 0x93, 0x7d, 0x6c, 0xff, 0x90, 0x7b, 0x6a, 0xff, 0x8f, 0x7a, 0x6b, 0xff, 0x9a, 0x89, 0x7d, 0xff, 0xd9, 0xd7, 0xd5, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdd, 0xdc, 0xda, 0xff, 0x92, 0x80, 0x6f, 0xff, 0x8a, 0x75, 0x63, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x89, 0x75, 0x64, 0xff, 0x87, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x73, 0x61, 0xff, 0x82, 0x70, 0x5f, 0xff, 0x86, 0x77, 0x6b, 0xff, 0xac, 0xa5, 0xa1, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xc4, 0xb5, 0xab, 0xff, 0xa3, 0x8a, 0x78, 0xff, 0xa3, 0x8a, 0x78, 0xff, 0xa5, 0x8c, 0x7a, 0xff, 0xa4, 0x8b, 0x78, 0xff, 0xa2, 0x8a, 0x78, 0xff, 0xa1, 0x88, 0x77, 0xff, 0xa0, 0x88, 0x76, 0xff, 0x9f, 0x86, 0x74, 0xff, 0xa1, 0x8a, 0x79, 0xff, 0xc4, 0xb8, 0xb0, 0xff, 0xdb, 0xd9, 0xd7, 0xff, 0xdb, 0xd9, 0xd8, 0xff, 0xd8, 0xd5, 0xd2, 0xff, 0xc7, 0xbc, 0xb4, 0xff, 0xa6, 0x93, 0x83, 0xff, 0x9a, 0x84, 0x72, 0xff, 0x97, 0x80, 0x6f, 0xff, 0x98, 0x81, 0x70, 0xff, 0x96, 0x80, 0x6f, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x94, 0x7e, 0x6d, 0xff, 0x93, 0x7d, 0x6c, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x92, 0x7e, 0x6c, 0xff, 0x90, 0x7a, 0x68, 0xff, 0x9c, 0x89, 0x7b, 0xff, 0xc1, 0xb7, 0xb0, 0xff, 0xd4, 0xd1, 0xcd, 0xff, 0x9f, 0x8f, 0x7f, 0xff, 0x89, 0x75, 0x62, 0xff, 0x89, 0x75, 0x62, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x89, 0x76, 0x64, 0xff, 0x87, 0x75, 0x63, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x60, 0xff, 0x82, 0x6f, 0x5d, 0xff, 0x86, 0x78, 0x6f, 0xff, 0xb6, 0xb0, 0xaf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xd7, 0xd0, 0xcb, 0xff, 0xa9, 0x90, 0x7f, 0xff, 0xa2, 0x88, 0x76, 0xff, 0xa5, 0x8b, 0x79, 0xff, 0xa4, 0x8b, 0x79, 0xff, 0xa3, 0x8a, 0x79, 0xff, 0xa2, 0x88, 0x78, 0xff, 0xa1, 0x88, 0x77, 0xff, 0xa0, 0x89, 0x77, 0xff, 0xa0, 0x87, 0x77, 0xff, 0x9c, 0x84, 0x71, 0xff, 0x9e, 0x86, 0x75, 0xff, 0x9e, 0x87, 0x75, 0xff, 0x9a, 0x83, 0x70, 0xff, 0x97, 0x7f, 0x6c, 0xff, 0x99, 0x83, 0x71, 0xff, 0x9b, 0x84, 0x74, 0xff, 0x98, 0x81, 0x70, 0xff, 0x97, 0x80, 0x6f, 0xff, 0x97, 0x80, 0x6f, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6d, 0xff, 0x94, 0x7e, 0x6d, 0xff, 0x93, 0x7e, 0x6d, 0xff, 0x92, 0x7d, 0x6c, 0xff, 0x91, 0x7c, 0x6b, 0xff, 0x91, 0x7b, 0x6a, 0xff, 0x91, 0x7c, 0x6b, 0xff, 0x8c, 0x76, 0x64, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x8a, 0x76, 0x63, 0xff, 0x8e, 0x7d, 0x6a, 0xff, 0x8c, 0x79, 0x66, 0xff, 0x8b, 0x78, 0x65, 0xff, 0x8b, 0x76, 0x65, 0xff, 0x89, 0x76, 0x64, 0xff, 0x87, 0x76, 0x64, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x60, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x84, 0x77, 0x71, 0xff, 0xdc, 0xdb, 0xdb, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xde, 0xde, 0xff, 0xba, 0xa8, 0x9d, 0xff, 0xa4, 0x8b, 0x7a, 0xff, 0xa4, 0x8a, 0x78, 0xff, 0xa5, 0x8b, 0x7a, 0xff, 0xa3, 0x8a, 0x78, 0xff, 0xa1, 0x89, 0x77, 0xff, 0xa0, 0x88, 0x76, 0xff, 0x9f, 0x87, 0x76, 0xff, 0x9f, 0x87, 0x75, 0xff, 0xa0, 0x87, 0x77, 0xff, 0x9e, 0x86, 0x75, 0xff, 0x9e, 0x88, 0x75, 0xff, 0x9d, 0x87, 0x75, 0xff, 0x9b, 0x84, 0x73, 0xff, 0x99, 0x82, 0x70, 0xff, 0x9a, 0x83, 0x71, 0xff, 0x98, 0x82, 0x70, 0xff, 0x97, 0x80, 0x6f, 0xff, 0x97, 0x80, 0x6f, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x93, 0x7e, 0x6c, 0xff, 0x92, 0x7e, 0x6c, 0xff, 0x91, 0x7b, 0x6b, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x8f, 0x79, 0x68, 0xff, 0x8f, 0x7b, 0x6a, 0xff, 0x8f, 0x7a, 0x6a, 0xff, 0x8c, 0x77, 0x65, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x8c, 0x78, 0x65, 0xff, 0x8b, 0x76, 0x64, 0xff, 0x89, 0x76, 0x64, 0xff, 0x88, 0x75, 0x64, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x5f, 0xff, 0x83, 0x73, 0x62, 0xff, 0x8a, 0x80, 0x7d, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xde, 0xde, 0xff, 0xbd, 0xb8, 0xb0, 0xff, 0xde, 0xdd, 0xdc, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe1, 0xdf, 0xde, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xd4, 0xcc, 0xc7, 0xff, 0xa7, 0x8e, 0x7c, 0xff, 0xa2, 0x87, 0x76, 0xff, 0xa5, 0x8a, 0x7a, 0xff, 0xa3, 0x8a, 0x79, 0xff, 0xa1, 0x8a, 0x77, 0xff, 0xa0, 0x89, 0x76, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x9f, 0x87, 0x75, 0xff, 0xa0, 0x88, 0x76, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x9d, 0x86, 0x73, 0xff, 0x9c, 0x86, 0x73, 0xff, 0x9b, 0x85, 0x73, 0xff, 0x9a, 0x83, 0x72, 0xff, 0x99, 0x83, 0x71, 0xff, 0x98, 0x82, 0x70, 0xff, 0x98, 0x80, 0x70, 0xff, 0x98, 0x80, 0x70, 0xff, 0x97, 0x80, 0x6f, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x93, 0x7e, 0x6c, 0xff, 0x92, 0x7e, 0x6c, 0xff, 0x91, 0x7b, 0x6a, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x90, 0x7a, 0x6a, 0xff, 0x90, 0x7b, 0x6a, 0xff, 0x8e, 0x7a, 0x69, 0xff, 0x8d, 0x79, 0x68, 0xff, 0x8d, 0x78, 0x67, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x8b, 0x76, 0x64, 0xff, 0x8a, 0x76, 0x64, 0xff, 0x88, 0x76, 0x64, 0xff, 0x87, 0x74, 0x62, 0xff, 0x86, 0x73, 0x60, 0xff, 0x84, 0x73, 0x62, 0xff, 0x88, 0x7e, 0x78, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xc8, 0xc2, 0xbd, 0xff, 0x95, 0x87, 0x78, 0xff, 0x85, 0x75, 0x63, 0xff, 0x8a, 0x7c, 0x6b, 0xff, 0xc4, 0xbe, 0xb7, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xcd, 0xbf, 0xb6, 0xff, 0xb8, 0x9f, 0x8f, 0xff, 0xbd, 0xa5, 0x97, 0xff, 0xe0, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xc0, 0xaf, 0xa4, 0xff, 0xa6, 0x8c, 0x7a, 0xff, 0xa3, 0x89, 0x77, 0xff, 0xa4, 0x8a, 0x79, 0xff, 0xa3, 0x8a, 0x78, 0xff, 0xa2, 0x8a, 0x78, 0xff, 0xa1, 0x88, 0x77, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x9d, 0x86, 0x73, 0xff, 0x9c, 0x85, 0x72, 0xff, 0x9b, 0x85, 0x72, 0xff, 0x9a, 0x84, 0x72, 0xff, 0x9a, 0x84, 0x71, 0xff, 0x9a, 0x83, 0x71, 0xff, 0x99, 0x82, 0x71, 0xff, 0x98, 0x81, 0x70, 0xff, 0x98, 0x80, 0x70, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x93, 0x7e, 0x6c, 0xff, 0x92, 0x7e, 0x6c, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x8e, 0x7a, 0x68, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x8d, 0x78, 0x67, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x8b, 0x78, 0x66, 0xff, 0x8a, 0x76, 0x64, 0xff, 0x89, 0x76, 0x64, 0xff, 0x88, 0x76, 0x64, 0xff, 0x87, 0x74, 0x62, 0xff, 0x86, 0x73, 0x61, 0xff, 0x83, 0x70, 0x5f, 0xff, 0x86, 0x77, 0x69, 0xff, 0xc7, 0xc1, 0xbe, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xde, 0xde, 0xff, 0xa8, 0x9c, 0x90, 0xff, 0x8a, 0x79, 0x68, 0xff, 0x7a, 0x69, 0x55, 0xff, 0x8b, 0x7b, 0x6b, 0xff, 0x74, 0x61, 0x4d, 0xff, 0x83, 0x74, 0x62, 0xff, 0xb8, 0xb0, 0xa9, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xc6, 0xb3, 0xa7, 0xff, 0xb3, 0x96, 0x85, 0xff, 0xab, 0x8c, 0x7a, 0xff, 0xac, 0x8e, 0x7c, 0xff, 0xb1, 0x96, 0x85, 0xff, 0xdd, 0xda, 0xd8, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xce, 0xc4, 0xbd, 0xff, 0xa8, 0x8d, 0x7b, 0xff, 0xa5, 0x8b, 0x79, 0xff, 0xa5, 0x8b, 0x7a, 0xff, 0xa3, 0x8a, 0x78, 0xff, 0xa3, 0x8a, 0x78, 0xff, 0xa2, 0x89, 0x78, 0xff, 0xa0, 0x88, 0x76, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x9e, 0x87, 0x74, 0xff, 0x9e, 0x86, 0x73, 0xff, 0x9e, 0x86, 0x74, 0xff, 0x9d, 0x86, 0x74, 0xff, 0x9b, 0x84, 0x72, 0xff, 0x9a, 0x82, 0x71, 0xff, 0x98, 0x81, 0x70, 0xff, 0x98, 0x81, 0x70, 0xff, 0x98, 0x81, 0x70, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x93, 0x7d, 0x6c, 0xff, 0x92, 0x7c, 0x6c, 0xff, 0x91, 0x7c, 0x6a, 0xff, 0x91, 0x7b, 0x6a, 0xff, 0x91, 0x7b, 0x6a, 0xff, 0x91, 0x7b, 0x6a, 0xff, 0x90, 0x7b, 0x6a, 0xff, 0x8e, 0x7a, 0x68, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x8a, 0x77, 0x65, 0xff, 0x8a, 0x76, 0x64, 0xff, 0x8a, 0x76, 0x64, 0xff, 0x89, 0x75, 0x63, 0xff, 0x87, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x87, 0x76, 0x64, 0xff, 0x83, 0x70, 0x5d, 0xff, 0x90, 0x7f, 0x6f, 0xff, 0xc6, 0xc0, 0xbb, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0x98, 0x8a, 0x7b, 0xff, 0x82, 0x71, 0x5f, 0xff, 0x7a, 0x68, 0x56, 0xff, 0x7d, 0x6c, 0x58, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x80, 0x6f, 0x5c, 0xff, 0x75, 0x64, 0x50, 0xff, 0x7e, 0x6f, 0x5d, 0xff, 0xad, 0xa5, 0x9b, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xc8, 0xb6, 0xab, 0xff, 0xb3, 0x97, 0x85, 0xff, 0xaf, 0x91, 0x7f, 0xff, 0xb0, 0x93, 0x83, 0xff, 0xad, 0x8f, 0x80, 0xff, 0xac, 0x8d, 0x7c, 0xff, 0xb0, 0x94, 0x83, 0xff, 0xcd, 0xbf, 0xb6, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xd5, 0xce, 0xc9, 0xff, 0xae, 0x96, 0x86, 0xff, 0xa7, 0x8d, 0x7b, 0xff, 0xa6, 0x8c, 0x79, 0xff, 0xa7, 0x8e, 0x7e, 0xff, 0xa5, 0x8b, 0x7a, 0xff, 0xa4, 0x8a, 0x79, 0xff, 0xa3, 0x8a, 0x79, 0xff, 0xa1, 0x89, 0x78, 0xff, 0xa1, 0x88, 0x77, 0xff, 0xa0, 0x88, 0x76, 0xff, 0xa0, 0x88, 0x75, 0xff, 0xa0, 0x88, 0x75, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x9d, 0x86, 0x73, 0xff, 0x9c, 0x85, 0x73, 0xff, 0x9b, 0x84, 0x72, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x90, 0x7b, 0x69, 0xff, 0x8f, 0x7a, 0x68, 0xff, 0x95, 0x7f, 0x6e, 0xff, 0x97, 0x81, 0x70, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x93, 0x7d, 0x6c, 0xff, 0x8e, 0x79, 0x68, 0xff, 0x89, 0x76, 0x64, 0xff, 0x8a, 0x76, 0x65, 0xff, 0x8e, 0x78, 0x67, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x8d, 0x7a, 0x67, 0xff, 0x8e, 0x79, 0x67, 0xff, 0x8d, 0x78, 0x66, 0xff, 0x8b, 0x78, 0x66, 0xff, 0x8a, 0x77, 0x65, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x89, 0x75, 0x63, 0xff, 0x87, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x61, 0xff, 0x86, 0x75, 0x62, 0xff, 0x83, 0x70, 0x5e, 0xff, 0x85, 0x73, 0x61, 0xff, 0x8e, 0x7d, 0x6d, 0xff, 0xd5, 0xd2, 0xcf, 0xff, 0xde, 0xdd, 0xdc, 0xff, 0x8e, 0x81, 0x71, 0xff, 0x80, 0x6f, 0x5d, 0xff, 0x7a, 0x67, 0x54, 0xff, 0x7f, 0x6e, 0x5c, 0xff, 0x80, 0x6f, 0x5c, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7f, 0x6e, 0x5c, 0xff, 0x73, 0x62, 0x4f, 0xff, 0x7f, 0x6f, 0x5d, 0xff, 0xbd, 0xb6, 0xae, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xd0, 0xc3, 0xbc, 0xff, 0xb4, 0x97, 0x86, 0xff, 0xaf, 0x90, 0x7e, 0xff, 0xb1, 0x94, 0x84, 0xff, 0xb0, 0x93, 0x82, 0xff, 0xaf, 0x92, 0x81, 0xff, 0xaf, 0x91, 0x82, 0xff, 0xac, 0x8e, 0x7c, 0xff, 0xaf, 0x93, 0x83, 0xff, 0xc2, 0xaf, 0xa4, 0xff, 0xe0, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xd4, 0xcd, 0xc8, 0xff, 0xae, 0x96, 0x86, 0xff, 0xa5, 0x8b, 0x77, 0xff, 0xa5, 0x8c, 0x79, 0xff, 0xa8, 0x90, 0x7f, 0xff, 0xa6, 0x8c, 0x7b, 0xff, 0xa5, 0x8b, 0x7a, 0xff, 0xa5, 0x8a, 0x7a, 0xff, 0xa3, 0x8a, 0x79, 0xff, 0xa1, 0x89, 0x77, 0xff, 0xa1, 0x89, 0x77, 0xff, 0xa2, 0x89, 0x77, 0xff, 0xa3, 0x8a, 0x78, 0xff, 0xa0, 0x88, 0x76, 0xff, 0x98, 0x81, 0x6f, 0xff, 0x8f, 0x7b, 0x68, 0xff, 0x86, 0x74, 0x61, 0xff, 0x7f, 0x6d, 0x5a, 0xff, 0x79, 0x6a, 0x57, 0xff, 0x74, 0x66, 0x53, 0xff, 0x7b, 0x6b, 0x58, 0xff, 0x90, 0x7b, 0x6a, 0xff, 0x98, 0x82, 0x70, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x91, 0x7c, 0x6a, 0xff, 0x85, 0x73, 0x61, 0xff, 0x78, 0x69, 0x55, 0xff, 0x74, 0x65, 0x52, 0xff, 0x78, 0x68, 0x55, 0xff, 0x7c, 0x6c, 0x58, 0xff, 0x81, 0x70, 0x5d, 0xff, 0x85, 0x73, 0x61, 0xff, 0x8a, 0x76, 0x64, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x8b, 0x78, 0x66, 0xff, 0x8a, 0x76, 0x64, 0xff, 0x89, 0x75, 0x63, 0xff, 0x87, 0x74, 0x62, 0xff, 0x85, 0x74, 0x62, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x75, 0x63, 0xff, 0x7e, 0x6b, 0x58, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x91, 0x82, 0x72, 0xff, 0x90, 0x81, 0x71, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x7b, 0x69, 0x57, 0xff, 0x80, 0x6e, 0x5d, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x76, 0x65, 0x52, 0xff, 0x9e, 0x92, 0x85, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xc0, 0xab, 0x9f, 0xff, 0xad, 0x8f, 0x7d, 0xff, 0xb0, 0x93, 0x83, 0xff, 0xb0, 0x93, 0x82, 0xff, 0xaf, 0x92, 0x81, 0xff, 0xaf, 0x92, 0x81, 0xff, 0xae, 0x91, 0x80, 0xff, 0xae, 0x90, 0x80, 0xff, 0xaa, 0x8d, 0x7c, 0xff, 0xaa, 0x90, 0x7e, 0xff, 0xac, 0x92, 0x81, 0xff, 0xab, 0x91, 0x7f, 0xff, 0xaa, 0x90, 0x7e, 0xff, 0xa6, 0x8c, 0x79, 0xff, 0xa7, 0x8f, 0x7c, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xa7, 0x8d, 0x7c, 0xff, 0xa6, 0x8c, 0x7b, 0xff, 0xa5, 0x8b, 0x7a, 0xff, 0xa4, 0x8a, 0x7a, 0xff, 0xa5, 0x8b, 0x7a, 0xff, 0xa5, 0x8c, 0x7a, 0xff, 0xa1, 0x89, 0x77, 0xff, 0x9a, 0x83, 0x71, 0xff, 0x92, 0x7d, 0x6b, 0xff, 0x89, 0x76, 0x64, 0xff, 0x81, 0x70, 0x5d, 0xff, 0x7a, 0x6b, 0x57, 0xff, 0x73, 0x64, 0x50, 0xff, 0x6b, 0x5e, 0x49, 0xff, 0x69, 0x5d, 0x49, 0xff, 0x66, 0x5b, 0x47, 0xff, 0x71, 0x63, 0x51, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x99, 0x82, 0x70, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x91, 0x7c, 0x69, 0xff, 0x81, 0x70, 0x5c, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x67, 0x5c, 0x47, 0xff, 0x6a, 0x5e, 0x49, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x72, 0x63, 0x4f, 0xff, 0x77, 0x68, 0x54, 0xff, 0x7b, 0x6c, 0x58, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x85, 0x71, 0x60, 0xff, 0x89, 0x75, 0x63, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x89, 0x76, 0x64, 0xff, 0x87, 0x74, 0x62, 0xff, 0x85, 0x74, 0x62, 0xff, 0x85, 0x73, 0x61, 0xff, 0x84, 0x72, 0x60, 0xff, 0x84, 0x72, 0x60, 0xff, 0x84, 0x72, 0x60, 0xff, 0x81, 0x6f, 0x5e, 0xff, 0x7c, 0x6a, 0x57, 0xff, 0x7d, 0x6b, 0x57, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x81, 0x6f, 0x5e, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x78, 0x68, 0x53, 0xff, 0x7b, 0x6b, 0x59, 0xff, 0xae, 0xa5, 0x9d, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xc3, 0xaf, 0xa5, 0xff, 0xac, 0x8e, 0x7c, 0xff, 0xae, 0x91, 0x80, 0xff, 0xaf, 0x92, 0x81, 0xff, 0xae, 0x91, 0x80, 0xff, 0xae, 0x91, 0x80, 0xff, 0xae, 0x90, 0x7f, 0xff, 0xae, 0x90, 0x7f, 0xff, 0xac, 0x91, 0x80, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xaa, 0x8f, 0x7d, 0xff, 0xaa, 0x90, 0x7e, 0xff, 0xa8, 0x8e, 0x7b, 0xff, 0xa8, 0x8f, 0x7d, 0xff, 0xa8, 0x8e, 0x7d, 0xff, 0xa7, 0x8d, 0x7b, 0xff, 0xa6, 0x8d, 0x7b, 0xff, 0xa6, 0x8c, 0x7b, 0xff, 0xa6, 0x8c, 0x7b, 0xff, 0xa5, 0x8c, 0x7b, 0xff, 0xa2, 0x89, 0x78, 0xff, 0x9c, 0x85, 0x74, 0xff, 0x92, 0x7d, 0x6b, 0xff, 0x84, 0x72, 0x5f, 0xff, 0x75, 0x66, 0x53, 0xff, 0x6b, 0x5f, 0x4c, 0xff, 0x6b, 0x5f, 0x4b, 0xff, 0x6d, 0x61, 0x4c, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x6b, 0x5e, 0x4a, 0xff, 0x74, 0x65, 0x52, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x98, 0x82, 0x70, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x91, 0x7c, 0x6a, 0xff, 0x83, 0x71, 0x5e, 0xff, 0x71, 0x63, 0x4e, 0xff, 0x6a, 0x5e, 0x48, 0xff, 0x6b, 0x5e, 0x49, 0xff, 0x6b, 0x5f, 0x49, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6d, 0x61, 0x4c, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x76, 0x66, 0x53, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x85, 0x73, 0x61, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x87, 0x74, 0x62, 0xff, 0x85, 0x73, 0x61, 0xff, 0x84, 0x72, 0x60, 0xff, 0x84, 0x72, 0x60, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x80, 0x6e, 0x5b, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x80, 0x6f, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6d, 0x5c, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7c, 0x6b, 0x57, 0xff, 0x77, 0x65, 0x52, 0xff, 0x80, 0x72, 0x65, 0xff, 0xb7, 0xb2, 0xae, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xda, 0xd3, 0xd0, 0xff, 0xb0, 0x94, 0x83, 0xff, 0xab, 0x8d, 0x7c, 0xff, 0xae, 0x91, 0x81, 0xff, 0xae, 0x91, 0x80, 0xff, 0xae, 0x91, 0x80, 0xff, 0xad, 0x90, 0x7f, 0xff, 0xac, 0x91, 0x7f, 0xff, 0xab, 0x91, 0x7f, 0xff, 0xaa, 0x91, 0x7f, 0xff, 0xaa, 0x90, 0x7e, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa9, 0x8e, 0x7c, 0xff, 0xa9, 0x8e, 0x7d, 0xff, 0xa8, 0x8e, 0x7d, 0xff, 0xa7, 0x8d, 0x7c, 0xff, 0xa6, 0x8d, 0x7b, 0xff, 0xa6, 0x8d, 0x7b, 0xff, 0xa7, 0x8d, 0x7b, 0xff, 0xa2, 0x88, 0x77, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x74, 0x65, 0x51, 0xff, 0x6f, 0x62, 0x4d, 0xff, 0x6d, 0x5f, 0x4b, 0xff, 0x6a, 0x5d, 0x4a, 0xff, 0x6b, 0x5f, 0x4b, 0xff, 0x6c, 0x60, 0x4c, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6f, 0x61, 0x4d, 0xff, 0x6c, 0x5e, 0x4a, 0xff, 0x75, 0x65, 0x52, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x98, 0x82, 0x70, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x84, 0x71, 0x5f, 0xff, 0x71, 0x63, 0x4e, 0xff, 0x6a, 0x5d, 0x47, 0xff, 0x6b, 0x5e, 0x48, 0xff, 0x6b, 0x5e, 0x49, 0xff, 0x6b, 0x5e, 0x4a, 0xff, 0x6c, 0x5f, 0x4b, 0xff, 0x6c, 0x60, 0x4c, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x71, 0x63, 0x50, 0xff, 0x74, 0x66, 0x53, 0xff, 0x78, 0x68, 0x55, 0xff, 0x7d, 0x6c, 0x5a, 0xff, 0x84, 0x71, 0x5f, 0xff, 0x86, 0x74, 0x62, 0xff, 0x85, 0x73, 0x61, 0xff, 0x84, 0x72, 0x60, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7b, 0x69, 0x55, 0xff, 0x78, 0x67, 0x57, 0xff, 0x84, 0x79, 0x75, 0xff, 0xde, 0xdd, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xd5, 0xcc, 0xc6, 0xff, 0xab, 0x8d, 0x7c, 0xff, 0xac, 0x8e, 0x7c, 0xff, 0xaf, 0x92, 0x82, 0xff, 0xae, 0x91, 0x80, 0xff, 0xad, 0x91, 0x7f, 0xff, 0xab, 0x91, 0x7f, 0xff, 0xab, 0x91, 0x7f, 0xff, 0xaa, 0x90, 0x7e, 0xff, 0xaa, 0x90, 0x7e, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa9, 0x8f, 0x7c, 0xff, 0xa9, 0x8e, 0x7c, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xa9, 0x8f, 0x7e, 0xff, 0xa5, 0x8c, 0x7b, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x85, 0x72, 0x60, 0xff, 0x77, 0x67, 0x54, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x69, 0x5e, 0x49, 0xff, 0x6b, 0x5e, 0x4a, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6f, 0x62, 0x4d, 0xff, 0x6f, 0x62, 0x4d, 0xff, 0x6e, 0x60, 0x4b, 0xff, 0x6c, 0x5d, 0x49, 0xff, 0x6a, 0x5b, 0x4a, 0xff, 0x6e, 0x61, 0x53, 0xff, 0x74, 0x69, 0x60, 0xff, 0x7c, 0x6f, 0x66, 0xff, 0x90, 0x7b, 0x6b, 0xff, 0x99, 0x82, 0x70, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x97, 0x80, 0x6e, 0xff, 0x8e, 0x79, 0x69, 0xff, 0x79, 0x67, 0x5c, 0xff, 0x63, 0x57, 0x4c, 0xff, 0x69, 0x5e, 0x52, 0xff, 0x76, 0x6b, 0x5b, 0xff, 0x73, 0x67, 0x55, 0xff, 0x6a, 0x5d, 0x4a, 0xff, 0x67, 0x58, 0x43, 0xff, 0x6b, 0x5d, 0x47, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x73, 0x64, 0x51, 0xff, 0x73, 0x64, 0x52, 0xff, 0x73, 0x64, 0x52, 0xff, 0x77, 0x67, 0x55, 0xff, 0x7b, 0x6a, 0x58, 0xff, 0x7f, 0x6e, 0x5c, 0xff, 0x82, 0x71, 0x5f, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x58, 0xff, 0x76, 0x66, 0x53, 0xff, 0x7a, 0x6e, 0x66, 0xff, 0xaa, 0xa4, 0xa6, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xd3, 0xc9, 0xc3, 0xff, 0xac, 0x8e, 0x7d, 0xff, 0xab, 0x8d, 0x7b, 0xff, 0xad, 0x92, 0x80, 0xff, 0xac, 0x91, 0x7f, 0xff, 0xab, 0x91, 0x7f, 0xff, 0xaa, 0x90, 0x7e, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xaa, 0x90, 0x7e, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa8, 0x8e, 0x7d, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xaa, 0x8f, 0x7d, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa0, 0x88, 0x77, 0xff, 0x90, 0x7b, 0x69, 0xff, 0x7c, 0x6c, 0x58, 0xff, 0x6c, 0x60, 0x4c, 0xff, 0x68, 0x5d, 0x49, 0xff, 0x6c, 0x60, 0x4c, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6f, 0x61, 0x4c, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x6a, 0x5d, 0x4a, 0xff, 0x6c, 0x5e, 0x4e, 0xff, 0x6f, 0x62, 0x55, 0xff, 0x7c, 0x71, 0x67, 0xff, 0x91, 0x87, 0x80, 0xff, 0xbe, 0xb9, 0xb6, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xda, 0xd9, 0xd9, 0xff, 0x9c, 0x88, 0x7c, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x96, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x97, 0x81, 0x6e, 0xff, 0x8a, 0x75, 0x66, 0xff, 0x71, 0x62, 0x5a, 0xff, 0x72, 0x68, 0x68, 0xff, 0xca, 0xc8, 0xc8, 0xff, 0xdd, 0xdd, 0xdc, 0xff, 0xdd, 0xdd, 0xdc, 0xff, 0xd8, 0xd7, 0xd6, 0xff, 0x95, 0x8b, 0x7d, 0xff, 0x85, 0x79, 0x68, 0xff, 0x72, 0x63, 0x50, 0xff, 0x6e, 0x5d, 0x4a, 0xff, 0x71, 0x60, 0x4d, 0xff, 0x76, 0x65, 0x54, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x79, 0x68, 0x56, 0xff, 0x7e, 0x6d, 0x5b, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x85, 0x73, 0x61, 0xff, 0x84, 0x72, 0x60, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7f, 0x6d, 0x5a, 0xff, 0x7a, 0x69, 0x57, 0xff, 0x71, 0x64, 0x5a, 0xff, 0x7e, 0x76, 0x78, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe0, 0xdf, 0xdf, 0xff, 0xb5, 0x9c, 0x8c, 0xff, 0xab, 0x8f, 0x7d, 0xff, 0xab, 0x91, 0x7f, 0xff, 0xab, 0x91, 0x7f, 0xff, 0xaa, 0x90, 0x7e, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xaa, 0x90, 0x7e, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa1, 0x87, 0x76, 0xff, 0x86, 0x74, 0x61, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x6c, 0x60, 0x4c, 0xff, 0x6c, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6e, 0x60, 0x4d, 0xff, 0x6e, 0x60, 0x4d, 0xff, 0x6e, 0x60, 0x4d, 0xff, 0x6f, 0x62, 0x51, 0xff, 0x74, 0x68, 0x5d, 0xff, 0x80, 0x77, 0x73, 0xff, 0x8f, 0x88, 0x88, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xdf, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xae, 0x9d, 0x90, 0xff, 0x97, 0x81, 0x70, 0xff, 0x94, 0x7d, 0x6b, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x96, 0x7f, 0x6d, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x86, 0x72, 0x62, 0xff, 0x7d, 0x6f, 0x67, 0xff, 0xb9, 0xb4, 0xb5, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdb, 0xda, 0xd9, 0xff, 0x98, 0x8d, 0x81, 0xff, 0x83, 0x75, 0x66, 0xff, 0x79, 0x6a, 0x57, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x65, 0x53, 0xff, 0x78, 0x68, 0x57, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7f, 0x6d, 0x59, 0xff, 0x71, 0x60, 0x52, 0xff, 0x76, 0x6a, 0x68, 0xff, 0xbd, 0xbb, 0xbd, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe0, 0xdf, 0xde, 0xff, 0xb5, 0x9d, 0x8d, 0xff, 0xa9, 0x8f, 0x7c, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xac, 0x91, 0x7f, 0xff, 0xaa, 0x90, 0x7e, 0xff, 0x9c, 0x84, 0x72, 0xff, 0x82, 0x70, 0x5d, 0xff, 0x6f, 0x62, 0x4d, 0xff, 0x6a, 0x5f, 0x4a, 0xff, 0x6c, 0x60, 0x4c, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x70, 0x61, 0x4d, 0xff, 0x6f, 0x60, 0x4c, 0xff, 0x6d, 0x5e, 0x4d, 0xff, 0x70, 0x65, 0x5d, 0xff, 0x84, 0x7c, 0x7a, 0xff, 0xd3, 0xd1, 0xd1, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xb2, 0xa1, 0x94, 0xff, 0x98, 0x82, 0x70, 0xff, 0x93, 0x7d, 0x6b, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6c, 0xff, 0x87, 0x74, 0x64, 0xff, 0x86, 0x78, 0x70, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xd2, 0xd0, 0xcd, 0xff, 0x85, 0x76, 0x66, 0xff, 0x77, 0x67, 0x54, 0xff, 0x78, 0x67, 0x54, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x81, 0x6e, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x58, 0xff, 0x74, 0x63, 0x54, 0xff, 0x86, 0x7b, 0x75, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xb4, 0x9e, 0x8e, 0xff, 0xa7, 0x8d, 0x7a, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xac, 0x91, 0x7f, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0x99, 0x83, 0x70, 0xff, 0x81, 0x6f, 0x5c, 0xff, 0x6d, 0x61, 0x4c, 0xff, 0x69, 0x5e, 0x49, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6f, 0x62, 0x4e, 0xff, 0x6f, 0x61, 0x4d, 0xff, 0x6b, 0x5d, 0x4c, 0xff, 0x6f, 0x63, 0x57, 0xff, 0x7f, 0x76, 0x71, 0xff, 0xd4, 0xd3, 0xd3, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xb0, 0x9e, 0x92, 0xff, 0x98, 0x82, 0x71, 0xff, 0x93, 0x7d, 0x6b, 0xff, 0x95, 0x7e, 0x6c, 0xff, 0x95, 0x7e, 0x6c, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x8a, 0x76, 0x67, 0xff, 0x88, 0x7a, 0x72, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xcf, 0xcc, 0xc8, 0xff, 0x8b, 0x7c, 0x6c, 0xff, 0x77, 0x64, 0x51, 0xff, 0x7b, 0x69, 0x56, 0xff, 0x81, 0x6f, 0x5e, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x81, 0x6e, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x77, 0x66, 0x53, 0xff, 0x8d, 0x80, 0x72, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xd0, 0xc6, 0xbf, 0xff, 0xac, 0x93, 0x82, 0xff, 0xa7, 0x8d, 0x7a, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xa9, 0x8e, 0x7c, 0xff, 0xab, 0x90, 0x7e, 0xff, 0xaa, 0x8f, 0x7d, 0xff, 0x99, 0x82, 0x6f, 0xff, 0x7e, 0x6e, 0x5a, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6c, 0x5f, 0x4b, 0xff, 0x6f, 0x62, 0x4e, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x6c, 0x5f, 0x4f, 0xff, 0x75, 0x6b, 0x63, 0xff, 0x8b, 0x85, 0x85, 0xff, 0xd7, 0xd6, 0xd6, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xb0, 0x9f, 0x92, 0xff, 0x98, 0x82, 0x71, 0xff, 0x93, 0x7d, 0x6b, 0xff, 0x95, 0x7f, 0x6c, 0xff, 0x95, 0x7f, 0x6c, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x8a, 0x77, 0x68, 0xff, 0x8a, 0x7c, 0x74, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xd2, 0xcf, 0xcc, 0xff, 0x91, 0x83, 0x73, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7e, 0x6b, 0x58, 0xff, 0x83, 0x73, 0x62, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x84, 0x72, 0x60, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x78, 0x67, 0x53, 0xff, 0x83, 0x73, 0x61, 0xff, 0xba, 0xb2, 0xab, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe0, 0xe0, 0xdf, 0xff, 0xae, 0x96, 0x85, 0xff, 0xa6, 0x8c, 0x79, 0xff, 0xa8, 0x8e, 0x7d, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xab, 0x90, 0x7e, 0xff, 0xaa, 0x8f, 0x7d, 0xff, 0x9a, 0x83, 0x71, 0xff, 0x7e, 0x6e, 0x5b, 0xff, 0x6c, 0x60, 0x4c, 0xff, 0x6c, 0x5f, 0x4c, 0xff, 0x6f, 0x62, 0x4e, 0xff, 0x71, 0x63, 0x4e, 0xff, 0x73, 0x65, 0x52, 0xff, 0x6e, 0x60, 0x52, 0xff, 0x78, 0x6f, 0x6c, 0xff, 0xc0, 0xbe, 0xbf, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xb0, 0x9f, 0x92, 0xff, 0x98, 0x82, 0x70, 0xff, 0x93, 0x7d, 0x6b, 0xff, 0x95, 0x7f, 0x6c, 0xff, 0x95, 0x7f, 0x6c, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x8a, 0x77, 0x68, 0xff, 0x8b, 0x7c, 0x75, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xde, 0xff, 0xad, 0xa3, 0x99, 0xff, 0x82, 0x70, 0x5f, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x85, 0x75, 0x63, 0xff, 0x85, 0x74, 0x61, 0xff, 0x87, 0x75, 0x62, 0xff, 0x84, 0x72, 0x60, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x77, 0x66, 0x52, 0xff, 0x81, 0x71, 0x5f, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdb, 0xda, 0xd9, 0xff, 0xc2, 0xbd, 0xb7, 0xff, 0xbf, 0xba, 0xb4, 0xff, 0xb5, 0xae, 0xa6, 0xff, 0xde, 0xdd, 0xdc, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xc5, 0xb7, 0xac, 0xff, 0xa7, 0x8d, 0x7b, 0xff, 0xa6, 0x8c, 0x7a, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xaa, 0x8f, 0x7d, 0xff, 0x9d, 0x86, 0x73, 0xff, 0x80, 0x6f, 0x5c, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6c, 0x5f, 0x4b, 0xff, 0x6f, 0x62, 0x4e, 0xff, 0x71, 0x63, 0x4d, 0xff, 0x71, 0x64, 0x53, 0xff, 0x6b, 0x5e, 0x53, 0xff, 0x83, 0x7b, 0x7a, 0xff, 0xd4, 0xd3, 0xd3, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xaf, 0x9f, 0x91, 0xff, 0x97, 0x81, 0x70, 0xff, 0x94, 0x7d, 0x6a, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x94, 0x7e, 0x6d, 0xff, 0x93, 0x7d, 0x6b, 0xff, 0x8a, 0x77, 0x68, 0xff, 0x8b, 0x7d, 0x75, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xca, 0xc5, 0xc0, 0xff, 0x8e, 0x7d, 0x6c, 0xff, 0x81, 0x6e, 0x5c, 0xff, 0x87, 0x76, 0x64, 0xff, 0x89, 0x77, 0x64, 0xff, 0x89, 0x77, 0x64, 0xff, 0x85, 0x73, 0x61, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x77, 0x66, 0x52, 0xff, 0x78, 0x68, 0x56, 0xff, 0xb1, 0xa9, 0xa0, 0xff, 0xca, 0xc5, 0xc1, 0xff, 0xcb, 0xc6, 0xc2, 0xff, 0xc7, 0xc3, 0xbe, 0xff, 0xb8, 0xb1, 0xa9, 0xff, 0x8c, 0x7f, 0x70, 0xff, 0x7d, 0x6e, 0x5d, 0xff, 0x73, 0x63, 0x50, 0xff, 0x70, 0x60, 0x4c, 0xff, 0x8d, 0x81, 0x72, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe0, 0xdf, 0xdf, 0xff, 0xb5, 0xa0, 0x92, 0xff, 0xb8, 0xa5, 0x98, 0xff, 0xdc, 0xd8, 0xd6, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xd0, 0xc6, 0xbf, 0xff, 0xa5, 0x8b, 0x79, 0xff, 0xa5, 0x8b, 0x78, 0xff, 0xa9, 0x8f, 0x7e, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xab, 0x90, 0x7e, 0xff, 0x9f, 0x87, 0x74, 0xff, 0x84, 0x73, 0x5f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6b, 0x5e, 0x4b, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x70, 0x63, 0x4d, 0xff, 0x70, 0x63, 0x51, 0xff, 0x6c, 0x60, 0x55, 0xff, 0x84, 0x7c, 0x7d, 0xff, 0xd4, 0xd3, 0xd4, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xaf, 0x9f, 0x91, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x93, 0x7c, 0x6a, 0xff, 0x95, 0x7f, 0x6c, 0xff, 0x93, 0x7e, 0x6c, 0xff, 0x92, 0x7c, 0x6a, 0xff, 0x8a, 0x76, 0x68, 0xff, 0x8c, 0x7d, 0x75, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xcb, 0xc6, 0xc1, 0xff, 0x90, 0x7e, 0x6d, 0xff, 0x85, 0x72, 0x5f, 0xff, 0x8b, 0x79, 0x67, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x8b, 0x77, 0x66, 0xff, 0x85, 0x72, 0x60, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7d, 0x6d, 0x59, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7d, 0x6b, 0x58, 0xff, 0x7c, 0x6b, 0x5a, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x7b, 0x6b, 0x59, 0xff, 0x83, 0x74, 0x63, 0xff, 0x83, 0x75, 0x64, 0xff, 0x7a, 0x6b, 0x59, 0xff, 0x73, 0x62, 0x50, 0xff, 0x73, 0x62, 0x50, 0xff, 0x80, 0x71, 0x61, 0xff, 0x80, 0x71, 0x62, 0xff, 0x7e, 0x70, 0x5f, 0xff, 0x77, 0x69, 0x57, 0xff, 0x9a, 0x90, 0x82, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xad, 0x96, 0x86, 0xff, 0xa1, 0x87, 0x75, 0xff, 0xa6, 0x8c, 0x7b, 0xff, 0xaa, 0x91, 0x80, 0xff, 0xaf, 0x97, 0x89, 0xff, 0xb3, 0xa0, 0x91, 0xff, 0xbc, 0xaa, 0x9e, 0xff, 0xcf, 0xc3, 0xbd, 0xff, 0xc4, 0xb5, 0xaa, 0xff, 0xaf, 0x98, 0x87, 0xff, 0xa5, 0x8b, 0x79, 0xff, 0xa7, 0x8d, 0x7d, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xa7, 0x8d, 0x7c, 0xff, 0xa7, 0x8d, 0x7b, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xa4, 0x8a, 0x78, 0xff, 0x8a, 0x77, 0x63, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6a, 0x5e, 0x4b, 0xff, 0x6f, 0x62, 0x4e, 0xff, 0x71, 0x63, 0x4e, 0xff, 0x72, 0x65, 0x53, 0xff, 0x6a, 0x5e, 0x53, 0xff, 0x85, 0x7e, 0x7e, 0xff, 0xd6, 0xd5, 0xd6, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xb0, 0x9f, 0x92, 0xff, 0x97, 0x81, 0x70, 0xff, 0x92, 0x7c, 0x6a, 0xff, 0x93, 0x7e, 0x6b, 0xff, 0x93, 0x7e, 0x6b, 0xff, 0x92, 0x7c, 0x6a, 0xff, 0x8a, 0x76, 0x67, 0xff, 0x8c, 0x7e, 0x76, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xca, 0xc5, 0xbf, 0xff, 0x93, 0x81, 0x70, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x8f, 0x7c, 0x6b, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x84, 0x72, 0x5f, 0xff, 0x7e, 0x6d, 0x59, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7c, 0x6a, 0x58, 0xff, 0x7a, 0x6a, 0x58, 0xff, 0x77, 0x67, 0x54, 0xff, 0x74, 0x64, 0x51, 0xff, 0x73, 0x62, 0x4f, 0xff, 0x72, 0x61, 0x4f, 0xff, 0x72, 0x62, 0x50, 0xff, 0x74, 0x64, 0x52, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x66, 0x54, 0xff, 0x75, 0x66, 0x53, 0xff, 0x6c, 0x5d, 0x49, 0xff, 0x84, 0x77, 0x67, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdd, 0xda, 0xd8, 0xff, 0xa8, 0x8f, 0x7e, 0xff, 0xa0, 0x85, 0x72, 0xff, 0xa5, 0x8b, 0x7c, 0xff, 0xa2, 0x87, 0x76, 0xff, 0xa2, 0x89, 0x77, 0xff, 0xa4, 0x8a, 0x79, 0xff, 0xa8, 0x8e, 0x7d, 0xff, 0xac, 0x93, 0x83, 0xff, 0xab, 0x92, 0x81, 0xff, 0xa7, 0x8c, 0x7b, 0xff, 0xa7, 0x8d, 0x7e, 0xff, 0xa6, 0x8c, 0x7b, 0xff, 0xa7, 0x8c, 0x7b, 0xff, 0xa5, 0x8c, 0x7b, 0xff, 0xa7, 0x8e, 0x7d, 0xff, 0xa7, 0x8c, 0x7b, 0xff, 0x90, 0x7b, 0x69, 0xff, 0x75, 0x66, 0x53, 0xff, 0x6b, 0x5f, 0x4b, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x71, 0x64, 0x4f, 0xff, 0x72, 0x63, 0x50, 0xff, 0x6c, 0x5f, 0x53, 0xff, 0x82, 0x7b, 0x7a, 0xff, 0xd6, 0xd5, 0xd6, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xaf, 0x9e, 0x91, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x92, 0x7c, 0x6a, 0xff, 0x92, 0x7d, 0x6c, 0xff, 0x92, 0x7d, 0x6b, 0xff, 0x92, 0x7b, 0x69, 0xff, 0x8a, 0x76, 0x66, 0xff, 0x8b, 0x7d, 0x75, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xcc, 0xc6, 0xc1, 0xff, 0x92, 0x7d, 0x6d, 0xff, 0x8c, 0x77, 0x65, 0xff, 0x91, 0x7b, 0x6a, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x82, 0x71, 0x5e, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7b, 0x6a, 0x58, 0xff, 0x7a, 0x6a, 0x58, 0xff, 0x78, 0x68, 0x57, 0xff, 0x78, 0x68, 0x56, 0xff, 0x78, 0x67, 0x55, 0xff, 0x77, 0x67, 0x56, 0xff, 0x77, 0x67, 0x56, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x6d, 0x5e, 0x49, 0xff, 0x75, 0x67, 0x54, 0xff, 0xc9, 0xc6, 0xc1, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xab, 0x95, 0x85, 0xff, 0xa3, 0x89, 0x78, 0xff, 0xa4, 0x8a, 0x78, 0xff, 0xa5, 0x8b, 0x7a, 0xff, 0xa5, 0x8c, 0x7a, 0xff, 0xa5, 0x8c, 0x7a, 0xff, 0xa5, 0x8b, 0x7a, 0xff, 0xa4, 0x89, 0x78, 0xff, 0xa3, 0x88, 0x76, 0xff, 0xa3, 0x89, 0x77, 0xff, 0xa4, 0x8b, 0x7a, 0xff, 0xa6, 0x8c, 0x7b, 0xff, 0xa6, 0x8c, 0x7b, 0xff, 0xa6, 0x8b, 0x79, 0xff, 0xa6, 0x8c, 0x7a, 0xff, 0xa6, 0x8c, 0x7b, 0xff, 0x9d, 0x85, 0x73, 0xff, 0x7e, 0x6d, 0x5b, 0xff, 0x6b, 0x5e, 0x4b, 0xff, 0x6d, 0x61, 0x4e, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x71, 0x63, 0x4d, 0xff, 0x6c, 0x5f, 0x51, 0xff, 0x79, 0x70, 0x6e, 0xff, 0xd3, 0xd2, 0xd2, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xaf, 0x9f, 0x91, 0xff, 0x96, 0x81, 0x6f, 0xff, 0x92, 0x7c, 0x6a, 0xff, 0x92, 0x7c, 0x6c, 0xff, 0x91, 0x7c, 0x6a, 0xff, 0x92, 0x7b, 0x68, 0xff, 0x8a, 0x75, 0x66, 0xff, 0x8b, 0x7c, 0x75, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xa9, 0x99, 0x8c, 0xff, 0x8d, 0x76, 0x64, 0xff, 0x91, 0x7b, 0x68, 0xff, 0x95, 0x7f, 0x6e, 0xff, 0x94, 0x7e, 0x6d, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x7b, 0x6a, 0x58, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x7a, 0x6a, 0x58, 0xff, 0x78, 0x69, 0x56, 0xff, 0x78, 0x68, 0x56, 0xff, 0x78, 0x68, 0x56, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x66, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x65, 0x53, 0xff, 0x71, 0x62, 0x4e, 0xff, 0x72, 0x64, 0x51, 0xff, 0x87, 0x7b, 0x6c, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe0, 0xdf, 0xdf, 0xff, 0x9f, 0x86, 0x74, 0xff, 0x9f, 0x86, 0x74, 0xff, 0xa3, 0x8a, 0x79, 0xff, 0xa4, 0x8b, 0x79, 0xff, 0xa5, 0x8b, 0x79, 0xff, 0xa5, 0x8b, 0x79, 0xff, 0xa5, 0x8b, 0x7a, 0xff, 0xa5, 0x8a, 0x7a, 0xff, 0xa4, 0x8b, 0x7a, 0xff, 0xa5, 0x8b, 0x7a, 0xff, 0xa5, 0x8c, 0x7a, 0xff, 0xa5, 0x8b, 0x7a, 0xff, 0xa5, 0x8b, 0x7a, 0xff, 0xa4, 0x8a, 0x79, 0xff, 0xa8, 0x8d, 0x7b, 0xff, 0xa1, 0x87, 0x76, 0xff, 0x89, 0x75, 0x63, 0xff, 0x72, 0x64, 0x52, 0xff, 0x6b, 0x5f, 0x4c, 0xff, 0x70, 0x63, 0x4e, 0xff, 0x72, 0x64, 0x4e, 0xff, 0x6a, 0x5d, 0x4c, 0xff, 0x74, 0x6a, 0x65, 0xff, 0xc2, 0xc0, 0xc1, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xae, 0x9e, 0x91, 0xff, 0x95, 0x80, 0x6e, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x92, 0x7d, 0x6c, 0xff, 0x91, 0x7c, 0x6a, 0xff, 0x92, 0x7b, 0x68, 0xff, 0x8a, 0x75, 0x66, 0xff, 0x8b, 0x7c, 0x74, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xdd, 0xff, 0xa2, 0x8f, 0x7f, 0xff, 0x92, 0x7b, 0x68, 0xff, 0x95, 0x7e, 0x6c, 0xff, 0x99, 0x82, 0x71, 0xff, 0x93, 0x7d, 0x6c, 0xff, 0x85, 0x72, 0x60, 0xff, 0x7d, 0x6b, 0x59, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x7a, 0x6a, 0x58, 0xff, 0x78, 0x69, 0x56, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x66, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x74, 0x66, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x53, 0xff, 0x73, 0x64, 0x50, 0xff, 0x71, 0x62, 0x4e, 0xff, 0x76, 0x69, 0x59, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xd8, 0xd3, 0xcf, 0xff, 0x9d, 0x84, 0x72, 0xff, 0x9e, 0x84, 0x72, 0xff, 0xa2, 0x89, 0x78, 0xff, 0xa2, 0x89, 0x78, 0xff, 0xa3, 0x8a, 0x79, 0xff, 0xa3, 0x8a, 0x79, 0xff, 0xa4, 0x8a, 0x79, 0xff, 0xa4, 0x8a, 0x79, 0xff, 0xa4, 0x8a, 0x79, 0xff, 0xa5, 0x8b, 0x79, 0xff, 0xa4, 0x8b, 0x79, 0xff, 0xa4, 0x8a, 0x79, 0xff, 0xa4, 0x8a, 0x79, 0xff, 0xa4, 0x8a, 0x79, 0xff, 0xa7, 0x8c, 0x7a, 0xff, 0x97, 0x80, 0x6e, 0xff, 0x75, 0x66, 0x53, 0xff, 0x6b, 0x5f, 0x4c, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x71, 0x63, 0x4e, 0xff, 0x6f, 0x60, 0x4c, 0xff, 0x6f, 0x65, 0x5d, 0xff, 0x92, 0x8c, 0x8f, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xaf, 0x9f, 0x92, 0xff, 0x95, 0x7f, 0x6e, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x92, 0x7c, 0x6a, 0xff, 0x91, 0x7b, 0x68, 0xff, 0x89, 0x74, 0x66, 0xff, 0x8a, 0x7b, 0x74, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdb, 0xd8, 0xd6, 0xff, 0x98, 0x82, 0x70, 0xff, 0x94, 0x7d, 0x6a, 0xff, 0x9a, 0x82, 0x71, 0xff, 0x99, 0x82, 0x71, 0xff, 0x90, 0x7b, 0x69, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x79, 0x69, 0x56, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x79, 0x69, 0x57, 0xff, 0x78, 0x68, 0x56, 0xff, 0x78, 0x68, 0x56, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x66, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x73, 0x64, 0x51, 0xff, 0x6f, 0x60, 0x4b, 0xff, 0x72, 0x64, 0x53, 0xff, 0x90, 0x87, 0x7d, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xd8, 0xd2, 0xce, 0xff, 0x9f, 0x86, 0x74, 0xff, 0x9d, 0x84, 0x71, 0xff, 0xa0, 0x88, 0x76, 0xff, 0xa1, 0x88, 0x77, 0xff, 0xa1, 0x89, 0x78, 0xff, 0xa2, 0x8a, 0x78, 0xff, 0xa2, 0x8a, 0x78, 0xff, 0xa3, 0x8a, 0x79, 0xff, 0xa3, 0x8a, 0x79, 0xff, 0xa3, 0x8a, 0x79, 0xff, 0xa3, 0x8a, 0x79, 0xff, 0xa2, 0x8a, 0x78, 0xff, 0xa3, 0x8a, 0x78, 0xff, 0xa4, 0x8b, 0x79, 0xff, 0x9e, 0x87, 0x74, 0xff, 0x89, 0x75, 0x62, 0xff, 0x70, 0x61, 0x4e, 0xff, 0x6c, 0x5f, 0x4b, 0xff, 0x72, 0x64, 0x4f, 0xff, 0x70, 0x61, 0x4d, 0xff, 0x6d, 0x60, 0x52, 0xff, 0x89, 0x81, 0x80, 0xff, 0xdd, 0xdd, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xaf, 0x9f, 0x92, 0xff, 0x95, 0x80, 0x6f, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x91, 0x7b, 0x6a, 0xff, 0x92, 0x7c, 0x69, 0xff, 0x91, 0x7a, 0x68, 0xff, 0x88, 0x74, 0x66, 0xff, 0x89, 0x7b, 0x74, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xaf, 0x9f, 0x92, 0xff, 0x9a, 0x84, 0x72, 0xff, 0x97, 0x80, 0x6e, 0xff, 0x9c, 0x85, 0x73, 0xff, 0x99, 0x82, 0x70, 0xff, 0x86, 0x74, 0x61, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x79, 0x69, 0x57, 0xff, 0x79, 0x69, 0x57, 0xff, 0x78, 0x68, 0x56, 0xff, 0x78, 0x68, 0x56, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x64, 0x50, 0xff, 0x71, 0x61, 0x4d, 0xff, 0x71, 0x64, 0x57, 0xff, 0x8a, 0x81, 0x7c, 0xff, 0xd9, 0xd7, 0xd7, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xcc, 0xc3, 0xbc, 0xff, 0xa0, 0x88, 0x77, 0xff, 0x99, 0x80, 0x6d, 0xff, 0x9d, 0x85, 0x72, 0xff, 0xa0, 0x89, 0x77, 0xff, 0xa1, 0x89, 0x77, 0xff, 0xa1, 0x89, 0x77, 0xff, 0xa1, 0x89, 0x77, 0xff, 0xa1, 0x88, 0x77, 0xff, 0xa1, 0x89, 0x77, 0xff, 0xa1, 0x89, 0x77, 0xff, 0xa0, 0x88, 0x76, 0xff, 0xa1, 0x8a, 0x77, 0xff, 0xa4, 0x8c, 0x7a, 0xff, 0x92, 0x7d, 0x6b, 0xff, 0x77, 0x67, 0x55, 0xff, 0x6e, 0x60, 0x4d, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x72, 0x63, 0x4e, 0xff, 0x6f, 0x60, 0x4f, 0xff, 0x74, 0x69, 0x65, 0xff, 0xd6, 0xd4, 0xd5, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xde, 0xde, 0xff, 0xa4, 0x91, 0x83, 0xff, 0x91, 0x7c, 0x6b, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x90, 0x7a, 0x68, 0xff, 0x88, 0x74, 0x64, 0xff, 0x8d, 0x7c, 0x70, 0xff, 0xda, 0xd9, 0xd8, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xde, 0xdd, 0xff, 0xa2, 0x8d, 0x7d, 0xff, 0x95, 0x7c, 0x69, 0xff, 0x9e, 0x86, 0x74, 0xff, 0x9e, 0x86, 0x74, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x78, 0x68, 0x56, 0xff, 0x78, 0x68, 0x56, 0xff, 0x78, 0x68, 0x56, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x65, 0x53, 0xff, 0x6d, 0x5e, 0x50, 0xff, 0x75, 0x69, 0x61, 0xff, 0xae, 0xa9, 0xa8, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdd, 0xdb, 0xda, 0xff, 0xbc, 0xac, 0xa1, 0xff, 0xa4, 0x8d, 0x7c, 0xff, 0x9b, 0x82, 0x6f, 0xff, 0x9d, 0x84, 0x71, 0xff, 0x9f, 0x88, 0x76, 0xff, 0xa0, 0x88, 0x76, 0xff, 0xa0, 0x88, 0x76, 0xff, 0xa0, 0x88, 0x76, 0xff, 0xa0, 0x88, 0x76, 0xff, 0x9f, 0x88, 0x76, 0xff, 0xa1, 0x89, 0x77, 0xff, 0xa1, 0x88, 0x77, 0xff, 0x88, 0x74, 0x62, 0xff, 0x6c, 0x5f, 0x4c, 0xff, 0x6e, 0x60, 0x4d, 0xff, 0x72, 0x64, 0x50, 0xff, 0x70, 0x62, 0x4d, 0xff, 0x72, 0x65, 0x59, 0xff, 0x89, 0x81, 0x83, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xde, 0xff, 0xdb, 0xd8, 0xd6, 0xff, 0xac, 0x9a, 0x8d, 0xff, 0x95, 0x80, 0x6f, 0xff, 0x8f, 0x79, 0x68, 0xff, 0x91, 0x7b, 0x6a, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x8f, 0x7b, 0x69, 0xff, 0x8e, 0x79, 0x68, 0xff, 0x8c, 0x77, 0x66, 0xff, 0x8e, 0x79, 0x69, 0xff, 0x9c, 0x8b, 0x7d, 0xff, 0xd9, 0xd7, 0xd5, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xc9, 0xbe, 0xb6, 0xff, 0x9b, 0x82, 0x70, 0xff, 0x9e, 0x86, 0x74, 0xff, 0xa0, 0x88, 0x76, 0xff, 0x9c, 0x84, 0x72, 0xff, 0x87, 0x74, 0x62, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x78, 0x68, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x77, 0x67, 0x54, 0xff, 0x72, 0x63, 0x53, 0xff, 0x6a, 0x5d, 0x52, 0xff, 0x7b, 0x70, 0x6e, 0xff, 0xbe, 0xbb, 0xbc, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xd3, 0xcb, 0xc7, 0xff, 0xa8, 0x91, 0x81, 0xff, 0x9f, 0x87, 0x75, 0xff, 0xa0, 0x89, 0x79, 0xff, 0x9f, 0x87, 0x76, 0xff, 0xa0, 0x88, 0x76, 0xff, 0xa0, 0x88, 0x76, 0xff, 0xa0, 0x88, 0x76, 0xff, 0xa1, 0x88, 0x76, 0xff, 0xa0, 0x88, 0x76, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x7f, 0x6e, 0x5c, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x74, 0x65, 0x50, 0xff, 0x6e, 0x60, 0x50, 0xff, 0x79, 0x6e, 0x69, 0xff, 0xd8, 0xd7, 0xd7, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdc, 0xdb, 0xda, 0xff, 0xa3, 0x90, 0x80, 0xff, 0x9b, 0x87, 0x76, 0xff, 0x93, 0x7c, 0x6a, 0xff, 0x92, 0x7d, 0x6b, 0xff, 0x91, 0x7b, 0x6a, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x8e, 0x79, 0x68, 0xff, 0x8e, 0x79, 0x68, 0xff, 0x90, 0x7c, 0x6b, 0xff, 0x8d, 0x78, 0x67, 0xff, 0x95, 0x82, 0x72, 0xff, 0xa3, 0x92, 0x84, 0xff, 0xde, 0xdd, 0xdd, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xde, 0xde, 0xff, 0xaa, 0x95, 0x85, 0xff, 0x9e, 0x85, 0x73, 0xff, 0xa2, 0x89, 0x77, 0xff, 0xa5, 0x8c, 0x7a, 0xff, 0x90, 0x7b, 0x69, 0xff, 0x79, 0x69, 0x57, 0xff, 0x77, 0x67, 0x55, 0xff, 0x78, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x78, 0x69, 0x53, 0xff, 0x6d, 0x60, 0x55, 0xff, 0x6c, 0x63, 0x65, 0xff, 0xbf, 0xbd, 0xbf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xd2, 0xcb, 0xc6, 0xff, 0xa6, 0x8f, 0x7f, 0xff, 0x9d, 0x86, 0x75, 0xff, 0x9e, 0x86, 0x74, 0xff, 0xa0, 0x88, 0x76, 0xff, 0x9f, 0x87, 0x75, 0xff, 0xa1, 0x89, 0x77, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x8b, 0x78, 0x65, 0xff, 0x76, 0x67, 0x54, 0xff, 0x6f, 0x62, 0x4e, 0xff, 0x72, 0x64, 0x4f, 0xff, 0x73, 0x63, 0x4e, 0xff, 0x6f, 0x62, 0x56, 0xff, 0x88, 0x81, 0x82, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xde, 0xde, 0xff, 0xca, 0xc2, 0xbb, 0xff, 0x9a, 0x84, 0x72, 0xff, 0x8f, 0x77, 0x64, 0xff, 0x92, 0x7c, 0x6a, 0xff, 0x91, 0x7b, 0x6a, 0xff, 0x91, 0x7c, 0x6b, 0xff, 0x91, 0x7c, 0x6a, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x8e, 0x79, 0x68, 0xff, 0x8d, 0x79, 0x68, 0xff, 0x8e, 0x79, 0x68, 0xff, 0x8d, 0x78, 0x66, 0xff, 0x87, 0x73, 0x61, 0xff, 0x88, 0x72, 0x5f, 0xff, 0x92, 0x7e, 0x6d, 0xff, 0xd1, 0xcd, 0xca, 0xff, 0xdf, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xd5, 0xcf, 0xca, 0xff, 0x9f, 0x85, 0x73, 0xff, 0xa3, 0x89, 0x78, 0xff, 0xa8, 0x8e, 0x7d, 0xff, 0x99, 0x82, 0x70, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x78, 0x68, 0x56, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x7a, 0x6b, 0x57, 0xff, 0x6d, 0x5f, 0x54, 0xff, 0xb4, 0xb0, 0xb1, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdd, 0xda, 0xd9, 0xff, 0xa7, 0x91, 0x81, 0xff, 0x9f, 0x88, 0x77, 0xff, 0x9d, 0x85, 0x73, 0xff, 0x9f, 0x86, 0x75, 0xff, 0x9e, 0x86, 0x74, 0xff, 0xa1, 0x88, 0x76, 0xff, 0x9c, 0x85, 0x73, 0xff, 0x81, 0x6f, 0x5c, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x73, 0x65, 0x50, 0xff, 0x70, 0x61, 0x4e, 0xff, 0x72, 0x67, 0x5f, 0xff, 0xb6, 0xb3, 0xb6, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xde, 0xff, 0xa7, 0x96, 0x87, 0xff, 0x8c, 0x77, 0x64, 0xff, 0x88, 0x74, 0x62, 0xff, 0x91, 0x7c, 0x6a, 0xff, 0x93, 0x7d, 0x6b, 0xff, 0x92, 0x7d, 0x6d, 0xff, 0x91, 0x7c, 0x6b, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x90, 0x7b, 0x6a, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x8f, 0x79, 0x68, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x8c, 0x78, 0x67, 0xff, 0x8c, 0x79, 0x67, 0xff, 0x8d, 0x79, 0x66, 0xff, 0x8e, 0x7c, 0x69, 0xff, 0x80, 0x6c, 0x59, 0xff, 0x87, 0x75, 0x63, 0xff, 0xa2, 0x94, 0x86, 0xff, 0xdf, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xdd, 0xff, 0xa3, 0x8a, 0x77, 0xff, 0xa5, 0x8a, 0x78, 0xff, 0xa9, 0x8f, 0x7e, 0xff, 0xa1, 0x89, 0x77, 0xff, 0x8e, 0x79, 0x67, 0xff, 0x7a, 0x69, 0x57, 0xff, 0x76, 0x66, 0x54, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x65, 0x54, 0xff, 0x7d, 0x6e, 0x5b, 0xff, 0x75, 0x67, 0x59, 0xff, 0xd7, 0xd6, 0xd5, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xd9, 0xd6, 0xd3, 0xff, 0x9f, 0x89, 0x76, 0xff, 0xa0, 0x89, 0x78, 0xff, 0x9e, 0x86, 0x74, 0xff, 0x9e, 0x86, 0x74, 0xff, 0x9d, 0x86, 0x73, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x6c, 0x5f, 0x4b, 0xff, 0x72, 0x64, 0x50, 0xff, 0x73, 0x64, 0x50, 0xff, 0x6e, 0x60, 0x51, 0xff, 0x82, 0x78, 0x75, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xb1, 0x9f, 0x92, 0xff, 0x87, 0x72, 0x5e, 0xff, 0x88, 0x79, 0x69, 0xff, 0x86, 0x76, 0x65, 0xff, 0x92, 0x80, 0x6f, 0xff, 0x93, 0x7e, 0x6d, 0xff, 0x8f, 0x79, 0x68, 0xff, 0x90, 0x7a, 0x68, 0xff, 0x8b, 0x75, 0x63, 0xff, 0x88, 0x73, 0x61, 0xff, 0x88, 0x74, 0x61, 0xff, 0x88, 0x73, 0x60, 0xff, 0x89, 0x72, 0x60, 0xff, 0x8a, 0x75, 0x64, 0xff, 0x8c, 0x77, 0x65, 0xff, 0x8d, 0x7a, 0x67, 0xff, 0x87, 0x74, 0x62, 0xff, 0x82, 0x72, 0x61, 0xff, 0x79, 0x6b, 0x58, 0xff, 0x86, 0x78, 0x67, 0xff, 0x82, 0x70, 0x5e, 0xff, 0xb8, 0xaf, 0xa6, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xde, 0xde, 0xff, 0xae, 0x96, 0x85, 0xff, 0xa7, 0x8d, 0x7b, 0xff, 0xaa, 0x90, 0x7e, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x7a, 0x69, 0x58, 0xff, 0x74, 0x65, 0x53, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x65, 0x53, 0xff, 0x79, 0x69, 0x57, 0xff, 0x71, 0x62, 0x52, 0xff, 0xbb, 0xb7, 0xb2, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xd8, 0xd4, 0xd1, 0xff, 0x99, 0x81, 0x6e, 0xff, 0xa0, 0x8a, 0x78, 0xff, 0x9c, 0x85, 0x72, 0xff, 0x9d, 0x85, 0x73, 0xff, 0x9d, 0x86, 0x73, 0xff, 0x9b, 0x85, 0x72, 0xff, 0x8f, 0x7b, 0x68, 0xff, 0x78, 0x68, 0x55, 0xff, 0x6e, 0x60, 0x4d, 0xff, 0x74, 0x64, 0x50, 0xff, 0x73, 0x63, 0x50, 0xff, 0x6d, 0x60, 0x56, 0xff, 0xac, 0xa7, 0xa6, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xcb, 0xc3, 0xbc, 0xff, 0x92, 0x7b, 0x69, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x78, 0x6c, 0x5a, 0xff, 0xa6, 0x9f, 0x94, 0xff, 0xb6, 0xae, 0xa4, 0xff, 0x9d, 0x8b, 0x7c, 0xff, 0x8e, 0x78, 0x66, 0xff, 0x86, 0x70, 0x5d, 0xff, 0x82, 0x70, 0x5d, 0xff, 0x81, 0x71, 0x5f, 0xff, 0x82, 0x72, 0x60, 0xff, 0x87, 0x75, 0x64, 0xff, 0x8b, 0x78, 0x68, 0xff, 0x8a, 0x76, 0x65, 0xff, 0x87, 0x72, 0x5f, 0xff, 0x86, 0x72, 0x5f, 0xff, 0x89, 0x7a, 0x6d, 0xff, 0x8d, 0x83, 0x7b, 0xff, 0x96, 0x8d, 0x81, 0xff, 0x7c, 0x6d, 0x5d, 0xff, 0x7e, 0x6a, 0x58, 0xff, 0x8b, 0x78, 0x67, 0xff, 0xd9, 0xd6, 0xd4, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdc, 0xda, 0xd8, 0xff, 0xac, 0x92, 0x81, 0xff, 0xa9, 0x8e, 0x7c, 0xff, 0xb0, 0x95, 0x83, 0xff, 0x9e, 0x87, 0x74, 0xff, 0x7b, 0x6a, 0x58, 0xff, 0x73, 0x63, 0x51, 0xff, 0x77, 0x67, 0x54, 0xff, 0x76, 0x67, 0x54, 0xff, 0x75, 0x66, 0x53, 0xff, 0x76, 0x67, 0x53, 0xff, 0x6d, 0x5f, 0x4c, 0xff, 0x8c, 0x82, 0x78, 0xff, 0xdf, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xcf, 0xc8, 0xc2, 0xff, 0x95, 0x7d, 0x69, 0xff, 0x9e, 0x88, 0x75, 0xff, 0x9b, 0x84, 0x71, 0xff, 0x9b, 0x84, 0x72, 0xff, 0x9c, 0x85, 0x73, 0xff, 0x98, 0x82, 0x6f, 0xff, 0x89, 0x76, 0x63, 0xff, 0x77, 0x68, 0x54, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x74, 0x64, 0x50, 0xff, 0x74, 0x64, 0x51, 0xff, 0x72, 0x68, 0x63, 0xff, 0xdc, 0xdb, 0xdc, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdd, 0xda, 0xd9, 0xff, 0x9c, 0x86, 0x75, 0xff, 0x8d, 0x75, 0x62, 0xff, 0x7c, 0x6d, 0x59, 0xff, 0x97, 0x91, 0x82, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xde, 0xff, 0x9c, 0x8d, 0x7e, 0xff, 0x92, 0x85, 0x75, 0xff, 0xa0, 0x96, 0x8a, 0xff, 0xb5, 0xb0, 0xa9, 0xff, 0xb3, 0xac, 0xa6, 0xff, 0xb9, 0xb2, 0xab, 0xff, 0xbf, 0xb7, 0xb0, 0xff, 0xaa, 0x9d, 0x8f, 0xff, 0x94, 0x81, 0x71, 0xff, 0x94, 0x85, 0x79, 0xff, 0xb8, 0xb2, 0xae, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xa9, 0x9d, 0x92, 0xff, 0x82, 0x70, 0x5d, 0xff, 0x7f, 0x6c, 0x59, 0xff, 0x93, 0x83, 0x73, 0xff, 0xde, 0xde, 0xdd, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xde, 0xde, 0xff, 0xb1, 0x96, 0x85, 0xff, 0xaa, 0x8d, 0x7b, 0xff, 0xb3, 0x96, 0x85, 0xff, 0xa5, 0x8b, 0x79, 0xff, 0x83, 0x71, 0x5e, 0xff, 0x75, 0x65, 0x54, 0xff, 0x76, 0x65, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x76, 0x67, 0x54, 0xff, 0x72, 0x62, 0x4f, 0xff, 0x81, 0x75, 0x68, 0xff, 0xd9, 0xd8, 0xd8, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xb1, 0xa1, 0x93, 0xff, 0x93, 0x7a, 0x67, 0xff, 0x9b, 0x84, 0x72, 0xff, 0x9a, 0x83, 0x71, 0xff, 0x9b, 0x84, 0x72, 0xff, 0x9c, 0x85, 0x73, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x83, 0x71, 0x5e, 0xff, 0x74, 0x66, 0x51, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x73, 0x64, 0x4f, 0xff, 0x72, 0x64, 0x52, 0xff, 0x7c, 0x73, 0x70, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xde, 0xdd, 0xff, 0xa3, 0x8f, 0x80, 0xff, 0x93, 0x7c, 0x6a, 0xff, 0x93, 0x7c, 0x6c, 0xff, 0x85, 0x71, 0x5f, 0xff, 0xa3, 0x99, 0x8e, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xd2, 0xd0, 0xcd, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xd3, 0xcf, 0xcb, 0xff, 0xdd, 0xdc, 0xdb, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xae, 0xa1, 0x95, 0xff, 0x84, 0x71, 0x5e, 0xff, 0x82, 0x70, 0x5f, 0xff, 0x82, 0x70, 0x5e, 0xff, 0xb4, 0xab, 0xa2, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xde, 0xde, 0xff, 0xb6, 0x9c, 0x8c, 0xff, 0xac, 0x8d, 0x7b, 0xff, 0xb5, 0x97, 0x86, 0xff, 0xab, 0x8f, 0x7e, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x7a, 0x69, 0x58, 0xff, 0x74, 0x64, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x54, 0xff, 0x71, 0x62, 0x4e, 0xff, 0x75, 0x67, 0x55, 0xff, 0x94, 0x8a, 0x80, 0xff, 0xdd, 0xdc, 0xdc, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xdc, 0xda, 0xff, 0xa8, 0x94, 0x85, 0xff, 0x95, 0x7c, 0x69, 0xff, 0x9a, 0x83, 0x71, 0xff, 0x9a, 0x83, 0x71, 0xff, 0x9a, 0x83, 0x72, 0xff, 0x9d, 0x85, 0x73, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x7d, 0x6c, 0x5a, 0xff, 0x72, 0x64, 0x50, 0xff, 0x73, 0x65, 0x51, 0xff, 0x73, 0x64, 0x51, 0xff, 0x72, 0x63, 0x54, 0xff, 0x86, 0x7e, 0x7b, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdb, 0xd9, 0xd7, 0xff, 0x96, 0x80, 0x6f, 0xff, 0x95, 0x7f, 0x6e, 0xff, 0x93, 0x7d, 0x6c, 0xff, 0x8d, 0x76, 0x64, 0xff, 0x9a, 0x88, 0x78, 0xff, 0xd7, 0xd5, 0xd2, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xcf, 0xc8, 0xc3, 0xff, 0x96, 0x84, 0x74, 0xff, 0x81, 0x6f, 0x5c, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x83, 0x71, 0x60, 0xff, 0x8b, 0x7a, 0x6a, 0xff, 0xdb, 0xda, 0xd9, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xb8, 0x9f, 0x90, 0xff, 0xaa, 0x8b, 0x79, 0xff, 0xb4, 0x97, 0x86, 0xff, 0xad, 0x91, 0x80, 0xff, 0x96, 0x7f, 0x6e, 0xff, 0x7d, 0x6b, 0x5a, 0xff, 0x74, 0x64, 0x52, 0xff, 0x74, 0x65, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x76, 0x68, 0x54, 0xff, 0x75, 0x67, 0x54, 0xff, 0x74, 0x67, 0x54, 0xff, 0x86, 0x7b, 0x6a, 0xff, 0x84, 0x79, 0x69, 0xff, 0x86, 0x7a, 0x6b, 0xff, 0x79, 0x6d, 0x5c, 0xff, 0x96, 0x8d, 0x7f, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xe0, 0xdf, 0xdf, 0xff, 0xdf, 0xdd, 0xdc, 0xff, 0xc8, 0xbf, 0xb7, 0xff, 0xa6, 0x92, 0x83, 0xff, 0x9b, 0x84, 0x73, 0xff, 0x98, 0x81, 0x6f, 0xff, 0x99, 0x83, 0x71, 0xff, 0x99, 0x83, 0x71, 0xff, 0x9a, 0x83, 0x71, 0xff, 0x9c, 0x84, 0x73, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x81, 0x6f, 0x5c, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7c, 0x6a, 0x58, 0xff, 0x7a, 0x6a, 0x5c, 0xff, 0x8d, 0x82, 0x7d, 0xff, 0xdb, 0xda, 0xda, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xcc, 0xc5, 0xc0, 0xff, 0x8f, 0x79, 0x66, 0xff, 0x90, 0x7b, 0x6a, 0xff, 0x93, 0x7d, 0x6c, 0xff, 0x94, 0x7c, 0x6b, 0xff, 0x8b, 0x76, 0x64, 0xff, 0x91, 0x82, 0x72, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0x9a, 0x88, 0x79, 0xff, 0x85, 0x71, 0x5f, 0xff, 0x84, 0x72, 0x60, 0xff, 0x85, 0x74, 0x62, 0xff, 0x84, 0x71, 0x60, 0xff, 0x7d, 0x6a, 0x57, 0xff, 0xb7, 0xae, 0xa5, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdd, 0xdc, 0xdb, 0xff, 0xa7, 0x8f, 0x7e, 0xff, 0x9e, 0x83, 0x71, 0xff, 0xa5, 0x8c, 0x7b, 0xff, 0xa1, 0x88, 0x76, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x7d, 0x6b, 0x59, 0xff, 0x74, 0x65, 0x53, 0xff, 0x74, 0x65, 0x53, 0xff, 0x74, 0x65, 0x53, 0xff, 0x74, 0x64, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x72, 0x65, 0x50, 0xff, 0x71, 0x62, 0x4e, 0xff, 0x6b, 0x5c, 0x47, 0xff, 0x6c, 0x5e, 0x4a, 0xff, 0x6b, 0x5e, 0x4a, 0xff, 0x6c, 0x5f, 0x4c, 0xff, 0x6c, 0x5e, 0x4b, 0xff, 0x73, 0x67, 0x54, 0xff, 0x8f, 0x86, 0x76, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xbb, 0xae, 0xa2, 0xff, 0xaf, 0x9e, 0x90, 0xff, 0xab, 0x99, 0x8a, 0xff, 0xa1, 0x8d, 0x7d, 0xff, 0x9c, 0x87, 0x75, 0xff, 0x99, 0x83, 0x72, 0xff, 0x96, 0x7f, 0x6d, 0xff, 0x96, 0x80, 0x6f, 0xff, 0x99, 0x82, 0x71, 0xff, 0x99, 0x82, 0x71, 0xff, 0x99, 0x82, 0x71, 0xff, 0x98, 0x82, 0x70, 0xff, 0x99, 0x83, 0x71, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x8f, 0x7a, 0x68, 0xff, 0x8c, 0x79, 0x67, 0xff, 0x8e, 0x7a, 0x68, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x8c, 0x78, 0x69, 0xff, 0x93, 0x80, 0x74, 0xff, 0xa5, 0x94, 0x89, 0xff, 0xd0, 0xc8, 0xc3, 0xff, 0xdb, 0xd7, 0xd4, 0xff, 0xd5, 0xd0, 0xcc, 0xff, 0xd5, 0xd0, 0xcc, 0xff, 0xd4, 0xce, 0xca, 0xff, 0xd3, 0xcd, 0xc9, 0xff, 0xd3, 0xce, 0xc9, 0xff, 0xd3, 0xce, 0xc9, 0xff, 0xd3, 0xce, 0xc9, 0xff, 0xd3, 0xcd, 0xc9, 0xff, 0xd6, 0xd2, 0xce, 0xff, 0xc8, 0xbf, 0xb8, 0xff, 0xa7, 0x96, 0x88, 0xff, 0x98, 0x85, 0x74, 0xff, 0x90, 0x7c, 0x6a, 0xff, 0x91, 0x7c, 0x6a, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x94, 0x7d, 0x6c, 0xff, 0x80, 0x6b, 0x57, 0xff, 0x7f, 0x70, 0x5e, 0xff, 0xd4, 0xd2, 0xcf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0x93, 0x7f, 0x6e, 0xff, 0x82, 0x6d, 0x5a, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x85, 0x73, 0x61, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x88, 0x78, 0x67, 0xff, 0x9b, 0x8d, 0x80, 0xff, 0xa7, 0x9a, 0x8d, 0xff, 0xa8, 0x9b, 0x8f, 0xff, 0xa5, 0x98, 0x8c, 0xff, 0xa5, 0x98, 0x8b, 0xff, 0xa4, 0x98, 0x8a, 0xff, 0xa3, 0x98, 0x8a, 0xff, 0xa3, 0x97, 0x8a, 0xff, 0xa3, 0x97, 0x8a, 0xff, 0xa3, 0x97, 0x8a, 0xff, 0xa2, 0x97, 0x8a, 0xff, 0xa2, 0x96, 0x89, 0xff, 0xa2, 0x96, 0x89, 0xff, 0xa4, 0x99, 0x8c, 0xff, 0x98, 0x8a, 0x7c, 0xff, 0x87, 0x74, 0x62, 0xff, 0x86, 0x72, 0x60, 0xff, 0x88, 0x75, 0x63, 0xff, 0x86, 0x73, 0x61, 0xff, 0x81, 0x6e, 0x5c, 0xff, 0x78, 0x68, 0x56, 0xff, 0x74, 0x66, 0x53, 0xff, 0x74, 0x66, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x64, 0x52, 0xff, 0x73, 0x65, 0x51, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x6e, 0x62, 0x4f, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6c, 0x5f, 0x4d, 0xff, 0x65, 0x58, 0x44, 0xff, 0x6c, 0x61, 0x4c, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xdf, 0xdf, 0xdf, 0xff, 0x96, 0x81, 0x6f, 0xff, 0x92, 0x7c, 0x69, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x7f, 0x6d, 0xff, 0x95, 0x7d, 0x6b, 0xff, 0x95, 0x7e, 0x6c, 0xff, 0x95, 0x80, 0x6e, 0xff, 0x97, 0x80, 0x6f, 0xff, 0x97, 0x81, 0x70, 0xff, 0x98, 0x81, 0x70, 0xff, 0x98, 0x81, 0x70, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x99, 0x82, 0x71, 0xff, 0x9a, 0x83, 0x72, 0xff, 0x9a, 0x83, 0x71, 0xff, 0x9a, 0x83, 0x72, 0xff, 0x9a, 0x83, 0x71, 0xff, 0x98, 0x81, 0x6f, 0xff, 0x96, 0x7e, 0x6c, 0xff, 0x95, 0x7e, 0x6c, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6c, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x93, 0x7d, 0x6b, 0xff, 0x93, 0x7d, 0x6b, 0xff, 0x93, 0x7d, 0x6b, 0xff, 0x92, 0x7c, 0x6a, 0xff, 0x92, 0x7c, 0x6a, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x90, 0x7b, 0x69, 0xff, 0x91, 0x7d, 0x6b, 0xff, 0x91, 0x7c, 0x6a, 0xff, 0x92, 0x7c, 0x6a, 0xff, 0x93, 0x7c, 0x6a, 0xff, 0x7e, 0x6b, 0x57, 0xff, 0x7d, 0x71, 0x61, 0xff, 0xdf, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xb6, 0xa7, 0x9b, 0xff, 0x8b, 0x76, 0x63, 0xff, 0x80, 0x6f, 0x5d, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x83, 0x72, 0x60, 0xff, 0x80, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5a, 0xff, 0x80, 0x6e, 0x5b, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x7e, 0x6b, 0x5a, 0xff, 0x7d, 0x6b, 0x59, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7c, 0x6a, 0x57, 0xff, 0x7c, 0x6a, 0x57, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7a, 0x69, 0x56, 0xff, 0x7a, 0x69, 0x56, 0xff, 0x7a, 0x69, 0x55, 0xff, 0x79, 0x67, 0x55, 0xff, 0x78, 0x67, 0x55, 0xff, 0x75, 0x65, 0x53, 0xff, 0x76, 0x66, 0x55, 0xff, 0x75, 0x66, 0x54, 0xff, 0x73, 0x64, 0x52, 0xff, 0x73, 0x64, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x73, 0x64, 0x51, 0xff, 0x72, 0x64, 0x4f, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x66, 0x58, 0x43, 0xff, 0x79, 0x6e, 0x5c, 0xff, 0xde, 0xdd, 0xdd, 0xff,
-  0xdf, 0xde, 0xdc, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x8e, 0x76, 0x63, 0xff, 0x93, 0x7e, 0x6b, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x96, 0x7f, 0x6d, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x96, 0x81, 0x6f, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x98, 0x82, 0x70, 0xff, 0x98, 0x82, 0x70, 0xff, 0x98, 0x82, 0x70, 0xff, 0x98, 0x82, 0x70, 0xff, 0x98, 0x81, 0x70, 0xff, 0x97, 0x80, 0x6e, 0xff, 0x94, 0x7e, 0x6b, 0xff, 0x93, 0x7c, 0x6a, 0xff, 0x93, 0x7c, 0x6a, 0xff, 0x93, 0x7c, 0x6a, 0xff, 0x92, 0x7c, 0x69, 0xff, 0x92, 0x7b, 0x69, 0xff, 0x92, 0x7b, 0x69, 0xff, 0x92, 0x7b, 0x69, 0xff, 0x91, 0x7b, 0x68, 0xff, 0x91, 0x7a, 0x68, 0xff, 0x90, 0x7a, 0x68, 0xff, 0x90, 0x79, 0x68, 0xff, 0x8f, 0x79, 0x67, 0xff, 0x8f, 0x79, 0x67, 0xff, 0x90, 0x7b, 0x68, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x91, 0x7b, 0x6a, 0xff, 0x90, 0x7a, 0x68, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x80, 0x75, 0x68, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xc1, 0xb1, 0xa7, 0xff, 0x91, 0x7c, 0x6a, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7e, 0x6c, 0x59, 0xff, 0x7c, 0x6a, 0x57, 0xff, 0x7b, 0x69, 0x56, 0xff, 0x7b, 0x68, 0x56, 0xff, 0x7b, 0x68, 0x56, 0xff, 0x7a, 0x67, 0x55, 0xff, 0x7a, 0x68, 0x55, 0xff, 0x7a, 0x68, 0x55, 0xff, 0x79, 0x67, 0x54, 0xff, 0x78, 0x66, 0x53, 0xff, 0x77, 0x66, 0x52, 0xff, 0x77, 0x65, 0x51, 0xff, 0x75, 0x64, 0x52, 0xff, 0x74, 0x63, 0x51, 0xff, 0x74, 0x64, 0x52, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x65, 0x53, 0xff, 0x74, 0x64, 0x52, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x73, 0x65, 0x51, 0xff, 0x73, 0x64, 0x51, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x6f, 0x62, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x67, 0x58, 0x43, 0xff, 0x71, 0x64, 0x52, 0xff, 0xc2, 0xbd, 0xba, 0xff,
-  0xde, 0xdc, 0xda, 0xff, 0x9c, 0x87, 0x78, 0xff, 0x90, 0x79, 0x67, 0xff, 0x96, 0x7f, 0x6d, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x95, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x96, 0x81, 0x6f, 0xff, 0x96, 0x81, 0x6f, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x96, 0x81, 0x6f, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x92, 0x7d, 0x6c, 0xff, 0x92, 0x7c, 0x6c, 0xff, 0x91, 0x7c, 0x6b, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x90, 0x7b, 0x69, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x8d, 0x79, 0x66, 0xff, 0x7f, 0x6c, 0x5b, 0xff, 0x84, 0x78, 0x6d, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xc7, 0xb8, 0xae, 0xff, 0x95, 0x80, 0x6e, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7e, 0x6d, 0x5b, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7b, 0x6b, 0x57, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x7a, 0x69, 0x58, 0xff, 0x79, 0x69, 0x57, 0xff, 0x78, 0x68, 0x56, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x73, 0x65, 0x51, 0xff, 0x73, 0x65, 0x51, 0xff, 0x73, 0x64, 0x51, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6f, 0x61, 0x4d, 0xff, 0x6a, 0x5c, 0x47, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x92, 0x89, 0x83, 0xff,
-  0xe1, 0xe0, 0xdf, 0xff, 0x9d, 0x8b, 0x7a, 0xff, 0x90, 0x79, 0x66, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6c, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x93, 0x7e, 0x6c, 0xff, 0x93, 0x7e, 0x6c, 0xff, 0x93, 0x7d, 0x6c, 0xff, 0x92, 0x7c, 0x6c, 0xff, 0x91, 0x7c, 0x6b, 0xff, 0x91, 0x7b, 0x6a, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x8f, 0x7a, 0x68, 0xff, 0x8d, 0x78, 0x66, 0xff, 0x81, 0x6e, 0x5d, 0xff, 0x87, 0x79, 0x6e, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xc5, 0xb4, 0xab, 0xff, 0x93, 0x7d, 0x6c, 0xff, 0x7d, 0x6b, 0x59, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x59, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7a, 0x6a, 0x58, 0xff, 0x79, 0x69, 0x57, 0xff, 0x79, 0x69, 0x57, 0xff, 0x78, 0x68, 0x56, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x65, 0x54, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x73, 0x64, 0x51, 0xff, 0x73, 0x64, 0x51, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x62, 0x4f, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x67, 0x5b, 0x45, 0xff, 0x6a, 0x5e, 0x4a, 0xff, 0x8c, 0x85, 0x7e, 0xff,
-  0xe1, 0xe0, 0xdf, 0xff, 0x9b, 0x87, 0x76, 0xff, 0x8e, 0x77, 0x64, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x94, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x97, 0x80, 0x6e, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x97, 0x80, 0x6f, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x97, 0x81, 0x6e, 0xff, 0x96, 0x7f, 0x6c, 0xff, 0x93, 0x7d, 0x6a, 0xff, 0x90, 0x7a, 0x68, 0xff, 0x90, 0x79, 0x67, 0xff, 0x90, 0x7a, 0x68, 0xff, 0x8f, 0x79, 0x67, 0xff, 0x8f, 0x78, 0x66, 0xff, 0x8e, 0x78, 0x66, 0xff, 0x8e, 0x77, 0x65, 0xff, 0x8e, 0x77, 0x65, 0xff, 0x8d, 0x77, 0x64, 0xff, 0x8d, 0x76, 0x63, 0xff, 0x8d, 0x76, 0x63, 0xff, 0x8e, 0x77, 0x65, 0xff, 0x8f, 0x79, 0x68, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x8e, 0x79, 0x68, 0xff, 0x8f, 0x79, 0x68, 0xff, 0x8e, 0x7a, 0x68, 0xff, 0x83, 0x70, 0x5e, 0xff, 0x8a, 0x7c, 0x6e, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xbd, 0xad, 0xa3, 0xff, 0x8d, 0x78, 0x65, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x80, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5c, 0xff, 0x7f, 0x6d, 0x5a, 0xff, 0x7d, 0x6a, 0x57, 0xff, 0x7a, 0x68, 0x55, 0xff, 0x79, 0x67, 0x54, 0xff, 0x79, 0x67, 0x53, 0xff, 0x79, 0x67, 0x53, 0xff, 0x78, 0x66, 0x52, 0xff, 0x78, 0x66, 0x52, 0xff, 0x77, 0x65, 0x51, 0xff, 0x76, 0x64, 0x51, 0xff, 0x75, 0x64, 0x51, 0xff, 0x73, 0x62, 0x50, 0xff, 0x73, 0x62, 0x4f, 0xff, 0x74, 0x64, 0x51, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x65, 0x54, 0xff, 0x74, 0x64, 0x52, 0xff, 0x74, 0x64, 0x52, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x74, 0x66, 0x52, 0xff, 0x73, 0x65, 0x51, 0xff, 0x73, 0x64, 0x51, 0xff, 0x72, 0x63, 0x50, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x72, 0x63, 0x4f, 0xff, 0x70, 0x62, 0x4d, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x6a, 0x5c, 0x47, 0xff, 0x68, 0x5b, 0x46, 0xff, 0x69, 0x5d, 0x48, 0xff, 0x66, 0x59, 0x46, 0xff, 0x72, 0x67, 0x56, 0xff, 0xc9, 0xc7, 0xc4, 0xff,
-  0xe1, 0xe0, 0xe0, 0xff, 0x93, 0x7d, 0x6c, 0xff, 0x8b, 0x74, 0x61, 0xff, 0x90, 0x7b, 0x69, 0xff, 0x91, 0x7c, 0x6a, 0xff, 0x91, 0x7c, 0x6a, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x94, 0x7d, 0x6c, 0xff, 0x95, 0x7e, 0x6c, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x95, 0x7e, 0x6c, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x94, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x95, 0x7f, 0x6e, 0xff, 0x96, 0x7f, 0x6d, 0xff, 0x94, 0x7f, 0x6c, 0xff, 0x92, 0x7b, 0x69, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x93, 0x7e, 0x6d, 0xff, 0x93, 0x7e, 0x6d, 0xff, 0x92, 0x7f, 0x6c, 0xff, 0x92, 0x7e, 0x6c, 0xff, 0x92, 0x7d, 0x6c, 0xff, 0x92, 0x7c, 0x6c, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x91, 0x7c, 0x6a, 0xff, 0x91, 0x7c, 0x6a, 0xff, 0x91, 0x7c, 0x6a, 0xff, 0x91, 0x7c, 0x6a, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x8e, 0x79, 0x68, 0xff, 0x8e, 0x7a, 0x69, 0xff, 0x8e, 0x79, 0x68, 0xff, 0x8e, 0x79, 0x68, 0xff, 0x8e, 0x79, 0x67, 0xff, 0x85, 0x70, 0x5d, 0xff, 0x8f, 0x7e, 0x6d, 0xff, 0xe0, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xa7, 0x95, 0x87, 0xff, 0x85, 0x71, 0x5e, 0xff, 0x7f, 0x6e, 0x5c, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6f, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7f, 0x6c, 0x5a, 0xff, 0x7f, 0x6e, 0x5c, 0xff, 0x7e, 0x6e, 0x5c, 0xff, 0x7e, 0x6d, 0x5c, 0xff, 0x7e, 0x6d, 0x5b, 0xff, 0x7e, 0x6d, 0x5b, 0xff, 0x7d, 0x6c, 0x5a, 0xff, 0x7d, 0x6b, 0x59, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7b, 0x6b, 0x58, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x79, 0x69, 0x57, 0xff, 0x78, 0x69, 0x57, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x67, 0x56, 0xff, 0x75, 0x66, 0x54, 0xff, 0x74, 0x65, 0x53, 0xff, 0x74, 0x66, 0x52, 0xff, 0x75, 0x66, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x73, 0x65, 0x51, 0xff, 0x73, 0x65, 0x51, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x6e, 0x60, 0x4d, 0xff, 0x6d, 0x5f, 0x4c, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6e, 0x62, 0x50, 0xff, 0x70, 0x64, 0x54, 0xff, 0x7a, 0x6f, 0x64, 0xff, 0x8d, 0x86, 0x80, 0xff, 0xdf, 0xdf, 0xdf, 0xff,
-  0xdf, 0xdf, 0xdf, 0xff, 0xa0, 0x8c, 0x7e, 0xff, 0x8f, 0x7a, 0x68, 0xff, 0x8c, 0x76, 0x64, 0xff, 0x8f, 0x79, 0x69, 0xff, 0x90, 0x7b, 0x69, 0xff, 0x8f, 0x79, 0x67, 0xff, 0x8f, 0x78, 0x66, 0xff, 0x91, 0x7d, 0x6a, 0xff, 0x93, 0x7d, 0x6c, 0xff, 0x93, 0x7d, 0x6c, 0xff, 0x93, 0x7d, 0x6c, 0xff, 0x93, 0x7e, 0x6c, 0xff, 0x94, 0x7e, 0x6d, 0xff, 0x95, 0x7f, 0x6e, 0xff, 0x8f, 0x7c, 0x6a, 0xff, 0x83, 0x72, 0x5f, 0xff, 0x81, 0x6f, 0x5c, 0xff, 0x82, 0x70, 0x5c, 0xff, 0x81, 0x6f, 0x5c, 0xff, 0x7d, 0x6b, 0x5b, 0xff, 0x79, 0x67, 0x5d, 0xff, 0x84, 0x74, 0x6e, 0xff, 0x9a, 0x8c, 0x84, 0xff, 0xce, 0xc8, 0xc5, 0xff, 0xdd, 0xdb, 0xd9, 0xff, 0xdb, 0xd9, 0xd7, 0xff, 0xdb, 0xd9, 0xd7, 0xff, 0xda, 0xd8, 0xd6, 0xff, 0xda, 0xd8, 0xd6, 0xff, 0xdb, 0xd9, 0xd8, 0xff, 0xdb, 0xd9, 0xd7, 0xff, 0xda, 0xd7, 0xd5, 0xff, 0xdd, 0xdb, 0xd9, 0xff, 0xcf, 0xc9, 0xc6, 0xff, 0xa4, 0x95, 0x8b, 0xff, 0x93, 0x80, 0x71, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x8c, 0x78, 0x67, 0xff, 0x85, 0x70, 0x5c, 0xff, 0x92, 0x7f, 0x6d, 0xff, 0xd7, 0xd4, 0xd2, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdd, 0xdb, 0xda, 0xff, 0x90, 0x7e, 0x6d, 0xff, 0x7c, 0x68, 0x55, 0xff, 0x81, 0x70, 0x5f, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x81, 0x6e, 0x5b, 0xff, 0x7b, 0x6a, 0x5b, 0xff, 0x75, 0x68, 0x5f, 0xff, 0x80, 0x73, 0x6d, 0xff, 0x91, 0x85, 0x7d, 0xff, 0xa0, 0x95, 0x8c, 0xff, 0xc6, 0xc0, 0xbb, 0xff, 0xd0, 0xcd, 0xca, 0xff, 0xcd, 0xc9, 0xc5, 0xff, 0xce, 0xc9, 0xc6, 0xff, 0xcd, 0xc9, 0xc5, 0xff, 0xcd, 0xc9, 0xc6, 0xff, 0xcd, 0xc9, 0xc5, 0xff, 0xce, 0xcb, 0xc7, 0xff, 0xcb, 0xc7, 0xc3, 0xff, 0xad, 0xa6, 0x9f, 0xff, 0x91, 0x84, 0x78, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7e, 0x6c, 0x59, 0xff, 0x7f, 0x6e, 0x5c, 0xff, 0x7e, 0x6d, 0x5b, 0xff, 0x7a, 0x6a, 0x58, 0xff, 0x76, 0x66, 0x53, 0xff, 0x73, 0x64, 0x51, 0xff, 0x73, 0x64, 0x51, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x72, 0x64, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x67, 0x5a, 0x4e, 0xff, 0x67, 0x5b, 0x54, 0xff, 0x7b, 0x72, 0x6c, 0xff, 0x94, 0x8c, 0x86, 0xff, 0xd3, 0xd1, 0xd0, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xcc, 0xc6, 0xbf, 0xff, 0xa8, 0x98, 0x8a, 0xff, 0xa3, 0x91, 0x84, 0xff, 0xa2, 0x90, 0x83, 0xff, 0x9e, 0x8d, 0x7e, 0xff, 0x98, 0x87, 0x78, 0xff, 0x90, 0x7d, 0x6d, 0xff, 0x91, 0x7e, 0x6d, 0xff, 0x92, 0x7d, 0x6c, 0xff, 0x91, 0x7c, 0x6b, 0xff, 0x91, 0x7c, 0x6b, 0xff, 0x93, 0x7d, 0x6c, 0xff, 0x95, 0x7f, 0x6e, 0xff, 0x8b, 0x78, 0x66, 0xff, 0x75, 0x67, 0x54, 0xff, 0x6e, 0x60, 0x4c, 0xff, 0x6f, 0x62, 0x4d, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x67, 0x5a, 0x4c, 0xff, 0x76, 0x6b, 0x6a, 0xff, 0xc5, 0xc1, 0xc3, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xce, 0xc9, 0xc5, 0xff, 0x88, 0x73, 0x61, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x87, 0x72, 0x60, 0xff, 0x93, 0x82, 0x76, 0xff, 0xde, 0xdd, 0xdc, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0x97, 0x87, 0x79, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6e, 0x5c, 0xff, 0x83, 0x71, 0x5e, 0xff, 0x7a, 0x6b, 0x61, 0xff, 0x83, 0x7b, 0x7d, 0xff, 0xdb, 0xdb, 0xdb, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdb, 0xd9, 0xd8, 0xff, 0x91, 0x7e, 0x6e, 0xff, 0x86, 0x71, 0x5e, 0xff, 0x8b, 0x78, 0x66, 0xff, 0x88, 0x74, 0x63, 0xff, 0x81, 0x6e, 0x5d, 0xff, 0x77, 0x67, 0x54, 0xff, 0x72, 0x64, 0x50, 0xff, 0x72, 0x64, 0x50, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x73, 0x65, 0x4f, 0xff, 0x6c, 0x5e, 0x4c, 0xff, 0x5f, 0x53, 0x50, 0xff, 0x80, 0x78, 0x7c, 0xff, 0xdb, 0xda, 0xdb, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xd0, 0xcb, 0xc8, 0xff, 0x9d, 0x8d, 0x81, 0xff, 0x93, 0x7e, 0x6d, 0xff, 0x91, 0x7c, 0x6a, 0xff, 0x91, 0x7b, 0x6a, 0xff, 0x91, 0x7b, 0x6a, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x93, 0x7e, 0x6c, 0xff, 0x8c, 0x77, 0x65, 0xff, 0x79, 0x69, 0x56, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x68, 0x5b, 0x45, 0xff, 0x68, 0x5c, 0x4a, 0xff, 0x95, 0x8d, 0x8b, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdb, 0xd9, 0xd8, 0xff, 0x91, 0x7e, 0x6d, 0xff, 0x8c, 0x77, 0x66, 0xff, 0x8c, 0x78, 0x65, 0xff, 0x88, 0x73, 0x60, 0xff, 0x8b, 0x79, 0x6c, 0xff, 0xb5, 0xaf, 0xac, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xdd, 0xdc, 0xff, 0x90, 0x81, 0x72, 0xff, 0x7a, 0x68, 0x55, 0xff, 0x7f, 0x6d, 0x5a, 0xff, 0x82, 0x70, 0x5d, 0xff, 0x7e, 0x6e, 0x5e, 0xff, 0x89, 0x7e, 0x79, 0xff, 0xdb, 0xda, 0xdb, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xde, 0xde, 0xff, 0x99, 0x86, 0x76, 0xff, 0x88, 0x72, 0x5f, 0xff, 0x90, 0x7b, 0x69, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x81, 0x6f, 0x5c, 0xff, 0x76, 0x67, 0x54, 0xff, 0x72, 0x64, 0x50, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x71, 0x63, 0x4e, 0xff, 0x6a, 0x5c, 0x4c, 0xff, 0x73, 0x6b, 0x6b, 0xff, 0xd7, 0xd6, 0xd7, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdc, 0xda, 0xd9, 0xff, 0x9d, 0x8b, 0x7b, 0xff, 0x8a, 0x74, 0x61, 0xff, 0x91, 0x7b, 0x6a, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x92, 0x7c, 0x6a, 0xff, 0x8e, 0x78, 0x66, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x70, 0x62, 0x4d, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x69, 0x5c, 0x45, 0xff, 0x6b, 0x5e, 0x4a, 0xff, 0x92, 0x8a, 0x86, 0xff, 0xe0, 0xdf, 0xe0, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe0, 0xdf, 0xde, 0xff, 0xa3, 0x93, 0x85, 0xff, 0x8a, 0x75, 0x63, 0xff, 0x89, 0x75, 0x62, 0xff, 0x80, 0x6d, 0x5a, 0xff, 0x8d, 0x80, 0x73, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xd5, 0xd1, 0xce, 0xff, 0xaf, 0xa1, 0x94, 0xff, 0xde, 0xdc, 0xdb, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe1, 0xe0, 0xe0, 0xff, 0xcf, 0xc6, 0xc0, 0xff, 0xe0, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xab, 0x9f, 0x94, 0xff, 0x80, 0x6d, 0x5a, 0xff, 0x7c, 0x69, 0x56, 0xff, 0x7b, 0x68, 0x56, 0xff, 0x85, 0x78, 0x6d, 0xff, 0xda, 0xd9, 0xd9, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0x98, 0x85, 0x73, 0xff, 0x8a, 0x74, 0x62, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x7c, 0x6c, 0x59, 0xff, 0x74, 0x65, 0x52, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x64, 0x50, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4e, 0xff, 0x6e, 0x60, 0x4b, 0xff, 0x6a, 0x5f, 0x50, 0xff, 0x86, 0x80, 0x80, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xca, 0xc3, 0xbe, 0xff, 0x89, 0x72, 0x61, 0xff, 0x93, 0x7e, 0x6e, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x91, 0x7b, 0x6a, 0xff, 0x8f, 0x79, 0x68, 0xff, 0x83, 0x70, 0x5e, 0xff, 0x72, 0x63, 0x4f, 0xff, 0x6b, 0x5e, 0x4a, 0xff, 0x6a, 0x5d, 0x47, 0xff, 0x6b, 0x5e, 0x48, 0xff, 0x84, 0x7a, 0x72, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdd, 0xdc, 0xda, 0xff, 0x94, 0x82, 0x72, 0xff, 0x84, 0x6e, 0x5c, 0xff, 0x7e, 0x6c, 0x59, 0xff, 0x8c, 0x7f, 0x70, 0xff, 0xdc, 0xda, 0xd9, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe0, 0xdf, 0xde, 0xff, 0x95, 0x85, 0x75, 0xff, 0x8d, 0x7a, 0x69, 0xff, 0x9c, 0x8a, 0x7c, 0xff, 0xbd, 0xb2, 0xa9, 0xff, 0xbe, 0xb3, 0xa8, 0xff, 0xbe, 0xb3, 0xa9, 0xff, 0xc3, 0xb6, 0xad, 0xff, 0xa9, 0x94, 0x85, 0xff, 0x95, 0x80, 0x6f, 0xff, 0x96, 0x86, 0x77, 0xff, 0xdf, 0xde, 0xdd, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xb6, 0xa5, 0x99, 0xff, 0x8d, 0x77, 0x65, 0xff, 0x77, 0x64, 0x52, 0xff, 0x87, 0x78, 0x6a, 0xff, 0xd8, 0xd6, 0xd5, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xda, 0xd8, 0xd6, 0xff, 0x95, 0x81, 0x6f, 0xff, 0x8d, 0x78, 0x65, 0xff, 0x93, 0x7d, 0x6c, 0xff, 0x8b, 0x77, 0x64, 0xff, 0x78, 0x69, 0x54, 0xff, 0x72, 0x63, 0x50, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x63, 0x50, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x6c, 0x5e, 0x4a, 0xff, 0x6b, 0x5e, 0x51, 0xff, 0x96, 0x90, 0x8f, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xd7, 0xd4, 0xd2, 0xff, 0x8c, 0x76, 0x65, 0xff, 0x93, 0x7f, 0x6f, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x8f, 0x79, 0x69, 0xff, 0x87, 0x74, 0x62, 0xff, 0x74, 0x65, 0x50, 0xff, 0x6a, 0x5e, 0x49, 0xff, 0x6b, 0x5e, 0x48, 0xff, 0x6b, 0x5e, 0x49, 0xff, 0x79, 0x6f, 0x62, 0xff, 0xde, 0xde, 0xdd, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xd5, 0xd1, 0xce, 0xff, 0x87, 0x74, 0x62, 0xff, 0x7d, 0x6a, 0x57, 0xff, 0x8a, 0x78, 0x67, 0xff, 0x9e, 0x8d, 0x7f, 0xff, 0xab, 0x9d, 0x91, 0xff, 0x95, 0x85, 0x75, 0xff, 0x80, 0x6d, 0x5a, 0xff, 0x82, 0x70, 0x5d, 0xff, 0x85, 0x73, 0x61, 0xff, 0x8d, 0x79, 0x68, 0xff, 0x90, 0x7c, 0x69, 0xff, 0x91, 0x7d, 0x6b, 0xff, 0x91, 0x7d, 0x6b, 0xff, 0x89, 0x75, 0x62, 0xff, 0x7c, 0x69, 0x56, 0xff, 0x7b, 0x68, 0x56, 0xff, 0x8f, 0x81, 0x71, 0xff, 0xae, 0xa4, 0x99, 0xff, 0xb3, 0xa4, 0x98, 0xff, 0xa4, 0x8e, 0x7e, 0xff, 0x8a, 0x74, 0x61, 0xff, 0x7d, 0x6c, 0x5b, 0xff, 0xcb, 0xc7, 0xc3, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xde, 0xde, 0xff, 0xaa, 0x99, 0x8a, 0xff, 0x93, 0x7d, 0x6b, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x94, 0x7d, 0x6c, 0xff, 0x89, 0x75, 0x62, 0xff, 0x75, 0x66, 0x52, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x72, 0x64, 0x51, 0xff, 0x71, 0x63, 0x50, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x6a, 0x5d, 0x4b, 0xff, 0x74, 0x69, 0x5f, 0xff, 0xd4, 0xd2, 0xd2, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xd7, 0xd3, 0xd1, 0xff, 0x94, 0x81, 0x71, 0xff, 0x90, 0x7d, 0x6c, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x8e, 0x79, 0x68, 0xff, 0x8e, 0x79, 0x68, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x75, 0x67, 0x53, 0xff, 0x6a, 0x5e, 0x49, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x6b, 0x5e, 0x49, 0xff, 0x6f, 0x63, 0x53, 0xff, 0xdd, 0xdc, 0xdc, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xc9, 0xc2, 0xbd, 0xff, 0x87, 0x74, 0x63, 0xff, 0x8d, 0x7b, 0x6b, 0xff, 0x8c, 0x78, 0x65, 0xff, 0x8c, 0x79, 0x68, 0xff, 0x85, 0x73, 0x61, 0xff, 0x84, 0x72, 0x60, 0xff, 0x85, 0x73, 0x62, 0xff, 0x83, 0x71, 0x5e, 0xff, 0x81, 0x6e, 0x5c, 0xff, 0x82, 0x6f, 0x5c, 0xff, 0x81, 0x6f, 0x5c, 0xff, 0x80, 0x6d, 0x5b, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x7f, 0x6c, 0x5a, 0xff, 0x7f, 0x6c, 0x5b, 0xff, 0x87, 0x76, 0x64, 0xff, 0x8c, 0x79, 0x67, 0xff, 0x8b, 0x78, 0x66, 0xff, 0x86, 0x75, 0x64, 0xff, 0xcf, 0xcb, 0xc7, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xdd, 0xff, 0x98, 0x83, 0x71, 0xff, 0x93, 0x7d, 0x6a, 0xff, 0x95, 0x7f, 0x6e, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x85, 0x72, 0x5f, 0xff, 0x74, 0x66, 0x52, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x71, 0x64, 0x50, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x6a, 0x5d, 0x4c, 0xff, 0x7d, 0x74, 0x6b, 0xff, 0xde, 0xdd, 0xdd, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe0, 0xdf, 0xde, 0xff, 0xa4, 0x95, 0x87, 0xff, 0x87, 0x74, 0x61, 0xff, 0x8b, 0x78, 0x66, 0xff, 0x8e, 0x7a, 0x68, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x8c, 0x7a, 0x66, 0xff, 0x7a, 0x6b, 0x58, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6c, 0x60, 0x4a, 0xff, 0x6a, 0x5d, 0x48, 0xff, 0x68, 0x5a, 0x46, 0xff, 0xbd, 0xb8, 0xb3, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xb1, 0xa5, 0x98, 0xff, 0x8b, 0x78, 0x67, 0xff, 0x81, 0x6d, 0x5a, 0xff, 0x87, 0x76, 0x63, 0xff, 0x83, 0x72, 0x5f, 0xff, 0x84, 0x73, 0x62, 0xff, 0x84, 0x72, 0x61, 0xff, 0x84, 0x72, 0x60, 0xff, 0x83, 0x72, 0x60, 0xff, 0x82, 0x71, 0x5f, 0xff, 0x81, 0x70, 0x5e, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x80, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5e, 0xff, 0x7f, 0x6c, 0x5a, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7c, 0x6b, 0x56, 0xff, 0x83, 0x73, 0x62, 0xff, 0xb2, 0xa8, 0xa0, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdc, 0xdb, 0xda, 0xff, 0x92, 0x7b, 0x69, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x8e, 0x7a, 0x68, 0xff, 0x80, 0x6e, 0x5b, 0xff, 0x73, 0x65, 0x51, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x6f, 0x61, 0x4f, 0xff, 0x6a, 0x5d, 0x4a, 0xff, 0x76, 0x6b, 0x5b, 0xff, 0xcc, 0xca, 0xc7, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe1, 0xe0, 0xe0, 0xff, 0xa1, 0x92, 0x82, 0xff, 0x87, 0x74, 0x61, 0xff, 0x8b, 0x79, 0x66, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x8e, 0x7a, 0x67, 0xff, 0x8c, 0x79, 0x67, 0xff, 0x81, 0x70, 0x5d, 0xff, 0x73, 0x65, 0x51, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x6a, 0x5e, 0x48, 0xff, 0x67, 0x59, 0x44, 0xff, 0x86, 0x7b, 0x6e, 0xff, 0xde, 0xde, 0xdd, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe1, 0xe0, 0xe0, 0xff, 0xd2, 0xce, 0xca, 0xff, 0x92, 0x82, 0x72, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x7a, 0x66, 0x53, 0xff, 0x82, 0x6f, 0x5e, 0xff, 0x84, 0x72, 0x60, 0xff, 0x84, 0x72, 0x61, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5c, 0xff, 0x82, 0x6f, 0x5b, 0xff, 0x7c, 0x69, 0x57, 0xff, 0x81, 0x71, 0x62, 0xff, 0xcc, 0xc8, 0xc4, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xb0, 0x9e, 0x90, 0xff, 0x94, 0x7d, 0x6b, 0xff, 0x97, 0x80, 0x6e, 0xff, 0x99, 0x82, 0x70, 0xff, 0x8a, 0x76, 0x64, 0xff, 0x78, 0x68, 0x54, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x50, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x6e, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4f, 0xff, 0x6d, 0x5f, 0x4c, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x82, 0x77, 0x66, 0xff, 0xd0, 0xce, 0xca, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe0, 0xe0, 0xdf, 0xff, 0xc4, 0xbd, 0xb6, 0xff, 0x8f, 0x7b, 0x6a, 0xff, 0x8c, 0x7a, 0x67, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x8d, 0x78, 0x66, 0xff, 0x88, 0x75, 0x63, 0xff, 0x79, 0x69, 0x56, 0xff, 0x6b, 0x5f, 0x4a, 0xff, 0x6b, 0x5e, 0x49, 0xff, 0x6a, 0x5d, 0x49, 0xff, 0x6f, 0x62, 0x52, 0xff, 0xa5, 0x9d, 0x94, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xde, 0xde, 0xff, 0xbe, 0xb6, 0xaf, 0xff, 0x94, 0x85, 0x76, 0xff, 0x8e, 0x7d, 0x6d, 0xff, 0x85, 0x73, 0x60, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x82, 0x70, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5d, 0xff, 0x7c, 0x6b, 0x5b, 0xff, 0x88, 0x7a, 0x6d, 0xff, 0xd8, 0xd7, 0xd5, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdd, 0xdb, 0xd9, 0xff, 0xa0, 0x8a, 0x79, 0xff, 0x97, 0x80, 0x6f, 0xff, 0x99, 0x82, 0x70, 0xff, 0x98, 0x82, 0x70, 0xff, 0x84, 0x72, 0x5f, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x71, 0x63, 0x50, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x6e, 0x62, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6f, 0x62, 0x4e, 0xff, 0x6b, 0x5f, 0x4a, 0xff, 0x6a, 0x5d, 0x47, 0xff, 0x7b, 0x70, 0x5d, 0xff, 0xc7, 0xc3, 0xbe, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xc7, 0xc1, 0xbb, 0xff, 0x9a, 0x89, 0x7a, 0xff, 0x8b, 0x78, 0x66, 0xff, 0x8a, 0x77, 0x65, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6c, 0x5f, 0x4b, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x68, 0x5a, 0x47, 0xff, 0x87, 0x7b, 0x6c, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xe0, 0xdf, 0xdf, 0xff, 0xd4, 0xd0, 0xcd, 0xff, 0x8a, 0x79, 0x68, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x81, 0x6f, 0x5c, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x82, 0x6f, 0x5d, 0xff, 0x7e, 0x6d, 0x5b, 0xff, 0x7b, 0x6a, 0x5b, 0xff, 0x76, 0x68, 0x5e, 0xff, 0x86, 0x7c, 0x78, 0xff, 0xd9, 0xd7, 0xd7, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xaf, 0x9c, 0x8d, 0xff, 0x97, 0x7f, 0x6c, 0xff, 0x9a, 0x83, 0x70, 0xff, 0x9a, 0x83, 0x71, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x7e, 0x6d, 0x5b, 0xff, 0x70, 0x61, 0x4e, 0xff, 0x6f, 0x62, 0x4e, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x61, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6b, 0x60, 0x4b, 0xff, 0x68, 0x5a, 0x44, 0xff, 0x69, 0x5c, 0x47, 0xff, 0x74, 0x67, 0x54, 0xff, 0x86, 0x7b, 0x6a, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xd9, 0xd6, 0xd4, 0xff, 0x9f, 0x8f, 0x81, 0xff, 0x8d, 0x7a, 0x68, 0xff, 0x83, 0x6e, 0x5b, 0xff, 0x87, 0x73, 0x60, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x8a, 0x76, 0x64, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x84, 0x71, 0x5f, 0xff, 0x75, 0x66, 0x53, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6a, 0x5c, 0x47, 0xff, 0x7a, 0x6d, 0x5a, 0xff, 0xd2, 0xd0, 0xcd, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0x99, 0x8a, 0x7c, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x7f, 0x6d, 0x5a, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x82, 0x6f, 0x5c, 0xff, 0x7b, 0x6a, 0x59, 0xff, 0x71, 0x63, 0x5a, 0xff, 0x7b, 0x72, 0x71, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xd9, 0xd5, 0xd2, 0xff, 0xa1, 0x8a, 0x79, 0xff, 0x99, 0x81, 0x6e, 0xff, 0x9f, 0x87, 0x74, 0xff, 0x9b, 0x84, 0x71, 0xff, 0x87, 0x74, 0x61, 0xff, 0x75, 0x66, 0x53, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x62, 0x4d, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x64, 0x56, 0x40, 0xff, 0x65, 0x57, 0x41, 0xff, 0xd0, 0xce, 0xca, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xca, 0xc4, 0xbe, 0xff, 0x8c, 0x7a, 0x69, 0xff, 0x7f, 0x6b, 0x58, 0xff, 0x87, 0x73, 0x61, 0xff, 0x89, 0x76, 0x64, 0xff, 0x89, 0x76, 0x64, 0xff, 0x89, 0x75, 0x63, 0xff, 0x8a, 0x75, 0x63, 0xff, 0x89, 0x75, 0x63, 0xff, 0x89, 0x75, 0x63, 0xff, 0x8a, 0x75, 0x63, 0xff, 0x89, 0x75, 0x63, 0xff, 0x8a, 0x76, 0x64, 0xff, 0x8a, 0x76, 0x64, 0xff, 0x88, 0x75, 0x63, 0xff, 0x7e, 0x6d, 0x5b, 0xff, 0x70, 0x63, 0x50, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x73, 0x64, 0x51, 0xff, 0x8a, 0x7e, 0x6e, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xa2, 0x94, 0x87, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x7e, 0x6c, 0x59, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x81, 0x6e, 0x5b, 0xff, 0x76, 0x65, 0x55, 0xff, 0x76, 0x69, 0x64, 0xff, 0xb1, 0xac, 0xae, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xa8, 0x92, 0x81, 0xff, 0x9e, 0x85, 0x73, 0xff, 0x9f, 0x87, 0x75, 0xff, 0xa0, 0x88, 0x76, 0xff, 0x97, 0x81, 0x6e, 0xff, 0x7d, 0x6c, 0x58, 0xff, 0x6f, 0x61, 0x4d, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x6f, 0x62, 0x4e, 0xff, 0x6e, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x60, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x61, 0x4c, 0xff, 0x69, 0x5c, 0x47, 0xff, 0x69, 0x5c, 0x47, 0xff, 0x9a, 0x92, 0x85, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0x8c, 0x7a, 0x69, 0xff, 0x82, 0x6f, 0x5d, 0xff, 0x86, 0x73, 0x61, 0xff, 0x86, 0x73, 0x61, 0xff, 0x86, 0x74, 0x62, 0xff, 0x87, 0x75, 0x63, 0xff, 0x88, 0x75, 0x63, 0xff, 0x88, 0x75, 0x63, 0xff, 0x87, 0x75, 0x63, 0xff, 0x88, 0x75, 0x63, 0xff, 0x88, 0x75, 0x63, 0xff, 0x88, 0x75, 0x63, 0xff, 0x88, 0x75, 0x63, 0xff, 0x88, 0x75, 0x63, 0xff, 0x89, 0x76, 0x64, 0xff, 0x83, 0x72, 0x60, 0xff, 0x76, 0x67, 0x55, 0xff, 0x70, 0x63, 0x50, 0xff, 0x73, 0x64, 0x50, 0xff, 0x70, 0x61, 0x4d, 0xff, 0x74, 0x65, 0x52, 0xff, 0xc9, 0xc5, 0xc1, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xa0, 0x92, 0x84, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x7f, 0x6d, 0x5a, 0xff, 0x77, 0x66, 0x56, 0xff, 0x7d, 0x71, 0x6a, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xd7, 0xd3, 0xd0, 0xff, 0xa1, 0x89, 0x77, 0xff, 0x9e, 0x85, 0x72, 0xff, 0xa2, 0x8a, 0x78, 0xff, 0x9d, 0x85, 0x74, 0xff, 0x8b, 0x77, 0x64, 0xff, 0x76, 0x66, 0x52, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6e, 0x62, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x69, 0x5c, 0x46, 0xff, 0x6d, 0x61, 0x4c, 0xff, 0xb0, 0xab, 0xa4, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0x94, 0x84, 0x74, 0xff, 0x86, 0x74, 0x62, 0xff, 0x85, 0x73, 0x61, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x87, 0x75, 0x63, 0xff, 0x86, 0x74, 0x62, 0xff, 0x7f, 0x6f, 0x5b, 0xff, 0x75, 0x67, 0x53, 0xff, 0x72, 0x64, 0x51, 0xff, 0x74, 0x65, 0x52, 0xff, 0x72, 0x63, 0x4f, 0xff, 0x81, 0x73, 0x63, 0xff, 0xcc, 0xc8, 0xc4, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0x9e, 0x91, 0x83, 0xff, 0x81, 0x6f, 0x5e, 0xff, 0x7d, 0x6a, 0x58, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x59, 0xff, 0x79, 0x69, 0x59, 0xff, 0x80, 0x73, 0x6b, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdc, 0xd9, 0xd7, 0xff, 0xaa, 0x91, 0x81, 0xff, 0xa2, 0x88, 0x76, 0xff, 0xa2, 0x8b, 0x79, 0xff, 0xa4, 0x8c, 0x7a, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x6f, 0x62, 0x4e, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x6f, 0x61, 0x4e, 0xff, 0x6e, 0x60, 0x4e, 0xff, 0x6e, 0x60, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6d, 0x61, 0x4c, 0xff, 0x6c, 0x60, 0x4b, 0xff, 0x6b, 0x5f, 0x4a, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6d, 0x60, 0x4a, 0xff, 0x6a, 0x5c, 0x47, 0xff, 0x72, 0x66, 0x58, 0xff, 0xd7, 0xd5, 0xd4, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xd2, 0xce, 0xca, 0xff, 0x8a, 0x78, 0x67, 0xff, 0x80, 0x6d, 0x5b, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x86, 0x74, 0x62, 0xff, 0x85, 0x73, 0x60, 0xff, 0x7b, 0x6b, 0x58, 0xff, 0x74, 0x65, 0x52, 0xff, 0x76, 0x67, 0x54, 0xff, 0x78, 0x68, 0x57, 0xff, 0x70, 0x5f, 0x4c, 0xff, 0x8b, 0x7e, 0x6e, 0xff, 0xd2, 0xcf, 0xcb, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0x9f, 0x91, 0x83, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x7c, 0x6a, 0x58, 0xff, 0x7e, 0x6c, 0x5b, 0xff, 0x7f, 0x6c, 0x5b, 0xff, 0x7e, 0x6c, 0x59, 0xff, 0x79, 0x69, 0x59, 0xff, 0x80, 0x74, 0x6c, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xde, 0xdd, 0xff, 0xb2, 0x9b, 0x8c, 0xff, 0xa0, 0x84, 0x72, 0xff, 0xa6, 0x8c, 0x7b, 0xff, 0xa8, 0x8e, 0x7d, 0xff, 0x9e, 0x86, 0x75, 0xff, 0x86, 0x74, 0x61, 0xff, 0x70, 0x63, 0x50, 0xff, 0x6d, 0x61, 0x4e, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x6f, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6d, 0x60, 0x4e, 0xff, 0x6e, 0x60, 0x4e, 0xff, 0x6d, 0x60, 0x4a, 0xff, 0x6a, 0x5e, 0x47, 0xff, 0x65, 0x58, 0x42, 0xff, 0x66, 0x58, 0x42, 0xff, 0x67, 0x5a, 0x43, 0xff, 0x6b, 0x5d, 0x48, 0xff, 0x6d, 0x60, 0x4a, 0xff, 0x6b, 0x5e, 0x47, 0xff, 0x6a, 0x5c, 0x48, 0xff, 0x7e, 0x74, 0x6d, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe0, 0xdf, 0xdf, 0xff, 0x92, 0x81, 0x71, 0xff, 0x7f, 0x6c, 0x59, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x85, 0x74, 0x61, 0xff, 0x85, 0x73, 0x60, 0xff, 0x84, 0x72, 0x5f, 0xff, 0x84, 0x72, 0x5e, 0xff, 0x84, 0x70, 0x5d, 0xff, 0x84, 0x72, 0x5f, 0xff, 0x85, 0x73, 0x62, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x86, 0x73, 0x62, 0xff, 0x85, 0x73, 0x62, 0xff, 0x80, 0x6e, 0x5d, 0xff, 0x79, 0x68, 0x56, 0xff, 0x75, 0x66, 0x54, 0xff, 0x76, 0x67, 0x55, 0xff, 0x78, 0x68, 0x57, 0xff, 0x79, 0x69, 0x57, 0xff, 0x8c, 0x7f, 0x6f, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0x9f, 0x91, 0x83, 0xff, 0x81, 0x70, 0x5d, 0xff, 0x7c, 0x6a, 0x58, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x7e, 0x6c, 0x58, 0xff, 0x79, 0x69, 0x58, 0xff, 0x80, 0x75, 0x6c, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xb6, 0xa0, 0x91, 0xff, 0xa6, 0x8b, 0x78, 0xff, 0xa7, 0x8c, 0x7a, 0xff, 0xa9, 0x8f, 0x7e, 0xff, 0xa7, 0x8d, 0x7b, 0xff, 0x8f, 0x7b, 0x68, 0xff, 0x76, 0x68, 0x54, 0xff, 0x6e, 0x62, 0x4e, 0xff, 0x6e, 0x62, 0x4e, 0xff, 0x6e, 0x61, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4f, 0xff, 0x68, 0x5c, 0x4c, 0xff, 0x71, 0x66, 0x58, 0xff, 0x7d, 0x72, 0x63, 0xff, 0x80, 0x76, 0x64, 0xff, 0x7a, 0x6e, 0x5b, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x69, 0x5b, 0x46, 0xff, 0x67, 0x59, 0x44, 0xff, 0x75, 0x69, 0x5a, 0xff, 0x97, 0x90, 0x8d, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe0, 0xdf, 0xdf, 0xff, 0x9e, 0x90, 0x82, 0xff, 0x83, 0x70, 0x5e, 0xff, 0x80, 0x6d, 0x5a, 0xff, 0x80, 0x6e, 0x5b, 0xff, 0x81, 0x6e, 0x5b, 0xff, 0x82, 0x6f, 0x5c, 0xff, 0x80, 0x6d, 0x5b, 0xff, 0x81, 0x6f, 0x5e, 0xff, 0x84, 0x71, 0x61, 0xff, 0x82, 0x6f, 0x5d, 0xff, 0x84, 0x72, 0x61, 0xff, 0x84, 0x72, 0x60, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x84, 0x72, 0x60, 0xff, 0x84, 0x72, 0x60, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x78, 0x68, 0x56, 0xff, 0x77, 0x67, 0x55, 0xff, 0x79, 0x69, 0x57, 0xff, 0x77, 0x67, 0x53, 0xff, 0x7a, 0x69, 0x55, 0xff, 0xbf, 0xb8, 0xb1, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0x9e, 0x91, 0x83, 0xff, 0x80, 0x6f, 0x5d, 0xff, 0x7c, 0x6a, 0x57, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x58, 0xff, 0x78, 0x68, 0x58, 0xff, 0x80, 0x75, 0x6b, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xcc, 0xc1, 0xba, 0xff, 0xa6, 0x8c, 0x79, 0xff, 0xa8, 0x8d, 0x7b, 0xff, 0xab, 0x91, 0x7f, 0xff, 0xa9, 0x8e, 0x7d, 0xff, 0x99, 0x83, 0x70, 0xff, 0x7e, 0x6e, 0x5a, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6f, 0x61, 0x4e, 0xff, 0x6e, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x60, 0x4b, 0xff, 0x65, 0x58, 0x49, 0xff, 0x65, 0x5b, 0x57, 0xff, 0x8f, 0x89, 0x8a, 0xff, 0xd8, 0xd7, 0xd6, 0xff, 0xde, 0xdd, 0xdc, 0xff, 0xad, 0xa8, 0x9f, 0xff, 0x91, 0x88, 0x7b, 0xff, 0x8a, 0x80, 0x72, 0xff, 0x81, 0x78, 0x69, 0xff, 0x8d, 0x84, 0x7c, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0x91, 0x80, 0x71, 0xff, 0x80, 0x6d, 0x5b, 0xff, 0x82, 0x71, 0x5e, 0xff, 0x85, 0x74, 0x62, 0xff, 0x88, 0x78, 0x6a, 0xff, 0x8b, 0x7d, 0x73, 0xff, 0x97, 0x8d, 0x86, 0xff, 0xa9, 0xa1, 0x9d, 0xff, 0x8c, 0x7e, 0x72, 0xff, 0x82, 0x6f, 0x5d, 0xff, 0x84, 0x71, 0x5e, 0xff, 0x85, 0x73, 0x61, 0xff, 0x84, 0x72, 0x60, 0xff, 0x84, 0x72, 0x60, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x84, 0x72, 0x60, 0xff, 0x83, 0x72, 0x60, 0xff, 0x7e, 0x6d, 0x5b, 0xff, 0x7a, 0x69, 0x58, 0xff, 0x7a, 0x69, 0x57, 0xff, 0x7e, 0x6e, 0x5b, 0xff, 0x7b, 0x69, 0x56, 0xff, 0x82, 0x70, 0x5e, 0xff, 0xb2, 0xa7, 0x9f, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0x9d, 0x90, 0x83, 0xff, 0x80, 0x6f, 0x5c, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x59, 0xff, 0x7d, 0x6b, 0x57, 0xff, 0x78, 0x67, 0x57, 0xff, 0x80, 0x74, 0x6b, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe0, 0xe0, 0xdf, 0xff, 0xc4, 0xb1, 0xa7, 0xff, 0xab, 0x8f, 0x7d, 0xff, 0xaa, 0x8f, 0x7d, 0xff, 0xac, 0x93, 0x82, 0xff, 0xab, 0x91, 0x7f, 0xff, 0x9e, 0x86, 0x74, 0xff, 0x80, 0x6f, 0x5c, 0xff, 0x6f, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4b, 0xff, 0x6c, 0x5f, 0x4b, 0xff, 0x6e, 0x63, 0x5b, 0xff, 0xaa, 0xa6, 0xa9, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xde, 0xde, 0xff, 0xb5, 0xaa, 0xa1, 0xff, 0xc0, 0xb8, 0xb1, 0xff, 0xc2, 0xbc, 0xb6, 0xff, 0xc0, 0xba, 0xb7, 0xff, 0xca, 0xc6, 0xc5, 0xff, 0xe1, 0xe0, 0xe1, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xd3, 0xd0, 0xce, 0xff, 0x9d, 0x8e, 0x81, 0xff, 0x83, 0x72, 0x60, 0xff, 0x80, 0x6d, 0x5a, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x81, 0x70, 0x5e, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x80, 0x6f, 0x5d, 0xff, 0x7a, 0x68, 0x55, 0xff, 0x83, 0x72, 0x60, 0xff, 0xac, 0xa1, 0x97, 0xff, 0xe1, 0xe0, 0xe0, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0x9d, 0x90, 0x82, 0xff, 0x80, 0x6f, 0x5c, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7c, 0x6a, 0x56, 0xff, 0x77, 0x67, 0x56, 0xff, 0x7f, 0x74, 0x6b, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xc9, 0xb9, 0xb0, 0xff, 0xae, 0x91, 0x7f, 0xff, 0xac, 0x8f, 0x7d, 0xff, 0xaf, 0x94, 0x83, 0xff, 0xae, 0x93, 0x81, 0xff, 0xa1, 0x89, 0x77, 0xff, 0x87, 0x74, 0x61, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x6c, 0x5f, 0x4c, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6f, 0x61, 0x4c, 0xff, 0x6d, 0x60, 0x4a, 0xff, 0x67, 0x5b, 0x4e, 0xff, 0x82, 0x7b, 0x7a, 0xff, 0xdc, 0xdc, 0xdd, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0x8e, 0x7e, 0x6e, 0xff, 0x7d, 0x6b, 0x58, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7f, 0x6c, 0x5a, 0xff, 0x7e, 0x6b, 0x59, 0xff, 0x93, 0x84, 0x75, 0xff, 0xd1, 0xce, 0xc9, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0x9c, 0x90, 0x82, 0xff, 0x7e, 0x6e, 0x5b, 0xff, 0x7a, 0x69, 0x56, 0xff, 0x7d, 0x6b, 0x58, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7b, 0x6a, 0x56, 0xff, 0x76, 0x67, 0x56, 0xff, 0x7f, 0x74, 0x6b, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdc, 0xda, 0xff, 0xb6, 0x9b, 0x8c, 0xff, 0xab, 0x8c, 0x7b, 0xff, 0xaf, 0x92, 0x81, 0xff, 0xb0, 0x95, 0x83, 0xff, 0xb1, 0x93, 0x82, 0xff, 0xa7, 0x8b, 0x7a, 0xff, 0x8b, 0x76, 0x65, 0xff, 0x71, 0x63, 0x50, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6e, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6d, 0x60, 0x4a, 0xff, 0x67, 0x5b, 0x49, 0xff, 0x71, 0x68, 0x65, 0xff, 0xca, 0xc8, 0xc9, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xc8, 0xc3, 0xbd, 0xff, 0x88, 0x77, 0x66, 0xff, 0x7e, 0x6c, 0x59, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x84, 0x72, 0x60, 0xff, 0x81, 0x6f, 0x5c, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x90, 0x7f, 0x6e, 0xff, 0xcd, 0xc7, 0xc3, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0x9b, 0x90, 0x81, 0xff, 0x7e, 0x6d, 0x5b, 0xff, 0x79, 0x68, 0x54, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7a, 0x6a, 0x56, 0xff, 0x75, 0x66, 0x57, 0xff, 0x7f, 0x73, 0x6b, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe0, 0xdf, 0xdf, 0xff, 0xd1, 0xc7, 0xc1, 0xff, 0xb2, 0x97, 0x86, 0xff, 0xae, 0x91, 0x7f, 0xff, 0xb0, 0x92, 0x81, 0xff, 0xb3, 0x97, 0x85, 0xff, 0xb2, 0x95, 0x83, 0xff, 0xa8, 0x8d, 0x7b, 0xff, 0x8b, 0x77, 0x64, 0xff, 0x73, 0x64, 0x51, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6e, 0x62, 0x4f, 0xff, 0x6e, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x62, 0x4c, 0xff, 0x69, 0x5e, 0x4a, 0xff, 0x68, 0x5d, 0x54, 0xff, 0x83, 0x7b, 0x7d, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xb5, 0xab, 0xa1, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x74, 0x62, 0xff, 0x7f, 0x6c, 0x59, 0xff, 0x8d, 0x7c, 0x6a, 0xff, 0xb7, 0xad, 0xa3, 0xff, 0xdf, 0xde, 0xdd, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe0, 0xdf, 0xdf, 0xff, 0x9b, 0x8e, 0x81, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x78, 0x68, 0x54, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7a, 0x69, 0x56, 0xff, 0x75, 0x66, 0x57, 0xff, 0x7f, 0x73, 0x6b, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xdd, 0xdb, 0xff, 0xbb, 0xa7, 0x99, 0xff, 0xad, 0x91, 0x80, 0xff, 0xaa, 0x8c, 0x7a, 0xff, 0xae, 0x91, 0x7f, 0xff, 0xb4, 0x96, 0x86, 0xff, 0xb5, 0x97, 0x85, 0xff, 0xa5, 0x8b, 0x7a, 0xff, 0x89, 0x75, 0x63, 0xff, 0x73, 0x64, 0x51, 0xff, 0x6c, 0x60, 0x4c, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4f, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x65, 0x58, 0x45, 0xff, 0x71, 0x66, 0x5c, 0xff, 0xce, 0xcc, 0xcd, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xc6, 0xc1, 0xbb, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7d, 0x6b, 0x58, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x80, 0x6f, 0x5c, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x85, 0x73, 0x61, 0xff, 0x87, 0x75, 0x63, 0xff, 0x89, 0x76, 0x64, 0xff, 0x88, 0x75, 0x62, 0xff, 0x87, 0x72, 0x5f, 0xff, 0x8e, 0x7a, 0x68, 0xff, 0xc2, 0xb9, 0xb1, 0xff, 0xe0, 0xdf, 0xde, 0xff, 0xe0, 0xe0, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe0, 0xdf, 0xdf, 0xff, 0x9c, 0x8f, 0x81, 0xff, 0x7d, 0x6c, 0x5a, 0xff, 0x78, 0x67, 0x54, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x79, 0x68, 0x55, 0xff, 0x74, 0x65, 0x56, 0xff, 0x7d, 0x72, 0x6a, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe0, 0xdf, 0xdf, 0xff, 0xe0, 0xdf, 0xdf, 0xff, 0xd2, 0xca, 0xc3, 0xff, 0xa7, 0x8d, 0x7a, 0xff, 0xa6, 0x8b, 0x78, 0xff, 0xab, 0x90, 0x7e, 0xff, 0xb0, 0x94, 0x83, 0xff, 0xb3, 0x95, 0x84, 0xff, 0xaf, 0x92, 0x82, 0xff, 0xa1, 0x88, 0x77, 0xff, 0x87, 0x74, 0x62, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x6b, 0x5f, 0x4c, 0xff, 0x6e, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x67, 0x59, 0x44, 0xff, 0x75, 0x69, 0x58, 0xff, 0xd8, 0xd6, 0xd5, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe1, 0xe1, 0xe0, 0xff, 0x99, 0x8c, 0x7d, 0xff, 0x7a, 0x68, 0x55, 0xff, 0x7e, 0x6b, 0x59, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x80, 0x6f, 0x5d, 0xff, 0x84, 0x72, 0x60, 0xff, 0x88, 0x75, 0x63, 0xff, 0x8b, 0x77, 0x66, 0xff, 0x8c, 0x78, 0x65, 0xff, 0x8a, 0x76, 0x64, 0xff, 0x8c, 0x76, 0x65, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x94, 0x7f, 0x6e, 0xff, 0xa1, 0x8e, 0x7f, 0xff, 0xda, 0xd7, 0xd5, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0x9b, 0x8e, 0x80, 0xff, 0x7d, 0x6d, 0x5b, 0xff, 0x77, 0x67, 0x54, 0xff, 0x78, 0x68, 0x57, 0xff, 0x78, 0x68, 0x56, 0xff, 0x77, 0x67, 0x54, 0xff, 0x72, 0x63, 0x53, 0xff, 0x7d, 0x71, 0x69, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xd9, 0xd4, 0xd0, 0xff, 0xad, 0x96, 0x86, 0xff, 0xa7, 0x8e, 0x7c, 0xff, 0xa7, 0x8d, 0x7c, 0xff, 0xa7, 0x8d, 0x7a, 0xff, 0xaa, 0x8f, 0x7c, 0xff, 0xae, 0x92, 0x81, 0xff, 0xb0, 0x93, 0x82, 0xff, 0xac, 0x90, 0x7f, 0xff, 0x9a, 0x83, 0x71, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x6d, 0x5f, 0x4c, 0xff, 0x6d, 0x5f, 0x4c, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6e, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6e, 0x60, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6a, 0x5d, 0x47, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x85, 0x7b, 0x69, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xc2, 0xbb, 0xb6, 0xff, 0x84, 0x72, 0x61, 0xff, 0x7c, 0x69, 0x56, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x80, 0x6f, 0x5c, 0xff, 0x84, 0x71, 0x5f, 0xff, 0x89, 0x76, 0x65, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x8f, 0x7a, 0x68, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x8e, 0x78, 0x66, 0xff, 0x8c, 0x76, 0x63, 0xff, 0x90, 0x7a, 0x67, 0xff, 0x9e, 0x8b, 0x7a, 0xff, 0xad, 0x9b, 0x8d, 0xff, 0xd2, 0xcd, 0xc8, 0xff, 0xdc, 0xda, 0xd9, 0xff, 0xdf, 0xde, 0xdd, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe1, 0xe1, 0xe0, 0xff, 0x91, 0x84, 0x75, 0xff, 0x7a, 0x69, 0x58, 0xff, 0x77, 0x67, 0x55, 0xff, 0x78, 0x68, 0x56, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x66, 0x54, 0xff, 0x72, 0x62, 0x51, 0xff, 0x7d, 0x70, 0x65, 0xff, 0xcb, 0xc6, 0xc3, 0xff, 0xe0, 0xdf, 0xdf, 0xff, 0xdf, 0xde, 0xde, 0xff, 0xdd, 0xdb, 0xda, 0xff, 0xc8, 0xbf, 0xb7, 0xff, 0xad, 0x99, 0x89, 0xff, 0xa5, 0x8d, 0x7c, 0xff, 0x9f, 0x85, 0x74, 0xff, 0xa1, 0x86, 0x74, 0xff, 0xa5, 0x8b, 0x79, 0xff, 0xaa, 0x8f, 0x7e, 0xff, 0xad, 0x92, 0x80, 0xff, 0xac, 0x90, 0x7f, 0xff, 0xa1, 0x87, 0x76, 0xff, 0x8c, 0x78, 0x65, 0xff, 0x7a, 0x6b, 0x57, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6c, 0x5f, 0x4c, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6f, 0x62, 0x4c, 0xff, 0x91, 0x88, 0x7a, 0xff, 0xdf, 0xdf, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xd9, 0xd7, 0xd5, 0xff, 0x81, 0x6f, 0x5e, 0xff, 0x78, 0x66, 0x53, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7e, 0x6e, 0x5a, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x86, 0x74, 0x62, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x92, 0x7c, 0x6a, 0xff, 0x94, 0x7e, 0x6d, 0xff, 0x95, 0x80, 0x6e, 0xff, 0x95, 0x80, 0x6e, 0xff, 0x93, 0x7d, 0x6a, 0xff, 0x91, 0x79, 0x67, 0xff, 0x91, 0x78, 0x66, 0xff, 0x96, 0x7f, 0x6d, 0xff, 0xa6, 0x92, 0x82, 0xff, 0xc8, 0xbb, 0xb3, 0xff, 0xc6, 0xbc, 0xb5, 0xff, 0x86, 0x76, 0x65, 0xff, 0x76, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x77, 0x67, 0x55, 0xff, 0x81, 0x70, 0x60, 0xff, 0x9a, 0x89, 0x7b, 0xff, 0xaa, 0x98, 0x8b, 0xff, 0xa5, 0x90, 0x80, 0xff, 0x99, 0x81, 0x6e, 0xff, 0x95, 0x7c, 0x69, 0xff, 0x9a, 0x81, 0x6e, 0xff, 0x9e, 0x86, 0x73, 0xff, 0xa3, 0x8a, 0x79, 0xff, 0xa7, 0x8e, 0x7d, 0xff, 0xaa, 0x90, 0x7f, 0xff, 0xa8, 0x8e, 0x7d, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x91, 0x7c, 0x69, 0xff, 0x82, 0x70, 0x5d, 0xff, 0x73, 0x66, 0x52, 0xff, 0x6c, 0x61, 0x4c, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x61, 0x4c, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x69, 0x5b, 0x46, 0xff, 0x74, 0x68, 0x54, 0xff, 0xae, 0xa9, 0xa0, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdc, 0xdb, 0xda, 0xff, 0x91, 0x83, 0x73, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7e, 0x6d, 0x5b, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x84, 0x72, 0x5f, 0xff, 0x8b, 0x76, 0x64, 0xff, 0x90, 0x7a, 0x68, 0xff, 0x94, 0x7f, 0x6c, 0xff, 0x97, 0x81, 0x70, 0xff, 0x9a, 0x83, 0x71, 0xff, 0x9a, 0x83, 0x72, 0xff, 0x9b, 0x83, 0x72, 0xff, 0x9b, 0x84, 0x72, 0xff, 0x9b, 0x83, 0x70, 0xff, 0x9e, 0x84, 0x71, 0xff, 0x96, 0x7f, 0x6c, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x77, 0x68, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x75, 0x65, 0x53, 0xff, 0x78, 0x68, 0x56, 0xff, 0x85, 0x71, 0x5f, 0xff, 0x92, 0x7c, 0x69, 0xff, 0x97, 0x80, 0x6e, 0xff, 0x98, 0x81, 0x6f, 0xff, 0x9b, 0x84, 0x72, 0xff, 0x9e, 0x86, 0x74, 0xff, 0xa1, 0x88, 0x76, 0xff, 0xa3, 0x8a, 0x78, 0xff, 0xa2, 0x89, 0x77, 0xff, 0xa0, 0x88, 0x76, 0xff, 0x9d, 0x85, 0x73, 0xff, 0x93, 0x7e, 0x6c, 0xff, 0x86, 0x73, 0x60, 0xff, 0x75, 0x67, 0x53, 0xff, 0x6d, 0x61, 0x4c, 0xff, 0x6e, 0x62, 0x4e, 0xff, 0x6f, 0x62, 0x4e, 0xff, 0x6e, 0x62, 0x4e, 0xff, 0x6e, 0x62, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x63, 0x56, 0x3f, 0xff, 0x9a, 0x93, 0x86, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xa7, 0x9b, 0x8f, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7d, 0x6d, 0x59, 0xff, 0x7e, 0x6d, 0x59, 0xff, 0x7d, 0x6c, 0x58, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7b, 0x6b, 0x58, 0xff, 0x7b, 0x6b, 0x57, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x83, 0x70, 0x5e, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x93, 0x7d, 0x6b, 0xff, 0x98, 0x81, 0x70, 0xff, 0x99, 0x84, 0x71, 0xff, 0x9b, 0x85, 0x72, 0xff, 0x9d, 0x86, 0x74, 0xff, 0x9f, 0x86, 0x74, 0xff, 0xa3, 0x89, 0x77, 0xff, 0x9a, 0x82, 0x70, 0xff, 0x80, 0x6f, 0x5c, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x74, 0x64, 0x52, 0xff, 0x78, 0x67, 0x56, 0xff, 0x85, 0x71, 0x60, 0xff, 0x94, 0x7d, 0x6b, 0xff, 0x9a, 0x82, 0x70, 0xff, 0x99, 0x82, 0x71, 0xff, 0x9b, 0x84, 0x72, 0xff, 0x9d, 0x85, 0x73, 0xff, 0x9f, 0x86, 0x74, 0xff, 0x9d, 0x86, 0x74, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x8d, 0x79, 0x66, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x74, 0x66, 0x52, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4e, 0xff, 0x6e, 0x62, 0x4e, 0xff, 0x6e, 0x62, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6c, 0x60, 0x4b, 0xff, 0x69, 0x5c, 0x48, 0xff, 0x68, 0x5b, 0x46, 0xff, 0x69, 0x5c, 0x47, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x61, 0x4c, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x60, 0x52, 0x3b, 0xff, 0x7d, 0x72, 0x60, 0xff, 0xde, 0xde, 0xdd, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0x98, 0x8b, 0x7d, 0xff, 0x78, 0x66, 0x53, 0xff, 0x7a, 0x69, 0x55, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7c, 0x6b, 0x59, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7c, 0x6a, 0x56, 0xff, 0x7a, 0x67, 0x54, 0xff, 0x79, 0x67, 0x54, 0xff, 0x7a, 0x69, 0x56, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7a, 0x6a, 0x58, 0xff, 0x79, 0x69, 0x57, 0xff, 0x78, 0x68, 0x56, 0xff, 0x7b, 0x6a, 0x58, 0xff, 0x7e, 0x6d, 0x5b, 0xff, 0x80, 0x6f, 0x5c, 0xff, 0x84, 0x72, 0x60, 0xff, 0x8b, 0x78, 0x65, 0xff, 0x92, 0x7e, 0x6b, 0xff, 0x98, 0x82, 0x70, 0xff, 0x9f, 0x87, 0x75, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0x9f, 0x88, 0x76, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x75, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x65, 0x53, 0xff, 0x74, 0x64, 0x52, 0xff, 0x78, 0x67, 0x55, 0xff, 0x85, 0x71, 0x60, 0xff, 0x96, 0x7f, 0x6d, 0xff, 0x9b, 0x84, 0x73, 0xff, 0x97, 0x80, 0x70, 0xff, 0x92, 0x7d, 0x6c, 0xff, 0x90, 0x7b, 0x69, 0xff, 0x89, 0x76, 0x63, 0xff, 0x80, 0x6f, 0x5d, 0xff, 0x7b, 0x6b, 0x58, 0xff, 0x77, 0x68, 0x55, 0xff, 0x72, 0x64, 0x50, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x6e, 0x62, 0x4d, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6d, 0x60, 0x4e, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6e, 0x60, 0x4c, 0xff, 0x6d, 0x60, 0x4a, 0xff, 0x69, 0x5d, 0x4a, 0xff, 0x67, 0x5c, 0x50, 0xff, 0x6f, 0x65, 0x5a, 0xff, 0x6d, 0x62, 0x51, 0xff, 0x68, 0x5b, 0x44, 0xff, 0x6c, 0x60, 0x4a, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6b, 0x5f, 0x48, 0xff, 0x69, 0x5c, 0x49, 0xff, 0x8f, 0x86, 0x7a, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xae, 0xa5, 0x9a, 0xff, 0x7e, 0x6e, 0x5c, 0xff, 0x76, 0x63, 0x50, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x7b, 0x6b, 0x58, 0xff, 0x7b, 0x6b, 0x58, 0xff, 0x7b, 0x6b, 0x58, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7d, 0x6b, 0x56, 0xff, 0x78, 0x67, 0x54, 0xff, 0x72, 0x63, 0x58, 0xff, 0x7a, 0x6c, 0x62, 0xff, 0x7e, 0x6f, 0x5f, 0xff, 0x78, 0x67, 0x53, 0xff, 0x75, 0x64, 0x4f, 0xff, 0x7c, 0x6b, 0x59, 0xff, 0x7b, 0x6b, 0x59, 0xff, 0x7a, 0x6a, 0x58, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x79, 0x69, 0x58, 0xff, 0x79, 0x6a, 0x58, 0xff, 0x79, 0x6a, 0x57, 0xff, 0x79, 0x69, 0x57, 0xff, 0x77, 0x68, 0x56, 0xff, 0x76, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x7c, 0x6c, 0x59, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x86, 0x73, 0x61, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x90, 0x7c, 0x6a, 0xff, 0x8d, 0x78, 0x66, 0xff, 0x7d, 0x6b, 0x59, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x65, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x77, 0x66, 0x54, 0xff, 0x7e, 0x6c, 0x59, 0xff, 0x86, 0x73, 0x60, 0xff, 0x87, 0x75, 0x62, 0xff, 0x84, 0x72, 0x5f, 0xff, 0x80, 0x6f, 0x5c, 0xff, 0x7d, 0x6c, 0x5a, 0xff, 0x77, 0x67, 0x54, 0xff, 0x70, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6f, 0x62, 0x4e, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x71, 0x64, 0x50, 0xff, 0x70, 0x63, 0x50, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x69, 0x5c, 0x4b, 0xff, 0x6f, 0x65, 0x5d, 0xff, 0x81, 0x79, 0x78, 0xff, 0xc7, 0xc4, 0xc4, 0xff, 0xd1, 0xd0, 0xcc, 0xff, 0x8b, 0x81, 0x70, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x66, 0x58, 0x42, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6b, 0x5f, 0x48, 0xff, 0x65, 0x58, 0x42, 0xff, 0x7e, 0x74, 0x69, 0xff, 0xc4, 0xc1, 0xc0, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0x97, 0x8b, 0x7d, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x75, 0x63, 0x50, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7c, 0x6c, 0x59, 0xff, 0x7b, 0x69, 0x56, 0xff, 0x79, 0x67, 0x52, 0xff, 0x75, 0x65, 0x52, 0xff, 0x78, 0x6b, 0x61, 0xff, 0x7d, 0x74, 0x75, 0xff, 0x9d, 0x97, 0x97, 0xff, 0xaa, 0xa1, 0x98, 0xff, 0x96, 0x8a, 0x7d, 0xff, 0x82, 0x73, 0x61, 0xff, 0x78, 0x68, 0x55, 0xff, 0x76, 0x65, 0x52, 0xff, 0x7a, 0x6a, 0x58, 0xff, 0x7a, 0x6a, 0x58, 0xff, 0x79, 0x69, 0x57, 0xff, 0x79, 0x69, 0x57, 0xff, 0x79, 0x69, 0x57, 0xff, 0x78, 0x68, 0x56, 0xff, 0x78, 0x68, 0x56, 0xff, 0x78, 0x68, 0x56, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x67, 0x54, 0xff, 0x76, 0x67, 0x54, 0xff, 0x76, 0x66, 0x53, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x66, 0x54, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x72, 0x64, 0x50, 0xff, 0x72, 0x64, 0x50, 0xff, 0x72, 0x65, 0x51, 0xff, 0x72, 0x64, 0x50, 0xff, 0x72, 0x63, 0x50, 0xff, 0x72, 0x63, 0x50, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x6e, 0x62, 0x51, 0xff, 0x69, 0x5c, 0x4f, 0xff, 0x73, 0x68, 0x63, 0xff, 0x8e, 0x88, 0x8a, 0xff, 0xda, 0xd9, 0xda, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdd, 0xdd, 0xdc, 0xff, 0x8e, 0x85, 0x75, 0xff, 0x72, 0x65, 0x52, 0xff, 0x69, 0x5c, 0x46, 0xff, 0x65, 0x58, 0x42, 0xff, 0x6c, 0x60, 0x4c, 0xff, 0x80, 0x75, 0x68, 0xff, 0xb2, 0xac, 0xaa, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0x99, 0x8c, 0x7f, 0xff, 0x7f, 0x6f, 0x5e, 0xff, 0x74, 0x62, 0x4f, 0xff, 0x78, 0x66, 0x54, 0xff, 0x75, 0x63, 0x4f, 0xff, 0x7a, 0x6b, 0x5a, 0xff, 0x82, 0x77, 0x6d, 0xff, 0x94, 0x8e, 0x8e, 0xff, 0xdd, 0xdc, 0xdd, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xc8, 0xc2, 0xbd, 0xff, 0x8b, 0x7e, 0x6e, 0xff, 0x74, 0x64, 0x51, 0xff, 0x76, 0x66, 0x53, 0xff, 0x78, 0x68, 0x56, 0xff, 0x78, 0x68, 0x56, 0xff, 0x78, 0x68, 0x56, 0xff, 0x78, 0x68, 0x56, 0xff, 0x78, 0x68, 0x56, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x65, 0x53, 0xff, 0x74, 0x65, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x73, 0x64, 0x51, 0xff, 0x72, 0x63, 0x50, 0xff, 0x72, 0x63, 0x50, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x71, 0x64, 0x50, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x6f, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6d, 0x60, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6f, 0x62, 0x4c, 0xff, 0x6b, 0x60, 0x4c, 0xff, 0x63, 0x58, 0x4e, 0xff, 0x75, 0x6d, 0x6d, 0xff, 0xc9, 0xc7, 0xc8, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xce, 0xcc, 0xc8, 0xff, 0x73, 0x68, 0x55, 0xff, 0x81, 0x76, 0x65, 0xff, 0x89, 0x80, 0x74, 0xff, 0xc9, 0xc6, 0xc4, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xae, 0xa6, 0x9b, 0xff, 0x84, 0x75, 0x64, 0xff, 0x79, 0x68, 0x56, 0xff, 0x85, 0x77, 0x69, 0xff, 0x98, 0x8e, 0x87, 0xff, 0xdc, 0xdb, 0xdb, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe0, 0xe0, 0xdf, 0xff, 0x97, 0x8a, 0x7c, 0xff, 0x79, 0x6a, 0x57, 0xff, 0x73, 0x63, 0x50, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x74, 0x66, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x73, 0x65, 0x51, 0xff, 0x73, 0x65, 0x51, 0xff, 0x73, 0x64, 0x51, 0xff, 0x73, 0x64, 0x50, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x6f, 0x63, 0x4f, 0xff, 0x6f, 0x61, 0x4f, 0xff, 0x6f, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6e, 0x60, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6d, 0x61, 0x4b, 0xff, 0x63, 0x57, 0x48, 0xff, 0x70, 0x67, 0x65, 0xff, 0xc9, 0xc7, 0xc9, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xc5, 0xbf, 0xb8, 0xff, 0xbb, 0xb5, 0xae, 0xff, 0xca, 0xc6, 0xc3, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xb9, 0xb0, 0xa9, 0xff, 0x80, 0x71, 0x60, 0xff, 0x6f, 0x5f, 0x4c, 0xff, 0x76, 0x66, 0x54, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x66, 0x54, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x73, 0x65, 0x51, 0xff, 0x72, 0x65, 0x50, 0xff, 0x72, 0x64, 0x50, 0xff, 0x72, 0x64, 0x50, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x63, 0x50, 0xff, 0x70, 0x63, 0x50, 0xff, 0x70, 0x63, 0x50, 0xff, 0x70, 0x63, 0x50, 0xff, 0x6f, 0x62, 0x50, 0xff, 0x6e, 0x61, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6b, 0x5f, 0x48, 0xff, 0x68, 0x5c, 0x4e, 0xff, 0x9a, 0x93, 0x91, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xad, 0xa3, 0x98, 0xff, 0x7f, 0x70, 0x5f, 0xff, 0x70, 0x5f, 0x4c, 0xff, 0x75, 0x65, 0x53, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x53, 0xff, 0x76, 0x65, 0x53, 0xff, 0x75, 0x65, 0x52, 0xff, 0x74, 0x65, 0x51, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x73, 0x64, 0x51, 0xff, 0x73, 0x64, 0x51, 0xff, 0x73, 0x64, 0x51, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x71, 0x63, 0x50, 0xff, 0x71, 0x63, 0x50, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x60, 0x4c, 0xff, 0x6d, 0x5f, 0x4b, 0xff, 0x6c, 0x5f, 0x4c, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6b, 0x5d, 0x47, 0xff, 0x6d, 0x61, 0x50, 0xff, 0xac, 0xa7, 0xa1, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0x8f, 0x83, 0x74, 0xff, 0x79, 0x69, 0x57, 0xff, 0x73, 0x62, 0x50, 0xff, 0x75, 0x65, 0x53, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x65, 0x53, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x53, 0xff, 0x74, 0x65, 0x51, 0xff, 0x75, 0x66, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x73, 0x65, 0x51, 0xff, 0x73, 0x65, 0x51, 0xff, 0x73, 0x64, 0x51, 0xff, 0x72, 0x64, 0x50, 0xff, 0x72, 0x63, 0x50, 0xff, 0x72, 0x63, 0x50, 0xff, 0x71, 0x63, 0x50, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x6f, 0x61, 0x4e, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6a, 0x5d, 0x49, 0xff, 0x69, 0x5d, 0x4a, 0xff, 0x6c, 0x5f, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6d, 0x61, 0x4c, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6b, 0x5e, 0x48, 0xff, 0x6c, 0x5f, 0x4b, 0xff, 0xa9, 0xa3, 0x9a, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0x7e, 0x70, 0x5f, 0xff, 0x74, 0x63, 0x51, 0xff, 0x75, 0x66, 0x53, 0xff, 0x76, 0x67, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x76, 0x67, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x6f, 0x61, 0x52, 0xff, 0x68, 0x5b, 0x50, 0xff, 0x76, 0x6a, 0x61, 0xff, 0x82, 0x76, 0x6a, 0xff, 0x7f, 0x72, 0x63, 0xff, 0x74, 0x66, 0x54, 0xff, 0x73, 0x64, 0x51, 0xff, 0x75, 0x66, 0x52, 0xff, 0x73, 0x65, 0x51, 0xff, 0x72, 0x64, 0x50, 0xff, 0x72, 0x63, 0x4f, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x63, 0x50, 0xff, 0x71, 0x63, 0x50, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6d, 0x60, 0x4e, 0xff, 0x69, 0x5b, 0x4c, 0xff, 0x72, 0x66, 0x5b, 0xff, 0x7a, 0x6f, 0x67, 0xff, 0x82, 0x79, 0x73, 0xff, 0x90, 0x88, 0x81, 0xff, 0x94, 0x8b, 0x81, 0xff, 0x79, 0x6d, 0x5d, 0xff, 0x67, 0x59, 0x44, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x6b, 0x5e, 0x49, 0xff, 0x67, 0x5a, 0x44, 0xff, 0x96, 0x8d, 0x81, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdb, 0xd9, 0xd7, 0xff, 0x76, 0x67, 0x54, 0xff, 0x70, 0x60, 0x4d, 0xff, 0x76, 0x67, 0x54, 0xff, 0x76, 0x67, 0x54, 0xff, 0x75, 0x66, 0x53, 0xff, 0x74, 0x66, 0x52, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x52, 0xff, 0x70, 0x60, 0x4e, 0xff, 0x68, 0x5b, 0x55, 0xff, 0x7f, 0x76, 0x77, 0xff, 0xce, 0xcd, 0xcd, 0xff, 0xdc, 0xdb, 0xdb, 0xff, 0xd8, 0xd7, 0xd5, 0xff, 0xb6, 0xb0, 0xa9, 0xff, 0x78, 0x6b, 0x58, 0xff, 0x70, 0x63, 0x4e, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x63, 0x50, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x6e, 0x60, 0x4d, 0xff, 0x69, 0x5d, 0x4e, 0xff, 0x6e, 0x64, 0x5a, 0xff, 0x81, 0x78, 0x74, 0xff, 0xd2, 0xd0, 0xd0, 0xff, 0xdb, 0xda, 0xda, 0xff, 0xd9, 0xd8, 0xd9, 0xff, 0xdf, 0xde, 0xdf, 0xff, 0xe1, 0xe1, 0xe1, 0xff, 0xc3, 0xc0, 0xba, 0xff, 0x6c, 0x5f, 0x4b, 0xff, 0x6b, 0x5e, 0x4a, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x65, 0x57, 0x40, 0xff, 0x7d, 0x72, 0x60, 0xff, 0xd2, 0xd0, 0xcd, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xa1, 0x97, 0x8a, 0xff, 0x74, 0x65, 0x52, 0xff, 0x70, 0x61, 0x4d, 0xff, 0x75, 0x66, 0x54, 0xff, 0x75, 0x66, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x73, 0x64, 0x4f, 0xff, 0x6e, 0x60, 0x51, 0xff, 0x78, 0x6f, 0x6e, 0xff, 0xd7, 0xd5, 0xd7, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe1, 0xe0, 0xe0, 0xff, 0x83, 0x78, 0x66, 0xff, 0x70, 0x64, 0x50, 0xff, 0x6f, 0x61, 0x4d, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x6b, 0x5d, 0x4b, 0xff, 0x65, 0x5a, 0x51, 0xff, 0x7f, 0x78, 0x77, 0xff, 0xdc, 0xdc, 0xdc, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe0, 0xe0, 0xdf, 0xff, 0x8c, 0x82, 0x72, 0xff, 0x69, 0x5c, 0x47, 0xff, 0x6a, 0x5c, 0x47, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6b, 0x5e, 0x48, 0xff, 0x68, 0x5b, 0x44, 0xff, 0x76, 0x6a, 0x59, 0xff, 0xab, 0xa4, 0xa0, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xbc, 0xb6, 0xaf, 0xff, 0x73, 0x63, 0x51, 0xff, 0x6b, 0x5a, 0x47, 0xff, 0x73, 0x64, 0x51, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x73, 0x64, 0x50, 0xff, 0x6d, 0x5f, 0x4c, 0xff, 0x77, 0x6c, 0x63, 0xff, 0xbf, 0xbd, 0xbe, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0x8c, 0x83, 0x73, 0xff, 0x74, 0x67, 0x54, 0xff, 0x6d, 0x5f, 0x4a, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6e, 0x62, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6f, 0x61, 0x4d, 0xff, 0x69, 0x5c, 0x4a, 0xff, 0x6e, 0x65, 0x5d, 0xff, 0xad, 0xa9, 0xa9, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xc9, 0xc6, 0xc0, 0xff, 0x6f, 0x62, 0x4d, 0xff, 0x65, 0x57, 0x40, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6c, 0x5f, 0x49, 0xff, 0x6b, 0x5d, 0x48, 0xff, 0x68, 0x5a, 0x44, 0xff, 0x66, 0x59, 0x43, 0xff, 0x7e, 0x73, 0x65, 0xff, 0xdb, 0xd9, 0xd9, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0x92, 0x86, 0x78, 0xff, 0x7a, 0x6c, 0x5b, 0xff, 0x6d, 0x5d, 0x4a, 0xff, 0x6b, 0x5c, 0x47, 0xff, 0x6e, 0x5f, 0x4a, 0xff, 0x71, 0x62, 0x4d, 0xff, 0x6d, 0x5d, 0x47, 0xff, 0x70, 0x63, 0x55, 0xff, 0x8c, 0x85, 0x83, 0xff, 0xe1, 0xe0, 0xe0, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0x9b, 0x91, 0x84, 0xff, 0x77, 0x6a, 0x57, 0xff, 0x69, 0x5c, 0x48, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x62, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6d, 0x5f, 0x4b, 0xff, 0x6a, 0x5d, 0x4b, 0xff, 0x75, 0x6b, 0x63, 0xff, 0xdd, 0xdc, 0xdc, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe0, 0xe0, 0xdf, 0xff, 0x8c, 0x81, 0x71, 0xff, 0x65, 0x57, 0x41, 0xff, 0x63, 0x55, 0x3f, 0xff, 0x67, 0x59, 0x44, 0xff, 0x6c, 0x5f, 0x4d, 0xff, 0x74, 0x68, 0x5b, 0xff, 0x86, 0x7d, 0x73, 0xff, 0xd6, 0xd5, 0xd3, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xcb, 0xc7, 0xc2, 0xff, 0x92, 0x88, 0x7a, 0xff, 0x84, 0x77, 0x66, 0xff, 0x78, 0x6b, 0x58, 0xff, 0x72, 0x64, 0x51, 0xff, 0x7a, 0x6c, 0x5a, 0xff, 0x90, 0x87, 0x7e, 0xff, 0xda, 0xd9, 0xd9, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe0, 0xe0, 0xdf, 0xff, 0xa5, 0x9d, 0x91, 0xff, 0x78, 0x6c, 0x5a, 0xff, 0x68, 0x5b, 0x47, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4f, 0xff, 0x6e, 0x61, 0x4f, 0xff, 0x6e, 0x62, 0x4f, 0xff, 0x6d, 0x60, 0x4a, 0xff, 0x6e, 0x60, 0x4e, 0xff, 0x77, 0x6c, 0x66, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xd8, 0xd7, 0xd4, 0xff, 0x93, 0x89, 0x7a, 0xff, 0x81, 0x75, 0x64, 0xff, 0x8c, 0x81, 0x73, 0xff, 0x9b, 0x93, 0x89, 0xff, 0xd5, 0xd4, 0xd2, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xdf, 0xde, 0xff, 0xa8, 0xa0, 0x96, 0xff, 0x8b, 0x80, 0x72, 0xff, 0xd2, 0xd0, 0xcd, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xae, 0xa6, 0x9b, 0xff, 0x75, 0x68, 0x56, 0xff, 0x64, 0x56, 0x41, 0xff, 0x6b, 0x5e, 0x4a, 0xff, 0x6b, 0x5e, 0x4a, 0xff, 0x6b, 0x5e, 0x4a, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x6a, 0x5c, 0x45, 0xff, 0x6d, 0x60, 0x4e, 0xff, 0x81, 0x78, 0x73, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xe0, 0xe0, 0xdf, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xde, 0xff, 0x7b, 0x6f, 0x5c, 0xff, 0x67, 0x5a, 0x44, 0xff, 0x6b, 0x5e, 0x49, 0xff, 0x6b, 0x5e, 0x4a, 0xff, 0x6b, 0x5e, 0x4a, 0xff, 0x6b, 0x5d, 0x48, 0xff, 0x67, 0x59, 0x44, 0xff, 0x74, 0x68, 0x59, 0xff, 0x97, 0x90, 0x8c, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xbd, 0xb9, 0xb1, 0xff, 0x8a, 0x80, 0x6f, 0xff, 0x91, 0x87, 0x79, 0xff, 0x92, 0x89, 0x7b, 0xff, 0x92, 0x88, 0x7a, 0xff, 0x8f, 0x84, 0x77, 0xff, 0x83, 0x78, 0x6a, 0xff, 0x96, 0x8d, 0x83, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-  0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xdf, 0xdf, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff, 0xde, 0xde, 0xde, 0xff,
-#endif
-};
-
-const lv_img_dsc_t img_benchmark_cogwheel_rgb = {
-  .header.always_zero = 0,
-  .header.w = 100,
-  .header.h = 100,
-  .data_size = 10000 * LV_COLOR_SIZE / 8,
-  .header.cf = LV_IMG_CF_TRUE_COLOR,
-  .data = img_benchmark_cogwheel_rgb_map,
-};
-
-#endif
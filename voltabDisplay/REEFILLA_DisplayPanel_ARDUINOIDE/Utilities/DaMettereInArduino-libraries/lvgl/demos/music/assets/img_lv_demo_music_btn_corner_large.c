@@ -1,163 +0,0 @@
-#include "../lv_demo_music.h"
-#if LV_USE_DEMO_MUSIC && LV_DEMO_MUSIC_LARGE
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMG_LV_DEMO_MUSIC_BTN_CORNER
-#define LV_ATTRIBUTE_IMG_IMG_LV_DEMO_MUSIC_BTN_CORNER
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMG_LV_DEMO_MUSIC_BTN_CORNER uint8_t img_lv_demo_music_btn_corner_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Blue: 2 bit, Green: 3 bit, Red: 3 bit, Alpha 8 bit */
-  0x49, 0x07, 0x49, 0x04, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-  0x49, 0x0c, 0x49, 0x08, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-  0x49, 0x18, 0x49, 0x10, 0x49, 0x03, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-  0x49, 0x2b, 0x49, 0x1c, 0x49, 0x04, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-  0x49, 0x3f, 0x49, 0x28, 0x49, 0x07, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-  0x49, 0x5c, 0x49, 0x3c, 0x49, 0x08, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-  0x49, 0x7c, 0x49, 0x53, 0x49, 0x0c, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-  0x49, 0xa4, 0x49, 0x6c, 0x49, 0x0f, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-  0x49, 0xcb, 0x49, 0x87, 0x49, 0x17, 0x49, 0x03, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-  0x49, 0xef, 0x49, 0xa3, 0x49, 0x24, 0x49, 0x08, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-  0x49, 0xfb, 0x49, 0xb7, 0x49, 0x44, 0x49, 0x1b, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-  0x49, 0xff, 0x49, 0xc7, 0x49, 0x6b, 0x49, 0x30, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-  0x49, 0xff, 0x49, 0xdb, 0x49, 0x9b, 0x49, 0x4c, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-  0x49, 0xff, 0x49, 0xeb, 0x49, 0xcb, 0x49, 0x6b, 0x49, 0x07, 0x49, 0x03, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-  0x49, 0xff, 0x49, 0xf7, 0x49, 0xeb, 0x49, 0x8f, 0x49, 0x28, 0x49, 0x10, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-  0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xb4, 0x49, 0x5f, 0x49, 0x2b, 0x49, 0x03, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-  0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xdf, 0x49, 0xb4, 0x49, 0x50, 0x49, 0x08, 0x49, 0x03, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-  0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xf4, 0x49, 0xe3, 0x49, 0x80, 0x49, 0x30, 0x49, 0x10, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-  0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xfc, 0x49, 0xf7, 0x49, 0xb3, 0x49, 0x6b, 0x49, 0x24, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-  0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xfc, 0x49, 0xd8, 0x49, 0xa7, 0x49, 0x53, 0x49, 0x1c, 0x49, 0x07, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-  0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xfc, 0x49, 0xe0, 0x49, 0x87, 0x49, 0x40, 0x49, 0x10, 0x49, 0x03, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-  0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xf3, 0x49, 0xcc, 0x49, 0x94, 0x49, 0x4f, 0x49, 0x23, 0x49, 0x03, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-  0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xd8, 0x49, 0x8f, 0x49, 0x50, 0x49, 0x14, 0x49, 0x08, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-  0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xf3, 0x49, 0xd8, 0x49, 0x9c, 0x49, 0x54, 0x49, 0x27, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-  0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xd4, 0x49, 0x9b, 0x49, 0x60, 0x49, 0x2b, 0x49, 0x13, 0x49, 0x04, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-  0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xf7, 0x49, 0xe8, 0x49, 0xb4, 0x49, 0x7c, 0x49, 0x38, 0x49, 0x0c, 0x49, 0x03, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-  0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xe0, 0x49, 0xbf, 0x49, 0x8c, 0x49, 0x5c, 0x49, 0x33, 0x49, 0x17, 0x49, 0x03, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-  0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xfc, 0x49, 0xfb, 0x49, 0xef, 0x49, 0xc8, 0x49, 0x74, 0x49, 0x37, 0x49, 0x08, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-  0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xfb, 0x49, 0xe8, 0x49, 0xc0, 0x49, 0x98, 0x49, 0x73, 0x49, 0x54, 0x49, 0x37, 0x49, 0x1f, 0x49, 0x0b, 0x49, 0x04, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00, 0x49, 0x00,
-  0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xf0, 0x49, 0xd7, 0x49, 0xa8, 0x49, 0x77, 0x49, 0x4c, 0x49, 0x28, 0x49, 0x1b, 0x49, 0x10, 0x49, 0x0c, 0x49, 0x0b, 0x49, 0x07, 0x49, 0x04, 0x49, 0x03, 0x49, 0x00, 0x49, 0x00,
-  0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xf8, 0x49, 0xf0, 0x49, 0xdf, 0x49, 0xcb, 0x49, 0xbb, 0x49, 0xa8, 0x49, 0x8f, 0x49, 0x73, 0x49, 0x58, 0x49, 0x44, 0x49, 0x30, 0x49, 0x20, 0x49, 0x10, 0x49, 0x08, 0x49, 0x04,
-  0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xf7, 0x49, 0xd4, 0x49, 0xaf, 0x49, 0x87, 0x49, 0x67, 0x49, 0x4b, 0x49, 0x30, 0x49, 0x18, 0x49, 0x0c, 0x49, 0x07,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Blue: 5 bit, Green: 6 bit, Red: 5 bit, Alpha 8 bit*/
-  0x89, 0x31, 0x07, 0x89, 0x31, 0x04, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00,
-  0x89, 0x31, 0x0c, 0x89, 0x31, 0x08, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00,
-  0x89, 0x31, 0x18, 0x89, 0x31, 0x10, 0x89, 0x31, 0x03, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00,
-  0x89, 0x31, 0x2b, 0x89, 0x31, 0x1c, 0x89, 0x31, 0x04, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00,
-  0x89, 0x31, 0x3f, 0x89, 0x31, 0x28, 0x89, 0x31, 0x07, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00,
-  0x89, 0x31, 0x5c, 0x89, 0x31, 0x3c, 0x89, 0x31, 0x08, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00,
-  0x89, 0x31, 0x7c, 0x89, 0x31, 0x53, 0x89, 0x31, 0x0c, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00,
-  0x89, 0x31, 0xa4, 0x89, 0x31, 0x6c, 0x89, 0x31, 0x0f, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00,
-  0x89, 0x31, 0xcb, 0x89, 0x31, 0x87, 0x89, 0x31, 0x17, 0x89, 0x31, 0x03, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00,
-  0x89, 0x31, 0xef, 0x89, 0x31, 0xa3, 0x89, 0x31, 0x24, 0x89, 0x31, 0x08, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00,
-  0x89, 0x31, 0xfb, 0x89, 0x31, 0xb7, 0x89, 0x31, 0x44, 0x89, 0x31, 0x1b, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00,
-  0x89, 0x31, 0xff, 0x89, 0x31, 0xc7, 0x89, 0x31, 0x6b, 0x89, 0x31, 0x30, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00,
-  0x89, 0x31, 0xff, 0x89, 0x31, 0xdb, 0x89, 0x31, 0x9b, 0x89, 0x31, 0x4c, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00,
-  0x89, 0x31, 0xff, 0x89, 0x31, 0xeb, 0x89, 0x31, 0xcb, 0x89, 0x31, 0x6b, 0x89, 0x31, 0x07, 0x89, 0x31, 0x03, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00,
-  0x89, 0x31, 0xff, 0x89, 0x31, 0xf7, 0x89, 0x31, 0xeb, 0x89, 0x31, 0x8f, 0x89, 0x31, 0x28, 0x89, 0x31, 0x10, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00,
-  0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xb4, 0x89, 0x31, 0x5f, 0x89, 0x31, 0x2b, 0x89, 0x31, 0x03, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00,
-  0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xdf, 0x89, 0x31, 0xb4, 0x89, 0x31, 0x50, 0x89, 0x31, 0x08, 0x89, 0x31, 0x03, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00,
-  0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xf4, 0x89, 0x31, 0xe3, 0x89, 0x31, 0x80, 0x89, 0x31, 0x30, 0x89, 0x31, 0x10, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00,
-  0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xfc, 0x89, 0x31, 0xf7, 0x89, 0x31, 0xb3, 0x89, 0x31, 0x6b, 0x89, 0x31, 0x24, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00,
-  0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xfc, 0x89, 0x31, 0xd8, 0x89, 0x31, 0xa7, 0x89, 0x31, 0x53, 0x89, 0x31, 0x1c, 0x89, 0x31, 0x07, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00,
-  0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xfc, 0x89, 0x31, 0xe0, 0x89, 0x31, 0x87, 0x89, 0x31, 0x40, 0x89, 0x31, 0x10, 0x89, 0x31, 0x03, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00,
-  0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xf3, 0x89, 0x31, 0xcc, 0x89, 0x31, 0x94, 0x89, 0x31, 0x4f, 0x89, 0x31, 0x23, 0x89, 0x31, 0x03, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00,
-  0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xd8, 0x89, 0x31, 0x8f, 0x89, 0x31, 0x50, 0x89, 0x31, 0x14, 0x89, 0x31, 0x08, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00,
-  0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xf3, 0x89, 0x31, 0xd8, 0x89, 0x31, 0x9c, 0x89, 0x31, 0x54, 0x89, 0x31, 0x27, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00,
-  0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xd4, 0x89, 0x31, 0x9b, 0x89, 0x31, 0x60, 0x89, 0x31, 0x2b, 0x89, 0x31, 0x13, 0x89, 0x31, 0x04, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00,
-  0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xf7, 0x89, 0x31, 0xe8, 0x89, 0x31, 0xb4, 0x89, 0x31, 0x7c, 0x89, 0x31, 0x38, 0x89, 0x31, 0x0c, 0x89, 0x31, 0x03, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00,
-  0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xe0, 0x89, 0x31, 0xbf, 0x89, 0x31, 0x8c, 0x89, 0x31, 0x5c, 0x89, 0x31, 0x33, 0x89, 0x31, 0x17, 0x89, 0x31, 0x03, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00,
-  0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xfc, 0x89, 0x31, 0xfb, 0x89, 0x31, 0xef, 0x89, 0x31, 0xc8, 0x89, 0x31, 0x74, 0x89, 0x31, 0x37, 0x89, 0x31, 0x08, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00,
-  0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xfb, 0x89, 0x31, 0xe8, 0x89, 0x31, 0xc0, 0x89, 0x31, 0x98, 0x89, 0x31, 0x73, 0x89, 0x31, 0x54, 0x89, 0x31, 0x37, 0x89, 0x31, 0x1f, 0x89, 0x31, 0x0b, 0x89, 0x31, 0x04, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00,
-  0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xf0, 0x89, 0x31, 0xd7, 0x89, 0x31, 0xa8, 0x89, 0x31, 0x77, 0x89, 0x31, 0x4c, 0x89, 0x31, 0x28, 0x89, 0x31, 0x1b, 0x89, 0x31, 0x10, 0x89, 0x31, 0x0c, 0x89, 0x31, 0x0b, 0x89, 0x31, 0x07, 0x89, 0x31, 0x04, 0x89, 0x31, 0x03, 0x89, 0x31, 0x00, 0x89, 0x31, 0x00,
-  0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xf8, 0x89, 0x31, 0xf0, 0x89, 0x31, 0xdf, 0x89, 0x31, 0xcb, 0x89, 0x31, 0xbb, 0x89, 0x31, 0xa8, 0x89, 0x31, 0x8f, 0x89, 0x31, 0x73, 0x89, 0x31, 0x58, 0x89, 0x31, 0x44, 0x89, 0x31, 0x30, 0x89, 0x31, 0x20, 0x89, 0x31, 0x10, 0x89, 0x31, 0x08, 0x89, 0x31, 0x04,
-  0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xff, 0x89, 0x31, 0xf7, 0x89, 0x31, 0xd4, 0x89, 0x31, 0xaf, 0x89, 0x31, 0x87, 0x89, 0x31, 0x67, 0x89, 0x31, 0x4b, 0x89, 0x31, 0x30, 0x89, 0x31, 0x18, 0x89, 0x31, 0x0c, 0x89, 0x31, 0x07,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format:  Blue: 5 bit Green: 6 bit, Red: 5 bit, Alpha 8 bit  BUT the 2  color bytes are swapped*/
-  0x31, 0x89, 0x07, 0x31, 0x89, 0x04, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00,
-  0x31, 0x89, 0x0c, 0x31, 0x89, 0x08, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00,
-  0x31, 0x89, 0x18, 0x31, 0x89, 0x10, 0x31, 0x89, 0x03, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00,
-  0x31, 0x89, 0x2b, 0x31, 0x89, 0x1c, 0x31, 0x89, 0x04, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00,
-  0x31, 0x89, 0x3f, 0x31, 0x89, 0x28, 0x31, 0x89, 0x07, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00,
-  0x31, 0x89, 0x5c, 0x31, 0x89, 0x3c, 0x31, 0x89, 0x08, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00,
-  0x31, 0x89, 0x7c, 0x31, 0x89, 0x53, 0x31, 0x89, 0x0c, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00,
-  0x31, 0x89, 0xa4, 0x31, 0x89, 0x6c, 0x31, 0x89, 0x0f, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00,
-  0x31, 0x89, 0xcb, 0x31, 0x89, 0x87, 0x31, 0x89, 0x17, 0x31, 0x89, 0x03, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00,
-  0x31, 0x89, 0xef, 0x31, 0x89, 0xa3, 0x31, 0x89, 0x24, 0x31, 0x89, 0x08, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00,
-  0x31, 0x89, 0xfb, 0x31, 0x89, 0xb7, 0x31, 0x89, 0x44, 0x31, 0x89, 0x1b, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00,
-  0x31, 0x89, 0xff, 0x31, 0x89, 0xc7, 0x31, 0x89, 0x6b, 0x31, 0x89, 0x30, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00,
-  0x31, 0x89, 0xff, 0x31, 0x89, 0xdb, 0x31, 0x89, 0x9b, 0x31, 0x89, 0x4c, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00,
-  0x31, 0x89, 0xff, 0x31, 0x89, 0xeb, 0x31, 0x89, 0xcb, 0x31, 0x89, 0x6b, 0x31, 0x89, 0x07, 0x31, 0x89, 0x03, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00,
-  0x31, 0x89, 0xff, 0x31, 0x89, 0xf7, 0x31, 0x89, 0xeb, 0x31, 0x89, 0x8f, 0x31, 0x89, 0x28, 0x31, 0x89, 0x10, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00,
-  0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xb4, 0x31, 0x89, 0x5f, 0x31, 0x89, 0x2b, 0x31, 0x89, 0x03, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00,
-  0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xdf, 0x31, 0x89, 0xb4, 0x31, 0x89, 0x50, 0x31, 0x89, 0x08, 0x31, 0x89, 0x03, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00,
-  0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xf4, 0x31, 0x89, 0xe3, 0x31, 0x89, 0x80, 0x31, 0x89, 0x30, 0x31, 0x89, 0x10, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00,
-  0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xfc, 0x31, 0x89, 0xf7, 0x31, 0x89, 0xb3, 0x31, 0x89, 0x6b, 0x31, 0x89, 0x24, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00,
-  0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xfc, 0x31, 0x89, 0xd8, 0x31, 0x89, 0xa7, 0x31, 0x89, 0x53, 0x31, 0x89, 0x1c, 0x31, 0x89, 0x07, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00,
-  0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xfc, 0x31, 0x89, 0xe0, 0x31, 0x89, 0x87, 0x31, 0x89, 0x40, 0x31, 0x89, 0x10, 0x31, 0x89, 0x03, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00,
-  0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xf3, 0x31, 0x89, 0xcc, 0x31, 0x89, 0x94, 0x31, 0x89, 0x4f, 0x31, 0x89, 0x23, 0x31, 0x89, 0x03, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00,
-  0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xd8, 0x31, 0x89, 0x8f, 0x31, 0x89, 0x50, 0x31, 0x89, 0x14, 0x31, 0x89, 0x08, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00,
-  0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xf3, 0x31, 0x89, 0xd8, 0x31, 0x89, 0x9c, 0x31, 0x89, 0x54, 0x31, 0x89, 0x27, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00,
-  0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xd4, 0x31, 0x89, 0x9b, 0x31, 0x89, 0x60, 0x31, 0x89, 0x2b, 0x31, 0x89, 0x13, 0x31, 0x89, 0x04, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00,
-  0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xf7, 0x31, 0x89, 0xe8, 0x31, 0x89, 0xb4, 0x31, 0x89, 0x7c, 0x31, 0x89, 0x38, 0x31, 0x89, 0x0c, 0x31, 0x89, 0x03, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00,
-  0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xe0, 0x31, 0x89, 0xbf, 0x31, 0x89, 0x8c, 0x31, 0x89, 0x5c, 0x31, 0x89, 0x33, 0x31, 0x89, 0x17, 0x31, 0x89, 0x03, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00,
-  0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xfc, 0x31, 0x89, 0xfb, 0x31, 0x89, 0xef, 0x31, 0x89, 0xc8, 0x31, 0x89, 0x74, 0x31, 0x89, 0x37, 0x31, 0x89, 0x08, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00,
-  0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xfb, 0x31, 0x89, 0xe8, 0x31, 0x89, 0xc0, 0x31, 0x89, 0x98, 0x31, 0x89, 0x73, 0x31, 0x89, 0x54, 0x31, 0x89, 0x37, 0x31, 0x89, 0x1f, 0x31, 0x89, 0x0b, 0x31, 0x89, 0x04, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00,
-  0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xf0, 0x31, 0x89, 0xd7, 0x31, 0x89, 0xa8, 0x31, 0x89, 0x77, 0x31, 0x89, 0x4c, 0x31, 0x89, 0x28, 0x31, 0x89, 0x1b, 0x31, 0x89, 0x10, 0x31, 0x89, 0x0c, 0x31, 0x89, 0x0b, 0x31, 0x89, 0x07, 0x31, 0x89, 0x04, 0x31, 0x89, 0x03, 0x31, 0x89, 0x00, 0x31, 0x89, 0x00,
-  0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xf8, 0x31, 0x89, 0xf0, 0x31, 0x89, 0xdf, 0x31, 0x89, 0xcb, 0x31, 0x89, 0xbb, 0x31, 0x89, 0xa8, 0x31, 0x89, 0x8f, 0x31, 0x89, 0x73, 0x31, 0x89, 0x58, 0x31, 0x89, 0x44, 0x31, 0x89, 0x30, 0x31, 0x89, 0x20, 0x31, 0x89, 0x10, 0x31, 0x89, 0x08, 0x31, 0x89, 0x04,
-  0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xff, 0x31, 0x89, 0xf7, 0x31, 0x89, 0xd4, 0x31, 0x89, 0xaf, 0x31, 0x89, 0x87, 0x31, 0x89, 0x67, 0x31, 0x89, 0x4b, 0x31, 0x89, 0x30, 0x31, 0x89, 0x18, 0x31, 0x89, 0x0c, 0x31, 0x89, 0x07,
-#endif
-#if LV_COLOR_DEPTH == 32
-  /*Pixel format:  Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha: 8 bit*/
-  0x47, 0x32, 0x34, 0x07, 0x47, 0x32, 0x34, 0x04, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00,
-  0x47, 0x32, 0x34, 0x0c, 0x47, 0x32, 0x34, 0x08, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00,
-  0x47, 0x32, 0x34, 0x18, 0x47, 0x32, 0x34, 0x10, 0x47, 0x32, 0x34, 0x03, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00,
-  0x47, 0x32, 0x34, 0x2b, 0x47, 0x32, 0x34, 0x1c, 0x47, 0x32, 0x34, 0x04, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00,
-  0x47, 0x32, 0x34, 0x3f, 0x47, 0x32, 0x34, 0x28, 0x47, 0x32, 0x34, 0x07, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00,
-  0x47, 0x32, 0x34, 0x5c, 0x47, 0x32, 0x34, 0x3c, 0x47, 0x32, 0x34, 0x08, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00,
-  0x47, 0x32, 0x34, 0x7c, 0x47, 0x32, 0x34, 0x53, 0x47, 0x32, 0x34, 0x0c, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00,
-  0x47, 0x32, 0x34, 0xa4, 0x47, 0x32, 0x34, 0x6c, 0x47, 0x32, 0x34, 0x0f, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00,
-  0x47, 0x32, 0x34, 0xcb, 0x47, 0x32, 0x34, 0x87, 0x47, 0x32, 0x34, 0x17, 0x47, 0x32, 0x34, 0x03, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00,
-  0x47, 0x32, 0x34, 0xef, 0x47, 0x32, 0x34, 0xa3, 0x47, 0x32, 0x34, 0x24, 0x47, 0x32, 0x34, 0x08, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00,
-  0x47, 0x32, 0x34, 0xfb, 0x47, 0x32, 0x34, 0xb7, 0x47, 0x32, 0x34, 0x44, 0x47, 0x32, 0x34, 0x1b, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00,
-  0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xc7, 0x47, 0x32, 0x34, 0x6b, 0x47, 0x32, 0x34, 0x30, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00,
-  0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xdb, 0x47, 0x32, 0x34, 0x9b, 0x47, 0x32, 0x34, 0x4c, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00,
-  0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xeb, 0x47, 0x32, 0x34, 0xcb, 0x47, 0x32, 0x34, 0x6b, 0x47, 0x32, 0x34, 0x07, 0x47, 0x32, 0x34, 0x03, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00,
-  0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xf7, 0x47, 0x32, 0x34, 0xeb, 0x47, 0x32, 0x34, 0x8f, 0x47, 0x32, 0x34, 0x28, 0x47, 0x32, 0x34, 0x10, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00,
-  0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xb4, 0x47, 0x32, 0x34, 0x5f, 0x47, 0x32, 0x34, 0x2b, 0x47, 0x32, 0x34, 0x03, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00,
-  0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xdf, 0x47, 0x32, 0x34, 0xb4, 0x47, 0x32, 0x34, 0x50, 0x47, 0x32, 0x34, 0x08, 0x47, 0x32, 0x34, 0x03, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00,
-  0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xf4, 0x47, 0x32, 0x34, 0xe3, 0x47, 0x32, 0x34, 0x80, 0x47, 0x32, 0x34, 0x30, 0x47, 0x32, 0x34, 0x10, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00,
-  0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xfc, 0x47, 0x32, 0x34, 0xf7, 0x47, 0x32, 0x34, 0xb3, 0x47, 0x32, 0x34, 0x6b, 0x47, 0x32, 0x34, 0x24, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00,
-  0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xfc, 0x47, 0x32, 0x34, 0xd8, 0x47, 0x32, 0x34, 0xa7, 0x47, 0x32, 0x34, 0x53, 0x47, 0x32, 0x34, 0x1c, 0x47, 0x32, 0x34, 0x07, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00,
-  0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xfc, 0x47, 0x32, 0x34, 0xe0, 0x47, 0x32, 0x34, 0x87, 0x47, 0x32, 0x34, 0x40, 0x47, 0x32, 0x34, 0x10, 0x47, 0x32, 0x34, 0x03, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00,
-  0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xf3, 0x47, 0x32, 0x34, 0xcc, 0x47, 0x32, 0x34, 0x94, 0x47, 0x32, 0x34, 0x4f, 0x47, 0x32, 0x34, 0x23, 0x47, 0x32, 0x34, 0x03, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00,
-  0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xd8, 0x47, 0x32, 0x34, 0x8f, 0x47, 0x32, 0x34, 0x50, 0x47, 0x32, 0x34, 0x14, 0x47, 0x32, 0x34, 0x08, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00,
-  0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xf3, 0x47, 0x32, 0x34, 0xd8, 0x47, 0x32, 0x34, 0x9c, 0x47, 0x32, 0x34, 0x54, 0x47, 0x32, 0x34, 0x27, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00,
-  0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xd4, 0x47, 0x32, 0x34, 0x9b, 0x47, 0x32, 0x34, 0x60, 0x47, 0x32, 0x34, 0x2b, 0x47, 0x32, 0x34, 0x13, 0x47, 0x32, 0x34, 0x04, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00,
-  0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xf7, 0x47, 0x32, 0x34, 0xe8, 0x47, 0x32, 0x34, 0xb4, 0x47, 0x32, 0x34, 0x7c, 0x47, 0x32, 0x34, 0x38, 0x47, 0x32, 0x34, 0x0c, 0x47, 0x32, 0x34, 0x03, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00,
-  0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xe0, 0x47, 0x32, 0x34, 0xbf, 0x47, 0x32, 0x34, 0x8c, 0x47, 0x32, 0x34, 0x5c, 0x47, 0x32, 0x34, 0x33, 0x47, 0x32, 0x34, 0x17, 0x47, 0x32, 0x34, 0x03, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00,
-  0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xfc, 0x47, 0x32, 0x34, 0xfb, 0x47, 0x32, 0x34, 0xef, 0x47, 0x32, 0x34, 0xc8, 0x47, 0x32, 0x34, 0x74, 0x47, 0x32, 0x34, 0x37, 0x47, 0x32, 0x34, 0x08, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00,
-  0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xfb, 0x47, 0x32, 0x34, 0xe8, 0x47, 0x32, 0x34, 0xc0, 0x47, 0x32, 0x34, 0x98, 0x47, 0x32, 0x34, 0x73, 0x47, 0x32, 0x34, 0x54, 0x47, 0x32, 0x34, 0x37, 0x47, 0x32, 0x34, 0x1f, 0x47, 0x32, 0x34, 0x0b, 0x47, 0x32, 0x34, 0x04, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00,
-  0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xf0, 0x47, 0x32, 0x34, 0xd7, 0x47, 0x32, 0x34, 0xa8, 0x47, 0x32, 0x34, 0x77, 0x47, 0x32, 0x34, 0x4c, 0x47, 0x32, 0x34, 0x28, 0x47, 0x32, 0x34, 0x1b, 0x47, 0x32, 0x34, 0x10, 0x47, 0x32, 0x34, 0x0c, 0x47, 0x32, 0x34, 0x0b, 0x47, 0x32, 0x34, 0x07, 0x47, 0x32, 0x34, 0x04, 0x47, 0x32, 0x34, 0x03, 0x47, 0x32, 0x34, 0x00, 0x47, 0x32, 0x34, 0x00,
-  0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xf8, 0x47, 0x32, 0x34, 0xf0, 0x47, 0x32, 0x34, 0xdf, 0x47, 0x32, 0x34, 0xcb, 0x47, 0x32, 0x34, 0xbb, 0x47, 0x32, 0x34, 0xa8, 0x47, 0x32, 0x34, 0x8f, 0x47, 0x32, 0x34, 0x73, 0x47, 0x32, 0x34, 0x58, 0x47, 0x32, 0x34, 0x44, 0x47, 0x32, 0x34, 0x30, 0x47, 0x32, 0x34, 0x20, 0x47, 0x32, 0x34, 0x10, 0x47, 0x32, 0x34, 0x08, 0x47, 0x32, 0x34, 0x04,
-  0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xff, 0x47, 0x32, 0x34, 0xf7, 0x47, 0x32, 0x34, 0xd4, 0x47, 0x32, 0x34, 0xaf, 0x47, 0x32, 0x34, 0x87, 0x47, 0x32, 0x34, 0x67, 0x47, 0x32, 0x34, 0x4b, 0x47, 0x32, 0x34, 0x30, 0x47, 0x32, 0x34, 0x18, 0x47, 0x32, 0x34, 0x0c, 0x47, 0x32, 0x34, 0x07,
-#endif
-};
-
-const lv_img_dsc_t img_lv_demo_music_btn_corner = {
-  .header.always_zero = 0,
-  .header.w = 32,
-  .header.h = 32,
-  .data_size = 1024 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .data = img_lv_demo_music_btn_corner_map,
-};
-#endif
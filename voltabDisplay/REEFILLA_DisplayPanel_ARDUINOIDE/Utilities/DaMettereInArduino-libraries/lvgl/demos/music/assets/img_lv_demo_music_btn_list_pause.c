@@ -1,273 +0,0 @@
-#include "../lv_demo_music.h"
-#if LV_USE_DEMO_MUSIC  && !LV_DEMO_MUSIC_LARGE
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t img_lv_demo_music_btn_list_pause_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x1b, 0xaf, 0x1c, 0xaf, 0x1f, 0xaf, 0x20, 0xaf, 0x20, 0xaf, 0x20, 0xaf, 0x20, 0xaf, 0x20, 0xaf, 0x1f, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1b, 0xaf, 0x1f, 0xaf, 0x23, 0xaf, 0x24, 0xaf, 0x27, 0xaf, 0x2b, 0xaf, 0x2b, 0xaf, 0x2c, 0xaf, 0x2c, 0xaf, 0x2c, 0xaf, 0x2b, 0xaf, 0x2b, 0xaf, 0x28, 0xaf, 0x24, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x24, 0xaf, 0x28, 0xaf, 0x2c, 0xaf, 0x34, 0x93, 0x57, 0x93, 0x70, 0x93, 0x7b, 0x93, 0x74, 0x93, 0x63, 0xaf, 0x44, 0xaf, 0x38, 0xaf, 0x37, 0xaf, 0x34, 0xaf, 0x30, 0xaf, 0x2f, 0xaf, 0x2b, 0xaf, 0x27, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x20, 0xaf, 0x24, 0xaf, 0x2b, 0x93, 0x5f, 0x73, 0x97, 0x73, 0xd4, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xdc, 0x93, 0xa8, 0x93, 0x7c, 0xaf, 0x3f, 0xaf, 0x3b, 0xaf, 0x37, 0xaf, 0x30, 0xaf, 0x2c, 0xaf, 0x27, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1c, 0xaf, 0x23, 0xaf, 0x28, 0x73, 0x83, 0x77, 0xd3, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xdf, 0x93, 0x9b, 0xaf, 0x44, 0xaf, 0x3f, 0xaf, 0x38, 0xaf, 0x30, 0xaf, 0x2b, 0xaf, 0x24, 0xaf, 0x1f, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x18, 0xaf, 0x1f, 0xaf, 0x24, 0x93, 0x53, 0x73, 0xbf, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x97, 0xff, 0xb7, 0xff, 0xbb, 0xff, 0xb7, 0xff, 0x97, 0xff, 0x97, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0x93, 0xdb, 0x93, 0x8f, 0xaf, 0x44, 0xaf, 0x3f, 0xaf, 0x37, 0xaf, 0x2f, 0xaf, 0x27, 0xaf, 0x20, 0xaf, 0x1b, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x18, 0xaf, 0x1f, 0xaf, 0x27, 0x73, 0x84, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0xbb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xb7, 0xaf, 0x4b, 0xaf, 0x43, 0xaf, 0x3b, 0xaf, 0x30, 0xaf, 0x28, 0xaf, 0x20, 0xaf, 0x1b, 0xaf, 0x14, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x13, 0xaf, 0x18, 0xaf, 0x1f, 0xaf, 0x27, 0x73, 0xa3, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xc8, 0xaf, 0x50, 0xaf, 0x47, 0xaf, 0x3c, 0xaf, 0x33, 0xaf, 0x28, 0xaf, 0x20, 0xaf, 0x1b, 0xaf, 0x14, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x17, 0xaf, 0x1f, 0xaf, 0x27, 0x73, 0xa0, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x97, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xcb, 0xaf, 0x53, 0xaf, 0x48, 0xaf, 0x3c, 0xaf, 0x33, 0xaf, 0x28, 0xaf, 0x20, 0xaf, 0x18, 0xaf, 0x13, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x14, 0xaf, 0x1c, 0xaf, 0x24, 0x73, 0x7f, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xb8, 0xaf, 0x54, 0xaf, 0x48, 0xaf, 0x3c, 0xaf, 0x30, 0xaf, 0x27, 0xaf, 0x1f, 0xaf, 0x17, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x13, 0xaf, 0x1b, 0xaf, 0x23, 0x93, 0x40, 0x77, 0xf0, 0x77, 0xff, 0x77, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0x9b, 0xaf, 0x53, 0xaf, 0x47, 0xaf, 0x38, 0xaf, 0x2f, 0xaf, 0x24, 0xaf, 0x1c, 0xaf, 0x14, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x0b, 0xaf, 0x10, 0xaf, 0x17, 0xaf, 0x1f, 0xaf, 0x28, 0x73, 0xa8, 0x77, 0xff, 0x77, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xe3, 0xaf, 0x5f, 0xaf, 0x50, 0xaf, 0x43, 0xaf, 0x37, 0xaf, 0x2b, 0xaf, 0x20, 0xaf, 0x18, 0xaf, 0x13, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x13, 0xaf, 0x1b, 0xaf, 0x24, 0x93, 0x67, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xaf, 0xaf, 0x5b, 0xaf, 0x4b, 0xaf, 0x3c, 0xaf, 0x30, 0xaf, 0x27, 0xaf, 0x1c, 0xaf, 0x14, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x07, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x17, 0xaf, 0x1f, 0xaf, 0x28, 0x73, 0x9f, 0x77, 0xff, 0x77, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xe4, 0xaf, 0x64, 0xaf, 0x54, 0xaf, 0x44, 0xaf, 0x37, 0xaf, 0x2b, 0xaf, 0x20, 0xaf, 0x18, 0xaf, 0x10, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x0c, 0xaf, 0x13, 0xaf, 0x1b, 0xaf, 0x23, 0xaf, 0x33, 0x73, 0xf0, 0x77, 0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xaf, 0x94, 0xaf, 0x5c, 0xaf, 0x4c, 0xaf, 0x3f, 0xaf, 0x30, 0xaf, 0x24, 0xaf, 0x1c, 0xaf, 0x14, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x14, 0xaf, 0x1c, 0xaf, 0x27, 0x93, 0x6b, 0x73, 0xff, 0x73, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xbb, 0xaf, 0x64, 0xaf, 0x53, 0xaf, 0x43, 0xaf, 0x37, 0xaf, 0x2b, 0xaf, 0x1f, 0xaf, 0x17, 0xaf, 0x0f, 0xaf, 0x08, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x08, 0xaf, 0x0f, 0xaf, 0x17, 0xaf, 0x20, 0xaf, 0x2b, 0x73, 0x9c, 0x73, 0xff, 0x73, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xe3, 0xaf, 0x6b, 0xaf, 0x58, 0xaf, 0x48, 0xaf, 0x3b, 0xaf, 0x2c, 0xaf, 0x23, 0xaf, 0x18, 0xaf, 0x10, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x03, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x07, 0xaf, 0x0b, 0xaf, 0x10, 0xaf, 0x18, 0xaf, 0x23, 0xaf, 0x2f, 0x73, 0xcf, 0x73, 0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xaf, 0x74, 0xaf, 0x5f, 0xaf, 0x4f, 0xaf, 0x3f, 0xaf, 0x30, 0xaf, 0x24, 0xaf, 0x1b, 0xaf, 0x13, 0xaf, 0x0c, 0xaf, 0x07, 0xaf, 0x03, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x07, 0xaf, 0x0b, 0xaf, 0x13, 0xaf, 0x1b, 0xaf, 0x24, 0xaf, 0x30, 0x73, 0xf0, 0x73, 0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0x8c, 0xaf, 0x63, 0xaf, 0x53, 0xaf, 0x43, 0xaf, 0x34, 0xaf, 0x27, 0xaf, 0x1c, 0xaf, 0x14, 0xaf, 0x0c, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x07, 0xaf, 0x0c, 0xaf, 0x13, 0xaf, 0x1c, 0xaf, 0x27, 0xaf, 0x34, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0x9c, 0xaf, 0x67, 0xaf, 0x54, 0xaf, 0x44, 0xaf, 0x37, 0xaf, 0x28, 0xaf, 0x1f, 0xaf, 0x14, 0xaf, 0x0f, 0xaf, 0x08, 0xaf, 0x04, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x07, 0xaf, 0x0c, 0xaf, 0x14, 0xaf, 0x1c, 0xaf, 0x28, 0xaf, 0x3f, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xa3, 0xaf, 0x6b, 0xaf, 0x57, 0xaf, 0x47, 0xaf, 0x38, 0xaf, 0x2b, 0xaf, 0x20, 0xaf, 0x17, 0xaf, 0x0f, 0xaf, 0x08, 0xaf, 0x04, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x07, 0xaf, 0x0c, 0xaf, 0x14, 0xaf, 0x1f, 0xaf, 0x28, 0xaf, 0x34, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0x9c, 0xaf, 0x6b, 0xaf, 0x58, 0xaf, 0x48, 0xaf, 0x38, 0xaf, 0x2c, 0xaf, 0x20, 0xaf, 0x17, 0xaf, 0x0f, 0xaf, 0x08, 0xaf, 0x04, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x07, 0xaf, 0x0c, 0xaf, 0x14, 0xaf, 0x1f, 0xaf, 0x28, 0xaf, 0x37, 0x73, 0xe4, 0x73, 0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0x8f, 0xaf, 0x6c, 0xaf, 0x58, 0xaf, 0x48, 0xaf, 0x38, 0xaf, 0x2c, 0xaf, 0x20, 0xaf, 0x17, 0xaf, 0x0f, 0xaf, 0x08, 0xaf, 0x04, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x07, 0xaf, 0x0c, 0xaf, 0x14, 0xaf, 0x1c, 0xaf, 0x28, 0xaf, 0x34, 0x93, 0xc0, 0x93, 0xff, 0x93, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xf4, 0xaf, 0x7f, 0xaf, 0x6b, 0xaf, 0x58, 0xaf, 0x48, 0xaf, 0x38, 0xaf, 0x2b, 0xaf, 0x20, 0xaf, 0x17, 0xaf, 0x0f, 0xaf, 0x08, 0xaf, 0x04, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x07, 0xaf, 0x0c, 0xaf, 0x14, 0xaf, 0x1c, 0xaf, 0x27, 0xaf, 0x34, 0x93, 0x93, 0x93, 0xff, 0x93, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xdb, 0xaf, 0x7c, 0xaf, 0x68, 0xaf, 0x57, 0xaf, 0x47, 0xaf, 0x37, 0xaf, 0x2b, 0xaf, 0x1f, 0xaf, 0x17, 0xaf, 0x0f, 0xaf, 0x08, 0xaf, 0x04, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x07, 0xaf, 0x0c, 0xaf, 0x13, 0xaf, 0x1b, 0xaf, 0x27, 0xaf, 0x33, 0x93, 0x64, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xbf, 0xaf, 0x78, 0xaf, 0x67, 0xaf, 0x54, 0xaf, 0x44, 0xaf, 0x34, 0xaf, 0x28, 0xaf, 0x1f, 0xaf, 0x14, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x04, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x07, 0xaf, 0x0b, 0xaf, 0x13, 0xaf, 0x1b, 0xaf, 0x24, 0xaf, 0x2f, 0xaf, 0x3c, 0x93, 0xdf, 0x93, 0xff, 0x93, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0x9b, 0xaf, 0x74, 0xaf, 0x63, 0xaf, 0x50, 0xaf, 0x40, 0xaf, 0x33, 0xaf, 0x27, 0xaf, 0x1c, 0xaf, 0x13, 0xaf, 0x0c, 0xaf, 0x07, 0xaf, 0x03, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x0b, 0xaf, 0x10, 0xaf, 0x18, 0xaf, 0x20, 0xaf, 0x2c, 0xaf, 0x38, 0x93, 0xa3, 0x93, 0xff, 0x93, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xd4, 0xaf, 0x83, 0xaf, 0x6f, 0xaf, 0x5c, 0xaf, 0x4c, 0xaf, 0x3c, 0xaf, 0x2f, 0xaf, 0x24, 0xaf, 0x1b, 0xaf, 0x13, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x03, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x08, 0xaf, 0x0f, 0xaf, 0x17, 0xaf, 0x1f, 0xaf, 0x28, 0xaf, 0x34, 0xaf, 0x53, 0x93, 0xef, 0x93, 0xff, 0x93, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xb3, 0xaf, 0x7b, 0xaf, 0x68, 0xaf, 0x57, 0xaf, 0x47, 0xaf, 0x38, 0xaf, 0x2c, 0xaf, 0x20, 0xaf, 0x18, 0xaf, 0x10, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x03, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x13, 0xaf, 0x1b, 0xaf, 0x24, 0xaf, 0x30, 0xaf, 0x3c, 0x93, 0x9c, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xd3, 0xaf, 0x83, 0xaf, 0x73, 0xaf, 0x60, 0xaf, 0x50, 0xaf, 0x40, 0xaf, 0x34, 0xaf, 0x28, 0xaf, 0x1f, 0xaf, 0x14, 0xaf, 0x0f, 0xaf, 0x08, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x07, 0xaf, 0x0b, 0xaf, 0x10, 0xaf, 0x18, 0xaf, 0x20, 0xaf, 0x2c, 0xaf, 0x38, 0xaf, 0x44, 0x93, 0xc8, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xf4, 0xaf, 0x93, 0xaf, 0x7b, 0xaf, 0x68, 0xaf, 0x58, 0xaf, 0x48, 0xaf, 0x3b, 0xaf, 0x2f, 0xaf, 0x24, 0xaf, 0x1b, 0xaf, 0x13, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0f, 0xaf, 0x14, 0xaf, 0x1c, 0xaf, 0x27, 0xaf, 0x33, 0xaf, 0x3f, 0xaf, 0x58, 0x93, 0xe3, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xb7, 0xaf, 0x7f, 0xaf, 0x70, 0xaf, 0x60, 0xaf, 0x50, 0xaf, 0x43, 0xaf, 0x34, 0xaf, 0x28, 0xaf, 0x1f, 0xaf, 0x17, 0xaf, 0x10, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x13, 0xaf, 0x18, 0xaf, 0x20, 0xaf, 0x2b, 0xaf, 0x37, 0xaf, 0x44, 0xb3, 0x7b, 0x93, 0xe3, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xc3, 0xaf, 0x83, 0xaf, 0x74, 0xaf, 0x64, 0xaf, 0x57, 0xaf, 0x48, 0xaf, 0x3b, 0xaf, 0x2f, 0xaf, 0x24, 0xaf, 0x1b, 0xaf, 0x14, 0xaf, 0x0f, 0xaf, 0x08, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x14, 0xaf, 0x1c, 0xaf, 0x24, 0xaf, 0x30, 0xaf, 0x3b, 0xaf, 0x48, 0xaf, 0x7c, 0x93, 0xe3, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xd3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xc0, 0xaf, 0x83, 0xaf, 0x77, 0xaf, 0x68, 0xaf, 0x5b, 0xaf, 0x4c, 0xaf, 0x3f, 0xaf, 0x33, 0xaf, 0x28, 0xaf, 0x1f, 0xaf, 0x17, 0xaf, 0x10, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x18, 0xaf, 0x1f, 0xaf, 0x28, 0xaf, 0x33, 0xaf, 0x3f, 0xaf, 0x4b, 0xaf, 0x60, 0x93, 0xcb, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xd7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xd7, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xec, 0xaf, 0xb7, 0xaf, 0x83, 0xaf, 0x74, 0xaf, 0x68, 0xaf, 0x5b, 0xaf, 0x4f, 0xaf, 0x43, 0xaf, 0x37, 0xaf, 0x2b, 0xaf, 0x23, 0xaf, 0x1b, 0xaf, 0x13, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x1b, 0xaf, 0x23, 0xaf, 0x2b, 0xaf, 0x34, 0xaf, 0x40, 0xaf, 0x4c, 0xaf, 0x58, 0xaf, 0xa7, 0xb3, 0xec, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xc8, 0xaf, 0x88, 0xaf, 0x7f, 0xaf, 0x73, 0xaf, 0x67, 0xaf, 0x5b, 0xaf, 0x4f, 0xaf, 0x43, 0xaf, 0x38, 0xaf, 0x2f, 0xaf, 0x24, 0xaf, 0x1c, 0xaf, 0x14, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x14, 0xaf, 0x1c, 0xaf, 0x23, 0xaf, 0x2c, 0xaf, 0x37, 0xaf, 0x40, 0xaf, 0x4b, 0xaf, 0x57, 0xaf, 0x67, 0xaf, 0xb0, 0xb3, 0xe3, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xef, 0xaf, 0xc8, 0xaf, 0x9c, 0xaf, 0x80, 0xaf, 0x78, 0xaf, 0x6f, 0xaf, 0x63, 0xaf, 0x58, 0xaf, 0x4f, 0xaf, 0x43, 0xaf, 0x38, 0xaf, 0x2f, 0xaf, 0x27, 0xaf, 0x1f, 0xaf, 0x17, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x17, 0xaf, 0x1c, 0xaf, 0x24, 0xaf, 0x2c, 0xaf, 0x34, 0xaf, 0x3f, 0xaf, 0x48, 0xaf, 0x53, 0xaf, 0x5b, 0xaf, 0x64, 0xaf, 0x80, 0xaf, 0xa8, 0xaf, 0xcc, 0xaf, 0xe7, 0xaf, 0xf7, 0xaf, 0xfb, 0xaf, 0xf8, 0xaf, 0xec, 0xaf, 0xd8, 0xaf, 0xbc, 0xaf, 0x9f, 0xaf, 0x83, 0xaf, 0x7f, 0xaf, 0x77, 0xaf, 0x6f, 0xaf, 0x67, 0xaf, 0x5f, 0xaf, 0x54, 0xaf, 0x4b, 0xaf, 0x40, 0xaf, 0x38, 0xaf, 0x2f, 0xaf, 0x27, 0xaf, 0x1f, 0xaf, 0x18, 0xaf, 0x13, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x17, 0xaf, 0x1c, 0xaf, 0x23, 0xaf, 0x2b, 0xaf, 0x33, 0xaf, 0x3b, 0xaf, 0x44, 0xaf, 0x4c, 0xaf, 0x54, 0xaf, 0x5c, 0xaf, 0x63, 0xaf, 0x68, 0xaf, 0x6f, 0xaf, 0x73, 0xaf, 0x77, 0xaf, 0x78, 0xaf, 0x78, 0xaf, 0x78, 0xaf, 0x77, 0xaf, 0x74, 0xaf, 0x70, 0xaf, 0x6b, 0xaf, 0x64, 0xaf, 0x5f, 0xaf, 0x57, 0xaf, 0x4f, 0xaf, 0x47, 0xaf, 0x3f, 0xaf, 0x34, 0xaf, 0x2c, 0xaf, 0x24, 0xaf, 0x1f, 0xaf, 0x18, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x23, 0xaf, 0x28, 0xaf, 0x2f, 0xaf, 0x37, 0xaf, 0x3f, 0xaf, 0x44, 0xaf, 0x4c, 0xaf, 0x53, 0xaf, 0x57, 0xaf, 0x5c, 0xaf, 0x60, 0xaf, 0x63, 0xaf, 0x64, 0xaf, 0x64, 0xaf, 0x64, 0xaf, 0x64, 0xaf, 0x60, 0xaf, 0x5c, 0xaf, 0x58, 0xaf, 0x53, 0xaf, 0x4c, 0xaf, 0x47, 0xaf, 0x40, 0xaf, 0x38, 0xaf, 0x30, 0xaf, 0x2b, 0xaf, 0x24, 0xaf, 0x1c, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x1b, 0xaf, 0x1f, 0xaf, 0x24, 0xaf, 0x2b, 0xaf, 0x30, 0xaf, 0x37, 0xaf, 0x3c, 0xaf, 0x43, 0xaf, 0x47, 0xaf, 0x4b, 0xaf, 0x4f, 0xaf, 0x50, 0xaf, 0x53, 0xaf, 0x53, 0xaf, 0x53, 0xaf, 0x53, 0xaf, 0x4f, 0xaf, 0x4c, 0xaf, 0x48, 0xaf, 0x44, 0xaf, 0x3f, 0xaf, 0x38, 0xaf, 0x33, 0xaf, 0x2c, 0xaf, 0x27, 0xaf, 0x20, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x27, 0xaf, 0x2b, 0xaf, 0x30, 0xaf, 0x34, 0xaf, 0x38, 0xaf, 0x3c, 0xaf, 0x3f, 0xaf, 0x40, 0xaf, 0x43, 0xaf, 0x43, 0xaf, 0x43, 0xaf, 0x43, 0xaf, 0x40, 0xaf, 0x3c, 0xaf, 0x3b, 0xaf, 0x37, 0xaf, 0x30, 0xaf, 0x2c, 0xaf, 0x28, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x24, 0xaf, 0x28, 0xaf, 0x2c, 0xaf, 0x2f, 0xaf, 0x30, 0xaf, 0x33, 0xaf, 0x34, 0xaf, 0x34, 0xaf, 0x34, 0xaf, 0x33, 0xaf, 0x33, 0xaf, 0x2f, 0xaf, 0x2c, 0xaf, 0x28, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1b, 0xaf, 0x1f, 0xaf, 0x20, 0xaf, 0x23, 0xaf, 0x24, 0xaf, 0x27, 0xaf, 0x28, 0xaf, 0x28, 0xaf, 0x28, 0xaf, 0x27, 0xaf, 0x27, 0xaf, 0x24, 0xaf, 0x20, 0xaf, 0x1f, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x1b, 0xaf, 0x1c, 0xaf, 0x1c, 0xaf, 0x1c, 0xaf, 0x1c, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2c, 0x5e, 0xa3, 0x34, 0xfe, 0x83, 0x57, 0x3f, 0x7c, 0x70, 0x3f, 0x7c, 0x7b, 0x1f, 0x7c, 0x74, 0xfe, 0x83, 0x63, 0x7e, 0x9b, 0x44, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x2b, 0x1f, 0x7c, 0x5f, 0x7f, 0x74, 0x97, 0x9f, 0x6c, 0xd4, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x74, 0xdc, 0x3f, 0x7c, 0xa8, 0xfe, 0x83, 0x7c, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x28, 0x7f, 0x74, 0x83, 0x9f, 0x64, 0xd3, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0x5f, 0x74, 0xdf, 0x1f, 0x84, 0x9b, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x24, 0x1f, 0x84, 0x53, 0x9f, 0x6c, 0xbf, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0xbf, 0x6c, 0xff, 0x1f, 0x85, 0xff, 0x9f, 0x95, 0xff, 0xbf, 0x9d, 0xff, 0x9f, 0x9d, 0xff, 0x3f, 0x8d, 0xff, 0x9f, 0x74, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x7c, 0xdb, 0xfe, 0x83, 0x8f, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x27, 0x7f, 0x74, 0x84, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xdf, 0x9d, 0xff, 0xff, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xe7, 0xff, 0xff, 0xb5, 0xff, 0x9f, 0x7c, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x7c, 0xff, 0x1e, 0x84, 0xb7, 0x3e, 0xab, 0x4b, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x27, 0x9f, 0x6c, 0xa3, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x3f, 0xae, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0x7e, 0xe7, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x5e, 0xe7, 0xff, 0x9f, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xbe, 0xff, 0x5f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x1e, 0x84, 0xc8, 0x3e, 0xab, 0x50, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x27, 0x7f, 0x6c, 0xa0, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x7f, 0x8d, 0xff, 0xdf, 0xce, 0xff, 0xbf, 0xf7, 0xff, 0x3e, 0xe7, 0xff, 0x1d, 0xd7, 0xff, 0xfd, 0xd6, 0xff, 0xdc, 0xce, 0xff, 0xdc, 0xce, 0xff, 0xdc, 0xce, 0xff, 0xdc, 0xce, 0xff, 0xdc, 0xce, 0xff, 0xdc, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xfd, 0xd6, 0xff, 0x1d, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xb5, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0xfe, 0x83, 0xcb, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x24, 0x5f, 0x74, 0x7f, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0xff, 0xa5, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xef, 0xff, 0x1d, 0xdf, 0xff, 0xfd, 0xd6, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xfd, 0xd6, 0xff, 0x1d, 0xdf, 0xff, 0x5e, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xbe, 0xff, 0x1f, 0x7c, 0xff, 0x1f, 0x84, 0xff, 0x1f, 0x84, 0xff, 0xde, 0x8b, 0xb8, 0x3e, 0xab, 0x54, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x23, 0xde, 0x8b, 0x40, 0x9f, 0x64, 0xf0, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0xff, 0xa5, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xe7, 0xff, 0x1d, 0xd7, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0x1d, 0xdf, 0xff, 0x3e, 0xe7, 0xff, 0xdf, 0xff, 0xff, 0x1f, 0xc6, 0xff, 0x1f, 0x84, 0xff, 0x1e, 0x84, 0xff, 0xfe, 0x83, 0xff, 0xbe, 0x93, 0x9b, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x28, 0x7f, 0x6c, 0xa8, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x3f, 0x85, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xe7, 0xff, 0x1d, 0xdf, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0x3d, 0xdf, 0xff, 0x5e, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xb5, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xde, 0x8b, 0xe3, 0x3e, 0xab, 0x5f, 0x3e, 0xab, 0x50, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x24, 0x3f, 0x7c, 0x67, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0xc6, 0xff, 0x9f, 0xef, 0xff, 0x1d, 0xdf, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0x1d, 0xd7, 0xff, 0x3e, 0xdf, 0xff, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0x3e, 0x8c, 0xff, 0xfe, 0x8b, 0xff, 0xfe, 0x8b, 0xff, 0xbe, 0x93, 0xaf, 0x3e, 0xab, 0x5b, 0x3e, 0xab, 0x4b, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x28, 0x7f, 0x6c, 0x9f, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0xbf, 0x9d, 0xff, 0xdf, 0xff, 0xff, 0x3e, 0xe7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xdf, 0xff, 0x5e, 0xe7, 0xff, 0xbf, 0xf7, 0xff, 0x1f, 0xc6, 0xff, 0xfe, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xe4, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x54, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x23, 0x7e, 0xa3, 0x33, 0x9f, 0x64, 0xf0, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x1f, 0xdf, 0xff, 0x7e, 0xef, 0xff, 0x3d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x5b, 0xc6, 0xff, 0x71, 0x6b, 0xff, 0x30, 0x63, 0xff, 0xb9, 0xb5, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x3a, 0xbe, 0xff, 0x51, 0x6b, 0xff, 0x30, 0x6b, 0xff, 0xd9, 0xb5, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x7e, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x94, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0x7e, 0x9b, 0x94, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x27, 0x1f, 0x7c, 0x6b, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x1f, 0x85, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xe7, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0xd2, 0x7b, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xef, 0x62, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x92, 0x73, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x30, 0x63, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x5e, 0xe7, 0xff, 0xdf, 0xf7, 0xff, 0x7f, 0xbd, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0x9e, 0x9b, 0xbb, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x2b, 0x5f, 0x74, 0x9c, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x3f, 0xb6, 0xff, 0xbf, 0xf7, 0xff, 0x5e, 0xe7, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x50, 0x6b, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x0f, 0x63, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xaf, 0x5a, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x5e, 0xe7, 0xff, 0x9f, 0xef, 0xff, 0xff, 0xe6, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xe3, 0x3e, 0xab, 0x6b, 0x3e, 0xab, 0x58, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x2f, 0x7f, 0x6c, 0xcf, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x1f, 0xdf, 0xff, 0x9f, 0xef, 0xff, 0x5e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x50, 0x6b, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x0f, 0x63, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xaf, 0x5a, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xde, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x5e, 0xab, 0x74, 0x3e, 0xab, 0x5f, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x30, 0x7f, 0x6c, 0xf0, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0xbf, 0xf7, 0xff, 0x9e, 0xef, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x50, 0x6b, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x0f, 0x63, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xaf, 0x5a, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xa4, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x5e, 0xa3, 0x8c, 0x3e, 0xab, 0x63, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x27, 0x5e, 0xa3, 0x34, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xef, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x50, 0x6b, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x0f, 0x63, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xaf, 0x5a, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x7e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xb4, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x7e, 0xa3, 0x9c, 0x3e, 0xab, 0x67, 0x3e, 0xab, 0x54, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x28, 0x7e, 0x9b, 0x3f, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x9f, 0x74, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xef, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x50, 0x6b, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x10, 0x63, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xaf, 0x5a, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xef, 0xff, 0x9f, 0xef, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xb4, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0xa3, 0xa3, 0x3e, 0xab, 0x6b, 0x3e, 0xab, 0x57, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x34, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xf7, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x51, 0x6b, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x10, 0x63, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xaf, 0x5a, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xb4, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x5e, 0xa3, 0x9c, 0x3e, 0xab, 0x6b, 0x3e, 0xab, 0x58, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x37, 0x5f, 0x74, 0xe4, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x7f, 0xef, 0xff, 0xbf, 0xf7, 0xff, 0x9f, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x51, 0x6b, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x10, 0x63, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xcf, 0x5a, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9f, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x1e, 0xa4, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x5e, 0xa3, 0x8f, 0x3e, 0xab, 0x6c, 0x3e, 0xab, 0x58, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x34, 0x3f, 0x7c, 0xc0, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0xbf, 0xd6, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x51, 0x6b, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x10, 0x63, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xcf, 0x5a, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x9f, 0xff, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xf4, 0x3e, 0xab, 0x7f, 0x3e, 0xab, 0x6b, 0x3e, 0xab, 0x58, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x34, 0x1f, 0x84, 0x93, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0xbf, 0xad, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x51, 0x6b, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x10, 0x63, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xcf, 0x5a, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0x5f, 0xde, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xdb, 0x3e, 0xab, 0x7c, 0x3e, 0xab, 0x68, 0x3e, 0xab, 0x57, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x33, 0xbe, 0x93, 0x64, 0x3f, 0x74, 0xff, 0x3f, 0x7c, 0xff, 0x7f, 0x84, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x91, 0x73, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x8e, 0x52, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x50, 0x6b, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xcf, 0x5a, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xbc, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x5e, 0xa3, 0xbf, 0x3e, 0xab, 0x78, 0x3e, 0xab, 0x67, 0x3e, 0xab, 0x54, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x3c, 0x3f, 0x7c, 0xdf, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x5f, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x37, 0xad, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x54, 0x8c, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x16, 0xa5, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x94, 0x94, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x1f, 0xef, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0x9b, 0x3e, 0xab, 0x74, 0x3e, 0xab, 0x63, 0x3e, 0xab, 0x50, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x38, 0xfe, 0x83, 0xa3, 0x3f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0xbf, 0x94, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x7b, 0xd6, 0xff, 0x3a, 0xc6, 0xff, 0xbf, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x7b, 0xce, 0xff, 0x3a, 0xce, 0xff, 0xbf, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xc5, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xd4, 0x3e, 0xab, 0x83, 0x3e, 0xab, 0x6f, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x34, 0x7e, 0x9b, 0x53, 0x1f, 0x84, 0xef, 0x1f, 0x7c, 0xff, 0x1f, 0x84, 0xff, 0x1f, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xde, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xb3, 0x3e, 0xab, 0x7b, 0x3e, 0xab, 0x68, 0x3e, 0xab, 0x57, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x3c, 0xde, 0x8b, 0x9c, 0x1f, 0x84, 0xff, 0x1f, 0x84, 0xff, 0xfe, 0x83, 0xff, 0x5f, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1e, 0xac, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xd3, 0x3e, 0xab, 0x83, 0x3e, 0xab, 0x73, 0x3e, 0xab, 0x60, 0x3e, 0xab, 0x50, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x44, 0xfe, 0x8b, 0xc8, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0x3f, 0x8c, 0xff, 0x5f, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xbc, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xf4, 0x3e, 0xab, 0x93, 0x3e, 0xab, 0x7b, 0x3e, 0xab, 0x68, 0x3e, 0xab, 0x58, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x3f, 0x7e, 0xa3, 0x58, 0xfe, 0x8b, 0xe3, 0xfe, 0x83, 0xff, 0xfe, 0x8b, 0xff, 0x1f, 0x94, 0xff, 0x5f, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xbc, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xb7, 0x3e, 0xab, 0x7f, 0x3e, 0xab, 0x70, 0x3e, 0xab, 0x60, 0x3e, 0xab, 0x50, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x44, 0x9e, 0x9b, 0x7b, 0xde, 0x8b, 0xe3, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xdf, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xbe, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xc3, 0x3e, 0xab, 0x83, 0x3e, 0xab, 0x74, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x57, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x48, 0x9e, 0x9b, 0x7c, 0xde, 0x8b, 0xe3, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xbe, 0x93, 0xff, 0x3e, 0x9c, 0xff, 0xff, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xde, 0xff, 0x7f, 0xb4, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xc0, 0x3e, 0xab, 0x83, 0x3e, 0xab, 0x77, 0x3e, 0xab, 0x68, 0x3e, 0xab, 0x5b, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x4b, 0x5e, 0xa3, 0x60, 0xbe, 0x93, 0xcb, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xde, 0x9b, 0xff, 0x1f, 0xbd, 0xff, 0x5f, 0xde, 0xff, 0x1f, 0xef, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x5f, 0xf7, 0xff, 0x7f, 0xe6, 0xff, 0x5f, 0xcd, 0xff, 0xde, 0xab, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xec, 0x5e, 0xa3, 0xb7, 0x3e, 0xab, 0x83, 0x3e, 0xab, 0x74, 0x3e, 0xab, 0x68, 0x3e, 0xab, 0x5b, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x58, 0x9e, 0x9b, 0xa7, 0xbe, 0x93, 0xec, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xc8, 0x3e, 0xab, 0x88, 0x3e, 0xab, 0x7f, 0x3e, 0xab, 0x73, 0x3e, 0xab, 0x67, 0x3e, 0xab, 0x5b, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x4b, 0x3e, 0xab, 0x57, 0x5e, 0xa3, 0x67, 0x7e, 0x9b, 0xb0, 0x9e, 0x9b, 0xe3, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xef, 0x5e, 0xa3, 0xc8, 0x5e, 0xab, 0x9c, 0x3e, 0xab, 0x80, 0x3e, 0xab, 0x78, 0x3e, 0xab, 0x6f, 0x3e, 0xab, 0x63, 0x3e, 0xab, 0x58, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x5b, 0x3e, 0xab, 0x64, 0x5e, 0xa3, 0x80, 0x7e, 0xa3, 0xa8, 0x7e, 0x9b, 0xcc, 0x7e, 0x9b, 0xe7, 0x7e, 0x9b, 0xf7, 0x7e, 0x9b, 0xfb, 0x7e, 0xa3, 0xf8, 0x7e, 0xa3, 0xec, 0x5e, 0xa3, 0xd8, 0x5e, 0xa3, 0xbc, 0x5e, 0xa3, 0x9f, 0x3e, 0xab, 0x83, 0x3e, 0xab, 0x7f, 0x3e, 0xab, 0x77, 0x3e, 0xab, 0x6f, 0x3e, 0xab, 0x67, 0x3e, 0xab, 0x5f, 0x3e, 0xab, 0x54, 0x3e, 0xab, 0x4b, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x54, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x63, 0x3e, 0xab, 0x68, 0x3e, 0xab, 0x6f, 0x3e, 0xab, 0x73, 0x3e, 0xab, 0x77, 0x3e, 0xab, 0x78, 0x3e, 0xab, 0x78, 0x3e, 0xab, 0x78, 0x3e, 0xab, 0x77, 0x3e, 0xab, 0x74, 0x3e, 0xab, 0x70, 0x3e, 0xab, 0x6b, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x5f, 0x3e, 0xab, 0x57, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x57, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x60, 0x3e, 0xab, 0x63, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x60, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x58, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x4b, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x50, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2c, 0xa3, 0x5e, 0x34, 0x83, 0xfe, 0x57, 0x7c, 0x3f, 0x70, 0x7c, 0x3f, 0x7b, 0x7c, 0x1f, 0x74, 0x83, 0xfe, 0x63, 0x9b, 0x7e, 0x44, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x2b, 0x7c, 0x1f, 0x5f, 0x74, 0x7f, 0x97, 0x6c, 0x9f, 0xd4, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x74, 0x7f, 0xdc, 0x7c, 0x3f, 0xa8, 0x83, 0xfe, 0x7c, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x28, 0x74, 0x7f, 0x83, 0x64, 0x9f, 0xd3, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x5f, 0xdf, 0x84, 0x1f, 0x9b, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x24, 0x84, 0x1f, 0x53, 0x6c, 0x9f, 0xbf, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0xbf, 0xff, 0x85, 0x1f, 0xff, 0x95, 0x9f, 0xff, 0x9d, 0xbf, 0xff, 0x9d, 0x9f, 0xff, 0x8d, 0x3f, 0xff, 0x74, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x7c, 0x3f, 0xdb, 0x83, 0xfe, 0x8f, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x27, 0x74, 0x7f, 0x84, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x64, 0xbf, 0xff, 0x9d, 0xdf, 0xff, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3f, 0xff, 0xb5, 0xff, 0xff, 0x7c, 0x9f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x7c, 0x3f, 0xff, 0x84, 0x1e, 0xb7, 0xab, 0x3e, 0x4b, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x27, 0x6c, 0x9f, 0xa3, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0xae, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0xff, 0xe7, 0x7e, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xe7, 0x5e, 0xff, 0xf7, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x3f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x84, 0x1e, 0xc8, 0xab, 0x3e, 0x50, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x27, 0x6c, 0x7f, 0xa0, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x8d, 0x7f, 0xff, 0xce, 0xdf, 0xff, 0xf7, 0xbf, 0xff, 0xe7, 0x3e, 0xff, 0xd7, 0x1d, 0xff, 0xd6, 0xfd, 0xff, 0xce, 0xdc, 0xff, 0xce, 0xdc, 0xff, 0xce, 0xdc, 0xff, 0xce, 0xdc, 0xff, 0xce, 0xdc, 0xff, 0xce, 0xdc, 0xff, 0xce, 0xdd, 0xff, 0xd6, 0xfd, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x3e, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xb5, 0xbf, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x1f, 0xff, 0x83, 0xfe, 0xcb, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x24, 0x74, 0x5f, 0x7f, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7e, 0xff, 0xdf, 0x1d, 0xff, 0xd6, 0xfd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xd6, 0xfd, 0xff, 0xdf, 0x1d, 0xff, 0xe7, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x1f, 0xff, 0x7c, 0x1f, 0xff, 0x84, 0x1f, 0xff, 0x84, 0x1f, 0xff, 0x8b, 0xde, 0xb8, 0xab, 0x3e, 0x54, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x23, 0x8b, 0xde, 0x40, 0x64, 0x9f, 0xf0, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x5e, 0xff, 0xd7, 0x1d, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xfd, 0xff, 0xdf, 0x1d, 0xff, 0xe7, 0x3e, 0xff, 0xff, 0xdf, 0xff, 0xc6, 0x1f, 0xff, 0x84, 0x1f, 0xff, 0x84, 0x1e, 0xff, 0x83, 0xfe, 0xff, 0x93, 0xbe, 0x9b, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x28, 0x6c, 0x7f, 0xa8, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x85, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x7e, 0xff, 0xdf, 0x1d, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xdf, 0x3d, 0xff, 0xe7, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x9f, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x8b, 0xde, 0xe3, 0xab, 0x3e, 0x5f, 0xab, 0x3e, 0x50, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x24, 0x7c, 0x3f, 0x67, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0xc6, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xdf, 0x1d, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd7, 0x1d, 0xff, 0xdf, 0x3e, 0xff, 0xef, 0x7e, 0xff, 0xff, 0xff, 0xff, 0x8c, 0x3e, 0xff, 0x8b, 0xfe, 0xff, 0x8b, 0xfe, 0xff, 0x93, 0xbe, 0xaf, 0xab, 0x3e, 0x5b, 0xab, 0x3e, 0x4b, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x28, 0x6c, 0x7f, 0x9f, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x9d, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xe7, 0x3e, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xe7, 0x5e, 0xff, 0xf7, 0xbf, 0xff, 0xc6, 0x1f, 0xff, 0x8b, 0xfe, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xe4, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x54, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x23, 0xa3, 0x7e, 0x33, 0x64, 0x9f, 0xf0, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0xdf, 0x1f, 0xff, 0xef, 0x7e, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xc6, 0x5b, 0xff, 0x6b, 0x71, 0xff, 0x63, 0x30, 0xff, 0xb5, 0xb9, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xbe, 0x3a, 0xff, 0x6b, 0x51, 0xff, 0x6b, 0x30, 0xff, 0xb5, 0xd9, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x3e, 0xff, 0xe7, 0x7e, 0xff, 0xff, 0xff, 0xff, 0x94, 0x1f, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x9b, 0x7e, 0x94, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x27, 0x7c, 0x1f, 0x6b, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x85, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x5e, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0x7b, 0xd2, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x62, 0xef, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0x73, 0x92, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x63, 0x30, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x3e, 0xff, 0xe7, 0x5e, 0xff, 0xf7, 0xdf, 0xff, 0xbd, 0x7f, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x9b, 0x9e, 0xbb, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x2b, 0x74, 0x5f, 0x9c, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0xb6, 0x3f, 0xff, 0xf7, 0xbf, 0xff, 0xe7, 0x5e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0x6b, 0x50, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0x63, 0x0f, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x5a, 0xaf, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xe7, 0x5e, 0xff, 0xef, 0x9f, 0xff, 0xe6, 0xff, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xe3, 0xab, 0x3e, 0x6b, 0xab, 0x3e, 0x58, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x2f, 0x6c, 0x7f, 0xcf, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0xdf, 0x1f, 0xff, 0xef, 0x9f, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0x6b, 0x50, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0x63, 0x0f, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x5a, 0xaf, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x5e, 0xff, 0xef, 0x7e, 0xff, 0xff, 0xff, 0xff, 0x93, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0xab, 0x5e, 0x74, 0xab, 0x3e, 0x5f, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x30, 0x6c, 0x7f, 0xf0, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0xf7, 0xbf, 0xff, 0xef, 0x9e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0x6b, 0x50, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0x63, 0x0f, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x5a, 0xaf, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x5f, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0xa3, 0x5e, 0x8c, 0xab, 0x3e, 0x63, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x27, 0xa3, 0x5e, 0x34, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xef, 0x9e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0x6b, 0x50, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0x63, 0x0f, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x5a, 0xaf, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xb4, 0xbf, 0xff, 0x93, 0x9e, 0xff, 0x93, 0x9e, 0xff, 0xa3, 0x7e, 0x9c, 0xab, 0x3e, 0x67, 0xab, 0x3e, 0x54, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x28, 0x9b, 0x7e, 0x3f, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xef, 0x9f, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0x6b, 0x50, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0x63, 0x10, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x5a, 0xaf, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xb4, 0xdf, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0xa3, 0x7e, 0xa3, 0xab, 0x3e, 0x6b, 0xab, 0x3e, 0x57, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x34, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9f, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0x6b, 0x51, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0x63, 0x10, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x5a, 0xaf, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x9f, 0xff, 0xf7, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x9f, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0xa3, 0x5e, 0x9c, 0xab, 0x3e, 0x6b, 0xab, 0x3e, 0x58, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x37, 0x74, 0x5f, 0xe4, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0xef, 0x7f, 0xff, 0xf7, 0xbf, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0x6b, 0x51, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0x63, 0x10, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x5a, 0xcf, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xf7, 0x9f, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x1e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0xa3, 0x5e, 0x8f, 0xab, 0x3e, 0x6c, 0xab, 0x3e, 0x58, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x34, 0x7c, 0x3f, 0xc0, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0xd6, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0xbf, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0x6b, 0x51, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0x63, 0x10, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x5a, 0xcf, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xf7, 0x9f, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0x9f, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xf4, 0xab, 0x3e, 0x7f, 0xab, 0x3e, 0x6b, 0xab, 0x3e, 0x58, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x34, 0x84, 0x1f, 0x93, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0xad, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0x6b, 0x51, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0x63, 0x10, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x5a, 0xcf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xde, 0x5f, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xdb, 0xab, 0x3e, 0x7c, 0xab, 0x3e, 0x68, 0xab, 0x3e, 0x57, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x33, 0x93, 0xbe, 0x64, 0x74, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x84, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0x73, 0x91, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x8e, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0x6b, 0x50, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x5a, 0xcf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xbf, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x5e, 0xbf, 0xab, 0x3e, 0x78, 0xab, 0x3e, 0x67, 0xab, 0x3e, 0x54, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x3c, 0x7c, 0x3f, 0xdf, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0xc6, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xad, 0x37, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x8c, 0x54, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xa5, 0x16, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x94, 0x94, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xef, 0x1f, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0x9b, 0xab, 0x3e, 0x74, 0xab, 0x3e, 0x63, 0xab, 0x3e, 0x50, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x38, 0x83, 0xfe, 0xa3, 0x7c, 0x3f, 0xff, 0x7c, 0x1f, 0xff, 0x94, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xd6, 0x7b, 0xff, 0xc6, 0x3a, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xce, 0x7b, 0xff, 0xce, 0x3a, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xc5, 0x3f, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xd4, 0xab, 0x3e, 0x83, 0xab, 0x3e, 0x6f, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x34, 0x9b, 0x7e, 0x53, 0x84, 0x1f, 0xef, 0x7c, 0x1f, 0xff, 0x84, 0x1f, 0xff, 0xc6, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0x1f, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xb3, 0xab, 0x3e, 0x7b, 0xab, 0x3e, 0x68, 0xab, 0x3e, 0x57, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x3c, 0x8b, 0xde, 0x9c, 0x84, 0x1f, 0xff, 0x84, 0x1f, 0xff, 0x83, 0xfe, 0xff, 0xce, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xac, 0x1e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xd3, 0xab, 0x3e, 0x83, 0xab, 0x3e, 0x73, 0xab, 0x3e, 0x60, 0xab, 0x3e, 0x50, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x44, 0x8b, 0xfe, 0xc8, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x8c, 0x3f, 0xff, 0xd6, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xbf, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xf4, 0xab, 0x3e, 0x93, 0xab, 0x3e, 0x7b, 0xab, 0x3e, 0x68, 0xab, 0x3e, 0x58, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x3f, 0xa3, 0x7e, 0x58, 0x8b, 0xfe, 0xe3, 0x83, 0xfe, 0xff, 0x8b, 0xfe, 0xff, 0x94, 0x1f, 0xff, 0xd6, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x9f, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xb7, 0xab, 0x3e, 0x7f, 0xab, 0x3e, 0x70, 0xab, 0x3e, 0x60, 0xab, 0x3e, 0x50, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x44, 0x9b, 0x9e, 0x7b, 0x8b, 0xde, 0xe3, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0xc5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0xff, 0xa3, 0xbe, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xc3, 0xab, 0x3e, 0x83, 0xab, 0x3e, 0x74, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x57, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x48, 0x9b, 0x9e, 0x7c, 0x8b, 0xde, 0xe3, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x9c, 0x3e, 0xff, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0x5f, 0xff, 0xb4, 0x7f, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xc0, 0xab, 0x3e, 0x83, 0xab, 0x3e, 0x77, 0xab, 0x3e, 0x68, 0xab, 0x3e, 0x5b, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x4b, 0xa3, 0x5e, 0x60, 0x93, 0xbe, 0xcb, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x9b, 0xde, 0xff, 0xbd, 0x1f, 0xff, 0xde, 0x5f, 0xff, 0xef, 0x1f, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xf7, 0x5f, 0xff, 0xe6, 0x7f, 0xff, 0xcd, 0x5f, 0xff, 0xab, 0xde, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xec, 0xa3, 0x5e, 0xb7, 0xab, 0x3e, 0x83, 0xab, 0x3e, 0x74, 0xab, 0x3e, 0x68, 0xab, 0x3e, 0x5b, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x58, 0x9b, 0x9e, 0xa7, 0x93, 0xbe, 0xec, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xc8, 0xab, 0x3e, 0x88, 0xab, 0x3e, 0x7f, 0xab, 0x3e, 0x73, 0xab, 0x3e, 0x67, 0xab, 0x3e, 0x5b, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x4b, 0xab, 0x3e, 0x57, 0xa3, 0x5e, 0x67, 0x9b, 0x7e, 0xb0, 0x9b, 0x9e, 0xe3, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xef, 0xa3, 0x5e, 0xc8, 0xab, 0x5e, 0x9c, 0xab, 0x3e, 0x80, 0xab, 0x3e, 0x78, 0xab, 0x3e, 0x6f, 0xab, 0x3e, 0x63, 0xab, 0x3e, 0x58, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x5b, 0xab, 0x3e, 0x64, 0xa3, 0x5e, 0x80, 0xa3, 0x7e, 0xa8, 0x9b, 0x7e, 0xcc, 0x9b, 0x7e, 0xe7, 0x9b, 0x7e, 0xf7, 0x9b, 0x7e, 0xfb, 0xa3, 0x7e, 0xf8, 0xa3, 0x7e, 0xec, 0xa3, 0x5e, 0xd8, 0xa3, 0x5e, 0xbc, 0xa3, 0x5e, 0x9f, 0xab, 0x3e, 0x83, 0xab, 0x3e, 0x7f, 0xab, 0x3e, 0x77, 0xab, 0x3e, 0x6f, 0xab, 0x3e, 0x67, 0xab, 0x3e, 0x5f, 0xab, 0x3e, 0x54, 0xab, 0x3e, 0x4b, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x54, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x63, 0xab, 0x3e, 0x68, 0xab, 0x3e, 0x6f, 0xab, 0x3e, 0x73, 0xab, 0x3e, 0x77, 0xab, 0x3e, 0x78, 0xab, 0x3e, 0x78, 0xab, 0x3e, 0x78, 0xab, 0x3e, 0x77, 0xab, 0x3e, 0x74, 0xab, 0x3e, 0x70, 0xab, 0x3e, 0x6b, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x5f, 0xab, 0x3e, 0x57, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x57, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x60, 0xab, 0x3e, 0x63, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x60, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x58, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x4b, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x50, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 32
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2c, 0xf2, 0x6a, 0x9f, 0x34, 0xf4, 0x7d, 0x83, 0x57, 0xf5, 0x83, 0x7a, 0x70, 0xf5, 0x84, 0x77, 0x7b, 0xf5, 0x82, 0x7b, 0x74, 0xf4, 0x7c, 0x84, 0x63, 0xf2, 0x6e, 0x9a, 0x44, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2b, 0xf5, 0x82, 0x7b, 0x5f, 0xf6, 0x8c, 0x6d, 0x97, 0xf7, 0x90, 0x65, 0xd4, 0xf7, 0x92, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x91, 0x63, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf7, 0x90, 0x65, 0xff, 0xf7, 0x8f, 0x67, 0xff, 0xf7, 0x8f, 0x68, 0xff, 0xf7, 0x8b, 0x6d, 0xdc, 0xf5, 0x86, 0x75, 0xa8, 0xf4, 0x7e, 0x81, 0x7c, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x28, 0xf6, 0x8b, 0x6e, 0x83, 0xf7, 0x91, 0x63, 0xd3, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf7, 0x90, 0x65, 0xff, 0xf7, 0x90, 0x66, 0xff, 0xf7, 0x8f, 0x67, 0xff, 0xf7, 0x8e, 0x68, 0xff, 0xf7, 0x8e, 0x69, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8c, 0x6b, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x89, 0x72, 0xdf, 0xf5, 0x81, 0x7d, 0x9b, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x24, 0xf5, 0x81, 0x7d, 0x53, 0xf6, 0x90, 0x65, 0xbf, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x91, 0x63, 0xff, 0xf7, 0x93, 0x67, 0xff, 0xf8, 0xa2, 0x7e, 0xff, 0xf9, 0xaf, 0x91, 0xff, 0xfa, 0xb4, 0x9a, 0xff, 0xf9, 0xb0, 0x95, 0xff, 0xf8, 0xa4, 0x88, 0xff, 0xf6, 0x92, 0x72, 0xff, 0xf6, 0x8c, 0x6c, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x8a, 0x6e, 0xff, 0xf6, 0x89, 0x6f, 0xff, 0xf6, 0x89, 0x71, 0xff, 0xf6, 0x85, 0x76, 0xdb, 0xf4, 0x7c, 0x84, 0x8f, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x27, 0xf7, 0x8b, 0x6d, 0x84, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x94, 0x64, 0xff, 0xfa, 0xb7, 0x98, 0xff, 0xfd, 0xde, 0xd0, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf8, 0xf5, 0xf2, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfd, 0xe5, 0xde, 0xff, 0xfa, 0xbd, 0xae, 0xff, 0xf6, 0x8f, 0x77, 0xff, 0xf6, 0x88, 0x71, 0xff, 0xf6, 0x88, 0x72, 0xff, 0xf6, 0x87, 0x74, 0xff, 0xf5, 0x86, 0x75, 0xff, 0xf4, 0x7f, 0x7f, 0xb7, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x27, 0xf7, 0x8f, 0x67, 0xa3, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xfb, 0xc4, 0xab, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf9, 0xf5, 0xf1, 0xff, 0xf1, 0xeb, 0xe3, 0xff, 0xec, 0xe2, 0xd8, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd4, 0xff, 0xea, 0xe0, 0xd4, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xeb, 0xe1, 0xd5, 0xff, 0xeb, 0xe1, 0xd7, 0xff, 0xf0, 0xe9, 0xe0, 0xff, 0xf7, 0xf2, 0xee, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfb, 0xc4, 0xba, 0xff, 0xf6, 0x89, 0x77, 0xff, 0xf5, 0x86, 0x75, 0xff, 0xf5, 0x85, 0x77, 0xff, 0xf5, 0x84, 0x78, 0xff, 0xf4, 0x7f, 0x80, 0xc8, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x27, 0xf6, 0x8e, 0x69, 0xa0, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf9, 0xad, 0x88, 0xff, 0xfc, 0xd9, 0xc9, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe4, 0xd9, 0xcb, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe7, 0xdd, 0xd1, 0xff, 0xea, 0xe1, 0xd6, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xf9, 0xb6, 0xad, 0xff, 0xf5, 0x84, 0x78, 0xff, 0xf5, 0x83, 0x7a, 0xff, 0xf5, 0x82, 0x7b, 0xff, 0xf4, 0x7d, 0x82, 0xcb, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x24, 0xf6, 0x89, 0x6f, 0x7f, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xfa, 0xbb, 0x9e, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xf3, 0xed, 0xe6, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xe7, 0xdc, 0xce, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe6, 0xda, 0xcc, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xf0, 0xe9, 0xe0, 0xff, 0xfc, 0xfb, 0xfa, 0xff, 0xfa, 0xc1, 0xbc, 0xff, 0xf5, 0x82, 0x7b, 0xff, 0xf5, 0x81, 0x7d, 0xff, 0xf5, 0x80, 0x7e, 0xff, 0xf4, 0x79, 0x88, 0xb8, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x23, 0xf3, 0x79, 0x88, 0x40, 0xf7, 0x92, 0x61, 0xf0, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xfa, 0xbb, 0x9d, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xf1, 0xea, 0xe2, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe7, 0xdc, 0xd0, 0xff, 0xec, 0xe2, 0xd8, 0xff, 0xef, 0xe6, 0xde, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xfa, 0xc1, 0xbf, 0xff, 0xf5, 0x80, 0x7e, 0xff, 0xf4, 0x7f, 0x80, 0xff, 0xf4, 0x7e, 0x81, 0xff, 0xf3, 0x74, 0x90, 0x9b, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x28, 0xf6, 0x8d, 0x69, 0xa8, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf8, 0xa3, 0x7d, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xf1, 0xeb, 0xe4, 0xff, 0xea, 0xe1, 0xd5, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe8, 0xde, 0xd1, 0xff, 0xec, 0xe4, 0xd9, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xf8, 0xb0, 0xb1, 0xff, 0xf4, 0x7e, 0x82, 0xff, 0xf4, 0x7d, 0x83, 0xff, 0xf4, 0x7a, 0x87, 0xe3, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x24, 0xf5, 0x84, 0x78, 0x67, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xfc, 0xd1, 0xbf, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xeb, 0xe2, 0xd7, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xf1, 0xeb, 0xe5, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf4, 0x83, 0x88, 0xff, 0xf4, 0x7c, 0x85, 0xff, 0xf4, 0x7b, 0x86, 0xff, 0xf3, 0x73, 0x91, 0xaf, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x28, 0xf6, 0x8b, 0x6c, 0x9f, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xfa, 0xb4, 0x97, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xeb, 0xe2, 0xd6, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xf8, 0xf5, 0xf0, 0xff, 0xfa, 0xbf, 0xc4, 0xff, 0xf4, 0x7b, 0x86, 0xff, 0xf4, 0x7a, 0x88, 0xff, 0xf4, 0x77, 0x8c, 0xe4, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x23, 0xf2, 0x6b, 0x9e, 0x33, 0xf7, 0x90, 0x64, 0xf0, 0xf7, 0x91, 0x64, 0xff, 0xf7, 0x90, 0x65, 0xff, 0xfd, 0xe2, 0xd7, 0xff, 0xf4, 0xee, 0xe8, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xd5, 0xc7, 0xbf, 0xff, 0x86, 0x6b, 0x6b, 0xff, 0x80, 0x63, 0x64, 0xff, 0xc7, 0xb6, 0xaf, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xd3, 0xc5, 0xbc, 0xff, 0x86, 0x6a, 0x6a, 0xff, 0x81, 0x64, 0x65, 0xff, 0xca, 0xba, 0xb3, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd6, 0xff, 0xee, 0xe5, 0xdc, 0xff, 0xf1, 0xeb, 0xe3, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf5, 0x7f, 0x8e, 0xff, 0xf4, 0x79, 0x89, 0xff, 0xf3, 0x78, 0x8b, 0xff, 0xf2, 0x6e, 0x9a, 0x94, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x27, 0xf5, 0x82, 0x7b, 0x6b, 0xf7, 0x90, 0x65, 0xff, 0xf7, 0x90, 0x66, 0xff, 0xf8, 0xa1, 0x7f, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xf0, 0xe9, 0xe1, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0x91, 0x77, 0x76, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x7a, 0x5d, 0x5e, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0x8d, 0x72, 0x72, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x80, 0x63, 0x64, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xf0, 0xea, 0xe3, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf8, 0xae, 0xb9, 0xff, 0xf3, 0x77, 0x8b, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf2, 0x71, 0x96, 0xbb, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x2b, 0xf6, 0x89, 0x70, 0x9c, 0xf7, 0x90, 0x66, 0xff, 0xf7, 0x8f, 0x67, 0xff, 0xfb, 0xc6, 0xb3, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0x84, 0x68, 0x68, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0x7c, 0x5f, 0x60, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x75, 0x56, 0x58, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xee, 0xe5, 0xdb, 0xff, 0xf1, 0xea, 0xe2, 0xff, 0xf5, 0xf1, 0xeb, 0xff, 0xfc, 0xdb, 0xe1, 0xff, 0xf3, 0x76, 0x8d, 0xff, 0xf3, 0x76, 0x8e, 0xff, 0xf3, 0x73, 0x92, 0xe3, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x2f, 0xf7, 0x8c, 0x6b, 0xcf, 0xf7, 0x8f, 0x67, 0xff, 0xf7, 0x8e, 0x69, 0xff, 0xfd, 0xe2, 0xd9, 0xff, 0xf6, 0xf2, 0xec, 0xff, 0xef, 0xe8, 0xe0, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0x84, 0x68, 0x69, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0x7c, 0x5f, 0x61, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x75, 0x56, 0x58, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xf1, 0xea, 0xe2, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x78, 0x91, 0xff, 0xf3, 0x74, 0x90, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf1, 0x67, 0xa5, 0x74, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x30, 0xf7, 0x8d, 0x69, 0xf0, 0xf7, 0x8e, 0x69, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xfe, 0xf6, 0xf3, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xef, 0xe9, 0xe0, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0x84, 0x68, 0x69, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0x7c, 0x5f, 0x61, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x75, 0x56, 0x58, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0xef, 0xe8, 0xdf, 0xff, 0xf1, 0xeb, 0xe4, 0xff, 0xf3, 0xee, 0xe8, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xf5, 0x8a, 0xa2, 0xff, 0xf3, 0x73, 0x91, 0xff, 0xf3, 0x73, 0x93, 0xff, 0xf2, 0x6a, 0xa1, 0x8c, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x68, 0xa3, 0x34, 0xf7, 0x8d, 0x69, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8d, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0x84, 0x69, 0x6a, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0x7c, 0x5f, 0x61, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x75, 0x56, 0x59, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf4, 0xf0, 0xea, 0xff, 0xfc, 0xfb, 0xfa, 0xff, 0xf6, 0x96, 0xad, 0xff, 0xf3, 0x72, 0x93, 0xff, 0xf3, 0x72, 0x94, 0xff, 0xf2, 0x6b, 0x9f, 0x9c, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x28, 0xf2, 0x6d, 0x9a, 0x3f, 0xf6, 0x8c, 0x6b, 0xff, 0xf6, 0x8c, 0x6c, 0xff, 0xf6, 0x90, 0x73, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xf5, 0xf0, 0xeb, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0x84, 0x69, 0x6a, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0x7d, 0x60, 0x61, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x75, 0x56, 0x59, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xf4, 0xee, 0xe8, 0xff, 0xf6, 0xf1, 0xec, 0xff, 0xfc, 0xfb, 0xfa, 0xff, 0xf6, 0x9a, 0xb2, 0xff, 0xf3, 0x71, 0x95, 0xff, 0xf2, 0x71, 0x96, 0xff, 0xf1, 0x6b, 0x9f, 0xa3, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x34, 0xf6, 0x8b, 0x6c, 0xff, 0xf6, 0x8b, 0x6e, 0xff, 0xf6, 0x8a, 0x6f, 0xff, 0xff, 0xfe, 0xfd, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf3, 0xed, 0xe8, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0x85, 0x69, 0x6b, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0x7d, 0x60, 0x62, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x75, 0x56, 0x59, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf6, 0xf2, 0xee, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xf6, 0x91, 0xad, 0xff, 0xf2, 0x70, 0x96, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf1, 0x69, 0xa1, 0x9c, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x37, 0xf6, 0x89, 0x70, 0xe4, 0xf6, 0x8a, 0x6f, 0xff, 0xf6, 0x89, 0x70, 0xff, 0xfe, 0xee, 0xeb, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf5, 0xf0, 0xeb, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0x85, 0x6a, 0x6b, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0x7d, 0x60, 0x62, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x75, 0x57, 0x59, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xf3, 0x7f, 0xa1, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6f, 0x99, 0xff, 0xf1, 0x68, 0xa4, 0x8f, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x34, 0xf5, 0x85, 0x77, 0xc0, 0xf6, 0x88, 0x71, 0xff, 0xf6, 0x88, 0x72, 0xff, 0xfc, 0xd6, 0xcf, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0x85, 0x6a, 0x6c, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0x7d, 0x60, 0x62, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x75, 0x57, 0x59, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xed, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xfe, 0xf1, 0xf5, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6e, 0x99, 0xff, 0xf2, 0x6e, 0x9b, 0xf4, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x34, 0xf5, 0x7f, 0x7f, 0x93, 0xf6, 0x87, 0x73, 0xff, 0xf6, 0x87, 0x74, 0xff, 0xf9, 0xb5, 0xaa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0x85, 0x6a, 0x6c, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0x7d, 0x61, 0x63, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x75, 0x57, 0x59, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf8, 0xf4, 0xf0, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfa, 0xc9, 0xd9, 0xff, 0xf2, 0x6e, 0x99, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6b, 0x9d, 0xdb, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x33, 0xf3, 0x76, 0x8e, 0x64, 0xf6, 0x86, 0x74, 0xff, 0xf5, 0x85, 0x76, 0xff, 0xf6, 0x8c, 0x7e, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0x89, 0x6f, 0x70, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x70, 0x51, 0x54, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0x83, 0x67, 0x69, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x77, 0x5a, 0x5c, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xf5, 0x94, 0xb5, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6d, 0x9c, 0xff, 0xf2, 0x69, 0xa1, 0xbf, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x3c, 0xf5, 0x83, 0x79, 0xdf, 0xf5, 0x84, 0x77, 0xff, 0xf5, 0x83, 0x79, 0xff, 0xfb, 0xc8, 0xc4, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xb7, 0xa6, 0xa6, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x9e, 0x89, 0x8a, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xb3, 0xa1, 0xa1, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xa4, 0x8f, 0x90, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xfa, 0xf7, 0xf4, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xe2, 0xeb, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6c, 0x9c, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf1, 0x67, 0xa4, 0x9b, 0xf1, 0x66, 0xa6, 0x74, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x38, 0xf4, 0x7d, 0x82, 0xa3, 0xf5, 0x83, 0x79, 0xff, 0xf5, 0x82, 0x7a, 0xff, 0xf6, 0x93, 0x8e, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfb, 0xfa, 0xf9, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xd8, 0xce, 0xcd, 0xff, 0xd0, 0xc5, 0xc4, 0xff, 0xf8, 0xf5, 0xf2, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xd6, 0xcc, 0xcb, 0xff, 0xd1, 0xc6, 0xc5, 0xff, 0xf8, 0xf5, 0xf2, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfb, 0xfa, 0xf7, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xf7, 0xa6, 0xc2, 0xff, 0xf2, 0x6c, 0x9c, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6a, 0xa0, 0xd4, 0xf1, 0x66, 0xa6, 0x83, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x34, 0xf2, 0x6d, 0x9b, 0x53, 0xf5, 0x81, 0x7d, 0xef, 0xf5, 0x81, 0x7c, 0xff, 0xf5, 0x80, 0x7d, 0xff, 0xfa, 0xc0, 0xc0, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfd, 0xfd, 0xfc, 0xff, 0xfa, 0xc2, 0xd6, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf1, 0x68, 0xa3, 0xb3, 0xf1, 0x66, 0xa6, 0x7b, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x3c, 0xf4, 0x7a, 0x88, 0x9c, 0xf5, 0x80, 0x7e, 0xff, 0xf5, 0x7f, 0x7f, 0xff, 0xf4, 0x7e, 0x81, 0xff, 0xfa, 0xc9, 0xcb, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfc, 0xfc, 0xfa, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x80, 0xaa, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x69, 0xa2, 0xd3, 0xf1, 0x66, 0xa6, 0x83, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x44, 0xf4, 0x7c, 0x85, 0xc8, 0xf4, 0x7e, 0x81, 0xff, 0xf4, 0x7d, 0x82, 0xff, 0xf5, 0x84, 0x8b, 0xff, 0xfa, 0xc9, 0xcd, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfd, 0xfd, 0xfc, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfc, 0xff, 0xfd, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x96, 0xb9, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6a, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xf4, 0xf1, 0x66, 0xa5, 0x93, 0xf1, 0x66, 0xa6, 0x7b, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x3f, 0xf2, 0x6b, 0x9e, 0x58, 0xf4, 0x7b, 0x85, 0xe3, 0xf4, 0x7c, 0x84, 0xff, 0xf4, 0x7b, 0x85, 0xff, 0xf5, 0x81, 0x8e, 0xff, 0xfa, 0xc7, 0xce, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x92, 0xb8, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf1, 0x68, 0xa3, 0xb7, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x44, 0xf2, 0x71, 0x96, 0x7b, 0xf4, 0x79, 0x88, 0xe3, 0xf4, 0x7a, 0x87, 0xff, 0xf4, 0x79, 0x88, 0xff, 0xf4, 0x78, 0x8a, 0xff, 0xf9, 0xba, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xbd, 0xd3, 0xff, 0xf3, 0x73, 0xa3, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf1, 0x69, 0xa1, 0xff, 0xf1, 0x68, 0xa4, 0xc3, 0xf1, 0x66, 0xa6, 0x83, 0xf1, 0x66, 0xa6, 0x74, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x48, 0xf2, 0x6f, 0x98, 0x7c, 0xf4, 0x78, 0x8b, 0xe3, 0xf4, 0x78, 0x8a, 0xff, 0xf3, 0x77, 0x8b, 0xff, 0xf3, 0x76, 0x8d, 0xff, 0xf4, 0x84, 0x9a, 0xff, 0xf9, 0xbe, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xc9, 0xdb, 0xff, 0xf5, 0x8d, 0xb3, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6a, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf1, 0x69, 0xa1, 0xff, 0xf1, 0x68, 0xa4, 0xc0, 0xf1, 0x66, 0xa6, 0x83, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x69, 0xa2, 0x60, 0xf3, 0x74, 0x90, 0xcb, 0xf3, 0x76, 0x8d, 0xff, 0xf3, 0x75, 0x8e, 0xff, 0xf3, 0x75, 0x90, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf3, 0x78, 0x96, 0xff, 0xf7, 0xa2, 0xb7, 0xff, 0xfa, 0xc7, 0xd5, 0xff, 0xfc, 0xe2, 0xe9, 0xff, 0xfe, 0xf4, 0xf7, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xfe, 0xf5, 0xf8, 0xff, 0xfd, 0xe7, 0xee, 0xff, 0xfb, 0xcd, 0xdd, 0xff, 0xf7, 0xa9, 0xc5, 0xff, 0xf3, 0x79, 0xa5, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf1, 0x69, 0xa2, 0xec, 0xf1, 0x68, 0xa4, 0xb7, 0xf1, 0x66, 0xa6, 0x83, 0xf1, 0x66, 0xa6, 0x74, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x58, 0xf2, 0x70, 0x97, 0xa7, 0xf3, 0x73, 0x91, 0xec, 0xf3, 0x73, 0x91, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf3, 0x72, 0x94, 0xff, 0xf3, 0x71, 0x95, 0xff, 0xf2, 0x70, 0x96, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6e, 0x99, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6c, 0x9c, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf1, 0x69, 0xa1, 0xff, 0xf1, 0x68, 0xa3, 0xc8, 0xf1, 0x66, 0xa6, 0x88, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x67, 0xa4, 0x67, 0xf2, 0x6e, 0x99, 0xb0, 0xf3, 0x71, 0x96, 0xe3, 0xf3, 0x71, 0x95, 0xff, 0xf2, 0x70, 0x96, 0xff, 0xf2, 0x6f, 0x97, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6d, 0x9c, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6c, 0x9e, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6a, 0x9f, 0xff, 0xf2, 0x6a, 0xa1, 0xef, 0xf1, 0x68, 0xa3, 0xc8, 0xf1, 0x67, 0xa5, 0x9c, 0xf1, 0x66, 0xa6, 0x80, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x69, 0xa2, 0x80, 0xf2, 0x6b, 0x9e, 0xa8, 0xf2, 0x6d, 0x9c, 0xcc, 0xf2, 0x6d, 0x9b, 0xe7, 0xf2, 0x6d, 0x9b, 0xf7, 0xf2, 0x6d, 0x9c, 0xfb, 0xf2, 0x6c, 0x9d, 0xf8, 0xf2, 0x6b, 0x9f, 0xec, 0xf2, 0x6a, 0xa1, 0xd8, 0xf2, 0x68, 0xa3, 0xbc, 0xf1, 0x67, 0xa4, 0x9f, 0xf1, 0x66, 0xa6, 0x83, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x66, 0xa6, 0x74, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-#endif
-};
-
-lv_img_dsc_t img_lv_demo_music_btn_list_pause = {
-  .header.always_zero = 0,
-  .header.w = 58,
-  .header.h = 60,
-  .data_size = 3480 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .data = img_lv_demo_music_btn_list_pause_map,
-};
-
-#endif /*LV_USE_DEMO_MUSIC*/
-
-
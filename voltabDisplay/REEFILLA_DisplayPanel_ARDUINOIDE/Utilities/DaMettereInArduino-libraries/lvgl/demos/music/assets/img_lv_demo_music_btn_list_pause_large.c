@@ -1,456 +0,0 @@
-#include "../lv_demo_music.h"
-#if LV_USE_DEMO_MUSIC && LV_DEMO_MUSIC_LARGE
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMG_LV_DEMO_MUSIC_BTN_LIST_PAUSE
-#define LV_ATTRIBUTE_IMG_IMG_LV_DEMO_MUSIC_BTN_LIST_PAUSE
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMG_LV_DEMO_MUSIC_BTN_LIST_PAUSE uint8_t img_lv_demo_music_btn_list_pause_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Blue: 2 bit, Green: 3 bit, Red: 3 bit, Alpha 8 bit */
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x18, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x1c, 0xaf, 0x1c, 0xaf, 0x1f, 0xaf, 0x1f, 0xaf, 0x20, 0xaf, 0x20, 0xaf, 0x20, 0xaf, 0x20, 0xaf, 0x20, 0xaf, 0x20, 0xaf, 0x20, 0xaf, 0x20, 0xaf, 0x20, 0xaf, 0x1f, 0xaf, 0x1f, 0xaf, 0x1f, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x1b, 0xaf, 0x1c, 0xaf, 0x1c, 0xaf, 0x1f, 0xaf, 0x20, 0xaf, 0x23, 0xaf, 0x23, 0xaf, 0x24, 0xaf, 0x24, 0xaf, 0x27, 0xaf, 0x27, 0xaf, 0x27, 0xaf, 0x28, 0xaf, 0x28, 0xaf, 0x28, 0xaf, 0x27, 0xaf, 0x27, 0xaf, 0x27, 0xaf, 0x27, 0xaf, 0x24, 0xaf, 0x24, 0xaf, 0x23, 0xaf, 0x20, 0xaf, 0x1f, 0xaf, 0x1f, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0x77, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x1b, 0xaf, 0x1c, 0xaf, 0x1f, 0xaf, 0x20, 0xaf, 0x23, 0xaf, 0x24, 0xaf, 0x27, 0xaf, 0x28, 0xaf, 0x2b, 0xaf, 0x2b, 0xaf, 0x2c, 0xaf, 0x2c, 0xaf, 0x2f, 0xaf, 0x2f, 0xaf, 0x2f, 0xaf, 0x2f, 0xaf, 0x2f, 0xaf, 0x2f, 0xaf, 0x2f, 0xaf, 0x2c, 0xaf, 0x2c, 0xaf, 0x2b, 0xaf, 0x2b, 0xaf, 0x28, 0xaf, 0x27, 0xaf, 0x24, 0xaf, 0x24, 0xaf, 0x23, 0xaf, 0x20, 0xaf, 0x1f, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x1f, 0xaf, 0x20, 0xaf, 0x23, 0xaf, 0x24, 0xaf, 0x27, 0xaf, 0x28, 0xaf, 0x2b, 0xaf, 0x2c, 0xaf, 0x2f, 0xaf, 0x30, 0xaf, 0x33, 0xaf, 0x33, 0xaf, 0x34, 0xaf, 0x34, 0xaf, 0x37, 0xaf, 0x37, 0xaf, 0x37, 0xaf, 0x37, 0xaf, 0x37, 0xaf, 0x34, 0xaf, 0x34, 0xaf, 0x34, 0xaf, 0x33, 0xaf, 0x30, 0xaf, 0x2f, 0xaf, 0x2f, 0xaf, 0x2c, 0xaf, 0x2b, 0xaf, 0x28, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x20, 0xaf, 0x1f, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x1b, 0xaf, 0x1f, 0xaf, 0x20, 0xaf, 0x23, 0xaf, 0x27, 0xaf, 0x28, 0xaf, 0x2b, 0xaf, 0x2f, 0xaf, 0x30, 0xaf, 0x33, 0xaf, 0x34, 0xaf, 0x37, 0xaf, 0x38, 0xaf, 0x3b, 0xaf, 0x3b, 0xaf, 0x3c, 0xaf, 0x3c, 0xaf, 0x3f, 0xaf, 0x3f, 0xaf, 0x3f, 0xaf, 0x3f, 0xaf, 0x3f, 0xaf, 0x3f, 0xaf, 0x3c, 0xaf, 0x3c, 0xaf, 0x3b, 0xaf, 0x38, 0xaf, 0x37, 0xaf, 0x34, 0xaf, 0x33, 0xaf, 0x30, 0xaf, 0x2f, 0xaf, 0x2c, 0xaf, 0x28, 0xaf, 0x27, 0xaf, 0x24, 0xaf, 0x20, 0xaf, 0x1f, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1b, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x23, 0xaf, 0x27, 0xaf, 0x28, 0xaf, 0x2c, 0xaf, 0x2f, 0xaf, 0x33, 0xaf, 0x34, 0xaf, 0x37, 0xaf, 0x3b, 0xaf, 0x3c, 0x93, 0x54, 0x93, 0x74, 0x93, 0x8c, 0x93, 0x97, 0x93, 0x9c, 0x93, 0x9b, 0x93, 0x90, 0x93, 0x80, 0x93, 0x64, 0xaf, 0x4b, 0xaf, 0x47, 0xaf, 0x47, 0xaf, 0x44, 0xaf, 0x44, 0xaf, 0x43, 0xaf, 0x40, 0xaf, 0x3f, 0xaf, 0x3c, 0xaf, 0x3b, 0xaf, 0x38, 0xaf, 0x34, 0xaf, 0x33, 0xaf, 0x30, 0xaf, 0x2c, 0xaf, 0x2b, 0xaf, 0x27, 0xaf, 0x24, 0xaf, 0x20, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x1f, 0xaf, 0x23, 0xaf, 0x27, 0xaf, 0x28, 0xaf, 0x2c, 0xaf, 0x30, 0xaf, 0x33, 0xaf, 0x37, 0xaf, 0x38, 0x93, 0x77, 0x73, 0xa4, 0x73, 0xd3, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xdb, 0x93, 0xb0, 0x93, 0x87, 0xaf, 0x54, 0xaf, 0x4c, 0xaf, 0x4b, 0xaf, 0x48, 0xaf, 0x44, 0xaf, 0x43, 0xaf, 0x40, 0xaf, 0x3c, 0xaf, 0x3b, 0xaf, 0x37, 0xaf, 0x34, 0xaf, 0x30, 0xaf, 0x2c, 0xaf, 0x2b, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x24, 0xaf, 0x28, 0xaf, 0x2b, 0xaf, 0x2f, 0xaf, 0x33, 0xaf, 0x37, 0x93, 0x84, 0x73, 0xc8, 0x77, 0xfb, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xdb, 0x93, 0xa0, 0xaf, 0x60, 0xaf, 0x4f, 0xaf, 0x4b, 0xaf, 0x48, 0xaf, 0x44, 0xaf, 0x43, 0xaf, 0x3f, 0xaf, 0x3b, 0xaf, 0x38, 0xaf, 0x34, 0xaf, 0x30, 0xaf, 0x2c, 0xaf, 0x28, 0xaf, 0x24, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1b, 0xaf, 0x1f, 0xaf, 0x23, 0xaf, 0x27, 0xaf, 0x2b, 0xaf, 0x2f, 0xaf, 0x33, 0xaf, 0x40, 0x73, 0xa4, 0x77, 0xfc, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xc7, 0x93, 0x8b, 0xaf, 0x53, 0xaf, 0x4f, 0xaf, 0x4b, 0xaf, 0x47, 0xaf, 0x43, 0xaf, 0x3f, 0xaf, 0x3b, 0xaf, 0x37, 0xaf, 0x33, 0xaf, 0x2f, 0xaf, 0x2b, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x1f, 0xaf, 0x23, 0xaf, 0x27, 0xaf, 0x2b, 0xaf, 0x30, 0xaf, 0x34, 0x73, 0x9f, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x97, 0xff, 0x97, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0xbb, 0xff, 0x97, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xcb, 0x93, 0x8b, 0xaf, 0x54, 0xaf, 0x50, 0xaf, 0x4b, 0xaf, 0x47, 0xaf, 0x43, 0xaf, 0x3f, 0xaf, 0x3b, 0xaf, 0x34, 0xaf, 0x30, 0xaf, 0x2c, 0xaf, 0x28, 0xaf, 0x24, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x24, 0xaf, 0x28, 0xaf, 0x2c, 0xaf, 0x30, 0x93, 0x7c, 0x77, 0xec, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x97, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xb3, 0xaf, 0x58, 0xaf, 0x54, 0xaf, 0x50, 0xaf, 0x4b, 0xaf, 0x47, 0xaf, 0x40, 0xaf, 0x3c, 0xaf, 0x37, 0xaf, 0x33, 0xaf, 0x2f, 0xaf, 0x2b, 0xaf, 0x24, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x24, 0xaf, 0x28, 0xaf, 0x2f, 0xaf, 0x33, 0x73, 0xab, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x97, 0xff, 0x73, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xd0, 0xaf, 0x6b, 0xaf, 0x58, 0xaf, 0x53, 0xaf, 0x4f, 0xaf, 0x48, 0xaf, 0x44, 0xaf, 0x3f, 0xaf, 0x38, 0xaf, 0x34, 0xaf, 0x2f, 0xaf, 0x2b, 0xaf, 0x27, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x24, 0xaf, 0x28, 0xaf, 0x2f, 0x93, 0x4c, 0x77, 0xd8, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x97, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xef, 0x93, 0x90, 0xaf, 0x5c, 0xaf, 0x57, 0xaf, 0x50, 0xaf, 0x4b, 0xaf, 0x47, 0xaf, 0x40, 0xaf, 0x3b, 0xaf, 0x34, 0xaf, 0x30, 0xaf, 0x2b, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x24, 0xaf, 0x28, 0xaf, 0x2f, 0x93, 0x63, 0x77, 0xeb, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xa8, 0xaf, 0x5f, 0xaf, 0x58, 0xaf, 0x53, 0xaf, 0x4c, 0xaf, 0x47, 0xaf, 0x40, 0xaf, 0x3b, 0xaf, 0x37, 0xaf, 0x30, 0xaf, 0x2b, 0xaf, 0x27, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x1f, 0xaf, 0x24, 0xaf, 0x28, 0xaf, 0x2f, 0x93, 0x6c, 0x77, 0xef, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xb8, 0xaf, 0x63, 0xaf, 0x5b, 0xaf, 0x54, 0xaf, 0x4f, 0xaf, 0x48, 0xaf, 0x43, 0xaf, 0x3c, 0xaf, 0x37, 0xaf, 0x30, 0xaf, 0x2b, 0xaf, 0x24, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x1f, 0xaf, 0x23, 0xaf, 0x28, 0xaf, 0x2f, 0x93, 0x64, 0x77, 0xf0, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xb8, 0xaf, 0x63, 0xaf, 0x5c, 0xaf, 0x57, 0xaf, 0x4f, 0xaf, 0x48, 0xaf, 0x43, 0xaf, 0x3b, 0xaf, 0x34, 0xaf, 0x2f, 0xaf, 0x2b, 0xaf, 0x24, 0xaf, 0x20, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x23, 0xaf, 0x27, 0xaf, 0x2c, 0x93, 0x4c, 0x77, 0xeb, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0x9b, 0xaf, 0x64, 0xaf, 0x5c, 0xaf, 0x57, 0xaf, 0x4f, 0xaf, 0x48, 0xaf, 0x40, 0xaf, 0x3b, 0xaf, 0x34, 0xaf, 0x2f, 0xaf, 0x28, 0xaf, 0x24, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x27, 0xaf, 0x2b, 0xaf, 0x30, 0x77, 0xd7, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xf4, 0xaf, 0x7f, 0xaf, 0x64, 0xaf, 0x5c, 0xaf, 0x57, 0xaf, 0x4f, 0xaf, 0x47, 0xaf, 0x40, 0xaf, 0x3b, 0xaf, 0x33, 0xaf, 0x2c, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x1f, 0xaf, 0x24, 0xaf, 0x2b, 0xaf, 0x30, 0x73, 0xab, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xdf, 0xaf, 0x6c, 0xaf, 0x64, 0xaf, 0x5c, 0xaf, 0x54, 0xaf, 0x4c, 0xaf, 0x47, 0xaf, 0x3f, 0xaf, 0x38, 0xaf, 0x30, 0xaf, 0x2b, 0xaf, 0x27, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x23, 0xaf, 0x28, 0xaf, 0x2f, 0x93, 0x7b, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xc0, 0xaf, 0x6c, 0xaf, 0x64, 0xaf, 0x5c, 0xaf, 0x54, 0xaf, 0x4c, 0xaf, 0x44, 0xaf, 0x3c, 0xaf, 0x37, 0xaf, 0x2f, 0xaf, 0x28, 0xaf, 0x24, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x20, 0xaf, 0x27, 0xaf, 0x2b, 0xaf, 0x33, 0x77, 0xe8, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xa0, 0xaf, 0x6b, 0xaf, 0x63, 0xaf, 0x5b, 0xaf, 0x53, 0xaf, 0x4b, 0xaf, 0x43, 0xaf, 0x3b, 0xaf, 0x34, 0xaf, 0x2c, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1f, 0xaf, 0x23, 0xaf, 0x28, 0xaf, 0x2f, 0x73, 0x9c, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xe0, 0xaf, 0x70, 0xaf, 0x68, 0xaf, 0x60, 0xaf, 0x57, 0xaf, 0x4f, 0xaf, 0x47, 0xaf, 0x3f, 0xaf, 0x38, 0xaf, 0x30, 0xaf, 0x2b, 0xaf, 0x24, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x27, 0xaf, 0x2c, 0xb3, 0x3f, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xa8, 0xaf, 0x6f, 0xaf, 0x67, 0xaf, 0x5c, 0xaf, 0x54, 0xaf, 0x4c, 0xaf, 0x44, 0xaf, 0x3c, 0xaf, 0x34, 0xaf, 0x2f, 0xaf, 0x28, 0xaf, 0x23, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1f, 0xaf, 0x23, 0xaf, 0x28, 0xaf, 0x30, 0x73, 0xa4, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xe4, 0xaf, 0x74, 0xaf, 0x6c, 0xaf, 0x63, 0xaf, 0x5b, 0xaf, 0x50, 0xaf, 0x48, 0xaf, 0x40, 0xaf, 0x38, 0xaf, 0x30, 0xaf, 0x2b, 0xaf, 0x24, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x20, 0xaf, 0x27, 0xaf, 0x2c, 0xaf, 0x33, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xaf, 0xa4, 0xaf, 0x70, 0xaf, 0x68, 0xaf, 0x5f, 0xaf, 0x54, 0xaf, 0x4c, 0xaf, 0x44, 0xaf, 0x3c, 0xaf, 0x34, 0xaf, 0x2f, 0xaf, 0x28, 0xaf, 0x23, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x23, 0xaf, 0x28, 0xaf, 0x2f, 0x93, 0x83, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xcc, 0xaf, 0x77, 0xaf, 0x6c, 0xaf, 0x64, 0xaf, 0x5b, 0xaf, 0x50, 0xaf, 0x48, 0xaf, 0x40, 0xaf, 0x38, 0xaf, 0x30, 0xaf, 0x2b, 0xaf, 0x24, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x1b, 0xaf, 0x1f, 0xaf, 0x24, 0xaf, 0x2b, 0xaf, 0x33, 0x73, 0xc7, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0x6a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xfb, 0xaf, 0x7c, 0xaf, 0x73, 0xaf, 0x68, 0xaf, 0x5f, 0xaf, 0x54, 0xaf, 0x4c, 0xaf, 0x43, 0xaf, 0x3b, 0xaf, 0x34, 0xaf, 0x2c, 0xaf, 0x27, 0xaf, 0x20, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x27, 0xaf, 0x2f, 0xaf, 0x34, 0x77, 0xfb, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xaf, 0xa7, 0xaf, 0x77, 0xaf, 0x6c, 0xaf, 0x63, 0xaf, 0x58, 0xaf, 0x50, 0xaf, 0x47, 0xaf, 0x3f, 0xaf, 0x37, 0xaf, 0x2f, 0xaf, 0x28, 0xaf, 0x23, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x23, 0xaf, 0x28, 0xaf, 0x30, 0x93, 0x73, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xc7, 0xaf, 0x7c, 0xaf, 0x70, 0xaf, 0x67, 0xaf, 0x5c, 0xaf, 0x53, 0xaf, 0x4b, 0xaf, 0x40, 0xaf, 0x38, 0xaf, 0x33, 0xaf, 0x2b, 0xaf, 0x24, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x1b, 0xaf, 0x1f, 0xaf, 0x24, 0xaf, 0x2b, 0xaf, 0x33, 0x73, 0xa4, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xe4, 0xaf, 0x80, 0xaf, 0x74, 0xaf, 0x6b, 0xaf, 0x60, 0xaf, 0x57, 0xaf, 0x4c, 0xaf, 0x44, 0xaf, 0x3c, 0xaf, 0x34, 0xaf, 0x2c, 0xaf, 0x27, 0xaf, 0x20, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x20, 0xaf, 0x27, 0xaf, 0x2c, 0xaf, 0x34, 0x73, 0xd3, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xaf, 0x84, 0xaf, 0x78, 0xaf, 0x6f, 0xaf, 0x64, 0xaf, 0x5b, 0xaf, 0x50, 0xaf, 0x47, 0xaf, 0x3f, 0xaf, 0x37, 0xaf, 0x2f, 0xaf, 0x28, 0xaf, 0x23, 0xaf, 0x1c, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1c, 0xaf, 0x23, 0xaf, 0x28, 0xaf, 0x2f, 0xaf, 0x38, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xaf, 0x9f, 0xaf, 0x7c, 0xaf, 0x73, 0xaf, 0x67, 0xaf, 0x5c, 0xaf, 0x53, 0xaf, 0x48, 0xaf, 0x40, 0xaf, 0x38, 0xaf, 0x30, 0xaf, 0x2b, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x23, 0xaf, 0x2b, 0xaf, 0x30, 0x93, 0x50, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xaf, 0xb7, 0xaf, 0x80, 0xaf, 0x74, 0xaf, 0x6b, 0xaf, 0x5f, 0xaf, 0x54, 0xaf, 0x4c, 0xaf, 0x43, 0xaf, 0x3b, 0xaf, 0x33, 0xaf, 0x2b, 0xaf, 0x24, 0xaf, 0x1f, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1f, 0xaf, 0x24, 0xaf, 0x2b, 0xaf, 0x33, 0x93, 0x70, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xc8, 0xaf, 0x83, 0xaf, 0x77, 0xaf, 0x6c, 0xaf, 0x60, 0xaf, 0x57, 0xaf, 0x4c, 0xaf, 0x44, 0xaf, 0x3c, 0xaf, 0x34, 0xaf, 0x2c, 0xaf, 0x27, 0xaf, 0x20, 0xaf, 0x1b, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x1b, 0xaf, 0x1f, 0xaf, 0x24, 0xaf, 0x2c, 0xaf, 0x33, 0x93, 0x88, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xd8, 0xaf, 0x84, 0xaf, 0x78, 0xaf, 0x6f, 0xaf, 0x63, 0xaf, 0x58, 0xaf, 0x4f, 0xaf, 0x47, 0xaf, 0x3c, 0xaf, 0x34, 0xaf, 0x2f, 0xaf, 0x27, 0xaf, 0x20, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x1b, 0xaf, 0x20, 0xaf, 0x27, 0xaf, 0x2c, 0xaf, 0x34, 0x93, 0x93, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xdf, 0xaf, 0x87, 0xaf, 0x7b, 0xaf, 0x70, 0xaf, 0x64, 0xaf, 0x5b, 0xaf, 0x50, 0xaf, 0x47, 0xaf, 0x3f, 0xaf, 0x37, 0xaf, 0x2f, 0xaf, 0x28, 0xaf, 0x23, 0xaf, 0x1c, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x20, 0xaf, 0x27, 0xaf, 0x2f, 0xaf, 0x34, 0x93, 0x98, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xe4, 0xaf, 0x88, 0xaf, 0x7c, 0xaf, 0x70, 0xaf, 0x67, 0xaf, 0x5c, 0xaf, 0x53, 0xaf, 0x48, 0xaf, 0x40, 0xaf, 0x37, 0xaf, 0x30, 0xaf, 0x28, 0xaf, 0x23, 0xaf, 0x1c, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x20, 0xaf, 0x27, 0xaf, 0x2f, 0xaf, 0x37, 0x93, 0x97, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xe0, 0xaf, 0x88, 0xaf, 0x7f, 0xaf, 0x73, 0xaf, 0x67, 0xaf, 0x5c, 0xaf, 0x53, 0xaf, 0x48, 0xaf, 0x40, 0xaf, 0x38, 0xaf, 0x30, 0xaf, 0x28, 0xaf, 0x23, 0xaf, 0x1c, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x20, 0xaf, 0x28, 0xaf, 0x2f, 0xaf, 0x37, 0x93, 0x8c, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xdc, 0xaf, 0x8b, 0xaf, 0x7f, 0xaf, 0x73, 0xaf, 0x68, 0xaf, 0x5c, 0xaf, 0x53, 0xaf, 0x4b, 0xaf, 0x40, 0xaf, 0x38, 0xaf, 0x30, 0xaf, 0x28, 0xaf, 0x23, 0xaf, 0x1c, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x28, 0xaf, 0x2f, 0xaf, 0x37, 0x93, 0x7b, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xd0, 0xaf, 0x8b, 0xaf, 0x7f, 0xaf, 0x73, 0xaf, 0x68, 0xaf, 0x5c, 0xaf, 0x53, 0xaf, 0x4b, 0xaf, 0x40, 0xaf, 0x38, 0xaf, 0x30, 0xaf, 0x2b, 0xaf, 0x23, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x20, 0xaf, 0x28, 0xaf, 0x2f, 0xaf, 0x37, 0x93, 0x5f, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xc0, 0xaf, 0x8b, 0xaf, 0x7f, 0xaf, 0x73, 0xaf, 0x68, 0xaf, 0x5c, 0xaf, 0x53, 0xaf, 0x4b, 0xaf, 0x40, 0xaf, 0x38, 0xaf, 0x30, 0xaf, 0x28, 0xaf, 0x23, 0xaf, 0x1c, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x20, 0xaf, 0x28, 0xaf, 0x2f, 0xaf, 0x37, 0xaf, 0x43, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xaf, 0xaf, 0x88, 0xaf, 0x7f, 0xaf, 0x73, 0xaf, 0x67, 0xaf, 0x5c, 0xaf, 0x53, 0xaf, 0x48, 0xaf, 0x40, 0xaf, 0x38, 0xaf, 0x30, 0xaf, 0x28, 0xaf, 0x23, 0xaf, 0x1c, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x20, 0xaf, 0x27, 0xaf, 0x2f, 0xaf, 0x34, 0xaf, 0x3f, 0x93, 0xd7, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0x97, 0xaf, 0x88, 0xaf, 0x7c, 0xaf, 0x70, 0xaf, 0x67, 0xaf, 0x5c, 0xaf, 0x53, 0xaf, 0x48, 0xaf, 0x40, 0xaf, 0x37, 0xaf, 0x30, 0xaf, 0x28, 0xaf, 0x23, 0xaf, 0x1c, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x1b, 0xaf, 0x20, 0xaf, 0x27, 0xaf, 0x2c, 0xaf, 0x34, 0xaf, 0x3c, 0x93, 0xab, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xeb, 0xaf, 0x93, 0xaf, 0x87, 0xaf, 0x7c, 0xaf, 0x70, 0xaf, 0x64, 0xaf, 0x5b, 0xaf, 0x50, 0xaf, 0x48, 0xaf, 0x3f, 0xaf, 0x37, 0xaf, 0x2f, 0xaf, 0x28, 0xaf, 0x23, 0xaf, 0x1c, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x1b, 0xaf, 0x1f, 0xaf, 0x27, 0xaf, 0x2c, 0xaf, 0x34, 0xaf, 0x3c, 0x93, 0x7f, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xd3, 0xaf, 0x90, 0xaf, 0x84, 0xaf, 0x7b, 0xaf, 0x6f, 0xaf, 0x64, 0xaf, 0x58, 0xaf, 0x4f, 0xaf, 0x47, 0xaf, 0x3f, 0xaf, 0x37, 0xaf, 0x2f, 0xaf, 0x27, 0xaf, 0x20, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1f, 0xaf, 0x24, 0xaf, 0x2b, 0xaf, 0x33, 0xaf, 0x3b, 0xaf, 0x4c, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xbb, 0xaf, 0x8f, 0xaf, 0x83, 0xaf, 0x78, 0xaf, 0x6c, 0xaf, 0x63, 0xaf, 0x58, 0xaf, 0x4f, 0xaf, 0x44, 0xaf, 0x3c, 0xaf, 0x34, 0xaf, 0x2c, 0xaf, 0x27, 0xaf, 0x20, 0xaf, 0x1b, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x18, 0xaf, 0x1f, 0xaf, 0x24, 0xaf, 0x2b, 0xaf, 0x30, 0xaf, 0x38, 0xaf, 0x40, 0x93, 0xd7, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0x9b, 0xaf, 0x8b, 0xaf, 0x80, 0xaf, 0x74, 0xaf, 0x6b, 0xaf, 0x60, 0xaf, 0x54, 0xaf, 0x4c, 0xaf, 0x43, 0xaf, 0x3b, 0xaf, 0x33, 0xaf, 0x2c, 0xaf, 0x24, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1c, 0xaf, 0x23, 0xaf, 0x28, 0xaf, 0x2f, 0xaf, 0x37, 0xaf, 0x3f, 0x93, 0x9b, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6a, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xe3, 0xaf, 0x93, 0xaf, 0x88, 0xaf, 0x7c, 0xaf, 0x73, 0xaf, 0x68, 0xaf, 0x5c, 0xaf, 0x53, 0xaf, 0x4b, 0xaf, 0x40, 0xaf, 0x38, 0xaf, 0x30, 0xaf, 0x2b, 0xaf, 0x24, 0xaf, 0x1f, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x20, 0xaf, 0x27, 0xaf, 0x2f, 0xaf, 0x34, 0xaf, 0x3c, 0xaf, 0x57, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xbf, 0xaf, 0x8f, 0xaf, 0x84, 0xaf, 0x7b, 0xaf, 0x6f, 0xaf, 0x64, 0xaf, 0x5b, 0xaf, 0x50, 0xaf, 0x47, 0xaf, 0x3f, 0xaf, 0x37, 0xaf, 0x2f, 0xaf, 0x28, 0xaf, 0x23, 0xaf, 0x1c, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x1b, 0xaf, 0x1f, 0xaf, 0x24, 0xaf, 0x2c, 0xaf, 0x33, 0xaf, 0x3b, 0xaf, 0x43, 0x93, 0xc7, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xf7, 0xaf, 0x94, 0xaf, 0x8b, 0xaf, 0x80, 0xaf, 0x77, 0xaf, 0x6c, 0xaf, 0x60, 0xaf, 0x57, 0xaf, 0x4f, 0xaf, 0x44, 0xaf, 0x3c, 0xaf, 0x34, 0xaf, 0x2f, 0xaf, 0x27, 0xaf, 0x20, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1f, 0xaf, 0x24, 0xaf, 0x2b, 0xaf, 0x30, 0xaf, 0x38, 0xaf, 0x40, 0x93, 0x83, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xc7, 0xaf, 0x90, 0xaf, 0x87, 0xaf, 0x7c, 0xaf, 0x73, 0xaf, 0x68, 0xaf, 0x5f, 0xaf, 0x54, 0xaf, 0x4b, 0xaf, 0x43, 0xaf, 0x3b, 0xaf, 0x33, 0xaf, 0x2b, 0xaf, 0x24, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1c, 0xaf, 0x23, 0xaf, 0x28, 0xaf, 0x2f, 0xaf, 0x34, 0xaf, 0x3c, 0xaf, 0x44, 0x93, 0xc3, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xf7, 0xaf, 0x97, 0xaf, 0x8c, 0xaf, 0x83, 0xaf, 0x78, 0xaf, 0x6f, 0xaf, 0x64, 0xaf, 0x5b, 0xaf, 0x50, 0xaf, 0x48, 0xaf, 0x3f, 0xaf, 0x37, 0xaf, 0x30, 0xaf, 0x28, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x20, 0xaf, 0x27, 0xaf, 0x2c, 0xaf, 0x33, 0xaf, 0x3b, 0xaf, 0x43, 0x93, 0x80, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xc0, 0xaf, 0x90, 0xaf, 0x87, 0xaf, 0x7c, 0xaf, 0x73, 0xaf, 0x6b, 0xaf, 0x60, 0xaf, 0x57, 0xaf, 0x4c, 0xaf, 0x44, 0xaf, 0x3c, 0xaf, 0x34, 0xaf, 0x2f, 0xaf, 0x27, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1f, 0xaf, 0x23, 0xaf, 0x28, 0xaf, 0x30, 0xaf, 0x37, 0xaf, 0x3f, 0xaf, 0x47, 0x93, 0xac, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xdc, 0xaf, 0x94, 0xaf, 0x8b, 0xaf, 0x83, 0xaf, 0x78, 0xaf, 0x6f, 0xaf, 0x64, 0xaf, 0x5b, 0xaf, 0x53, 0xaf, 0x48, 0xaf, 0x40, 0xaf, 0x38, 0xaf, 0x33, 0xaf, 0x2b, 0xaf, 0x24, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x27, 0xaf, 0x2c, 0xaf, 0x34, 0xaf, 0x3b, 0xaf, 0x43, 0xaf, 0x4b, 0x93, 0xc8, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xf4, 0xaf, 0x9c, 0xaf, 0x8f, 0xaf, 0x84, 0xaf, 0x7c, 0xaf, 0x73, 0xaf, 0x68, 0xaf, 0x60, 0xaf, 0x57, 0xaf, 0x4f, 0xaf, 0x44, 0xaf, 0x3c, 0xaf, 0x37, 0xaf, 0x2f, 0xaf, 0x28, 0xaf, 0x23, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x1b, 0xaf, 0x1f, 0xaf, 0x24, 0xaf, 0x2b, 0xaf, 0x30, 0xaf, 0x38, 0xaf, 0x3f, 0xaf, 0x47, 0xaf, 0x5f, 0x93, 0xec, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xbb, 0xaf, 0x90, 0xaf, 0x88, 0xaf, 0x7f, 0xaf, 0x77, 0xaf, 0x6c, 0xaf, 0x64, 0xaf, 0x5b, 0xaf, 0x53, 0xaf, 0x48, 0xaf, 0x40, 0xaf, 0x38, 0xaf, 0x33, 0xaf, 0x2c, 0xaf, 0x27, 0xaf, 0x20, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x27, 0xaf, 0x2c, 0xaf, 0x34, 0xaf, 0x3b, 0xaf, 0x43, 0xaf, 0x4b, 0xb3, 0x87, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xd3, 0xaf, 0x93, 0xaf, 0x8b, 0xaf, 0x83, 0xaf, 0x78, 0xaf, 0x70, 0xaf, 0x67, 0xaf, 0x5f, 0xaf, 0x57, 0xaf, 0x4c, 0xaf, 0x44, 0xaf, 0x3c, 0xaf, 0x37, 0xaf, 0x2f, 0xaf, 0x28, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x1f, 0xaf, 0x24, 0xaf, 0x2b, 0xaf, 0x30, 0xaf, 0x37, 0xaf, 0x3f, 0xaf, 0x47, 0xaf, 0x4f, 0x93, 0xa3, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xdf, 0xaf, 0x94, 0xaf, 0x8c, 0xaf, 0x84, 0xaf, 0x7b, 0xaf, 0x73, 0xaf, 0x6b, 0xaf, 0x60, 0xaf, 0x58, 0xaf, 0x50, 0xaf, 0x48, 0xaf, 0x40, 0xaf, 0x38, 0xaf, 0x33, 0xaf, 0x2b, 0xaf, 0x27, 0xaf, 0x20, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x27, 0xaf, 0x2c, 0xaf, 0x33, 0xaf, 0x3b, 0xaf, 0x40, 0xaf, 0x48, 0xaf, 0x50, 0x93, 0xb0, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xe3, 0xaf, 0x94, 0xaf, 0x8c, 0xaf, 0x84, 0xaf, 0x7c, 0xaf, 0x74, 0xaf, 0x6c, 0xaf, 0x64, 0xaf, 0x5b, 0xaf, 0x53, 0xaf, 0x4b, 0xaf, 0x43, 0xaf, 0x3c, 0xaf, 0x34, 0xaf, 0x2f, 0xaf, 0x28, 0xaf, 0x23, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x1b, 0xaf, 0x1f, 0xaf, 0x23, 0xaf, 0x28, 0xaf, 0x2f, 0xaf, 0x34, 0xaf, 0x3c, 0xaf, 0x44, 0xaf, 0x4b, 0xaf, 0x53, 0x93, 0xb3, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xdf, 0xaf, 0x94, 0xaf, 0x8c, 0xaf, 0x84, 0xaf, 0x7f, 0xaf, 0x77, 0xaf, 0x6f, 0xaf, 0x64, 0xaf, 0x5c, 0xaf, 0x54, 0xaf, 0x4c, 0xaf, 0x47, 0xaf, 0x3f, 0xaf, 0x37, 0xaf, 0x30, 0xaf, 0x2b, 0xaf, 0x24, 0xaf, 0x20, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x20, 0xaf, 0x24, 0xaf, 0x2b, 0xaf, 0x30, 0xaf, 0x37, 0xaf, 0x3f, 0xaf, 0x47, 0xaf, 0x4c, 0xaf, 0x54, 0xb3, 0x94, 0x93, 0xf4, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xd0, 0xaf, 0x93, 0xaf, 0x8c, 0xaf, 0x84, 0xaf, 0x7f, 0xaf, 0x77, 0xaf, 0x6f, 0xaf, 0x67, 0xaf, 0x5f, 0xaf, 0x57, 0xaf, 0x4f, 0xaf, 0x47, 0xaf, 0x40, 0xaf, 0x38, 0xaf, 0x33, 0xaf, 0x2c, 0xaf, 0x27, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x23, 0xaf, 0x27, 0xaf, 0x2c, 0xaf, 0x33, 0xaf, 0x38, 0xaf, 0x40, 0xaf, 0x47, 0xaf, 0x4f, 0xaf, 0x57, 0xaf, 0x73, 0x93, 0xdc, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xf7, 0xaf, 0xb8, 0xaf, 0x90, 0xaf, 0x8b, 0xaf, 0x84, 0xaf, 0x7c, 0xaf, 0x77, 0xaf, 0x6f, 0xaf, 0x67, 0xaf, 0x5f, 0xaf, 0x58, 0xaf, 0x50, 0xaf, 0x48, 0xaf, 0x43, 0xaf, 0x3b, 0xaf, 0x34, 0xaf, 0x2f, 0xaf, 0x28, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x1f, 0xaf, 0x23, 0xaf, 0x28, 0xaf, 0x2f, 0xaf, 0x34, 0xaf, 0x3b, 0xaf, 0x40, 0xaf, 0x48, 0xaf, 0x4f, 0xaf, 0x57, 0xaf, 0x5c, 0xb3, 0xbb, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xdb, 0xaf, 0x9b, 0xaf, 0x8f, 0xaf, 0x88, 0xaf, 0x83, 0xaf, 0x7b, 0xaf, 0x74, 0xaf, 0x6f, 0xaf, 0x67, 0xaf, 0x5f, 0xaf, 0x58, 0xaf, 0x50, 0xaf, 0x4b, 0xaf, 0x43, 0xaf, 0x3c, 0xaf, 0x37, 0xaf, 0x30, 0xaf, 0x2b, 0xaf, 0x24, 0xaf, 0x20, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x20, 0xaf, 0x24, 0xaf, 0x2b, 0xaf, 0x2f, 0xaf, 0x34, 0xaf, 0x3b, 0xaf, 0x43, 0xaf, 0x48, 0xaf, 0x4f, 0xaf, 0x57, 0xaf, 0x5c, 0xaf, 0x97, 0xb3, 0xdf, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xd7, 0xff, 0xdb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xd7, 0xff, 0xd3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xf7, 0xaf, 0xbc, 0xaf, 0x90, 0xaf, 0x8b, 0xaf, 0x84, 0xaf, 0x7f, 0xaf, 0x78, 0xaf, 0x73, 0xaf, 0x6c, 0xaf, 0x64, 0xaf, 0x5f, 0xaf, 0x58, 0xaf, 0x50, 0xaf, 0x4b, 0xaf, 0x43, 0xaf, 0x3c, 0xaf, 0x37, 0xaf, 0x30, 0xaf, 0x2b, 0xaf, 0x27, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x24, 0xaf, 0x2b, 0xaf, 0x30, 0xaf, 0x37, 0xaf, 0x3c, 0xaf, 0x43, 0xaf, 0x48, 0xaf, 0x4f, 0xaf, 0x54, 0xaf, 0x5c, 0xaf, 0x63, 0xaf, 0xa0, 0xb3, 0xe4, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xf7, 0xaf, 0xc4, 0xaf, 0x90, 0xaf, 0x8c, 0xaf, 0x87, 0xaf, 0x83, 0xaf, 0x7c, 0xaf, 0x77, 0xaf, 0x70, 0xaf, 0x6b, 0xaf, 0x64, 0xaf, 0x5c, 0xaf, 0x57, 0xaf, 0x50, 0xaf, 0x4b, 0xaf, 0x43, 0xaf, 0x3c, 0xaf, 0x37, 0xaf, 0x30, 0xaf, 0x2c, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x27, 0xaf, 0x2b, 0xaf, 0x30, 0xaf, 0x37, 0xaf, 0x3b, 0xaf, 0x40, 0xaf, 0x47, 0xaf, 0x4f, 0xaf, 0x54, 0xaf, 0x5b, 0xaf, 0x60, 0xaf, 0x67, 0xaf, 0x9b, 0xaf, 0xc7, 0xb3, 0xfb, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xe0, 0xaf, 0xbb, 0xaf, 0x8f, 0xaf, 0x8b, 0xaf, 0x87, 0xaf, 0x83, 0xaf, 0x7c, 0xaf, 0x78, 0xaf, 0x73, 0xaf, 0x6c, 0xaf, 0x67, 0xaf, 0x60, 0xaf, 0x5b, 0xaf, 0x54, 0xaf, 0x4f, 0xaf, 0x48, 0xaf, 0x43, 0xaf, 0x3c, 0xaf, 0x37, 0xaf, 0x30, 0xaf, 0x2c, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x23, 0xaf, 0x27, 0xaf, 0x2b, 0xaf, 0x30, 0xaf, 0x34, 0xaf, 0x3b, 0xaf, 0x40, 0xaf, 0x47, 0xaf, 0x4c, 0xaf, 0x53, 0xaf, 0x57, 0xaf, 0x5c, 0xaf, 0x63, 0xaf, 0x68, 0xaf, 0x6c, 0xaf, 0x9c, 0xaf, 0xc0, 0xaf, 0xe0, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xe8, 0xaf, 0xcf, 0xaf, 0xb4, 0xaf, 0x93, 0xaf, 0x8b, 0xaf, 0x88, 0xaf, 0x84, 0xaf, 0x80, 0xaf, 0x7c, 0xaf, 0x78, 0xaf, 0x73, 0xaf, 0x6f, 0xaf, 0x68, 0xaf, 0x64, 0xaf, 0x5f, 0xaf, 0x58, 0xaf, 0x53, 0xaf, 0x4c, 0xaf, 0x47, 0xaf, 0x43, 0xaf, 0x3c, 0xaf, 0x37, 0xaf, 0x30, 0xaf, 0x2c, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x1c, 0xaf, 0x23, 0xaf, 0x27, 0xaf, 0x2b, 0xaf, 0x2f, 0xaf, 0x34, 0xaf, 0x3b, 0xaf, 0x3f, 0xaf, 0x44, 0xaf, 0x4b, 0xaf, 0x4f, 0xaf, 0x54, 0xaf, 0x5b, 0xaf, 0x5f, 0xaf, 0x64, 0xaf, 0x68, 0xaf, 0x6c, 0xaf, 0x70, 0xaf, 0x77, 0xaf, 0x93, 0xaf, 0xaf, 0xaf, 0xc3, 0xaf, 0xd3, 0xaf, 0xdb, 0xaf, 0xdf, 0xaf, 0xdc, 0xaf, 0xd7, 0xaf, 0xcc, 0xaf, 0xbb, 0xaf, 0xa7, 0xaf, 0x8c, 0xaf, 0x88, 0xaf, 0x87, 0xaf, 0x84, 0xaf, 0x83, 0xaf, 0x80, 0xaf, 0x7c, 0xaf, 0x7b, 0xaf, 0x77, 0xaf, 0x73, 0xaf, 0x6f, 0xaf, 0x6b, 0xaf, 0x64, 0xaf, 0x60, 0xaf, 0x5b, 0xaf, 0x57, 0xaf, 0x50, 0xaf, 0x4b, 0xaf, 0x47, 0xaf, 0x40, 0xaf, 0x3b, 0xaf, 0x37, 0xaf, 0x30, 0xaf, 0x2c, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x24, 0xaf, 0x2b, 0xaf, 0x2f, 0xaf, 0x33, 0xaf, 0x38, 0xaf, 0x3c, 0xaf, 0x43, 0xaf, 0x47, 0xaf, 0x4c, 0xaf, 0x50, 0xaf, 0x54, 0xaf, 0x5b, 0xaf, 0x5f, 0xaf, 0x63, 0xaf, 0x67, 0xaf, 0x6b, 0xaf, 0x6f, 0xaf, 0x73, 0xaf, 0x74, 0xaf, 0x77, 0xaf, 0x78, 0xaf, 0x7b, 0xaf, 0x7c, 0xaf, 0x7f, 0xaf, 0x7f, 0xaf, 0x7f, 0xaf, 0x7f, 0xaf, 0x7f, 0xaf, 0x7c, 0xaf, 0x7c, 0xaf, 0x7b, 0xaf, 0x78, 0xaf, 0x74, 0xaf, 0x73, 0xaf, 0x6f, 0xaf, 0x6c, 0xaf, 0x68, 0xaf, 0x64, 0xaf, 0x60, 0xaf, 0x5b, 0xaf, 0x57, 0xaf, 0x53, 0xaf, 0x4c, 0xaf, 0x48, 0xaf, 0x43, 0xaf, 0x3f, 0xaf, 0x38, 0xaf, 0x34, 0xaf, 0x30, 0xaf, 0x2b, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x24, 0xaf, 0x28, 0xaf, 0x2c, 0xaf, 0x30, 0xaf, 0x37, 0xaf, 0x3b, 0xaf, 0x3f, 0xaf, 0x44, 0xaf, 0x48, 0xaf, 0x4c, 0xaf, 0x50, 0xaf, 0x54, 0xaf, 0x58, 0xaf, 0x5c, 0xaf, 0x60, 0xaf, 0x64, 0xaf, 0x67, 0xaf, 0x6b, 0xaf, 0x6c, 0xaf, 0x6f, 0xaf, 0x70, 0xaf, 0x70, 0xaf, 0x73, 0xaf, 0x73, 0xaf, 0x73, 0xaf, 0x73, 0xaf, 0x73, 0xaf, 0x70, 0xaf, 0x70, 0xaf, 0x6f, 0xaf, 0x6c, 0xaf, 0x6b, 0xaf, 0x68, 0xaf, 0x64, 0xaf, 0x60, 0xaf, 0x5f, 0xaf, 0x5b, 0xaf, 0x57, 0xaf, 0x53, 0xaf, 0x4f, 0xaf, 0x48, 0xaf, 0x44, 0xaf, 0x40, 0xaf, 0x3c, 0xaf, 0x37, 0xaf, 0x33, 0xaf, 0x2f, 0xaf, 0x2b, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x24, 0xaf, 0x27, 0xaf, 0x2b, 0xaf, 0x2f, 0xaf, 0x34, 0xaf, 0x38, 0xaf, 0x3c, 0xaf, 0x40, 0xaf, 0x44, 0xaf, 0x48, 0xaf, 0x4c, 0xaf, 0x50, 0xaf, 0x53, 0xaf, 0x57, 0xaf, 0x5b, 0xaf, 0x5c, 0xaf, 0x5f, 0xaf, 0x60, 0xaf, 0x63, 0xaf, 0x64, 0xaf, 0x67, 0xaf, 0x67, 0xaf, 0x68, 0xaf, 0x68, 0xaf, 0x68, 0xaf, 0x67, 0xaf, 0x67, 0xaf, 0x64, 0xaf, 0x64, 0xaf, 0x63, 0xaf, 0x60, 0xaf, 0x5c, 0xaf, 0x5b, 0xaf, 0x57, 0xaf, 0x54, 0xaf, 0x50, 0xaf, 0x4c, 0xaf, 0x48, 0xaf, 0x44, 0xaf, 0x40, 0xaf, 0x3c, 0xaf, 0x38, 0xaf, 0x34, 0xaf, 0x30, 0xaf, 0x2c, 0xaf, 0x28, 0xaf, 0x24, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1b, 0xaf, 0x1f, 0xaf, 0x23, 0xaf, 0x27, 0xaf, 0x28, 0xaf, 0x2c, 0xaf, 0x30, 0xaf, 0x34, 0xaf, 0x38, 0xaf, 0x3c, 0xaf, 0x40, 0xaf, 0x43, 0xaf, 0x47, 0xaf, 0x4b, 0xaf, 0x4c, 0xaf, 0x50, 0xaf, 0x53, 0xaf, 0x54, 0xaf, 0x57, 0xaf, 0x58, 0xaf, 0x5b, 0xaf, 0x5c, 0xaf, 0x5c, 0xaf, 0x5c, 0xaf, 0x5c, 0xaf, 0x5c, 0xaf, 0x5c, 0xaf, 0x5c, 0xaf, 0x5b, 0xaf, 0x58, 0xaf, 0x57, 0xaf, 0x54, 0xaf, 0x53, 0xaf, 0x50, 0xaf, 0x4f, 0xaf, 0x4b, 0xaf, 0x48, 0xaf, 0x44, 0xaf, 0x40, 0xaf, 0x3c, 0xaf, 0x38, 0xaf, 0x37, 0xaf, 0x33, 0xaf, 0x2f, 0xaf, 0x2b, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x24, 0xaf, 0x27, 0xaf, 0x2b, 0xaf, 0x2f, 0xaf, 0x30, 0xaf, 0x34, 0xaf, 0x38, 0xaf, 0x3b, 0xaf, 0x3f, 0xaf, 0x40, 0xaf, 0x44, 0xaf, 0x47, 0xaf, 0x48, 0xaf, 0x4c, 0xaf, 0x4c, 0xaf, 0x4f, 0xaf, 0x50, 0xaf, 0x53, 0xaf, 0x53, 0xaf, 0x53, 0xaf, 0x53, 0xaf, 0x53, 0xaf, 0x53, 0xaf, 0x53, 0xaf, 0x50, 0xaf, 0x4f, 0xaf, 0x4f, 0xaf, 0x4c, 0xaf, 0x4b, 0xaf, 0x47, 0xaf, 0x44, 0xaf, 0x43, 0xaf, 0x3f, 0xaf, 0x3c, 0xaf, 0x38, 0xaf, 0x37, 0xaf, 0x33, 0xaf, 0x2f, 0xaf, 0x2b, 0xaf, 0x28, 0xaf, 0x24, 0xaf, 0x20, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x1f, 0xaf, 0x23, 0xaf, 0x24, 0xaf, 0x28, 0xaf, 0x2b, 0xaf, 0x2f, 0xaf, 0x30, 0xaf, 0x34, 0xaf, 0x37, 0xaf, 0x38, 0xaf, 0x3c, 0xaf, 0x3f, 0xaf, 0x40, 0xaf, 0x43, 0xaf, 0x44, 0xaf, 0x47, 0xaf, 0x47, 0xaf, 0x48, 0xaf, 0x48, 0xaf, 0x48, 0xaf, 0x4b, 0xaf, 0x4b, 0xaf, 0x48, 0xaf, 0x48, 0xaf, 0x47, 0xaf, 0x47, 0xaf, 0x44, 0xaf, 0x43, 0xaf, 0x40, 0xaf, 0x3f, 0xaf, 0x3c, 0xaf, 0x3b, 0xaf, 0x37, 0xaf, 0x34, 0xaf, 0x33, 0xaf, 0x2f, 0xaf, 0x2c, 0xaf, 0x28, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1b, 0xaf, 0x1c, 0xaf, 0x1f, 0xaf, 0x23, 0xaf, 0x24, 0xaf, 0x28, 0xaf, 0x2b, 0xaf, 0x2c, 0xaf, 0x2f, 0xaf, 0x33, 0xaf, 0x34, 0xaf, 0x37, 0xaf, 0x38, 0xaf, 0x3b, 0xaf, 0x3c, 0xaf, 0x3c, 0xaf, 0x3f, 0xaf, 0x3f, 0xaf, 0x40, 0xaf, 0x40, 0xaf, 0x40, 0xaf, 0x40, 0xaf, 0x40, 0xaf, 0x40, 0xaf, 0x3f, 0xaf, 0x3f, 0xaf, 0x3c, 0xaf, 0x3b, 0xaf, 0x38, 0xaf, 0x37, 0xaf, 0x34, 0xaf, 0x33, 0xaf, 0x30, 0xaf, 0x2c, 0xaf, 0x2b, 0xaf, 0x28, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x1b, 0xaf, 0x1c, 0xaf, 0x1f, 0xaf, 0x23, 0xaf, 0x24, 0xaf, 0x27, 0xaf, 0x28, 0xaf, 0x2b, 0xaf, 0x2c, 0xaf, 0x2f, 0xaf, 0x30, 0xaf, 0x33, 0xaf, 0x34, 0xaf, 0x34, 0xaf, 0x37, 0xaf, 0x37, 0xaf, 0x38, 0xaf, 0x38, 0xaf, 0x38, 0xaf, 0x38, 0xaf, 0x38, 0xaf, 0x37, 0xaf, 0x37, 0xaf, 0x37, 0xaf, 0x34, 0xaf, 0x33, 0xaf, 0x30, 0xaf, 0x2f, 0xaf, 0x2f, 0xaf, 0x2b, 0xaf, 0x28, 0xaf, 0x27, 0xaf, 0x24, 0xaf, 0x23, 0xaf, 0x20, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x1b, 0xaf, 0x1c, 0xaf, 0x1f, 0xaf, 0x20, 0xaf, 0x23, 0xaf, 0x24, 0xaf, 0x27, 0xaf, 0x28, 0xaf, 0x2b, 0xaf, 0x2b, 0xaf, 0x2c, 0xaf, 0x2f, 0xaf, 0x2f, 0xaf, 0x30, 0xaf, 0x30, 0xaf, 0x30, 0xaf, 0x30, 0xaf, 0x30, 0xaf, 0x30, 0xaf, 0x30, 0xaf, 0x2f, 0xaf, 0x2f, 0xaf, 0x2c, 0xaf, 0x2c, 0xaf, 0x2b, 0xaf, 0x28, 0xaf, 0x27, 0xaf, 0x24, 0xaf, 0x23, 0xaf, 0x20, 0xaf, 0x1f, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x1c, 0xaf, 0x1f, 0xaf, 0x20, 0xaf, 0x23, 0xaf, 0x23, 0xaf, 0x24, 0xaf, 0x27, 0xaf, 0x27, 0xaf, 0x28, 0xaf, 0x28, 0xaf, 0x28, 0xaf, 0x28, 0xaf, 0x2b, 0xaf, 0x28, 0xaf, 0x28, 0xaf, 0x28, 0xaf, 0x28, 0xaf, 0x27, 0xaf, 0x27, 0xaf, 0x24, 0xaf, 0x24, 0xaf, 0x23, 0xaf, 0x20, 0xaf, 0x1f, 0xaf, 0x1f, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x1c, 0xaf, 0x1f, 0xaf, 0x1f, 0xaf, 0x20, 0xaf, 0x20, 0xaf, 0x23, 0xaf, 0x23, 0xaf, 0x23, 0xaf, 0x23, 0xaf, 0x23, 0xaf, 0x23, 0xaf, 0x23, 0xaf, 0x23, 0xaf, 0x23, 0xaf, 0x20, 0xaf, 0x20, 0xaf, 0x1f, 0xaf, 0x1f, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x18, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x1c, 0xaf, 0x1c, 0xaf, 0x1c, 0xaf, 0x1c, 0xaf, 0x1c, 0xaf, 0x1c, 0xaf, 0x1c, 0xaf, 0x1c, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Blue: 5 bit, Green: 6 bit, Red: 5 bit, Alpha 8 bit*/
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0xdf, 0x5c, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x3b, 0x5e, 0xab, 0x3c, 0xbe, 0x93, 0x54, 0x1f, 0x84, 0x74, 0x3f, 0x7c, 0x8c, 0x5f, 0x74, 0x97, 0x5f, 0x74, 0x9c, 0x3f, 0x74, 0x9b, 0x3f, 0x7c, 0x90, 0x1f, 0x84, 0x80, 0xde, 0x8b, 0x64, 0x5e, 0xa3, 0x4b, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x38, 0x3f, 0x7c, 0x77, 0x7f, 0x6c, 0xa4, 0x9f, 0x6c, 0xd3, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xdb, 0x3f, 0x74, 0xb0, 0xff, 0x83, 0x87, 0x7e, 0xa3, 0x54, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x4b, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x37, 0x5f, 0x74, 0x84, 0x9f, 0x6c, 0xc8, 0xbf, 0x64, 0xfb, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x5f, 0x74, 0xdb, 0x1f, 0x84, 0xa0, 0x9e, 0x9b, 0x60, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x4b, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x33, 0x9e, 0x9b, 0x40, 0x7f, 0x6c, 0xa4, 0xbf, 0x64, 0xfc, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0x3f, 0x7c, 0xc7, 0xfe, 0x8b, 0x8b, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x4b, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x34, 0x7f, 0x6c, 0x9f, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0xff, 0x7c, 0xff, 0x9f, 0x95, 0xff, 0xff, 0xa5, 0xff, 0x1f, 0xae, 0xff, 0x3f, 0xb6, 0xff, 0x1f, 0xb6, 0xff, 0xff, 0xa5, 0xff, 0x9f, 0x9d, 0xff, 0x1f, 0x85, 0xff, 0x9f, 0x74, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0x7f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x7c, 0xcb, 0xde, 0x8b, 0x8b, 0x3e, 0xab, 0x54, 0x3e, 0xab, 0x50, 0x3e, 0xab, 0x4b, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x30, 0x5f, 0x74, 0x7c, 0xbf, 0x64, 0xec, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x3f, 0x85, 0xff, 0x3f, 0xae, 0xff, 0x3f, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xe7, 0xff, 0x5f, 0xbe, 0xff, 0x5f, 0x95, 0xff, 0x7f, 0x74, 0xff, 0x7f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x1f, 0x84, 0xb3, 0x3e, 0xab, 0x58, 0x3e, 0xab, 0x54, 0x3e, 0xab, 0x50, 0x3e, 0xab, 0x4b, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x33, 0x9f, 0x6c, 0xab, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xdf, 0x6c, 0xff, 0x3f, 0xae, 0xff, 0x9f, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0x7f, 0xc6, 0xff, 0xff, 0x84, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x1f, 0x7c, 0xd0, 0x7e, 0xa3, 0x6b, 0x3e, 0xab, 0x58, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2f, 0xde, 0x8b, 0x4c, 0xbf, 0x64, 0xd8, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x1f, 0x75, 0xff, 0x7f, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x9f, 0xf7, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xe7, 0xff, 0x3f, 0x95, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x74, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xef, 0xbe, 0x93, 0x90, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x57, 0x3e, 0xab, 0x50, 0x3e, 0xab, 0x4b, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2f, 0x1f, 0x7c, 0x63, 0xbf, 0x64, 0xeb, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xff, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xf7, 0xff, 0x7e, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x5e, 0xe7, 0xff, 0x9f, 0xef, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xe7, 0xff, 0xff, 0x94, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0xde, 0x8b, 0xa8, 0x3e, 0xab, 0x5f, 0x3e, 0xab, 0x58, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2f, 0x3f, 0x7c, 0x6c, 0xbf, 0x64, 0xef, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x7f, 0x8d, 0xff, 0x7f, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x7e, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x5e, 0xe7, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x7f, 0xa5, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0xfe, 0x8b, 0xb8, 0x3e, 0xab, 0x63, 0x3e, 0xab, 0x5b, 0x3e, 0xab, 0x54, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2f, 0x3f, 0x7c, 0x64, 0xbf, 0x64, 0xf0, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xff, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x5e, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xd7, 0xff, 0xfd, 0xd6, 0xff, 0xdd, 0xce, 0xff, 0xdc, 0xce, 0xff, 0xdc, 0xce, 0xff, 0xdc, 0xce, 0xff, 0xdc, 0xce, 0xff, 0xdc, 0xce, 0xff, 0xdc, 0xce, 0xff, 0xdc, 0xce, 0xff, 0xdc, 0xce, 0xff, 0xdc, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xfd, 0xd6, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x5e, 0xe7, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xc6, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0xde, 0x8b, 0xb8, 0x3e, 0xab, 0x63, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x57, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x2c, 0xde, 0x8b, 0x4c, 0xbf, 0x64, 0xeb, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x3f, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xef, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0xfd, 0xd6, 0xff, 0xdc, 0xce, 0xff, 0xdc, 0xce, 0xff, 0xdc, 0xce, 0xff, 0xdc, 0xce, 0xff, 0xdc, 0xce, 0xff, 0xdc, 0xce, 0xff, 0xdc, 0xce, 0xff, 0xdc, 0xce, 0xff, 0xdc, 0xce, 0xff, 0xdc, 0xce, 0xff, 0xdc, 0xce, 0xff, 0xdc, 0xce, 0xff, 0xdc, 0xce, 0xff, 0xdc, 0xce, 0xff, 0xdc, 0xce, 0xff, 0xdc, 0xce, 0xff, 0xdd, 0xd6, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x5e, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xd6, 0xff, 0x3f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x1f, 0x84, 0xff, 0xbe, 0x93, 0x9b, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x57, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x30, 0x9f, 0x64, 0xd7, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x7f, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x5e, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x1d, 0xd7, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xfd, 0xd6, 0xff, 0x1d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xe7, 0xff, 0xdf, 0x94, 0xff, 0x1f, 0x7c, 0xff, 0x1f, 0x84, 0xff, 0x1f, 0x84, 0xff, 0x1f, 0x84, 0xf4, 0x7e, 0x9b, 0x7f, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x57, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x30, 0x7f, 0x6c, 0xab, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x3f, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0x3e, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xdd, 0xce, 0xff, 0xfd, 0xd6, 0xff, 0x1d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x9f, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xe7, 0xff, 0x1f, 0x84, 0xff, 0x1f, 0x84, 0xff, 0x1f, 0x84, 0xff, 0x1f, 0x84, 0xff, 0xfe, 0x8b, 0xdf, 0x3e, 0xab, 0x6c, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x54, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2f, 0x5f, 0x74, 0x7b, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xdf, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x1d, 0xd7, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xdd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0x1d, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x9e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xce, 0xff, 0x1f, 0x84, 0xff, 0x1e, 0x84, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xde, 0x8b, 0xc0, 0x3e, 0xab, 0x6c, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x54, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x33, 0xbf, 0x64, 0xe8, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x7f, 0x8d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0x1d, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x9f, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xb5, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0x9e, 0x9b, 0xa0, 0x3e, 0xab, 0x6b, 0x3e, 0xab, 0x63, 0x3e, 0xab, 0x5b, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x4b, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2f, 0x7f, 0x6c, 0x9c, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x7f, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x5e, 0xe7, 0xff, 0x3e, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0x1d, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x9c, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xde, 0x8b, 0xe0, 0x3e, 0xab, 0x70, 0x3e, 0xab, 0x68, 0x3e, 0xab, 0x60, 0x3e, 0xab, 0x57, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x2c, 0x9e, 0x9b, 0x3f, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0xff, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x1d, 0xdf, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0x1d, 0xd7, 0xff, 0x3d, 0xdf, 0xff, 0x3e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xef, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x8b, 0xff, 0xfe, 0x8b, 0xff, 0x9e, 0x9b, 0xa8, 0x3e, 0xab, 0x6f, 0x3e, 0xab, 0x67, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x54, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x30, 0x7f, 0x6c, 0xa4, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x1f, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xef, 0xff, 0x3e, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0x1d, 0xdf, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xad, 0xff, 0xfe, 0x8b, 0xff, 0xfe, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xe4, 0x3e, 0xab, 0x74, 0x3e, 0xab, 0x6c, 0x3e, 0xab, 0x63, 0x3e, 0xab, 0x5b, 0x3e, 0xab, 0x50, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x33, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x7f, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x5e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x1d, 0xd7, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0xfd, 0xd6, 0xff, 0x1d, 0xdf, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xef, 0xff, 0xfe, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0x9e, 0x9b, 0xa4, 0x3e, 0xab, 0x70, 0x3e, 0xab, 0x68, 0x3e, 0xab, 0x5f, 0x3e, 0xab, 0x54, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2f, 0x5f, 0x74, 0x83, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0xdf, 0x74, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xef, 0xff, 0x5e, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0xfd, 0xd6, 0xff, 0xd9, 0xb5, 0xff, 0x57, 0xa5, 0xff, 0x3a, 0xc6, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x5b, 0xc6, 0xff, 0x57, 0xa5, 0xff, 0xd9, 0xb5, 0xff, 0xfd, 0xd6, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xdf, 0xff, 0x3e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xad, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xbe, 0x93, 0xcc, 0x3e, 0xab, 0x77, 0x3e, 0xab, 0x6c, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x5b, 0x3e, 0xab, 0x50, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x33, 0x7f, 0x6c, 0xc7, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x3f, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0xdc, 0xd6, 0xff, 0x71, 0x73, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x54, 0x84, 0xff, 0x1d, 0xd7, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x95, 0x94, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x51, 0x6b, 0xff, 0xbc, 0xce, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xef, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xfb, 0x3e, 0xab, 0x7c, 0x3e, 0xab, 0x73, 0x3e, 0xab, 0x68, 0x3e, 0xab, 0x5f, 0x3e, 0xab, 0x54, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x34, 0x9f, 0x64, 0xfb, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xef, 0xff, 0x5e, 0xe7, 0xff, 0x3e, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x33, 0x84, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x57, 0xa5, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x98, 0xad, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xf3, 0x7b, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x94, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0x7e, 0x9b, 0xa7, 0x3e, 0xab, 0x77, 0x3e, 0xab, 0x6c, 0x3e, 0xab, 0x63, 0x3e, 0xab, 0x58, 0x3e, 0xab, 0x50, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x30, 0x3f, 0x7c, 0x73, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x3f, 0x85, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0xaf, 0x5a, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xd2, 0x7b, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x13, 0x84, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x8e, 0x52, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x1d, 0xdf, 0xff, 0x3e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xc5, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x9b, 0xc7, 0x3e, 0xab, 0x7c, 0x3e, 0xab, 0x70, 0x3e, 0xab, 0x67, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x4b, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x33, 0x5f, 0x74, 0xa4, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x1f, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0x7e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x91, 0x73, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0xd2, 0x7b, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xdd, 0xd6, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3d, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x5e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x9f, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xef, 0xff, 0xde, 0x8b, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xe4, 0x3e, 0xab, 0x80, 0x3e, 0xab, 0x74, 0x3e, 0xab, 0x6b, 0x3e, 0xab, 0x60, 0x3e, 0xab, 0x57, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x34, 0x7f, 0x6c, 0xd3, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x3f, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xef, 0xff, 0x7e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x91, 0x73, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0xd2, 0x7b, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xfd, 0xd6, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x5e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x3e, 0xab, 0x84, 0x3e, 0xab, 0x78, 0x3e, 0xab, 0x6f, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x5b, 0x3e, 0xab, 0x50, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2f, 0x5e, 0xa3, 0x38, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x91, 0x73, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0xd2, 0x7b, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xfd, 0xd6, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x3e, 0xdf, 0xff, 0x5e, 0xe7, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xa4, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x5e, 0xa3, 0x9f, 0x3e, 0xab, 0x7c, 0x3e, 0xab, 0x73, 0x3e, 0xab, 0x67, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x30, 0xbe, 0x93, 0x50, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0xff, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x91, 0x73, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0xd2, 0x7b, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xfd, 0xde, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x3e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xbd, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x7e, 0x9b, 0xb7, 0x3e, 0xab, 0x80, 0x3e, 0xab, 0x74, 0x3e, 0xab, 0x6b, 0x3e, 0xab, 0x5f, 0x3e, 0xab, 0x54, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x33, 0x1f, 0x84, 0x70, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x95, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x91, 0x73, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0xd2, 0x7b, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xfd, 0xde, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x9b, 0xc8, 0x3e, 0xab, 0x83, 0x3e, 0xab, 0x77, 0x3e, 0xab, 0x6c, 0x3e, 0xab, 0x60, 0x3e, 0xab, 0x57, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x33, 0x3f, 0x7c, 0x88, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0xdf, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x91, 0x73, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0xf2, 0x7b, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x1d, 0xdf, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xde, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xd8, 0x3e, 0xab, 0x84, 0x3e, 0xab, 0x78, 0x3e, 0xab, 0x6f, 0x3e, 0xab, 0x63, 0x3e, 0xab, 0x58, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x34, 0x3f, 0x7c, 0x93, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x1f, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x9e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x91, 0x73, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0xf2, 0x7b, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x1d, 0xdf, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x7e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xe6, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xdf, 0x3e, 0xab, 0x87, 0x3e, 0xab, 0x7b, 0x3e, 0xab, 0x70, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x5b, 0x3e, 0xab, 0x50, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x34, 0x3f, 0x7c, 0x98, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x1f, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x9f, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x91, 0x73, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0xf2, 0x7b, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x1d, 0xdf, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x5e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x9e, 0xef, 0xff, 0x9f, 0xef, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xe4, 0x3e, 0xab, 0x88, 0x3e, 0xab, 0x7c, 0x3e, 0xab, 0x70, 0x3e, 0xab, 0x67, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x37, 0x3f, 0x7c, 0x97, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x1f, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x91, 0x73, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0xf2, 0x7b, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x3d, 0xdf, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xe7, 0xff, 0x7e, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xe6, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xe0, 0x3e, 0xab, 0x88, 0x3e, 0xab, 0x7f, 0x3e, 0xab, 0x73, 0x3e, 0xab, 0x67, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x37, 0x1f, 0x7c, 0x8c, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0xdf, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x9f, 0xf7, 0xff, 0x9f, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xb1, 0x73, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0xf2, 0x7b, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x3d, 0xe7, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xde, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xdc, 0x3e, 0xab, 0x8b, 0x3e, 0xab, 0x7f, 0x3e, 0xab, 0x73, 0x3e, 0xab, 0x68, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x4b, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x37, 0xfe, 0x83, 0x7b, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0x7f, 0x74, 0xff, 0x7f, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0x9f, 0xf7, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xb2, 0x73, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0xf2, 0x7b, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x3d, 0xe7, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xd6, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xd0, 0x3e, 0xab, 0x8b, 0x3e, 0xab, 0x7f, 0x3e, 0xab, 0x73, 0x3e, 0xab, 0x68, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x4b, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x37, 0xbe, 0x93, 0x5f, 0x7f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xb2, 0x73, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0xf3, 0x83, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x3d, 0xe7, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9e, 0xef, 0xff, 0x9f, 0xef, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xc5, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0xa3, 0xc0, 0x3e, 0xab, 0x8b, 0x3e, 0xab, 0x7f, 0x3e, 0xab, 0x73, 0x3e, 0xab, 0x68, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x4b, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x37, 0x5e, 0xa3, 0x43, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x7f, 0x74, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xb2, 0x73, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0xf3, 0x83, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x3e, 0xe7, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xb4, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x5e, 0xa3, 0xaf, 0x3e, 0xab, 0x88, 0x3e, 0xab, 0x7f, 0x3e, 0xab, 0x73, 0x3e, 0xab, 0x67, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x3f, 0x5f, 0x74, 0xd7, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xb2, 0x7b, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0xf3, 0x83, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x5e, 0xe7, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xef, 0xff, 0x9f, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x3e, 0xab, 0x97, 0x3e, 0xab, 0x88, 0x3e, 0xab, 0x7c, 0x3e, 0xab, 0x70, 0x3e, 0xab, 0x67, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x3c, 0x3f, 0x7c, 0xab, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x9f, 0xf7, 0xff, 0x9f, 0xf7, 0xff, 0x9f, 0xf7, 0xff, 0x9f, 0xf7, 0xff, 0x9f, 0xf7, 0xff, 0x9f, 0xf7, 0xff, 0x9f, 0xf7, 0xff, 0x9f, 0xf7, 0xff, 0x9f, 0xf7, 0xff, 0x9f, 0xf7, 0xff, 0x9f, 0xf7, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xb2, 0x7b, 0xff, 0x9f, 0xf7, 0xff, 0x9f, 0xf7, 0xff, 0x9f, 0xf7, 0xff, 0x9f, 0xf7, 0xff, 0x9f, 0xf7, 0xff, 0xf3, 0x83, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x5e, 0xe7, 0xff, 0x9f, 0xf7, 0xff, 0x9f, 0xf7, 0xff, 0x9f, 0xf7, 0xff, 0x9f, 0xf7, 0xff, 0x9f, 0xf7, 0xff, 0x9f, 0xf7, 0xff, 0x9f, 0xf7, 0xff, 0x9f, 0xf7, 0xff, 0x9f, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xef, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xeb, 0x3e, 0xab, 0x93, 0x3e, 0xab, 0x87, 0x3e, 0xab, 0x7c, 0x3e, 0xab, 0x70, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x5b, 0x3e, 0xab, 0x50, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x3c, 0xfe, 0x8b, 0x7f, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xb2, 0x7b, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xf3, 0x83, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x5e, 0xef, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xd5, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xd3, 0x3e, 0xab, 0x90, 0x3e, 0xab, 0x84, 0x3e, 0xab, 0x7b, 0x3e, 0xab, 0x6f, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x58, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x3b, 0x7e, 0xa3, 0x4c, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x74, 0xff, 0x3f, 0x7c, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xb2, 0x7b, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xf3, 0x83, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x5e, 0xef, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xac, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x5e, 0xa3, 0xbb, 0x3e, 0xab, 0x8f, 0x3e, 0xab, 0x83, 0x3e, 0xab, 0x78, 0x3e, 0xab, 0x6c, 0x3e, 0xab, 0x63, 0x3e, 0xab, 0x58, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x40, 0x3f, 0x7c, 0xd7, 0x3f, 0x74, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x5f, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x10, 0x63, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x33, 0x8c, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x95, 0x94, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xcf, 0x5a, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xf7, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x3e, 0xab, 0x9b, 0x3e, 0xab, 0x8b, 0x3e, 0xab, 0x80, 0x3e, 0xab, 0x74, 0x3e, 0xab, 0x6b, 0x3e, 0xab, 0x60, 0x3e, 0xab, 0x54, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x3f, 0xff, 0x83, 0x9b, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0xdf, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x57, 0xad, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x8e, 0x52, 0xff, 0x7b, 0xce, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbc, 0xd6, 0xff, 0x8e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xf6, 0xa4, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xc5, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xe3, 0x3e, 0xab, 0x93, 0x3e, 0xab, 0x88, 0x3e, 0xab, 0x7c, 0x3e, 0xab, 0x73, 0x3e, 0xab, 0x68, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x4b, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x3c, 0x9e, 0x9b, 0x57, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xbf, 0xf7, 0xff, 0x16, 0xa5, 0xff, 0xae, 0x5a, 0xff, 0x6e, 0x52, 0xff, 0x0f, 0x63, 0xff, 0xf9, 0xbd, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0x3a, 0xc6, 0xff, 0x30, 0x6b, 0xff, 0x6e, 0x52, 0xff, 0xae, 0x5a, 0xff, 0xd5, 0x9c, 0xff, 0xbf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xbf, 0x3e, 0xab, 0x8f, 0x3e, 0xab, 0x84, 0x3e, 0xab, 0x7b, 0x3e, 0xab, 0x6f, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x5b, 0x3e, 0xab, 0x50, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x43, 0x1f, 0x84, 0xc7, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x1f, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0x5e, 0xef, 0xff, 0xdf, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0x5e, 0xef, 0xff, 0xbf, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xc5, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xf7, 0x3e, 0xab, 0x94, 0x3e, 0xab, 0x8b, 0x3e, 0xab, 0x80, 0x3e, 0xab, 0x77, 0x3e, 0xab, 0x6c, 0x3e, 0xab, 0x60, 0x3e, 0xab, 0x57, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x40, 0xde, 0x8b, 0x83, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x1f, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xf7, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xc7, 0x3e, 0xab, 0x90, 0x3e, 0xab, 0x87, 0x3e, 0xab, 0x7c, 0x3e, 0xab, 0x73, 0x3e, 0xab, 0x68, 0x3e, 0xab, 0x5f, 0x3e, 0xab, 0x54, 0x3e, 0xab, 0x4b, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x44, 0x1e, 0x84, 0xc3, 0x1f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0xdf, 0x94, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xbc, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xf7, 0x3e, 0xab, 0x97, 0x3e, 0xab, 0x8c, 0x3e, 0xab, 0x83, 0x3e, 0xab, 0x78, 0x3e, 0xab, 0x6f, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x5b, 0x3e, 0xab, 0x50, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x43, 0xbe, 0x93, 0x80, 0x1f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x1f, 0x84, 0xff, 0x1f, 0x84, 0xff, 0x5f, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xd5, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xc0, 0x3e, 0xab, 0x90, 0x3e, 0xab, 0x87, 0x3e, 0xab, 0x7c, 0x3e, 0xab, 0x73, 0x3e, 0xab, 0x6b, 0x3e, 0xab, 0x60, 0x3e, 0xab, 0x57, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x47, 0xfe, 0x8b, 0xac, 0x1f, 0x84, 0xff, 0x1f, 0x84, 0xff, 0x1f, 0x84, 0xff, 0x1f, 0x84, 0xff, 0x3f, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xef, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xdc, 0x3e, 0xab, 0x94, 0x3e, 0xab, 0x8b, 0x3e, 0xab, 0x83, 0x3e, 0xab, 0x78, 0x3e, 0xab, 0x6f, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x5b, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x4b, 0xfe, 0x83, 0xc8, 0x1f, 0x84, 0xff, 0x1e, 0x84, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xdf, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x5f, 0xb4, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xf4, 0x3e, 0xab, 0x9c, 0x3e, 0xab, 0x8f, 0x3e, 0xab, 0x84, 0x3e, 0xab, 0x7c, 0x3e, 0xab, 0x73, 0x3e, 0xab, 0x68, 0x3e, 0xab, 0x60, 0x3e, 0xab, 0x57, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x47, 0x7e, 0xa3, 0x5f, 0xfe, 0x83, 0xec, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0x1f, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x7f, 0xb4, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xbb, 0x3e, 0xab, 0x90, 0x3e, 0xab, 0x88, 0x3e, 0xab, 0x7f, 0x3e, 0xab, 0x77, 0x3e, 0xab, 0x6c, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x5b, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x4b, 0xbe, 0x93, 0x87, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xbf, 0x9c, 0xff, 0x1f, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0x7f, 0xb4, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xd3, 0x3e, 0xab, 0x93, 0x3e, 0xab, 0x8b, 0x3e, 0xab, 0x83, 0x3e, 0xab, 0x78, 0x3e, 0xab, 0x70, 0x3e, 0xab, 0x67, 0x3e, 0xab, 0x5f, 0x3e, 0xab, 0x57, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x4f, 0xbe, 0x93, 0xa3, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x8b, 0xff, 0xfe, 0x8b, 0xff, 0xfe, 0x8b, 0xff, 0x5f, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xef, 0xff, 0x5f, 0xb4, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xdf, 0x3e, 0xab, 0x94, 0x3e, 0xab, 0x8c, 0x3e, 0xab, 0x84, 0x3e, 0xab, 0x7b, 0x3e, 0xab, 0x73, 0x3e, 0xab, 0x6b, 0x3e, 0xab, 0x60, 0x3e, 0xab, 0x58, 0x3e, 0xab, 0x50, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x50, 0xde, 0x8b, 0xb0, 0xfe, 0x8b, 0xff, 0xfe, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0x7f, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xd5, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xe3, 0x3e, 0xab, 0x94, 0x3e, 0xab, 0x8c, 0x3e, 0xab, 0x84, 0x3e, 0xab, 0x7c, 0x3e, 0xab, 0x74, 0x3e, 0xab, 0x6c, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x5b, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x4b, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x4b, 0x3e, 0xab, 0x53, 0xbe, 0x93, 0xb3, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xbf, 0xa4, 0xff, 0x3f, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xf7, 0xff, 0xbf, 0xbc, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xdf, 0x3e, 0xab, 0x94, 0x3e, 0xab, 0x8c, 0x3e, 0xab, 0x84, 0x3e, 0xab, 0x7f, 0x3e, 0xab, 0x77, 0x3e, 0xab, 0x6f, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x54, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x54, 0x9e, 0x93, 0x94, 0xde, 0x8b, 0xf4, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0x1f, 0xb5, 0xff, 0x5f, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x3f, 0xc5, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xd0, 0x3e, 0xab, 0x93, 0x3e, 0xab, 0x8c, 0x3e, 0xab, 0x84, 0x3e, 0xab, 0x7f, 0x3e, 0xab, 0x77, 0x3e, 0xab, 0x6f, 0x3e, 0xab, 0x67, 0x3e, 0xab, 0x5f, 0x3e, 0xab, 0x57, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x57, 0x7e, 0xa3, 0x73, 0xbe, 0x93, 0xdc, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xff, 0xb4, 0xff, 0x1f, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xf7, 0xff, 0x3f, 0xc5, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xf7, 0x5e, 0xa3, 0xb8, 0x3e, 0xab, 0x90, 0x3e, 0xab, 0x8b, 0x3e, 0xab, 0x84, 0x3e, 0xab, 0x7c, 0x3e, 0xab, 0x77, 0x3e, 0xab, 0x6f, 0x3e, 0xab, 0x67, 0x3e, 0xab, 0x5f, 0x3e, 0xab, 0x58, 0x3e, 0xab, 0x50, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x57, 0x3e, 0xab, 0x5c, 0xbe, 0x93, 0xbb, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xfe, 0x9b, 0xff, 0x9f, 0xc5, 0xff, 0x1f, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xef, 0xff, 0xdf, 0xd5, 0xff, 0x3e, 0xb4, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xdb, 0x3e, 0xab, 0x9b, 0x3e, 0xab, 0x8f, 0x3e, 0xab, 0x88, 0x3e, 0xab, 0x83, 0x3e, 0xab, 0x7b, 0x3e, 0xab, 0x74, 0x3e, 0xab, 0x6f, 0x3e, 0xab, 0x67, 0x3e, 0xab, 0x5f, 0x3e, 0xab, 0x58, 0x3e, 0xab, 0x50, 0x3e, 0xab, 0x4b, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x57, 0x3e, 0xab, 0x5c, 0x9e, 0x9b, 0x97, 0xbe, 0x93, 0xdf, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x7f, 0xac, 0xff, 0x3f, 0xc5, 0xff, 0xff, 0xd5, 0xff, 0x7f, 0xde, 0xff, 0xbf, 0xe6, 0xff, 0xdf, 0xe6, 0xff, 0xbf, 0xe6, 0xff, 0x7f, 0xe6, 0xff, 0x1f, 0xd6, 0xff, 0x5f, 0xc5, 0xff, 0x9f, 0xb4, 0xff, 0x9e, 0xa3, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xf7, 0x5e, 0xa3, 0xbc, 0x3e, 0xab, 0x90, 0x3e, 0xab, 0x8b, 0x3e, 0xab, 0x84, 0x3e, 0xab, 0x7f, 0x3e, 0xab, 0x78, 0x3e, 0xab, 0x73, 0x3e, 0xab, 0x6c, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x5f, 0x3e, 0xab, 0x58, 0x3e, 0xab, 0x50, 0x3e, 0xab, 0x4b, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x54, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x63, 0x7e, 0x9b, 0xa0, 0xbe, 0x93, 0xe4, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xf7, 0x5e, 0xa3, 0xc4, 0x3e, 0xab, 0x90, 0x3e, 0xab, 0x8c, 0x3e, 0xab, 0x87, 0x3e, 0xab, 0x83, 0x3e, 0xab, 0x7c, 0x3e, 0xab, 0x77, 0x3e, 0xab, 0x70, 0x3e, 0xab, 0x6b, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x57, 0x3e, 0xab, 0x50, 0x3e, 0xab, 0x4b, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x54, 0x3e, 0xab, 0x5b, 0x3e, 0xab, 0x60, 0x3e, 0xab, 0x67, 0x7e, 0x9b, 0x9b, 0x9e, 0x9b, 0xc7, 0x9e, 0x93, 0xfb, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xe0, 0x5e, 0xa3, 0xbb, 0x3e, 0xab, 0x8f, 0x3e, 0xab, 0x8b, 0x3e, 0xab, 0x87, 0x3e, 0xab, 0x83, 0x3e, 0xab, 0x7c, 0x3e, 0xab, 0x78, 0x3e, 0xab, 0x73, 0x3e, 0xab, 0x6c, 0x3e, 0xab, 0x67, 0x3e, 0xab, 0x60, 0x3e, 0xab, 0x5b, 0x3e, 0xab, 0x54, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x57, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x63, 0x3e, 0xab, 0x68, 0x3e, 0xab, 0x6c, 0x7e, 0xa3, 0x9c, 0x7e, 0x9b, 0xc0, 0x9e, 0x9b, 0xe0, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xe8, 0x5e, 0xa3, 0xcf, 0x5e, 0xa3, 0xb4, 0x3e, 0xab, 0x93, 0x3e, 0xab, 0x8b, 0x3e, 0xab, 0x88, 0x3e, 0xab, 0x84, 0x3e, 0xab, 0x80, 0x3e, 0xab, 0x7c, 0x3e, 0xab, 0x78, 0x3e, 0xab, 0x73, 0x3e, 0xab, 0x6f, 0x3e, 0xab, 0x68, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x5f, 0x3e, 0xab, 0x58, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x4b, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x54, 0x3e, 0xab, 0x5b, 0x3e, 0xab, 0x5f, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x68, 0x3e, 0xab, 0x6c, 0x3e, 0xab, 0x70, 0x3e, 0xab, 0x77, 0x5e, 0xa3, 0x93, 0x5e, 0xa3, 0xaf, 0x7e, 0xa3, 0xc3, 0x7e, 0xa3, 0xd3, 0x7e, 0xa3, 0xdb, 0x7e, 0xa3, 0xdf, 0x7e, 0xa3, 0xdc, 0x7e, 0xa3, 0xd7, 0x5e, 0xa3, 0xcc, 0x5e, 0xa3, 0xbb, 0x5e, 0xa3, 0xa7, 0x3e, 0xab, 0x8c, 0x3e, 0xab, 0x88, 0x3e, 0xab, 0x87, 0x3e, 0xab, 0x84, 0x3e, 0xab, 0x83, 0x3e, 0xab, 0x80, 0x3e, 0xab, 0x7c, 0x3e, 0xab, 0x7b, 0x3e, 0xab, 0x77, 0x3e, 0xab, 0x73, 0x3e, 0xab, 0x6f, 0x3e, 0xab, 0x6b, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x60, 0x3e, 0xab, 0x5b, 0x3e, 0xab, 0x57, 0x3e, 0xab, 0x50, 0x3e, 0xab, 0x4b, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x50, 0x3e, 0xab, 0x54, 0x3e, 0xab, 0x5b, 0x3e, 0xab, 0x5f, 0x3e, 0xab, 0x63, 0x3e, 0xab, 0x67, 0x3e, 0xab, 0x6b, 0x3e, 0xab, 0x6f, 0x3e, 0xab, 0x73, 0x3e, 0xab, 0x74, 0x3e, 0xab, 0x77, 0x3e, 0xab, 0x78, 0x3e, 0xab, 0x7b, 0x3e, 0xab, 0x7c, 0x3e, 0xab, 0x7f, 0x3e, 0xab, 0x7f, 0x3e, 0xab, 0x7f, 0x3e, 0xab, 0x7f, 0x3e, 0xab, 0x7f, 0x3e, 0xab, 0x7c, 0x3e, 0xab, 0x7c, 0x3e, 0xab, 0x7b, 0x3e, 0xab, 0x78, 0x3e, 0xab, 0x74, 0x3e, 0xab, 0x73, 0x3e, 0xab, 0x6f, 0x3e, 0xab, 0x6c, 0x3e, 0xab, 0x68, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x60, 0x3e, 0xab, 0x5b, 0x3e, 0xab, 0x57, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x50, 0x3e, 0xab, 0x54, 0x3e, 0xab, 0x58, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x60, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x67, 0x3e, 0xab, 0x6b, 0x3e, 0xab, 0x6c, 0x3e, 0xab, 0x6f, 0x3e, 0xab, 0x70, 0x3e, 0xab, 0x70, 0x3e, 0xab, 0x73, 0x3e, 0xab, 0x73, 0x3e, 0xab, 0x73, 0x3e, 0xab, 0x73, 0x3e, 0xab, 0x73, 0x3e, 0xab, 0x70, 0x3e, 0xab, 0x70, 0x3e, 0xab, 0x6f, 0x3e, 0xab, 0x6c, 0x3e, 0xab, 0x6b, 0x3e, 0xab, 0x68, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x60, 0x3e, 0xab, 0x5f, 0x3e, 0xab, 0x5b, 0x3e, 0xab, 0x57, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x50, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x57, 0x3e, 0xab, 0x5b, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x5f, 0x3e, 0xab, 0x60, 0x3e, 0xab, 0x63, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x67, 0x3e, 0xab, 0x67, 0x3e, 0xab, 0x68, 0x3e, 0xab, 0x68, 0x3e, 0xab, 0x68, 0x3e, 0xab, 0x67, 0x3e, 0xab, 0x67, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x64, 0x3e, 0xab, 0x63, 0x3e, 0xab, 0x60, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x5b, 0x3e, 0xab, 0x57, 0x3e, 0xab, 0x54, 0x3e, 0xab, 0x50, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x4b, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x50, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x54, 0x3e, 0xab, 0x57, 0x3e, 0xab, 0x58, 0x3e, 0xab, 0x5b, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x5c, 0x3e, 0xab, 0x5b, 0x3e, 0xab, 0x58, 0x3e, 0xab, 0x57, 0x3e, 0xab, 0x54, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x50, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x4b, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x50, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x53, 0x3e, 0xab, 0x50, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x4f, 0x3e, 0xab, 0x4c, 0x3e, 0xab, 0x4b, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x4b, 0x3e, 0xab, 0x4b, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x48, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x47, 0x3e, 0xab, 0x44, 0x3e, 0xab, 0x43, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x40, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x3f, 0x3e, 0xab, 0x3c, 0x3e, 0xab, 0x3b, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x38, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x37, 0x3e, 0xab, 0x34, 0x3e, 0xab, 0x33, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x30, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x2f, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x2c, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x2b, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x28, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x27, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x24, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x23, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x20, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1f, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1c, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x1b, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x18, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x17, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x14, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x13, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x10, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0f, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0c, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x0b, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x08, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x07, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x04, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x03, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00, 0x3e, 0xab, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format:  Blue: 5 bit Green: 6 bit, Red: 5 bit, Alpha 8 bit  BUT the 2  color bytes are swapped*/
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0x5c, 0xdf, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x3b, 0xab, 0x5e, 0x3c, 0x93, 0xbe, 0x54, 0x84, 0x1f, 0x74, 0x7c, 0x3f, 0x8c, 0x74, 0x5f, 0x97, 0x74, 0x5f, 0x9c, 0x74, 0x3f, 0x9b, 0x7c, 0x3f, 0x90, 0x84, 0x1f, 0x80, 0x8b, 0xde, 0x64, 0xa3, 0x5e, 0x4b, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x38, 0x7c, 0x3f, 0x77, 0x6c, 0x7f, 0xa4, 0x6c, 0x9f, 0xd3, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xdb, 0x74, 0x3f, 0xb0, 0x83, 0xff, 0x87, 0xa3, 0x7e, 0x54, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x4b, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x37, 0x74, 0x5f, 0x84, 0x6c, 0x9f, 0xc8, 0x64, 0xbf, 0xfb, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x5f, 0xdb, 0x84, 0x1f, 0xa0, 0x9b, 0x9e, 0x60, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x4b, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x33, 0x9b, 0x9e, 0x40, 0x6c, 0x7f, 0xa4, 0x64, 0xbf, 0xfc, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x7c, 0x3f, 0xc7, 0x8b, 0xfe, 0x8b, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x4b, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x34, 0x6c, 0x7f, 0x9f, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x7c, 0xff, 0xff, 0x95, 0x9f, 0xff, 0xa5, 0xff, 0xff, 0xae, 0x1f, 0xff, 0xb6, 0x3f, 0xff, 0xb6, 0x1f, 0xff, 0xa5, 0xff, 0xff, 0x9d, 0x9f, 0xff, 0x85, 0x1f, 0xff, 0x74, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x7c, 0x3f, 0xcb, 0x8b, 0xde, 0x8b, 0xab, 0x3e, 0x54, 0xab, 0x3e, 0x50, 0xab, 0x3e, 0x4b, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x30, 0x74, 0x5f, 0x7c, 0x64, 0xbf, 0xec, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x85, 0x3f, 0xff, 0xae, 0x3f, 0xff, 0xdf, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x5f, 0xff, 0xbe, 0x5f, 0xff, 0x95, 0x5f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x84, 0x1f, 0xb3, 0xab, 0x3e, 0x58, 0xab, 0x3e, 0x54, 0xab, 0x3e, 0x50, 0xab, 0x3e, 0x4b, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x33, 0x6c, 0x9f, 0xab, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x6c, 0xdf, 0xff, 0xae, 0x3f, 0xff, 0xef, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0xff, 0xc6, 0x7f, 0xff, 0x84, 0xff, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x7c, 0x1f, 0xd0, 0xa3, 0x7e, 0x6b, 0xab, 0x3e, 0x58, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2f, 0x8b, 0xde, 0x4c, 0x64, 0xbf, 0xd8, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x75, 0x1f, 0xff, 0xbe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xf7, 0x9f, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3f, 0xff, 0x95, 0x3f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xef, 0x93, 0xbe, 0x90, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x57, 0xab, 0x3e, 0x50, 0xab, 0x3e, 0x4b, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2f, 0x7c, 0x1f, 0x63, 0x64, 0xbf, 0xeb, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9f, 0xff, 0xe7, 0x7e, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xe7, 0x5e, 0xff, 0xef, 0x9f, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3f, 0xff, 0x94, 0xff, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x8b, 0xde, 0xa8, 0xab, 0x3e, 0x5f, 0xab, 0x3e, 0x58, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2f, 0x7c, 0x3f, 0x6c, 0x64, 0xbf, 0xef, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x8d, 0x7f, 0xff, 0xe7, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xe7, 0x7e, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xe7, 0x5e, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xa5, 0x7f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x8b, 0xfe, 0xb8, 0xab, 0x3e, 0x63, 0xab, 0x3e, 0x5b, 0xab, 0x3e, 0x54, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2f, 0x7c, 0x3f, 0x64, 0x64, 0xbf, 0xf0, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xe7, 0x5e, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd6, 0xfd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdc, 0xff, 0xce, 0xdc, 0xff, 0xce, 0xdc, 0xff, 0xce, 0xdc, 0xff, 0xce, 0xdc, 0xff, 0xce, 0xdc, 0xff, 0xce, 0xdc, 0xff, 0xce, 0xdc, 0xff, 0xce, 0xdc, 0xff, 0xce, 0xdd, 0xff, 0xd6, 0xfd, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xe7, 0x5e, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x1f, 0xff, 0x7c, 0x1f, 0xff, 0x8b, 0xde, 0xb8, 0xab, 0x3e, 0x63, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x57, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x2c, 0x8b, 0xde, 0x4c, 0x64, 0xbf, 0xeb, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0xae, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7e, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x1d, 0xff, 0xd6, 0xfd, 0xff, 0xce, 0xdc, 0xff, 0xce, 0xdc, 0xff, 0xce, 0xdc, 0xff, 0xce, 0xdc, 0xff, 0xce, 0xdc, 0xff, 0xce, 0xdc, 0xff, 0xce, 0xdc, 0xff, 0xce, 0xdc, 0xff, 0xce, 0xdc, 0xff, 0xce, 0xdc, 0xff, 0xce, 0xdc, 0xff, 0xce, 0xdc, 0xff, 0xce, 0xdc, 0xff, 0xce, 0xdc, 0xff, 0xce, 0xdc, 0xff, 0xce, 0xdc, 0xff, 0xd6, 0xdd, 0xff, 0xd7, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xe7, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xdf, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x1f, 0xff, 0x7c, 0x1f, 0xff, 0x7c, 0x1f, 0xff, 0x84, 0x1f, 0xff, 0x93, 0xbe, 0x9b, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x57, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x30, 0x64, 0x9f, 0xd7, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0xb6, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xe7, 0x5e, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xd7, 0x1d, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xd6, 0xfd, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3e, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x1f, 0xff, 0x94, 0xdf, 0xff, 0x7c, 0x1f, 0xff, 0x84, 0x1f, 0xff, 0x84, 0x1f, 0xff, 0x84, 0x1f, 0xf4, 0x9b, 0x7e, 0x7f, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x57, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x30, 0x6c, 0x7f, 0xab, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0xb6, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x1d, 0xff, 0xd6, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xce, 0xdd, 0xff, 0xd6, 0xfd, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xef, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x1f, 0xff, 0x84, 0x1f, 0xff, 0x84, 0x1f, 0xff, 0x84, 0x1f, 0xff, 0x84, 0x1f, 0xff, 0x8b, 0xfe, 0xdf, 0xab, 0x3e, 0x6c, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x54, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2f, 0x74, 0x5f, 0x7b, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x9d, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xd7, 0x1d, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xdd, 0xff, 0xd6, 0xfd, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xef, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x5f, 0xff, 0x84, 0x1f, 0xff, 0x84, 0x1e, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x8b, 0xde, 0xc0, 0xab, 0x3e, 0x6c, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x54, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x33, 0x64, 0xbf, 0xe8, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x8d, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x1d, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xef, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x7f, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x9b, 0x9e, 0xa0, 0xab, 0x3e, 0x6b, 0xab, 0x3e, 0x63, 0xab, 0x3e, 0x5b, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x4b, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2f, 0x6c, 0x7f, 0x9c, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0xe7, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xe7, 0x5e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x1d, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xdf, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x8b, 0xde, 0xe0, 0xab, 0x3e, 0x70, 0xab, 0x3e, 0x68, 0xab, 0x3e, 0x60, 0xab, 0x3e, 0x57, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x2c, 0x9b, 0x9e, 0x3f, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x3e, 0xff, 0xdf, 0x1d, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd7, 0x1d, 0xff, 0xdf, 0x3d, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x5e, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x3f, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x8b, 0xfe, 0xff, 0x8b, 0xfe, 0xff, 0x9b, 0x9e, 0xa8, 0xab, 0x3e, 0x6f, 0xab, 0x3e, 0x67, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x54, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x30, 0x6c, 0x7f, 0xa4, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x7d, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x9f, 0xff, 0xe7, 0x3e, 0xff, 0xdf, 0x3d, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xdf, 0x1d, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0x3f, 0xff, 0x8b, 0xfe, 0xff, 0x8b, 0xfe, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xe4, 0xab, 0x3e, 0x74, 0xab, 0x3e, 0x6c, 0xab, 0x3e, 0x63, 0xab, 0x3e, 0x5b, 0xab, 0x3e, 0x50, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x33, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0xbe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x3e, 0xff, 0xd7, 0x1d, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xd6, 0xfd, 0xff, 0xdf, 0x1d, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5f, 0xff, 0x8b, 0xfe, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x9b, 0x9e, 0xa4, 0xab, 0x3e, 0x70, 0xab, 0x3e, 0x68, 0xab, 0x3e, 0x5f, 0xab, 0x3e, 0x54, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2f, 0x74, 0x5f, 0x83, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x74, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7e, 0xff, 0xe7, 0x5e, 0xff, 0xdf, 0x3d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd6, 0xfd, 0xff, 0xb5, 0xd9, 0xff, 0xa5, 0x57, 0xff, 0xc6, 0x3a, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xc6, 0x5b, 0xff, 0xa5, 0x57, 0xff, 0xb5, 0xd9, 0xff, 0xd6, 0xfd, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xd7, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0x1f, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x93, 0xbe, 0xcc, 0xab, 0x3e, 0x77, 0xab, 0x3e, 0x6c, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x5b, 0xab, 0x3e, 0x50, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x33, 0x6c, 0x7f, 0xc7, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0xb6, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xd6, 0xdc, 0xff, 0x73, 0x71, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x84, 0x54, 0xff, 0xd7, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0x94, 0x95, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x6b, 0x51, 0xff, 0xce, 0xbc, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x3d, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x3f, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xfb, 0xab, 0x3e, 0x7c, 0xab, 0x3e, 0x73, 0xab, 0x3e, 0x68, 0xab, 0x3e, 0x5f, 0xab, 0x3e, 0x54, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x34, 0x64, 0x9f, 0xfb, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0xef, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x9f, 0xff, 0xe7, 0x5e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0x84, 0x33, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xa5, 0x57, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xad, 0x98, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x7b, 0xf3, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0x3f, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x9b, 0x7e, 0xa7, 0xab, 0x3e, 0x77, 0xab, 0x3e, 0x6c, 0xab, 0x3e, 0x63, 0xab, 0x3e, 0x58, 0xab, 0x3e, 0x50, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x30, 0x7c, 0x3f, 0x73, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x85, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0x5a, 0xaf, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x7b, 0xd2, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0x84, 0x13, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x8e, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xdf, 0x1d, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xbf, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x9b, 0x9e, 0xc7, 0xab, 0x3e, 0x7c, 0xab, 0x3e, 0x70, 0xab, 0x3e, 0x67, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x4b, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x33, 0x74, 0x5f, 0xa4, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0xae, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x5e, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x73, 0x91, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0x7b, 0xd2, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xd6, 0xdd, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3d, 0xff, 0xdf, 0x3e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x7e, 0xff, 0xf7, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x1f, 0xff, 0x8b, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xe4, 0xab, 0x3e, 0x80, 0xab, 0x3e, 0x74, 0xab, 0x3e, 0x6b, 0xab, 0x3e, 0x60, 0xab, 0x3e, 0x57, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x34, 0x6c, 0x7f, 0xd3, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0xdf, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x9f, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x5e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x73, 0x91, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0x7b, 0xd2, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xd6, 0xfd, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0xab, 0x3e, 0x84, 0xab, 0x3e, 0x78, 0xab, 0x3e, 0x6f, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x5b, 0xab, 0x3e, 0x50, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2f, 0xa3, 0x5e, 0x38, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xe7, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x73, 0x91, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0x7b, 0xd2, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xd6, 0xfd, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xdf, 0x3e, 0xff, 0xe7, 0x5e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x9f, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0xa3, 0x5e, 0x9f, 0xab, 0x3e, 0x7c, 0xab, 0x3e, 0x73, 0xab, 0x3e, 0x67, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x30, 0x93, 0xbe, 0x50, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x73, 0x91, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0x7b, 0xd2, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xde, 0xfd, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x3e, 0xff, 0xe7, 0x5e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0x5f, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x9b, 0x7e, 0xb7, 0xab, 0x3e, 0x80, 0xab, 0x3e, 0x74, 0xab, 0x3e, 0x6b, 0xab, 0x3e, 0x5f, 0xab, 0x3e, 0x54, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x33, 0x84, 0x1f, 0x70, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x95, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x73, 0x91, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0x7b, 0xd2, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xde, 0xfd, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xff, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x9b, 0x9e, 0xc8, 0xab, 0x3e, 0x83, 0xab, 0x3e, 0x77, 0xab, 0x3e, 0x6c, 0xab, 0x3e, 0x60, 0xab, 0x3e, 0x57, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x33, 0x7c, 0x3f, 0x88, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0xa5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x73, 0x91, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0x7b, 0xf2, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xdf, 0x1d, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0x7f, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xd8, 0xab, 0x3e, 0x84, 0xab, 0x3e, 0x78, 0xab, 0x3e, 0x6f, 0xab, 0x3e, 0x63, 0xab, 0x3e, 0x58, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x34, 0x7c, 0x3f, 0x93, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0xb6, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x7e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x73, 0x91, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0x7b, 0xf2, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xdf, 0x1d, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x9e, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xbf, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xdf, 0xab, 0x3e, 0x87, 0xab, 0x3e, 0x7b, 0xab, 0x3e, 0x70, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x5b, 0xab, 0x3e, 0x50, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x34, 0x7c, 0x3f, 0x98, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0xb6, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x7e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x73, 0x91, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0x7b, 0xf2, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xdf, 0x1d, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x5e, 0xff, 0xe7, 0x7e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9f, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xff, 0x93, 0x9e, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xe4, 0xab, 0x3e, 0x88, 0xab, 0x3e, 0x7c, 0xab, 0x3e, 0x70, 0xab, 0x3e, 0x67, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x37, 0x7c, 0x3f, 0x97, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0xb6, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x73, 0x91, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0x7b, 0xf2, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xdf, 0x3d, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xe7, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xdf, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xe0, 0xab, 0x3e, 0x88, 0xab, 0x3e, 0x7f, 0xab, 0x3e, 0x73, 0xab, 0x3e, 0x67, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x37, 0x7c, 0x1f, 0x8c, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0xad, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x73, 0xb1, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0x7b, 0xf2, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xe7, 0x3d, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x9f, 0xff, 0xf7, 0x9f, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0x9f, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xdc, 0xab, 0x3e, 0x8b, 0xab, 0x3e, 0x7f, 0xab, 0x3e, 0x73, 0xab, 0x3e, 0x68, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x4b, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x37, 0x83, 0xfe, 0x7b, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x9d, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x9f, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x73, 0xb2, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0x7b, 0xf2, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xe7, 0x3d, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xef, 0x9e, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x1f, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xd0, 0xab, 0x3e, 0x8b, 0xab, 0x3e, 0x7f, 0xab, 0x3e, 0x73, 0xab, 0x3e, 0x68, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x4b, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x37, 0x93, 0xbe, 0x5f, 0x74, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x73, 0xb2, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0x83, 0xf3, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xe7, 0x3d, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9e, 0xff, 0xef, 0x9f, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0x7f, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0xa3, 0x7e, 0xc0, 0xab, 0x3e, 0x8b, 0xab, 0x3e, 0x7f, 0xab, 0x3e, 0x73, 0xab, 0x3e, 0x68, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x4b, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x37, 0xa3, 0x5e, 0x43, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x73, 0xb2, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0x83, 0xf3, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xe7, 0x3e, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xf7, 0x9f, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0xbf, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0xa3, 0x5e, 0xaf, 0xab, 0x3e, 0x88, 0xab, 0x3e, 0x7f, 0xab, 0x3e, 0x73, 0xab, 0x3e, 0x67, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x3f, 0x74, 0x5f, 0xd7, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0xe7, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x7b, 0xb2, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0x83, 0xf3, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xe7, 0x5e, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xef, 0x9f, 0xff, 0xf7, 0x9f, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xbe, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xab, 0x3e, 0x97, 0xab, 0x3e, 0x88, 0xab, 0x3e, 0x7c, 0xab, 0x3e, 0x70, 0xab, 0x3e, 0x67, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x3c, 0x7c, 0x3f, 0xab, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0xbe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0x9f, 0xff, 0xf7, 0x9f, 0xff, 0xf7, 0x9f, 0xff, 0xf7, 0x9f, 0xff, 0xf7, 0x9f, 0xff, 0xf7, 0x9f, 0xff, 0xf7, 0x9f, 0xff, 0xf7, 0x9f, 0xff, 0xf7, 0x9f, 0xff, 0xf7, 0x9f, 0xff, 0xf7, 0x9f, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x7b, 0xb2, 0xff, 0xf7, 0x9f, 0xff, 0xf7, 0x9f, 0xff, 0xf7, 0x9f, 0xff, 0xf7, 0x9f, 0xff, 0xf7, 0x9f, 0xff, 0x83, 0xf3, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xe7, 0x5e, 0xff, 0xf7, 0x9f, 0xff, 0xf7, 0x9f, 0xff, 0xf7, 0x9f, 0xff, 0xf7, 0x9f, 0xff, 0xf7, 0x9f, 0xff, 0xf7, 0x9f, 0xff, 0xf7, 0x9f, 0xff, 0xf7, 0x9f, 0xff, 0xf7, 0x9f, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x1f, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xeb, 0xab, 0x3e, 0x93, 0xab, 0x3e, 0x87, 0xab, 0x3e, 0x7c, 0xab, 0x3e, 0x70, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x5b, 0xab, 0x3e, 0x50, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x3c, 0x8b, 0xfe, 0x7f, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x9d, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x7b, 0xb2, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0x83, 0xf3, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xef, 0x5e, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xdf, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xd3, 0xab, 0x3e, 0x90, 0xab, 0x3e, 0x84, 0xab, 0x3e, 0x7b, 0xab, 0x3e, 0x6f, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x58, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x3b, 0xa3, 0x7e, 0x4c, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x7b, 0xb2, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0x83, 0xf3, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xef, 0x5e, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xac, 0x5e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x5e, 0xbb, 0xab, 0x3e, 0x8f, 0xab, 0x3e, 0x83, 0xab, 0x3e, 0x78, 0xab, 0x3e, 0x6c, 0xab, 0x3e, 0x63, 0xab, 0x3e, 0x58, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x40, 0x7c, 0x3f, 0xd7, 0x74, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0xc6, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0x63, 0x10, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x8c, 0x33, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0x94, 0x95, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x5a, 0xcf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x5f, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xab, 0x3e, 0x9b, 0xab, 0x3e, 0x8b, 0xab, 0x3e, 0x80, 0xab, 0x3e, 0x74, 0xab, 0x3e, 0x6b, 0xab, 0x3e, 0x60, 0xab, 0x3e, 0x54, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x3f, 0x83, 0xff, 0x9b, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x8c, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xad, 0x57, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x8e, 0xff, 0xce, 0x7b, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xd6, 0xbc, 0xff, 0x52, 0x8e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xa4, 0xf6, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0x3f, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xe3, 0xab, 0x3e, 0x93, 0xab, 0x3e, 0x88, 0xab, 0x3e, 0x7c, 0xab, 0x3e, 0x73, 0xab, 0x3e, 0x68, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x4b, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x3c, 0x9b, 0x9e, 0x57, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0xe7, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xbf, 0xff, 0xa5, 0x16, 0xff, 0x5a, 0xae, 0xff, 0x52, 0x6e, 0xff, 0x63, 0x0f, 0xff, 0xbd, 0xf9, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xc6, 0x3a, 0xff, 0x6b, 0x30, 0xff, 0x52, 0x6e, 0xff, 0x5a, 0xae, 0xff, 0x9c, 0xd5, 0xff, 0xf7, 0xbf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xbf, 0xab, 0x3e, 0x8f, 0xab, 0x3e, 0x84, 0xab, 0x3e, 0x7b, 0xab, 0x3e, 0x6f, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x5b, 0xab, 0x3e, 0x50, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x43, 0x84, 0x1f, 0xc7, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x9d, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0xbf, 0xff, 0xef, 0x5e, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0xdf, 0xff, 0xef, 0x5e, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0x3f, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xf7, 0xab, 0x3e, 0x94, 0xab, 0x3e, 0x8b, 0xab, 0x3e, 0x80, 0xab, 0x3e, 0x77, 0xab, 0x3e, 0x6c, 0xab, 0x3e, 0x60, 0xab, 0x3e, 0x57, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x40, 0x8b, 0xde, 0x83, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x1f, 0xff, 0x7c, 0x1f, 0xff, 0xe7, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x5f, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xc7, 0xab, 0x3e, 0x90, 0xab, 0x3e, 0x87, 0xab, 0x3e, 0x7c, 0xab, 0x3e, 0x73, 0xab, 0x3e, 0x68, 0xab, 0x3e, 0x5f, 0xab, 0x3e, 0x54, 0xab, 0x3e, 0x4b, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x44, 0x84, 0x1e, 0xc3, 0x7c, 0x1f, 0xff, 0x7c, 0x1f, 0xff, 0x7c, 0x1f, 0xff, 0x94, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xbf, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xf7, 0xab, 0x3e, 0x97, 0xab, 0x3e, 0x8c, 0xab, 0x3e, 0x83, 0xab, 0x3e, 0x78, 0xab, 0x3e, 0x6f, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x5b, 0xab, 0x3e, 0x50, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x43, 0x93, 0xbe, 0x80, 0x7c, 0x1f, 0xff, 0x7c, 0x1f, 0xff, 0x84, 0x1f, 0xff, 0x84, 0x1f, 0xff, 0xad, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xdf, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xc0, 0xab, 0x3e, 0x90, 0xab, 0x3e, 0x87, 0xab, 0x3e, 0x7c, 0xab, 0x3e, 0x73, 0xab, 0x3e, 0x6b, 0xab, 0x3e, 0x60, 0xab, 0x3e, 0x57, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x47, 0x8b, 0xfe, 0xac, 0x84, 0x1f, 0xff, 0x84, 0x1f, 0xff, 0x84, 0x1f, 0xff, 0x84, 0x1f, 0xff, 0xc6, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x1f, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xdc, 0xab, 0x3e, 0x94, 0xab, 0x3e, 0x8b, 0xab, 0x3e, 0x83, 0xab, 0x3e, 0x78, 0xab, 0x3e, 0x6f, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x5b, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x4b, 0x83, 0xfe, 0xc8, 0x84, 0x1f, 0xff, 0x84, 0x1e, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0xde, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xb4, 0x5f, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xf4, 0xab, 0x3e, 0x9c, 0xab, 0x3e, 0x8f, 0xab, 0x3e, 0x84, 0xab, 0x3e, 0x7c, 0xab, 0x3e, 0x73, 0xab, 0x3e, 0x68, 0xab, 0x3e, 0x60, 0xab, 0x3e, 0x57, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x47, 0xa3, 0x7e, 0x5f, 0x83, 0xfe, 0xec, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0xe7, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xb4, 0x7f, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xbb, 0xab, 0x3e, 0x90, 0xab, 0x3e, 0x88, 0xab, 0x3e, 0x7f, 0xab, 0x3e, 0x77, 0xab, 0x3e, 0x6c, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x5b, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x4b, 0x93, 0xbe, 0x87, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x9c, 0xbf, 0xff, 0xe7, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xb4, 0x7f, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xd3, 0xab, 0x3e, 0x93, 0xab, 0x3e, 0x8b, 0xab, 0x3e, 0x83, 0xab, 0x3e, 0x78, 0xab, 0x3e, 0x70, 0xab, 0x3e, 0x67, 0xab, 0x3e, 0x5f, 0xab, 0x3e, 0x57, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x4f, 0x93, 0xbe, 0xa3, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x8b, 0xfe, 0xff, 0x8b, 0xfe, 0xff, 0x8b, 0xfe, 0xff, 0xd6, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x1f, 0xff, 0xb4, 0x5f, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xdf, 0xab, 0x3e, 0x94, 0xab, 0x3e, 0x8c, 0xab, 0x3e, 0x84, 0xab, 0x3e, 0x7b, 0xab, 0x3e, 0x73, 0xab, 0x3e, 0x6b, 0xab, 0x3e, 0x60, 0xab, 0x3e, 0x58, 0xab, 0x3e, 0x50, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x50, 0x8b, 0xde, 0xb0, 0x8b, 0xfe, 0xff, 0x8b, 0xfe, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0xbd, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xdf, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xe3, 0xab, 0x3e, 0x94, 0xab, 0x3e, 0x8c, 0xab, 0x3e, 0x84, 0xab, 0x3e, 0x7c, 0xab, 0x3e, 0x74, 0xab, 0x3e, 0x6c, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x5b, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x4b, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x4b, 0xab, 0x3e, 0x53, 0x93, 0xbe, 0xb3, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0xa4, 0xbf, 0xff, 0xef, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x5f, 0xff, 0xbc, 0xbf, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xdf, 0xab, 0x3e, 0x94, 0xab, 0x3e, 0x8c, 0xab, 0x3e, 0x84, 0xab, 0x3e, 0x7f, 0xab, 0x3e, 0x77, 0xab, 0x3e, 0x6f, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x54, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x54, 0x93, 0x9e, 0x94, 0x8b, 0xde, 0xf4, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0xb5, 0x1f, 0xff, 0xf7, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xc5, 0x3f, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xd0, 0xab, 0x3e, 0x93, 0xab, 0x3e, 0x8c, 0xab, 0x3e, 0x84, 0xab, 0x3e, 0x7f, 0xab, 0x3e, 0x77, 0xab, 0x3e, 0x6f, 0xab, 0x3e, 0x67, 0xab, 0x3e, 0x5f, 0xab, 0x3e, 0x57, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x57, 0xa3, 0x7e, 0x73, 0x93, 0xbe, 0xdc, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0xb4, 0xff, 0xff, 0xef, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x5f, 0xff, 0xc5, 0x3f, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xf7, 0xa3, 0x5e, 0xb8, 0xab, 0x3e, 0x90, 0xab, 0x3e, 0x8b, 0xab, 0x3e, 0x84, 0xab, 0x3e, 0x7c, 0xab, 0x3e, 0x77, 0xab, 0x3e, 0x6f, 0xab, 0x3e, 0x67, 0xab, 0x3e, 0x5f, 0xab, 0x3e, 0x58, 0xab, 0x3e, 0x50, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x57, 0xab, 0x3e, 0x5c, 0x93, 0xbe, 0xbb, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x9b, 0xfe, 0xff, 0xc5, 0x9f, 0xff, 0xef, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x1f, 0xff, 0xd5, 0xdf, 0xff, 0xb4, 0x3e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xdb, 0xab, 0x3e, 0x9b, 0xab, 0x3e, 0x8f, 0xab, 0x3e, 0x88, 0xab, 0x3e, 0x83, 0xab, 0x3e, 0x7b, 0xab, 0x3e, 0x74, 0xab, 0x3e, 0x6f, 0xab, 0x3e, 0x67, 0xab, 0x3e, 0x5f, 0xab, 0x3e, 0x58, 0xab, 0x3e, 0x50, 0xab, 0x3e, 0x4b, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x57, 0xab, 0x3e, 0x5c, 0x9b, 0x9e, 0x97, 0x93, 0xbe, 0xdf, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0xac, 0x7f, 0xff, 0xc5, 0x3f, 0xff, 0xd5, 0xff, 0xff, 0xde, 0x7f, 0xff, 0xe6, 0xbf, 0xff, 0xe6, 0xdf, 0xff, 0xe6, 0xbf, 0xff, 0xe6, 0x7f, 0xff, 0xd6, 0x1f, 0xff, 0xc5, 0x5f, 0xff, 0xb4, 0x9f, 0xff, 0xa3, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xf7, 0xa3, 0x5e, 0xbc, 0xab, 0x3e, 0x90, 0xab, 0x3e, 0x8b, 0xab, 0x3e, 0x84, 0xab, 0x3e, 0x7f, 0xab, 0x3e, 0x78, 0xab, 0x3e, 0x73, 0xab, 0x3e, 0x6c, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x5f, 0xab, 0x3e, 0x58, 0xab, 0x3e, 0x50, 0xab, 0x3e, 0x4b, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x54, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x63, 0x9b, 0x7e, 0xa0, 0x93, 0xbe, 0xe4, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xf7, 0xa3, 0x5e, 0xc4, 0xab, 0x3e, 0x90, 0xab, 0x3e, 0x8c, 0xab, 0x3e, 0x87, 0xab, 0x3e, 0x83, 0xab, 0x3e, 0x7c, 0xab, 0x3e, 0x77, 0xab, 0x3e, 0x70, 0xab, 0x3e, 0x6b, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x57, 0xab, 0x3e, 0x50, 0xab, 0x3e, 0x4b, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x54, 0xab, 0x3e, 0x5b, 0xab, 0x3e, 0x60, 0xab, 0x3e, 0x67, 0x9b, 0x7e, 0x9b, 0x9b, 0x9e, 0xc7, 0x93, 0x9e, 0xfb, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xe0, 0xa3, 0x5e, 0xbb, 0xab, 0x3e, 0x8f, 0xab, 0x3e, 0x8b, 0xab, 0x3e, 0x87, 0xab, 0x3e, 0x83, 0xab, 0x3e, 0x7c, 0xab, 0x3e, 0x78, 0xab, 0x3e, 0x73, 0xab, 0x3e, 0x6c, 0xab, 0x3e, 0x67, 0xab, 0x3e, 0x60, 0xab, 0x3e, 0x5b, 0xab, 0x3e, 0x54, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x57, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x63, 0xab, 0x3e, 0x68, 0xab, 0x3e, 0x6c, 0xa3, 0x7e, 0x9c, 0x9b, 0x7e, 0xc0, 0x9b, 0x9e, 0xe0, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xe8, 0xa3, 0x5e, 0xcf, 0xa3, 0x5e, 0xb4, 0xab, 0x3e, 0x93, 0xab, 0x3e, 0x8b, 0xab, 0x3e, 0x88, 0xab, 0x3e, 0x84, 0xab, 0x3e, 0x80, 0xab, 0x3e, 0x7c, 0xab, 0x3e, 0x78, 0xab, 0x3e, 0x73, 0xab, 0x3e, 0x6f, 0xab, 0x3e, 0x68, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x5f, 0xab, 0x3e, 0x58, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x4b, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x54, 0xab, 0x3e, 0x5b, 0xab, 0x3e, 0x5f, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x68, 0xab, 0x3e, 0x6c, 0xab, 0x3e, 0x70, 0xab, 0x3e, 0x77, 0xa3, 0x5e, 0x93, 0xa3, 0x5e, 0xaf, 0xa3, 0x7e, 0xc3, 0xa3, 0x7e, 0xd3, 0xa3, 0x7e, 0xdb, 0xa3, 0x7e, 0xdf, 0xa3, 0x7e, 0xdc, 0xa3, 0x7e, 0xd7, 0xa3, 0x5e, 0xcc, 0xa3, 0x5e, 0xbb, 0xa3, 0x5e, 0xa7, 0xab, 0x3e, 0x8c, 0xab, 0x3e, 0x88, 0xab, 0x3e, 0x87, 0xab, 0x3e, 0x84, 0xab, 0x3e, 0x83, 0xab, 0x3e, 0x80, 0xab, 0x3e, 0x7c, 0xab, 0x3e, 0x7b, 0xab, 0x3e, 0x77, 0xab, 0x3e, 0x73, 0xab, 0x3e, 0x6f, 0xab, 0x3e, 0x6b, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x60, 0xab, 0x3e, 0x5b, 0xab, 0x3e, 0x57, 0xab, 0x3e, 0x50, 0xab, 0x3e, 0x4b, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x50, 0xab, 0x3e, 0x54, 0xab, 0x3e, 0x5b, 0xab, 0x3e, 0x5f, 0xab, 0x3e, 0x63, 0xab, 0x3e, 0x67, 0xab, 0x3e, 0x6b, 0xab, 0x3e, 0x6f, 0xab, 0x3e, 0x73, 0xab, 0x3e, 0x74, 0xab, 0x3e, 0x77, 0xab, 0x3e, 0x78, 0xab, 0x3e, 0x7b, 0xab, 0x3e, 0x7c, 0xab, 0x3e, 0x7f, 0xab, 0x3e, 0x7f, 0xab, 0x3e, 0x7f, 0xab, 0x3e, 0x7f, 0xab, 0x3e, 0x7f, 0xab, 0x3e, 0x7c, 0xab, 0x3e, 0x7c, 0xab, 0x3e, 0x7b, 0xab, 0x3e, 0x78, 0xab, 0x3e, 0x74, 0xab, 0x3e, 0x73, 0xab, 0x3e, 0x6f, 0xab, 0x3e, 0x6c, 0xab, 0x3e, 0x68, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x60, 0xab, 0x3e, 0x5b, 0xab, 0x3e, 0x57, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x50, 0xab, 0x3e, 0x54, 0xab, 0x3e, 0x58, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x60, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x67, 0xab, 0x3e, 0x6b, 0xab, 0x3e, 0x6c, 0xab, 0x3e, 0x6f, 0xab, 0x3e, 0x70, 0xab, 0x3e, 0x70, 0xab, 0x3e, 0x73, 0xab, 0x3e, 0x73, 0xab, 0x3e, 0x73, 0xab, 0x3e, 0x73, 0xab, 0x3e, 0x73, 0xab, 0x3e, 0x70, 0xab, 0x3e, 0x70, 0xab, 0x3e, 0x6f, 0xab, 0x3e, 0x6c, 0xab, 0x3e, 0x6b, 0xab, 0x3e, 0x68, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x60, 0xab, 0x3e, 0x5f, 0xab, 0x3e, 0x5b, 0xab, 0x3e, 0x57, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x50, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x57, 0xab, 0x3e, 0x5b, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x5f, 0xab, 0x3e, 0x60, 0xab, 0x3e, 0x63, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x67, 0xab, 0x3e, 0x67, 0xab, 0x3e, 0x68, 0xab, 0x3e, 0x68, 0xab, 0x3e, 0x68, 0xab, 0x3e, 0x67, 0xab, 0x3e, 0x67, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x64, 0xab, 0x3e, 0x63, 0xab, 0x3e, 0x60, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x5b, 0xab, 0x3e, 0x57, 0xab, 0x3e, 0x54, 0xab, 0x3e, 0x50, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x4b, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x50, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x54, 0xab, 0x3e, 0x57, 0xab, 0x3e, 0x58, 0xab, 0x3e, 0x5b, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x5c, 0xab, 0x3e, 0x5b, 0xab, 0x3e, 0x58, 0xab, 0x3e, 0x57, 0xab, 0x3e, 0x54, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x50, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x4b, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x50, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x53, 0xab, 0x3e, 0x50, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x4f, 0xab, 0x3e, 0x4c, 0xab, 0x3e, 0x4b, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x4b, 0xab, 0x3e, 0x4b, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x48, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x47, 0xab, 0x3e, 0x44, 0xab, 0x3e, 0x43, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x40, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x3f, 0xab, 0x3e, 0x3c, 0xab, 0x3e, 0x3b, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x38, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x37, 0xab, 0x3e, 0x34, 0xab, 0x3e, 0x33, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x30, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x2f, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x2c, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x2b, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x28, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x27, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x24, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x23, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x20, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1f, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1c, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x1b, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x18, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x17, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x14, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x13, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x10, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0f, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0c, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x0b, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x08, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x07, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x04, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x03, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00, 0xab, 0x3e, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 32
-  /*Pixel format:  Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha: 8 bit*/
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf8, 0x98, 0x59, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x67, 0xa5, 0x3c, 0xf3, 0x76, 0x8d, 0x54, 0xf5, 0x80, 0x7d, 0x74, 0xf5, 0x85, 0x75, 0x8c, 0xf5, 0x87, 0x74, 0x97, 0xf6, 0x87, 0x73, 0x9c, 0xf6, 0x86, 0x74, 0x9b, 0xf5, 0x84, 0x78, 0x90, 0xf5, 0x80, 0x7e, 0x80, 0xf3, 0x77, 0x8c, 0x64, 0xf1, 0x69, 0xa1, 0x4b, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x38, 0xf5, 0x84, 0x79, 0x77, 0xf6, 0x8b, 0x6c, 0xa4, 0xf7, 0x90, 0x66, 0xd3, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x63, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf7, 0x90, 0x65, 0xff, 0xf7, 0x90, 0x66, 0xff, 0xf7, 0x8f, 0x66, 0xff, 0xf7, 0x8f, 0x67, 0xff, 0xf7, 0x8c, 0x6c, 0xdb, 0xf6, 0x86, 0x74, 0xb0, 0xf5, 0x7e, 0x81, 0x87, 0xf2, 0x6b, 0x9e, 0x54, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x37, 0xf5, 0x88, 0x72, 0x84, 0xf6, 0x90, 0x65, 0xc8, 0xf7, 0x94, 0x61, 0xfb, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x63, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf7, 0x90, 0x65, 0xff, 0xf7, 0x90, 0x65, 0xff, 0xf7, 0x90, 0x66, 0xff, 0xf7, 0x8f, 0x66, 0xff, 0xf7, 0x8f, 0x67, 0xff, 0xf7, 0x8e, 0x68, 0xff, 0xf7, 0x8e, 0x68, 0xff, 0xf7, 0x8e, 0x69, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x89, 0x70, 0xdb, 0xf5, 0x81, 0x7d, 0xa0, 0xf2, 0x6f, 0x99, 0x60, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x33, 0xf3, 0x70, 0x96, 0x40, 0xf7, 0x8c, 0x6a, 0xa4, 0xf7, 0x94, 0x5f, 0xfc, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x63, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf7, 0x90, 0x65, 0xff, 0xf7, 0x90, 0x65, 0xff, 0xf7, 0x90, 0x66, 0xff, 0xf7, 0x8f, 0x67, 0xff, 0xf7, 0x8f, 0x67, 0xff, 0xf7, 0x8e, 0x68, 0xff, 0xf7, 0x8e, 0x68, 0xff, 0xf7, 0x8e, 0x69, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8c, 0x6b, 0xff, 0xf6, 0x8c, 0x6c, 0xff, 0xf6, 0x8b, 0x6c, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf5, 0x86, 0x76, 0xc7, 0xf4, 0x7b, 0x86, 0x8b, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x34, 0xf7, 0x8d, 0x6a, 0x9f, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf8, 0x9e, 0x77, 0xff, 0xf9, 0xaf, 0x8e, 0xff, 0xfa, 0xbc, 0xa1, 0xff, 0xfb, 0xc1, 0xaa, 0xff, 0xfb, 0xc3, 0xad, 0xff, 0xfb, 0xc2, 0xad, 0xff, 0xfa, 0xbc, 0xa4, 0xff, 0xfa, 0xb1, 0x97, 0xff, 0xf8, 0xa0, 0x81, 0xff, 0xf7, 0x90, 0x6d, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8d, 0x6b, 0xff, 0xf6, 0x8c, 0x6b, 0xff, 0xf6, 0x8c, 0x6c, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x8a, 0x6e, 0xff, 0xf6, 0x8a, 0x6f, 0xff, 0xf6, 0x89, 0x6f, 0xff, 0xf5, 0x84, 0x78, 0xcb, 0xf4, 0x79, 0x88, 0x8b, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x30, 0xf6, 0x88, 0x72, 0x7c, 0xf8, 0x94, 0x60, 0xec, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf8, 0xa6, 0x7f, 0xff, 0xfb, 0xc3, 0xa9, 0xff, 0xfd, 0xe6, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe7, 0xe0, 0xff, 0xfb, 0xc7, 0xb8, 0xff, 0xf8, 0xa9, 0x91, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x8b, 0x6e, 0xff, 0xf6, 0x8a, 0x6e, 0xff, 0xf6, 0x8a, 0x6f, 0xff, 0xf6, 0x89, 0x70, 0xff, 0xf6, 0x89, 0x70, 0xff, 0xf6, 0x88, 0x71, 0xff, 0xf6, 0x88, 0x72, 0xff, 0xf5, 0x80, 0x7e, 0xb3, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x33, 0xf7, 0x8f, 0x68, 0xab, 0xf8, 0x94, 0x5e, 0xff, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x98, 0x68, 0xff, 0xfb, 0xc4, 0xaa, 0xff, 0xfe, 0xef, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf6, 0xf4, 0xff, 0xfb, 0xcb, 0xbf, 0xff, 0xf7, 0x9b, 0x84, 0xff, 0xf6, 0x89, 0x70, 0xff, 0xf6, 0x89, 0x71, 0xff, 0xf6, 0x88, 0x71, 0xff, 0xf6, 0x88, 0x72, 0xff, 0xf6, 0x87, 0x73, 0xff, 0xf6, 0x87, 0x73, 0xff, 0xf5, 0x81, 0x7b, 0xd0, 0xf2, 0x6c, 0x9d, 0x6b, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf4, 0x7a, 0x87, 0x4c, 0xf8, 0x93, 0x62, 0xd8, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf8, 0x9f, 0x73, 0xff, 0xfb, 0xcb, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfb, 0xfa, 0xff, 0xfa, 0xf7, 0xf4, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf1, 0xec, 0xff, 0xf6, 0xf1, 0xed, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xfc, 0xfa, 0xf9, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe5, 0xe0, 0xff, 0xf8, 0xa3, 0x91, 0xff, 0xf6, 0x88, 0x72, 0xff, 0xf6, 0x87, 0x73, 0xff, 0xf6, 0x87, 0x74, 0xff, 0xf6, 0x86, 0x74, 0xff, 0xf5, 0x86, 0x75, 0xff, 0xf5, 0x84, 0x78, 0xef, 0xf3, 0x76, 0x8d, 0x90, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf5, 0x82, 0x7b, 0x63, 0xf8, 0x94, 0x60, 0xeb, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xfa, 0xbd, 0x9f, 0xff, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfc, 0xfc, 0xff, 0xf7, 0xf2, 0xee, 0xff, 0xf1, 0xeb, 0xe4, 0xff, 0xec, 0xe3, 0xda, 0xff, 0xeb, 0xe1, 0xd7, 0xff, 0xeb, 0xe1, 0xd7, 0xff, 0xeb, 0xe1, 0xd7, 0xff, 0xeb, 0xe1, 0xd7, 0xff, 0xeb, 0xe1, 0xd7, 0xff, 0xeb, 0xe1, 0xd7, 0xff, 0xeb, 0xe1, 0xd7, 0xff, 0xeb, 0xe1, 0xd7, 0xff, 0xeb, 0xe1, 0xd7, 0xff, 0xec, 0xe2, 0xd8, 0xff, 0xf0, 0xe9, 0xe1, 0xff, 0xf5, 0xf0, 0xeb, 0xff, 0xfc, 0xfa, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe4, 0xdf, 0xff, 0xf8, 0x9d, 0x8d, 0xff, 0xf5, 0x86, 0x75, 0xff, 0xf5, 0x86, 0x75, 0xff, 0xf5, 0x85, 0x76, 0xff, 0xf5, 0x85, 0x77, 0xff, 0xf5, 0x84, 0x77, 0xff, 0xf4, 0x7a, 0x88, 0xa8, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf6, 0x85, 0x77, 0x6c, 0xf8, 0x93, 0x5f, 0xef, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf9, 0xac, 0x85, 0xff, 0xfe, 0xec, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xf2, 0xeb, 0xe3, 0xff, 0xec, 0xe3, 0xd8, 0xff, 0xec, 0xe2, 0xd7, 0xff, 0xeb, 0xe2, 0xd7, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xea, 0xe1, 0xd5, 0xff, 0xea, 0xe0, 0xd4, 0xff, 0xea, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xea, 0xdf, 0xd4, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xeb, 0xe1, 0xd5, 0xff, 0xeb, 0xe2, 0xd6, 0xff, 0xec, 0xe2, 0xd7, 0xff, 0xec, 0xe2, 0xd7, 0xff, 0xec, 0xe2, 0xd7, 0xff, 0xf0, 0xe8, 0xdf, 0xff, 0xf8, 0xf4, 0xf0, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf7, 0xf6, 0xff, 0xf8, 0xac, 0xa1, 0xff, 0xf5, 0x85, 0x76, 0xff, 0xf5, 0x85, 0x77, 0xff, 0xf5, 0x84, 0x78, 0xff, 0xf5, 0x84, 0x78, 0xff, 0xf5, 0x83, 0x79, 0xff, 0xf4, 0x7b, 0x86, 0xb8, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf5, 0x83, 0x7a, 0x64, 0xf7, 0x93, 0x60, 0xf0, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xfa, 0xbb, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf9, 0xf6, 0xff, 0xf1, 0xea, 0xe1, 0xff, 0xec, 0xe3, 0xd8, 0xff, 0xec, 0xe3, 0xd8, 0xff, 0xeb, 0xe2, 0xd6, 0xff, 0xe9, 0xe0, 0xd4, 0xff, 0xe7, 0xdc, 0xce, 0xff, 0xe5, 0xd9, 0xca, 0xff, 0xe4, 0xd8, 0xc9, 0xff, 0xe4, 0xd8, 0xc9, 0xff, 0xe4, 0xd8, 0xc9, 0xff, 0xe4, 0xd8, 0xc9, 0xff, 0xe4, 0xd8, 0xc9, 0xff, 0xe4, 0xd8, 0xc9, 0xff, 0xe4, 0xd8, 0xc9, 0xff, 0xe4, 0xd8, 0xc9, 0xff, 0xe4, 0xd8, 0xc9, 0xff, 0xe5, 0xda, 0xcb, 0xff, 0xe8, 0xde, 0xd1, 0xff, 0xea, 0xe1, 0xd5, 0xff, 0xeb, 0xe2, 0xd7, 0xff, 0xec, 0xe3, 0xd8, 0xff, 0xec, 0xe3, 0xd8, 0xff, 0xee, 0xe7, 0xdd, 0xff, 0xf8, 0xf4, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xc6, 0xc0, 0xff, 0xf5, 0x84, 0x78, 0xff, 0xf5, 0x83, 0x79, 0xff, 0xf5, 0x83, 0x79, 0xff, 0xf5, 0x82, 0x7a, 0xff, 0xf5, 0x82, 0x7b, 0xff, 0xf4, 0x7a, 0x87, 0xb8, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2c, 0xf4, 0x7a, 0x88, 0x4c, 0xf7, 0x93, 0x61, 0xeb, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xfb, 0xc6, 0xab, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xf3, 0xee, 0xe8, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xeb, 0xe3, 0xd9, 0xff, 0xea, 0xe1, 0xd6, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe4, 0xd9, 0xcb, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe4, 0xd8, 0xca, 0xff, 0xe5, 0xda, 0xcd, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xf0, 0xea, 0xe2, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xd7, 0xd4, 0xff, 0xf5, 0x83, 0x7a, 0xff, 0xf5, 0x82, 0x7a, 0xff, 0xf5, 0x82, 0x7b, 0xff, 0xf5, 0x81, 0x7c, 0xff, 0xf5, 0x81, 0x7d, 0xff, 0xf3, 0x74, 0x90, 0x9b, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x30, 0xf7, 0x92, 0x63, 0xd7, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xfb, 0xcb, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xee, 0xe7, 0xde, 0xff, 0xec, 0xe4, 0xd9, 0xff, 0xec, 0xe3, 0xd8, 0xff, 0xe9, 0xdf, 0xd3, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe5, 0xd9, 0xcb, 0xff, 0xe6, 0xdb, 0xcd, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe4, 0xd9, 0xff, 0xed, 0xe5, 0xdb, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe2, 0xe0, 0xff, 0xf7, 0x98, 0x92, 0xff, 0xf5, 0x81, 0x7c, 0xff, 0xf5, 0x81, 0x7d, 0xff, 0xf5, 0x80, 0x7e, 0xff, 0xf5, 0x7f, 0x80, 0xf4, 0xf2, 0x6c, 0x9c, 0x7f, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x30, 0xf6, 0x8e, 0x68, 0xab, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xfb, 0xc6, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xed, 0xe5, 0xdb, 0xff, 0xec, 0xe3, 0xda, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xe6, 0xda, 0xce, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe5, 0xd9, 0xcc, 0xff, 0xe7, 0xdc, 0xd0, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xec, 0xe4, 0xda, 0xff, 0xec, 0xe4, 0xda, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe2, 0xe1, 0xff, 0xf5, 0x81, 0x7d, 0xff, 0xf5, 0x80, 0x7e, 0xff, 0xf5, 0x80, 0x7f, 0xff, 0xf5, 0x7f, 0x7f, 0xff, 0xf4, 0x7c, 0x85, 0xdf, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf5, 0x87, 0x72, 0x7b, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xfa, 0xba, 0x9b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xed, 0xe4, 0xdc, 0xff, 0xed, 0xe4, 0xdb, 0xff, 0xea, 0xe0, 0xd4, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe6, 0xda, 0xcd, 0xff, 0xe7, 0xdc, 0xd0, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xed, 0xe4, 0xdb, 0xff, 0xed, 0xe4, 0xdb, 0xff, 0xf4, 0xef, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xc8, 0xc7, 0xff, 0xf5, 0x7f, 0x7f, 0xff, 0xf4, 0x7f, 0x80, 0xff, 0xf4, 0x7e, 0x80, 0xff, 0xf4, 0x7e, 0x81, 0xff, 0xf3, 0x78, 0x8c, 0xc0, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x33, 0xf7, 0x93, 0x62, 0xe8, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf9, 0xab, 0x86, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdb, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe6, 0xdb, 0xce, 0xff, 0xe7, 0xdc, 0xd0, 0xff, 0xeb, 0xe2, 0xd7, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xad, 0xae, 0xff, 0xf4, 0x7e, 0x81, 0xff, 0xf4, 0x7e, 0x81, 0xff, 0xf4, 0x7d, 0x82, 0xff, 0xf4, 0x7d, 0x83, 0xff, 0xf3, 0x71, 0x95, 0xa0, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf6, 0x8c, 0x6c, 0x9c, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xfe, 0xeb, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xef, 0xe7, 0xdd, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xea, 0xe1, 0xd6, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe7, 0xdc, 0xcf, 0xff, 0xe8, 0xdd, 0xd0, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xee, 0xe6, 0xdc, 0xff, 0xee, 0xe6, 0xdc, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x98, 0x9b, 0xff, 0xf4, 0x7d, 0x82, 0xff, 0xf4, 0x7d, 0x83, 0xff, 0xf4, 0x7c, 0x84, 0xff, 0xf4, 0x79, 0x88, 0xe0, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2c, 0xf2, 0x71, 0x95, 0x3f, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xfa, 0xbc, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xeb, 0xe2, 0xd7, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe7, 0xdd, 0xd0, 0xff, 0xe8, 0xdf, 0xd2, 0xff, 0xec, 0xe4, 0xda, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xef, 0xe7, 0xde, 0xff, 0xfc, 0xfa, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe4, 0xe5, 0xff, 0xf4, 0x7d, 0x83, 0xff, 0xf4, 0x7c, 0x84, 0xff, 0xf4, 0x7c, 0x85, 0xff, 0xf4, 0x7b, 0x85, 0xff, 0xf3, 0x71, 0x95, 0xa8, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x30, 0xf6, 0x8c, 0x6c, 0xa4, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf8, 0x9f, 0x75, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf0, 0xeb, 0xff, 0xee, 0xe6, 0xde, 0xff, 0xec, 0xe3, 0xda, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xe8, 0xdd, 0xd1, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xde, 0xff, 0xf1, 0xea, 0xe4, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xa4, 0xa9, 0xff, 0xf4, 0x7b, 0x85, 0xff, 0xf4, 0x7b, 0x86, 0xff, 0xf4, 0x7a, 0x86, 0xff, 0xf4, 0x78, 0x8b, 0xe4, 0xf1, 0x66, 0xa6, 0x74, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x33, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x63, 0xff, 0xfb, 0xcb, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe6, 0xdd, 0xff, 0xea, 0xdf, 0xd4, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xe9, 0xde, 0xd2, 0xff, 0xeb, 0xe2, 0xd7, 0xff, 0xef, 0xe7, 0xde, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe9, 0xea, 0xff, 0xf4, 0x7b, 0x86, 0xff, 0xf4, 0x7a, 0x87, 0xff, 0xf4, 0x7a, 0x87, 0xff, 0xf4, 0x79, 0x88, 0xff, 0xf2, 0x6f, 0x98, 0xa4, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf5, 0x87, 0x73, 0x83, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x63, 0xff, 0xf7, 0x97, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xed, 0xe7, 0xff, 0xef, 0xe8, 0xe0, 0xff, 0xec, 0xe4, 0xda, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xde, 0xd3, 0xff, 0xca, 0xba, 0xb3, 0xff, 0xbc, 0xaa, 0xa4, 0xff, 0xd3, 0xc5, 0xbd, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xd6, 0xc9, 0xc0, 0xff, 0xbc, 0xaa, 0xa4, 0xff, 0xc9, 0xb9, 0xb2, 0xff, 0xe7, 0xdd, 0xd2, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xe9, 0xdf, 0xd4, 0xff, 0xea, 0xe0, 0xd6, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xef, 0xe8, 0xe0, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9f, 0xa8, 0xff, 0xf4, 0x7a, 0x88, 0xff, 0xf4, 0x79, 0x88, 0xff, 0xf4, 0x79, 0x89, 0xff, 0xf3, 0x74, 0x91, 0xcc, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x33, 0xf6, 0x8e, 0x68, 0xc7, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xfb, 0xc4, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xf0, 0xe9, 0xe1, 0xff, 0xef, 0xe7, 0xde, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xe3, 0xd7, 0xcd, 0xff, 0x89, 0x6e, 0x6e, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x9e, 0x87, 0x84, 0xff, 0xea, 0xdf, 0xd4, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xa6, 0x90, 0x8d, 0xff, 0x6d, 0x4e, 0x51, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x85, 0x69, 0x69, 0xff, 0xdf, 0xd3, 0xc9, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xea, 0xe0, 0xd5, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xf0, 0xe9, 0xe1, 0xff, 0xf0, 0xe9, 0xe1, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe3, 0xe6, 0xff, 0xf4, 0x79, 0x89, 0xff, 0xf4, 0x79, 0x89, 0xff, 0xf4, 0x78, 0x8a, 0xff, 0xf3, 0x78, 0x8c, 0xfb, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x34, 0xf7, 0x91, 0x63, 0xfb, 0xf7, 0x91, 0x64, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf7, 0x90, 0x65, 0xff, 0xfe, 0xee, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf1, 0xe9, 0xe1, 0xff, 0xee, 0xe5, 0xdc, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0x9c, 0x85, 0x82, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xba, 0xa7, 0xa1, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xc1, 0xb0, 0xaa, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x95, 0x7b, 0x7a, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xeb, 0xe1, 0xd6, 0xff, 0xec, 0xe2, 0xd7, 0xff, 0xef, 0xe7, 0xde, 0xff, 0xf1, 0xe9, 0xe1, 0xff, 0xf2, 0xeb, 0xe3, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x83, 0x93, 0xff, 0xf4, 0x78, 0x8a, 0xff, 0xf3, 0x78, 0x8b, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf2, 0x6e, 0x9a, 0xa7, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x30, 0xf5, 0x83, 0x79, 0x73, 0xf7, 0x91, 0x64, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf7, 0x90, 0x65, 0xff, 0xf8, 0xa4, 0x82, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xf1, 0xea, 0xe4, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xeb, 0xe2, 0xd9, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0x75, 0x56, 0x59, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x91, 0x77, 0x76, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0x99, 0x82, 0x80, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6f, 0x4f, 0x52, 0xff, 0xe9, 0xdf, 0xd5, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xeb, 0xe2, 0xd8, 0xff, 0xed, 0xe6, 0xdd, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xb3, 0xbd, 0xff, 0xf3, 0x77, 0x8b, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf3, 0x76, 0x8d, 0xff, 0xf2, 0x71, 0x95, 0xc7, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x33, 0xf6, 0x8a, 0x6f, 0xa4, 0xf7, 0x90, 0x65, 0xff, 0xf7, 0x90, 0x65, 0xff, 0xf7, 0x90, 0x66, 0xff, 0xfb, 0xc2, 0xab, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf1, 0xeb, 0xe4, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8b, 0x70, 0x70, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0x92, 0x79, 0x78, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xe5, 0xda, 0xd1, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xec, 0xe3, 0xd9, 0xff, 0xed, 0xe5, 0xdb, 0xff, 0xf1, 0xea, 0xe2, 0xff, 0xf1, 0xeb, 0xe4, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe0, 0xe5, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf3, 0x76, 0x8d, 0xff, 0xf3, 0x76, 0x8e, 0xff, 0xf3, 0x73, 0x91, 0xe4, 0xf1, 0x66, 0xa6, 0x80, 0xf1, 0x66, 0xa6, 0x74, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x34, 0xf7, 0x8d, 0x69, 0xd3, 0xf7, 0x90, 0x65, 0xff, 0xf7, 0x90, 0x66, 0xff, 0xf7, 0x8f, 0x67, 0xff, 0xfd, 0xe6, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf2, 0xec, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xef, 0xe7, 0xde, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8b, 0x71, 0x70, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0x93, 0x79, 0x79, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xe5, 0xdb, 0xd2, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xed, 0xe4, 0xda, 0xff, 0xf0, 0xe9, 0xe0, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf3, 0xed, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x77, 0x8e, 0xff, 0xf3, 0x76, 0x8e, 0xff, 0xf3, 0x75, 0x8f, 0xff, 0xf3, 0x75, 0x8f, 0xff, 0xf1, 0x66, 0xa6, 0x84, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x67, 0xa4, 0x38, 0xf7, 0x90, 0x66, 0xff, 0xf7, 0x8f, 0x66, 0xff, 0xf7, 0x8f, 0x67, 0xff, 0xf7, 0x90, 0x68, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xed, 0xe8, 0xff, 0xf2, 0xec, 0xe5, 0xff, 0xed, 0xe6, 0xdd, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8b, 0x71, 0x71, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0x93, 0x7a, 0x79, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xe5, 0xdc, 0xd4, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xed, 0xe5, 0xdc, 0xff, 0xef, 0xe9, 0xe1, 0xff, 0xf2, 0xec, 0xe6, 0xff, 0xf2, 0xec, 0xe6, 0xff, 0xfd, 0xfb, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x90, 0xa4, 0xff, 0xf3, 0x75, 0x8f, 0xff, 0xf3, 0x75, 0x8f, 0xff, 0xf3, 0x74, 0x90, 0xff, 0xf2, 0x6a, 0x9f, 0x9f, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x30, 0xf3, 0x76, 0x8d, 0x50, 0xf7, 0x8f, 0x66, 0xff, 0xf7, 0x8f, 0x67, 0xff, 0xf7, 0x8e, 0x68, 0xff, 0xf8, 0x9c, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xf3, 0xed, 0xe6, 0xff, 0xf2, 0xec, 0xe5, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8b, 0x71, 0x71, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0x93, 0x7a, 0x79, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xe6, 0xdd, 0xd5, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xee, 0xe6, 0xdd, 0xff, 0xf0, 0xe9, 0xe1, 0xff, 0xf3, 0xed, 0xe6, 0xff, 0xf3, 0xed, 0xe6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xa8, 0xb9, 0xff, 0xf3, 0x74, 0x90, 0xff, 0xf3, 0x74, 0x90, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf2, 0x6d, 0x9c, 0xb7, 0xf1, 0x66, 0xa6, 0x80, 0xf1, 0x66, 0xa6, 0x74, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x33, 0xf5, 0x80, 0x7f, 0x70, 0xf7, 0x8f, 0x67, 0xff, 0xf7, 0x8e, 0x68, 0xff, 0xf7, 0x8e, 0x68, 0xff, 0xf9, 0xad, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfa, 0xf9, 0xff, 0xf3, 0xee, 0xe8, 0xff, 0xf3, 0xec, 0xe6, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8c, 0x71, 0x72, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0x93, 0x7a, 0x7a, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xe7, 0xde, 0xd7, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xef, 0xe7, 0xdf, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf3, 0xed, 0xe8, 0xff, 0xf3, 0xee, 0xe8, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xbd, 0xca, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf3, 0x73, 0x91, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf2, 0x6f, 0x99, 0xc8, 0xf1, 0x66, 0xa6, 0x83, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x33, 0xf5, 0x84, 0x78, 0x88, 0xf7, 0x8e, 0x68, 0xff, 0xf7, 0x8e, 0x69, 0xff, 0xf7, 0x8d, 0x69, 0xff, 0xfa, 0xba, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xf4, 0xee, 0xe9, 0xff, 0xf3, 0xed, 0xe6, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8c, 0x71, 0x72, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0x94, 0x7b, 0x7a, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xe8, 0xdf, 0xd8, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf0, 0xe8, 0xe0, 0xff, 0xf1, 0xe9, 0xe2, 0xff, 0xf4, 0xee, 0xe8, 0xff, 0xf4, 0xee, 0xe9, 0xff, 0xf8, 0xf4, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xce, 0xd9, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf3, 0x72, 0x93, 0xff, 0xf3, 0x6f, 0x98, 0xd8, 0xf1, 0x66, 0xa6, 0x84, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x34, 0xf6, 0x85, 0x76, 0x93, 0xf7, 0x8e, 0x69, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xfa, 0xbf, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xf4, 0xef, 0xea, 0xff, 0xf3, 0xed, 0xe8, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8c, 0x72, 0x72, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0x94, 0x7b, 0x7b, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xe8, 0xe0, 0xd9, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf0, 0xe9, 0xe2, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf4, 0xee, 0xe9, 0xff, 0xf4, 0xef, 0xea, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xd6, 0xdf, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf3, 0x72, 0x93, 0xff, 0xf3, 0x72, 0x94, 0xff, 0xf3, 0x6f, 0x97, 0xdf, 0xf1, 0x66, 0xa6, 0x87, 0xf1, 0x66, 0xa6, 0x7b, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x34, 0xf6, 0x86, 0x76, 0x98, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8c, 0x6b, 0xff, 0xfa, 0xc2, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xf5, 0xf0, 0xeb, 0xff, 0xf4, 0xee, 0xe8, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8c, 0x72, 0x73, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0x94, 0x7b, 0x7b, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xe9, 0xe1, 0xda, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf1, 0xea, 0xe3, 0xff, 0xf2, 0xeb, 0xe4, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf5, 0xf0, 0xeb, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xde, 0xe5, 0xff, 0xf3, 0x72, 0x93, 0xff, 0xf3, 0x72, 0x94, 0xff, 0xf3, 0x71, 0x95, 0xff, 0xf3, 0x6f, 0x98, 0xe4, 0xf1, 0x66, 0xa6, 0x88, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x37, 0xf5, 0x84, 0x77, 0x97, 0xf6, 0x8d, 0x6b, 0xff, 0xf6, 0x8c, 0x6b, 0xff, 0xf6, 0x8c, 0x6c, 0xff, 0xfa, 0xc0, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf9, 0xf6, 0xff, 0xf6, 0xf1, 0xec, 0xff, 0xf5, 0xf0, 0xe9, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8c, 0x72, 0x73, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0x94, 0x7c, 0x7c, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xea, 0xe3, 0xdb, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf2, 0xec, 0xe4, 0xff, 0xf3, 0xed, 0xe5, 0xff, 0xf5, 0xf1, 0xea, 0xff, 0xf6, 0xf1, 0xec, 0xff, 0xf9, 0xf5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xd7, 0xe1, 0xff, 0xf3, 0x72, 0x94, 0xff, 0xf3, 0x71, 0x95, 0xff, 0xf3, 0x71, 0x95, 0xff, 0xf2, 0x6e, 0x99, 0xe0, 0xf1, 0x66, 0xa6, 0x88, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x37, 0xf5, 0x82, 0x7b, 0x8c, 0xf6, 0x8c, 0x6b, 0xff, 0xf6, 0x8c, 0x6c, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xfa, 0xba, 0xa9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf5, 0xf1, 0xeb, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8c, 0x73, 0x73, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0x94, 0x7c, 0x7c, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xea, 0xe4, 0xdd, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf2, 0xed, 0xe6, 0xff, 0xf3, 0xee, 0xe8, 0xff, 0xf5, 0xf2, 0xec, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xd0, 0xdc, 0xff, 0xf3, 0x71, 0x95, 0xff, 0xf2, 0x71, 0x96, 0xff, 0xf2, 0x70, 0x96, 0xff, 0xf2, 0x6e, 0x9a, 0xdc, 0xf1, 0x66, 0xa6, 0x8b, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x37, 0xf4, 0x7e, 0x81, 0x7b, 0xf6, 0x8b, 0x6c, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x8b, 0x6e, 0xff, 0xf9, 0xae, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfb, 0xfa, 0xff, 0xf6, 0xf3, 0xee, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8d, 0x73, 0x74, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0x94, 0x7c, 0x7c, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xeb, 0xe5, 0xde, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf3, 0xee, 0xe7, 0xff, 0xf4, 0xf0, 0xe9, 0xff, 0xf6, 0xf3, 0xee, 0xff, 0xf6, 0xf3, 0xee, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xc1, 0xd1, 0xff, 0xf2, 0x70, 0x96, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x6c, 0x9c, 0xd0, 0xf1, 0x66, 0xa6, 0x8b, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x37, 0xf3, 0x76, 0x8d, 0x5f, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x8a, 0x6e, 0xff, 0xf6, 0x8a, 0x6f, 0xff, 0xf7, 0x9d, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8d, 0x73, 0x74, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0x95, 0x7d, 0x7d, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xec, 0xe5, 0xe0, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf4, 0xef, 0xe9, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xab, 0xc1, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6b, 0x9f, 0xc0, 0xf1, 0x66, 0xa6, 0x8b, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x69, 0xa2, 0x43, 0xf6, 0x8a, 0x6e, 0xff, 0xf6, 0x8a, 0x6f, 0xff, 0xf6, 0x89, 0x70, 0xff, 0xf6, 0x8b, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf4, 0xf0, 0xff, 0xf8, 0xf4, 0xf0, 0xff, 0xf5, 0xf1, 0xeb, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8d, 0x73, 0x74, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0x95, 0x7d, 0x7d, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xed, 0xe6, 0xe1, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf5, 0xf0, 0xea, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf8, 0xf4, 0xf0, 0xff, 0xf8, 0xf4, 0xf0, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x93, 0xb1, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6f, 0x99, 0xff, 0xf1, 0x69, 0xa1, 0xaf, 0xf1, 0x66, 0xa6, 0x88, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x3f, 0xf6, 0x87, 0x73, 0xd7, 0xf6, 0x89, 0x70, 0xff, 0xf6, 0x89, 0x70, 0xff, 0xf6, 0x88, 0x71, 0xff, 0xfd, 0xe5, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf7, 0xf4, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf6, 0xf3, 0xef, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8d, 0x74, 0x75, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0x95, 0x7d, 0x7e, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xed, 0xe7, 0xe3, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xec, 0xff, 0xf5, 0xf1, 0xed, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x74, 0x9b, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6e, 0x99, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf1, 0x66, 0xa5, 0x97, 0xf1, 0x66, 0xa6, 0x88, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x3c, 0xf5, 0x83, 0x7a, 0xab, 0xf6, 0x89, 0x71, 0xff, 0xf6, 0x88, 0x71, 0xff, 0xf6, 0x88, 0x72, 0xff, 0xfb, 0xc5, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8d, 0x74, 0x75, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0x95, 0x7e, 0x7e, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xee, 0xe8, 0xe4, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf6, 0xf2, 0xed, 0xff, 0xf7, 0xf3, 0xef, 0xff, 0xf8, 0xf5, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xfb, 0xf8, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe2, 0xea, 0xff, 0xf2, 0x6f, 0x99, 0xff, 0xf2, 0x6e, 0x99, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9c, 0xeb, 0xf1, 0x66, 0xa6, 0x93, 0xf1, 0x66, 0xa6, 0x87, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x3c, 0xf4, 0x7b, 0x85, 0x7f, 0xf6, 0x88, 0x72, 0xff, 0xf6, 0x88, 0x72, 0xff, 0xf6, 0x87, 0x73, 0xff, 0xf8, 0xa5, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf7, 0xf4, 0xef, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8d, 0x74, 0x75, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0x96, 0x7e, 0x7e, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xef, 0xe9, 0xe5, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf7, 0xf3, 0xee, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xfd, 0xfb, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xb8, 0xcd, 0xff, 0xf2, 0x6e, 0x99, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6b, 0x9f, 0xd3, 0xf1, 0x66, 0xa6, 0x90, 0xf1, 0x66, 0xa6, 0x84, 0xf1, 0x66, 0xa6, 0x7b, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x3b, 0xf2, 0x6b, 0x9e, 0x4c, 0xf6, 0x87, 0x73, 0xff, 0xf6, 0x87, 0x73, 0xff, 0xf6, 0x86, 0x74, 0xff, 0xf5, 0x86, 0x75, 0xff, 0xfe, 0xf6, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf9, 0xf6, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf8, 0xf6, 0xf3, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x8d, 0x74, 0x76, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0x96, 0x7e, 0x7f, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xef, 0xea, 0xe7, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf7, 0xf5, 0xf1, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x87, 0xab, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf1, 0x69, 0xa2, 0xbb, 0xf1, 0x66, 0xa6, 0x8f, 0xf1, 0x66, 0xa6, 0x83, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x40, 0xf6, 0x85, 0x77, 0xd7, 0xf6, 0x86, 0x74, 0xff, 0xf5, 0x86, 0x75, 0xff, 0xf5, 0x85, 0x76, 0xff, 0xfb, 0xc9, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xf8, 0xf6, 0xf2, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0x7d, 0x61, 0x63, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x9c, 0x86, 0x87, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xa6, 0x92, 0x92, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x75, 0x57, 0x59, 0xff, 0xf7, 0xf4, 0xf0, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf8, 0xf5, 0xf1, 0xff, 0xf9, 0xf6, 0xf3, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe7, 0xee, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6c, 0x9c, 0xff, 0xf1, 0x66, 0xa5, 0x9b, 0xf1, 0x66, 0xa6, 0x8b, 0xf1, 0x66, 0xa6, 0x80, 0xf1, 0x66, 0xa6, 0x74, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x3f, 0xf5, 0x7e, 0x81, 0x9b, 0xf5, 0x86, 0x75, 0xff, 0xf5, 0x85, 0x76, 0xff, 0xf5, 0x85, 0x77, 0xff, 0xf7, 0x97, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfa, 0xf7, 0xff, 0xfb, 0xf9, 0xf6, 0xff, 0xfa, 0xf8, 0xf4, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xb8, 0xa7, 0xa6, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6f, 0x4f, 0x52, 0xff, 0xd6, 0xcc, 0xca, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xde, 0xd5, 0xd2, 0xff, 0x70, 0x51, 0x54, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xaf, 0x9d, 0x9d, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf6, 0xf2, 0xff, 0xf9, 0xf7, 0xf3, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfb, 0xf9, 0xf6, 0xff, 0xfb, 0xf9, 0xf6, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xa5, 0xc1, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6d, 0x9c, 0xff, 0xf2, 0x6c, 0x9c, 0xff, 0xf2, 0x6b, 0x9f, 0xe3, 0xf1, 0x66, 0xa6, 0x93, 0xf1, 0x66, 0xa6, 0x88, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x3c, 0xf2, 0x6f, 0x99, 0x57, 0xf5, 0x85, 0x76, 0xff, 0xf5, 0x85, 0x77, 0xff, 0xf5, 0x84, 0x78, 0xff, 0xf5, 0x84, 0x78, 0xff, 0xfd, 0xe5, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf8, 0xf6, 0xf3, 0xff, 0xb3, 0xa2, 0xa2, 0xff, 0x74, 0x55, 0x58, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x7c, 0x5f, 0x61, 0xff, 0xc9, 0xbc, 0xbb, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xcf, 0xc4, 0xc3, 0xff, 0x7f, 0x63, 0x65, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x72, 0x54, 0x56, 0xff, 0xac, 0x9a, 0x9a, 0xff, 0xf7, 0xf4, 0xf1, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfd, 0xfb, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf2, 0xf6, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6d, 0x9c, 0xff, 0xf2, 0x6c, 0x9c, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf1, 0x69, 0xa2, 0xbf, 0xf1, 0x66, 0xa6, 0x8f, 0xf1, 0x66, 0xa6, 0x84, 0xf1, 0x66, 0xa6, 0x7b, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x43, 0xf5, 0x80, 0x7d, 0xc7, 0xf5, 0x84, 0x78, 0xff, 0xf5, 0x84, 0x79, 0xff, 0xf5, 0x83, 0x79, 0xff, 0xf7, 0xa0, 0x99, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfb, 0xfa, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xfb, 0xfa, 0xf7, 0xff, 0xfa, 0xf8, 0xf6, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xf7, 0xf4, 0xf1, 0xff, 0xee, 0xe9, 0xe7, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xf9, 0xf7, 0xf4, 0xff, 0xee, 0xe9, 0xe7, 0xff, 0xf6, 0xf3, 0xf0, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfa, 0xf8, 0xf5, 0xff, 0xfb, 0xf9, 0xf6, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xfb, 0xfa, 0xf8, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xa6, 0xc2, 0xff, 0xf2, 0x6c, 0x9c, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xf7, 0xf1, 0x66, 0xa6, 0x94, 0xf1, 0x66, 0xa6, 0x8b, 0xf1, 0x66, 0xa6, 0x80, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x40, 0xf3, 0x79, 0x89, 0x83, 0xf5, 0x83, 0x79, 0xff, 0xf5, 0x83, 0x7a, 0xff, 0xf5, 0x82, 0x7a, 0xff, 0xf5, 0x82, 0x7b, 0xff, 0xfd, 0xe2, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfc, 0xfa, 0xf9, 0xff, 0xfc, 0xfa, 0xf9, 0xff, 0xfc, 0xf9, 0xf8, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf8, 0xf6, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf9, 0xff, 0xfc, 0xfa, 0xf9, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xea, 0xf1, 0xff, 0xf2, 0x6c, 0x9c, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x69, 0xa1, 0xc7, 0xf1, 0x66, 0xa6, 0x90, 0xf1, 0x66, 0xa6, 0x87, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x44, 0xf4, 0x7f, 0x80, 0xc3, 0xf5, 0x82, 0x7b, 0xff, 0xf5, 0x82, 0x7b, 0xff, 0xf5, 0x81, 0x7c, 0xff, 0xf7, 0x97, 0x94, 0xff, 0xfe, 0xf5, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf7, 0xff, 0xfb, 0xf9, 0xf8, 0xff, 0xfc, 0xfa, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfd, 0xfd, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x96, 0xb8, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xf7, 0xf1, 0x66, 0xa6, 0x97, 0xf1, 0x66, 0xa6, 0x8c, 0xf1, 0x66, 0xa6, 0x83, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x43, 0xf3, 0x76, 0x8d, 0x80, 0xf5, 0x82, 0x7b, 0xff, 0xf5, 0x81, 0x7c, 0xff, 0xf5, 0x81, 0x7d, 0xff, 0xf5, 0x80, 0x7e, 0xff, 0xf8, 0xa9, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfd, 0xfb, 0xfa, 0xff, 0xfd, 0xfb, 0xfa, 0xff, 0xfd, 0xfb, 0xf9, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf8, 0xff, 0xfc, 0xfa, 0xf9, 0xff, 0xfd, 0xfb, 0xfa, 0xff, 0xfd, 0xfb, 0xfa, 0xff, 0xfd, 0xfb, 0xfa, 0xff, 0xfe, 0xfc, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xb8, 0xd0, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x68, 0xa2, 0xc0, 0xf1, 0x66, 0xa6, 0x90, 0xf1, 0x66, 0xa6, 0x87, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x47, 0xf4, 0x7b, 0x85, 0xac, 0xf5, 0x80, 0x7d, 0xff, 0xf5, 0x80, 0x7e, 0xff, 0xf5, 0x80, 0x7f, 0xff, 0xf5, 0x7f, 0x7f, 0xff, 0xfa, 0xc3, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfb, 0xf9, 0xff, 0xfc, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe0, 0xea, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x69, 0xa1, 0xdc, 0xf1, 0x66, 0xa6, 0x94, 0xf1, 0x66, 0xa6, 0x8b, 0xf1, 0x66, 0xa6, 0x83, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x4b, 0xf4, 0x7d, 0x83, 0xc8, 0xf5, 0x7f, 0x7f, 0xff, 0xf4, 0x7f, 0x80, 0xff, 0xf4, 0x7e, 0x80, 0xff, 0xf4, 0x7e, 0x81, 0xff, 0xfc, 0xd7, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfd, 0xfb, 0xff, 0xfe, 0xfd, 0xfb, 0xff, 0xfe, 0xfd, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xfa, 0xff, 0xfd, 0xfd, 0xfb, 0xff, 0xfe, 0xfd, 0xfb, 0xff, 0xfe, 0xfd, 0xfb, 0xff, 0xfe, 0xfd, 0xfb, 0xff, 0xfe, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf2, 0xf7, 0xff, 0xf5, 0x89, 0xb0, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xf4, 0xf1, 0x66, 0xa6, 0x9c, 0xf1, 0x66, 0xa6, 0x8f, 0xf1, 0x66, 0xa6, 0x84, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x47, 0xf2, 0x6c, 0x9d, 0x5f, 0xf4, 0x7e, 0x82, 0xec, 0xf4, 0x7e, 0x81, 0xff, 0xf4, 0x7e, 0x81, 0xff, 0xf4, 0x7d, 0x82, 0xff, 0xf4, 0x7d, 0x83, 0xff, 0xfc, 0xe1, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfd, 0xfd, 0xfc, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfb, 0xff, 0xfd, 0xfc, 0xfc, 0xff, 0xfd, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf9, 0xfb, 0xff, 0xf5, 0x8d, 0xb4, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf1, 0x68, 0xa3, 0xbb, 0xf1, 0x66, 0xa6, 0x90, 0xf1, 0x66, 0xa6, 0x88, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x4b, 0xf3, 0x73, 0x91, 0x87, 0xf4, 0x7e, 0x82, 0xff, 0xf4, 0x7d, 0x82, 0xff, 0xf4, 0x7d, 0x83, 0xff, 0xf4, 0x7c, 0x84, 0xff, 0xf6, 0x93, 0x9b, 0xff, 0xfc, 0xe0, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf2, 0xf6, 0xff, 0xf5, 0x8c, 0xb4, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf2, 0x69, 0xa2, 0xd3, 0xf1, 0x66, 0xa6, 0x93, 0xf1, 0x66, 0xa6, 0x8b, 0xf1, 0x66, 0xa6, 0x83, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x4f, 0xf3, 0x76, 0x8d, 0xa3, 0xf4, 0x7c, 0x83, 0xff, 0xf4, 0x7c, 0x84, 0xff, 0xf4, 0x7c, 0x85, 0xff, 0xf4, 0x7b, 0x86, 0xff, 0xf4, 0x7b, 0x86, 0xff, 0xfa, 0xc8, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe0, 0xea, 0xff, 0xf5, 0x88, 0xb1, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf2, 0x69, 0xa1, 0xdf, 0xf1, 0x66, 0xa6, 0x94, 0xf1, 0x66, 0xa6, 0x8c, 0xf1, 0x66, 0xa6, 0x84, 0xf1, 0x66, 0xa6, 0x7b, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x50, 0xf3, 0x77, 0x8c, 0xb0, 0xf4, 0x7b, 0x85, 0xff, 0xf4, 0x7b, 0x86, 0xff, 0xf4, 0x7a, 0x87, 0xff, 0xf4, 0x7a, 0x87, 0xff, 0xf4, 0x79, 0x88, 0xff, 0xf8, 0xab, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xb9, 0xd1, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf1, 0x68, 0xa2, 0xe3, 0xf1, 0x66, 0xa6, 0x94, 0xf1, 0x66, 0xa6, 0x8c, 0xf1, 0x66, 0xa6, 0x84, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x74, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x53, 0xf3, 0x76, 0x8e, 0xb3, 0xf4, 0x7a, 0x87, 0xff, 0xf4, 0x7a, 0x88, 0xff, 0xf4, 0x79, 0x88, 0xff, 0xf4, 0x79, 0x89, 0xff, 0xf4, 0x78, 0x8a, 0xff, 0xf6, 0x93, 0xa1, 0xff, 0xfd, 0xe3, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe8, 0xf0, 0xff, 0xf6, 0x94, 0xb9, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf1, 0x68, 0xa2, 0xdf, 0xf1, 0x66, 0xa6, 0x94, 0xf1, 0x66, 0xa6, 0x8c, 0xf1, 0x66, 0xa6, 0x84, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x54, 0xf3, 0x72, 0x94, 0x94, 0xf4, 0x79, 0x8a, 0xf4, 0xf4, 0x79, 0x89, 0xff, 0xf4, 0x78, 0x8a, 0xff, 0xf3, 0x78, 0x8b, 0xff, 0xf3, 0x77, 0x8b, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf7, 0xa0, 0xb0, 0xff, 0xfd, 0xea, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf3, 0xf7, 0xff, 0xf7, 0xa3, 0xc2, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf1, 0x68, 0xa3, 0xd0, 0xf1, 0x66, 0xa6, 0x93, 0xf1, 0x66, 0xa6, 0x8c, 0xf1, 0x66, 0xa6, 0x84, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x57, 0xf2, 0x6c, 0x9d, 0x73, 0xf4, 0x76, 0x8d, 0xdc, 0xf3, 0x78, 0x8b, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf3, 0x76, 0x8d, 0xff, 0xf3, 0x76, 0x8e, 0xff, 0xf3, 0x75, 0x8e, 0xff, 0xf6, 0x9d, 0xaf, 0xff, 0xfd, 0xe2, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe7, 0xef, 0xff, 0xf7, 0xa4, 0xc3, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf1, 0x6a, 0xa1, 0xf7, 0xf1, 0x67, 0xa4, 0xb8, 0xf1, 0x66, 0xa6, 0x90, 0xf1, 0x66, 0xa6, 0x8b, 0xf1, 0x66, 0xa6, 0x84, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x5c, 0xf3, 0x73, 0x92, 0xbb, 0xf3, 0x76, 0x8d, 0xff, 0xf3, 0x76, 0x8d, 0xff, 0xf3, 0x76, 0x8e, 0xff, 0xf3, 0x75, 0x8f, 0xff, 0xf3, 0x75, 0x8f, 0xff, 0xf3, 0x74, 0x90, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf4, 0x7e, 0x9a, 0xff, 0xf8, 0xb0, 0xc1, 0xff, 0xfc, 0xdf, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe1, 0xeb, 0xff, 0xf9, 0xb7, 0xce, 0xff, 0xf4, 0x86, 0xae, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf1, 0x68, 0xa2, 0xdb, 0xf1, 0x66, 0xa6, 0x9b, 0xf1, 0x66, 0xa6, 0x8f, 0xf1, 0x66, 0xa6, 0x88, 0xf1, 0x66, 0xa6, 0x83, 0xf1, 0x66, 0xa6, 0x7b, 0xf1, 0x66, 0xa6, 0x74, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x5c, 0xf2, 0x6f, 0x99, 0x97, 0xf3, 0x73, 0x91, 0xdf, 0xf3, 0x75, 0x8f, 0xff, 0xf3, 0x75, 0x90, 0xff, 0xf3, 0x74, 0x90, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf3, 0x72, 0x93, 0xff, 0xf3, 0x72, 0x94, 0xff, 0xf3, 0x72, 0x95, 0xff, 0xf5, 0x8c, 0xa9, 0xff, 0xf7, 0xa6, 0xbe, 0xff, 0xf9, 0xbb, 0xcd, 0xff, 0xfa, 0xcd, 0xda, 0xff, 0xfb, 0xd3, 0xdf, 0xff, 0xfc, 0xd9, 0xe4, 0xff, 0xfb, 0xd5, 0xe1, 0xff, 0xfb, 0xce, 0xdd, 0xff, 0xf9, 0xbf, 0xd3, 0xff, 0xf7, 0xa9, 0xc4, 0xff, 0xf5, 0x90, 0xb3, 0xff, 0xf2, 0x72, 0x9f, 0xff, 0xf2, 0x6c, 0x9c, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf2, 0x6a, 0xa0, 0xf7, 0xf1, 0x68, 0xa3, 0xbc, 0xf1, 0x66, 0xa6, 0x90, 0xf1, 0x66, 0xa6, 0x8b, 0xf1, 0x66, 0xa6, 0x84, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x63, 0xf2, 0x6e, 0x99, 0xa0, 0xf3, 0x73, 0x93, 0xe4, 0xf3, 0x73, 0x91, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf3, 0x73, 0x93, 0xff, 0xf3, 0x72, 0x93, 0xff, 0xf3, 0x72, 0x94, 0xff, 0xf3, 0x71, 0x95, 0xff, 0xf3, 0x71, 0x95, 0xff, 0xf2, 0x70, 0x96, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6e, 0x99, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6d, 0x9c, 0xff, 0xf2, 0x6c, 0x9c, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0x9f, 0xff, 0xf2, 0x6a, 0xa0, 0xff, 0xf2, 0x6a, 0xa0, 0xf7, 0xf1, 0x68, 0xa3, 0xc4, 0xf1, 0x66, 0xa6, 0x90, 0xf1, 0x66, 0xa6, 0x8c, 0xf1, 0x66, 0xa6, 0x87, 0xf1, 0x66, 0xa6, 0x83, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x67, 0xf2, 0x6d, 0x9b, 0x9b, 0xf3, 0x6f, 0x97, 0xc7, 0xf3, 0x72, 0x93, 0xfb, 0xf3, 0x72, 0x94, 0xff, 0xf3, 0x71, 0x95, 0xff, 0xf3, 0x71, 0x95, 0xff, 0xf2, 0x70, 0x96, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6f, 0x99, 0xff, 0xf2, 0x6e, 0x99, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6d, 0x9c, 0xff, 0xf2, 0x6c, 0x9c, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf2, 0x6a, 0x9f, 0xff, 0xf2, 0x69, 0xa1, 0xe0, 0xf2, 0x68, 0xa3, 0xbb, 0xf1, 0x66, 0xa6, 0x8f, 0xf1, 0x66, 0xa6, 0x8b, 0xf1, 0x66, 0xa6, 0x87, 0xf1, 0x66, 0xa6, 0x83, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x6c, 0xf2, 0x6b, 0x9e, 0x9c, 0xf2, 0x6e, 0x9b, 0xc0, 0xf2, 0x6f, 0x98, 0xe0, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6f, 0x99, 0xff, 0xf2, 0x6e, 0x99, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6d, 0x9c, 0xff, 0xf2, 0x6c, 0x9c, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6a, 0x9f, 0xe8, 0xf2, 0x69, 0xa1, 0xcf, 0xf1, 0x68, 0xa3, 0xb4, 0xf1, 0x66, 0xa6, 0x93, 0xf1, 0x66, 0xa6, 0x8b, 0xf1, 0x66, 0xa6, 0x88, 0xf1, 0x66, 0xa6, 0x84, 0xf1, 0x66, 0xa6, 0x80, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x69, 0xa1, 0x93, 0xf2, 0x6a, 0x9f, 0xaf, 0xf2, 0x6b, 0x9e, 0xc3, 0xf2, 0x6c, 0x9d, 0xd3, 0xf2, 0x6c, 0x9d, 0xdb, 0xf2, 0x6c, 0x9d, 0xdf, 0xf2, 0x6c, 0x9e, 0xdc, 0xf2, 0x6b, 0x9e, 0xd7, 0xf2, 0x6a, 0xa0, 0xcc, 0xf2, 0x69, 0xa2, 0xbb, 0xf1, 0x68, 0xa3, 0xa7, 0xf1, 0x66, 0xa6, 0x8c, 0xf1, 0x66, 0xa6, 0x88, 0xf1, 0x66, 0xa6, 0x87, 0xf1, 0x66, 0xa6, 0x84, 0xf1, 0x66, 0xa6, 0x83, 0xf1, 0x66, 0xa6, 0x80, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x7b, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x74, 0xf1, 0x66, 0xa6, 0x77, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x7b, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x7f, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x7c, 0xf1, 0x66, 0xa6, 0x7b, 0xf1, 0x66, 0xa6, 0x78, 0xf1, 0x66, 0xa6, 0x74, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x73, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x70, 0xf1, 0x66, 0xa6, 0x6f, 0xf1, 0x66, 0xa6, 0x6c, 0xf1, 0x66, 0xa6, 0x6b, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x5f, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x68, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x67, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x64, 0xf1, 0x66, 0xa6, 0x63, 0xf1, 0x66, 0xa6, 0x60, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x5c, 0xf1, 0x66, 0xa6, 0x5b, 0xf1, 0x66, 0xa6, 0x58, 0xf1, 0x66, 0xa6, 0x57, 0xf1, 0x66, 0xa6, 0x54, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x53, 0xf1, 0x66, 0xa6, 0x50, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x4f, 0xf1, 0x66, 0xa6, 0x4c, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x4b, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x48, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x47, 0xf1, 0x66, 0xa6, 0x44, 0xf1, 0x66, 0xa6, 0x43, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x40, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3f, 0xf1, 0x66, 0xa6, 0x3c, 0xf1, 0x66, 0xa6, 0x3b, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x38, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x37, 0xf1, 0x66, 0xa6, 0x34, 0xf1, 0x66, 0xa6, 0x33, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x30, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2f, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2c, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x2b, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x28, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x27, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x24, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x23, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x20, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1f, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1c, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x1b, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x18, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x17, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x14, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x13, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x10, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0f, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0c, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x0b, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x08, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x07, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x04, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x03, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00, 0xf1, 0x66, 0xa6, 0x00,
-#endif
-};
-
-const lv_img_dsc_t img_lv_demo_music_btn_list_pause = {
-  .header.always_zero = 0,
-  .header.w = 106,
-  .header.h = 105,
-  .data_size = 11130 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .data = img_lv_demo_music_btn_list_pause_map,
-};
-#endif
-
@@ -1,281 +0,0 @@
-#include "../lv_demo_music.h"
-#if LV_USE_DEMO_MUSIC  && !LV_DEMO_MUSIC_LARGE
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t img_lv_demo_music_btn_next_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x18, 0xfb, 0x30, 0xff, 0x67, 0xff, 0x88, 0xff, 0x94, 0xff, 0x94, 0xff, 0x87, 0xff, 0x63, 0xdb, 0x2c, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xd7, 0x20, 0xff, 0x78, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xff, 0x73, 0xd3, 0x1c, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xff, 0x64, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0x5f, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xd3, 0x1c, 0xff, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xb3, 0x1b, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xd3, 0x1c, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0xb3, 0x1b, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xff, 0xab, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xff, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x63, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xd7, 0x27, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xd7, 0x20, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7c, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xb3, 0x1b, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x17, 0xff, 0x47, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x3b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6a, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xff, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xff, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa8, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xff, 0xa8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x8e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xff, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x44, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xd3, 0x1f, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xb3, 0x1b, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xff, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xfb, 0x34, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xdb, 0x2b, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xb3, 0x1c, 0xff, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xb3, 0x1b, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xdb, 0x2b, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xd7, 0x27, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xdb, 0x2c, 0xff, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xd7, 0x27, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xb3, 0x1c, 0xff, 0x90, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0x87, 0xb3, 0x1b, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xfb, 0x37, 0xff, 0xa4, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0x9f, 0xfb, 0x33, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xd7, 0x20, 0xff, 0x5c, 0xff, 0x90, 0xff, 0xb0, 0xff, 0xc3, 0xff, 0xc3, 0xff, 0xaf, 0xff, 0x8c, 0xff, 0x58, 0xd7, 0x1f, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0xff, 0xd5, 0x30, 0x5f, 0xf7, 0x67, 0x9f, 0xff, 0x88, 0xbf, 0xff, 0x94, 0xbf, 0xff, 0x94, 0x9f, 0xff, 0x87, 0x5f, 0xf7, 0x63, 0xdf, 0xd5, 0x2c, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0xbf, 0xbc, 0x20, 0x7f, 0xf7, 0x78, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x7f, 0xf7, 0x73, 0x7f, 0xb4, 0x1c, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0x3f, 0xf7, 0x64, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x3f, 0xef, 0x5f, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7f, 0xb4, 0x1c, 0xbf, 0xff, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x9c, 0xfe, 0xab, 0x1b, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7f, 0xb4, 0x1c, 0xdf, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xb4, 0xfe, 0xab, 0x1b, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0xbf, 0xff, 0xab, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x9c, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x5f, 0xf7, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xf7, 0x63, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x5f, 0xcd, 0x27, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xbf, 0xbc, 0x20, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x9f, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xf7, 0x7c, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0xde, 0xa3, 0x1b, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1a, 0xc6, 0xff, 0xfc, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x17, 0xdf, 0xee, 0x47, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x71, 0x73, 0xff, 0xf2, 0x83, 0xff, 0x3d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x52, 0xff, 0x33, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xe6, 0x3b, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x9f, 0xf7, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x37, 0xad, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x52, 0xff, 0x13, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xf7, 0x70, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0xbf, 0xff, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x62, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x10, 0x63, 0xff, 0xd9, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x52, 0xff, 0x13, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x94, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0xdf, 0xff, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x62, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xd2, 0x7b, 0xff, 0x9b, 0xd6, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x52, 0xff, 0x13, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xa7, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0xdf, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x62, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x52, 0xff, 0x13, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xa8, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0xbf, 0xff, 0xa8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x62, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x91, 0x73, 0xff, 0x5a, 0xce, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x52, 0xff, 0x13, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x9b, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x9f, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x62, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xef, 0x62, 0xff, 0x98, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x52, 0xff, 0x13, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xf7, 0x78, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x1f, 0xef, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xf6, 0xa4, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x52, 0xff, 0x13, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xe6, 0x44, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x9f, 0xb4, 0x1f, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x6b, 0xff, 0xb2, 0x7b, 0xff, 0xfc, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x52, 0xff, 0x33, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xde, 0xa3, 0x1b, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0xbf, 0xff, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xd6, 0xff, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x8f, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x3f, 0xde, 0x34, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xbf, 0xd5, 0x2b, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x9f, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xf7, 0x7f, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x1e, 0xac, 0x1c, 0xdf, 0xff, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbf, 0xde, 0xa3, 0x1b, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0xbf, 0xd5, 0x2b, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x3f, 0xc5, 0x27, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x9f, 0xcd, 0x2c, 0xff, 0xff, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xc3, 0x5f, 0xcd, 0x27, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x3e, 0xb4, 0x1c, 0xbf, 0xff, 0x90, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9f, 0xff, 0x87, 0xfe, 0xab, 0x1b, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x5f, 0xde, 0x37, 0xbf, 0xff, 0xa4, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xbf, 0xff, 0x9f, 0x1f, 0xde, 0x33, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0xdf, 0xbc, 0x20, 0x3f, 0xef, 0x5c, 0xbf, 0xff, 0x90, 0xdf, 0xff, 0xb0, 0xdf, 0xff, 0xc3, 0xdf, 0xff, 0xc3, 0xdf, 0xff, 0xaf, 0x9f, 0xff, 0x8c, 0x3f, 0xef, 0x58, 0x9f, 0xbc, 0x1f, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xd5, 0xff, 0x30, 0xf7, 0x5f, 0x67, 0xff, 0x9f, 0x88, 0xff, 0xbf, 0x94, 0xff, 0xbf, 0x94, 0xff, 0x9f, 0x87, 0xf7, 0x5f, 0x63, 0xd5, 0xdf, 0x2c, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0xbc, 0xbf, 0x20, 0xf7, 0x7f, 0x78, 0xff, 0xff, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xf7, 0x7f, 0x73, 0xb4, 0x7f, 0x1c, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xf7, 0x3f, 0x64, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xef, 0x3f, 0x5f, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xb4, 0x7f, 0x1c, 0xff, 0xbf, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x9c, 0xab, 0xfe, 0x1b, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xb4, 0x7f, 0x1c, 0xff, 0xdf, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xb4, 0xab, 0xfe, 0x1b, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xff, 0xbf, 0xab, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x9c, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xf7, 0x5f, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x3f, 0x63, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xcd, 0x5f, 0x27, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xbc, 0xbf, 0x20, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xff, 0x9f, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7f, 0x7c, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0xa3, 0xde, 0x1b, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x1a, 0xff, 0xde, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x17, 0xee, 0xdf, 0x47, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x73, 0x71, 0xff, 0x83, 0xf2, 0xff, 0xef, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x8e, 0xff, 0x8c, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x7f, 0x3b, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xf7, 0x9f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xad, 0x37, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x6e, 0xff, 0x84, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7f, 0x70, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xff, 0xbf, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x62, 0xef, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x63, 0x10, 0xff, 0xbd, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x6e, 0xff, 0x84, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x94, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xff, 0xdf, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x62, 0xef, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x7b, 0xd2, 0xff, 0xd6, 0x9b, 0xff, 0xff, 0xff, 0xff, 0x52, 0x6e, 0xff, 0x84, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xa7, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xff, 0xdf, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x62, 0xef, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xff, 0xff, 0xff, 0x52, 0x6e, 0xff, 0x84, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xa8, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xff, 0xbf, 0xa8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x62, 0xef, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x73, 0x91, 0xff, 0xce, 0x5a, 0xff, 0xff, 0xff, 0xff, 0x52, 0x6e, 0xff, 0x84, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x9b, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xff, 0x9f, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x62, 0xef, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x62, 0xef, 0xff, 0xb5, 0x98, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x6e, 0xff, 0x84, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7f, 0x78, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xef, 0x1f, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xa4, 0xf6, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x6e, 0xff, 0x84, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xdf, 0x44, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0xb4, 0x9f, 0x1f, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6b, 0x50, 0xff, 0x7b, 0xb2, 0xff, 0xe6, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x8e, 0xff, 0x8c, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xa3, 0xde, 0x1b, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xff, 0xbf, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x9b, 0xff, 0xef, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x8f, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xde, 0x3f, 0x34, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xd5, 0xbf, 0x2b, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xff, 0x9f, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9f, 0x7f, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xac, 0x1e, 0x1c, 0xff, 0xdf, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xbf, 0xa3, 0xde, 0x1b, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xd5, 0xbf, 0x2b, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xc5, 0x3f, 0x27, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xcd, 0x9f, 0x2c, 0xff, 0xff, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xc3, 0xcd, 0x5f, 0x27, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xb4, 0x3e, 0x1c, 0xff, 0xbf, 0x90, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0x9f, 0x87, 0xab, 0xfe, 0x1b, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0xde, 0x5f, 0x37, 0xff, 0xbf, 0xa4, 0xff, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xbf, 0x9f, 0xde, 0x1f, 0x33, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0xbc, 0xdf, 0x20, 0xef, 0x3f, 0x5c, 0xff, 0xbf, 0x90, 0xff, 0xdf, 0xb0, 0xff, 0xdf, 0xc3, 0xff, 0xdf, 0xc3, 0xff, 0xdf, 0xaf, 0xff, 0x9f, 0x8c, 0xef, 0x3f, 0x58, 0xbc, 0x9f, 0x1f, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 32
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xf9, 0xbc, 0xd2, 0x30, 0xfd, 0xe7, 0xef, 0x67, 0xfe, 0xf1, 0xf6, 0x88, 0xfe, 0xf3, 0xf7, 0x94, 0xfe, 0xf3, 0xf7, 0x94, 0xfe, 0xf1, 0xf5, 0x87, 0xfd, 0xe7, 0xef, 0x63, 0xf9, 0xb7, 0xce, 0x2c, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf6, 0x96, 0xb8, 0x20, 0xfd, 0xed, 0xf3, 0x78, 0xff, 0xfc, 0xfd, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfc, 0xcc, 0xfd, 0xec, 0xf2, 0x73, 0xf5, 0x8b, 0xb1, 0x1c, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xfd, 0xe6, 0xee, 0x64, 0xff, 0xfd, 0xfe, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xe3, 0xfd, 0xe3, 0xec, 0x5f, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf5, 0x8b, 0xb1, 0x1c, 0xfe, 0xf6, 0xf9, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf5, 0xf8, 0x9c, 0xf3, 0x7c, 0xa7, 0x1b, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf5, 0x8b, 0xb1, 0x1c, 0xff, 0xfa, 0xfc, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf8, 0xfa, 0xb4, 0xf3, 0x7c, 0xa7, 0x1b, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xfe, 0xf6, 0xf9, 0xab, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf5, 0xf8, 0x9c, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfd, 0xea, 0xf1, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe6, 0xee, 0x63, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf7, 0xaa, 0xc6, 0x27, 0xff, 0xfe, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xe7, 0xf6, 0x96, 0xb8, 0x20, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfe, 0xf1, 0xf6, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xee, 0xf4, 0x7c, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf3, 0x78, 0xa4, 0x1b, 0xff, 0xfd, 0xfe, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xc2, 0xc3, 0xff, 0xe1, 0xdb, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xd8, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x17, 0xfc, 0xd8, 0xe5, 0x47, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x86, 0x6c, 0x6e, 0xff, 0x93, 0x7b, 0x7d, 0xff, 0xea, 0xe5, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x50, 0x53, 0xff, 0x9a, 0x83, 0x86, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xcc, 0xdd, 0x3b, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfe, 0xef, 0xf4, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6e, 0x4e, 0x51, 0xff, 0xb5, 0xa4, 0xa6, 0xff, 0xfb, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x98, 0x81, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xeb, 0xf2, 0x70, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfe, 0xf6, 0xf9, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0x5c, 0x5e, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x7e, 0x61, 0x64, 0xff, 0xc6, 0xba, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x98, 0x81, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf4, 0xf8, 0x94, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfe, 0xf9, 0xfb, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0x5c, 0x5e, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x90, 0x78, 0x7a, 0xff, 0xda, 0xd2, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x98, 0x81, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf6, 0xf9, 0xa7, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfe, 0xf9, 0xfb, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0x5c, 0x5e, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x98, 0x81, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf6, 0xf9, 0xa8, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfe, 0xf6, 0xf9, 0xa8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0x5c, 0x5e, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x89, 0x6f, 0x72, 0xff, 0xd3, 0xc9, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x98, 0x81, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf5, 0xf8, 0x9b, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfe, 0xf1, 0xf5, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0x5c, 0x5e, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x7a, 0x5c, 0x5f, 0xff, 0xc0, 0xb2, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x98, 0x81, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xed, 0xf3, 0x78, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfc, 0xdf, 0xe9, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xad, 0x9b, 0x9d, 0xff, 0xf7, 0xf5, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x98, 0x81, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xd7, 0xe4, 0x44, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf5, 0x8f, 0xb3, 0x1f, 0xff, 0xfe, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0x69, 0x6b, 0xff, 0x8e, 0x75, 0x77, 0xff, 0xe3, 0xdd, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x51, 0x54, 0xff, 0x9b, 0x85, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xe7, 0xf3, 0x78, 0xa4, 0x1b, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfe, 0xf5, 0xf8, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xd2, 0xd3, 0xff, 0xeb, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf3, 0xf7, 0x8f, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfa, 0xc4, 0xd7, 0x34, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf4, 0xf8, 0xb4, 0xcd, 0x2b, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfe, 0xf1, 0xf6, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xef, 0xf4, 0x7f, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf4, 0x81, 0xaa, 0x1c, 0xff, 0xfa, 0xfc, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfc, 0xbf, 0xf3, 0x78, 0xa4, 0x1b, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf8, 0xb4, 0xcd, 0x2b, 0xff, 0xfc, 0xfd, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xd4, 0xf7, 0xa6, 0xc3, 0x27, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf8, 0xb2, 0xcb, 0x2c, 0xff, 0xfb, 0xfc, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfc, 0xc3, 0xf7, 0xaa, 0xc6, 0x27, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf4, 0x85, 0xad, 0x1c, 0xfe, 0xf3, 0xf7, 0x90, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf7, 0xfe, 0xf1, 0xf5, 0x87, 0xf3, 0x7c, 0xa7, 0x1b, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xfa, 0xc7, 0xd9, 0x37, 0xfe, 0xf6, 0xf9, 0xa4, 0xff, 0xfe, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xf3, 0xfe, 0xf5, 0xf8, 0x9f, 0xfa, 0xc1, 0xd5, 0x33, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf6, 0x98, 0xba, 0x20, 0xfd, 0xe3, 0xec, 0x5c, 0xfe, 0xf3, 0xf7, 0x90, 0xfe, 0xf8, 0xfa, 0xb0, 0xff, 0xfa, 0xfc, 0xc3, 0xff, 0xfa, 0xfc, 0xc3, 0xfe, 0xf8, 0xfa, 0xaf, 0xfe, 0xf2, 0xf6, 0x8c, 0xfd, 0xe3, 0xec, 0x58, 0xf5, 0x92, 0xb6, 0x1f, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-#endif
-};
-
-lv_img_dsc_t img_lv_demo_music_btn_next = {
-  .header.always_zero = 0,
-  .header.w = 62,
-  .header.h = 62,
-  .data_size = 3844 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .data = img_lv_demo_music_btn_next_map,
-};
-
-#endif /*LV_USE_DEMO_MUSIC*/
-
-
@@ -1,341 +0,0 @@
-#include "../lv_demo_music.h"
-#if LV_USE_DEMO_MUSIC  && !LV_DEMO_MUSIC_LARGE
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t img_lv_demo_music_btn_play_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x18, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x1b, 0xaf, 0x1c, 0xaf, 0x1c, 0xaf, 0x1f, 0xaf, 0x1f, 0xaf, 0x1f, 0xaf, 0x20, 0xaf, 0x20, 0xaf, 0x20, 0xaf, 0x20, 0xaf, 0x1f, 0xaf, 0x1f, 0xaf, 0x1c, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x1b, 0xaf, 0x1c, 0x93, 0x44, 0x73, 0x6c, 0x77, 0x8f, 0x77, 0xa3, 0x77, 0xac, 0x77, 0xa8, 0x73, 0xa0, 0x73, 0x8b, 0x93, 0x68, 0x93, 0x3c, 0xaf, 0x24, 0xaf, 0x24, 0xaf, 0x24, 0xaf, 0x23, 0xaf, 0x20, 0xaf, 0x20, 0xaf, 0x1f, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x1c, 0x77, 0x5f, 0x77, 0xaf, 0x77, 0xef, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xdf, 0x73, 0x9f, 0x93, 0x4f, 0xaf, 0x28, 0xaf, 0x27, 0xaf, 0x24, 0xaf, 0x24, 0xaf, 0x23, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x17, 0xb3, 0x1f, 0x77, 0x78, 0x77, 0xe3, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xcb, 0x93, 0x64, 0xaf, 0x2b, 0xaf, 0x28, 0xaf, 0x27, 0xaf, 0x24, 0xaf, 0x23, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0x77, 0x57, 0x77, 0xdc, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0x93, 0xc3, 0x93, 0x4b, 0xaf, 0x2c, 0xaf, 0x2b, 0xaf, 0x27, 0xaf, 0x24, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x14, 0xb3, 0x1c, 0x77, 0x9b, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xf4, 0x93, 0x7c, 0xaf, 0x30, 0xaf, 0x2c, 0xaf, 0x2b, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x14, 0x93, 0x27, 0x77, 0xc7, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xa0, 0xaf, 0x34, 0xaf, 0x2f, 0xaf, 0x2c, 0xaf, 0x28, 0xaf, 0x24, 0xaf, 0x20, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0x93, 0x2b, 0x77, 0xd7, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xb3, 0xaf, 0x37, 0xaf, 0x30, 0xaf, 0x2c, 0xaf, 0x28, 0xaf, 0x24, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0x93, 0x20, 0x77, 0xcf, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xa3, 0xaf, 0x37, 0xaf, 0x33, 0xaf, 0x2f, 0xaf, 0x2b, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x17, 0x77, 0xac, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0x80, 0xaf, 0x37, 0xaf, 0x33, 0xaf, 0x2f, 0xaf, 0x2b, 0xaf, 0x24, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x14, 0x77, 0x70, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xf7, 0xb3, 0x58, 0xaf, 0x37, 0xaf, 0x33, 0xaf, 0x2f, 0xaf, 0x28, 0xaf, 0x24, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0x93, 0x28, 0x77, 0xef, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xc8, 0xaf, 0x3c, 0xaf, 0x37, 0xaf, 0x33, 0xaf, 0x2c, 0xaf, 0x28, 0xaf, 0x24, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x17, 0x77, 0x9f, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0x78, 0xaf, 0x3b, 0xaf, 0x37, 0xaf, 0x30, 0xaf, 0x2c, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0x93, 0x2f, 0x77, 0xf7, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xd4, 0xaf, 0x40, 0xaf, 0x3b, 0xaf, 0x34, 0xaf, 0x2f, 0xaf, 0x2b, 0xaf, 0x24, 0xaf, 0x20, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x17, 0x77, 0x88, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff, 0x73, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xaf, 0x6b, 0xaf, 0x3f, 0xaf, 0x38, 0xaf, 0x33, 0xaf, 0x2c, 0xaf, 0x28, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x18, 0x77, 0xdf, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x97, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xb0, 0xaf, 0x43, 0xaf, 0x3c, 0xaf, 0x37, 0xaf, 0x30, 0xaf, 0x2b, 0xaf, 0x24, 0xaf, 0x20, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x14, 0x73, 0x40, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xeb, 0xaf, 0x44, 0xaf, 0x3f, 0xaf, 0x38, 0xaf, 0x33, 0xaf, 0x2c, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x17, 0x77, 0x7b, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0x63, 0xaf, 0x43, 0xaf, 0x3c, 0xaf, 0x34, 0xaf, 0x2f, 0xaf, 0x28, 0xaf, 0x24, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x18, 0x77, 0xab, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0x88, 0xaf, 0x44, 0xaf, 0x3f, 0xaf, 0x38, 0xaf, 0x30, 0xaf, 0x2b, 0xaf, 0x24, 0xaf, 0x20, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x18, 0x77, 0xcc, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xa4, 0xaf, 0x47, 0xaf, 0x40, 0xaf, 0x3b, 0xaf, 0x33, 0xaf, 0x2c, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1b, 0x77, 0xe4, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xbb, 0xaf, 0x48, 0xaf, 0x43, 0xaf, 0x3c, 0xaf, 0x34, 0xaf, 0x2f, 0xaf, 0x28, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1b, 0x77, 0xf0, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xc3, 0xaf, 0x4b, 0xaf, 0x44, 0xaf, 0x3c, 0xaf, 0x37, 0xaf, 0x30, 0xaf, 0x2b, 0xaf, 0x24, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1c, 0x77, 0xf3, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xc7, 0xaf, 0x4c, 0xaf, 0x44, 0xaf, 0x3f, 0xaf, 0x37, 0xaf, 0x30, 0xaf, 0x2b, 0xaf, 0x24, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1c, 0x77, 0xe8, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0x93, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xc0, 0xaf, 0x4c, 0xaf, 0x47, 0xaf, 0x3f, 0xaf, 0x38, 0xaf, 0x30, 0xaf, 0x2b, 0xaf, 0x24, 0xaf, 0x20, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x18, 0xaf, 0x1c, 0x77, 0xd8, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xb0, 0xaf, 0x4c, 0xaf, 0x47, 0xaf, 0x40, 0xaf, 0x38, 0xaf, 0x33, 0xaf, 0x2b, 0xaf, 0x27, 0xaf, 0x20, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x18, 0xaf, 0x1c, 0x77, 0xb7, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0x98, 0xaf, 0x4c, 0xaf, 0x47, 0xaf, 0x40, 0xaf, 0x38, 0xaf, 0x33, 0xaf, 0x2c, 0xaf, 0x27, 0xaf, 0x20, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x18, 0xaf, 0x1c, 0x73, 0x90, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0x78, 0xaf, 0x4c, 0xaf, 0x47, 0xaf, 0x3f, 0xaf, 0x38, 0xaf, 0x33, 0xaf, 0x2b, 0xaf, 0x24, 0xaf, 0x20, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1c, 0x93, 0x58, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb3, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xf7, 0xaf, 0x54, 0xaf, 0x4c, 0xaf, 0x47, 0xaf, 0x3f, 0xaf, 0x38, 0xaf, 0x30, 0xaf, 0x2b, 0xaf, 0x24, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1b, 0xb3, 0x27, 0x73, 0xf4, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xb3, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xcc, 0xaf, 0x50, 0xaf, 0x4b, 0xaf, 0x44, 0xaf, 0x3f, 0xaf, 0x37, 0xaf, 0x30, 0xaf, 0x2b, 0xaf, 0x24, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x1f, 0x73, 0xaf, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0x90, 0xaf, 0x50, 0xaf, 0x4b, 0xaf, 0x43, 0xaf, 0x3c, 0xaf, 0x37, 0xaf, 0x2f, 0xaf, 0x28, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x1b, 0xaf, 0x1f, 0x93, 0x54, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xf0, 0xaf, 0x58, 0xaf, 0x4f, 0xaf, 0x48, 0xaf, 0x40, 0xaf, 0x3b, 0xaf, 0x34, 0xaf, 0x2f, 0xaf, 0x28, 0xaf, 0x23, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x23, 0x73, 0xcb, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xa4, 0xaf, 0x50, 0xaf, 0x4c, 0xaf, 0x44, 0xaf, 0x3f, 0xaf, 0x38, 0xaf, 0x33, 0xaf, 0x2c, 0xaf, 0x27, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1c, 0xaf, 0x20, 0x93, 0x57, 0x73, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xeb, 0xaf, 0x5b, 0xaf, 0x4f, 0xaf, 0x48, 0xaf, 0x43, 0xaf, 0x3c, 0xaf, 0x37, 0xaf, 0x30, 0xaf, 0x2b, 0xaf, 0x24, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x1f, 0xaf, 0x24, 0x93, 0xa8, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0x8b, 0xaf, 0x50, 0xaf, 0x4c, 0xaf, 0x47, 0xaf, 0x40, 0xaf, 0x3b, 0xaf, 0x34, 0xaf, 0x2f, 0xaf, 0x28, 0xaf, 0x23, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x23, 0xb3, 0x30, 0x93, 0xdf, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xbc, 0xaf, 0x53, 0xaf, 0x4f, 0xaf, 0x48, 0xaf, 0x43, 0xaf, 0x3c, 0xaf, 0x37, 0xaf, 0x30, 0xaf, 0x2b, 0xaf, 0x27, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x20, 0xaf, 0x24, 0x93, 0x4f, 0x93, 0xf3, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xdb, 0xaf, 0x5b, 0xaf, 0x4f, 0xaf, 0x4b, 0xaf, 0x44, 0xaf, 0x3f, 0xaf, 0x3b, 0xaf, 0x34, 0xaf, 0x2f, 0xaf, 0x28, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x23, 0xaf, 0x27, 0x93, 0x63, 0x93, 0xf7, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xe7, 0xaf, 0x63, 0xaf, 0x50, 0xaf, 0x4b, 0xaf, 0x47, 0xaf, 0x40, 0xaf, 0x3c, 0xaf, 0x37, 0xaf, 0x30, 0xaf, 0x2b, 0xaf, 0x27, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x1f, 0xaf, 0x24, 0xaf, 0x28, 0x93, 0x63, 0x93, 0xf3, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xe0, 0xaf, 0x64, 0xaf, 0x50, 0xaf, 0x4c, 0xaf, 0x47, 0xaf, 0x43, 0xaf, 0x3c, 0xaf, 0x38, 0xaf, 0x33, 0xaf, 0x2c, 0xaf, 0x28, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x27, 0xaf, 0x2b, 0xb3, 0x53, 0x93, 0xdf, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xc8, 0xaf, 0x5c, 0xaf, 0x50, 0xaf, 0x4b, 0xaf, 0x47, 0xaf, 0x43, 0xaf, 0x3f, 0xaf, 0x38, 0xaf, 0x34, 0xaf, 0x2f, 0xaf, 0x28, 0xaf, 0x24, 0xaf, 0x20, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x1f, 0xaf, 0x23, 0xaf, 0x27, 0xaf, 0x2c, 0xaf, 0x3b, 0x93, 0xac, 0x93, 0xfc, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xf4, 0xaf, 0x9b, 0xaf, 0x53, 0xaf, 0x4f, 0xaf, 0x4b, 0xaf, 0x47, 0xaf, 0x43, 0xaf, 0x3f, 0xaf, 0x38, 0xaf, 0x34, 0xaf, 0x2f, 0xaf, 0x2b, 0xaf, 0x27, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x1f, 0xaf, 0x24, 0xaf, 0x28, 0xaf, 0x2c, 0xaf, 0x30, 0xb3, 0x60, 0x93, 0xcb, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xfb, 0xaf, 0xbb, 0xaf, 0x63, 0xaf, 0x50, 0xaf, 0x4c, 0xaf, 0x48, 0xaf, 0x44, 0xaf, 0x40, 0xaf, 0x3c, 0xaf, 0x38, 0xaf, 0x34, 0xaf, 0x30, 0xaf, 0x2b, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x24, 0xaf, 0x28, 0xaf, 0x2c, 0xaf, 0x30, 0xaf, 0x34, 0xb3, 0x64, 0xb3, 0xb4, 0x93, 0xf4, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xe8, 0xaf, 0xab, 0xaf, 0x64, 0xaf, 0x4f, 0xaf, 0x4c, 0xaf, 0x4b, 0xaf, 0x47, 0xaf, 0x43, 0xaf, 0x40, 0xaf, 0x3c, 0xaf, 0x38, 0xaf, 0x34, 0xaf, 0x30, 0xaf, 0x2b, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x24, 0xaf, 0x28, 0xaf, 0x2c, 0xaf, 0x30, 0xaf, 0x34, 0xaf, 0x38, 0xaf, 0x40, 0xaf, 0x6f, 0xaf, 0xa3, 0xaf, 0xc3, 0xaf, 0xdf, 0xaf, 0xf0, 0xaf, 0xf8, 0xaf, 0xf4, 0xaf, 0xef, 0xaf, 0xdb, 0xaf, 0xbf, 0xaf, 0x9c, 0xaf, 0x6f, 0xaf, 0x4f, 0xaf, 0x4c, 0xaf, 0x4b, 0xaf, 0x48, 0xaf, 0x47, 0xaf, 0x44, 0xaf, 0x40, 0xaf, 0x3f, 0xaf, 0x3b, 0xaf, 0x37, 0xaf, 0x33, 0xaf, 0x2f, 0xaf, 0x2b, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x24, 0xaf, 0x27, 0xaf, 0x2b, 0xaf, 0x2f, 0xaf, 0x33, 0xaf, 0x34, 0xaf, 0x38, 0xaf, 0x3c, 0xaf, 0x3f, 0xaf, 0x40, 0xaf, 0x43, 0xaf, 0x44, 0xaf, 0x47, 0xaf, 0x48, 0xaf, 0x48, 0xaf, 0x48, 0xaf, 0x48, 0xaf, 0x48, 0xaf, 0x47, 0xaf, 0x47, 0xaf, 0x44, 0xaf, 0x43, 0xaf, 0x40, 0xaf, 0x3f, 0xaf, 0x3b, 0xaf, 0x38, 0xaf, 0x34, 0xaf, 0x30, 0xaf, 0x2f, 0xaf, 0x2b, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x1f, 0xaf, 0x23, 0xaf, 0x27, 0xaf, 0x28, 0xaf, 0x2c, 0xaf, 0x30, 0xaf, 0x33, 0xaf, 0x34, 0xaf, 0x38, 0xaf, 0x3b, 0xaf, 0x3c, 0xaf, 0x3f, 0xaf, 0x40, 0xaf, 0x40, 0xaf, 0x40, 0xaf, 0x43, 0xaf, 0x43, 0xaf, 0x40, 0xaf, 0x40, 0xaf, 0x3f, 0xaf, 0x3f, 0xaf, 0x3c, 0xaf, 0x3b, 0xaf, 0x37, 0xaf, 0x34, 0xaf, 0x33, 0xaf, 0x2f, 0xaf, 0x2c, 0xaf, 0x28, 0xaf, 0x24, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1b, 0xaf, 0x1f, 0xaf, 0x20, 0xaf, 0x24, 0xaf, 0x27, 0xaf, 0x2b, 0xaf, 0x2c, 0xaf, 0x2f, 0xaf, 0x33, 0xaf, 0x34, 0xaf, 0x37, 0xaf, 0x37, 0xaf, 0x38, 0xaf, 0x3b, 0xaf, 0x3b, 0xaf, 0x3b, 0xaf, 0x3b, 0xaf, 0x3b, 0xaf, 0x3b, 0xaf, 0x38, 0xaf, 0x37, 0xaf, 0x34, 0xaf, 0x33, 0xaf, 0x30, 0xaf, 0x2f, 0xaf, 0x2c, 0xaf, 0x28, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x1c, 0xaf, 0x1f, 0xaf, 0x23, 0xaf, 0x24, 0xaf, 0x27, 0xaf, 0x28, 0xaf, 0x2c, 0xaf, 0x2f, 0xaf, 0x2f, 0xaf, 0x30, 0xaf, 0x33, 0xaf, 0x33, 0xaf, 0x34, 0xaf, 0x34, 0xaf, 0x34, 0xaf, 0x33, 0xaf, 0x33, 0xaf, 0x33, 0xaf, 0x30, 0xaf, 0x2f, 0xaf, 0x2c, 0xaf, 0x2b, 0xaf, 0x28, 0xaf, 0x27, 0xaf, 0x24, 0xaf, 0x20, 0xaf, 0x1f, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x1b, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x23, 0xaf, 0x24, 0xaf, 0x27, 0xaf, 0x28, 0xaf, 0x28, 0xaf, 0x2b, 0xaf, 0x2c, 0xaf, 0x2c, 0xaf, 0x2c, 0xaf, 0x2c, 0xaf, 0x2c, 0xaf, 0x2c, 0xaf, 0x2c, 0xaf, 0x2b, 0xaf, 0x2b, 0xaf, 0x28, 0xaf, 0x27, 0xaf, 0x24, 0xaf, 0x23, 0xaf, 0x20, 0xaf, 0x1f, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x1b, 0xaf, 0x1c, 0xaf, 0x1f, 0xaf, 0x20, 0xaf, 0x23, 0xaf, 0x24, 0xaf, 0x24, 0xaf, 0x27, 0xaf, 0x27, 0xaf, 0x27, 0xaf, 0x27, 0xaf, 0x27, 0xaf, 0x27, 0xaf, 0x27, 0xaf, 0x27, 0xaf, 0x24, 0xaf, 0x23, 0xaf, 0x23, 0xaf, 0x20, 0xaf, 0x1f, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x1b, 0xaf, 0x1c, 0xaf, 0x1c, 0xaf, 0x1f, 0xaf, 0x1f, 0xaf, 0x20, 0xaf, 0x20, 0xaf, 0x20, 0xaf, 0x23, 0xaf, 0x23, 0xaf, 0x20, 0xaf, 0x20, 0xaf, 0x20, 0xaf, 0x1f, 0xaf, 0x1f, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x1c, 0xaf, 0x1c, 0xaf, 0x1c, 0xaf, 0x1c, 0xaf, 0x1c, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x18, 0xaf, 0x18, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x1b, 0x7e, 0xa3, 0x1c, 0x5f, 0x74, 0x44, 0x9f, 0x6c, 0x6c, 0x9f, 0x64, 0x8f, 0xbf, 0x64, 0xa3, 0xbf, 0x64, 0xac, 0x9f, 0x64, 0xa8, 0x9f, 0x6c, 0xa0, 0x7f, 0x6c, 0x8b, 0x5f, 0x74, 0x68, 0xfe, 0x8b, 0x3c, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x17, 0x9e, 0xa3, 0x1c, 0x9f, 0x6c, 0x5f, 0xdf, 0x5c, 0xaf, 0xdf, 0x5c, 0xef, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xdf, 0x5f, 0x74, 0x9f, 0xfe, 0x83, 0x4f, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x17, 0xbe, 0x93, 0x1f, 0xbf, 0x64, 0x78, 0xdf, 0x5c, 0xe3, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x5f, 0x74, 0xcb, 0x1e, 0x84, 0x64, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x17, 0x9f, 0x64, 0x57, 0xff, 0x5c, 0xdc, 0xff, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x7c, 0xc3, 0xde, 0x93, 0x4b, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x14, 0xbe, 0x9b, 0x1c, 0xdf, 0x5c, 0x9b, 0xff, 0x54, 0xff, 0xff, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x7c, 0xf4, 0xfe, 0x83, 0x7c, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x14, 0x1e, 0x84, 0x27, 0xff, 0x5c, 0xc7, 0xff, 0x54, 0xff, 0xff, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0xfe, 0x83, 0xa0, 0x5e, 0xa3, 0x34, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x14, 0x3e, 0x7c, 0x2b, 0xff, 0x54, 0xd7, 0xff, 0x54, 0xff, 0xff, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xbf, 0x5c, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0xfe, 0x83, 0xb3, 0x5e, 0xa3, 0x37, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x14, 0xde, 0x8b, 0x20, 0xff, 0x54, 0xcf, 0xff, 0x54, 0xff, 0xff, 0x54, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xbf, 0x5c, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x1e, 0x84, 0xff, 0x1e, 0x84, 0xff, 0xfe, 0x8b, 0xa3, 0x5e, 0xab, 0x37, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x17, 0xdf, 0x5c, 0xac, 0xff, 0x54, 0xff, 0xff, 0x54, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xbf, 0x5c, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x1e, 0x84, 0xff, 0x1e, 0x84, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xde, 0x93, 0x80, 0x5e, 0xab, 0x37, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x14, 0xbf, 0x64, 0x70, 0xff, 0x54, 0xff, 0xff, 0x54, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xbf, 0x5c, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x1e, 0x84, 0xff, 0x1e, 0x84, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x8b, 0xf7, 0x9e, 0x9b, 0x58, 0x5e, 0xab, 0x37, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x14, 0x1e, 0x84, 0x28, 0xff, 0x54, 0xef, 0xff, 0x54, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xbf, 0x5c, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x1e, 0x84, 0xff, 0x1e, 0x84, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xc8, 0x5e, 0xab, 0x3c, 0x5e, 0xab, 0x37, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x17, 0xdf, 0x5c, 0x9f, 0xff, 0x54, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xbf, 0x5c, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x1e, 0x84, 0xff, 0x1e, 0x84, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0x9e, 0x9b, 0x78, 0x5e, 0xab, 0x3b, 0x5e, 0xab, 0x37, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x14, 0x3e, 0x7c, 0x2f, 0xff, 0x54, 0xf7, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xbf, 0x5c, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0xff, 0x7c, 0xff, 0x5f, 0xe7, 0xff, 0x9f, 0xef, 0xff, 0xdf, 0xa5, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x1e, 0x84, 0xff, 0x1e, 0x84, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xbe, 0x93, 0xd4, 0x5e, 0xab, 0x40, 0x5e, 0xab, 0x3b, 0x5e, 0xab, 0x34, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x17, 0xbf, 0x5c, 0x88, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xbf, 0x5c, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xe7, 0xff, 0x3f, 0x95, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x1e, 0x84, 0xff, 0x1e, 0x84, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x9b, 0x6b, 0x5e, 0xab, 0x3f, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x18, 0xdf, 0x5c, 0xdf, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xbf, 0x5c, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xce, 0xff, 0x9f, 0x84, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x1e, 0x84, 0xff, 0x1e, 0x84, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x9b, 0xb0, 0x5e, 0xab, 0x43, 0x5e, 0xab, 0x3c, 0x5e, 0xab, 0x37, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x14, 0x5f, 0x74, 0x40, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xbf, 0x5c, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x1e, 0x84, 0xff, 0x1e, 0x84, 0xff, 0x1e, 0x84, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x9b, 0xeb, 0x5e, 0xab, 0x44, 0x5e, 0xab, 0x3f, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x17, 0xbf, 0x64, 0x7b, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xbf, 0x5c, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xef, 0xff, 0x7f, 0xad, 0xff, 0x1e, 0x84, 0xff, 0x1e, 0x84, 0xff, 0x1e, 0x84, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0xa3, 0x63, 0x5e, 0xab, 0x43, 0x5e, 0xab, 0x3c, 0x5e, 0xab, 0x34, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x18, 0xbf, 0x64, 0xab, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xbf, 0x5c, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xde, 0xff, 0xdf, 0x9c, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0xa3, 0x88, 0x5e, 0xab, 0x44, 0x5e, 0xab, 0x3f, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x18, 0xbf, 0x5c, 0xcc, 0xdf, 0x5c, 0xff, 0xbf, 0x5c, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xce, 0xff, 0x3f, 0x94, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0xa3, 0xa4, 0x5e, 0xab, 0x47, 0x5e, 0xab, 0x40, 0x5e, 0xab, 0x3b, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x1b, 0xbf, 0x5c, 0xe4, 0xbf, 0x5c, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0x7f, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x7f, 0xbd, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xbb, 0x5e, 0xab, 0x48, 0x5e, 0xab, 0x43, 0x5e, 0xab, 0x3c, 0x5e, 0xab, 0x34, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x1b, 0xdf, 0x5c, 0xf0, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x7f, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xef, 0xff, 0x9f, 0xa4, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xc3, 0x5e, 0xab, 0x4b, 0x5e, 0xab, 0x44, 0x5e, 0xab, 0x3c, 0x5e, 0xab, 0x37, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x1c, 0xbf, 0x64, 0xf3, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x7f, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xf7, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xc7, 0x5e, 0xab, 0x4c, 0x5e, 0xab, 0x44, 0x5e, 0xab, 0x3f, 0x5e, 0xab, 0x37, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x1c, 0xbf, 0x64, 0xe8, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xe6, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xc0, 0x5e, 0xab, 0x4c, 0x5e, 0xab, 0x47, 0x5e, 0xab, 0x3f, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x1c, 0xbf, 0x64, 0xd8, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xd6, 0xff, 0xfe, 0x9b, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xb0, 0x5e, 0xab, 0x4c, 0x5e, 0xab, 0x47, 0x5e, 0xab, 0x40, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x1c, 0x9f, 0x6c, 0xb7, 0x9f, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x7c, 0xff, 0x5f, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xff, 0x9f, 0xac, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0x98, 0x5e, 0xab, 0x4c, 0x5e, 0xab, 0x47, 0x5e, 0xab, 0x40, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x1c, 0x7f, 0x6c, 0x90, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x5f, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xf7, 0xff, 0x1f, 0xb5, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0x78, 0x5e, 0xab, 0x4c, 0x5e, 0xab, 0x47, 0x5e, 0xab, 0x3f, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x1c, 0x3f, 0x7c, 0x58, 0x9f, 0x6c, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x5f, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xcd, 0xff, 0xde, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xf7, 0x5e, 0xab, 0x54, 0x5e, 0xab, 0x4c, 0x5e, 0xab, 0x47, 0x5e, 0xab, 0x3f, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x1b, 0x9e, 0x9b, 0x27, 0x9f, 0x6c, 0xf4, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x5f, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xde, 0xff, 0x7f, 0xa4, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xcc, 0x5e, 0xab, 0x50, 0x5e, 0xab, 0x4b, 0x5e, 0xab, 0x44, 0x5e, 0xab, 0x3f, 0x5e, 0xab, 0x37, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1f, 0x7f, 0x74, 0xaf, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x5f, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xef, 0xff, 0xff, 0xac, 0xff, 0xde, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xab, 0x90, 0x5e, 0xab, 0x50, 0x5e, 0xab, 0x4b, 0x5e, 0xab, 0x43, 0x5e, 0xab, 0x3c, 0x5e, 0xab, 0x37, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1f, 0x1e, 0x84, 0x54, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x1e, 0x84, 0xff, 0x7f, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xbd, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xab, 0xf0, 0x5e, 0xab, 0x58, 0x5e, 0xab, 0x4f, 0x5e, 0xab, 0x48, 0x5e, 0xab, 0x40, 0x5e, 0xab, 0x3b, 0x5e, 0xab, 0x34, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x23, 0x5f, 0x74, 0xcb, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x1e, 0x84, 0xff, 0x1e, 0x84, 0xff, 0xdf, 0xbd, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x5f, 0xd6, 0xff, 0x1e, 0x94, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xab, 0xff, 0x5e, 0xab, 0xa4, 0x5e, 0xab, 0x50, 0x5e, 0xab, 0x4c, 0x5e, 0xab, 0x44, 0x5e, 0xab, 0x3f, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x20, 0x1e, 0x84, 0x57, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x1e, 0x84, 0xff, 0x1e, 0x84, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xab, 0xff, 0x3e, 0xab, 0xeb, 0x5e, 0xab, 0x5b, 0x5e, 0xab, 0x4f, 0x5e, 0xab, 0x48, 0x5e, 0xab, 0x43, 0x5e, 0xab, 0x3c, 0x5e, 0xab, 0x37, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x24, 0x3f, 0x7c, 0xa8, 0x5f, 0x74, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x1e, 0x84, 0xff, 0x1e, 0x84, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xab, 0xff, 0x3e, 0xab, 0xff, 0x5e, 0xab, 0x8b, 0x5e, 0xab, 0x50, 0x5e, 0xab, 0x4c, 0x5e, 0xab, 0x47, 0x5e, 0xab, 0x40, 0x5e, 0xab, 0x3b, 0x5e, 0xab, 0x34, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x23, 0x9e, 0x9b, 0x30, 0x3f, 0x7c, 0xdf, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x1e, 0x84, 0xff, 0x1e, 0x84, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xab, 0xff, 0x3e, 0xab, 0xff, 0x3e, 0xab, 0xbc, 0x5e, 0xab, 0x53, 0x5e, 0xab, 0x4f, 0x5e, 0xab, 0x48, 0x5e, 0xab, 0x43, 0x5e, 0xab, 0x3c, 0x5e, 0xab, 0x37, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x24, 0xde, 0x8b, 0x4f, 0x3f, 0x7c, 0xf3, 0x3f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x1e, 0x84, 0xff, 0x1e, 0x84, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xab, 0xff, 0x3e, 0xab, 0xff, 0x3e, 0xab, 0xdb, 0x5e, 0xab, 0x5b, 0x5e, 0xab, 0x4f, 0x5e, 0xab, 0x4b, 0x5e, 0xab, 0x44, 0x5e, 0xab, 0x3f, 0x5e, 0xab, 0x3b, 0x5e, 0xab, 0x34, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x27, 0xde, 0x8b, 0x63, 0x1f, 0x7c, 0xf7, 0x1e, 0x84, 0xff, 0x1e, 0x84, 0xff, 0x1e, 0x84, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xab, 0xff, 0x3e, 0xab, 0xff, 0x3e, 0xab, 0xe7, 0x5e, 0xab, 0x63, 0x5e, 0xab, 0x50, 0x5e, 0xab, 0x4b, 0x5e, 0xab, 0x47, 0x5e, 0xab, 0x40, 0x5e, 0xab, 0x3c, 0x5e, 0xab, 0x37, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x28, 0xde, 0x8b, 0x63, 0x1e, 0x84, 0xf3, 0x1e, 0x84, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xab, 0xff, 0x3e, 0xab, 0xff, 0x3e, 0xab, 0xe0, 0x5e, 0xab, 0x64, 0x5e, 0xab, 0x50, 0x5e, 0xab, 0x4c, 0x5e, 0xab, 0x47, 0x5e, 0xab, 0x43, 0x5e, 0xab, 0x3c, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x2b, 0xbe, 0x93, 0x53, 0xfe, 0x83, 0xdf, 0xfe, 0x83, 0xff, 0xfe, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xab, 0xff, 0x3e, 0xab, 0xff, 0x5e, 0xab, 0xc8, 0x5e, 0xab, 0x5c, 0x5e, 0xab, 0x50, 0x5e, 0xab, 0x4b, 0x5e, 0xab, 0x47, 0x5e, 0xab, 0x43, 0x5e, 0xab, 0x3f, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x34, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x2c, 0x7e, 0xa3, 0x3b, 0xde, 0x8b, 0xac, 0xde, 0x8b, 0xfc, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xab, 0xff, 0x3e, 0xab, 0xf4, 0x5e, 0xab, 0x9b, 0x5e, 0xab, 0x53, 0x5e, 0xab, 0x4f, 0x5e, 0xab, 0x4b, 0x5e, 0xab, 0x47, 0x5e, 0xab, 0x43, 0x5e, 0xab, 0x3f, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x34, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x30, 0x9e, 0x9b, 0x60, 0xde, 0x8b, 0xcb, 0xde, 0x8b, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xfb, 0x5e, 0xab, 0xbb, 0x5e, 0xab, 0x63, 0x5e, 0xab, 0x50, 0x5e, 0xab, 0x4c, 0x5e, 0xab, 0x48, 0x5e, 0xab, 0x44, 0x5e, 0xab, 0x40, 0x5e, 0xab, 0x3c, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x34, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x34, 0x9e, 0x9b, 0x64, 0xbe, 0x93, 0xb4, 0xbe, 0x93, 0xf4, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xe8, 0x5e, 0xa3, 0xab, 0x5e, 0xab, 0x64, 0x5e, 0xab, 0x4f, 0x5e, 0xab, 0x4c, 0x5e, 0xab, 0x4b, 0x5e, 0xab, 0x47, 0x5e, 0xab, 0x43, 0x5e, 0xab, 0x40, 0x5e, 0xab, 0x3c, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x34, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x34, 0x5e, 0xab, 0x38, 0x7e, 0xa3, 0x40, 0x9e, 0x9b, 0x6f, 0x9e, 0x9b, 0xa3, 0x9e, 0x9b, 0xc3, 0x9e, 0x9b, 0xdf, 0x7e, 0x9b, 0xf0, 0x7e, 0x9b, 0xf8, 0x7e, 0x9b, 0xf4, 0x7e, 0xa3, 0xef, 0x7e, 0xa3, 0xdb, 0x5e, 0xa3, 0xbf, 0x5e, 0xa3, 0x9c, 0x5e, 0xa3, 0x6f, 0x5e, 0xab, 0x4f, 0x5e, 0xab, 0x4c, 0x5e, 0xab, 0x4b, 0x5e, 0xab, 0x48, 0x5e, 0xab, 0x47, 0x5e, 0xab, 0x44, 0x5e, 0xab, 0x40, 0x5e, 0xab, 0x3f, 0x5e, 0xab, 0x3b, 0x5e, 0xab, 0x37, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x34, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x3c, 0x5e, 0xab, 0x3f, 0x5e, 0xab, 0x40, 0x5e, 0xab, 0x43, 0x5e, 0xab, 0x44, 0x5e, 0xab, 0x47, 0x5e, 0xab, 0x48, 0x5e, 0xab, 0x48, 0x5e, 0xab, 0x48, 0x5e, 0xab, 0x48, 0x5e, 0xab, 0x48, 0x5e, 0xab, 0x47, 0x5e, 0xab, 0x47, 0x5e, 0xab, 0x44, 0x5e, 0xab, 0x43, 0x5e, 0xab, 0x40, 0x5e, 0xab, 0x3f, 0x5e, 0xab, 0x3b, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x34, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x34, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x3b, 0x5e, 0xab, 0x3c, 0x5e, 0xab, 0x3f, 0x5e, 0xab, 0x40, 0x5e, 0xab, 0x40, 0x5e, 0xab, 0x40, 0x5e, 0xab, 0x43, 0x5e, 0xab, 0x43, 0x5e, 0xab, 0x40, 0x5e, 0xab, 0x40, 0x5e, 0xab, 0x3f, 0x5e, 0xab, 0x3f, 0x5e, 0xab, 0x3c, 0x5e, 0xab, 0x3b, 0x5e, 0xab, 0x37, 0x5e, 0xab, 0x34, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x34, 0x5e, 0xab, 0x37, 0x5e, 0xab, 0x37, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x3b, 0x5e, 0xab, 0x3b, 0x5e, 0xab, 0x3b, 0x5e, 0xab, 0x3b, 0x5e, 0xab, 0x3b, 0x5e, 0xab, 0x3b, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x37, 0x5e, 0xab, 0x34, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x34, 0x5e, 0xab, 0x34, 0x5e, 0xab, 0x34, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x1b, 0xa3, 0x7e, 0x1c, 0x74, 0x5f, 0x44, 0x6c, 0x9f, 0x6c, 0x64, 0x9f, 0x8f, 0x64, 0xbf, 0xa3, 0x64, 0xbf, 0xac, 0x64, 0x9f, 0xa8, 0x6c, 0x9f, 0xa0, 0x6c, 0x7f, 0x8b, 0x74, 0x5f, 0x68, 0x8b, 0xfe, 0x3c, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x17, 0xa3, 0x9e, 0x1c, 0x6c, 0x9f, 0x5f, 0x5c, 0xdf, 0xaf, 0x5c, 0xdf, 0xef, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xdf, 0x74, 0x5f, 0x9f, 0x83, 0xfe, 0x4f, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x17, 0x93, 0xbe, 0x1f, 0x64, 0xbf, 0x78, 0x5c, 0xdf, 0xe3, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x5f, 0xcb, 0x84, 0x1e, 0x64, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x17, 0x64, 0x9f, 0x57, 0x5c, 0xff, 0xdc, 0x5c, 0xff, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x7c, 0x3f, 0xc3, 0x93, 0xde, 0x4b, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x14, 0x9b, 0xbe, 0x1c, 0x5c, 0xdf, 0x9b, 0x54, 0xff, 0xff, 0x5c, 0xff, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x7c, 0x3f, 0xf4, 0x83, 0xfe, 0x7c, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x14, 0x84, 0x1e, 0x27, 0x5c, 0xff, 0xc7, 0x54, 0xff, 0xff, 0x5c, 0xff, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x83, 0xfe, 0xa0, 0xa3, 0x5e, 0x34, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x14, 0x7c, 0x3e, 0x2b, 0x54, 0xff, 0xd7, 0x54, 0xff, 0xff, 0x5c, 0xff, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x1f, 0xff, 0x7c, 0x1f, 0xff, 0x83, 0xfe, 0xb3, 0xa3, 0x5e, 0x37, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x14, 0x8b, 0xde, 0x20, 0x54, 0xff, 0xcf, 0x54, 0xff, 0xff, 0x54, 0xff, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x1f, 0xff, 0x7c, 0x1f, 0xff, 0x84, 0x1e, 0xff, 0x84, 0x1e, 0xff, 0x8b, 0xfe, 0xa3, 0xab, 0x5e, 0x37, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x17, 0x5c, 0xdf, 0xac, 0x54, 0xff, 0xff, 0x54, 0xff, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x1f, 0xff, 0x84, 0x1e, 0xff, 0x84, 0x1e, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x93, 0xde, 0x80, 0xab, 0x5e, 0x37, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x14, 0x64, 0xbf, 0x70, 0x54, 0xff, 0xff, 0x54, 0xff, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x1f, 0xff, 0x84, 0x1e, 0xff, 0x84, 0x1e, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x8b, 0xfe, 0xf7, 0x9b, 0x9e, 0x58, 0xab, 0x5e, 0x37, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x14, 0x84, 0x1e, 0x28, 0x54, 0xff, 0xef, 0x54, 0xff, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x1f, 0xff, 0x84, 0x1e, 0xff, 0x84, 0x1e, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x8b, 0xfe, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xc8, 0xab, 0x5e, 0x3c, 0xab, 0x5e, 0x37, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x17, 0x5c, 0xdf, 0x9f, 0x54, 0xff, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x1f, 0xff, 0x84, 0x1e, 0xff, 0x84, 0x1e, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x8b, 0xfe, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x9b, 0x9e, 0x78, 0xab, 0x5e, 0x3b, 0xab, 0x5e, 0x37, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x14, 0x7c, 0x3e, 0x2f, 0x54, 0xff, 0xf7, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x7c, 0xff, 0xff, 0xe7, 0x5f, 0xff, 0xef, 0x9f, 0xff, 0xa5, 0xdf, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x1f, 0xff, 0x84, 0x1e, 0xff, 0x84, 0x1e, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x8b, 0xfe, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x93, 0xbe, 0xd4, 0xab, 0x5e, 0x40, 0xab, 0x5e, 0x3b, 0xab, 0x5e, 0x34, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x17, 0x5c, 0xbf, 0x88, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0xbe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3f, 0xff, 0x95, 0x3f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x1f, 0xff, 0x84, 0x1e, 0xff, 0x84, 0x1e, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x8b, 0xfe, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x9b, 0x9e, 0x6b, 0xab, 0x5e, 0x3f, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x18, 0x5c, 0xdf, 0xdf, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0xc6, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xbf, 0xff, 0x84, 0x9f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x1f, 0xff, 0x84, 0x1e, 0xff, 0x84, 0x1e, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x8b, 0xfe, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x9b, 0x9e, 0xb0, 0xab, 0x5e, 0x43, 0xab, 0x5e, 0x3c, 0xab, 0x5e, 0x37, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x14, 0x74, 0x5f, 0x40, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0xc6, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbd, 0xff, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x1f, 0xff, 0x84, 0x1e, 0xff, 0x84, 0x1e, 0xff, 0x84, 0x1e, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x8b, 0xfe, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x9b, 0x9e, 0xeb, 0xab, 0x5e, 0x44, 0xab, 0x5e, 0x3f, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x17, 0x64, 0xbf, 0x7b, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0xc6, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5f, 0xff, 0xad, 0x7f, 0xff, 0x84, 0x1e, 0xff, 0x84, 0x1e, 0xff, 0x84, 0x1e, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x8b, 0xfe, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0xa3, 0x7e, 0x63, 0xab, 0x5e, 0x43, 0xab, 0x5e, 0x3c, 0xab, 0x5e, 0x34, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x18, 0x64, 0xbf, 0xab, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0xc6, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdf, 0xff, 0x9c, 0xdf, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x8b, 0xfe, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0xa3, 0x7e, 0x88, 0xab, 0x5e, 0x44, 0xab, 0x5e, 0x3f, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x18, 0x5c, 0xbf, 0xcc, 0x5c, 0xdf, 0xff, 0x5c, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0xc6, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x1f, 0xff, 0x94, 0x3f, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0xa3, 0x7e, 0xa4, 0xab, 0x5e, 0x47, 0xab, 0x5e, 0x40, 0xab, 0x5e, 0x3b, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x1b, 0x5c, 0xbf, 0xe4, 0x5c, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0xc6, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xbd, 0x7f, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xbb, 0xab, 0x5e, 0x48, 0xab, 0x5e, 0x43, 0xab, 0x5e, 0x3c, 0xab, 0x5e, 0x34, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x1b, 0x5c, 0xdf, 0xf0, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0xc6, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x3f, 0xff, 0xa4, 0x9f, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xc3, 0xab, 0x5e, 0x4b, 0xab, 0x5e, 0x44, 0xab, 0x5e, 0x3c, 0xab, 0x5e, 0x37, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x1c, 0x64, 0xbf, 0xf3, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0xc6, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7f, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xc7, 0xab, 0x5e, 0x4c, 0xab, 0x5e, 0x44, 0xab, 0x5e, 0x3f, 0xab, 0x5e, 0x37, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x1c, 0x64, 0xbf, 0xe8, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0xc6, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xdf, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xc0, 0xab, 0x5e, 0x4c, 0xab, 0x5e, 0x47, 0xab, 0x5e, 0x3f, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x1c, 0x64, 0xbf, 0xd8, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0xc6, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x5f, 0xff, 0x9b, 0xfe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xb0, 0xab, 0x5e, 0x4c, 0xab, 0x5e, 0x47, 0xab, 0x5e, 0x40, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x1c, 0x6c, 0x9f, 0xb7, 0x64, 0x9f, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x7c, 0x3f, 0xff, 0xc6, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xff, 0xff, 0xac, 0x9f, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0x98, 0xab, 0x5e, 0x4c, 0xab, 0x5e, 0x47, 0xab, 0x5e, 0x40, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x1c, 0x6c, 0x7f, 0x90, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0xc6, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9f, 0xff, 0xb5, 0x1f, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0x78, 0xab, 0x5e, 0x4c, 0xab, 0x5e, 0x47, 0xab, 0x5e, 0x3f, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x1c, 0x7c, 0x3f, 0x58, 0x6c, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0xce, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0xdf, 0xff, 0x93, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xf7, 0xab, 0x5e, 0x54, 0xab, 0x5e, 0x4c, 0xab, 0x5e, 0x47, 0xab, 0x5e, 0x3f, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x1b, 0x9b, 0x9e, 0x27, 0x6c, 0x9f, 0xf4, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x1f, 0xff, 0xce, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0x7f, 0xff, 0xa4, 0x7f, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xcc, 0xab, 0x5e, 0x50, 0xab, 0x5e, 0x4b, 0xab, 0x5e, 0x44, 0xab, 0x5e, 0x3f, 0xab, 0x5e, 0x37, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1f, 0x74, 0x7f, 0xaf, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x1f, 0xff, 0x7c, 0x1f, 0xff, 0xce, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x1f, 0xff, 0xac, 0xff, 0xff, 0x93, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xab, 0x5e, 0x90, 0xab, 0x5e, 0x50, 0xab, 0x5e, 0x4b, 0xab, 0x5e, 0x43, 0xab, 0x5e, 0x3c, 0xab, 0x5e, 0x37, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1f, 0x84, 0x1e, 0x54, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x1f, 0xff, 0x84, 0x1e, 0xff, 0xd6, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xbd, 0xbf, 0xff, 0x8b, 0xde, 0xff, 0x93, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xab, 0x5e, 0xf0, 0xab, 0x5e, 0x58, 0xab, 0x5e, 0x4f, 0xab, 0x5e, 0x48, 0xab, 0x5e, 0x40, 0xab, 0x5e, 0x3b, 0xab, 0x5e, 0x34, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x23, 0x74, 0x5f, 0xcb, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x1f, 0xff, 0x84, 0x1e, 0xff, 0x84, 0x1e, 0xff, 0xbd, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xd6, 0x5f, 0xff, 0x94, 0x1e, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xab, 0x5e, 0xff, 0xab, 0x5e, 0xa4, 0xab, 0x5e, 0x50, 0xab, 0x5e, 0x4c, 0xab, 0x5e, 0x44, 0xab, 0x5e, 0x3f, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x20, 0x84, 0x1e, 0x57, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x1f, 0xff, 0x84, 0x1e, 0xff, 0x84, 0x1e, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x8b, 0xfe, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xab, 0x5e, 0xff, 0xab, 0x3e, 0xeb, 0xab, 0x5e, 0x5b, 0xab, 0x5e, 0x4f, 0xab, 0x5e, 0x48, 0xab, 0x5e, 0x43, 0xab, 0x5e, 0x3c, 0xab, 0x5e, 0x37, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x24, 0x7c, 0x3f, 0xa8, 0x74, 0x5f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x1f, 0xff, 0x84, 0x1e, 0xff, 0x84, 0x1e, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x8b, 0xfe, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xab, 0x5e, 0xff, 0xab, 0x3e, 0xff, 0xab, 0x5e, 0x8b, 0xab, 0x5e, 0x50, 0xab, 0x5e, 0x4c, 0xab, 0x5e, 0x47, 0xab, 0x5e, 0x40, 0xab, 0x5e, 0x3b, 0xab, 0x5e, 0x34, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x23, 0x9b, 0x9e, 0x30, 0x7c, 0x3f, 0xdf, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x1f, 0xff, 0x84, 0x1e, 0xff, 0x84, 0x1e, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x8b, 0xfe, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xab, 0x5e, 0xff, 0xab, 0x3e, 0xff, 0xab, 0x3e, 0xbc, 0xab, 0x5e, 0x53, 0xab, 0x5e, 0x4f, 0xab, 0x5e, 0x48, 0xab, 0x5e, 0x43, 0xab, 0x5e, 0x3c, 0xab, 0x5e, 0x37, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x24, 0x8b, 0xde, 0x4f, 0x7c, 0x3f, 0xf3, 0x7c, 0x3f, 0xff, 0x7c, 0x1f, 0xff, 0x84, 0x1e, 0xff, 0x84, 0x1e, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x8b, 0xfe, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xab, 0x5e, 0xff, 0xab, 0x3e, 0xff, 0xab, 0x3e, 0xdb, 0xab, 0x5e, 0x5b, 0xab, 0x5e, 0x4f, 0xab, 0x5e, 0x4b, 0xab, 0x5e, 0x44, 0xab, 0x5e, 0x3f, 0xab, 0x5e, 0x3b, 0xab, 0x5e, 0x34, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x27, 0x8b, 0xde, 0x63, 0x7c, 0x1f, 0xf7, 0x84, 0x1e, 0xff, 0x84, 0x1e, 0xff, 0x84, 0x1e, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x8b, 0xfe, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xab, 0x5e, 0xff, 0xab, 0x3e, 0xff, 0xab, 0x3e, 0xe7, 0xab, 0x5e, 0x63, 0xab, 0x5e, 0x50, 0xab, 0x5e, 0x4b, 0xab, 0x5e, 0x47, 0xab, 0x5e, 0x40, 0xab, 0x5e, 0x3c, 0xab, 0x5e, 0x37, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x28, 0x8b, 0xde, 0x63, 0x84, 0x1e, 0xf3, 0x84, 0x1e, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x8b, 0xfe, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xab, 0x5e, 0xff, 0xab, 0x3e, 0xff, 0xab, 0x3e, 0xe0, 0xab, 0x5e, 0x64, 0xab, 0x5e, 0x50, 0xab, 0x5e, 0x4c, 0xab, 0x5e, 0x47, 0xab, 0x5e, 0x43, 0xab, 0x5e, 0x3c, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x2b, 0x93, 0xbe, 0x53, 0x83, 0xfe, 0xdf, 0x83, 0xfe, 0xff, 0x8b, 0xfe, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xab, 0x5e, 0xff, 0xab, 0x3e, 0xff, 0xab, 0x5e, 0xc8, 0xab, 0x5e, 0x5c, 0xab, 0x5e, 0x50, 0xab, 0x5e, 0x4b, 0xab, 0x5e, 0x47, 0xab, 0x5e, 0x43, 0xab, 0x5e, 0x3f, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x34, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x2c, 0xa3, 0x7e, 0x3b, 0x8b, 0xde, 0xac, 0x8b, 0xde, 0xfc, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xab, 0x5e, 0xff, 0xab, 0x3e, 0xf4, 0xab, 0x5e, 0x9b, 0xab, 0x5e, 0x53, 0xab, 0x5e, 0x4f, 0xab, 0x5e, 0x4b, 0xab, 0x5e, 0x47, 0xab, 0x5e, 0x43, 0xab, 0x5e, 0x3f, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x34, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x30, 0x9b, 0x9e, 0x60, 0x8b, 0xde, 0xcb, 0x8b, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xfb, 0xab, 0x5e, 0xbb, 0xab, 0x5e, 0x63, 0xab, 0x5e, 0x50, 0xab, 0x5e, 0x4c, 0xab, 0x5e, 0x48, 0xab, 0x5e, 0x44, 0xab, 0x5e, 0x40, 0xab, 0x5e, 0x3c, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x34, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x34, 0x9b, 0x9e, 0x64, 0x93, 0xbe, 0xb4, 0x93, 0xbe, 0xf4, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xe8, 0xa3, 0x5e, 0xab, 0xab, 0x5e, 0x64, 0xab, 0x5e, 0x4f, 0xab, 0x5e, 0x4c, 0xab, 0x5e, 0x4b, 0xab, 0x5e, 0x47, 0xab, 0x5e, 0x43, 0xab, 0x5e, 0x40, 0xab, 0x5e, 0x3c, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x34, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x34, 0xab, 0x5e, 0x38, 0xa3, 0x7e, 0x40, 0x9b, 0x9e, 0x6f, 0x9b, 0x9e, 0xa3, 0x9b, 0x9e, 0xc3, 0x9b, 0x9e, 0xdf, 0x9b, 0x7e, 0xf0, 0x9b, 0x7e, 0xf8, 0x9b, 0x7e, 0xf4, 0xa3, 0x7e, 0xef, 0xa3, 0x7e, 0xdb, 0xa3, 0x5e, 0xbf, 0xa3, 0x5e, 0x9c, 0xa3, 0x5e, 0x6f, 0xab, 0x5e, 0x4f, 0xab, 0x5e, 0x4c, 0xab, 0x5e, 0x4b, 0xab, 0x5e, 0x48, 0xab, 0x5e, 0x47, 0xab, 0x5e, 0x44, 0xab, 0x5e, 0x40, 0xab, 0x5e, 0x3f, 0xab, 0x5e, 0x3b, 0xab, 0x5e, 0x37, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x34, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x3c, 0xab, 0x5e, 0x3f, 0xab, 0x5e, 0x40, 0xab, 0x5e, 0x43, 0xab, 0x5e, 0x44, 0xab, 0x5e, 0x47, 0xab, 0x5e, 0x48, 0xab, 0x5e, 0x48, 0xab, 0x5e, 0x48, 0xab, 0x5e, 0x48, 0xab, 0x5e, 0x48, 0xab, 0x5e, 0x47, 0xab, 0x5e, 0x47, 0xab, 0x5e, 0x44, 0xab, 0x5e, 0x43, 0xab, 0x5e, 0x40, 0xab, 0x5e, 0x3f, 0xab, 0x5e, 0x3b, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x34, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x34, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x3b, 0xab, 0x5e, 0x3c, 0xab, 0x5e, 0x3f, 0xab, 0x5e, 0x40, 0xab, 0x5e, 0x40, 0xab, 0x5e, 0x40, 0xab, 0x5e, 0x43, 0xab, 0x5e, 0x43, 0xab, 0x5e, 0x40, 0xab, 0x5e, 0x40, 0xab, 0x5e, 0x3f, 0xab, 0x5e, 0x3f, 0xab, 0x5e, 0x3c, 0xab, 0x5e, 0x3b, 0xab, 0x5e, 0x37, 0xab, 0x5e, 0x34, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x34, 0xab, 0x5e, 0x37, 0xab, 0x5e, 0x37, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x3b, 0xab, 0x5e, 0x3b, 0xab, 0x5e, 0x3b, 0xab, 0x5e, 0x3b, 0xab, 0x5e, 0x3b, 0xab, 0x5e, 0x3b, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x37, 0xab, 0x5e, 0x34, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x34, 0xab, 0x5e, 0x34, 0xab, 0x5e, 0x34, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 32
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6c, 0xa2, 0x1c, 0xf5, 0x89, 0x72, 0x44, 0xf7, 0x90, 0x67, 0x6c, 0xf6, 0x92, 0x63, 0x8f, 0xf6, 0x93, 0x61, 0xa3, 0xf6, 0x93, 0x62, 0xac, 0xf6, 0x91, 0x64, 0xa8, 0xf6, 0x90, 0x67, 0xa0, 0xf6, 0x8d, 0x6b, 0x8b, 0xf5, 0x88, 0x73, 0x68, 0xf3, 0x7c, 0x87, 0x3c, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x17, 0xf1, 0x6f, 0x9d, 0x1c, 0xf6, 0x91, 0x66, 0x5f, 0xf7, 0x97, 0x5b, 0xaf, 0xf8, 0x98, 0x58, 0xef, 0xf8, 0x98, 0x59, 0xff, 0xf7, 0x97, 0x5a, 0xff, 0xf7, 0x97, 0x5b, 0xff, 0xf7, 0x96, 0x5d, 0xff, 0xf7, 0x95, 0x5e, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf6, 0x90, 0x66, 0xff, 0xf6, 0x8e, 0x69, 0xdf, 0xf5, 0x8a, 0x70, 0x9f, 0xf3, 0x7e, 0x83, 0x4f, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x17, 0xf2, 0x74, 0x94, 0x1f, 0xf7, 0x95, 0x5f, 0x78, 0xf8, 0x9a, 0x57, 0xe3, 0xf8, 0x9a, 0x56, 0xff, 0xf8, 0x99, 0x57, 0xff, 0xf8, 0x98, 0x59, 0xff, 0xf7, 0x98, 0x5a, 0xff, 0xf7, 0x97, 0x5b, 0xff, 0xf7, 0x96, 0x5d, 0xff, 0xf7, 0x95, 0x5e, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf6, 0x90, 0x66, 0xff, 0xf6, 0x8f, 0x67, 0xff, 0xf6, 0x8e, 0x69, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8c, 0x6c, 0xff, 0xf6, 0x89, 0x71, 0xcb, 0xf4, 0x80, 0x81, 0x64, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x17, 0xf6, 0x91, 0x64, 0x57, 0xf8, 0x9b, 0x56, 0xdc, 0xf8, 0x9b, 0x55, 0xff, 0xf8, 0x9a, 0x56, 0xff, 0xf8, 0x99, 0x57, 0xff, 0xf8, 0x98, 0x59, 0xff, 0xf7, 0x98, 0x5a, 0xff, 0xf7, 0x97, 0x5b, 0xff, 0xf7, 0x96, 0x5d, 0xff, 0xf7, 0x95, 0x5e, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf6, 0x90, 0x66, 0xff, 0xf6, 0x8f, 0x67, 0xff, 0xf6, 0x8e, 0x69, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8c, 0x6c, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x8a, 0x6f, 0xff, 0xf6, 0x89, 0x71, 0xff, 0xf5, 0x86, 0x76, 0xc3, 0xf2, 0x77, 0x8f, 0x4b, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x14, 0xf1, 0x73, 0x97, 0x1c, 0xf7, 0x98, 0x59, 0x9b, 0xf8, 0x9c, 0x53, 0xff, 0xf8, 0x9b, 0x55, 0xff, 0xf8, 0x9a, 0x56, 0xff, 0xf8, 0x99, 0x57, 0xff, 0xf8, 0x98, 0x58, 0xff, 0xf7, 0x98, 0x5a, 0xff, 0xf7, 0x97, 0x5b, 0xff, 0xf7, 0x96, 0x5d, 0xff, 0xf7, 0x95, 0x5e, 0xff, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf6, 0x90, 0x65, 0xff, 0xf6, 0x8f, 0x67, 0xff, 0xf6, 0x8e, 0x69, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8c, 0x6c, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x8a, 0x6f, 0xff, 0xf6, 0x89, 0x71, 0xff, 0xf5, 0x88, 0x72, 0xff, 0xf5, 0x87, 0x74, 0xff, 0xf5, 0x86, 0x77, 0xf4, 0xf4, 0x7d, 0x83, 0x7c, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x14, 0xf3, 0x7f, 0x82, 0x27, 0xf8, 0x9b, 0x55, 0xc7, 0xf8, 0x9c, 0x53, 0xff, 0xf8, 0x9b, 0x55, 0xff, 0xf8, 0x9a, 0x56, 0xff, 0xf8, 0x99, 0x57, 0xff, 0xf8, 0x99, 0x58, 0xff, 0xf7, 0x98, 0x5a, 0xff, 0xf7, 0x97, 0x5b, 0xff, 0xf7, 0x96, 0x5d, 0xff, 0xf7, 0x95, 0x5e, 0xff, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf6, 0x90, 0x65, 0xff, 0xf6, 0x8f, 0x67, 0xff, 0xf6, 0x8e, 0x69, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8c, 0x6c, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x8a, 0x6f, 0xff, 0xf6, 0x89, 0x71, 0xff, 0xf5, 0x88, 0x72, 0xff, 0xf5, 0x87, 0x74, 0xff, 0xf5, 0x86, 0x76, 0xff, 0xf5, 0x85, 0x77, 0xff, 0xf5, 0x83, 0x79, 0xff, 0xf4, 0x7e, 0x82, 0xa0, 0xf0, 0x6a, 0xa4, 0x34, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x14, 0xf4, 0x83, 0x7c, 0x2b, 0xf8, 0x9c, 0x54, 0xd7, 0xf8, 0x9c, 0x53, 0xff, 0xf8, 0x9b, 0x55, 0xff, 0xf8, 0x9a, 0x56, 0xff, 0xf8, 0x99, 0x57, 0xff, 0xf8, 0x99, 0x58, 0xff, 0xf7, 0x98, 0x5a, 0xff, 0xf7, 0x97, 0x5b, 0xff, 0xf7, 0x96, 0x5c, 0xff, 0xf7, 0x95, 0x5e, 0xff, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf6, 0x90, 0x65, 0xff, 0xf6, 0x8f, 0x67, 0xff, 0xf6, 0x8e, 0x68, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8c, 0x6c, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x8a, 0x6f, 0xff, 0xf6, 0x89, 0x71, 0xff, 0xf5, 0x88, 0x72, 0xff, 0xf5, 0x87, 0x74, 0xff, 0xf5, 0x86, 0x75, 0xff, 0xf5, 0x85, 0x77, 0xff, 0xf5, 0x83, 0x79, 0xff, 0xf5, 0x82, 0x7a, 0xff, 0xf5, 0x81, 0x7c, 0xff, 0xf3, 0x7d, 0x83, 0xb3, 0xf0, 0x6a, 0xa4, 0x37, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x14, 0xf3, 0x7a, 0x8b, 0x20, 0xf8, 0x9c, 0x54, 0xcf, 0xf8, 0x9c, 0x53, 0xff, 0xf8, 0x9b, 0x54, 0xff, 0xf8, 0x9a, 0x56, 0xff, 0xf8, 0x99, 0x57, 0xff, 0xf8, 0x99, 0x58, 0xff, 0xf8, 0x98, 0x5a, 0xff, 0xf7, 0x97, 0x5b, 0xff, 0xf7, 0x96, 0x5c, 0xff, 0xf7, 0x95, 0x5e, 0xff, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf7, 0x90, 0x65, 0xff, 0xf6, 0x8f, 0x67, 0xff, 0xf6, 0x8e, 0x68, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8c, 0x6c, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x8a, 0x6f, 0xff, 0xf6, 0x89, 0x70, 0xff, 0xf5, 0x88, 0x72, 0xff, 0xf5, 0x87, 0x74, 0xff, 0xf5, 0x86, 0x75, 0xff, 0xf5, 0x85, 0x77, 0xff, 0xf5, 0x84, 0x79, 0xff, 0xf5, 0x82, 0x7a, 0xff, 0xf5, 0x81, 0x7c, 0xff, 0xf4, 0x80, 0x7e, 0xff, 0xf4, 0x7f, 0x7f, 0xff, 0xf3, 0x7b, 0x87, 0xa3, 0xf0, 0x6a, 0xa5, 0x37, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x17, 0xf8, 0x9a, 0x56, 0xac, 0xf8, 0x9c, 0x53, 0xff, 0xf8, 0x9b, 0x54, 0xff, 0xf8, 0x9a, 0x56, 0xff, 0xf8, 0x99, 0x57, 0xff, 0xf8, 0x99, 0x58, 0xff, 0xf8, 0x98, 0x5a, 0xff, 0xf7, 0x97, 0x5b, 0xff, 0xf7, 0x96, 0x5c, 0xff, 0xf7, 0x95, 0x5e, 0xff, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf7, 0x90, 0x65, 0xff, 0xf6, 0x8f, 0x67, 0xff, 0xf6, 0x8e, 0x68, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8c, 0x6b, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x8a, 0x6f, 0xff, 0xf6, 0x89, 0x70, 0xff, 0xf5, 0x88, 0x72, 0xff, 0xf5, 0x87, 0x74, 0xff, 0xf5, 0x86, 0x75, 0xff, 0xf5, 0x85, 0x77, 0xff, 0xf5, 0x84, 0x79, 0xff, 0xf5, 0x83, 0x7a, 0xff, 0xf5, 0x81, 0x7c, 0xff, 0xf4, 0x80, 0x7e, 0xff, 0xf4, 0x7f, 0x7f, 0xff, 0xf4, 0x7e, 0x81, 0xff, 0xf4, 0x7d, 0x83, 0xff, 0xf3, 0x77, 0x8e, 0x80, 0xf0, 0x6a, 0xa5, 0x37, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x14, 0xf7, 0x96, 0x5e, 0x70, 0xf8, 0x9c, 0x53, 0xff, 0xf8, 0x9b, 0x54, 0xff, 0xf8, 0x9a, 0x56, 0xff, 0xf8, 0x9a, 0x57, 0xff, 0xf8, 0x99, 0x58, 0xff, 0xf8, 0x98, 0x59, 0xff, 0xf7, 0x97, 0x5b, 0xff, 0xf7, 0x96, 0x5c, 0xff, 0xf7, 0x95, 0x5e, 0xff, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf7, 0x90, 0x65, 0xff, 0xf6, 0x8f, 0x67, 0xff, 0xf6, 0x8e, 0x68, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8c, 0x6b, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x8a, 0x6f, 0xff, 0xf6, 0x89, 0x70, 0xff, 0xf5, 0x88, 0x72, 0xff, 0xf5, 0x87, 0x74, 0xff, 0xf5, 0x86, 0x75, 0xff, 0xf5, 0x85, 0x77, 0xff, 0xf5, 0x84, 0x79, 0xff, 0xf5, 0x83, 0x7a, 0xff, 0xf5, 0x81, 0x7c, 0xff, 0xf4, 0x80, 0x7e, 0xff, 0xf4, 0x7f, 0x7f, 0xff, 0xf4, 0x7e, 0x81, 0xff, 0xf4, 0x7d, 0x83, 0xff, 0xf4, 0x7c, 0x84, 0xff, 0xf4, 0x7b, 0x86, 0xf7, 0xf2, 0x71, 0x99, 0x58, 0xf0, 0x6a, 0xa5, 0x37, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x14, 0xf4, 0x82, 0x7f, 0x28, 0xf8, 0x9c, 0x54, 0xef, 0xf8, 0x9b, 0x54, 0xff, 0xf8, 0x9a, 0x56, 0xff, 0xf8, 0x9a, 0x57, 0xff, 0xf8, 0x99, 0x58, 0xff, 0xf8, 0x98, 0x59, 0xff, 0xf7, 0x97, 0x5b, 0xff, 0xf7, 0x96, 0x5c, 0xff, 0xf7, 0x95, 0x5e, 0xff, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x91, 0x63, 0xff, 0xf7, 0x90, 0x65, 0xff, 0xf6, 0x8f, 0x67, 0xff, 0xf6, 0x8e, 0x68, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8c, 0x6b, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x8a, 0x6f, 0xff, 0xf6, 0x89, 0x70, 0xff, 0xf5, 0x88, 0x72, 0xff, 0xf5, 0x87, 0x73, 0xff, 0xf5, 0x86, 0x75, 0xff, 0xf5, 0x85, 0x77, 0xff, 0xf5, 0x84, 0x78, 0xff, 0xf5, 0x83, 0x7a, 0xff, 0xf5, 0x82, 0x7c, 0xff, 0xf4, 0x80, 0x7d, 0xff, 0xf4, 0x7f, 0x7f, 0xff, 0xf4, 0x7e, 0x81, 0xff, 0xf4, 0x7d, 0x82, 0xff, 0xf4, 0x7c, 0x84, 0xff, 0xf4, 0x7b, 0x86, 0xff, 0xf4, 0x7a, 0x87, 0xff, 0xf3, 0x78, 0x8c, 0xc8, 0xf0, 0x6a, 0xa5, 0x3c, 0xf0, 0x6a, 0xa5, 0x37, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x17, 0xf7, 0x98, 0x59, 0x9f, 0xf8, 0x9b, 0x54, 0xff, 0xf8, 0x9a, 0x55, 0xff, 0xf8, 0x9a, 0x57, 0xff, 0xf8, 0x99, 0x58, 0xff, 0xf8, 0x98, 0x59, 0xff, 0xf7, 0x97, 0x5b, 0xff, 0xf7, 0x96, 0x5c, 0xff, 0xf7, 0x95, 0x5e, 0xff, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x91, 0x63, 0xff, 0xf7, 0x90, 0x65, 0xff, 0xf6, 0x8f, 0x66, 0xff, 0xf6, 0x8e, 0x68, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8c, 0x6b, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x8a, 0x6e, 0xff, 0xf6, 0x89, 0x70, 0xff, 0xf5, 0x88, 0x72, 0xff, 0xf5, 0x87, 0x73, 0xff, 0xf5, 0x86, 0x75, 0xff, 0xf5, 0x85, 0x77, 0xff, 0xf5, 0x84, 0x78, 0xff, 0xf5, 0x83, 0x7a, 0xff, 0xf5, 0x82, 0x7c, 0xff, 0xf4, 0x81, 0x7d, 0xff, 0xf4, 0x7f, 0x7f, 0xff, 0xf4, 0x7e, 0x81, 0xff, 0xf4, 0x7d, 0x82, 0xff, 0xf4, 0x7c, 0x84, 0xff, 0xf4, 0x7b, 0x86, 0xff, 0xf4, 0x7a, 0x87, 0xff, 0xf3, 0x79, 0x89, 0xff, 0xf3, 0x78, 0x8b, 0xff, 0xf2, 0x72, 0x96, 0x78, 0xf0, 0x6a, 0xa5, 0x3b, 0xf0, 0x6a, 0xa5, 0x37, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x14, 0xf4, 0x84, 0x7a, 0x2f, 0xf8, 0x9b, 0x54, 0xf7, 0xf8, 0x9a, 0x55, 0xff, 0xf8, 0x9a, 0x57, 0xff, 0xf8, 0x99, 0x58, 0xff, 0xf8, 0x98, 0x59, 0xff, 0xf7, 0x97, 0x5b, 0xff, 0xf7, 0x96, 0x5c, 0xff, 0xf7, 0x95, 0x5d, 0xff, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x91, 0x63, 0xff, 0xf8, 0x9c, 0x76, 0xff, 0xfd, 0xe8, 0xdf, 0xff, 0xfe, 0xef, 0xe9, 0xff, 0xf9, 0xb8, 0xa2, 0xff, 0xf6, 0x8c, 0x6b, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x8a, 0x6e, 0xff, 0xf6, 0x89, 0x70, 0xff, 0xf5, 0x88, 0x72, 0xff, 0xf5, 0x87, 0x73, 0xff, 0xf5, 0x86, 0x75, 0xff, 0xf5, 0x85, 0x77, 0xff, 0xf5, 0x84, 0x78, 0xff, 0xf5, 0x83, 0x7a, 0xff, 0xf5, 0x82, 0x7c, 0xff, 0xf4, 0x81, 0x7d, 0xff, 0xf4, 0x7f, 0x7f, 0xff, 0xf4, 0x7e, 0x81, 0xff, 0xf4, 0x7d, 0x82, 0xff, 0xf4, 0x7c, 0x84, 0xff, 0xf4, 0x7b, 0x86, 0xff, 0xf4, 0x7a, 0x87, 0xff, 0xf3, 0x79, 0x89, 0xff, 0xf3, 0x78, 0x8b, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf3, 0x75, 0x90, 0xd4, 0xf0, 0x6a, 0xa5, 0x40, 0xf0, 0x6a, 0xa5, 0x3b, 0xf0, 0x6a, 0xa5, 0x34, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x17, 0xf7, 0x96, 0x5c, 0x88, 0xf8, 0x9a, 0x55, 0xff, 0xf8, 0x9a, 0x57, 0xff, 0xf8, 0x99, 0x58, 0xff, 0xf8, 0x98, 0x59, 0xff, 0xf7, 0x97, 0x5b, 0xff, 0xf7, 0x96, 0x5c, 0xff, 0xf7, 0x95, 0x5d, 0xff, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x91, 0x63, 0xff, 0xf7, 0x90, 0x65, 0xff, 0xfb, 0xcc, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe6, 0xe0, 0xff, 0xf8, 0xa6, 0x90, 0xff, 0xf6, 0x89, 0x70, 0xff, 0xf5, 0x88, 0x72, 0xff, 0xf5, 0x87, 0x73, 0xff, 0xf5, 0x86, 0x75, 0xff, 0xf5, 0x85, 0x77, 0xff, 0xf5, 0x84, 0x78, 0xff, 0xf5, 0x83, 0x7a, 0xff, 0xf5, 0x82, 0x7c, 0xff, 0xf4, 0x81, 0x7d, 0xff, 0xf4, 0x80, 0x7f, 0xff, 0xf4, 0x7e, 0x81, 0xff, 0xf4, 0x7d, 0x82, 0xff, 0xf4, 0x7c, 0x84, 0xff, 0xf4, 0x7b, 0x86, 0xff, 0xf4, 0x7a, 0x87, 0xff, 0xf3, 0x79, 0x89, 0xff, 0xf3, 0x78, 0x8b, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf3, 0x76, 0x8e, 0xff, 0xf3, 0x75, 0x8f, 0xff, 0xf1, 0x6f, 0x9b, 0x6b, 0xf0, 0x6a, 0xa5, 0x3f, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x18, 0xf8, 0x9a, 0x57, 0xdf, 0xf8, 0x9a, 0x57, 0xff, 0xf8, 0x99, 0x58, 0xff, 0xf8, 0x98, 0x59, 0xff, 0xf7, 0x97, 0x5b, 0xff, 0xf7, 0x96, 0x5c, 0xff, 0xf7, 0x95, 0x5d, 0xff, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x93, 0x62, 0xff, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x65, 0xff, 0xf6, 0x90, 0x66, 0xff, 0xfb, 0xd1, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xd4, 0xcb, 0xff, 0xf6, 0x92, 0x80, 0xff, 0xf5, 0x86, 0x75, 0xff, 0xf5, 0x85, 0x76, 0xff, 0xf5, 0x84, 0x78, 0xff, 0xf5, 0x83, 0x7a, 0xff, 0xf5, 0x82, 0x7b, 0xff, 0xf4, 0x81, 0x7d, 0xff, 0xf4, 0x80, 0x7f, 0xff, 0xf4, 0x7e, 0x81, 0xff, 0xf4, 0x7d, 0x82, 0xff, 0xf4, 0x7c, 0x84, 0xff, 0xf4, 0x7b, 0x86, 0xff, 0xf4, 0x7a, 0x87, 0xff, 0xf3, 0x79, 0x89, 0xff, 0xf3, 0x78, 0x8a, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf3, 0x76, 0x8e, 0xff, 0xf3, 0x75, 0x8f, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf2, 0x71, 0x95, 0xb0, 0xf0, 0x6a, 0xa5, 0x43, 0xf0, 0x6a, 0xa5, 0x3c, 0xf0, 0x6a, 0xa5, 0x37, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x14, 0xf5, 0x8a, 0x70, 0x40, 0xf8, 0x9a, 0x56, 0xff, 0xf8, 0x99, 0x58, 0xff, 0xf8, 0x98, 0x59, 0xff, 0xf7, 0x97, 0x5a, 0xff, 0xf7, 0x96, 0x5c, 0xff, 0xf7, 0x95, 0x5d, 0xff, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x62, 0xff, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x65, 0xff, 0xf6, 0x90, 0x66, 0xff, 0xf6, 0x8f, 0x68, 0xff, 0xfb, 0xcd, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf9, 0xff, 0xfa, 0xbe, 0xb6, 0xff, 0xf5, 0x84, 0x78, 0xff, 0xf5, 0x83, 0x7a, 0xff, 0xf5, 0x82, 0x7b, 0xff, 0xf4, 0x81, 0x7d, 0xff, 0xf4, 0x80, 0x7f, 0xff, 0xf4, 0x7f, 0x80, 0xff, 0xf4, 0x7d, 0x82, 0xff, 0xf4, 0x7c, 0x84, 0xff, 0xf4, 0x7b, 0x85, 0xff, 0xf4, 0x7a, 0x87, 0xff, 0xf3, 0x79, 0x89, 0xff, 0xf3, 0x78, 0x8a, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf3, 0x76, 0x8e, 0xff, 0xf3, 0x75, 0x8f, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf2, 0x72, 0x95, 0xeb, 0xf0, 0x6a, 0xa5, 0x44, 0xf0, 0x6a, 0xa5, 0x3f, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x17, 0xf7, 0x94, 0x60, 0x7b, 0xf8, 0x99, 0x58, 0xff, 0xf8, 0x98, 0x59, 0xff, 0xf7, 0x97, 0x5a, 0xff, 0xf7, 0x96, 0x5c, 0xff, 0xf7, 0x95, 0x5d, 0xff, 0xf7, 0x95, 0x5f, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x62, 0xff, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x65, 0xff, 0xf6, 0x90, 0x66, 0xff, 0xf6, 0x8f, 0x68, 0xff, 0xf6, 0x8e, 0x69, 0xff, 0xfb, 0xcd, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xea, 0xe9, 0xff, 0xf8, 0xab, 0xa6, 0xff, 0xf4, 0x81, 0x7d, 0xff, 0xf4, 0x80, 0x7f, 0xff, 0xf4, 0x7f, 0x80, 0xff, 0xf4, 0x7e, 0x82, 0xff, 0xf4, 0x7c, 0x84, 0xff, 0xf4, 0x7b, 0x85, 0xff, 0xf4, 0x7a, 0x87, 0xff, 0xf3, 0x79, 0x89, 0xff, 0xf3, 0x78, 0x8a, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf3, 0x76, 0x8e, 0xff, 0xf3, 0x75, 0x8f, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf3, 0x72, 0x94, 0xff, 0xf2, 0x71, 0x95, 0xff, 0xf1, 0x6c, 0xa0, 0x63, 0xf0, 0x6a, 0xa5, 0x43, 0xf0, 0x6a, 0xa5, 0x3c, 0xf0, 0x6a, 0xa5, 0x34, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x18, 0xf7, 0x96, 0x5d, 0xab, 0xf8, 0x98, 0x59, 0xff, 0xf7, 0x97, 0x5a, 0xff, 0xf7, 0x96, 0x5c, 0xff, 0xf7, 0x95, 0x5d, 0xff, 0xf7, 0x95, 0x5f, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf6, 0x90, 0x66, 0xff, 0xf6, 0x8f, 0x68, 0xff, 0xf6, 0x8e, 0x69, 0xff, 0xf6, 0x8d, 0x6b, 0xff, 0xfb, 0xcc, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xd9, 0xd8, 0xff, 0xf6, 0x97, 0x98, 0xff, 0xf4, 0x7e, 0x82, 0xff, 0xf4, 0x7c, 0x84, 0xff, 0xf4, 0x7b, 0x85, 0xff, 0xf4, 0x7a, 0x87, 0xff, 0xf3, 0x79, 0x89, 0xff, 0xf3, 0x78, 0x8a, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf3, 0x76, 0x8d, 0xff, 0xf3, 0x75, 0x8f, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf3, 0x72, 0x94, 0xff, 0xf2, 0x71, 0x95, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf1, 0x6d, 0x9d, 0x88, 0xf0, 0x6a, 0xa5, 0x44, 0xf0, 0x6a, 0xa5, 0x3f, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x18, 0xf8, 0x96, 0x5c, 0xcc, 0xf7, 0x97, 0x5a, 0xff, 0xf7, 0x96, 0x5c, 0xff, 0xf7, 0x96, 0x5d, 0xff, 0xf7, 0x95, 0x5e, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf6, 0x90, 0x66, 0xff, 0xf6, 0x8f, 0x68, 0xff, 0xf6, 0x8e, 0x69, 0xff, 0xf6, 0x8d, 0x6b, 0xff, 0xf6, 0x8c, 0x6c, 0xff, 0xfb, 0xcc, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xc2, 0xc6, 0xff, 0xf5, 0x84, 0x8d, 0xff, 0xf4, 0x7a, 0x87, 0xff, 0xf3, 0x79, 0x89, 0xff, 0xf3, 0x78, 0x8a, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf3, 0x76, 0x8d, 0xff, 0xf3, 0x75, 0x8f, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf3, 0x72, 0x94, 0xff, 0xf2, 0x71, 0x95, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6d, 0x9d, 0xa4, 0xf0, 0x6a, 0xa5, 0x47, 0xf0, 0x6a, 0xa5, 0x40, 0xf0, 0x6a, 0xa5, 0x3b, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x1b, 0xf7, 0x96, 0x5b, 0xe4, 0xf7, 0x96, 0x5c, 0xff, 0xf7, 0x96, 0x5d, 0xff, 0xf7, 0x95, 0x5e, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf6, 0x90, 0x66, 0xff, 0xf6, 0x8f, 0x67, 0xff, 0xf6, 0x8e, 0x69, 0xff, 0xf6, 0x8d, 0x6b, 0xff, 0xf6, 0x8c, 0x6c, 0xff, 0xf6, 0x8b, 0x6e, 0xff, 0xfb, 0xcc, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf6, 0xf7, 0xff, 0xf8, 0xae, 0xb7, 0xff, 0xf3, 0x78, 0x8a, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf3, 0x76, 0x8d, 0xff, 0xf3, 0x75, 0x8f, 0xff, 0xf3, 0x74, 0x90, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf3, 0x72, 0x94, 0xff, 0xf2, 0x71, 0x95, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9d, 0xbb, 0xf0, 0x6a, 0xa5, 0x48, 0xf0, 0x6a, 0xa5, 0x43, 0xf0, 0x6a, 0xa5, 0x3c, 0xf0, 0x6a, 0xa5, 0x34, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x1b, 0xf7, 0x97, 0x5c, 0xf0, 0xf7, 0x96, 0x5d, 0xff, 0xf7, 0x95, 0x5e, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf6, 0x90, 0x66, 0xff, 0xf6, 0x8f, 0x67, 0xff, 0xf6, 0x8e, 0x69, 0xff, 0xf6, 0x8d, 0x6b, 0xff, 0xf6, 0x8c, 0x6c, 0xff, 0xf6, 0x8b, 0x6e, 0xff, 0xf6, 0x8a, 0x6f, 0xff, 0xfb, 0xcb, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe4, 0xe8, 0xff, 0xf5, 0x8f, 0xa2, 0xff, 0xf3, 0x75, 0x8f, 0xff, 0xf3, 0x74, 0x90, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf3, 0x72, 0x94, 0xff, 0xf2, 0x71, 0x95, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6c, 0x9d, 0xc3, 0xf0, 0x6a, 0xa5, 0x4b, 0xf0, 0x6a, 0xa5, 0x44, 0xf0, 0x6a, 0xa5, 0x3c, 0xf0, 0x6a, 0xa5, 0x37, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x1c, 0xf7, 0x96, 0x5e, 0xf3, 0xf7, 0x95, 0x5e, 0xff, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf6, 0x90, 0x66, 0xff, 0xf6, 0x8f, 0x67, 0xff, 0xf6, 0x8e, 0x69, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8c, 0x6c, 0xff, 0xf6, 0x8b, 0x6e, 0xff, 0xf6, 0x8a, 0x6f, 0xff, 0xf5, 0x89, 0x71, 0xff, 0xfb, 0xcb, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xec, 0xf0, 0xff, 0xf3, 0x74, 0x90, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf3, 0x72, 0x93, 0xff, 0xf2, 0x71, 0x95, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6e, 0x99, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6c, 0x9c, 0xff, 0xf2, 0x6b, 0x9f, 0xc7, 0xf0, 0x6a, 0xa5, 0x4c, 0xf0, 0x6a, 0xa5, 0x44, 0xf0, 0x6a, 0xa5, 0x3f, 0xf0, 0x6a, 0xa5, 0x37, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x1c, 0xf7, 0x94, 0x5f, 0xe8, 0xf7, 0x94, 0x60, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf6, 0x90, 0x66, 0xff, 0xf6, 0x8f, 0x67, 0xff, 0xf6, 0x8e, 0x69, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8c, 0x6c, 0xff, 0xf6, 0x8b, 0x6e, 0xff, 0xf6, 0x8a, 0x6f, 0xff, 0xf6, 0x89, 0x71, 0xff, 0xf5, 0x88, 0x72, 0xff, 0xfb, 0xca, 0xc2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xd9, 0xe1, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf3, 0x72, 0x93, 0xff, 0xf2, 0x71, 0x95, 0xff, 0xf2, 0x70, 0x96, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6e, 0x99, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6c, 0x9c, 0xff, 0xf2, 0x6c, 0x9e, 0xff, 0xf2, 0x6b, 0xa0, 0xc0, 0xf0, 0x6a, 0xa5, 0x4c, 0xf0, 0x6a, 0xa5, 0x47, 0xf0, 0x6a, 0xa5, 0x3f, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x1c, 0xf7, 0x93, 0x62, 0xd8, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x92, 0x63, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf6, 0x90, 0x66, 0xff, 0xf6, 0x8f, 0x67, 0xff, 0xf6, 0x8e, 0x69, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8c, 0x6c, 0xff, 0xf6, 0x8b, 0x6e, 0xff, 0xf6, 0x8a, 0x6f, 0xff, 0xf6, 0x89, 0x71, 0xff, 0xf5, 0x88, 0x72, 0xff, 0xf5, 0x87, 0x74, 0xff, 0xfb, 0xc9, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xc8, 0xd3, 0xff, 0xf4, 0x7b, 0x98, 0xff, 0xf3, 0x72, 0x93, 0xff, 0xf2, 0x71, 0x95, 0xff, 0xf2, 0x70, 0x96, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6e, 0x99, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6c, 0x9c, 0xff, 0xf2, 0x6c, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf1, 0x6a, 0xa1, 0xb0, 0xf0, 0x6a, 0xa5, 0x4c, 0xf0, 0x6a, 0xa5, 0x47, 0xf0, 0x6a, 0xa5, 0x40, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x1c, 0xf7, 0x91, 0x65, 0xb7, 0xf7, 0x92, 0x62, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf6, 0x90, 0x66, 0xff, 0xf6, 0x8f, 0x67, 0xff, 0xf6, 0x8e, 0x69, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8c, 0x6c, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x8a, 0x6f, 0xff, 0xf6, 0x89, 0x71, 0xff, 0xf5, 0x88, 0x72, 0xff, 0xf5, 0x87, 0x74, 0xff, 0xf5, 0x86, 0x76, 0xff, 0xfb, 0xc9, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xdd, 0xe3, 0xff, 0xf5, 0x90, 0xa7, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf3, 0x72, 0x93, 0xff, 0xf2, 0x71, 0x95, 0xff, 0xf2, 0x70, 0x96, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6e, 0x99, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6d, 0x9c, 0xff, 0xf2, 0x6c, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf1, 0x6a, 0xa0, 0xff, 0xf1, 0x69, 0xa3, 0x98, 0xf0, 0x6a, 0xa5, 0x4c, 0xf0, 0x6a, 0xa5, 0x47, 0xf0, 0x6a, 0xa5, 0x40, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x1c, 0xf6, 0x8e, 0x69, 0x90, 0xf7, 0x91, 0x64, 0xff, 0xf6, 0x90, 0x65, 0xff, 0xf6, 0x8f, 0x67, 0xff, 0xf6, 0x8e, 0x69, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8c, 0x6c, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x8a, 0x6f, 0xff, 0xf6, 0x89, 0x71, 0xff, 0xf5, 0x88, 0x72, 0xff, 0xf5, 0x87, 0x74, 0xff, 0xf5, 0x86, 0x76, 0xff, 0xf5, 0x85, 0x77, 0xff, 0xfb, 0xc9, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xef, 0xf2, 0xff, 0xf7, 0xa2, 0xb3, 0xff, 0xf3, 0x74, 0x90, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf3, 0x72, 0x93, 0xff, 0xf2, 0x71, 0x95, 0xff, 0xf2, 0x70, 0x96, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6e, 0x99, 0xff, 0xf2, 0x6e, 0x9b, 0xff, 0xf2, 0x6d, 0x9c, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf1, 0x6a, 0xa0, 0xff, 0xf1, 0x69, 0xa2, 0xff, 0xf0, 0x69, 0xa4, 0x78, 0xf0, 0x6a, 0xa5, 0x4c, 0xf0, 0x6a, 0xa5, 0x47, 0xf0, 0x6a, 0xa5, 0x3f, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x1c, 0xf5, 0x86, 0x76, 0x58, 0xf6, 0x90, 0x65, 0xff, 0xf6, 0x8f, 0x67, 0xff, 0xf6, 0x8e, 0x68, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8c, 0x6c, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x8a, 0x6f, 0xff, 0xf6, 0x89, 0x71, 0xff, 0xf5, 0x88, 0x72, 0xff, 0xf5, 0x87, 0x74, 0xff, 0xf5, 0x86, 0x75, 0xff, 0xf5, 0x85, 0x77, 0xff, 0xf5, 0x83, 0x79, 0xff, 0xfb, 0xc8, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xf9, 0xba, 0xc5, 0xff, 0xf3, 0x78, 0x91, 0xff, 0xf3, 0x74, 0x90, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf3, 0x72, 0x93, 0xff, 0xf2, 0x71, 0x95, 0xff, 0xf2, 0x70, 0x96, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6f, 0x99, 0xff, 0xf2, 0x6e, 0x9b, 0xff, 0xf2, 0x6d, 0x9c, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf1, 0x6a, 0xa0, 0xff, 0xf1, 0x69, 0xa1, 0xff, 0xf1, 0x68, 0xa3, 0xf7, 0xf0, 0x6a, 0xa5, 0x54, 0xf0, 0x6a, 0xa5, 0x4c, 0xf0, 0x6a, 0xa5, 0x47, 0xf0, 0x6a, 0xa5, 0x3f, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x1b, 0xf1, 0x71, 0x99, 0x27, 0xf6, 0x8f, 0x67, 0xf4, 0xf6, 0x8e, 0x68, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8c, 0x6c, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x8a, 0x6f, 0xff, 0xf6, 0x89, 0x70, 0xff, 0xf5, 0x88, 0x72, 0xff, 0xf5, 0x87, 0x74, 0xff, 0xf5, 0x86, 0x75, 0xff, 0xf5, 0x85, 0x77, 0xff, 0xf5, 0x84, 0x79, 0xff, 0xf5, 0x82, 0x7a, 0xff, 0xfb, 0xc8, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xce, 0xd5, 0xff, 0xf5, 0x8b, 0x9e, 0xff, 0xf3, 0x76, 0x8e, 0xff, 0xf3, 0x75, 0x90, 0xff, 0xf3, 0x73, 0x91, 0xff, 0xf3, 0x72, 0x93, 0xff, 0xf2, 0x71, 0x95, 0xff, 0xf2, 0x70, 0x96, 0xff, 0xf2, 0x70, 0x98, 0xff, 0xf2, 0x6f, 0x99, 0xff, 0xf2, 0x6e, 0x9b, 0xff, 0xf2, 0x6d, 0x9c, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf1, 0x6a, 0xa0, 0xff, 0xf1, 0x69, 0xa1, 0xff, 0xf1, 0x68, 0xa3, 0xff, 0xf1, 0x67, 0xa4, 0xcc, 0xf0, 0x6a, 0xa5, 0x50, 0xf0, 0x6a, 0xa5, 0x4b, 0xf0, 0x6a, 0xa5, 0x44, 0xf0, 0x6a, 0xa5, 0x3f, 0xf0, 0x6a, 0xa5, 0x37, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1f, 0xf6, 0x8b, 0x6d, 0xaf, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8c, 0x6b, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x8a, 0x6f, 0xff, 0xf6, 0x89, 0x70, 0xff, 0xf5, 0x88, 0x72, 0xff, 0xf5, 0x87, 0x74, 0xff, 0xf5, 0x86, 0x75, 0xff, 0xf5, 0x85, 0x77, 0xff, 0xf5, 0x84, 0x79, 0xff, 0xf5, 0x82, 0x7a, 0xff, 0xf5, 0x81, 0x7c, 0xff, 0xfa, 0xc8, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe2, 0xe5, 0xff, 0xf6, 0x9d, 0xaa, 0xff, 0xf3, 0x77, 0x8d, 0xff, 0xf3, 0x76, 0x8e, 0xff, 0xf3, 0x75, 0x90, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf3, 0x73, 0x93, 0xff, 0xf2, 0x72, 0x94, 0xff, 0xf2, 0x71, 0x96, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x6f, 0x99, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9c, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf1, 0x6a, 0xa0, 0xff, 0xf1, 0x69, 0xa1, 0xff, 0xf1, 0x68, 0xa3, 0xff, 0xf1, 0x68, 0xa4, 0xff, 0xf1, 0x68, 0xa5, 0x90, 0xf0, 0x6a, 0xa5, 0x50, 0xf0, 0x6a, 0xa5, 0x4b, 0xf0, 0x6a, 0xa5, 0x43, 0xf0, 0x6a, 0xa5, 0x3c, 0xf0, 0x6a, 0xa5, 0x37, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1f, 0xf4, 0x81, 0x7e, 0x54, 0xf6, 0x8c, 0x6b, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x8a, 0x6f, 0xff, 0xf6, 0x89, 0x70, 0xff, 0xf5, 0x88, 0x72, 0xff, 0xf5, 0x87, 0x74, 0xff, 0xf5, 0x86, 0x75, 0xff, 0xf5, 0x85, 0x77, 0xff, 0xf5, 0x84, 0x79, 0xff, 0xf5, 0x83, 0x7a, 0xff, 0xf5, 0x81, 0x7c, 0xff, 0xf4, 0x80, 0x7e, 0xff, 0xfb, 0xce, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf5, 0xf6, 0xff, 0xf8, 0xb3, 0xbc, 0xff, 0xf3, 0x78, 0x8b, 0xff, 0xf3, 0x77, 0x8d, 0xff, 0xf3, 0x76, 0x8e, 0xff, 0xf3, 0x75, 0x90, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf3, 0x73, 0x93, 0xff, 0xf2, 0x72, 0x94, 0xff, 0xf2, 0x71, 0x96, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x6f, 0x99, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9c, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf1, 0x6a, 0xa0, 0xff, 0xf1, 0x69, 0xa1, 0xff, 0xf1, 0x68, 0xa3, 0xff, 0xf1, 0x68, 0xa4, 0xff, 0xf1, 0x67, 0xa5, 0xf0, 0xf0, 0x6a, 0xa5, 0x58, 0xf0, 0x6a, 0xa5, 0x4f, 0xf0, 0x6a, 0xa5, 0x48, 0xf0, 0x6a, 0xa5, 0x40, 0xf0, 0x6a, 0xa5, 0x3b, 0xf0, 0x6a, 0xa5, 0x34, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x23, 0xf6, 0x89, 0x70, 0xcb, 0xf6, 0x8a, 0x6f, 0xff, 0xf6, 0x89, 0x70, 0xff, 0xf5, 0x88, 0x72, 0xff, 0xf5, 0x87, 0x73, 0xff, 0xf5, 0x86, 0x75, 0xff, 0xf5, 0x85, 0x77, 0xff, 0xf5, 0x84, 0x79, 0xff, 0xf5, 0x83, 0x7a, 0xff, 0xf5, 0x82, 0x7c, 0xff, 0xf4, 0x80, 0x7e, 0xff, 0xf4, 0x7f, 0x7f, 0xff, 0xf9, 0xb7, 0xb8, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf8, 0xf9, 0xff, 0xfe, 0xf6, 0xf6, 0xff, 0xfa, 0xc8, 0xce, 0xff, 0xf4, 0x81, 0x90, 0xff, 0xf3, 0x78, 0x8b, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf3, 0x76, 0x8e, 0xff, 0xf3, 0x75, 0x90, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf3, 0x73, 0x93, 0xff, 0xf2, 0x72, 0x94, 0xff, 0xf2, 0x71, 0x96, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x6f, 0x99, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9c, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf1, 0x6a, 0xa0, 0xff, 0xf1, 0x69, 0xa1, 0xff, 0xf1, 0x68, 0xa3, 0xff, 0xf1, 0x68, 0xa4, 0xff, 0xf1, 0x67, 0xa5, 0xff, 0xf1, 0x67, 0xa6, 0xa4, 0xf0, 0x6a, 0xa5, 0x50, 0xf0, 0x6a, 0xa5, 0x4c, 0xf0, 0x6a, 0xa5, 0x44, 0xf0, 0x6a, 0xa5, 0x3f, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x20, 0xf4, 0x7f, 0x82, 0x57, 0xf6, 0x89, 0x70, 0xff, 0xf5, 0x88, 0x72, 0xff, 0xf5, 0x87, 0x73, 0xff, 0xf5, 0x86, 0x75, 0xff, 0xf5, 0x85, 0x77, 0xff, 0xf5, 0x84, 0x78, 0xff, 0xf5, 0x83, 0x7a, 0xff, 0xf5, 0x82, 0x7c, 0xff, 0xf4, 0x80, 0x7d, 0xff, 0xf4, 0x7f, 0x7f, 0xff, 0xf4, 0x7e, 0x81, 0xff, 0xf4, 0x7d, 0x82, 0xff, 0xf4, 0x7c, 0x84, 0xff, 0xf4, 0x7b, 0x86, 0xff, 0xf4, 0x7a, 0x87, 0xff, 0xf3, 0x79, 0x89, 0xff, 0xf3, 0x78, 0x8b, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf3, 0x76, 0x8e, 0xff, 0xf3, 0x75, 0x90, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf3, 0x73, 0x93, 0xff, 0xf2, 0x72, 0x94, 0xff, 0xf2, 0x71, 0x96, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x6f, 0x99, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9c, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf1, 0x6a, 0xa0, 0xff, 0xf1, 0x69, 0xa1, 0xff, 0xf1, 0x68, 0xa2, 0xff, 0xf1, 0x68, 0xa4, 0xff, 0xf1, 0x67, 0xa5, 0xff, 0xf1, 0x66, 0xa6, 0xeb, 0xf0, 0x69, 0xa5, 0x5b, 0xf0, 0x6a, 0xa5, 0x4f, 0xf0, 0x6a, 0xa5, 0x48, 0xf0, 0x6a, 0xa5, 0x43, 0xf0, 0x6a, 0xa5, 0x3c, 0xf0, 0x6a, 0xa5, 0x37, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x24, 0xf5, 0x85, 0x77, 0xa8, 0xf5, 0x87, 0x73, 0xff, 0xf5, 0x86, 0x75, 0xff, 0xf5, 0x85, 0x77, 0xff, 0xf5, 0x84, 0x78, 0xff, 0xf5, 0x83, 0x7a, 0xff, 0xf5, 0x82, 0x7c, 0xff, 0xf4, 0x81, 0x7d, 0xff, 0xf4, 0x7f, 0x7f, 0xff, 0xf4, 0x7e, 0x81, 0xff, 0xf4, 0x7d, 0x82, 0xff, 0xf4, 0x7c, 0x84, 0xff, 0xf4, 0x7b, 0x86, 0xff, 0xf4, 0x7a, 0x87, 0xff, 0xf3, 0x79, 0x89, 0xff, 0xf3, 0x78, 0x8b, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf3, 0x76, 0x8e, 0xff, 0xf3, 0x75, 0x8f, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf3, 0x73, 0x93, 0xff, 0xf2, 0x72, 0x94, 0xff, 0xf2, 0x71, 0x96, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x6f, 0x99, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9c, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf1, 0x6a, 0xa0, 0xff, 0xf1, 0x69, 0xa1, 0xff, 0xf1, 0x68, 0xa2, 0xff, 0xf1, 0x68, 0xa4, 0xff, 0xf1, 0x67, 0xa5, 0xff, 0xf1, 0x66, 0xa6, 0xff, 0xf1, 0x67, 0xa6, 0x8b, 0xf0, 0x6a, 0xa5, 0x50, 0xf0, 0x6a, 0xa5, 0x4c, 0xf0, 0x6a, 0xa5, 0x47, 0xf0, 0x6a, 0xa5, 0x40, 0xf0, 0x6a, 0xa5, 0x3b, 0xf0, 0x6a, 0xa5, 0x34, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x23, 0xf1, 0x71, 0x9a, 0x30, 0xf5, 0x85, 0x77, 0xdf, 0xf5, 0x85, 0x77, 0xff, 0xf5, 0x84, 0x78, 0xff, 0xf5, 0x83, 0x7a, 0xff, 0xf5, 0x82, 0x7c, 0xff, 0xf4, 0x81, 0x7d, 0xff, 0xf4, 0x7f, 0x7f, 0xff, 0xf4, 0x7e, 0x81, 0xff, 0xf4, 0x7d, 0x82, 0xff, 0xf4, 0x7c, 0x84, 0xff, 0xf4, 0x7b, 0x86, 0xff, 0xf4, 0x7a, 0x87, 0xff, 0xf3, 0x79, 0x89, 0xff, 0xf3, 0x78, 0x8b, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf3, 0x76, 0x8e, 0xff, 0xf3, 0x75, 0x8f, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf3, 0x73, 0x93, 0xff, 0xf2, 0x72, 0x94, 0xff, 0xf2, 0x71, 0x96, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x6f, 0x99, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9c, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf1, 0x6a, 0xa0, 0xff, 0xf1, 0x69, 0xa1, 0xff, 0xf1, 0x69, 0xa2, 0xff, 0xf1, 0x68, 0xa4, 0xff, 0xf1, 0x67, 0xa5, 0xff, 0xf1, 0x66, 0xa6, 0xff, 0xf1, 0x66, 0xa7, 0xbc, 0xf0, 0x6a, 0xa5, 0x53, 0xf0, 0x6a, 0xa5, 0x4f, 0xf0, 0x6a, 0xa5, 0x48, 0xf0, 0x6a, 0xa5, 0x43, 0xf0, 0x6a, 0xa5, 0x3c, 0xf0, 0x6a, 0xa5, 0x37, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x24, 0xf3, 0x79, 0x8c, 0x4f, 0xf5, 0x84, 0x79, 0xf3, 0xf5, 0x83, 0x7a, 0xff, 0xf5, 0x82, 0x7c, 0xff, 0xf4, 0x81, 0x7d, 0xff, 0xf4, 0x80, 0x7f, 0xff, 0xf4, 0x7e, 0x81, 0xff, 0xf4, 0x7d, 0x82, 0xff, 0xf4, 0x7c, 0x84, 0xff, 0xf4, 0x7b, 0x86, 0xff, 0xf4, 0x7a, 0x87, 0xff, 0xf3, 0x79, 0x89, 0xff, 0xf3, 0x78, 0x8a, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf3, 0x76, 0x8e, 0xff, 0xf3, 0x75, 0x8f, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf2, 0x72, 0x94, 0xff, 0xf2, 0x71, 0x96, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x6f, 0x99, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf1, 0x6a, 0xa0, 0xff, 0xf1, 0x69, 0xa1, 0xff, 0xf1, 0x69, 0xa2, 0xff, 0xf1, 0x68, 0xa4, 0xff, 0xf1, 0x67, 0xa5, 0xff, 0xf1, 0x66, 0xa6, 0xff, 0xf1, 0x65, 0xa7, 0xdb, 0xf0, 0x69, 0xa5, 0x5b, 0xf0, 0x6a, 0xa5, 0x4f, 0xf0, 0x6a, 0xa5, 0x4b, 0xf0, 0x6a, 0xa5, 0x44, 0xf0, 0x6a, 0xa5, 0x3f, 0xf0, 0x6a, 0xa5, 0x3b, 0xf0, 0x6a, 0xa5, 0x34, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x27, 0xf3, 0x7a, 0x89, 0x63, 0xf5, 0x82, 0x7b, 0xf7, 0xf4, 0x81, 0x7d, 0xff, 0xf4, 0x80, 0x7f, 0xff, 0xf4, 0x7f, 0x80, 0xff, 0xf4, 0x7d, 0x82, 0xff, 0xf4, 0x7c, 0x84, 0xff, 0xf4, 0x7b, 0x85, 0xff, 0xf4, 0x7a, 0x87, 0xff, 0xf3, 0x79, 0x89, 0xff, 0xf3, 0x78, 0x8a, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf3, 0x76, 0x8e, 0xff, 0xf3, 0x75, 0x8f, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf2, 0x72, 0x94, 0xff, 0xf2, 0x71, 0x95, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf1, 0x6a, 0xa0, 0xff, 0xf1, 0x69, 0xa1, 0xff, 0xf1, 0x69, 0xa2, 0xff, 0xf1, 0x68, 0xa3, 0xff, 0xf1, 0x67, 0xa5, 0xff, 0xf1, 0x66, 0xa6, 0xff, 0xf1, 0x65, 0xa7, 0xe7, 0xf0, 0x69, 0xa6, 0x63, 0xf0, 0x6a, 0xa5, 0x50, 0xf0, 0x6a, 0xa5, 0x4b, 0xf0, 0x6a, 0xa5, 0x47, 0xf0, 0x6a, 0xa5, 0x40, 0xf0, 0x6a, 0xa5, 0x3c, 0xf0, 0x6a, 0xa5, 0x37, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x28, 0xf3, 0x79, 0x8b, 0x63, 0xf4, 0x80, 0x7f, 0xf3, 0xf4, 0x7f, 0x80, 0xff, 0xf4, 0x7d, 0x82, 0xff, 0xf4, 0x7c, 0x84, 0xff, 0xf4, 0x7b, 0x85, 0xff, 0xf4, 0x7a, 0x87, 0xff, 0xf3, 0x79, 0x89, 0xff, 0xf3, 0x78, 0x8a, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf3, 0x76, 0x8e, 0xff, 0xf3, 0x75, 0x8f, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf2, 0x72, 0x94, 0xff, 0xf2, 0x71, 0x95, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf1, 0x6a, 0xa0, 0xff, 0xf1, 0x6a, 0xa1, 0xff, 0xf1, 0x69, 0xa2, 0xff, 0xf1, 0x68, 0xa3, 0xff, 0xf1, 0x67, 0xa5, 0xff, 0xf1, 0x66, 0xa6, 0xff, 0xf1, 0x65, 0xa7, 0xe0, 0xf0, 0x69, 0xa6, 0x64, 0xf0, 0x6a, 0xa5, 0x50, 0xf0, 0x6a, 0xa5, 0x4c, 0xf0, 0x6a, 0xa5, 0x47, 0xf0, 0x6a, 0xa5, 0x43, 0xf0, 0x6a, 0xa5, 0x3c, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x2b, 0xf2, 0x75, 0x92, 0x53, 0xf4, 0x7d, 0x83, 0xdf, 0xf4, 0x7c, 0x84, 0xff, 0xf4, 0x7b, 0x85, 0xff, 0xf4, 0x7a, 0x87, 0xff, 0xf3, 0x79, 0x89, 0xff, 0xf3, 0x78, 0x8a, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf3, 0x76, 0x8d, 0xff, 0xf3, 0x75, 0x8f, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf3, 0x72, 0x94, 0xff, 0xf2, 0x71, 0x95, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6a, 0x9f, 0xff, 0xf1, 0x6a, 0xa1, 0xff, 0xf1, 0x69, 0xa2, 0xff, 0xf1, 0x68, 0xa3, 0xff, 0xf1, 0x67, 0xa5, 0xff, 0xf1, 0x66, 0xa6, 0xff, 0xf1, 0x67, 0xa7, 0xc8, 0xf0, 0x69, 0xa5, 0x5c, 0xf0, 0x6a, 0xa5, 0x50, 0xf0, 0x6a, 0xa5, 0x4b, 0xf0, 0x6a, 0xa5, 0x47, 0xf0, 0x6a, 0xa5, 0x43, 0xf0, 0x6a, 0xa5, 0x3f, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x34, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x2c, 0xf1, 0x6e, 0x9e, 0x3b, 0xf3, 0x79, 0x89, 0xac, 0xf4, 0x7a, 0x87, 0xfc, 0xf3, 0x79, 0x89, 0xff, 0xf3, 0x78, 0x8a, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf3, 0x76, 0x8d, 0xff, 0xf3, 0x75, 0x8f, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf3, 0x72, 0x94, 0xff, 0xf2, 0x71, 0x95, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6a, 0x9f, 0xff, 0xf1, 0x6a, 0xa1, 0xff, 0xf1, 0x69, 0xa2, 0xff, 0xf1, 0x68, 0xa3, 0xff, 0xf1, 0x67, 0xa5, 0xff, 0xf1, 0x66, 0xa6, 0xf4, 0xf1, 0x67, 0xa6, 0x9b, 0xf0, 0x6a, 0xa5, 0x53, 0xf0, 0x6a, 0xa5, 0x4f, 0xf0, 0x6a, 0xa5, 0x4b, 0xf0, 0x6a, 0xa5, 0x47, 0xf0, 0x6a, 0xa5, 0x43, 0xf0, 0x6a, 0xa5, 0x3f, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x34, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x30, 0xf2, 0x72, 0x95, 0x60, 0xf3, 0x77, 0x8c, 0xcb, 0xf3, 0x77, 0x8c, 0xff, 0xf3, 0x76, 0x8d, 0xff, 0xf3, 0x75, 0x8f, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf3, 0x72, 0x94, 0xff, 0xf2, 0x71, 0x95, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6a, 0x9f, 0xff, 0xf1, 0x6a, 0xa1, 0xff, 0xf1, 0x69, 0xa2, 0xff, 0xf1, 0x68, 0xa3, 0xff, 0xf1, 0x67, 0xa4, 0xfb, 0xf1, 0x67, 0xa6, 0xbb, 0xf0, 0x69, 0xa5, 0x63, 0xf0, 0x6a, 0xa5, 0x50, 0xf0, 0x6a, 0xa5, 0x4c, 0xf0, 0x6a, 0xa5, 0x48, 0xf0, 0x6a, 0xa5, 0x44, 0xf0, 0x6a, 0xa5, 0x40, 0xf0, 0x6a, 0xa5, 0x3c, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x34, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x34, 0xf2, 0x71, 0x98, 0x64, 0xf3, 0x74, 0x92, 0xb4, 0xf3, 0x74, 0x90, 0xf4, 0xf3, 0x73, 0x92, 0xff, 0xf3, 0x72, 0x94, 0xff, 0xf2, 0x71, 0x95, 0xff, 0xf2, 0x70, 0x97, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6c, 0x9c, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf2, 0x6b, 0x9f, 0xff, 0xf1, 0x6a, 0xa1, 0xff, 0xf1, 0x69, 0xa2, 0xff, 0xf1, 0x68, 0xa3, 0xe8, 0xf1, 0x68, 0xa4, 0xab, 0xf0, 0x69, 0xa5, 0x64, 0xf0, 0x6a, 0xa5, 0x4f, 0xf0, 0x6a, 0xa5, 0x4c, 0xf0, 0x6a, 0xa5, 0x4b, 0xf0, 0x6a, 0xa5, 0x47, 0xf0, 0x6a, 0xa5, 0x43, 0xf0, 0x6a, 0xa5, 0x40, 0xf0, 0x6a, 0xa5, 0x3c, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x34, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x34, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6b, 0xa3, 0x40, 0xf2, 0x6f, 0x9b, 0x6f, 0xf2, 0x70, 0x98, 0xa3, 0xf2, 0x6f, 0x99, 0xc3, 0xf2, 0x6f, 0x99, 0xdf, 0xf2, 0x6e, 0x9a, 0xf0, 0xf2, 0x6d, 0x9b, 0xf8, 0xf2, 0x6c, 0x9c, 0xf4, 0xf2, 0x6b, 0x9e, 0xef, 0xf2, 0x6b, 0x9f, 0xdb, 0xf1, 0x6a, 0xa2, 0xbf, 0xf1, 0x69, 0xa3, 0x9c, 0xf0, 0x69, 0xa4, 0x6f, 0xf0, 0x6a, 0xa5, 0x4f, 0xf0, 0x6a, 0xa5, 0x4c, 0xf0, 0x6a, 0xa5, 0x4b, 0xf0, 0x6a, 0xa5, 0x48, 0xf0, 0x6a, 0xa5, 0x47, 0xf0, 0x6a, 0xa5, 0x44, 0xf0, 0x6a, 0xa5, 0x40, 0xf0, 0x6a, 0xa5, 0x3f, 0xf0, 0x6a, 0xa5, 0x3b, 0xf0, 0x6a, 0xa5, 0x37, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x34, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x3c, 0xf0, 0x6a, 0xa5, 0x3f, 0xf0, 0x6a, 0xa5, 0x40, 0xf0, 0x6a, 0xa5, 0x43, 0xf0, 0x6a, 0xa5, 0x44, 0xf0, 0x6a, 0xa5, 0x47, 0xf0, 0x6a, 0xa5, 0x48, 0xf0, 0x6a, 0xa5, 0x48, 0xf0, 0x6a, 0xa5, 0x48, 0xf0, 0x6a, 0xa5, 0x48, 0xf0, 0x6a, 0xa5, 0x48, 0xf0, 0x6a, 0xa5, 0x47, 0xf0, 0x6a, 0xa5, 0x47, 0xf0, 0x6a, 0xa5, 0x44, 0xf0, 0x6a, 0xa5, 0x43, 0xf0, 0x6a, 0xa5, 0x40, 0xf0, 0x6a, 0xa5, 0x3f, 0xf0, 0x6a, 0xa5, 0x3b, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x34, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x34, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x3b, 0xf0, 0x6a, 0xa5, 0x3c, 0xf0, 0x6a, 0xa5, 0x3f, 0xf0, 0x6a, 0xa5, 0x40, 0xf0, 0x6a, 0xa5, 0x40, 0xf0, 0x6a, 0xa5, 0x40, 0xf0, 0x6a, 0xa5, 0x43, 0xf0, 0x6a, 0xa5, 0x43, 0xf0, 0x6a, 0xa5, 0x40, 0xf0, 0x6a, 0xa5, 0x40, 0xf0, 0x6a, 0xa5, 0x3f, 0xf0, 0x6a, 0xa5, 0x3f, 0xf0, 0x6a, 0xa5, 0x3c, 0xf0, 0x6a, 0xa5, 0x3b, 0xf0, 0x6a, 0xa5, 0x37, 0xf0, 0x6a, 0xa5, 0x34, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x34, 0xf0, 0x6a, 0xa5, 0x37, 0xf0, 0x6a, 0xa5, 0x37, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x3b, 0xf0, 0x6a, 0xa5, 0x3b, 0xf0, 0x6a, 0xa5, 0x3b, 0xf0, 0x6a, 0xa5, 0x3b, 0xf0, 0x6a, 0xa5, 0x3b, 0xf0, 0x6a, 0xa5, 0x3b, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x37, 0xf0, 0x6a, 0xa5, 0x34, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x34, 0xf0, 0x6a, 0xa5, 0x34, 0xf0, 0x6a, 0xa5, 0x34, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-#endif
-};
-
-lv_img_dsc_t img_lv_demo_music_btn_play = {
-  .header.always_zero = 0,
-  .header.w = 79,
-  .header.h = 77,
-  .data_size = 6083 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .data = img_lv_demo_music_btn_play_map,
-};
-
-#endif /*LV_USE_DEMO_MUSIC*/
-
-
@@ -1,281 +0,0 @@
-#include "../lv_demo_music.h"
-#if LV_USE_DEMO_MUSIC  && !LV_DEMO_MUSIC_LARGE
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t img_lv_demo_music_btn_prev_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xd7, 0x27, 0xff, 0x5c, 0xff, 0x83, 0xff, 0x94, 0xff, 0x94, 0xff, 0x8c, 0xff, 0x6b, 0xfb, 0x38, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xb3, 0x1b, 0xff, 0x63, 0xff, 0xc3, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x87, 0xd7, 0x27, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xff, 0x4b, 0xff, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0x7b, 0xb3, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xff, 0x80, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xd7, 0x27, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xd7, 0x27, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 0xb3, 0x1c, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xff, 0x47, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xb3, 0x18, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0x3b, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xff, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xff, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xd7, 0x27, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xd7, 0x20, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6c, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x17, 0xff, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x6a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xff, 0x78, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x92, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x17, 0xff, 0x58, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xd7, 0x27, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x74, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfb, 0x30, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xff, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x17, 0xb3, 0x1c, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xff, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xac, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x18, 0xff, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xd7, 0x27, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xb3, 0x1c, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xfb, 0x38, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xb3, 0x1c, 0xff, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xfb, 0x34, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xff, 0x6f, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xd7, 0x23, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xd7, 0x28, 0xff, 0x8f, 0xff, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xb3, 0xff, 0x47, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xb3, 0x1b, 0xff, 0x4f, 0xff, 0x87, 0xff, 0xab, 0xff, 0xc0, 0xff, 0xc3, 0xff, 0xb3, 0xff, 0x94, 0xff, 0x64, 0xd7, 0x27, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x5f, 0xcd, 0x27, 0x3f, 0xf7, 0x5c, 0x9f, 0xff, 0x83, 0xbf, 0xff, 0x94, 0xbf, 0xff, 0x94, 0x9f, 0xff, 0x8c, 0x5f, 0xf7, 0x6b, 0x5f, 0xde, 0x38, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0xde, 0xa3, 0x1b, 0x3f, 0xf7, 0x63, 0xdf, 0xff, 0xc3, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x9f, 0xff, 0x87, 0x7f, 0xcd, 0x27, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0xdf, 0xee, 0x4b, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0xf7, 0x7b, 0x9e, 0xa3, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0x9f, 0xf7, 0x80, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbf, 0x5f, 0xcd, 0x27, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0xbf, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x7f, 0xcd, 0x27, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x9f, 0xf7, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xcb, 0x3e, 0xb4, 0x1c, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0xbf, 0xe6, 0x47, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x90, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x9e, 0xa3, 0x18, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x7f, 0xde, 0x3b, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x1f, 0xef, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xab, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0xdf, 0xff, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xef, 0xff, 0xd8, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7f, 0xcd, 0x27, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0xbf, 0xbc, 0x20, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x9c, 0xff, 0x6e, 0x52, 0xff, 0x7e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5e, 0xef, 0xff, 0x13, 0x84, 0xff, 0x51, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xf7, 0x6c, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x17, 0xff, 0xee, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x9c, 0xff, 0x6e, 0x52, 0xff, 0x5e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xad, 0xff, 0x8e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x9f, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7f, 0xf7, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x9c, 0xff, 0x6e, 0x52, 0xff, 0x5e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xc5, 0xff, 0x30, 0x6b, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xef, 0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xc3, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x9f, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x9c, 0xff, 0x6e, 0x52, 0xff, 0x5e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xde, 0xff, 0xf2, 0x83, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xef, 0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x9f, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x9c, 0xff, 0x6e, 0x52, 0xff, 0x5e, 0xef, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xef, 0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7f, 0xf7, 0x78, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x9c, 0xff, 0x6e, 0x52, 0xff, 0x5e, 0xef, 0xff, 0xff, 0xff, 0xff, 0x7b, 0xd6, 0xff, 0xb1, 0x7b, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xef, 0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xc7, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x17, 0x3f, 0xef, 0x58, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x9c, 0xff, 0x6e, 0x52, 0xff, 0x5e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xbd, 0xff, 0x0f, 0x63, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xef, 0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xa7, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7f, 0xcd, 0x27, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x9c, 0xff, 0x6e, 0x52, 0xff, 0x5e, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x16, 0xa5, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xf7, 0x74, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0xdf, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xa4, 0xff, 0x6e, 0x52, 0xff, 0x7e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1d, 0xe7, 0xff, 0xd2, 0x7b, 0xff, 0x50, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f, 0xde, 0x30, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x5f, 0xf7, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0x5a, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbf, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x17, 0x3e, 0xb4, 0x1c, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x4f, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x3f, 0xf7, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xac, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0xbf, 0xff, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x5f, 0xcd, 0x27, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x3e, 0xb4, 0x1c, 0xdf, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x5f, 0xde, 0x38, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x1e, 0xac, 0x1c, 0xbf, 0xff, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x1f, 0xde, 0x34, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0x5f, 0xf7, 0x6f, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xa4, 0xff, 0xbc, 0x23, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x9f, 0xcd, 0x28, 0xbf, 0xff, 0x8f, 0xff, 0xff, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xdf, 0xff, 0xb3, 0xbf, 0xe6, 0x47, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0xfe, 0xab, 0x1b, 0xff, 0xee, 0x4f, 0x9f, 0xff, 0x87, 0xdf, 0xff, 0xab, 0xdf, 0xff, 0xc0, 0xdf, 0xff, 0xc3, 0xdf, 0xff, 0xb3, 0xbf, 0xff, 0x94, 0x3f, 0xf7, 0x64, 0x7f, 0xcd, 0x27, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0xcd, 0x5f, 0x27, 0xf7, 0x3f, 0x5c, 0xff, 0x9f, 0x83, 0xff, 0xbf, 0x94, 0xff, 0xbf, 0x94, 0xff, 0x9f, 0x8c, 0xf7, 0x5f, 0x6b, 0xde, 0x5f, 0x38, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xa3, 0xde, 0x1b, 0xf7, 0x3f, 0x63, 0xff, 0xdf, 0xc3, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x9f, 0x87, 0xcd, 0x7f, 0x27, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xee, 0xdf, 0x4b, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf7, 0x7f, 0x7b, 0xa3, 0x9e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xf7, 0x9f, 0x80, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xbf, 0xcd, 0x5f, 0x27, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xff, 0xbf, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xcd, 0x7f, 0x27, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xf7, 0x9f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xcb, 0xb4, 0x3e, 0x1c, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xe6, 0xbf, 0x47, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x90, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0xa3, 0x9e, 0x18, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xde, 0x7f, 0x3b, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xef, 0x1f, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xab, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xff, 0xdf, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x3d, 0xff, 0xbd, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xcd, 0x7f, 0x27, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0xbc, 0xbf, 0x20, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xd5, 0xff, 0x52, 0x6e, 0xff, 0xef, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5e, 0xff, 0x84, 0x13, 0xff, 0x73, 0x51, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x5f, 0x6c, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x17, 0xee, 0xff, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xb5, 0xff, 0x52, 0x6e, 0xff, 0xef, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0x57, 0xff, 0x52, 0x8e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x9f, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xf7, 0x7f, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xb5, 0xff, 0x52, 0x6e, 0xff, 0xef, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xf9, 0xff, 0x6b, 0x30, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x62, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xc3, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xff, 0x9f, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xb5, 0xff, 0x52, 0x6e, 0xff, 0xef, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xde, 0xbc, 0xff, 0x83, 0xf2, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x62, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xff, 0x9f, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xb5, 0xff, 0x52, 0x6e, 0xff, 0xef, 0x5e, 0xff, 0xff, 0xff, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x62, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xf7, 0x7f, 0x78, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xb5, 0xff, 0x52, 0x6e, 0xff, 0xef, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x7b, 0xff, 0x7b, 0xb1, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x62, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xc7, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x17, 0xef, 0x3f, 0x58, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xb5, 0xff, 0x52, 0x6e, 0xff, 0xef, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xb8, 0xff, 0x63, 0x0f, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x62, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xa7, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0xcd, 0x7f, 0x27, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xb5, 0xff, 0x52, 0x6e, 0xff, 0xef, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xa5, 0x16, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7f, 0x74, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xff, 0xdf, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xf6, 0xff, 0x52, 0x6e, 0xff, 0xf7, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x1d, 0xff, 0x7b, 0xd2, 0xff, 0x6b, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xde, 0x1f, 0x30, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xf7, 0x5f, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0xce, 0x5a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xbf, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x17, 0xb4, 0x3e, 0x1c, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0x4f, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xf7, 0x3f, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xac, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xff, 0xbf, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xcd, 0x5f, 0x27, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xb4, 0x3e, 0x1c, 0xff, 0xdf, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xde, 0x5f, 0x38, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0xac, 0x1e, 0x1c, 0xff, 0xbf, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xde, 0x1f, 0x34, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xf7, 0x5f, 0x6f, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xa4, 0xbc, 0xff, 0x23, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0xcd, 0x9f, 0x28, 0xff, 0xbf, 0x8f, 0xff, 0xff, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xdf, 0xb3, 0xe6, 0xbf, 0x47, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0xab, 0xfe, 0x1b, 0xee, 0xff, 0x4f, 0xff, 0x9f, 0x87, 0xff, 0xdf, 0xab, 0xff, 0xdf, 0xc0, 0xff, 0xdf, 0xc3, 0xff, 0xdf, 0xb3, 0xff, 0xbf, 0x94, 0xf7, 0x3f, 0x64, 0xcd, 0x7f, 0x27, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 32
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf7, 0xaa, 0xc6, 0x27, 0xfd, 0xe4, 0xed, 0x5c, 0xfe, 0xef, 0xf5, 0x83, 0xfe, 0xf3, 0xf7, 0x94, 0xfe, 0xf4, 0xf8, 0x94, 0xfe, 0xf2, 0xf6, 0x8c, 0xfd, 0xe9, 0xf0, 0x6b, 0xfa, 0xc9, 0xdb, 0x38, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf3, 0x78, 0xa4, 0x1b, 0xfd, 0xe6, 0xee, 0x63, 0xff, 0xfa, 0xfc, 0xc3, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xdf, 0xfe, 0xf1, 0xf5, 0x87, 0xf8, 0xac, 0xc7, 0x27, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xfc, 0xd8, 0xe5, 0x4b, 0xff, 0xfc, 0xfd, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xf0, 0xfe, 0xee, 0xf4, 0x7b, 0xf3, 0x72, 0xa0, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xfe, 0xef, 0xf4, 0x80, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfc, 0xbf, 0xf7, 0xaa, 0xc6, 0x27, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xfe, 0xf3, 0xf7, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xd4, 0xf8, 0xac, 0xc7, 0x27, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfe, 0xef, 0xf4, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfc, 0xcb, 0xf4, 0x85, 0xad, 0x1c, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfb, 0xd5, 0xe3, 0x47, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf3, 0xf7, 0x90, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf3, 0x72, 0xa0, 0x18, 0xff, 0xfb, 0xfc, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfb, 0xfa, 0xcb, 0xdc, 0x3b, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfc, 0xe2, 0xec, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf8, 0xfa, 0xab, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfe, 0xf9, 0xfb, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xe6, 0xe6, 0xff, 0xc4, 0xb7, 0xb8, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf8, 0xf8, 0xac, 0xc7, 0x27, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf6, 0x96, 0xb8, 0x20, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xac, 0x9a, 0x9b, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xef, 0xeb, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xe9, 0xe9, 0xff, 0x96, 0x7f, 0x81, 0xff, 0x85, 0x6a, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe9, 0xf0, 0x6c, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x17, 0xfc, 0xde, 0xe8, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x96, 0x98, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xee, 0xea, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xb7, 0xa8, 0xa9, 0xff, 0x70, 0x50, 0x53, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf6, 0xf9, 0x9f, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfd, 0xec, 0xf2, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x96, 0x98, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xee, 0xea, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0xbe, 0xbf, 0xff, 0x80, 0x65, 0x67, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x78, 0x5b, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfc, 0xc3, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfe, 0xf1, 0xf5, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x96, 0x98, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xee, 0xea, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xd5, 0xd6, 0xff, 0x93, 0x7c, 0x7e, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x78, 0x5b, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xd4, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfe, 0xf1, 0xf5, 0x84, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x96, 0x98, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xee, 0xea, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x78, 0x5b, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xd7, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfd, 0xed, 0xf3, 0x78, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x96, 0x98, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xee, 0xea, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xcc, 0xcd, 0xff, 0x8c, 0x73, 0x75, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x78, 0x5b, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfc, 0xc7, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x17, 0xfd, 0xe3, 0xec, 0x58, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x96, 0x98, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xee, 0xea, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xb6, 0xb8, 0xff, 0x7c, 0x5f, 0x62, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x78, 0x5b, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf6, 0xf9, 0xa7, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf8, 0xac, 0xc7, 0x27, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x96, 0x98, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xee, 0xea, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf8, 0xf8, 0xff, 0xb1, 0x9f, 0xa1, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xec, 0xf2, 0x74, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xff, 0xfa, 0xfc, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0x9c, 0x9e, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xf0, 0xed, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xe0, 0xe1, 0xff, 0x90, 0x78, 0x7b, 0xff, 0x83, 0x68, 0x6a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf9, 0xc0, 0xd5, 0x30, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfd, 0xea, 0xf1, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xef, 0xef, 0xff, 0xd3, 0xc9, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfc, 0xbf, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x17, 0xf4, 0x85, 0xad, 0x1c, 0xff, 0xfd, 0xfe, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xdc, 0xe7, 0x4f, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xfd, 0xe4, 0xed, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf8, 0xfa, 0xac, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xfe, 0xf5, 0xf8, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xdf, 0xf7, 0xaa, 0xc6, 0x27, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf4, 0x85, 0xad, 0x1c, 0xfe, 0xf9, 0xfb, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xeb, 0xfa, 0xc9, 0xdb, 0x38, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf4, 0x81, 0xaa, 0x1c, 0xfe, 0xf5, 0xf8, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xd4, 0xf9, 0xc1, 0xd5, 0x34, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xfd, 0xea, 0xf1, 0x6f, 0xff, 0xfe, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf6, 0xf9, 0xa4, 0xf6, 0x9c, 0xbc, 0x23, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf8, 0xb0, 0xca, 0x28, 0xfe, 0xf3, 0xf7, 0x8f, 0xff, 0xfd, 0xfe, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf8, 0xfe, 0xf8, 0xfa, 0xb3, 0xfb, 0xd5, 0xe3, 0x47, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf3, 0x7c, 0xa7, 0x1b, 0xfc, 0xde, 0xe8, 0x4f, 0xfe, 0xf1, 0xf5, 0x87, 0xfe, 0xf8, 0xfa, 0xab, 0xff, 0xfa, 0xfc, 0xc0, 0xff, 0xfa, 0xfc, 0xc3, 0xfe, 0xf9, 0xfb, 0xb3, 0xfe, 0xf4, 0xf8, 0x94, 0xfd, 0xe6, 0xee, 0x64, 0xf8, 0xac, 0xc7, 0x27, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-#endif
-};
-
-lv_img_dsc_t img_lv_demo_music_btn_prev = {
-  .header.always_zero = 0,
-  .header.w = 62,
-  .header.h = 62,
-  .data_size = 3844 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .data = img_lv_demo_music_btn_prev_map,
-};
-
-#endif /*LV_USE_DEMO_MUSIC*/
-
-
@@ -1,477 +0,0 @@
-#include "../lv_demo_music.h"
-#if LV_USE_DEMO_MUSIC && LV_DEMO_MUSIC_LARGE
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMG_LV_DEMO_MUSIC_BTN_PREV
-#define LV_ATTRIBUTE_IMG_IMG_LV_DEMO_MUSIC_BTN_PREV
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMG_LV_DEMO_MUSIC_BTN_PREV uint8_t img_lv_demo_music_btn_prev_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Blue: 2 bit, Green: 3 bit, Red: 3 bit, Alpha 8 bit */
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x18, 0xd7, 0x23, 0xff, 0x47, 0xff, 0x68, 0xff, 0x78, 0xff, 0x84, 0xff, 0x84, 0xff, 0x7b, 0xff, 0x70, 0xff, 0x4f, 0xdb, 0x2b, 0xaf, 0x18, 0xaf, 0x18, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x18, 0xb3, 0x18, 0xff, 0x50, 0xff, 0x98, 0xff, 0xd4, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xa8, 0xff, 0x67, 0xd7, 0x20, 0xaf, 0x18, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x18, 0xd7, 0x27, 0xff, 0x88, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xa0, 0xfb, 0x38, 0xaf, 0x18, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x18, 0xd7, 0x20, 0xff, 0x8c, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xac, 0xfb, 0x34, 0xaf, 0x18, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x18, 0xff, 0x58, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0x7f, 0xb3, 0x1b, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x18, 0xb3, 0x1c, 0xff, 0x98, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xdb, 0x2b, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x18, 0xd7, 0x23, 0xff, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xfb, 0x38, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x18, 0xd7, 0x27, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xfb, 0x43, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xd7, 0x23, 0xff, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xfb, 0x38, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x18, 0xff, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xd7, 0x24, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x18, 0xff, 0x74, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xfb, 0x3b, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x68, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x18, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xd7, 0x27, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xff, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x18, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xd7, 0x27, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xff, 0x47, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xff, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xb3, 0x18, 0xff, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x40, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xff, 0x43, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x83, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xff, 0xa8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xff, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xd7, 0x1f, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xff, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x38, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x44, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x6a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x48, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x3c, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xff, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x27, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xff, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x6a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xff, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xd3, 0x1f, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x6e, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xff, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xb3, 0x1b, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xff, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x6e, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xb3, 0x1c, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0x38, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xff, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xac, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xb3, 0x1f, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xfb, 0x3b, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xff, 0x58, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8c, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x18, 0xff, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xd7, 0x20, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xd7, 0x20, 0xff, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xfb, 0x3b, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x18, 0xfb, 0x34, 0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0x5b, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x18, 0xfb, 0x43, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0x6b, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x18, 0xfb, 0x3c, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0x63, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x18, 0xfb, 0x30, 0xff, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0x4f, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x18, 0xb3, 0x1c, 0xff, 0x90, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xdb, 0x2b, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x18, 0xfb, 0x40, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0x67, 0xaf, 0x18, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x18, 0xff, 0x54, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x77, 0xb3, 0x1f, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x18, 0xfb, 0x38, 0xff, 0x8c, 0xff, 0xd3, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xa0, 0xff, 0x4c, 0xb3, 0x18, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x18, 0xd7, 0x28, 0xff, 0x5f, 0xff, 0x87, 0xff, 0xa4, 0xff, 0xb3, 0xff, 0xc0, 0xff, 0xc3, 0xff, 0xb4, 0xff, 0xab, 0xff, 0x88, 0xff, 0x67, 0xfb, 0x37, 0xaf, 0x18, 0xaf, 0x18, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x18, 0xaf, 0x18, 0xaf, 0x18, 0xaf, 0x18, 0xaf, 0x18, 0xaf, 0x18, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Blue: 5 bit, Green: 6 bit, Red: 5 bit, Alpha 8 bit*/
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x18, 0xff, 0xc4, 0x23, 0xbf, 0xe6, 0x47, 0x5f, 0xf7, 0x68, 0x7f, 0xf7, 0x78, 0x9f, 0xff, 0x84, 0x9f, 0xff, 0x84, 0x7f, 0xf7, 0x7b, 0x5f, 0xf7, 0x70, 0xff, 0xee, 0x4f, 0xbf, 0xd5, 0x2b, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0x9e, 0xa3, 0x18, 0xff, 0xee, 0x50, 0xbf, 0xff, 0x98, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xbf, 0xff, 0xa8, 0x5f, 0xf7, 0x67, 0xbf, 0xbc, 0x20, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x18, 0x5f, 0xcd, 0x27, 0x9f, 0xff, 0x88, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xbf, 0xff, 0xa0, 0x5f, 0xde, 0x38, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0xbf, 0xbc, 0x20, 0x9f, 0xff, 0x8c, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xdf, 0xff, 0xac, 0x1f, 0xde, 0x34, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x18, 0x1f, 0xef, 0x58, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9f, 0xf7, 0x7f, 0x9e, 0xa3, 0x1b, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0x1e, 0xac, 0x1c, 0xbf, 0xff, 0x98, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbc, 0x9f, 0xcd, 0x2b, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0xdf, 0xbc, 0x23, 0xdf, 0xff, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x5f, 0xde, 0x38, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0x3f, 0xc5, 0x27, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x9f, 0xe6, 0x43, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0xdf, 0xbc, 0x23, 0xff, 0xff, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x5f, 0xde, 0x38, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x18, 0xdf, 0xff, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0x1f, 0xc5, 0x24, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0x7f, 0xf7, 0x74, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xaf, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0x5f, 0xde, 0x3b, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xf7, 0x68, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0xdf, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x1f, 0xc5, 0x27, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0x1f, 0xef, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x90, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0xdf, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x5f, 0xcd, 0x27, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0xbf, 0xe6, 0x47, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xf7, 0x7f, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0xbf, 0xff, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xef, 0xff, 0x98, 0xb5, 0xff, 0x3d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x9e, 0xa3, 0x18, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x6b, 0xff, 0x6e, 0x52, 0xff, 0x30, 0x6b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xbd, 0xff, 0x30, 0x6b, 0xff, 0xb5, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xe6, 0x40, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0xbf, 0xe6, 0x43, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xde, 0xff, 0xb2, 0x7b, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0x83, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0x9f, 0xf7, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xff, 0xb5, 0x9c, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xef, 0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xb8, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0xdf, 0xff, 0xa8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x98, 0xb5, 0xff, 0xcf, 0x5a, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xef, 0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0xdf, 0xff, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xd6, 0xff, 0x91, 0x73, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xef, 0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x9f, 0xbc, 0x1f, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0xff, 0xff, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf7, 0xff, 0x94, 0x94, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xef, 0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xde, 0x38, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xbd, 0xff, 0xae, 0x5a, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xef, 0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xe6, 0x44, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xef, 0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x4f, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0xb5, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xef, 0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xee, 0x48, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xe7, 0xff, 0x33, 0x8c, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xef, 0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xe6, 0x3c, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0xce, 0xff, 0x50, 0x6b, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xef, 0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xcd, 0x27, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0xdf, 0xff, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x57, 0xad, 0xff, 0x8e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xef, 0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0x9f, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0xff, 0x54, 0x8c, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xef, 0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xc4, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0xff, 0xee, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xce, 0xff, 0x51, 0x73, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x90, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x9f, 0xb4, 0x1f, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0xad, 0xff, 0x0f, 0x63, 0xff, 0x74, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x54, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0xdf, 0xff, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x52, 0xff, 0x6e, 0x52, 0xff, 0x8e, 0x52, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xfe, 0xab, 0x1b, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0x3f, 0xef, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0xa5, 0xff, 0xae, 0x5a, 0xff, 0x16, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x94, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x1e, 0xac, 0x1c, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x5f, 0xde, 0x38, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0x7f, 0xf7, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xac, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x3e, 0xb4, 0x1f, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x5f, 0xde, 0x3b, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0x1f, 0xef, 0x58, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0x8c, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0xbf, 0xff, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x9f, 0xbc, 0x20, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0x9f, 0xbc, 0x20, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x7f, 0xde, 0x3b, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0x1f, 0xde, 0x34, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x1f, 0xef, 0x5b, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0x9f, 0xe6, 0x43, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x5f, 0xf7, 0x6b, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0x7f, 0xe6, 0x3c, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xf7, 0x63, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0xff, 0xd5, 0x30, 0xdf, 0xff, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xee, 0x4f, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0x1e, 0xac, 0x1c, 0xbf, 0xff, 0x90, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xb8, 0x9f, 0xcd, 0x2b, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x18, 0x9f, 0xe6, 0x40, 0xdf, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x5f, 0xf7, 0x67, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x18, 0xff, 0xee, 0x54, 0xdf, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x7f, 0xf7, 0x77, 0x5f, 0xb4, 0x1f, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x18, 0x5f, 0xde, 0x38, 0x9f, 0xff, 0x8c, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xbf, 0xff, 0xa0, 0xdf, 0xee, 0x4c, 0x9e, 0xa3, 0x18, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x18, 0x9f, 0xcd, 0x28, 0x3f, 0xef, 0x5f, 0x9f, 0xff, 0x87, 0xbf, 0xff, 0xa4, 0xdf, 0xff, 0xb3, 0xdf, 0xff, 0xc0, 0xdf, 0xff, 0xc3, 0xdf, 0xff, 0xb4, 0xdf, 0xff, 0xab, 0x9f, 0xff, 0x88, 0x5f, 0xf7, 0x67, 0x3f, 0xde, 0x37, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x18, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x17, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x14, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x13, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x10, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0f, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0c, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x0b, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x08, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x07, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x04, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x03, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-  0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00, 0x7e, 0x9b, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format:  Blue: 5 bit Green: 6 bit, Red: 5 bit, Alpha 8 bit  BUT the 2  color bytes are swapped*/
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x18, 0xc4, 0xff, 0x23, 0xe6, 0xbf, 0x47, 0xf7, 0x5f, 0x68, 0xf7, 0x7f, 0x78, 0xff, 0x9f, 0x84, 0xff, 0x9f, 0x84, 0xf7, 0x7f, 0x7b, 0xf7, 0x5f, 0x70, 0xee, 0xff, 0x4f, 0xd5, 0xbf, 0x2b, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xa3, 0x9e, 0x18, 0xee, 0xff, 0x50, 0xff, 0xbf, 0x98, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xbf, 0xa8, 0xf7, 0x5f, 0x67, 0xbc, 0xbf, 0x20, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x18, 0xcd, 0x5f, 0x27, 0xff, 0x9f, 0x88, 0xff, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xbf, 0xa0, 0xde, 0x5f, 0x38, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xbc, 0xbf, 0x20, 0xff, 0x9f, 0x8c, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xdf, 0xac, 0xde, 0x1f, 0x34, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x18, 0xef, 0x1f, 0x58, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0x9f, 0x7f, 0xa3, 0x9e, 0x1b, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xac, 0x1e, 0x1c, 0xff, 0xbf, 0x98, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xbc, 0xcd, 0x9f, 0x2b, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xbc, 0xdf, 0x23, 0xff, 0xdf, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xde, 0x5f, 0x38, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xc5, 0x3f, 0x27, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xe6, 0x9f, 0x43, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xbc, 0xdf, 0x23, 0xff, 0xff, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xde, 0x5f, 0x38, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x18, 0xff, 0xdf, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xc5, 0x1f, 0x24, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xf7, 0x7f, 0x74, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xaf, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xde, 0x5f, 0x3b, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x5f, 0x68, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xff, 0xdf, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xc5, 0x1f, 0x27, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xef, 0x1f, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x90, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xff, 0xdf, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xcd, 0x5f, 0x27, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xe6, 0xbf, 0x47, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9f, 0x7f, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xff, 0xbf, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x3d, 0xff, 0xb5, 0x98, 0xff, 0xef, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0xa3, 0x9e, 0x18, 0xff, 0xff, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6b, 0x30, 0xff, 0x52, 0x6e, 0xff, 0x6b, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xb8, 0xff, 0x6b, 0x30, 0xff, 0x9c, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x9f, 0x40, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0xe6, 0xbf, 0x43, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xbc, 0xff, 0x7b, 0xb2, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x83, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xf7, 0x9f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xff, 0x9c, 0xb5, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x62, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xb8, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xff, 0xdf, 0xa8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x98, 0xff, 0x5a, 0xcf, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x62, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xff, 0xdf, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x9b, 0xff, 0x73, 0x91, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x62, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xbc, 0x9f, 0x1f, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xff, 0xff, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7e, 0xff, 0x94, 0x94, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x62, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0x5f, 0x38, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xd9, 0xff, 0x5a, 0xae, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x62, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xbf, 0x44, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x62, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0x4f, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x77, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x62, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xdf, 0x48, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x3d, 0xff, 0x8c, 0x33, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x62, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x7f, 0x3c, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xff, 0xff, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x5a, 0xff, 0x6b, 0x50, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x62, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0x5f, 0x27, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xff, 0xdf, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0x57, 0xff, 0x52, 0x8e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x62, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xff, 0x9f, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5d, 0xff, 0x8c, 0x54, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x62, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xc4, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0xee, 0xff, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x7a, 0xff, 0x73, 0x51, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x90, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0xb4, 0x9f, 0x1f, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0x77, 0xff, 0x63, 0x0f, 0xff, 0x94, 0x74, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0x54, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xff, 0xdf, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x52, 0x8e, 0xff, 0x52, 0x6e, 0xff, 0x52, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xab, 0xfe, 0x1b, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xef, 0x3f, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x16, 0xff, 0x5a, 0xae, 0xff, 0xa5, 0x16, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x94, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0xac, 0x1e, 0x1c, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xde, 0x5f, 0x38, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xf7, 0x7f, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xac, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0xb4, 0x3e, 0x1f, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xde, 0x5f, 0x3b, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xef, 0x1f, 0x58, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x8c, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xff, 0xbf, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xbc, 0x9f, 0x20, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xbc, 0x9f, 0x20, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xde, 0x7f, 0x3b, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xde, 0x1f, 0x34, 0xff, 0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xef, 0x1f, 0x5b, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xe6, 0x9f, 0x43, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf7, 0x5f, 0x6b, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xe6, 0x7f, 0x3c, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf7, 0x3f, 0x63, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xd5, 0xff, 0x30, 0xff, 0xdf, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xee, 0xff, 0x4f, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0xac, 0x1e, 0x1c, 0xff, 0xbf, 0x90, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xb8, 0xcd, 0x9f, 0x2b, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x18, 0xe6, 0x9f, 0x40, 0xff, 0xdf, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xf7, 0x5f, 0x67, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x18, 0xee, 0xff, 0x54, 0xff, 0xdf, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xf7, 0x7f, 0x77, 0xb4, 0x5f, 0x1f, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x18, 0xde, 0x5f, 0x38, 0xff, 0x9f, 0x8c, 0xff, 0xff, 0xd3, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xbf, 0xa0, 0xee, 0xdf, 0x4c, 0xa3, 0x9e, 0x18, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x18, 0xcd, 0x9f, 0x28, 0xef, 0x3f, 0x5f, 0xff, 0x9f, 0x87, 0xff, 0xbf, 0xa4, 0xff, 0xdf, 0xb3, 0xff, 0xdf, 0xc0, 0xff, 0xdf, 0xc3, 0xff, 0xdf, 0xb4, 0xff, 0xdf, 0xab, 0xff, 0x9f, 0x88, 0xf7, 0x5f, 0x67, 0xde, 0x3f, 0x37, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x18, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x17, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x14, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x13, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x10, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0f, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0c, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x0b, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x08, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x07, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x04, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x03, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-  0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00, 0x9b, 0x7e, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 32
-  /*Pixel format:  Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha: 8 bit*/
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x18, 0xf6, 0x9e, 0xbe, 0x23, 0xfb, 0xd5, 0xe3, 0x47, 0xfd, 0xe9, 0xf0, 0x68, 0xfd, 0xed, 0xf3, 0x78, 0xfe, 0xf1, 0xf5, 0x84, 0xfe, 0xf1, 0xf5, 0x84, 0xfe, 0xee, 0xf4, 0x7b, 0xfd, 0xea, 0xf1, 0x70, 0xfc, 0xdc, 0xe7, 0x4f, 0xf8, 0xb4, 0xcd, 0x2b, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xf3, 0x72, 0xa0, 0x18, 0xfc, 0xdc, 0xe8, 0x50, 0xfe, 0xf5, 0xf8, 0x98, 0xff, 0xfc, 0xfd, 0xd4, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xe3, 0xfe, 0xf6, 0xf9, 0xa8, 0xfd, 0xe7, 0xef, 0x67, 0xf6, 0x96, 0xb8, 0x20, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x18, 0xf7, 0xa9, 0xc5, 0x27, 0xfe, 0xf1, 0xf6, 0x88, 0xff, 0xfd, 0xfe, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xf3, 0xfe, 0xf6, 0xf9, 0xa0, 0xfa, 0xc7, 0xd9, 0x38, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xf6, 0x94, 0xb7, 0x20, 0xfe, 0xf1, 0xf6, 0x8c, 0xff, 0xfe, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xf8, 0xfa, 0xac, 0xf9, 0xc1, 0xd5, 0x34, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x18, 0xfc, 0xe1, 0xeb, 0x58, 0xff, 0xfd, 0xfe, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf7, 0xfe, 0xef, 0xf4, 0x7f, 0xf3, 0x72, 0xa0, 0x1b, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xf4, 0x80, 0xaa, 0x1c, 0xfe, 0xf5, 0xf8, 0x98, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf9, 0xfb, 0xbc, 0xf8, 0xb1, 0xca, 0x2b, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xf6, 0x9a, 0xbb, 0x23, 0xff, 0xfa, 0xfc, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xe0, 0xfa, 0xc9, 0xdb, 0x38, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xf7, 0xa4, 0xc2, 0x27, 0xff, 0xfb, 0xfc, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xeb, 0xfb, 0xd0, 0xe0, 0x43, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xf6, 0x97, 0xb9, 0x23, 0xff, 0xfb, 0xfc, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xe7, 0xfa, 0xc9, 0xdb, 0x38, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x18, 0xfe, 0xf8, 0xfa, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xdc, 0xf7, 0xa0, 0xbf, 0x24, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xfd, 0xec, 0xf2, 0x74, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf8, 0xfa, 0xaf, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xfa, 0xca, 0xdb, 0x3b, 0xff, 0xfe, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe9, 0xf0, 0x68, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xff, 0xfa, 0xfc, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xe8, 0xf7, 0xa2, 0xc0, 0x27, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xfc, 0xe0, 0xea, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf3, 0xf7, 0x90, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xff, 0xfa, 0xfc, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xf0, 0xf7, 0xa9, 0xc5, 0x27, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xfb, 0xd5, 0xe3, 0x47, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xef, 0xf4, 0x7f, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xfe, 0xf5, 0xf8, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xe6, 0xe6, 0xff, 0xbe, 0xb0, 0xb1, 0xff, 0xea, 0xe6, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xd4, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf3, 0x72, 0xa0, 0x18, 0xff, 0xfe, 0xfe, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x65, 0x67, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x82, 0x66, 0x69, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xb6, 0xb7, 0xff, 0x80, 0x64, 0x67, 0xff, 0xa6, 0x93, 0x95, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xcf, 0xde, 0x40, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xfb, 0xd3, 0xe1, 0x43, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xd5, 0xd6, 0xff, 0x8d, 0x74, 0x76, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf1, 0xf5, 0x83, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xfe, 0xef, 0xf4, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xf0, 0xf0, 0xff, 0xa6, 0x93, 0x95, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x7a, 0x5d, 0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf9, 0xfb, 0xb8, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xfe, 0xf7, 0xfa, 0xa8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xb2, 0xb4, 0xff, 0x75, 0x57, 0x5a, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x7b, 0x5e, 0x61, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xe3, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xff, 0xfa, 0xfc, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xd2, 0xd2, 0xff, 0x8b, 0x71, 0x74, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x7b, 0x5e, 0x61, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf5, 0x92, 0xb6, 0x1f, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xff, 0xfe, 0xfe, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xed, 0xed, 0xff, 0xa3, 0x8f, 0x91, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x7b, 0x5e, 0x61, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xc9, 0xdb, 0x38, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xff, 0xfe, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xb8, 0xb9, 0xff, 0x73, 0x55, 0x58, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x7b, 0x5e, 0x61, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xd6, 0xe3, 0x44, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x7b, 0x5e, 0x61, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xdd, 0xe8, 0x4f, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xac, 0xad, 0xff, 0x6e, 0x4e, 0x51, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x7b, 0x5e, 0x61, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xd8, 0xe5, 0x48, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xff, 0xfe, 0xfe, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xe4, 0xe4, 0xff, 0x9b, 0x85, 0x87, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x7b, 0x5e, 0x61, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xce, 0xde, 0x3c, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xff, 0xfc, 0xfd, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0xc7, 0xc8, 0xff, 0x82, 0x67, 0x69, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x7b, 0x5e, 0x61, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xaa, 0xc6, 0x27, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xfe, 0xf8, 0xfa, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xb7, 0xa7, 0xa9, 0xff, 0x6f, 0x4f, 0x52, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x7b, 0x5e, 0x61, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xeb, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xfe, 0xf1, 0xf6, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xe7, 0xe7, 0xff, 0x9e, 0x88, 0x8a, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x7a, 0x5d, 0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfc, 0xc4, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xfc, 0xdd, 0xe8, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xcb, 0xcc, 0xff, 0x85, 0x6a, 0x6d, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf3, 0xf7, 0x90, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf5, 0x8f, 0xb3, 0x1f, 0xff, 0xfe, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xab, 0xac, 0xff, 0x7c, 0x5f, 0x62, 0xff, 0xa1, 0x8c, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xde, 0xe8, 0x54, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xfe, 0xf8, 0xfa, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0x4f, 0x52, 0xff, 0x6d, 0x4d, 0x50, 0xff, 0x70, 0x51, 0x54, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xe8, 0xf3, 0x7c, 0xa7, 0x1b, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xfd, 0xe3, 0xec, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xa2, 0xa4, 0xff, 0x73, 0x55, 0x58, 0xff, 0xb3, 0xa2, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf4, 0xf8, 0x94, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf4, 0x81, 0xaa, 0x1c, 0xff, 0xfc, 0xfd, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfa, 0xc7, 0xd9, 0x38, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xfd, 0xeb, 0xf2, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf8, 0xfa, 0xac, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf4, 0x85, 0xad, 0x1f, 0xff, 0xfc, 0xfd, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf8, 0xfa, 0xca, 0xdb, 0x3b, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xfc, 0xe1, 0xeb, 0x58, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf2, 0xf6, 0x8c, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xfe, 0xf5, 0xf8, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xd3, 0xf5, 0x91, 0xb5, 0x20, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xf5, 0x91, 0xb5, 0x20, 0xff, 0xfc, 0xfd, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf3, 0xfa, 0xcb, 0xdc, 0x3b, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xfa, 0xc2, 0xd6, 0x34, 0xff, 0xfe, 0xfe, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xfb, 0xfc, 0xe2, 0xeb, 0x5b, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xfb, 0xd0, 0xe0, 0x43, 0xff, 0xfe, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xe9, 0xf0, 0x6b, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xfb, 0xcc, 0xdd, 0x3c, 0xff, 0xfd, 0xfe, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xf8, 0xfd, 0xe6, 0xee, 0x63, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xf9, 0xbc, 0xd2, 0x30, 0xff, 0xfa, 0xfc, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xe7, 0xfc, 0xdb, 0xe7, 0x4f, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xf4, 0x80, 0xaa, 0x1c, 0xfe, 0xf3, 0xf7, 0x90, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf9, 0xfb, 0xb8, 0xf8, 0xb1, 0xca, 0x2b, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x18, 0xfb, 0xd0, 0xdf, 0x40, 0xff, 0xfa, 0xfc, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xe3, 0xfd, 0xe8, 0xef, 0x67, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x18, 0xfc, 0xde, 0xe9, 0x54, 0xff, 0xfa, 0xfc, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xdf, 0xfd, 0xed, 0xf3, 0x77, 0xf5, 0x89, 0xb0, 0x1f, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x18, 0xfa, 0xc7, 0xd9, 0x38, 0xfe, 0xf2, 0xf6, 0x8c, 0xff, 0xfc, 0xfd, 0xd3, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xe3, 0xfe, 0xf6, 0xf9, 0xa0, 0xfc, 0xda, 0xe6, 0x4c, 0xf3, 0x72, 0xa0, 0x18, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x18, 0xf8, 0xb0, 0xca, 0x28, 0xfd, 0xe3, 0xec, 0x5f, 0xfe, 0xf1, 0xf5, 0x87, 0xfe, 0xf6, 0xf9, 0xa4, 0xfe, 0xf9, 0xfb, 0xb3, 0xff, 0xfa, 0xfc, 0xc0, 0xff, 0xfa, 0xfc, 0xc3, 0xfe, 0xf9, 0xfb, 0xb4, 0xfe, 0xf8, 0xfa, 0xab, 0xfe, 0xf1, 0xf6, 0x88, 0xfd, 0xe7, 0xef, 0x67, 0xfa, 0xc6, 0xd9, 0x37, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x18, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x17, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x14, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x13, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x10, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0f, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0c, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x0b, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x08, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x07, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x04, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x03, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-  0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00, 0xf2, 0x6c, 0x9c, 0x00,
-#endif
-};
-
-const lv_img_dsc_t img_lv_demo_music_btn_prev = {
-  .header.always_zero = 0,
-  .header.w = 110,
-  .header.h = 110,
-  .data_size = 12100 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .data = img_lv_demo_music_btn_prev_map,
-};
-
-#endif
@@ -1,159 +0,0 @@
-#include "../lv_demo_music.h"
-#if LV_USE_DEMO_MUSIC && LV_DEMO_MUSIC_LARGE
-
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMG_LV_DEMO_MUSIC_ICN_CHART
-#define LV_ATTRIBUTE_IMG_IMG_LV_DEMO_MUSIC_ICN_CHART
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMG_LV_DEMO_MUSIC_ICN_CHART uint8_t img_lv_demo_music_icon_1_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Blue: 2 bit, Green: 3 bit, Red: 3 bit, Alpha 8 bit */
-  0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x0f, 0x21, 0x67, 0x21, 0xab, 0x21, 0xd8, 0x21, 0xef, 0x21, 0xf3, 0x21, 0xf0, 0x21, 0xf0, 0x21, 0xf0, 0x21, 0xf0, 0x21, 0xf0, 0x21, 0xf0, 0x21, 0xf0, 0x21, 0xf0, 0x21, 0xf0, 0x21, 0xf0, 0x21, 0xf0, 0x21, 0xf0, 0x21, 0xe8, 0x21, 0xc7, 0x21, 0x93, 0x21, 0x44, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x25, 0x00,
-  0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x5f, 0x21, 0xef, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xbc, 0x21, 0x1c, 0x21, 0x00, 0x25, 0x00,
-  0x21, 0x00, 0x21, 0x00, 0x21, 0x7f, 0x21, 0xff, 0x21, 0xff, 0x21, 0xdf, 0x21, 0x83, 0x21, 0x44, 0x21, 0x33, 0x21, 0x30, 0x21, 0x30, 0x21, 0x30, 0x21, 0x30, 0x21, 0x30, 0x21, 0x30, 0x21, 0x30, 0x21, 0x30, 0x21, 0x30, 0x21, 0x30, 0x21, 0x30, 0x21, 0x30, 0x21, 0x30, 0x21, 0x37, 0x21, 0x5b, 0x21, 0xa4, 0x21, 0xff, 0x21, 0xff, 0x21, 0xf0, 0x21, 0x23, 0x21, 0x00,
-  0x21, 0x00, 0x21, 0x48, 0x21, 0xff, 0x21, 0xff, 0x21, 0x8f, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x2b, 0x21, 0xdb, 0x21, 0xff, 0x21, 0xe4, 0x21, 0x04,
-  0x21, 0x04, 0x21, 0xef, 0x21, 0xff, 0x21, 0x98, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x0b, 0x21, 0xec, 0x21, 0xff, 0x21, 0x7f,
-  0x21, 0x58, 0x21, 0xff, 0x21, 0xec, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x5f, 0x21, 0xff, 0x21, 0xf3,
-  0x21, 0xa3, 0x21, 0xff, 0x21, 0x8f, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x25, 0x00, 0x25, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x25, 0x00, 0x25, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xf8, 0x21, 0xff,
-  0x21, 0xd3, 0x21, 0xff, 0x21, 0x47, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x7f, 0x21, 0xdf, 0x21, 0x3b, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xc8, 0x21, 0xff,
-  0x21, 0xf0, 0x21, 0xff, 0x21, 0x2f, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xc8, 0x21, 0xff, 0x21, 0x7c, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xac, 0x21, 0xff,
-  0x21, 0xf4, 0x21, 0xff, 0x21, 0x2f, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xb3, 0x21, 0xff, 0x21, 0x6f, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xac, 0x21, 0xff,
-  0x21, 0xf0, 0x21, 0xff, 0x21, 0x30, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x25, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x25, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xb3, 0x21, 0xff, 0x21, 0x6c, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xaf, 0x21, 0xff,
-  0x21, 0xf0, 0x21, 0xff, 0x21, 0x30, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x25, 0x00, 0x21, 0x00, 0x21, 0x4c, 0x21, 0x24, 0x25, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xb3, 0x21, 0xff, 0x21, 0x6c, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xaf, 0x21, 0xff,
-  0x21, 0xf0, 0x21, 0xff, 0x21, 0x30, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x43, 0x21, 0xff, 0x21, 0xd0, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xb3, 0x21, 0xff, 0x21, 0x6c, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xaf, 0x21, 0xff,
-  0x21, 0xf0, 0x21, 0xff, 0x21, 0x30, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x5b, 0x21, 0xff, 0x21, 0xdb, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xb3, 0x21, 0xff, 0x21, 0x6c, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xaf, 0x21, 0xff,
-  0x21, 0xf0, 0x21, 0xff, 0x21, 0x30, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x53, 0x21, 0xff, 0x21, 0xd0, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xb3, 0x21, 0xff, 0x21, 0x6c, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x25, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xaf, 0x21, 0xff,
-  0x21, 0xf0, 0x21, 0xff, 0x21, 0x30, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x53, 0x21, 0xff, 0x21, 0xd0, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xb3, 0x21, 0xff, 0x21, 0x6c, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x25, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xaf, 0x21, 0xff,
-  0x21, 0xf0, 0x21, 0xff, 0x21, 0x30, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x53, 0x21, 0xff, 0x21, 0xd0, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xb3, 0x21, 0xff, 0x21, 0x6c, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x28, 0x21, 0x17, 0x21, 0x00, 0x25, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xaf, 0x21, 0xff,
-  0x21, 0xf0, 0x21, 0xff, 0x21, 0x30, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x53, 0x21, 0xff, 0x21, 0xd0, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xb3, 0x21, 0xff, 0x21, 0x6c, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x24, 0x21, 0xff, 0x21, 0xdc, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xaf, 0x21, 0xff,
-  0x21, 0xf0, 0x21, 0xff, 0x21, 0x30, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x53, 0x21, 0xff, 0x21, 0xd0, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xb3, 0x21, 0xff, 0x21, 0x6c, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x43, 0x21, 0xff, 0x21, 0xf7, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xaf, 0x21, 0xff,
-  0x21, 0xf0, 0x21, 0xff, 0x21, 0x30, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x53, 0x21, 0xff, 0x21, 0xd0, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xb3, 0x21, 0xff, 0x21, 0x6c, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x38, 0x21, 0xff, 0x21, 0xe7, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xaf, 0x21, 0xff,
-  0x21, 0xf3, 0x21, 0xff, 0x21, 0x30, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x53, 0x21, 0xff, 0x21, 0xd0, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xb3, 0x21, 0xff, 0x21, 0x6c, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x38, 0x21, 0xff, 0x21, 0xe7, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xac, 0x21, 0xff,
-  0x21, 0xf4, 0x21, 0xff, 0x21, 0x2f, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x58, 0x21, 0xff, 0x21, 0xd7, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xb8, 0x21, 0xff, 0x21, 0x74, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x3f, 0x21, 0xff, 0x21, 0xec, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xab, 0x21, 0xff,
-  0x21, 0xe7, 0x21, 0xff, 0x21, 0x34, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x4b, 0x21, 0xff, 0x21, 0xdf, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xbc, 0x21, 0xff, 0x21, 0x68, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x33, 0x21, 0xff, 0x21, 0xff, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xb4, 0x21, 0xff,
-  0x21, 0xbf, 0x21, 0xff, 0x21, 0x63, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x25, 0x00, 0x21, 0x04, 0x21, 0x73, 0x21, 0x3c, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x25, 0x00, 0x21, 0x33, 0x21, 0x73, 0x21, 0x0c, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x6f, 0x21, 0x4f, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xe0, 0x21, 0xff,
-  0x21, 0x84, 0x21, 0xff, 0x21, 0xbf, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x25, 0x00, 0x25, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x25, 0x00, 0x21, 0x00, 0x21, 0x00, 0x25, 0x00, 0x25, 0x00, 0x21, 0x00, 0x21, 0x00, 0x25, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x1c, 0x21, 0xff, 0x21, 0xff,
-  0x21, 0x2b, 0x21, 0xff, 0x21, 0xff, 0x21, 0x30, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0xab, 0x21, 0xff, 0x21, 0xc8,
-  0x21, 0x00, 0x21, 0xab, 0x21, 0xff, 0x21, 0xeb, 0x21, 0x1b, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x68, 0x21, 0xff, 0x21, 0xff, 0x21, 0x3b,
-  0x21, 0x00, 0x21, 0x0b, 0x21, 0xeb, 0x21, 0xff, 0x21, 0xf0, 0x21, 0x63, 0x21, 0x08, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x23, 0x21, 0x98, 0x21, 0xff, 0x21, 0xff, 0x21, 0x8c, 0x21, 0x00,
-  0x21, 0x00, 0x21, 0x00, 0x21, 0x1f, 0x21, 0xd8, 0x21, 0xff, 0x21, 0xff, 0x21, 0xfc, 0x21, 0xd0, 0x21, 0xbf, 0x21, 0xbc, 0x21, 0xbc, 0x21, 0xbc, 0x21, 0xbc, 0x21, 0xbc, 0x21, 0xbc, 0x21, 0xbc, 0x21, 0xbc, 0x21, 0xbc, 0x21, 0xbc, 0x21, 0xbc, 0x21, 0xbc, 0x21, 0xbc, 0x21, 0xc3, 0x21, 0xe0, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0x8f, 0x21, 0x00, 0x21, 0x00,
-  0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x03, 0x21, 0x7c, 0x21, 0xe3, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xff, 0x21, 0xbf, 0x21, 0x4c, 0x21, 0x00, 0x21, 0x00, 0x25, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Blue: 5 bit, Green: 6 bit, Red: 5 bit, Alpha 8 bit*/
-  0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x66, 0x20, 0x0f, 0x66, 0x20, 0x67, 0x66, 0x20, 0xab, 0x66, 0x20, 0xd8, 0x66, 0x20, 0xef, 0x66, 0x20, 0xf3, 0x66, 0x20, 0xf0, 0x66, 0x20, 0xf0, 0x66, 0x20, 0xf0, 0x66, 0x20, 0xf0, 0x66, 0x20, 0xf0, 0x66, 0x20, 0xf0, 0x66, 0x20, 0xf0, 0x66, 0x20, 0xf0, 0x66, 0x20, 0xf0, 0x66, 0x20, 0xf0, 0x66, 0x20, 0xf0, 0x66, 0x20, 0xf0, 0x66, 0x20, 0xe8, 0x66, 0x20, 0xc7, 0x66, 0x20, 0x93, 0x66, 0x20, 0x44, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x86, 0x20, 0x00,
-  0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x66, 0x20, 0x5f, 0x66, 0x20, 0xef, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xbc, 0x66, 0x20, 0x1c, 0x66, 0x20, 0x00, 0x86, 0x20, 0x00,
-  0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x7f, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xdf, 0x66, 0x20, 0x83, 0x66, 0x20, 0x44, 0x66, 0x20, 0x33, 0x66, 0x20, 0x30, 0x66, 0x20, 0x30, 0x66, 0x20, 0x30, 0x66, 0x20, 0x30, 0x66, 0x20, 0x30, 0x66, 0x20, 0x30, 0x66, 0x20, 0x30, 0x66, 0x20, 0x30, 0x66, 0x20, 0x30, 0x66, 0x20, 0x30, 0x66, 0x20, 0x30, 0x66, 0x20, 0x30, 0x66, 0x20, 0x30, 0x66, 0x20, 0x37, 0x66, 0x20, 0x5b, 0x66, 0x20, 0xa4, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xf0, 0x66, 0x20, 0x23, 0x66, 0x20, 0x00,
-  0x86, 0x20, 0x00, 0x86, 0x20, 0x48, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0x8f, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x2b, 0x66, 0x20, 0xdb, 0x86, 0x20, 0xff, 0x66, 0x20, 0xe4, 0x66, 0x20, 0x04,
-  0x86, 0x20, 0x04, 0x66, 0x20, 0xef, 0x66, 0x20, 0xff, 0x66, 0x20, 0x98, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x86, 0x20, 0x0b, 0x66, 0x20, 0xec, 0x66, 0x20, 0xff, 0x86, 0x20, 0x7f,
-  0x66, 0x20, 0x58, 0x66, 0x20, 0xff, 0x66, 0x20, 0xec, 0x46, 0x20, 0x00, 0x46, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x66, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x5f, 0x66, 0x20, 0xff, 0x66, 0x20, 0xf3,
-  0x66, 0x20, 0xa3, 0x66, 0x20, 0xff, 0x66, 0x20, 0x8f, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x66, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xf8, 0x66, 0x20, 0xff,
-  0x66, 0x20, 0xd3, 0x66, 0x20, 0xff, 0x66, 0x20, 0x47, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x86, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x7f, 0x66, 0x20, 0xdf, 0x66, 0x20, 0x3b, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x86, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x66, 0x20, 0xc8, 0x66, 0x20, 0xff,
-  0x66, 0x20, 0xf0, 0x66, 0x20, 0xff, 0x66, 0x20, 0x2f, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x86, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xc8, 0x66, 0x20, 0xff, 0x66, 0x20, 0x7c, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xac, 0x66, 0x20, 0xff,
-  0x66, 0x20, 0xf4, 0x66, 0x20, 0xff, 0x66, 0x20, 0x2f, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x86, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xb3, 0x66, 0x20, 0xff, 0x66, 0x20, 0x6f, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xac, 0x66, 0x20, 0xff,
-  0x66, 0x20, 0xf0, 0x66, 0x20, 0xff, 0x66, 0x20, 0x30, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x86, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xb3, 0x66, 0x20, 0xff, 0x66, 0x20, 0x6c, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xaf, 0x66, 0x20, 0xff,
-  0x66, 0x20, 0xf0, 0x66, 0x20, 0xff, 0x66, 0x20, 0x30, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x66, 0x20, 0x4c, 0x66, 0x20, 0x24, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xb3, 0x66, 0x20, 0xff, 0x66, 0x20, 0x6c, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xaf, 0x66, 0x20, 0xff,
-  0x66, 0x20, 0xf0, 0x66, 0x20, 0xff, 0x66, 0x20, 0x30, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x43, 0x66, 0x20, 0xff, 0x66, 0x20, 0xd0, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xb3, 0x66, 0x20, 0xff, 0x66, 0x20, 0x6c, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xaf, 0x66, 0x20, 0xff,
-  0x66, 0x20, 0xf0, 0x66, 0x20, 0xff, 0x66, 0x20, 0x30, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x5b, 0x66, 0x20, 0xff, 0x66, 0x20, 0xdb, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xb3, 0x66, 0x20, 0xff, 0x66, 0x20, 0x6c, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x86, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xaf, 0x66, 0x20, 0xff,
-  0x66, 0x20, 0xf0, 0x66, 0x20, 0xff, 0x66, 0x20, 0x30, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x53, 0x66, 0x20, 0xff, 0x66, 0x20, 0xd0, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xb3, 0x66, 0x20, 0xff, 0x66, 0x20, 0x6c, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x86, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xaf, 0x66, 0x20, 0xff,
-  0x66, 0x20, 0xf0, 0x66, 0x20, 0xff, 0x66, 0x20, 0x30, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x53, 0x66, 0x20, 0xff, 0x66, 0x20, 0xd0, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xb3, 0x66, 0x20, 0xff, 0x66, 0x20, 0x6c, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xaf, 0x66, 0x20, 0xff,
-  0x66, 0x20, 0xf0, 0x66, 0x20, 0xff, 0x66, 0x20, 0x30, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x53, 0x66, 0x20, 0xff, 0x66, 0x20, 0xd0, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xb3, 0x66, 0x20, 0xff, 0x66, 0x20, 0x6c, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x28, 0x66, 0x20, 0x17, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xaf, 0x66, 0x20, 0xff,
-  0x66, 0x20, 0xf0, 0x66, 0x20, 0xff, 0x66, 0x20, 0x30, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x53, 0x66, 0x20, 0xff, 0x66, 0x20, 0xd0, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xb3, 0x66, 0x20, 0xff, 0x66, 0x20, 0x6c, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x24, 0x66, 0x20, 0xff, 0x66, 0x20, 0xdc, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xaf, 0x66, 0x20, 0xff,
-  0x66, 0x20, 0xf0, 0x66, 0x20, 0xff, 0x66, 0x20, 0x30, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x53, 0x66, 0x20, 0xff, 0x66, 0x20, 0xd0, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xb3, 0x66, 0x20, 0xff, 0x66, 0x20, 0x6c, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x43, 0x66, 0x20, 0xff, 0x66, 0x20, 0xf7, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xaf, 0x66, 0x20, 0xff,
-  0x66, 0x20, 0xf0, 0x66, 0x20, 0xff, 0x66, 0x20, 0x30, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x53, 0x66, 0x20, 0xff, 0x66, 0x20, 0xd0, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xb3, 0x66, 0x20, 0xff, 0x66, 0x20, 0x6c, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x38, 0x66, 0x20, 0xff, 0x66, 0x20, 0xe7, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xaf, 0x66, 0x20, 0xff,
-  0x66, 0x20, 0xf3, 0x66, 0x20, 0xff, 0x66, 0x20, 0x30, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x53, 0x66, 0x20, 0xff, 0x66, 0x20, 0xd0, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xb3, 0x66, 0x20, 0xff, 0x66, 0x20, 0x6c, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x38, 0x66, 0x20, 0xff, 0x66, 0x20, 0xe7, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xac, 0x66, 0x20, 0xff,
-  0x66, 0x20, 0xf4, 0x66, 0x20, 0xff, 0x66, 0x20, 0x2f, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x58, 0x66, 0x20, 0xff, 0x66, 0x20, 0xd7, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xb8, 0x66, 0x20, 0xff, 0x66, 0x20, 0x74, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x3f, 0x66, 0x20, 0xff, 0x66, 0x20, 0xec, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xab, 0x66, 0x20, 0xff,
-  0x66, 0x20, 0xe7, 0x66, 0x20, 0xff, 0x66, 0x20, 0x34, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x4b, 0x66, 0x20, 0xff, 0x66, 0x20, 0xdf, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xbc, 0x66, 0x20, 0xff, 0x66, 0x20, 0x68, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x33, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xb4, 0x66, 0x20, 0xff,
-  0x66, 0x20, 0xbf, 0x66, 0x20, 0xff, 0x66, 0x20, 0x63, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x04, 0x86, 0x20, 0x73, 0x66, 0x20, 0x3c, 0x26, 0x20, 0x00, 0x46, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x33, 0x66, 0x20, 0x73, 0x86, 0x20, 0x0c, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x6f, 0x66, 0x20, 0x4f, 0x46, 0x20, 0x00, 0x46, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0xe0, 0x66, 0x20, 0xff,
-  0x66, 0x20, 0x84, 0x86, 0x20, 0xff, 0x66, 0x20, 0xbf, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x46, 0x20, 0x00, 0x26, 0x20, 0x00, 0x46, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x66, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x66, 0x20, 0x00, 0x26, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x1c, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff,
-  0x86, 0x20, 0x2b, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0x30, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x86, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x86, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x86, 0x20, 0x00, 0x66, 0x20, 0x00, 0x86, 0x20, 0x00, 0x66, 0x20, 0xab, 0x86, 0x20, 0xff, 0x66, 0x20, 0xc8,
-  0x86, 0x20, 0x00, 0x66, 0x20, 0xab, 0x66, 0x20, 0xff, 0x66, 0x20, 0xeb, 0x66, 0x20, 0x1b, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x86, 0x20, 0x68, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x46, 0x20, 0x3b,
-  0x86, 0x20, 0x00, 0x86, 0x20, 0x0b, 0x66, 0x20, 0xeb, 0x66, 0x20, 0xff, 0x66, 0x20, 0xf0, 0x66, 0x20, 0x63, 0x66, 0x20, 0x08, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x00, 0x66, 0x20, 0x23, 0x66, 0x20, 0x98, 0x66, 0x20, 0xff, 0x86, 0x20, 0xff, 0x66, 0x20, 0x8c, 0x46, 0x20, 0x00,
-  0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x1f, 0x66, 0x20, 0xd8, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xfc, 0x66, 0x20, 0xd0, 0x66, 0x20, 0xbf, 0x66, 0x20, 0xbc, 0x66, 0x20, 0xbc, 0x66, 0x20, 0xbc, 0x66, 0x20, 0xbc, 0x66, 0x20, 0xbc, 0x66, 0x20, 0xbc, 0x66, 0x20, 0xbc, 0x66, 0x20, 0xbc, 0x66, 0x20, 0xbc, 0x66, 0x20, 0xbc, 0x66, 0x20, 0xbc, 0x66, 0x20, 0xbc, 0x66, 0x20, 0xbc, 0x66, 0x20, 0xc3, 0x66, 0x20, 0xe0, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0x8f, 0x66, 0x20, 0x00, 0x86, 0x20, 0x00,
-  0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00, 0x66, 0x20, 0x03, 0x66, 0x20, 0x7c, 0x66, 0x20, 0xe3, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xff, 0x66, 0x20, 0xbf, 0x66, 0x20, 0x4c, 0x66, 0x20, 0x00, 0x86, 0x20, 0x00, 0x86, 0x20, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format:  Blue: 5 bit Green: 6 bit, Red: 5 bit, Alpha 8 bit  BUT the 2  color bytes are swapped*/
-  0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x66, 0x0f, 0x20, 0x66, 0x67, 0x20, 0x66, 0xab, 0x20, 0x66, 0xd8, 0x20, 0x66, 0xef, 0x20, 0x66, 0xf3, 0x20, 0x66, 0xf0, 0x20, 0x66, 0xf0, 0x20, 0x66, 0xf0, 0x20, 0x66, 0xf0, 0x20, 0x66, 0xf0, 0x20, 0x66, 0xf0, 0x20, 0x66, 0xf0, 0x20, 0x66, 0xf0, 0x20, 0x66, 0xf0, 0x20, 0x66, 0xf0, 0x20, 0x66, 0xf0, 0x20, 0x66, 0xf0, 0x20, 0x66, 0xe8, 0x20, 0x66, 0xc7, 0x20, 0x66, 0x93, 0x20, 0x66, 0x44, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x86, 0x00,
-  0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x66, 0x5f, 0x20, 0x66, 0xef, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xbc, 0x20, 0x66, 0x1c, 0x20, 0x66, 0x00, 0x20, 0x86, 0x00,
-  0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x7f, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xdf, 0x20, 0x66, 0x83, 0x20, 0x66, 0x44, 0x20, 0x66, 0x33, 0x20, 0x66, 0x30, 0x20, 0x66, 0x30, 0x20, 0x66, 0x30, 0x20, 0x66, 0x30, 0x20, 0x66, 0x30, 0x20, 0x66, 0x30, 0x20, 0x66, 0x30, 0x20, 0x66, 0x30, 0x20, 0x66, 0x30, 0x20, 0x66, 0x30, 0x20, 0x66, 0x30, 0x20, 0x66, 0x30, 0x20, 0x66, 0x30, 0x20, 0x66, 0x37, 0x20, 0x66, 0x5b, 0x20, 0x66, 0xa4, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xf0, 0x20, 0x66, 0x23, 0x20, 0x66, 0x00,
-  0x20, 0x86, 0x00, 0x20, 0x86, 0x48, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0x8f, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x2b, 0x20, 0x66, 0xdb, 0x20, 0x86, 0xff, 0x20, 0x66, 0xe4, 0x20, 0x66, 0x04,
-  0x20, 0x86, 0x04, 0x20, 0x66, 0xef, 0x20, 0x66, 0xff, 0x20, 0x66, 0x98, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x86, 0x0b, 0x20, 0x66, 0xec, 0x20, 0x66, 0xff, 0x20, 0x86, 0x7f,
-  0x20, 0x66, 0x58, 0x20, 0x66, 0xff, 0x20, 0x66, 0xec, 0x20, 0x46, 0x00, 0x20, 0x46, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x66, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x5f, 0x20, 0x66, 0xff, 0x20, 0x66, 0xf3,
-  0x20, 0x66, 0xa3, 0x20, 0x66, 0xff, 0x20, 0x66, 0x8f, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x66, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xf8, 0x20, 0x66, 0xff,
-  0x20, 0x66, 0xd3, 0x20, 0x66, 0xff, 0x20, 0x66, 0x47, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x86, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x7f, 0x20, 0x66, 0xdf, 0x20, 0x66, 0x3b, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x86, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x66, 0xc8, 0x20, 0x66, 0xff,
-  0x20, 0x66, 0xf0, 0x20, 0x66, 0xff, 0x20, 0x66, 0x2f, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x86, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xc8, 0x20, 0x66, 0xff, 0x20, 0x66, 0x7c, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xac, 0x20, 0x66, 0xff,
-  0x20, 0x66, 0xf4, 0x20, 0x66, 0xff, 0x20, 0x66, 0x2f, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x86, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xb3, 0x20, 0x66, 0xff, 0x20, 0x66, 0x6f, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xac, 0x20, 0x66, 0xff,
-  0x20, 0x66, 0xf0, 0x20, 0x66, 0xff, 0x20, 0x66, 0x30, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x86, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xb3, 0x20, 0x66, 0xff, 0x20, 0x66, 0x6c, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xaf, 0x20, 0x66, 0xff,
-  0x20, 0x66, 0xf0, 0x20, 0x66, 0xff, 0x20, 0x66, 0x30, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x66, 0x4c, 0x20, 0x66, 0x24, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xb3, 0x20, 0x66, 0xff, 0x20, 0x66, 0x6c, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xaf, 0x20, 0x66, 0xff,
-  0x20, 0x66, 0xf0, 0x20, 0x66, 0xff, 0x20, 0x66, 0x30, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x43, 0x20, 0x66, 0xff, 0x20, 0x66, 0xd0, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xb3, 0x20, 0x66, 0xff, 0x20, 0x66, 0x6c, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xaf, 0x20, 0x66, 0xff,
-  0x20, 0x66, 0xf0, 0x20, 0x66, 0xff, 0x20, 0x66, 0x30, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x5b, 0x20, 0x66, 0xff, 0x20, 0x66, 0xdb, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xb3, 0x20, 0x66, 0xff, 0x20, 0x66, 0x6c, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x86, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xaf, 0x20, 0x66, 0xff,
-  0x20, 0x66, 0xf0, 0x20, 0x66, 0xff, 0x20, 0x66, 0x30, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x53, 0x20, 0x66, 0xff, 0x20, 0x66, 0xd0, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xb3, 0x20, 0x66, 0xff, 0x20, 0x66, 0x6c, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x86, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xaf, 0x20, 0x66, 0xff,
-  0x20, 0x66, 0xf0, 0x20, 0x66, 0xff, 0x20, 0x66, 0x30, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x53, 0x20, 0x66, 0xff, 0x20, 0x66, 0xd0, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xb3, 0x20, 0x66, 0xff, 0x20, 0x66, 0x6c, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xaf, 0x20, 0x66, 0xff,
-  0x20, 0x66, 0xf0, 0x20, 0x66, 0xff, 0x20, 0x66, 0x30, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x53, 0x20, 0x66, 0xff, 0x20, 0x66, 0xd0, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xb3, 0x20, 0x66, 0xff, 0x20, 0x66, 0x6c, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x28, 0x20, 0x66, 0x17, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xaf, 0x20, 0x66, 0xff,
-  0x20, 0x66, 0xf0, 0x20, 0x66, 0xff, 0x20, 0x66, 0x30, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x53, 0x20, 0x66, 0xff, 0x20, 0x66, 0xd0, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xb3, 0x20, 0x66, 0xff, 0x20, 0x66, 0x6c, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x24, 0x20, 0x66, 0xff, 0x20, 0x66, 0xdc, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xaf, 0x20, 0x66, 0xff,
-  0x20, 0x66, 0xf0, 0x20, 0x66, 0xff, 0x20, 0x66, 0x30, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x53, 0x20, 0x66, 0xff, 0x20, 0x66, 0xd0, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xb3, 0x20, 0x66, 0xff, 0x20, 0x66, 0x6c, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x43, 0x20, 0x66, 0xff, 0x20, 0x66, 0xf7, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xaf, 0x20, 0x66, 0xff,
-  0x20, 0x66, 0xf0, 0x20, 0x66, 0xff, 0x20, 0x66, 0x30, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x53, 0x20, 0x66, 0xff, 0x20, 0x66, 0xd0, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xb3, 0x20, 0x66, 0xff, 0x20, 0x66, 0x6c, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x38, 0x20, 0x66, 0xff, 0x20, 0x66, 0xe7, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xaf, 0x20, 0x66, 0xff,
-  0x20, 0x66, 0xf3, 0x20, 0x66, 0xff, 0x20, 0x66, 0x30, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x53, 0x20, 0x66, 0xff, 0x20, 0x66, 0xd0, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xb3, 0x20, 0x66, 0xff, 0x20, 0x66, 0x6c, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x38, 0x20, 0x66, 0xff, 0x20, 0x66, 0xe7, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xac, 0x20, 0x66, 0xff,
-  0x20, 0x66, 0xf4, 0x20, 0x66, 0xff, 0x20, 0x66, 0x2f, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x58, 0x20, 0x66, 0xff, 0x20, 0x66, 0xd7, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xb8, 0x20, 0x66, 0xff, 0x20, 0x66, 0x74, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x3f, 0x20, 0x66, 0xff, 0x20, 0x66, 0xec, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xab, 0x20, 0x66, 0xff,
-  0x20, 0x66, 0xe7, 0x20, 0x66, 0xff, 0x20, 0x66, 0x34, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x4b, 0x20, 0x66, 0xff, 0x20, 0x66, 0xdf, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xbc, 0x20, 0x66, 0xff, 0x20, 0x66, 0x68, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x33, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xb4, 0x20, 0x66, 0xff,
-  0x20, 0x66, 0xbf, 0x20, 0x66, 0xff, 0x20, 0x66, 0x63, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x04, 0x20, 0x86, 0x73, 0x20, 0x66, 0x3c, 0x20, 0x26, 0x00, 0x20, 0x46, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x33, 0x20, 0x66, 0x73, 0x20, 0x86, 0x0c, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x6f, 0x20, 0x66, 0x4f, 0x20, 0x46, 0x00, 0x20, 0x46, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0xe0, 0x20, 0x66, 0xff,
-  0x20, 0x66, 0x84, 0x20, 0x86, 0xff, 0x20, 0x66, 0xbf, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x46, 0x00, 0x20, 0x26, 0x00, 0x20, 0x46, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x66, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x66, 0x00, 0x20, 0x26, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x1c, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff,
-  0x20, 0x86, 0x2b, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0x30, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x86, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x86, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x86, 0x00, 0x20, 0x66, 0x00, 0x20, 0x86, 0x00, 0x20, 0x66, 0xab, 0x20, 0x86, 0xff, 0x20, 0x66, 0xc8,
-  0x20, 0x86, 0x00, 0x20, 0x66, 0xab, 0x20, 0x66, 0xff, 0x20, 0x66, 0xeb, 0x20, 0x66, 0x1b, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x86, 0x68, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x46, 0x3b,
-  0x20, 0x86, 0x00, 0x20, 0x86, 0x0b, 0x20, 0x66, 0xeb, 0x20, 0x66, 0xff, 0x20, 0x66, 0xf0, 0x20, 0x66, 0x63, 0x20, 0x66, 0x08, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x00, 0x20, 0x66, 0x23, 0x20, 0x66, 0x98, 0x20, 0x66, 0xff, 0x20, 0x86, 0xff, 0x20, 0x66, 0x8c, 0x20, 0x46, 0x00,
-  0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x1f, 0x20, 0x66, 0xd8, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xfc, 0x20, 0x66, 0xd0, 0x20, 0x66, 0xbf, 0x20, 0x66, 0xbc, 0x20, 0x66, 0xbc, 0x20, 0x66, 0xbc, 0x20, 0x66, 0xbc, 0x20, 0x66, 0xbc, 0x20, 0x66, 0xbc, 0x20, 0x66, 0xbc, 0x20, 0x66, 0xbc, 0x20, 0x66, 0xbc, 0x20, 0x66, 0xbc, 0x20, 0x66, 0xbc, 0x20, 0x66, 0xbc, 0x20, 0x66, 0xbc, 0x20, 0x66, 0xc3, 0x20, 0x66, 0xe0, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0x8f, 0x20, 0x66, 0x00, 0x20, 0x86, 0x00,
-  0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00, 0x20, 0x66, 0x03, 0x20, 0x66, 0x7c, 0x20, 0x66, 0xe3, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xff, 0x20, 0x66, 0xbf, 0x20, 0x66, 0x4c, 0x20, 0x66, 0x00, 0x20, 0x86, 0x00, 0x20, 0x86, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 32
-  /*Pixel format:  Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha: 8 bit*/
-  0x30, 0x10, 0x20, 0x00, 0x30, 0x10, 0x20, 0x00, 0x30, 0x10, 0x20, 0x00, 0x31, 0x0f, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x0f, 0x32, 0x0e, 0x20, 0x67, 0x32, 0x0e, 0x20, 0xab, 0x32, 0x0e, 0x20, 0xd8, 0x32, 0x0e, 0x20, 0xef, 0x32, 0x0e, 0x20, 0xf3, 0x32, 0x0e, 0x20, 0xf0, 0x32, 0x0e, 0x20, 0xf0, 0x32, 0x0e, 0x20, 0xf0, 0x32, 0x0e, 0x20, 0xf0, 0x32, 0x0e, 0x20, 0xf0, 0x32, 0x0e, 0x20, 0xf0, 0x32, 0x0e, 0x20, 0xf0, 0x32, 0x0e, 0x20, 0xf0, 0x32, 0x0e, 0x20, 0xf0, 0x32, 0x0e, 0x20, 0xf0, 0x32, 0x0e, 0x20, 0xf0, 0x32, 0x0e, 0x20, 0xf0, 0x32, 0x0e, 0x20, 0xe8, 0x32, 0x0e, 0x20, 0xc7, 0x32, 0x0e, 0x20, 0x93, 0x32, 0x0c, 0x20, 0x44, 0x32, 0x0c, 0x20, 0x00, 0x31, 0x0c, 0x20, 0x00, 0x30, 0x0e, 0x20, 0x00, 0x30, 0x11, 0x20, 0x00,
-  0x30, 0x10, 0x20, 0x00, 0x30, 0x10, 0x20, 0x00, 0x30, 0x10, 0x20, 0x00, 0x32, 0x0e, 0x20, 0x5f, 0x32, 0x0e, 0x20, 0xef, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xbc, 0x31, 0x0b, 0x20, 0x1c, 0x30, 0x0e, 0x20, 0x00, 0x30, 0x12, 0x20, 0x00,
-  0x30, 0x10, 0x20, 0x00, 0x30, 0x10, 0x20, 0x00, 0x31, 0x0f, 0x20, 0x7f, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xdf, 0x31, 0x0e, 0x20, 0x83, 0x31, 0x0d, 0x20, 0x44, 0x31, 0x0d, 0x20, 0x33, 0x32, 0x0d, 0x20, 0x30, 0x32, 0x0d, 0x20, 0x30, 0x32, 0x0d, 0x20, 0x30, 0x32, 0x0d, 0x20, 0x30, 0x32, 0x0d, 0x20, 0x30, 0x32, 0x0d, 0x20, 0x30, 0x32, 0x0d, 0x20, 0x30, 0x32, 0x0d, 0x20, 0x30, 0x32, 0x0d, 0x20, 0x30, 0x32, 0x0d, 0x20, 0x30, 0x32, 0x0d, 0x20, 0x30, 0x32, 0x0d, 0x20, 0x30, 0x32, 0x0d, 0x20, 0x30, 0x31, 0x0d, 0x20, 0x37, 0x31, 0x0e, 0x20, 0x5b, 0x32, 0x0e, 0x20, 0xa4, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xf0, 0x30, 0x0d, 0x20, 0x23, 0x30, 0x0d, 0x20, 0x00,
-  0x30, 0x0f, 0x20, 0x00, 0x31, 0x0f, 0x20, 0x48, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0x8f, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0c, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x2b, 0x32, 0x0e, 0x20, 0xdb, 0x32, 0x0f, 0x20, 0xff, 0x32, 0x0d, 0x20, 0xe4, 0x30, 0x0b, 0x20, 0x04,
-  0x31, 0x0f, 0x20, 0x04, 0x32, 0x0e, 0x20, 0xef, 0x32, 0x0e, 0x20, 0xff, 0x31, 0x0c, 0x20, 0x98, 0x31, 0x0c, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x30, 0x10, 0x20, 0x0b, 0x32, 0x0e, 0x20, 0xec, 0x33, 0x0e, 0x20, 0xff, 0x31, 0x0f, 0x20, 0x7f,
-  0x31, 0x0d, 0x20, 0x58, 0x33, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xec, 0x30, 0x0a, 0x20, 0x00, 0x30, 0x09, 0x20, 0x00, 0x31, 0x0b, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x10, 0x20, 0x00, 0x30, 0x10, 0x20, 0x00, 0x31, 0x0c, 0x20, 0x00, 0x30, 0x0f, 0x20, 0x00, 0x31, 0x0f, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x30, 0x0d, 0x20, 0x00, 0x30, 0x0e, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x5f, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xf3,
-  0x32, 0x0e, 0x20, 0xa3, 0x33, 0x0e, 0x20, 0xff, 0x31, 0x0d, 0x20, 0x8f, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0c, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x10, 0x20, 0x00, 0x30, 0x11, 0x20, 0x00, 0x30, 0x11, 0x20, 0x00, 0x30, 0x10, 0x20, 0x00, 0x31, 0x0c, 0x20, 0x00, 0x30, 0x10, 0x20, 0x00, 0x2f, 0x12, 0x20, 0x00, 0x30, 0x11, 0x20, 0x00, 0x31, 0x10, 0x20, 0x00, 0x32, 0x0e, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x32, 0x0e, 0x20, 0xf8, 0x32, 0x0e, 0x20, 0xff,
-  0x32, 0x0e, 0x20, 0xd3, 0x32, 0x0e, 0x20, 0xff, 0x31, 0x0e, 0x20, 0x47, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0f, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x30, 0x0d, 0x20, 0x00, 0x30, 0x0f, 0x20, 0x00, 0x30, 0x10, 0x20, 0x00, 0x30, 0x0f, 0x20, 0x00, 0x30, 0x0f, 0x20, 0x00, 0x31, 0x0f, 0x20, 0x7f, 0x32, 0x0d, 0x20, 0xdf, 0x31, 0x0e, 0x20, 0x3b, 0x31, 0x0e, 0x20, 0x00, 0x30, 0x0e, 0x20, 0x00, 0x30, 0x0f, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x31, 0x0f, 0x20, 0x00, 0x31, 0x0f, 0x20, 0x00, 0x31, 0x0f, 0x20, 0x00, 0x31, 0x0f, 0x20, 0x00, 0x31, 0x0f, 0x20, 0x00, 0x32, 0x0e, 0x20, 0xc8, 0x32, 0x0e, 0x20, 0xff,
-  0x32, 0x0e, 0x20, 0xf0, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0d, 0x20, 0x2f, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x30, 0x10, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x30, 0x0e, 0x20, 0x00, 0x30, 0x0d, 0x20, 0x00, 0x30, 0x0b, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x31, 0x0d, 0x20, 0xc8, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0d, 0x20, 0x7c, 0x31, 0x0c, 0x20, 0x00, 0x31, 0x0c, 0x20, 0x00, 0x31, 0x0c, 0x20, 0x00, 0x31, 0x0c, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x32, 0x0e, 0x20, 0xac, 0x32, 0x0e, 0x20, 0xff,
-  0x32, 0x0e, 0x20, 0xf4, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0d, 0x20, 0x2f, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x31, 0x0f, 0x20, 0x00, 0x30, 0x10, 0x20, 0x00, 0x31, 0x0c, 0x20, 0x00, 0x30, 0x0e, 0x20, 0x00, 0x30, 0x0f, 0x20, 0x00, 0x30, 0x0b, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x31, 0x0d, 0x20, 0xb3, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0x6f, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x32, 0x0e, 0x20, 0xac, 0x32, 0x0e, 0x20, 0xff,
-  0x32, 0x0e, 0x20, 0xf0, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0d, 0x20, 0x30, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0e, 0x20, 0x00, 0x30, 0x11, 0x20, 0x00, 0x30, 0x10, 0x20, 0x00, 0x31, 0x0c, 0x20, 0x00, 0x30, 0x0d, 0x20, 0x00, 0x30, 0x11, 0x20, 0x00, 0x30, 0x0d, 0x20, 0x00, 0x30, 0x0b, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x31, 0x0d, 0x20, 0xb3, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0x6c, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x32, 0x0e, 0x20, 0xaf, 0x32, 0x0e, 0x20, 0xff,
-  0x32, 0x0e, 0x20, 0xf0, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0d, 0x20, 0x30, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x30, 0x0f, 0x20, 0x00, 0x2f, 0x11, 0x20, 0x00, 0x30, 0x10, 0x20, 0x00, 0x31, 0x0c, 0x20, 0x4c, 0x30, 0x0d, 0x20, 0x24, 0x30, 0x12, 0x20, 0x00, 0x30, 0x0f, 0x20, 0x00, 0x30, 0x0b, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x31, 0x0d, 0x20, 0xb3, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0x6c, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x32, 0x0e, 0x20, 0xaf, 0x32, 0x0e, 0x20, 0xff,
-  0x32, 0x0e, 0x20, 0xf0, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0d, 0x20, 0x30, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x30, 0x0e, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x43, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xd0, 0x30, 0x0e, 0x20, 0x00, 0x30, 0x0d, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x31, 0x0d, 0x20, 0xb3, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0x6c, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x32, 0x0e, 0x20, 0xaf, 0x32, 0x0e, 0x20, 0xff,
-  0x32, 0x0e, 0x20, 0xf0, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0d, 0x20, 0x30, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x5b, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xdb, 0x30, 0x0b, 0x20, 0x00, 0x30, 0x0b, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x31, 0x0d, 0x20, 0xb3, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0x6c, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0c, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x30, 0x0f, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x32, 0x0e, 0x20, 0xaf, 0x32, 0x0e, 0x20, 0xff,
-  0x32, 0x0e, 0x20, 0xf0, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0d, 0x20, 0x30, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x53, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xd0, 0x30, 0x0c, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x31, 0x0d, 0x20, 0xb3, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0x6c, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x31, 0x0c, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x30, 0x11, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x32, 0x0e, 0x20, 0xaf, 0x32, 0x0e, 0x20, 0xff,
-  0x32, 0x0e, 0x20, 0xf0, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0d, 0x20, 0x30, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x53, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xd0, 0x30, 0x0c, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x31, 0x0d, 0x20, 0xb3, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0x6c, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x30, 0x11, 0x20, 0x00, 0x30, 0x0f, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x32, 0x0e, 0x20, 0xaf, 0x32, 0x0e, 0x20, 0xff,
-  0x32, 0x0e, 0x20, 0xf0, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0d, 0x20, 0x30, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x53, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xd0, 0x30, 0x0c, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x31, 0x0d, 0x20, 0xb3, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0x6c, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x28, 0x31, 0x0e, 0x20, 0x17, 0x30, 0x10, 0x20, 0x00, 0x30, 0x11, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x32, 0x0e, 0x20, 0xaf, 0x32, 0x0e, 0x20, 0xff,
-  0x32, 0x0e, 0x20, 0xf0, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0d, 0x20, 0x30, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x53, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xd0, 0x30, 0x0c, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x31, 0x0d, 0x20, 0xb3, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0x6c, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x24, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xdc, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x32, 0x0e, 0x20, 0xaf, 0x32, 0x0e, 0x20, 0xff,
-  0x32, 0x0e, 0x20, 0xf0, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0d, 0x20, 0x30, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x53, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xd0, 0x30, 0x0c, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x31, 0x0d, 0x20, 0xb3, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0x6c, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x43, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xf7, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x32, 0x0e, 0x20, 0xaf, 0x32, 0x0e, 0x20, 0xff,
-  0x32, 0x0e, 0x20, 0xf0, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0d, 0x20, 0x30, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x53, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xd0, 0x30, 0x0c, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x31, 0x0d, 0x20, 0xb3, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0x6c, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x38, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xe7, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x32, 0x0e, 0x20, 0xaf, 0x32, 0x0e, 0x20, 0xff,
-  0x32, 0x0e, 0x20, 0xf3, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0d, 0x20, 0x30, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x53, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xd0, 0x30, 0x0c, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x31, 0x0d, 0x20, 0xb3, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0x6c, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x38, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xe7, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x32, 0x0e, 0x20, 0xac, 0x32, 0x0e, 0x20, 0xff,
-  0x32, 0x0e, 0x20, 0xf4, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0d, 0x20, 0x2f, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x58, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xd7, 0x30, 0x0c, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x30, 0x0b, 0x20, 0x00, 0x31, 0x0d, 0x20, 0xb8, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0x74, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x30, 0x0c, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x3f, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xec, 0x32, 0x0e, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x32, 0x0e, 0x20, 0xab, 0x32, 0x0e, 0x20, 0xff,
-  0x32, 0x0e, 0x20, 0xe7, 0x32, 0x0e, 0x20, 0xff, 0x31, 0x0c, 0x20, 0x34, 0x31, 0x0c, 0x20, 0x00, 0x31, 0x0c, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x4b, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xdf, 0x30, 0x0d, 0x20, 0x00, 0x30, 0x0d, 0x20, 0x00, 0x30, 0x0d, 0x20, 0x00, 0x30, 0x0d, 0x20, 0x00, 0x31, 0x0e, 0x20, 0xbc, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0d, 0x20, 0x68, 0x31, 0x0c, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x30, 0x0d, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x33, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0c, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x32, 0x0e, 0x20, 0xb4, 0x32, 0x0e, 0x20, 0xff,
-  0x32, 0x0e, 0x20, 0xbf, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0d, 0x20, 0x63, 0x31, 0x0c, 0x20, 0x00, 0x31, 0x0c, 0x20, 0x00, 0x30, 0x0e, 0x20, 0x00, 0x30, 0x11, 0x20, 0x00, 0x30, 0x0f, 0x20, 0x04, 0x32, 0x0f, 0x20, 0x73, 0x31, 0x0b, 0x20, 0x3c, 0x30, 0x06, 0x20, 0x00, 0x30, 0x08, 0x20, 0x00, 0x30, 0x0f, 0x20, 0x00, 0x30, 0x11, 0x20, 0x00, 0x31, 0x0f, 0x20, 0x33, 0x32, 0x0d, 0x20, 0x73, 0x30, 0x0f, 0x20, 0x0c, 0x30, 0x0f, 0x20, 0x00, 0x30, 0x10, 0x20, 0x00, 0x30, 0x10, 0x20, 0x00, 0x30, 0x10, 0x20, 0x00, 0x32, 0x0f, 0x20, 0x6f, 0x32, 0x0c, 0x20, 0x4f, 0x30, 0x07, 0x20, 0x00, 0x2f, 0x07, 0x20, 0x00, 0x31, 0x0c, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x32, 0x0e, 0x20, 0xe0, 0x32, 0x0e, 0x20, 0xff,
-  0x32, 0x0d, 0x20, 0x84, 0x33, 0x0f, 0x20, 0xff, 0x32, 0x0d, 0x20, 0xbf, 0x30, 0x0c, 0x20, 0x00, 0x30, 0x0b, 0x20, 0x00, 0x31, 0x0c, 0x20, 0x00, 0x30, 0x11, 0x20, 0x00, 0x30, 0x11, 0x20, 0x00, 0x31, 0x0f, 0x20, 0x00, 0x31, 0x0a, 0x20, 0x00, 0x30, 0x05, 0x20, 0x00, 0x30, 0x09, 0x20, 0x00, 0x30, 0x0f, 0x20, 0x00, 0x30, 0x12, 0x20, 0x00, 0x30, 0x0f, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x30, 0x11, 0x20, 0x00, 0x30, 0x11, 0x20, 0x00, 0x30, 0x0f, 0x20, 0x00, 0x30, 0x10, 0x20, 0x00, 0x30, 0x11, 0x20, 0x00, 0x31, 0x0f, 0x20, 0x00, 0x31, 0x0b, 0x20, 0x00, 0x30, 0x06, 0x20, 0x00, 0x31, 0x0b, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x1c, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff,
-  0x31, 0x0f, 0x20, 0x2b, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x30, 0x0d, 0x20, 0x30, 0x30, 0x0c, 0x20, 0x00, 0x31, 0x0c, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0f, 0x20, 0x00, 0x31, 0x0b, 0x20, 0x00, 0x31, 0x0b, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0f, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0c, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0c, 0x20, 0x00, 0x31, 0x0c, 0x20, 0x00, 0x31, 0x0f, 0x20, 0x00, 0x30, 0x0e, 0x20, 0x00, 0x30, 0x0f, 0x20, 0x00, 0x31, 0x0e, 0x20, 0xab, 0x33, 0x0f, 0x20, 0xff, 0x31, 0x0e, 0x20, 0xc8,
-  0x30, 0x0f, 0x20, 0x00, 0x31, 0x0e, 0x20, 0xab, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xeb, 0x31, 0x0d, 0x20, 0x1b, 0x31, 0x0c, 0x20, 0x00, 0x32, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0c, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x00, 0x31, 0x0f, 0x20, 0x68, 0x32, 0x0e, 0x20, 0xff, 0x33, 0x0e, 0x20, 0xff, 0x30, 0x09, 0x20, 0x3b,
-  0x30, 0x10, 0x20, 0x00, 0x30, 0x10, 0x20, 0x0b, 0x32, 0x0e, 0x20, 0xeb, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xf0, 0x32, 0x0d, 0x20, 0x63, 0x32, 0x0d, 0x20, 0x08, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0d, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x23, 0x32, 0x0e, 0x20, 0x98, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0f, 0x20, 0xff, 0x31, 0x0c, 0x20, 0x8c, 0x30, 0x08, 0x20, 0x00,
-  0x30, 0x10, 0x20, 0x00, 0x30, 0x10, 0x20, 0x00, 0x30, 0x0f, 0x20, 0x1f, 0x32, 0x0e, 0x20, 0xd8, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xfc, 0x32, 0x0e, 0x20, 0xd0, 0x32, 0x0e, 0x20, 0xbf, 0x32, 0x0e, 0x20, 0xbc, 0x32, 0x0e, 0x20, 0xbc, 0x32, 0x0e, 0x20, 0xbc, 0x32, 0x0e, 0x20, 0xbc, 0x32, 0x0e, 0x20, 0xbc, 0x32, 0x0e, 0x20, 0xbc, 0x32, 0x0e, 0x20, 0xbc, 0x32, 0x0e, 0x20, 0xbc, 0x32, 0x0e, 0x20, 0xbc, 0x32, 0x0e, 0x20, 0xbc, 0x32, 0x0e, 0x20, 0xbc, 0x32, 0x0e, 0x20, 0xbc, 0x32, 0x0e, 0x20, 0xbc, 0x32, 0x0e, 0x20, 0xc3, 0x32, 0x0e, 0x20, 0xe0, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x31, 0x0e, 0x20, 0x8f, 0x30, 0x0e, 0x20, 0x00, 0x30, 0x10, 0x20, 0x00,
-  0x30, 0x10, 0x20, 0x00, 0x30, 0x10, 0x20, 0x00, 0x30, 0x10, 0x20, 0x00, 0x31, 0x0e, 0x20, 0x03, 0x32, 0x0e, 0x20, 0x7c, 0x32, 0x0e, 0x20, 0xe3, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xff, 0x32, 0x0e, 0x20, 0xbf, 0x31, 0x0d, 0x20, 0x4c, 0x31, 0x0c, 0x20, 0x00, 0x30, 0x10, 0x20, 0x00, 0x30, 0x11, 0x20, 0x00,
-#endif
-};
-
-const lv_img_dsc_t img_lv_demo_music_icon_1 = {
-  .header.always_zero = 0,
-  .header.w = 30,
-  .header.h = 30,
-  .data_size = 900 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .data = img_lv_demo_music_icon_1_map,
-};
-
-#endif
-
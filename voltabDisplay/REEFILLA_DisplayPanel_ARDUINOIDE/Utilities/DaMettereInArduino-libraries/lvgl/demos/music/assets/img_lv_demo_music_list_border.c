@@ -1,49 +0,0 @@
-#include "../lv_demo_music.h"
-#if LV_USE_DEMO_MUSIC  && !LV_DEMO_MUSIC_LARGE
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t img_lv_demo_music_list_border_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08,
-  0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27, 0x00, 0x27,
-  0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24,
-  0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08,
-  0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27,
-  0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24, 0x59, 0xce, 0x24,
-  0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08,
-  0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27, 0x00, 0x00, 0x27,
-  0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24, 0xce, 0x59, 0x24,
-  0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18,
-#endif
-#if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08,
-  0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x27,
-  0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24, 0xc8, 0xc8, 0xc8, 0x24,
-  0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18,
-#endif
-};
-
-lv_img_dsc_t img_lv_demo_music_list_border = {
-  .header.always_zero = 0,
-  .header.w = 272,
-  .header.h = 4,
-  .data_size = 1088 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .data = img_lv_demo_music_list_border_map,
-};
-
-#endif /*LV_USE_DEMO_MUSIC*/
-
-
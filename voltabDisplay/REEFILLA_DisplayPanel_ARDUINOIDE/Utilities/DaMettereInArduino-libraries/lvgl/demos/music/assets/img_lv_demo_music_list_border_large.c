@@ -1,66 +0,0 @@
-#include "../lv_demo_music.h"
-#if LV_USE_DEMO_MUSIC && LV_DEMO_MUSIC_LARGE
-
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMG_LV_DEMO_MUSIC_LIST_BORDER
-#define LV_ATTRIBUTE_IMG_IMG_LV_DEMO_MUSIC_LIST_BORDER
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMG_LV_DEMO_MUSIC_LIST_BORDER uint8_t img_lv_demo_music_list_border_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Blue: 2 bit, Green: 3 bit, Red: 3 bit, Alpha 8 bit */
-  0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08,
-  0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13, 0x00, 0x13,
-  0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24,
-  0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27, 0x6e, 0x27,
-  0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24, 0xdb, 0x24,
-  0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c, 0xff, 0x1c,
-  0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18, 0xff, 0x18,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Blue: 5 bit, Green: 6 bit, Red: 5 bit, Alpha 8 bit*/
-  0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08,
-  0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13,
-  0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24,
-  0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27, 0x2c, 0x63, 0x27,
-  0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24, 0x79, 0xce, 0x24,
-  0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c, 0x7d, 0xef, 0x1c,
-  0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format:  Blue: 5 bit Green: 6 bit, Red: 5 bit, Alpha 8 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x08,
-  0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13,
-  0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24, 0x00, 0x00, 0x24,
-  0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27, 0x63, 0x2c, 0x27,
-  0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24, 0xce, 0x79, 0x24,
-  0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c, 0xef, 0x7d, 0x1c,
-  0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18, 0xff, 0xff, 0x18,
-#endif
-#if LV_COLOR_DEPTH == 32
-  /*Pixel format:  Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha: 8 bit*/
-  0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08,
-  0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x13,
-  0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24,
-  0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27, 0x64, 0x64, 0x64, 0x27,
-  0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24, 0xcc, 0xcc, 0xcc, 0x24,
-  0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c, 0xeb, 0xeb, 0xeb, 0x1c,
-  0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x18,
-#endif
-};
-
-const lv_img_dsc_t img_lv_demo_music_list_border = {
-  .header.always_zero = 0,
-  .header.w = 479,
-  .header.h = 7,
-  .data_size = 3353 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .data = img_lv_demo_music_list_border_map,
-};
-
-#endif
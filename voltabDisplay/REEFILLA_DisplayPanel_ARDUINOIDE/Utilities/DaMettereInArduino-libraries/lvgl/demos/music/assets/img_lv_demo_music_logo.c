@@ -1,422 +0,0 @@
-#include "../lv_demo_music.h"
-#if LV_USE_DEMO_MUSIC
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN uint8_t img_lv_demo_music_logo_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x6e, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x6e, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x49, 0xb6, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x6e, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x92, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x6e, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x92, 0xff, 0xff,
-  0xff, 0xff, 0xb6, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0xb7, 0xff,
-  0xff, 0xff, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6d, 0xff,
-  0xff, 0xb7, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x29, 0xdb,
-  0xff, 0x92, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x92,
-  0xff, 0x92, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x92,
-  0xff, 0x6e, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6d, 0x92, 0x92, 0x92, 0x6d, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0x6e, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0x6e, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0x6e, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0x6e, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0x6e, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0x6e, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0x6e, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0x6e, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0x6e, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0xb6, 0xff, 0xff, 0xff, 0xb6, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0x6e, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0x6e, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0x6e, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0x6e, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0x6e, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0x6e, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0x92, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xdb, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xff, 0x92, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xff, 0xff, 0xff, 0x92, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xff, 0xfb, 0xee, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xe9, 0xed, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xfb, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xee, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xf6, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xff, 0xf6, 0xe5, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe4, 0xe5, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x92, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xff, 0xff, 0xfb, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xe4, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe4, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xf2, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6e,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x92,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x92,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0xb7,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x49, 0xff,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x92, 0xff,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x49, 0xff, 0xff,
-  0xff, 0xed, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x49, 0xff, 0xff, 0xff,
-  0xff, 0xee, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x6d, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfb, 0xe9, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe5, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xe4, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe4, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x49, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x49, 0x6d, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf6, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf2, 0xf6, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb6, 0xb7, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xfc, 0xe6, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0x1c, 0xe7, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd6, 0x72, 0x94, 0x4d, 0x6b, 0x6a, 0x4a, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x28, 0x42, 0x8a, 0x52, 0x6e, 0x6b, 0x92, 0x94, 0xdb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x71, 0x8c, 0xc7, 0x39, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xe8, 0x41, 0xd3, 0x9c, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xef, 0x2c, 0x63, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x8e, 0x73, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x6d, 0x6b, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xcf, 0x7b, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf4, 0xa4, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x25, 0x21, 0x55, 0xad, 0xff, 0xff,
-  0xff, 0xff, 0x3c, 0xe7, 0x49, 0x4a, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xab, 0x52, 0x5d, 0xef,
-  0xff, 0xff, 0x76, 0xad, 0x66, 0x29, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x86, 0x31, 0xd7, 0xbd,
-  0xff, 0xff, 0x10, 0x84, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x25, 0x21, 0x92, 0x94,
-  0xdf, 0xff, 0x8e, 0x73, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xaf, 0x7b,
-  0x9e, 0xf7, 0x4d, 0x6b, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x25, 0x29, 0xab, 0x52, 0xf0, 0x7b, 0x71, 0x8c, 0xef, 0x7b, 0xab, 0x52, 0x25, 0x29, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x73,
-  0x9e, 0xf7, 0x4d, 0x6b, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x45, 0x29, 0xb2, 0x94, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xef, 0x92, 0x94, 0x66, 0x29, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xf7, 0x4d, 0x6b, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x92, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x31, 0x8c, 0x25, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xf7, 0x4d, 0x6b, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x29, 0x42, 0xfc, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xd6, 0xe7, 0x39, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xf7, 0x4d, 0x6b, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x4d, 0x6b, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xef, 0xcb, 0x5a, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xf7, 0x4d, 0x6b, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x73, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xef, 0xec, 0x62, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xf7, 0x4d, 0x6b, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x8a, 0x52, 0x3d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x29, 0x42, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xf7, 0x4d, 0x6b, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x76, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x9c, 0x45, 0x29, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xf7, 0x4d, 0x6b, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x45, 0x29, 0x7a, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38, 0xc6, 0xe8, 0x39, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xf7, 0x4d, 0x6b, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x92, 0x94, 0xba, 0xd6, 0xdb, 0xde, 0xba, 0xd6, 0xb3, 0x9c, 0x45, 0x29, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xf7, 0x4d, 0x6b, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x86, 0x31, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xf7, 0x4d, 0x6b, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xf7, 0x4d, 0x6b, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xf7, 0x4d, 0x6b, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xf7, 0x4d, 0x6b, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0xbf, 0xff, 0x6e, 0x73, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0xff, 0xff, 0x10, 0x84, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0xff, 0xff, 0xd7, 0xbd, 0x66, 0x29, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0xff, 0xff, 0xdf, 0xff, 0x51, 0x8c, 0x45, 0x29, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xd6, 0x72, 0x8c, 0x6e, 0x73, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x0c, 0x63, 0x8a, 0x52, 0x66, 0x29, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0xb7, 0xbd, 0x29, 0x42, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xd6, 0x25, 0x29, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 0x5a, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x9c, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0xff, 0xff, 0xff, 0xff, 0x7a, 0xfe, 0x0c, 0xeb, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0xec, 0xea, 0x7a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76, 0xad, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0xff, 0xff, 0xd7, 0xf5, 0x82, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x20, 0xd8, 0x76, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0xdf, 0xff, 0x2c, 0xeb, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xe7, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76, 0xb5, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xb5, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xce, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0xbe, 0xff, 0xeb, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa7, 0xe1, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xf7, 0x45, 0x29, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0xff, 0xff, 0xb2, 0xf4, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xef, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xa4, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0xff, 0xff, 0xbe, 0xff, 0xb3, 0xf4, 0x86, 0xe1, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0x65, 0xe1, 0x72, 0xf4, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xf8, 0xc5, 0xcf, 0x7b, 0x29, 0x4a, 0xa7, 0x39, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x39, 0x86, 0x31, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0x7e, 0xf7, 0x14, 0xa5, 0xa7, 0x31, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe6, 0x28, 0x42, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x14, 0xa5, 0x25, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xce, 0x66, 0x31, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xd7, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0xd7, 0xf5, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xfe, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0xbb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x08, 0x42, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0xff, 0xff, 0x1c, 0xff, 0xaa, 0xe2, 0x61, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x49, 0xe2, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xf4, 0xc3, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0xe4, 0xd8, 0x76, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xde, 0x29, 0x42, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0xff, 0xff, 0xef, 0xeb, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xcb, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0x20, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa3, 0xd8, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x29, 0x42, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0xbe, 0xff, 0xcb, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xdb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x29, 0x42, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xf5, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x29, 0x42, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xf5, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x29, 0x42, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xf5, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x29, 0x42, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xf5, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x29, 0x42, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xf5, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x29, 0x42, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xf5, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x29, 0x42, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xf5, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x29, 0x42, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xf5, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x29, 0x42, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xf5, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x29, 0x42, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xf5, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x29, 0x42, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xf5, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x29, 0x42, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xf5, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x29, 0x42, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xf5, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x29, 0x42, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xf5, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x29, 0x42, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xf5, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x29, 0x42, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xf5, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x29, 0x42, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x6e, 0x6b,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xf5, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x29, 0x42, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x8e, 0x73,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xf5, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x29, 0x42, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x31, 0x8c,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xf5, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x29, 0x42, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x66, 0x29, 0x55, 0xad,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xf5, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x29, 0x42, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x29, 0x42, 0xdb, 0xde,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xf5, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x29, 0x42, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x51, 0x8c, 0xff, 0xff,
-  0x9e, 0xff, 0xab, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xf5, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x9a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xe7, 0x49, 0x4a, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x8a, 0x52, 0x5d, 0xef, 0xff, 0xff,
-  0x9e, 0xff, 0xcb, 0xea, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa6, 0xe1, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x35, 0xf5, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xbb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x0c, 0x63, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x28, 0x42, 0xba, 0xd6, 0xff, 0xff, 0xff, 0xff,
-  0xdf, 0xff, 0x4d, 0xeb, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x69, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xfe, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x14, 0xa5, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0xcb, 0x5a, 0xdb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x7a, 0xfe, 0xe7, 0xe1, 0x82, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x62, 0xd8, 0x65, 0xe1, 0x38, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0xeb, 0x82, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0xa2, 0xd8, 0x72, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x92, 0x94, 0xe8, 0x39, 0x86, 0x31, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x66, 0x31, 0xc7, 0x39, 0xab, 0x5a, 0xf4, 0xa4, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xdb, 0xfe, 0xf4, 0xf4, 0x72, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0xf3, 0xf4, 0xdb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xb6, 0xf5, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0xf7, 0xf5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdb, 0xde, 0xb7, 0xbd, 0x14, 0xa5, 0xf4, 0x9c, 0xf4, 0x9c, 0xf4, 0x9c, 0xf4, 0x9c, 0xf4, 0x9c, 0xf4, 0x9c, 0xf4, 0x9c, 0xf4, 0x9c, 0xf4, 0x9c, 0xf4, 0x9c, 0xf4, 0x9c, 0xf4, 0x9c, 0xf4, 0x9c, 0xf4, 0x9c, 0x14, 0xa5, 0x76, 0xad, 0x7a, 0xce, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Red: 5 bit, Green: 6 bit, Blue: 5 bit BUT the 2 bytes are swapped*/
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xe6, 0xfc, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xde, 0xbb, 0xe7, 0x1c, 0xf7, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x9a, 0x94, 0x72, 0x6b, 0x4d, 0x4a, 0x6a, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x08, 0x42, 0x28, 0x52, 0x8a, 0x6b, 0x6e, 0x94, 0x92, 0xde, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0x8c, 0x71, 0x39, 0xc7, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x41, 0xe8, 0x9c, 0xd3, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7d, 0x63, 0x2c, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x73, 0x8e, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf7, 0xbe, 0x6b, 0x6d, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x7b, 0xcf, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xa4, 0xf4, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x25, 0xad, 0x55, 0xff, 0xff,
-  0xff, 0xff, 0xe7, 0x3c, 0x4a, 0x49, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x52, 0xab, 0xef, 0x5d,
-  0xff, 0xff, 0xad, 0x76, 0x29, 0x66, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x31, 0x86, 0xbd, 0xd7,
-  0xff, 0xff, 0x84, 0x10, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x25, 0x94, 0x92,
-  0xff, 0xdf, 0x73, 0x8e, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x7b, 0xaf,
-  0xf7, 0x9e, 0x6b, 0x4d, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x29, 0x25, 0x52, 0xab, 0x7b, 0xf0, 0x8c, 0x71, 0x7b, 0xef, 0x52, 0xab, 0x29, 0x25, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x73, 0x6e,
-  0xf7, 0x9e, 0x6b, 0x4d, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x29, 0x45, 0x94, 0xb2, 0xef, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x3d, 0x94, 0x92, 0x29, 0x66, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xf7, 0x9e, 0x6b, 0x4d, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x94, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x8c, 0x31, 0x21, 0x25, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xf7, 0x9e, 0x6b, 0x4d, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x42, 0x29, 0xe6, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x7a, 0x39, 0xe7, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xf7, 0x9e, 0x6b, 0x4d, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x4d, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x3d, 0x5a, 0xcb, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xf7, 0x9e, 0x6b, 0x4d, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x73, 0x6e, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x5d, 0x62, 0xec, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xf7, 0x9e, 0x6b, 0x4d, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x52, 0x8a, 0xef, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x42, 0x29, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xf7, 0x9e, 0x6b, 0x4d, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0xb5, 0x76, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xf4, 0x29, 0x45, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xf7, 0x9e, 0x6b, 0x4d, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x29, 0x45, 0xce, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x38, 0x39, 0xe8, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xf7, 0x9e, 0x6b, 0x4d, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x94, 0x92, 0xd6, 0xba, 0xde, 0xdb, 0xd6, 0xba, 0x9c, 0xb3, 0x29, 0x45, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xf7, 0x9e, 0x6b, 0x4d, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x31, 0x86, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xf7, 0x9e, 0x6b, 0x4d, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xf7, 0x9e, 0x6b, 0x4d, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xf7, 0x9e, 0x6b, 0x4d, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xf7, 0x9e, 0x6b, 0x4d, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0xbf, 0x73, 0x6e, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0xff, 0x84, 0x10, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0xff, 0xbd, 0xd7, 0x29, 0x66, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0xff, 0xff, 0xdf, 0x8c, 0x51, 0x29, 0x45, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xba, 0x8c, 0x72, 0x73, 0x6e, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x6b, 0x4d, 0x63, 0x0c, 0x52, 0x8a, 0x29, 0x66, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x9e, 0xbd, 0xb7, 0x42, 0x29, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x7a, 0x29, 0x25, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0xcb, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0xb3, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x7a, 0xeb, 0x0c, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xe2, 0x49, 0xea, 0xec, 0xfe, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0x76, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0xff, 0xf5, 0xd7, 0xd8, 0x82, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x20, 0xf5, 0x76, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x96, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0xdf, 0xeb, 0x2c, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x96, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x96, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x96, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x96, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x96, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x96, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x96, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x96, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x96, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x96, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x96, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x96, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x96, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x96, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x96, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x96, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x96, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x96, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x96, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x96, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x96, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x76, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x96, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x59, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0xbe, 0xea, 0xeb, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa7, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbe, 0x29, 0x45, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0xff, 0xf4, 0xb2, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xeb, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xf4, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0xff, 0xff, 0xbe, 0xf4, 0xb3, 0xe1, 0x86, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xd8, 0xc3, 0xe1, 0x65, 0xf4, 0x72, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xc5, 0xf8, 0x7b, 0xcf, 0x4a, 0x29, 0x39, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x31, 0xa7, 0x39, 0xa7, 0x31, 0x86, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0x9e, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xbf, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0xbe, 0xf7, 0x7e, 0xa5, 0x14, 0x31, 0xa7, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xfc, 0x42, 0x28, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x14, 0x21, 0x25, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0x79, 0x31, 0x66, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xf5, 0xd7, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0xd7, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7a, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xf5, 0x96, 0xfe, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x42, 0x08, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0xff, 0xff, 0x1c, 0xe2, 0xaa, 0xd8, 0x61, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xe2, 0x49, 0xfe, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xd3, 0xd8, 0xc3, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0x41, 0xd8, 0xe4, 0xf5, 0x76, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xfb, 0x42, 0x29, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0xff, 0xeb, 0xef, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xea, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xd8, 0x20, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0xa3, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x42, 0x29, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0xbe, 0xea, 0xcb, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x55, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xfe, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x42, 0x29, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x34, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x42, 0x29, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x34, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x42, 0x29, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x34, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x42, 0x29, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x34, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x42, 0x29, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x34, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x42, 0x29, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x34, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x42, 0x29, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x34, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x42, 0x29, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x34, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x42, 0x29, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x34, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x42, 0x29, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x34, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x42, 0x29, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x34, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x42, 0x29, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x34, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x42, 0x29, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x34, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x42, 0x29, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x34, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x42, 0x29, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x34, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x42, 0x29, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x34, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x42, 0x29, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x6b, 0x6e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x34, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x42, 0x29, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x73, 0x8e,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x34, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x42, 0x29, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x8c, 0x31,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x34, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x42, 0x29, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x29, 0x66, 0xad, 0x55,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x34, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x42, 0x29, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x42, 0x29, 0xde, 0xdb,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x34, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdb, 0x42, 0x29, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x8c, 0x51, 0xff, 0xff,
-  0xff, 0x9e, 0xea, 0xab, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x34, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xfe, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x1c, 0x4a, 0x49, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x52, 0x8a, 0xef, 0x5d, 0xff, 0xff,
-  0xff, 0x9e, 0xea, 0xcb, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe1, 0xa6, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x35, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xfe, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x63, 0x0c, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x42, 0x28, 0xd6, 0xba, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xdf, 0xeb, 0x4d, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xe2, 0x69, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xba, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xd8, 0x00, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x14, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x21, 0x04, 0x5a, 0xcb, 0xde, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x7a, 0xe1, 0xe7, 0xd8, 0x82, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x62, 0xe1, 0x65, 0xfe, 0x38, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xae, 0xd8, 0x82, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0x61, 0xd8, 0xa2, 0xf4, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x94, 0x92, 0x39, 0xe8, 0x31, 0x86, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x29, 0x45, 0x31, 0x66, 0x39, 0xc7, 0x5a, 0xab, 0xa4, 0xf4, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0xdb, 0xf4, 0xf4, 0xf4, 0x72, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0xf3, 0xfe, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf5, 0xb6, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf4, 0x92, 0xf5, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xde, 0xdb, 0xbd, 0xb7, 0xa5, 0x14, 0x9c, 0xf4, 0x9c, 0xf4, 0x9c, 0xf4, 0x9c, 0xf4, 0x9c, 0xf4, 0x9c, 0xf4, 0x9c, 0xf4, 0x9c, 0xf4, 0x9c, 0xf4, 0x9c, 0xf4, 0x9c, 0xf4, 0x9c, 0xf4, 0x9c, 0xf4, 0x9c, 0xf4, 0xa5, 0x14, 0xad, 0x76, 0xce, 0x7a, 0xef, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-#endif
-#if LV_COLOR_DEPTH == 32
-  /*Pixel format: Fix 0xFF: 8 bit, Red: 8 bit, Green: 8 bit, Blue: 8 bit*/
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xf1, 0xf0, 0xf0, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd5, 0xd5, 0xff, 0xd6, 0xd6, 0xd6, 0xff, 0xdf, 0xdf, 0xdf, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xd2, 0xd2, 0xd2, 0xff, 0x8e, 0x8d, 0x8d, 0xff, 0x69, 0x67, 0x67, 0xff, 0x4e, 0x4c, 0x4b, 0xff, 0x43, 0x42, 0x41, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x42, 0x41, 0x40, 0xff, 0x44, 0x43, 0x42, 0xff, 0x50, 0x4f, 0x4e, 0xff, 0x6d, 0x6c, 0x6b, 0xff, 0x93, 0x92, 0x92, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0x8c, 0x8b, 0x8a, 0xff, 0x3b, 0x39, 0x38, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x24, 0x22, 0x21, 0xff, 0x40, 0x3e, 0x3d, 0xff, 0x98, 0x97, 0x96, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0x64, 0x63, 0x62, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x73, 0x72, 0x71, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0x6c, 0x6b, 0x6a, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x79, 0x78, 0x78, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x9e, 0x9d, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x25, 0x23, 0x22, 0xff, 0xaa, 0xa9, 0xa9, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xe4, 0xe3, 0xe3, 0xff, 0x4a, 0x49, 0x48, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x56, 0x54, 0x53, 0xff, 0xe7, 0xe7, 0xe7, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xae, 0xad, 0xac, 0xff, 0x2e, 0x2d, 0x2c, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x33, 0x31, 0x30, 0xff, 0xbb, 0xba, 0xba, 0xff,
-  0xfc, 0xfc, 0xfc, 0xff, 0x81, 0x80, 0x7f, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x27, 0x25, 0x24, 0xff, 0x90, 0x8f, 0x8e, 0xff,
-  0xf7, 0xf7, 0xf7, 0xff, 0x73, 0x72, 0x71, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x24, 0x22, 0x21, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x78, 0x76, 0x76, 0xff,
-  0xf2, 0xf2, 0xf2, 0xff, 0x6b, 0x6a, 0x69, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x27, 0x26, 0x25, 0xff, 0x55, 0x53, 0x52, 0xff, 0x7d, 0x7c, 0x7b, 0xff, 0x8c, 0x8b, 0x8a, 0xff, 0x7c, 0x7b, 0x7a, 0xff, 0x56, 0x54, 0x53, 0xff, 0x28, 0x26, 0x25, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6f, 0x6e, 0x6d, 0xff,
-  0xf2, 0xf2, 0xf2, 0xff, 0x6b, 0x6a, 0x69, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x2a, 0x28, 0x27, 0xff, 0x94, 0x93, 0x93, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x93, 0x92, 0x92, 0xff, 0x2e, 0x2d, 0x2c, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf2, 0xf2, 0xf2, 0xff, 0x6b, 0x6a, 0x69, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x90, 0x8f, 0x8e, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xf7, 0xff, 0x87, 0x86, 0x86, 0xff, 0x26, 0x24, 0x23, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf2, 0xf2, 0xf2, 0xff, 0x6b, 0x6a, 0x69, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x46, 0x44, 0x43, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xcd, 0xcd, 0xff, 0x3c, 0x3b, 0x3a, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf2, 0xf2, 0xf2, 0xff, 0x6b, 0x6a, 0x69, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6b, 0x6a, 0x69, 0xff, 0xf8, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0x5c, 0x5a, 0x5a, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf2, 0xf2, 0xf2, 0xff, 0x6b, 0x6a, 0x69, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6f, 0x6e, 0x6d, 0xff, 0xf8, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xe9, 0xe8, 0xff, 0x5f, 0x5e, 0x5d, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf2, 0xf2, 0xf2, 0xff, 0x6b, 0x6a, 0x69, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x51, 0x50, 0x4f, 0xff, 0xe6, 0xe6, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xd7, 0xd7, 0xff, 0x46, 0x44, 0x43, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf2, 0xf2, 0xf2, 0xff, 0x6b, 0x6a, 0x69, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0xae, 0xae, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0x9d, 0x9c, 0x9c, 0xff, 0x29, 0x27, 0x26, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf2, 0xf2, 0xf2, 0xff, 0x6b, 0x6a, 0x69, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x29, 0x27, 0x26, 0xff, 0xcd, 0xcc, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0xc4, 0xc3, 0xff, 0x3d, 0x3b, 0x3b, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf2, 0xf2, 0xf2, 0xff, 0x6b, 0x6a, 0x69, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x93, 0x92, 0x92, 0xff, 0xd4, 0xd3, 0xd3, 0xff, 0xdb, 0xda, 0xda, 0xff, 0xd3, 0xd3, 0xd2, 0xff, 0x97, 0x96, 0x96, 0xff, 0x2b, 0x29, 0x28, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf2, 0xf2, 0xf2, 0xff, 0x6b, 0x6a, 0x69, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x31, 0x2f, 0x2e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf2, 0xf2, 0xf2, 0xff, 0x6b, 0x6a, 0x69, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf2, 0xf2, 0xf2, 0xff, 0x6b, 0x6a, 0x69, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf2, 0xf2, 0xf2, 0xff, 0x6b, 0x6a, 0x69, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf2, 0xf2, 0xf2, 0xff, 0x6b, 0x6a, 0x69, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf5, 0xf5, 0xf5, 0xff, 0x70, 0x6e, 0x6e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xfc, 0xfc, 0xfc, 0xff, 0x83, 0x82, 0x81, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xba, 0xb9, 0xb9, 0xff, 0x2e, 0x2d, 0x2c, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0x88, 0x87, 0x87, 0xff, 0x2c, 0x2a, 0x29, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xd3, 0xd2, 0xff, 0x8d, 0x8c, 0x8c, 0xff, 0x6f, 0x6e, 0x6d, 0xff, 0x68, 0x67, 0x66, 0xff, 0x69, 0x67, 0x67, 0xff, 0x69, 0x67, 0x67, 0xff, 0x69, 0x67, 0x67, 0xff, 0x69, 0x67, 0x67, 0xff, 0x69, 0x67, 0x67, 0xff, 0x69, 0x67, 0x67, 0xff, 0x69, 0x67, 0x67, 0xff, 0x69, 0x67, 0x67, 0xff, 0x69, 0x67, 0x67, 0xff, 0x69, 0x67, 0x67, 0xff, 0x69, 0x67, 0x67, 0xff, 0x69, 0x67, 0x67, 0xff, 0x69, 0x67, 0x67, 0xff, 0x69, 0x67, 0x67, 0xff, 0x69, 0x67, 0x67, 0xff, 0x69, 0x67, 0x67, 0xff, 0x69, 0x67, 0x67, 0xff, 0x69, 0x67, 0x67, 0xff, 0x69, 0x67, 0x67, 0xff, 0x69, 0x67, 0x67, 0xff, 0x69, 0x67, 0x67, 0xff, 0x69, 0x67, 0x67, 0xff, 0x69, 0x67, 0x67, 0xff, 0x64, 0x62, 0x61, 0xff, 0x50, 0x4f, 0x4e, 0xff, 0x2d, 0x2b, 0x2a, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xf0, 0xf0, 0xff, 0xb6, 0xb6, 0xb5, 0xff, 0x47, 0x45, 0x44, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xcd, 0xcd, 0xff, 0x27, 0x26, 0x25, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5a, 0x58, 0x58, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x96, 0x96, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xce, 0xf7, 0xff, 0x62, 0x62, 0xe6, 0xff, 0x48, 0x48, 0xe3, 0xff, 0x4a, 0x4a, 0xe3, 0xff, 0x4a, 0x4a, 0xe3, 0xff, 0x4a, 0x4a, 0xe3, 0xff, 0x4a, 0x4a, 0xe3, 0xff, 0x4a, 0x4a, 0xe3, 0xff, 0x4a, 0x4a, 0xe3, 0xff, 0x4a, 0x4a, 0xe3, 0xff, 0x4a, 0x4a, 0xe3, 0xff, 0x4a, 0x4a, 0xe3, 0xff, 0x4a, 0x4a, 0xe3, 0xff, 0x4a, 0x4a, 0xe3, 0xff, 0x4a, 0x4a, 0xe3, 0xff, 0x4a, 0x4a, 0xe3, 0xff, 0x4a, 0x4a, 0xe3, 0xff, 0x4a, 0x4a, 0xe3, 0xff, 0x4a, 0x4a, 0xe3, 0xff, 0x4a, 0x4a, 0xe3, 0xff, 0x4a, 0x4a, 0xe3, 0xff, 0x4a, 0x4a, 0xe3, 0xff, 0x4a, 0x4a, 0xe3, 0xff, 0x4a, 0x4a, 0xe3, 0xff, 0x49, 0x49, 0xe3, 0xff, 0x5e, 0x5e, 0xe6, 0xff, 0xcd, 0xcd, 0xf7, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0xad, 0xac, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xba, 0xba, 0xf4, 0xff, 0x0f, 0x0f, 0xda, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x03, 0x03, 0xd8, 0xff, 0xad, 0xad, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xaf, 0xae, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf8, 0xf8, 0xfd, 0xff, 0x63, 0x63, 0xe7, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x3c, 0x3c, 0xe1, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xaf, 0xae, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xaf, 0xae, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xaf, 0xae, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xaf, 0xae, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xaf, 0xae, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xaf, 0xae, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xaf, 0xae, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xaf, 0xae, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xaf, 0xae, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xaf, 0xae, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xaf, 0xae, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xaf, 0xae, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xaf, 0xae, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xaf, 0xae, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xaf, 0xae, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xaf, 0xae, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xaf, 0xae, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xaf, 0xae, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xaf, 0xae, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xaf, 0xae, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xaf, 0xae, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0xae, 0xad, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0xaf, 0xaf, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x55, 0x55, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0xc9, 0xc9, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf4, 0xf4, 0xfd, 0xff, 0x5b, 0x5b, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x35, 0x35, 0xe0, 0xff, 0xf2, 0xf2, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0x2b, 0x29, 0x28, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xfe, 0xfe, 0xfe, 0xff, 0x94, 0x94, 0xee, 0xff, 0x02, 0x02, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x7c, 0x7c, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xff, 0x9f, 0x9e, 0x9d, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf3, 0xf3, 0xfd, 0xff, 0x96, 0x96, 0xee, 0xff, 0x2f, 0x2f, 0xdf, 0xff, 0x19, 0x19, 0xdb, 0xff, 0x1a, 0x1a, 0xdb, 0xff, 0x1a, 0x1a, 0xdb, 0xff, 0x1a, 0x1a, 0xdb, 0xff, 0x1a, 0x1a, 0xdb, 0xff, 0x1a, 0x1a, 0xdb, 0xff, 0x1a, 0x1a, 0xdb, 0xff, 0x1a, 0x1a, 0xdb, 0xff, 0x1a, 0x1a, 0xdb, 0xff, 0x1a, 0x1a, 0xdb, 0xff, 0x1a, 0x1a, 0xdb, 0xff, 0x1a, 0x1a, 0xdb, 0xff, 0x1a, 0x1a, 0xdb, 0xff, 0x1a, 0x1a, 0xdb, 0xff, 0x1a, 0x1a, 0xdb, 0xff, 0x1a, 0x1a, 0xdb, 0xff, 0x1a, 0x1a, 0xdb, 0xff, 0x1a, 0x1a, 0xdb, 0xff, 0x1a, 0x1a, 0xdb, 0xff, 0x1a, 0x1a, 0xdb, 0xff, 0x1a, 0x1a, 0xdb, 0xff, 0x1a, 0x1a, 0xdb, 0xff, 0x19, 0x19, 0xdb, 0xff, 0x2b, 0x2b, 0xde, 0xff, 0x8d, 0x8d, 0xed, 0xff, 0xf3, 0xf3, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf7, 0xf7, 0xff, 0xbf, 0xbe, 0xbe, 0xff, 0x78, 0x77, 0x77, 0xff, 0x48, 0x46, 0x45, 0xff, 0x38, 0x36, 0x35, 0xff, 0x36, 0x34, 0x34, 0xff, 0x37, 0x35, 0x34, 0xff, 0x37, 0x35, 0x34, 0xff, 0x37, 0x35, 0x34, 0xff, 0x37, 0x35, 0x34, 0xff, 0x37, 0x35, 0x34, 0xff, 0x37, 0x35, 0x34, 0xff, 0x37, 0x35, 0x34, 0xff, 0x37, 0x35, 0x34, 0xff, 0x37, 0x35, 0x34, 0xff, 0x37, 0x35, 0x34, 0xff, 0x37, 0x35, 0x34, 0xff, 0x37, 0x35, 0x34, 0xff, 0x37, 0x35, 0x34, 0xff, 0x37, 0x35, 0x34, 0xff, 0x37, 0x35, 0x34, 0xff, 0x37, 0x35, 0x34, 0xff, 0x37, 0x35, 0x34, 0xff, 0x37, 0x35, 0x34, 0xff, 0x37, 0x35, 0x34, 0xff, 0x37, 0x35, 0x34, 0xff, 0x37, 0x35, 0x34, 0xff, 0x38, 0x36, 0x35, 0xff, 0x32, 0x30, 0x2f, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfe, 0xff, 0xf4, 0xf4, 0xfd, 0xff, 0xf2, 0xf2, 0xfd, 0xff, 0xf2, 0xf2, 0xfd, 0xff, 0xf2, 0xf2, 0xfd, 0xff, 0xf2, 0xf2, 0xfd, 0xff, 0xf2, 0xf2, 0xfd, 0xff, 0xf2, 0xf2, 0xfd, 0xff, 0xf2, 0xf2, 0xfd, 0xff, 0xf2, 0xf2, 0xfd, 0xff, 0xf2, 0xf2, 0xfd, 0xff, 0xf2, 0xf2, 0xfd, 0xff, 0xf2, 0xf2, 0xfd, 0xff, 0xf2, 0xf2, 0xfd, 0xff, 0xf2, 0xf2, 0xfd, 0xff, 0xf2, 0xf2, 0xfd, 0xff, 0xf2, 0xf2, 0xfd, 0xff, 0xf2, 0xf2, 0xfd, 0xff, 0xf2, 0xf2, 0xfd, 0xff, 0xf2, 0xf2, 0xfd, 0xff, 0xf2, 0xf2, 0xfd, 0xff, 0xf2, 0xf2, 0xfd, 0xff, 0xf2, 0xf2, 0xfd, 0xff, 0xf2, 0xf2, 0xfd, 0xff, 0xf2, 0xf2, 0xfd, 0xff, 0xf4, 0xf4, 0xfd, 0xff, 0xfc, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xff, 0xf5, 0xf5, 0xf5, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xf3, 0xf3, 0xf3, 0xff, 0xed, 0xed, 0xed, 0xff, 0xa0, 0xa0, 0x9f, 0xff, 0x35, 0x33, 0x32, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xde, 0xde, 0xff, 0x44, 0x43, 0x42, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0xa1, 0xa0, 0xff, 0x25, 0x23, 0x22, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 0xcb, 0xca, 0xff, 0x30, 0x2e, 0x2d, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xee, 0xfc, 0xff, 0xba, 0xba, 0xf4, 0xff, 0xaf, 0xaf, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xaf, 0xaf, 0xf2, 0xff, 0xb8, 0xb8, 0xf4, 0xff, 0xeb, 0xeb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xcd, 0xcd, 0xf7, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xb1, 0xb1, 0xf3, 0xff, 0xd5, 0xd5, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xda, 0xd9, 0xff, 0x42, 0x40, 0x3f, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xe1, 0xe1, 0xfa, 0xff, 0x53, 0x53, 0xe4, 0xff, 0x0b, 0x0b, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x07, 0x07, 0xd9, 0xff, 0x4a, 0x4a, 0xe3, 0xff, 0xdb, 0xdb, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfe, 0xff, 0x97, 0x97, 0xef, 0xff, 0x19, 0x19, 0xdb, 0xff, 0x07, 0x07, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x07, 0x07, 0xd9, 0xff, 0x1d, 0x1d, 0xdc, 0xff, 0xae, 0xae, 0xf2, 0xff, 0xfd, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xdb, 0xdb, 0xff, 0x45, 0x43, 0x43, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xfc, 0xfc, 0xfe, 0xff, 0x7b, 0x7b, 0xea, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x5a, 0x5a, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xe4, 0xfa, 0xff, 0x03, 0x03, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x16, 0x16, 0xdb, 0xff, 0xf1, 0xf1, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xda, 0xda, 0xff, 0x45, 0x43, 0x43, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf3, 0xf3, 0xfd, 0xff, 0x57, 0x57, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xeb, 0xeb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0xaa, 0xf2, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0xd8, 0xd8, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xda, 0xda, 0xff, 0x45, 0x43, 0x43, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe6, 0xe6, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 0xa3, 0xf0, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0xd2, 0xd2, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xda, 0xda, 0xff, 0x45, 0x43, 0x43, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xa4, 0xf1, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0xd2, 0xd2, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xda, 0xda, 0xff, 0x45, 0x43, 0x43, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xa4, 0xf1, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0xd2, 0xd2, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xda, 0xda, 0xff, 0x45, 0x43, 0x43, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xa4, 0xf1, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0xd2, 0xd2, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xda, 0xda, 0xff, 0x45, 0x43, 0x43, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xa4, 0xf1, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0xd2, 0xd2, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xda, 0xda, 0xff, 0x45, 0x43, 0x43, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xa4, 0xf1, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0xd2, 0xd2, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xda, 0xda, 0xff, 0x45, 0x43, 0x43, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xa4, 0xf1, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0xd2, 0xd2, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xda, 0xda, 0xff, 0x45, 0x43, 0x43, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xa4, 0xf1, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0xd2, 0xd2, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xda, 0xda, 0xff, 0x45, 0x43, 0x43, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xa4, 0xf1, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0xd2, 0xd2, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xda, 0xda, 0xff, 0x45, 0x43, 0x43, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xa4, 0xf1, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0xd2, 0xd2, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xda, 0xda, 0xff, 0x45, 0x43, 0x43, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xa4, 0xf1, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0xd2, 0xd2, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xda, 0xda, 0xff, 0x45, 0x43, 0x43, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xa4, 0xf1, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0xd2, 0xd2, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xda, 0xda, 0xff, 0x45, 0x43, 0x43, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xa4, 0xf1, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0xd2, 0xd2, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xda, 0xda, 0xff, 0x45, 0x43, 0x43, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xa4, 0xf1, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0xd2, 0xd2, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xda, 0xda, 0xff, 0x45, 0x43, 0x43, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xa4, 0xf1, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0xd2, 0xd2, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xda, 0xda, 0xff, 0x45, 0x43, 0x43, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xa4, 0xf1, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0xd2, 0xd2, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xda, 0xda, 0xff, 0x45, 0x43, 0x43, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x6e, 0x6d, 0x6c, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xa4, 0xf1, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0xd2, 0xd2, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xda, 0xda, 0xff, 0x45, 0x43, 0x43, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x73, 0x72, 0x71, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xa4, 0xf1, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0xd2, 0xd2, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xda, 0xda, 0xff, 0x45, 0x43, 0x43, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x23, 0x21, 0x20, 0xff, 0x86, 0x85, 0x85, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xa4, 0xf1, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0xd2, 0xd2, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xda, 0xda, 0xff, 0x45, 0x43, 0x43, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x2e, 0x2d, 0x2c, 0xff, 0xab, 0xaa, 0xaa, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xa4, 0xf1, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0xd2, 0xd2, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xda, 0xda, 0xff, 0x45, 0x43, 0x43, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x45, 0x43, 0x43, 0xff, 0xdb, 0xda, 0xda, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xa4, 0xf1, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0xd2, 0xd2, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xda, 0xda, 0xff, 0x45, 0x43, 0x43, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x8a, 0x89, 0x88, 0xff, 0xfc, 0xfc, 0xfc, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x56, 0x56, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 0xa3, 0xf0, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0xd2, 0xd2, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0x4b, 0x4a, 0x49, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x50, 0x4f, 0x4e, 0xff, 0xe7, 0xe7, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf1, 0xf1, 0xfc, 0xff, 0x57, 0x57, 0xe5, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x33, 0x33, 0xdf, 0xff, 0xe8, 0xe8, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0xa5, 0xf1, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0xd5, 0xd5, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0x63, 0x61, 0x61, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x44, 0x43, 0x42, 0xff, 0xd3, 0xd3, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfa, 0xfa, 0xfe, 0xff, 0x6a, 0x6a, 0xe8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x4b, 0x4b, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xd3, 0xf8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x02, 0x02, 0xd8, 0xff, 0xed, 0xed, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0xa1, 0xa0, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x24, 0x22, 0x21, 0xff, 0x5a, 0x58, 0x58, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xcd, 0xcd, 0xf7, 0xff, 0x3c, 0x3c, 0xe1, 0xff, 0x10, 0x10, 0xda, 0xff, 0x0b, 0x0b, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0b, 0x0b, 0xd9, 0xff, 0x0e, 0x0e, 0xda, 0xff, 0x2b, 0x2b, 0xde, 0xff, 0xc3, 0xc3, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfe, 0xff, 0x73, 0x73, 0xe9, 0xff, 0x11, 0x11, 0xda, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x0c, 0x0c, 0xd9, 0xff, 0x13, 0x13, 0xda, 0xff, 0x8d, 0x8d, 0xed, 0xff, 0xfb, 0xfb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0x92, 0x91, 0x90, 0xff, 0x3d, 0x3b, 0x3b, 0xff, 0x32, 0x30, 0x2f, 0xff, 0x2c, 0x2a, 0x29, 0xff, 0x2b, 0x29, 0x28, 0xff, 0x2b, 0x29, 0x28, 0xff, 0x2b, 0x29, 0x28, 0xff, 0x2b, 0x29, 0x28, 0xff, 0x2b, 0x29, 0x28, 0xff, 0x2b, 0x29, 0x28, 0xff, 0x2b, 0x29, 0x28, 0xff, 0x2b, 0x29, 0x28, 0xff, 0x2b, 0x29, 0x28, 0xff, 0x2b, 0x29, 0x28, 0xff, 0x2b, 0x29, 0x28, 0xff, 0x2b, 0x29, 0x28, 0xff, 0x2b, 0x29, 0x28, 0xff, 0x2b, 0x29, 0x28, 0xff, 0x2b, 0x29, 0x28, 0xff, 0x2f, 0x2d, 0x2d, 0xff, 0x3a, 0x38, 0x37, 0xff, 0x57, 0x56, 0x55, 0xff, 0x9e, 0x9d, 0x9d, 0xff, 0xf1, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xda, 0xf9, 0xff, 0x9e, 0x9e, 0xf0, 0xff, 0x8e, 0x8e, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x9c, 0x9c, 0xef, 0xff, 0xd7, 0xd7, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xfd, 0xff, 0xb4, 0xb4, 0xf3, 0xff, 0x91, 0x91, 0xee, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x8f, 0x8f, 0xed, 0xff, 0x92, 0x92, 0xee, 0xff, 0xbb, 0xbb, 0xf4, 0xff, 0xf9, 0xf9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xb6, 0xb6, 0xb5, 0xff, 0xa0, 0xa0, 0x9f, 0xff, 0x9d, 0x9c, 0x9c, 0xff, 0x9d, 0x9c, 0x9c, 0xff, 0x9d, 0x9c, 0x9c, 0xff, 0x9d, 0x9c, 0x9c, 0xff, 0x9d, 0x9c, 0x9c, 0xff, 0x9d, 0x9c, 0x9c, 0xff, 0x9d, 0x9c, 0x9c, 0xff, 0x9d, 0x9c, 0x9c, 0xff, 0x9d, 0x9c, 0x9c, 0xff, 0x9d, 0x9c, 0x9c, 0xff, 0x9d, 0x9c, 0x9c, 0xff, 0x9d, 0x9c, 0x9c, 0xff, 0x9d, 0x9c, 0x9c, 0xff, 0x9d, 0x9c, 0x9c, 0xff, 0xa0, 0x9f, 0x9e, 0xff, 0xae, 0xad, 0xac, 0xff, 0xcd, 0xcc, 0xcc, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-#endif
-};
-
-lv_img_dsc_t img_lv_demo_music_logo = {
-  .header.always_zero = 0,
-  .header.w = 97,
-  .header.h = 97,
-  .data_size = 9409 * LV_COLOR_SIZE / 8,
-  .header.cf = LV_IMG_CF_TRUE_COLOR,
-  .data = img_lv_demo_music_logo_map,
-};
-
-
-#endif /*LV_USE_DEMO_MUSIC*/
-
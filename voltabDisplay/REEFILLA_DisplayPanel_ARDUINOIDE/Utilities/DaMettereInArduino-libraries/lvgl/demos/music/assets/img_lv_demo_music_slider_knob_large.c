@@ -1,301 +0,0 @@
-#include "../lv_demo_music.h"
-#if LV_USE_DEMO_MUSIC && LV_DEMO_MUSIC_LARGE
-
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMG_LV_DEMO_MUSIC_ICN_SLIDER
-#define LV_ATTRIBUTE_IMG_IMG_LV_DEMO_MUSIC_ICN_SLIDER
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMG_LV_DEMO_MUSIC_ICN_SLIDER uint8_t img_lv_demo_music_slider_knob_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Blue: 2 bit, Green: 3 bit, Red: 3 bit, Alpha 8 bit */
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0x93, 0x17, 0x77, 0x5c, 0x77, 0xa8, 0x77, 0xdb, 0x77, 0xf4, 0x77, 0xff, 0x77, 0xf8, 0x73, 0xd3, 0x73, 0x93, 0x93, 0x48, 0xaf, 0x18, 0xaf, 0x18, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0x77, 0x68, 0x77, 0xe3, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xc3, 0x93, 0x48, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0x93, 0x1c, 0x77, 0xbc, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0x93, 0xfc, 0x93, 0x88, 0xaf, 0x1f, 0xaf, 0x1f, 0xaf, 0x1c, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0x93, 0x1c, 0x77, 0xd3, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0x97, 0xaf, 0x23, 0xaf, 0x20, 0xaf, 0x20, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0x77, 0xbb, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0x7c, 0xaf, 0x27, 0xaf, 0x24, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0x77, 0x64, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xf4, 0xaf, 0x43, 0xaf, 0x28, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0x93, 0x14, 0x77, 0xe0, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x97, 0xff, 0xb7, 0xff, 0xbb, 0xff, 0xb7, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xab, 0xaf, 0x2c, 0xaf, 0x2b, 0xaf, 0x27, 0xaf, 0x24, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0x77, 0x5f, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xf7, 0xaf, 0x3c, 0xaf, 0x2f, 0xaf, 0x2b, 0xaf, 0x28, 0xaf, 0x24, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0x77, 0xa8, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0x74, 0xaf, 0x33, 0xaf, 0x2f, 0xaf, 0x2b, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0x77, 0xd8, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xa0, 0xaf, 0x37, 0xaf, 0x33, 0xaf, 0x2f, 0xaf, 0x2b, 0xaf, 0x24, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0x77, 0xf4, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xb8, 0xaf, 0x3b, 0xaf, 0x37, 0xaf, 0x30, 0xaf, 0x2c, 0xaf, 0x28, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0x77, 0xfc, 0x77, 0xff, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xbc, 0xaf, 0x3c, 0xaf, 0x38, 0xaf, 0x34, 0xaf, 0x2f, 0xaf, 0x2b, 0xaf, 0x24, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x13, 0x77, 0xec, 0x77, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xb3, 0xaf, 0x3f, 0xaf, 0x3b, 0xaf, 0x37, 0xaf, 0x30, 0xaf, 0x2b, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x14, 0x77, 0xc8, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0x98, 0xaf, 0x40, 0xaf, 0x3c, 0xaf, 0x37, 0xaf, 0x33, 0xaf, 0x2c, 0xaf, 0x28, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0x73, 0x90, 0x73, 0xff, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0x6b, 0xaf, 0x43, 0xaf, 0x3c, 0xaf, 0x38, 0xaf, 0x33, 0xaf, 0x2f, 0xaf, 0x28, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0x93, 0x40, 0x73, 0xff, 0x73, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xe3, 0xaf, 0x47, 0xaf, 0x43, 0xaf, 0x3f, 0xaf, 0x38, 0xaf, 0x34, 0xaf, 0x2f, 0xaf, 0x28, 0xaf, 0x24, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x18, 0x93, 0xb4, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0x90, 0xaf, 0x47, 0xaf, 0x43, 0xaf, 0x3f, 0xaf, 0x38, 0xaf, 0x34, 0xaf, 0x2f, 0xaf, 0x28, 0xaf, 0x24, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x18, 0x93, 0x3f, 0x93, 0xf8, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xdb, 0xaf, 0x4c, 0xaf, 0x47, 0xaf, 0x43, 0xaf, 0x3f, 0xaf, 0x38, 0xaf, 0x33, 0xaf, 0x2f, 0xaf, 0x28, 0xaf, 0x24, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1c, 0x93, 0x77, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xf0, 0xaf, 0x64, 0xaf, 0x4b, 0xaf, 0x47, 0xaf, 0x43, 0xaf, 0x3c, 0xaf, 0x38, 0xaf, 0x33, 0xaf, 0x2c, 0xaf, 0x28, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x1f, 0x93, 0x88, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xf0, 0xaf, 0x70, 0xaf, 0x4b, 0xaf, 0x48, 0xaf, 0x44, 0xaf, 0x40, 0xaf, 0x3c, 0xaf, 0x37, 0xaf, 0x30, 0xaf, 0x2c, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x1f, 0xaf, 0x23, 0x93, 0x6b, 0x93, 0xeb, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xd7, 0xaf, 0x64, 0xaf, 0x4b, 0xaf, 0x48, 0xaf, 0x47, 0xaf, 0x43, 0xaf, 0x3f, 0xaf, 0x3b, 0xaf, 0x34, 0xaf, 0x30, 0xaf, 0x2b, 0xaf, 0x27, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x27, 0xaf, 0x34, 0x93, 0x94, 0x93, 0xec, 0xb3, 0xff, 0xb3, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xff, 0xaf, 0xdf, 0xaf, 0x8c, 0xaf, 0x4c, 0xaf, 0x4b, 0xaf, 0x48, 0xaf, 0x47, 0xaf, 0x43, 0xaf, 0x40, 0xaf, 0x3c, 0xaf, 0x37, 0xaf, 0x33, 0xaf, 0x2f, 0xaf, 0x28, 0xaf, 0x24, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1b, 0xaf, 0x1f, 0xaf, 0x24, 0xaf, 0x28, 0xaf, 0x2c, 0xaf, 0x34, 0xaf, 0x67, 0xaf, 0x94, 0xaf, 0xac, 0xaf, 0xb3, 0xaf, 0xa8, 0xaf, 0x8f, 0xaf, 0x63, 0xaf, 0x47, 0xaf, 0x47, 0xaf, 0x47, 0xaf, 0x47, 0xaf, 0x44, 0xaf, 0x43, 0xaf, 0x40, 0xaf, 0x3c, 0xaf, 0x38, 0xaf, 0x34, 0xaf, 0x30, 0xaf, 0x2b, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x27, 0xaf, 0x2b, 0xaf, 0x2f, 0xaf, 0x33, 0xaf, 0x37, 0xaf, 0x3b, 0xaf, 0x3c, 0xaf, 0x3f, 0xaf, 0x40, 0xaf, 0x43, 0xaf, 0x43, 0xaf, 0x43, 0xaf, 0x43, 0xaf, 0x43, 0xaf, 0x40, 0xaf, 0x3f, 0xaf, 0x3c, 0xaf, 0x38, 0xaf, 0x34, 0xaf, 0x30, 0xaf, 0x2c, 0xaf, 0x28, 0xaf, 0x24, 0xaf, 0x20, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x18, 0xaf, 0x1b, 0xaf, 0x1f, 0xaf, 0x23, 0xaf, 0x27, 0xaf, 0x2b, 0xaf, 0x2f, 0xaf, 0x33, 0xaf, 0x34, 0xaf, 0x38, 0xaf, 0x3b, 0xaf, 0x3c, 0xaf, 0x3c, 0xaf, 0x3f, 0xaf, 0x3f, 0xaf, 0x3f, 0xaf, 0x3c, 0xaf, 0x3b, 0xaf, 0x3b, 0xaf, 0x37, 0xaf, 0x34, 0xaf, 0x30, 0xaf, 0x2c, 0xaf, 0x2b, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x24, 0xaf, 0x27, 0xaf, 0x2b, 0xaf, 0x2f, 0xaf, 0x30, 0xaf, 0x33, 0xaf, 0x34, 0xaf, 0x37, 0xaf, 0x38, 0xaf, 0x38, 0xaf, 0x38, 0xaf, 0x38, 0xaf, 0x38, 0xaf, 0x37, 0xaf, 0x34, 0xaf, 0x33, 0xaf, 0x30, 0xaf, 0x2c, 0xaf, 0x2b, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x23, 0xaf, 0x27, 0xaf, 0x28, 0xaf, 0x2c, 0xaf, 0x2f, 0xaf, 0x30, 0xaf, 0x33, 0xaf, 0x33, 0xaf, 0x33, 0xaf, 0x33, 0xaf, 0x33, 0xaf, 0x33, 0xaf, 0x30, 0xaf, 0x30, 0xaf, 0x2f, 0xaf, 0x2b, 0xaf, 0x28, 0xaf, 0x27, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x1b, 0xaf, 0x1c, 0xaf, 0x20, 0xaf, 0x23, 0xaf, 0x24, 0xaf, 0x27, 0xaf, 0x28, 0xaf, 0x2b, 0xaf, 0x2c, 0xaf, 0x2c, 0xaf, 0x2f, 0xaf, 0x2f, 0xaf, 0x2f, 0xaf, 0x2c, 0xaf, 0x2c, 0xaf, 0x2b, 0xaf, 0x28, 0xaf, 0x27, 0xaf, 0x24, 0xaf, 0x23, 0xaf, 0x1f, 0xaf, 0x1c, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x1c, 0xaf, 0x1f, 0xaf, 0x20, 0xaf, 0x23, 0xaf, 0x24, 0xaf, 0x27, 0xaf, 0x27, 0xaf, 0x28, 0xaf, 0x28, 0xaf, 0x28, 0xaf, 0x28, 0xaf, 0x28, 0xaf, 0x27, 0xaf, 0x27, 0xaf, 0x24, 0xaf, 0x23, 0xaf, 0x20, 0xaf, 0x1f, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x1b, 0xaf, 0x1c, 0xaf, 0x1f, 0xaf, 0x20, 0xaf, 0x20, 0xaf, 0x23, 0xaf, 0x23, 0xaf, 0x24, 0xaf, 0x24, 0xaf, 0x24, 0xaf, 0x23, 0xaf, 0x23, 0xaf, 0x20, 0xaf, 0x20, 0xaf, 0x1f, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x1b, 0xaf, 0x1c, 0xaf, 0x1c, 0xaf, 0x1f, 0xaf, 0x1f, 0xaf, 0x1f, 0xaf, 0x1f, 0xaf, 0x1f, 0xaf, 0x1f, 0xaf, 0x1f, 0xaf, 0x1c, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x18, 0xaf, 0x18, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x1b, 0xaf, 0x18, 0xaf, 0x18, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x17, 0xaf, 0x14, 0xaf, 0x14, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x13, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x10, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0f, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0c, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x0b, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x08, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x07, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x04, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x03, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00, 0xaf, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Blue: 5 bit, Green: 6 bit, Red: 5 bit, Alpha 8 bit*/
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0xfe, 0x8b, 0x17, 0xbf, 0x64, 0x5c, 0xdf, 0x5c, 0xa8, 0xdf, 0x5c, 0xdb, 0xbf, 0x5c, 0xf4, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xf8, 0x9f, 0x6c, 0xd3, 0x7f, 0x6c, 0x93, 0x3e, 0x7c, 0x48, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x7e, 0xa3, 0x0f, 0xdf, 0x5c, 0x68, 0xff, 0x5c, 0xe3, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xbf, 0x5c, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0x5f, 0x74, 0xc3, 0xfe, 0x83, 0x48, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0x7c, 0x1c, 0xff, 0x54, 0xbc, 0xff, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xbf, 0x5c, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x7c, 0xfc, 0x1e, 0x84, 0x88, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x3e, 0x7c, 0x1c, 0xff, 0x54, 0xd3, 0xff, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xbf, 0x5c, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0xfe, 0x83, 0x97, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x7e, 0xa3, 0x0f, 0xff, 0x54, 0xbb, 0xff, 0x54, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xbf, 0x5c, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x1e, 0x84, 0xff, 0xfe, 0x83, 0xff, 0xde, 0x8b, 0x7c, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0xdf, 0x5c, 0x64, 0xff, 0x54, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xbf, 0x5c, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x1e, 0x84, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x8b, 0xff, 0xde, 0x8b, 0xf4, 0x9e, 0x9b, 0x43, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0xde, 0x93, 0x14, 0xff, 0x5c, 0xe0, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0xbf, 0x74, 0xff, 0x9f, 0x9d, 0xff, 0xbf, 0xad, 0xff, 0x3f, 0x95, 0xff, 0x5f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x1e, 0x84, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xbe, 0x93, 0xab, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0f, 0xbf, 0x64, 0x5f, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x3f, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xef, 0xff, 0xdf, 0x9c, 0xff, 0x1e, 0x84, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xf7, 0x7e, 0xa3, 0x3c, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0xdf, 0x5c, 0xa8, 0xdf, 0x5c, 0xff, 0xdf, 0x5c, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x5f, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x9f, 0x9c, 0xff, 0xfe, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x7e, 0x9b, 0x74, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x10, 0xdf, 0x5c, 0xd8, 0xdf, 0x5c, 0xff, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0xff, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xde, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xa0, 0x5e, 0xab, 0x37, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0xdf, 0x5c, 0xf4, 0xbf, 0x64, 0xff, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0xff, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0xa3, 0xb8, 0x5e, 0xab, 0x3b, 0x5e, 0xab, 0x37, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x13, 0xbf, 0x64, 0xfc, 0xbf, 0x64, 0xff, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x3f, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1e, 0x9c, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xbc, 0x5e, 0xab, 0x3c, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x34, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0xbf, 0x64, 0xec, 0x9f, 0x64, 0xff, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x5f, 0x74, 0xff, 0xbf, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xb3, 0x5e, 0xab, 0x3f, 0x5e, 0xab, 0x3b, 0x5e, 0xab, 0x37, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x14, 0x9f, 0x6c, 0xc8, 0x9f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x9f, 0x84, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xd6, 0xff, 0x9e, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0x98, 0x5e, 0xab, 0x40, 0x5e, 0xab, 0x3c, 0x5e, 0xab, 0x37, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x14, 0x7f, 0x6c, 0x90, 0x7f, 0x6c, 0xff, 0x7f, 0x6c, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x74, 0xff, 0x3f, 0x7c, 0xff, 0x7f, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xf7, 0xff, 0xfe, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xab, 0x6b, 0x5e, 0xab, 0x43, 0x5e, 0xab, 0x3c, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x14, 0x3e, 0x7c, 0x40, 0x7f, 0x6c, 0xff, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x74, 0xff, 0x3f, 0x7c, 0xff, 0x1f, 0x7c, 0xff, 0x1e, 0x84, 0xff, 0x3f, 0xad, 0xff, 0x5f, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xde, 0xff, 0xfe, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xab, 0xe3, 0x5e, 0xab, 0x47, 0x5e, 0xab, 0x43, 0x5e, 0xab, 0x3f, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x34, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x18, 0x5f, 0x74, 0xb4, 0x5f, 0x74, 0xff, 0x5f, 0x74, 0xff, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x1e, 0x84, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x83, 0xff, 0xde, 0x8b, 0xff, 0x5e, 0x9c, 0xff, 0x9f, 0xa4, 0xff, 0xfe, 0x9b, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xab, 0xff, 0x5e, 0xab, 0x90, 0x5e, 0xab, 0x47, 0x5e, 0xab, 0x43, 0x5e, 0xab, 0x3f, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x34, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x18, 0xfe, 0x8b, 0x3f, 0x5f, 0x74, 0xf8, 0x3f, 0x7c, 0xff, 0x3f, 0x7c, 0xff, 0x1e, 0x84, 0xff, 0x1e, 0x84, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xab, 0xff, 0x3e, 0xab, 0xdb, 0x5e, 0xab, 0x4c, 0x5e, 0xab, 0x47, 0x5e, 0xab, 0x43, 0x5e, 0xab, 0x3f, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x1c, 0x1e, 0x84, 0x77, 0x3f, 0x7c, 0xff, 0x1e, 0x84, 0xff, 0x1e, 0x84, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x93, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xab, 0xff, 0x3e, 0xab, 0xf0, 0x5e, 0xab, 0x64, 0x5e, 0xab, 0x4b, 0x5e, 0xab, 0x47, 0x5e, 0xab, 0x43, 0x5e, 0xab, 0x3c, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1f, 0xfe, 0x83, 0x88, 0x1e, 0x84, 0xff, 0xfe, 0x83, 0xff, 0xfe, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xab, 0xff, 0x3e, 0xab, 0xf0, 0x5e, 0xab, 0x70, 0x5e, 0xab, 0x4b, 0x5e, 0xab, 0x48, 0x5e, 0xab, 0x44, 0x5e, 0xab, 0x40, 0x5e, 0xab, 0x3c, 0x5e, 0xab, 0x37, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x23, 0xde, 0x8b, 0x6b, 0xfe, 0x8b, 0xeb, 0xde, 0x8b, 0xff, 0xde, 0x8b, 0xff, 0xbe, 0x93, 0xff, 0xbe, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xab, 0xff, 0x3e, 0xab, 0xd7, 0x5e, 0xab, 0x64, 0x5e, 0xab, 0x4b, 0x5e, 0xab, 0x48, 0x5e, 0xab, 0x47, 0x5e, 0xab, 0x43, 0x5e, 0xab, 0x3f, 0x5e, 0xab, 0x3b, 0x5e, 0xab, 0x34, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x27, 0x7e, 0xa3, 0x34, 0xbe, 0x93, 0x94, 0xbe, 0x93, 0xec, 0xbe, 0x93, 0xff, 0x9e, 0x9b, 0xff, 0x9e, 0x9b, 0xff, 0x7e, 0x9b, 0xff, 0x7e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xff, 0x5e, 0xa3, 0xdf, 0x5e, 0xab, 0x8c, 0x5e, 0xab, 0x4c, 0x5e, 0xab, 0x4b, 0x5e, 0xab, 0x48, 0x5e, 0xab, 0x47, 0x5e, 0xab, 0x43, 0x5e, 0xab, 0x40, 0x5e, 0xab, 0x3c, 0x5e, 0xab, 0x37, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x2c, 0x7e, 0xa3, 0x34, 0x7e, 0x9b, 0x67, 0x9e, 0x9b, 0x94, 0x7e, 0x9b, 0xac, 0x7e, 0xa3, 0xb3, 0x5e, 0xa3, 0xa8, 0x5e, 0xa3, 0x8f, 0x5e, 0xab, 0x63, 0x5e, 0xab, 0x47, 0x5e, 0xab, 0x47, 0x5e, 0xab, 0x47, 0x5e, 0xab, 0x47, 0x5e, 0xab, 0x44, 0x5e, 0xab, 0x43, 0x5e, 0xab, 0x40, 0x5e, 0xab, 0x3c, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x34, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x37, 0x5e, 0xab, 0x3b, 0x5e, 0xab, 0x3c, 0x5e, 0xab, 0x3f, 0x5e, 0xab, 0x40, 0x5e, 0xab, 0x43, 0x5e, 0xab, 0x43, 0x5e, 0xab, 0x43, 0x5e, 0xab, 0x43, 0x5e, 0xab, 0x43, 0x5e, 0xab, 0x40, 0x5e, 0xab, 0x3f, 0x5e, 0xab, 0x3c, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x34, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x34, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x3b, 0x5e, 0xab, 0x3c, 0x5e, 0xab, 0x3c, 0x5e, 0xab, 0x3f, 0x5e, 0xab, 0x3f, 0x5e, 0xab, 0x3f, 0x5e, 0xab, 0x3c, 0x5e, 0xab, 0x3b, 0x5e, 0xab, 0x3b, 0x5e, 0xab, 0x37, 0x5e, 0xab, 0x34, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x34, 0x5e, 0xab, 0x37, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x38, 0x5e, 0xab, 0x37, 0x5e, 0xab, 0x34, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x33, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x30, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x2f, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x2c, 0x5e, 0xab, 0x2b, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x28, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x27, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x24, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x23, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x20, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1f, 0x5e, 0xab, 0x1c, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x1b, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x18, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x17, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x14, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x13, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x10, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0f, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0c, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x0b, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x08, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x07, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x04, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x03, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00, 0x5e, 0xab, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format:  Blue: 5 bit Green: 6 bit, Red: 5 bit, Alpha 8 bit  BUT the 2  color bytes are swapped*/
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0x8b, 0xfe, 0x17, 0x64, 0xbf, 0x5c, 0x5c, 0xdf, 0xa8, 0x5c, 0xdf, 0xdb, 0x5c, 0xbf, 0xf4, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xf8, 0x6c, 0x9f, 0xd3, 0x6c, 0x7f, 0x93, 0x7c, 0x3e, 0x48, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xa3, 0x7e, 0x0f, 0x5c, 0xdf, 0x68, 0x5c, 0xff, 0xe3, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x5f, 0xc3, 0x83, 0xfe, 0x48, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0x7c, 0x5e, 0x1c, 0x54, 0xff, 0xbc, 0x5c, 0xff, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x7c, 0x3f, 0xfc, 0x84, 0x1e, 0x88, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0x7c, 0x3e, 0x1c, 0x54, 0xff, 0xd3, 0x5c, 0xff, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x1f, 0xff, 0x83, 0xfe, 0x97, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xa3, 0x7e, 0x0f, 0x54, 0xff, 0xbb, 0x54, 0xff, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x1f, 0xff, 0x84, 0x1e, 0xff, 0x83, 0xfe, 0xff, 0x8b, 0xde, 0x7c, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0x5c, 0xdf, 0x64, 0x54, 0xff, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x1f, 0xff, 0x84, 0x1e, 0xff, 0x83, 0xfe, 0xff, 0x8b, 0xfe, 0xff, 0x8b, 0xde, 0xf4, 0x9b, 0x9e, 0x43, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0x93, 0xde, 0x14, 0x5c, 0xff, 0xe0, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x74, 0xbf, 0xff, 0x9d, 0x9f, 0xff, 0xad, 0xbf, 0xff, 0x95, 0x3f, 0xff, 0x7c, 0x5f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x1f, 0xff, 0x84, 0x1e, 0xff, 0x83, 0xfe, 0xff, 0x8b, 0xfe, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x93, 0xbe, 0xab, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0f, 0x64, 0xbf, 0x5f, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0xb6, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7f, 0xff, 0x9c, 0xdf, 0xff, 0x84, 0x1e, 0xff, 0x83, 0xfe, 0xff, 0x8b, 0xfe, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xf7, 0xa3, 0x7e, 0x3c, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0x5c, 0xdf, 0xa8, 0x5c, 0xdf, 0xff, 0x5c, 0xdf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0xbe, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x9c, 0x9f, 0xff, 0x8b, 0xfe, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x7e, 0x74, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x10, 0x5c, 0xdf, 0xd8, 0x5c, 0xdf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xbf, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xa0, 0xab, 0x5e, 0x37, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0x5c, 0xdf, 0xf4, 0x64, 0xbf, 0xff, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xfe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0xa3, 0x7e, 0xb8, 0xab, 0x5e, 0x3b, 0xab, 0x5e, 0x37, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x13, 0x64, 0xbf, 0xfc, 0x64, 0xbf, 0xff, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0xbe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0x1e, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xbc, 0xab, 0x5e, 0x3c, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x34, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0x64, 0xbf, 0xec, 0x64, 0x9f, 0xff, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0xad, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x93, 0xbe, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xb3, 0xab, 0x5e, 0x3f, 0xab, 0x5e, 0x3b, 0xab, 0x5e, 0x37, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x14, 0x6c, 0x9f, 0xc8, 0x6c, 0x9f, 0xff, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x84, 0x9f, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x3f, 0xff, 0x93, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0x98, 0xab, 0x5e, 0x40, 0xab, 0x5e, 0x3c, 0xab, 0x5e, 0x37, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x14, 0x6c, 0x7f, 0x90, 0x6c, 0x7f, 0xff, 0x6c, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0xad, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x5f, 0xff, 0x9b, 0xfe, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xab, 0x5e, 0x6b, 0xab, 0x5e, 0x43, 0xab, 0x5e, 0x3c, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x14, 0x7c, 0x3e, 0x40, 0x6c, 0x7f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x74, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x1f, 0xff, 0x84, 0x1e, 0xff, 0xad, 0x3f, 0xff, 0xef, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0x7f, 0xff, 0x9b, 0xfe, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xab, 0x5e, 0xe3, 0xab, 0x5e, 0x47, 0xab, 0x5e, 0x43, 0xab, 0x5e, 0x3f, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x34, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x18, 0x74, 0x5f, 0xb4, 0x74, 0x5f, 0xff, 0x74, 0x5f, 0xff, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x84, 0x1e, 0xff, 0x83, 0xfe, 0xff, 0x83, 0xfe, 0xff, 0x8b, 0xde, 0xff, 0x9c, 0x5e, 0xff, 0xa4, 0x9f, 0xff, 0x9b, 0xfe, 0xff, 0x93, 0xbe, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xab, 0x5e, 0xff, 0xab, 0x5e, 0x90, 0xab, 0x5e, 0x47, 0xab, 0x5e, 0x43, 0xab, 0x5e, 0x3f, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x34, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x18, 0x8b, 0xfe, 0x3f, 0x74, 0x5f, 0xf8, 0x7c, 0x3f, 0xff, 0x7c, 0x3f, 0xff, 0x84, 0x1e, 0xff, 0x84, 0x1e, 0xff, 0x83, 0xfe, 0xff, 0x8b, 0xfe, 0xff, 0x8b, 0xde, 0xff, 0x93, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xab, 0x5e, 0xff, 0xab, 0x3e, 0xdb, 0xab, 0x5e, 0x4c, 0xab, 0x5e, 0x47, 0xab, 0x5e, 0x43, 0xab, 0x5e, 0x3f, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x1c, 0x84, 0x1e, 0x77, 0x7c, 0x3f, 0xff, 0x84, 0x1e, 0xff, 0x84, 0x1e, 0xff, 0x83, 0xfe, 0xff, 0x8b, 0xfe, 0xff, 0x8b, 0xde, 0xff, 0x93, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xab, 0x5e, 0xff, 0xab, 0x3e, 0xf0, 0xab, 0x5e, 0x64, 0xab, 0x5e, 0x4b, 0xab, 0x5e, 0x47, 0xab, 0x5e, 0x43, 0xab, 0x5e, 0x3c, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1f, 0x83, 0xfe, 0x88, 0x84, 0x1e, 0xff, 0x83, 0xfe, 0xff, 0x8b, 0xfe, 0xff, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xab, 0x5e, 0xff, 0xab, 0x3e, 0xf0, 0xab, 0x5e, 0x70, 0xab, 0x5e, 0x4b, 0xab, 0x5e, 0x48, 0xab, 0x5e, 0x44, 0xab, 0x5e, 0x40, 0xab, 0x5e, 0x3c, 0xab, 0x5e, 0x37, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x23, 0x8b, 0xde, 0x6b, 0x8b, 0xfe, 0xeb, 0x8b, 0xde, 0xff, 0x8b, 0xde, 0xff, 0x93, 0xbe, 0xff, 0x93, 0xbe, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xab, 0x5e, 0xff, 0xab, 0x3e, 0xd7, 0xab, 0x5e, 0x64, 0xab, 0x5e, 0x4b, 0xab, 0x5e, 0x48, 0xab, 0x5e, 0x47, 0xab, 0x5e, 0x43, 0xab, 0x5e, 0x3f, 0xab, 0x5e, 0x3b, 0xab, 0x5e, 0x34, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x27, 0xa3, 0x7e, 0x34, 0x93, 0xbe, 0x94, 0x93, 0xbe, 0xec, 0x93, 0xbe, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x9e, 0xff, 0x9b, 0x7e, 0xff, 0xa3, 0x7e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xff, 0xa3, 0x5e, 0xdf, 0xab, 0x5e, 0x8c, 0xab, 0x5e, 0x4c, 0xab, 0x5e, 0x4b, 0xab, 0x5e, 0x48, 0xab, 0x5e, 0x47, 0xab, 0x5e, 0x43, 0xab, 0x5e, 0x40, 0xab, 0x5e, 0x3c, 0xab, 0x5e, 0x37, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x2c, 0xa3, 0x7e, 0x34, 0x9b, 0x7e, 0x67, 0x9b, 0x9e, 0x94, 0x9b, 0x7e, 0xac, 0xa3, 0x7e, 0xb3, 0xa3, 0x5e, 0xa8, 0xa3, 0x5e, 0x8f, 0xab, 0x5e, 0x63, 0xab, 0x5e, 0x47, 0xab, 0x5e, 0x47, 0xab, 0x5e, 0x47, 0xab, 0x5e, 0x47, 0xab, 0x5e, 0x44, 0xab, 0x5e, 0x43, 0xab, 0x5e, 0x40, 0xab, 0x5e, 0x3c, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x34, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x37, 0xab, 0x5e, 0x3b, 0xab, 0x5e, 0x3c, 0xab, 0x5e, 0x3f, 0xab, 0x5e, 0x40, 0xab, 0x5e, 0x43, 0xab, 0x5e, 0x43, 0xab, 0x5e, 0x43, 0xab, 0x5e, 0x43, 0xab, 0x5e, 0x43, 0xab, 0x5e, 0x40, 0xab, 0x5e, 0x3f, 0xab, 0x5e, 0x3c, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x34, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x34, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x3b, 0xab, 0x5e, 0x3c, 0xab, 0x5e, 0x3c, 0xab, 0x5e, 0x3f, 0xab, 0x5e, 0x3f, 0xab, 0x5e, 0x3f, 0xab, 0x5e, 0x3c, 0xab, 0x5e, 0x3b, 0xab, 0x5e, 0x3b, 0xab, 0x5e, 0x37, 0xab, 0x5e, 0x34, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x34, 0xab, 0x5e, 0x37, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x38, 0xab, 0x5e, 0x37, 0xab, 0x5e, 0x34, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x33, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x30, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x2f, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x2c, 0xab, 0x5e, 0x2b, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x28, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x27, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x24, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x23, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x20, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1f, 0xab, 0x5e, 0x1c, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x1b, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x18, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x17, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x14, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x13, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x10, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0f, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0c, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x0b, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x08, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x07, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x04, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x03, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00, 0xab, 0x5e, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 32
-  /*Pixel format:  Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha: 8 bit*/
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf3, 0x7b, 0x88, 0x17, 0xf7, 0x95, 0x5e, 0x5c, 0xf8, 0x97, 0x5a, 0xa8, 0xf7, 0x97, 0x5b, 0xdb, 0xf7, 0x96, 0x5c, 0xf4, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x93, 0x62, 0xf8, 0xf7, 0x90, 0x66, 0xd3, 0xf6, 0x8c, 0x6c, 0x93, 0xf4, 0x84, 0x7a, 0x48, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf1, 0x6d, 0x9f, 0x0f, 0xf7, 0x97, 0x5b, 0x68, 0xf8, 0x9b, 0x56, 0xe3, 0xf8, 0x99, 0x57, 0xff, 0xf8, 0x98, 0x5a, 0xff, 0xf7, 0x96, 0x5c, 0xff, 0xf7, 0x94, 0x5f, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf6, 0x8f, 0x67, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x88, 0x72, 0xc3, 0xf3, 0x7e, 0x83, 0x48, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf4, 0x87, 0x76, 0x1c, 0xf8, 0x9b, 0x54, 0xbc, 0xf8, 0x9b, 0x55, 0xff, 0xf8, 0x99, 0x57, 0xff, 0xf8, 0x98, 0x59, 0xff, 0xf7, 0x96, 0x5c, 0xff, 0xf7, 0x95, 0x5f, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf6, 0x8f, 0x67, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x89, 0x70, 0xff, 0xf5, 0x87, 0x73, 0xff, 0xf5, 0x85, 0x76, 0xfc, 0xf4, 0x80, 0x7f, 0x88, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf4, 0x86, 0x77, 0x1c, 0xf8, 0x9b, 0x53, 0xd3, 0xf8, 0x9b, 0x55, 0xff, 0xf8, 0x9a, 0x57, 0xff, 0xf8, 0x98, 0x59, 0xff, 0xf7, 0x96, 0x5c, 0xff, 0xf7, 0x95, 0x5e, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf6, 0x8f, 0x67, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x89, 0x70, 0xff, 0xf5, 0x87, 0x73, 0xff, 0xf5, 0x85, 0x76, 0xff, 0xf5, 0x83, 0x79, 0xff, 0xf5, 0x81, 0x7c, 0xff, 0xf4, 0x7d, 0x83, 0x97, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf1, 0x6d, 0x9f, 0x0f, 0xf8, 0x9c, 0x54, 0xbb, 0xf8, 0x9b, 0x54, 0xff, 0xf8, 0x9a, 0x57, 0xff, 0xf8, 0x98, 0x59, 0xff, 0xf7, 0x96, 0x5c, 0xff, 0xf7, 0x95, 0x5e, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf6, 0x8f, 0x67, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8b, 0x6d, 0xff, 0xf6, 0x89, 0x70, 0xff, 0xf5, 0x87, 0x73, 0xff, 0xf5, 0x85, 0x76, 0xff, 0xf5, 0x83, 0x79, 0xff, 0xf5, 0x81, 0x7c, 0xff, 0xf4, 0x7f, 0x7f, 0xff, 0xf4, 0x7d, 0x82, 0xff, 0xf3, 0x78, 0x8b, 0x7c, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf7, 0x98, 0x5a, 0x64, 0xf8, 0x9b, 0x54, 0xff, 0xf8, 0x9a, 0x57, 0xff, 0xf8, 0x98, 0x59, 0xff, 0xf7, 0x96, 0x5c, 0xff, 0xf7, 0x95, 0x5e, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf6, 0x8f, 0x67, 0xff, 0xf6, 0x8d, 0x6a, 0xff, 0xf6, 0x8b, 0x6c, 0xff, 0xf6, 0x8a, 0x70, 0xff, 0xf5, 0x88, 0x73, 0xff, 0xf5, 0x86, 0x76, 0xff, 0xf5, 0x84, 0x79, 0xff, 0xf5, 0x82, 0x7c, 0xff, 0xf4, 0x7f, 0x7f, 0xff, 0xf4, 0x7d, 0x82, 0xff, 0xf4, 0x7b, 0x85, 0xff, 0xf3, 0x79, 0x88, 0xf4, 0xf1, 0x70, 0x9a, 0x43, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf2, 0x79, 0x8d, 0x14, 0xf8, 0x9b, 0x55, 0xe0, 0xf8, 0x9a, 0x57, 0xff, 0xf8, 0x98, 0x59, 0xff, 0xf7, 0x97, 0x5b, 0xff, 0xf7, 0x95, 0x5e, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x91, 0x64, 0xff, 0xf6, 0x8f, 0x66, 0xff, 0xf7, 0x95, 0x74, 0xff, 0xf9, 0xb0, 0x9a, 0xff, 0xf9, 0xb6, 0xa5, 0xff, 0xf7, 0xa3, 0x92, 0xff, 0xf5, 0x87, 0x76, 0xff, 0xf5, 0x84, 0x79, 0xff, 0xf5, 0x82, 0x7c, 0xff, 0xf4, 0x80, 0x7f, 0xff, 0xf4, 0x7e, 0x82, 0xff, 0xf4, 0x7c, 0x85, 0xff, 0xf4, 0x7a, 0x88, 0xff, 0xf3, 0x78, 0x8b, 0xff, 0xf3, 0x75, 0x91, 0xab, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0f, 0xf7, 0x95, 0x5e, 0x5f, 0xf8, 0x9a, 0x56, 0xff, 0xf8, 0x98, 0x59, 0xff, 0xf7, 0x97, 0x5b, 0xff, 0xf7, 0x95, 0x5e, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x91, 0x63, 0xff, 0xf6, 0x8f, 0x67, 0xff, 0xfa, 0xc5, 0xb2, 0xff, 0xff, 0xfb, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xeb, 0xe9, 0xff, 0xf7, 0x9a, 0x95, 0xff, 0xf4, 0x80, 0x7f, 0xff, 0xf4, 0x7e, 0x82, 0xff, 0xf4, 0x7c, 0x85, 0xff, 0xf4, 0x7a, 0x88, 0xff, 0xf3, 0x78, 0x8b, 0xff, 0xf3, 0x76, 0x8e, 0xff, 0xf3, 0x74, 0x91, 0xf7, 0xf1, 0x6c, 0xa1, 0x3c, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf8, 0x98, 0x59, 0xa8, 0xf8, 0x98, 0x59, 0xff, 0xf7, 0x97, 0x5b, 0xff, 0xf7, 0x95, 0x5e, 0xff, 0xf7, 0x93, 0x61, 0xff, 0xf7, 0x91, 0x63, 0xff, 0xf6, 0x90, 0x66, 0xff, 0xfb, 0xc8, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf8, 0xf7, 0xff, 0xf6, 0x91, 0x95, 0xff, 0xf4, 0x7c, 0x85, 0xff, 0xf4, 0x7a, 0x88, 0xff, 0xf3, 0x78, 0x8b, 0xff, 0xf3, 0x76, 0x8e, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf3, 0x72, 0x94, 0xff, 0xf1, 0x6e, 0x9b, 0x74, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x10, 0xf8, 0x97, 0x5a, 0xd8, 0xf7, 0x97, 0x5b, 0xff, 0xf7, 0x95, 0x5e, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x91, 0x63, 0xff, 0xf6, 0x90, 0x66, 0xff, 0xf7, 0x9c, 0x7b, 0xff, 0xff, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xd4, 0xd7, 0xff, 0xf4, 0x7a, 0x88, 0xff, 0xf3, 0x78, 0x8b, 0xff, 0xf3, 0x76, 0x8e, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf3, 0x72, 0x94, 0xff, 0xf2, 0x70, 0x96, 0xff, 0xf2, 0x6d, 0x9b, 0xa0, 0xf0, 0x6a, 0xa5, 0x37, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf7, 0x97, 0x5b, 0xf4, 0xf7, 0x95, 0x5e, 0xff, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x92, 0x63, 0xff, 0xf6, 0x90, 0x66, 0xff, 0xf6, 0x8e, 0x69, 0xff, 0xfa, 0xbb, 0xa9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xf3, 0x7b, 0x8d, 0xff, 0xf3, 0x76, 0x8e, 0xff, 0xf3, 0x74, 0x91, 0xff, 0xf3, 0x72, 0x93, 0xff, 0xf2, 0x70, 0x96, 0xff, 0xf2, 0x6f, 0x99, 0xff, 0xf2, 0x6d, 0x9d, 0xb8, 0xf0, 0x6a, 0xa5, 0x3b, 0xf0, 0x6a, 0xa5, 0x37, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x13, 0xf7, 0x95, 0x5e, 0xfc, 0xf7, 0x93, 0x60, 0xff, 0xf7, 0x92, 0x63, 0xff, 0xf6, 0x90, 0x66, 0xff, 0xf6, 0x8e, 0x69, 0xff, 0xf6, 0x8c, 0x6c, 0xff, 0xfb, 0xc5, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x80, 0x95, 0xff, 0xf3, 0x74, 0x90, 0xff, 0xf3, 0x72, 0x93, 0xff, 0xf2, 0x70, 0x96, 0xff, 0xf2, 0x6f, 0x99, 0xff, 0xf2, 0x6d, 0x9c, 0xff, 0xf2, 0x6b, 0x9f, 0xbc, 0xf0, 0x6a, 0xa5, 0x3c, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x34, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf7, 0x94, 0x61, 0xec, 0xf7, 0x92, 0x63, 0xff, 0xf6, 0x90, 0x66, 0xff, 0xf6, 0x8e, 0x69, 0xff, 0xf6, 0x8c, 0x6c, 0xff, 0xf6, 0x8a, 0x6f, 0xff, 0xf9, 0xb4, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf6, 0xf8, 0xff, 0xf3, 0x75, 0x91, 0xff, 0xf3, 0x72, 0x93, 0xff, 0xf2, 0x71, 0x96, 0xff, 0xf2, 0x6f, 0x99, 0xff, 0xf2, 0x6d, 0x9c, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf1, 0x6a, 0xa2, 0xb3, 0xf0, 0x6a, 0xa5, 0x3f, 0xf0, 0x6a, 0xa5, 0x3b, 0xf0, 0x6a, 0xa5, 0x37, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x14, 0xf7, 0x91, 0x65, 0xc8, 0xf6, 0x90, 0x66, 0xff, 0xf6, 0x8e, 0x68, 0xff, 0xf6, 0x8c, 0x6b, 0xff, 0xf6, 0x8a, 0x6e, 0xff, 0xf5, 0x88, 0x71, 0xff, 0xf6, 0x8f, 0x7f, 0xff, 0xfe, 0xf8, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xc5, 0xd0, 0xff, 0xf3, 0x72, 0x93, 0xff, 0xf2, 0x71, 0x96, 0xff, 0xf2, 0x6f, 0x99, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf1, 0x6a, 0xa1, 0xff, 0xf1, 0x69, 0xa4, 0x98, 0xf0, 0x6a, 0xa5, 0x40, 0xf0, 0x6a, 0xa5, 0x3c, 0xf0, 0x6a, 0xa5, 0x37, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x14, 0xf6, 0x8d, 0x6a, 0x90, 0xf6, 0x8e, 0x68, 0xff, 0xf6, 0x8c, 0x6b, 0xff, 0xf6, 0x8a, 0x6e, 0xff, 0xf5, 0x88, 0x71, 0xff, 0xf5, 0x86, 0x74, 0xff, 0xf5, 0x84, 0x77, 0xff, 0xf9, 0xae, 0xaa, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xea, 0xee, 0xff, 0xf4, 0x7d, 0x9b, 0xff, 0xf2, 0x71, 0x96, 0xff, 0xf2, 0x6f, 0x99, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf1, 0x6a, 0xa0, 0xff, 0xf1, 0x68, 0xa3, 0xff, 0xf0, 0x69, 0xa5, 0x6b, 0xf0, 0x6a, 0xa5, 0x43, 0xf0, 0x6a, 0xa5, 0x3c, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x14, 0xf4, 0x83, 0x7b, 0x40, 0xf6, 0x8c, 0x6b, 0xff, 0xf6, 0x8a, 0x6e, 0xff, 0xf5, 0x88, 0x71, 0xff, 0xf5, 0x86, 0x74, 0xff, 0xf5, 0x84, 0x77, 0xff, 0xf5, 0x82, 0x7a, 0xff, 0xf4, 0x80, 0x7e, 0xff, 0xf7, 0xa3, 0xa6, 0xff, 0xfd, 0xe9, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xfb, 0xcd, 0xd7, 0xff, 0xf4, 0x7e, 0x9b, 0xff, 0xf2, 0x71, 0x96, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6b, 0x9e, 0xff, 0xf1, 0x6a, 0xa0, 0xff, 0xf1, 0x68, 0xa3, 0xff, 0xf1, 0x67, 0xa5, 0xe3, 0xf0, 0x6a, 0xa5, 0x47, 0xf0, 0x6a, 0xa5, 0x43, 0xf0, 0x6a, 0xa5, 0x3f, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x34, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x18, 0xf6, 0x89, 0x71, 0xb4, 0xf5, 0x89, 0x71, 0xff, 0xf5, 0x87, 0x74, 0xff, 0xf5, 0x85, 0x77, 0xff, 0xf5, 0x83, 0x7a, 0xff, 0xf4, 0x81, 0x7d, 0xff, 0xf4, 0x7e, 0x81, 0xff, 0xf4, 0x7c, 0x84, 0xff, 0xf4, 0x7a, 0x87, 0xff, 0xf4, 0x87, 0x97, 0xff, 0xf5, 0x8f, 0xa1, 0xff, 0xf4, 0x7b, 0x95, 0xff, 0xf3, 0x73, 0x93, 0xff, 0xf2, 0x71, 0x96, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6c, 0x9e, 0xff, 0xf1, 0x6a, 0xa0, 0xff, 0xf1, 0x68, 0xa3, 0xff, 0xf1, 0x67, 0xa5, 0xff, 0xf1, 0x67, 0xa6, 0x90, 0xf0, 0x6a, 0xa5, 0x47, 0xf0, 0x6a, 0xa5, 0x43, 0xf0, 0x6a, 0xa5, 0x3f, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x34, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x18, 0xf4, 0x7d, 0x85, 0x3f, 0xf5, 0x87, 0x74, 0xf8, 0xf5, 0x85, 0x77, 0xff, 0xf5, 0x83, 0x7a, 0xff, 0xf4, 0x81, 0x7d, 0xff, 0xf4, 0x7f, 0x80, 0xff, 0xf4, 0x7d, 0x83, 0xff, 0xf4, 0x7b, 0x87, 0xff, 0xf3, 0x79, 0x8a, 0xff, 0xf3, 0x77, 0x8d, 0xff, 0xf3, 0x75, 0x90, 0xff, 0xf3, 0x73, 0x93, 0xff, 0xf2, 0x71, 0x95, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6c, 0x9e, 0xff, 0xf1, 0x6a, 0xa0, 0xff, 0xf1, 0x68, 0xa2, 0xff, 0xf1, 0x67, 0xa5, 0xff, 0xf1, 0x65, 0xa7, 0xdb, 0xf0, 0x6a, 0xa5, 0x4c, 0xf0, 0x6a, 0xa5, 0x47, 0xf0, 0x6a, 0xa5, 0x43, 0xf0, 0x6a, 0xa5, 0x3f, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x1c, 0xf4, 0x81, 0x7e, 0x77, 0xf5, 0x83, 0x7a, 0xff, 0xf4, 0x81, 0x7d, 0xff, 0xf4, 0x7f, 0x80, 0xff, 0xf4, 0x7d, 0x83, 0xff, 0xf4, 0x7b, 0x86, 0xff, 0xf3, 0x79, 0x89, 0xff, 0xf3, 0x77, 0x8d, 0xff, 0xf3, 0x75, 0x8f, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf2, 0x71, 0x95, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6d, 0x9b, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf1, 0x6a, 0xa0, 0xff, 0xf1, 0x68, 0xa2, 0xff, 0xf1, 0x67, 0xa5, 0xff, 0xf1, 0x66, 0xa7, 0xf0, 0xf0, 0x68, 0xa6, 0x64, 0xf0, 0x6a, 0xa5, 0x4b, 0xf0, 0x6a, 0xa5, 0x47, 0xf0, 0x6a, 0xa5, 0x43, 0xf0, 0x6a, 0xa5, 0x3c, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1f, 0xf3, 0x7e, 0x83, 0x88, 0xf4, 0x7f, 0x80, 0xff, 0xf4, 0x7d, 0x83, 0xff, 0xf4, 0x7b, 0x86, 0xff, 0xf3, 0x79, 0x89, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf3, 0x75, 0x8f, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf2, 0x71, 0x95, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6e, 0x9b, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf1, 0x6a, 0xa0, 0xff, 0xf1, 0x69, 0xa2, 0xff, 0xf1, 0x67, 0xa5, 0xff, 0xf1, 0x66, 0xa7, 0xf0, 0xf0, 0x67, 0xa7, 0x70, 0xf0, 0x6a, 0xa5, 0x4b, 0xf0, 0x6a, 0xa5, 0x48, 0xf0, 0x6a, 0xa5, 0x44, 0xf0, 0x6a, 0xa5, 0x40, 0xf0, 0x6a, 0xa5, 0x3c, 0xf0, 0x6a, 0xa5, 0x37, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x23, 0xf3, 0x78, 0x8c, 0x6b, 0xf4, 0x7b, 0x86, 0xeb, 0xf3, 0x79, 0x89, 0xff, 0xf3, 0x77, 0x8c, 0xff, 0xf3, 0x75, 0x8f, 0xff, 0xf3, 0x73, 0x92, 0xff, 0xf2, 0x71, 0x95, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6e, 0x9b, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf1, 0x6a, 0xa0, 0xff, 0xf1, 0x69, 0xa2, 0xff, 0xf1, 0x67, 0xa5, 0xff, 0xf1, 0x66, 0xa7, 0xd7, 0xf0, 0x68, 0xa6, 0x64, 0xf0, 0x6a, 0xa5, 0x4b, 0xf0, 0x6a, 0xa5, 0x48, 0xf0, 0x6a, 0xa5, 0x47, 0xf0, 0x6a, 0xa5, 0x43, 0xf0, 0x6a, 0xa5, 0x3f, 0xf0, 0x6a, 0xa5, 0x3b, 0xf0, 0x6a, 0xa5, 0x34, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x27, 0xf1, 0x6d, 0x9f, 0x34, 0xf3, 0x75, 0x90, 0x94, 0xf3, 0x75, 0x8f, 0xec, 0xf3, 0x73, 0x92, 0xff, 0xf2, 0x71, 0x95, 0xff, 0xf2, 0x6f, 0x98, 0xff, 0xf2, 0x6e, 0x9a, 0xff, 0xf2, 0x6c, 0x9d, 0xff, 0xf1, 0x6a, 0xa0, 0xff, 0xf1, 0x69, 0xa2, 0xff, 0xf1, 0x67, 0xa4, 0xdf, 0xf1, 0x67, 0xa6, 0x8c, 0xf0, 0x6a, 0xa5, 0x4c, 0xf0, 0x6a, 0xa5, 0x4b, 0xf0, 0x6a, 0xa5, 0x48, 0xf0, 0x6a, 0xa5, 0x47, 0xf0, 0x6a, 0xa5, 0x43, 0xf0, 0x6a, 0xa5, 0x40, 0xf0, 0x6a, 0xa5, 0x3c, 0xf0, 0x6a, 0xa5, 0x37, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6b, 0xa3, 0x34, 0xf1, 0x6e, 0x9b, 0x67, 0xf2, 0x6f, 0x9b, 0x94, 0xf2, 0x6d, 0x9c, 0xac, 0xf2, 0x6c, 0x9e, 0xb3, 0xf1, 0x6a, 0xa1, 0xa8, 0xf1, 0x69, 0xa3, 0x8f, 0xf0, 0x69, 0xa5, 0x63, 0xf0, 0x6a, 0xa5, 0x47, 0xf0, 0x6a, 0xa5, 0x47, 0xf0, 0x6a, 0xa5, 0x47, 0xf0, 0x6a, 0xa5, 0x47, 0xf0, 0x6a, 0xa5, 0x44, 0xf0, 0x6a, 0xa5, 0x43, 0xf0, 0x6a, 0xa5, 0x40, 0xf0, 0x6a, 0xa5, 0x3c, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x34, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x37, 0xf0, 0x6a, 0xa5, 0x3b, 0xf0, 0x6a, 0xa5, 0x3c, 0xf0, 0x6a, 0xa5, 0x3f, 0xf0, 0x6a, 0xa5, 0x40, 0xf0, 0x6a, 0xa5, 0x43, 0xf0, 0x6a, 0xa5, 0x43, 0xf0, 0x6a, 0xa5, 0x43, 0xf0, 0x6a, 0xa5, 0x43, 0xf0, 0x6a, 0xa5, 0x43, 0xf0, 0x6a, 0xa5, 0x40, 0xf0, 0x6a, 0xa5, 0x3f, 0xf0, 0x6a, 0xa5, 0x3c, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x34, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x34, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x3b, 0xf0, 0x6a, 0xa5, 0x3c, 0xf0, 0x6a, 0xa5, 0x3c, 0xf0, 0x6a, 0xa5, 0x3f, 0xf0, 0x6a, 0xa5, 0x3f, 0xf0, 0x6a, 0xa5, 0x3f, 0xf0, 0x6a, 0xa5, 0x3c, 0xf0, 0x6a, 0xa5, 0x3b, 0xf0, 0x6a, 0xa5, 0x3b, 0xf0, 0x6a, 0xa5, 0x37, 0xf0, 0x6a, 0xa5, 0x34, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x34, 0xf0, 0x6a, 0xa5, 0x37, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x38, 0xf0, 0x6a, 0xa5, 0x37, 0xf0, 0x6a, 0xa5, 0x34, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x33, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x30, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x2f, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x2c, 0xf0, 0x6a, 0xa5, 0x2b, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x28, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x27, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x24, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x23, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x20, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1f, 0xf0, 0x6a, 0xa5, 0x1c, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x1b, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x18, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x17, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x14, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x13, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x10, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0f, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0c, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x0b, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x08, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x07, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x04, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x03, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00, 0xf0, 0x6a, 0xa5, 0x00,
-#endif
-};
-
-const lv_img_dsc_t img_lv_demo_music_slider_knob = {
-  .header.always_zero = 0,
-  .header.w = 66,
-  .header.h = 66,
-  .data_size = 4356 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .data = img_lv_demo_music_slider_knob_map,
-};
-
-#endif
@@ -1,261 +0,0 @@
-#include "../../../lvgl.h"
-
-#if LV_USE_DEMO_WIDGETS
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMG_CLOTHES
-#define LV_ATTRIBUTE_IMG_IMG_CLOTHES
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMG_CLOTHES uint8_t img_clothes_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Blue: 2 bit, Green: 3 bit, Red: 3 bit, Alpha 8 bit */
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x07, 0xff, 0x50, 0xff, 0x9b, 0xff, 0xd0, 0xff, 0xe8, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xd7, 0xef, 0xd2, 0xef, 0x8d, 0xef, 0x8d, 0xef, 0xd6, 0xef, 0xfb, 0xef, 0xff, 0xef, 0xff, 0xef, 0xfb, 0xef, 0xfb, 0xef, 0xff, 0xef, 0xff, 0xef, 0xfb, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xef, 0xff, 0xe3, 0xff, 0xc8, 0xff, 0x9b, 0xff, 0x4f, 0xff, 0x07, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x50, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xd2, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x53, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xad, 0xff, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x88, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x88, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x54, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf6, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xad, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0xff, 0x00,
-  0xff, 0x07, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xd6, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xad, 0xff, 0x8d, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0x07,
-  0xff, 0x54, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0x8d, 0xff, 0x64, 0xff, 0xd6, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xd1, 0xff, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c,
-  0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x49, 0xff, 0x45, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xd6, 0xff, 0x69, 0xff, 0x69, 0xff, 0xd6, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xd1, 0xff, 0xd1, 0xff, 0xfa, 0xff, 0xb2, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xac,
-  0xff, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0x25, 0xff, 0x01, 0xff, 0x25, 0xff, 0xd2, 0xff, 0xf6, 0xff, 0xb1, 0xff, 0x44, 0xff, 0x44, 0xff, 0xd6, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xd6, 0xff, 0xf6, 0xff, 0xfe, 0xff, 0xb6, 0xff, 0x01, 0xff, 0x25, 0xff, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x4e, 0xff, 0x25, 0xff, 0x05, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x20, 0xff, 0x44, 0xff, 0x20, 0xff, 0x64, 0xff, 0xd1, 0xff, 0xd2, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0x49, 0xff, 0x05, 0xff, 0x05, 0xff, 0x01, 0xff, 0x49, 0xff, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x05, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x00, 0xff, 0x00, 0xff, 0x64, 0xff, 0xd1, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfb, 0xff, 0x6e, 0xff, 0x05, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x01, 0xff, 0x49, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0x05, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xd6, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xb2, 0xff, 0x49, 0xff, 0x05, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x01, 0xff, 0x25, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x25, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x29, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x29, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x4e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x4a, 0xff, 0x4e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x29, 0xff, 0x4a, 0xff, 0x29, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0xff, 0x25, 0xff, 0x25, 0xff, 0x01, 0xff, 0x25, 0xff, 0x29, 0xff, 0x29, 0xff, 0x25, 0xff, 0x6e, 0xff, 0x93, 0xff, 0x72, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0x72, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x29, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x29, 0xff, 0x25, 0xff, 0x4a, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4a, 0xff, 0x29, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x01, 0xff, 0x05, 0xff, 0x25, 0xff, 0x05, 0xff, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x4e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x00, 0xff, 0x05, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x29, 0xff, 0x4a, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x49, 0xff, 0x4a, 0xff, 0x49, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x01, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xff, 0x05, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x01, 0xff, 0x25, 0xff, 0x29, 0xff, 0x4e, 0xff, 0x25, 0xff, 0x25, 0xff, 0x49, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6d, 0xff, 0x4a, 0xff, 0x29, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x01, 0xff, 0x05, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xff, 0x6d, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x01, 0xff, 0x00, 0xff, 0x25, 0xff, 0x25, 0xff, 0x4a, 0xff, 0x29, 0xff, 0x25, 0xff, 0x4e, 0xff, 0x4a, 0xff, 0x49, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x29, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x01, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xd6, 0xff, 0xb2, 0xff, 0xb2, 0xff, 0x45, 0xff, 0x25, 0xff, 0x25, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0x29, 0xff, 0x4a, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x29, 0xff, 0x4a, 0xff, 0x25, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x29, 0xff, 0x49, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x01, 0xff, 0x05, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x01, 0xff, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0x45, 0xff, 0x25, 0xff, 0x25, 0xff, 0x4a, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x4a, 0xff, 0x29, 0xff, 0x25, 0xff, 0x25, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x49, 0xff, 0x29, 0xff, 0x29, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x29, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x49, 0xff, 0x8d, 0xff, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x49, 0xff, 0x92, 0xff, 0x72, 0xff, 0x4a, 0xff, 0x29, 0xff, 0x25, 0xff, 0x4a, 0xff, 0x4e, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x4e, 0xff, 0x29, 0xff, 0x4a, 0xff, 0x4e, 0xff, 0x29, 0xff, 0x25, 0xff, 0x25, 0xff, 0x49, 0xff, 0x8d, 0xff, 0xd6, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xd2, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x4a, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x29, 0xff, 0x25, 0xff, 0x4a, 0xff, 0x29, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x25, 0xff, 0x05, 0xff, 0x25, 0xff, 0x49, 0xff, 0x8d, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xb1, 0xff, 0x6e, 0xff, 0x25, 0xff, 0x25, 0xff, 0x4a, 0xff, 0x29, 0xff, 0x29, 0xff, 0x4e, 0xff, 0x29, 0xff, 0x25, 0xff, 0x4a, 0xff, 0x29, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x49, 0xff, 0x49, 0xff, 0x29, 0xff, 0x49, 0xff, 0x25, 0xff, 0x01, 0xff, 0x01, 0xff, 0x49, 0xff, 0x8d, 0xff, 0xd6, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xb1, 0xff, 0x6e, 0xff, 0x25, 0xff, 0x25, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x4a, 0xff, 0x29, 0xff, 0x25, 0xff, 0x49, 0xff, 0x4a, 0xff, 0x4a, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x49, 0xff, 0x29, 0xff, 0x25, 0xff, 0x29, 0xff, 0x25, 0xff, 0x01, 0xff, 0x01, 0xff, 0x49, 0xff, 0x8d, 0xff, 0xd1, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xd2, 0xff, 0x6e, 0xff, 0x25, 0xff, 0x25, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x4a, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x29, 0xff, 0x29, 0xff, 0x25, 0xff, 0x25, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x01, 0xff, 0x49, 0xff, 0x8d, 0xff, 0xb1, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xd6, 0xff, 0x6e, 0xff, 0x25, 0xff, 0x25, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x49, 0xff, 0x25, 0xff, 0x05, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x49, 0xff, 0x8e, 0xff, 0xb1, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xd6, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x25, 0xff, 0x05, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x49, 0xff, 0x8e, 0xff, 0xd2, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xd6, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xd6, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x29, 0xff, 0x4e, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x29, 0xff, 0x29, 0xff, 0x25, 0xff, 0x25, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x49, 0xff, 0x92, 0xff, 0xd6, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf6, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x29, 0xff, 0x49, 0xff, 0x29, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x69, 0xff, 0x92, 0xff, 0xd6, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf6, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xd6, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf6, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xd6, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x29, 0xff, 0x25, 0xff, 0x29, 0xff, 0x29, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x8e, 0xff, 0xb2, 0xff, 0xd6, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xd1, 0xff, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf6, 0xff, 0xd6, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x01, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x92, 0xff, 0xb6, 0xff, 0xd2, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xd1, 0xff, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xd2, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x05, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x92, 0xff, 0xb6, 0xff, 0xb2, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xd1, 0xff, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xd1, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x01, 0xff, 0x05, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x92, 0xff, 0xb7, 0xff, 0xb2, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xd1, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xd1, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xad, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x01, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x92, 0xff, 0xd7, 0xff, 0xb2, 0xff, 0xd6, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xd1, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xd1, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0x8d, 0xff, 0x05, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x01, 0xff, 0x01, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x92, 0xff, 0xdb, 0xff, 0xb2, 0xff, 0xd1, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xb1, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0x69, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x00, 0xff, 0x01, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x92, 0xff, 0xdb, 0xff, 0xb6, 0xff, 0xd1, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xd1, 0xff, 0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xff, 0xd1, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0x69, 0xff, 0x25, 0xff, 0x29, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x00, 0xff, 0x01, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6e, 0xff, 0xdb, 0xff, 0xd6, 0xff, 0xd1, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xd1, 0xff, 0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xff, 0xd1, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0x69, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x25, 0xff, 0x6e, 0xff, 0xdb, 0xff, 0xd7, 0xff, 0xd1, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xd1, 0xff, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xd1, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0x69, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x29, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x05, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x6e, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xd1, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xad, 0xff, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0xff, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xd1, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0x69, 0xff, 0x05, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x05, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x49, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xb1, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xad, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xb2, 0xff, 0x05, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x49, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xb2, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xad, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xac,
-  0xff, 0x54, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xfa, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x29, 0xff, 0xd7, 0xff, 0xdb, 0xff, 0xd2, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xad, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c,
-  0xff, 0x07, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0xb7, 0xff, 0xdb, 0xff, 0xd6, 0xff, 0xfb, 0xff, 0xf6, 0xff, 0xad, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0x07,
-  0xff, 0x00, 0xff, 0x54, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x00, 0xff, 0x24, 0xff, 0xb6, 0xff, 0xdb, 0xff, 0xd6, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xad, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x05, 0xff, 0x05, 0xff, 0x05, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x05, 0xff, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xb6, 0xff, 0x92, 0xff, 0x24, 0xff, 0x6d, 0xff, 0x49, 0xff, 0x6d, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0x24, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x20, 0xff, 0x20, 0xff, 0x20, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x92, 0xff, 0xd6, 0xff, 0xb2, 0xff, 0x69, 0xff, 0x00, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x94, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x53, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xff, 0xff, 0x69, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x92, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xd1, 0xff, 0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x54, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x07, 0xff, 0x5b, 0xff, 0xac, 0xff, 0xdf, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xf2, 0xff, 0xff, 0xff, 0x8d, 0xff, 0x00, 0xff, 0x24, 0xff, 0x24, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x20, 0xff, 0x24, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0xb2, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfa, 0xff, 0xf6, 0xff, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xdf, 0xff, 0xac, 0xff, 0x5b, 0xff, 0x07, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Blue: 5 bit, Green: 6 bit, Red: 5 bit, Alpha 8 bit*/
-  0x7e, 0xf7, 0x00, 0x7e, 0xf7, 0x00, 0x7e, 0xf7, 0x00, 0x7e, 0xf7, 0x00, 0x7e, 0xf7, 0x00, 0x9e, 0xf7, 0x07, 0x7e, 0xf7, 0x50, 0x7e, 0xf7, 0x9b, 0x7e, 0xf7, 0xd0, 0x7e, 0xf7, 0xe8, 0x7e, 0xf7, 0xef, 0x7e, 0xf7, 0xef, 0x7e, 0xf7, 0xef, 0x7d, 0xf7, 0xef, 0x7d, 0xf7, 0xef, 0x7d, 0xf7, 0xef, 0x9e, 0xf7, 0xef, 0x7d, 0xef, 0xef, 0x74, 0xc5, 0xef, 0x2d, 0xb4, 0xef, 0xc9, 0x8a, 0xef, 0x2b, 0x8b, 0xef, 0x31, 0xcd, 0xef, 0x55, 0xee, 0xef, 0x3a, 0xff, 0xef, 0x19, 0xff, 0xef, 0x15, 0xe6, 0xef, 0x56, 0xe6, 0xef, 0xd8, 0xfe, 0xef, 0xf8, 0xfe, 0xef, 0x77, 0xee, 0xef, 0x5d, 0xef, 0xef, 0x7d, 0xf7, 0xef, 0x5d, 0xf7, 0xef, 0x5d, 0xf7, 0xef, 0x5d, 0xf7, 0xef, 0x7d, 0xf7, 0xef, 0x7d, 0xef, 0xef, 0x7d, 0xef, 0xef, 0x7d, 0xef, 0xef, 0x7d, 0xef, 0xef, 0x7d, 0xef, 0xef, 0x7d, 0xef, 0xef, 0x7d, 0xef, 0xef, 0x7d, 0xef, 0xef, 0x7d, 0xef, 0xef, 0x7d, 0xef, 0xe3, 0x7d, 0xef, 0xc8, 0x7d, 0xef, 0x9b, 0x5d, 0xef, 0x4f, 0x5d, 0xef, 0x07, 0x5d, 0xef, 0x00, 0x5d, 0xef, 0x00, 0x5d, 0xef, 0x00, 0x5d, 0xef, 0x00, 0x5d, 0xef, 0x00,
-  0x5d, 0xef, 0x00, 0x5d, 0xef, 0x00, 0x5d, 0xf7, 0x00, 0x5d, 0xf7, 0x00, 0x7d, 0xf7, 0x50, 0x7d, 0xf7, 0xdb, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x99, 0xde, 0xff, 0x15, 0xe6, 0xff, 0x35, 0xee, 0xff, 0x0d, 0xbc, 0xff, 0x92, 0xe5, 0xff, 0x19, 0xff, 0xff, 0x19, 0xff, 0xff, 0xb7, 0xfe, 0xff, 0xf3, 0xed, 0xff, 0xb2, 0xe5, 0xff, 0xf8, 0xfe, 0xff, 0xf8, 0xfe, 0xff, 0x90, 0xac, 0xff, 0x3d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xdb, 0x5c, 0xef, 0x53, 0x3c, 0xef, 0x00, 0x3c, 0xef, 0x00, 0x3c, 0xef, 0x00, 0x3c, 0xef, 0x00,
-  0x5d, 0xef, 0x00, 0x7d, 0xf7, 0x00, 0x7d, 0xf7, 0x03, 0x7d, 0xf7, 0x88, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x3c, 0xef, 0xff, 0xfa, 0xfe, 0xff, 0x7b, 0xff, 0xff, 0xd7, 0xfe, 0xff, 0x76, 0xfe, 0xff, 0x19, 0xff, 0xff, 0xd8, 0xfe, 0xff, 0x75, 0xf6, 0xff, 0xf3, 0xed, 0xff, 0x91, 0xdd, 0xff, 0x72, 0xdd, 0xff, 0x4a, 0xa3, 0xff, 0x8b, 0x9b, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x3c, 0xef, 0x88, 0x3c, 0xef, 0x03, 0x3c, 0xef, 0x00, 0x3c, 0xef, 0x00,
-  0x5d, 0xef, 0x00, 0x7d, 0xf7, 0x00, 0x7d, 0xf7, 0x88, 0x7d, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xef, 0xff, 0x7d, 0xef, 0xff, 0x1b, 0xf7, 0xff, 0x1a, 0xff, 0xff, 0x3a, 0xff, 0xff, 0xb7, 0xfe, 0xff, 0xb7, 0xfe, 0xff, 0xb7, 0xfe, 0xff, 0x96, 0xf6, 0xff, 0x75, 0xf6, 0xff, 0x34, 0xee, 0xff, 0xb1, 0xe5, 0xff, 0x0b, 0xb4, 0xff, 0x0b, 0xbc, 0xff, 0xce, 0xcc, 0xff, 0xba, 0xe6, 0xff, 0x5d, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x5c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0x88, 0x3c, 0xef, 0x00, 0x3c, 0xef, 0x00,
-  0x5d, 0xef, 0x00, 0x7d, 0xf7, 0x54, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0x7d, 0xef, 0xff, 0xfa, 0xee, 0xff, 0xb4, 0xdd, 0xff, 0x31, 0xdd, 0xff, 0x96, 0xfe, 0xff, 0xd7, 0xfe, 0xff, 0xd7, 0xfe, 0xff, 0x96, 0xf6, 0xff, 0x55, 0xee, 0xff, 0x55, 0xee, 0xff, 0x91, 0xdd, 0xff, 0x49, 0x9b, 0xff, 0x50, 0xdd, 0xff, 0x70, 0xdd, 0xff, 0xd5, 0xd5, 0xff, 0x5d, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x5c, 0xef, 0xff, 0x3d, 0xef, 0x54, 0x3d, 0xef, 0x00,
-  0x5d, 0xef, 0x07, 0x7d, 0xf7, 0xe3, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x7d, 0xef, 0xff, 0x37, 0xd6, 0xff, 0xcf, 0xcc, 0xff, 0x34, 0xf6, 0xff, 0x55, 0xf6, 0xff, 0xf8, 0xfe, 0xff, 0x76, 0xf6, 0xff, 0x96, 0xf6, 0xff, 0x34, 0xee, 0xff, 0x8a, 0x9b, 0xff, 0x08, 0x8b, 0xff, 0x91, 0xe5, 0xff, 0x90, 0xe5, 0xff, 0xef, 0xcc, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xe4, 0x3d, 0xef, 0x07,
-  0x5d, 0xef, 0x54, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x9d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0xbe, 0xff, 0xff, 0x5d, 0xef, 0xff, 0x50, 0xbc, 0xff, 0x90, 0xdc, 0xff, 0xd2, 0xed, 0xff, 0x54, 0xee, 0xff, 0x75, 0xf6, 0xff, 0x13, 0xe6, 0xff, 0xe8, 0x8a, 0xff, 0x83, 0x59, 0xff, 0xce, 0xc4, 0xff, 0xd1, 0xe5, 0xff, 0x90, 0xe5, 0xff, 0x6c, 0xc4, 0xff, 0x73, 0xcd, 0xff, 0xba, 0xde, 0xff, 0x1c, 0xe7, 0xff, 0x9e, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x3d, 0xef, 0x5c,
-  0x7d, 0xf7, 0x9f, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xef, 0xff, 0xbe, 0xff, 0xff, 0x7e, 0xf7, 0xff, 0xb7, 0xb5, 0xff, 0x2b, 0x42, 0xff, 0x86, 0x39, 0xff, 0x70, 0xdd, 0xff, 0xd6, 0xfe, 0xff, 0x13, 0xee, 0xff, 0x0f, 0xcd, 0xff, 0x46, 0x72, 0xff, 0x05, 0x62, 0xff, 0xce, 0xc4, 0xff, 0xd2, 0xe5, 0xff, 0xf2, 0xe5, 0xff, 0x90, 0xe5, 0xff, 0x8c, 0xcc, 0xff, 0x4b, 0xc4, 0xff, 0xb1, 0xe5, 0xff, 0x90, 0xa4, 0xff, 0x12, 0x84, 0xff, 0xfb, 0xe6, 0xff, 0xbe, 0xff, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xac,
-  0x7d, 0xf7, 0xd0, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0x7e, 0xf7, 0xff, 0xb8, 0xbd, 0xff, 0xce, 0x52, 0xff, 0xc7, 0x10, 0xff, 0x45, 0x00, 0xff, 0xa4, 0x18, 0xff, 0x6d, 0xb4, 0xff, 0x71, 0xd5, 0xff, 0x8b, 0x93, 0xff, 0xc2, 0x38, 0xff, 0xe1, 0x40, 0xff, 0x0f, 0xcd, 0xff, 0x91, 0xdd, 0xff, 0xb1, 0xe5, 0xff, 0xf2, 0xed, 0xff, 0x70, 0xdd, 0xff, 0xed, 0xd4, 0xff, 0xed, 0xd4, 0xff, 0xb4, 0xfe, 0xff, 0xb0, 0xac, 0xff, 0x25, 0x00, 0xff, 0x89, 0x29, 0xff, 0xb4, 0x94, 0xff, 0x3c, 0xef, 0xff, 0xbe, 0xff, 0xff, 0x7d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x3d, 0xef, 0xe0,
-  0x7e, 0xf7, 0xe7, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x9e, 0xff, 0xff, 0x5d, 0xef, 0xff, 0xf5, 0x9c, 0xff, 0xae, 0x4a, 0xff, 0xe8, 0x18, 0xff, 0xc8, 0x10, 0xff, 0x08, 0x19, 0xff, 0x08, 0x19, 0xff, 0x86, 0x08, 0xff, 0x62, 0x18, 0xff, 0xc1, 0x30, 0xff, 0x20, 0x20, 0xff, 0x22, 0x59, 0xff, 0xca, 0xb3, 0xff, 0x8c, 0xc4, 0xff, 0x2f, 0xd5, 0xff, 0x13, 0xee, 0xff, 0xd1, 0xe5, 0xff, 0x90, 0xdd, 0xff, 0xb1, 0xe5, 0xff, 0x12, 0xee, 0xff, 0x94, 0xf6, 0xff, 0x6c, 0x52, 0xff, 0xc7, 0x10, 0xff, 0xa6, 0x08, 0xff, 0x86, 0x08, 0xff, 0xca, 0x31, 0xff, 0xb4, 0x9c, 0xff, 0x5d, 0xef, 0xff, 0x9e, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x3d, 0xef, 0xf8,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0xbe, 0xff, 0xff, 0x1c, 0xe7, 0xff, 0x6d, 0x4a, 0xff, 0xc7, 0x10, 0xff, 0xe8, 0x10, 0xff, 0x09, 0x19, 0xff, 0x29, 0x19, 0xff, 0x29, 0x19, 0xff, 0x29, 0x19, 0xff, 0xe8, 0x18, 0xff, 0x44, 0x00, 0xff, 0x00, 0x00, 0xff, 0x63, 0x59, 0xff, 0x2a, 0xc4, 0xff, 0x11, 0xf6, 0xff, 0x12, 0xee, 0xff, 0xd1, 0xe5, 0xff, 0x12, 0xee, 0xff, 0xf2, 0xed, 0xff, 0x53, 0xf6, 0xff, 0xd6, 0xfe, 0xff, 0x55, 0xee, 0xff, 0xed, 0x62, 0xff, 0xc7, 0x10, 0xff, 0xe7, 0x10, 0xff, 0xe7, 0x10, 0xff, 0xe7, 0x10, 0xff, 0xc7, 0x10, 0xff, 0x86, 0x08, 0xff, 0x4b, 0x42, 0xff, 0x39, 0xc6, 0xff, 0xbe, 0xff, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0x91, 0x6b, 0xff, 0xc8, 0x10, 0xff, 0x29, 0x21, 0xff, 0x29, 0x21, 0xff, 0x29, 0x21, 0xff, 0x4a, 0x21, 0xff, 0x4a, 0x21, 0xff, 0x4a, 0x21, 0xff, 0x49, 0x21, 0xff, 0xe8, 0x18, 0xff, 0xa6, 0x10, 0xff, 0xe6, 0x18, 0xff, 0x0b, 0x73, 0xff, 0x31, 0xc5, 0xff, 0x54, 0xee, 0xff, 0x54, 0xf6, 0xff, 0x74, 0xf6, 0xff, 0x55, 0xee, 0xff, 0x15, 0xde, 0xff, 0x30, 0x94, 0xff, 0xca, 0x39, 0xff, 0xc8, 0x10, 0xff, 0xe7, 0x10, 0xff, 0xe8, 0x18, 0xff, 0xe8, 0x18, 0xff, 0x08, 0x19, 0xff, 0x08, 0x19, 0xff, 0x08, 0x19, 0xff, 0x86, 0x08, 0xff, 0xc6, 0x10, 0xff, 0xf4, 0xa4, 0xff, 0xbe, 0xff, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0x5a, 0xce, 0xff, 0x4a, 0x21, 0xff, 0x49, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x4a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x29, 0x19, 0xff, 0x49, 0x21, 0xff, 0xeb, 0x39, 0xff, 0x4c, 0x4a, 0xff, 0x4c, 0x4a, 0xff, 0x0b, 0x42, 0xff, 0x6a, 0x29, 0xff, 0x09, 0x11, 0xff, 0x29, 0x19, 0xff, 0x49, 0x21, 0xff, 0x49, 0x21, 0xff, 0x29, 0x21, 0xff, 0x29, 0x19, 0xff, 0x08, 0x19, 0xff, 0x08, 0x19, 0xff, 0x08, 0x19, 0xff, 0xe8, 0x18, 0xff, 0x86, 0x08, 0xff, 0xe7, 0x18, 0xff, 0x7a, 0xce, 0xff, 0x9e, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7d, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0x74, 0x8c, 0xff, 0xe8, 0x10, 0xff, 0x6a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x4a, 0x21, 0xff, 0x29, 0x19, 0xff, 0x2a, 0x19, 0xff, 0x4a, 0x21, 0xff, 0x4a, 0x21, 0xff, 0x4a, 0x21, 0xff, 0x4a, 0x21, 0xff, 0x4a, 0x21, 0xff, 0x4a, 0x21, 0xff, 0x49, 0x21, 0xff, 0x49, 0x21, 0xff, 0x29, 0x19, 0xff, 0x29, 0x19, 0xff, 0x29, 0x19, 0xff, 0x29, 0x19, 0xff, 0x08, 0x19, 0xff, 0xa7, 0x08, 0xff, 0x70, 0x6b, 0xff, 0xbe, 0xff, 0xff, 0x7d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xbf, 0xff, 0xff, 0x30, 0x63, 0xff, 0x09, 0x19, 0xff, 0x6a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x4a, 0x21, 0xff, 0x29, 0x21, 0xff, 0x49, 0x21, 0xff, 0x29, 0x19, 0xff, 0x08, 0x19, 0xff, 0x8a, 0x29, 0xff, 0xdb, 0xde, 0xff, 0x9e, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x6d, 0x42, 0xff, 0x29, 0x19, 0xff, 0x6a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x4a, 0x21, 0xff, 0x49, 0x21, 0xff, 0x29, 0x19, 0xff, 0x08, 0x19, 0xff, 0xc8, 0x10, 0xff, 0x56, 0xad, 0xff, 0xbe, 0xff, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x3d, 0xe7, 0xff, 0xec, 0x39, 0xff, 0x29, 0x19, 0xff, 0x49, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x8b, 0x29, 0xff, 0x8b, 0x21, 0xff, 0x8b, 0x21, 0xff, 0x8b, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8b, 0x21, 0xff, 0x8b, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x4a, 0x21, 0xff, 0x29, 0x19, 0xff, 0x09, 0x19, 0xff, 0x08, 0x19, 0xff, 0xa7, 0x10, 0xff, 0xd1, 0x73, 0xff, 0xbe, 0xff, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0xbe, 0xff, 0xff, 0x1c, 0xe7, 0xff, 0xcb, 0x31, 0xff, 0x09, 0x19, 0xff, 0x08, 0x19, 0xff, 0x49, 0x21, 0xff, 0x8b, 0x21, 0xff, 0x8b, 0x21, 0xff, 0x8b, 0x21, 0xff, 0x8b, 0x29, 0xff, 0x6a, 0x21, 0xff, 0x4a, 0x21, 0xff, 0x4a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x4a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x4a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x4a, 0x21, 0xff, 0x08, 0x19, 0xff, 0x08, 0x19, 0xff, 0x08, 0x19, 0xff, 0xa7, 0x08, 0xff, 0xad, 0x52, 0xff, 0x9d, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x3d, 0xef, 0xff, 0x0c, 0x3a, 0xff, 0x08, 0x19, 0xff, 0xe8, 0x18, 0xff, 0xc7, 0x10, 0xff, 0x29, 0x21, 0xff, 0x8b, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6d, 0x3a, 0xff, 0x8e, 0x42, 0xff, 0x4d, 0x3a, 0xff, 0x4d, 0x3a, 0xff, 0x2c, 0x32, 0xff, 0x4d, 0x3a, 0xff, 0x4d, 0x3a, 0xff, 0x2d, 0x3a, 0xff, 0xae, 0x42, 0xff, 0x2d, 0x32, 0xff, 0x6d, 0x42, 0xff, 0x8e, 0x42, 0xff, 0x4d, 0x3a, 0xff, 0x6d, 0x3a, 0xff, 0x0c, 0x32, 0xff, 0x4d, 0x3a, 0xff, 0xab, 0x29, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x49, 0x21, 0xff, 0x08, 0x19, 0xff, 0xe8, 0x18, 0xff, 0xe8, 0x18, 0xff, 0xc7, 0x10, 0xff, 0x4c, 0x42, 0xff, 0x5d, 0xef, 0xff, 0x7d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7d, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0x4d, 0x42, 0xff, 0x08, 0x19, 0xff, 0xe8, 0x18, 0xff, 0x85, 0x10, 0xff, 0xc7, 0x10, 0xff, 0x8b, 0x29, 0xff, 0x8a, 0x21, 0xff, 0x4a, 0x21, 0xff, 0x30, 0x53, 0xff, 0x74, 0x74, 0xff, 0xb1, 0x63, 0xff, 0x74, 0x74, 0xff, 0x54, 0x74, 0xff, 0x54, 0x74, 0xff, 0x33, 0x6c, 0xff, 0x74, 0x74, 0xff, 0xf2, 0x63, 0xff, 0xb1, 0x5b, 0xff, 0xd2, 0x63, 0xff, 0x74, 0x74, 0xff, 0xb2, 0x63, 0xff, 0x74, 0x74, 0xff, 0x53, 0x74, 0xff, 0xf2, 0x63, 0xff, 0xab, 0x29, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0xe8, 0x18, 0xff, 0xa6, 0x10, 0xff, 0xc7, 0x10, 0xff, 0xe7, 0x10, 0xff, 0xa7, 0x10, 0xff, 0xeb, 0x39, 0xff, 0x1c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xff, 0xff, 0x1c, 0xe7, 0xff, 0x0c, 0x3a, 0xff, 0x29, 0x19, 0xff, 0x09, 0x19, 0xff, 0xc7, 0x10, 0xff, 0xa6, 0x10, 0xff, 0x8a, 0x21, 0xff, 0x8b, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x4d, 0x3a, 0xff, 0xef, 0x52, 0xff, 0xce, 0x4a, 0xff, 0xce, 0x4a, 0xff, 0xce, 0x4a, 0xff, 0xce, 0x4a, 0xff, 0xce, 0x4a, 0xff, 0xce, 0x52, 0xff, 0xae, 0x4a, 0xff, 0xae, 0x4a, 0xff, 0xae, 0x4a, 0xff, 0xef, 0x52, 0xff, 0xae, 0x4a, 0xff, 0xae, 0x4a, 0xff, 0xce, 0x4a, 0xff, 0x6d, 0x42, 0xff, 0xab, 0x29, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x29, 0x19, 0xff, 0x85, 0x10, 0xff, 0x65, 0x08, 0xff, 0xa6, 0x10, 0xff, 0xe7, 0x10, 0xff, 0xc7, 0x10, 0xff, 0x89, 0x29, 0xff, 0xfb, 0xe6, 0xff, 0x5d, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0xbe, 0xff, 0xff, 0xf9, 0xc5, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x49, 0x21, 0xff, 0x08, 0x19, 0xff, 0xa6, 0x10, 0xff, 0x08, 0x19, 0xff, 0x8a, 0x21, 0xff, 0x8b, 0x21, 0xff, 0x8d, 0x4a, 0xff, 0xeb, 0x31, 0xff, 0xeb, 0x31, 0xff, 0xec, 0x31, 0xff, 0xcb, 0x31, 0xff, 0xcb, 0x31, 0xff, 0xeb, 0x31, 0xff, 0xeb, 0x31, 0xff, 0x0c, 0x3a, 0xff, 0x0c, 0x3a, 0xff, 0x0c, 0x3a, 0xff, 0x0c, 0x3a, 0xff, 0x0c, 0x3a, 0xff, 0xeb, 0x31, 0xff, 0xeb, 0x31, 0xff, 0xcb, 0x31, 0xff, 0x8a, 0x29, 0xff, 0x6a, 0x21, 0xff, 0x4a, 0x21, 0xff, 0xe7, 0x18, 0xff, 0x64, 0x08, 0xff, 0x86, 0x10, 0xff, 0xe7, 0x18, 0xff, 0x08, 0x19, 0xff, 0xc7, 0x10, 0xff, 0x48, 0x21, 0xff, 0x9a, 0xd6, 0xff, 0x5d, 0xf7, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0xdf, 0xff, 0xff, 0x94, 0x94, 0xff, 0x29, 0x19, 0xff, 0x8a, 0x21, 0xff, 0x29, 0x21, 0xff, 0x08, 0x19, 0xff, 0xa6, 0x10, 0xff, 0xc6, 0x10, 0xff, 0x6a, 0x21, 0xff, 0x8b, 0x29, 0xff, 0x8c, 0x4a, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x2c, 0x3a, 0xff, 0x6c, 0x4a, 0xff, 0xeb, 0x41, 0xff, 0xcb, 0x31, 0xff, 0x4a, 0x19, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x4a, 0x21, 0xff, 0x4a, 0x21, 0xff, 0x4a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x49, 0x21, 0xff, 0x85, 0x10, 0xff, 0x85, 0x08, 0xff, 0xe7, 0x10, 0xff, 0x08, 0x19, 0xff, 0xe8, 0x18, 0xff, 0xe7, 0x10, 0xff, 0x08, 0x19, 0xff, 0x19, 0xc6, 0xff, 0x7d, 0xf7, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x5c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xbe, 0xff, 0xff, 0x91, 0x73, 0xff, 0xe9, 0x10, 0xff, 0x6a, 0x21, 0xff, 0x49, 0x21, 0xff, 0x08, 0x19, 0xff, 0xc6, 0x10, 0xff, 0x85, 0x10, 0xff, 0x49, 0x21, 0xff, 0xab, 0x29, 0xff, 0x8d, 0x4a, 0xff, 0x6a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0xab, 0x31, 0xff, 0xac, 0x62, 0xff, 0x0d, 0x63, 0xff, 0xcc, 0x62, 0xff, 0x6c, 0x52, 0xff, 0xcb, 0x31, 0xff, 0xeb, 0x31, 0xff, 0xec, 0x31, 0xff, 0xeb, 0x31, 0xff, 0xeb, 0x31, 0xff, 0xcb, 0x31, 0xff, 0xcb, 0x31, 0xff, 0xcb, 0x31, 0xff, 0x8a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x49, 0x21, 0xff, 0x84, 0x10, 0xff, 0x85, 0x10, 0xff, 0xe8, 0x10, 0xff, 0x08, 0x19, 0xff, 0x08, 0x19, 0xff, 0x08, 0x19, 0xff, 0xa7, 0x10, 0xff, 0xf5, 0xa4, 0xff, 0x7d, 0xf7, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x74, 0xcd, 0xff, 0xcc, 0x62, 0xff, 0x6a, 0x29, 0xff, 0xe8, 0x10, 0xff, 0xc7, 0x10, 0xff, 0x86, 0x08, 0xff, 0x64, 0x08, 0xff, 0xe7, 0x18, 0xff, 0x6a, 0x21, 0xff, 0x8d, 0x4a, 0xff, 0x8b, 0x29, 0xff, 0x6a, 0x21, 0xff, 0xad, 0x4a, 0xff, 0x4c, 0x42, 0xff, 0x2c, 0x42, 0xff, 0x4c, 0x42, 0xff, 0x8d, 0x4a, 0xff, 0xce, 0x52, 0xff, 0x2c, 0x3a, 0xff, 0x4c, 0x3a, 0xff, 0x4d, 0x42, 0xff, 0x4c, 0x42, 0xff, 0x0c, 0x3a, 0xff, 0x0b, 0x32, 0xff, 0x4c, 0x42, 0xff, 0xcb, 0x31, 0xff, 0x6a, 0x21, 0xff, 0x49, 0x21, 0xff, 0x85, 0x10, 0xff, 0x65, 0x08, 0xff, 0xc7, 0x10, 0xff, 0x08, 0x19, 0xff, 0x08, 0x19, 0xff, 0x29, 0x19, 0xff, 0xa7, 0x08, 0xff, 0x4f, 0x63, 0xff, 0x7d, 0xf7, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0xf4, 0xe5, 0xff, 0xf1, 0xf5, 0xff, 0xb3, 0xdd, 0xff, 0x13, 0xbd, 0xff, 0x91, 0xa4, 0xff, 0xcd, 0x9b, 0xff, 0x45, 0x39, 0xff, 0xc7, 0x10, 0xff, 0x4a, 0x21, 0xff, 0x6c, 0x42, 0xff, 0x0e, 0x63, 0xff, 0xcb, 0x29, 0xff, 0x6d, 0x42, 0xff, 0x8a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x4a, 0x19, 0xff, 0xab, 0x29, 0xff, 0x6c, 0x4a, 0xff, 0x89, 0x29, 0xff, 0xaa, 0x31, 0xff, 0x6a, 0x21, 0xff, 0x4a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0xcb, 0x29, 0xff, 0x2b, 0x3a, 0xff, 0xcb, 0x31, 0xff, 0x4a, 0x21, 0xff, 0x29, 0x19, 0xff, 0xa5, 0x10, 0xff, 0x64, 0x08, 0xff, 0xc7, 0x10, 0xff, 0xe8, 0x18, 0xff, 0xe8, 0x18, 0xff, 0xc7, 0x10, 0xff, 0x86, 0x08, 0xff, 0x2e, 0x6b, 0xff, 0x3c, 0xef, 0xff, 0x1c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xb3, 0xdd, 0xff, 0xb0, 0xed, 0xff, 0x94, 0xfe, 0xff, 0x18, 0xff, 0xff, 0x17, 0xff, 0xff, 0x90, 0xed, 0xff, 0x86, 0x41, 0xff, 0xe7, 0x18, 0xff, 0x6a, 0x21, 0xff, 0x4c, 0x42, 0xff, 0xf1, 0x7b, 0xff, 0xee, 0x5a, 0xff, 0x6d, 0x42, 0xff, 0xab, 0x29, 0xff, 0x8a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0xec, 0x31, 0xff, 0xcb, 0x5a, 0xff, 0xeb, 0x5a, 0xff, 0x0c, 0x63, 0xff, 0x4b, 0x42, 0xff, 0xab, 0x29, 0xff, 0xaa, 0x29, 0xff, 0x8c, 0x4a, 0xff, 0xac, 0x52, 0xff, 0xcb, 0x31, 0xff, 0x49, 0x21, 0xff, 0xe8, 0x18, 0xff, 0x47, 0x29, 0xff, 0x06, 0x29, 0xff, 0xc7, 0x10, 0xff, 0x08, 0x19, 0xff, 0x68, 0x29, 0xff, 0x0a, 0x42, 0xff, 0x6b, 0x93, 0xff, 0xf0, 0xcc, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x93, 0xdd, 0xff, 0x6f, 0xe5, 0xff, 0x74, 0xf6, 0xff, 0xf8, 0xfe, 0xff, 0xd6, 0xfe, 0xff, 0x0e, 0xd5, 0xff, 0xe9, 0x41, 0xff, 0xe8, 0x18, 0xff, 0x49, 0x21, 0xff, 0x2c, 0x42, 0xff, 0xd0, 0x73, 0xff, 0x8f, 0x73, 0xff, 0x4c, 0x42, 0xff, 0xab, 0x29, 0xff, 0x6a, 0x21, 0xff, 0x4c, 0x42, 0xff, 0xad, 0x4a, 0xff, 0x6c, 0x42, 0xff, 0x6d, 0x4a, 0xff, 0x8d, 0x4a, 0xff, 0x6d, 0x42, 0xff, 0xad, 0x52, 0xff, 0xcb, 0x31, 0xff, 0x8c, 0x4a, 0xff, 0x8c, 0x4a, 0xff, 0x8a, 0x29, 0xff, 0x08, 0x19, 0xff, 0xc7, 0x10, 0xff, 0x08, 0x4a, 0xff, 0x09, 0x83, 0xff, 0xef, 0xc4, 0xff, 0xb3, 0xd5, 0xff, 0xf3, 0xe5, 0xff, 0x12, 0xee, 0xff, 0x8f, 0xed, 0xff, 0xcf, 0xc4, 0xff, 0xfb, 0xe6, 0xff, 0xfb, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x93, 0xdd, 0xff, 0x6f, 0xe5, 0xff, 0x94, 0xf6, 0xff, 0xd7, 0xfe, 0xff, 0x74, 0xf6, 0xff, 0x6c, 0xc4, 0xff, 0x2b, 0x4a, 0xff, 0xe8, 0x18, 0xff, 0x28, 0x21, 0xff, 0x8d, 0x4a, 0xff, 0x6f, 0x6b, 0xff, 0x4e, 0x63, 0xff, 0xad, 0x52, 0xff, 0xab, 0x29, 0xff, 0x6a, 0x21, 0xff, 0x4c, 0x42, 0xff, 0xab, 0x29, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x4a, 0x19, 0xff, 0x2c, 0x3a, 0xff, 0x6c, 0x42, 0xff, 0xcd, 0x52, 0xff, 0xcc, 0x52, 0xff, 0x49, 0x21, 0xff, 0xa6, 0x10, 0xff, 0xa6, 0x10, 0xff, 0xe8, 0x41, 0xff, 0x09, 0x83, 0xff, 0x90, 0xe5, 0xff, 0x95, 0xfe, 0xff, 0x95, 0xfe, 0xff, 0x33, 0xf6, 0xff, 0x2e, 0xdd, 0xff, 0x8e, 0xc4, 0xff, 0xfb, 0xe6, 0xff, 0xfb, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xb4, 0xdd, 0xff, 0x6f, 0xe5, 0xff, 0x54, 0xf6, 0xff, 0xb6, 0xfe, 0xff, 0xf2, 0xed, 0xff, 0xeb, 0xb3, 0xff, 0xad, 0x52, 0xff, 0x08, 0x19, 0xff, 0x28, 0x21, 0xff, 0x8d, 0x4a, 0xff, 0xcb, 0x31, 0xff, 0xaa, 0x29, 0xff, 0x8d, 0x4a, 0xff, 0x8b, 0x29, 0xff, 0x6a, 0x21, 0xff, 0x4c, 0x42, 0xff, 0xab, 0x29, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x2c, 0x42, 0xff, 0x0b, 0x3a, 0xff, 0x8a, 0x29, 0xff, 0xea, 0x39, 0xff, 0x48, 0x21, 0xff, 0x65, 0x08, 0xff, 0x85, 0x08, 0xff, 0xc8, 0x41, 0xff, 0xe9, 0x7a, 0xff, 0xcd, 0xd4, 0xff, 0x33, 0xf6, 0xff, 0x54, 0xf6, 0xff, 0x13, 0xee, 0xff, 0x2f, 0xe5, 0xff, 0x8e, 0xbc, 0xff, 0xdb, 0xe6, 0xff, 0xfb, 0xe6, 0xff, 0x1b, 0xe7, 0xff, 0x1c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xd4, 0xdd, 0xff, 0xb0, 0xed, 0xff, 0x13, 0xf6, 0xff, 0xf2, 0xed, 0xff, 0x4f, 0xe5, 0xff, 0xcb, 0xa3, 0xff, 0x70, 0x6b, 0xff, 0x08, 0x19, 0xff, 0x08, 0x21, 0xff, 0x4c, 0x42, 0xff, 0x29, 0x21, 0xff, 0x29, 0x19, 0xff, 0x4c, 0x42, 0xff, 0xab, 0x29, 0xff, 0x6a, 0x29, 0xff, 0x4c, 0x42, 0xff, 0x8d, 0x4a, 0xff, 0x6c, 0x42, 0xff, 0x2c, 0x3a, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x0c, 0x3a, 0xff, 0x8a, 0x29, 0xff, 0x29, 0x19, 0xff, 0x8a, 0x29, 0xff, 0x48, 0x21, 0xff, 0x85, 0x10, 0xff, 0x65, 0x08, 0xff, 0x09, 0x4a, 0xff, 0xea, 0x72, 0xff, 0x4c, 0xc4, 0xff, 0xd2, 0xed, 0xff, 0x33, 0xf6, 0xff, 0xf2, 0xed, 0xff, 0x4f, 0xe5, 0xff, 0xcf, 0xc4, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xe6, 0xff, 0x1b, 0xe7, 0xff, 0x1c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x92, 0xdd, 0xff, 0x12, 0xf6, 0xff, 0x33, 0xf6, 0xff, 0x90, 0xed, 0xff, 0x0e, 0xdd, 0xff, 0x4d, 0xb4, 0xff, 0x90, 0x6b, 0xff, 0x08, 0x19, 0xff, 0x08, 0x21, 0xff, 0x4c, 0x42, 0xff, 0x49, 0x21, 0xff, 0x29, 0x19, 0xff, 0x6c, 0x4a, 0xff, 0x0a, 0x42, 0xff, 0xca, 0x41, 0xff, 0xec, 0x5a, 0xff, 0xc9, 0x39, 0xff, 0xab, 0x29, 0xff, 0x8a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x0b, 0x3a, 0xff, 0x69, 0x21, 0xff, 0x08, 0x19, 0xff, 0x89, 0x29, 0xff, 0x48, 0x21, 0xff, 0xa6, 0x10, 0xff, 0x65, 0x08, 0xff, 0x09, 0x4a, 0xff, 0x2b, 0x7b, 0xff, 0xaa, 0xab, 0xff, 0x70, 0xe5, 0xff, 0xd1, 0xed, 0xff, 0xd1, 0xed, 0xff, 0xb0, 0xed, 0xff, 0xef, 0xcc, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x3c, 0xef, 0xff, 0x71, 0xe5, 0xff, 0x74, 0xfe, 0xff, 0x74, 0xf6, 0xff, 0xf2, 0xed, 0xff, 0xb1, 0xed, 0xff, 0xf0, 0xcc, 0xff, 0xce, 0x52, 0xff, 0x29, 0x19, 0xff, 0x08, 0x21, 0xff, 0x2b, 0x42, 0xff, 0x49, 0x21, 0xff, 0x09, 0x19, 0xff, 0x4c, 0x4a, 0xff, 0xea, 0x41, 0xff, 0x89, 0x39, 0xff, 0x6c, 0x52, 0xff, 0xca, 0x39, 0xff, 0x6a, 0x21, 0xff, 0x4a, 0x21, 0xff, 0x4a, 0x21, 0xff, 0x4a, 0x21, 0xff, 0xeb, 0x39, 0xff, 0x29, 0x21, 0xff, 0xc7, 0x10, 0xff, 0x89, 0x29, 0xff, 0x48, 0x21, 0xff, 0xa6, 0x10, 0xff, 0xa7, 0x10, 0xff, 0x09, 0x4a, 0xff, 0x6c, 0x7b, 0xff, 0xab, 0xab, 0xff, 0xcd, 0xd4, 0xff, 0xee, 0xdc, 0xff, 0xd2, 0xed, 0xff, 0x12, 0xf6, 0xff, 0xce, 0xcc, 0xff, 0x9a, 0xde, 0xff, 0xfb, 0xe6, 0xff, 0x1b, 0xe7, 0xff, 0x1c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xfb, 0xee, 0xff, 0x50, 0xe5, 0xff, 0x53, 0xfe, 0xff, 0x74, 0xf6, 0xff, 0xf2, 0xed, 0xff, 0x12, 0xf6, 0xff, 0x10, 0xd5, 0xff, 0x0b, 0x42, 0xff, 0x4a, 0x21, 0xff, 0x08, 0x21, 0xff, 0x2b, 0x42, 0xff, 0x29, 0x19, 0xff, 0x09, 0x19, 0xff, 0x2b, 0x42, 0xff, 0x4b, 0x4a, 0xff, 0x4b, 0x4a, 0xff, 0xcc, 0x5a, 0xff, 0x4b, 0x42, 0xff, 0x4c, 0x42, 0xff, 0x0b, 0x3a, 0xff, 0x0b, 0x3a, 0xff, 0x0b, 0x42, 0xff, 0x4c, 0x4a, 0xff, 0x28, 0x21, 0xff, 0xa7, 0x10, 0xff, 0x89, 0x29, 0xff, 0x28, 0x21, 0xff, 0xc7, 0x10, 0xff, 0xc7, 0x10, 0xff, 0x09, 0x4a, 0xff, 0x6c, 0x83, 0xff, 0x4d, 0xbc, 0xff, 0x91, 0xed, 0xff, 0x4f, 0xe5, 0xff, 0x13, 0xf6, 0xff, 0x54, 0xf6, 0xff, 0xee, 0xd4, 0xff, 0x58, 0xd6, 0xff, 0x1c, 0xe7, 0xff, 0x1b, 0xe7, 0xff, 0x1c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xb9, 0xe6, 0xff, 0x2f, 0xe5, 0xff, 0x53, 0xfe, 0xff, 0x74, 0xfe, 0xff, 0xf2, 0xed, 0xff, 0xd2, 0xed, 0xff, 0x30, 0xd5, 0xff, 0x0b, 0x42, 0xff, 0x4a, 0x21, 0xff, 0x08, 0x21, 0xff, 0x0b, 0x42, 0xff, 0x29, 0x19, 0xff, 0x08, 0x19, 0xff, 0x08, 0x19, 0xff, 0x49, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x8a, 0x29, 0xff, 0x8c, 0x4a, 0xff, 0x2c, 0x42, 0xff, 0x6a, 0x21, 0xff, 0x8a, 0x29, 0xff, 0xaa, 0x29, 0xff, 0x8a, 0x29, 0xff, 0x48, 0x29, 0xff, 0x27, 0x21, 0xff, 0xa9, 0x31, 0xff, 0x48, 0x21, 0xff, 0xc7, 0x10, 0xff, 0xc7, 0x10, 0xff, 0x2a, 0x4a, 0xff, 0xad, 0x83, 0xff, 0x8d, 0xc4, 0xff, 0x13, 0xf6, 0xff, 0xd2, 0xed, 0xff, 0x54, 0xf6, 0xff, 0x95, 0xfe, 0xff, 0x0e, 0xdd, 0xff, 0x17, 0xd6, 0xff, 0x1c, 0xe7, 0xff, 0x1b, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x78, 0xe6, 0xff, 0x0e, 0xe5, 0xff, 0x74, 0xfe, 0xff, 0x95, 0xfe, 0xff, 0x33, 0xf6, 0xff, 0x91, 0xed, 0xff, 0x30, 0xd5, 0xff, 0x2c, 0x4a, 0xff, 0x4a, 0x21, 0xff, 0x08, 0x21, 0xff, 0xea, 0x39, 0xff, 0x09, 0x19, 0xff, 0x08, 0x11, 0xff, 0x49, 0x21, 0xff, 0x89, 0x29, 0xff, 0x49, 0x29, 0xff, 0xaa, 0x29, 0xff, 0xea, 0x39, 0xff, 0xca, 0x31, 0xff, 0xe9, 0x10, 0xff, 0x09, 0x19, 0xff, 0x4a, 0x21, 0xff, 0x4a, 0x19, 0xff, 0x69, 0x29, 0xff, 0x47, 0x29, 0xff, 0x89, 0x29, 0xff, 0x48, 0x21, 0xff, 0xe7, 0x10, 0xff, 0x86, 0x08, 0xff, 0x6a, 0x52, 0xff, 0xee, 0x8b, 0xff, 0xce, 0xc4, 0xff, 0xd1, 0xed, 0xff, 0xf2, 0xed, 0xff, 0x95, 0xf6, 0xff, 0x95, 0xfe, 0xff, 0xed, 0xdc, 0xff, 0xd5, 0xcd, 0xff, 0x1c, 0xe7, 0xff, 0x1b, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x78, 0xe6, 0xff, 0xee, 0xdc, 0xff, 0x54, 0xf6, 0xff, 0xb6, 0xfe, 0xff, 0x54, 0xf6, 0xff, 0x70, 0xe5, 0xff, 0x0f, 0xd5, 0xff, 0x4c, 0x4a, 0xff, 0x4a, 0x21, 0xff, 0x28, 0x21, 0xff, 0x4b, 0x4a, 0xff, 0x2b, 0x42, 0xff, 0x0b, 0x3a, 0xff, 0x4b, 0x52, 0xff, 0x6c, 0x4a, 0xff, 0x0b, 0x4a, 0xff, 0x2b, 0x4a, 0xff, 0x2a, 0x3a, 0xff, 0x4b, 0x42, 0xff, 0xca, 0x31, 0xff, 0xeb, 0x39, 0xff, 0x0b, 0x3a, 0xff, 0xcb, 0x31, 0xff, 0xca, 0x39, 0xff, 0xa9, 0x39, 0xff, 0xa9, 0x31, 0xff, 0x69, 0x29, 0xff, 0xe8, 0x18, 0xff, 0xa6, 0x10, 0xff, 0x0c, 0x6b, 0xff, 0x30, 0x94, 0xff, 0xae, 0xc4, 0xff, 0xb0, 0xed, 0xff, 0x13, 0xee, 0xff, 0x95, 0xfe, 0xff, 0x74, 0xf6, 0xff, 0xad, 0xd4, 0xff, 0x74, 0xc5, 0xff, 0x1c, 0xe7, 0xff, 0x1b, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xba, 0xe6, 0xff, 0xad, 0xd4, 0xff, 0xf2, 0xf5, 0xff, 0x75, 0xfe, 0xff, 0x74, 0xf6, 0xff, 0x90, 0xe5, 0xff, 0xce, 0xd4, 0xff, 0x4b, 0x4a, 0xff, 0x4a, 0x21, 0xff, 0x29, 0x21, 0xff, 0x69, 0x29, 0xff, 0xcb, 0x39, 0xff, 0xcb, 0x31, 0xff, 0xaa, 0x31, 0xff, 0xaa, 0x31, 0xff, 0xab, 0x31, 0xff, 0x8a, 0x29, 0xff, 0xaa, 0x29, 0xff, 0x8a, 0x29, 0xff, 0xaa, 0x31, 0xff, 0xa9, 0x31, 0xff, 0x69, 0x29, 0xff, 0x8a, 0x29, 0xff, 0xaa, 0x31, 0xff, 0x89, 0x29, 0xff, 0x28, 0x21, 0xff, 0x29, 0x21, 0xff, 0x29, 0x21, 0xff, 0xc6, 0x10, 0xff, 0x6e, 0x73, 0xff, 0x91, 0x9c, 0xff, 0x8e, 0xbc, 0xff, 0x6f, 0xe5, 0xff, 0x13, 0xee, 0xff, 0x74, 0xf6, 0xff, 0x33, 0xf6, 0xff, 0x4b, 0xcc, 0xff, 0x33, 0xbd, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x3c, 0xef, 0xff, 0xce, 0xd4, 0xff, 0xd1, 0xed, 0xff, 0x74, 0xf6, 0xff, 0x74, 0xf6, 0xff, 0x70, 0xe5, 0xff, 0xad, 0xcc, 0xff, 0x4b, 0x52, 0xff, 0x4a, 0x19, 0xff, 0x49, 0x21, 0xff, 0x08, 0x19, 0xff, 0x29, 0x19, 0xff, 0x29, 0x19, 0xff, 0x09, 0x19, 0xff, 0x29, 0x19, 0xff, 0x29, 0x19, 0xff, 0x49, 0x21, 0xff, 0x29, 0x19, 0xff, 0x08, 0x19, 0xff, 0xe8, 0x18, 0xff, 0xc7, 0x10, 0xff, 0x65, 0x08, 0xff, 0xe7, 0x10, 0xff, 0x29, 0x19, 0xff, 0x09, 0x19, 0xff, 0xc7, 0x10, 0xff, 0x08, 0x19, 0xff, 0xe7, 0x18, 0xff, 0xa6, 0x10, 0xff, 0xae, 0x7b, 0xff, 0xd2, 0xa4, 0xff, 0x6d, 0xbc, 0xff, 0x2f, 0xe5, 0xff, 0x13, 0xf6, 0xff, 0x54, 0xf6, 0xff, 0xf2, 0xf5, 0xff, 0x0a, 0xcc, 0xff, 0x33, 0xbd, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xef, 0xff, 0x10, 0xd5, 0xff, 0x4f, 0xe5, 0xff, 0x54, 0xf6, 0xff, 0x54, 0xf6, 0xff, 0x6f, 0xe5, 0xff, 0x6c, 0xc4, 0xff, 0x4b, 0x52, 0xff, 0x2a, 0x19, 0xff, 0x49, 0x21, 0xff, 0x08, 0x19, 0xff, 0x29, 0x21, 0xff, 0x29, 0x19, 0xff, 0x29, 0x19, 0xff, 0x09, 0x19, 0xff, 0x49, 0x19, 0xff, 0x49, 0x21, 0xff, 0x29, 0x21, 0xff, 0x08, 0x19, 0xff, 0x08, 0x19, 0xff, 0x08, 0x19, 0xff, 0xa6, 0x10, 0xff, 0x86, 0x10, 0xff, 0x08, 0x19, 0xff, 0x29, 0x21, 0xff, 0xe8, 0x18, 0xff, 0xe7, 0x18, 0xff, 0xc7, 0x18, 0xff, 0xc7, 0x10, 0xff, 0xcf, 0x83, 0xff, 0x13, 0xad, 0xff, 0x0c, 0xb4, 0xff, 0x2f, 0xdd, 0xff, 0x33, 0xf6, 0xff, 0x34, 0xf6, 0xff, 0xb1, 0xed, 0xff, 0xea, 0xc3, 0xff, 0x54, 0xc5, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x53, 0xd5, 0xff, 0xcd, 0xdc, 0xff, 0x33, 0xf6, 0xff, 0x54, 0xf6, 0xff, 0x6f, 0xe5, 0xff, 0x0b, 0xbc, 0xff, 0x68, 0x31, 0xff, 0x4a, 0x19, 0xff, 0x6a, 0x21, 0xff, 0x08, 0x19, 0xff, 0x29, 0x19, 0xff, 0x29, 0x19, 0xff, 0x08, 0x19, 0xff, 0x08, 0x19, 0xff, 0x29, 0x19, 0xff, 0x29, 0x19, 0xff, 0x29, 0x21, 0xff, 0x29, 0x19, 0xff, 0x29, 0x19, 0xff, 0x49, 0x21, 0xff, 0xe8, 0x18, 0xff, 0x45, 0x08, 0xff, 0xa6, 0x10, 0xff, 0x49, 0x21, 0xff, 0x08, 0x19, 0xff, 0xc7, 0x10, 0xff, 0xc7, 0x10, 0xff, 0x08, 0x19, 0xff, 0x10, 0x8c, 0xff, 0x34, 0xb5, 0xff, 0xec, 0xa3, 0xff, 0x0e, 0xdd, 0xff, 0x34, 0xf6, 0xff, 0x33, 0xf6, 0xff, 0x6f, 0xed, 0xff, 0xa9, 0xbb, 0xff, 0xb6, 0xc5, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0xf6, 0xd5, 0xff, 0x8c, 0xd4, 0xff, 0xf2, 0xed, 0xff, 0x33, 0xf6, 0xff, 0x4f, 0xe5, 0xff, 0x6a, 0xa3, 0xff, 0x27, 0x21, 0xff, 0x29, 0x19, 0xff, 0x6a, 0x21, 0xff, 0x08, 0x19, 0xff, 0x29, 0x19, 0xff, 0x29, 0x19, 0xff, 0x08, 0x19, 0xff, 0x08, 0x19, 0xff, 0x28, 0x19, 0xff, 0x29, 0x19, 0xff, 0x29, 0x19, 0xff, 0x29, 0x19, 0xff, 0x49, 0x19, 0xff, 0x29, 0x19, 0xff, 0x49, 0x21, 0xff, 0xa6, 0x10, 0xff, 0x85, 0x08, 0xff, 0x08, 0x19, 0xff, 0x6a, 0x21, 0xff, 0x29, 0x19, 0xff, 0xe7, 0x18, 0xff, 0xc7, 0x10, 0xff, 0xef, 0x83, 0xff, 0x75, 0xbd, 0xff, 0x2e, 0xac, 0xff, 0xac, 0xd4, 0xff, 0x33, 0xf6, 0xff, 0x33, 0xf6, 0xff, 0x0e, 0xe5, 0xff, 0x89, 0xb3, 0xff, 0x17, 0xce, 0xff, 0xfb, 0xe6, 0xff, 0xfc, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x99, 0xde, 0xff, 0x4c, 0xcc, 0xff, 0x90, 0xed, 0xff, 0xf1, 0xed, 0xff, 0x2e, 0xe5, 0xff, 0xa8, 0x82, 0xff, 0xa6, 0x10, 0xff, 0xc7, 0x10, 0xff, 0x49, 0x21, 0xff, 0x28, 0x19, 0xff, 0x08, 0x19, 0xff, 0x29, 0x19, 0xff, 0x29, 0x19, 0xff, 0x29, 0x19, 0xff, 0x49, 0x21, 0xff, 0x29, 0x19, 0xff, 0x29, 0x19, 0xff, 0x29, 0x19, 0xff, 0xe8, 0x18, 0xff, 0xe7, 0x10, 0xff, 0x29, 0x21, 0xff, 0x09, 0x19, 0xff, 0x85, 0x08, 0xff, 0x85, 0x08, 0xff, 0x08, 0x19, 0xff, 0x49, 0x21, 0xff, 0xe7, 0x18, 0xff, 0xc7, 0x10, 0xff, 0xaf, 0x7b, 0xff, 0xb6, 0xbd, 0xff, 0x70, 0xac, 0xff, 0x4b, 0xcc, 0xff, 0x13, 0xf6, 0xff, 0xf2, 0xf5, 0xff, 0xcd, 0xdc, 0xff, 0x8a, 0xab, 0xff, 0x59, 0xd6, 0xff, 0xdb, 0xe6, 0xff, 0xfb, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7e, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0x3d, 0xef, 0xff, 0x6e, 0xc4, 0xff, 0xee, 0xe4, 0xff, 0xf2, 0xed, 0xff, 0x2e, 0xe5, 0xff, 0x26, 0x72, 0xff, 0x08, 0x19, 0xff, 0x49, 0x21, 0xff, 0xe7, 0x18, 0xff, 0x49, 0x21, 0xff, 0x08, 0x19, 0xff, 0x29, 0x19, 0xff, 0x08, 0x19, 0xff, 0x29, 0x19, 0xff, 0x49, 0x21, 0xff, 0x49, 0x21, 0xff, 0x29, 0x19, 0xff, 0x28, 0x19, 0xff, 0xe8, 0x18, 0xff, 0xc7, 0x10, 0xff, 0x29, 0x19, 0xff, 0x4a, 0x21, 0xff, 0xc7, 0x10, 0xff, 0x44, 0x08, 0xff, 0x65, 0x08, 0xff, 0x08, 0x19, 0xff, 0x28, 0x19, 0xff, 0xe8, 0x10, 0xff, 0xaf, 0x7b, 0xff, 0xd6, 0xbd, 0xff, 0xd2, 0xb4, 0xff, 0x2b, 0xc4, 0xff, 0x12, 0xee, 0xff, 0xf2, 0xf5, 0xff, 0x4b, 0xd4, 0xff, 0xec, 0xab, 0xff, 0x9a, 0xd6, 0xff, 0xdb, 0xe6, 0xff, 0xfb, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7d, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0x7e, 0xef, 0xff, 0xf1, 0xc4, 0xff, 0x6b, 0xd4, 0xff, 0x12, 0xf6, 0xff, 0x4f, 0xe5, 0xff, 0xe6, 0x61, 0xff, 0x29, 0x19, 0xff, 0xab, 0x29, 0xff, 0x29, 0x19, 0xff, 0x08, 0x19, 0xff, 0x08, 0x19, 0xff, 0x29, 0x19, 0xff, 0x29, 0x19, 0xff, 0x08, 0x19, 0xff, 0x29, 0x19, 0xff, 0x4a, 0x21, 0xff, 0x29, 0x21, 0xff, 0x08, 0x19, 0xff, 0x08, 0x19, 0xff, 0xe7, 0x10, 0xff, 0xe8, 0x10, 0xff, 0x49, 0x21, 0xff, 0x4a, 0x21, 0xff, 0xc7, 0x10, 0xff, 0x44, 0x08, 0xff, 0x65, 0x08, 0xff, 0x29, 0x21, 0xff, 0x09, 0x19, 0xff, 0x4e, 0x6b, 0xff, 0xd6, 0xc5, 0xff, 0x34, 0xb5, 0xff, 0x2b, 0xc4, 0xff, 0xf2, 0xed, 0xff, 0xf2, 0xed, 0xff, 0x2a, 0xcc, 0xff, 0x4f, 0xb4, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xe6, 0xff, 0xfb, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7d, 0xf7, 0xec, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x74, 0xcd, 0xff, 0x2b, 0xc4, 0xff, 0x12, 0xf6, 0xff, 0x90, 0xed, 0xff, 0x07, 0x6a, 0xff, 0x08, 0x11, 0xff, 0x6a, 0x21, 0xff, 0x8a, 0x21, 0xff, 0x49, 0x19, 0xff, 0x29, 0x19, 0xff, 0x29, 0x21, 0xff, 0x29, 0x19, 0xff, 0x09, 0x19, 0xff, 0x29, 0x19, 0xff, 0x49, 0x21, 0xff, 0x4a, 0x21, 0xff, 0x29, 0x19, 0xff, 0xe7, 0x10, 0xff, 0xe7, 0x10, 0xff, 0xc7, 0x10, 0xff, 0x08, 0x19, 0xff, 0x49, 0x21, 0xff, 0x4a, 0x21, 0xff, 0x29, 0x19, 0xff, 0xc7, 0x10, 0xff, 0x86, 0x10, 0xff, 0xc7, 0x10, 0xff, 0x6f, 0x73, 0xff, 0xd6, 0xc5, 0xff, 0x95, 0xbd, 0xff, 0x0b, 0xbc, 0xff, 0xb1, 0xed, 0xff, 0xb1, 0xed, 0xff, 0xc9, 0xbb, 0xff, 0xf2, 0xbc, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xe6, 0xff, 0xfb, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff,
-  0x7d, 0xf7, 0xe0, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0x7e, 0xef, 0xff, 0xf7, 0xd5, 0xff, 0xeb, 0xbb, 0xff, 0x13, 0xf6, 0xff, 0xb1, 0xed, 0xff, 0xe6, 0x61, 0xff, 0x09, 0x11, 0xff, 0x29, 0x19, 0xff, 0x29, 0x19, 0xff, 0x8b, 0x21, 0xff, 0x49, 0x21, 0xff, 0x28, 0x19, 0xff, 0x29, 0x19, 0xff, 0x08, 0x19, 0xff, 0x08, 0x19, 0xff, 0x29, 0x19, 0xff, 0x29, 0x19, 0xff, 0x49, 0x21, 0xff, 0xe8, 0x18, 0xff, 0xc6, 0x10, 0xff, 0xc6, 0x10, 0xff, 0xe7, 0x10, 0xff, 0x08, 0x19, 0xff, 0x49, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x6a, 0x21, 0xff, 0x29, 0x21, 0xff, 0x86, 0x08, 0xff, 0x6f, 0x73, 0xff, 0xd6, 0xc5, 0xff, 0xd6, 0xbd, 0xff, 0x0c, 0xbc, 0xff, 0x90, 0xe5, 0xff, 0x90, 0xed, 0xff, 0x48, 0xab, 0xff, 0x75, 0xc5, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xf8,
-  0x7e, 0xf7, 0xcb, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x7e, 0xef, 0xff, 0x58, 0xd6, 0xff, 0xaa, 0xb3, 0xff, 0x12, 0xf6, 0xff, 0x74, 0xfe, 0xff, 0x27, 0x62, 0xff, 0xa7, 0x08, 0xff, 0x6a, 0x21, 0xff, 0xe8, 0x18, 0xff, 0xe8, 0x18, 0xff, 0x08, 0x19, 0xff, 0xe7, 0x10, 0xff, 0x28, 0x19, 0xff, 0x08, 0x19, 0xff, 0x08, 0x19, 0xff, 0x08, 0x19, 0xff, 0x29, 0x19, 0xff, 0x49, 0x21, 0xff, 0x49, 0x21, 0xff, 0xe8, 0x18, 0xff, 0xa6, 0x10, 0xff, 0xa6, 0x10, 0xff, 0xc7, 0x10, 0xff, 0x08, 0x19, 0xff, 0x29, 0x19, 0xff, 0x29, 0x19, 0xff, 0x08, 0x19, 0xff, 0xc7, 0x10, 0xff, 0x4c, 0x4a, 0xff, 0xb6, 0xbd, 0xff, 0xf7, 0xc5, 0xff, 0xcb, 0xab, 0xff, 0x70, 0xe5, 0xff, 0x50, 0xe5, 0xff, 0x08, 0xa3, 0xff, 0xd6, 0xc5, 0xff, 0xda, 0xde, 0xff, 0xda, 0xde, 0xff, 0xfb, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xe0,
-  0x7e, 0xf7, 0x9f, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0xba, 0xde, 0xff, 0x2c, 0xc4, 0xff, 0xf2, 0xf5, 0xff, 0xf7, 0xfe, 0xff, 0xed, 0xa3, 0xff, 0xc7, 0x10, 0xff, 0x6a, 0x21, 0xff, 0x49, 0x21, 0xff, 0xc7, 0x10, 0xff, 0xa6, 0x10, 0xff, 0xc7, 0x10, 0xff, 0x08, 0x19, 0xff, 0x08, 0x19, 0xff, 0x08, 0x19, 0xff, 0x28, 0x19, 0xff, 0x29, 0x19, 0xff, 0x29, 0x19, 0xff, 0x49, 0x21, 0xff, 0x29, 0x19, 0xff, 0xe8, 0x18, 0xff, 0xc7, 0x10, 0xff, 0xa6, 0x10, 0xff, 0xc7, 0x10, 0xff, 0x08, 0x19, 0xff, 0x29, 0x19, 0xff, 0x29, 0x19, 0xff, 0x09, 0x19, 0xff, 0xeb, 0x39, 0xff, 0x95, 0xbd, 0xff, 0x18, 0xc6, 0xff, 0x0d, 0xb4, 0xff, 0xb1, 0xed, 0xff, 0x0e, 0xe5, 0xff, 0xe8, 0x9a, 0xff, 0x18, 0xce, 0xff, 0xba, 0xde, 0xff, 0xba, 0xde, 0xff, 0xfb, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xac,
-  0x7e, 0xf7, 0x54, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x9d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0xdb, 0xe6, 0xff, 0xad, 0xcc, 0xff, 0xf2, 0xf5, 0xff, 0xf7, 0xfe, 0xff, 0xb3, 0xdd, 0xff, 0xe6, 0x18, 0xff, 0x4a, 0x19, 0xff, 0x4a, 0x21, 0xff, 0x49, 0x21, 0xff, 0x08, 0x19, 0xff, 0xa6, 0x10, 0xff, 0xc7, 0x10, 0xff, 0xe8, 0x10, 0xff, 0x08, 0x19, 0xff, 0x28, 0x19, 0xff, 0x08, 0x19, 0xff, 0x29, 0x19, 0xff, 0x29, 0x19, 0xff, 0x29, 0x19, 0xff, 0x29, 0x19, 0xff, 0x08, 0x19, 0xff, 0xe7, 0x18, 0xff, 0xc7, 0x10, 0xff, 0xe7, 0x10, 0xff, 0x08, 0x19, 0xff, 0x28, 0x19, 0xff, 0xe8, 0x10, 0xff, 0xaa, 0x31, 0xff, 0x75, 0xb5, 0xff, 0x18, 0xce, 0xff, 0x6e, 0xbc, 0xff, 0xf2, 0xf5, 0xff, 0xcd, 0xdc, 0xff, 0x28, 0xa3, 0xff, 0x59, 0xd6, 0xff, 0xba, 0xde, 0xff, 0xba, 0xde, 0xff, 0xfb, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0x5c,
-  0x7e, 0xf7, 0x07, 0x7e, 0xf7, 0xe3, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x3c, 0xef, 0xff, 0xef, 0xd4, 0xff, 0x91, 0xed, 0xff, 0xb7, 0xfe, 0xff, 0xd7, 0xfe, 0xff, 0xec, 0x72, 0xff, 0x09, 0x11, 0xff, 0x6a, 0x21, 0xff, 0x4a, 0x21, 0xff, 0x29, 0x19, 0xff, 0x08, 0x19, 0xff, 0xc7, 0x10, 0xff, 0xc7, 0x10, 0xff, 0xc7, 0x10, 0xff, 0x08, 0x19, 0xff, 0x29, 0x19, 0xff, 0x29, 0x19, 0xff, 0x29, 0x19, 0xff, 0x29, 0x21, 0xff, 0x49, 0x19, 0xff, 0x29, 0x19, 0xff, 0x29, 0x19, 0xff, 0x49, 0x19, 0xff, 0x29, 0x19, 0xff, 0x08, 0x19, 0xff, 0x08, 0x19, 0xff, 0xe7, 0x10, 0xff, 0x47, 0x29, 0xff, 0x54, 0xb5, 0xff, 0x18, 0xc6, 0xff, 0x31, 0xcd, 0xff, 0x54, 0xfe, 0xff, 0xad, 0xdc, 0xff, 0x69, 0xa3, 0xff, 0x79, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0xba, 0xde, 0xff, 0xfb, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xe4, 0x5d, 0xef, 0x07,
-  0x7e, 0xf7, 0x00, 0x7e, 0xf7, 0x54, 0x7e, 0xf7, 0xff, 0x7e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x9e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x92, 0xdd, 0xff, 0x90, 0xed, 0xff, 0xb7, 0xfe, 0xff, 0xf8, 0xfe, 0xff, 0x35, 0xee, 0xff, 0xa8, 0x39, 0xff, 0xe7, 0x10, 0xff, 0x08, 0x19, 0xff, 0x29, 0x19, 0xff, 0x29, 0x19, 0xff, 0xc7, 0x10, 0xff, 0xe7, 0x10, 0xff, 0x08, 0x11, 0xff, 0x08, 0x19, 0xff, 0x49, 0x19, 0xff, 0x49, 0x19, 0xff, 0x49, 0x21, 0xff, 0x4a, 0x21, 0xff, 0x4a, 0x21, 0xff, 0x4a, 0x21, 0xff, 0x29, 0x19, 0xff, 0x08, 0x19, 0xff, 0xe7, 0x18, 0xff, 0xc6, 0x10, 0xff, 0xa5, 0x10, 0xff, 0x62, 0x10, 0xff, 0x82, 0x18, 0xff, 0xf3, 0xa4, 0xff, 0xb6, 0xbd, 0xff, 0x10, 0xc5, 0xff, 0xb6, 0xfe, 0xff, 0x0e, 0xe5, 0xff, 0x49, 0xa3, 0xff, 0x99, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0xda, 0xde, 0xff, 0xfb, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0x54, 0x5d, 0xef, 0x00,
-  0x7e, 0xf7, 0x00, 0x7e, 0xf7, 0x00, 0x7e, 0xf7, 0x8b, 0x7e, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x92, 0xd5, 0xff, 0xb0, 0xed, 0xff, 0x96, 0xfe, 0xff, 0xb7, 0xfe, 0xff, 0x18, 0xff, 0xff, 0xed, 0x9b, 0xff, 0x20, 0x08, 0xff, 0x82, 0x10, 0xff, 0x83, 0x10, 0xff, 0x84, 0x08, 0xff, 0x64, 0x08, 0xff, 0x85, 0x10, 0xff, 0xc6, 0x10, 0xff, 0xc6, 0x10, 0xff, 0xc6, 0x10, 0xff, 0xe6, 0x18, 0xff, 0xc6, 0x10, 0xff, 0xc5, 0x10, 0xff, 0xa4, 0x10, 0xff, 0x83, 0x10, 0xff, 0x83, 0x10, 0xff, 0x62, 0x10, 0xff, 0x61, 0x10, 0xff, 0x61, 0x10, 0xff, 0x61, 0x10, 0xff, 0x61, 0x10, 0xff, 0x61, 0x10, 0xff, 0xb2, 0x9c, 0xff, 0x71, 0x94, 0xff, 0xa3, 0x18, 0xff, 0xa9, 0x5a, 0xff, 0xc5, 0x51, 0xff, 0x0b, 0x63, 0xff, 0xba, 0xd6, 0xff, 0xdb, 0xe6, 0xff, 0xda, 0xde, 0xff, 0xfb, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0x8b, 0x5d, 0xef, 0x00, 0x5d, 0xef, 0x00,
-  0x7e, 0xf7, 0x00, 0x7e, 0xf7, 0x00, 0x7e, 0xf7, 0x03, 0x7e, 0xf7, 0x93, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0xb3, 0xdd, 0xff, 0xb1, 0xed, 0xff, 0x75, 0xf6, 0xff, 0xb7, 0xfe, 0xff, 0xb7, 0xfe, 0xff, 0xf5, 0xe5, 0xff, 0xc3, 0x20, 0xff, 0x41, 0x08, 0xff, 0x41, 0x08, 0xff, 0x40, 0x08, 0xff, 0x41, 0x08, 0xff, 0x41, 0x08, 0xff, 0x41, 0x08, 0xff, 0x41, 0x08, 0xff, 0x61, 0x10, 0xff, 0x82, 0x10, 0xff, 0x82, 0x10, 0xff, 0x81, 0x10, 0xff, 0x61, 0x10, 0xff, 0x61, 0x10, 0xff, 0x61, 0x08, 0xff, 0x61, 0x10, 0xff, 0x61, 0x10, 0xff, 0x61, 0x10, 0xff, 0x61, 0x10, 0xff, 0x61, 0x10, 0xff, 0x41, 0x08, 0xff, 0xef, 0x83, 0xff, 0x73, 0xc5, 0xff, 0xed, 0x9b, 0xff, 0x89, 0x62, 0xff, 0x20, 0x08, 0xff, 0x51, 0x74, 0xff, 0x1c, 0xe7, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xff, 0x3c, 0xef, 0xff, 0x5d, 0xef, 0x94, 0x5d, 0xef, 0x03, 0x5d, 0xef, 0x00, 0x5d, 0xef, 0x00,
-  0x7e, 0xf7, 0x00, 0x7e, 0xf7, 0x00, 0x7e, 0xf7, 0x00, 0x7d, 0xf7, 0x00, 0x7d, 0xf7, 0x53, 0x7d, 0xf7, 0xdb, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x7d, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0xb4, 0xdd, 0xff, 0xb1, 0xed, 0xff, 0x76, 0xf6, 0xff, 0x77, 0xfe, 0xff, 0xd3, 0xf5, 0xff, 0xd8, 0xfe, 0xff, 0x69, 0x62, 0xff, 0x20, 0x00, 0xff, 0x61, 0x10, 0xff, 0x41, 0x08, 0xff, 0x41, 0x08, 0xff, 0x41, 0x08, 0xff, 0x21, 0x08, 0xff, 0x21, 0x08, 0xff, 0x41, 0x08, 0xff, 0x82, 0x10, 0xff, 0xa3, 0x18, 0xff, 0xa2, 0x18, 0xff, 0x82, 0x10, 0xff, 0x61, 0x10, 0xff, 0x61, 0x10, 0xff, 0x61, 0x10, 0xff, 0x61, 0x08, 0xff, 0x41, 0x08, 0xff, 0x41, 0x08, 0xff, 0x61, 0x08, 0xff, 0x21, 0x08, 0xff, 0x8d, 0x83, 0xff, 0x96, 0xfe, 0xff, 0xf7, 0xfe, 0xff, 0x74, 0xfe, 0xff, 0xca, 0xb3, 0xff, 0x70, 0x94, 0xff, 0x1c, 0xe7, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xfb, 0xe6, 0xff, 0x1c, 0xe7, 0xff, 0x3c, 0xe7, 0xdb, 0x3c, 0xef, 0x54, 0x5d, 0xef, 0x00, 0x5d, 0xef, 0x00, 0x5d, 0xef, 0x00, 0x5d, 0xef, 0x00,
-  0x7e, 0xf7, 0x00, 0x7e, 0xf7, 0x00, 0x7e, 0xf7, 0x00, 0x7d, 0xf7, 0x00, 0x7d, 0xf7, 0x00, 0x7d, 0xf7, 0x07, 0x7d, 0xf7, 0x5b, 0x7d, 0xf7, 0xac, 0x7d, 0xf7, 0xdf, 0x5d, 0xef, 0xfb, 0x5d, 0xef, 0xff, 0x5d, 0xef, 0xff, 0xb4, 0xdd, 0xff, 0xd2, 0xed, 0xff, 0x77, 0xfe, 0xff, 0x56, 0xfe, 0xff, 0x6e, 0xd4, 0xff, 0xb7, 0xfe, 0xff, 0x0b, 0x7b, 0xff, 0x20, 0x00, 0xff, 0xa2, 0x10, 0xff, 0x82, 0x10, 0xff, 0x82, 0x10, 0xff, 0x62, 0x10, 0xff, 0x61, 0x10, 0xff, 0x61, 0x10, 0xff, 0x41, 0x08, 0xff, 0x41, 0x08, 0xff, 0x41, 0x08, 0xff, 0x82, 0x10, 0xff, 0x82, 0x10, 0xff, 0x41, 0x08, 0xff, 0x41, 0x08, 0xff, 0x41, 0x08, 0xff, 0x41, 0x08, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0xff, 0x61, 0x08, 0xff, 0x41, 0x08, 0xff, 0x6f, 0xb4, 0xff, 0xd7, 0xfe, 0xff, 0x96, 0xf6, 0xff, 0x33, 0xf6, 0xff, 0xac, 0xd4, 0xff, 0xd1, 0xbc, 0xff, 0xfc, 0xe6, 0xff, 0xdb, 0xde, 0xfb, 0xdb, 0xe6, 0xdf, 0xfb, 0xe6, 0xac, 0x1c, 0xe7, 0x5b, 0x3c, 0xe7, 0x07, 0x3c, 0xef, 0x00, 0x5d, 0xef, 0x00, 0x5d, 0xef, 0x00, 0x5d, 0xef, 0x00, 0x5d, 0xef, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format:  Blue: 5 bit Green: 6 bit, Red: 5 bit, Alpha 8 bit  BUT the 2  color bytes are swapped*/
-  0xf7, 0x7e, 0x00, 0xf7, 0x7e, 0x00, 0xf7, 0x7e, 0x00, 0xf7, 0x7e, 0x00, 0xf7, 0x7e, 0x00, 0xf7, 0x9e, 0x07, 0xf7, 0x7e, 0x50, 0xf7, 0x7e, 0x9b, 0xf7, 0x7e, 0xd0, 0xf7, 0x7e, 0xe8, 0xf7, 0x7e, 0xef, 0xf7, 0x7e, 0xef, 0xf7, 0x7e, 0xef, 0xf7, 0x7d, 0xef, 0xf7, 0x7d, 0xef, 0xf7, 0x7d, 0xef, 0xf7, 0x9e, 0xef, 0xef, 0x7d, 0xef, 0xc5, 0x74, 0xef, 0xb4, 0x2d, 0xef, 0x8a, 0xc9, 0xef, 0x8b, 0x2b, 0xef, 0xcd, 0x31, 0xef, 0xee, 0x55, 0xef, 0xff, 0x3a, 0xef, 0xff, 0x19, 0xef, 0xe6, 0x15, 0xef, 0xe6, 0x56, 0xef, 0xfe, 0xd8, 0xef, 0xfe, 0xf8, 0xef, 0xee, 0x77, 0xef, 0xef, 0x5d, 0xef, 0xf7, 0x7d, 0xef, 0xf7, 0x5d, 0xef, 0xf7, 0x5d, 0xef, 0xf7, 0x5d, 0xef, 0xf7, 0x7d, 0xef, 0xef, 0x7d, 0xef, 0xef, 0x7d, 0xef, 0xef, 0x7d, 0xef, 0xef, 0x7d, 0xef, 0xef, 0x7d, 0xef, 0xef, 0x7d, 0xef, 0xef, 0x7d, 0xef, 0xef, 0x7d, 0xef, 0xef, 0x7d, 0xef, 0xef, 0x7d, 0xe3, 0xef, 0x7d, 0xc8, 0xef, 0x7d, 0x9b, 0xef, 0x5d, 0x4f, 0xef, 0x5d, 0x07, 0xef, 0x5d, 0x00, 0xef, 0x5d, 0x00, 0xef, 0x5d, 0x00, 0xef, 0x5d, 0x00, 0xef, 0x5d, 0x00,
-  0xef, 0x5d, 0x00, 0xef, 0x5d, 0x00, 0xf7, 0x5d, 0x00, 0xf7, 0x5d, 0x00, 0xf7, 0x7d, 0x50, 0xf7, 0x7d, 0xdb, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x9e, 0xff, 0xde, 0x99, 0xff, 0xe6, 0x15, 0xff, 0xee, 0x35, 0xff, 0xbc, 0x0d, 0xff, 0xe5, 0x92, 0xff, 0xff, 0x19, 0xff, 0xff, 0x19, 0xff, 0xfe, 0xb7, 0xff, 0xed, 0xf3, 0xff, 0xe5, 0xb2, 0xff, 0xfe, 0xf8, 0xff, 0xfe, 0xf8, 0xff, 0xac, 0x90, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xdb, 0xef, 0x5c, 0x53, 0xef, 0x3c, 0x00, 0xef, 0x3c, 0x00, 0xef, 0x3c, 0x00, 0xef, 0x3c, 0x00,
-  0xef, 0x5d, 0x00, 0xf7, 0x7d, 0x00, 0xf7, 0x7d, 0x03, 0xf7, 0x7d, 0x88, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xef, 0x3c, 0xff, 0xfe, 0xfa, 0xff, 0xff, 0x7b, 0xff, 0xfe, 0xd7, 0xff, 0xfe, 0x76, 0xff, 0xff, 0x19, 0xff, 0xfe, 0xd8, 0xff, 0xf6, 0x75, 0xff, 0xed, 0xf3, 0xff, 0xdd, 0x91, 0xff, 0xdd, 0x72, 0xff, 0xa3, 0x4a, 0xff, 0x9b, 0x8b, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x3c, 0x88, 0xef, 0x3c, 0x03, 0xef, 0x3c, 0x00, 0xef, 0x3c, 0x00,
-  0xef, 0x5d, 0x00, 0xf7, 0x7d, 0x00, 0xf7, 0x7d, 0x88, 0xf7, 0x7d, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x7d, 0xff, 0xf7, 0x1b, 0xff, 0xff, 0x1a, 0xff, 0xff, 0x3a, 0xff, 0xfe, 0xb7, 0xff, 0xfe, 0xb7, 0xff, 0xfe, 0xb7, 0xff, 0xf6, 0x96, 0xff, 0xf6, 0x75, 0xff, 0xee, 0x34, 0xff, 0xe5, 0xb1, 0xff, 0xb4, 0x0b, 0xff, 0xbc, 0x0b, 0xff, 0xcc, 0xce, 0xff, 0xe6, 0xba, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0x88, 0xef, 0x3c, 0x00, 0xef, 0x3c, 0x00,
-  0xef, 0x5d, 0x00, 0xf7, 0x7d, 0x54, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x7d, 0xff, 0xee, 0xfa, 0xff, 0xdd, 0xb4, 0xff, 0xdd, 0x31, 0xff, 0xfe, 0x96, 0xff, 0xfe, 0xd7, 0xff, 0xfe, 0xd7, 0xff, 0xf6, 0x96, 0xff, 0xee, 0x55, 0xff, 0xee, 0x55, 0xff, 0xdd, 0x91, 0xff, 0x9b, 0x49, 0xff, 0xdd, 0x50, 0xff, 0xdd, 0x70, 0xff, 0xd5, 0xd5, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5c, 0xff, 0xef, 0x3d, 0x54, 0xef, 0x3d, 0x00,
-  0xef, 0x5d, 0x07, 0xf7, 0x7d, 0xe3, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x7d, 0xff, 0xd6, 0x37, 0xff, 0xcc, 0xcf, 0xff, 0xf6, 0x34, 0xff, 0xf6, 0x55, 0xff, 0xfe, 0xf8, 0xff, 0xf6, 0x76, 0xff, 0xf6, 0x96, 0xff, 0xee, 0x34, 0xff, 0x9b, 0x8a, 0xff, 0x8b, 0x08, 0xff, 0xe5, 0x91, 0xff, 0xe5, 0x90, 0xff, 0xcc, 0xef, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xe4, 0xef, 0x3d, 0x07,
-  0xef, 0x5d, 0x54, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x9d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xff, 0xbe, 0xff, 0xef, 0x5d, 0xff, 0xbc, 0x50, 0xff, 0xdc, 0x90, 0xff, 0xed, 0xd2, 0xff, 0xee, 0x54, 0xff, 0xf6, 0x75, 0xff, 0xe6, 0x13, 0xff, 0x8a, 0xe8, 0xff, 0x59, 0x83, 0xff, 0xc4, 0xce, 0xff, 0xe5, 0xd1, 0xff, 0xe5, 0x90, 0xff, 0xc4, 0x6c, 0xff, 0xcd, 0x73, 0xff, 0xde, 0xba, 0xff, 0xe7, 0x1c, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3d, 0x5c,
-  0xf7, 0x7d, 0x9f, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xef, 0x7d, 0xff, 0xff, 0xbe, 0xff, 0xf7, 0x7e, 0xff, 0xb5, 0xb7, 0xff, 0x42, 0x2b, 0xff, 0x39, 0x86, 0xff, 0xdd, 0x70, 0xff, 0xfe, 0xd6, 0xff, 0xee, 0x13, 0xff, 0xcd, 0x0f, 0xff, 0x72, 0x46, 0xff, 0x62, 0x05, 0xff, 0xc4, 0xce, 0xff, 0xe5, 0xd2, 0xff, 0xe5, 0xf2, 0xff, 0xe5, 0x90, 0xff, 0xcc, 0x8c, 0xff, 0xc4, 0x4b, 0xff, 0xe5, 0xb1, 0xff, 0xa4, 0x90, 0xff, 0x84, 0x12, 0xff, 0xe6, 0xfb, 0xff, 0xff, 0xbe, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xac,
-  0xf7, 0x7d, 0xd0, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xdf, 0xff, 0xf7, 0x7e, 0xff, 0xbd, 0xb8, 0xff, 0x52, 0xce, 0xff, 0x10, 0xc7, 0xff, 0x00, 0x45, 0xff, 0x18, 0xa4, 0xff, 0xb4, 0x6d, 0xff, 0xd5, 0x71, 0xff, 0x93, 0x8b, 0xff, 0x38, 0xc2, 0xff, 0x40, 0xe1, 0xff, 0xcd, 0x0f, 0xff, 0xdd, 0x91, 0xff, 0xe5, 0xb1, 0xff, 0xed, 0xf2, 0xff, 0xdd, 0x70, 0xff, 0xd4, 0xed, 0xff, 0xd4, 0xed, 0xff, 0xfe, 0xb4, 0xff, 0xac, 0xb0, 0xff, 0x00, 0x25, 0xff, 0x29, 0x89, 0xff, 0x94, 0xb4, 0xff, 0xef, 0x3c, 0xff, 0xff, 0xbe, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x3d, 0xe0,
-  0xf7, 0x7e, 0xe7, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xff, 0x9e, 0xff, 0xef, 0x5d, 0xff, 0x9c, 0xf5, 0xff, 0x4a, 0xae, 0xff, 0x18, 0xe8, 0xff, 0x10, 0xc8, 0xff, 0x19, 0x08, 0xff, 0x19, 0x08, 0xff, 0x08, 0x86, 0xff, 0x18, 0x62, 0xff, 0x30, 0xc1, 0xff, 0x20, 0x20, 0xff, 0x59, 0x22, 0xff, 0xb3, 0xca, 0xff, 0xc4, 0x8c, 0xff, 0xd5, 0x2f, 0xff, 0xee, 0x13, 0xff, 0xe5, 0xd1, 0xff, 0xdd, 0x90, 0xff, 0xe5, 0xb1, 0xff, 0xee, 0x12, 0xff, 0xf6, 0x94, 0xff, 0x52, 0x6c, 0xff, 0x10, 0xc7, 0xff, 0x08, 0xa6, 0xff, 0x08, 0x86, 0xff, 0x31, 0xca, 0xff, 0x9c, 0xb4, 0xff, 0xef, 0x5d, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x3d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x3d, 0xf8,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xff, 0xbe, 0xff, 0xe7, 0x1c, 0xff, 0x4a, 0x6d, 0xff, 0x10, 0xc7, 0xff, 0x10, 0xe8, 0xff, 0x19, 0x09, 0xff, 0x19, 0x29, 0xff, 0x19, 0x29, 0xff, 0x19, 0x29, 0xff, 0x18, 0xe8, 0xff, 0x00, 0x44, 0xff, 0x00, 0x00, 0xff, 0x59, 0x63, 0xff, 0xc4, 0x2a, 0xff, 0xf6, 0x11, 0xff, 0xee, 0x12, 0xff, 0xe5, 0xd1, 0xff, 0xee, 0x12, 0xff, 0xed, 0xf2, 0xff, 0xf6, 0x53, 0xff, 0xfe, 0xd6, 0xff, 0xee, 0x55, 0xff, 0x62, 0xed, 0xff, 0x10, 0xc7, 0xff, 0x10, 0xe7, 0xff, 0x10, 0xe7, 0xff, 0x10, 0xe7, 0xff, 0x10, 0xc7, 0xff, 0x08, 0x86, 0xff, 0x42, 0x4b, 0xff, 0xc6, 0x39, 0xff, 0xff, 0xbe, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xbf, 0xff, 0x6b, 0x91, 0xff, 0x10, 0xc8, 0xff, 0x21, 0x29, 0xff, 0x21, 0x29, 0xff, 0x21, 0x29, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x49, 0xff, 0x18, 0xe8, 0xff, 0x10, 0xa6, 0xff, 0x18, 0xe6, 0xff, 0x73, 0x0b, 0xff, 0xc5, 0x31, 0xff, 0xee, 0x54, 0xff, 0xf6, 0x54, 0xff, 0xf6, 0x74, 0xff, 0xee, 0x55, 0xff, 0xde, 0x15, 0xff, 0x94, 0x30, 0xff, 0x39, 0xca, 0xff, 0x10, 0xc8, 0xff, 0x10, 0xe7, 0xff, 0x18, 0xe8, 0xff, 0x18, 0xe8, 0xff, 0x19, 0x08, 0xff, 0x19, 0x08, 0xff, 0x19, 0x08, 0xff, 0x08, 0x86, 0xff, 0x10, 0xc6, 0xff, 0xa4, 0xf4, 0xff, 0xff, 0xbe, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xff, 0xbf, 0xff, 0xce, 0x5a, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x49, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x19, 0x29, 0xff, 0x21, 0x49, 0xff, 0x39, 0xeb, 0xff, 0x4a, 0x4c, 0xff, 0x4a, 0x4c, 0xff, 0x42, 0x0b, 0xff, 0x29, 0x6a, 0xff, 0x11, 0x09, 0xff, 0x19, 0x29, 0xff, 0x21, 0x49, 0xff, 0x21, 0x49, 0xff, 0x21, 0x29, 0xff, 0x19, 0x29, 0xff, 0x19, 0x08, 0xff, 0x19, 0x08, 0xff, 0x19, 0x08, 0xff, 0x18, 0xe8, 0xff, 0x08, 0x86, 0xff, 0x18, 0xe7, 0xff, 0xce, 0x7a, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7d, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xff, 0xdf, 0xff, 0x8c, 0x74, 0xff, 0x10, 0xe8, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x4a, 0xff, 0x19, 0x29, 0xff, 0x19, 0x2a, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x49, 0xff, 0x21, 0x49, 0xff, 0x19, 0x29, 0xff, 0x19, 0x29, 0xff, 0x19, 0x29, 0xff, 0x19, 0x29, 0xff, 0x19, 0x08, 0xff, 0x08, 0xa7, 0xff, 0x6b, 0x70, 0xff, 0xff, 0xbe, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xbf, 0xff, 0x63, 0x30, 0xff, 0x19, 0x09, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x29, 0xff, 0x21, 0x49, 0xff, 0x19, 0x29, 0xff, 0x19, 0x08, 0xff, 0x29, 0x8a, 0xff, 0xde, 0xdb, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7d, 0xff, 0x42, 0x6d, 0xff, 0x19, 0x29, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x49, 0xff, 0x19, 0x29, 0xff, 0x19, 0x08, 0xff, 0x10, 0xc8, 0xff, 0xad, 0x56, 0xff, 0xff, 0xbe, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xe7, 0x3d, 0xff, 0x39, 0xec, 0xff, 0x19, 0x29, 0xff, 0x21, 0x49, 0xff, 0x21, 0x6a, 0xff, 0x29, 0x8b, 0xff, 0x21, 0x8b, 0xff, 0x21, 0x8b, 0xff, 0x21, 0x8b, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8b, 0xff, 0x21, 0x8b, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x4a, 0xff, 0x19, 0x29, 0xff, 0x19, 0x09, 0xff, 0x19, 0x08, 0xff, 0x10, 0xa7, 0xff, 0x73, 0xd1, 0xff, 0xff, 0xbe, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xff, 0xff, 0xbe, 0xff, 0xe7, 0x1c, 0xff, 0x31, 0xcb, 0xff, 0x19, 0x09, 0xff, 0x19, 0x08, 0xff, 0x21, 0x49, 0xff, 0x21, 0x8b, 0xff, 0x21, 0x8b, 0xff, 0x21, 0x8b, 0xff, 0x29, 0x8b, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x4a, 0xff, 0x19, 0x08, 0xff, 0x19, 0x08, 0xff, 0x19, 0x08, 0xff, 0x08, 0xa7, 0xff, 0x52, 0xad, 0xff, 0xf7, 0x9d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x3d, 0xff, 0x3a, 0x0c, 0xff, 0x19, 0x08, 0xff, 0x18, 0xe8, 0xff, 0x10, 0xc7, 0xff, 0x21, 0x29, 0xff, 0x21, 0x8b, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x6a, 0xff, 0x3a, 0x6d, 0xff, 0x42, 0x8e, 0xff, 0x3a, 0x4d, 0xff, 0x3a, 0x4d, 0xff, 0x32, 0x2c, 0xff, 0x3a, 0x4d, 0xff, 0x3a, 0x4d, 0xff, 0x3a, 0x2d, 0xff, 0x42, 0xae, 0xff, 0x32, 0x2d, 0xff, 0x42, 0x6d, 0xff, 0x42, 0x8e, 0xff, 0x3a, 0x4d, 0xff, 0x3a, 0x6d, 0xff, 0x32, 0x0c, 0xff, 0x3a, 0x4d, 0xff, 0x29, 0xab, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x49, 0xff, 0x19, 0x08, 0xff, 0x18, 0xe8, 0xff, 0x18, 0xe8, 0xff, 0x10, 0xc7, 0xff, 0x42, 0x4c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7d, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x5d, 0xff, 0x42, 0x4d, 0xff, 0x19, 0x08, 0xff, 0x18, 0xe8, 0xff, 0x10, 0x85, 0xff, 0x10, 0xc7, 0xff, 0x29, 0x8b, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x4a, 0xff, 0x53, 0x30, 0xff, 0x74, 0x74, 0xff, 0x63, 0xb1, 0xff, 0x74, 0x74, 0xff, 0x74, 0x54, 0xff, 0x74, 0x54, 0xff, 0x6c, 0x33, 0xff, 0x74, 0x74, 0xff, 0x63, 0xf2, 0xff, 0x5b, 0xb1, 0xff, 0x63, 0xd2, 0xff, 0x74, 0x74, 0xff, 0x63, 0xb2, 0xff, 0x74, 0x74, 0xff, 0x74, 0x53, 0xff, 0x63, 0xf2, 0xff, 0x29, 0xab, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x6a, 0xff, 0x18, 0xe8, 0xff, 0x10, 0xa6, 0xff, 0x10, 0xc7, 0xff, 0x10, 0xe7, 0xff, 0x10, 0xa7, 0xff, 0x39, 0xeb, 0xff, 0xef, 0x1c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xff, 0x9e, 0xff, 0xe7, 0x1c, 0xff, 0x3a, 0x0c, 0xff, 0x19, 0x29, 0xff, 0x19, 0x09, 0xff, 0x10, 0xc7, 0xff, 0x10, 0xa6, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8b, 0xff, 0x21, 0x6a, 0xff, 0x3a, 0x4d, 0xff, 0x52, 0xef, 0xff, 0x4a, 0xce, 0xff, 0x4a, 0xce, 0xff, 0x4a, 0xce, 0xff, 0x4a, 0xce, 0xff, 0x4a, 0xce, 0xff, 0x52, 0xce, 0xff, 0x4a, 0xae, 0xff, 0x4a, 0xae, 0xff, 0x4a, 0xae, 0xff, 0x52, 0xef, 0xff, 0x4a, 0xae, 0xff, 0x4a, 0xae, 0xff, 0x4a, 0xce, 0xff, 0x42, 0x6d, 0xff, 0x29, 0xab, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x19, 0x29, 0xff, 0x10, 0x85, 0xff, 0x08, 0x65, 0xff, 0x10, 0xa6, 0xff, 0x10, 0xe7, 0xff, 0x10, 0xc7, 0xff, 0x29, 0x89, 0xff, 0xe6, 0xfb, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xff, 0xbe, 0xff, 0xc5, 0xf9, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x49, 0xff, 0x19, 0x08, 0xff, 0x10, 0xa6, 0xff, 0x19, 0x08, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8b, 0xff, 0x4a, 0x8d, 0xff, 0x31, 0xeb, 0xff, 0x31, 0xeb, 0xff, 0x31, 0xec, 0xff, 0x31, 0xcb, 0xff, 0x31, 0xcb, 0xff, 0x31, 0xeb, 0xff, 0x31, 0xeb, 0xff, 0x3a, 0x0c, 0xff, 0x3a, 0x0c, 0xff, 0x3a, 0x0c, 0xff, 0x3a, 0x0c, 0xff, 0x3a, 0x0c, 0xff, 0x31, 0xeb, 0xff, 0x31, 0xeb, 0xff, 0x31, 0xcb, 0xff, 0x29, 0x8a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x4a, 0xff, 0x18, 0xe7, 0xff, 0x08, 0x64, 0xff, 0x10, 0x86, 0xff, 0x18, 0xe7, 0xff, 0x19, 0x08, 0xff, 0x10, 0xc7, 0xff, 0x21, 0x48, 0xff, 0xd6, 0x9a, 0xff, 0xf7, 0x5d, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xff, 0xdf, 0xff, 0x94, 0x94, 0xff, 0x19, 0x29, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x29, 0xff, 0x19, 0x08, 0xff, 0x10, 0xa6, 0xff, 0x10, 0xc6, 0xff, 0x21, 0x6a, 0xff, 0x29, 0x8b, 0xff, 0x4a, 0x8c, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x3a, 0x2c, 0xff, 0x4a, 0x6c, 0xff, 0x41, 0xeb, 0xff, 0x31, 0xcb, 0xff, 0x19, 0x4a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x49, 0xff, 0x10, 0x85, 0xff, 0x08, 0x85, 0xff, 0x10, 0xe7, 0xff, 0x19, 0x08, 0xff, 0x18, 0xe8, 0xff, 0x10, 0xe7, 0xff, 0x19, 0x08, 0xff, 0xc6, 0x19, 0xff, 0xf7, 0x7d, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xbe, 0xff, 0x73, 0x91, 0xff, 0x10, 0xe9, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x49, 0xff, 0x19, 0x08, 0xff, 0x10, 0xc6, 0xff, 0x10, 0x85, 0xff, 0x21, 0x49, 0xff, 0x29, 0xab, 0xff, 0x4a, 0x8d, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x8a, 0xff, 0x31, 0xab, 0xff, 0x62, 0xac, 0xff, 0x63, 0x0d, 0xff, 0x62, 0xcc, 0xff, 0x52, 0x6c, 0xff, 0x31, 0xcb, 0xff, 0x31, 0xeb, 0xff, 0x31, 0xec, 0xff, 0x31, 0xeb, 0xff, 0x31, 0xeb, 0xff, 0x31, 0xcb, 0xff, 0x31, 0xcb, 0xff, 0x31, 0xcb, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x49, 0xff, 0x10, 0x84, 0xff, 0x10, 0x85, 0xff, 0x10, 0xe8, 0xff, 0x19, 0x08, 0xff, 0x19, 0x08, 0xff, 0x19, 0x08, 0xff, 0x10, 0xa7, 0xff, 0xa4, 0xf5, 0xff, 0xf7, 0x7d, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xcd, 0x74, 0xff, 0x62, 0xcc, 0xff, 0x29, 0x6a, 0xff, 0x10, 0xe8, 0xff, 0x10, 0xc7, 0xff, 0x08, 0x86, 0xff, 0x08, 0x64, 0xff, 0x18, 0xe7, 0xff, 0x21, 0x6a, 0xff, 0x4a, 0x8d, 0xff, 0x29, 0x8b, 0xff, 0x21, 0x6a, 0xff, 0x4a, 0xad, 0xff, 0x42, 0x4c, 0xff, 0x42, 0x2c, 0xff, 0x42, 0x4c, 0xff, 0x4a, 0x8d, 0xff, 0x52, 0xce, 0xff, 0x3a, 0x2c, 0xff, 0x3a, 0x4c, 0xff, 0x42, 0x4d, 0xff, 0x42, 0x4c, 0xff, 0x3a, 0x0c, 0xff, 0x32, 0x0b, 0xff, 0x42, 0x4c, 0xff, 0x31, 0xcb, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x49, 0xff, 0x10, 0x85, 0xff, 0x08, 0x65, 0xff, 0x10, 0xc7, 0xff, 0x19, 0x08, 0xff, 0x19, 0x08, 0xff, 0x19, 0x29, 0xff, 0x08, 0xa7, 0xff, 0x63, 0x4f, 0xff, 0xf7, 0x7d, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xe5, 0xf4, 0xff, 0xf5, 0xf1, 0xff, 0xdd, 0xb3, 0xff, 0xbd, 0x13, 0xff, 0xa4, 0x91, 0xff, 0x9b, 0xcd, 0xff, 0x39, 0x45, 0xff, 0x10, 0xc7, 0xff, 0x21, 0x4a, 0xff, 0x42, 0x6c, 0xff, 0x63, 0x0e, 0xff, 0x29, 0xcb, 0xff, 0x42, 0x6d, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x6a, 0xff, 0x19, 0x4a, 0xff, 0x29, 0xab, 0xff, 0x4a, 0x6c, 0xff, 0x29, 0x89, 0xff, 0x31, 0xaa, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x6a, 0xff, 0x29, 0xcb, 0xff, 0x3a, 0x2b, 0xff, 0x31, 0xcb, 0xff, 0x21, 0x4a, 0xff, 0x19, 0x29, 0xff, 0x10, 0xa5, 0xff, 0x08, 0x64, 0xff, 0x10, 0xc7, 0xff, 0x18, 0xe8, 0xff, 0x18, 0xe8, 0xff, 0x10, 0xc7, 0xff, 0x08, 0x86, 0xff, 0x6b, 0x2e, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x1c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xdd, 0xb3, 0xff, 0xed, 0xb0, 0xff, 0xfe, 0x94, 0xff, 0xff, 0x18, 0xff, 0xff, 0x17, 0xff, 0xed, 0x90, 0xff, 0x41, 0x86, 0xff, 0x18, 0xe7, 0xff, 0x21, 0x6a, 0xff, 0x42, 0x4c, 0xff, 0x7b, 0xf1, 0xff, 0x5a, 0xee, 0xff, 0x42, 0x6d, 0xff, 0x29, 0xab, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x6a, 0xff, 0x31, 0xec, 0xff, 0x5a, 0xcb, 0xff, 0x5a, 0xeb, 0xff, 0x63, 0x0c, 0xff, 0x42, 0x4b, 0xff, 0x29, 0xab, 0xff, 0x29, 0xaa, 0xff, 0x4a, 0x8c, 0xff, 0x52, 0xac, 0xff, 0x31, 0xcb, 0xff, 0x21, 0x49, 0xff, 0x18, 0xe8, 0xff, 0x29, 0x47, 0xff, 0x29, 0x06, 0xff, 0x10, 0xc7, 0xff, 0x19, 0x08, 0xff, 0x29, 0x68, 0xff, 0x42, 0x0a, 0xff, 0x93, 0x6b, 0xff, 0xcc, 0xf0, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x1c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xdd, 0x93, 0xff, 0xe5, 0x6f, 0xff, 0xf6, 0x74, 0xff, 0xfe, 0xf8, 0xff, 0xfe, 0xd6, 0xff, 0xd5, 0x0e, 0xff, 0x41, 0xe9, 0xff, 0x18, 0xe8, 0xff, 0x21, 0x49, 0xff, 0x42, 0x2c, 0xff, 0x73, 0xd0, 0xff, 0x73, 0x8f, 0xff, 0x42, 0x4c, 0xff, 0x29, 0xab, 0xff, 0x21, 0x6a, 0xff, 0x42, 0x4c, 0xff, 0x4a, 0xad, 0xff, 0x42, 0x6c, 0xff, 0x4a, 0x6d, 0xff, 0x4a, 0x8d, 0xff, 0x42, 0x6d, 0xff, 0x52, 0xad, 0xff, 0x31, 0xcb, 0xff, 0x4a, 0x8c, 0xff, 0x4a, 0x8c, 0xff, 0x29, 0x8a, 0xff, 0x19, 0x08, 0xff, 0x10, 0xc7, 0xff, 0x4a, 0x08, 0xff, 0x83, 0x09, 0xff, 0xc4, 0xef, 0xff, 0xd5, 0xb3, 0xff, 0xe5, 0xf3, 0xff, 0xee, 0x12, 0xff, 0xed, 0x8f, 0xff, 0xc4, 0xcf, 0xff, 0xe6, 0xfb, 0xff, 0xe6, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xdd, 0x93, 0xff, 0xe5, 0x6f, 0xff, 0xf6, 0x94, 0xff, 0xfe, 0xd7, 0xff, 0xf6, 0x74, 0xff, 0xc4, 0x6c, 0xff, 0x4a, 0x2b, 0xff, 0x18, 0xe8, 0xff, 0x21, 0x28, 0xff, 0x4a, 0x8d, 0xff, 0x6b, 0x6f, 0xff, 0x63, 0x4e, 0xff, 0x52, 0xad, 0xff, 0x29, 0xab, 0xff, 0x21, 0x6a, 0xff, 0x42, 0x4c, 0xff, 0x29, 0xab, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x19, 0x4a, 0xff, 0x3a, 0x2c, 0xff, 0x42, 0x6c, 0xff, 0x52, 0xcd, 0xff, 0x52, 0xcc, 0xff, 0x21, 0x49, 0xff, 0x10, 0xa6, 0xff, 0x10, 0xa6, 0xff, 0x41, 0xe8, 0xff, 0x83, 0x09, 0xff, 0xe5, 0x90, 0xff, 0xfe, 0x95, 0xff, 0xfe, 0x95, 0xff, 0xf6, 0x33, 0xff, 0xdd, 0x2e, 0xff, 0xc4, 0x8e, 0xff, 0xe6, 0xfb, 0xff, 0xe6, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x1c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xdd, 0xb4, 0xff, 0xe5, 0x6f, 0xff, 0xf6, 0x54, 0xff, 0xfe, 0xb6, 0xff, 0xed, 0xf2, 0xff, 0xb3, 0xeb, 0xff, 0x52, 0xad, 0xff, 0x19, 0x08, 0xff, 0x21, 0x28, 0xff, 0x4a, 0x8d, 0xff, 0x31, 0xcb, 0xff, 0x29, 0xaa, 0xff, 0x4a, 0x8d, 0xff, 0x29, 0x8b, 0xff, 0x21, 0x6a, 0xff, 0x42, 0x4c, 0xff, 0x29, 0xab, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x6a, 0xff, 0x42, 0x2c, 0xff, 0x3a, 0x0b, 0xff, 0x29, 0x8a, 0xff, 0x39, 0xea, 0xff, 0x21, 0x48, 0xff, 0x08, 0x65, 0xff, 0x08, 0x85, 0xff, 0x41, 0xc8, 0xff, 0x7a, 0xe9, 0xff, 0xd4, 0xcd, 0xff, 0xf6, 0x33, 0xff, 0xf6, 0x54, 0xff, 0xee, 0x13, 0xff, 0xe5, 0x2f, 0xff, 0xbc, 0x8e, 0xff, 0xe6, 0xdb, 0xff, 0xe6, 0xfb, 0xff, 0xe7, 0x1b, 0xff, 0xef, 0x1c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xdd, 0xd4, 0xff, 0xed, 0xb0, 0xff, 0xf6, 0x13, 0xff, 0xed, 0xf2, 0xff, 0xe5, 0x4f, 0xff, 0xa3, 0xcb, 0xff, 0x6b, 0x70, 0xff, 0x19, 0x08, 0xff, 0x21, 0x08, 0xff, 0x42, 0x4c, 0xff, 0x21, 0x29, 0xff, 0x19, 0x29, 0xff, 0x42, 0x4c, 0xff, 0x29, 0xab, 0xff, 0x29, 0x6a, 0xff, 0x42, 0x4c, 0xff, 0x4a, 0x8d, 0xff, 0x42, 0x6c, 0xff, 0x3a, 0x2c, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x3a, 0x0c, 0xff, 0x29, 0x8a, 0xff, 0x19, 0x29, 0xff, 0x29, 0x8a, 0xff, 0x21, 0x48, 0xff, 0x10, 0x85, 0xff, 0x08, 0x65, 0xff, 0x4a, 0x09, 0xff, 0x72, 0xea, 0xff, 0xc4, 0x4c, 0xff, 0xed, 0xd2, 0xff, 0xf6, 0x33, 0xff, 0xed, 0xf2, 0xff, 0xe5, 0x4f, 0xff, 0xc4, 0xcf, 0xff, 0xde, 0xdb, 0xff, 0xe6, 0xfb, 0xff, 0xe7, 0x1b, 0xff, 0xef, 0x1c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xdd, 0x92, 0xff, 0xf6, 0x12, 0xff, 0xf6, 0x33, 0xff, 0xed, 0x90, 0xff, 0xdd, 0x0e, 0xff, 0xb4, 0x4d, 0xff, 0x6b, 0x90, 0xff, 0x19, 0x08, 0xff, 0x21, 0x08, 0xff, 0x42, 0x4c, 0xff, 0x21, 0x49, 0xff, 0x19, 0x29, 0xff, 0x4a, 0x6c, 0xff, 0x42, 0x0a, 0xff, 0x41, 0xca, 0xff, 0x5a, 0xec, 0xff, 0x39, 0xc9, 0xff, 0x29, 0xab, 0xff, 0x21, 0x8a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x3a, 0x0b, 0xff, 0x21, 0x69, 0xff, 0x19, 0x08, 0xff, 0x29, 0x89, 0xff, 0x21, 0x48, 0xff, 0x10, 0xa6, 0xff, 0x08, 0x65, 0xff, 0x4a, 0x09, 0xff, 0x7b, 0x2b, 0xff, 0xab, 0xaa, 0xff, 0xe5, 0x70, 0xff, 0xed, 0xd1, 0xff, 0xed, 0xd1, 0xff, 0xed, 0xb0, 0xff, 0xcc, 0xef, 0xff, 0xde, 0xdb, 0xff, 0xe6, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x1c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x3c, 0xff, 0xe5, 0x71, 0xff, 0xfe, 0x74, 0xff, 0xf6, 0x74, 0xff, 0xed, 0xf2, 0xff, 0xed, 0xb1, 0xff, 0xcc, 0xf0, 0xff, 0x52, 0xce, 0xff, 0x19, 0x29, 0xff, 0x21, 0x08, 0xff, 0x42, 0x2b, 0xff, 0x21, 0x49, 0xff, 0x19, 0x09, 0xff, 0x4a, 0x4c, 0xff, 0x41, 0xea, 0xff, 0x39, 0x89, 0xff, 0x52, 0x6c, 0xff, 0x39, 0xca, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x4a, 0xff, 0x39, 0xeb, 0xff, 0x21, 0x29, 0xff, 0x10, 0xc7, 0xff, 0x29, 0x89, 0xff, 0x21, 0x48, 0xff, 0x10, 0xa6, 0xff, 0x10, 0xa7, 0xff, 0x4a, 0x09, 0xff, 0x7b, 0x6c, 0xff, 0xab, 0xab, 0xff, 0xd4, 0xcd, 0xff, 0xdc, 0xee, 0xff, 0xed, 0xd2, 0xff, 0xf6, 0x12, 0xff, 0xcc, 0xce, 0xff, 0xde, 0x9a, 0xff, 0xe6, 0xfb, 0xff, 0xe7, 0x1b, 0xff, 0xef, 0x1c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xee, 0xfb, 0xff, 0xe5, 0x50, 0xff, 0xfe, 0x53, 0xff, 0xf6, 0x74, 0xff, 0xed, 0xf2, 0xff, 0xf6, 0x12, 0xff, 0xd5, 0x10, 0xff, 0x42, 0x0b, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x08, 0xff, 0x42, 0x2b, 0xff, 0x19, 0x29, 0xff, 0x19, 0x09, 0xff, 0x42, 0x2b, 0xff, 0x4a, 0x4b, 0xff, 0x4a, 0x4b, 0xff, 0x5a, 0xcc, 0xff, 0x42, 0x4b, 0xff, 0x42, 0x4c, 0xff, 0x3a, 0x0b, 0xff, 0x3a, 0x0b, 0xff, 0x42, 0x0b, 0xff, 0x4a, 0x4c, 0xff, 0x21, 0x28, 0xff, 0x10, 0xa7, 0xff, 0x29, 0x89, 0xff, 0x21, 0x28, 0xff, 0x10, 0xc7, 0xff, 0x10, 0xc7, 0xff, 0x4a, 0x09, 0xff, 0x83, 0x6c, 0xff, 0xbc, 0x4d, 0xff, 0xed, 0x91, 0xff, 0xe5, 0x4f, 0xff, 0xf6, 0x13, 0xff, 0xf6, 0x54, 0xff, 0xd4, 0xee, 0xff, 0xd6, 0x58, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1b, 0xff, 0xef, 0x1c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xe6, 0xb9, 0xff, 0xe5, 0x2f, 0xff, 0xfe, 0x53, 0xff, 0xfe, 0x74, 0xff, 0xed, 0xf2, 0xff, 0xed, 0xd2, 0xff, 0xd5, 0x30, 0xff, 0x42, 0x0b, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x08, 0xff, 0x42, 0x0b, 0xff, 0x19, 0x29, 0xff, 0x19, 0x08, 0xff, 0x19, 0x08, 0xff, 0x21, 0x49, 0xff, 0x21, 0x6a, 0xff, 0x29, 0x8a, 0xff, 0x4a, 0x8c, 0xff, 0x42, 0x2c, 0xff, 0x21, 0x6a, 0xff, 0x29, 0x8a, 0xff, 0x29, 0xaa, 0xff, 0x29, 0x8a, 0xff, 0x29, 0x48, 0xff, 0x21, 0x27, 0xff, 0x31, 0xa9, 0xff, 0x21, 0x48, 0xff, 0x10, 0xc7, 0xff, 0x10, 0xc7, 0xff, 0x4a, 0x2a, 0xff, 0x83, 0xad, 0xff, 0xc4, 0x8d, 0xff, 0xf6, 0x13, 0xff, 0xed, 0xd2, 0xff, 0xf6, 0x54, 0xff, 0xfe, 0x95, 0xff, 0xdd, 0x0e, 0xff, 0xd6, 0x17, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1b, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xe6, 0x78, 0xff, 0xe5, 0x0e, 0xff, 0xfe, 0x74, 0xff, 0xfe, 0x95, 0xff, 0xf6, 0x33, 0xff, 0xed, 0x91, 0xff, 0xd5, 0x30, 0xff, 0x4a, 0x2c, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x08, 0xff, 0x39, 0xea, 0xff, 0x19, 0x09, 0xff, 0x11, 0x08, 0xff, 0x21, 0x49, 0xff, 0x29, 0x89, 0xff, 0x29, 0x49, 0xff, 0x29, 0xaa, 0xff, 0x39, 0xea, 0xff, 0x31, 0xca, 0xff, 0x10, 0xe9, 0xff, 0x19, 0x09, 0xff, 0x21, 0x4a, 0xff, 0x19, 0x4a, 0xff, 0x29, 0x69, 0xff, 0x29, 0x47, 0xff, 0x29, 0x89, 0xff, 0x21, 0x48, 0xff, 0x10, 0xe7, 0xff, 0x08, 0x86, 0xff, 0x52, 0x6a, 0xff, 0x8b, 0xee, 0xff, 0xc4, 0xce, 0xff, 0xed, 0xd1, 0xff, 0xed, 0xf2, 0xff, 0xf6, 0x95, 0xff, 0xfe, 0x95, 0xff, 0xdc, 0xed, 0xff, 0xcd, 0xd5, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1b, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xe6, 0x78, 0xff, 0xdc, 0xee, 0xff, 0xf6, 0x54, 0xff, 0xfe, 0xb6, 0xff, 0xf6, 0x54, 0xff, 0xe5, 0x70, 0xff, 0xd5, 0x0f, 0xff, 0x4a, 0x4c, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x28, 0xff, 0x4a, 0x4b, 0xff, 0x42, 0x2b, 0xff, 0x3a, 0x0b, 0xff, 0x52, 0x4b, 0xff, 0x4a, 0x6c, 0xff, 0x4a, 0x0b, 0xff, 0x4a, 0x2b, 0xff, 0x3a, 0x2a, 0xff, 0x42, 0x4b, 0xff, 0x31, 0xca, 0xff, 0x39, 0xeb, 0xff, 0x3a, 0x0b, 0xff, 0x31, 0xcb, 0xff, 0x39, 0xca, 0xff, 0x39, 0xa9, 0xff, 0x31, 0xa9, 0xff, 0x29, 0x69, 0xff, 0x18, 0xe8, 0xff, 0x10, 0xa6, 0xff, 0x6b, 0x0c, 0xff, 0x94, 0x30, 0xff, 0xc4, 0xae, 0xff, 0xed, 0xb0, 0xff, 0xee, 0x13, 0xff, 0xfe, 0x95, 0xff, 0xf6, 0x74, 0xff, 0xd4, 0xad, 0xff, 0xc5, 0x74, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1b, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xe6, 0xba, 0xff, 0xd4, 0xad, 0xff, 0xf5, 0xf2, 0xff, 0xfe, 0x75, 0xff, 0xf6, 0x74, 0xff, 0xe5, 0x90, 0xff, 0xd4, 0xce, 0xff, 0x4a, 0x4b, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x29, 0xff, 0x29, 0x69, 0xff, 0x39, 0xcb, 0xff, 0x31, 0xcb, 0xff, 0x31, 0xaa, 0xff, 0x31, 0xaa, 0xff, 0x31, 0xab, 0xff, 0x29, 0x8a, 0xff, 0x29, 0xaa, 0xff, 0x29, 0x8a, 0xff, 0x31, 0xaa, 0xff, 0x31, 0xa9, 0xff, 0x29, 0x69, 0xff, 0x29, 0x8a, 0xff, 0x31, 0xaa, 0xff, 0x29, 0x89, 0xff, 0x21, 0x28, 0xff, 0x21, 0x29, 0xff, 0x21, 0x29, 0xff, 0x10, 0xc6, 0xff, 0x73, 0x6e, 0xff, 0x9c, 0x91, 0xff, 0xbc, 0x8e, 0xff, 0xe5, 0x6f, 0xff, 0xee, 0x13, 0xff, 0xf6, 0x74, 0xff, 0xf6, 0x33, 0xff, 0xcc, 0x4b, 0xff, 0xbd, 0x33, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x3c, 0xff, 0xd4, 0xce, 0xff, 0xed, 0xd1, 0xff, 0xf6, 0x74, 0xff, 0xf6, 0x74, 0xff, 0xe5, 0x70, 0xff, 0xcc, 0xad, 0xff, 0x52, 0x4b, 0xff, 0x19, 0x4a, 0xff, 0x21, 0x49, 0xff, 0x19, 0x08, 0xff, 0x19, 0x29, 0xff, 0x19, 0x29, 0xff, 0x19, 0x09, 0xff, 0x19, 0x29, 0xff, 0x19, 0x29, 0xff, 0x21, 0x49, 0xff, 0x19, 0x29, 0xff, 0x19, 0x08, 0xff, 0x18, 0xe8, 0xff, 0x10, 0xc7, 0xff, 0x08, 0x65, 0xff, 0x10, 0xe7, 0xff, 0x19, 0x29, 0xff, 0x19, 0x09, 0xff, 0x10, 0xc7, 0xff, 0x19, 0x08, 0xff, 0x18, 0xe7, 0xff, 0x10, 0xa6, 0xff, 0x7b, 0xae, 0xff, 0xa4, 0xd2, 0xff, 0xbc, 0x6d, 0xff, 0xe5, 0x2f, 0xff, 0xf6, 0x13, 0xff, 0xf6, 0x54, 0xff, 0xf5, 0xf2, 0xff, 0xcc, 0x0a, 0xff, 0xbd, 0x33, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xef, 0x7e, 0xff, 0xd5, 0x10, 0xff, 0xe5, 0x4f, 0xff, 0xf6, 0x54, 0xff, 0xf6, 0x54, 0xff, 0xe5, 0x6f, 0xff, 0xc4, 0x6c, 0xff, 0x52, 0x4b, 0xff, 0x19, 0x2a, 0xff, 0x21, 0x49, 0xff, 0x19, 0x08, 0xff, 0x21, 0x29, 0xff, 0x19, 0x29, 0xff, 0x19, 0x29, 0xff, 0x19, 0x09, 0xff, 0x19, 0x49, 0xff, 0x21, 0x49, 0xff, 0x21, 0x29, 0xff, 0x19, 0x08, 0xff, 0x19, 0x08, 0xff, 0x19, 0x08, 0xff, 0x10, 0xa6, 0xff, 0x10, 0x86, 0xff, 0x19, 0x08, 0xff, 0x21, 0x29, 0xff, 0x18, 0xe8, 0xff, 0x18, 0xe7, 0xff, 0x18, 0xc7, 0xff, 0x10, 0xc7, 0xff, 0x83, 0xcf, 0xff, 0xad, 0x13, 0xff, 0xb4, 0x0c, 0xff, 0xdd, 0x2f, 0xff, 0xf6, 0x33, 0xff, 0xf6, 0x34, 0xff, 0xed, 0xb1, 0xff, 0xc3, 0xea, 0xff, 0xc5, 0x54, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x9e, 0xff, 0xd5, 0x53, 0xff, 0xdc, 0xcd, 0xff, 0xf6, 0x33, 0xff, 0xf6, 0x54, 0xff, 0xe5, 0x6f, 0xff, 0xbc, 0x0b, 0xff, 0x31, 0x68, 0xff, 0x19, 0x4a, 0xff, 0x21, 0x6a, 0xff, 0x19, 0x08, 0xff, 0x19, 0x29, 0xff, 0x19, 0x29, 0xff, 0x19, 0x08, 0xff, 0x19, 0x08, 0xff, 0x19, 0x29, 0xff, 0x19, 0x29, 0xff, 0x21, 0x29, 0xff, 0x19, 0x29, 0xff, 0x19, 0x29, 0xff, 0x21, 0x49, 0xff, 0x18, 0xe8, 0xff, 0x08, 0x45, 0xff, 0x10, 0xa6, 0xff, 0x21, 0x49, 0xff, 0x19, 0x08, 0xff, 0x10, 0xc7, 0xff, 0x10, 0xc7, 0xff, 0x19, 0x08, 0xff, 0x8c, 0x10, 0xff, 0xb5, 0x34, 0xff, 0xa3, 0xec, 0xff, 0xdd, 0x0e, 0xff, 0xf6, 0x34, 0xff, 0xf6, 0x33, 0xff, 0xed, 0x6f, 0xff, 0xbb, 0xa9, 0xff, 0xc5, 0xb6, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x9e, 0xff, 0xd5, 0xf6, 0xff, 0xd4, 0x8c, 0xff, 0xed, 0xf2, 0xff, 0xf6, 0x33, 0xff, 0xe5, 0x4f, 0xff, 0xa3, 0x6a, 0xff, 0x21, 0x27, 0xff, 0x19, 0x29, 0xff, 0x21, 0x6a, 0xff, 0x19, 0x08, 0xff, 0x19, 0x29, 0xff, 0x19, 0x29, 0xff, 0x19, 0x08, 0xff, 0x19, 0x08, 0xff, 0x19, 0x28, 0xff, 0x19, 0x29, 0xff, 0x19, 0x29, 0xff, 0x19, 0x29, 0xff, 0x19, 0x49, 0xff, 0x19, 0x29, 0xff, 0x21, 0x49, 0xff, 0x10, 0xa6, 0xff, 0x08, 0x85, 0xff, 0x19, 0x08, 0xff, 0x21, 0x6a, 0xff, 0x19, 0x29, 0xff, 0x18, 0xe7, 0xff, 0x10, 0xc7, 0xff, 0x83, 0xef, 0xff, 0xbd, 0x75, 0xff, 0xac, 0x2e, 0xff, 0xd4, 0xac, 0xff, 0xf6, 0x33, 0xff, 0xf6, 0x33, 0xff, 0xe5, 0x0e, 0xff, 0xb3, 0x89, 0xff, 0xce, 0x17, 0xff, 0xe6, 0xfb, 0xff, 0xe6, 0xfc, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7e, 0xff, 0xde, 0x99, 0xff, 0xcc, 0x4c, 0xff, 0xed, 0x90, 0xff, 0xed, 0xf1, 0xff, 0xe5, 0x2e, 0xff, 0x82, 0xa8, 0xff, 0x10, 0xa6, 0xff, 0x10, 0xc7, 0xff, 0x21, 0x49, 0xff, 0x19, 0x28, 0xff, 0x19, 0x08, 0xff, 0x19, 0x29, 0xff, 0x19, 0x29, 0xff, 0x19, 0x29, 0xff, 0x21, 0x49, 0xff, 0x19, 0x29, 0xff, 0x19, 0x29, 0xff, 0x19, 0x29, 0xff, 0x18, 0xe8, 0xff, 0x10, 0xe7, 0xff, 0x21, 0x29, 0xff, 0x19, 0x09, 0xff, 0x08, 0x85, 0xff, 0x08, 0x85, 0xff, 0x19, 0x08, 0xff, 0x21, 0x49, 0xff, 0x18, 0xe7, 0xff, 0x10, 0xc7, 0xff, 0x7b, 0xaf, 0xff, 0xbd, 0xb6, 0xff, 0xac, 0x70, 0xff, 0xcc, 0x4b, 0xff, 0xf6, 0x13, 0xff, 0xf5, 0xf2, 0xff, 0xdc, 0xcd, 0xff, 0xab, 0x8a, 0xff, 0xd6, 0x59, 0xff, 0xe6, 0xdb, 0xff, 0xe6, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7e, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x3d, 0xff, 0xc4, 0x6e, 0xff, 0xe4, 0xee, 0xff, 0xed, 0xf2, 0xff, 0xe5, 0x2e, 0xff, 0x72, 0x26, 0xff, 0x19, 0x08, 0xff, 0x21, 0x49, 0xff, 0x18, 0xe7, 0xff, 0x21, 0x49, 0xff, 0x19, 0x08, 0xff, 0x19, 0x29, 0xff, 0x19, 0x08, 0xff, 0x19, 0x29, 0xff, 0x21, 0x49, 0xff, 0x21, 0x49, 0xff, 0x19, 0x29, 0xff, 0x19, 0x28, 0xff, 0x18, 0xe8, 0xff, 0x10, 0xc7, 0xff, 0x19, 0x29, 0xff, 0x21, 0x4a, 0xff, 0x10, 0xc7, 0xff, 0x08, 0x44, 0xff, 0x08, 0x65, 0xff, 0x19, 0x08, 0xff, 0x19, 0x28, 0xff, 0x10, 0xe8, 0xff, 0x7b, 0xaf, 0xff, 0xbd, 0xd6, 0xff, 0xb4, 0xd2, 0xff, 0xc4, 0x2b, 0xff, 0xee, 0x12, 0xff, 0xf5, 0xf2, 0xff, 0xd4, 0x4b, 0xff, 0xab, 0xec, 0xff, 0xd6, 0x9a, 0xff, 0xe6, 0xdb, 0xff, 0xe6, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7d, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x7e, 0xff, 0xc4, 0xf1, 0xff, 0xd4, 0x6b, 0xff, 0xf6, 0x12, 0xff, 0xe5, 0x4f, 0xff, 0x61, 0xe6, 0xff, 0x19, 0x29, 0xff, 0x29, 0xab, 0xff, 0x19, 0x29, 0xff, 0x19, 0x08, 0xff, 0x19, 0x08, 0xff, 0x19, 0x29, 0xff, 0x19, 0x29, 0xff, 0x19, 0x08, 0xff, 0x19, 0x29, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x29, 0xff, 0x19, 0x08, 0xff, 0x19, 0x08, 0xff, 0x10, 0xe7, 0xff, 0x10, 0xe8, 0xff, 0x21, 0x49, 0xff, 0x21, 0x4a, 0xff, 0x10, 0xc7, 0xff, 0x08, 0x44, 0xff, 0x08, 0x65, 0xff, 0x21, 0x29, 0xff, 0x19, 0x09, 0xff, 0x6b, 0x4e, 0xff, 0xc5, 0xd6, 0xff, 0xb5, 0x34, 0xff, 0xc4, 0x2b, 0xff, 0xed, 0xf2, 0xff, 0xed, 0xf2, 0xff, 0xcc, 0x2a, 0xff, 0xb4, 0x4f, 0xff, 0xde, 0xdb, 0xff, 0xe6, 0xdb, 0xff, 0xe6, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7d, 0xec, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x7e, 0xff, 0xcd, 0x74, 0xff, 0xc4, 0x2b, 0xff, 0xf6, 0x12, 0xff, 0xed, 0x90, 0xff, 0x6a, 0x07, 0xff, 0x11, 0x08, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x8a, 0xff, 0x19, 0x49, 0xff, 0x19, 0x29, 0xff, 0x21, 0x29, 0xff, 0x19, 0x29, 0xff, 0x19, 0x09, 0xff, 0x19, 0x29, 0xff, 0x21, 0x49, 0xff, 0x21, 0x4a, 0xff, 0x19, 0x29, 0xff, 0x10, 0xe7, 0xff, 0x10, 0xe7, 0xff, 0x10, 0xc7, 0xff, 0x19, 0x08, 0xff, 0x21, 0x49, 0xff, 0x21, 0x4a, 0xff, 0x19, 0x29, 0xff, 0x10, 0xc7, 0xff, 0x10, 0x86, 0xff, 0x10, 0xc7, 0xff, 0x73, 0x6f, 0xff, 0xc5, 0xd6, 0xff, 0xbd, 0x95, 0xff, 0xbc, 0x0b, 0xff, 0xed, 0xb1, 0xff, 0xed, 0xb1, 0xff, 0xbb, 0xc9, 0xff, 0xbc, 0xf2, 0xff, 0xde, 0xdb, 0xff, 0xe6, 0xdb, 0xff, 0xe6, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff,
-  0xf7, 0x7d, 0xe0, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x7e, 0xff, 0xd5, 0xf7, 0xff, 0xbb, 0xeb, 0xff, 0xf6, 0x13, 0xff, 0xed, 0xb1, 0xff, 0x61, 0xe6, 0xff, 0x11, 0x09, 0xff, 0x19, 0x29, 0xff, 0x19, 0x29, 0xff, 0x21, 0x8b, 0xff, 0x21, 0x49, 0xff, 0x19, 0x28, 0xff, 0x19, 0x29, 0xff, 0x19, 0x08, 0xff, 0x19, 0x08, 0xff, 0x19, 0x29, 0xff, 0x19, 0x29, 0xff, 0x21, 0x49, 0xff, 0x18, 0xe8, 0xff, 0x10, 0xc6, 0xff, 0x10, 0xc6, 0xff, 0x10, 0xe7, 0xff, 0x19, 0x08, 0xff, 0x21, 0x49, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x29, 0xff, 0x08, 0x86, 0xff, 0x73, 0x6f, 0xff, 0xc5, 0xd6, 0xff, 0xbd, 0xd6, 0xff, 0xbc, 0x0c, 0xff, 0xe5, 0x90, 0xff, 0xed, 0x90, 0xff, 0xab, 0x48, 0xff, 0xc5, 0x75, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xe6, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xf8,
-  0xf7, 0x7e, 0xcb, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7d, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x7e, 0xff, 0xd6, 0x58, 0xff, 0xb3, 0xaa, 0xff, 0xf6, 0x12, 0xff, 0xfe, 0x74, 0xff, 0x62, 0x27, 0xff, 0x08, 0xa7, 0xff, 0x21, 0x6a, 0xff, 0x18, 0xe8, 0xff, 0x18, 0xe8, 0xff, 0x19, 0x08, 0xff, 0x10, 0xe7, 0xff, 0x19, 0x28, 0xff, 0x19, 0x08, 0xff, 0x19, 0x08, 0xff, 0x19, 0x08, 0xff, 0x19, 0x29, 0xff, 0x21, 0x49, 0xff, 0x21, 0x49, 0xff, 0x18, 0xe8, 0xff, 0x10, 0xa6, 0xff, 0x10, 0xa6, 0xff, 0x10, 0xc7, 0xff, 0x19, 0x08, 0xff, 0x19, 0x29, 0xff, 0x19, 0x29, 0xff, 0x19, 0x08, 0xff, 0x10, 0xc7, 0xff, 0x4a, 0x4c, 0xff, 0xbd, 0xb6, 0xff, 0xc5, 0xf7, 0xff, 0xab, 0xcb, 0xff, 0xe5, 0x70, 0xff, 0xe5, 0x50, 0xff, 0xa3, 0x08, 0xff, 0xc5, 0xd6, 0xff, 0xde, 0xda, 0xff, 0xde, 0xda, 0xff, 0xe6, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xe0,
-  0xf7, 0x7e, 0x9f, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xde, 0xba, 0xff, 0xc4, 0x2c, 0xff, 0xf5, 0xf2, 0xff, 0xfe, 0xf7, 0xff, 0xa3, 0xed, 0xff, 0x10, 0xc7, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x49, 0xff, 0x10, 0xc7, 0xff, 0x10, 0xa6, 0xff, 0x10, 0xc7, 0xff, 0x19, 0x08, 0xff, 0x19, 0x08, 0xff, 0x19, 0x08, 0xff, 0x19, 0x28, 0xff, 0x19, 0x29, 0xff, 0x19, 0x29, 0xff, 0x21, 0x49, 0xff, 0x19, 0x29, 0xff, 0x18, 0xe8, 0xff, 0x10, 0xc7, 0xff, 0x10, 0xa6, 0xff, 0x10, 0xc7, 0xff, 0x19, 0x08, 0xff, 0x19, 0x29, 0xff, 0x19, 0x29, 0xff, 0x19, 0x09, 0xff, 0x39, 0xeb, 0xff, 0xbd, 0x95, 0xff, 0xc6, 0x18, 0xff, 0xb4, 0x0d, 0xff, 0xed, 0xb1, 0xff, 0xe5, 0x0e, 0xff, 0x9a, 0xe8, 0xff, 0xce, 0x18, 0xff, 0xde, 0xba, 0xff, 0xde, 0xba, 0xff, 0xe6, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xac,
-  0xf7, 0x7e, 0x54, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x9d, 0xff, 0xf7, 0x7d, 0xff, 0xef, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xe6, 0xdb, 0xff, 0xcc, 0xad, 0xff, 0xf5, 0xf2, 0xff, 0xfe, 0xf7, 0xff, 0xdd, 0xb3, 0xff, 0x18, 0xe6, 0xff, 0x19, 0x4a, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x49, 0xff, 0x19, 0x08, 0xff, 0x10, 0xa6, 0xff, 0x10, 0xc7, 0xff, 0x10, 0xe8, 0xff, 0x19, 0x08, 0xff, 0x19, 0x28, 0xff, 0x19, 0x08, 0xff, 0x19, 0x29, 0xff, 0x19, 0x29, 0xff, 0x19, 0x29, 0xff, 0x19, 0x29, 0xff, 0x19, 0x08, 0xff, 0x18, 0xe7, 0xff, 0x10, 0xc7, 0xff, 0x10, 0xe7, 0xff, 0x19, 0x08, 0xff, 0x19, 0x28, 0xff, 0x10, 0xe8, 0xff, 0x31, 0xaa, 0xff, 0xb5, 0x75, 0xff, 0xce, 0x18, 0xff, 0xbc, 0x6e, 0xff, 0xf5, 0xf2, 0xff, 0xdc, 0xcd, 0xff, 0xa3, 0x28, 0xff, 0xd6, 0x59, 0xff, 0xde, 0xba, 0xff, 0xde, 0xba, 0xff, 0xe6, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x1c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0x5c,
-  0xf7, 0x7e, 0x07, 0xf7, 0x7e, 0xe3, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x3c, 0xff, 0xd4, 0xef, 0xff, 0xed, 0x91, 0xff, 0xfe, 0xb7, 0xff, 0xfe, 0xd7, 0xff, 0x72, 0xec, 0xff, 0x11, 0x09, 0xff, 0x21, 0x6a, 0xff, 0x21, 0x4a, 0xff, 0x19, 0x29, 0xff, 0x19, 0x08, 0xff, 0x10, 0xc7, 0xff, 0x10, 0xc7, 0xff, 0x10, 0xc7, 0xff, 0x19, 0x08, 0xff, 0x19, 0x29, 0xff, 0x19, 0x29, 0xff, 0x19, 0x29, 0xff, 0x21, 0x29, 0xff, 0x19, 0x49, 0xff, 0x19, 0x29, 0xff, 0x19, 0x29, 0xff, 0x19, 0x49, 0xff, 0x19, 0x29, 0xff, 0x19, 0x08, 0xff, 0x19, 0x08, 0xff, 0x10, 0xe7, 0xff, 0x29, 0x47, 0xff, 0xb5, 0x54, 0xff, 0xc6, 0x18, 0xff, 0xcd, 0x31, 0xff, 0xfe, 0x54, 0xff, 0xdc, 0xad, 0xff, 0xa3, 0x69, 0xff, 0xd6, 0x79, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xba, 0xff, 0xe6, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xe4, 0xef, 0x5d, 0x07,
-  0xf7, 0x7e, 0x00, 0xf7, 0x7e, 0x54, 0xf7, 0x7e, 0xff, 0xf7, 0x7e, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x9e, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xdd, 0x92, 0xff, 0xed, 0x90, 0xff, 0xfe, 0xb7, 0xff, 0xfe, 0xf8, 0xff, 0xee, 0x35, 0xff, 0x39, 0xa8, 0xff, 0x10, 0xe7, 0xff, 0x19, 0x08, 0xff, 0x19, 0x29, 0xff, 0x19, 0x29, 0xff, 0x10, 0xc7, 0xff, 0x10, 0xe7, 0xff, 0x11, 0x08, 0xff, 0x19, 0x08, 0xff, 0x19, 0x49, 0xff, 0x19, 0x49, 0xff, 0x21, 0x49, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x4a, 0xff, 0x21, 0x4a, 0xff, 0x19, 0x29, 0xff, 0x19, 0x08, 0xff, 0x18, 0xe7, 0xff, 0x10, 0xc6, 0xff, 0x10, 0xa5, 0xff, 0x10, 0x62, 0xff, 0x18, 0x82, 0xff, 0xa4, 0xf3, 0xff, 0xbd, 0xb6, 0xff, 0xc5, 0x10, 0xff, 0xfe, 0xb6, 0xff, 0xe5, 0x0e, 0xff, 0xa3, 0x49, 0xff, 0xd6, 0x99, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xda, 0xff, 0xe6, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0x54, 0xef, 0x5d, 0x00,
-  0xf7, 0x7e, 0x00, 0xf7, 0x7e, 0x00, 0xf7, 0x7e, 0x8b, 0xf7, 0x7e, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xd5, 0x92, 0xff, 0xed, 0xb0, 0xff, 0xfe, 0x96, 0xff, 0xfe, 0xb7, 0xff, 0xff, 0x18, 0xff, 0x9b, 0xed, 0xff, 0x08, 0x20, 0xff, 0x10, 0x82, 0xff, 0x10, 0x83, 0xff, 0x08, 0x84, 0xff, 0x08, 0x64, 0xff, 0x10, 0x85, 0xff, 0x10, 0xc6, 0xff, 0x10, 0xc6, 0xff, 0x10, 0xc6, 0xff, 0x18, 0xe6, 0xff, 0x10, 0xc6, 0xff, 0x10, 0xc5, 0xff, 0x10, 0xa4, 0xff, 0x10, 0x83, 0xff, 0x10, 0x83, 0xff, 0x10, 0x62, 0xff, 0x10, 0x61, 0xff, 0x10, 0x61, 0xff, 0x10, 0x61, 0xff, 0x10, 0x61, 0xff, 0x10, 0x61, 0xff, 0x9c, 0xb2, 0xff, 0x94, 0x71, 0xff, 0x18, 0xa3, 0xff, 0x5a, 0xa9, 0xff, 0x51, 0xc5, 0xff, 0x63, 0x0b, 0xff, 0xd6, 0xba, 0xff, 0xe6, 0xdb, 0xff, 0xde, 0xda, 0xff, 0xe6, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0x8b, 0xef, 0x5d, 0x00, 0xef, 0x5d, 0x00,
-  0xf7, 0x7e, 0x00, 0xf7, 0x7e, 0x00, 0xf7, 0x7e, 0x03, 0xf7, 0x7e, 0x93, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xdd, 0xb3, 0xff, 0xed, 0xb1, 0xff, 0xf6, 0x75, 0xff, 0xfe, 0xb7, 0xff, 0xfe, 0xb7, 0xff, 0xe5, 0xf5, 0xff, 0x20, 0xc3, 0xff, 0x08, 0x41, 0xff, 0x08, 0x41, 0xff, 0x08, 0x40, 0xff, 0x08, 0x41, 0xff, 0x08, 0x41, 0xff, 0x08, 0x41, 0xff, 0x08, 0x41, 0xff, 0x10, 0x61, 0xff, 0x10, 0x82, 0xff, 0x10, 0x82, 0xff, 0x10, 0x81, 0xff, 0x10, 0x61, 0xff, 0x10, 0x61, 0xff, 0x08, 0x61, 0xff, 0x10, 0x61, 0xff, 0x10, 0x61, 0xff, 0x10, 0x61, 0xff, 0x10, 0x61, 0xff, 0x10, 0x61, 0xff, 0x08, 0x41, 0xff, 0x83, 0xef, 0xff, 0xc5, 0x73, 0xff, 0x9b, 0xed, 0xff, 0x62, 0x89, 0xff, 0x08, 0x20, 0xff, 0x74, 0x51, 0xff, 0xe7, 0x1c, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xe6, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xff, 0xef, 0x3c, 0xff, 0xef, 0x5d, 0x94, 0xef, 0x5d, 0x03, 0xef, 0x5d, 0x00, 0xef, 0x5d, 0x00,
-  0xf7, 0x7e, 0x00, 0xf7, 0x7e, 0x00, 0xf7, 0x7e, 0x00, 0xf7, 0x7d, 0x00, 0xf7, 0x7d, 0x53, 0xf7, 0x7d, 0xdb, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xf7, 0x7d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xdd, 0xb4, 0xff, 0xed, 0xb1, 0xff, 0xf6, 0x76, 0xff, 0xfe, 0x77, 0xff, 0xf5, 0xd3, 0xff, 0xfe, 0xd8, 0xff, 0x62, 0x69, 0xff, 0x00, 0x20, 0xff, 0x10, 0x61, 0xff, 0x08, 0x41, 0xff, 0x08, 0x41, 0xff, 0x08, 0x41, 0xff, 0x08, 0x21, 0xff, 0x08, 0x21, 0xff, 0x08, 0x41, 0xff, 0x10, 0x82, 0xff, 0x18, 0xa3, 0xff, 0x18, 0xa2, 0xff, 0x10, 0x82, 0xff, 0x10, 0x61, 0xff, 0x10, 0x61, 0xff, 0x10, 0x61, 0xff, 0x08, 0x61, 0xff, 0x08, 0x41, 0xff, 0x08, 0x41, 0xff, 0x08, 0x61, 0xff, 0x08, 0x21, 0xff, 0x83, 0x8d, 0xff, 0xfe, 0x96, 0xff, 0xfe, 0xf7, 0xff, 0xfe, 0x74, 0xff, 0xb3, 0xca, 0xff, 0x94, 0x70, 0xff, 0xe7, 0x1c, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xe6, 0xfb, 0xff, 0xe7, 0x1c, 0xff, 0xe7, 0x3c, 0xdb, 0xef, 0x3c, 0x54, 0xef, 0x5d, 0x00, 0xef, 0x5d, 0x00, 0xef, 0x5d, 0x00, 0xef, 0x5d, 0x00,
-  0xf7, 0x7e, 0x00, 0xf7, 0x7e, 0x00, 0xf7, 0x7e, 0x00, 0xf7, 0x7d, 0x00, 0xf7, 0x7d, 0x00, 0xf7, 0x7d, 0x07, 0xf7, 0x7d, 0x5b, 0xf7, 0x7d, 0xac, 0xf7, 0x7d, 0xdf, 0xef, 0x5d, 0xfb, 0xef, 0x5d, 0xff, 0xef, 0x5d, 0xff, 0xdd, 0xb4, 0xff, 0xed, 0xd2, 0xff, 0xfe, 0x77, 0xff, 0xfe, 0x56, 0xff, 0xd4, 0x6e, 0xff, 0xfe, 0xb7, 0xff, 0x7b, 0x0b, 0xff, 0x00, 0x20, 0xff, 0x10, 0xa2, 0xff, 0x10, 0x82, 0xff, 0x10, 0x82, 0xff, 0x10, 0x62, 0xff, 0x10, 0x61, 0xff, 0x10, 0x61, 0xff, 0x08, 0x41, 0xff, 0x08, 0x41, 0xff, 0x08, 0x41, 0xff, 0x10, 0x82, 0xff, 0x10, 0x82, 0xff, 0x08, 0x41, 0xff, 0x08, 0x41, 0xff, 0x08, 0x41, 0xff, 0x08, 0x41, 0xff, 0x08, 0x61, 0xff, 0x08, 0x61, 0xff, 0x08, 0x61, 0xff, 0x08, 0x41, 0xff, 0xb4, 0x6f, 0xff, 0xfe, 0xd7, 0xff, 0xf6, 0x96, 0xff, 0xf6, 0x33, 0xff, 0xd4, 0xac, 0xff, 0xbc, 0xd1, 0xff, 0xe6, 0xfc, 0xff, 0xde, 0xdb, 0xfb, 0xe6, 0xdb, 0xdf, 0xe6, 0xfb, 0xac, 0xe7, 0x1c, 0x5b, 0xe7, 0x3c, 0x07, 0xef, 0x3c, 0x00, 0xef, 0x5d, 0x00, 0xef, 0x5d, 0x00, 0xef, 0x5d, 0x00, 0xef, 0x5d, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 32
-  /*Pixel format:  Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha: 8 bit*/
-  0xed, 0xeb, 0xed, 0x00, 0xed, 0xec, 0xee, 0x00, 0xed, 0xec, 0xee, 0x00, 0xed, 0xec, 0xee, 0x00, 0xed, 0xed, 0xef, 0x00, 0xee, 0xef, 0xf0, 0x07, 0xed, 0xee, 0xf0, 0x50, 0xed, 0xee, 0xf1, 0x9b, 0xed, 0xee, 0xf1, 0xd0, 0xed, 0xee, 0xf1, 0xe8, 0xed, 0xee, 0xf1, 0xef, 0xed, 0xee, 0xf1, 0xef, 0xed, 0xee, 0xf0, 0xef, 0xec, 0xee, 0xef, 0xef, 0xec, 0xee, 0xef, 0xef, 0xec, 0xee, 0xef, 0xef, 0xed, 0xef, 0xef, 0xef, 0xea, 0xec, 0xeb, 0xef, 0xa3, 0xad, 0xbd, 0xef, 0x6c, 0x86, 0xb3, 0xef, 0x47, 0x57, 0x89, 0xef, 0x57, 0x64, 0x89, 0xef, 0x8b, 0xa3, 0xcc, 0xef, 0xac, 0xc7, 0xe9, 0xef, 0xcd, 0xe3, 0xf9, 0xef, 0xca, 0xe1, 0xfb, 0xef, 0xa7, 0xc2, 0xe2, 0xef, 0xae, 0xc7, 0xe3, 0xef, 0xc3, 0xda, 0xf7, 0xef, 0xc1, 0xdb, 0xfa, 0xef, 0xbc, 0xcd, 0xea, 0xef, 0xe7, 0xe7, 0xea, 0xef, 0xea, 0xeb, 0xed, 0xef, 0xea, 0xea, 0xee, 0xef, 0xea, 0xea, 0xed, 0xef, 0xea, 0xea, 0xee, 0xef, 0xea, 0xeb, 0xee, 0xef, 0xea, 0xeb, 0xec, 0xef, 0xea, 0xeb, 0xec, 0xef, 0xea, 0xeb, 0xec, 0xef, 0xea, 0xeb, 0xec, 0xef, 0xea, 0xeb, 0xec, 0xef, 0xea, 0xeb, 0xec, 0xef, 0xea, 0xeb, 0xec, 0xef, 0xea, 0xeb, 0xec, 0xef, 0xea, 0xeb, 0xec, 0xef, 0xea, 0xeb, 0xec, 0xe3, 0xea, 0xeb, 0xec, 0xc8, 0xe9, 0xeb, 0xec, 0x9b, 0xea, 0xea, 0xeb, 0x4f, 0xe9, 0xea, 0xeb, 0x07, 0xe8, 0xea, 0xea, 0x00, 0xe8, 0xea, 0xea, 0x00, 0xe7, 0xe9, 0xea, 0x00, 0xe7, 0xe9, 0xea, 0x00, 0xe7, 0xe9, 0xe9, 0x00,
-  0xea, 0xe9, 0xeb, 0x00, 0xeb, 0xea, 0xec, 0x00, 0xeb, 0xea, 0xed, 0x00, 0xeb, 0xea, 0xed, 0x00, 0xeb, 0xeb, 0xed, 0x50, 0xec, 0xed, 0xf0, 0xdb, 0xeb, 0xed, 0xf1, 0xff, 0xeb, 0xed, 0xf0, 0xff, 0xeb, 0xec, 0xf0, 0xff, 0xeb, 0xec, 0xf0, 0xff, 0xeb, 0xec, 0xf0, 0xff, 0xeb, 0xec, 0xef, 0xff, 0xeb, 0xed, 0xee, 0xff, 0xea, 0xec, 0xed, 0xff, 0xea, 0xec, 0xed, 0xff, 0xea, 0xec, 0xed, 0xff, 0xe9, 0xec, 0xed, 0xff, 0xef, 0xf0, 0xf0, 0xff, 0xca, 0xd0, 0xd8, 0xff, 0xa8, 0xc0, 0xe1, 0xff, 0xab, 0xc6, 0xec, 0xff, 0x66, 0x80, 0xb7, 0xff, 0x93, 0xb0, 0xdd, 0xff, 0xc6, 0xdf, 0xf9, 0xff, 0xc9, 0xe0, 0xfc, 0xff, 0xb6, 0xd5, 0xf7, 0xff, 0x98, 0xbe, 0xe6, 0xff, 0x8f, 0xb5, 0xe0, 0xff, 0xbf, 0xdd, 0xfd, 0xff, 0xc4, 0xdc, 0xfb, 0xff, 0x81, 0x8f, 0xac, 0xff, 0xe6, 0xe6, 0xe8, 0xff, 0xe6, 0xe7, 0xeb, 0xff, 0xe6, 0xe7, 0xea, 0xff, 0xe6, 0xe8, 0xeb, 0xff, 0xe7, 0xe8, 0xec, 0xff, 0xe7, 0xe8, 0xeb, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe6, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe6, 0xe8, 0xe9, 0xff, 0xe6, 0xe8, 0xe9, 0xff, 0xe7, 0xe7, 0xe9, 0xff, 0xe6, 0xe7, 0xe8, 0xdb, 0xe4, 0xe7, 0xe8, 0x53, 0xe4, 0xe6, 0xe7, 0x00, 0xe3, 0xe5, 0xe7, 0x00, 0xe3, 0xe6, 0xe7, 0x00, 0xe3, 0xe5, 0xe6, 0x00,
-  0xeb, 0xea, 0xec, 0x00, 0xec, 0xeb, 0xed, 0x00, 0xec, 0xeb, 0xed, 0x03, 0xec, 0xeb, 0xed, 0x88, 0xed, 0xec, 0xed, 0xff, 0xed, 0xee, 0xf0, 0xff, 0xec, 0xee, 0xf1, 0xff, 0xec, 0xed, 0xf1, 0xff, 0xec, 0xee, 0xf0, 0xff, 0xec, 0xed, 0xf0, 0xff, 0xec, 0xed, 0xf0, 0xff, 0xec, 0xed, 0xef, 0xff, 0xeb, 0xec, 0xef, 0xff, 0xeb, 0xed, 0xee, 0xff, 0xea, 0xec, 0xed, 0xff, 0xea, 0xec, 0xed, 0xff, 0xea, 0xec, 0xed, 0xff, 0xec, 0xed, 0xed, 0xff, 0xdf, 0xe3, 0xeb, 0xff, 0xd0, 0xde, 0xf8, 0xff, 0xda, 0xec, 0xff, 0xff, 0xbb, 0xd7, 0xfa, 0xff, 0xae, 0xcd, 0xf6, 0xff, 0xc7, 0xdf, 0xfc, 0xff, 0xbd, 0xd9, 0xf9, 0xff, 0xaa, 0xce, 0xf3, 0xff, 0x99, 0xbe, 0xe6, 0xff, 0x87, 0xaf, 0xdb, 0xff, 0x90, 0xad, 0xd7, 0xff, 0x54, 0x6a, 0x9f, 0xff, 0x59, 0x71, 0x98, 0xff, 0xe7, 0xe9, 0xeb, 0xff, 0xe6, 0xe7, 0xeb, 0xff, 0xe5, 0xe7, 0xea, 0xff, 0xe6, 0xe7, 0xea, 0xff, 0xe6, 0xe7, 0xea, 0xff, 0xe6, 0xe8, 0xeb, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe6, 0xe8, 0xe9, 0xff, 0xe8, 0xe7, 0xe9, 0xff, 0xe5, 0xe7, 0xe8, 0xff, 0xe5, 0xe7, 0xe8, 0xff, 0xe4, 0xe6, 0xe7, 0x88, 0xe4, 0xe6, 0xe7, 0x03, 0xe4, 0xe6, 0xe7, 0x00, 0xe4, 0xe6, 0xe7, 0x00,
-  0xec, 0xea, 0xec, 0x00, 0xec, 0xeb, 0xed, 0x00, 0xec, 0xeb, 0xed, 0x88, 0xec, 0xeb, 0xed, 0xff, 0xed, 0xec, 0xee, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xed, 0xee, 0xf0, 0xff, 0xec, 0xee, 0xf0, 0xff, 0xec, 0xee, 0xef, 0xff, 0xec, 0xee, 0xef, 0xff, 0xec, 0xed, 0xf0, 0xff, 0xec, 0xee, 0xf0, 0xff, 0xeb, 0xec, 0xf0, 0xff, 0xeb, 0xed, 0xee, 0xff, 0xea, 0xed, 0xee, 0xff, 0xeb, 0xec, 0xed, 0xff, 0xec, 0xeb, 0xec, 0xff, 0xeb, 0xec, 0xec, 0xff, 0xdb, 0xe1, 0xef, 0xff, 0xd1, 0xe2, 0xff, 0xff, 0xd1, 0xe3, 0xff, 0xff, 0xb9, 0xd4, 0xfb, 0xff, 0xb7, 0xd3, 0xf9, 0xff, 0xbb, 0xd6, 0xfa, 0xff, 0xae, 0xd1, 0xf3, 0xff, 0xa8, 0xcc, 0xee, 0xff, 0xa1, 0xc4, 0xe7, 0xff, 0x8a, 0xb3, 0xdd, 0xff, 0x58, 0x7f, 0xb3, 0xff, 0x5a, 0x82, 0xb9, 0xff, 0x6f, 0x97, 0xc7, 0xff, 0xce, 0xd4, 0xdd, 0xff, 0xe7, 0xe7, 0xea, 0xff, 0xe3, 0xe4, 0xe8, 0xff, 0xe4, 0xe5, 0xe8, 0xff, 0xe4, 0xe6, 0xe8, 0xff, 0xe4, 0xe7, 0xe8, 0xff, 0xe6, 0xe7, 0xe9, 0xff, 0xe7, 0xe8, 0xeb, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe8, 0xe9, 0xff, 0xe5, 0xe8, 0xe8, 0xff, 0xe5, 0xe7, 0xe8, 0xff, 0xe5, 0xe7, 0xe8, 0xff, 0xe4, 0xe6, 0xe7, 0xff, 0xe4, 0xe6, 0xe7, 0x88, 0xe4, 0xe6, 0xe7, 0x00, 0xe4, 0xe6, 0xe7, 0x00,
-  0xec, 0xea, 0xec, 0x00, 0xec, 0xeb, 0xed, 0x54, 0xec, 0xeb, 0xed, 0xff, 0xec, 0xeb, 0xed, 0xff, 0xed, 0xec, 0xee, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xed, 0xee, 0xef, 0xff, 0xec, 0xee, 0xef, 0xff, 0xec, 0xee, 0xf0, 0xff, 0xec, 0xee, 0xf0, 0xff, 0xec, 0xed, 0xef, 0xff, 0xeb, 0xed, 0xef, 0xff, 0xeb, 0xed, 0xee, 0xff, 0xeb, 0xed, 0xee, 0xff, 0xeb, 0xed, 0xee, 0xff, 0xeb, 0xeb, 0xed, 0xff, 0xe9, 0xea, 0xeb, 0xff, 0xeb, 0xec, 0xeb, 0xff, 0xd3, 0xdb, 0xea, 0xff, 0xa2, 0xb5, 0xdc, 0xff, 0x8c, 0xa6, 0xd6, 0xff, 0xb0, 0xcf, 0xf6, 0xff, 0xba, 0xd8, 0xfa, 0xff, 0xbc, 0xd8, 0xf8, 0xff, 0xb2, 0xd1, 0xf2, 0xff, 0xa6, 0xc9, 0xec, 0xff, 0xa7, 0xc9, 0xec, 0xff, 0x88, 0xb1, 0xdc, 0xff, 0x47, 0x6a, 0x9b, 0xff, 0x7d, 0xa7, 0xd6, 0xff, 0x81, 0xad, 0xdb, 0xff, 0xa5, 0xb9, 0xd1, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xe2, 0xe3, 0xe7, 0xff, 0xe2, 0xe3, 0xe7, 0xff, 0xe3, 0xe4, 0xe8, 0xff, 0xe3, 0xe5, 0xe7, 0xff, 0xe4, 0xe6, 0xe7, 0xff, 0xe6, 0xe8, 0xe9, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe8, 0xe9, 0xea, 0xff, 0xe8, 0xe8, 0xe9, 0xff, 0xe8, 0xe7, 0xe9, 0xff, 0xe6, 0xe7, 0xe8, 0xff, 0xe6, 0xe7, 0xe8, 0xff, 0xe5, 0xe7, 0xe8, 0xff, 0xe4, 0xe6, 0xe7, 0xff, 0xe4, 0xe7, 0xe8, 0xff, 0xe5, 0xe6, 0xe7, 0x54, 0xe5, 0xe5, 0xe7, 0x00,
-  0xec, 0xea, 0xec, 0x07, 0xec, 0xeb, 0xed, 0xe3, 0xec, 0xeb, 0xed, 0xff, 0xec, 0xeb, 0xed, 0xff, 0xed, 0xec, 0xee, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xed, 0xef, 0xf0, 0xff, 0xec, 0xee, 0xf0, 0xff, 0xec, 0xed, 0xf0, 0xff, 0xec, 0xee, 0xf0, 0xff, 0xec, 0xee, 0xef, 0xff, 0xec, 0xee, 0xf0, 0xff, 0xeb, 0xee, 0xee, 0xff, 0xeb, 0xed, 0xee, 0xff, 0xea, 0xec, 0xed, 0xff, 0xea, 0xea, 0xec, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xeb, 0xec, 0xec, 0xff, 0xbb, 0xc3, 0xcf, 0xff, 0x79, 0x99, 0xcb, 0xff, 0xa1, 0xc4, 0xed, 0xff, 0xaa, 0xca, 0xee, 0xff, 0xc1, 0xdc, 0xf7, 0xff, 0xb0, 0xcd, 0xed, 0xff, 0xb2, 0xcf, 0xee, 0xff, 0x9f, 0xc6, 0xeb, 0xff, 0x4e, 0x70, 0x9c, 0xff, 0x40, 0x60, 0x8c, 0xff, 0x85, 0xb0, 0xdd, 0xff, 0x82, 0xaf, 0xdd, 0xff, 0x7c, 0x9e, 0xc5, 0xff, 0xe4, 0xe3, 0xe5, 0xff, 0xe7, 0xe7, 0xe9, 0xff, 0xe4, 0xe5, 0xe8, 0xff, 0xe3, 0xe4, 0xe8, 0xff, 0xe3, 0xe4, 0xe8, 0xff, 0xe4, 0xe6, 0xe7, 0xff, 0xe5, 0xe7, 0xe8, 0xff, 0xe6, 0xe8, 0xe9, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe8, 0xe9, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xe8, 0xe7, 0xe9, 0xff, 0xe8, 0xe7, 0xe9, 0xff, 0xe6, 0xe6, 0xe8, 0xff, 0xe5, 0xe7, 0xe8, 0xff, 0xe4, 0xe7, 0xe7, 0xff, 0xe4, 0xe6, 0xe7, 0xff, 0xe4, 0xe6, 0xe7, 0xff, 0xe4, 0xe6, 0xe7, 0xe4, 0xe6, 0xe5, 0xe7, 0x07,
-  0xec, 0xea, 0xec, 0x54, 0xec, 0xeb, 0xed, 0xff, 0xec, 0xeb, 0xed, 0xff, 0xec, 0xeb, 0xed, 0xff, 0xed, 0xec, 0xee, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xee, 0xee, 0xf0, 0xff, 0xed, 0xef, 0xf0, 0xff, 0xed, 0xef, 0xef, 0xff, 0xec, 0xee, 0xef, 0xff, 0xec, 0xef, 0xf0, 0xff, 0xec, 0xee, 0xee, 0xff, 0xeb, 0xed, 0xee, 0xff, 0xea, 0xec, 0xed, 0xff, 0xe9, 0xea, 0xeb, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xf1, 0xf3, 0xf5, 0xff, 0xea, 0xea, 0xe9, 0xff, 0x82, 0x8a, 0xba, 0xff, 0x7d, 0x91, 0xdb, 0xff, 0x94, 0xb7, 0xe5, 0xff, 0xa4, 0xca, 0xeb, 0xff, 0xac, 0xcd, 0xee, 0xff, 0x9b, 0xbf, 0xe3, 0xff, 0x41, 0x5d, 0x86, 0xff, 0x18, 0x2f, 0x57, 0xff, 0x6f, 0x97, 0xc1, 0xff, 0x8b, 0xb7, 0xe1, 0xff, 0x84, 0xb2, 0xde, 0xff, 0x5f, 0x8e, 0xc1, 0xff, 0x98, 0xad, 0xca, 0xff, 0xd1, 0xd5, 0xdc, 0xff, 0xe0, 0xdf, 0xe2, 0xff, 0xed, 0xf0, 0xf4, 0xff, 0xe7, 0xe9, 0xeb, 0xff, 0xe4, 0xe6, 0xe7, 0xff, 0xe4, 0xe6, 0xe7, 0xff, 0xe5, 0xe7, 0xe8, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xea, 0xe8, 0xea, 0xff, 0xe8, 0xe7, 0xe9, 0xff, 0xe8, 0xe7, 0xe9, 0xff, 0xe8, 0xe6, 0xe8, 0xff, 0xe6, 0xe6, 0xe8, 0xff, 0xe4, 0xe6, 0xe7, 0xff, 0xe5, 0xe7, 0xe8, 0xff, 0xe4, 0xe6, 0xe7, 0xff, 0xe4, 0xe6, 0xe7, 0xff, 0xe5, 0xe5, 0xe7, 0x5c,
-  0xec, 0xeb, 0xed, 0x9f, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xee, 0xed, 0xef, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xed, 0xef, 0xf0, 0xff, 0xed, 0xef, 0xf0, 0xff, 0xec, 0xee, 0xef, 0xff, 0xec, 0xee, 0xf0, 0xff, 0xec, 0xee, 0xef, 0xff, 0xeb, 0xed, 0xee, 0xff, 0xea, 0xeb, 0xed, 0xff, 0xea, 0xeb, 0xec, 0xff, 0xf0, 0xf3, 0xf5, 0xff, 0xee, 0xee, 0xf0, 0xff, 0xbc, 0xb3, 0xb2, 0xff, 0x5a, 0x45, 0x43, 0xff, 0x32, 0x2f, 0x3b, 0xff, 0x84, 0xab, 0xdb, 0xff, 0xb3, 0xd8, 0xf8, 0xff, 0x9a, 0xc2, 0xe6, 0xff, 0x76, 0xa0, 0xc9, 0xff, 0x30, 0x49, 0x6e, 0xff, 0x2a, 0x40, 0x63, 0xff, 0x73, 0x9a, 0xc4, 0xff, 0x8e, 0xb8, 0xe0, 0xff, 0x91, 0xbc, 0xe4, 0xff, 0x82, 0xb2, 0xde, 0xff, 0x5f, 0x90, 0xc6, 0xff, 0x59, 0x8a, 0xc3, 0xff, 0x87, 0xb6, 0xdd, 0xff, 0x81, 0x90, 0xa4, 0xff, 0x90, 0x82, 0x81, 0xff, 0xdb, 0xdb, 0xde, 0xff, 0xf0, 0xf3, 0xf5, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe5, 0xe7, 0xe8, 0xff, 0xe6, 0xe8, 0xe9, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe8, 0xe8, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xe8, 0xe7, 0xe9, 0xff, 0xe8, 0xe7, 0xe9, 0xff, 0xe7, 0xe6, 0xe8, 0xff, 0xe7, 0xe6, 0xe8, 0xff, 0xe6, 0xe6, 0xe8, 0xff, 0xe5, 0xe7, 0xe8, 0xff, 0xe4, 0xe7, 0xe7, 0xff, 0xe4, 0xe6, 0xe7, 0xff, 0xe4, 0xe6, 0xe7, 0xac,
-  0xec, 0xeb, 0xed, 0xd0, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xee, 0xed, 0xef, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xed, 0xee, 0xf1, 0xff, 0xed, 0xee, 0xf1, 0xff, 0xec, 0xef, 0xef, 0xff, 0xec, 0xee, 0xf1, 0xff, 0xeb, 0xec, 0xf0, 0xff, 0xed, 0xef, 0xf1, 0xff, 0xf5, 0xf7, 0xf9, 0xff, 0xee, 0xee, 0xf0, 0xff, 0xc0, 0xb6, 0xb5, 0xff, 0x71, 0x57, 0x52, 0xff, 0x39, 0x18, 0x11, 0xff, 0x28, 0x09, 0x02, 0xff, 0x23, 0x15, 0x18, 0xff, 0x6a, 0x8b, 0xb3, 0xff, 0x89, 0xac, 0xd4, 0xff, 0x55, 0x71, 0x94, 0xff, 0x0d, 0x1a, 0x39, 0xff, 0x0b, 0x1c, 0x43, 0xff, 0x78, 0xa1, 0xcc, 0xff, 0x87, 0xb1, 0xdb, 0xff, 0x8a, 0xb5, 0xde, 0xff, 0x93, 0xbe, 0xe6, 0xff, 0x7d, 0xae, 0xda, 0xff, 0x6a, 0x9d, 0xd0, 0xff, 0x6c, 0x9e, 0xd4, 0xff, 0x9e, 0xd4, 0xfd, 0xff, 0x81, 0x94, 0xa8, 0xff, 0x2a, 0x06, 0x00, 0xff, 0x48, 0x30, 0x2b, 0xff, 0x9d, 0x95, 0x94, 0xff, 0xe3, 0xe6, 0xe8, 0xff, 0xf1, 0xf5, 0xf6, 0xff, 0xe8, 0xeb, 0xec, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe8, 0xe9, 0xea, 0xff, 0xe8, 0xe8, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xe8, 0xe7, 0xe9, 0xff, 0xe8, 0xe7, 0xe9, 0xff, 0xe8, 0xe7, 0xe9, 0xff, 0xe8, 0xe6, 0xe8, 0xff, 0xe7, 0xe6, 0xe8, 0xff, 0xe5, 0xe7, 0xe8, 0xff, 0xe5, 0xe7, 0xe8, 0xff, 0xe5, 0xe6, 0xe8, 0xe0,
-  0xed, 0xeb, 0xed, 0xe7, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xee, 0xed, 0xef, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xee, 0xee, 0xf0, 0xff, 0xed, 0xee, 0xf1, 0xff, 0xed, 0xef, 0xf1, 0xff, 0xec, 0xee, 0xf1, 0xff, 0xec, 0xec, 0xf1, 0xff, 0xef, 0xf2, 0xf6, 0xff, 0xe7, 0xe7, 0xe9, 0xff, 0xaa, 0x9d, 0x9a, 0xff, 0x6f, 0x53, 0x4b, 0xff, 0x43, 0x1e, 0x15, 0xff, 0x3e, 0x1a, 0x10, 0xff, 0x42, 0x21, 0x18, 0xff, 0x41, 0x20, 0x17, 0xff, 0x2e, 0x11, 0x0a, 0xff, 0x14, 0x0d, 0x16, 0xff, 0x0c, 0x18, 0x34, 0xff, 0x00, 0x03, 0x1f, 0xff, 0x11, 0x25, 0x55, 0xff, 0x4f, 0x79, 0xb1, 0xff, 0x64, 0x8f, 0xc3, 0xff, 0x79, 0xa6, 0xd4, 0xff, 0x95, 0xc0, 0xe8, 0xff, 0x8b, 0xb9, 0xe2, 0xff, 0x7d, 0xaf, 0xda, 0xff, 0x86, 0xb5, 0xdf, 0xff, 0x8f, 0xc0, 0xeb, 0xff, 0xa3, 0xcf, 0xf2, 0xff, 0x5e, 0x4c, 0x4d, 0xff, 0x3a, 0x18, 0x0d, 0xff, 0x33, 0x14, 0x0c, 0xff, 0x2d, 0x0f, 0x06, 0xff, 0x50, 0x3a, 0x34, 0xff, 0x9f, 0x96, 0x96, 0xff, 0xe8, 0xea, 0xec, 0xff, 0xef, 0xf2, 0xf3, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe8, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xe8, 0xe7, 0xe9, 0xff, 0xe8, 0xe7, 0xe9, 0xff, 0xe8, 0xe7, 0xe9, 0xff, 0xe8, 0xe7, 0xe9, 0xff, 0xe7, 0xe6, 0xe8, 0xff, 0xe7, 0xe7, 0xe8, 0xff, 0xe7, 0xe6, 0xe8, 0xf8,
-  0xed, 0xeb, 0xed, 0xec, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xee, 0xee, 0xf0, 0xff, 0xed, 0xee, 0xf1, 0xff, 0xed, 0xee, 0xf1, 0xff, 0xed, 0xee, 0xf2, 0xff, 0xf1, 0xf3, 0xf6, 0xff, 0xe3, 0xe2, 0xe3, 0xff, 0x6a, 0x4e, 0x47, 0xff, 0x3c, 0x18, 0x0e, 0xff, 0x3f, 0x1b, 0x12, 0xff, 0x48, 0x22, 0x1a, 0xff, 0x47, 0x24, 0x1b, 0xff, 0x48, 0x25, 0x1c, 0xff, 0x48, 0x24, 0x1b, 0xff, 0x3e, 0x1d, 0x16, 0xff, 0x1d, 0x07, 0x04, 0xff, 0x04, 0x00, 0x01, 0xff, 0x1a, 0x2d, 0x55, 0xff, 0x51, 0x83, 0xbf, 0xff, 0x8c, 0xc0, 0xed, 0xff, 0x93, 0xbf, 0xe9, 0xff, 0x8c, 0xb9, 0xe3, 0xff, 0x93, 0xc1, 0xe8, 0xff, 0x8d, 0xbc, 0xe5, 0xff, 0x9b, 0xc9, 0xee, 0xff, 0xad, 0xd9, 0xfd, 0xff, 0xa6, 0xc9, 0xe8, 0xff, 0x68, 0x5d, 0x64, 0xff, 0x3b, 0x18, 0x0e, 0xff, 0x3b, 0x1d, 0x14, 0xff, 0x3b, 0x1c, 0x13, 0xff, 0x3c, 0x1d, 0x13, 0xff, 0x37, 0x17, 0x0d, 0xff, 0x2f, 0x10, 0x08, 0xff, 0x5a, 0x47, 0x42, 0xff, 0xc5, 0xc3, 0xc4, 0xff, 0xf2, 0xf6, 0xf7, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe7, 0xea, 0xeb, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe8, 0xe9, 0xea, 0xff, 0xe8, 0xe9, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xe8, 0xe7, 0xe9, 0xff, 0xe8, 0xe7, 0xe9, 0xff, 0xe8, 0xe7, 0xe9, 0xff, 0xe8, 0xe7, 0xe9, 0xff,
-  0xed, 0xeb, 0xed, 0xec, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xee, 0xed, 0xef, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xef, 0xee, 0xf1, 0xff, 0xee, 0xef, 0xf1, 0xff, 0xf5, 0xf6, 0xf8, 0xff, 0x88, 0x71, 0x6c, 0xff, 0x3d, 0x17, 0x0e, 0xff, 0x4a, 0x25, 0x1d, 0xff, 0x4b, 0x26, 0x1e, 0xff, 0x4b, 0x26, 0x1e, 0xff, 0x4d, 0x28, 0x1f, 0xff, 0x4e, 0x29, 0x20, 0xff, 0x4e, 0x2a, 0x20, 0xff, 0x4b, 0x27, 0x1d, 0xff, 0x3e, 0x1e, 0x17, 0xff, 0x2e, 0x13, 0x0d, 0xff, 0x34, 0x1d, 0x1a, 0xff, 0x5c, 0x5f, 0x6e, 0xff, 0x8b, 0xa6, 0xc2, 0xff, 0xa4, 0xc7, 0xe6, 0xff, 0xa2, 0xc9, 0xed, 0xff, 0xa3, 0xcd, 0xef, 0xff, 0xa6, 0xca, 0xea, 0xff, 0xaa, 0xc1, 0xd6, 0xff, 0x81, 0x85, 0x92, 0xff, 0x54, 0x3a, 0x37, 0xff, 0x3d, 0x18, 0x0d, 0xff, 0x3c, 0x1c, 0x14, 0xff, 0x3e, 0x1e, 0x15, 0xff, 0x3f, 0x1d, 0x15, 0xff, 0x40, 0x1f, 0x16, 0xff, 0x42, 0x21, 0x18, 0xff, 0x41, 0x20, 0x16, 0xff, 0x2f, 0x10, 0x07, 0xff, 0x32, 0x18, 0x13, 0xff, 0xa4, 0x9d, 0x9e, 0xff, 0xf1, 0xf4, 0xf6, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xe8, 0xe8, 0xea, 0xff, 0xe8, 0xe7, 0xe9, 0xff, 0xe8, 0xe7, 0xe9, 0xff,
-  0xed, 0xeb, 0xed, 0xec, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xee, 0xed, 0xef, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xf5, 0xf5, 0xf7, 0xff, 0xd1, 0xc9, 0xca, 0xff, 0x4d, 0x29, 0x1f, 0xff, 0x4c, 0x27, 0x1e, 0xff, 0x50, 0x2d, 0x23, 0xff, 0x50, 0x2c, 0x22, 0xff, 0x4f, 0x2c, 0x21, 0xff, 0x4f, 0x2b, 0x21, 0xff, 0x4e, 0x2a, 0x21, 0xff, 0x51, 0x2d, 0x23, 0xff, 0x53, 0x2f, 0x23, 0xff, 0x53, 0x2f, 0x24, 0xff, 0x52, 0x2d, 0x23, 0xff, 0x50, 0x2b, 0x20, 0xff, 0x4c, 0x24, 0x17, 0xff, 0x4c, 0x28, 0x1f, 0xff, 0x58, 0x3c, 0x37, 0xff, 0x60, 0x4a, 0x49, 0xff, 0x5f, 0x4a, 0x4b, 0xff, 0x5b, 0x42, 0x3f, 0xff, 0x50, 0x2e, 0x27, 0xff, 0x48, 0x1f, 0x14, 0xff, 0x4a, 0x24, 0x19, 0xff, 0x4c, 0x28, 0x1f, 0xff, 0x4c, 0x27, 0x20, 0xff, 0x4b, 0x25, 0x1e, 0xff, 0x49, 0x24, 0x1c, 0xff, 0x44, 0x22, 0x19, 0xff, 0x42, 0x21, 0x18, 0xff, 0x41, 0x1f, 0x16, 0xff, 0x3f, 0x1e, 0x15, 0xff, 0x32, 0x12, 0x0b, 0xff, 0x38, 0x1d, 0x17, 0xff, 0xd0, 0xcc, 0xcc, 0xff, 0xee, 0xf1, 0xf3, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe8, 0xe9, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff,
-  0xec, 0xeb, 0xed, 0xec, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xee, 0xed, 0xef, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xf9, 0xfa, 0xfd, 0xff, 0xa0, 0x8e, 0x8c, 0xff, 0x44, 0x1e, 0x13, 0xff, 0x4e, 0x2b, 0x20, 0xff, 0x53, 0x30, 0x23, 0xff, 0x52, 0x2e, 0x23, 0xff, 0x52, 0x2e, 0x23, 0xff, 0x51, 0x2d, 0x22, 0xff, 0x50, 0x2c, 0x21, 0xff, 0x50, 0x2c, 0x22, 0xff, 0x51, 0x2d, 0x22, 0xff, 0x51, 0x2d, 0x22, 0xff, 0x51, 0x2e, 0x23, 0xff, 0x51, 0x2d, 0x23, 0xff, 0x50, 0x2c, 0x22, 0xff, 0x50, 0x2c, 0x21, 0xff, 0x4e, 0x28, 0x1d, 0xff, 0x4c, 0x26, 0x1a, 0xff, 0x4d, 0x26, 0x1b, 0xff, 0x4f, 0x29, 0x1e, 0xff, 0x4f, 0x2a, 0x20, 0xff, 0x4f, 0x2a, 0x20, 0xff, 0x4d, 0x29, 0x20, 0xff, 0x4d, 0x29, 0x20, 0xff, 0x4d, 0x28, 0x1f, 0xff, 0x4c, 0x27, 0x1e, 0xff, 0x4b, 0x27, 0x1d, 0xff, 0x49, 0x25, 0x1c, 0xff, 0x49, 0x25, 0x1c, 0xff, 0x48, 0x24, 0x1c, 0xff, 0x48, 0x24, 0x1b, 0xff, 0x43, 0x22, 0x19, 0xff, 0x37, 0x16, 0x0c, 0xff, 0x82, 0x6e, 0x68, 0xff, 0xf0, 0xf4, 0xf6, 0xff, 0xe9, 0xeb, 0xec, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe8, 0xe9, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff,
-  0xed, 0xeb, 0xed, 0xec, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xee, 0xed, 0xef, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf6, 0xf6, 0xf9, 0xff, 0x7e, 0x65, 0x5e, 0xff, 0x47, 0x21, 0x16, 0xff, 0x4f, 0x2c, 0x20, 0xff, 0x53, 0x30, 0x23, 0xff, 0x52, 0x2f, 0x24, 0xff, 0x52, 0x2f, 0x23, 0xff, 0x53, 0x30, 0x23, 0xff, 0x51, 0x2f, 0x21, 0xff, 0x50, 0x2d, 0x20, 0xff, 0x51, 0x2e, 0x21, 0xff, 0x51, 0x2d, 0x22, 0xff, 0x52, 0x2e, 0x23, 0xff, 0x52, 0x2d, 0x24, 0xff, 0x51, 0x2d, 0x24, 0xff, 0x51, 0x2d, 0x23, 0xff, 0x52, 0x2e, 0x24, 0xff, 0x51, 0x2d, 0x23, 0xff, 0x52, 0x2e, 0x24, 0xff, 0x51, 0x2d, 0x23, 0xff, 0x51, 0x2d, 0x23, 0xff, 0x50, 0x2d, 0x22, 0xff, 0x50, 0x2c, 0x21, 0xff, 0x51, 0x2e, 0x21, 0xff, 0x50, 0x2e, 0x21, 0xff, 0x50, 0x2d, 0x20, 0xff, 0x51, 0x2d, 0x22, 0xff, 0x4f, 0x2b, 0x21, 0xff, 0x4d, 0x29, 0x1f, 0xff, 0x4a, 0x26, 0x1d, 0xff, 0x4a, 0x27, 0x1d, 0xff, 0x46, 0x23, 0x1a, 0xff, 0x40, 0x1f, 0x15, 0xff, 0x4f, 0x30, 0x28, 0xff, 0xda, 0xd9, 0xda, 0xff, 0xed, 0xef, 0xf0, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe8, 0xe8, 0xea, 0xff, 0xe8, 0xe8, 0xea, 0xff, 0xe8, 0xe8, 0xea, 0xff,
-  0xed, 0xeb, 0xed, 0xec, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xee, 0xed, 0xef, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf2, 0xf1, 0xf3, 0xff, 0xec, 0xeb, 0xed, 0xff, 0x69, 0x4b, 0x44, 0xff, 0x4b, 0x25, 0x1b, 0xff, 0x4e, 0x2b, 0x20, 0xff, 0x54, 0x30, 0x23, 0xff, 0x54, 0x30, 0x24, 0xff, 0x53, 0x30, 0x23, 0xff, 0x54, 0x30, 0x24, 0xff, 0x52, 0x2f, 0x22, 0xff, 0x52, 0x2f, 0x22, 0xff, 0x52, 0x2f, 0x22, 0xff, 0x52, 0x2f, 0x23, 0xff, 0x52, 0x2f, 0x23, 0xff, 0x52, 0x2e, 0x22, 0xff, 0x51, 0x2e, 0x23, 0xff, 0x51, 0x2d, 0x23, 0xff, 0x52, 0x2e, 0x24, 0xff, 0x52, 0x2e, 0x23, 0xff, 0x52, 0x2f, 0x23, 0xff, 0x51, 0x2e, 0x22, 0xff, 0x52, 0x2e, 0x24, 0xff, 0x52, 0x2e, 0x24, 0xff, 0x52, 0x2f, 0x23, 0xff, 0x53, 0x30, 0x23, 0xff, 0x52, 0x2f, 0x22, 0xff, 0x52, 0x2f, 0x22, 0xff, 0x52, 0x2f, 0x22, 0xff, 0x51, 0x2e, 0x22, 0xff, 0x50, 0x2c, 0x21, 0xff, 0x4d, 0x29, 0x1e, 0xff, 0x4b, 0x27, 0x1d, 0xff, 0x47, 0x24, 0x1c, 0xff, 0x43, 0x22, 0x19, 0xff, 0x3d, 0x1a, 0x11, 0xff, 0xb3, 0xaa, 0xa8, 0xff, 0xf1, 0xf5, 0xf6, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff,
-  0xed, 0xeb, 0xed, 0xec, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf3, 0xf2, 0xf4, 0xff, 0xe5, 0xe3, 0xe4, 0xff, 0x5d, 0x3d, 0x35, 0xff, 0x4a, 0x25, 0x1b, 0xff, 0x4b, 0x27, 0x1e, 0xff, 0x53, 0x2e, 0x23, 0xff, 0x57, 0x31, 0x25, 0xff, 0x55, 0x30, 0x24, 0xff, 0x56, 0x30, 0x24, 0xff, 0x56, 0x30, 0x24, 0xff, 0x53, 0x30, 0x24, 0xff, 0x53, 0x2f, 0x23, 0xff, 0x52, 0x2f, 0x23, 0xff, 0x53, 0x30, 0x23, 0xff, 0x52, 0x2f, 0x22, 0xff, 0x52, 0x2f, 0x22, 0xff, 0x52, 0x2f, 0x24, 0xff, 0x52, 0x2f, 0x23, 0xff, 0x53, 0x30, 0x23, 0xff, 0x53, 0x30, 0x23, 0xff, 0x52, 0x30, 0x22, 0xff, 0x52, 0x2f, 0x22, 0xff, 0x53, 0x2f, 0x24, 0xff, 0x53, 0x30, 0x23, 0xff, 0x55, 0x30, 0x24, 0xff, 0x55, 0x30, 0x23, 0xff, 0x54, 0x30, 0x24, 0xff, 0x53, 0x30, 0x24, 0xff, 0x52, 0x2f, 0x22, 0xff, 0x51, 0x2e, 0x21, 0xff, 0x4d, 0x29, 0x1f, 0xff, 0x49, 0x26, 0x1c, 0xff, 0x45, 0x22, 0x1a, 0xff, 0x42, 0x21, 0x18, 0xff, 0x3a, 0x16, 0x0d, 0xff, 0x88, 0x77, 0x73, 0xff, 0xf1, 0xf5, 0xf7, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe8, 0xea, 0xff,
-  0xed, 0xec, 0xee, 0xec, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xf3, 0xf3, 0xf5, 0xff, 0xe4, 0xe0, 0xe1, 0xff, 0x5a, 0x3a, 0x31, 0xff, 0x46, 0x21, 0x18, 0xff, 0x44, 0x21, 0x1a, 0xff, 0x4a, 0x27, 0x1d, 0xff, 0x55, 0x30, 0x24, 0xff, 0x56, 0x30, 0x24, 0xff, 0x56, 0x30, 0x24, 0xff, 0x56, 0x31, 0x25, 0xff, 0x52, 0x2d, 0x21, 0xff, 0x4e, 0x2a, 0x1e, 0xff, 0x4f, 0x2a, 0x1f, 0xff, 0x50, 0x2c, 0x1f, 0xff, 0x4f, 0x2c, 0x20, 0xff, 0x4e, 0x2a, 0x20, 0xff, 0x4f, 0x2b, 0x20, 0xff, 0x4f, 0x2c, 0x1f, 0xff, 0x4f, 0x2b, 0x1e, 0xff, 0x51, 0x2c, 0x20, 0xff, 0x4f, 0x2b, 0x1f, 0xff, 0x4e, 0x29, 0x1f, 0xff, 0x50, 0x2c, 0x20, 0xff, 0x4f, 0x2c, 0x1f, 0xff, 0x52, 0x2c, 0x20, 0xff, 0x53, 0x2c, 0x21, 0xff, 0x54, 0x30, 0x24, 0xff, 0x52, 0x2f, 0x22, 0xff, 0x51, 0x2e, 0x22, 0xff, 0x51, 0x2d, 0x21, 0xff, 0x4d, 0x29, 0x20, 0xff, 0x43, 0x21, 0x19, 0xff, 0x42, 0x20, 0x17, 0xff, 0x42, 0x21, 0x18, 0xff, 0x37, 0x16, 0x0c, 0xff, 0x6c, 0x56, 0x50, 0xff, 0xec, 0xef, 0xf1, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe8, 0xe9, 0xea, 0xff, 0xe8, 0xe8, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff,
-  0xed, 0xeb, 0xed, 0xec, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf2, 0xf2, 0xf4, 0xff, 0xe8, 0xe5, 0xe6, 0xff, 0x60, 0x40, 0x38, 0xff, 0x43, 0x1f, 0x16, 0xff, 0x3e, 0x1d, 0x17, 0xff, 0x35, 0x17, 0x11, 0xff, 0x49, 0x26, 0x1d, 0xff, 0x56, 0x30, 0x24, 0xff, 0x54, 0x30, 0x23, 0xff, 0x52, 0x2e, 0x21, 0xff, 0x6c, 0x4b, 0x3b, 0xff, 0x6e, 0x51, 0x3f, 0xff, 0x68, 0x49, 0x39, 0xff, 0x68, 0x49, 0x39, 0xff, 0x63, 0x44, 0x34, 0xff, 0x68, 0x49, 0x38, 0xff, 0x68, 0x49, 0x39, 0xff, 0x65, 0x45, 0x35, 0xff, 0x71, 0x54, 0x41, 0xff, 0x65, 0x44, 0x34, 0xff, 0x6c, 0x4e, 0x3d, 0xff, 0x6f, 0x51, 0x40, 0xff, 0x67, 0x48, 0x39, 0xff, 0x6a, 0x4c, 0x3b, 0xff, 0x60, 0x3f, 0x30, 0xff, 0x69, 0x49, 0x39, 0xff, 0x57, 0x33, 0x26, 0xff, 0x52, 0x2f, 0x22, 0xff, 0x52, 0x2f, 0x22, 0xff, 0x51, 0x2d, 0x21, 0xff, 0x49, 0x27, 0x1d, 0xff, 0x40, 0x1f, 0x16, 0xff, 0x3f, 0x1e, 0x15, 0xff, 0x3e, 0x1e, 0x15, 0xff, 0x37, 0x17, 0x0d, 0xff, 0x5f, 0x48, 0x42, 0xff, 0xe7, 0xe8, 0xeb, 0xff, 0xe8, 0xeb, 0xec, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe8, 0xe8, 0xea, 0xff, 0xe8, 0xe9, 0xea, 0xff,
-  0xec, 0xec, 0xed, 0xec, 0xed, 0xec, 0xee, 0xff, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xf1, 0xf1, 0xf3, 0xff, 0xeb, 0xea, 0xec, 0xff, 0x66, 0x48, 0x41, 0xff, 0x44, 0x1f, 0x16, 0xff, 0x3d, 0x1c, 0x16, 0xff, 0x29, 0x0f, 0x0d, 0xff, 0x36, 0x1a, 0x13, 0xff, 0x55, 0x31, 0x25, 0xff, 0x54, 0x31, 0x23, 0xff, 0x4e, 0x2a, 0x1e, 0xff, 0x82, 0x66, 0x52, 0xff, 0xa2, 0x8e, 0x73, 0xff, 0x8c, 0x75, 0x5e, 0xff, 0x9f, 0x8b, 0x71, 0xff, 0x9e, 0x8a, 0x70, 0xff, 0x9e, 0x89, 0x6f, 0xff, 0x9a, 0x84, 0x6b, 0xff, 0x9f, 0x8b, 0x70, 0xff, 0x94, 0x7d, 0x64, 0xff, 0x8b, 0x74, 0x5c, 0xff, 0x90, 0x78, 0x60, 0xff, 0xa0, 0x8b, 0x71, 0xff, 0x8d, 0x74, 0x5e, 0xff, 0xa0, 0x8c, 0x72, 0xff, 0x9c, 0x88, 0x6e, 0xff, 0x92, 0x7b, 0x63, 0xff, 0x59, 0x34, 0x28, 0xff, 0x53, 0x2f, 0x22, 0xff, 0x53, 0x30, 0x23, 0xff, 0x4f, 0x2c, 0x1f, 0xff, 0x3d, 0x1e, 0x17, 0xff, 0x34, 0x16, 0x10, 0xff, 0x36, 0x18, 0x12, 0xff, 0x39, 0x1b, 0x13, 0xff, 0x36, 0x16, 0x0d, 0xff, 0x56, 0x3e, 0x38, 0xff, 0xe1, 0xe2, 0xe5, 0xff, 0xe7, 0xea, 0xeb, 0xff, 0xe6, 0xe8, 0xe9, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe8, 0xe8, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff,
-  0xed, 0xec, 0xee, 0xec, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xf0, 0xee, 0xf0, 0xff, 0xf1, 0xf1, 0xf5, 0xff, 0xe2, 0xe1, 0xe4, 0xff, 0x60, 0x40, 0x38, 0xff, 0x4a, 0x25, 0x1b, 0xff, 0x46, 0x22, 0x1c, 0xff, 0x36, 0x17, 0x14, 0xff, 0x32, 0x16, 0x12, 0xff, 0x52, 0x2f, 0x23, 0xff, 0x55, 0x31, 0x24, 0xff, 0x53, 0x2d, 0x21, 0xff, 0x67, 0x47, 0x3b, 0xff, 0x78, 0x5e, 0x50, 0xff, 0x71, 0x57, 0x4a, 0xff, 0x71, 0x58, 0x4b, 0xff, 0x72, 0x59, 0x4b, 0xff, 0x72, 0x59, 0x4b, 0xff, 0x72, 0x59, 0x4c, 0xff, 0x73, 0x5a, 0x4d, 0xff, 0x70, 0x55, 0x49, 0xff, 0x6e, 0x54, 0x48, 0xff, 0x6e, 0x53, 0x47, 0xff, 0x75, 0x5d, 0x4f, 0xff, 0x70, 0x56, 0x49, 0xff, 0x70, 0x56, 0x48, 0xff, 0x6f, 0x57, 0x49, 0xff, 0x67, 0x4d, 0x40, 0xff, 0x57, 0x33, 0x27, 0xff, 0x54, 0x2f, 0x22, 0xff, 0x52, 0x2f, 0x21, 0xff, 0x46, 0x23, 0x1b, 0xff, 0x2a, 0x12, 0x0f, 0xff, 0x27, 0x0d, 0x0b, 0xff, 0x31, 0x13, 0x10, 0xff, 0x3a, 0x1b, 0x14, 0xff, 0x38, 0x18, 0x0f, 0xff, 0x4c, 0x32, 0x2c, 0xff, 0xdb, 0xdb, 0xdd, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe4, 0xe6, 0xe7, 0xff, 0xe5, 0xe7, 0xe8, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff,
-  0xed, 0xec, 0xee, 0xec, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xf3, 0xf6, 0xf9, 0xff, 0xc5, 0xbd, 0xbe, 0xff, 0x4f, 0x2b, 0x20, 0xff, 0x50, 0x2c, 0x22, 0xff, 0x4b, 0x27, 0x1e, 0xff, 0x41, 0x1f, 0x18, 0xff, 0x2f, 0x13, 0x10, 0xff, 0x43, 0x22, 0x1b, 0xff, 0x54, 0x2f, 0x23, 0xff, 0x55, 0x2f, 0x24, 0xff, 0x69, 0x51, 0x4b, 0xff, 0x5c, 0x3d, 0x33, 0xff, 0x5c, 0x3d, 0x33, 0xff, 0x5d, 0x3e, 0x34, 0xff, 0x5b, 0x3a, 0x30, 0xff, 0x59, 0x38, 0x2e, 0xff, 0x5b, 0x3b, 0x30, 0xff, 0x5c, 0x3d, 0x32, 0xff, 0x5d, 0x3f, 0x35, 0xff, 0x5e, 0x3f, 0x36, 0xff, 0x5f, 0x40, 0x37, 0xff, 0x5e, 0x3f, 0x36, 0xff, 0x5f, 0x41, 0x37, 0xff, 0x5b, 0x3d, 0x32, 0xff, 0x59, 0x3b, 0x30, 0xff, 0x58, 0x3a, 0x30, 0xff, 0x54, 0x31, 0x25, 0xff, 0x51, 0x2e, 0x21, 0xff, 0x4e, 0x2a, 0x1f, 0xff, 0x38, 0x1b, 0x15, 0xff, 0x1f, 0x0b, 0x09, 0xff, 0x2d, 0x11, 0x0f, 0xff, 0x3b, 0x1b, 0x15, 0xff, 0x41, 0x20, 0x17, 0xff, 0x3a, 0x1a, 0x11, 0xff, 0x43, 0x28, 0x21, 0xff, 0xd2, 0xd1, 0xd4, 0xff, 0xe7, 0xe9, 0xed, 0xff, 0xe3, 0xe5, 0xe6, 0xff, 0xe4, 0xe6, 0xe7, 0xff, 0xe6, 0xe8, 0xe9, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe8, 0xe8, 0xea, 0xff, 0xe9, 0xe9, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff,
-  0xed, 0xec, 0xee, 0xec, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xf5, 0xf8, 0xfd, 0xff, 0xa1, 0x8f, 0x8d, 0xff, 0x4b, 0x25, 0x18, 0xff, 0x54, 0x30, 0x24, 0xff, 0x4b, 0x26, 0x1e, 0xff, 0x42, 0x20, 0x17, 0xff, 0x31, 0x16, 0x11, 0xff, 0x33, 0x17, 0x13, 0xff, 0x51, 0x2c, 0x23, 0xff, 0x56, 0x31, 0x26, 0xff, 0x64, 0x4f, 0x47, 0xff, 0x50, 0x2c, 0x1f, 0xff, 0x4f, 0x2c, 0x1e, 0xff, 0x4f, 0x2b, 0x1e, 0xff, 0x60, 0x46, 0x3c, 0xff, 0x62, 0x4c, 0x45, 0xff, 0x59, 0x3e, 0x3f, 0xff, 0x57, 0x3a, 0x32, 0xff, 0x4d, 0x27, 0x19, 0xff, 0x50, 0x2b, 0x1e, 0xff, 0x50, 0x2b, 0x1e, 0xff, 0x4e, 0x29, 0x1d, 0xff, 0x4f, 0x2a, 0x1e, 0xff, 0x4f, 0x2a, 0x1e, 0xff, 0x50, 0x2b, 0x1e, 0xff, 0x51, 0x2c, 0x1f, 0xff, 0x53, 0x30, 0x23, 0xff, 0x51, 0x2e, 0x21, 0xff, 0x4a, 0x27, 0x1d, 0xff, 0x28, 0x12, 0x0e, 0xff, 0x29, 0x10, 0x0c, 0xff, 0x3b, 0x1b, 0x14, 0xff, 0x41, 0x20, 0x18, 0xff, 0x3f, 0x1e, 0x15, 0xff, 0x3b, 0x1b, 0x12, 0xff, 0x3d, 0x1f, 0x17, 0xff, 0xc5, 0xc0, 0xc3, 0xff, 0xe9, 0xeb, 0xef, 0xff, 0xe3, 0xe4, 0xe7, 0xff, 0xe3, 0xe5, 0xe7, 0xff, 0xe4, 0xe7, 0xe7, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff,
-  0xed, 0xec, 0xee, 0xec, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xee, 0xef, 0xf1, 0xff, 0xf3, 0xf6, 0xfb, 0xff, 0x88, 0x71, 0x6e, 0xff, 0x45, 0x1c, 0x0e, 0xff, 0x50, 0x2b, 0x20, 0xff, 0x4c, 0x27, 0x1f, 0xff, 0x43, 0x21, 0x19, 0xff, 0x34, 0x17, 0x12, 0xff, 0x26, 0x10, 0x0d, 0xff, 0x48, 0x27, 0x1e, 0xff, 0x56, 0x33, 0x25, 0xff, 0x66, 0x51, 0x4a, 0xff, 0x53, 0x2e, 0x23, 0xff, 0x53, 0x30, 0x21, 0xff, 0x56, 0x35, 0x31, 0xff, 0x64, 0x55, 0x62, 0xff, 0x69, 0x5f, 0x5e, 0xff, 0x60, 0x58, 0x63, 0xff, 0x61, 0x4e, 0x50, 0xff, 0x5a, 0x39, 0x2d, 0xff, 0x5c, 0x3d, 0x33, 0xff, 0x5d, 0x3e, 0x33, 0xff, 0x5b, 0x3d, 0x32, 0xff, 0x5c, 0x3d, 0x32, 0xff, 0x59, 0x3a, 0x2f, 0xff, 0x59, 0x39, 0x30, 0xff, 0x57, 0x38, 0x2d, 0xff, 0x53, 0x30, 0x24, 0xff, 0x52, 0x2f, 0x22, 0xff, 0x4a, 0x28, 0x1e, 0xff, 0x21, 0x10, 0x0d, 0xff, 0x2b, 0x11, 0x0d, 0xff, 0x3d, 0x1e, 0x14, 0xff, 0x40, 0x20, 0x17, 0xff, 0x42, 0x21, 0x18, 0xff, 0x40, 0x20, 0x16, 0xff, 0x38, 0x16, 0x0e, 0xff, 0xa7, 0x9d, 0x9d, 0xff, 0xec, 0xee, 0xf2, 0xff, 0xe3, 0xe4, 0xe8, 0xff, 0xe3, 0xe5, 0xe7, 0xff, 0xe4, 0xe6, 0xe7, 0xff, 0xe6, 0xe8, 0xe9, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe8, 0xe9, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff,
-  0xed, 0xec, 0xee, 0xec, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xee, 0xee, 0xf1, 0xff, 0xf1, 0xf2, 0xf4, 0xff, 0x9e, 0xad, 0xc9, 0xff, 0x5e, 0x57, 0x64, 0xff, 0x4e, 0x2d, 0x27, 0xff, 0x42, 0x1d, 0x13, 0xff, 0x3a, 0x17, 0x0e, 0xff, 0x31, 0x10, 0x09, 0xff, 0x1e, 0x0b, 0x08, 0xff, 0x38, 0x1b, 0x16, 0xff, 0x51, 0x2c, 0x22, 0xff, 0x66, 0x50, 0x4a, 0xff, 0x55, 0x31, 0x28, 0xff, 0x50, 0x2c, 0x1f, 0xff, 0x6a, 0x53, 0x4a, 0xff, 0x63, 0x4a, 0x41, 0xff, 0x60, 0x46, 0x3e, 0xff, 0x61, 0x47, 0x40, 0xff, 0x68, 0x4f, 0x47, 0xff, 0x71, 0x5a, 0x52, 0xff, 0x62, 0x43, 0x39, 0xff, 0x64, 0x47, 0x3c, 0xff, 0x65, 0x49, 0x3f, 0xff, 0x64, 0x47, 0x3f, 0xff, 0x5f, 0x42, 0x3a, 0xff, 0x5c, 0x3f, 0x34, 0xff, 0x5f, 0x49, 0x41, 0xff, 0x57, 0x3a, 0x30, 0xff, 0x50, 0x2b, 0x20, 0xff, 0x49, 0x27, 0x1d, 0xff, 0x26, 0x11, 0x0d, 0xff, 0x25, 0x0d, 0x0a, 0xff, 0x39, 0x1a, 0x13, 0xff, 0x3f, 0x20, 0x16, 0xff, 0x43, 0x22, 0x19, 0xff, 0x45, 0x23, 0x1a, 0xff, 0x38, 0x16, 0x0c, 0xff, 0x7b, 0x68, 0x64, 0xff, 0xe9, 0xec, 0xf1, 0xff, 0xe3, 0xe4, 0xe8, 0xff, 0xe3, 0xe5, 0xe8, 0xff, 0xe4, 0xe6, 0xe7, 0xff, 0xe5, 0xe7, 0xe8, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff,
-  0xed, 0xeb, 0xed, 0xec, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xee, 0xee, 0xf1, 0xff, 0xef, 0xee, 0xf1, 0xff, 0x9f, 0xbb, 0xe1, 0xff, 0x89, 0xbb, 0xee, 0xff, 0x96, 0xb6, 0xd6, 0xff, 0x96, 0xa1, 0xb6, 0xff, 0x89, 0x90, 0xa3, 0xff, 0x67, 0x79, 0x97, 0xff, 0x2c, 0x28, 0x36, 0xff, 0x37, 0x18, 0x13, 0xff, 0x4d, 0x2a, 0x22, 0xff, 0x63, 0x4c, 0x44, 0xff, 0x73, 0x61, 0x5d, 0xff, 0x5a, 0x37, 0x2c, 0xff, 0x66, 0x4d, 0x44, 0xff, 0x52, 0x2f, 0x22, 0xff, 0x51, 0x2c, 0x1f, 0xff, 0x4f, 0x2a, 0x1c, 0xff, 0x56, 0x34, 0x28, 0xff, 0x62, 0x4d, 0x46, 0xff, 0x4b, 0x30, 0x2b, 0xff, 0x4e, 0x34, 0x31, 0xff, 0x50, 0x2e, 0x22, 0xff, 0x4f, 0x2a, 0x1d, 0xff, 0x51, 0x2e, 0x22, 0xff, 0x55, 0x37, 0x2c, 0xff, 0x5b, 0x44, 0x3c, 0xff, 0x57, 0x39, 0x31, 0xff, 0x4e, 0x29, 0x1f, 0xff, 0x46, 0x25, 0x1c, 0xff, 0x28, 0x13, 0x10, 0xff, 0x23, 0x0c, 0x09, 0xff, 0x35, 0x18, 0x10, 0xff, 0x3e, 0x1d, 0x15, 0xff, 0x3f, 0x1e, 0x15, 0xff, 0x3c, 0x1a, 0x0f, 0xff, 0x33, 0x10, 0x07, 0xff, 0x6f, 0x65, 0x6b, 0xff, 0xe2, 0xe6, 0xea, 0xff, 0xe1, 0xe2, 0xe6, 0xff, 0xe3, 0xe4, 0xe8, 0xff, 0xe4, 0xe6, 0xe7, 0xff, 0xe5, 0xe7, 0xe8, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff,
-  0xed, 0xec, 0xee, 0xec, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf0, 0xff, 0xee, 0xee, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0x9b, 0xb6, 0xda, 0xff, 0x81, 0xb3, 0xe6, 0xff, 0xa4, 0xd1, 0xf8, 0xff, 0xc0, 0xe2, 0xff, 0xff, 0xbb, 0xe1, 0xff, 0xff, 0x7e, 0xb1, 0xe6, 0xff, 0x34, 0x30, 0x43, 0xff, 0x3c, 0x1c, 0x16, 0xff, 0x50, 0x2d, 0x23, 0xff, 0x61, 0x48, 0x40, 0xff, 0x86, 0x7e, 0x7b, 0xff, 0x71, 0x5d, 0x57, 0xff, 0x65, 0x4b, 0x43, 0xff, 0x56, 0x35, 0x29, 0xff, 0x52, 0x2f, 0x22, 0xff, 0x51, 0x2e, 0x22, 0xff, 0x5e, 0x3e, 0x33, 0xff, 0x57, 0x57, 0x55, 0xff, 0x55, 0x5b, 0x5c, 0xff, 0x5d, 0x60, 0x63, 0xff, 0x5c, 0x4a, 0x42, 0xff, 0x57, 0x33, 0x26, 0xff, 0x53, 0x35, 0x2a, 0xff, 0x64, 0x52, 0x4c, 0xff, 0x63, 0x53, 0x4d, 0xff, 0x55, 0x37, 0x2d, 0xff, 0x4b, 0x27, 0x1d, 0xff, 0x40, 0x1e, 0x16, 0xff, 0x35, 0x27, 0x28, 0xff, 0x31, 0x22, 0x25, 0xff, 0x37, 0x19, 0x13, 0xff, 0x3d, 0x20, 0x1b, 0xff, 0x44, 0x2b, 0x28, 0xff, 0x50, 0x40, 0x42, 0xff, 0x5a, 0x6d, 0x8d, 0xff, 0x7f, 0x9e, 0xc8, 0xff, 0xdd, 0xdf, 0xe0, 0xff, 0xdd, 0xdf, 0xe3, 0xff, 0xe1, 0xe2, 0xe6, 0xff, 0xe4, 0xe5, 0xe7, 0xff, 0xe4, 0xe6, 0xe7, 0xff, 0xe6, 0xe8, 0xe9, 0xff, 0xe8, 0xe9, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff,
-  0xee, 0xec, 0xee, 0xec, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xee, 0xee, 0xf1, 0xff, 0xf0, 0xf0, 0xef, 0xff, 0x98, 0xb2, 0xd6, 0xff, 0x7b, 0xae, 0xe3, 0xff, 0xa2, 0xcd, 0xf2, 0xff, 0xbe, 0xdb, 0xfa, 0xff, 0xb1, 0xd7, 0xf7, 0xff, 0x72, 0x9f, 0xcf, 0xff, 0x4a, 0x3b, 0x44, 0xff, 0x3e, 0x1d, 0x18, 0xff, 0x4b, 0x2a, 0x21, 0xff, 0x60, 0x46, 0x3e, 0xff, 0x80, 0x77, 0x74, 0xff, 0x7a, 0x71, 0x6e, 0xff, 0x64, 0x4a, 0x43, 0xff, 0x56, 0x34, 0x29, 0xff, 0x51, 0x2c, 0x1f, 0xff, 0x63, 0x48, 0x3f, 0xff, 0x6a, 0x53, 0x4b, 0xff, 0x61, 0x4b, 0x43, 0xff, 0x65, 0x4d, 0x45, 0xff, 0x68, 0x4f, 0x46, 0xff, 0x67, 0x4d, 0x43, 0xff, 0x6c, 0x55, 0x4d, 0xff, 0x55, 0x3a, 0x2f, 0xff, 0x64, 0x50, 0x48, 0xff, 0x62, 0x51, 0x4b, 0xff, 0x4e, 0x32, 0x28, 0xff, 0x42, 0x20, 0x18, 0xff, 0x3a, 0x19, 0x13, 0xff, 0x43, 0x40, 0x47, 0xff, 0x48, 0x60, 0x82, 0xff, 0x7c, 0x9c, 0xc2, 0xff, 0x99, 0xb4, 0xd2, 0xff, 0x9b, 0xbd, 0xdf, 0xff, 0x91, 0xc0, 0xeb, 0xff, 0x79, 0xaf, 0xe7, 0xff, 0x78, 0x98, 0xc4, 0xff, 0xdb, 0xdc, 0xdf, 0xff, 0xdb, 0xde, 0xe2, 0xff, 0xde, 0xe0, 0xe4, 0xff, 0xe2, 0xe4, 0xe7, 0xff, 0xe4, 0xe6, 0xe7, 0xff, 0xe6, 0xe8, 0xe9, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe8, 0xe9, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff,
-  0xee, 0xec, 0xee, 0xec, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xee, 0xee, 0xf0, 0xff, 0xf1, 0xf0, 0xef, 0xff, 0x98, 0xb1, 0xd5, 0xff, 0x79, 0xad, 0xe1, 0xff, 0xa4, 0xcf, 0xf2, 0xff, 0xb9, 0xd9, 0xf8, 0xff, 0xa3, 0xce, 0xf3, 0xff, 0x64, 0x8e, 0xbe, 0xff, 0x5b, 0x46, 0x49, 0xff, 0x3e, 0x1e, 0x1a, 0xff, 0x44, 0x24, 0x1e, 0xff, 0x69, 0x50, 0x49, 0xff, 0x79, 0x6d, 0x69, 0xff, 0x72, 0x68, 0x63, 0xff, 0x6b, 0x55, 0x4f, 0xff, 0x56, 0x33, 0x27, 0xff, 0x51, 0x2c, 0x1f, 0xff, 0x62, 0x47, 0x3e, 0xff, 0x57, 0x33, 0x29, 0xff, 0x53, 0x2b, 0x1e, 0xff, 0x53, 0x2d, 0x20, 0xff, 0x50, 0x2c, 0x1f, 0xff, 0x4e, 0x28, 0x1b, 0xff, 0x5e, 0x44, 0x3b, 0xff, 0x5d, 0x4c, 0x43, 0xff, 0x65, 0x59, 0x53, 0xff, 0x63, 0x58, 0x53, 0xff, 0x47, 0x2a, 0x23, 0xff, 0x33, 0x14, 0x0f, 0xff, 0x32, 0x16, 0x11, 0xff, 0x3e, 0x3e, 0x44, 0xff, 0x49, 0x61, 0x83, 0xff, 0x7d, 0xaf, 0xe2, 0xff, 0xa8, 0xd1, 0xf8, 0xff, 0xa7, 0xd1, 0xf5, 0xff, 0x96, 0xc4, 0xed, 0xff, 0x74, 0xa6, 0xdc, 0xff, 0x70, 0x8f, 0xbd, 0xff, 0xda, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xe2, 0xff, 0xdd, 0xdf, 0xe4, 0xff, 0xe1, 0xe2, 0xe6, 0xff, 0xe4, 0xe6, 0xe7, 0xff, 0xe6, 0xe8, 0xe9, 0xff, 0xe8, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe8, 0xe8, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff,
-  0xee, 0xec, 0xee, 0xec, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xee, 0xee, 0xf0, 0xff, 0xf1, 0xf0, 0xef, 0xff, 0x9e, 0xb6, 0xd7, 0xff, 0x78, 0xab, 0xe1, 0xff, 0x9f, 0xca, 0xf0, 0xff, 0xae, 0xd4, 0xf5, 0xff, 0x91, 0xbe, 0xec, 0xff, 0x5a, 0x7d, 0xae, 0xff, 0x6b, 0x56, 0x54, 0xff, 0x41, 0x20, 0x1a, 0xff, 0x42, 0x23, 0x1e, 0xff, 0x67, 0x4f, 0x48, 0xff, 0x58, 0x3a, 0x30, 0xff, 0x54, 0x35, 0x2c, 0xff, 0x67, 0x52, 0x4a, 0xff, 0x56, 0x32, 0x26, 0xff, 0x52, 0x2c, 0x1f, 0xff, 0x63, 0x47, 0x3d, 0xff, 0x57, 0x34, 0x28, 0xff, 0x51, 0x2d, 0x1f, 0xff, 0x53, 0x2e, 0x21, 0xff, 0x52, 0x2f, 0x22, 0xff, 0x50, 0x2c, 0x1f, 0xff, 0x60, 0x45, 0x3e, 0xff, 0x5b, 0x41, 0x37, 0xff, 0x51, 0x32, 0x27, 0xff, 0x54, 0x3d, 0x36, 0xff, 0x41, 0x27, 0x24, 0xff, 0x2c, 0x0e, 0x0c, 0xff, 0x2a, 0x0f, 0x0c, 0xff, 0x3d, 0x39, 0x40, 0xff, 0x4a, 0x5c, 0x77, 0xff, 0x6a, 0x9a, 0xcf, 0xff, 0x98, 0xc4, 0xef, 0xff, 0x9f, 0xc9, 0xee, 0xff, 0x96, 0xc2, 0xec, 0xff, 0x76, 0xa6, 0xde, 0xff, 0x72, 0x90, 0xbc, 0xff, 0xda, 0xda, 0xdd, 0xff, 0xdb, 0xde, 0xe2, 0xff, 0xdc, 0xdf, 0xe3, 0xff, 0xe0, 0xe2, 0xe5, 0xff, 0xe3, 0xe5, 0xe7, 0xff, 0xe7, 0xe8, 0xe9, 0xff, 0xe8, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe8, 0xe9, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff,
-  0xed, 0xec, 0xee, 0xec, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xed, 0xee, 0xf1, 0xff, 0xf1, 0xf0, 0xf0, 0xff, 0xa0, 0xb9, 0xd9, 0xff, 0x83, 0xb4, 0xe9, 0xff, 0x96, 0xc1, 0xee, 0xff, 0x92, 0xbd, 0xeb, 0xff, 0x78, 0xa7, 0xdd, 0xff, 0x5b, 0x77, 0xa3, 0xff, 0x7f, 0x6b, 0x67, 0xff, 0x42, 0x20, 0x19, 0xff, 0x3f, 0x22, 0x1f, 0xff, 0x5e, 0x47, 0x42, 0xff, 0x4a, 0x26, 0x1d, 0xff, 0x4a, 0x24, 0x19, 0xff, 0x62, 0x49, 0x40, 0xff, 0x57, 0x33, 0x27, 0xff, 0x51, 0x2d, 0x26, 0xff, 0x60, 0x49, 0x44, 0xff, 0x65, 0x4f, 0x47, 0xff, 0x64, 0x4b, 0x44, 0xff, 0x5e, 0x43, 0x3b, 0xff, 0x51, 0x2e, 0x21, 0xff, 0x51, 0x2d, 0x20, 0xff, 0x5d, 0x42, 0x39, 0xff, 0x52, 0x31, 0x27, 0xff, 0x4a, 0x23, 0x18, 0xff, 0x4d, 0x32, 0x2b, 0xff, 0x40, 0x28, 0x24, 0xff, 0x2c, 0x10, 0x0d, 0xff, 0x2a, 0x0e, 0x0b, 0xff, 0x4a, 0x41, 0x45, 0xff, 0x50, 0x5e, 0x73, 0xff, 0x60, 0x8a, 0xbe, 0xff, 0x8d, 0xba, 0xe8, 0xff, 0x99, 0xc3, 0xed, 0xff, 0x8e, 0xbb, 0xe8, 0xff, 0x79, 0xaa, 0xe2, 0xff, 0x7b, 0x99, 0xc3, 0xff, 0xd9, 0xda, 0xdc, 0xff, 0xdb, 0xdd, 0xe1, 0xff, 0xdc, 0xdf, 0xe3, 0xff, 0xdf, 0xe1, 0xe5, 0xff, 0xe3, 0xe5, 0xe6, 0xff, 0xe6, 0xe8, 0xe9, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe8, 0xe9, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff,
-  0xed, 0xeb, 0xed, 0xec, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf0, 0xff, 0xed, 0xee, 0xf1, 0xff, 0xee, 0xed, 0xee, 0xff, 0x94, 0xb1, 0xd9, 0xff, 0x93, 0xc0, 0xf0, 0xff, 0x99, 0xc4, 0xf1, 0xff, 0x84, 0xb0, 0xe5, 0xff, 0x73, 0x9f, 0xda, 0xff, 0x6b, 0x88, 0xb2, 0xff, 0x83, 0x70, 0x6b, 0xff, 0x44, 0x20, 0x18, 0xff, 0x3e, 0x21, 0x1d, 0xff, 0x5d, 0x47, 0x43, 0xff, 0x4b, 0x27, 0x1e, 0xff, 0x49, 0x24, 0x19, 0xff, 0x63, 0x4e, 0x47, 0xff, 0x54, 0x42, 0x41, 0xff, 0x51, 0x39, 0x3f, 0xff, 0x63, 0x5b, 0x59, 0xff, 0x4a, 0x37, 0x36, 0xff, 0x56, 0x34, 0x29, 0xff, 0x53, 0x31, 0x24, 0xff, 0x50, 0x2d, 0x20, 0xff, 0x51, 0x2c, 0x20, 0xff, 0x5a, 0x3f, 0x37, 0xff, 0x4a, 0x2c, 0x23, 0xff, 0x43, 0x1f, 0x15, 0xff, 0x49, 0x2f, 0x29, 0xff, 0x40, 0x29, 0x24, 0xff, 0x31, 0x15, 0x11, 0xff, 0x29, 0x0e, 0x0b, 0xff, 0x49, 0x41, 0x45, 0xff, 0x5b, 0x65, 0x75, 0xff, 0x53, 0x76, 0xa5, 0xff, 0x7f, 0xad, 0xe0, 0xff, 0x8b, 0xb7, 0xe6, 0xff, 0x87, 0xb7, 0xe5, 0xff, 0x82, 0xb4, 0xe7, 0xff, 0x7c, 0x9c, 0xc6, 0xff, 0xd8, 0xd9, 0xdb, 0xff, 0xdb, 0xdd, 0xe1, 0xff, 0xdd, 0xdf, 0xe3, 0xff, 0xdf, 0xe1, 0xe5, 0xff, 0xe2, 0xe4, 0xe6, 0xff, 0xe5, 0xe7, 0xe8, 0xff, 0xe8, 0xe9, 0xea, 0xff, 0xe9, 0xe9, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff,
-  0xed, 0xec, 0xee, 0xec, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xef, 0xee, 0xf1, 0xff, 0xef, 0xef, 0xf1, 0xff, 0xe3, 0xe5, 0xeb, 0xff, 0x8a, 0xad, 0xdd, 0xff, 0xa0, 0xcb, 0xf6, 0xff, 0xa2, 0xcb, 0xf4, 0xff, 0x94, 0xbd, 0xeb, 0xff, 0x88, 0xb5, 0xe9, 0xff, 0x7d, 0x9d, 0xc9, 0xff, 0x6f, 0x57, 0x52, 0xff, 0x49, 0x23, 0x1b, 0xff, 0x3d, 0x20, 0x1d, 0xff, 0x5a, 0x46, 0x40, 0xff, 0x49, 0x27, 0x1d, 0xff, 0x47, 0x22, 0x18, 0xff, 0x5f, 0x4a, 0x45, 0xff, 0x4d, 0x3e, 0x42, 0xff, 0x48, 0x32, 0x37, 0xff, 0x5d, 0x4d, 0x4f, 0xff, 0x4e, 0x39, 0x38, 0xff, 0x51, 0x2c, 0x20, 0xff, 0x4f, 0x2a, 0x1e, 0xff, 0x4d, 0x29, 0x1d, 0xff, 0x4f, 0x29, 0x1d, 0xff, 0x59, 0x3e, 0x37, 0xff, 0x45, 0x26, 0x1f, 0xff, 0x3b, 0x18, 0x0f, 0xff, 0x47, 0x2f, 0x2a, 0xff, 0x3e, 0x27, 0x23, 0xff, 0x31, 0x16, 0x12, 0xff, 0x35, 0x16, 0x10, 0xff, 0x48, 0x3f, 0x45, 0xff, 0x63, 0x6d, 0x7b, 0xff, 0x56, 0x76, 0xa7, 0xff, 0x6a, 0x98, 0xd3, 0xff, 0x71, 0x9e, 0xda, 0xff, 0x8d, 0xba, 0xe9, 0xff, 0x91, 0xc1, 0xee, 0xff, 0x74, 0x9a, 0xca, 0xff, 0xd0, 0xd2, 0xd7, 0xff, 0xdb, 0xdd, 0xe1, 0xff, 0xdc, 0xdf, 0xe3, 0xff, 0xdf, 0xe1, 0xe5, 0xff, 0xe3, 0xe4, 0xe6, 0xff, 0xe5, 0xe7, 0xe8, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xea, 0xe9, 0xeb, 0xff, 0xea, 0xe9, 0xeb, 0xff,
-  0xed, 0xec, 0xee, 0xec, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf1, 0xf0, 0xf2, 0xff, 0xd7, 0xdc, 0xe6, 0xff, 0x7d, 0xa8, 0xde, 0xff, 0x9b, 0xc8, 0xf5, 0xff, 0xa1, 0xcb, 0xf4, 0xff, 0x92, 0xbb, 0xea, 0xff, 0x94, 0xbf, 0xef, 0xff, 0x80, 0xa2, 0xcd, 0xff, 0x5c, 0x42, 0x41, 0xff, 0x4e, 0x28, 0x1e, 0xff, 0x3e, 0x20, 0x1d, 0xff, 0x57, 0x44, 0x3f, 0xff, 0x48, 0x25, 0x1c, 0xff, 0x45, 0x20, 0x17, 0xff, 0x5a, 0x45, 0x40, 0xff, 0x59, 0x4a, 0x48, 0xff, 0x5a, 0x49, 0x4c, 0xff, 0x64, 0x58, 0x57, 0xff, 0x5a, 0x4a, 0x44, 0xff, 0x5f, 0x48, 0x40, 0xff, 0x5b, 0x42, 0x3b, 0xff, 0x56, 0x40, 0x3b, 0xff, 0x5a, 0x42, 0x3d, 0xff, 0x5f, 0x4a, 0x45, 0xff, 0x44, 0x24, 0x1f, 0xff, 0x35, 0x14, 0x0d, 0xff, 0x48, 0x2f, 0x2a, 0xff, 0x3e, 0x26, 0x22, 0xff, 0x35, 0x18, 0x13, 0xff, 0x37, 0x18, 0x11, 0xff, 0x4b, 0x41, 0x46, 0xff, 0x64, 0x6e, 0x7d, 0xff, 0x66, 0x8a, 0xba, 0xff, 0x85, 0xb0, 0xe5, 0xff, 0x7c, 0xa9, 0xde, 0xff, 0x98, 0xc2, 0xee, 0xff, 0x9e, 0xc9, 0xf2, 0xff, 0x71, 0x9b, 0xd0, 0xff, 0xc2, 0xc9, 0xd3, 0xff, 0xdd, 0xdf, 0xe2, 0xff, 0xdc, 0xdf, 0xe3, 0xff, 0xdf, 0xe1, 0xe5, 0xff, 0xe3, 0xe4, 0xe5, 0xff, 0xe5, 0xe7, 0xe8, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xea, 0xe9, 0xeb, 0xff, 0xea, 0xe9, 0xeb, 0xff,
-  0xed, 0xeb, 0xed, 0xec, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xca, 0xd3, 0xe2, 0xff, 0x77, 0xa5, 0xdf, 0xff, 0x9c, 0xc8, 0xf5, 0xff, 0xa1, 0xcb, 0xf5, 0xff, 0x92, 0xbc, 0xeb, 0xff, 0x8e, 0xba, 0xea, 0xff, 0x80, 0xa5, 0xd0, 0xff, 0x58, 0x40, 0x41, 0xff, 0x4e, 0x28, 0x1e, 0xff, 0x3d, 0x20, 0x1d, 0xff, 0x55, 0x41, 0x3e, 0xff, 0x48, 0x26, 0x1c, 0xff, 0x44, 0x22, 0x18, 0xff, 0x43, 0x22, 0x19, 0xff, 0x4a, 0x29, 0x20, 0xff, 0x4f, 0x2d, 0x21, 0xff, 0x51, 0x31, 0x25, 0xff, 0x62, 0x51, 0x48, 0xff, 0x5d, 0x46, 0x3f, 0xff, 0x4e, 0x2d, 0x23, 0xff, 0x4f, 0x2f, 0x27, 0xff, 0x54, 0x34, 0x2a, 0xff, 0x53, 0x31, 0x26, 0xff, 0x43, 0x29, 0x2a, 0xff, 0x37, 0x24, 0x20, 0xff, 0x4b, 0x36, 0x31, 0xff, 0x3f, 0x27, 0x23, 0xff, 0x37, 0x1a, 0x14, 0xff, 0x36, 0x17, 0x0f, 0xff, 0x4f, 0x46, 0x49, 0xff, 0x69, 0x74, 0x81, 0xff, 0x6c, 0x91, 0xbe, 0xff, 0x95, 0xc0, 0xed, 0xff, 0x8f, 0xba, 0xe6, 0xff, 0xa3, 0xca, 0xf0, 0xff, 0xa9, 0xd1, 0xf6, 0xff, 0x72, 0xa0, 0xd6, 0xff, 0xb6, 0xbf, 0xce, 0xff, 0xdd, 0xe0, 0xe2, 0xff, 0xdc, 0xdf, 0xe3, 0xff, 0xdf, 0xe1, 0xe4, 0xff, 0xe3, 0xe5, 0xe6, 0xff, 0xe5, 0xe7, 0xe8, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xea, 0xeb, 0xff, 0xe9, 0xe9, 0xeb, 0xff, 0xea, 0xe9, 0xeb, 0xff,
-  0xed, 0xeb, 0xed, 0xec, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xee, 0xed, 0xef, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xef, 0xef, 0xf1, 0xff, 0xf3, 0xf2, 0xf2, 0xff, 0xc2, 0xcd, 0xdf, 0xff, 0x72, 0xa1, 0xdd, 0xff, 0xa3, 0xcd, 0xf5, 0xff, 0xa5, 0xcf, 0xf6, 0xff, 0x99, 0xc3, 0xef, 0xff, 0x85, 0xb2, 0xe5, 0xff, 0x81, 0xa6, 0xd4, 0xff, 0x5f, 0x46, 0x46, 0xff, 0x4f, 0x28, 0x1e, 0xff, 0x40, 0x22, 0x1e, 0xff, 0x52, 0x3e, 0x3b, 0xff, 0x47, 0x22, 0x18, 0xff, 0x42, 0x1f, 0x14, 0xff, 0x47, 0x29, 0x20, 0xff, 0x4b, 0x30, 0x2a, 0xff, 0x4b, 0x29, 0x26, 0xff, 0x51, 0x34, 0x2b, 0xff, 0x4f, 0x3e, 0x36, 0xff, 0x52, 0x37, 0x2f, 0xff, 0x45, 0x1e, 0x14, 0xff, 0x48, 0x22, 0x18, 0xff, 0x4f, 0x29, 0x1d, 0xff, 0x4e, 0x28, 0x1c, 0xff, 0x49, 0x2b, 0x27, 0xff, 0x3a, 0x27, 0x27, 0xff, 0x45, 0x2f, 0x2a, 0xff, 0x43, 0x28, 0x24, 0xff, 0x39, 0x1b, 0x14, 0xff, 0x2f, 0x12, 0x0b, 0xff, 0x54, 0x4e, 0x53, 0xff, 0x73, 0x7c, 0x89, 0xff, 0x74, 0x98, 0xc3, 0xff, 0x8c, 0xb9, 0xea, 0xff, 0x93, 0xbd, 0xe8, 0xff, 0xa8, 0xcf, 0xf3, 0xff, 0xa6, 0xcf, 0xf5, 0xff, 0x6a, 0x9b, 0xd5, 0xff, 0xab, 0xb7, 0xc9, 0xff, 0xdf, 0xe1, 0xe2, 0xff, 0xdc, 0xdf, 0xe3, 0xff, 0xdf, 0xe1, 0xe4, 0xff, 0xe3, 0xe5, 0xe6, 0xff, 0xe5, 0xe7, 0xe8, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xea, 0xeb, 0xff,
-  0xed, 0xeb, 0xed, 0xec, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xee, 0xed, 0xef, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xef, 0xef, 0xf1, 0xff, 0xf3, 0xf2, 0xf1, 0xff, 0xc4, 0xce, 0xdf, 0xff, 0x6d, 0x9d, 0xdb, 0xff, 0xa0, 0xc9, 0xf4, 0xff, 0xad, 0xd3, 0xf7, 0xff, 0x9f, 0xc9, 0xf3, 0xff, 0x80, 0xae, 0xe2, 0xff, 0x77, 0xa0, 0xd1, 0xff, 0x5e, 0x47, 0x48, 0xff, 0x4f, 0x28, 0x1d, 0xff, 0x44, 0x23, 0x1d, 0xff, 0x56, 0x48, 0x46, 0xff, 0x56, 0x43, 0x41, 0xff, 0x56, 0x3f, 0x3b, 0xff, 0x59, 0x47, 0x4f, 0xff, 0x5e, 0x4d, 0x4c, 0xff, 0x57, 0x40, 0x46, 0xff, 0x55, 0x44, 0x45, 0xff, 0x52, 0x43, 0x3b, 0xff, 0x5a, 0x48, 0x43, 0xff, 0x53, 0x39, 0x34, 0xff, 0x57, 0x3d, 0x36, 0xff, 0x5a, 0x3f, 0x37, 0xff, 0x56, 0x3a, 0x33, 0xff, 0x51, 0x3a, 0x3a, 0xff, 0x46, 0x36, 0x37, 0xff, 0x45, 0x35, 0x31, 0xff, 0x4a, 0x2c, 0x27, 0xff, 0x3d, 0x1e, 0x18, 0xff, 0x30, 0x13, 0x0d, 0xff, 0x63, 0x60, 0x65, 0xff, 0x7d, 0x85, 0x90, 0xff, 0x72, 0x96, 0xbf, 0xff, 0x84, 0xb3, 0xe7, 0xff, 0x96, 0xbf, 0xeb, 0xff, 0xaa, 0xd0, 0xf5, 0xff, 0xa4, 0xcd, 0xf4, 0xff, 0x65, 0x95, 0xd2, 0xff, 0xa1, 0xae, 0xc3, 0xff, 0xe0, 0xe2, 0xe3, 0xff, 0xdc, 0xdf, 0xe2, 0xff, 0xde, 0xe1, 0xe3, 0xff, 0xe3, 0xe4, 0xe5, 0xff, 0xe5, 0xe7, 0xe8, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe9, 0xea, 0xeb, 0xff,
-  0xed, 0xeb, 0xed, 0xec, 0xed, 0xec, 0xee, 0xff, 0xee, 0xed, 0xef, 0xff, 0xed, 0xec, 0xee, 0xff, 0xee, 0xed, 0xef, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf1, 0xf1, 0xf0, 0xff, 0xcf, 0xd5, 0xe1, 0xff, 0x68, 0x96, 0xd4, 0xff, 0x90, 0xbe, 0xef, 0xff, 0xa5, 0xce, 0xf6, 0xff, 0xa2, 0xcc, 0xf3, 0xff, 0x82, 0xb1, 0xe2, 0xff, 0x70, 0x98, 0xcd, 0xff, 0x59, 0x47, 0x4b, 0xff, 0x50, 0x29, 0x1d, 0xff, 0x46, 0x25, 0x1d, 0xff, 0x49, 0x2d, 0x28, 0xff, 0x56, 0x3a, 0x35, 0xff, 0x56, 0x39, 0x33, 0xff, 0x53, 0x36, 0x31, 0xff, 0x54, 0x36, 0x2e, 0xff, 0x55, 0x36, 0x2e, 0xff, 0x50, 0x32, 0x2b, 0xff, 0x50, 0x34, 0x2c, 0xff, 0x4e, 0x32, 0x2c, 0xff, 0x50, 0x35, 0x2d, 0xff, 0x4c, 0x33, 0x2e, 0xff, 0x47, 0x2e, 0x2a, 0xff, 0x4f, 0x31, 0x2c, 0xff, 0x54, 0x34, 0x2e, 0xff, 0x4c, 0x2f, 0x28, 0xff, 0x3f, 0x26, 0x20, 0xff, 0x46, 0x26, 0x1f, 0xff, 0x46, 0x25, 0x1f, 0xff, 0x34, 0x17, 0x10, 0xff, 0x6d, 0x6b, 0x72, 0xff, 0x88, 0x8f, 0x99, 0xff, 0x6e, 0x91, 0xbc, 0xff, 0x7c, 0xad, 0xe3, 0xff, 0x96, 0xc0, 0xec, 0xff, 0xa4, 0xcb, 0xf4, 0xff, 0x9b, 0xc6, 0xf2, 0xff, 0x59, 0x88, 0xc9, 0xff, 0x98, 0xa5, 0xbc, 0xff, 0xe1, 0xe2, 0xe3, 0xff, 0xdd, 0xe0, 0xe1, 0xff, 0xdf, 0xe1, 0xe2, 0xff, 0xe2, 0xe3, 0xe4, 0xff, 0xe5, 0xe7, 0xe8, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xea, 0xeb, 0xff,
-  0xed, 0xeb, 0xed, 0xec, 0xee, 0xed, 0xef, 0xff, 0xee, 0xed, 0xef, 0xff, 0xed, 0xec, 0xee, 0xff, 0xee, 0xed, 0xef, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xee, 0xef, 0xef, 0xff, 0xe1, 0xe3, 0xe7, 0xff, 0x72, 0x99, 0xcf, 0xff, 0x86, 0xb8, 0xec, 0xff, 0xa3, 0xcb, 0xf4, 0xff, 0xa1, 0xcb, 0xf2, 0xff, 0x7d, 0xad, 0xdf, 0xff, 0x6b, 0x94, 0xc9, 0xff, 0x59, 0x4a, 0x4f, 0xff, 0x4f, 0x28, 0x1c, 0xff, 0x49, 0x27, 0x20, 0xff, 0x40, 0x1f, 0x18, 0xff, 0x48, 0x24, 0x1a, 0xff, 0x48, 0x23, 0x19, 0xff, 0x47, 0x22, 0x18, 0xff, 0x48, 0x23, 0x19, 0xff, 0x4b, 0x26, 0x1c, 0xff, 0x4c, 0x27, 0x1d, 0xff, 0x48, 0x23, 0x1a, 0xff, 0x42, 0x1f, 0x16, 0xff, 0x42, 0x1e, 0x15, 0xff, 0x38, 0x18, 0x11, 0xff, 0x27, 0x0d, 0x0a, 0xff, 0x3b, 0x1b, 0x13, 0xff, 0x4a, 0x24, 0x1b, 0xff, 0x47, 0x22, 0x1a, 0xff, 0x37, 0x18, 0x10, 0xff, 0x3e, 0x1f, 0x17, 0xff, 0x3a, 0x1d, 0x18, 0xff, 0x2e, 0x13, 0x0f, 0xff, 0x74, 0x74, 0x7b, 0xff, 0x93, 0x99, 0xa2, 0xff, 0x69, 0x8b, 0xba, 0xff, 0x75, 0xa5, 0xdd, 0xff, 0x96, 0xc1, 0xed, 0xff, 0xa1, 0xc9, 0xf3, 0xff, 0x8e, 0xbd, 0xee, 0xff, 0x51, 0x81, 0xc5, 0xff, 0x96, 0xa4, 0xbc, 0xff, 0xe2, 0xe2, 0xe1, 0xff, 0xde, 0xdf, 0xe1, 0xff, 0xdf, 0xe1, 0xe2, 0xff, 0xe1, 0xe3, 0xe4, 0xff, 0xe4, 0xe6, 0xe7, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xea, 0xeb, 0xff,
-  0xed, 0xeb, 0xed, 0xec, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xee, 0xed, 0xef, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xed, 0xec, 0xee, 0xff, 0xee, 0xed, 0xec, 0xff, 0x82, 0xa0, 0xcd, 0xff, 0x75, 0xa9, 0xe3, 0xff, 0x9d, 0xc8, 0xf1, 0xff, 0x9f, 0xc8, 0xf0, 0xff, 0x7b, 0xab, 0xe0, 0xff, 0x64, 0x8d, 0xc3, 0xff, 0x59, 0x4a, 0x4e, 0xff, 0x4d, 0x26, 0x1b, 0xff, 0x4c, 0x29, 0x22, 0xff, 0x3f, 0x20, 0x1a, 0xff, 0x49, 0x26, 0x1d, 0xff, 0x48, 0x25, 0x1b, 0xff, 0x47, 0x23, 0x1b, 0xff, 0x46, 0x22, 0x1a, 0xff, 0x4a, 0x27, 0x1c, 0xff, 0x4c, 0x28, 0x1f, 0xff, 0x4a, 0x25, 0x1d, 0xff, 0x41, 0x20, 0x17, 0xff, 0x40, 0x1f, 0x16, 0xff, 0x43, 0x21, 0x18, 0xff, 0x31, 0x13, 0x0e, 0xff, 0x2f, 0x12, 0x0d, 0xff, 0x43, 0x21, 0x18, 0xff, 0x4a, 0x25, 0x1d, 0xff, 0x3d, 0x1d, 0x15, 0xff, 0x3b, 0x1d, 0x16, 0xff, 0x37, 0x1a, 0x15, 0xff, 0x35, 0x18, 0x13, 0xff, 0x79, 0x7a, 0x81, 0xff, 0x9c, 0xa0, 0xa9, 0xff, 0x63, 0x82, 0xaf, 0xff, 0x75, 0xa4, 0xdb, 0xff, 0x9b, 0xc5, 0xef, 0xff, 0x9d, 0xc5, 0xf0, 0xff, 0x86, 0xb6, 0xea, 0xff, 0x4d, 0x7e, 0xc2, 0xff, 0x9d, 0xaa, 0xbe, 0xff, 0xe0, 0xe1, 0xe2, 0xff, 0xde, 0xdf, 0xe1, 0xff, 0xdf, 0xe1, 0xe2, 0xff, 0xe1, 0xe3, 0xe4, 0xff, 0xe4, 0xe6, 0xe7, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xea, 0xeb, 0xff,
-  0xed, 0xeb, 0xed, 0xec, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xee, 0xed, 0xef, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xec, 0xec, 0xed, 0xff, 0xf2, 0xf0, 0xee, 0xff, 0x95, 0xaa, 0xce, 0xff, 0x66, 0x9a, 0xd9, 0xff, 0x99, 0xc4, 0xf0, 0xff, 0x9f, 0xca, 0xf1, 0xff, 0x7c, 0xac, 0xe0, 0xff, 0x5a, 0x80, 0xb5, 0xff, 0x3e, 0x2e, 0x30, 0xff, 0x4d, 0x27, 0x1c, 0xff, 0x4f, 0x2c, 0x22, 0xff, 0x3e, 0x1f, 0x19, 0xff, 0x49, 0x25, 0x1c, 0xff, 0x46, 0x25, 0x1a, 0xff, 0x43, 0x21, 0x18, 0xff, 0x42, 0x21, 0x18, 0xff, 0x45, 0x23, 0x19, 0xff, 0x49, 0x25, 0x1c, 0xff, 0x4a, 0x26, 0x1d, 0xff, 0x48, 0x25, 0x1b, 0xff, 0x47, 0x24, 0x1c, 0xff, 0x4b, 0x27, 0x1e, 0xff, 0x3f, 0x1d, 0x16, 0xff, 0x25, 0x0a, 0x0a, 0xff, 0x31, 0x15, 0x10, 0xff, 0x4b, 0x27, 0x1e, 0xff, 0x43, 0x22, 0x1a, 0xff, 0x36, 0x19, 0x13, 0xff, 0x35, 0x18, 0x14, 0xff, 0x3f, 0x22, 0x1b, 0xff, 0x7e, 0x80, 0x88, 0xff, 0xa2, 0xa6, 0xad, 0xff, 0x62, 0x7d, 0xa4, 0xff, 0x6f, 0x9f, 0xd8, 0xff, 0x9d, 0xc6, 0xf0, 0xff, 0x9c, 0xc4, 0xef, 0xff, 0x7a, 0xad, 0xe5, 0xff, 0x48, 0x74, 0xb7, 0xff, 0xad, 0xb5, 0xc3, 0xff, 0xde, 0xdf, 0xe0, 0xff, 0xdd, 0xdf, 0xe0, 0xff, 0xdf, 0xe1, 0xe2, 0xff, 0xe1, 0xe3, 0xe4, 0xff, 0xe4, 0xe6, 0xe7, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xea, 0xeb, 0xff,
-  0xed, 0xeb, 0xed, 0xec, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xf0, 0xee, 0xf0, 0xff, 0xee, 0xed, 0xef, 0xff, 0xeb, 0xeb, 0xed, 0xff, 0xf2, 0xef, 0xee, 0xff, 0xaf, 0xbd, 0xd4, 0xff, 0x5d, 0x8f, 0xd0, 0xff, 0x8e, 0xbc, 0xec, 0xff, 0x96, 0xc4, 0xef, 0xff, 0x77, 0xa9, 0xe0, 0xff, 0x4d, 0x6d, 0x9f, 0xff, 0x3c, 0x24, 0x1e, 0xff, 0x49, 0x26, 0x1b, 0xff, 0x52, 0x2e, 0x22, 0xff, 0x3d, 0x1f, 0x18, 0xff, 0x47, 0x24, 0x1b, 0xff, 0x47, 0x25, 0x1a, 0xff, 0x42, 0x22, 0x18, 0xff, 0x41, 0x20, 0x18, 0xff, 0x44, 0x23, 0x1a, 0xff, 0x49, 0x26, 0x1c, 0xff, 0x48, 0x26, 0x1c, 0xff, 0x49, 0x26, 0x1c, 0xff, 0x4a, 0x27, 0x1c, 0xff, 0x48, 0x24, 0x1a, 0xff, 0x4b, 0x27, 0x1d, 0xff, 0x34, 0x16, 0x11, 0xff, 0x2b, 0x10, 0x0c, 0xff, 0x40, 0x20, 0x17, 0xff, 0x4f, 0x2b, 0x21, 0xff, 0x49, 0x26, 0x1c, 0xff, 0x38, 0x1b, 0x15, 0xff, 0x36, 0x19, 0x12, 0xff, 0x7c, 0x7c, 0x81, 0xff, 0xaa, 0xae, 0xb5, 0xff, 0x6f, 0x83, 0xa5, 0xff, 0x63, 0x93, 0xcf, 0xff, 0x9a, 0xc3, 0xee, 0xff, 0x9a, 0xc3, 0xf0, 0xff, 0x6f, 0xa0, 0xde, 0xff, 0x4c, 0x72, 0xb1, 0xff, 0xbc, 0xc1, 0xc9, 0xff, 0xdb, 0xdc, 0xdf, 0xff, 0xdd, 0xde, 0xe1, 0xff, 0xde, 0xe0, 0xe1, 0xff, 0xe1, 0xe3, 0xe4, 0xff, 0xe4, 0xe6, 0xe7, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xea, 0xeb, 0xff,
-  0xed, 0xeb, 0xed, 0xec, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xf0, 0xef, 0xf1, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xee, 0xed, 0xef, 0xff, 0xeb, 0xeb, 0xed, 0xff, 0xef, 0xee, 0xed, 0xff, 0xca, 0xd0, 0xdc, 0xff, 0x5f, 0x8a, 0xc8, 0xff, 0x83, 0xb2, 0xe9, 0xff, 0x8a, 0xbb, 0xea, 0xff, 0x72, 0xa5, 0xe0, 0xff, 0x3e, 0x54, 0x82, 0xff, 0x31, 0x15, 0x0d, 0xff, 0x35, 0x18, 0x11, 0xff, 0x4c, 0x29, 0x1e, 0xff, 0x41, 0x23, 0x1a, 0xff, 0x43, 0x22, 0x1a, 0xff, 0x4a, 0x26, 0x1c, 0xff, 0x45, 0x23, 0x1a, 0xff, 0x47, 0x24, 0x1b, 0xff, 0x4a, 0x27, 0x1d, 0xff, 0x48, 0x25, 0x1b, 0xff, 0x46, 0x24, 0x1a, 0xff, 0x46, 0x25, 0x1b, 0xff, 0x3f, 0x1e, 0x15, 0xff, 0x3b, 0x1b, 0x12, 0xff, 0x4a, 0x26, 0x1d, 0xff, 0x45, 0x22, 0x19, 0xff, 0x2c, 0x0f, 0x0c, 0xff, 0x2c, 0x10, 0x0b, 0xff, 0x43, 0x22, 0x19, 0xff, 0x4a, 0x28, 0x1f, 0xff, 0x3b, 0x1e, 0x18, 0xff, 0x39, 0x19, 0x10, 0xff, 0x7b, 0x76, 0x79, 0xff, 0xaf, 0xb4, 0xba, 0xff, 0x7e, 0x8d, 0xa8, 0xff, 0x5b, 0x8a, 0xc8, 0xff, 0x98, 0xc2, 0xee, 0xff, 0x93, 0xbe, 0xed, 0xff, 0x66, 0x97, 0xd8, 0xff, 0x51, 0x71, 0xaa, 0xff, 0xc7, 0xca, 0xce, 0xff, 0xd8, 0xda, 0xde, 0xff, 0xdc, 0xde, 0xe1, 0xff, 0xde, 0xe0, 0xe1, 0xff, 0xe0, 0xe2, 0xe3, 0xff, 0xe4, 0xe6, 0xe7, 0xff, 0xe6, 0xe8, 0xe9, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xea, 0xeb, 0xff,
-  0xed, 0xeb, 0xed, 0xec, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xee, 0xed, 0xef, 0xff, 0xec, 0xec, 0xed, 0xff, 0xeb, 0xea, 0xeb, 0xff, 0xe5, 0xe4, 0xe7, 0xff, 0x6d, 0x8c, 0xc2, 0xff, 0x6d, 0x9d, 0xdd, 0xff, 0x8d, 0xbb, 0xeb, 0xff, 0x71, 0xa3, 0xdf, 0xff, 0x31, 0x43, 0x6d, 0xff, 0x44, 0x21, 0x15, 0xff, 0x4c, 0x2a, 0x1f, 0xff, 0x3c, 0x1e, 0x16, 0xff, 0x49, 0x28, 0x1d, 0xff, 0x41, 0x20, 0x18, 0xff, 0x49, 0x26, 0x1b, 0xff, 0x43, 0x21, 0x18, 0xff, 0x45, 0x23, 0x1a, 0xff, 0x4c, 0x28, 0x1e, 0xff, 0x4c, 0x28, 0x1e, 0xff, 0x46, 0x24, 0x1a, 0xff, 0x43, 0x23, 0x18, 0xff, 0x3e, 0x1e, 0x15, 0xff, 0x36, 0x18, 0x10, 0xff, 0x47, 0x24, 0x1b, 0xff, 0x4e, 0x29, 0x1f, 0xff, 0x39, 0x19, 0x13, 0xff, 0x1f, 0x07, 0x06, 0xff, 0x2a, 0x0e, 0x0b, 0xff, 0x3e, 0x1f, 0x17, 0xff, 0x42, 0x23, 0x1b, 0xff, 0x3f, 0x1c, 0x12, 0xff, 0x7a, 0x75, 0x78, 0xff, 0xb1, 0xb7, 0xbb, 0xff, 0x90, 0x9a, 0xad, 0xff, 0x57, 0x84, 0xc1, 0xff, 0x94, 0xc0, 0xec, 0xff, 0x93, 0xbe, 0xed, 0xff, 0x58, 0x89, 0xcd, 0xff, 0x61, 0x7b, 0xab, 0xff, 0xd1, 0xd2, 0xd3, 0xff, 0xd7, 0xd9, 0xdd, 0xff, 0xdb, 0xdd, 0xe1, 0xff, 0xde, 0xe0, 0xe1, 0xff, 0xe0, 0xe3, 0xe4, 0xff, 0xe4, 0xe6, 0xe7, 0xff, 0xe6, 0xe8, 0xe9, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe8, 0xea, 0xeb, 0xff,
-  0xec, 0xeb, 0xed, 0xec, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xec, 0xeb, 0xed, 0xff, 0xec, 0xeb, 0xed, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xed, 0xed, 0xef, 0xff, 0xec, 0xeb, 0xed, 0xff, 0xea, 0xe9, 0xeb, 0xff, 0xf0, 0xed, 0xeb, 0xff, 0x87, 0x9c, 0xc4, 0xff, 0x5c, 0x8c, 0xce, 0xff, 0x94, 0xc1, 0xee, 0xff, 0x76, 0xa8, 0xe3, 0xff, 0x2d, 0x3d, 0x64, 0xff, 0x47, 0x25, 0x16, 0xff, 0x5c, 0x35, 0x27, 0xff, 0x47, 0x25, 0x1c, 0xff, 0x42, 0x22, 0x19, 0xff, 0x43, 0x22, 0x1a, 0xff, 0x4a, 0x26, 0x1c, 0xff, 0x46, 0x23, 0x1a, 0xff, 0x44, 0x21, 0x19, 0xff, 0x4a, 0x26, 0x1c, 0xff, 0x4d, 0x29, 0x1f, 0xff, 0x4a, 0x26, 0x1d, 0xff, 0x43, 0x21, 0x18, 0xff, 0x42, 0x20, 0x17, 0xff, 0x3c, 0x1c, 0x13, 0xff, 0x3d, 0x1e, 0x14, 0xff, 0x4c, 0x28, 0x1e, 0xff, 0x4d, 0x29, 0x1e, 0xff, 0x39, 0x1a, 0x14, 0xff, 0x1d, 0x07, 0x06, 0xff, 0x25, 0x0d, 0x0a, 0xff, 0x47, 0x26, 0x1d, 0xff, 0x46, 0x22, 0x17, 0xff, 0x71, 0x68, 0x6b, 0xff, 0xb2, 0xb8, 0xbe, 0xff, 0x9e, 0xa6, 0xb3, 0xff, 0x59, 0x83, 0xbd, 0xff, 0x8f, 0xbb, 0xe9, 0xff, 0x92, 0xbd, 0xec, 0xff, 0x54, 0x84, 0xc9, 0xff, 0x76, 0x8a, 0xae, 0xff, 0xd6, 0xd7, 0xd7, 0xff, 0xd6, 0xd9, 0xdd, 0xff, 0xdc, 0xdd, 0xe1, 0xff, 0xdd, 0xe0, 0xe1, 0xff, 0xe0, 0xe2, 0xe3, 0xff, 0xe3, 0xe5, 0xe6, 0xff, 0xe6, 0xe8, 0xe9, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe8, 0xea, 0xeb, 0xff,
-  0xec, 0xeb, 0xed, 0xec, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xec, 0xeb, 0xed, 0xff, 0xed, 0xec, 0xee, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xed, 0xed, 0xee, 0xff, 0xeb, 0xeb, 0xed, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xf1, 0xee, 0xec, 0xff, 0xa0, 0xae, 0xc8, 0xff, 0x58, 0x83, 0xc2, 0xff, 0x94, 0xc0, 0xed, 0xff, 0x7d, 0xaf, 0xe8, 0xff, 0x35, 0x42, 0x65, 0xff, 0x44, 0x21, 0x14, 0xff, 0x4f, 0x2b, 0x1f, 0xff, 0x54, 0x2f, 0x23, 0xff, 0x49, 0x27, 0x1b, 0xff, 0x47, 0x26, 0x1c, 0xff, 0x4a, 0x26, 0x1d, 0xff, 0x4a, 0x25, 0x1c, 0xff, 0x46, 0x22, 0x1a, 0xff, 0x47, 0x23, 0x1a, 0xff, 0x4b, 0x27, 0x1d, 0xff, 0x4d, 0x28, 0x1e, 0xff, 0x46, 0x23, 0x19, 0xff, 0x3b, 0x1c, 0x13, 0xff, 0x3a, 0x1b, 0x12, 0xff, 0x38, 0x1a, 0x11, 0xff, 0x43, 0x22, 0x18, 0xff, 0x4b, 0x28, 0x1e, 0xff, 0x4e, 0x2a, 0x1f, 0xff, 0x45, 0x23, 0x1a, 0xff, 0x35, 0x18, 0x12, 0xff, 0x2d, 0x12, 0x0f, 0xff, 0x3a, 0x1a, 0x11, 0xff, 0x78, 0x6e, 0x70, 0xff, 0xb1, 0xb7, 0xbe, 0xff, 0xa9, 0xb0, 0xb9, 0xff, 0x59, 0x80, 0xb7, 0xff, 0x89, 0xb6, 0xe5, 0xff, 0x88, 0xb5, 0xe7, 0xff, 0x4a, 0x77, 0xbc, 0xff, 0x90, 0x9d, 0xb6, 0xff, 0xd7, 0xd8, 0xd9, 0xff, 0xd6, 0xd8, 0xdd, 0xff, 0xdc, 0xdd, 0xe0, 0xff, 0xde, 0xe0, 0xe1, 0xff, 0xe1, 0xe3, 0xe4, 0xff, 0xe3, 0xe5, 0xe6, 0xff, 0xe6, 0xe8, 0xe9, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe8, 0xea, 0xeb, 0xff,
-  0xec, 0xeb, 0xed, 0xe0, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xec, 0xeb, 0xed, 0xff, 0xed, 0xec, 0xee, 0xff, 0xf0, 0xee, 0xf0, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xec, 0xed, 0xee, 0xff, 0xea, 0xec, 0xed, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xef, 0xed, 0xec, 0xff, 0xb6, 0xbd, 0xcd, 0xff, 0x55, 0x7d, 0xb9, 0xff, 0x96, 0xc2, 0xf0, 0xff, 0x86, 0xb6, 0xeb, 0xff, 0x34, 0x3e, 0x5f, 0xff, 0x45, 0x21, 0x14, 0xff, 0x47, 0x24, 0x1a, 0xff, 0x46, 0x24, 0x1a, 0xff, 0x57, 0x31, 0x24, 0xff, 0x4a, 0x28, 0x1d, 0xff, 0x44, 0x23, 0x18, 0xff, 0x46, 0x24, 0x1a, 0xff, 0x43, 0x21, 0x18, 0xff, 0x43, 0x21, 0x19, 0xff, 0x45, 0x23, 0x1a, 0xff, 0x49, 0x26, 0x1c, 0xff, 0x4c, 0x27, 0x1e, 0xff, 0x40, 0x1e, 0x16, 0xff, 0x33, 0x17, 0x0f, 0xff, 0x34, 0x17, 0x10, 0xff, 0x39, 0x1b, 0x13, 0xff, 0x43, 0x21, 0x17, 0xff, 0x4b, 0x27, 0x1e, 0xff, 0x50, 0x2c, 0x20, 0xff, 0x50, 0x2b, 0x20, 0xff, 0x48, 0x25, 0x1d, 0xff, 0x30, 0x11, 0x0b, 0xff, 0x75, 0x6d, 0x6f, 0xff, 0xb1, 0xb8, 0xbe, 0xff, 0xb4, 0xb7, 0xbc, 0xff, 0x60, 0x82, 0xb5, 0xff, 0x83, 0xaf, 0xe2, 0xff, 0x84, 0xb0, 0xe5, 0xff, 0x40, 0x69, 0xac, 0xff, 0xa5, 0xad, 0xbd, 0xff, 0xd6, 0xd8, 0xd9, 0xff, 0xd5, 0xd8, 0xdc, 0xff, 0xdb, 0xdd, 0xdf, 0xff, 0xde, 0xe0, 0xe1, 0xff, 0xe0, 0xe2, 0xe3, 0xff, 0xe3, 0xe5, 0xe6, 0xff, 0xe5, 0xe7, 0xe8, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xf8,
-  0xed, 0xeb, 0xed, 0xcb, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xec, 0xeb, 0xed, 0xff, 0xec, 0xeb, 0xed, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xee, 0xee, 0xf0, 0xff, 0xeb, 0xed, 0xee, 0xff, 0xea, 0xeb, 0xec, 0xff, 0xe9, 0xe8, 0xea, 0xff, 0xed, 0xeb, 0xeb, 0xff, 0xc4, 0xc8, 0xd4, 0xff, 0x4f, 0x75, 0xb4, 0xff, 0x93, 0xc0, 0xef, 0xff, 0xa1, 0xcc, 0xf8, 0xff, 0x37, 0x43, 0x64, 0xff, 0x36, 0x16, 0x0a, 0xff, 0x4f, 0x2b, 0x1f, 0xff, 0x3e, 0x1e, 0x16, 0xff, 0x3f, 0x1e, 0x16, 0xff, 0x44, 0x22, 0x1a, 0xff, 0x3c, 0x1c, 0x14, 0xff, 0x44, 0x23, 0x19, 0xff, 0x42, 0x21, 0x17, 0xff, 0x40, 0x20, 0x17, 0xff, 0x44, 0x22, 0x19, 0xff, 0x48, 0x26, 0x1b, 0xff, 0x4b, 0x28, 0x1d, 0xff, 0x4b, 0x27, 0x1d, 0xff, 0x3e, 0x1d, 0x16, 0xff, 0x31, 0x14, 0x0f, 0xff, 0x30, 0x13, 0x0e, 0xff, 0x38, 0x19, 0x11, 0xff, 0x43, 0x21, 0x19, 0xff, 0x49, 0x26, 0x1c, 0xff, 0x49, 0x24, 0x1b, 0xff, 0x42, 0x21, 0x18, 0xff, 0x3a, 0x18, 0x0f, 0xff, 0x5d, 0x4a, 0x46, 0xff, 0xb0, 0xb6, 0xbc, 0xff, 0xb9, 0xbc, 0xbf, 0xff, 0x5c, 0x7a, 0xaa, 0xff, 0x80, 0xad, 0xe2, 0xff, 0x7d, 0xa9, 0xe1, 0xff, 0x3e, 0x60, 0xa0, 0xff, 0xb2, 0xb9, 0xc3, 0xff, 0xd4, 0xd7, 0xd9, 0xff, 0xd4, 0xd7, 0xdb, 0xff, 0xda, 0xdc, 0xde, 0xff, 0xde, 0xe0, 0xe1, 0xff, 0xe0, 0xe2, 0xe3, 0xff, 0xe2, 0xe4, 0xe5, 0xff, 0xe5, 0xe7, 0xe8, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xe0,
-  0xed, 0xeb, 0xed, 0x9f, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xef, 0xee, 0xf0, 0xff, 0xed, 0xee, 0xef, 0xff, 0xec, 0xed, 0xee, 0xff, 0xea, 0xeb, 0xed, 0xff, 0xe9, 0xe9, 0xea, 0xff, 0xec, 0xea, 0xeb, 0xff, 0xd0, 0xd3, 0xdb, 0xff, 0x5e, 0x84, 0xbd, 0xff, 0x94, 0xbe, 0xef, 0xff, 0xba, 0xdd, 0xff, 0xff, 0x66, 0x7b, 0x9d, 0xff, 0x38, 0x19, 0x0f, 0xff, 0x51, 0x2d, 0x1f, 0xff, 0x4b, 0x27, 0x1d, 0xff, 0x3a, 0x1a, 0x14, 0xff, 0x32, 0x14, 0x0f, 0xff, 0x39, 0x1a, 0x12, 0xff, 0x41, 0x1f, 0x16, 0xff, 0x42, 0x21, 0x18, 0xff, 0x42, 0x21, 0x18, 0xff, 0x44, 0x23, 0x19, 0xff, 0x48, 0x25, 0x1b, 0xff, 0x48, 0x24, 0x1b, 0xff, 0x4a, 0x27, 0x1d, 0xff, 0x48, 0x24, 0x1b, 0xff, 0x3e, 0x1e, 0x16, 0xff, 0x36, 0x18, 0x11, 0xff, 0x33, 0x16, 0x0f, 0xff, 0x38, 0x19, 0x12, 0xff, 0x44, 0x21, 0x18, 0xff, 0x47, 0x25, 0x1b, 0xff, 0x46, 0x24, 0x1a, 0xff, 0x46, 0x21, 0x17, 0xff, 0x55, 0x3d, 0x37, 0xff, 0xac, 0xb1, 0xb7, 0xff, 0xbe, 0xc0, 0xc4, 0xff, 0x65, 0x80, 0xae, 0xff, 0x85, 0xb3, 0xe6, 0xff, 0x74, 0xa1, 0xdd, 0xff, 0x3e, 0x5e, 0x9b, 0xff, 0xbd, 0xc2, 0xc9, 0xff, 0xd4, 0xd6, 0xd9, 0xff, 0xd2, 0xd6, 0xd9, 0xff, 0xda, 0xdc, 0xde, 0xff, 0xde, 0xe0, 0xe1, 0xff, 0xe0, 0xe2, 0xe3, 0xff, 0xe2, 0xe4, 0xe5, 0xff, 0xe4, 0xe6, 0xe7, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xac,
-  0xed, 0xeb, 0xed, 0x54, 0xee, 0xed, 0xef, 0xff, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xed, 0xec, 0xee, 0xff, 0xee, 0xef, 0xf0, 0xff, 0xec, 0xef, 0xf0, 0xff, 0xeb, 0xed, 0xee, 0xff, 0xe9, 0xec, 0xec, 0xff, 0xe8, 0xe9, 0xea, 0xff, 0xeb, 0xe9, 0xea, 0xff, 0xd8, 0xda, 0xe0, 0xff, 0x6b, 0x94, 0xca, 0xff, 0x91, 0xbc, 0xef, 0xff, 0xbc, 0xdd, 0xff, 0xff, 0x98, 0xb3, 0xd8, 0xff, 0x34, 0x1c, 0x19, 0xff, 0x4e, 0x2a, 0x1b, 0xff, 0x4e, 0x29, 0x1f, 0xff, 0x4a, 0x27, 0x1d, 0xff, 0x44, 0x22, 0x19, 0xff, 0x32, 0x14, 0x0f, 0xff, 0x39, 0x1a, 0x12, 0xff, 0x3e, 0x1d, 0x14, 0xff, 0x41, 0x20, 0x16, 0xff, 0x44, 0x23, 0x18, 0xff, 0x43, 0x22, 0x18, 0xff, 0x48, 0x25, 0x1b, 0xff, 0x4a, 0x26, 0x1c, 0xff, 0x49, 0x26, 0x1c, 0xff, 0x48, 0x24, 0x1b, 0xff, 0x42, 0x21, 0x18, 0xff, 0x3c, 0x1c, 0x15, 0xff, 0x37, 0x19, 0x12, 0xff, 0x3a, 0x1b, 0x12, 0xff, 0x42, 0x22, 0x18, 0xff, 0x44, 0x23, 0x19, 0xff, 0x3e, 0x1c, 0x13, 0xff, 0x4e, 0x34, 0x2d, 0xff, 0xaa, 0xae, 0xb3, 0xff, 0xc0, 0xc1, 0xc5, 0xff, 0x71, 0x8c, 0xb6, 0xff, 0x92, 0xbd, 0xef, 0xff, 0x6c, 0x9a, 0xd8, 0xff, 0x44, 0x64, 0x9e, 0xff, 0xc7, 0xca, 0xcf, 0xff, 0xd4, 0xd6, 0xda, 0xff, 0xd3, 0xd6, 0xd8, 0xff, 0xda, 0xdd, 0xde, 0xff, 0xde, 0xe0, 0xe1, 0xff, 0xe0, 0xe2, 0xe3, 0xff, 0xe2, 0xe4, 0xe5, 0xff, 0xe4, 0xe6, 0xe7, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0x5c,
-  0xee, 0xec, 0xee, 0x07, 0xee, 0xed, 0xef, 0xe3, 0xee, 0xed, 0xef, 0xff, 0xed, 0xec, 0xee, 0xff, 0xec, 0xec, 0xee, 0xff, 0xed, 0xef, 0xf0, 0xff, 0xec, 0xee, 0xef, 0xff, 0xeb, 0xed, 0xee, 0xff, 0xe9, 0xec, 0xed, 0xff, 0xe8, 0xe9, 0xeb, 0xff, 0xe9, 0xe8, 0xe9, 0xff, 0xe3, 0xe3, 0xe5, 0xff, 0x79, 0x9c, 0xcf, 0xff, 0x85, 0xb2, 0xe7, 0xff, 0xb5, 0xd6, 0xfa, 0xff, 0xb8, 0xd9, 0xfc, 0xff, 0x60, 0x5e, 0x6f, 0xff, 0x47, 0x20, 0x12, 0xff, 0x50, 0x2b, 0x1f, 0xff, 0x4d, 0x28, 0x1e, 0xff, 0x47, 0x26, 0x1a, 0xff, 0x41, 0x20, 0x17, 0xff, 0x38, 0x1a, 0x12, 0xff, 0x3a, 0x1a, 0x12, 0xff, 0x37, 0x19, 0x10, 0xff, 0x3f, 0x1f, 0x16, 0xff, 0x47, 0x24, 0x1a, 0xff, 0x47, 0x24, 0x1b, 0xff, 0x48, 0x25, 0x1c, 0xff, 0x4a, 0x26, 0x1d, 0xff, 0x4a, 0x27, 0x1c, 0xff, 0x49, 0x26, 0x1b, 0xff, 0x49, 0x25, 0x1c, 0xff, 0x49, 0x27, 0x1c, 0xff, 0x47, 0x25, 0x1a, 0xff, 0x3f, 0x1f, 0x15, 0xff, 0x40, 0x1f, 0x16, 0xff, 0x3b, 0x1b, 0x12, 0xff, 0x3b, 0x29, 0x25, 0xff, 0xa4, 0xa9, 0xaf, 0xff, 0xbf, 0xc0, 0xc4, 0xff, 0x85, 0xa3, 0xc9, 0xff, 0xa2, 0xca, 0xf7, 0xff, 0x69, 0x96, 0xd6, 0xff, 0x4a, 0x6b, 0xa4, 0xff, 0xcb, 0xce, 0xd3, 0xff, 0xd5, 0xd8, 0xdb, 0xff, 0xd4, 0xd6, 0xd9, 0xff, 0xdb, 0xdd, 0xde, 0xff, 0xdf, 0xe0, 0xe1, 0xff, 0xe1, 0xe3, 0xe4, 0xff, 0xe2, 0xe4, 0xe5, 0xff, 0xe5, 0xe7, 0xe8, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0xe4, 0xe7, 0xe9, 0xea, 0x07,
-  0xee, 0xec, 0xee, 0x00, 0xee, 0xed, 0xef, 0x54, 0xee, 0xed, 0xef, 0xff, 0xed, 0xec, 0xee, 0xff, 0xec, 0xec, 0xee, 0xff, 0xed, 0xef, 0xf0, 0xff, 0xec, 0xee, 0xef, 0xff, 0xeb, 0xed, 0xee, 0xff, 0xea, 0xec, 0xed, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xe8, 0xe9, 0xff, 0xec, 0xea, 0xe8, 0xff, 0x94, 0xaf, 0xd5, 0xff, 0x81, 0xb1, 0xe6, 0xff, 0xb5, 0xd6, 0xf8, 0xff, 0xbe, 0xdb, 0xfc, 0xff, 0xac, 0xc6, 0xeb, 0xff, 0x3f, 0x33, 0x38, 0xff, 0x37, 0x1b, 0x11, 0xff, 0x42, 0x22, 0x18, 0xff, 0x46, 0x24, 0x19, 0xff, 0x46, 0x23, 0x18, 0xff, 0x37, 0x18, 0x11, 0xff, 0x3b, 0x1b, 0x12, 0xff, 0x3f, 0x1f, 0x14, 0xff, 0x43, 0x22, 0x17, 0xff, 0x49, 0x27, 0x1c, 0xff, 0x4a, 0x27, 0x1c, 0xff, 0x4c, 0x27, 0x1d, 0xff, 0x4e, 0x28, 0x1e, 0xff, 0x4e, 0x28, 0x1e, 0xff, 0x4d, 0x28, 0x1e, 0xff, 0x4a, 0x26, 0x1c, 0xff, 0x42, 0x22, 0x18, 0xff, 0x39, 0x1d, 0x15, 0xff, 0x2e, 0x18, 0x11, 0xff, 0x26, 0x16, 0x11, 0xff, 0x14, 0x0d, 0x0d, 0xff, 0x11, 0x12, 0x15, 0xff, 0x9a, 0x9d, 0xa3, 0xff, 0xb0, 0xb3, 0xb9, 0xff, 0x83, 0xa2, 0xc3, 0xff, 0xad, 0xd4, 0xff, 0xff, 0x72, 0xa1, 0xe4, 0xff, 0x4a, 0x6a, 0xa1, 0xff, 0xcb, 0xcf, 0xd1, 0xff, 0xd6, 0xd9, 0xdb, 0xff, 0xd4, 0xd7, 0xda, 0xff, 0xdb, 0xdd, 0xde, 0xff, 0xdf, 0xe1, 0xe2, 0xff, 0xe1, 0xe3, 0xe4, 0xff, 0xe2, 0xe4, 0xe5, 0xff, 0xe4, 0xe6, 0xe7, 0xff, 0xe7, 0xe9, 0xea, 0xff, 0xe7, 0xe9, 0xea, 0x54, 0xe7, 0xe9, 0xea, 0x00,
-  0xee, 0xed, 0xef, 0x00, 0xee, 0xed, 0xef, 0x00, 0xed, 0xec, 0xee, 0x8b, 0xed, 0xec, 0xee, 0xff, 0xec, 0xec, 0xed, 0xff, 0xec, 0xee, 0xef, 0xff, 0xec, 0xee, 0xef, 0xff, 0xeb, 0xed, 0xee, 0xff, 0xea, 0xec, 0xed, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xe7, 0xe9, 0xff, 0xea, 0xea, 0xe8, 0xff, 0x93, 0xaf, 0xd4, 0xff, 0x84, 0xb4, 0xe6, 0xff, 0xad, 0xd2, 0xf5, 0xff, 0xb9, 0xd5, 0xf7, 0xff, 0xc4, 0xe0, 0xff, 0xff, 0x69, 0x7b, 0x99, 0xff, 0x02, 0x03, 0x05, 0xff, 0x13, 0x0f, 0x0f, 0xff, 0x1a, 0x10, 0x0e, 0xff, 0x1e, 0x0f, 0x0c, 0xff, 0x1f, 0x0e, 0x0b, 0xff, 0x27, 0x12, 0x0d, 0xff, 0x2e, 0x17, 0x0f, 0xff, 0x2e, 0x17, 0x10, 0xff, 0x30, 0x18, 0x11, 0xff, 0x34, 0x1c, 0x15, 0xff, 0x2f, 0x1a, 0x14, 0xff, 0x29, 0x18, 0x13, 0xff, 0x22, 0x14, 0x10, 0xff, 0x1c, 0x12, 0x0f, 0xff, 0x16, 0x10, 0x0e, 0xff, 0x10, 0x0d, 0x0d, 0xff, 0x0b, 0x0b, 0x0d, 0xff, 0x09, 0x0c, 0x0d, 0xff, 0x08, 0x0c, 0x0d, 0xff, 0x09, 0x0c, 0x0e, 0xff, 0x0a, 0x0c, 0x0e, 0xff, 0x90, 0x94, 0x99, 0xff, 0x89, 0x8b, 0x8d, 0xff, 0x15, 0x15, 0x18, 0xff, 0x49, 0x54, 0x5c, 0xff, 0x27, 0x38, 0x50, 0xff, 0x56, 0x60, 0x61, 0xff, 0xd0, 0xd3, 0xd0, 0xff, 0xd7, 0xda, 0xde, 0xff, 0xd4, 0xd8, 0xdb, 0xff, 0xdb, 0xde, 0xde, 0xff, 0xdf, 0xe1, 0xe2, 0xff, 0xe1, 0xe3, 0xe4, 0xff, 0xe2, 0xe4, 0xe5, 0xff, 0xe5, 0xe7, 0xe8, 0xff, 0xe7, 0xe9, 0xea, 0x8b, 0xe7, 0xe9, 0xea, 0x00, 0xe7, 0xe9, 0xea, 0x00,
-  0xed, 0xec, 0xee, 0x00, 0xee, 0xed, 0xef, 0x00, 0xed, 0xec, 0xee, 0x03, 0xed, 0xeb, 0xed, 0x93, 0xeb, 0xeb, 0xed, 0xff, 0xec, 0xee, 0xef, 0xff, 0xec, 0xee, 0xef, 0xff, 0xeb, 0xed, 0xee, 0xff, 0xea, 0xec, 0xed, 0xff, 0xe8, 0xe9, 0xeb, 0xff, 0xe8, 0xe7, 0xe9, 0xff, 0xe8, 0xe8, 0xe7, 0xff, 0x9a, 0xb6, 0xd8, 0xff, 0x89, 0xb5, 0xe7, 0xff, 0xa9, 0xcb, 0xf2, 0xff, 0xb9, 0xd4, 0xf6, 0xff, 0xb7, 0xd3, 0xfd, 0xff, 0xa8, 0xbd, 0xe4, 0xff, 0x16, 0x19, 0x22, 0xff, 0x05, 0x07, 0x08, 0xff, 0x06, 0x07, 0x0a, 0xff, 0x04, 0x07, 0x09, 0xff, 0x06, 0x08, 0x0a, 0xff, 0x06, 0x08, 0x0a, 0xff, 0x07, 0x08, 0x0a, 0xff, 0x08, 0x09, 0x0b, 0xff, 0x0a, 0x0c, 0x0e, 0xff, 0x0d, 0x10, 0x12, 0xff, 0x0d, 0x10, 0x12, 0xff, 0x0c, 0x10, 0x12, 0xff, 0x0b, 0x0e, 0x10, 0xff, 0x08, 0x0c, 0x0d, 0xff, 0x07, 0x0b, 0x0c, 0xff, 0x08, 0x0c, 0x0e, 0xff, 0x0b, 0x0d, 0x10, 0xff, 0x0a, 0x0d, 0x0e, 0xff, 0x0a, 0x0c, 0x0d, 0xff, 0x0b, 0x0d, 0x0e, 0xff, 0x06, 0x07, 0x0a, 0xff, 0x79, 0x7d, 0x80, 0xff, 0x9c, 0xad, 0xc4, 0xff, 0x67, 0x7b, 0x95, 0xff, 0x45, 0x4f, 0x5e, 0xff, 0x03, 0x04, 0x08, 0xff, 0x86, 0x88, 0x72, 0xff, 0xdd, 0xdf, 0xdd, 0xff, 0xd5, 0xd9, 0xdb, 0xff, 0xd5, 0xd8, 0xdb, 0xff, 0xdb, 0xdd, 0xe0, 0xff, 0xdf, 0xe1, 0xe2, 0xff, 0xe1, 0xe3, 0xe4, 0xff, 0xe2, 0xe4, 0xe5, 0xff, 0xe5, 0xe7, 0xe8, 0x94, 0xe7, 0xe9, 0xea, 0x03, 0xe7, 0xe9, 0xea, 0x00, 0xe7, 0xe9, 0xea, 0x00,
-  0xed, 0xeb, 0xed, 0x00, 0xed, 0xec, 0xee, 0x00, 0xed, 0xec, 0xee, 0x00, 0xec, 0xeb, 0xed, 0x00, 0xeb, 0xeb, 0xed, 0x53, 0xec, 0xee, 0xef, 0xdb, 0xec, 0xee, 0xef, 0xff, 0xeb, 0xed, 0xee, 0xff, 0xea, 0xec, 0xed, 0xff, 0xe8, 0xea, 0xeb, 0xff, 0xe8, 0xe7, 0xe9, 0xff, 0xe9, 0xe8, 0xe7, 0xff, 0x9d, 0xb6, 0xd6, 0xff, 0x8c, 0xb6, 0xe6, 0xff, 0xb0, 0xce, 0xf3, 0xff, 0xb5, 0xce, 0xf5, 0xff, 0x99, 0xb8, 0xf1, 0xff, 0xc2, 0xd8, 0xff, 0xff, 0x45, 0x4e, 0x61, 0xff, 0x04, 0x05, 0x04, 0xff, 0x0b, 0x0c, 0x0e, 0xff, 0x09, 0x09, 0x0b, 0xff, 0x07, 0x08, 0x09, 0xff, 0x06, 0x07, 0x08, 0xff, 0x05, 0x06, 0x07, 0xff, 0x06, 0x05, 0x07, 0xff, 0x07, 0x07, 0x09, 0xff, 0x0f, 0x0f, 0x10, 0xff, 0x16, 0x16, 0x18, 0xff, 0x11, 0x13, 0x15, 0xff, 0x10, 0x12, 0x13, 0xff, 0x0b, 0x0d, 0x0e, 0xff, 0x09, 0x0c, 0x0e, 0xff, 0x09, 0x0c, 0x0f, 0xff, 0x09, 0x0b, 0x0c, 0xff, 0x08, 0x0a, 0x0b, 0xff, 0x08, 0x0a, 0x0b, 0xff, 0x09, 0x0b, 0x0c, 0xff, 0x05, 0x05, 0x06, 0xff, 0x67, 0x71, 0x7f, 0xff, 0xb1, 0xcf, 0xf9, 0xff, 0xb6, 0xdc, 0xff, 0xff, 0xa0, 0xcd, 0xfa, 0xff, 0x51, 0x7a, 0xb1, 0xff, 0x83, 0x8b, 0x92, 0xff, 0xde, 0xdf, 0xdf, 0xff, 0xd5, 0xd9, 0xda, 0xff, 0xd6, 0xd9, 0xdc, 0xff, 0xdb, 0xde, 0xe1, 0xff, 0xe0, 0xe2, 0xe2, 0xff, 0xe1, 0xe3, 0xe4, 0xdb, 0xe3, 0xe5, 0xe6, 0x54, 0xe5, 0xe7, 0xe8, 0x00, 0xe6, 0xe8, 0xe9, 0x00, 0xe7, 0xe9, 0xea, 0x00, 0xe7, 0xe9, 0xea, 0x00,
-  0xed, 0xeb, 0xed, 0x00, 0xed, 0xec, 0xee, 0x00, 0xed, 0xec, 0xee, 0x00, 0xec, 0xeb, 0xed, 0x00, 0xeb, 0xeb, 0xed, 0x00, 0xec, 0xee, 0xef, 0x07, 0xeb, 0xed, 0xee, 0x5b, 0xeb, 0xed, 0xee, 0xac, 0xea, 0xec, 0xed, 0xdf, 0xe8, 0xea, 0xeb, 0xfb, 0xe8, 0xe8, 0xe9, 0xff, 0xe9, 0xe8, 0xe8, 0xff, 0xa1, 0xb6, 0xd5, 0xff, 0x91, 0xb7, 0xe6, 0xff, 0xb6, 0xcd, 0xf6, 0xff, 0xb0, 0xc7, 0xf6, 0xff, 0x6d, 0x8b, 0xd3, 0xff, 0xbb, 0xd4, 0xfe, 0xff, 0x57, 0x62, 0x7b, 0xff, 0x02, 0x03, 0x02, 0xff, 0x11, 0x13, 0x14, 0xff, 0x0f, 0x11, 0x12, 0xff, 0x0d, 0x0f, 0x10, 0xff, 0x0d, 0x0e, 0x10, 0xff, 0x0b, 0x0d, 0x0e, 0xff, 0x0b, 0x0c, 0x0d, 0xff, 0x09, 0x0a, 0x0b, 0xff, 0x09, 0x08, 0x0a, 0xff, 0x0b, 0x09, 0x0b, 0xff, 0x0f, 0x10, 0x11, 0xff, 0x11, 0x11, 0x12, 0xff, 0x08, 0x09, 0x0a, 0xff, 0x05, 0x07, 0x08, 0xff, 0x07, 0x09, 0x0b, 0xff, 0x07, 0x0a, 0x0b, 0xff, 0x09, 0x0b, 0x0c, 0xff, 0x09, 0x0b, 0x0c, 0xff, 0x0a, 0x0b, 0x0c, 0xff, 0x08, 0x0a, 0x0c, 0xff, 0x77, 0x8d, 0xaf, 0xff, 0xba, 0xd7, 0xfd, 0xff, 0xaf, 0xd0, 0xf4, 0xff, 0x96, 0xc4, 0xee, 0xff, 0x61, 0x94, 0xd1, 0xff, 0x86, 0x99, 0xb8, 0xff, 0xdd, 0xdd, 0xdd, 0xff, 0xd5, 0xd9, 0xda, 0xfb, 0xd8, 0xda, 0xdd, 0xdf, 0xdc, 0xde, 0xe1, 0xac, 0xde, 0xe1, 0xe2, 0x5b, 0xe1, 0xe3, 0xe4, 0x07, 0xe3, 0xe5, 0xe6, 0x00, 0xe5, 0xe7, 0xe8, 0x00, 0xe6, 0xe8, 0xe9, 0x00, 0xe7, 0xe9, 0xea, 0x00, 0xe7, 0xe9, 0xea, 0x00,
-#endif
-};
-
-const lv_img_dsc_t img_clothes = {
-  .header.always_zero = 0,
-  .header.w = 56,
-  .header.h = 56,
-  .data_size = 3136 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .data = img_clothes_map,
-};
-
-#endif
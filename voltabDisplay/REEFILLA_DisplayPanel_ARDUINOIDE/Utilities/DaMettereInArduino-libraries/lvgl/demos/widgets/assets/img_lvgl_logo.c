@@ -1,209 +0,0 @@
-#include "../../../lvgl.h"
-
-#if LV_USE_DEMO_WIDGETS
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMG_LVGL_LOGO
-#define LV_ATTRIBUTE_IMG_IMG_LVGL_LOGO
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_IMG_LVGL_LOGO uint8_t img_lvgl_logo_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Blue: 2 bit, Green: 3 bit, Red: 3 bit, Alpha 8 bit */
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x6e, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x6e, 0xff, 0xb6, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x92, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6e, 0xff, 0xdb, 0xff, 0xff, 0xff,
-  0xb6, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x92, 0xff, 0xff, 0xff,
-  0x6e, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x49, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6e, 0xff, 0xff, 0xff,
-  0x6d, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6e, 0xff, 0xb7, 0xff, 0xb6, 0xff, 0x6d, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x49, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x96, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0x92, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x49, 0xff, 0x6d, 0xff, 0x6d, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0x6d, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xb7, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0xb6, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0xfb, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0xed, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe4, 0xff, 0xe5, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0xe9, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0xe9, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0xe9, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0xe9, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0xe9, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0xe9, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0xe9, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0xe9, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0xe9, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0xe9, 0xff, 0xe4, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe4, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0xf6, 0xff, 0xee, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xed, 0xff, 0xee, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x49, 0xff, 0x29, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x6e, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0xe9, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xee, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0xe9, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xee, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0xe9, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xee, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0xe9, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xee, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0xe9, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xee, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0xe9, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xee, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0xe9, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xee, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0xe9, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xee, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xff, 0xff,
-  0xe9, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xee, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x92, 0xff, 0xff, 0xff,
-  0xe9, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xee, 0xff, 0xff, 0xff, 0xb7, 0xff, 0x49, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x6d, 0xff, 0xdb, 0xff, 0xff, 0xff,
-  0xf2, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe9, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe9, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xfb, 0xff, 0x92, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x49, 0xff, 0x6e, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Blue: 5 bit, Green: 6 bit, Red: 5 bit, Alpha 8 bit*/
-  0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x7d, 0xef, 0xff, 0xdb, 0xde, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0x9a, 0xd6, 0xff, 0xdb, 0xde, 0xff, 0x5d, 0xef, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xdf, 0xff, 0xff, 0xdb, 0xde, 0xff, 0x14, 0xa5, 0xff, 0x6e, 0x73, 0xff, 0xcb, 0x5a, 0xff, 0xab, 0x5a, 0xff, 0xab, 0x5a, 0xff, 0xab, 0x5a, 0xff, 0xab, 0x5a, 0xff, 0xab, 0x5a, 0xff, 0xab, 0x5a, 0xff, 0xab, 0x5a, 0xff, 0xab, 0x5a, 0xff, 0xab, 0x5a, 0xff, 0xab, 0x5a, 0xff, 0xab, 0x5a, 0xff, 0xab, 0x5a, 0xff, 0xab, 0x5a, 0xff, 0xab, 0x5a, 0xff, 0xab, 0x5a, 0xff, 0xab, 0x5a, 0xff, 0xab, 0x5a, 0xff, 0xab, 0x5a, 0xff, 0xab, 0x5a, 0xff, 0xab, 0x5a, 0xff, 0xab, 0x5a, 0xff, 0xab, 0x5a, 0xff, 0xab, 0x5a, 0xff, 0xab, 0x5a, 0xff, 0xab, 0x5a, 0xff, 0xab, 0x5a, 0xff, 0xab, 0x5a, 0xff, 0xab, 0x5a, 0xff, 0xab, 0x5a, 0xff, 0xab, 0x5a, 0xff, 0xab, 0x5a, 0xff, 0xcb, 0x5a, 0xff, 0x4d, 0x6b, 0xff, 0xd3, 0x9c, 0xff, 0x7a, 0xd6, 0xff, 0xbe, 0xf7, 0xff, 0xff, 0xff, 0xff,
-  0x1c, 0xe7, 0xff, 0xef, 0x7b, 0xff, 0x86, 0x31, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x45, 0x29, 0xff, 0x4d, 0x6b, 0xff, 0x79, 0xce, 0xff, 0xff, 0xff, 0xff,
-  0xf4, 0xa4, 0xff, 0xc7, 0x39, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x66, 0x31, 0xff, 0x51, 0x8c, 0xff, 0xbe, 0xf7, 0xff,
-  0x2d, 0x6b, 0xff, 0x45, 0x29, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x86, 0x31, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x66, 0x29, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x0c, 0x63, 0xff, 0x5d, 0xef, 0xff,
-  0x8a, 0x52, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x45, 0x29, 0xff, 0x6d, 0x6b, 0xff, 0x14, 0xa5, 0xff, 0xf4, 0xa4, 0xff, 0xec, 0x62, 0xff, 0x45, 0x29, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0x1c, 0xe7, 0xff,
-  0x8a, 0x52, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xc7, 0x39, 0xff, 0x18, 0xc6, 0xff, 0x9e, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0x14, 0xa5, 0xff, 0x08, 0x42, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0x8a, 0x52, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xe8, 0x41, 0xff, 0xfb, 0xde, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x96, 0xb5, 0xff, 0x49, 0x4a, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0x8a, 0x52, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x66, 0x29, 0xff, 0x92, 0x94, 0xff, 0x9a, 0xd6, 0xff, 0x59, 0xce, 0xff, 0xf0, 0x7b, 0xff, 0x86, 0x31, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0x8a, 0x52, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xe8, 0x39, 0xff, 0xab, 0x52, 0xff, 0xaa, 0x52, 0xff, 0xa7, 0x39, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0x8a, 0x52, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0xab, 0x5a, 0xff, 0x25, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0x31, 0x84, 0xff, 0x29, 0x42, 0xff, 0xa7, 0x39, 0xff, 0xa7, 0x31, 0xff, 0xa7, 0x31, 0xff, 0xa7, 0x31, 0xff, 0xa7, 0x31, 0xff, 0xa7, 0x31, 0xff, 0xa7, 0x31, 0xff, 0xa7, 0x31, 0xff, 0xa7, 0x31, 0xff, 0xa7, 0x31, 0xff, 0x86, 0x31, 0xff, 0x45, 0x29, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0x3c, 0xe7, 0xff, 0x76, 0xb5, 0xff, 0xd3, 0x9c, 0xff, 0xb3, 0x9c, 0xff, 0xb3, 0x9c, 0xff, 0xb3, 0x9c, 0xff, 0xb3, 0x9c, 0xff, 0xb3, 0x9c, 0xff, 0xb3, 0x9c, 0xff, 0xb3, 0x9c, 0xff, 0xb3, 0x9c, 0xff, 0xb3, 0x94, 0xff, 0x72, 0x8c, 0xff, 0x4d, 0x6b, 0xff, 0xa7, 0x31, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0x9e, 0xff, 0xff, 0x1c, 0xf7, 0xff, 0xfb, 0xf6, 0xff, 0xdb, 0xf6, 0xff, 0xdb, 0xf6, 0xff, 0xdb, 0xf6, 0xff, 0xdb, 0xf6, 0xff, 0xdb, 0xf6, 0xff, 0xdb, 0xf6, 0xff, 0xdb, 0xf6, 0xff, 0xdb, 0xf6, 0xff, 0x1c, 0xf7, 0xff, 0x5d, 0xef, 0xff, 0x7a, 0xd6, 0xff, 0x6e, 0x6b, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0xd7, 0xfd, 0xff, 0x51, 0xf4, 0xff, 0x10, 0xec, 0xff, 0x10, 0xec, 0xff, 0x10, 0xec, 0xff, 0x10, 0xec, 0xff, 0x10, 0xec, 0xff, 0x10, 0xec, 0xff, 0x10, 0xec, 0xff, 0x10, 0xec, 0xff, 0x10, 0xec, 0xff, 0xb2, 0xf4, 0xff, 0xbb, 0xfe, 0xff, 0x5d, 0xf7, 0xff, 0x72, 0x8c, 0xff, 0x25, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0xec, 0xea, 0xff, 0x04, 0xe1, 0xff, 0xc3, 0xd8, 0xff, 0xc3, 0xd8, 0xff, 0xc3, 0xd8, 0xff, 0xc3, 0xd8, 0xff, 0xc3, 0xd8, 0xff, 0xc3, 0xd8, 0xff, 0xc3, 0xd8, 0xff, 0xc3, 0xd8, 0xff, 0xc3, 0xd8, 0xff, 0x45, 0xe1, 0xff, 0x34, 0xf5, 0xff, 0x5d, 0xf7, 0xff, 0xb3, 0x94, 0xff, 0x25, 0x29, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0xc7, 0xe1, 0xff, 0x20, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x61, 0xd8, 0xff, 0x71, 0xf4, 0xff, 0x3c, 0xf7, 0xff, 0xb3, 0x94, 0xff, 0x25, 0x29, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0xa7, 0xe1, 0xff, 0x20, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x61, 0xd8, 0xff, 0x71, 0xf4, 0xff, 0x3c, 0xf7, 0xff, 0xb3, 0x94, 0xff, 0x25, 0x29, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0xa7, 0xe1, 0xff, 0x20, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x61, 0xd8, 0xff, 0x71, 0xf4, 0xff, 0x3c, 0xf7, 0xff, 0xb3, 0x94, 0xff, 0x25, 0x29, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0xa7, 0xe1, 0xff, 0x20, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x61, 0xd8, 0xff, 0x71, 0xf4, 0xff, 0x3c, 0xf7, 0xff, 0xb3, 0x94, 0xff, 0x25, 0x29, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0xa7, 0xe1, 0xff, 0x20, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x61, 0xd8, 0xff, 0x71, 0xf4, 0xff, 0x3c, 0xf7, 0xff, 0xb3, 0x94, 0xff, 0x25, 0x29, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0xa7, 0xe1, 0xff, 0x20, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x61, 0xd8, 0xff, 0x71, 0xf4, 0xff, 0x3c, 0xf7, 0xff, 0xb3, 0x94, 0xff, 0x25, 0x29, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0xa7, 0xe1, 0xff, 0x20, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x61, 0xd8, 0xff, 0x71, 0xf4, 0xff, 0x3c, 0xf7, 0xff, 0xb3, 0x94, 0xff, 0x25, 0x29, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0xa7, 0xe1, 0xff, 0x20, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x61, 0xd8, 0xff, 0x71, 0xf4, 0xff, 0x3c, 0xf7, 0xff, 0xb3, 0x94, 0xff, 0x25, 0x29, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0xc7, 0xe1, 0xff, 0x20, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x61, 0xd8, 0xff, 0x71, 0xf4, 0xff, 0x3c, 0xf7, 0xff, 0xd3, 0x9c, 0xff, 0x45, 0x29, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0x69, 0xe2, 0xff, 0x82, 0xd8, 0xff, 0x61, 0xd8, 0xff, 0x61, 0xd8, 0xff, 0x61, 0xd8, 0xff, 0x61, 0xd8, 0xff, 0x61, 0xd8, 0xff, 0x61, 0xd8, 0xff, 0x61, 0xd8, 0xff, 0x61, 0xd8, 0xff, 0x61, 0xd8, 0xff, 0xc3, 0xd8, 0xff, 0xd3, 0xf4, 0xff, 0x5d, 0xf7, 0xff, 0x55, 0xad, 0xff, 0xe8, 0x41, 0xff, 0x66, 0x29, 0xff, 0x45, 0x29, 0xff, 0x45, 0x29, 0xff, 0x45, 0x29, 0xff, 0x45, 0x29, 0xff, 0x45, 0x29, 0xff, 0x45, 0x29, 0xff, 0x45, 0x29, 0xff, 0x45, 0x29, 0xff, 0x45, 0x29, 0xff, 0x45, 0x29, 0xff, 0x25, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0xf4, 0xf4, 0xff, 0x0c, 0xeb, 0xff, 0xcb, 0xea, 0xff, 0xcb, 0xea, 0xff, 0xcb, 0xea, 0xff, 0xcb, 0xea, 0xff, 0xcb, 0xea, 0xff, 0xcb, 0xea, 0xff, 0xcb, 0xea, 0xff, 0xcb, 0xea, 0xff, 0xcb, 0xea, 0xff, 0x6d, 0xeb, 0xff, 0x59, 0xfe, 0xff, 0xbf, 0xff, 0xff, 0xbb, 0xd6, 0xff, 0x92, 0x94, 0xff, 0x8e, 0x73, 0xff, 0x6e, 0x6b, 0xff, 0x6d, 0x6b, 0xff, 0x6d, 0x6b, 0xff, 0x6d, 0x6b, 0xff, 0x6d, 0x6b, 0xff, 0x6d, 0x6b, 0xff, 0x6d, 0x6b, 0xff, 0x6d, 0x6b, 0xff, 0x6d, 0x6b, 0xff, 0x4d, 0x6b, 0xff, 0x8a, 0x52, 0xff, 0x86, 0x31, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0x7e, 0xff, 0xff, 0xdb, 0xfe, 0xff, 0x9a, 0xfe, 0xff, 0x9a, 0xfe, 0xff, 0x9a, 0xfe, 0xff, 0x9a, 0xfe, 0xff, 0x9a, 0xfe, 0xff, 0x9a, 0xfe, 0xff, 0x9a, 0xfe, 0xff, 0x9a, 0xfe, 0xff, 0x9a, 0xfe, 0xff, 0xfb, 0xfe, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x5d, 0xef, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xdb, 0xde, 0xff, 0xbb, 0xde, 0xff, 0x18, 0xc6, 0xff, 0x6e, 0x73, 0xff, 0x45, 0x29, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0x1c, 0xff, 0xff, 0xb6, 0xf5, 0xff, 0x55, 0xf5, 0xff, 0x55, 0xf5, 0xff, 0x55, 0xf5, 0xff, 0x55, 0xf5, 0xff, 0x55, 0xf5, 0xff, 0x55, 0xf5, 0xff, 0x55, 0xf5, 0xff, 0x55, 0xf5, 0xff, 0x55, 0xf5, 0xff, 0xf7, 0xf5, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xf8, 0xfd, 0xff, 0x55, 0xf5, 0xff, 0x55, 0xf5, 0xff, 0x55, 0xf5, 0xff, 0x55, 0xf5, 0xff, 0x55, 0xf5, 0xff, 0x55, 0xf5, 0xff, 0x55, 0xf5, 0xff, 0x55, 0xf5, 0xff, 0x55, 0xf5, 0xff, 0xd7, 0xf5, 0xff, 0x1c, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xf3, 0x9c, 0xff, 0xa7, 0x31, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0xef, 0xeb, 0xff, 0xe7, 0xe1, 0xff, 0x86, 0xe1, 0xff, 0x86, 0xe1, 0xff, 0x86, 0xe1, 0xff, 0x86, 0xe1, 0xff, 0x86, 0xe1, 0xff, 0x86, 0xe1, 0xff, 0x86, 0xe1, 0xff, 0x86, 0xe1, 0xff, 0x86, 0xe1, 0xff, 0x49, 0xe2, 0xff, 0xb6, 0xf5, 0xff, 0x9e, 0xff, 0xff, 0x76, 0xf5, 0xff, 0x29, 0xe2, 0xff, 0xa6, 0xe1, 0xff, 0x86, 0xe1, 0xff, 0x86, 0xe1, 0xff, 0x86, 0xe1, 0xff, 0x86, 0xe1, 0xff, 0x86, 0xe1, 0xff, 0x86, 0xe1, 0xff, 0x86, 0xe1, 0xff, 0xa6, 0xe1, 0xff, 0xe8, 0xe1, 0xff, 0xb3, 0xf4, 0xff, 0x7e, 0xff, 0xff, 0x35, 0xad, 0xff, 0xc7, 0x39, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0xe7, 0xe1, 0xff, 0x21, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x82, 0xd8, 0xff, 0x92, 0xf4, 0xff, 0x3d, 0xff, 0xff, 0x51, 0xf4, 0xff, 0x62, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x41, 0xd8, 0xff, 0x6d, 0xeb, 0xff, 0x1c, 0xff, 0xff, 0x35, 0xad, 0xff, 0xc7, 0x39, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0xa7, 0xe1, 0xff, 0x20, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x61, 0xd8, 0xff, 0x71, 0xf4, 0xff, 0x1c, 0xff, 0xff, 0x31, 0xec, 0xff, 0x41, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x21, 0xd8, 0xff, 0x4d, 0xeb, 0xff, 0xfc, 0xfe, 0xff, 0x35, 0xad, 0xff, 0xc7, 0x39, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0xa7, 0xe1, 0xff, 0x20, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x61, 0xd8, 0xff, 0x71, 0xf4, 0xff, 0x1c, 0xff, 0xff, 0x31, 0xec, 0xff, 0x41, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x21, 0xd8, 0xff, 0x4d, 0xeb, 0xff, 0xfc, 0xfe, 0xff, 0x35, 0xad, 0xff, 0xc7, 0x39, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0xa7, 0xe1, 0xff, 0x20, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x61, 0xd8, 0xff, 0x71, 0xf4, 0xff, 0x1c, 0xff, 0xff, 0x31, 0xec, 0xff, 0x41, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x21, 0xd8, 0xff, 0x4d, 0xeb, 0xff, 0xfc, 0xfe, 0xff, 0x35, 0xad, 0xff, 0xc7, 0x39, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0xa7, 0xe1, 0xff, 0x20, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x61, 0xd8, 0xff, 0x71, 0xf4, 0xff, 0x1c, 0xff, 0xff, 0x31, 0xec, 0xff, 0x41, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x21, 0xd8, 0xff, 0x4d, 0xeb, 0xff, 0xfc, 0xfe, 0xff, 0x35, 0xad, 0xff, 0xc7, 0x39, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0xa7, 0xe1, 0xff, 0x20, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x61, 0xd8, 0xff, 0x71, 0xf4, 0xff, 0x1c, 0xff, 0xff, 0x31, 0xec, 0xff, 0x41, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x21, 0xd8, 0xff, 0x4d, 0xeb, 0xff, 0xfc, 0xfe, 0xff, 0x35, 0xad, 0xff, 0xc7, 0x39, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0xa7, 0xe1, 0xff, 0x20, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x61, 0xd8, 0xff, 0x71, 0xf4, 0xff, 0x1c, 0xff, 0xff, 0x31, 0xec, 0xff, 0x41, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x21, 0xd8, 0xff, 0x4d, 0xeb, 0xff, 0xfc, 0xfe, 0xff, 0x35, 0xad, 0xff, 0xc7, 0x39, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xcb, 0x5a, 0xff, 0xfc, 0xe6, 0xff,
-  0xa7, 0xe1, 0xff, 0x20, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x61, 0xd8, 0xff, 0x71, 0xf4, 0xff, 0x1c, 0xff, 0xff, 0x31, 0xec, 0xff, 0x41, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x21, 0xd8, 0xff, 0x4d, 0xeb, 0xff, 0xfc, 0xfe, 0xff, 0x35, 0xad, 0xff, 0xc7, 0x39, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0xeb, 0x5a, 0xff, 0x1c, 0xe7, 0xff,
-  0xa7, 0xe1, 0xff, 0x20, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x61, 0xd8, 0xff, 0x71, 0xf4, 0xff, 0x1c, 0xff, 0xff, 0x31, 0xec, 0xff, 0x41, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x21, 0xd8, 0xff, 0x4d, 0xeb, 0xff, 0xfc, 0xfe, 0xff, 0x35, 0xad, 0xff, 0xc7, 0x39, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x45, 0x29, 0xff, 0xaf, 0x7b, 0xff, 0x9e, 0xf7, 0xff,
-  0xc7, 0xe1, 0xff, 0x20, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x61, 0xd8, 0xff, 0x72, 0xf4, 0xff, 0x3c, 0xff, 0xff, 0x51, 0xf4, 0xff, 0x41, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x00, 0xd8, 0xff, 0x21, 0xd8, 0xff, 0x4d, 0xeb, 0xff, 0x1c, 0xff, 0xff, 0x75, 0xb5, 0xff, 0x08, 0x42, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x04, 0x21, 0xff, 0x25, 0x21, 0xff, 0xab, 0x52, 0xff, 0xb7, 0xbd, 0xff, 0xdf, 0xff, 0xff,
-  0xcf, 0xeb, 0xff, 0x86, 0xe1, 0xff, 0x45, 0xe1, 0xff, 0x45, 0xe1, 0xff, 0x45, 0xe1, 0xff, 0x45, 0xe1, 0xff, 0x45, 0xe1, 0xff, 0x45, 0xe1, 0xff, 0x45, 0xe1, 0xff, 0x45, 0xe1, 0xff, 0x45, 0xe1, 0xff, 0xe7, 0xe1, 0xff, 0x96, 0xf5, 0xff, 0x7e, 0xff, 0xff, 0x55, 0xf5, 0xff, 0xe8, 0xe1, 0xff, 0x45, 0xe1, 0xff, 0x45, 0xe1, 0xff, 0x45, 0xe1, 0xff, 0x45, 0xe1, 0xff, 0x45, 0xe1, 0xff, 0x45, 0xe1, 0xff, 0x45, 0xe1, 0xff, 0x45, 0xe1, 0xff, 0x45, 0xe1, 0xff, 0xa6, 0xe1, 0xff, 0x92, 0xf4, 0xff, 0x7e, 0xff, 0xff, 0x9a, 0xd6, 0xff, 0xaf, 0x7b, 0xff, 0x49, 0x4a, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x08, 0x42, 0xff, 0x49, 0x4a, 0xff, 0x4d, 0x6b, 0xff, 0x96, 0xb5, 0xff, 0x5d, 0xef, 0xff, 0xff, 0xff, 0xff,
-  0xdb, 0xfe, 0xff, 0xd7, 0xfd, 0xff, 0x76, 0xf5, 0xff, 0x76, 0xf5, 0xff, 0x76, 0xf5, 0xff, 0x76, 0xf5, 0xff, 0x76, 0xf5, 0xff, 0x76, 0xf5, 0xff, 0x76, 0xf5, 0xff, 0x76, 0xf5, 0xff, 0x76, 0xf5, 0xff, 0xf8, 0xfd, 0xff, 0x5d, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x18, 0xfe, 0xff, 0x96, 0xf5, 0xff, 0x76, 0xf5, 0xff, 0x76, 0xf5, 0xff, 0x76, 0xf5, 0xff, 0x76, 0xf5, 0xff, 0x76, 0xf5, 0xff, 0x76, 0xf5, 0xff, 0x76, 0xf5, 0xff, 0x96, 0xf5, 0xff, 0xd7, 0xf5, 0xff, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0xdb, 0xde, 0xff, 0xf8, 0xc5, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0xd7, 0xbd, 0xff, 0x18, 0xc6, 0xff, 0xdb, 0xde, 0xff, 0x9e, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format:  Blue: 5 bit Green: 6 bit, Red: 5 bit, Alpha 8 bit  BUT the 2  color bytes are swapped*/
-  0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xef, 0x7d, 0xff, 0xde, 0xdb, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xd6, 0x9a, 0xff, 0xde, 0xdb, 0xff, 0xef, 0x5d, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xdf, 0xff, 0xde, 0xdb, 0xff, 0xa5, 0x14, 0xff, 0x73, 0x6e, 0xff, 0x5a, 0xcb, 0xff, 0x5a, 0xab, 0xff, 0x5a, 0xab, 0xff, 0x5a, 0xab, 0xff, 0x5a, 0xab, 0xff, 0x5a, 0xab, 0xff, 0x5a, 0xab, 0xff, 0x5a, 0xab, 0xff, 0x5a, 0xab, 0xff, 0x5a, 0xab, 0xff, 0x5a, 0xab, 0xff, 0x5a, 0xab, 0xff, 0x5a, 0xab, 0xff, 0x5a, 0xab, 0xff, 0x5a, 0xab, 0xff, 0x5a, 0xab, 0xff, 0x5a, 0xab, 0xff, 0x5a, 0xab, 0xff, 0x5a, 0xab, 0xff, 0x5a, 0xab, 0xff, 0x5a, 0xab, 0xff, 0x5a, 0xab, 0xff, 0x5a, 0xab, 0xff, 0x5a, 0xab, 0xff, 0x5a, 0xab, 0xff, 0x5a, 0xab, 0xff, 0x5a, 0xab, 0xff, 0x5a, 0xab, 0xff, 0x5a, 0xab, 0xff, 0x5a, 0xab, 0xff, 0x5a, 0xab, 0xff, 0x5a, 0xab, 0xff, 0x5a, 0xcb, 0xff, 0x6b, 0x4d, 0xff, 0x9c, 0xd3, 0xff, 0xd6, 0x7a, 0xff, 0xf7, 0xbe, 0xff, 0xff, 0xff, 0xff,
-  0xe7, 0x1c, 0xff, 0x7b, 0xef, 0xff, 0x31, 0x86, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x29, 0x45, 0xff, 0x6b, 0x4d, 0xff, 0xce, 0x79, 0xff, 0xff, 0xff, 0xff,
-  0xa4, 0xf4, 0xff, 0x39, 0xc7, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x31, 0x66, 0xff, 0x8c, 0x51, 0xff, 0xf7, 0xbe, 0xff,
-  0x6b, 0x2d, 0xff, 0x29, 0x45, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x31, 0x86, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x29, 0x66, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x63, 0x0c, 0xff, 0xef, 0x5d, 0xff,
-  0x52, 0x8a, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x29, 0x45, 0xff, 0x6b, 0x6d, 0xff, 0xa5, 0x14, 0xff, 0xa4, 0xf4, 0xff, 0x62, 0xec, 0xff, 0x29, 0x45, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe7, 0x1c, 0xff,
-  0x52, 0x8a, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x39, 0xc7, 0xff, 0xc6, 0x18, 0xff, 0xf7, 0x9e, 0xff, 0xef, 0x5d, 0xff, 0xa5, 0x14, 0xff, 0x42, 0x08, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0x52, 0x8a, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x41, 0xe8, 0xff, 0xde, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xb5, 0x96, 0xff, 0x4a, 0x49, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0x52, 0x8a, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x29, 0x66, 0xff, 0x94, 0x92, 0xff, 0xd6, 0x9a, 0xff, 0xce, 0x59, 0xff, 0x7b, 0xf0, 0xff, 0x31, 0x86, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0x52, 0x8a, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x39, 0xe8, 0xff, 0x52, 0xab, 0xff, 0x52, 0xaa, 0xff, 0x39, 0xa7, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0x52, 0x8a, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0x5a, 0xab, 0xff, 0x21, 0x25, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0x84, 0x31, 0xff, 0x42, 0x29, 0xff, 0x39, 0xa7, 0xff, 0x31, 0xa7, 0xff, 0x31, 0xa7, 0xff, 0x31, 0xa7, 0xff, 0x31, 0xa7, 0xff, 0x31, 0xa7, 0xff, 0x31, 0xa7, 0xff, 0x31, 0xa7, 0xff, 0x31, 0xa7, 0xff, 0x31, 0xa7, 0xff, 0x31, 0x86, 0xff, 0x29, 0x45, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0xe7, 0x3c, 0xff, 0xb5, 0x76, 0xff, 0x9c, 0xd3, 0xff, 0x9c, 0xb3, 0xff, 0x9c, 0xb3, 0xff, 0x9c, 0xb3, 0xff, 0x9c, 0xb3, 0xff, 0x9c, 0xb3, 0xff, 0x9c, 0xb3, 0xff, 0x9c, 0xb3, 0xff, 0x9c, 0xb3, 0xff, 0x94, 0xb3, 0xff, 0x8c, 0x72, 0xff, 0x6b, 0x4d, 0xff, 0x31, 0xa7, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0xff, 0x9e, 0xff, 0xf7, 0x1c, 0xff, 0xf6, 0xfb, 0xff, 0xf6, 0xdb, 0xff, 0xf6, 0xdb, 0xff, 0xf6, 0xdb, 0xff, 0xf6, 0xdb, 0xff, 0xf6, 0xdb, 0xff, 0xf6, 0xdb, 0xff, 0xf6, 0xdb, 0xff, 0xf6, 0xdb, 0xff, 0xf7, 0x1c, 0xff, 0xef, 0x5d, 0xff, 0xd6, 0x7a, 0xff, 0x6b, 0x6e, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0xfd, 0xd7, 0xff, 0xf4, 0x51, 0xff, 0xec, 0x10, 0xff, 0xec, 0x10, 0xff, 0xec, 0x10, 0xff, 0xec, 0x10, 0xff, 0xec, 0x10, 0xff, 0xec, 0x10, 0xff, 0xec, 0x10, 0xff, 0xec, 0x10, 0xff, 0xec, 0x10, 0xff, 0xf4, 0xb2, 0xff, 0xfe, 0xbb, 0xff, 0xf7, 0x5d, 0xff, 0x8c, 0x72, 0xff, 0x21, 0x25, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0xea, 0xec, 0xff, 0xe1, 0x04, 0xff, 0xd8, 0xc3, 0xff, 0xd8, 0xc3, 0xff, 0xd8, 0xc3, 0xff, 0xd8, 0xc3, 0xff, 0xd8, 0xc3, 0xff, 0xd8, 0xc3, 0xff, 0xd8, 0xc3, 0xff, 0xd8, 0xc3, 0xff, 0xd8, 0xc3, 0xff, 0xe1, 0x45, 0xff, 0xf5, 0x34, 0xff, 0xf7, 0x5d, 0xff, 0x94, 0xb3, 0xff, 0x29, 0x25, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0xe1, 0xc7, 0xff, 0xd8, 0x20, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x61, 0xff, 0xf4, 0x71, 0xff, 0xf7, 0x3c, 0xff, 0x94, 0xb3, 0xff, 0x29, 0x25, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0xe1, 0xa7, 0xff, 0xd8, 0x20, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x61, 0xff, 0xf4, 0x71, 0xff, 0xf7, 0x3c, 0xff, 0x94, 0xb3, 0xff, 0x29, 0x25, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0xe1, 0xa7, 0xff, 0xd8, 0x20, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x61, 0xff, 0xf4, 0x71, 0xff, 0xf7, 0x3c, 0xff, 0x94, 0xb3, 0xff, 0x29, 0x25, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0xe1, 0xa7, 0xff, 0xd8, 0x20, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x61, 0xff, 0xf4, 0x71, 0xff, 0xf7, 0x3c, 0xff, 0x94, 0xb3, 0xff, 0x29, 0x25, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0xe1, 0xa7, 0xff, 0xd8, 0x20, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x61, 0xff, 0xf4, 0x71, 0xff, 0xf7, 0x3c, 0xff, 0x94, 0xb3, 0xff, 0x29, 0x25, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0xe1, 0xa7, 0xff, 0xd8, 0x20, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x61, 0xff, 0xf4, 0x71, 0xff, 0xf7, 0x3c, 0xff, 0x94, 0xb3, 0xff, 0x29, 0x25, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0xe1, 0xa7, 0xff, 0xd8, 0x20, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x61, 0xff, 0xf4, 0x71, 0xff, 0xf7, 0x3c, 0xff, 0x94, 0xb3, 0xff, 0x29, 0x25, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0xe1, 0xa7, 0xff, 0xd8, 0x20, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x61, 0xff, 0xf4, 0x71, 0xff, 0xf7, 0x3c, 0xff, 0x94, 0xb3, 0xff, 0x29, 0x25, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0xe1, 0xc7, 0xff, 0xd8, 0x20, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x61, 0xff, 0xf4, 0x71, 0xff, 0xf7, 0x3c, 0xff, 0x9c, 0xd3, 0xff, 0x29, 0x45, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0xe2, 0x69, 0xff, 0xd8, 0x82, 0xff, 0xd8, 0x61, 0xff, 0xd8, 0x61, 0xff, 0xd8, 0x61, 0xff, 0xd8, 0x61, 0xff, 0xd8, 0x61, 0xff, 0xd8, 0x61, 0xff, 0xd8, 0x61, 0xff, 0xd8, 0x61, 0xff, 0xd8, 0x61, 0xff, 0xd8, 0xc3, 0xff, 0xf4, 0xd3, 0xff, 0xf7, 0x5d, 0xff, 0xad, 0x55, 0xff, 0x41, 0xe8, 0xff, 0x29, 0x66, 0xff, 0x29, 0x45, 0xff, 0x29, 0x45, 0xff, 0x29, 0x45, 0xff, 0x29, 0x45, 0xff, 0x29, 0x45, 0xff, 0x29, 0x45, 0xff, 0x29, 0x45, 0xff, 0x29, 0x45, 0xff, 0x29, 0x45, 0xff, 0x29, 0x45, 0xff, 0x21, 0x25, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0xf4, 0xf4, 0xff, 0xeb, 0x0c, 0xff, 0xea, 0xcb, 0xff, 0xea, 0xcb, 0xff, 0xea, 0xcb, 0xff, 0xea, 0xcb, 0xff, 0xea, 0xcb, 0xff, 0xea, 0xcb, 0xff, 0xea, 0xcb, 0xff, 0xea, 0xcb, 0xff, 0xea, 0xcb, 0xff, 0xeb, 0x6d, 0xff, 0xfe, 0x59, 0xff, 0xff, 0xbf, 0xff, 0xd6, 0xbb, 0xff, 0x94, 0x92, 0xff, 0x73, 0x8e, 0xff, 0x6b, 0x6e, 0xff, 0x6b, 0x6d, 0xff, 0x6b, 0x6d, 0xff, 0x6b, 0x6d, 0xff, 0x6b, 0x6d, 0xff, 0x6b, 0x6d, 0xff, 0x6b, 0x6d, 0xff, 0x6b, 0x6d, 0xff, 0x6b, 0x6d, 0xff, 0x6b, 0x4d, 0xff, 0x52, 0x8a, 0xff, 0x31, 0x86, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0xff, 0x7e, 0xff, 0xfe, 0xdb, 0xff, 0xfe, 0x9a, 0xff, 0xfe, 0x9a, 0xff, 0xfe, 0x9a, 0xff, 0xfe, 0x9a, 0xff, 0xfe, 0x9a, 0xff, 0xfe, 0x9a, 0xff, 0xfe, 0x9a, 0xff, 0xfe, 0x9a, 0xff, 0xfe, 0x9a, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xef, 0x5d, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xdb, 0xff, 0xde, 0xbb, 0xff, 0xc6, 0x18, 0xff, 0x73, 0x6e, 0xff, 0x29, 0x45, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0xff, 0x1c, 0xff, 0xf5, 0xb6, 0xff, 0xf5, 0x55, 0xff, 0xf5, 0x55, 0xff, 0xf5, 0x55, 0xff, 0xf5, 0x55, 0xff, 0xf5, 0x55, 0xff, 0xf5, 0x55, 0xff, 0xf5, 0x55, 0xff, 0xf5, 0x55, 0xff, 0xf5, 0x55, 0xff, 0xf5, 0xf7, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0xfd, 0xf8, 0xff, 0xf5, 0x55, 0xff, 0xf5, 0x55, 0xff, 0xf5, 0x55, 0xff, 0xf5, 0x55, 0xff, 0xf5, 0x55, 0xff, 0xf5, 0x55, 0xff, 0xf5, 0x55, 0xff, 0xf5, 0x55, 0xff, 0xf5, 0x55, 0xff, 0xf5, 0xd7, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xbf, 0xff, 0x9c, 0xf3, 0xff, 0x31, 0xa7, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0xeb, 0xef, 0xff, 0xe1, 0xe7, 0xff, 0xe1, 0x86, 0xff, 0xe1, 0x86, 0xff, 0xe1, 0x86, 0xff, 0xe1, 0x86, 0xff, 0xe1, 0x86, 0xff, 0xe1, 0x86, 0xff, 0xe1, 0x86, 0xff, 0xe1, 0x86, 0xff, 0xe1, 0x86, 0xff, 0xe2, 0x49, 0xff, 0xf5, 0xb6, 0xff, 0xff, 0x9e, 0xff, 0xf5, 0x76, 0xff, 0xe2, 0x29, 0xff, 0xe1, 0xa6, 0xff, 0xe1, 0x86, 0xff, 0xe1, 0x86, 0xff, 0xe1, 0x86, 0xff, 0xe1, 0x86, 0xff, 0xe1, 0x86, 0xff, 0xe1, 0x86, 0xff, 0xe1, 0x86, 0xff, 0xe1, 0xa6, 0xff, 0xe1, 0xe8, 0xff, 0xf4, 0xb3, 0xff, 0xff, 0x7e, 0xff, 0xad, 0x35, 0xff, 0x39, 0xc7, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0xe1, 0xe7, 0xff, 0xd8, 0x21, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x82, 0xff, 0xf4, 0x92, 0xff, 0xff, 0x3d, 0xff, 0xf4, 0x51, 0xff, 0xd8, 0x62, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x41, 0xff, 0xeb, 0x6d, 0xff, 0xff, 0x1c, 0xff, 0xad, 0x35, 0xff, 0x39, 0xc7, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0xe1, 0xa7, 0xff, 0xd8, 0x20, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x61, 0xff, 0xf4, 0x71, 0xff, 0xff, 0x1c, 0xff, 0xec, 0x31, 0xff, 0xd8, 0x41, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x21, 0xff, 0xeb, 0x4d, 0xff, 0xfe, 0xfc, 0xff, 0xad, 0x35, 0xff, 0x39, 0xc7, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0xe1, 0xa7, 0xff, 0xd8, 0x20, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x61, 0xff, 0xf4, 0x71, 0xff, 0xff, 0x1c, 0xff, 0xec, 0x31, 0xff, 0xd8, 0x41, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x21, 0xff, 0xeb, 0x4d, 0xff, 0xfe, 0xfc, 0xff, 0xad, 0x35, 0xff, 0x39, 0xc7, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0xe1, 0xa7, 0xff, 0xd8, 0x20, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x61, 0xff, 0xf4, 0x71, 0xff, 0xff, 0x1c, 0xff, 0xec, 0x31, 0xff, 0xd8, 0x41, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x21, 0xff, 0xeb, 0x4d, 0xff, 0xfe, 0xfc, 0xff, 0xad, 0x35, 0xff, 0x39, 0xc7, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0xe1, 0xa7, 0xff, 0xd8, 0x20, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x61, 0xff, 0xf4, 0x71, 0xff, 0xff, 0x1c, 0xff, 0xec, 0x31, 0xff, 0xd8, 0x41, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x21, 0xff, 0xeb, 0x4d, 0xff, 0xfe, 0xfc, 0xff, 0xad, 0x35, 0xff, 0x39, 0xc7, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0xe1, 0xa7, 0xff, 0xd8, 0x20, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x61, 0xff, 0xf4, 0x71, 0xff, 0xff, 0x1c, 0xff, 0xec, 0x31, 0xff, 0xd8, 0x41, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x21, 0xff, 0xeb, 0x4d, 0xff, 0xfe, 0xfc, 0xff, 0xad, 0x35, 0xff, 0x39, 0xc7, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0xe1, 0xa7, 0xff, 0xd8, 0x20, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x61, 0xff, 0xf4, 0x71, 0xff, 0xff, 0x1c, 0xff, 0xec, 0x31, 0xff, 0xd8, 0x41, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x21, 0xff, 0xeb, 0x4d, 0xff, 0xfe, 0xfc, 0xff, 0xad, 0x35, 0xff, 0x39, 0xc7, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xcb, 0xff, 0xe6, 0xfc, 0xff,
-  0xe1, 0xa7, 0xff, 0xd8, 0x20, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x61, 0xff, 0xf4, 0x71, 0xff, 0xff, 0x1c, 0xff, 0xec, 0x31, 0xff, 0xd8, 0x41, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x21, 0xff, 0xeb, 0x4d, 0xff, 0xfe, 0xfc, 0xff, 0xad, 0x35, 0xff, 0x39, 0xc7, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x5a, 0xeb, 0xff, 0xe7, 0x1c, 0xff,
-  0xe1, 0xa7, 0xff, 0xd8, 0x20, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x61, 0xff, 0xf4, 0x71, 0xff, 0xff, 0x1c, 0xff, 0xec, 0x31, 0xff, 0xd8, 0x41, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x21, 0xff, 0xeb, 0x4d, 0xff, 0xfe, 0xfc, 0xff, 0xad, 0x35, 0xff, 0x39, 0xc7, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x29, 0x45, 0xff, 0x7b, 0xaf, 0xff, 0xf7, 0x9e, 0xff,
-  0xe1, 0xc7, 0xff, 0xd8, 0x20, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x61, 0xff, 0xf4, 0x72, 0xff, 0xff, 0x3c, 0xff, 0xf4, 0x51, 0xff, 0xd8, 0x41, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x00, 0xff, 0xd8, 0x21, 0xff, 0xeb, 0x4d, 0xff, 0xff, 0x1c, 0xff, 0xb5, 0x75, 0xff, 0x42, 0x08, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x04, 0xff, 0x21, 0x25, 0xff, 0x52, 0xab, 0xff, 0xbd, 0xb7, 0xff, 0xff, 0xdf, 0xff,
-  0xeb, 0xcf, 0xff, 0xe1, 0x86, 0xff, 0xe1, 0x45, 0xff, 0xe1, 0x45, 0xff, 0xe1, 0x45, 0xff, 0xe1, 0x45, 0xff, 0xe1, 0x45, 0xff, 0xe1, 0x45, 0xff, 0xe1, 0x45, 0xff, 0xe1, 0x45, 0xff, 0xe1, 0x45, 0xff, 0xe1, 0xe7, 0xff, 0xf5, 0x96, 0xff, 0xff, 0x7e, 0xff, 0xf5, 0x55, 0xff, 0xe1, 0xe8, 0xff, 0xe1, 0x45, 0xff, 0xe1, 0x45, 0xff, 0xe1, 0x45, 0xff, 0xe1, 0x45, 0xff, 0xe1, 0x45, 0xff, 0xe1, 0x45, 0xff, 0xe1, 0x45, 0xff, 0xe1, 0x45, 0xff, 0xe1, 0x45, 0xff, 0xe1, 0xa6, 0xff, 0xf4, 0x92, 0xff, 0xff, 0x7e, 0xff, 0xd6, 0x9a, 0xff, 0x7b, 0xaf, 0xff, 0x4a, 0x49, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x42, 0x08, 0xff, 0x4a, 0x49, 0xff, 0x6b, 0x4d, 0xff, 0xb5, 0x96, 0xff, 0xef, 0x5d, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0xdb, 0xff, 0xfd, 0xd7, 0xff, 0xf5, 0x76, 0xff, 0xf5, 0x76, 0xff, 0xf5, 0x76, 0xff, 0xf5, 0x76, 0xff, 0xf5, 0x76, 0xff, 0xf5, 0x76, 0xff, 0xf5, 0x76, 0xff, 0xf5, 0x76, 0xff, 0xf5, 0x76, 0xff, 0xfd, 0xf8, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x3c, 0xff, 0xfe, 0x18, 0xff, 0xf5, 0x96, 0xff, 0xf5, 0x76, 0xff, 0xf5, 0x76, 0xff, 0xf5, 0x76, 0xff, 0xf5, 0x76, 0xff, 0xf5, 0x76, 0xff, 0xf5, 0x76, 0xff, 0xf5, 0x76, 0xff, 0xf5, 0x96, 0xff, 0xf5, 0xd7, 0xff, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0xff, 0xde, 0xdb, 0xff, 0xc5, 0xf8, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xbd, 0xd7, 0xff, 0xc6, 0x18, 0xff, 0xde, 0xdb, 0xff, 0xf7, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-#endif
-#if LV_COLOR_DEPTH == 32
-  /*Pixel format:  Blue: 8 bit, Green: 8 bit, Red: 8 bit, Alpha: 8 bit*/
-  0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xfa, 0xff, 0xeb, 0xeb, 0xeb, 0xff, 0xda, 0xda, 0xda, 0xff, 0xd2, 0xd1, 0xd1, 0xff, 0xd1, 0xd0, 0xd0, 0xff, 0xd1, 0xd0, 0xd0, 0xff, 0xd1, 0xd0, 0xd0, 0xff, 0xd1, 0xd0, 0xd0, 0xff, 0xd1, 0xd0, 0xd0, 0xff, 0xd1, 0xd0, 0xd0, 0xff, 0xd1, 0xd0, 0xd0, 0xff, 0xd1, 0xd0, 0xd0, 0xff, 0xd1, 0xd0, 0xd0, 0xff, 0xd1, 0xd0, 0xd0, 0xff, 0xd1, 0xd0, 0xd0, 0xff, 0xd1, 0xd0, 0xd0, 0xff, 0xd1, 0xd0, 0xd0, 0xff, 0xd1, 0xd0, 0xd0, 0xff, 0xd1, 0xd0, 0xd0, 0xff, 0xd1, 0xd0, 0xd0, 0xff, 0xd1, 0xd0, 0xd0, 0xff, 0xd1, 0xd0, 0xd0, 0xff, 0xd1, 0xd0, 0xd0, 0xff, 0xd1, 0xd0, 0xd0, 0xff, 0xd1, 0xd0, 0xd0, 0xff, 0xd1, 0xd0, 0xd0, 0xff, 0xd1, 0xd0, 0xd0, 0xff, 0xd1, 0xd0, 0xd0, 0xff, 0xd1, 0xd0, 0xd0, 0xff, 0xd1, 0xd0, 0xd0, 0xff, 0xd1, 0xd0, 0xd0, 0xff, 0xd1, 0xd0, 0xd0, 0xff, 0xd1, 0xd0, 0xd0, 0xff, 0xd1, 0xd0, 0xd0, 0xff, 0xd1, 0xd0, 0xd0, 0xff, 0xd2, 0xd1, 0xd1, 0xff, 0xd8, 0xd8, 0xd8, 0xff, 0xe8, 0xe8, 0xe8, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf9, 0xf9, 0xf9, 0xff, 0xd8, 0xd8, 0xd7, 0xff, 0xa3, 0xa2, 0xa2, 0xff, 0x6e, 0x6d, 0x6d, 0xff, 0x59, 0x57, 0x57, 0xff, 0x56, 0x55, 0x55, 0xff, 0x56, 0x55, 0x55, 0xff, 0x56, 0x55, 0x55, 0xff, 0x56, 0x55, 0x55, 0xff, 0x56, 0x55, 0x55, 0xff, 0x56, 0x55, 0x55, 0xff, 0x56, 0x55, 0x55, 0xff, 0x56, 0x55, 0x55, 0xff, 0x56, 0x55, 0x55, 0xff, 0x56, 0x55, 0x55, 0xff, 0x56, 0x55, 0x55, 0xff, 0x56, 0x55, 0x55, 0xff, 0x56, 0x55, 0x55, 0xff, 0x56, 0x55, 0x55, 0xff, 0x56, 0x55, 0x55, 0xff, 0x56, 0x55, 0x55, 0xff, 0x56, 0x55, 0x55, 0xff, 0x56, 0x55, 0x55, 0xff, 0x56, 0x55, 0x55, 0xff, 0x56, 0x55, 0x55, 0xff, 0x56, 0x55, 0x55, 0xff, 0x56, 0x55, 0x55, 0xff, 0x56, 0x55, 0x55, 0xff, 0x56, 0x55, 0x55, 0xff, 0x56, 0x55, 0x55, 0xff, 0x56, 0x55, 0x55, 0xff, 0x56, 0x55, 0x55, 0xff, 0x56, 0x55, 0x55, 0xff, 0x56, 0x55, 0x55, 0xff, 0x56, 0x55, 0x55, 0xff, 0x56, 0x55, 0x55, 0xff, 0x58, 0x57, 0x56, 0xff, 0x68, 0x67, 0x67, 0xff, 0x99, 0x98, 0x98, 0xff, 0xcf, 0xce, 0xce, 0xff, 0xf4, 0xf4, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0xe0, 0xdf, 0xff, 0x7c, 0x7b, 0x7a, 0xff, 0x32, 0x30, 0x2f, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x2a, 0x28, 0x27, 0xff, 0x6c, 0x6a, 0x6a, 0xff, 0xcb, 0xcb, 0xca, 0xff, 0xfd, 0xfd, 0xfd, 0xff,
-  0x9f, 0x9e, 0x9e, 0xff, 0x3c, 0x3a, 0x39, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x23, 0x21, 0x20, 0xff, 0x23, 0x21, 0x20, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x30, 0x2e, 0x2d, 0xff, 0x89, 0x88, 0x87, 0xff, 0xf4, 0xf4, 0xf4, 0xff,
-  0x67, 0x66, 0x65, 0xff, 0x29, 0x27, 0x26, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x30, 0x2f, 0x2e, 0xff, 0x42, 0x41, 0x40, 0xff, 0x41, 0x3f, 0x3e, 0xff, 0x2e, 0x2c, 0x2b, 0xff, 0x23, 0x21, 0x20, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x23, 0x21, 0x20, 0xff, 0x63, 0x61, 0x61, 0xff, 0xe7, 0xe7, 0xe7, 0xff,
-  0x53, 0x51, 0x51, 0xff, 0x24, 0x22, 0x21, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x2a, 0x28, 0x27, 0xff, 0x6c, 0x6c, 0x6b, 0xff, 0xa2, 0xa2, 0xa2, 0xff, 0x9e, 0x9d, 0x9d, 0xff, 0x60, 0x5e, 0x5d, 0xff, 0x2c, 0x2a, 0x29, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x59, 0x58, 0x57, 0xff, 0xdf, 0xdf, 0xdf, 0xff,
-  0x51, 0x4f, 0x4e, 0xff, 0x24, 0x22, 0x21, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x23, 0x21, 0x20, 0xff, 0x3a, 0x38, 0x38, 0xff, 0xc0, 0xc0, 0xbf, 0xff, 0xf0, 0xf0, 0xf0, 0xff, 0xe9, 0xe9, 0xe9, 0xff, 0xa0, 0x9f, 0x9e, 0xff, 0x40, 0x3f, 0x3e, 0xff, 0x23, 0x21, 0x20, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xde, 0xde, 0xdd, 0xff,
-  0x51, 0x4f, 0x4e, 0xff, 0x24, 0x22, 0x21, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x40, 0x3e, 0x3d, 0xff, 0xdc, 0xdc, 0xdb, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xf6, 0xf6, 0xf6, 0xff, 0xb1, 0xb0, 0xb0, 0xff, 0x49, 0x47, 0x46, 0xff, 0x23, 0x21, 0x20, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xde, 0xde, 0xdd, 0xff,
-  0x51, 0x4f, 0x4e, 0xff, 0x24, 0x22, 0x21, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x2f, 0x2d, 0x2c, 0xff, 0x92, 0x91, 0x90, 0xff, 0xcf, 0xcf, 0xce, 0xff, 0xca, 0xca, 0xc9, 0xff, 0x7d, 0x7d, 0x7c, 0xff, 0x32, 0x30, 0x2f, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xde, 0xde, 0xdd, 0xff,
-  0x51, 0x4f, 0x4e, 0xff, 0x24, 0x22, 0x21, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x23, 0x21, 0x20, 0xff, 0x3d, 0x3b, 0x3a, 0xff, 0x56, 0x55, 0x54, 0xff, 0x54, 0x53, 0x52, 0xff, 0x37, 0x36, 0x35, 0xff, 0x23, 0x21, 0x20, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xde, 0xde, 0xdd, 0xff,
-  0x51, 0x4f, 0x4e, 0xff, 0x23, 0x22, 0x21, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x23, 0x21, 0x20, 0xff, 0x23, 0x21, 0x20, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xde, 0xde, 0xdd, 0xff,
-  0x58, 0x56, 0x55, 0xff, 0x26, 0x24, 0x23, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xde, 0xde, 0xdd, 0xff,
-  0x86, 0x85, 0x84, 0xff, 0x46, 0x44, 0x43, 0xff, 0x37, 0x36, 0x35, 0xff, 0x36, 0x34, 0x33, 0xff, 0x36, 0x34, 0x33, 0xff, 0x36, 0x34, 0x33, 0xff, 0x36, 0x34, 0x33, 0xff, 0x36, 0x34, 0x33, 0xff, 0x36, 0x34, 0x33, 0xff, 0x36, 0x34, 0x33, 0xff, 0x36, 0x34, 0x33, 0xff, 0x36, 0x34, 0x33, 0xff, 0x33, 0x32, 0x31, 0xff, 0x2b, 0x29, 0x28, 0xff, 0x23, 0x21, 0x20, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xde, 0xde, 0xdd, 0xff,
-  0xe4, 0xe3, 0xe3, 0xff, 0xaf, 0xae, 0xae, 0xff, 0x99, 0x98, 0x97, 0xff, 0x96, 0x95, 0x95, 0xff, 0x96, 0x95, 0x95, 0xff, 0x96, 0x95, 0x95, 0xff, 0x97, 0x95, 0x95, 0xff, 0x97, 0x95, 0x95, 0xff, 0x96, 0x95, 0x95, 0xff, 0x96, 0x95, 0x95, 0xff, 0x96, 0x95, 0x95, 0xff, 0x96, 0x95, 0x94, 0xff, 0x8d, 0x8c, 0x8b, 0xff, 0x69, 0x68, 0x67, 0xff, 0x37, 0x35, 0x34, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xde, 0xde, 0xdd, 0xff,
-  0xf1, 0xf1, 0xfa, 0xff, 0xe1, 0xe1, 0xf1, 0xff, 0xdb, 0xdb, 0xef, 0xff, 0xda, 0xda, 0xed, 0xff, 0xda, 0xda, 0xed, 0xff, 0xda, 0xda, 0xed, 0xff, 0xda, 0xda, 0xee, 0xff, 0xda, 0xda, 0xee, 0xff, 0xda, 0xda, 0xed, 0xff, 0xda, 0xda, 0xed, 0xff, 0xda, 0xda, 0xed, 0xff, 0xdf, 0xdf, 0xee, 0xff, 0xe7, 0xe7, 0xec, 0xff, 0xcd, 0xcc, 0xcd, 0xff, 0x6d, 0x6c, 0x6b, 0xff, 0x23, 0x21, 0x20, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xde, 0xde, 0xdd, 0xff,
-  0xba, 0xba, 0xf5, 0xff, 0x8a, 0x8a, 0xed, 0xff, 0x80, 0x80, 0xec, 0xff, 0x80, 0x80, 0xec, 0xff, 0x80, 0x80, 0xec, 0xff, 0x80, 0x80, 0xec, 0xff, 0x80, 0x80, 0xec, 0xff, 0x80, 0x80, 0xec, 0xff, 0x80, 0x80, 0xec, 0xff, 0x80, 0x80, 0xec, 0xff, 0x80, 0x80, 0xec, 0xff, 0x93, 0x93, 0xef, 0xff, 0xd6, 0xd6, 0xf8, 0xff, 0xea, 0xea, 0xed, 0xff, 0x8e, 0x8d, 0x8c, 0xff, 0x26, 0x24, 0x23, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xde, 0xde, 0xdd, 0xff,
-  0x5e, 0x5e, 0xe7, 0xff, 0x20, 0x20, 0xdd, 0xff, 0x18, 0x18, 0xdc, 0xff, 0x18, 0x18, 0xdc, 0xff, 0x18, 0x18, 0xdc, 0xff, 0x18, 0x18, 0xdc, 0xff, 0x18, 0x18, 0xdc, 0xff, 0x18, 0x18, 0xdc, 0xff, 0x18, 0x18, 0xdc, 0xff, 0x18, 0x18, 0xdc, 0xff, 0x18, 0x18, 0xdc, 0xff, 0x2a, 0x2a, 0xdf, 0xff, 0xa3, 0xa3, 0xf1, 0xff, 0xe8, 0xe8, 0xf0, 0xff, 0x95, 0x94, 0x93, 0xff, 0x28, 0x26, 0x25, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xde, 0xde, 0xdd, 0xff,
-  0x37, 0x37, 0xe1, 0xff, 0x03, 0x03, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x0b, 0x0b, 0xda, 0xff, 0x8c, 0x8c, 0xed, 0xff, 0xe4, 0xe4, 0xf0, 0xff, 0x95, 0x94, 0x93, 0xff, 0x28, 0x26, 0x25, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xde, 0xde, 0xdd, 0xff,
-  0x36, 0x36, 0xe1, 0xff, 0x03, 0x03, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x0b, 0x0b, 0xda, 0xff, 0x8b, 0x8b, 0xed, 0xff, 0xe3, 0xe3, 0xf0, 0xff, 0x95, 0x94, 0x93, 0xff, 0x28, 0x26, 0x25, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xde, 0xde, 0xdd, 0xff,
-  0x36, 0x36, 0xe1, 0xff, 0x03, 0x03, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x0b, 0x0b, 0xda, 0xff, 0x8b, 0x8b, 0xed, 0xff, 0xe3, 0xe3, 0xf0, 0xff, 0x95, 0x94, 0x93, 0xff, 0x28, 0x26, 0x25, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xde, 0xde, 0xdd, 0xff,
-  0x36, 0x36, 0xe1, 0xff, 0x03, 0x03, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x0b, 0x0b, 0xda, 0xff, 0x8b, 0x8b, 0xed, 0xff, 0xe3, 0xe3, 0xf0, 0xff, 0x95, 0x94, 0x93, 0xff, 0x28, 0x26, 0x25, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xde, 0xde, 0xdd, 0xff,
-  0x36, 0x36, 0xe1, 0xff, 0x03, 0x03, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x0b, 0x0b, 0xda, 0xff, 0x8b, 0x8b, 0xed, 0xff, 0xe3, 0xe3, 0xf0, 0xff, 0x95, 0x94, 0x93, 0xff, 0x28, 0x26, 0x25, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xde, 0xde, 0xdd, 0xff,
-  0x36, 0x36, 0xe1, 0xff, 0x03, 0x03, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x0b, 0x0b, 0xda, 0xff, 0x8b, 0x8b, 0xed, 0xff, 0xe3, 0xe3, 0xf0, 0xff, 0x95, 0x94, 0x93, 0xff, 0x28, 0x26, 0x25, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xde, 0xde, 0xdd, 0xff,
-  0x36, 0x36, 0xe1, 0xff, 0x03, 0x03, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x0b, 0x0b, 0xda, 0xff, 0x8b, 0x8b, 0xed, 0xff, 0xe3, 0xe3, 0xf0, 0xff, 0x95, 0x94, 0x93, 0xff, 0x28, 0x26, 0x25, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xde, 0xde, 0xdd, 0xff,
-  0x36, 0x36, 0xe1, 0xff, 0x03, 0x03, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x0b, 0x0b, 0xda, 0xff, 0x8b, 0x8b, 0xed, 0xff, 0xe3, 0xe3, 0xf0, 0xff, 0x95, 0x94, 0x93, 0xff, 0x28, 0x26, 0x25, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xde, 0xde, 0xdd, 0xff,
-  0x37, 0x37, 0xe1, 0xff, 0x03, 0x03, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x0b, 0x0b, 0xda, 0xff, 0x8c, 0x8c, 0xed, 0xff, 0xe4, 0xe4, 0xf0, 0xff, 0x97, 0x97, 0x96, 0xff, 0x2a, 0x28, 0x27, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xde, 0xde, 0xdd, 0xff,
-  0x4b, 0x4b, 0xe3, 0xff, 0x11, 0x11, 0xda, 0xff, 0x0c, 0x0c, 0xda, 0xff, 0x0c, 0x0c, 0xda, 0xff, 0x0c, 0x0c, 0xda, 0xff, 0x0c, 0x0c, 0xda, 0xff, 0x0c, 0x0c, 0xda, 0xff, 0x0c, 0x0c, 0xda, 0xff, 0x0c, 0x0c, 0xda, 0xff, 0x0c, 0x0c, 0xda, 0xff, 0x0c, 0x0c, 0xda, 0xff, 0x1a, 0x1a, 0xdc, 0xff, 0x98, 0x98, 0xf0, 0xff, 0xea, 0xea, 0xf3, 0xff, 0xa8, 0xa7, 0xa6, 0xff, 0x3f, 0x3e, 0x3d, 0xff, 0x2d, 0x2b, 0x2a, 0xff, 0x2b, 0x29, 0x28, 0xff, 0x2b, 0x29, 0x28, 0xff, 0x2b, 0x29, 0x28, 0xff, 0x2b, 0x29, 0x28, 0xff, 0x2b, 0x29, 0x28, 0xff, 0x2b, 0x29, 0x28, 0xff, 0x2b, 0x29, 0x28, 0xff, 0x2b, 0x29, 0x28, 0xff, 0x2b, 0x29, 0x28, 0xff, 0x2a, 0x28, 0x27, 0xff, 0x27, 0x25, 0x24, 0xff, 0x23, 0x21, 0x20, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xde, 0xde, 0xdd, 0xff,
-  0x9e, 0x9e, 0xf0, 0xff, 0x62, 0x62, 0xe7, 0xff, 0x57, 0x57, 0xe5, 0xff, 0x57, 0x57, 0xe5, 0xff, 0x57, 0x57, 0xe5, 0xff, 0x57, 0x57, 0xe5, 0xff, 0x57, 0x57, 0xe5, 0xff, 0x57, 0x57, 0xe5, 0xff, 0x57, 0x57, 0xe5, 0xff, 0x57, 0x57, 0xe5, 0xff, 0x57, 0x57, 0xe5, 0xff, 0x6b, 0x6b, 0xe8, 0xff, 0xc7, 0xc7, 0xf7, 0xff, 0xf6, 0xf6, 0xfa, 0xff, 0xd5, 0xd4, 0xd4, 0xff, 0x91, 0x90, 0x8f, 0xff, 0x71, 0x70, 0x70, 0xff, 0x6d, 0x6b, 0x6a, 0xff, 0x6c, 0x6b, 0x6a, 0xff, 0x6c, 0x6b, 0x6a, 0xff, 0x6c, 0x6b, 0x6a, 0xff, 0x6c, 0x6b, 0x6a, 0xff, 0x6c, 0x6b, 0x6a, 0xff, 0x6c, 0x6b, 0x6a, 0xff, 0x6c, 0x6b, 0x6a, 0xff, 0x6c, 0x6b, 0x6a, 0xff, 0x69, 0x67, 0x66, 0xff, 0x52, 0x50, 0x50, 0xff, 0x33, 0x31, 0x30, 0xff, 0x23, 0x21, 0x20, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xde, 0xde, 0xdd, 0xff,
-  0xed, 0xed, 0xfd, 0xff, 0xd7, 0xd7, 0xf9, 0xff, 0xd2, 0xd2, 0xf9, 0xff, 0xd2, 0xd2, 0xf8, 0xff, 0xd2, 0xd2, 0xf9, 0xff, 0xd2, 0xd2, 0xf8, 0xff, 0xd2, 0xd2, 0xf9, 0xff, 0xd2, 0xd2, 0xf9, 0xff, 0xd2, 0xd2, 0xf8, 0xff, 0xd2, 0xd2, 0xf9, 0xff, 0xd2, 0xd2, 0xf9, 0xff, 0xdb, 0xdb, 0xf9, 0xff, 0xf4, 0xf4, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xf8, 0xf8, 0xf8, 0xff, 0xe8, 0xe7, 0xe7, 0xff, 0xda, 0xda, 0xd9, 0xff, 0xd8, 0xd8, 0xd7, 0xff, 0xd8, 0xd7, 0xd7, 0xff, 0xd8, 0xd7, 0xd7, 0xff, 0xd8, 0xd7, 0xd7, 0xff, 0xd8, 0xd7, 0xd7, 0xff, 0xd8, 0xd7, 0xd7, 0xff, 0xd8, 0xd7, 0xd7, 0xff, 0xd8, 0xd7, 0xd7, 0xff, 0xd8, 0xd7, 0xd7, 0xff, 0xd5, 0xd5, 0xd5, 0xff, 0xbf, 0xbf, 0xbf, 0xff, 0x6e, 0x6d, 0x6d, 0xff, 0x2b, 0x2a, 0x29, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xde, 0xde, 0xdd, 0xff,
-  0xdf, 0xdf, 0xfb, 0xff, 0xb4, 0xb4, 0xf4, 0xff, 0xa9, 0xa9, 0xf2, 0xff, 0xa9, 0xa9, 0xf2, 0xff, 0xa9, 0xa9, 0xf2, 0xff, 0xa9, 0xa9, 0xf2, 0xff, 0xa9, 0xa9, 0xf2, 0xff, 0xa9, 0xa9, 0xf2, 0xff, 0xa9, 0xa9, 0xf2, 0xff, 0xa9, 0xa9, 0xf2, 0xff, 0xa9, 0xa9, 0xf2, 0xff, 0xbb, 0xbb, 0xf4, 0xff, 0xec, 0xec, 0xfc, 0xff, 0xfc, 0xfc, 0xfe, 0xff, 0xe7, 0xe7, 0xfb, 0xff, 0xbe, 0xbe, 0xf5, 0xff, 0xaa, 0xaa, 0xf1, 0xff, 0xa9, 0xa9, 0xf1, 0xff, 0xa9, 0xa9, 0xf1, 0xff, 0xa9, 0xa9, 0xf1, 0xff, 0xa9, 0xa9, 0xf1, 0xff, 0xa9, 0xa9, 0xf1, 0xff, 0xa9, 0xa9, 0xf1, 0xff, 0xa9, 0xa9, 0xf1, 0xff, 0xaa, 0xaa, 0xf1, 0xff, 0xb7, 0xb7, 0xf4, 0xff, 0xe0, 0xe0, 0xf9, 0xff, 0xf5, 0xf5, 0xf6, 0xff, 0x9c, 0x9b, 0x9b, 0xff, 0x36, 0x34, 0x33, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xde, 0xde, 0xdd, 0xff,
-  0x7b, 0x7b, 0xeb, 0xff, 0x3c, 0x3c, 0xe1, 0xff, 0x32, 0x32, 0xe0, 0xff, 0x32, 0x32, 0xe0, 0xff, 0x32, 0x32, 0xe0, 0xff, 0x32, 0x32, 0xe0, 0xff, 0x32, 0x32, 0xe0, 0xff, 0x32, 0x32, 0xe0, 0xff, 0x32, 0x32, 0xe0, 0xff, 0x32, 0x32, 0xe0, 0xff, 0x32, 0x32, 0xe0, 0xff, 0x47, 0x47, 0xe4, 0xff, 0xb4, 0xb4, 0xf3, 0xff, 0xf0, 0xf0, 0xfd, 0xff, 0xad, 0xad, 0xf2, 0xff, 0x46, 0x46, 0xe3, 0xff, 0x33, 0x33, 0xe0, 0xff, 0x32, 0x32, 0xe0, 0xff, 0x32, 0x32, 0xe0, 0xff, 0x32, 0x32, 0xe0, 0xff, 0x32, 0x32, 0xe0, 0xff, 0x32, 0x32, 0xe0, 0xff, 0x32, 0x32, 0xe0, 0xff, 0x32, 0x32, 0xe0, 0xff, 0x33, 0x33, 0xe0, 0xff, 0x3e, 0x3e, 0xe1, 0xff, 0x96, 0x96, 0xef, 0xff, 0xed, 0xed, 0xfb, 0xff, 0xa6, 0xa6, 0xa6, 0xff, 0x3a, 0x39, 0x38, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xde, 0xde, 0xdd, 0xff,
-  0x3b, 0x3b, 0xe1, 0xff, 0x06, 0x06, 0xd8, 0xff, 0x02, 0x02, 0xd8, 0xff, 0x02, 0x02, 0xd8, 0xff, 0x02, 0x02, 0xd8, 0xff, 0x02, 0x02, 0xd8, 0xff, 0x02, 0x02, 0xd8, 0xff, 0x02, 0x02, 0xd8, 0xff, 0x02, 0x02, 0xd8, 0xff, 0x02, 0x02, 0xd8, 0xff, 0x02, 0x02, 0xd8, 0xff, 0x0f, 0x0f, 0xda, 0xff, 0x8f, 0x8f, 0xee, 0xff, 0xe5, 0xe5, 0xfc, 0xff, 0x89, 0x89, 0xed, 0xff, 0x0d, 0x0d, 0xda, 0xff, 0x02, 0x02, 0xd8, 0xff, 0x02, 0x02, 0xd8, 0xff, 0x02, 0x02, 0xd8, 0xff, 0x02, 0x02, 0xd8, 0xff, 0x02, 0x02, 0xd8, 0xff, 0x02, 0x02, 0xd8, 0xff, 0x02, 0x02, 0xd8, 0xff, 0x02, 0x02, 0xd8, 0xff, 0x02, 0x02, 0xd8, 0xff, 0x09, 0x09, 0xd9, 0xff, 0x6b, 0x6b, 0xe9, 0xff, 0xe0, 0xe0, 0xf9, 0xff, 0xa6, 0xa5, 0xa7, 0xff, 0x3a, 0x39, 0x38, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xde, 0xde, 0xdd, 0xff,
-  0x36, 0x36, 0xe1, 0xff, 0x03, 0x03, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x0b, 0x0b, 0xda, 0xff, 0x8b, 0x8b, 0xed, 0xff, 0xe1, 0xe1, 0xfb, 0xff, 0x85, 0x85, 0xec, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x06, 0x06, 0xd9, 0xff, 0x67, 0x67, 0xe8, 0xff, 0xdd, 0xdd, 0xf9, 0xff, 0xa6, 0xa5, 0xa7, 0xff, 0x3a, 0x39, 0x38, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xde, 0xde, 0xdd, 0xff,
-  0x36, 0x36, 0xe1, 0xff, 0x03, 0x03, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x0b, 0x0b, 0xda, 0xff, 0x8b, 0x8b, 0xed, 0xff, 0xe1, 0xe1, 0xfb, 0xff, 0x85, 0x85, 0xec, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x06, 0x06, 0xd9, 0xff, 0x67, 0x67, 0xe8, 0xff, 0xdd, 0xdd, 0xf9, 0xff, 0xa6, 0xa5, 0xa7, 0xff, 0x3a, 0x39, 0x38, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xde, 0xde, 0xdd, 0xff,
-  0x36, 0x36, 0xe1, 0xff, 0x03, 0x03, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x0b, 0x0b, 0xda, 0xff, 0x8b, 0x8b, 0xed, 0xff, 0xe1, 0xe1, 0xfb, 0xff, 0x85, 0x85, 0xec, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x06, 0x06, 0xd9, 0xff, 0x67, 0x67, 0xe8, 0xff, 0xdd, 0xdd, 0xf9, 0xff, 0xa6, 0xa5, 0xa7, 0xff, 0x3a, 0x39, 0x38, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xde, 0xde, 0xdd, 0xff,
-  0x36, 0x36, 0xe1, 0xff, 0x03, 0x03, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x0b, 0x0b, 0xda, 0xff, 0x8b, 0x8b, 0xed, 0xff, 0xe1, 0xe1, 0xfb, 0xff, 0x85, 0x85, 0xec, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x06, 0x06, 0xd9, 0xff, 0x67, 0x67, 0xe8, 0xff, 0xdd, 0xdd, 0xf9, 0xff, 0xa6, 0xa5, 0xa7, 0xff, 0x3a, 0x39, 0x38, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xde, 0xde, 0xdd, 0xff,
-  0x36, 0x36, 0xe1, 0xff, 0x03, 0x03, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x0b, 0x0b, 0xda, 0xff, 0x8b, 0x8b, 0xed, 0xff, 0xe1, 0xe1, 0xfb, 0xff, 0x85, 0x85, 0xec, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x06, 0x06, 0xd9, 0xff, 0x67, 0x67, 0xe8, 0xff, 0xdd, 0xdd, 0xf9, 0xff, 0xa6, 0xa5, 0xa7, 0xff, 0x3a, 0x39, 0x38, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xde, 0xde, 0xdd, 0xff,
-  0x36, 0x36, 0xe1, 0xff, 0x03, 0x03, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x0b, 0x0b, 0xda, 0xff, 0x8b, 0x8b, 0xed, 0xff, 0xe1, 0xe1, 0xfb, 0xff, 0x85, 0x85, 0xec, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x06, 0x06, 0xd9, 0xff, 0x67, 0x67, 0xe8, 0xff, 0xdd, 0xdd, 0xf9, 0xff, 0xa6, 0xa5, 0xa7, 0xff, 0x3a, 0x39, 0x38, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x58, 0x57, 0x56, 0xff, 0xdf, 0xde, 0xde, 0xff,
-  0x36, 0x36, 0xe1, 0xff, 0x03, 0x03, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x0b, 0x0b, 0xda, 0xff, 0x8b, 0x8b, 0xed, 0xff, 0xe1, 0xe1, 0xfb, 0xff, 0x85, 0x85, 0xec, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x06, 0x06, 0xd9, 0xff, 0x67, 0x67, 0xe8, 0xff, 0xdd, 0xdd, 0xf9, 0xff, 0xa6, 0xa5, 0xa7, 0xff, 0x3a, 0x39, 0x38, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x20, 0x1f, 0xff, 0x5c, 0x5b, 0x5a, 0xff, 0xe3, 0xe2, 0xe2, 0xff,
-  0x36, 0x36, 0xe1, 0xff, 0x03, 0x03, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x0b, 0x0b, 0xda, 0xff, 0x8b, 0x8b, 0xed, 0xff, 0xe1, 0xe1, 0xfb, 0xff, 0x85, 0x85, 0xec, 0xff, 0x08, 0x08, 0xd9, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x06, 0x06, 0xd9, 0xff, 0x67, 0x67, 0xe8, 0xff, 0xdd, 0xdd, 0xf9, 0xff, 0xa6, 0xa5, 0xa7, 0xff, 0x3a, 0x39, 0x38, 0xff, 0x22, 0x20, 0x1f, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x28, 0x27, 0x26, 0xff, 0x77, 0x75, 0x75, 0xff, 0xf0, 0xf0, 0xf0, 0xff,
-  0x38, 0x38, 0xe1, 0xff, 0x03, 0x03, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x0c, 0x0c, 0xda, 0xff, 0x8d, 0x8d, 0xee, 0xff, 0xe3, 0xe3, 0xfc, 0xff, 0x87, 0x87, 0xed, 0xff, 0x0a, 0x0a, 0xda, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x00, 0x00, 0xd8, 0xff, 0x06, 0x06, 0xd9, 0xff, 0x69, 0x69, 0xe8, 0xff, 0xdf, 0xdf, 0xfa, 0xff, 0xac, 0xab, 0xae, 0xff, 0x41, 0x3f, 0x3e, 0xff, 0x23, 0x21, 0x20, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x21, 0x1f, 0x1e, 0xff, 0x26, 0x24, 0x24, 0xff, 0x55, 0x53, 0x53, 0xff, 0xb6, 0xb6, 0xb5, 0xff, 0xfa, 0xfa, 0xfa, 0xff,
-  0x77, 0x77, 0xea, 0xff, 0x31, 0x31, 0xe0, 0xff, 0x28, 0x28, 0xde, 0xff, 0x28, 0x28, 0xde, 0xff, 0x28, 0x28, 0xde, 0xff, 0x28, 0x28, 0xde, 0xff, 0x28, 0x28, 0xde, 0xff, 0x28, 0x28, 0xde, 0xff, 0x28, 0x28, 0xde, 0xff, 0x28, 0x28, 0xde, 0xff, 0x28, 0x28, 0xde, 0xff, 0x3b, 0x3b, 0xe2, 0xff, 0xb0, 0xb0, 0xf2, 0xff, 0xed, 0xed, 0xfd, 0xff, 0xa8, 0xa8, 0xf1, 0xff, 0x3d, 0x3d, 0xe2, 0xff, 0x28, 0x28, 0xde, 0xff, 0x28, 0x28, 0xde, 0xff, 0x28, 0x28, 0xde, 0xff, 0x28, 0x28, 0xde, 0xff, 0x28, 0x28, 0xde, 0xff, 0x28, 0x28, 0xde, 0xff, 0x28, 0x28, 0xde, 0xff, 0x28, 0x28, 0xde, 0xff, 0x28, 0x28, 0xde, 0xff, 0x34, 0x34, 0xe0, 0xff, 0x91, 0x91, 0xee, 0xff, 0xed, 0xed, 0xfc, 0xff, 0xd1, 0xd0, 0xd2, 0xff, 0x77, 0x75, 0x75, 0xff, 0x49, 0x48, 0x47, 0xff, 0x43, 0x41, 0x40, 0xff, 0x43, 0x41, 0x40, 0xff, 0x43, 0x41, 0x40, 0xff, 0x43, 0x41, 0x40, 0xff, 0x43, 0x41, 0x40, 0xff, 0x44, 0x42, 0x41, 0xff, 0x4b, 0x49, 0x48, 0xff, 0x6b, 0x69, 0x68, 0xff, 0xb1, 0xaf, 0xaf, 0xff, 0xe9, 0xe9, 0xe9, 0xff, 0xfe, 0xfe, 0xfe, 0xff,
-  0xd8, 0xd8, 0xf9, 0xff, 0xb9, 0xb9, 0xf5, 0xff, 0xae, 0xae, 0xf2, 0xff, 0xae, 0xae, 0xf2, 0xff, 0xae, 0xae, 0xf2, 0xff, 0xae, 0xae, 0xf2, 0xff, 0xae, 0xae, 0xf2, 0xff, 0xae, 0xae, 0xf2, 0xff, 0xae, 0xae, 0xf2, 0xff, 0xae, 0xae, 0xf2, 0xff, 0xae, 0xae, 0xf2, 0xff, 0xbe, 0xbe, 0xf5, 0xff, 0xe8, 0xe8, 0xfc, 0xff, 0xfa, 0xfa, 0xfe, 0xff, 0xe4, 0xe4, 0xfb, 0xff, 0xbf, 0xbf, 0xf5, 0xff, 0xaf, 0xaf, 0xf2, 0xff, 0xae, 0xae, 0xf2, 0xff, 0xae, 0xae, 0xf2, 0xff, 0xae, 0xae, 0xf2, 0xff, 0xae, 0xae, 0xf2, 0xff, 0xae, 0xae, 0xf2, 0xff, 0xae, 0xae, 0xf2, 0xff, 0xae, 0xae, 0xf2, 0xff, 0xaf, 0xaf, 0xf2, 0xff, 0xb9, 0xb9, 0xf4, 0xff, 0xde, 0xde, 0xfa, 0xff, 0xfb, 0xfb, 0xfe, 0xff, 0xf5, 0xf4, 0xf4, 0xff, 0xda, 0xda, 0xda, 0xff, 0xbf, 0xbe, 0xbd, 0xff, 0xb9, 0xb7, 0xb7, 0xff, 0xb9, 0xb7, 0xb7, 0xff, 0xb9, 0xb7, 0xb7, 0xff, 0xb9, 0xb7, 0xb7, 0xff, 0xb9, 0xb7, 0xb7, 0xff, 0xba, 0xb8, 0xb8, 0xff, 0xc1, 0xc0, 0xbf, 0xff, 0xd9, 0xd9, 0xd9, 0xff, 0xf2, 0xf2, 0xf2, 0xff, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
-#endif
-};
-
-const lv_img_dsc_t img_lvgl_logo = {
-  .header.always_zero = 0,
-  .header.w = 42,
-  .header.h = 43,
-  .data_size = 1806 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .data = img_lvgl_logo_map,
-};
-
-#endif
@@ -1,40 +0,0 @@
-/**
- * @file lv_demo_widgets.h
- *
- */
-
-#ifndef LV_DEMO_WIDGETS_H
-#define LV_DEMO_WIDGETS_H
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-/*********************
- *      INCLUDES
- *********************/
-#include "../lv_demos.h"
-
-/*********************
- *      DEFINES
- *********************/
-
-/**********************
- *      TYPEDEFS
- **********************/
-
-/**********************
- * GLOBAL PROTOTYPES
- **********************/
-void lv_demo_widgets(void);
-void lv_demo_widgets_close(void);
-
-/**********************
- *      MACROS
- **********************/
-
-#ifdef __cplusplus
-} /* extern "C" */
-#endif
-
-#endif /*LV_DEMO_WIDGETS_H*/
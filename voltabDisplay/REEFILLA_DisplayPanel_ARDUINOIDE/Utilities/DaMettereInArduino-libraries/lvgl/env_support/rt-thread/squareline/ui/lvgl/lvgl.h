@@ -1,15 +0,0 @@
-/*
- * Copyright (c) 2006-2021, RT-Thread Development Team
- *
- * SPDX-License-Identifier: MIT
- *
- * Change Logs:
- * Date           Author       Notes
- * 2022-11-20     Meco Man     The first version
- */
-
-#ifdef __RTTHREAD__
-
-#include "../../../../../lvgl.h" /* back to the root folder's lvgl.h */
-
-#endif /* __RTTHREAD__ */
@@ -1,436 +0,0 @@
-#include "../../lvgl.h"
-
-#if LV_BUILD_EXAMPLES
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-#define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_IMG_COGWHEEL_ARGB
-#define LV_ATTRIBUTE_IMG_IMG_COGWHEEL_ARGB
-#endif
-
-const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_IMG_IMG_COGWHEEL_ARGB uint8_t img_cogwheel_argb_map[] = {
-#if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
-  /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x08, 0x97, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0xdb, 0x6c, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x10, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0xff, 0x08, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x08, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0c, 0xff, 0x0f, 0xff, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x38, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0xff, 0x07, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdb, 0x53, 0xb7, 0xff, 0xff, 0x28, 0xff, 0x07, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x07, 0xff, 0x0c, 0xff, 0x2b, 0x97, 0xff, 0x92, 0xff, 0xb7, 0xa4, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x4b, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0xff, 0x2c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdb, 0x50, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x97, 0xff, 0xff, 0x28, 0xff, 0x08, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0c, 0xdb, 0x8c, 0x97, 0xff, 0x93, 0xff, 0x93, 0xff, 0x92, 0xff, 0x92, 0xff, 0xbb, 0x98, 0xff, 0x07, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0xbb, 0xab, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xfb, 0x72, 0xff, 0x96, 0xff, 0xff, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x20, 0x92, 0xff, 0x6e, 0xff, 0x6e, 0xfb, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x07, 0xbb, 0xb3, 0x93, 0xff, 0x72, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xfc, 0x72, 0xff, 0x93, 0xff, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0x97, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0xff, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0xb7, 0xd7, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xfb, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0xff, 0x23, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x24, 0x97, 0xff, 0x92, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x92, 0xff, 0x92, 0xff, 0xbb, 0x6b, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0x97, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xfb, 0xff, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x10, 0x92, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0xdb, 0x67, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0b, 0xb7, 0xc4, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x92, 0xff, 0x92, 0xff, 0xff, 0x2b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x08, 0x93, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0xdb, 0x40, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xbb, 0x7c, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xb7, 0xd4, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb7, 0xa3, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x92, 0xff, 0x72, 0xff, 0xb7, 0xbf, 0xff, 0x0f, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x07, 0xff, 0x2c, 0xb7, 0x83, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xfb, 0x72, 0xff, 0x92, 0xff, 0xdb, 0x47, 0xff, 0x04, 0xff, 0x00, 0xdf, 0x30, 0x72, 0xff, 0x72, 0xff, 0x72, 0xfb, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xfb, 0x72, 0xff, 0xb7, 0xdc, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb7, 0xbb, 0x93, 0xff, 0x93, 0xfc, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x92, 0xff, 0x92, 0xff, 0x93, 0xff, 0xb7, 0xa8, 0xdb, 0x3b, 0xdb, 0x34, 0xdb, 0x4f, 0xb7, 0xac, 0x97, 0xff, 0x92, 0xff, 0x72, 0xfb, 0x72, 0xfb, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xf7, 0x72, 0xff, 0x92, 0xff, 0xb7, 0xa8, 0xbb, 0x58, 0x92, 0xff, 0x72, 0xff, 0x72, 0xfb, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xb7, 0xc7, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdb, 0x7f, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x92, 0xfb, 0x92, 0xf7, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xf7, 0x92, 0xf7, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xfb, 0x72, 0xf3, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xf7, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x08, 0xb7, 0xdb, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xf7, 0x72, 0xf3, 0x72, 0xf0, 0x72, 0xf3, 0x72, 0xf7, 0x72, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xf7, 0x72, 0xf3, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xe4, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x17, 0x97, 0x94, 0xff, 0x2f, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0xff, 0x4b, 0xff, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdb, 0x88, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xec, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0f, 0xb7, 0x87, 0x72, 0xe7, 0x72, 0xff, 0x72, 0xff, 0xb7, 0x93, 0xff, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x07, 0xbb, 0xaf, 0x97, 0xff, 0xb7, 0xff, 0xff, 0x30, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x07, 0xb7, 0xd3, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xb7, 0x87, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0b, 0x97, 0xf4, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xdc, 0x4e, 0xff, 0x72, 0xff, 0xb7, 0xb0, 0xff, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x08, 0xb7, 0xcc, 0x97, 0xff, 0x93, 0xff, 0x93, 0xff, 0x97, 0xff, 0xdf, 0x4b, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x07, 0xb7, 0x88, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xf7, 0x6e, 0xff, 0x72, 0xff, 0xb7, 0x83, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0c, 0x92, 0xff, 0x72, 0xff, 0x6e, 0xfb, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xf7, 0x4e, 0xff, 0x6e, 0xff, 0x96, 0xbf, 0xff, 0x07, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x08, 0xb7, 0xc8, 0x97, 0xff, 0x97, 0xff, 0x97, 0xf8, 0x93, 0xf8, 0x93, 0xff, 0x97, 0xff, 0xbb, 0xbb, 0xff, 0x18, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xdb, 0x78, 0x97, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xf8, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xf7, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0xdb, 0x6b, 0xff, 0x2c, 0x72, 0xf7, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xfb, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xf7, 0x4e, 0xff, 0x6e, 0xff, 0xb7, 0xa7, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xbb, 0x9f, 0x97, 0xff, 0x93, 0xff, 0x97, 0xf8, 0x97, 0xff, 0x97, 0xff, 0x93, 0xf8, 0x93, 0xff, 0x97, 0xff, 0xb7, 0xe7, 0xff, 0x20, 0xff, 0x07, 0xbb, 0x77, 0x97, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xf8, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xf7, 0x6e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xfb, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xf7, 0x6e, 0xff, 0x92, 0xe3, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x08, 0xb7, 0xd7, 0x93, 0xff, 0x97, 0xf8, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x93, 0xfc, 0x93, 0xff, 0x93, 0xff, 0x97, 0xff, 0x97, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xf8, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xfb, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xfb, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x92, 0xb8, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x07, 0xb7, 0xc4, 0x93, 0xff, 0x97, 0xfc, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x93, 0xff, 0x93, 0xff, 0x97, 0xfc, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xfb, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xb7, 0xbb, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdb, 0x6f, 0x97, 0xff, 0x93, 0xff, 0x97, 0xfc, 0x97, 0xff, 0x97, 0xff, 0x93, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xff, 0x28, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0b, 0xdb, 0x8f, 0x93, 0xff, 0x93, 0xff, 0x97, 0xfc, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xfb, 0x72, 0xfb, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xfb, 0x4e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0xb6, 0xd3, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0b, 0xbb, 0x8f, 0x93, 0xff, 0x93, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x92, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x92, 0xff, 0xb7, 0x97, 0xff, 0x13, 0xdb, 0x2b, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xfb, 0x6e, 0xff, 0x6e, 0xff, 0xb7, 0x63, 0xff, 0x18, 0xdf, 0x14, 0xdb, 0x30, 0x92, 0xff, 0x72, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xfb, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xfb, 0x6e, 0xff, 0x92, 0xff, 0xff, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x13, 0x97, 0xff, 0x93, 0xff, 0x97, 0xfc, 0x97, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x72, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfb, 0x4e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0x92, 0xff, 0xdb, 0x28, 0xff, 0x0f, 0xff, 0x04, 0xff, 0x00, 0xff, 0x00, 0x97, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0xb7, 0xb3, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x07, 0xdb, 0x37, 0x92, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xfb, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0xb7, 0x9c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x28, 0x97, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x97, 0xff, 0x93, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfb, 0x4e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xdb, 0x54, 0xff, 0x0f, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0xb7, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0xff, 0x13, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0c, 0xff, 0x0b, 0xbb, 0x4f, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xfb, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xff, 0x0f, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0c, 0x97, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x97, 0xff, 0x93, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfb, 0x4e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xdb, 0x40, 0xff, 0x07, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0xb7, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x08, 0xb7, 0x5f, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xfb, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xff, 0x0f, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xbb, 0x9f, 0x97, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xf7, 0x4e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xdb, 0x44, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0xb7, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0xff, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xbb, 0x60, 0x92, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xf7, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xb7, 0xb3, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x18, 0x97, 0xff, 0x93, 0xff, 0x93, 0xfc, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xf4, 0x6e, 0xff, 0x6e, 0xff, 0xb7, 0x88, 0xff, 0x0f, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0xb7, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0xff, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x1f, 0x96, 0xc0, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xf7, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xfb, 0x6e, 0xff, 0x72, 0xff, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xdf, 0x44, 0x97, 0x7c, 0x92, 0x70, 0x92, 0x87, 0xff, 0x20, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0b, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0xb7, 0xb0, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xf4, 0x6e, 0xff, 0x92, 0xff, 0xdb, 0x4f, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0xb7, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0xff, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb7, 0x70, 0x72, 0xff, 0x6e, 0xff, 0x72, 0xf7, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xfb, 0x92, 0xac, 0xb7, 0x80, 0xb7, 0x80, 0xb7, 0x78, 0x96, 0x9b, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x92, 0xff, 0xff, 0x13, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x23, 0x97, 0xf3, 0xb7, 0xe8, 0xdf, 0x64, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x03, 0xff, 0x00, 0xff, 0x04, 0xbb, 0x94, 0x93, 0xff, 0x93, 0xff, 0x93, 0xfc, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x92, 0xff, 0x72, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xf4, 0x6e, 0xff, 0x92, 0xff, 0xdb, 0x54, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0xb7, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0xff, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb7, 0x77, 0x72, 0xff, 0x72, 0xff, 0x72, 0xf7, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xfb, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xf7, 0x6e, 0xe7, 0x6e, 0xe8, 0x6e, 0xe7, 0x6e, 0xff, 0x92, 0xff, 0xff, 0x07, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x10, 0x97, 0xff, 0x93, 0xff, 0x93, 0xff, 0x97, 0xff, 0x93, 0xe3, 0x97, 0xcc, 0x97, 0xcf, 0xbb, 0xac, 0xb7, 0xd4, 0x97, 0xff, 0x93, 0xff, 0x93, 0xf8, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x72, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xf4, 0x6e, 0xff, 0x92, 0xff, 0xdb, 0x4f, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0xb7, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0xff, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb7, 0x77, 0x72, 0xff, 0x72, 0xff, 0x72, 0xf7, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x72, 0xff, 0xff, 0x18, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdf, 0x50, 0x93, 0xff, 0x92, 0xff, 0x93, 0xf8, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x97, 0xff, 0x97, 0xff, 0x93, 0xff, 0x93, 0xf8, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xf8, 0x6e, 0xff, 0x92, 0xff, 0xdb, 0x50, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0xb7, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0xff, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb7, 0x74, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0xbb, 0x88, 0xff, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x10, 0x97, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfc, 0x6e, 0xff, 0x6e, 0xff, 0xdb, 0x57, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0xb7, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0xff, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0x97, 0xf3, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x1f, 0x92, 0xff, 0x92, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0xb7, 0x87, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0xb7, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0xff, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x2f, 0x93, 0xff, 0x72, 0xff, 0x72, 0xfb, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0xdb, 0x7b, 0x92, 0xff, 0x92, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xff, 0x0f, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0xb7, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0xff, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdb, 0x44, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xdb, 0x78, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x92, 0xff, 0x72, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfc, 0x6e, 0xff, 0x92, 0xff, 0xff, 0x37, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xb7, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xb7, 0xfb, 0x92, 0xff, 0x72, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xdb, 0x4f, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x08, 0xb7, 0x93, 0x92, 0xff, 0x72, 0xff, 0x92, 0xff, 0x92, 0xfc, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x92, 0xff, 0x93, 0xff, 0x93, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0xdb, 0x4b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x20, 0x97, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0xdb, 0x37, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x2c, 0x93, 0xff, 0x72, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xfb, 0x4e, 0xff, 0x6e, 0xff, 0x96, 0xac, 0xff, 0x28, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0xdf, 0x40, 0xb7, 0xd8, 0x93, 0xff, 0x72, 0xff, 0x92, 0xff, 0x92, 0xfc, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x93, 0xff, 0x93, 0xff, 0x72, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfc, 0x6e, 0xff, 0x92, 0xff, 0xff, 0x08, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x10, 0xdb, 0x44, 0x97, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xfb, 0x72, 0xff, 0x92, 0xff, 0xdb, 0x47, 0xff, 0x07, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xb7, 0xa7, 0x72, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xfb, 0x6e, 0xff, 0x6e, 0xff, 0xb7, 0x83, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0b, 0xbb, 0x7f, 0x97, 0xff, 0x92, 0xff, 0x92, 0xf8, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x93, 0xff, 0x92, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0xdb, 0x44, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdb, 0x2b, 0x93, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xfb, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xf7, 0x72, 0xff, 0x92, 0xff, 0x97, 0xff, 0xff, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x1b, 0x97, 0xff, 0x92, 0xff, 0x93, 0xff, 0x93, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xf4, 0x6e, 0xff, 0xb7, 0x84, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xff, 0x17, 0xbb, 0x78, 0x93, 0xff, 0x92, 0xf8, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x93, 0xff, 0x92, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xff, 0x0f, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x18, 0xb7, 0x8c, 0x92, 0xff, 0x72, 0xff, 0x72, 0xf3, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xfb, 0x6e, 0xf7, 0x72, 0xff, 0x72, 0xff, 0xb7, 0x5b, 0xff, 0x14, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xbb, 0x6c, 0x92, 0xff, 0x93, 0xff, 0x93, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xf7, 0x6e, 0xff, 0x92, 0x8b, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdf, 0x44, 0x97, 0xff, 0x92, 0xf3, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x93, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0xb7, 0xb8, 0xff, 0x08, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x1c, 0x97, 0xff, 0x72, 0xff, 0x72, 0xf7, 0x72, 0xf7, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xef, 0x6e, 0xfb, 0x72, 0xff, 0x97, 0xff, 0xff, 0x18, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x18, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xf0, 0x6e, 0xff, 0xdb, 0x37, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdb, 0x4c, 0x92, 0xff, 0x92, 0xf3, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xff, 0x28, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x08, 0x97, 0xe8, 0x72, 0xff, 0x6e, 0xe3, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xfb, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xf7, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xdf, 0x6e, 0xff, 0x97, 0xb7, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x13, 0x97, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xf7, 0x6e, 0xff, 0xb7, 0x90, 0xff, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdb, 0x4c, 0x72, 0xff, 0x92, 0xf3, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0xb6, 0xc7, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0xbb, 0x94, 0x72, 0xff, 0x6e, 0xf4, 0x6e, 0xff, 0x96, 0xd8, 0xb7, 0xcc, 0x92, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xeb, 0x72, 0xcf, 0x6e, 0xfb, 0x6e, 0xf7, 0x72, 0xff, 0xdb, 0x4b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdb, 0x3c, 0x97, 0xff, 0x93, 0xff, 0x97, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xfb, 0x92, 0xff, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xb7, 0x78, 0x72, 0xff, 0x92, 0xf7, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0xff, 0x33, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdf, 0x3f, 0x92, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x92, 0xd4, 0xff, 0x04, 0xff, 0x00, 0xff, 0x0f, 0x92, 0xff, 0x92, 0xff, 0x92, 0xe8, 0xb7, 0xaf, 0x97, 0xb4, 0xb7, 0xb4, 0xb7, 0xaf, 0x97, 0xe7, 0x92, 0xff, 0x92, 0xff, 0xb7, 0xb3, 0xff, 0x03, 0xff, 0x00, 0x92, 0xcb, 0x6e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xff, 0x23, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x18, 0x97, 0xff, 0x93, 0xff, 0x97, 0xff, 0x93, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xf7, 0x72, 0xff, 0xdb, 0x3c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x18, 0x97, 0xec, 0x72, 0xff, 0x92, 0xfc, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xff, 0x20, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x23, 0x93, 0xff, 0x72, 0xff, 0x72, 0xf8, 0x72, 0xff, 0x92, 0xdc, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x14, 0xdb, 0x78, 0xff, 0x0c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0b, 0xdb, 0x77, 0xff, 0x3b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0x97, 0xdf, 0x72, 0xff, 0x6e, 0xf3, 0x6e, 0xff, 0xb7, 0xcb, 0xff, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x18, 0x97, 0xff, 0x93, 0xff, 0x97, 0xff, 0x93, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xff, 0x27, 0xff, 0x00, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xff, 0x4f, 0x97, 0xff, 0x72, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdb, 0x3f, 0x72, 0xff, 0x72, 0xf4, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0xdb, 0x60, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xbb, 0x88, 0x92, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x6e, 0xf7, 0x72, 0xff, 0xdb, 0x30, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0c, 0x97, 0xff, 0x93, 0xff, 0x97, 0xff, 0x97, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xf7, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xd4, 0x6e, 0xdc, 0x6e, 0xdf, 0x6e, 0xff, 0x92, 0xe7, 0xff, 0x0c, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x08, 0xff, 0x10, 0xff, 0x0b, 0xff, 0x1b, 0xff, 0x50, 0xbb, 0xb4, 0x97, 0xff, 0x92, 0xff, 0x72, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xff, 0x43, 0xff, 0x03, 0xff, 0x03, 0xff, 0x04, 0xff, 0x04, 0xff, 0x04, 0xff, 0x04, 0xff, 0x04, 0xff, 0x04, 0xff, 0x04, 0xff, 0x04, 0xff, 0x03, 0xff, 0x04, 0xff, 0x13, 0xb7, 0x80, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xfb, 0x72, 0xff, 0x92, 0xff, 0xff, 0x17, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0b, 0x92, 0xff, 0x72, 0xff, 0x72, 0xfb, 0x72, 0xff, 0x6e, 0xfb, 0x6e, 0xff, 0x97, 0xb0, 0xff, 0x10, 0xff, 0x03, 0xff, 0x04, 0xff, 0x04, 0xff, 0x04, 0xff, 0x04, 0xff, 0x04, 0xff, 0x04, 0xff, 0x04, 0xff, 0x04, 0xff, 0x04, 0xff, 0x04, 0xff, 0x04, 0xff, 0x03, 0xdf, 0x33, 0x93, 0xff, 0x92, 0xff, 0x93, 0xff, 0x93, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xf8, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x72, 0xe3, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x20, 0xb7, 0xdf, 0x97, 0xff, 0x97, 0xff, 0x93, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xfc, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0x97, 0xff, 0xdb, 0x98, 0xdb, 0x64, 0xdb, 0x80, 0xdb, 0x80, 0xdb, 0x88, 0xdb, 0x8b, 0xdb, 0x88, 0xdb, 0x88, 0xdb, 0x87, 0xdb, 0x88, 0xdb, 0x78, 0xbb, 0xaf, 0x97, 0xff, 0x92, 0xff, 0x72, 0xfc, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0xdb, 0x6c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x14, 0x72, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xfb, 0x72, 0xff, 0x92, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfb, 0x4e, 0xff, 0x4e, 0xff, 0xff, 0x08,
-  0xff, 0x0f, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xfc, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xfc, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xfc, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xff, 0x37, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x97, 0xb7, 0x72, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xfb, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xfb, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xec, 0xff, 0x3b,
-  0xff, 0x50, 0x72, 0xff, 0x72, 0xff, 0x72, 0xfc, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xff, 0x2c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb7, 0xb3, 0x72, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfb, 0xb7, 0xaf,
-  0xff, 0x60, 0x92, 0xf3, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xff, 0x28, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb7, 0xb7, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfb, 0x4e, 0xff, 0x92, 0xff,
-  0xff, 0x3b, 0x92, 0xec, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xff, 0x20, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb7, 0xb8, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfb, 0x4e, 0xff, 0x92, 0xff,
-  0xff, 0x3c, 0x72, 0xec, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xff, 0x24, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x97, 0xb3, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0xbb, 0x8f,
-  0xff, 0x2c, 0x72, 0xff, 0x72, 0xff, 0x72, 0xfc, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xfc, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xfc, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xff, 0x38, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0c, 0x92, 0xdc, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xfb, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xfb, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfb, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xff, 0x0b,
-  0xff, 0x0b, 0x92, 0xf7, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xfc, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x92, 0xff, 0xdb, 0x93, 0xff, 0x57, 0xdf, 0x5b, 0xdf, 0x5b, 0xdb, 0x63, 0xdb, 0x63, 0xdf, 0x5b, 0xdf, 0x5c, 0xdb, 0x64, 0xff, 0x53, 0xdb, 0x90, 0x97, 0xff, 0x92, 0xff, 0x72, 0xfc, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xdb, 0x73, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x4c, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xfb, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xfb, 0x6e, 0xff, 0x72, 0xff, 0x92, 0xff, 0x96, 0xff, 0xb7, 0x9f, 0xdb, 0x78, 0xbb, 0x84, 0xbb, 0x83, 0xbb, 0x83, 0xbb, 0x83, 0xbb, 0x83, 0xbb, 0x7f, 0xbb, 0x8b, 0xb7, 0xdf, 0x92, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xf8, 0x6e, 0xff, 0x72, 0xff, 0x92, 0xff, 0xdb, 0x60, 0xff, 0x17, 0xff, 0x0c, 0xff, 0x08, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x17, 0xbb, 0xa0, 0x97, 0xff, 0x97, 0xff, 0x93, 0xf8, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xf8, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0xb7, 0x94, 0xff, 0x1c, 0xff, 0x04, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x04, 0xff, 0x10, 0xb7, 0x70, 0x72, 0xff, 0x72, 0xfc, 0x72, 0xff, 0x72, 0xfc, 0x72, 0xff, 0x92, 0xff, 0xff, 0x4b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0c, 0x92, 0xf8, 0x6e, 0xff, 0x6e, 0xfb, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xf7, 0x6e, 0xff, 0x92, 0xff, 0xdb, 0x2b, 0xff, 0x03, 0xff, 0x07, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xff, 0x03, 0xdb, 0x37, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4d, 0xff, 0x92, 0xff, 0xdb, 0x33, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0xff, 0x0c, 0xff, 0x0b, 0xff, 0x07, 0xff, 0x18, 0xdb, 0x90, 0x92, 0xff, 0x72, 0xff, 0x72, 0xf8, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x92, 0xff, 0xff, 0x23, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdb, 0x43, 0x72, 0xff, 0x72, 0xf7, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0xb7, 0xb3, 0xff, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x3b, 0x92, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xf8, 0x6e, 0xff, 0x92, 0xff, 0xdb, 0x30, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x14, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0xdb, 0x3f, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdf, 0x50, 0x92, 0xff, 0x72, 0xfc, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x92, 0xff, 0xff, 0x20, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x2f, 0x97, 0xff, 0x72, 0xff, 0x72, 0xf8, 0x6e, 0xff, 0x92, 0xff, 0xff, 0x28, 0xff, 0x00, 0xff, 0x03, 0xdb, 0x78, 0x97, 0xec, 0xff, 0x40, 0xff, 0x00, 0xff, 0x03, 0xff, 0x03, 0xff, 0x00, 0xff, 0x20, 0xbb, 0x9f, 0xff, 0x23, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0x97, 0xd8, 0x6e, 0xff, 0x6e, 0xfb, 0x6e, 0xff, 0x72, 0xff, 0xdb, 0x33, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x18, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfb, 0x92, 0xff, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb7, 0x7c, 0x72, 0xff, 0x72, 0xf7, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x92, 0xff, 0xff, 0x2b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x47, 0x92, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xff, 0x58, 0xff, 0x07, 0xff, 0x2f, 0x92, 0xff, 0x72, 0xff, 0x92, 0xff, 0xb7, 0xbc, 0xb7, 0xbf, 0xb7, 0xc0, 0xb7, 0xbc, 0x97, 0xfc, 0x72, 0xff, 0x92, 0xff, 0xff, 0x37, 0xff, 0x03, 0xff, 0x07, 0x97, 0xd8, 0x72, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xdb, 0x47, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdb, 0x47, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xff, 0x13, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdb, 0x48, 0x72, 0xff, 0x72, 0xf3, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0xff, 0x24, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xdb, 0x68, 0x72, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x92, 0xff, 0x97, 0xe8, 0x92, 0xfc, 0x6e, 0xff, 0x6e, 0xf8, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0x97, 0xdb, 0x97, 0xd8, 0x93, 0xf8, 0x72, 0xff, 0x6e, 0xff, 0xbb, 0x80, 0xff, 0x08, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x14, 0x97, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfb, 0x6e, 0xff, 0xdb, 0x54, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdb, 0x54, 0x92, 0xff, 0x72, 0xf3, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0xff, 0x2f, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xb7, 0x8c, 0x72, 0xff, 0x72, 0xe8, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xfc, 0x72, 0xfc, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xfc, 0x6e, 0xfc, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xef, 0x72, 0xff, 0xbb, 0x6c, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x13, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xf8, 0x72, 0xff, 0xff, 0x23, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x3f, 0x97, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0xb7, 0xa0, 0xff, 0x08, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x17, 0xb7, 0xef, 0x72, 0xff, 0x6e, 0xfc, 0x72, 0xf3, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xf4, 0x6e, 0xf8, 0x72, 0xff, 0xb7, 0xd8, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdb, 0x2b, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfb, 0x6e, 0xff, 0xb7, 0x6b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x30, 0x97, 0xff, 0x72, 0xff, 0x72, 0xfc, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x72, 0xff, 0xff, 0x3c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x20, 0xbb, 0x6c, 0x92, 0xff, 0x72, 0xff, 0x6e, 0xfc, 0x6e, 0xf8, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xf8, 0x6e, 0xff, 0x72, 0xff, 0xb7, 0x77, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x07, 0x97, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfb, 0x72, 0xff, 0xb7, 0x53, 0xff, 0x08, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x07, 0xff, 0x28, 0xb7, 0x90, 0x72, 0xff, 0x72, 0xf8, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x97, 0xec, 0xff, 0x10, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x30, 0xb7, 0xa4, 0x92, 0xff, 0x72, 0xff, 0x72, 0xfc, 0x6e, 0xfc, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xf8, 0x6e, 0xff, 0x72, 0xff, 0xdb, 0x48, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdf, 0x37, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfb, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0xb7, 0x84, 0xff, 0x18, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x13, 0xb7, 0x90, 0x92, 0xff, 0x72, 0xff, 0x72, 0xfc, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x72, 0xff, 0xff, 0x13, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x08, 0xff, 0x34, 0xdb, 0x64, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xf8, 0x6e, 0xff, 0x92, 0xff, 0xdb, 0x4b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x07, 0x97, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfb, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xdb, 0x57, 0x92, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0xdb, 0x64, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0b, 0x92, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xfc, 0x6e, 0xff, 0x92, 0xff, 0xdb, 0x40, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdb, 0x4c, 0x93, 0xff, 0x72, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0xbb, 0x5b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0xb7, 0x87, 0x72, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfc, 0x6e, 0xff, 0x72, 0xff, 0xff, 0x14, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x10, 0x97, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0xb7, 0xc4, 0xff, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x07, 0x97, 0xff, 0x92, 0xff, 0x92, 0xfb, 0x92, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfb, 0x4e, 0xff, 0x96, 0xff, 0xff, 0x08, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x1b, 0x72, 0xff, 0x6e, 0xff, 0x72, 0xfc, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0xb7, 0x7b, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x13, 0x96, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xff, 0x27, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdb, 0x58, 0x93, 0xff, 0x92, 0xff, 0x93, 0xff, 0x92, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0xb7, 0xd0, 0xff, 0x04, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x17, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xfc, 0x4e, 0xff, 0x72, 0xff, 0xbb, 0x7c, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x13, 0x96, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xff, 0x0c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdb, 0x4b, 0x97, 0xff, 0x93, 0xff, 0x93, 0xfb, 0x93, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0xdb, 0x58, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x07, 0xdb, 0x84, 0x72, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xf8, 0x4e, 0xff, 0x72, 0xff, 0xdb, 0x78, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x13, 0x96, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xff, 0x10, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x34, 0x97, 0xff, 0x92, 0xff, 0x93, 0xfb, 0x93, 0xff, 0x92, 0xff, 0x72, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfb, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfb, 0x4e, 0xff, 0x72, 0xff, 0xff, 0x14, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x27, 0x92, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xf8, 0x6e, 0xff, 0x72, 0xff, 0xff, 0x08, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x13, 0x96, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xff, 0x10, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x07, 0x97, 0xec, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xf8, 0x4e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xff, 0x07, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x14, 0x92, 0xff, 0x6e, 0xff, 0x6e, 0xfc, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xfc, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xf8, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x97, 0x93, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x13, 0x96, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xff, 0x10, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x07, 0xb7, 0x8c, 0x93, 0xff, 0x93, 0xff, 0x97, 0xff, 0x93, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x92, 0xe8, 0xdb, 0x54, 0xff, 0x34, 0x97, 0xcb, 0x72, 0xd7, 0x6e, 0xcb, 0x6e, 0xdc, 0x92, 0xf8, 0xff, 0x18, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x24, 0x92, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0x92, 0xe8, 0x92, 0xc7, 0x92, 0xff, 0x6e, 0xff, 0x6e, 0xfc, 0x72, 0xfc, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xf8, 0x6e, 0xff, 0x6e, 0xff, 0x97, 0xc8, 0xff, 0x20, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x13, 0x92, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xff, 0x10, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x17, 0xb7, 0xcf, 0x93, 0xff, 0x93, 0xff, 0x97, 0xf7, 0x97, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xf8, 0x6e, 0xff, 0x92, 0xab, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x28, 0x97, 0xbc, 0xb7, 0x9b, 0xb7, 0x98, 0xb7, 0xa3, 0xdb, 0x93, 0xff, 0x24, 0xff, 0x0b, 0xdb, 0x74, 0x92, 0xf7, 0x6e, 0xf8, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xf8, 0x6e, 0xff, 0x72, 0xff, 0x97, 0xd4, 0xff, 0x2b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x13, 0x92, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xff, 0x13, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0f, 0xb7, 0xb0, 0x97, 0xff, 0x93, 0xff, 0x97, 0xf7, 0x97, 0xff, 0x93, 0xff, 0x72, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfb, 0x4e, 0xff, 0x92, 0xff, 0xff, 0x37, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x2c, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xfc, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xfc, 0x6e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xdb, 0x7f, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x13, 0x92, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xff, 0x13, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xff, 0x48, 0x97, 0xff, 0x93, 0xff, 0x97, 0xff, 0x97, 0xfb, 0x97, 0xff, 0x93, 0xff, 0x72, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0xd7, 0x74, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xb7, 0x87, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xfc, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xb7, 0x7b, 0xff, 0x08, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x13, 0x92, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xff, 0x13, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x13, 0xbb, 0x93, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xfb, 0x97, 0xff, 0x93, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfb, 0x6e, 0xff, 0x92, 0xff, 0xff, 0x08, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x08, 0xb7, 0xc8, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xf8, 0x6e, 0xff, 0x72, 0xff, 0xb7, 0xcc, 0xff, 0x38, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x13, 0x92, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xff, 0x13, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0xff, 0x3f, 0xb7, 0xf7, 0x97, 0xff, 0x93, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x93, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0xdb, 0x73, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0xbb, 0xa8, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xfc, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0xb7, 0xac, 0xff, 0x30, 0xff, 0x23, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x13, 0x92, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xff, 0x0f, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0xff, 0x1f, 0xff, 0x23, 0xbb, 0x87, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x97, 0xfb, 0x97, 0xff, 0x97, 0xff, 0x93, 0xff, 0x72, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0xdb, 0x4f, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x20, 0x92, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x93, 0xff, 0xdb, 0x57, 0xff, 0x1b, 0xff, 0x08, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0f, 0x92, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0f, 0xff, 0x28, 0xdb, 0x68, 0x97, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x97, 0xff, 0x97, 0xff, 0x93, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x72, 0xff, 0xff, 0x1c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xb7, 0x9f, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0x97, 0xff, 0xbb, 0x74, 0xdf, 0x3b, 0xff, 0x33, 0xff, 0x13, 0xff, 0x27, 0x92, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0xdb, 0x97, 0xff, 0x3b, 0xff, 0x2c, 0xdf, 0x38, 0xb7, 0xa3, 0x97, 0xff, 0x93, 0xff, 0x92, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x97, 0xff, 0x93, 0xff, 0x93, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xf8, 0x4e, 0xff, 0x92, 0xff, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdb, 0x4c, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xfc, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x97, 0xff, 0xbb, 0xc7, 0xb7, 0xac, 0x72, 0xfc, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xfc, 0x6e, 0xfc, 0x92, 0xff, 0x97, 0xff, 0x93, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x92, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xf8, 0x6e, 0xff, 0x96, 0xb3, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x4c, 0x92, 0xff, 0x6e, 0xff, 0x6e, 0xf8, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x92, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xfc, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0x92, 0xff, 0x93, 0xff, 0x93, 0xff, 0x93, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x72, 0xbb, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0x97, 0xe8, 0x6e, 0xff, 0x6e, 0xf8, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x93, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfb, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4d, 0xff, 0x72, 0xff, 0xff, 0x40, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0c, 0x92, 0xef, 0x6e, 0xff, 0x6e, 0xfc, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0x93, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x92, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfb, 0x4e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xf8, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xf8, 0x4e, 0xff, 0x72, 0xe3, 0xff, 0x0c, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x07, 0x97, 0xd3, 0x6e, 0xff, 0x4e, 0xff, 0x6e, 0xf8, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xfc, 0x6e, 0xfc, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x6e, 0xf8, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xf8, 0x4e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xb7, 0x8b, 0xdb, 0x73, 0x72, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfb, 0x4e, 0xff, 0x4e, 0xf8, 0x4e, 0xff, 0x72, 0xff, 0xb7, 0x8b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x1b, 0x92, 0xeb, 0x6e, 0xff, 0x4e, 0xff, 0x6e, 0xfc, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xfc, 0x6e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0x92, 0xdc, 0x96, 0xd3, 0x92, 0xe3, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xfc, 0x6e, 0xfc, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xf7, 0x4e, 0xff, 0x6e, 0xff, 0x92, 0xfc, 0xfb, 0x4f, 0xff, 0x03, 0xff, 0x00, 0xff, 0x38, 0x92, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x72, 0xff, 0xb7, 0xbc, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x10, 0x92, 0xe7, 0x6e, 0xff, 0x4e, 0xff, 0x6e, 0xf8, 0x4e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x92, 0xe8, 0xff, 0x43, 0xff, 0x08, 0xff, 0x03, 0xff, 0x0c, 0xb7, 0x93, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xf8, 0x4e, 0xff, 0x6e, 0xff, 0xb7, 0x73, 0xff, 0x07, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x10, 0xbb, 0x67, 0x6e, 0xf7, 0x4e, 0xd8, 0x72, 0xe7, 0xbb, 0x8b, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0f, 0x97, 0xd0, 0x72, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x92, 0xf7, 0xff, 0x4f, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x37, 0x92, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0xd7, 0x7b, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0c, 0xff, 0x0f, 0xff, 0x07, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x13, 0xb7, 0x9b, 0xb7, 0xa0, 0xbb, 0x90, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x07, 0xb7, 0xdc, 0x72, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x92, 0xc7, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x08, 0xb7, 0xe7, 0x6e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x92, 0xa7, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0c, 0x72, 0xef, 0x6e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xf8, 0x4e, 0xf8, 0x4e, 0xf8, 0x6e, 0xfc, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xf8, 0x4e, 0xf8, 0x4e, 0xf7, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x92, 0xa7, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x10, 0x6e, 0xf0, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xf8, 0x4e, 0xff, 0x6e, 0xff, 0x72, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x4e, 0xfc, 0x6e, 0xfc, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xf8, 0x4e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0x92, 0xff, 0x92, 0xff, 0x6e, 0xff, 0x4e, 0xfc, 0x4e, 0xfc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x72, 0xcf, 0xff, 0x17, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xdf, 0x53, 0x6e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xfc, 0x6e, 0xff, 0x92, 0xff, 0xdb, 0x67, 0xff, 0x3b, 0xdb, 0x50, 0xb7, 0xaf, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xf8, 0x6e, 0xff, 0x92, 0xff, 0xdb, 0x58, 0xdb, 0x40, 0xdb, 0x4f, 0xff, 0x3f, 0xff, 0x2f, 0xb7, 0x7f, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x72, 0xff, 0xdb, 0x7b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x08, 0x97, 0xff, 0x6e, 0xff, 0x4e, 0xf8, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xfc, 0x6e, 0xff, 0x6e, 0xff, 0xdb, 0x58, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x24, 0x72, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xff, 0x47, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x28, 0x92, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfb, 0x6e, 0xff, 0x96, 0xc3, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0xb7, 0xc0, 0x6e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0xb7, 0xa0, 0xff, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0c, 0x92, 0xf8, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0xb7, 0xcf, 0xff, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x08, 0xb7, 0x83, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x72, 0xff, 0xdf, 0x54, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x28, 0x92, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfc, 0x4e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xff, 0x28, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x10, 0x96, 0xff, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0xff, 0x53, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x2f, 0x92, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xdb, 0x68, 0xff, 0x07, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x23, 0xbb, 0x94, 0x92, 0xff, 0x72, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xdb, 0x50, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x13, 0xb7, 0xff, 0x6e, 0xff, 0x4e, 0xfc, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0xff, 0x17, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x08, 0xdb, 0x68, 0x92, 0xff, 0x72, 0xff, 0x92, 0xff, 0x96, 0xff, 0xdb, 0x6b, 0xff, 0x24, 0xff, 0x07, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0b, 0xff, 0x17, 0xff, 0x38, 0x97, 0xeb, 0x92, 0xff, 0xdb, 0x63, 0xff, 0x17, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x0f, 0xb7, 0xef, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfc, 0x4e, 0xff, 0x92, 0xff, 0xff, 0x10, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x04, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0x1c, 0xff, 0x07, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x13, 0xff, 0x1b, 0xff, 0x04, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x2f, 0x6e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x6e, 0xff, 0x92, 0xff, 0xff, 0x10, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xff, 0x00, 0xff, 0x0b, 0xb7, 0xb8, 0x72, 0xff, 0x72, 0xe7, 0x72, 0xe3, 0x72, 0xe4, 0x72, 0xe7, 0x72, 0xff, 0x92, 0xf7, 0xff, 0x28, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-  0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x03, 0xff, 0x08, 0xff, 0x0c, 0xff, 0x0c, 0xff, 0x0b, 0xff, 0x10, 0xff, 0x18, 0xff, 0x13, 0xff, 0x0b, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x08, 0xf6, 0x94, 0xff, 0xf3, 0x73, 0xff, 0xd2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0x33, 0x74, 0xff, 0x5a, 0xc6, 0x6c, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x9e, 0xf7, 0x10, 0x54, 0x7c, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0x74, 0x84, 0xff, 0xdf, 0xff, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x0c, 0x9f, 0xf7, 0x0f, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x1d, 0xdf, 0x38, 0x33, 0x74, 0xff, 0xd2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0x13, 0x74, 0xff, 0xdf, 0xff, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x19, 0xbe, 0x53, 0x16, 0x9d, 0xff, 0xdc, 0xde, 0x28, 0xdf, 0xff, 0x07, 0xdf, 0xff, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xdf, 0xff, 0x0c, 0x1d, 0xdf, 0x2b, 0xd6, 0x8c, 0xff, 0x34, 0x74, 0xff, 0x57, 0x9d, 0xa4, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdc, 0xd6, 0x4b, 0x54, 0x7c, 0xff, 0xd2, 0x6b, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0x13, 0x74, 0xff, 0xdc, 0xde, 0x2c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xf9, 0xbd, 0x50, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0x90, 0x63, 0xff, 0x12, 0x74, 0xff, 0xd5, 0x8c, 0xff, 0xfc, 0xde, 0x28, 0xdf, 0xff, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0c, 0x1a, 0xbe, 0x8c, 0xd6, 0x8c, 0xff, 0x95, 0x84, 0xff, 0x54, 0x7c, 0xff, 0x33, 0x74, 0xff, 0x54, 0x7c, 0xff, 0x98, 0xad, 0x98, 0xff, 0xff, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0xd8, 0xb5, 0xab, 0x53, 0x7c, 0xff, 0xf2, 0x6b, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0xf3, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xfb, 0xf2, 0x73, 0xff, 0x94, 0x8c, 0xff, 0xdf, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5d, 0xe7, 0x20, 0x73, 0x7c, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xfb, 0x90, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xd1, 0x6b, 0xff, 0x12, 0x74, 0xff, 0x73, 0x84, 0xff, 0xdf, 0xff, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xb9, 0xad, 0xb3, 0x75, 0x7c, 0xff, 0x14, 0x74, 0xff, 0x34, 0x74, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xfc, 0x13, 0x74, 0xff, 0x75, 0x84, 0xff, 0x5e, 0xef, 0x1b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x04, 0xf6, 0x94, 0xff, 0x33, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0x13, 0x74, 0xff, 0xf3, 0x6b, 0xff, 0xf3, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0x12, 0x7c, 0xff, 0xdf, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0x16, 0x9d, 0xd7, 0xd1, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0x90, 0x63, 0xfb, 0x70, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x90, 0x63, 0xff, 0x5d, 0xef, 0x23, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xbf, 0xf7, 0x24, 0xd6, 0x8c, 0xff, 0x34, 0x74, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x34, 0x74, 0xff, 0x54, 0x7c, 0xff, 0x98, 0xad, 0x6b, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0x95, 0x84, 0xff, 0x33, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0xf3, 0x73, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x73, 0xfb, 0xdf, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x9e, 0xf7, 0x10, 0x32, 0x74, 0xff, 0x70, 0x5b, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x90, 0x63, 0xff, 0x39, 0xbe, 0x67, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0b, 0x16, 0x95, 0xc4, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x34, 0x74, 0xff, 0x54, 0x7c, 0xff, 0xfc, 0xde, 0x2b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x08, 0x74, 0x7c, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x12, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xf2, 0x73, 0xff, 0x5a, 0xce, 0x40, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xb8, 0xad, 0x7c, 0xf2, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0xd1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0x90, 0x5b, 0xff, 0xb1, 0x6b, 0xff, 0x15, 0x9d, 0xd4, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x57, 0x9d, 0xa3, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x13, 0x74, 0xff, 0x16, 0x9d, 0xbf, 0xdf, 0xff, 0x0f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xdc, 0xde, 0x2c, 0x98, 0xa5, 0x83, 0x33, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x6c, 0xff, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xfb, 0xd2, 0x6b, 0xff, 0x53, 0x84, 0xff, 0x3a, 0xc6, 0x47, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xbb, 0xd6, 0x30, 0x12, 0x74, 0xff, 0xb1, 0x63, 0xff, 0xd1, 0x6b, 0xfb, 0xd1, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0x90, 0x63, 0xfb, 0xd1, 0x6b, 0xff, 0xf5, 0x9c, 0xdc, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x57, 0x9d, 0xbb, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xfc, 0x75, 0x7c, 0xff, 0x74, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x34, 0x74, 0xff, 0x54, 0x7c, 0xff, 0x37, 0x9d, 0xa8, 0x7b, 0xc6, 0x3b, 0x5a, 0xc6, 0x34, 0x1a, 0xbe, 0x4f, 0x77, 0xa5, 0xac, 0xb5, 0x84, 0xff, 0x33, 0x74, 0xff, 0x13, 0x74, 0xfb, 0x13, 0x74, 0xfb, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x73, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xf7, 0xd2, 0x6b, 0xff, 0x53, 0x7c, 0xff, 0x36, 0x9d, 0xa8, 0xd8, 0xb5, 0x58, 0x94, 0x84, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xfb, 0xd1, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0x90, 0x63, 0xff, 0xd1, 0x73, 0xff, 0x35, 0xa5, 0xc7, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x1a, 0xbe, 0x7f, 0x95, 0x84, 0xff, 0x54, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x74, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xfb, 0x34, 0x74, 0xf7, 0x33, 0x74, 0xff, 0x34, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x33, 0x74, 0xff, 0x13, 0x6c, 0xff, 0x13, 0x74, 0xf7, 0x13, 0x74, 0xf7, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x73, 0xff, 0xf2, 0x73, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xfb, 0xd2, 0x6b, 0xf3, 0xb1, 0x63, 0xff, 0xd1, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0xd1, 0x6b, 0xf7, 0xd1, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xb1, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0x90, 0x63, 0xff, 0xd0, 0x73, 0xff, 0xbb, 0xd6, 0x3c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x08, 0x17, 0x95, 0xdb, 0x74, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x34, 0x74, 0xf7, 0x13, 0x74, 0xf3, 0x33, 0x74, 0xf0, 0x33, 0x74, 0xf3, 0x13, 0x74, 0xf7, 0x13, 0x74, 0xff, 0x33, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xf7, 0xb1, 0x6b, 0xf3, 0xd1, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb0, 0x63, 0xff, 0xb0, 0x73, 0xe4, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5d, 0xe7, 0x17, 0xf5, 0x94, 0x94, 0xfc, 0xde, 0x2f, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0x3d, 0xe7, 0x4b, 0xbf, 0xf7, 0x1c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfa, 0xb5, 0x88, 0x75, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x55, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x34, 0x74, 0xff, 0x33, 0x74, 0xff, 0x33, 0x74, 0xff, 0x33, 0x74, 0xff, 0x33, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb0, 0x63, 0xff, 0xd0, 0x73, 0xec, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x9e, 0xf7, 0x0f, 0x57, 0xa5, 0x87, 0xf2, 0x73, 0xe7, 0xb1, 0x63, 0xff, 0xf1, 0x6b, 0xff, 0x56, 0x9d, 0x93, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0x99, 0xad, 0xaf, 0x17, 0x95, 0xff, 0x38, 0x9d, 0xff, 0x1d, 0xe7, 0x30, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0x37, 0x9d, 0xd3, 0x75, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x34, 0x74, 0xff, 0x33, 0x74, 0xff, 0x33, 0x74, 0xff, 0x33, 0x74, 0xff, 0x33, 0x74, 0xff, 0x33, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0x90, 0x63, 0xff, 0xd1, 0x6b, 0xff, 0x56, 0xa5, 0x87, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xbf, 0xf7, 0x0b, 0xd5, 0x94, 0xf4, 0xd1, 0x6b, 0xff, 0x4f, 0x5b, 0xff, 0x70, 0x5b, 0xdc, 0x0e, 0x53, 0xff, 0xb0, 0x63, 0xff, 0xf5, 0x94, 0xb0, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x08, 0x58, 0x9d, 0xcc, 0xb6, 0x8c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0xb6, 0x8c, 0xff, 0x9b, 0xce, 0x4b, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0x98, 0xa5, 0x88, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x74, 0xff, 0x34, 0x74, 0xff, 0x34, 0x74, 0xff, 0x34, 0x74, 0xff, 0x33, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xf7, 0x90, 0x63, 0xff, 0x12, 0x74, 0xff, 0x36, 0x9d, 0x83, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x7e, 0xef, 0x0c, 0x53, 0x7c, 0xff, 0x90, 0x63, 0xff, 0x4f, 0x53, 0xfb, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xf7, 0x2f, 0x53, 0xff, 0x90, 0x63, 0xff, 0x94, 0x8c, 0xbf, 0xdf, 0xff, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x08, 0x78, 0xa5, 0xc8, 0xd6, 0x8c, 0xff, 0x96, 0x84, 0xff, 0x96, 0x84, 0xf8, 0x75, 0x84, 0xf8, 0x75, 0x7c, 0xff, 0xb6, 0x84, 0xff, 0xb9, 0xad, 0xbb, 0xbf, 0xf7, 0x18, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xf9, 0xb5, 0x78, 0xb6, 0x8c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xf8, 0x75, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x34, 0x74, 0xff, 0x33, 0x74, 0xff, 0x33, 0x74, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0x90, 0x63, 0xf7, 0x90, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xf2, 0x73, 0xff, 0x39, 0xbe, 0x6b, 0xfc, 0xde, 0x2c, 0xf1, 0x73, 0xf7, 0x90, 0x63, 0xff, 0x4f, 0x53, 0xff, 0x70, 0x5b, 0xfb, 0x90, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x6f, 0x5b, 0xf7, 0x0e, 0x53, 0xff, 0x90, 0x63, 0xff, 0x15, 0x9d, 0xa7, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xb9, 0xad, 0x9f, 0xd6, 0x8c, 0xff, 0x96, 0x84, 0xff, 0xb6, 0x84, 0xf8, 0xb6, 0x84, 0xff, 0x96, 0x84, 0xff, 0x96, 0x84, 0xf8, 0x75, 0x7c, 0xff, 0xb6, 0x84, 0xff, 0x58, 0xa5, 0xe7, 0x7e, 0xef, 0x20, 0xdf, 0xff, 0x07, 0xd9, 0xb5, 0x77, 0xb6, 0x8c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x84, 0xf8, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x55, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x2e, 0x53, 0xff, 0x6f, 0x5b, 0xff, 0xf2, 0x6b, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0x4f, 0x5b, 0xff, 0x2e, 0x53, 0xff, 0x4f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x90, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0x90, 0x63, 0xf7, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x12, 0x74, 0xff, 0x12, 0x74, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x70, 0x5b, 0xfb, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x53, 0xf7, 0x2f, 0x53, 0xff, 0x53, 0x7c, 0xe3, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x08, 0x17, 0x95, 0xd7, 0x96, 0x84, 0xff, 0x96, 0x84, 0xf8, 0xb6, 0x84, 0xff, 0x96, 0x84, 0xff, 0x96, 0x84, 0xff, 0x96, 0x84, 0xff, 0x96, 0x84, 0xfc, 0x75, 0x7c, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xf8, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x33, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0x90, 0x63, 0xff, 0x6f, 0x5b, 0xff, 0x2e, 0x53, 0xff, 0xed, 0x4a, 0xff, 0xed, 0x4a, 0xff, 0xed, 0x4a, 0xff, 0x2e, 0x53, 0xff, 0xd2, 0x6b, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0x90, 0x5b, 0xff, 0x0e, 0x4b, 0xff, 0xed, 0x4a, 0xff, 0xed, 0x4a, 0xff, 0x0e, 0x4b, 0xff, 0x2e, 0x53, 0xff, 0x4f, 0x53, 0xff, 0x6f, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x91, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xd1, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xfb, 0x4f, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xfb, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x53, 0xff, 0x6f, 0x5b, 0xff, 0x93, 0x8c, 0xb8, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0x17, 0x95, 0xc4, 0x75, 0x7c, 0xff, 0x96, 0x84, 0xfc, 0x96, 0x84, 0xff, 0x96, 0x84, 0xff, 0x96, 0x84, 0xff, 0x96, 0x84, 0xff, 0x96, 0x84, 0xff, 0x95, 0x84, 0xfc, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xfb, 0x75, 0x84, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x33, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0x90, 0x63, 0xff, 0x2f, 0x53, 0xff, 0x0d, 0x4b, 0xff, 0x0d, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0xed, 0x4a, 0xff, 0x2e, 0x53, 0xff, 0xd2, 0x6b, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0x90, 0x63, 0xff, 0x2e, 0x53, 0xff, 0xed, 0x4a, 0xff, 0xed, 0x4a, 0xff, 0x0d, 0x4b, 0xff, 0x0d, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x70, 0x5b, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x90, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x90, 0x6b, 0xff, 0x15, 0xa5, 0xbb, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3b, 0xc6, 0x6f, 0xb6, 0x84, 0xff, 0x75, 0x7c, 0xff, 0x96, 0x84, 0xfc, 0x96, 0x84, 0xff, 0x96, 0x84, 0xff, 0x96, 0x84, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x84, 0xff, 0x75, 0x84, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0xf2, 0x6b, 0xff, 0x70, 0x5b, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0xed, 0x4a, 0xff, 0x0d, 0x4b, 0xff, 0x0d, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0xed, 0x4a, 0xff, 0x2f, 0x53, 0xff, 0xd2, 0x6b, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0x90, 0x63, 0xff, 0x2e, 0x53, 0xff, 0xed, 0x4a, 0xff, 0xed, 0x4a, 0xff, 0xed, 0x4a, 0xff, 0xed, 0x4a, 0xff, 0x0d, 0x4b, 0xff, 0x0d, 0x4b, 0xff, 0x0e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x4f, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x90, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0xd0, 0x7b, 0xff, 0xfc, 0xe6, 0x28, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0b, 0xfa, 0xb5, 0x8f, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x96, 0x84, 0xfc, 0x96, 0x84, 0xff, 0x96, 0x84, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x95, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x95, 0x84, 0xff, 0x75, 0x7c, 0xff, 0x13, 0x74, 0xff, 0x91, 0x63, 0xff, 0x4f, 0x53, 0xff, 0x0e, 0x53, 0xff, 0xed, 0x4a, 0xff, 0xed, 0x4a, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0xed, 0x4a, 0xff, 0xed, 0x4a, 0xff, 0x0e, 0x53, 0xff, 0x4e, 0x63, 0xff, 0x8f, 0x6b, 0xff, 0xd2, 0x6b, 0xfb, 0x13, 0x74, 0xfb, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0xd2, 0x6b, 0xff, 0x2f, 0x5b, 0xfb, 0xcc, 0x4a, 0xff, 0xed, 0x52, 0xff, 0x6f, 0x5b, 0xff, 0x4e, 0x5b, 0xff, 0xed, 0x4a, 0xff, 0xcd, 0x42, 0xff, 0xed, 0x4a, 0xff, 0x0e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x90, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x6f, 0x6b, 0xff, 0xd4, 0x9c, 0xd3, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0b, 0xd9, 0xb5, 0x8f, 0x75, 0x84, 0xff, 0x75, 0x7c, 0xff, 0x96, 0x84, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x75, 0x84, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x54, 0x7c, 0xff, 0xf2, 0x6b, 0xff, 0x6f, 0x5b, 0xff, 0x0d, 0x4b, 0xff, 0xed, 0x4a, 0xff, 0x0d, 0x4b, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0x0d, 0x4b, 0xff, 0xed, 0x4a, 0xff, 0xed, 0x52, 0xff, 0x0e, 0x5b, 0xff, 0x8f, 0x6b, 0xff, 0x52, 0x84, 0xff, 0x15, 0x9d, 0x97, 0xdb, 0xde, 0x13, 0x39, 0xc6, 0x2b, 0x53, 0x7c, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0xb1, 0x6b, 0xfb, 0x0e, 0x5b, 0xff, 0x4e, 0x6b, 0xff, 0x55, 0xad, 0x63, 0xbb, 0xd6, 0x18, 0xbb, 0xd6, 0x14, 0xf8, 0xbd, 0x30, 0x73, 0x84, 0xff, 0xd1, 0x6b, 0xff, 0x2e, 0x53, 0xff, 0xee, 0x4a, 0xff, 0x0e, 0x53, 0xff, 0x2f, 0x53, 0xfb, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x90, 0x63, 0xff, 0xb1, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x5b, 0xfb, 0x2e, 0x5b, 0xff, 0xb0, 0x7b, 0xff, 0x1c, 0xe7, 0x1c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x13, 0xf7, 0x8c, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xfc, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x75, 0x7c, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x54, 0x7c, 0xff, 0xb1, 0x63, 0xff, 0x2e, 0x53, 0xff, 0x0d, 0x4b, 0xff, 0x0d, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xfb, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x4e, 0x63, 0xff, 0xd0, 0x73, 0xff, 0x52, 0x8c, 0xff, 0x7a, 0xd6, 0x28, 0x7e, 0xf7, 0x0f, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xf6, 0x94, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x91, 0x63, 0xff, 0x90, 0x6b, 0xff, 0x35, 0xa5, 0xb3, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x07, 0x7a, 0xce, 0x37, 0x73, 0x84, 0xff, 0xb0, 0x6b, 0xff, 0x4f, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x4f, 0x5b, 0xfb, 0x4f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x0e, 0x53, 0xff, 0x4f, 0x6b, 0xff, 0x35, 0xad, 0x9c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3d, 0xe7, 0x28, 0xf7, 0x94, 0xff, 0x95, 0x7c, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x33, 0x74, 0xff, 0x90, 0x63, 0xff, 0x0e, 0x53, 0xff, 0x0d, 0x4b, 0xff, 0x0d, 0x4b, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xfb, 0xee, 0x52, 0xff, 0x2e, 0x63, 0xff, 0xf0, 0x7b, 0xff, 0xd8, 0xbd, 0x54, 0x5d, 0xef, 0x0f, 0x9e, 0xf7, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x04, 0x16, 0x95, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x6c, 0xff, 0xb1, 0x63, 0xff, 0xd1, 0x73, 0xff, 0x5d, 0xef, 0x13, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x9e, 0xf7, 0x0c, 0x7e, 0xef, 0x0b, 0x97, 0xad, 0x4f, 0xb1, 0x6b, 0xff, 0x4f, 0x53, 0xff, 0x4f, 0x53, 0xff, 0x6f, 0x5b, 0xfb, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x2e, 0x53, 0xff, 0xf1, 0x7b, 0xff, 0x9e, 0xf7, 0x0f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0c, 0xf6, 0x94, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x75, 0x7c, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x33, 0x74, 0xff, 0x90, 0x5b, 0xff, 0x0e, 0x4b, 0xff, 0xed, 0x4a, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xfb, 0xed, 0x4a, 0xff, 0x2e, 0x5b, 0xff, 0xb0, 0x73, 0xff, 0xb7, 0xb5, 0x40, 0xbe, 0xf7, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x04, 0xf6, 0x94, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0xf3, 0x6b, 0xff, 0xf3, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xb1, 0x6b, 0xff, 0xd1, 0x73, 0xff, 0xdf, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x7e, 0xef, 0x08, 0x77, 0xad, 0x5f, 0xf1, 0x6b, 0xff, 0x2f, 0x53, 0xff, 0x4f, 0x5b, 0xff, 0x70, 0x5b, 0xfb, 0x70, 0x5b, 0xff, 0x70, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x12, 0x74, 0xff, 0x9e, 0xf7, 0x0f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xd9, 0xad, 0x9f, 0xb5, 0x84, 0xff, 0x75, 0x7c, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x13, 0x74, 0xff, 0x70, 0x5b, 0xff, 0x0e, 0x4b, 0xff, 0x0d, 0x4b, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xf7, 0x0d, 0x53, 0xff, 0x6f, 0x63, 0xff, 0x31, 0x8c, 0xff, 0x18, 0xc6, 0x44, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x04, 0x16, 0x95, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0x13, 0x6c, 0xff, 0x13, 0x6c, 0xff, 0xf2, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xf1, 0x73, 0xff, 0xbf, 0xf7, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xd8, 0xb5, 0x60, 0x32, 0x74, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x90, 0x63, 0xf7, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x53, 0xff, 0xb0, 0x63, 0xff, 0x15, 0x9d, 0xb3, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xbf, 0xf7, 0x18, 0xb6, 0x8c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xfc, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x33, 0x74, 0xff, 0x70, 0x5b, 0xff, 0x0d, 0x4b, 0xff, 0x0d, 0x4b, 0xff, 0x0e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x4b, 0xf4, 0x0e, 0x53, 0xff, 0x8f, 0x6b, 0xff, 0x35, 0xad, 0x88, 0xbe, 0xf7, 0x0f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x04, 0x16, 0x95, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0x13, 0x6c, 0xff, 0x13, 0x6c, 0xff, 0xf2, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xf1, 0x7b, 0xff, 0xbf, 0xf7, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5d, 0xef, 0x1f, 0x94, 0x84, 0xc0, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xf7, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x6f, 0x5b, 0xfb, 0x2f, 0x53, 0xff, 0x90, 0x63, 0xff, 0x9e, 0xf7, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0x9b, 0xce, 0x44, 0xf5, 0x94, 0x7c, 0x73, 0x84, 0x70, 0x32, 0x7c, 0x87, 0xdc, 0xde, 0x20, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0x37, 0x9d, 0xb0, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x34, 0x74, 0xff, 0x90, 0x5b, 0xff, 0x0e, 0x4b, 0xff, 0x0d, 0x4b, 0xff, 0x0e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xf4, 0xed, 0x52, 0xff, 0xf0, 0x7b, 0xff, 0xf8, 0xc5, 0x4f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x04, 0x16, 0x95, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x73, 0xff, 0xf2, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xf1, 0x7b, 0xff, 0xbf, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x36, 0x9d, 0x70, 0xf2, 0x6b, 0xff, 0x70, 0x5b, 0xff, 0xb1, 0x63, 0xf7, 0xd1, 0x63, 0xff, 0xd1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x4f, 0x53, 0xfb, 0x93, 0x84, 0xac, 0x77, 0xad, 0x80, 0x97, 0xad, 0x80, 0x36, 0x9d, 0x78, 0xb4, 0x8c, 0x9b, 0x11, 0x74, 0xff, 0x70, 0x63, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0x12, 0x74, 0xff, 0x9e, 0xf7, 0x13, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xef, 0x23, 0xf6, 0x94, 0xf3, 0x17, 0x95, 0xe8, 0x9b, 0xce, 0x64, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0xb9, 0xad, 0x94, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x95, 0x84, 0xfc, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x95, 0x84, 0xff, 0x54, 0x74, 0xff, 0xb0, 0x63, 0xff, 0x0e, 0x53, 0xff, 0xed, 0x4a, 0xff, 0x0e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0xed, 0x4a, 0xf4, 0x0d, 0x5b, 0xff, 0xf0, 0x83, 0xff, 0xf8, 0xc5, 0x54, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x04, 0x16, 0x95, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0x13, 0x6c, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xb1, 0x6b, 0xff, 0xf1, 0x7b, 0xff, 0xbf, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x77, 0xa5, 0x77, 0xf2, 0x73, 0xff, 0x91, 0x63, 0xff, 0xb1, 0x63, 0xf7, 0xd2, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0x91, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x5b, 0xfb, 0x4f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0xb0, 0x63, 0xff, 0xb0, 0x63, 0xff, 0x6f, 0x5b, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xf7, 0x2f, 0x53, 0xe7, 0x4f, 0x5b, 0xe8, 0x2e, 0x53, 0xe7, 0x4f, 0x5b, 0xff, 0x93, 0x84, 0xff, 0xdf, 0xff, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x10, 0xb6, 0x8c, 0xff, 0x54, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xe3, 0x95, 0x84, 0xcc, 0x17, 0x95, 0xcf, 0xd9, 0xb5, 0xac, 0x78, 0xa5, 0xd4, 0xd6, 0x8c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xf8, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0xd1, 0x63, 0xff, 0x0e, 0x53, 0xff, 0xed, 0x4a, 0xff, 0x0e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xf4, 0xed, 0x52, 0xff, 0xf1, 0x83, 0xff, 0x19, 0xce, 0x4f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x04, 0x16, 0x95, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xb1, 0x6b, 0xff, 0xf1, 0x7b, 0xff, 0xbf, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x57, 0xa5, 0x77, 0x12, 0x74, 0xff, 0xd1, 0x6b, 0xff, 0xd2, 0x6b, 0xf7, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0xed, 0x4a, 0xff, 0xd0, 0x6b, 0xff, 0x3d, 0xe7, 0x18, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xbc, 0xd6, 0x50, 0x95, 0x84, 0xff, 0x34, 0x74, 0xff, 0x54, 0x7c, 0xf8, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x75, 0x84, 0xff, 0xb5, 0x84, 0xff, 0x95, 0x84, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xf8, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x84, 0xff, 0x75, 0x7c, 0xff, 0xf2, 0x6b, 0xff, 0x2f, 0x53, 0xff, 0x0d, 0x4b, 0xff, 0x0e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x4b, 0xf8, 0x0d, 0x53, 0xff, 0xf0, 0x7b, 0xff, 0x39, 0xce, 0x50, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x04, 0xf6, 0x94, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xb1, 0x6b, 0xff, 0xf1, 0x7b, 0xff, 0xbf, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x57, 0xa5, 0x74, 0xf2, 0x73, 0xff, 0xd1, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0xee, 0x4a, 0xff, 0x4f, 0x53, 0xff, 0x97, 0xad, 0x88, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xbf, 0xf7, 0x10, 0xb5, 0x8c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x74, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x34, 0x74, 0xff, 0x70, 0x5b, 0xff, 0xed, 0x4a, 0xff, 0x0e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x4b, 0xfc, 0x0d, 0x53, 0xff, 0x8f, 0x73, 0xff, 0xf8, 0xc5, 0x57, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x04, 0x16, 0x95, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xb1, 0x6b, 0xff, 0xf1, 0x7b, 0xff, 0xbf, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xb5, 0x8c, 0xf3, 0xb2, 0x63, 0xff, 0xf2, 0x6b, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x73, 0xff, 0xd1, 0x6b, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x2f, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0xf1, 0x6b, 0xff, 0x9e, 0xf7, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x7e, 0xef, 0x1f, 0x34, 0x74, 0xff, 0x34, 0x74, 0xff, 0x54, 0x7c, 0xff, 0x74, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x55, 0x7c, 0xff, 0x74, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0xb1, 0x63, 0xff, 0x2e, 0x53, 0xff, 0x0d, 0x4b, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0xed, 0x4a, 0xff, 0x4e, 0x6b, 0xff, 0x35, 0xad, 0x87, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x04, 0xf6, 0x94, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xb1, 0x6b, 0xff, 0xf1, 0x73, 0xff, 0xbf, 0xf7, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfc, 0xde, 0x2f, 0x94, 0x84, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xfb, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0x91, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x2f, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x4f, 0x5b, 0xff, 0x7e, 0xef, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0x5a, 0xc6, 0x7b, 0x34, 0x74, 0xff, 0x34, 0x74, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x74, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x13, 0x74, 0xff, 0x2f, 0x53, 0xff, 0x0d, 0x4b, 0xff, 0x0e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0x2e, 0x63, 0xff, 0x72, 0x94, 0xff, 0xdf, 0xff, 0x0f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x04, 0x16, 0x95, 0xff, 0x13, 0x74, 0xff, 0xd2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xb1, 0x6b, 0xff, 0xf1, 0x73, 0xff, 0xbf, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5a, 0xc6, 0x44, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0x2e, 0x53, 0xff, 0x52, 0x84, 0xff, 0xbe, 0xf7, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0x3a, 0xc6, 0x78, 0x34, 0x74, 0xff, 0x34, 0x74, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x74, 0x7c, 0xff, 0x54, 0x74, 0xff, 0xb1, 0x63, 0xff, 0x0e, 0x53, 0xff, 0x0d, 0x4b, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x4b, 0xfc, 0x0e, 0x53, 0xff, 0x11, 0x84, 0xff, 0xfc, 0xe6, 0x37, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0x16, 0x95, 0xff, 0x13, 0x74, 0xff, 0xd2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xb1, 0x6b, 0xff, 0xf1, 0x73, 0xff, 0xdf, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0x16, 0x95, 0xfb, 0x33, 0x74, 0xff, 0x13, 0x74, 0xff, 0x33, 0x74, 0xff, 0x13, 0x74, 0xff, 0xb1, 0x63, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x2e, 0x5b, 0xff, 0x11, 0x7c, 0xff, 0x5a, 0xce, 0x4f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x08, 0x98, 0xa5, 0x93, 0x54, 0x7c, 0xff, 0x13, 0x74, 0xff, 0x34, 0x74, 0xff, 0x54, 0x7c, 0xfc, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x74, 0x7c, 0xff, 0xf2, 0x6b, 0xff, 0x4f, 0x5b, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x4e, 0x6b, 0xff, 0x18, 0xc6, 0x4b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3d, 0xe7, 0x20, 0x94, 0x84, 0xff, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0xf2, 0x73, 0xff, 0x5a, 0xc6, 0x37, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfc, 0xde, 0x2c, 0x74, 0x84, 0xff, 0xf3, 0x6b, 0xff, 0x34, 0x74, 0xff, 0x34, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2e, 0x53, 0xfb, 0xee, 0x52, 0xff, 0x4f, 0x63, 0xff, 0x93, 0x94, 0xac, 0xfc, 0xde, 0x28, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0xbc, 0xd6, 0x40, 0x37, 0x9d, 0xd8, 0x74, 0x7c, 0xff, 0x13, 0x74, 0xff, 0x34, 0x74, 0xff, 0x54, 0x7c, 0xfc, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0xb1, 0x63, 0xff, 0x0d, 0x4b, 0xff, 0x0e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x4b, 0xfc, 0x2e, 0x5b, 0xff, 0x11, 0x84, 0xff, 0xdf, 0xff, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x9e, 0xef, 0x10, 0x5a, 0xc6, 0x44, 0xd5, 0x94, 0xff, 0x13, 0x74, 0xff, 0xd2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xb1, 0x6b, 0xfb, 0xd2, 0x6b, 0xff, 0x73, 0x84, 0xff, 0x3a, 0xc6, 0x47, 0xff, 0xff, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0x78, 0xa5, 0xa7, 0x13, 0x74, 0xff, 0x34, 0x74, 0xff, 0x54, 0x7c, 0xff, 0x33, 0x74, 0xff, 0xb1, 0x63, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x4f, 0x53, 0xff, 0x0e, 0x53, 0xfb, 0xed, 0x52, 0xff, 0x8f, 0x73, 0xff, 0xf4, 0xa4, 0x83, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0b, 0xd9, 0xb5, 0x7f, 0x95, 0x84, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xf8, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x13, 0x74, 0xff, 0x70, 0x5b, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x6f, 0x6b, 0xff, 0x39, 0xce, 0x44, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x9b, 0xce, 0x2b, 0x94, 0x84, 0xff, 0x53, 0x7c, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xfb, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xf7, 0xd2, 0x6b, 0xff, 0x13, 0x74, 0xff, 0x94, 0x84, 0xff, 0xdc, 0xde, 0x1c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5d, 0xe7, 0x1b, 0xb5, 0x8c, 0xff, 0x34, 0x74, 0xff, 0x54, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0xf2, 0x6b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x2f, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x4f, 0x53, 0xff, 0xed, 0x52, 0xf4, 0x2d, 0x6b, 0xff, 0x14, 0xa5, 0x84, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0x9e, 0xf7, 0x17, 0xb9, 0xad, 0x78, 0x95, 0x84, 0xff, 0x33, 0x74, 0xf8, 0x34, 0x74, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0xd1, 0x6b, 0xff, 0x4f, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x5b, 0xff, 0x11, 0x84, 0xff, 0xbf, 0xff, 0x0f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5d, 0xef, 0x18, 0x77, 0xa5, 0x8c, 0x33, 0x74, 0xff, 0xd2, 0x63, 0xff, 0xd2, 0x6b, 0xf3, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd1, 0x6b, 0xfb, 0x91, 0x63, 0xf7, 0x91, 0x63, 0xff, 0xf2, 0x73, 0xff, 0x97, 0xad, 0x5b, 0x5d, 0xef, 0x14, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xf9, 0xb5, 0x6c, 0x34, 0x74, 0xff, 0x54, 0x7c, 0xff, 0x75, 0x84, 0xff, 0x13, 0x74, 0xff, 0x90, 0x63, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x2f, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x4f, 0x53, 0xf7, 0x0e, 0x53, 0xff, 0x52, 0x8c, 0x8b, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x9b, 0xce, 0x44, 0x95, 0x84, 0xff, 0x33, 0x74, 0xf3, 0x34, 0x74, 0xff, 0x34, 0x7c, 0xff, 0x34, 0x74, 0xff, 0x54, 0x7c, 0xff, 0x33, 0x74, 0xff, 0x90, 0x5b, 0xff, 0x0e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x4e, 0x63, 0xff, 0x35, 0xad, 0xb8, 0xff, 0xff, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5d, 0xe7, 0x1c, 0xb5, 0x8c, 0xff, 0xd1, 0x63, 0xff, 0x91, 0x63, 0xf7, 0xd2, 0x6b, 0xf7, 0xf2, 0x6b, 0xff, 0xf2, 0x73, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xb1, 0x63, 0xef, 0x70, 0x5b, 0xfb, 0xb1, 0x63, 0xff, 0xb4, 0x8c, 0xff, 0x5d, 0xef, 0x18, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x1d, 0xdf, 0x18, 0x54, 0x7c, 0xff, 0x55, 0x7c, 0xff, 0x95, 0x84, 0xff, 0x54, 0x7c, 0xff, 0xd2, 0x6b, 0xff, 0x4f, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x4f, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x4f, 0x53, 0xf0, 0x4f, 0x5b, 0xff, 0xd8, 0xbd, 0x37, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3a, 0xbe, 0x4c, 0x54, 0x7c, 0xff, 0x34, 0x74, 0xf3, 0x34, 0x74, 0xff, 0x34, 0x74, 0xff, 0x34, 0x74, 0xff, 0x54, 0x7c, 0xff, 0x13, 0x74, 0xff, 0x4f, 0x5b, 0xff, 0x0d, 0x4b, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0xd0, 0x7b, 0xff, 0x1c, 0xe7, 0x28, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x08, 0xd6, 0x8c, 0xe8, 0x91, 0x63, 0xff, 0x70, 0x5b, 0xe3, 0xb1, 0x6b, 0xff, 0x12, 0x74, 0xff, 0xf2, 0x73, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xfb, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0x91, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xd1, 0x6b, 0xff, 0xd1, 0x63, 0xf7, 0xb1, 0x63, 0xff, 0x90, 0x63, 0xff, 0x6f, 0x5b, 0xff, 0x4f, 0x5b, 0xdf, 0x90, 0x63, 0xff, 0xf5, 0x94, 0xb7, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5d, 0xe7, 0x13, 0xb6, 0x8c, 0xff, 0x75, 0x7c, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x13, 0x74, 0xff, 0x4f, 0x5b, 0xff, 0x2e, 0x53, 0xff, 0x4f, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xf7, 0x0e, 0x53, 0xff, 0xd4, 0x94, 0x90, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xf9, 0xb5, 0x4c, 0x13, 0x74, 0xff, 0x34, 0x74, 0xf3, 0x33, 0x74, 0xff, 0x34, 0x74, 0xff, 0x34, 0x74, 0xff, 0x33, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0x4f, 0x5b, 0xff, 0x0e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x5b, 0xff, 0xd4, 0x9c, 0xc7, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0x98, 0xad, 0x94, 0xf2, 0x6b, 0xff, 0x2f, 0x53, 0xf4, 0x6f, 0x5b, 0xff, 0xb4, 0x8c, 0xd8, 0x16, 0x9d, 0xcc, 0x74, 0x7c, 0xff, 0xd2, 0x6b, 0xff, 0x91, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xd1, 0x6b, 0xff, 0xb1, 0x6b, 0xff, 0x91, 0x63, 0xff, 0x91, 0x63, 0xff, 0xd1, 0x73, 0xff, 0xf1, 0x73, 0xeb, 0xd1, 0x6b, 0xcf, 0x6f, 0x5b, 0xfb, 0x4f, 0x53, 0xf7, 0xd1, 0x6b, 0xff, 0x3a, 0xc6, 0x4b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x7b, 0xce, 0x3c, 0x95, 0x84, 0xff, 0x75, 0x7c, 0xff, 0xb6, 0x84, 0xff, 0x54, 0x74, 0xff, 0x4f, 0x5b, 0xff, 0x2e, 0x53, 0xff, 0x4f, 0x53, 0xff, 0x4f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x4f, 0x53, 0xff, 0xed, 0x4a, 0xfb, 0x11, 0x7c, 0xff, 0x3d, 0xef, 0x1f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0x98, 0xa5, 0x78, 0xf3, 0x6b, 0xff, 0x33, 0x74, 0xf7, 0x33, 0x74, 0xff, 0x33, 0x74, 0xff, 0x33, 0x74, 0xff, 0x13, 0x74, 0xff, 0xb1, 0x63, 0xff, 0x4f, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x4e, 0x63, 0xff, 0x9a, 0xd6, 0x33, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x9b, 0xce, 0x3f, 0x33, 0x7c, 0xff, 0xb2, 0x63, 0xff, 0x6f, 0x5b, 0xff, 0x11, 0x74, 0xd4, 0xdf, 0xff, 0x04, 0xff, 0xff, 0x00, 0x9e, 0xf7, 0x0f, 0x73, 0x84, 0xff, 0x32, 0x7c, 0xff, 0x93, 0x84, 0xe8, 0xf4, 0x94, 0xaf, 0xd4, 0x94, 0xb4, 0x15, 0x9d, 0xb4, 0x36, 0x9d, 0xaf, 0xb5, 0x8c, 0xe7, 0x12, 0x74, 0xff, 0x32, 0x7c, 0xff, 0x15, 0x9d, 0xb3, 0xdf, 0xff, 0x03, 0xff, 0xff, 0x00, 0x73, 0x84, 0xcb, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x32, 0x74, 0xff, 0x1c, 0xdf, 0x23, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3d, 0xe7, 0x18, 0xb6, 0x8c, 0xff, 0x75, 0x7c, 0xff, 0xb6, 0x8c, 0xff, 0x75, 0x7c, 0xff, 0x90, 0x63, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x4f, 0x53, 0xff, 0x0e, 0x4b, 0xf7, 0xb0, 0x6b, 0xff, 0x5a, 0xce, 0x3c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x18, 0xf6, 0x94, 0xec, 0xd2, 0x6b, 0xff, 0x33, 0x74, 0xfc, 0x33, 0x74, 0xff, 0x33, 0x74, 0xff, 0x33, 0x74, 0xff, 0x13, 0x74, 0xff, 0x90, 0x63, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0xaf, 0x73, 0xff, 0x1c, 0xe7, 0x20, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x1d, 0xe7, 0x23, 0x94, 0x84, 0xff, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xf8, 0x91, 0x63, 0xff, 0x93, 0x84, 0xdc, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x9e, 0xf7, 0x14, 0x19, 0xbe, 0x78, 0xdf, 0xff, 0x0c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x0b, 0xf9, 0xbd, 0x77, 0xbb, 0xd6, 0x3b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xd5, 0x8c, 0xdf, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xf3, 0x90, 0x63, 0xff, 0xf5, 0x94, 0xcb, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xe7, 0x18, 0xf7, 0x8c, 0xff, 0x75, 0x7c, 0xff, 0xd7, 0x8c, 0xff, 0x95, 0x84, 0xff, 0xd2, 0x6b, 0xff, 0x4f, 0x5b, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x4f, 0x5b, 0xff, 0x52, 0x84, 0xff, 0xbb, 0xd6, 0x27, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xdf, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xdc, 0xd6, 0x4f, 0xb5, 0x8c, 0xff, 0xf3, 0x6b, 0xff, 0x33, 0x74, 0xff, 0x33, 0x74, 0xff, 0x33, 0x74, 0xff, 0x34, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0x70, 0x5b, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0xf1, 0x7b, 0xff, 0x5d, 0xef, 0x1b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5a, 0xc6, 0x3f, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xf4, 0xf2, 0x6b, 0xff, 0xb2, 0x63, 0xff, 0x53, 0x7c, 0xff, 0x5a, 0xc6, 0x60, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xb8, 0xb5, 0x88, 0x33, 0x74, 0xff, 0x90, 0x5b, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xf7, 0xd1, 0x6b, 0xff, 0x7a, 0xce, 0x30, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xbf, 0xf7, 0x0c, 0x17, 0x95, 0xff, 0x75, 0x7c, 0xff, 0xd6, 0x8c, 0xff, 0x96, 0x84, 0xff, 0x13, 0x74, 0xff, 0x70, 0x5b, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xf7, 0x4f, 0x53, 0xff, 0x4e, 0x53, 0xff, 0x4f, 0x53, 0xd4, 0x4f, 0x5b, 0xdc, 0x6f, 0x5b, 0xdf, 0x6f, 0x5b, 0xff, 0x32, 0x7c, 0xe7, 0x7e, 0xef, 0x0c, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x08, 0xdf, 0xff, 0x10, 0xdf, 0xff, 0x0b, 0x9e, 0xf7, 0x1b, 0xfc, 0xde, 0x50, 0xb8, 0xad, 0xb4, 0x95, 0x84, 0xff, 0x33, 0x74, 0xff, 0x13, 0x74, 0xff, 0x33, 0x74, 0xff, 0x33, 0x74, 0xff, 0x33, 0x74, 0xff, 0x33, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0x90, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x12, 0x84, 0xff, 0x9b, 0xd6, 0x43, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x04, 0xff, 0xff, 0x04, 0xff, 0xff, 0x04, 0xff, 0xff, 0x04, 0xff, 0xff, 0x04, 0xff, 0xff, 0x04, 0xff, 0xff, 0x04, 0xff, 0xff, 0x04, 0xff, 0xff, 0x03, 0xff, 0xff, 0x04, 0xdf, 0xff, 0x13, 0x77, 0xa5, 0x80, 0xd2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xfb, 0xb1, 0x63, 0xff, 0x12, 0x74, 0xff, 0x7e, 0xf7, 0x17, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x0b, 0x53, 0x7c, 0xff, 0x91, 0x63, 0xff, 0x90, 0x63, 0xfb, 0xb1, 0x63, 0xff, 0x90, 0x63, 0xfb, 0x50, 0x5b, 0xff, 0xd5, 0x94, 0xb0, 0xbe, 0xf7, 0x10, 0xff, 0xff, 0x03, 0xff, 0xff, 0x04, 0xdf, 0xff, 0x04, 0xdf, 0xff, 0x04, 0xdf, 0xff, 0x04, 0xdf, 0xff, 0x04, 0xdf, 0xff, 0x04, 0xdf, 0xff, 0x04, 0xdf, 0xff, 0x04, 0xdf, 0xff, 0x04, 0xdf, 0xff, 0x04, 0xdf, 0xff, 0x04, 0xff, 0xff, 0x03, 0xbc, 0xd6, 0x33, 0x95, 0x84, 0xff, 0x34, 0x74, 0xff, 0x75, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0xf2, 0x6b, 0xff, 0x70, 0x5b, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x4b, 0xf8, 0xed, 0x4a, 0xff, 0xed, 0x4a, 0xff, 0xed, 0x4a, 0xff, 0x0d, 0x4b, 0xff, 0xed, 0x4a, 0xff, 0x4e, 0x53, 0xff, 0xf1, 0x6b, 0xe3, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0x5e, 0xef, 0x20, 0x57, 0x9d, 0xdf, 0xf6, 0x94, 0xff, 0xd5, 0x8c, 0xff, 0x74, 0x84, 0xff, 0x53, 0x7c, 0xff, 0x33, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xfc, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x33, 0x74, 0xff, 0x13, 0x74, 0xff, 0xd2, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0x12, 0x74, 0xff, 0xb5, 0x8c, 0xff, 0xd9, 0xb5, 0x98, 0x7b, 0xce, 0x64, 0x3a, 0xbe, 0x80, 0x3a, 0xbe, 0x80, 0x19, 0xbe, 0x88, 0x19, 0xbe, 0x8b, 0x19, 0xbe, 0x88, 0x19, 0xbe, 0x88, 0x19, 0xbe, 0x87, 0x19, 0xbe, 0x88, 0x3a, 0xc6, 0x78, 0x98, 0xad, 0xaf, 0xb5, 0x8c, 0xff, 0x33, 0x74, 0xff, 0xf2, 0x6b, 0xfc, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0x70, 0x5b, 0xff, 0x90, 0x63, 0xff, 0x39, 0xbe, 0x6c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x9e, 0xf7, 0x14, 0x12, 0x74, 0xff, 0x70, 0x5b, 0xff, 0x90, 0x63, 0xff, 0xb1, 0x63, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xfb, 0xd1, 0x6b, 0xff, 0x73, 0x84, 0xff, 0xd5, 0x94, 0xff, 0xf5, 0x94, 0xff, 0xd5, 0x8c, 0xff, 0xd5, 0x8c, 0xff, 0xd4, 0x8c, 0xff, 0xd4, 0x8c, 0xff, 0xd4, 0x8c, 0xff, 0xd4, 0x8c, 0xff, 0xd4, 0x8c, 0xff, 0xd4, 0x8c, 0xff, 0xb4, 0x8c, 0xff, 0xb4, 0x8c, 0xff, 0xd4, 0x8c, 0xff, 0x53, 0x7c, 0xff, 0xb1, 0x63, 0xff, 0x91, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0xed, 0x4a, 0xfb, 0xcd, 0x42, 0xff, 0x0d, 0x4b, 0xff, 0xbf, 0xf7, 0x08,
-  0xdf, 0xff, 0x0f, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0xf3, 0x6b, 0xff, 0xf3, 0x6b, 0xff, 0x13, 0x74, 0xfc, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x33, 0x74, 0xff, 0x33, 0x74, 0xff, 0x33, 0x74, 0xff, 0x33, 0x74, 0xff, 0x13, 0x74, 0xfc, 0xf3, 0x6b, 0xff, 0xf3, 0x6b, 0xff, 0x13, 0x74, 0xff, 0x13, 0x6c, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xfc, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0x70, 0x5b, 0xff, 0x90, 0x63, 0xff, 0x1c, 0xe7, 0x37, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x95, 0x84, 0xb7, 0xb1, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xfb, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xfb, 0x2f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0xcd, 0x42, 0xff, 0x2e, 0x53, 0xec, 0xfc, 0xde, 0x3b,
-  0xfc, 0xde, 0x50, 0x13, 0x74, 0xff, 0xb2, 0x63, 0xff, 0xf2, 0x6b, 0xfc, 0xf2, 0x6b, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0x70, 0x5b, 0xff, 0xb0, 0x6b, 0xff, 0x5d, 0xef, 0x2c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x17, 0x95, 0xb3, 0xf2, 0x6b, 0xff, 0x70, 0x5b, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0xcd, 0x42, 0xff, 0x2e, 0x53, 0xfb, 0x97, 0xad, 0xaf,
-  0xdc, 0xde, 0x60, 0x33, 0x74, 0xf3, 0xd2, 0x6b, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0x70, 0x5b, 0xff, 0xd0, 0x73, 0xff, 0x7d, 0xef, 0x28, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x58, 0x9d, 0xb7, 0x13, 0x74, 0xff, 0x70, 0x5b, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0xcd, 0x4a, 0xfb, 0x0e, 0x53, 0xff, 0x52, 0x84, 0xff,
-  0x5d, 0xef, 0x3b, 0x33, 0x74, 0xec, 0xd2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0x13, 0x74, 0xff, 0x13, 0x6c, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0x70, 0x63, 0xff, 0xd1, 0x73, 0xff, 0x9e, 0xf7, 0x20, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x37, 0x9d, 0xb8, 0xf2, 0x6b, 0xff, 0x70, 0x5b, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0xcd, 0x42, 0xfb, 0xed, 0x4a, 0xff, 0x31, 0x84, 0xff,
-  0x5d, 0xe7, 0x3c, 0x13, 0x74, 0xec, 0xd2, 0x63, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x12, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x6c, 0xff, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x63, 0xff, 0xb2, 0x63, 0xff, 0xb2, 0x63, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0x90, 0x63, 0xff, 0xf1, 0x73, 0xff, 0x9e, 0xf7, 0x24, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xd6, 0x8c, 0xb3, 0xd2, 0x6b, 0xff, 0x70, 0x5b, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x50, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x53, 0xff, 0x4f, 0x53, 0xff, 0x4f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0d, 0x4b, 0xff, 0xed, 0x4a, 0xff, 0xed, 0x4a, 0xff, 0xed, 0x4a, 0xff, 0xcd, 0x4a, 0xff, 0x4e, 0x5b, 0xff, 0xb7, 0xb5, 0x8f,
-  0x7e, 0xef, 0x2c, 0xf2, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0xd2, 0x6b, 0xfc, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf3, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf3, 0x6b, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x12, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xfc, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x73, 0xff, 0xf2, 0x73, 0xff, 0x12, 0x6c, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xfc, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0x91, 0x63, 0xff, 0xf2, 0x73, 0xff, 0x3d, 0xe7, 0x38, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x0c, 0x54, 0x7c, 0xdc, 0x91, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x90, 0x5b, 0xff, 0x70, 0x5b, 0xfb, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x2f, 0x53, 0xfb, 0x2f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x4b, 0xfb, 0x0e, 0x4b, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x8f, 0x63, 0xff, 0x32, 0x84, 0xff, 0xdf, 0xff, 0x0b,
-  0xff, 0xff, 0x0b, 0x54, 0x7c, 0xf7, 0xd2, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0xd2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xf2, 0x6b, 0xfc, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x73, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0x90, 0x63, 0xff, 0x90, 0x5b, 0xff, 0x90, 0x5b, 0xff, 0x90, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x63, 0xff, 0xb0, 0x73, 0xff, 0x73, 0x84, 0xff, 0xd8, 0xb5, 0x93, 0xbb, 0xd6, 0x57, 0x9b, 0xce, 0x5b, 0x9b, 0xce, 0x5b, 0x9b, 0xce, 0x63, 0x9b, 0xce, 0x63, 0x9b, 0xd6, 0x5b, 0x9b, 0xce, 0x5c, 0x7b, 0xce, 0x64, 0xbb, 0xd6, 0x53, 0xd9, 0xb5, 0x90, 0xb4, 0x8c, 0xff, 0x12, 0x74, 0xff, 0xb1, 0x63, 0xfc, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0x91, 0x5b, 0xff, 0x12, 0x74, 0xff, 0x5a, 0xce, 0x73, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdc, 0xd6, 0x4c, 0xf2, 0x73, 0xff, 0x4f, 0x5b, 0xff, 0x90, 0x63, 0xfb, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x5b, 0xfb, 0x4f, 0x63, 0xff, 0xb0, 0x73, 0xff, 0x32, 0x84, 0xff, 0xb4, 0x8c, 0xff, 0x97, 0xad, 0x9f, 0xf8, 0xb5, 0x78, 0xb8, 0xb5, 0x84, 0xd8, 0xb5, 0x83, 0xd8, 0xb5, 0x83, 0xd8, 0xb5, 0x83, 0xd8, 0xb5, 0x83, 0xd8, 0xb5, 0x7f, 0xb7, 0xb5, 0x8b, 0xf5, 0x9c, 0xdf, 0x32, 0x7c, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0xcc, 0x4a, 0xf8, 0xed, 0x52, 0xff, 0x8f, 0x6b, 0xff, 0x72, 0x8c, 0xff, 0xf8, 0xbd, 0x60, 0x3d, 0xe7, 0x17, 0x7e, 0xef, 0x0c, 0xbf, 0xff, 0x08, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xbf, 0xf7, 0x17, 0xd8, 0xb5, 0xa0, 0xd5, 0x8c, 0xff, 0x94, 0x84, 0xff, 0x94, 0x84, 0xf8, 0x74, 0x84, 0xff, 0x53, 0x7c, 0xff, 0xf2, 0x73, 0xff, 0xf2, 0x6b, 0xf8, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0x13, 0x74, 0xff, 0xd1, 0x6b, 0xff, 0x4f, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x53, 0xff, 0x0d, 0x4b, 0xff, 0xcd, 0x4a, 0xff, 0x6f, 0x6b, 0xff, 0x76, 0xb5, 0x94, 0x9e, 0xf7, 0x1c, 0xff, 0xff, 0x04, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x04, 0xdf, 0xff, 0x10, 0x97, 0xad, 0x70, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xfc, 0xd2, 0x6b, 0xff, 0xd1, 0x6b, 0xfc, 0x91, 0x63, 0xff, 0x12, 0x7c, 0xff, 0xfc, 0xde, 0x4b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x0c, 0x33, 0x7c, 0xf8, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xfb, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xf7, 0x6f, 0x63, 0xff, 0xf0, 0x83, 0xff, 0x7a, 0xd6, 0x2b, 0xff, 0xff, 0x03, 0xdf, 0xff, 0x07, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0x5a, 0xce, 0x37, 0xf2, 0x73, 0xff, 0x91, 0x63, 0xff, 0xd1, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0x70, 0x63, 0xff, 0x4f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0xed, 0x4a, 0xff, 0xac, 0x52, 0xff, 0xd0, 0x7b, 0xff, 0x7a, 0xd6, 0x33, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0xff, 0xff, 0x0c, 0xdf, 0xff, 0x0b, 0xff, 0xff, 0x07, 0xbf, 0xff, 0x18, 0xf9, 0xbd, 0x90, 0x74, 0x84, 0xff, 0xf2, 0x73, 0xff, 0xd2, 0x6b, 0xf8, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0x4f, 0x5b, 0xff, 0x0e, 0x4b, 0xff, 0x0d, 0x4b, 0xff, 0xed, 0x4a, 0xff, 0xed, 0x4a, 0xff, 0x73, 0x8c, 0xff, 0xbe, 0xff, 0x23, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x7b, 0xce, 0x43, 0xf2, 0x73, 0xff, 0xb1, 0x63, 0xf7, 0xd1, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0xd1, 0x6b, 0xff, 0xf4, 0x9c, 0xb3, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfc, 0xde, 0x3b, 0x12, 0x74, 0xff, 0x4f, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xf8, 0x70, 0x63, 0xff, 0xf1, 0x7b, 0xff, 0x7a, 0xd6, 0x30, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5d, 0xe7, 0x14, 0x33, 0x7c, 0xff, 0x91, 0x63, 0xff, 0xf2, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0x90, 0x5b, 0xff, 0x4f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0xed, 0x4a, 0xff, 0x6e, 0x6b, 0xff, 0x18, 0xc6, 0x3f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xbb, 0xd6, 0x50, 0x74, 0x7c, 0xff, 0xb1, 0x63, 0xfc, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0x70, 0x5b, 0xff, 0x0e, 0x53, 0xff, 0x0d, 0x4b, 0xff, 0xed, 0x4a, 0xff, 0xed, 0x4a, 0xff, 0x52, 0x8c, 0xff, 0x7e, 0xf7, 0x20, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3d, 0xe7, 0x2f, 0xb4, 0x8c, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xf8, 0x70, 0x5b, 0xff, 0x12, 0x74, 0xff, 0x7e, 0xf7, 0x28, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0x39, 0xc6, 0x78, 0xf5, 0x94, 0xec, 0xdc, 0xd6, 0x40, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0x9f, 0xf7, 0x20, 0xd9, 0xb5, 0x9f, 0x7e, 0xef, 0x23, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xb4, 0x8c, 0xd8, 0x70, 0x5b, 0xff, 0x4f, 0x53, 0xfb, 0x4f, 0x5b, 0xff, 0xd1, 0x73, 0xff, 0x5a, 0xce, 0x33, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x1d, 0xe7, 0x18, 0x33, 0x74, 0xff, 0xb1, 0x63, 0xff, 0xf2, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0x6f, 0x5b, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0xed, 0x52, 0xfb, 0x11, 0x84, 0xff, 0x1c, 0xe7, 0x1f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x57, 0xa5, 0x7c, 0x91, 0x63, 0xff, 0xf2, 0x6b, 0xf7, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0x90, 0x63, 0xff, 0x2e, 0x53, 0xff, 0xed, 0x4a, 0xff, 0xed, 0x4a, 0xff, 0xed, 0x4a, 0xff, 0xd0, 0x73, 0xff, 0x1c, 0xe7, 0x2b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdc, 0xd6, 0x47, 0x12, 0x74, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x11, 0x74, 0xff, 0xbb, 0xd6, 0x58, 0xff, 0xff, 0x07, 0x3d, 0xe7, 0x2f, 0x33, 0x7c, 0xff, 0xd2, 0x6b, 0xff, 0x53, 0x7c, 0xff, 0x36, 0x9d, 0xbc, 0x36, 0x9d, 0xbf, 0x37, 0x9d, 0xc0, 0x57, 0x9d, 0xbc, 0xb5, 0x84, 0xfc, 0x13, 0x74, 0xff, 0x33, 0x7c, 0xff, 0x1c, 0xe7, 0x37, 0xff, 0xff, 0x03, 0xff, 0xff, 0x07, 0xf6, 0x94, 0xd8, 0xd2, 0x6b, 0xff, 0x2f, 0x53, 0xff, 0xd1, 0x6b, 0xff, 0x39, 0xc6, 0x47, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5a, 0xc6, 0x47, 0x13, 0x74, 0xff, 0xd2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xd1, 0x63, 0xff, 0x4f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0xed, 0x4a, 0xff, 0xed, 0x52, 0xff, 0x93, 0x94, 0xff, 0x9e, 0xf7, 0x13, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xf9, 0xb5, 0x48, 0xb1, 0x6b, 0xff, 0xf2, 0x6b, 0xf3, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0x2e, 0x53, 0xff, 0xed, 0x4a, 0xff, 0xed, 0x4a, 0xff, 0xed, 0x4a, 0xff, 0x8f, 0x63, 0xff, 0x1c, 0xe7, 0x24, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0x19, 0xbe, 0x68, 0xb1, 0x63, 0xff, 0x50, 0x5b, 0xff, 0xd1, 0x6b, 0xff, 0x74, 0x84, 0xff, 0xd5, 0x8c, 0xe8, 0x33, 0x74, 0xfc, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xf8, 0xb1, 0x63, 0xff, 0xd2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x12, 0x74, 0xff, 0xf5, 0x94, 0xdb, 0xf5, 0x8c, 0xd8, 0x74, 0x7c, 0xf8, 0xb1, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x97, 0xad, 0x80, 0xff, 0xff, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xef, 0x14, 0xd5, 0x8c, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0x2f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0xed, 0x4a, 0xfb, 0x4e, 0x63, 0xff, 0xf8, 0xbd, 0x54, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x19, 0xbe, 0x54, 0x12, 0x74, 0xff, 0xd2, 0x6b, 0xf3, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0x4f, 0x53, 0xff, 0xed, 0x4a, 0xff, 0x0d, 0x4b, 0xff, 0xed, 0x4a, 0xff, 0x2e, 0x53, 0xff, 0xdb, 0xd6, 0x2f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0x77, 0xa5, 0x8c, 0xb1, 0x63, 0xff, 0x91, 0x63, 0xe8, 0xd1, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0x90, 0x63, 0xfc, 0x90, 0x63, 0xfc, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x90, 0x5b, 0xff, 0x90, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xfc, 0x70, 0x5b, 0xfc, 0x70, 0x5b, 0xff, 0xb1, 0x63, 0xff, 0xd1, 0x6b, 0xff, 0x91, 0x63, 0xef, 0xb1, 0x63, 0xff, 0xb7, 0xad, 0x6c, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x1d, 0xdf, 0x13, 0x33, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0x91, 0x63, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0xcd, 0x4a, 0xf8, 0xb0, 0x6b, 0xff, 0xfc, 0xde, 0x23, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3d, 0xe7, 0x3f, 0xb4, 0x8c, 0xff, 0xb1, 0x63, 0xff, 0xd1, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0x6f, 0x5b, 0xff, 0x0e, 0x4b, 0xff, 0x0d, 0x4b, 0xff, 0xed, 0x4a, 0xff, 0xcd, 0x4a, 0xff, 0x35, 0x9d, 0xa0, 0xff, 0xff, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x17, 0x16, 0x95, 0xef, 0xd1, 0x6b, 0xff, 0x70, 0x5b, 0xfc, 0x90, 0x63, 0xf3, 0x90, 0x63, 0xff, 0xb0, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x50, 0x5b, 0xf4, 0x4f, 0x53, 0xf8, 0xb0, 0x63, 0xff, 0x15, 0x9d, 0xd8, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x9b, 0xce, 0x2b, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0x13, 0x74, 0xff, 0xd2, 0x6b, 0xff, 0x70, 0x5b, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0xed, 0x4a, 0xfb, 0x6f, 0x5b, 0xff, 0x96, 0xad, 0x6b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x7e, 0xef, 0x30, 0x94, 0x84, 0xff, 0xb1, 0x63, 0xff, 0xd1, 0x6b, 0xfc, 0xd2, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0x90, 0x63, 0xff, 0x2e, 0x53, 0xff, 0x0d, 0x4b, 0xff, 0xed, 0x4a, 0xff, 0xcd, 0x42, 0xff, 0xf1, 0x73, 0xff, 0xfc, 0xde, 0x3c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xbf, 0xf7, 0x20, 0xd8, 0xb5, 0x6c, 0x12, 0x74, 0xff, 0x90, 0x63, 0xff, 0x2f, 0x53, 0xfc, 0x70, 0x5b, 0xf8, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x5b, 0xff, 0x70, 0x5b, 0xf8, 0x4f, 0x5b, 0xff, 0x90, 0x63, 0xff, 0x97, 0xad, 0x77, 0xbe, 0xf7, 0x1b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x07, 0xf6, 0x94, 0xff, 0xf2, 0x6b, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0xb1, 0x63, 0xff, 0x4f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xfb, 0xd0, 0x6b, 0xff, 0x76, 0xa5, 0x53, 0x9e, 0xf7, 0x08, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0x7e, 0xef, 0x28, 0x36, 0x9d, 0x90, 0xf2, 0x6b, 0xff, 0xd1, 0x6b, 0xf8, 0xd1, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0x4f, 0x5b, 0xff, 0x0d, 0x4b, 0xff, 0xed, 0x4a, 0xff, 0xed, 0x4a, 0xff, 0x0e, 0x53, 0xff, 0xd4, 0x94, 0xec, 0xff, 0xff, 0x10, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x1d, 0xe7, 0x30, 0x16, 0x9d, 0xa4, 0x32, 0x7c, 0xff, 0xf2, 0x73, 0xff, 0x90, 0x63, 0xfc, 0x90, 0x63, 0xfc, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xf8, 0x6f, 0x5b, 0xff, 0xd1, 0x73, 0xff, 0x39, 0xc6, 0x48, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x9b, 0xce, 0x37, 0x54, 0x7c, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x90, 0x63, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xfb, 0x0d, 0x4b, 0xff, 0xed, 0x4a, 0xff, 0x8f, 0x63, 0xff, 0x76, 0xa5, 0x84, 0x7d, 0xef, 0x18, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x13, 0x77, 0xa5, 0x90, 0x53, 0x7c, 0xff, 0xd1, 0x6b, 0xff, 0xb1, 0x63, 0xfc, 0xd1, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0x70, 0x5b, 0xff, 0x0e, 0x4b, 0xff, 0x0d, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0xcd, 0x4a, 0xff, 0xf1, 0x6b, 0xff, 0xbf, 0xf7, 0x13, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x08, 0x3d, 0xe7, 0x34, 0xf9, 0xb5, 0x64, 0xd1, 0x6b, 0xff, 0x70, 0x5b, 0xff, 0x90, 0x5b, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x5b, 0xf8, 0x4f, 0x63, 0xff, 0xf1, 0x7b, 0xff, 0x5a, 0xce, 0x4b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x07, 0xf6, 0x94, 0xff, 0x13, 0x6c, 0xff, 0x33, 0x74, 0xff, 0x33, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0x70, 0x5b, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0xed, 0x4a, 0xfb, 0xcd, 0x42, 0xff, 0xed, 0x4a, 0xff, 0x4e, 0x53, 0xff, 0xf1, 0x6b, 0xff, 0x9e, 0xf7, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0x5a, 0xc6, 0x57, 0x94, 0x84, 0xff, 0xd2, 0x6b, 0xff, 0x70, 0x5b, 0xff, 0xb1, 0x63, 0xff, 0xd1, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0xd1, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0x90, 0x63, 0xff, 0x2f, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0xed, 0x4a, 0xff, 0x6f, 0x5b, 0xff, 0xf8, 0xb5, 0x64, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0b, 0x53, 0x7c, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x5b, 0xff, 0x4f, 0x5b, 0xfc, 0x2e, 0x5b, 0xff, 0x8f, 0x73, 0xff, 0x7a, 0xd6, 0x40, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x1a, 0xbe, 0x4c, 0x54, 0x7c, 0xff, 0x13, 0x74, 0xff, 0x54, 0x74, 0xff, 0x33, 0x74, 0xff, 0xb1, 0x63, 0xff, 0x2f, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0d, 0x4b, 0xff, 0xac, 0x42, 0xff, 0xcd, 0x42, 0xff, 0x97, 0xad, 0x5b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0x77, 0xa5, 0x87, 0xd1, 0x6b, 0xff, 0x70, 0x5b, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xfc, 0x2e, 0x53, 0xff, 0xf1, 0x73, 0xff, 0xbf, 0xf7, 0x14, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x10, 0xb4, 0x8c, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x2f, 0x5b, 0xff, 0x4f, 0x63, 0xff, 0xf4, 0xa4, 0xc4, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x07, 0x95, 0x84, 0xff, 0x34, 0x74, 0xff, 0x34, 0x74, 0xfb, 0x54, 0x7c, 0xff, 0x13, 0x74, 0xff, 0x70, 0x5b, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0xcd, 0x4a, 0xfb, 0xed, 0x4a, 0xff, 0x93, 0x8c, 0xff, 0xdf, 0xff, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x7e, 0xef, 0x1b, 0xd1, 0x6b, 0xff, 0x90, 0x63, 0xff, 0x91, 0x63, 0xfc, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0x90, 0x63, 0xff, 0x4f, 0x5b, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x76, 0xa5, 0x7b, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x13, 0x94, 0x84, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x2f, 0x5b, 0xff, 0x90, 0x6b, 0xff, 0x5d, 0xef, 0x27, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x19, 0xbe, 0x58, 0x54, 0x7c, 0xff, 0x34, 0x74, 0xff, 0x54, 0x7c, 0xff, 0x34, 0x74, 0xff, 0xd1, 0x63, 0xff, 0x2f, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0xed, 0x4a, 0xff, 0x0e, 0x4b, 0xff, 0x15, 0x9d, 0xd0, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x9e, 0xf7, 0x17, 0x32, 0x74, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0x90, 0x5b, 0xff, 0x4f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xfc, 0x2e, 0x53, 0xff, 0xb0, 0x63, 0xff, 0x97, 0xad, 0x7c, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x13, 0x94, 0x84, 0xff, 0x90, 0x63, 0xff, 0x50, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0xb0, 0x6b, 0xff, 0xdf, 0xff, 0x0c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x9b, 0xce, 0x4b, 0x95, 0x84, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xfb, 0x74, 0x7c, 0xff, 0x13, 0x74, 0xff, 0x4f, 0x5b, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0x0d, 0x4b, 0xff, 0x0d, 0x4b, 0xff, 0x0d, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0xed, 0x4a, 0xff, 0x2e, 0x5b, 0xff, 0x39, 0xc6, 0x58, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0x19, 0xbe, 0x84, 0xd1, 0x6b, 0xff, 0x70, 0x5b, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0x6f, 0x5b, 0xff, 0x2e, 0x53, 0xff, 0x4f, 0x53, 0xff, 0x2f, 0x53, 0xf8, 0x0e, 0x4b, 0xff, 0xf1, 0x73, 0xff, 0x19, 0xbe, 0x78, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x13, 0x94, 0x84, 0xff, 0x90, 0x63, 0xff, 0x4f, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0xb0, 0x6b, 0xff, 0xbf, 0xf7, 0x10, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x1d, 0xdf, 0x34, 0xf6, 0x8c, 0xff, 0x34, 0x74, 0xff, 0x75, 0x7c, 0xfb, 0x75, 0x84, 0xff, 0x34, 0x7c, 0xff, 0xb1, 0x63, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0xed, 0x4a, 0xfb, 0xcd, 0x42, 0xff, 0xcd, 0x42, 0xff, 0xcd, 0x42, 0xff, 0xed, 0x4a, 0xff, 0x0e, 0x4b, 0xff, 0xed, 0x4a, 0xfb, 0xed, 0x4a, 0xff, 0xb0, 0x73, 0xff, 0x5d, 0xef, 0x14, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5e, 0xef, 0x27, 0x12, 0x74, 0xff, 0x70, 0x5b, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0x70, 0x63, 0xff, 0x4f, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x4f, 0x5b, 0xff, 0x2f, 0x53, 0xf8, 0x4f, 0x5b, 0xff, 0x11, 0x74, 0xff, 0xff, 0xff, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x13, 0x94, 0x84, 0xff, 0x90, 0x63, 0xff, 0x4f, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0xb0, 0x6b, 0xff, 0xbf, 0xff, 0x10, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xf6, 0x8c, 0xec, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x95, 0x84, 0xff, 0x75, 0x7c, 0xff, 0xf2, 0x6b, 0xff, 0x4f, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0xed, 0x4a, 0xf8, 0xed, 0x4a, 0xff, 0x2e, 0x5b, 0xff, 0x90, 0x63, 0xff, 0xb0, 0x63, 0xff, 0x6f, 0x5b, 0xff, 0x0e, 0x53, 0xff, 0xed, 0x4a, 0xff, 0xcd, 0x42, 0xff, 0x4f, 0x5b, 0xff, 0x93, 0x94, 0xff, 0xdf, 0xff, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xbf, 0xff, 0x14, 0x94, 0x84, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xfc, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xfc, 0x70, 0x5b, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xf8, 0x90, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x53, 0xff, 0x4f, 0x5b, 0xff, 0xf5, 0x94, 0x93, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x13, 0x94, 0x84, 0xff, 0x90, 0x63, 0xff, 0x4f, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0xb0, 0x6b, 0xff, 0xbf, 0xff, 0x10, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0x78, 0xa5, 0x8c, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x95, 0x84, 0xff, 0x75, 0x84, 0xff, 0x33, 0x74, 0xff, 0x70, 0x5b, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0xcd, 0x4a, 0xff, 0xed, 0x5a, 0xff, 0x11, 0x84, 0xe8, 0x59, 0xce, 0x54, 0xfc, 0xde, 0x34, 0xd4, 0x94, 0xcb, 0xd0, 0x6b, 0xd7, 0x4e, 0x5b, 0xcb, 0x4e, 0x5b, 0xdc, 0x11, 0x7c, 0xf8, 0x5d, 0xef, 0x18, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5d, 0xef, 0x24, 0x12, 0x74, 0xff, 0x70, 0x5b, 0xff, 0x90, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xd1, 0x6b, 0xff, 0xf1, 0x73, 0xff, 0x32, 0x84, 0xe8, 0x93, 0x8c, 0xc7, 0xf1, 0x73, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xfc, 0x90, 0x63, 0xfc, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x6f, 0x5b, 0xf8, 0x4f, 0x5b, 0xff, 0x90, 0x63, 0xff, 0xd5, 0x94, 0xc8, 0xdf, 0xff, 0x20, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x13, 0x94, 0x84, 0xff, 0x90, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0xb0, 0x6b, 0xff, 0xbf, 0xff, 0x10, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xbf, 0xf7, 0x17, 0x58, 0x9d, 0xcf, 0x95, 0x84, 0xff, 0x95, 0x84, 0xff, 0x95, 0x84, 0xf7, 0x95, 0x84, 0xff, 0x34, 0x74, 0xff, 0x90, 0x5b, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0xed, 0x4a, 0xf8, 0x2e, 0x5b, 0xff, 0x72, 0x94, 0xab, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3d, 0xe7, 0x28, 0xd5, 0x8c, 0xbc, 0x16, 0x9d, 0x9b, 0x36, 0x9d, 0x98, 0x56, 0xa5, 0xa3, 0xb8, 0xb5, 0x93, 0x9e, 0xf7, 0x24, 0xff, 0xff, 0x0b, 0x19, 0xc6, 0x74, 0x73, 0x84, 0xf7, 0x90, 0x63, 0xf8, 0x70, 0x5b, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xf8, 0x4f, 0x5b, 0xff, 0x90, 0x63, 0xff, 0xb4, 0x8c, 0xd4, 0x7e, 0xef, 0x2b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x13, 0x94, 0x84, 0xff, 0x90, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0xb0, 0x6b, 0xff, 0xbf, 0xff, 0x13, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x0f, 0x58, 0x9d, 0xb0, 0x96, 0x84, 0xff, 0x95, 0x84, 0xff, 0x96, 0x84, 0xf7, 0xb6, 0x84, 0xff, 0x54, 0x7c, 0xff, 0xb1, 0x63, 0xff, 0x2e, 0x53, 0xff, 0x0d, 0x4b, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0x0d, 0x4b, 0xfb, 0xed, 0x52, 0xff, 0xf0, 0x7b, 0xff, 0xdb, 0xde, 0x37, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x7e, 0xef, 0x2c, 0xf2, 0x73, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xfc, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xfc, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x32, 0x7c, 0xff, 0xf9, 0xbd, 0x7f, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x13, 0x93, 0x84, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0xb0, 0x6b, 0xff, 0xbf, 0xff, 0x13, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xdc, 0xd6, 0x48, 0xf7, 0x8c, 0xff, 0x75, 0x7c, 0xff, 0x96, 0x84, 0xff, 0xb6, 0x84, 0xfb, 0xb6, 0x84, 0xff, 0x75, 0x7c, 0xff, 0xb1, 0x6b, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0xed, 0x4a, 0xff, 0x4e, 0x6b, 0xff, 0x96, 0xb5, 0x74, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0x77, 0xa5, 0x87, 0xd1, 0x6b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xfc, 0x90, 0x5b, 0xff, 0x90, 0x63, 0xff, 0x12, 0x74, 0xff, 0x97, 0xad, 0x7b, 0xff, 0xff, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x13, 0x93, 0x84, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x53, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x2f, 0x5b, 0xff, 0xb0, 0x6b, 0xff, 0xbf, 0xff, 0x13, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x13, 0xd9, 0xad, 0x93, 0xd6, 0x8c, 0xff, 0x96, 0x84, 0xff, 0x96, 0x84, 0xff, 0xb6, 0x84, 0xfb, 0xb6, 0x84, 0xff, 0x75, 0x7c, 0xff, 0xd1, 0x63, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0xed, 0x4a, 0xfb, 0xed, 0x52, 0xff, 0xf0, 0x83, 0xff, 0xdf, 0xff, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x08, 0xf5, 0x94, 0xc8, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0xb1, 0x63, 0xff, 0x90, 0x63, 0xf8, 0x70, 0x5b, 0xff, 0xf2, 0x6b, 0xff, 0x16, 0x9d, 0xcc, 0x1c, 0xdf, 0x38, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x13, 0x73, 0x84, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x53, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x2f, 0x5b, 0xff, 0xb0, 0x6b, 0xff, 0xbf, 0xf7, 0x13, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0xdc, 0xd6, 0x3f, 0x37, 0x9d, 0xf7, 0x96, 0x84, 0xff, 0x75, 0x7c, 0xff, 0x96, 0x84, 0xff, 0xb6, 0x8c, 0xff, 0xd7, 0x8c, 0xff, 0x75, 0x7c, 0xff, 0xb1, 0x63, 0xff, 0x2e, 0x53, 0xff, 0x0d, 0x4b, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0xcd, 0x4a, 0xff, 0x2e, 0x5b, 0xff, 0xd7, 0xbd, 0x73, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0xb7, 0xad, 0xa8, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x90, 0x5b, 0xff, 0x90, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xfc, 0xb1, 0x63, 0xff, 0x91, 0x63, 0xff, 0xd2, 0x6b, 0xff, 0x57, 0x9d, 0xac, 0x3d, 0xe7, 0x30, 0x7e, 0xef, 0x23, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x13, 0x93, 0x84, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x53, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x2e, 0x5b, 0xff, 0x90, 0x6b, 0xff, 0xdf, 0xff, 0x0f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0x7e, 0xef, 0x1f, 0x7e, 0xef, 0x23, 0xd9, 0xad, 0x87, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x95, 0x84, 0xff, 0xb6, 0x84, 0xfb, 0xb6, 0x84, 0xff, 0x96, 0x84, 0xff, 0x54, 0x7c, 0xff, 0xb1, 0x63, 0xff, 0x0e, 0x53, 0xff, 0x0d, 0x4b, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0xcd, 0x42, 0xff, 0x4f, 0x5b, 0xff, 0x59, 0xc6, 0x4f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xbf, 0xff, 0x20, 0x73, 0x84, 0xff, 0x4f, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x90, 0x63, 0xff, 0x90, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xd1, 0x6b, 0xff, 0xd1, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0x12, 0x74, 0xff, 0x74, 0x84, 0xff, 0x7a, 0xce, 0x57, 0xdf, 0xff, 0x1b, 0xff, 0xff, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x0f, 0x73, 0x84, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x53, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x90, 0x6b, 0xff, 0x9e, 0xf7, 0x1f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0x7e, 0xef, 0x28, 0x3a, 0xc6, 0x68, 0xb6, 0x8c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x95, 0x7c, 0xff, 0x96, 0x84, 0xff, 0xb6, 0x84, 0xff, 0x95, 0x84, 0xff, 0x33, 0x74, 0xff, 0x70, 0x5b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0xed, 0x4a, 0xff, 0x0e, 0x4b, 0xff, 0xf1, 0x6b, 0xff, 0x3d, 0xe7, 0x1c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0x56, 0xa5, 0x9f, 0x90, 0x63, 0xff, 0x4f, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x90, 0x5b, 0xff, 0x90, 0x63, 0xff, 0xb1, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0xd2, 0x6b, 0xff, 0x74, 0x7c, 0xff, 0xf6, 0x94, 0xff, 0xd9, 0xb5, 0x74, 0x9b, 0xce, 0x3b, 0x1d, 0xe7, 0x33, 0xff, 0xff, 0x13, 0xbe, 0xf7, 0x27, 0x32, 0x7c, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x90, 0x6b, 0xff, 0xd8, 0xb5, 0x97, 0x3d, 0xe7, 0x3b, 0x1d, 0xe7, 0x2c, 0xbb, 0xd6, 0x38, 0x78, 0xa5, 0xa3, 0xd6, 0x8c, 0xff, 0x75, 0x7c, 0xff, 0x34, 0x74, 0xff, 0x34, 0x74, 0xff, 0x75, 0x7c, 0xff, 0x95, 0x84, 0xff, 0x96, 0x84, 0xff, 0x95, 0x84, 0xff, 0x54, 0x7c, 0xff, 0xd1, 0x6b, 0xff, 0x6f, 0x5b, 0xff, 0x0e, 0x53, 0xff, 0x0d, 0x4b, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0xed, 0x4a, 0xf8, 0x0e, 0x4b, 0xff, 0x52, 0x7c, 0xff, 0x5d, 0xef, 0x1f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5a, 0xc6, 0x4c, 0x90, 0x63, 0xff, 0x2f, 0x53, 0xff, 0x70, 0x5b, 0xfc, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x90, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xd1, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x73, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0x13, 0x74, 0xff, 0x95, 0x84, 0xff, 0x98, 0xad, 0xc7, 0x77, 0xa5, 0xac, 0xb1, 0x63, 0xfc, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xfc, 0x90, 0x63, 0xfc, 0x53, 0x7c, 0xff, 0xd5, 0x8c, 0xff, 0x95, 0x84, 0xff, 0x13, 0x74, 0xff, 0xf3, 0x6b, 0xff, 0x13, 0x74, 0xff, 0x34, 0x74, 0xff, 0x54, 0x7c, 0xff, 0x75, 0x84, 0xff, 0x95, 0x84, 0xff, 0x75, 0x84, 0xff, 0x54, 0x7c, 0xff, 0xf2, 0x6b, 0xff, 0x90, 0x63, 0xff, 0x2e, 0x53, 0xff, 0x0d, 0x4b, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0d, 0x4b, 0xff, 0xcd, 0x42, 0xf8, 0x4e, 0x53, 0xff, 0xb3, 0x8c, 0xb3, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xbb, 0xd6, 0x4c, 0x32, 0x74, 0xff, 0x70, 0x5b, 0xff, 0x6f, 0x5b, 0xf8, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x90, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xd2, 0x6b, 0xff, 0x12, 0x6c, 0xff, 0x13, 0x74, 0xff, 0x33, 0x74, 0xff, 0x33, 0x74, 0xff, 0x33, 0x74, 0xff, 0x33, 0x74, 0xff, 0x33, 0x74, 0xff, 0x34, 0x74, 0xff, 0x13, 0x6c, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x53, 0xfc, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x4f, 0x5b, 0xff, 0x91, 0x63, 0xff, 0xf2, 0x6b, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x33, 0x74, 0xff, 0x34, 0x74, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x34, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0x4f, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0d, 0x4b, 0xff, 0xac, 0x42, 0xff, 0xd0, 0x6b, 0xbb, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0xb4, 0x8c, 0xe8, 0x70, 0x5b, 0xff, 0x4f, 0x5b, 0xf8, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x90, 0x63, 0xff, 0xd1, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0x13, 0x74, 0xff, 0x33, 0x74, 0xff, 0x33, 0x74, 0xff, 0x34, 0x74, 0xff, 0x34, 0x74, 0xff, 0x54, 0x7c, 0xff, 0x13, 0x74, 0xff, 0x90, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x4f, 0x5b, 0xff, 0x91, 0x63, 0xff, 0xf2, 0x6b, 0xff, 0x13, 0x74, 0xff, 0x13, 0x74, 0xff, 0x33, 0x74, 0xff, 0x34, 0x74, 0xff, 0x34, 0x74, 0xff, 0x34, 0x74, 0xff, 0x13, 0x74, 0xff, 0xd2, 0x6b, 0xff, 0x70, 0x5b, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0xed, 0x4a, 0xfb, 0xed, 0x4a, 0xff, 0xed, 0x4a, 0xff, 0xed, 0x4a, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0d, 0x4b, 0xff, 0x8c, 0x3a, 0xff, 0x90, 0x63, 0xff, 0x1c, 0xdf, 0x40, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0c, 0x32, 0x7c, 0xef, 0x2f, 0x53, 0xff, 0x4f, 0x53, 0xfc, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x53, 0xff, 0x4f, 0x53, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x90, 0x5b, 0xff, 0x90, 0x63, 0xff, 0xd1, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0x13, 0x74, 0xff, 0x54, 0x7c, 0xff, 0x75, 0x7c, 0xff, 0x54, 0x7c, 0xff, 0x90, 0x63, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x4f, 0x5b, 0xff, 0x91, 0x63, 0xff, 0x13, 0x74, 0xff, 0x33, 0x74, 0xff, 0x13, 0x74, 0xff, 0xf2, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xb1, 0x63, 0xff, 0x90, 0x63, 0xff, 0x6f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0xed, 0x4a, 0xfb, 0xed, 0x52, 0xff, 0x2e, 0x5b, 0xff, 0x0e, 0x53, 0xff, 0xed, 0x42, 0xff, 0xed, 0x4a, 0xf8, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0xed, 0x4a, 0xf8, 0xed, 0x4a, 0xff, 0xf1, 0x73, 0xe3, 0xdf, 0xff, 0x0c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xd4, 0x8c, 0xd3, 0x70, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x4f, 0x5b, 0xf8, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xfc, 0x2f, 0x53, 0xfc, 0x2e, 0x5b, 0xff, 0x6f, 0x63, 0xff, 0x90, 0x63, 0xff, 0x4f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x4f, 0x5b, 0xf8, 0x6f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x6f, 0x5b, 0xff, 0x90, 0x63, 0xff, 0xb1, 0x63, 0xff, 0xd1, 0x6b, 0xff, 0xf2, 0x6b, 0xff, 0xd2, 0x6b, 0xff, 0x70, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x70, 0x5b, 0xff, 0xb1, 0x63, 0xff, 0xb1, 0x63, 0xff, 0x90, 0x63, 0xff, 0x90, 0x5b, 0xff, 0x70, 0x5b, 0xff, 0x4f, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0xed, 0x4a, 0xf8, 0xed, 0x4a, 0xff, 0x2e, 0x63, 0xff, 0xd0, 0x7b, 0xff, 0x97, 0xb5, 0x8b, 0x18, 0xbe, 0x73, 0x11, 0x74, 0xff, 0x0e, 0x4b, 0xff, 0xcd, 0x42, 0xff, 0x0e, 0x4b, 0xfb, 0x0e, 0x4b, 0xff, 0xed, 0x4a, 0xf8, 0xcd, 0x42, 0xff, 0xb0, 0x6b, 0xff, 0x56, 0xad, 0x8b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xbf, 0xf7, 0x1b, 0x32, 0x7c, 0xeb, 0x70, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x4f, 0x5b, 0xfc, 0x6f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x2f, 0x53, 0xfc, 0x2f, 0x53, 0xff, 0x6f, 0x63, 0xff, 0xb0, 0x7b, 0xff, 0x72, 0x94, 0xdc, 0xb4, 0x8c, 0xd3, 0x12, 0x74, 0xe3, 0xb0, 0x63, 0xff, 0x4f, 0x5b, 0xff, 0x2f, 0x53, 0xfc, 0x4f, 0x5b, 0xfc, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x53, 0xff, 0x4f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0xed, 0x4a, 0xf7, 0xed, 0x52, 0xff, 0x4e, 0x63, 0xff, 0x52, 0x8c, 0xfc, 0x9a, 0xd6, 0x4f, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xfc, 0xde, 0x38, 0x32, 0x7c, 0xff, 0x2e, 0x53, 0xff, 0xed, 0x4a, 0xff, 0xcd, 0x42, 0xff, 0x0d, 0x4b, 0xff, 0xb0, 0x6b, 0xff, 0xf4, 0x9c, 0xbc, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x10, 0x32, 0x7c, 0xe7, 0x90, 0x63, 0xff, 0x0e, 0x53, 0xff, 0x2f, 0x53, 0xf8, 0x2f, 0x53, 0xff, 0x6f, 0x5b, 0xff, 0xd0, 0x73, 0xff, 0x52, 0x8c, 0xe8, 0xdb, 0xde, 0x43, 0xff, 0xff, 0x08, 0xff, 0xff, 0x03, 0xff, 0xff, 0x0c, 0x97, 0xad, 0x93, 0xf1, 0x73, 0xff, 0x2e, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0xed, 0x4a, 0xf8, 0xcc, 0x52, 0xff, 0x6f, 0x73, 0xff, 0x76, 0xb5, 0x73, 0xff, 0xff, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x10, 0x97, 0xad, 0x67, 0x2e, 0x53, 0xf7, 0x2e, 0x53, 0xd8, 0xb0, 0x6b, 0xe7, 0xb7, 0xb5, 0x8b, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x0f, 0xd4, 0x94, 0xd0, 0xb0, 0x63, 0xff, 0x4f, 0x5b, 0xff, 0xd1, 0x6b, 0xff, 0x73, 0x84, 0xf7, 0xdb, 0xde, 0x4f, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5d, 0xef, 0x37, 0x53, 0x7c, 0xff, 0x4f, 0x5b, 0xff, 0x2e, 0x53, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0xcc, 0x4a, 0xff, 0x4e, 0x6b, 0xff, 0x96, 0xb5, 0x7b, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0c, 0xdf, 0xff, 0x0f, 0xff, 0xff, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x13, 0x77, 0xa5, 0x9b, 0xf5, 0x94, 0xa0, 0xb7, 0xb5, 0x90, 0xbf, 0xf7, 0x1f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0x56, 0xa5, 0xdc, 0x90, 0x63, 0xff, 0x0e, 0x4b, 0xff, 0x2f, 0x53, 0xff, 0x4f, 0x5b, 0xff, 0x4f, 0x5b, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0d, 0x4b, 0xff, 0xed, 0x52, 0xff, 0x11, 0x7c, 0xc7, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x08, 0xf5, 0x94, 0xe7, 0x90, 0x63, 0xff, 0x0e, 0x4b, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0xed, 0x4a, 0xfc, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0xed, 0x4a, 0xff, 0x0e, 0x53, 0xff, 0x72, 0x84, 0xa7, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x0c, 0xf1, 0x73, 0xef, 0x4f, 0x5b, 0xff, 0x0e, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xf8, 0x2e, 0x53, 0xf8, 0x2e, 0x53, 0xf8, 0x2e, 0x53, 0xfc, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xf8, 0x0d, 0x4b, 0xf8, 0xed, 0x4a, 0xf7, 0xed, 0x4a, 0xff, 0xed, 0x4a, 0xff, 0xed, 0x4a, 0xfc, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0xed, 0x4a, 0xff, 0x0d, 0x4b, 0xff, 0x32, 0x7c, 0xa7, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x10, 0x4f, 0x5b, 0xf0, 0x2e, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x4f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x4f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0xee, 0x52, 0xf8, 0xed, 0x52, 0xff, 0x4f, 0x63, 0xff, 0xb0, 0x6b, 0xff, 0x90, 0x63, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xfc, 0x2e, 0x53, 0xfc, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0xed, 0x4a, 0xf8, 0xed, 0x4a, 0xff, 0x2e, 0x5b, 0xff, 0x8f, 0x6b, 0xff, 0xd0, 0x73, 0xff, 0x52, 0x84, 0xff, 0x72, 0x84, 0xff, 0x6f, 0x63, 0xff, 0xcd, 0x42, 0xfc, 0x0e, 0x4b, 0xfc, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0xed, 0x4a, 0xff, 0xcd, 0x42, 0xff, 0xf1, 0x6b, 0xcf, 0xdf, 0xff, 0x17, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x9b, 0xce, 0x53, 0x4f, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x4f, 0x53, 0xff, 0x4f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x0e, 0x53, 0xfc, 0xed, 0x5a, 0xff, 0xb0, 0x7b, 0xff, 0xb7, 0xb5, 0x67, 0xbb, 0xd6, 0x3b, 0x5a, 0xc6, 0x50, 0xf5, 0x94, 0xaf, 0x6f, 0x5b, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0xcd, 0x4a, 0xf8, 0x2e, 0x5b, 0xff, 0xd0, 0x73, 0xff, 0xd8, 0xbd, 0x58, 0x9a, 0xd6, 0x40, 0x7a, 0xd6, 0x4f, 0x1c, 0xe7, 0x3f, 0x9e, 0xf7, 0x2f, 0x15, 0x9d, 0x7f, 0x0d, 0x4b, 0xff, 0xed, 0x4a, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0d, 0x4b, 0xff, 0xcd, 0x42, 0xff, 0x90, 0x63, 0xff, 0x19, 0xbe, 0x7b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x08, 0xd4, 0x8c, 0xff, 0x2e, 0x53, 0xff, 0xee, 0x4a, 0xf8, 0x2f, 0x53, 0xff, 0x2f, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xfc, 0x0e, 0x53, 0xff, 0x8f, 0x73, 0xff, 0x59, 0xce, 0x58, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xbe, 0xf7, 0x24, 0xd0, 0x6b, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0xed, 0x4a, 0xff, 0xcd, 0x52, 0xff, 0xd0, 0x7b, 0xff, 0xdb, 0xde, 0x47, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x7e, 0xef, 0x28, 0x11, 0x74, 0xff, 0xed, 0x4a, 0xff, 0xed, 0x4a, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xff, 0xed, 0x4a, 0xff, 0xcd, 0x42, 0xfb, 0x4f, 0x5b, 0xff, 0xb3, 0x94, 0xc3, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0x56, 0xa5, 0xc0, 0x2e, 0x53, 0xff, 0xcd, 0x4a, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x2e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0x6f, 0x63, 0xff, 0x56, 0xad, 0xa0, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0c, 0x11, 0x74, 0xf8, 0x4e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0xed, 0x4a, 0xff, 0x2e, 0x63, 0xff, 0xf4, 0xa4, 0xcf, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x08, 0x97, 0xad, 0x83, 0x0e, 0x53, 0xff, 0xcd, 0x42, 0xff, 0x0e, 0x4b, 0xff, 0x0d, 0x4b, 0xff, 0xed, 0x4a, 0xff, 0xcd, 0x42, 0xff, 0xcd, 0x42, 0xff, 0xb0, 0x6b, 0xff, 0x9b, 0xd6, 0x54, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x9e, 0xf7, 0x28, 0x32, 0x7c, 0xff, 0x6f, 0x5b, 0xff, 0xee, 0x4a, 0xff, 0xed, 0x4a, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x4b, 0xfc, 0xee, 0x4a, 0xff, 0x2e, 0x5b, 0xff, 0x31, 0x84, 0xff, 0x9e, 0xf7, 0x28, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x10, 0x93, 0x84, 0xff, 0x4f, 0x5b, 0xff, 0xed, 0x4a, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0xed, 0x4a, 0xff, 0x6f, 0x63, 0xff, 0xdb, 0xde, 0x53, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x5d, 0xef, 0x2f, 0x11, 0x74, 0xff, 0xcd, 0x42, 0xff, 0xac, 0x42, 0xff, 0xcd, 0x42, 0xff, 0x0d, 0x53, 0xff, 0x4e, 0x5b, 0xff, 0xf1, 0x73, 0xff, 0x59, 0xc6, 0x68, 0xff, 0xff, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x9e, 0xf7, 0x23, 0xd8, 0xb5, 0x94, 0x52, 0x7c, 0xff, 0xd0, 0x6b, 0xff, 0x6f, 0x5b, 0xff, 0x2e, 0x53, 0xff, 0x6f, 0x5b, 0xff, 0x52, 0x84, 0xff, 0x9a, 0xd6, 0x50, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x13, 0xf5, 0x94, 0xff, 0x6f, 0x5b, 0xff, 0xcd, 0x4a, 0xfc, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x53, 0xff, 0x0e, 0x4b, 0xff, 0x0e, 0x53, 0xff, 0x6f, 0x6b, 0xff, 0xbf, 0xff, 0x17, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x08, 0x7a, 0xce, 0x68, 0x52, 0x7c, 0xff, 0xb0, 0x63, 0xff, 0x11, 0x74, 0xff, 0xb3, 0x8c, 0xff, 0x39, 0xc6, 0x6b, 0x9e, 0xf7, 0x24, 0xff, 0xff, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0b, 0xdf, 0xff, 0x17, 0x3d, 0xe7, 0x38, 0xf4, 0x94, 0xeb, 0x11, 0x74, 0xff, 0xf8, 0xb5, 0x63, 0xdf, 0xff, 0x17, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0x15, 0x9d, 0xef, 0x4f, 0x5b, 0xff, 0xac, 0x42, 0xff, 0xed, 0x4a, 0xff, 0xed, 0x4a, 0xff, 0xed, 0x4a, 0xff, 0x0d, 0x4b, 0xff, 0xed, 0x42, 0xfc, 0x0e, 0x53, 0xff, 0xd0, 0x73, 0xff, 0xdf, 0xff, 0x10, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0xbf, 0xff, 0x1f, 0xbe, 0xf7, 0x1f, 0xbf, 0xf7, 0x1f, 0xdf, 0xff, 0x1c, 0xff, 0xff, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x13, 0xbe, 0xf7, 0x1b, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x3d, 0xe7, 0x2f, 0x8f, 0x5b, 0xff, 0xcd, 0x42, 0xff, 0xed, 0x4a, 0xff, 0xed, 0x4a, 0xff, 0xed, 0x4a, 0xff, 0xed, 0x4a, 0xff, 0xcd, 0x42, 0xff, 0x4e, 0x5b, 0xff, 0x93, 0x8c, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0b, 0x76, 0xa5, 0xb8, 0x11, 0x74, 0xff, 0xf1, 0x73, 0xe7, 0x11, 0x74, 0xe3, 0xf1, 0x73, 0xe4, 0xf1, 0x73, 0xe7, 0xd0, 0x6b, 0xff, 0x72, 0x84, 0xf7, 0x7e, 0xef, 0x28, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x08, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x10, 0xdf, 0xff, 0x18, 0xdf, 0xff, 0x13, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
-  /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x08, 0x94, 0xf6, 0xff, 0x73, 0xf3, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x63, 0xb1, 0xff, 0x74, 0x33, 0xff, 0xc6, 0x5a, 0x6c, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xf7, 0x9e, 0x10, 0x7c, 0x54, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x84, 0x74, 0xff, 0xff, 0xdf, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x0c, 0xf7, 0x9f, 0x0f, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0x1d, 0x38, 0x74, 0x33, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xf2, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x63, 0xb1, 0xff, 0x74, 0x13, 0xff, 0xff, 0xdf, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xbe, 0x19, 0x53, 0x9d, 0x16, 0xff, 0xde, 0xdc, 0x28, 0xff, 0xdf, 0x07, 0xff, 0xdf, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xff, 0xdf, 0x0c, 0xdf, 0x1d, 0x2b, 0x8c, 0xd6, 0xff, 0x74, 0x34, 0xff, 0x9d, 0x57, 0xa4, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xd6, 0xdc, 0x4b, 0x7c, 0x54, 0xff, 0x6b, 0xd2, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xff, 0x74, 0x13, 0xff, 0xde, 0xdc, 0x2c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xbd, 0xf9, 0x50, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0x90, 0xff, 0x74, 0x12, 0xff, 0x8c, 0xd5, 0xff, 0xde, 0xfc, 0x28, 0xff, 0xdf, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0c, 0xbe, 0x1a, 0x8c, 0x8c, 0xd6, 0xff, 0x84, 0x95, 0xff, 0x7c, 0x54, 0xff, 0x74, 0x33, 0xff, 0x7c, 0x54, 0xff, 0xad, 0x98, 0x98, 0xff, 0xff, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0xb5, 0xd8, 0xab, 0x7c, 0x53, 0xff, 0x6b, 0xf2, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf3, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xfb, 0x73, 0xf2, 0xff, 0x8c, 0x94, 0xff, 0xff, 0xdf, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xe7, 0x5d, 0x20, 0x7c, 0x73, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xfb, 0x63, 0x90, 0xff, 0x63, 0xb1, 0xff, 0x6b, 0xd1, 0xff, 0x74, 0x12, 0xff, 0x84, 0x73, 0xff, 0xff, 0xdf, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xad, 0xb9, 0xb3, 0x7c, 0x75, 0xff, 0x74, 0x14, 0xff, 0x74, 0x34, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xfc, 0x74, 0x13, 0xff, 0x84, 0x75, 0xff, 0xef, 0x5e, 0x1b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x04, 0x94, 0xf6, 0xff, 0x74, 0x33, 0xff, 0x6b, 0xf2, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf3, 0xff, 0x6b, 0xf3, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x7c, 0x12, 0xff, 0xff, 0xdf, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0x9d, 0x16, 0xd7, 0x6b, 0xd1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0x90, 0xfb, 0x5b, 0x70, 0xff, 0x5b, 0x4f, 0xff, 0x63, 0x90, 0xff, 0xef, 0x5d, 0x23, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xf7, 0xbf, 0x24, 0x8c, 0xd6, 0xff, 0x74, 0x34, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x74, 0x34, 0xff, 0x7c, 0x54, 0xff, 0xad, 0x98, 0x6b, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0x84, 0x95, 0xff, 0x74, 0x33, 0xff, 0x6b, 0xf2, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x73, 0xf3, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x73, 0xf2, 0xfb, 0xff, 0xdf, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xf7, 0x9e, 0x10, 0x74, 0x32, 0xff, 0x5b, 0x70, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x5b, 0x70, 0xff, 0x63, 0x90, 0xff, 0xbe, 0x39, 0x67, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0b, 0x95, 0x16, 0xc4, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x74, 0x34, 0xff, 0x7c, 0x54, 0xff, 0xde, 0xfc, 0x2b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x08, 0x7c, 0x74, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x12, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xff, 0x73, 0xf2, 0xff, 0xce, 0x5a, 0x40, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xad, 0xb8, 0x7c, 0x6b, 0xf2, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xd1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x5b, 0x90, 0xff, 0x6b, 0xb1, 0xff, 0x9d, 0x15, 0xd4, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x9d, 0x57, 0xa3, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x74, 0x13, 0xff, 0x9d, 0x16, 0xbf, 0xff, 0xdf, 0x0f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xde, 0xdc, 0x2c, 0xa5, 0x98, 0x83, 0x74, 0x33, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x6c, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xfb, 0x6b, 0xd2, 0xff, 0x84, 0x53, 0xff, 0xc6, 0x3a, 0x47, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xd6, 0xbb, 0x30, 0x74, 0x12, 0xff, 0x63, 0xb1, 0xff, 0x6b, 0xd1, 0xfb, 0x6b, 0xd1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0x90, 0xfb, 0x6b, 0xd1, 0xff, 0x9c, 0xf5, 0xdc, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x9d, 0x57, 0xbb, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xfc, 0x7c, 0x75, 0xff, 0x7c, 0x74, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x74, 0x34, 0xff, 0x7c, 0x54, 0xff, 0x9d, 0x37, 0xa8, 0xc6, 0x7b, 0x3b, 0xc6, 0x5a, 0x34, 0xbe, 0x1a, 0x4f, 0xa5, 0x77, 0xac, 0x84, 0xb5, 0xff, 0x74, 0x33, 0xff, 0x74, 0x13, 0xfb, 0x74, 0x13, 0xfb, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x73, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xf7, 0x6b, 0xd2, 0xff, 0x7c, 0x53, 0xff, 0x9d, 0x36, 0xa8, 0xb5, 0xd8, 0x58, 0x84, 0x94, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xfb, 0x6b, 0xd1, 0xff, 0x6b, 0xd1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0x90, 0xff, 0x73, 0xd1, 0xff, 0xa5, 0x35, 0xc7, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xbe, 0x1a, 0x7f, 0x84, 0x95, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x74, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xfb, 0x74, 0x34, 0xf7, 0x74, 0x33, 0xff, 0x7c, 0x34, 0xff, 0x7c, 0x54, 0xff, 0x74, 0x33, 0xff, 0x6c, 0x13, 0xff, 0x74, 0x13, 0xf7, 0x74, 0x13, 0xf7, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x73, 0xf2, 0xff, 0x73, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xfb, 0x6b, 0xd2, 0xf3, 0x63, 0xb1, 0xff, 0x6b, 0xd1, 0xff, 0x63, 0xb1, 0xff, 0x6b, 0xd1, 0xf7, 0x6b, 0xd1, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0x90, 0xff, 0x73, 0xd0, 0xff, 0xd6, 0xbb, 0x3c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x08, 0x95, 0x17, 0xdb, 0x7c, 0x74, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x74, 0x34, 0xf7, 0x74, 0x13, 0xf3, 0x74, 0x33, 0xf0, 0x74, 0x33, 0xf3, 0x74, 0x13, 0xf7, 0x74, 0x13, 0xff, 0x74, 0x33, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xf7, 0x6b, 0xb1, 0xf3, 0x6b, 0xd1, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xd1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb0, 0xff, 0x73, 0xb0, 0xe4, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xe7, 0x5d, 0x17, 0x94, 0xf5, 0x94, 0xde, 0xfc, 0x2f, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0xe7, 0x3d, 0x4b, 0xf7, 0xbf, 0x1c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xb5, 0xfa, 0x88, 0x7c, 0x75, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x55, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x74, 0x34, 0xff, 0x74, 0x33, 0xff, 0x74, 0x33, 0xff, 0x74, 0x33, 0xff, 0x74, 0x33, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xd1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb0, 0xff, 0x73, 0xd0, 0xec, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xf7, 0x9e, 0x0f, 0xa5, 0x57, 0x87, 0x73, 0xf2, 0xe7, 0x63, 0xb1, 0xff, 0x6b, 0xf1, 0xff, 0x9d, 0x56, 0x93, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xad, 0x99, 0xaf, 0x95, 0x17, 0xff, 0x9d, 0x38, 0xff, 0xe7, 0x1d, 0x30, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0x9d, 0x37, 0xd3, 0x7c, 0x75, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x74, 0x34, 0xff, 0x74, 0x33, 0xff, 0x74, 0x33, 0xff, 0x74, 0x33, 0xff, 0x74, 0x33, 0xff, 0x74, 0x33, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xd1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0x90, 0xff, 0x6b, 0xd1, 0xff, 0xa5, 0x56, 0x87, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xf7, 0xbf, 0x0b, 0x94, 0xd5, 0xf4, 0x6b, 0xd1, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x70, 0xdc, 0x53, 0x0e, 0xff, 0x63, 0xb0, 0xff, 0x94, 0xf5, 0xb0, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x08, 0x9d, 0x58, 0xcc, 0x8c, 0xb6, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x8c, 0xb6, 0xff, 0xce, 0x9b, 0x4b, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xa5, 0x98, 0x88, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x74, 0x54, 0xff, 0x74, 0x34, 0xff, 0x74, 0x34, 0xff, 0x74, 0x34, 0xff, 0x74, 0x33, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xd1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xf7, 0x63, 0x90, 0xff, 0x74, 0x12, 0xff, 0x9d, 0x36, 0x83, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xef, 0x7e, 0x0c, 0x7c, 0x53, 0xff, 0x63, 0x90, 0xff, 0x53, 0x4f, 0xfb, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xf7, 0x53, 0x2f, 0xff, 0x63, 0x90, 0xff, 0x8c, 0x94, 0xbf, 0xff, 0xdf, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x08, 0xa5, 0x78, 0xc8, 0x8c, 0xd6, 0xff, 0x84, 0x96, 0xff, 0x84, 0x96, 0xf8, 0x84, 0x75, 0xf8, 0x7c, 0x75, 0xff, 0x84, 0xb6, 0xff, 0xad, 0xb9, 0xbb, 0xf7, 0xbf, 0x18, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xb5, 0xf9, 0x78, 0x8c, 0xb6, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xf8, 0x7c, 0x75, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x74, 0x34, 0xff, 0x74, 0x33, 0xff, 0x74, 0x33, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xff, 0x63, 0xb1, 0xff, 0x6b, 0xb1, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xd1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0x90, 0xf7, 0x63, 0x90, 0xff, 0x63, 0xb1, 0xff, 0x73, 0xf2, 0xff, 0xbe, 0x39, 0x6b, 0xde, 0xfc, 0x2c, 0x73, 0xf1, 0xf7, 0x63, 0x90, 0xff, 0x53, 0x4f, 0xff, 0x5b, 0x70, 0xfb, 0x5b, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x6f, 0xf7, 0x53, 0x0e, 0xff, 0x63, 0x90, 0xff, 0x9d, 0x15, 0xa7, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xad, 0xb9, 0x9f, 0x8c, 0xd6, 0xff, 0x84, 0x96, 0xff, 0x84, 0xb6, 0xf8, 0x84, 0xb6, 0xff, 0x84, 0x96, 0xff, 0x84, 0x96, 0xf8, 0x7c, 0x75, 0xff, 0x84, 0xb6, 0xff, 0xa5, 0x58, 0xe7, 0xef, 0x7e, 0x20, 0xff, 0xdf, 0x07, 0xb5, 0xd9, 0x77, 0x8c, 0xb6, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x84, 0x75, 0xf8, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x55, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x63, 0xb1, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2e, 0xff, 0x5b, 0x6f, 0xff, 0x6b, 0xf2, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x63, 0xb1, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2e, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x6f, 0xff, 0x63, 0x90, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0x90, 0xf7, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x74, 0x12, 0xff, 0x74, 0x12, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x70, 0xfb, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x53, 0x4f, 0xf7, 0x53, 0x2f, 0xff, 0x7c, 0x53, 0xe3, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x08, 0x95, 0x17, 0xd7, 0x84, 0x96, 0xff, 0x84, 0x96, 0xf8, 0x84, 0xb6, 0xff, 0x84, 0x96, 0xff, 0x84, 0x96, 0xff, 0x84, 0x96, 0xff, 0x84, 0x96, 0xfc, 0x7c, 0x75, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xf8, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x54, 0xff, 0x74, 0x33, 0xff, 0x6b, 0xf2, 0xff, 0x63, 0xb1, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x6f, 0xff, 0x53, 0x2e, 0xff, 0x4a, 0xed, 0xff, 0x4a, 0xed, 0xff, 0x4a, 0xed, 0xff, 0x53, 0x2e, 0xff, 0x6b, 0xd2, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x5b, 0x90, 0xff, 0x4b, 0x0e, 0xff, 0x4a, 0xed, 0xff, 0x4a, 0xed, 0xff, 0x4b, 0x0e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x4f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x70, 0xff, 0x63, 0x91, 0xff, 0x63, 0xb1, 0xff, 0x6b, 0xd1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xfb, 0x5b, 0x4f, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xfb, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x53, 0x4f, 0xff, 0x5b, 0x6f, 0xff, 0x8c, 0x93, 0xb8, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0x95, 0x17, 0xc4, 0x7c, 0x75, 0xff, 0x84, 0x96, 0xfc, 0x84, 0x96, 0xff, 0x84, 0x96, 0xff, 0x84, 0x96, 0xff, 0x84, 0x96, 0xff, 0x84, 0x96, 0xff, 0x84, 0x95, 0xfc, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xfb, 0x84, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x54, 0xff, 0x74, 0x33, 0xff, 0x6b, 0xf2, 0xff, 0x63, 0x90, 0xff, 0x53, 0x2f, 0xff, 0x4b, 0x0d, 0xff, 0x4b, 0x0d, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4a, 0xed, 0xff, 0x53, 0x2e, 0xff, 0x6b, 0xd2, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x63, 0x90, 0xff, 0x53, 0x2e, 0xff, 0x4a, 0xed, 0xff, 0x4a, 0xed, 0xff, 0x4b, 0x0d, 0xff, 0x4b, 0x0d, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x2f, 0xff, 0x5b, 0x70, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x6f, 0xff, 0x53, 0x2f, 0xff, 0x6b, 0x90, 0xff, 0xa5, 0x15, 0xbb, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xc6, 0x3b, 0x6f, 0x84, 0xb6, 0xff, 0x7c, 0x75, 0xff, 0x84, 0x96, 0xfc, 0x84, 0x96, 0xff, 0x84, 0x96, 0xff, 0x84, 0x96, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x7c, 0x75, 0xff, 0x84, 0x75, 0xff, 0x84, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x54, 0xff, 0x6b, 0xf2, 0xff, 0x5b, 0x70, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4a, 0xed, 0xff, 0x4b, 0x0d, 0xff, 0x4b, 0x0d, 0xff, 0x4b, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4a, 0xed, 0xff, 0x53, 0x2f, 0xff, 0x6b, 0xd2, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x63, 0x90, 0xff, 0x53, 0x2e, 0xff, 0x4a, 0xed, 0xff, 0x4a, 0xed, 0xff, 0x4a, 0xed, 0xff, 0x4a, 0xed, 0xff, 0x4b, 0x0d, 0xff, 0x4b, 0x0d, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x70, 0xff, 0x63, 0x90, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x7b, 0xd0, 0xff, 0xe6, 0xfc, 0x28, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0b, 0xb5, 0xfa, 0x8f, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x84, 0x96, 0xfc, 0x84, 0x96, 0xff, 0x84, 0x96, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x7c, 0x95, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x84, 0x95, 0xff, 0x7c, 0x75, 0xff, 0x74, 0x13, 0xff, 0x63, 0x91, 0xff, 0x53, 0x4f, 0xff, 0x53, 0x0e, 0xff, 0x4a, 0xed, 0xff, 0x4a, 0xed, 0xff, 0x4b, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4a, 0xed, 0xff, 0x4a, 0xed, 0xff, 0x53, 0x0e, 0xff, 0x63, 0x4e, 0xff, 0x6b, 0x8f, 0xff, 0x6b, 0xd2, 0xfb, 0x74, 0x13, 0xfb, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xd2, 0xff, 0x5b, 0x2f, 0xfb, 0x4a, 0xcc, 0xff, 0x52, 0xed, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x4e, 0xff, 0x4a, 0xed, 0xff, 0x42, 0xcd, 0xff, 0x4a, 0xed, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x70, 0xff, 0x63, 0x90, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x53, 0x2f, 0xff, 0x6b, 0x6f, 0xff, 0x9c, 0xd4, 0xd3, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0b, 0xb5, 0xd9, 0x8f, 0x84, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x84, 0x96, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x84, 0x75, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x7c, 0x54, 0xff, 0x6b, 0xf2, 0xff, 0x5b, 0x6f, 0xff, 0x4b, 0x0d, 0xff, 0x4a, 0xed, 0xff, 0x4b, 0x0d, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0d, 0xff, 0x4a, 0xed, 0xff, 0x52, 0xed, 0xff, 0x5b, 0x0e, 0xff, 0x6b, 0x8f, 0xff, 0x84, 0x52, 0xff, 0x9d, 0x15, 0x97, 0xde, 0xdb, 0x13, 0xc6, 0x39, 0x2b, 0x7c, 0x53, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xb1, 0xfb, 0x5b, 0x0e, 0xff, 0x6b, 0x4e, 0xff, 0xad, 0x55, 0x63, 0xd6, 0xbb, 0x18, 0xd6, 0xbb, 0x14, 0xbd, 0xf8, 0x30, 0x84, 0x73, 0xff, 0x6b, 0xd1, 0xff, 0x53, 0x2e, 0xff, 0x4a, 0xee, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x2f, 0xfb, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x70, 0xff, 0x63, 0x90, 0xff, 0x63, 0xb1, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x4f, 0xfb, 0x5b, 0x2e, 0xff, 0x7b, 0xb0, 0xff, 0xe7, 0x1c, 0x1c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x13, 0x8c, 0xf7, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xfc, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x7c, 0x75, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x7c, 0x54, 0xff, 0x63, 0xb1, 0xff, 0x53, 0x2e, 0xff, 0x4b, 0x0d, 0xff, 0x4b, 0x0d, 0xff, 0x4b, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xfb, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x63, 0x4e, 0xff, 0x73, 0xd0, 0xff, 0x8c, 0x52, 0xff, 0xd6, 0x7a, 0x28, 0xf7, 0x7e, 0x0f, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x94, 0xf6, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x63, 0x91, 0xff, 0x6b, 0x90, 0xff, 0xa5, 0x35, 0xb3, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x07, 0xce, 0x7a, 0x37, 0x84, 0x73, 0xff, 0x6b, 0xb0, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x5b, 0x4f, 0xfb, 0x5b, 0x4f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x70, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x53, 0x0e, 0xff, 0x6b, 0x4f, 0xff, 0xad, 0x35, 0x9c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xe7, 0x3d, 0x28, 0x94, 0xf7, 0xff, 0x7c, 0x95, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x74, 0x33, 0xff, 0x63, 0x90, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0d, 0xff, 0x4b, 0x0d, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xfb, 0x52, 0xee, 0xff, 0x63, 0x2e, 0xff, 0x7b, 0xf0, 0xff, 0xbd, 0xd8, 0x54, 0xef, 0x5d, 0x0f, 0xf7, 0x9e, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x04, 0x95, 0x16, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x6c, 0x13, 0xff, 0x63, 0xb1, 0xff, 0x73, 0xd1, 0xff, 0xef, 0x5d, 0x13, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xf7, 0x9e, 0x0c, 0xef, 0x7e, 0x0b, 0xad, 0x97, 0x4f, 0x6b, 0xb1, 0xff, 0x53, 0x4f, 0xff, 0x53, 0x4f, 0xff, 0x5b, 0x6f, 0xfb, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x63, 0x70, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x53, 0x2e, 0xff, 0x7b, 0xf1, 0xff, 0xf7, 0x9e, 0x0f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0c, 0x94, 0xf6, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x7c, 0x75, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x74, 0x33, 0xff, 0x5b, 0x90, 0xff, 0x4b, 0x0e, 0xff, 0x4a, 0xed, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xfb, 0x4a, 0xed, 0xff, 0x5b, 0x2e, 0xff, 0x73, 0xb0, 0xff, 0xb5, 0xb7, 0x40, 0xf7, 0xbe, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x04, 0x94, 0xf6, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf3, 0xff, 0x6b, 0xf3, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xb1, 0xff, 0x73, 0xd1, 0xff, 0xff, 0xdf, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xef, 0x7e, 0x08, 0xad, 0x77, 0x5f, 0x6b, 0xf1, 0xff, 0x53, 0x2f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x70, 0xfb, 0x5b, 0x70, 0xff, 0x63, 0x70, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x6f, 0xff, 0x53, 0x2f, 0xff, 0x74, 0x12, 0xff, 0xf7, 0x9e, 0x0f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xad, 0xd9, 0x9f, 0x84, 0xb5, 0xff, 0x7c, 0x75, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x74, 0x13, 0xff, 0x5b, 0x70, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0d, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xf7, 0x53, 0x0d, 0xff, 0x63, 0x6f, 0xff, 0x8c, 0x31, 0xff, 0xc6, 0x18, 0x44, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x04, 0x95, 0x16, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x6c, 0x13, 0xff, 0x6c, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd1, 0xff, 0x73, 0xf1, 0xff, 0xf7, 0xbf, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xb5, 0xd8, 0x60, 0x74, 0x32, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x63, 0x90, 0xf7, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x53, 0x4f, 0xff, 0x63, 0xb0, 0xff, 0x9d, 0x15, 0xb3, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xf7, 0xbf, 0x18, 0x8c, 0xb6, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xfc, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x74, 0x33, 0xff, 0x5b, 0x70, 0xff, 0x4b, 0x0d, 0xff, 0x4b, 0x0d, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x2e, 0xff, 0x4b, 0x0e, 0xf4, 0x53, 0x0e, 0xff, 0x6b, 0x8f, 0xff, 0xad, 0x35, 0x88, 0xf7, 0xbe, 0x0f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x04, 0x95, 0x16, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x6c, 0x13, 0xff, 0x6c, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd1, 0xff, 0x7b, 0xf1, 0xff, 0xf7, 0xbf, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xef, 0x5d, 0x1f, 0x84, 0x94, 0xc0, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xf7, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x6f, 0xfb, 0x53, 0x2f, 0xff, 0x63, 0x90, 0xff, 0xf7, 0x9e, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xce, 0x9b, 0x44, 0x94, 0xf5, 0x7c, 0x84, 0x73, 0x70, 0x7c, 0x32, 0x87, 0xde, 0xdc, 0x20, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0x9d, 0x37, 0xb0, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x74, 0x34, 0xff, 0x5b, 0x90, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0d, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xf4, 0x52, 0xed, 0xff, 0x7b, 0xf0, 0xff, 0xc5, 0xf8, 0x4f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x04, 0x95, 0x16, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x74, 0x13, 0xff, 0x73, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd1, 0xff, 0x7b, 0xf1, 0xff, 0xff, 0xbf, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x9d, 0x36, 0x70, 0x6b, 0xf2, 0xff, 0x5b, 0x70, 0xff, 0x63, 0xb1, 0xf7, 0x63, 0xd1, 0xff, 0x63, 0xd1, 0xff, 0x63, 0xb1, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x4f, 0xfb, 0x84, 0x93, 0xac, 0xad, 0x77, 0x80, 0xad, 0x97, 0x80, 0x9d, 0x36, 0x78, 0x8c, 0xb4, 0x9b, 0x74, 0x11, 0xff, 0x63, 0x70, 0xff, 0x53, 0x2e, 0xff, 0x4b, 0x0e, 0xff, 0x74, 0x12, 0xff, 0xf7, 0x9e, 0x13, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xef, 0x5e, 0x23, 0x94, 0xf6, 0xf3, 0x95, 0x17, 0xe8, 0xce, 0x9b, 0x64, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0xad, 0xb9, 0x94, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x84, 0x95, 0xfc, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x84, 0x95, 0xff, 0x74, 0x54, 0xff, 0x63, 0xb0, 0xff, 0x53, 0x0e, 0xff, 0x4a, 0xed, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x2e, 0xff, 0x4a, 0xed, 0xf4, 0x5b, 0x0d, 0xff, 0x83, 0xf0, 0xff, 0xc5, 0xf8, 0x54, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x04, 0x95, 0x16, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x6c, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xb1, 0xff, 0x7b, 0xf1, 0xff, 0xff, 0xbf, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xa5, 0x77, 0x77, 0x73, 0xf2, 0xff, 0x63, 0x91, 0xff, 0x63, 0xb1, 0xf7, 0x6b, 0xd2, 0xff, 0x6b, 0xd1, 0xff, 0x63, 0x91, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x4f, 0xfb, 0x5b, 0x4f, 0xff, 0x5b, 0x6f, 0xff, 0x63, 0xb0, 0xff, 0x63, 0xb0, 0xff, 0x5b, 0x6f, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xf7, 0x53, 0x2f, 0xe7, 0x5b, 0x4f, 0xe8, 0x53, 0x2e, 0xe7, 0x5b, 0x4f, 0xff, 0x84, 0x93, 0xff, 0xff, 0xdf, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x10, 0x8c, 0xb6, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x75, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xe3, 0x84, 0x95, 0xcc, 0x95, 0x17, 0xcf, 0xb5, 0xd9, 0xac, 0xa5, 0x78, 0xd4, 0x8c, 0xd6, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xf8, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x54, 0xff, 0x63, 0xd1, 0xff, 0x53, 0x0e, 0xff, 0x4a, 0xed, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xf4, 0x52, 0xed, 0xff, 0x83, 0xf1, 0xff, 0xce, 0x19, 0x4f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x04, 0x95, 0x16, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xb1, 0xff, 0x7b, 0xf1, 0xff, 0xff, 0xbf, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xa5, 0x57, 0x77, 0x74, 0x12, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xd2, 0xf7, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x4f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x4a, 0xed, 0xff, 0x6b, 0xd0, 0xff, 0xe7, 0x3d, 0x18, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xd6, 0xbc, 0x50, 0x84, 0x95, 0xff, 0x74, 0x34, 0xff, 0x7c, 0x54, 0xf8, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x84, 0x75, 0xff, 0x84, 0xb5, 0xff, 0x84, 0x95, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xf8, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x84, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x6b, 0xf2, 0xff, 0x53, 0x2f, 0xff, 0x4b, 0x0d, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x2e, 0xff, 0x4b, 0x0e, 0xf8, 0x53, 0x0d, 0xff, 0x7b, 0xf0, 0xff, 0xce, 0x39, 0x50, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x04, 0x94, 0xf6, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xb1, 0xff, 0x7b, 0xf1, 0xff, 0xff, 0xbf, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xa5, 0x57, 0x74, 0x73, 0xf2, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd1, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x4a, 0xee, 0xff, 0x53, 0x4f, 0xff, 0xad, 0x97, 0x88, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xf7, 0xbf, 0x10, 0x8c, 0xb5, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x74, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x74, 0x34, 0xff, 0x5b, 0x70, 0xff, 0x4a, 0xed, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x2e, 0xff, 0x4b, 0x0e, 0xfc, 0x53, 0x0d, 0xff, 0x73, 0x8f, 0xff, 0xc5, 0xf8, 0x57, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x04, 0x95, 0x16, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xb1, 0xff, 0x7b, 0xf1, 0xff, 0xff, 0xbf, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0x8c, 0xb5, 0xf3, 0x63, 0xb2, 0xff, 0x6b, 0xf2, 0xff, 0x74, 0x13, 0xff, 0x73, 0xf2, 0xff, 0x6b, 0xd1, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x2e, 0xff, 0x6b, 0xf1, 0xff, 0xf7, 0x9e, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xef, 0x7e, 0x1f, 0x74, 0x34, 0xff, 0x74, 0x34, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x74, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x55, 0xff, 0x7c, 0x74, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x54, 0xff, 0x63, 0xb1, 0xff, 0x53, 0x2e, 0xff, 0x4b, 0x0d, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x4a, 0xed, 0xff, 0x6b, 0x4e, 0xff, 0xad, 0x35, 0x87, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x04, 0x94, 0xf6, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xb1, 0xff, 0x73, 0xf1, 0xff, 0xf7, 0xbf, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xde, 0xfc, 0x2f, 0x84, 0x94, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xfb, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x63, 0x91, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x5b, 0x4f, 0xff, 0xef, 0x7e, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0xc6, 0x5a, 0x7b, 0x74, 0x34, 0xff, 0x74, 0x34, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x74, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x75, 0xff, 0x74, 0x13, 0xff, 0x53, 0x2f, 0xff, 0x4b, 0x0d, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x2e, 0xff, 0x4b, 0x0e, 0xff, 0x63, 0x2e, 0xff, 0x94, 0x72, 0xff, 0xff, 0xdf, 0x0f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x04, 0x95, 0x16, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xb1, 0xff, 0x73, 0xf1, 0xff, 0xff, 0xbf, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xc6, 0x5a, 0x44, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x4b, 0x0e, 0xff, 0x53, 0x2e, 0xff, 0x84, 0x52, 0xff, 0xf7, 0xbe, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xc6, 0x3a, 0x78, 0x74, 0x34, 0xff, 0x74, 0x34, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x74, 0xff, 0x74, 0x54, 0xff, 0x63, 0xb1, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0d, 0xff, 0x53, 0x2e, 0xff, 0x4b, 0x0e, 0xfc, 0x53, 0x0e, 0xff, 0x84, 0x11, 0xff, 0xe6, 0xfc, 0x37, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0x95, 0x16, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xb1, 0xff, 0x73, 0xf1, 0xff, 0xff, 0xdf, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0x95, 0x16, 0xfb, 0x74, 0x33, 0xff, 0x74, 0x13, 0xff, 0x74, 0x33, 0xff, 0x74, 0x13, 0xff, 0x63, 0xb1, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x0e, 0xff, 0x5b, 0x2e, 0xff, 0x7c, 0x11, 0xff, 0xce, 0x5a, 0x4f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x08, 0xa5, 0x98, 0x93, 0x7c, 0x54, 0xff, 0x74, 0x13, 0xff, 0x74, 0x34, 0xff, 0x7c, 0x54, 0xfc, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x74, 0xff, 0x6b, 0xf2, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x6b, 0x4e, 0xff, 0xc6, 0x18, 0x4b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xe7, 0x3d, 0x20, 0x84, 0x94, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xff, 0x63, 0xb1, 0xff, 0x73, 0xf2, 0xff, 0xc6, 0x5a, 0x37, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xde, 0xfc, 0x2c, 0x84, 0x74, 0xff, 0x6b, 0xf3, 0xff, 0x74, 0x34, 0xff, 0x74, 0x34, 0xff, 0x6b, 0xf2, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2e, 0xfb, 0x52, 0xee, 0xff, 0x63, 0x4f, 0xff, 0x94, 0x93, 0xac, 0xde, 0xfc, 0x28, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0xd6, 0xbc, 0x40, 0x9d, 0x37, 0xd8, 0x7c, 0x74, 0xff, 0x74, 0x13, 0xff, 0x74, 0x34, 0xff, 0x7c, 0x54, 0xfc, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x63, 0xb1, 0xff, 0x4b, 0x0d, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x2e, 0xff, 0x4b, 0x0e, 0xfc, 0x5b, 0x2e, 0xff, 0x84, 0x11, 0xff, 0xff, 0xdf, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xef, 0x9e, 0x10, 0xc6, 0x5a, 0x44, 0x94, 0xd5, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xb1, 0xfb, 0x6b, 0xd2, 0xff, 0x84, 0x73, 0xff, 0xc6, 0x3a, 0x47, 0xff, 0xff, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xa5, 0x78, 0xa7, 0x74, 0x13, 0xff, 0x74, 0x34, 0xff, 0x7c, 0x54, 0xff, 0x74, 0x33, 0xff, 0x63, 0xb1, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x4f, 0xff, 0x53, 0x0e, 0xfb, 0x52, 0xed, 0xff, 0x73, 0x8f, 0xff, 0xa4, 0xf4, 0x83, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0b, 0xb5, 0xd9, 0x7f, 0x84, 0x95, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xf8, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x74, 0x13, 0xff, 0x5b, 0x70, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x6b, 0x6f, 0xff, 0xce, 0x39, 0x44, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xce, 0x9b, 0x2b, 0x84, 0x94, 0xff, 0x7c, 0x53, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xfb, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xf7, 0x6b, 0xd2, 0xff, 0x74, 0x13, 0xff, 0x84, 0x94, 0xff, 0xde, 0xdc, 0x1c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xe7, 0x5d, 0x1b, 0x8c, 0xb5, 0xff, 0x74, 0x34, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x75, 0xff, 0x6b, 0xf2, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x4f, 0xff, 0x52, 0xed, 0xf4, 0x6b, 0x2d, 0xff, 0xa5, 0x14, 0x84, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xf7, 0x9e, 0x17, 0xad, 0xb9, 0x78, 0x84, 0x95, 0xff, 0x74, 0x33, 0xf8, 0x74, 0x34, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x6b, 0xd1, 0xff, 0x53, 0x4f, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x5b, 0x0e, 0xff, 0x84, 0x11, 0xff, 0xff, 0xbf, 0x0f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xef, 0x5d, 0x18, 0xa5, 0x77, 0x8c, 0x74, 0x33, 0xff, 0x63, 0xd2, 0xff, 0x6b, 0xd2, 0xf3, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd1, 0xfb, 0x63, 0x91, 0xf7, 0x63, 0x91, 0xff, 0x73, 0xf2, 0xff, 0xad, 0x97, 0x5b, 0xef, 0x5d, 0x14, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xb5, 0xf9, 0x6c, 0x74, 0x34, 0xff, 0x7c, 0x54, 0xff, 0x84, 0x75, 0xff, 0x74, 0x13, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x4f, 0xf7, 0x53, 0x0e, 0xff, 0x8c, 0x52, 0x8b, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xce, 0x9b, 0x44, 0x84, 0x95, 0xff, 0x74, 0x33, 0xf3, 0x74, 0x34, 0xff, 0x7c, 0x34, 0xff, 0x74, 0x34, 0xff, 0x7c, 0x54, 0xff, 0x74, 0x33, 0xff, 0x5b, 0x90, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x63, 0x4e, 0xff, 0xad, 0x35, 0xb8, 0xff, 0xff, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xe7, 0x5d, 0x1c, 0x8c, 0xb5, 0xff, 0x63, 0xd1, 0xff, 0x63, 0x91, 0xf7, 0x6b, 0xd2, 0xf7, 0x6b, 0xf2, 0xff, 0x73, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xd2, 0xff, 0x63, 0xb1, 0xef, 0x5b, 0x70, 0xfb, 0x63, 0xb1, 0xff, 0x8c, 0xb4, 0xff, 0xef, 0x5d, 0x18, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0x1d, 0x18, 0x7c, 0x54, 0xff, 0x7c, 0x55, 0xff, 0x84, 0x95, 0xff, 0x7c, 0x54, 0xff, 0x6b, 0xd2, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2f, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x4f, 0xf0, 0x5b, 0x4f, 0xff, 0xbd, 0xd8, 0x37, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xbe, 0x3a, 0x4c, 0x7c, 0x54, 0xff, 0x74, 0x34, 0xf3, 0x74, 0x34, 0xff, 0x74, 0x34, 0xff, 0x74, 0x34, 0xff, 0x7c, 0x54, 0xff, 0x74, 0x13, 0xff, 0x5b, 0x4f, 0xff, 0x4b, 0x0d, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x7b, 0xd0, 0xff, 0xe7, 0x1c, 0x28, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x08, 0x8c, 0xd6, 0xe8, 0x63, 0x91, 0xff, 0x5b, 0x70, 0xe3, 0x6b, 0xb1, 0xff, 0x74, 0x12, 0xff, 0x73, 0xf2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xfb, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0x91, 0xff, 0x63, 0xb1, 0xff, 0x6b, 0xd1, 0xff, 0x63, 0xd1, 0xf7, 0x63, 0xb1, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x4f, 0xdf, 0x63, 0x90, 0xff, 0x94, 0xf5, 0xb7, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xe7, 0x5d, 0x13, 0x8c, 0xb6, 0xff, 0x7c, 0x75, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x74, 0x13, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2e, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xf7, 0x53, 0x0e, 0xff, 0x94, 0xd4, 0x90, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xb5, 0xf9, 0x4c, 0x74, 0x13, 0xff, 0x74, 0x34, 0xf3, 0x74, 0x33, 0xff, 0x74, 0x34, 0xff, 0x74, 0x34, 0xff, 0x74, 0x33, 0xff, 0x6b, 0xf2, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x5b, 0x0e, 0xff, 0x9c, 0xd4, 0xc7, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0xad, 0x98, 0x94, 0x6b, 0xf2, 0xff, 0x53, 0x2f, 0xf4, 0x5b, 0x6f, 0xff, 0x8c, 0xb4, 0xd8, 0x9d, 0x16, 0xcc, 0x7c, 0x74, 0xff, 0x6b, 0xd2, 0xff, 0x63, 0x91, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0xb1, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xb1, 0xff, 0x63, 0x91, 0xff, 0x63, 0x91, 0xff, 0x73, 0xd1, 0xff, 0x73, 0xf1, 0xeb, 0x6b, 0xd1, 0xcf, 0x5b, 0x6f, 0xfb, 0x53, 0x4f, 0xf7, 0x6b, 0xd1, 0xff, 0xc6, 0x3a, 0x4b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xce, 0x7b, 0x3c, 0x84, 0x95, 0xff, 0x7c, 0x75, 0xff, 0x84, 0xb6, 0xff, 0x74, 0x54, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x4f, 0xff, 0x53, 0x4f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x4f, 0xff, 0x4a, 0xed, 0xfb, 0x7c, 0x11, 0xff, 0xef, 0x3d, 0x1f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xa5, 0x98, 0x78, 0x6b, 0xf3, 0xff, 0x74, 0x33, 0xf7, 0x74, 0x33, 0xff, 0x74, 0x33, 0xff, 0x74, 0x33, 0xff, 0x74, 0x13, 0xff, 0x63, 0xb1, 0xff, 0x53, 0x4f, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x63, 0x4e, 0xff, 0xd6, 0x9a, 0x33, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xce, 0x9b, 0x3f, 0x7c, 0x33, 0xff, 0x63, 0xb2, 0xff, 0x5b, 0x6f, 0xff, 0x74, 0x11, 0xd4, 0xff, 0xdf, 0x04, 0xff, 0xff, 0x00, 0xf7, 0x9e, 0x0f, 0x84, 0x73, 0xff, 0x7c, 0x32, 0xff, 0x84, 0x93, 0xe8, 0x94, 0xf4, 0xaf, 0x94, 0xd4, 0xb4, 0x9d, 0x15, 0xb4, 0x9d, 0x36, 0xaf, 0x8c, 0xb5, 0xe7, 0x74, 0x12, 0xff, 0x7c, 0x32, 0xff, 0x9d, 0x15, 0xb3, 0xff, 0xdf, 0x03, 0xff, 0xff, 0x00, 0x84, 0x73, 0xcb, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x74, 0x32, 0xff, 0xdf, 0x1c, 0x23, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xe7, 0x3d, 0x18, 0x8c, 0xb6, 0xff, 0x7c, 0x75, 0xff, 0x8c, 0xb6, 0xff, 0x7c, 0x75, 0xff, 0x63, 0x90, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x4f, 0xff, 0x4b, 0x0e, 0xf7, 0x6b, 0xb0, 0xff, 0xce, 0x5a, 0x3c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x18, 0x94, 0xf6, 0xec, 0x6b, 0xd2, 0xff, 0x74, 0x33, 0xfc, 0x74, 0x33, 0xff, 0x74, 0x33, 0xff, 0x74, 0x33, 0xff, 0x74, 0x13, 0xff, 0x63, 0x90, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x73, 0xaf, 0xff, 0xe7, 0x1c, 0x20, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xe7, 0x1d, 0x23, 0x84, 0x94, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xf8, 0x63, 0x91, 0xff, 0x84, 0x93, 0xdc, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xf7, 0x9e, 0x14, 0xbe, 0x19, 0x78, 0xff, 0xdf, 0x0c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x0b, 0xbd, 0xf9, 0x77, 0xd6, 0xbb, 0x3b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0x8c, 0xd5, 0xdf, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xf3, 0x63, 0x90, 0xff, 0x94, 0xf5, 0xcb, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xe7, 0x5e, 0x18, 0x8c, 0xf7, 0xff, 0x7c, 0x75, 0xff, 0x8c, 0xd7, 0xff, 0x84, 0x95, 0xff, 0x6b, 0xd2, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x0e, 0xff, 0x5b, 0x4f, 0xff, 0x84, 0x52, 0xff, 0xd6, 0xbb, 0x27, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xdf, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xd6, 0xdc, 0x4f, 0x8c, 0xb5, 0xff, 0x6b, 0xf3, 0xff, 0x74, 0x33, 0xff, 0x74, 0x33, 0xff, 0x74, 0x33, 0xff, 0x74, 0x34, 0xff, 0x6b, 0xf2, 0xff, 0x5b, 0x70, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x7b, 0xf1, 0xff, 0xef, 0x5d, 0x1b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xc6, 0x5a, 0x3f, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xf4, 0x6b, 0xf2, 0xff, 0x63, 0xb2, 0xff, 0x7c, 0x53, 0xff, 0xc6, 0x5a, 0x60, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xb5, 0xb8, 0x88, 0x74, 0x33, 0xff, 0x5b, 0x90, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xf7, 0x6b, 0xd1, 0xff, 0xce, 0x7a, 0x30, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xf7, 0xbf, 0x0c, 0x95, 0x17, 0xff, 0x7c, 0x75, 0xff, 0x8c, 0xd6, 0xff, 0x84, 0x96, 0xff, 0x74, 0x13, 0xff, 0x5b, 0x70, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xf7, 0x53, 0x4f, 0xff, 0x53, 0x4e, 0xff, 0x53, 0x4f, 0xd4, 0x5b, 0x4f, 0xdc, 0x5b, 0x6f, 0xdf, 0x5b, 0x6f, 0xff, 0x7c, 0x32, 0xe7, 0xef, 0x7e, 0x0c, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x08, 0xff, 0xdf, 0x10, 0xff, 0xdf, 0x0b, 0xf7, 0x9e, 0x1b, 0xde, 0xfc, 0x50, 0xad, 0xb8, 0xb4, 0x84, 0x95, 0xff, 0x74, 0x33, 0xff, 0x74, 0x13, 0xff, 0x74, 0x33, 0xff, 0x74, 0x33, 0xff, 0x74, 0x33, 0xff, 0x74, 0x33, 0xff, 0x6b, 0xf2, 0xff, 0x5b, 0x90, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x84, 0x12, 0xff, 0xd6, 0x9b, 0x43, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x04, 0xff, 0xff, 0x04, 0xff, 0xff, 0x04, 0xff, 0xff, 0x04, 0xff, 0xff, 0x04, 0xff, 0xff, 0x04, 0xff, 0xff, 0x04, 0xff, 0xff, 0x04, 0xff, 0xff, 0x03, 0xff, 0xff, 0x04, 0xff, 0xdf, 0x13, 0xa5, 0x77, 0x80, 0x6b, 0xd2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xfb, 0x63, 0xb1, 0xff, 0x74, 0x12, 0xff, 0xf7, 0x7e, 0x17, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x0b, 0x7c, 0x53, 0xff, 0x63, 0x91, 0xff, 0x63, 0x90, 0xfb, 0x63, 0xb1, 0xff, 0x63, 0x90, 0xfb, 0x5b, 0x50, 0xff, 0x94, 0xd5, 0xb0, 0xf7, 0xbe, 0x10, 0xff, 0xff, 0x03, 0xff, 0xff, 0x04, 0xff, 0xdf, 0x04, 0xff, 0xdf, 0x04, 0xff, 0xdf, 0x04, 0xff, 0xdf, 0x04, 0xff, 0xdf, 0x04, 0xff, 0xdf, 0x04, 0xff, 0xdf, 0x04, 0xff, 0xdf, 0x04, 0xff, 0xdf, 0x04, 0xff, 0xdf, 0x04, 0xff, 0xff, 0x03, 0xd6, 0xbc, 0x33, 0x84, 0x95, 0xff, 0x74, 0x34, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x54, 0xff, 0x6b, 0xf2, 0xff, 0x5b, 0x70, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x4b, 0x0e, 0xf8, 0x4a, 0xed, 0xff, 0x4a, 0xed, 0xff, 0x4a, 0xed, 0xff, 0x4b, 0x0d, 0xff, 0x4a, 0xed, 0xff, 0x53, 0x4e, 0xff, 0x6b, 0xf1, 0xe3, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xef, 0x5e, 0x20, 0x9d, 0x57, 0xdf, 0x94, 0xf6, 0xff, 0x8c, 0xd5, 0xff, 0x84, 0x74, 0xff, 0x7c, 0x53, 0xff, 0x74, 0x33, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xfc, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x33, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd1, 0xff, 0x74, 0x12, 0xff, 0x8c, 0xb5, 0xff, 0xb5, 0xd9, 0x98, 0xce, 0x7b, 0x64, 0xbe, 0x3a, 0x80, 0xbe, 0x3a, 0x80, 0xbe, 0x19, 0x88, 0xbe, 0x19, 0x8b, 0xbe, 0x19, 0x88, 0xbe, 0x19, 0x88, 0xbe, 0x19, 0x87, 0xbe, 0x19, 0x88, 0xc6, 0x3a, 0x78, 0xad, 0x98, 0xaf, 0x8c, 0xb5, 0xff, 0x74, 0x33, 0xff, 0x6b, 0xf2, 0xfc, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x5b, 0x70, 0xff, 0x63, 0x90, 0xff, 0xbe, 0x39, 0x6c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xf7, 0x9e, 0x14, 0x74, 0x12, 0xff, 0x5b, 0x70, 0xff, 0x63, 0x90, 0xff, 0x63, 0xb1, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xfb, 0x6b, 0xd1, 0xff, 0x84, 0x73, 0xff, 0x94, 0xd5, 0xff, 0x94, 0xf5, 0xff, 0x8c, 0xd5, 0xff, 0x8c, 0xd5, 0xff, 0x8c, 0xd4, 0xff, 0x8c, 0xd4, 0xff, 0x8c, 0xd4, 0xff, 0x8c, 0xd4, 0xff, 0x8c, 0xd4, 0xff, 0x8c, 0xd4, 0xff, 0x8c, 0xb4, 0xff, 0x8c, 0xb4, 0xff, 0x8c, 0xd4, 0xff, 0x7c, 0x53, 0xff, 0x63, 0xb1, 0xff, 0x63, 0x91, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4a, 0xed, 0xfb, 0x42, 0xcd, 0xff, 0x4b, 0x0d, 0xff, 0xf7, 0xbf, 0x08,
-  0xff, 0xdf, 0x0f, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf3, 0xff, 0x6b, 0xf3, 0xff, 0x74, 0x13, 0xfc, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x33, 0xff, 0x74, 0x33, 0xff, 0x74, 0x33, 0xff, 0x74, 0x33, 0xff, 0x74, 0x13, 0xfc, 0x6b, 0xf3, 0xff, 0x6b, 0xf3, 0xff, 0x74, 0x13, 0xff, 0x6c, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xfc, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x5b, 0x70, 0xff, 0x63, 0x90, 0xff, 0xe7, 0x1c, 0x37, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x84, 0x95, 0xb7, 0x63, 0xb1, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xfb, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xfb, 0x53, 0x2f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x42, 0xcd, 0xff, 0x53, 0x2e, 0xec, 0xde, 0xfc, 0x3b,
-  0xde, 0xfc, 0x50, 0x74, 0x13, 0xff, 0x63, 0xb2, 0xff, 0x6b, 0xf2, 0xfc, 0x6b, 0xf2, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xff, 0x5b, 0x70, 0xff, 0x6b, 0xb0, 0xff, 0xef, 0x5d, 0x2c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x95, 0x17, 0xb3, 0x6b, 0xf2, 0xff, 0x5b, 0x70, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x4f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x42, 0xcd, 0xff, 0x53, 0x2e, 0xfb, 0xad, 0x97, 0xaf,
-  0xde, 0xdc, 0x60, 0x74, 0x33, 0xf3, 0x6b, 0xd2, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x5b, 0x70, 0xff, 0x73, 0xd0, 0xff, 0xef, 0x7d, 0x28, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x9d, 0x58, 0xb7, 0x74, 0x13, 0xff, 0x5b, 0x70, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4a, 0xcd, 0xfb, 0x53, 0x0e, 0xff, 0x84, 0x52, 0xff,
-  0xef, 0x5d, 0x3b, 0x74, 0x33, 0xec, 0x6b, 0xd2, 0xff, 0x6b, 0xf2, 0xff, 0x74, 0x13, 0xff, 0x6c, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x63, 0x70, 0xff, 0x73, 0xd1, 0xff, 0xf7, 0x9e, 0x20, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x9d, 0x37, 0xb8, 0x6b, 0xf2, 0xff, 0x5b, 0x70, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x42, 0xcd, 0xfb, 0x4a, 0xed, 0xff, 0x84, 0x31, 0xff,
-  0xe7, 0x5d, 0x3c, 0x74, 0x13, 0xec, 0x63, 0xd2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x12, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x6c, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x63, 0xd2, 0xff, 0x63, 0xb2, 0xff, 0x63, 0xb2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x63, 0x90, 0xff, 0x73, 0xf1, 0xff, 0xf7, 0x9e, 0x24, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0x8c, 0xd6, 0xb3, 0x6b, 0xd2, 0xff, 0x5b, 0x70, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x50, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x4f, 0xff, 0x53, 0x4f, 0xff, 0x53, 0x4f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0d, 0xff, 0x4a, 0xed, 0xff, 0x4a, 0xed, 0xff, 0x4a, 0xed, 0xff, 0x4a, 0xcd, 0xff, 0x5b, 0x4e, 0xff, 0xb5, 0xb7, 0x8f,
-  0xef, 0x7e, 0x2c, 0x6b, 0xf2, 0xff, 0x63, 0xb1, 0xff, 0x6b, 0xd2, 0xfc, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf3, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf3, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x12, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xfc, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x73, 0xf2, 0xff, 0x73, 0xf2, 0xff, 0x6c, 0x12, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xfc, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x63, 0x91, 0xff, 0x73, 0xf2, 0xff, 0xe7, 0x3d, 0x38, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x0c, 0x7c, 0x54, 0xdc, 0x63, 0x91, 0xff, 0x5b, 0x70, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x90, 0xff, 0x5b, 0x70, 0xfb, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2f, 0xfb, 0x53, 0x2f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x4b, 0x0e, 0xfb, 0x4b, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x2e, 0xff, 0x63, 0x8f, 0xff, 0x84, 0x32, 0xff, 0xff, 0xdf, 0x0b,
-  0xff, 0xff, 0x0b, 0x7c, 0x54, 0xf7, 0x6b, 0xd2, 0xff, 0x63, 0xb1, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xf2, 0xfc, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x73, 0xf2, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x90, 0xff, 0x5b, 0x90, 0xff, 0x5b, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x63, 0x4f, 0xff, 0x73, 0xb0, 0xff, 0x84, 0x73, 0xff, 0xb5, 0xd8, 0x93, 0xd6, 0xbb, 0x57, 0xce, 0x9b, 0x5b, 0xce, 0x9b, 0x5b, 0xce, 0x9b, 0x63, 0xce, 0x9b, 0x63, 0xd6, 0x9b, 0x5b, 0xce, 0x9b, 0x5c, 0xce, 0x7b, 0x64, 0xd6, 0xbb, 0x53, 0xb5, 0xd9, 0x90, 0x8c, 0xb4, 0xff, 0x74, 0x12, 0xff, 0x63, 0xb1, 0xfc, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd1, 0xff, 0x5b, 0x91, 0xff, 0x74, 0x12, 0xff, 0xce, 0x5a, 0x73, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xd6, 0xdc, 0x4c, 0x73, 0xf2, 0xff, 0x5b, 0x4f, 0xff, 0x63, 0x90, 0xfb, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x4f, 0xfb, 0x63, 0x4f, 0xff, 0x73, 0xb0, 0xff, 0x84, 0x32, 0xff, 0x8c, 0xb4, 0xff, 0xad, 0x97, 0x9f, 0xb5, 0xf8, 0x78, 0xb5, 0xb8, 0x84, 0xb5, 0xd8, 0x83, 0xb5, 0xd8, 0x83, 0xb5, 0xd8, 0x83, 0xb5, 0xd8, 0x83, 0xb5, 0xd8, 0x7f, 0xb5, 0xb7, 0x8b, 0x9c, 0xf5, 0xdf, 0x7c, 0x32, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x4a, 0xcc, 0xf8, 0x52, 0xed, 0xff, 0x6b, 0x8f, 0xff, 0x8c, 0x72, 0xff, 0xbd, 0xf8, 0x60, 0xe7, 0x3d, 0x17, 0xef, 0x7e, 0x0c, 0xff, 0xbf, 0x08, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xf7, 0xbf, 0x17, 0xb5, 0xd8, 0xa0, 0x8c, 0xd5, 0xff, 0x84, 0x94, 0xff, 0x84, 0x94, 0xf8, 0x84, 0x74, 0xff, 0x7c, 0x53, 0xff, 0x73, 0xf2, 0xff, 0x6b, 0xf2, 0xf8, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xd1, 0xff, 0x53, 0x4f, 0xff, 0x4b, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0d, 0xff, 0x4a, 0xcd, 0xff, 0x6b, 0x6f, 0xff, 0xb5, 0x76, 0x94, 0xf7, 0x9e, 0x1c, 0xff, 0xff, 0x04, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x04, 0xff, 0xdf, 0x10, 0xad, 0x97, 0x70, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xfc, 0x6b, 0xd2, 0xff, 0x6b, 0xd1, 0xfc, 0x63, 0x91, 0xff, 0x7c, 0x12, 0xff, 0xde, 0xfc, 0x4b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x0c, 0x7c, 0x33, 0xf8, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xfb, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xf7, 0x63, 0x6f, 0xff, 0x83, 0xf0, 0xff, 0xd6, 0x7a, 0x2b, 0xff, 0xff, 0x03, 0xff, 0xdf, 0x07, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xce, 0x5a, 0x37, 0x73, 0xf2, 0xff, 0x63, 0x91, 0xff, 0x6b, 0xd1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0x70, 0xff, 0x53, 0x4f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x4a, 0xed, 0xff, 0x52, 0xac, 0xff, 0x7b, 0xd0, 0xff, 0xd6, 0x7a, 0x33, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0xff, 0xff, 0x0c, 0xff, 0xdf, 0x0b, 0xff, 0xff, 0x07, 0xff, 0xbf, 0x18, 0xbd, 0xf9, 0x90, 0x84, 0x74, 0xff, 0x73, 0xf2, 0xff, 0x6b, 0xd2, 0xf8, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd1, 0xff, 0x5b, 0x4f, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0d, 0xff, 0x4a, 0xed, 0xff, 0x4a, 0xed, 0xff, 0x8c, 0x73, 0xff, 0xff, 0xbe, 0x23, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xce, 0x7b, 0x43, 0x73, 0xf2, 0xff, 0x63, 0xb1, 0xf7, 0x6b, 0xd1, 0xff, 0x63, 0xb1, 0xff, 0x6b, 0xd1, 0xff, 0x9c, 0xf4, 0xb3, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xde, 0xfc, 0x3b, 0x74, 0x12, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xf8, 0x63, 0x70, 0xff, 0x7b, 0xf1, 0xff, 0xd6, 0x7a, 0x30, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xe7, 0x5d, 0x14, 0x7c, 0x33, 0xff, 0x63, 0x91, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd1, 0xff, 0x5b, 0x90, 0xff, 0x53, 0x4f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x2e, 0xff, 0x4a, 0xed, 0xff, 0x6b, 0x6e, 0xff, 0xc6, 0x18, 0x3f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xd6, 0xbb, 0x50, 0x7c, 0x74, 0xff, 0x63, 0xb1, 0xfc, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xff, 0x5b, 0x70, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0d, 0xff, 0x4a, 0xed, 0xff, 0x4a, 0xed, 0xff, 0x8c, 0x52, 0xff, 0xf7, 0x7e, 0x20, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xe7, 0x3d, 0x2f, 0x8c, 0xb4, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xf8, 0x5b, 0x70, 0xff, 0x74, 0x12, 0xff, 0xf7, 0x7e, 0x28, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xc6, 0x39, 0x78, 0x94, 0xf5, 0xec, 0xd6, 0xdc, 0x40, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xf7, 0x9f, 0x20, 0xb5, 0xd9, 0x9f, 0xef, 0x7e, 0x23, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0x8c, 0xb4, 0xd8, 0x5b, 0x70, 0xff, 0x53, 0x4f, 0xfb, 0x5b, 0x4f, 0xff, 0x73, 0xd1, 0xff, 0xce, 0x5a, 0x33, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xe7, 0x1d, 0x18, 0x74, 0x33, 0xff, 0x63, 0xb1, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd1, 0xff, 0x5b, 0x6f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x4b, 0x0e, 0xff, 0x52, 0xed, 0xfb, 0x84, 0x11, 0xff, 0xe7, 0x1c, 0x1f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xa5, 0x57, 0x7c, 0x63, 0x91, 0xff, 0x6b, 0xf2, 0xf7, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xff, 0x63, 0x90, 0xff, 0x53, 0x2e, 0xff, 0x4a, 0xed, 0xff, 0x4a, 0xed, 0xff, 0x4a, 0xed, 0xff, 0x73, 0xd0, 0xff, 0xe7, 0x1c, 0x2b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xd6, 0xdc, 0x47, 0x74, 0x12, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x74, 0x11, 0xff, 0xd6, 0xbb, 0x58, 0xff, 0xff, 0x07, 0xe7, 0x3d, 0x2f, 0x7c, 0x33, 0xff, 0x6b, 0xd2, 0xff, 0x7c, 0x53, 0xff, 0x9d, 0x36, 0xbc, 0x9d, 0x36, 0xbf, 0x9d, 0x37, 0xc0, 0x9d, 0x57, 0xbc, 0x84, 0xb5, 0xfc, 0x74, 0x13, 0xff, 0x7c, 0x33, 0xff, 0xe7, 0x1c, 0x37, 0xff, 0xff, 0x03, 0xff, 0xff, 0x07, 0x94, 0xf6, 0xd8, 0x6b, 0xd2, 0xff, 0x53, 0x2f, 0xff, 0x6b, 0xd1, 0xff, 0xc6, 0x39, 0x47, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xc6, 0x5a, 0x47, 0x74, 0x13, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xf2, 0xff, 0x63, 0xd1, 0xff, 0x53, 0x4f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x4a, 0xed, 0xff, 0x52, 0xed, 0xff, 0x94, 0x93, 0xff, 0xf7, 0x9e, 0x13, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xb5, 0xf9, 0x48, 0x6b, 0xb1, 0xff, 0x6b, 0xf2, 0xf3, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x63, 0xb1, 0xff, 0x53, 0x2e, 0xff, 0x4a, 0xed, 0xff, 0x4a, 0xed, 0xff, 0x4a, 0xed, 0xff, 0x63, 0x8f, 0xff, 0xe7, 0x1c, 0x24, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xbe, 0x19, 0x68, 0x63, 0xb1, 0xff, 0x5b, 0x50, 0xff, 0x6b, 0xd1, 0xff, 0x84, 0x74, 0xff, 0x8c, 0xd5, 0xe8, 0x74, 0x33, 0xfc, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xf8, 0x63, 0xb1, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x63, 0xb1, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x74, 0x12, 0xff, 0x94, 0xf5, 0xdb, 0x8c, 0xf5, 0xd8, 0x7c, 0x74, 0xf8, 0x63, 0xb1, 0xff, 0x5b, 0x70, 0xff, 0xad, 0x97, 0x80, 0xff, 0xff, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xef, 0x5e, 0x14, 0x8c, 0xd5, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x63, 0xb1, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x4a, 0xed, 0xfb, 0x63, 0x4e, 0xff, 0xbd, 0xf8, 0x54, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xbe, 0x19, 0x54, 0x74, 0x12, 0xff, 0x6b, 0xd2, 0xf3, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd1, 0xff, 0x53, 0x4f, 0xff, 0x4a, 0xed, 0xff, 0x4b, 0x0d, 0xff, 0x4a, 0xed, 0xff, 0x53, 0x2e, 0xff, 0xd6, 0xdb, 0x2f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xa5, 0x77, 0x8c, 0x63, 0xb1, 0xff, 0x63, 0x91, 0xe8, 0x6b, 0xd1, 0xff, 0x6b, 0xd1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0x90, 0xfc, 0x63, 0x90, 0xfc, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x90, 0xff, 0x5b, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xfc, 0x5b, 0x70, 0xfc, 0x5b, 0x70, 0xff, 0x63, 0xb1, 0xff, 0x6b, 0xd1, 0xff, 0x63, 0x91, 0xef, 0x63, 0xb1, 0xff, 0xad, 0xb7, 0x6c, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0x1d, 0x13, 0x74, 0x33, 0xff, 0x6b, 0xf2, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x63, 0x91, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4a, 0xcd, 0xf8, 0x6b, 0xb0, 0xff, 0xde, 0xfc, 0x23, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xe7, 0x3d, 0x3f, 0x8c, 0xb4, 0xff, 0x63, 0xb1, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd1, 0xff, 0x5b, 0x6f, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0d, 0xff, 0x4a, 0xed, 0xff, 0x4a, 0xcd, 0xff, 0x9d, 0x35, 0xa0, 0xff, 0xff, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x17, 0x95, 0x16, 0xef, 0x6b, 0xd1, 0xff, 0x5b, 0x70, 0xfc, 0x63, 0x90, 0xf3, 0x63, 0x90, 0xff, 0x63, 0xb0, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x50, 0xf4, 0x53, 0x4f, 0xf8, 0x63, 0xb0, 0xff, 0x9d, 0x15, 0xd8, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xce, 0x9b, 0x2b, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xd2, 0xff, 0x5b, 0x70, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4a, 0xed, 0xfb, 0x5b, 0x6f, 0xff, 0xad, 0x96, 0x6b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xef, 0x7e, 0x30, 0x84, 0x94, 0xff, 0x63, 0xb1, 0xff, 0x6b, 0xd1, 0xfc, 0x6b, 0xd2, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd1, 0xff, 0x63, 0x90, 0xff, 0x53, 0x2e, 0xff, 0x4b, 0x0d, 0xff, 0x4a, 0xed, 0xff, 0x42, 0xcd, 0xff, 0x73, 0xf1, 0xff, 0xde, 0xfc, 0x3c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xf7, 0xbf, 0x20, 0xb5, 0xd8, 0x6c, 0x74, 0x12, 0xff, 0x63, 0x90, 0xff, 0x53, 0x2f, 0xfc, 0x5b, 0x70, 0xf8, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x90, 0xff, 0x5b, 0x70, 0xf8, 0x5b, 0x4f, 0xff, 0x63, 0x90, 0xff, 0xad, 0x97, 0x77, 0xf7, 0xbe, 0x1b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x07, 0x94, 0xf6, 0xff, 0x6b, 0xf2, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x63, 0xb1, 0xff, 0x53, 0x4f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xfb, 0x6b, 0xd0, 0xff, 0xa5, 0x76, 0x53, 0xf7, 0x9e, 0x08, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xef, 0x7e, 0x28, 0x9d, 0x36, 0x90, 0x6b, 0xf2, 0xff, 0x6b, 0xd1, 0xf8, 0x6b, 0xd1, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xd2, 0xff, 0x63, 0xb1, 0xff, 0x5b, 0x4f, 0xff, 0x4b, 0x0d, 0xff, 0x4a, 0xed, 0xff, 0x4a, 0xed, 0xff, 0x53, 0x0e, 0xff, 0x94, 0xd4, 0xec, 0xff, 0xff, 0x10, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xe7, 0x1d, 0x30, 0x9d, 0x16, 0xa4, 0x7c, 0x32, 0xff, 0x73, 0xf2, 0xff, 0x63, 0x90, 0xfc, 0x63, 0x90, 0xfc, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xf8, 0x5b, 0x6f, 0xff, 0x73, 0xd1, 0xff, 0xc6, 0x39, 0x48, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xce, 0x9b, 0x37, 0x7c, 0x54, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x63, 0x90, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xfb, 0x4b, 0x0d, 0xff, 0x4a, 0xed, 0xff, 0x63, 0x8f, 0xff, 0xa5, 0x76, 0x84, 0xef, 0x7d, 0x18, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x13, 0xa5, 0x77, 0x90, 0x7c, 0x53, 0xff, 0x6b, 0xd1, 0xff, 0x63, 0xb1, 0xfc, 0x6b, 0xd1, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xd1, 0xff, 0x5b, 0x70, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0d, 0xff, 0x4b, 0x0e, 0xff, 0x4a, 0xcd, 0xff, 0x6b, 0xf1, 0xff, 0xf7, 0xbf, 0x13, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x08, 0xe7, 0x3d, 0x34, 0xb5, 0xf9, 0x64, 0x6b, 0xd1, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x4f, 0xf8, 0x63, 0x4f, 0xff, 0x7b, 0xf1, 0xff, 0xce, 0x5a, 0x4b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x07, 0x94, 0xf6, 0xff, 0x6c, 0x13, 0xff, 0x74, 0x33, 0xff, 0x74, 0x33, 0xff, 0x6b, 0xf2, 0xff, 0x5b, 0x70, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4a, 0xed, 0xfb, 0x42, 0xcd, 0xff, 0x4a, 0xed, 0xff, 0x53, 0x4e, 0xff, 0x6b, 0xf1, 0xff, 0xf7, 0x9e, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xc6, 0x5a, 0x57, 0x84, 0x94, 0xff, 0x6b, 0xd2, 0xff, 0x5b, 0x70, 0xff, 0x63, 0xb1, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xd1, 0xff, 0x63, 0xb1, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xd1, 0xff, 0x63, 0x90, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4a, 0xed, 0xff, 0x5b, 0x6f, 0xff, 0xb5, 0xf8, 0x64, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0b, 0x7c, 0x53, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x90, 0xff, 0x5b, 0x4f, 0xfc, 0x5b, 0x2e, 0xff, 0x73, 0x8f, 0xff, 0xd6, 0x7a, 0x40, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xbe, 0x1a, 0x4c, 0x7c, 0x54, 0xff, 0x74, 0x13, 0xff, 0x74, 0x54, 0xff, 0x74, 0x33, 0xff, 0x63, 0xb1, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0d, 0xff, 0x42, 0xac, 0xff, 0x42, 0xcd, 0xff, 0xad, 0x97, 0x5b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0xa5, 0x77, 0x87, 0x6b, 0xd1, 0xff, 0x5b, 0x70, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x5b, 0x70, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xfc, 0x53, 0x2e, 0xff, 0x73, 0xf1, 0xff, 0xf7, 0xbf, 0x14, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x10, 0x8c, 0xb4, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x2f, 0xff, 0x63, 0x4f, 0xff, 0xa4, 0xf4, 0xc4, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x07, 0x84, 0x95, 0xff, 0x74, 0x34, 0xff, 0x74, 0x34, 0xfb, 0x7c, 0x54, 0xff, 0x74, 0x13, 0xff, 0x5b, 0x70, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4a, 0xcd, 0xfb, 0x4a, 0xed, 0xff, 0x8c, 0x93, 0xff, 0xff, 0xdf, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xef, 0x7e, 0x1b, 0x6b, 0xd1, 0xff, 0x63, 0x90, 0xff, 0x63, 0x91, 0xfc, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x2e, 0xff, 0xa5, 0x76, 0x7b, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x13, 0x84, 0x94, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x2f, 0xff, 0x6b, 0x90, 0xff, 0xef, 0x5d, 0x27, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xbe, 0x19, 0x58, 0x7c, 0x54, 0xff, 0x74, 0x34, 0xff, 0x7c, 0x54, 0xff, 0x74, 0x34, 0xff, 0x63, 0xd1, 0xff, 0x53, 0x2f, 0xff, 0x4b, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4a, 0xed, 0xff, 0x4b, 0x0e, 0xff, 0x9d, 0x15, 0xd0, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xf7, 0x9e, 0x17, 0x74, 0x32, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x5b, 0x90, 0xff, 0x53, 0x4f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xfc, 0x53, 0x2e, 0xff, 0x63, 0xb0, 0xff, 0xad, 0x97, 0x7c, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x13, 0x84, 0x94, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x50, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x4f, 0xff, 0x6b, 0xb0, 0xff, 0xff, 0xdf, 0x0c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xce, 0x9b, 0x4b, 0x84, 0x95, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xfb, 0x7c, 0x74, 0xff, 0x74, 0x13, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0d, 0xff, 0x4b, 0x0d, 0xff, 0x4b, 0x0d, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4a, 0xed, 0xff, 0x5b, 0x2e, 0xff, 0xc6, 0x39, 0x58, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xbe, 0x19, 0x84, 0x6b, 0xd1, 0xff, 0x5b, 0x70, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x5b, 0x6f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x4f, 0xff, 0x53, 0x2f, 0xf8, 0x4b, 0x0e, 0xff, 0x73, 0xf1, 0xff, 0xbe, 0x19, 0x78, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x13, 0x84, 0x94, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x4f, 0xff, 0x6b, 0xb0, 0xff, 0xf7, 0xbf, 0x10, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xdf, 0x1d, 0x34, 0x8c, 0xf6, 0xff, 0x74, 0x34, 0xff, 0x7c, 0x75, 0xfb, 0x84, 0x75, 0xff, 0x7c, 0x34, 0xff, 0x63, 0xb1, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4a, 0xed, 0xfb, 0x42, 0xcd, 0xff, 0x42, 0xcd, 0xff, 0x42, 0xcd, 0xff, 0x4a, 0xed, 0xff, 0x4b, 0x0e, 0xff, 0x4a, 0xed, 0xfb, 0x4a, 0xed, 0xff, 0x73, 0xb0, 0xff, 0xef, 0x5d, 0x14, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xef, 0x5e, 0x27, 0x74, 0x12, 0xff, 0x5b, 0x70, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0x70, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2f, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2f, 0xf8, 0x5b, 0x4f, 0xff, 0x74, 0x11, 0xff, 0xff, 0xff, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x13, 0x84, 0x94, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x4f, 0xff, 0x6b, 0xb0, 0xff, 0xff, 0xbf, 0x10, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0x8c, 0xf6, 0xec, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x84, 0x95, 0xff, 0x7c, 0x75, 0xff, 0x6b, 0xf2, 0xff, 0x53, 0x4f, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4a, 0xed, 0xf8, 0x4a, 0xed, 0xff, 0x5b, 0x2e, 0xff, 0x63, 0x90, 0xff, 0x63, 0xb0, 0xff, 0x5b, 0x6f, 0xff, 0x53, 0x0e, 0xff, 0x4a, 0xed, 0xff, 0x42, 0xcd, 0xff, 0x5b, 0x4f, 0xff, 0x94, 0x93, 0xff, 0xff, 0xdf, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xbf, 0x14, 0x84, 0x94, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xfc, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xfc, 0x5b, 0x70, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xf8, 0x63, 0x90, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x94, 0xf5, 0x93, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x13, 0x84, 0x94, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x4f, 0xff, 0x6b, 0xb0, 0xff, 0xff, 0xbf, 0x10, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xa5, 0x78, 0x8c, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x84, 0x95, 0xff, 0x84, 0x75, 0xff, 0x74, 0x33, 0xff, 0x5b, 0x70, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4a, 0xcd, 0xff, 0x5a, 0xed, 0xff, 0x84, 0x11, 0xe8, 0xce, 0x59, 0x54, 0xde, 0xfc, 0x34, 0x94, 0xd4, 0xcb, 0x6b, 0xd0, 0xd7, 0x5b, 0x4e, 0xcb, 0x5b, 0x4e, 0xdc, 0x7c, 0x11, 0xf8, 0xef, 0x5d, 0x18, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xef, 0x5d, 0x24, 0x74, 0x12, 0xff, 0x5b, 0x70, 0xff, 0x63, 0x90, 0xff, 0x63, 0xb1, 0xff, 0x6b, 0xd1, 0xff, 0x73, 0xf1, 0xff, 0x84, 0x32, 0xe8, 0x8c, 0x93, 0xc7, 0x73, 0xf1, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xfc, 0x63, 0x90, 0xfc, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x6f, 0xf8, 0x5b, 0x4f, 0xff, 0x63, 0x90, 0xff, 0x94, 0xd5, 0xc8, 0xff, 0xdf, 0x20, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x13, 0x84, 0x94, 0xff, 0x5b, 0x90, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x4f, 0xff, 0x6b, 0xb0, 0xff, 0xff, 0xbf, 0x10, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xf7, 0xbf, 0x17, 0x9d, 0x58, 0xcf, 0x84, 0x95, 0xff, 0x84, 0x95, 0xff, 0x84, 0x95, 0xf7, 0x84, 0x95, 0xff, 0x74, 0x34, 0xff, 0x5b, 0x90, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4a, 0xed, 0xf8, 0x5b, 0x2e, 0xff, 0x94, 0x72, 0xab, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xe7, 0x3d, 0x28, 0x8c, 0xd5, 0xbc, 0x9d, 0x16, 0x9b, 0x9d, 0x36, 0x98, 0xa5, 0x56, 0xa3, 0xb5, 0xb8, 0x93, 0xf7, 0x9e, 0x24, 0xff, 0xff, 0x0b, 0xc6, 0x19, 0x74, 0x84, 0x73, 0xf7, 0x63, 0x90, 0xf8, 0x5b, 0x70, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xf8, 0x5b, 0x4f, 0xff, 0x63, 0x90, 0xff, 0x8c, 0xb4, 0xd4, 0xef, 0x7e, 0x2b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x13, 0x84, 0x94, 0xff, 0x5b, 0x90, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x6b, 0xb0, 0xff, 0xff, 0xbf, 0x13, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x0f, 0x9d, 0x58, 0xb0, 0x84, 0x96, 0xff, 0x84, 0x95, 0xff, 0x84, 0x96, 0xf7, 0x84, 0xb6, 0xff, 0x7c, 0x54, 0xff, 0x63, 0xb1, 0xff, 0x53, 0x2e, 0xff, 0x4b, 0x0d, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0d, 0xfb, 0x52, 0xed, 0xff, 0x7b, 0xf0, 0xff, 0xde, 0xdb, 0x37, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xef, 0x7e, 0x2c, 0x73, 0xf2, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xfc, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xfc, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x7c, 0x32, 0xff, 0xbd, 0xf9, 0x7f, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x13, 0x84, 0x93, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x6b, 0xb0, 0xff, 0xff, 0xbf, 0x13, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xd6, 0xdc, 0x48, 0x8c, 0xf7, 0xff, 0x7c, 0x75, 0xff, 0x84, 0x96, 0xff, 0x84, 0xb6, 0xfb, 0x84, 0xb6, 0xff, 0x7c, 0x75, 0xff, 0x6b, 0xb1, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4a, 0xed, 0xff, 0x6b, 0x4e, 0xff, 0xb5, 0x96, 0x74, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xa5, 0x77, 0x87, 0x6b, 0xd1, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xfc, 0x5b, 0x90, 0xff, 0x63, 0x90, 0xff, 0x74, 0x12, 0xff, 0xad, 0x97, 0x7b, 0xff, 0xff, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x13, 0x84, 0x93, 0xff, 0x5b, 0x70, 0xff, 0x53, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x2f, 0xff, 0x6b, 0xb0, 0xff, 0xff, 0xbf, 0x13, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x13, 0xad, 0xd9, 0x93, 0x8c, 0xd6, 0xff, 0x84, 0x96, 0xff, 0x84, 0x96, 0xff, 0x84, 0xb6, 0xfb, 0x84, 0xb6, 0xff, 0x7c, 0x75, 0xff, 0x63, 0xd1, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4a, 0xed, 0xfb, 0x52, 0xed, 0xff, 0x83, 0xf0, 0xff, 0xff, 0xdf, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x08, 0x94, 0xf5, 0xc8, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0xb1, 0xff, 0x63, 0x90, 0xf8, 0x5b, 0x70, 0xff, 0x6b, 0xf2, 0xff, 0x9d, 0x16, 0xcc, 0xdf, 0x1c, 0x38, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x13, 0x84, 0x73, 0xff, 0x5b, 0x70, 0xff, 0x53, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x2f, 0xff, 0x6b, 0xb0, 0xff, 0xf7, 0xbf, 0x13, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0xd6, 0xdc, 0x3f, 0x9d, 0x37, 0xf7, 0x84, 0x96, 0xff, 0x7c, 0x75, 0xff, 0x84, 0x96, 0xff, 0x8c, 0xb6, 0xff, 0x8c, 0xd7, 0xff, 0x7c, 0x75, 0xff, 0x63, 0xb1, 0xff, 0x53, 0x2e, 0xff, 0x4b, 0x0d, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4a, 0xcd, 0xff, 0x5b, 0x2e, 0xff, 0xbd, 0xd7, 0x73, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0xad, 0xb7, 0xa8, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xfc, 0x63, 0xb1, 0xff, 0x63, 0x91, 0xff, 0x6b, 0xd2, 0xff, 0x9d, 0x57, 0xac, 0xe7, 0x3d, 0x30, 0xef, 0x7e, 0x23, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x13, 0x84, 0x93, 0xff, 0x5b, 0x70, 0xff, 0x53, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x2e, 0xff, 0x6b, 0x90, 0xff, 0xff, 0xdf, 0x0f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0xef, 0x7e, 0x1f, 0xef, 0x7e, 0x23, 0xad, 0xd9, 0x87, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x84, 0x95, 0xff, 0x84, 0xb6, 0xfb, 0x84, 0xb6, 0xff, 0x84, 0x96, 0xff, 0x7c, 0x54, 0xff, 0x63, 0xb1, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0d, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x42, 0xcd, 0xff, 0x5b, 0x4f, 0xff, 0xc6, 0x59, 0x4f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xbf, 0x20, 0x84, 0x73, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x63, 0x90, 0xff, 0x63, 0x90, 0xff, 0x63, 0xb1, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xd1, 0xff, 0x63, 0xb1, 0xff, 0x6b, 0xb1, 0xff, 0x6b, 0xd2, 0xff, 0x74, 0x12, 0xff, 0x84, 0x74, 0xff, 0xce, 0x7a, 0x57, 0xff, 0xdf, 0x1b, 0xff, 0xff, 0x08, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x0f, 0x84, 0x73, 0xff, 0x5b, 0x70, 0xff, 0x53, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x4f, 0xff, 0x53, 0x2e, 0xff, 0x6b, 0x90, 0xff, 0xf7, 0x9e, 0x1f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0xef, 0x7e, 0x28, 0xc6, 0x3a, 0x68, 0x8c, 0xb6, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x95, 0xff, 0x84, 0x96, 0xff, 0x84, 0xb6, 0xff, 0x84, 0x95, 0xff, 0x74, 0x33, 0xff, 0x5b, 0x70, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4a, 0xed, 0xff, 0x4b, 0x0e, 0xff, 0x6b, 0xf1, 0xff, 0xe7, 0x3d, 0x1c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xa5, 0x56, 0x9f, 0x63, 0x90, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x90, 0xff, 0x63, 0x90, 0xff, 0x6b, 0xb1, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x63, 0xb1, 0xff, 0x6b, 0xd2, 0xff, 0x7c, 0x74, 0xff, 0x94, 0xf6, 0xff, 0xb5, 0xd9, 0x74, 0xce, 0x9b, 0x3b, 0xe7, 0x1d, 0x33, 0xff, 0xff, 0x13, 0xf7, 0xbe, 0x27, 0x7c, 0x32, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x0e, 0xff, 0x6b, 0x90, 0xff, 0xb5, 0xd8, 0x97, 0xe7, 0x3d, 0x3b, 0xe7, 0x1d, 0x2c, 0xd6, 0xbb, 0x38, 0xa5, 0x78, 0xa3, 0x8c, 0xd6, 0xff, 0x7c, 0x75, 0xff, 0x74, 0x34, 0xff, 0x74, 0x34, 0xff, 0x7c, 0x75, 0xff, 0x84, 0x95, 0xff, 0x84, 0x96, 0xff, 0x84, 0x95, 0xff, 0x7c, 0x54, 0xff, 0x6b, 0xd1, 0xff, 0x5b, 0x6f, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0d, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4a, 0xed, 0xf8, 0x4b, 0x0e, 0xff, 0x7c, 0x52, 0xff, 0xef, 0x5d, 0x1f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xc6, 0x5a, 0x4c, 0x63, 0x90, 0xff, 0x53, 0x2f, 0xff, 0x5b, 0x70, 0xfc, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x63, 0x90, 0xff, 0x63, 0xb1, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xf2, 0xff, 0x73, 0xf2, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xff, 0x6b, 0xd2, 0xff, 0x74, 0x13, 0xff, 0x84, 0x95, 0xff, 0xad, 0x98, 0xc7, 0xa5, 0x77, 0xac, 0x63, 0xb1, 0xfc, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xfc, 0x63, 0x90, 0xfc, 0x7c, 0x53, 0xff, 0x8c, 0xd5, 0xff, 0x84, 0x95, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf3, 0xff, 0x74, 0x13, 0xff, 0x74, 0x34, 0xff, 0x7c, 0x54, 0xff, 0x84, 0x75, 0xff, 0x84, 0x95, 0xff, 0x84, 0x75, 0xff, 0x7c, 0x54, 0xff, 0x6b, 0xf2, 0xff, 0x63, 0x90, 0xff, 0x53, 0x2e, 0xff, 0x4b, 0x0d, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0d, 0xff, 0x42, 0xcd, 0xf8, 0x53, 0x4e, 0xff, 0x8c, 0xb3, 0xb3, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xd6, 0xbb, 0x4c, 0x74, 0x32, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x6f, 0xf8, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x70, 0xff, 0x63, 0x90, 0xff, 0x63, 0xb1, 0xff, 0x6b, 0xd2, 0xff, 0x6c, 0x12, 0xff, 0x74, 0x13, 0xff, 0x74, 0x33, 0xff, 0x74, 0x33, 0xff, 0x74, 0x33, 0xff, 0x74, 0x33, 0xff, 0x74, 0x33, 0xff, 0x74, 0x34, 0xff, 0x6c, 0x13, 0xff, 0x5b, 0x70, 0xff, 0x53, 0x4f, 0xfc, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2f, 0xff, 0x5b, 0x4f, 0xff, 0x63, 0x91, 0xff, 0x6b, 0xf2, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x33, 0xff, 0x74, 0x34, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x54, 0xff, 0x74, 0x34, 0xff, 0x6b, 0xf2, 0xff, 0x63, 0xb1, 0xff, 0x53, 0x4f, 0xff, 0x4b, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0d, 0xff, 0x42, 0xac, 0xff, 0x6b, 0xd0, 0xbb, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0x8c, 0xb4, 0xe8, 0x5b, 0x70, 0xff, 0x5b, 0x4f, 0xf8, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x63, 0x90, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xf2, 0xff, 0x74, 0x13, 0xff, 0x74, 0x33, 0xff, 0x74, 0x33, 0xff, 0x74, 0x34, 0xff, 0x74, 0x34, 0xff, 0x7c, 0x54, 0xff, 0x74, 0x13, 0xff, 0x5b, 0x90, 0xff, 0x53, 0x2f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2e, 0xff, 0x5b, 0x4f, 0xff, 0x63, 0x91, 0xff, 0x6b, 0xf2, 0xff, 0x74, 0x13, 0xff, 0x74, 0x13, 0xff, 0x74, 0x33, 0xff, 0x74, 0x34, 0xff, 0x74, 0x34, 0xff, 0x74, 0x34, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xd2, 0xff, 0x5b, 0x70, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4a, 0xed, 0xfb, 0x4a, 0xed, 0xff, 0x4a, 0xed, 0xff, 0x4a, 0xed, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0d, 0xff, 0x3a, 0x8c, 0xff, 0x63, 0x90, 0xff, 0xdf, 0x1c, 0x40, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0c, 0x7c, 0x32, 0xef, 0x53, 0x2f, 0xff, 0x53, 0x4f, 0xfc, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x4f, 0xff, 0x53, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x70, 0xff, 0x5b, 0x90, 0xff, 0x63, 0x90, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xf2, 0xff, 0x74, 0x13, 0xff, 0x7c, 0x54, 0xff, 0x7c, 0x75, 0xff, 0x7c, 0x54, 0xff, 0x63, 0x90, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2e, 0xff, 0x5b, 0x4f, 0xff, 0x63, 0x91, 0xff, 0x74, 0x13, 0xff, 0x74, 0x33, 0xff, 0x74, 0x13, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xf2, 0xff, 0x63, 0xb1, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2e, 0xff, 0x4b, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4a, 0xed, 0xfb, 0x52, 0xed, 0xff, 0x5b, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x42, 0xed, 0xff, 0x4a, 0xed, 0xf8, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4a, 0xed, 0xf8, 0x4a, 0xed, 0xff, 0x73, 0xf1, 0xe3, 0xff, 0xdf, 0x0c, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0x8c, 0xd4, 0xd3, 0x5b, 0x70, 0xff, 0x53, 0x2f, 0xff, 0x5b, 0x4f, 0xf8, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x6f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xfc, 0x53, 0x2f, 0xfc, 0x5b, 0x2e, 0xff, 0x63, 0x6f, 0xff, 0x63, 0x90, 0xff, 0x53, 0x4f, 0xff, 0x53, 0x2f, 0xff, 0x5b, 0x4f, 0xf8, 0x5b, 0x6f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x6f, 0xff, 0x63, 0x90, 0xff, 0x63, 0xb1, 0xff, 0x6b, 0xd1, 0xff, 0x6b, 0xf2, 0xff, 0x6b, 0xd2, 0xff, 0x5b, 0x70, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2f, 0xff, 0x5b, 0x70, 0xff, 0x63, 0xb1, 0xff, 0x63, 0xb1, 0xff, 0x63, 0x90, 0xff, 0x5b, 0x90, 0xff, 0x5b, 0x70, 0xff, 0x53, 0x4f, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4a, 0xed, 0xf8, 0x4a, 0xed, 0xff, 0x63, 0x2e, 0xff, 0x7b, 0xd0, 0xff, 0xb5, 0x97, 0x8b, 0xbe, 0x18, 0x73, 0x74, 0x11, 0xff, 0x4b, 0x0e, 0xff, 0x42, 0xcd, 0xff, 0x4b, 0x0e, 0xfb, 0x4b, 0x0e, 0xff, 0x4a, 0xed, 0xf8, 0x42, 0xcd, 0xff, 0x6b, 0xb0, 0xff, 0xad, 0x56, 0x8b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xf7, 0xbf, 0x1b, 0x7c, 0x32, 0xeb, 0x5b, 0x70, 0xff, 0x53, 0x2f, 0xff, 0x5b, 0x4f, 0xfc, 0x5b, 0x6f, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2f, 0xfc, 0x53, 0x2f, 0xff, 0x63, 0x6f, 0xff, 0x7b, 0xb0, 0xff, 0x94, 0x72, 0xdc, 0x8c, 0xb4, 0xd3, 0x74, 0x12, 0xe3, 0x63, 0xb0, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2f, 0xfc, 0x5b, 0x4f, 0xfc, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x4f, 0xff, 0x53, 0x4f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4a, 0xed, 0xf7, 0x52, 0xed, 0xff, 0x63, 0x4e, 0xff, 0x8c, 0x52, 0xfc, 0xd6, 0x9a, 0x4f, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xde, 0xfc, 0x38, 0x7c, 0x32, 0xff, 0x53, 0x2e, 0xff, 0x4a, 0xed, 0xff, 0x42, 0xcd, 0xff, 0x4b, 0x0d, 0xff, 0x6b, 0xb0, 0xff, 0x9c, 0xf4, 0xbc, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x10, 0x7c, 0x32, 0xe7, 0x63, 0x90, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x2f, 0xf8, 0x53, 0x2f, 0xff, 0x5b, 0x6f, 0xff, 0x73, 0xd0, 0xff, 0x8c, 0x52, 0xe8, 0xde, 0xdb, 0x43, 0xff, 0xff, 0x08, 0xff, 0xff, 0x03, 0xff, 0xff, 0x0c, 0xad, 0x97, 0x93, 0x73, 0xf1, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4a, 0xed, 0xf8, 0x52, 0xcc, 0xff, 0x73, 0x6f, 0xff, 0xb5, 0x76, 0x73, 0xff, 0xff, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x10, 0xad, 0x97, 0x67, 0x53, 0x2e, 0xf7, 0x53, 0x2e, 0xd8, 0x6b, 0xb0, 0xe7, 0xb5, 0xb7, 0x8b, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x0f, 0x94, 0xd4, 0xd0, 0x63, 0xb0, 0xff, 0x5b, 0x4f, 0xff, 0x6b, 0xd1, 0xff, 0x84, 0x73, 0xf7, 0xde, 0xdb, 0x4f, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xef, 0x5d, 0x37, 0x7c, 0x53, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2e, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4a, 0xcc, 0xff, 0x6b, 0x4e, 0xff, 0xb5, 0x96, 0x7b, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0c, 0xff, 0xdf, 0x0f, 0xff, 0xff, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x13, 0xa5, 0x77, 0x9b, 0x94, 0xf5, 0xa0, 0xb5, 0xb7, 0x90, 0xf7, 0xbf, 0x1f, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x07, 0xa5, 0x56, 0xdc, 0x63, 0x90, 0xff, 0x4b, 0x0e, 0xff, 0x53, 0x2f, 0xff, 0x5b, 0x4f, 0xff, 0x5b, 0x4f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0d, 0xff, 0x52, 0xed, 0xff, 0x7c, 0x11, 0xc7, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x08, 0x94, 0xf5, 0xe7, 0x63, 0x90, 0xff, 0x4b, 0x0e, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4a, 0xed, 0xfc, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4a, 0xed, 0xff, 0x53, 0x0e, 0xff, 0x84, 0x72, 0xa7, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x0c, 0x73, 0xf1, 0xef, 0x5b, 0x4f, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xf8, 0x53, 0x2e, 0xf8, 0x53, 0x2e, 0xf8, 0x53, 0x2e, 0xfc, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xf8, 0x4b, 0x0d, 0xf8, 0x4a, 0xed, 0xf7, 0x4a, 0xed, 0xff, 0x4a, 0xed, 0xff, 0x4a, 0xed, 0xfc, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4a, 0xed, 0xff, 0x4b, 0x0d, 0xff, 0x7c, 0x32, 0xa7, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xdf, 0x10, 0x5b, 0x4f, 0xf0, 0x53, 0x2e, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x4f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x4f, 0xff, 0x53, 0x2e, 0xff, 0x52, 0xee, 0xf8, 0x52, 0xed, 0xff, 0x63, 0x4f, 0xff, 0x6b, 0xb0, 0xff, 0x63, 0x90, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xfc, 0x53, 0x2e, 0xfc, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x4a, 0xed, 0xf8, 0x4a, 0xed, 0xff, 0x5b, 0x2e, 0xff, 0x6b, 0x8f, 0xff, 0x73, 0xd0, 0xff, 0x84, 0x52, 0xff, 0x84, 0x72, 0xff, 0x63, 0x6f, 0xff, 0x42, 0xcd, 0xfc, 0x4b, 0x0e, 0xfc, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4a, 0xed, 0xff, 0x42, 0xcd, 0xff, 0x6b, 0xf1, 0xcf, 0xff, 0xdf, 0x17, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xce, 0x9b, 0x53, 0x53, 0x4f, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x4f, 0xff, 0x53, 0x4f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x0e, 0xfc, 0x5a, 0xed, 0xff, 0x7b, 0xb0, 0xff, 0xb5, 0xb7, 0x67, 0xd6, 0xbb, 0x3b, 0xc6, 0x5a, 0x50, 0x94, 0xf5, 0xaf, 0x5b, 0x6f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x4a, 0xcd, 0xf8, 0x5b, 0x2e, 0xff, 0x73, 0xd0, 0xff, 0xbd, 0xd8, 0x58, 0xd6, 0x9a, 0x40, 0xd6, 0x7a, 0x4f, 0xe7, 0x1c, 0x3f, 0xf7, 0x9e, 0x2f, 0x9d, 0x15, 0x7f, 0x4b, 0x0d, 0xff, 0x4a, 0xed, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0d, 0xff, 0x42, 0xcd, 0xff, 0x63, 0x90, 0xff, 0xbe, 0x19, 0x7b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x08, 0x8c, 0xd4, 0xff, 0x53, 0x2e, 0xff, 0x4a, 0xee, 0xf8, 0x53, 0x2f, 0xff, 0x53, 0x2f, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xfc, 0x53, 0x0e, 0xff, 0x73, 0x8f, 0xff, 0xce, 0x59, 0x58, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xf7, 0xbe, 0x24, 0x6b, 0xd0, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4a, 0xed, 0xff, 0x52, 0xcd, 0xff, 0x7b, 0xd0, 0xff, 0xde, 0xdb, 0x47, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xef, 0x7e, 0x28, 0x74, 0x11, 0xff, 0x4a, 0xed, 0xff, 0x4a, 0xed, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4a, 0xed, 0xff, 0x42, 0xcd, 0xfb, 0x5b, 0x4f, 0xff, 0x94, 0xb3, 0xc3, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0xa5, 0x56, 0xc0, 0x53, 0x2e, 0xff, 0x4a, 0xcd, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x53, 0x2e, 0xff, 0x4b, 0x0e, 0xff, 0x63, 0x6f, 0xff, 0xad, 0x56, 0xa0, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0c, 0x74, 0x11, 0xf8, 0x53, 0x4e, 0xff, 0x4b, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4a, 0xed, 0xff, 0x63, 0x2e, 0xff, 0xa4, 0xf4, 0xcf, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x08, 0xad, 0x97, 0x83, 0x53, 0x0e, 0xff, 0x42, 0xcd, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0d, 0xff, 0x4a, 0xed, 0xff, 0x42, 0xcd, 0xff, 0x42, 0xcd, 0xff, 0x6b, 0xb0, 0xff, 0xd6, 0x9b, 0x54, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xf7, 0x9e, 0x28, 0x7c, 0x32, 0xff, 0x5b, 0x6f, 0xff, 0x4a, 0xee, 0xff, 0x4a, 0xed, 0xff, 0x4b, 0x0e, 0xff, 0x4b, 0x0e, 0xfc, 0x4a, 0xee, 0xff, 0x5b, 0x2e, 0xff, 0x84, 0x31, 0xff, 0xf7, 0x9e, 0x28, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x10, 0x84, 0x93, 0xff, 0x5b, 0x4f, 0xff, 0x4a, 0xed, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x4a, 0xed, 0xff, 0x63, 0x6f, 0xff, 0xde, 0xdb, 0x53, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xef, 0x5d, 0x2f, 0x74, 0x11, 0xff, 0x42, 0xcd, 0xff, 0x42, 0xac, 0xff, 0x42, 0xcd, 0xff, 0x53, 0x0d, 0xff, 0x5b, 0x4e, 0xff, 0x73, 0xf1, 0xff, 0xc6, 0x59, 0x68, 0xff, 0xff, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xf7, 0x9e, 0x23, 0xb5, 0xd8, 0x94, 0x7c, 0x52, 0xff, 0x6b, 0xd0, 0xff, 0x5b, 0x6f, 0xff, 0x53, 0x2e, 0xff, 0x5b, 0x6f, 0xff, 0x84, 0x52, 0xff, 0xd6, 0x9a, 0x50, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x13, 0x94, 0xf5, 0xff, 0x5b, 0x6f, 0xff, 0x4a, 0xcd, 0xfc, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x4b, 0x0e, 0xff, 0x53, 0x0e, 0xff, 0x6b, 0x6f, 0xff, 0xff, 0xbf, 0x17, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x08, 0xce, 0x7a, 0x68, 0x7c, 0x52, 0xff, 0x63, 0xb0, 0xff, 0x74, 0x11, 0xff, 0x8c, 0xb3, 0xff, 0xc6, 0x39, 0x6b, 0xf7, 0x9e, 0x24, 0xff, 0xff, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0b, 0xff, 0xdf, 0x17, 0xe7, 0x3d, 0x38, 0x94, 0xf4, 0xeb, 0x74, 0x11, 0xff, 0xb5, 0xf8, 0x63, 0xff, 0xdf, 0x17, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0f, 0x9d, 0x15, 0xef, 0x5b, 0x4f, 0xff, 0x42, 0xac, 0xff, 0x4a, 0xed, 0xff, 0x4a, 0xed, 0xff, 0x4a, 0xed, 0xff, 0x4b, 0x0d, 0xff, 0x42, 0xed, 0xfc, 0x53, 0x0e, 0xff, 0x73, 0xd0, 0xff, 0xff, 0xdf, 0x10, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x04, 0xff, 0xbf, 0x1f, 0xf7, 0xbe, 0x1f, 0xf7, 0xbf, 0x1f, 0xff, 0xdf, 0x1c, 0xff, 0xff, 0x07, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x13, 0xf7, 0xbe, 0x1b, 0xff, 0xff, 0x04, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xe7, 0x3d, 0x2f, 0x5b, 0x8f, 0xff, 0x42, 0xcd, 0xff, 0x4a, 0xed, 0xff, 0x4a, 0xed, 0xff, 0x4a, 0xed, 0xff, 0x4a, 0xed, 0xff, 0x42, 0xcd, 0xff, 0x5b, 0x4e, 0xff, 0x8c, 0x93, 0xff, 0xff, 0xff, 0x10, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x00, 0xff, 0xff, 0x0b, 0xa5, 0x76, 0xb8, 0x74, 0x11, 0xff, 0x73, 0xf1, 0xe7, 0x74, 0x11, 0xe3, 0x73, 0xf1, 0xe4, 0x73, 0xf1, 0xe7, 0x6b, 0xd0, 0xff, 0x84, 0x72, 0xf7, 0xef, 0x7e, 0x28, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x03, 0xff, 0xff, 0x08, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0c, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x10, 0xff, 0xdf, 0x18, 0xff, 0xdf, 0x13, 0xff, 0xff, 0x0b, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
-#endif
-#if LV_COLOR_DEPTH == 32
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfb, 0xfa, 0xf9, 0x08, 0xad, 0x9b, 0x8f, 0xff, 0x95, 0x7e, 0x6d, 0xff, 0x90, 0x7a, 0x67, 0xff, 0x92, 0x7c, 0x69, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x8c, 0x75, 0x63, 0xff, 0x97, 0x83, 0x72, 0xff, 0xd1, 0xc8, 0xc0, 0x6c, 0xfe, 0xfe, 0xfe, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf4, 0xf2, 0xf1, 0x10, 0x9e, 0x8a, 0x79, 0xff, 0x8f, 0x78, 0x65, 0xff, 0x90, 0x79, 0x66, 0xff, 0x91, 0x7a, 0x67, 0xff, 0x8f, 0x79, 0x66, 0xff, 0x8c, 0x75, 0x63, 0xff, 0x8c, 0x76, 0x64, 0xff, 0x9f, 0x8c, 0x7d, 0xff, 0xf8, 0xf7, 0xf6, 0x08, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xfc, 0xfb, 0x08, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf9, 0xf7, 0xf6, 0x0c, 0xf5, 0xf2, 0xf1, 0x0f, 0xfd, 0xfc, 0xfc, 0x04, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xdf, 0xdb, 0x38, 0x9a, 0x85, 0x74, 0xff, 0x90, 0x79, 0x66, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x8c, 0x76, 0x63, 0xff, 0x95, 0x7f, 0x6e, 0xff, 0xf9, 0xf8, 0xf7, 0x07, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0xcb, 0xc2, 0xba, 0x53, 0xae, 0xa2, 0x96, 0xff, 0xdf, 0xda, 0xd6, 0x28, 0xf9, 0xf8, 0xf8, 0x07, 0xf9, 0xf8, 0xf7, 0x0b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x07, 0xfa, 0xf9, 0xf8, 0x0c, 0xe7, 0xe1, 0xdc, 0x2b, 0xaf, 0x9a, 0x8b, 0xff, 0x9d, 0x85, 0x73, 0xff, 0xb9, 0xa8, 0x9b, 0xa4, 0xfd, 0xfd, 0xfc, 0x0b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xdf, 0xd9, 0xd4, 0x4b, 0x9d, 0x88, 0x77, 0xff, 0x91, 0x7a, 0x68, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x93, 0x7e, 0x6c, 0xff, 0x8d, 0x78, 0x65, 0xff, 0x95, 0x80, 0x6f, 0xff, 0xde, 0xd9, 0xd5, 0x2c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xc7, 0xbe, 0xb5, 0x50, 0x87, 0x74, 0x61, 0xff, 0x85, 0x73, 0x60, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x90, 0x80, 0x6f, 0xff, 0xa7, 0x9a, 0x8c, 0xff, 0xe1, 0xdc, 0xd8, 0x28, 0xfa, 0xfa, 0xf9, 0x08, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xfb, 0xfa, 0x0c, 0xce, 0xc0, 0xb7, 0x8c, 0xad, 0x97, 0x87, 0xff, 0xa7, 0x90, 0x7f, 0xff, 0xa2, 0x8a, 0x78, 0xff, 0x9c, 0x83, 0x71, 0xff, 0xa0, 0x89, 0x77, 0xff, 0xc1, 0xb2, 0xa6, 0x98, 0xfd, 0xfc, 0xfc, 0x07, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfd, 0xfd, 0x04, 0xc4, 0xb7, 0xad, 0xab, 0x9c, 0x88, 0x77, 0xff, 0x92, 0x7c, 0x69, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7e, 0x6c, 0xff, 0x93, 0x7e, 0x6c, 0xff, 0x90, 0x79, 0x67, 0xfb, 0x92, 0x7e, 0x6e, 0xff, 0x9f, 0x92, 0x89, 0xff, 0xfa, 0xf9, 0xf9, 0x04, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xea, 0xe7, 0xe4, 0x20, 0x9c, 0x8b, 0x7c, 0xff, 0x82, 0x6e, 0x5b, 0xff, 0x81, 0x6e, 0x5a, 0xfb, 0x82, 0x70, 0x5d, 0xff, 0x85, 0x73, 0x61, 0xff, 0x89, 0x77, 0x65, 0xff, 0x8f, 0x7f, 0x6e, 0xff, 0x9c, 0x8e, 0x7f, 0xff, 0xf9, 0xf8, 0xf7, 0x0b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x07, 0xc5, 0xb4, 0xa9, 0xb3, 0xa6, 0x8d, 0x7b, 0xff, 0x9d, 0x82, 0x6f, 0xff, 0x9f, 0x85, 0x72, 0xff, 0x9f, 0x87, 0x75, 0xff, 0xa0, 0x89, 0x77, 0xfc, 0x9b, 0x82, 0x6f, 0xff, 0xa5, 0x8e, 0x7d, 0xff, 0xed, 0xe8, 0xe5, 0x1b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfb, 0xfa, 0xfa, 0x04, 0xad, 0x9b, 0x8d, 0xff, 0x9a, 0x84, 0x73, 0xff, 0x94, 0x7d, 0x6a, 0xff, 0x95, 0x80, 0x6d, 0xff, 0x95, 0x7e, 0x6c, 0xff, 0x95, 0x7e, 0x6c, 0xff, 0x93, 0x7e, 0x6c, 0xff, 0x92, 0x7c, 0x69, 0xff, 0x91, 0x7c, 0x6c, 0xff, 0x92, 0x82, 0x79, 0xff, 0xf9, 0xf9, 0xf9, 0x04, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfc, 0xfc, 0x04, 0xaf, 0xa2, 0x96, 0xd7, 0x8a, 0x77, 0x65, 0xff, 0x88, 0x73, 0x61, 0xff, 0x88, 0x75, 0x63, 0xff, 0x87, 0x75, 0x63, 0xff, 0x84, 0x72, 0x60, 0xfb, 0x81, 0x6e, 0x5b, 0xff, 0x7c, 0x69, 0x56, 0xff, 0x82, 0x6f, 0x5d, 0xff, 0xeb, 0xe8, 0xe5, 0x23, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf6, 0xf4, 0xf2, 0x24, 0xaf, 0x99, 0x89, 0xff, 0xa0, 0x84, 0x72, 0xff, 0xa4, 0x89, 0x78, 0xff, 0xa3, 0x8a, 0x79, 0xff, 0xa2, 0x8a, 0x78, 0xff, 0xa2, 0x8a, 0x78, 0xff, 0x9e, 0x85, 0x73, 0xff, 0xa0, 0x87, 0x76, 0xff, 0xc1, 0xb2, 0xa7, 0x6b, 0xfe, 0xfe, 0xfe, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xfb, 0xfb, 0x03, 0xa5, 0x91, 0x82, 0xff, 0x99, 0x83, 0x71, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x95, 0x80, 0x6e, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7e, 0x6d, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x93, 0x7d, 0x6a, 0xff, 0x90, 0x7b, 0x6a, 0xff, 0x8e, 0x7e, 0x74, 0xfb, 0xfa, 0xfa, 0xfa, 0x04, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf3, 0xf1, 0xf0, 0x10, 0x94, 0x83, 0x72, 0xff, 0x84, 0x6e, 0x5b, 0xff, 0x8a, 0x76, 0x64, 0xff, 0x89, 0x76, 0x63, 0xff, 0x87, 0x75, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x7f, 0x6c, 0x59, 0xff, 0x83, 0x70, 0x5e, 0xff, 0xcb, 0xc3, 0xbc, 0x67, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xfb, 0xfb, 0x0b, 0xb4, 0x9f, 0x92, 0xc4, 0xa2, 0x88, 0x77, 0xff, 0xa4, 0x8a, 0x79, 0xff, 0xa5, 0x8b, 0x79, 0xff, 0xa3, 0x8a, 0x78, 0xff, 0xa2, 0x8a, 0x78, 0xff, 0xa1, 0x88, 0x77, 0xff, 0x9e, 0x86, 0x73, 0xff, 0x9f, 0x89, 0x77, 0xff, 0xe2, 0xdb, 0xd6, 0x2b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf9, 0xf8, 0xf7, 0x08, 0xa1, 0x8c, 0x7c, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x94, 0x7f, 0x6d, 0xff, 0x93, 0x7d, 0x6b, 0xff, 0x8e, 0x79, 0x68, 0xff, 0x8e, 0x7d, 0x72, 0xff, 0xce, 0xc9, 0xc6, 0x40, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0xbe, 0xb4, 0xaa, 0x7c, 0x90, 0x7d, 0x6b, 0xff, 0x88, 0x73, 0x60, 0xff, 0x8a, 0x77, 0x64, 0xff, 0x89, 0x76, 0x63, 0xff, 0x87, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x81, 0x6f, 0x5c, 0xff, 0x87, 0x76, 0x66, 0xff, 0xab, 0xa1, 0x99, 0xd4, 0xfe, 0xfe, 0xfe, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xba, 0xa7, 0x99, 0xa3, 0xa4, 0x8a, 0x79, 0xff, 0xa4, 0x89, 0x78, 0xff, 0xa5, 0x8b, 0x79, 0xff, 0xa3, 0x8a, 0x78, 0xff, 0xa1, 0x8a, 0x77, 0xff, 0xa1, 0x89, 0x77, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x9a, 0x81, 0x6e, 0xff, 0xb4, 0xa2, 0x96, 0xbf, 0xfa, 0xf9, 0xf9, 0x0f, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfd, 0xfc, 0x07, 0xe1, 0xda, 0xd6, 0x2c, 0xbd, 0xaf, 0xa3, 0x83, 0x99, 0x83, 0x72, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6c, 0xff, 0x93, 0x7d, 0x6c, 0xff, 0x8f, 0x7a, 0x69, 0xfb, 0x8f, 0x7a, 0x6b, 0xff, 0x9a, 0x89, 0x7d, 0xff, 0xcd, 0xc5, 0xbe, 0x47, 0xfd, 0xfd, 0xfd, 0x04, 0xff, 0xff, 0xff, 0x00, 0xda, 0xd4, 0xce, 0x30, 0x92, 0x80, 0x6f, 0xff, 0x8a, 0x75, 0x63, 0xff, 0x8b, 0x77, 0x65, 0xfb, 0x8b, 0x77, 0x65, 0xff, 0x89, 0x75, 0x64, 0xff, 0x87, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x73, 0x61, 0xff, 0x81, 0x6f, 0x5d, 0xfb, 0x86, 0x77, 0x6b, 0xff, 0xa5, 0x9c, 0x98, 0xdc, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0xbb, 0xa7, 0x99, 0xbb, 0xa3, 0x8a, 0x78, 0xff, 0xa3, 0x89, 0x77, 0xfc, 0xa5, 0x8c, 0x7a, 0xff, 0xa4, 0x8b, 0x78, 0xff, 0xa2, 0x8a, 0x78, 0xff, 0xa1, 0x88, 0x77, 0xff, 0xa0, 0x88, 0x76, 0xff, 0x9f, 0x86, 0x74, 0xff, 0xa1, 0x8a, 0x79, 0xff, 0xb7, 0xa6, 0x9a, 0xa8, 0xd5, 0xcb, 0xc4, 0x3b, 0xd4, 0xca, 0xc2, 0x34, 0xcd, 0xc2, 0xb9, 0x4f, 0xbc, 0xad, 0xa1, 0xac, 0xa6, 0x93, 0x83, 0xff, 0x9a, 0x84, 0x72, 0xff, 0x96, 0x7f, 0x6e, 0xfb, 0x97, 0x80, 0x6f, 0xfb, 0x96, 0x80, 0x6f, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x94, 0x7e, 0x6d, 0xff, 0x93, 0x7d, 0x6c, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x90, 0x7b, 0x69, 0xf7, 0x90, 0x7a, 0x68, 0xff, 0x9c, 0x89, 0x7b, 0xff, 0xb2, 0xa4, 0x99, 0xa8, 0xc3, 0xb9, 0xaf, 0x58, 0x9f, 0x8f, 0x7f, 0xff, 0x89, 0x75, 0x62, 0xff, 0x88, 0x74, 0x61, 0xfb, 0x8c, 0x78, 0x66, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x89, 0x76, 0x64, 0xff, 0x87, 0x75, 0x63, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x60, 0xff, 0x82, 0x6f, 0x5d, 0xff, 0x86, 0x78, 0x6f, 0xff, 0xac, 0xa4, 0xa3, 0xc7, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xd0, 0xc2, 0xb8, 0x7f, 0xa9, 0x90, 0x7f, 0xff, 0xa2, 0x88, 0x76, 0xff, 0xa5, 0x8b, 0x79, 0xff, 0xa4, 0x8b, 0x79, 0xff, 0xa3, 0x8a, 0x79, 0xff, 0xa2, 0x88, 0x78, 0xff, 0xa1, 0x88, 0x77, 0xff, 0xa0, 0x88, 0x76, 0xfb, 0x9e, 0x85, 0x74, 0xf7, 0x9c, 0x84, 0x71, 0xff, 0x9e, 0x86, 0x75, 0xff, 0x9e, 0x87, 0x75, 0xff, 0x9a, 0x83, 0x70, 0xff, 0x97, 0x7f, 0x6c, 0xff, 0x97, 0x81, 0x6e, 0xf7, 0x99, 0x82, 0x71, 0xf7, 0x98, 0x81, 0x70, 0xff, 0x97, 0x80, 0x6f, 0xff, 0x97, 0x80, 0x6f, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6d, 0xff, 0x94, 0x7e, 0x6d, 0xff, 0x93, 0x7e, 0x6d, 0xff, 0x92, 0x7d, 0x6c, 0xff, 0x91, 0x7c, 0x6b, 0xff, 0x90, 0x7a, 0x69, 0xfb, 0x8e, 0x78, 0x66, 0xf3, 0x8c, 0x76, 0x64, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x8a, 0x76, 0x63, 0xff, 0x8c, 0x7a, 0x67, 0xf7, 0x8c, 0x79, 0x66, 0xff, 0x8b, 0x78, 0x65, 0xff, 0x8b, 0x76, 0x65, 0xff, 0x89, 0x76, 0x64, 0xff, 0x87, 0x76, 0x64, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x60, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x84, 0x77, 0x71, 0xff, 0xd7, 0xd4, 0xd4, 0x3c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfb, 0xfa, 0xf9, 0x08, 0xb5, 0xa0, 0x92, 0xdb, 0xa4, 0x8b, 0x7a, 0xff, 0xa4, 0x8a, 0x78, 0xff, 0xa5, 0x8b, 0x7a, 0xff, 0xa3, 0x8a, 0x78, 0xff, 0xa1, 0x89, 0x77, 0xff, 0xa0, 0x88, 0x76, 0xff, 0x9f, 0x87, 0x76, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x9e, 0x85, 0x74, 0xf7, 0x9b, 0x82, 0x70, 0xf3, 0x9a, 0x83, 0x6f, 0xf0, 0x9a, 0x83, 0x70, 0xf3, 0x99, 0x82, 0x70, 0xf7, 0x99, 0x82, 0x70, 0xff, 0x9a, 0x83, 0x71, 0xff, 0x98, 0x82, 0x70, 0xff, 0x97, 0x80, 0x6f, 0xff, 0x97, 0x80, 0x6f, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x93, 0x7e, 0x6c, 0xff, 0x92, 0x7e, 0x6c, 0xff, 0x91, 0x7b, 0x6b, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x8f, 0x79, 0x68, 0xff, 0x8d, 0x78, 0x67, 0xf7, 0x8c, 0x76, 0x65, 0xf3, 0x8c, 0x77, 0x65, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x8c, 0x78, 0x65, 0xff, 0x8b, 0x76, 0x64, 0xff, 0x89, 0x76, 0x64, 0xff, 0x88, 0x75, 0x64, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x5f, 0xff, 0x83, 0x73, 0x62, 0xff, 0x81, 0x76, 0x73, 0xe4, 0xfb, 0xfb, 0xfb, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xea, 0xe7, 0xe4, 0x17, 0xa7, 0x9d, 0x90, 0x94, 0xdf, 0xdb, 0xd7, 0x2f, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfd, 0xfd, 0x04, 0xea, 0xe3, 0xde, 0x4b, 0xf8, 0xf5, 0xf4, 0x1c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xcd, 0xbe, 0xb4, 0x88, 0xa7, 0x8e, 0x7c, 0xff, 0xa2, 0x87, 0x76, 0xff, 0xa5, 0x8a, 0x7a, 0xff, 0xa3, 0x8a, 0x79, 0xff, 0xa1, 0x8a, 0x77, 0xff, 0xa0, 0x89, 0x76, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x9f, 0x87, 0x75, 0xff, 0xa0, 0x88, 0x76, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x9d, 0x86, 0x73, 0xff, 0x9c, 0x86, 0x73, 0xff, 0x9b, 0x85, 0x73, 0xff, 0x9a, 0x83, 0x72, 0xff, 0x99, 0x83, 0x71, 0xff, 0x98, 0x82, 0x70, 0xff, 0x98, 0x80, 0x70, 0xff, 0x98, 0x80, 0x70, 0xff, 0x97, 0x80, 0x6f, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x93, 0x7e, 0x6c, 0xff, 0x92, 0x7e, 0x6c, 0xff, 0x91, 0x7b, 0x6a, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x90, 0x7a, 0x6a, 0xff, 0x90, 0x7b, 0x6a, 0xff, 0x8e, 0x7a, 0x69, 0xff, 0x8d, 0x79, 0x68, 0xff, 0x8d, 0x78, 0x67, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x8b, 0x76, 0x64, 0xff, 0x8a, 0x76, 0x64, 0xff, 0x88, 0x76, 0x64, 0xff, 0x87, 0x74, 0x62, 0xff, 0x86, 0x73, 0x60, 0xff, 0x84, 0x73, 0x62, 0xff, 0x82, 0x77, 0x70, 0xec, 0xfb, 0xfb, 0xfb, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf4, 0xf2, 0xf1, 0x0f, 0xb5, 0xaa, 0xa0, 0x87, 0x8e, 0x7e, 0x6e, 0xe7, 0x85, 0x75, 0x63, 0xff, 0x8a, 0x7c, 0x6b, 0xff, 0xb1, 0xa7, 0x9b, 0x93, 0xfc, 0xfc, 0xfc, 0x04, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xfc, 0xfb, 0x07, 0xc6, 0xb2, 0xa5, 0xaf, 0xb8, 0x9f, 0x8f, 0xff, 0xbd, 0xa5, 0x97, 0xff, 0xea, 0xe2, 0xde, 0x30, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfc, 0xfc, 0x07, 0xba, 0xa5, 0x98, 0xd3, 0xa6, 0x8c, 0x7a, 0xff, 0xa3, 0x89, 0x77, 0xff, 0xa4, 0x8a, 0x79, 0xff, 0xa3, 0x8a, 0x78, 0xff, 0xa2, 0x8a, 0x78, 0xff, 0xa1, 0x88, 0x77, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x9d, 0x86, 0x73, 0xff, 0x9c, 0x85, 0x72, 0xff, 0x9b, 0x85, 0x72, 0xff, 0x9a, 0x84, 0x72, 0xff, 0x9a, 0x84, 0x71, 0xff, 0x9a, 0x83, 0x71, 0xff, 0x99, 0x82, 0x71, 0xff, 0x98, 0x81, 0x70, 0xff, 0x98, 0x80, 0x70, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x93, 0x7e, 0x6c, 0xff, 0x92, 0x7e, 0x6c, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x8e, 0x7a, 0x68, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x8d, 0x78, 0x67, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x8b, 0x78, 0x66, 0xff, 0x8a, 0x76, 0x64, 0xff, 0x89, 0x76, 0x64, 0xff, 0x88, 0x76, 0x64, 0xff, 0x87, 0x74, 0x62, 0xff, 0x86, 0x73, 0x61, 0xff, 0x83, 0x70, 0x5f, 0xff, 0x86, 0x77, 0x69, 0xff, 0xb3, 0xa9, 0xa2, 0x87, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf6, 0xf5, 0xf4, 0x0b, 0xa6, 0x9a, 0x8d, 0xf4, 0x8a, 0x79, 0x68, 0xff, 0x7a, 0x69, 0x55, 0xff, 0x7e, 0x6c, 0x59, 0xdc, 0x74, 0x61, 0x4d, 0xff, 0x83, 0x74, 0x62, 0xff, 0xa8, 0x9d, 0x92, 0xb0, 0xfc, 0xfc, 0xfc, 0x04, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xfb, 0xfb, 0x08, 0xc0, 0xa9, 0x9a, 0xcc, 0xb3, 0x96, 0x85, 0xff, 0xab, 0x8c, 0x7a, 0xff, 0xac, 0x8e, 0x7c, 0xff, 0xb1, 0x96, 0x85, 0xff, 0xdc, 0xd1, 0xca, 0x4b, 0xff, 0xff, 0xfe, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xfb, 0xfa, 0x07, 0xc1, 0xaf, 0xa2, 0x88, 0xa8, 0x8d, 0x7b, 0xff, 0xa5, 0x8b, 0x79, 0xff, 0xa5, 0x8b, 0x7a, 0xff, 0xa3, 0x8a, 0x78, 0xff, 0xa3, 0x8a, 0x78, 0xff, 0xa2, 0x89, 0x78, 0xff, 0xa0, 0x88, 0x76, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x9e, 0x87, 0x74, 0xff, 0x9e, 0x86, 0x73, 0xff, 0x9e, 0x86, 0x74, 0xff, 0x9d, 0x86, 0x74, 0xff, 0x9b, 0x84, 0x72, 0xff, 0x9a, 0x82, 0x71, 0xff, 0x98, 0x81, 0x70, 0xff, 0x98, 0x81, 0x70, 0xff, 0x98, 0x81, 0x70, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x93, 0x7d, 0x6c, 0xff, 0x92, 0x7c, 0x6c, 0xff, 0x91, 0x7c, 0x6a, 0xff, 0x91, 0x7b, 0x6a, 0xff, 0x91, 0x7b, 0x6a, 0xff, 0x91, 0x7b, 0x6a, 0xff, 0x90, 0x7b, 0x6a, 0xff, 0x8e, 0x7a, 0x68, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x8a, 0x77, 0x65, 0xff, 0x8a, 0x76, 0x64, 0xff, 0x8a, 0x76, 0x64, 0xff, 0x89, 0x75, 0x63, 0xff, 0x87, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x85, 0x73, 0x61, 0xf7, 0x83, 0x70, 0x5d, 0xff, 0x90, 0x7f, 0x6f, 0xff, 0xb1, 0xa5, 0x9a, 0x83, 0xfb, 0xfb, 0xfa, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xef, 0xee, 0xeb, 0x0c, 0x98, 0x8a, 0x7b, 0xff, 0x82, 0x71, 0x5f, 0xff, 0x79, 0x67, 0x54, 0xfb, 0x7d, 0x6c, 0x58, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x58, 0xf7, 0x75, 0x64, 0x50, 0xff, 0x7e, 0x6f, 0x5d, 0xff, 0x9d, 0x92, 0x85, 0xbf, 0xfa, 0xfa, 0xf9, 0x07, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xfb, 0xfb, 0x08, 0xc2, 0xab, 0x9d, 0xc8, 0xb3, 0x97, 0x85, 0xff, 0xaf, 0x91, 0x7f, 0xff, 0xaf, 0x92, 0x81, 0xf8, 0xac, 0x8e, 0x7e, 0xf8, 0xac, 0x8d, 0x7c, 0xff, 0xb0, 0x94, 0x83, 0xff, 0xc8, 0xb4, 0xa8, 0xbb, 0xf7, 0xf5, 0xf4, 0x18, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x03, 0xcc, 0xbd, 0xb3, 0x78, 0xae, 0x96, 0x86, 0xff, 0xa7, 0x8d, 0x7b, 0xff, 0xa6, 0x8c, 0x79, 0xff, 0xa6, 0x8c, 0x7c, 0xf8, 0xa5, 0x8b, 0x7a, 0xff, 0xa4, 0x8a, 0x79, 0xff, 0xa3, 0x8a, 0x79, 0xff, 0xa1, 0x89, 0x78, 0xff, 0xa1, 0x88, 0x77, 0xff, 0xa0, 0x88, 0x76, 0xff, 0xa0, 0x88, 0x75, 0xff, 0xa0, 0x88, 0x75, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x9d, 0x86, 0x73, 0xff, 0x9c, 0x85, 0x73, 0xff, 0x9b, 0x84, 0x72, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x90, 0x7b, 0x69, 0xff, 0x8f, 0x7a, 0x68, 0xff, 0x95, 0x7f, 0x6e, 0xff, 0x97, 0x81, 0x70, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x93, 0x7d, 0x6c, 0xff, 0x8e, 0x79, 0x68, 0xff, 0x89, 0x76, 0x64, 0xff, 0x8a, 0x76, 0x65, 0xff, 0x8e, 0x78, 0x67, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x8d, 0x7a, 0x67, 0xff, 0x8e, 0x79, 0x67, 0xff, 0x8d, 0x78, 0x66, 0xff, 0x8b, 0x78, 0x66, 0xff, 0x8a, 0x77, 0x65, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x89, 0x75, 0x63, 0xff, 0x87, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x61, 0xff, 0x84, 0x72, 0x5f, 0xf7, 0x83, 0x70, 0x5e, 0xff, 0x85, 0x73, 0x61, 0xff, 0x8e, 0x7d, 0x6d, 0xff, 0xca, 0xc3, 0xbb, 0x6b, 0xdf, 0xdb, 0xd7, 0x2c, 0x8c, 0x7e, 0x6e, 0xf7, 0x80, 0x6f, 0x5d, 0xff, 0x7a, 0x67, 0x54, 0xff, 0x7e, 0x6d, 0x5a, 0xfb, 0x80, 0x6f, 0x5c, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7c, 0x6b, 0x58, 0xf7, 0x73, 0x62, 0x4f, 0xff, 0x7f, 0x6f, 0x5d, 0xff, 0xac, 0xa2, 0x96, 0xa7, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0xc9, 0xb4, 0xa9, 0x9f, 0xb4, 0x97, 0x86, 0xff, 0xaf, 0x90, 0x7e, 0xff, 0xb0, 0x93, 0x82, 0xf8, 0xb0, 0x93, 0x82, 0xff, 0xaf, 0x92, 0x81, 0xff, 0xae, 0x90, 0x80, 0xf8, 0xac, 0x8e, 0x7c, 0xff, 0xaf, 0x93, 0x83, 0xff, 0xc0, 0xaa, 0x9e, 0xe7, 0xf0, 0xeb, 0xe8, 0x20, 0xfb, 0xfa, 0xfa, 0x07, 0xc9, 0xba, 0xaf, 0x77, 0xae, 0x96, 0x86, 0xff, 0xa5, 0x8b, 0x77, 0xff, 0xa5, 0x8c, 0x79, 0xff, 0xa7, 0x8e, 0x7d, 0xf8, 0xa6, 0x8c, 0x7b, 0xff, 0xa5, 0x8b, 0x7a, 0xff, 0xa5, 0x8a, 0x7a, 0xff, 0xa3, 0x8a, 0x79, 0xff, 0xa1, 0x89, 0x77, 0xff, 0xa1, 0x89, 0x77, 0xff, 0xa2, 0x89, 0x77, 0xff, 0xa3, 0x8a, 0x78, 0xff, 0xa0, 0x88, 0x76, 0xff, 0x98, 0x81, 0x6f, 0xff, 0x8f, 0x7b, 0x68, 0xff, 0x86, 0x74, 0x61, 0xff, 0x7f, 0x6d, 0x5a, 0xff, 0x79, 0x6a, 0x57, 0xff, 0x74, 0x66, 0x53, 0xff, 0x7b, 0x6b, 0x58, 0xff, 0x90, 0x7b, 0x6a, 0xff, 0x98, 0x82, 0x70, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x91, 0x7c, 0x6a, 0xff, 0x85, 0x73, 0x61, 0xff, 0x78, 0x69, 0x55, 0xff, 0x74, 0x65, 0x52, 0xff, 0x78, 0x68, 0x55, 0xff, 0x7c, 0x6c, 0x58, 0xff, 0x81, 0x70, 0x5d, 0xff, 0x85, 0x73, 0x61, 0xff, 0x8a, 0x76, 0x64, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x8b, 0x78, 0x66, 0xff, 0x8a, 0x76, 0x64, 0xff, 0x89, 0x75, 0x63, 0xff, 0x87, 0x74, 0x62, 0xff, 0x85, 0x74, 0x62, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x83, 0x72, 0x60, 0xf7, 0x7e, 0x6b, 0x58, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x91, 0x82, 0x72, 0xff, 0x90, 0x81, 0x71, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x7b, 0x69, 0x57, 0xff, 0x7f, 0x6d, 0x5b, 0xfb, 0x7f, 0x6e, 0x5b, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x79, 0x68, 0x54, 0xf7, 0x76, 0x65, 0x52, 0xff, 0x97, 0x89, 0x7b, 0xe3, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfd, 0xfd, 0x08, 0xbb, 0xa2, 0x94, 0xd7, 0xad, 0x8f, 0x7d, 0xff, 0xaf, 0x92, 0x81, 0xf8, 0xb0, 0x93, 0x82, 0xff, 0xaf, 0x92, 0x81, 0xff, 0xaf, 0x92, 0x81, 0xff, 0xae, 0x91, 0x80, 0xff, 0xae, 0x90, 0x7f, 0xfc, 0xaa, 0x8d, 0x7c, 0xff, 0xaa, 0x90, 0x7e, 0xff, 0xac, 0x92, 0x81, 0xff, 0xab, 0x91, 0x7f, 0xff, 0xaa, 0x90, 0x7e, 0xff, 0xa6, 0x8c, 0x79, 0xff, 0xa6, 0x8d, 0x7a, 0xf8, 0xa8, 0x8e, 0x7c, 0xff, 0xa7, 0x8d, 0x7c, 0xff, 0xa6, 0x8c, 0x7b, 0xff, 0xa5, 0x8b, 0x7a, 0xff, 0xa4, 0x8a, 0x7a, 0xff, 0xa5, 0x8b, 0x7a, 0xff, 0xa5, 0x8c, 0x7a, 0xff, 0xa1, 0x89, 0x77, 0xff, 0x9a, 0x83, 0x71, 0xff, 0x92, 0x7d, 0x6b, 0xff, 0x89, 0x76, 0x64, 0xff, 0x81, 0x70, 0x5d, 0xff, 0x7a, 0x6b, 0x57, 0xff, 0x73, 0x64, 0x50, 0xff, 0x6b, 0x5e, 0x49, 0xff, 0x69, 0x5d, 0x49, 0xff, 0x66, 0x5b, 0x47, 0xff, 0x71, 0x63, 0x51, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x99, 0x82, 0x70, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x91, 0x7c, 0x69, 0xff, 0x81, 0x70, 0x5c, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x67, 0x5c, 0x47, 0xff, 0x6a, 0x5e, 0x49, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x72, 0x63, 0x4f, 0xff, 0x77, 0x68, 0x54, 0xff, 0x7b, 0x6c, 0x58, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x85, 0x71, 0x60, 0xff, 0x89, 0x75, 0x63, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x89, 0x76, 0x64, 0xff, 0x87, 0x74, 0x62, 0xff, 0x85, 0x74, 0x62, 0xff, 0x85, 0x73, 0x61, 0xff, 0x84, 0x72, 0x60, 0xff, 0x84, 0x72, 0x60, 0xff, 0x84, 0x72, 0x60, 0xff, 0x80, 0x6e, 0x5c, 0xfb, 0x7c, 0x6a, 0x57, 0xff, 0x7d, 0x6b, 0x57, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x80, 0x6e, 0x5c, 0xfb, 0x80, 0x6e, 0x5c, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x78, 0x68, 0x53, 0xff, 0x7b, 0x6b, 0x59, 0xff, 0x9c, 0x90, 0x85, 0xb8, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x07, 0xbb, 0xa2, 0x94, 0xc4, 0xac, 0x8e, 0x7c, 0xff, 0xae, 0x91, 0x7f, 0xfc, 0xaf, 0x92, 0x81, 0xff, 0xae, 0x91, 0x80, 0xff, 0xae, 0x91, 0x80, 0xff, 0xae, 0x90, 0x7f, 0xff, 0xae, 0x90, 0x7f, 0xff, 0xac, 0x91, 0x7f, 0xfc, 0xa9, 0x8f, 0x7d, 0xff, 0xaa, 0x8f, 0x7d, 0xff, 0xaa, 0x90, 0x7e, 0xff, 0xa8, 0x8e, 0x7b, 0xff, 0xa8, 0x8e, 0x7c, 0xfb, 0xa8, 0x8e, 0x7d, 0xff, 0xa7, 0x8d, 0x7b, 0xff, 0xa6, 0x8d, 0x7b, 0xff, 0xa6, 0x8c, 0x7b, 0xff, 0xa6, 0x8c, 0x7b, 0xff, 0xa5, 0x8c, 0x7b, 0xff, 0xa2, 0x89, 0x78, 0xff, 0x9c, 0x85, 0x74, 0xff, 0x92, 0x7d, 0x6b, 0xff, 0x84, 0x72, 0x5f, 0xff, 0x75, 0x66, 0x53, 0xff, 0x6b, 0x5f, 0x4c, 0xff, 0x6b, 0x5f, 0x4b, 0xff, 0x6d, 0x61, 0x4c, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x6b, 0x5e, 0x4a, 0xff, 0x74, 0x65, 0x52, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x98, 0x82, 0x70, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x91, 0x7c, 0x6a, 0xff, 0x83, 0x71, 0x5e, 0xff, 0x71, 0x63, 0x4e, 0xff, 0x6a, 0x5e, 0x48, 0xff, 0x6b, 0x5e, 0x49, 0xff, 0x6b, 0x5f, 0x49, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6d, 0x61, 0x4c, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x76, 0x66, 0x53, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x85, 0x73, 0x61, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x87, 0x74, 0x62, 0xff, 0x85, 0x73, 0x61, 0xff, 0x84, 0x72, 0x60, 0xff, 0x84, 0x72, 0x60, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x80, 0x6e, 0x5b, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x80, 0x6f, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6d, 0x5c, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7c, 0x6b, 0x57, 0xff, 0x77, 0x65, 0x52, 0xff, 0x80, 0x72, 0x65, 0xff, 0xa9, 0xa2, 0x9d, 0xbb, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xd5, 0xc6, 0xbe, 0x6f, 0xb0, 0x94, 0x83, 0xff, 0xab, 0x8d, 0x7c, 0xff, 0xae, 0x91, 0x80, 0xfc, 0xae, 0x91, 0x80, 0xff, 0xae, 0x91, 0x80, 0xff, 0xad, 0x90, 0x7f, 0xff, 0xac, 0x91, 0x7f, 0xff, 0xab, 0x91, 0x7f, 0xff, 0xaa, 0x91, 0x7f, 0xff, 0xaa, 0x90, 0x7e, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa9, 0x8e, 0x7c, 0xff, 0xa9, 0x8e, 0x7d, 0xff, 0xa8, 0x8e, 0x7d, 0xff, 0xa7, 0x8d, 0x7c, 0xff, 0xa6, 0x8d, 0x7b, 0xff, 0xa6, 0x8d, 0x7b, 0xff, 0xa7, 0x8d, 0x7b, 0xff, 0xa2, 0x88, 0x77, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x74, 0x65, 0x51, 0xff, 0x6f, 0x62, 0x4d, 0xff, 0x6d, 0x5f, 0x4b, 0xff, 0x6a, 0x5d, 0x4a, 0xff, 0x6b, 0x5f, 0x4b, 0xff, 0x6c, 0x60, 0x4c, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6f, 0x61, 0x4d, 0xff, 0x6c, 0x5e, 0x4a, 0xff, 0x75, 0x65, 0x52, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x98, 0x82, 0x70, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x84, 0x71, 0x5f, 0xff, 0x71, 0x63, 0x4e, 0xff, 0x6a, 0x5d, 0x47, 0xff, 0x6b, 0x5e, 0x48, 0xff, 0x6b, 0x5e, 0x49, 0xff, 0x6b, 0x5e, 0x4a, 0xff, 0x6c, 0x5f, 0x4b, 0xff, 0x6c, 0x60, 0x4c, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x71, 0x63, 0x50, 0xff, 0x74, 0x66, 0x53, 0xff, 0x78, 0x68, 0x55, 0xff, 0x7d, 0x6c, 0x5a, 0xff, 0x84, 0x71, 0x5f, 0xff, 0x86, 0x74, 0x62, 0xff, 0x85, 0x73, 0x61, 0xff, 0x84, 0x72, 0x60, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7b, 0x69, 0x55, 0xff, 0x78, 0x67, 0x57, 0xff, 0x84, 0x79, 0x75, 0xff, 0xdf, 0xdd, 0xde, 0x28, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x0b, 0xce, 0xbe, 0xb4, 0x8f, 0xab, 0x8d, 0x7c, 0xff, 0xac, 0x8e, 0x7c, 0xff, 0xaf, 0x92, 0x81, 0xfc, 0xae, 0x91, 0x80, 0xff, 0xad, 0x91, 0x7f, 0xff, 0xab, 0x91, 0x7f, 0xff, 0xab, 0x91, 0x7f, 0xff, 0xaa, 0x90, 0x7e, 0xff, 0xaa, 0x90, 0x7e, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa9, 0x8f, 0x7c, 0xff, 0xa9, 0x8e, 0x7c, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xa9, 0x8f, 0x7e, 0xff, 0xa5, 0x8c, 0x7b, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x85, 0x72, 0x60, 0xff, 0x77, 0x67, 0x54, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x69, 0x5e, 0x49, 0xff, 0x6b, 0x5e, 0x4a, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6f, 0x62, 0x4d, 0xff, 0x6f, 0x62, 0x4d, 0xff, 0x6e, 0x60, 0x4b, 0xff, 0x6c, 0x5d, 0x49, 0xff, 0x6a, 0x5b, 0x4a, 0xff, 0x6e, 0x61, 0x53, 0xff, 0x74, 0x69, 0x60, 0xff, 0x7c, 0x6f, 0x66, 0xff, 0x8f, 0x7a, 0x6a, 0xfb, 0x98, 0x81, 0x6f, 0xfb, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x97, 0x80, 0x6e, 0xff, 0x8e, 0x79, 0x69, 0xff, 0x78, 0x66, 0x5a, 0xfb, 0x63, 0x57, 0x4c, 0xff, 0x69, 0x5e, 0x52, 0xff, 0x76, 0x6b, 0x5b, 0xff, 0x73, 0x67, 0x55, 0xff, 0x6a, 0x5d, 0x4a, 0xff, 0x67, 0x58, 0x43, 0xff, 0x6b, 0x5d, 0x47, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x73, 0x64, 0x51, 0xff, 0x73, 0x64, 0x52, 0xff, 0x73, 0x64, 0x52, 0xff, 0x77, 0x67, 0x55, 0xff, 0x7b, 0x6a, 0x58, 0xff, 0x7f, 0x6e, 0x5c, 0xff, 0x82, 0x71, 0x5f, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x58, 0xff, 0x76, 0x66, 0x53, 0xff, 0x7a, 0x6e, 0x66, 0xff, 0x9f, 0x98, 0x9a, 0xd3, 0xfe, 0xfe, 0xfe, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfd, 0xfd, 0x0b, 0xcc, 0xba, 0xaf, 0x8f, 0xac, 0x8e, 0x7d, 0xff, 0xab, 0x8d, 0x7b, 0xff, 0xad, 0x92, 0x80, 0xff, 0xac, 0x91, 0x7f, 0xff, 0xab, 0x91, 0x7f, 0xff, 0xaa, 0x90, 0x7e, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xaa, 0x90, 0x7e, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa8, 0x8e, 0x7d, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xaa, 0x8f, 0x7d, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa0, 0x88, 0x77, 0xff, 0x90, 0x7b, 0x69, 0xff, 0x7c, 0x6c, 0x58, 0xff, 0x6c, 0x60, 0x4c, 0xff, 0x68, 0x5d, 0x49, 0xff, 0x6c, 0x60, 0x4c, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6f, 0x61, 0x4c, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x6a, 0x5d, 0x4a, 0xff, 0x6c, 0x5e, 0x4e, 0xff, 0x6f, 0x62, 0x55, 0xff, 0x7c, 0x71, 0x67, 0xff, 0x91, 0x87, 0x80, 0xff, 0xa8, 0xa1, 0x9c, 0x97, 0xdb, 0xd9, 0xd9, 0x13, 0xc9, 0xc3, 0xc2, 0x2b, 0x9c, 0x88, 0x7c, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x96, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x97, 0x81, 0x6e, 0xff, 0x89, 0x74, 0x65, 0xfb, 0x71, 0x62, 0x5a, 0xff, 0x72, 0x68, 0x68, 0xff, 0xac, 0xa7, 0xa6, 0x63, 0xd9, 0xd5, 0xd2, 0x18, 0xd8, 0xd5, 0xd0, 0x14, 0xc2, 0xbc, 0xb5, 0x30, 0x95, 0x8b, 0x7d, 0xff, 0x85, 0x79, 0x68, 0xff, 0x72, 0x63, 0x50, 0xff, 0x6e, 0x5d, 0x4a, 0xff, 0x71, 0x60, 0x4d, 0xff, 0x75, 0x64, 0x52, 0xfb, 0x77, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x79, 0x68, 0x56, 0xff, 0x7e, 0x6d, 0x5b, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x85, 0x73, 0x61, 0xff, 0x84, 0x72, 0x60, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7f, 0x6d, 0x5a, 0xff, 0x79, 0x68, 0x55, 0xfb, 0x71, 0x64, 0x5a, 0xff, 0x7e, 0x76, 0x78, 0xff, 0xe3, 0xe2, 0xe4, 0x1c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfa, 0xf8, 0xf7, 0x13, 0xb5, 0x9c, 0x8c, 0xff, 0xab, 0x8f, 0x7d, 0xff, 0xab, 0x91, 0x7e, 0xfc, 0xab, 0x91, 0x7f, 0xff, 0xaa, 0x90, 0x7e, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xaa, 0x90, 0x7e, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa1, 0x87, 0x76, 0xff, 0x86, 0x74, 0x61, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x6c, 0x60, 0x4c, 0xff, 0x6c, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6e, 0x60, 0x4d, 0xff, 0x6d, 0x5f, 0x4b, 0xfb, 0x6e, 0x60, 0x4d, 0xff, 0x6f, 0x62, 0x51, 0xff, 0x74, 0x68, 0x5d, 0xff, 0x80, 0x77, 0x73, 0xff, 0x8f, 0x88, 0x88, 0xff, 0xd0, 0xcc, 0xcd, 0x28, 0xef, 0xed, 0xed, 0x0f, 0xfd, 0xfc, 0xfd, 0x04, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfd, 0xfd, 0x00, 0xae, 0x9d, 0x90, 0xff, 0x97, 0x81, 0x70, 0xff, 0x94, 0x7d, 0x6b, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x96, 0x7f, 0x6d, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x86, 0x72, 0x62, 0xff, 0x7d, 0x6f, 0x67, 0xff, 0xa9, 0xa3, 0xa4, 0xb3, 0xfe, 0xfe, 0xff, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfa, 0xfa, 0xf9, 0x07, 0xd1, 0xcd, 0xc7, 0x37, 0x98, 0x8d, 0x81, 0xff, 0x83, 0x75, 0x66, 0xff, 0x79, 0x6a, 0x57, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x65, 0x53, 0xff, 0x77, 0x67, 0x55, 0xfb, 0x7a, 0x6a, 0x57, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7f, 0x6d, 0x59, 0xff, 0x71, 0x60, 0x52, 0xff, 0x76, 0x6a, 0x68, 0xff, 0xaa, 0xa6, 0xa9, 0x9c, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xec, 0xe6, 0xe2, 0x28, 0xb5, 0x9d, 0x8d, 0xff, 0xa9, 0x8f, 0x7c, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xac, 0x91, 0x7f, 0xff, 0xaa, 0x90, 0x7e, 0xff, 0x9c, 0x84, 0x72, 0xff, 0x82, 0x70, 0x5d, 0xff, 0x6f, 0x62, 0x4d, 0xff, 0x6a, 0x5f, 0x4a, 0xff, 0x6c, 0x60, 0x4c, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x70, 0x61, 0x4d, 0xff, 0x6e, 0x5f, 0x4a, 0xfb, 0x6d, 0x5e, 0x4d, 0xff, 0x70, 0x65, 0x5d, 0xff, 0x84, 0x7c, 0x7a, 0xff, 0xbd, 0xb9, 0xb8, 0x54, 0xea, 0xe8, 0xe8, 0x0f, 0xef, 0xef, 0xf0, 0x0b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfa, 0xf9, 0xf9, 0x04, 0xb2, 0xa1, 0x94, 0xff, 0x98, 0x82, 0x70, 0xff, 0x93, 0x7d, 0x6b, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6c, 0xff, 0x87, 0x74, 0x64, 0xff, 0x86, 0x78, 0x70, 0xff, 0xeb, 0xe9, 0xe8, 0x13, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0xf0, 0xef, 0x0c, 0xf0, 0xee, 0xec, 0x0b, 0xba, 0xb2, 0xa9, 0x4f, 0x85, 0x76, 0x66, 0xff, 0x77, 0x67, 0x54, 0xff, 0x78, 0x67, 0x54, 0xff, 0x7c, 0x6b, 0x57, 0xfb, 0x7d, 0x6c, 0x59, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x81, 0x6e, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x58, 0xff, 0x74, 0x63, 0x54, 0xff, 0x86, 0x7b, 0x75, 0xff, 0xf3, 0xf2, 0xf2, 0x0f, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xfb, 0xfb, 0x0c, 0xb4, 0x9e, 0x8e, 0xff, 0xa7, 0x8d, 0x7a, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xac, 0x91, 0x7f, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0x99, 0x83, 0x70, 0xff, 0x81, 0x6f, 0x5c, 0xff, 0x6d, 0x61, 0x4c, 0xff, 0x69, 0x5e, 0x49, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6f, 0x62, 0x4e, 0xff, 0x6e, 0x60, 0x4b, 0xfb, 0x6b, 0x5d, 0x4c, 0xff, 0x6f, 0x63, 0x57, 0xff, 0x7f, 0x76, 0x71, 0xff, 0xb9, 0xb4, 0xb4, 0x40, 0xf3, 0xf3, 0xf4, 0x07, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfa, 0xf9, 0xf8, 0x04, 0xb0, 0x9e, 0x92, 0xff, 0x98, 0x82, 0x71, 0xff, 0x93, 0x7d, 0x6b, 0xff, 0x95, 0x7e, 0x6c, 0xff, 0x95, 0x7e, 0x6c, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x8a, 0x76, 0x67, 0xff, 0x88, 0x7a, 0x72, 0xff, 0xf7, 0xf7, 0xf6, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0xf0, 0xee, 0xec, 0x08, 0xb8, 0xae, 0xa5, 0x5f, 0x8b, 0x7c, 0x6c, 0xff, 0x77, 0x64, 0x51, 0xff, 0x7b, 0x69, 0x56, 0xff, 0x80, 0x6e, 0x5c, 0xfb, 0x80, 0x6e, 0x5c, 0xff, 0x81, 0x6e, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x77, 0x66, 0x53, 0xff, 0x8d, 0x80, 0x72, 0xff, 0xf4, 0xf2, 0xf1, 0x0f, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x03, 0xc9, 0xb8, 0xac, 0x9f, 0xac, 0x93, 0x82, 0xff, 0xa7, 0x8d, 0x7a, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xa9, 0x8e, 0x7c, 0xff, 0xab, 0x90, 0x7e, 0xff, 0xaa, 0x8f, 0x7d, 0xff, 0x99, 0x82, 0x6f, 0xff, 0x7e, 0x6e, 0x5a, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6c, 0x5f, 0x4b, 0xff, 0x6f, 0x62, 0x4e, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x6e, 0x60, 0x4b, 0xf7, 0x6c, 0x5f, 0x4f, 0xff, 0x75, 0x6b, 0x63, 0xff, 0x8b, 0x85, 0x85, 0xff, 0xc4, 0xc1, 0xc3, 0x44, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfa, 0xf9, 0xf8, 0x04, 0xb0, 0x9f, 0x92, 0xff, 0x98, 0x82, 0x71, 0xff, 0x93, 0x7d, 0x6b, 0xff, 0x95, 0x7f, 0x6c, 0xff, 0x95, 0x7f, 0x6c, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x8a, 0x77, 0x68, 0xff, 0x8a, 0x7c, 0x74, 0xff, 0xf5, 0xf5, 0xf4, 0x04, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xc0, 0xb8, 0xaf, 0x60, 0x91, 0x83, 0x73, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7e, 0x6b, 0x58, 0xff, 0x81, 0x70, 0x5e, 0xf7, 0x83, 0x71, 0x5f, 0xff, 0x84, 0x72, 0x60, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x78, 0x67, 0x53, 0xff, 0x83, 0x73, 0x61, 0xff, 0xab, 0xa0, 0x95, 0xb3, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf6, 0xf4, 0xf2, 0x18, 0xae, 0x96, 0x85, 0xff, 0xa6, 0x8c, 0x79, 0xff, 0xa8, 0x8e, 0x7c, 0xfc, 0xa8, 0x8e, 0x7c, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xab, 0x90, 0x7e, 0xff, 0xaa, 0x8f, 0x7d, 0xff, 0x9a, 0x83, 0x71, 0xff, 0x7e, 0x6e, 0x5b, 0xff, 0x6c, 0x60, 0x4c, 0xff, 0x6c, 0x5f, 0x4c, 0xff, 0x6f, 0x62, 0x4e, 0xff, 0x71, 0x63, 0x4e, 0xff, 0x6f, 0x60, 0x4c, 0xf4, 0x6e, 0x60, 0x52, 0xff, 0x78, 0x6f, 0x6c, 0xff, 0xa8, 0xa4, 0xa6, 0x88, 0xf3, 0xf3, 0xf3, 0x0f, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfa, 0xf9, 0xf8, 0x04, 0xb0, 0x9f, 0x92, 0xff, 0x98, 0x82, 0x70, 0xff, 0x93, 0x7d, 0x6b, 0xff, 0x95, 0x7f, 0x6c, 0xff, 0x95, 0x7f, 0x6c, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x8a, 0x77, 0x68, 0xff, 0x8b, 0x7c, 0x75, 0xff, 0xf6, 0xf5, 0xf4, 0x04, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xeb, 0xe8, 0xe6, 0x1f, 0x9e, 0x91, 0x83, 0xc0, 0x82, 0x70, 0x5f, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x83, 0x72, 0x60, 0xf7, 0x85, 0x74, 0x61, 0xff, 0x87, 0x75, 0x62, 0xff, 0x84, 0x72, 0x60, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7c, 0x6b, 0x57, 0xfb, 0x77, 0x66, 0x52, 0xff, 0x81, 0x71, 0x5f, 0xff, 0xf3, 0xf2, 0xf0, 0x0b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x03, 0xd5, 0xd1, 0xcc, 0x44, 0xa5, 0x9c, 0x8f, 0x7c, 0x99, 0x8d, 0x7f, 0x70, 0x90, 0x84, 0x75, 0x87, 0xde, 0xda, 0xd5, 0x20, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfc, 0xfc, 0x0b, 0xfd, 0xfc, 0xfc, 0x0b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfc, 0xfc, 0x04, 0xba, 0xa6, 0x97, 0xb0, 0xa7, 0x8d, 0x7b, 0xff, 0xa6, 0x8c, 0x7a, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0xaa, 0x8f, 0x7d, 0xff, 0x9d, 0x86, 0x73, 0xff, 0x80, 0x6f, 0x5c, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6c, 0x5f, 0x4b, 0xff, 0x6f, 0x62, 0x4e, 0xff, 0x71, 0x63, 0x4d, 0xff, 0x6d, 0x5f, 0x4d, 0xf4, 0x6b, 0x5e, 0x53, 0xff, 0x83, 0x7b, 0x7a, 0xff, 0xbf, 0xbb, 0xbd, 0x4f, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfa, 0xf9, 0xf8, 0x04, 0xaf, 0x9f, 0x91, 0xff, 0x97, 0x81, 0x70, 0xff, 0x94, 0x7d, 0x6a, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x94, 0x7e, 0x6d, 0xff, 0x93, 0x7d, 0x6b, 0xff, 0x8a, 0x77, 0x68, 0xff, 0x8b, 0x7d, 0x75, 0xff, 0xf6, 0xf5, 0xf5, 0x04, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfd, 0xfc, 0x00, 0xb1, 0xa6, 0x9b, 0x70, 0x8e, 0x7d, 0x6c, 0xff, 0x81, 0x6e, 0x5c, 0xff, 0x85, 0x73, 0x61, 0xf7, 0x89, 0x77, 0x64, 0xff, 0x89, 0x77, 0x64, 0xff, 0x85, 0x73, 0x61, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x77, 0x66, 0x52, 0xff, 0x77, 0x67, 0x54, 0xfb, 0x9c, 0x90, 0x83, 0xac, 0xb7, 0xae, 0xa5, 0x80, 0xb9, 0xb0, 0xa7, 0x80, 0xaf, 0xa6, 0x9b, 0x78, 0xa0, 0x95, 0x88, 0x9b, 0x8c, 0x7f, 0x70, 0xff, 0x7d, 0x6e, 0x5d, 0xff, 0x73, 0x63, 0x50, 0xff, 0x70, 0x60, 0x4c, 0xff, 0x8d, 0x81, 0x72, 0xff, 0xf0, 0xef, 0xed, 0x13, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xee, 0xe9, 0xe6, 0x23, 0xb3, 0x9d, 0x8f, 0xf3, 0xb5, 0xa0, 0x92, 0xe8, 0xdb, 0xd1, 0xca, 0x64, 0xfc, 0xfb, 0xfa, 0x0b, 0xfe, 0xfe, 0xfe, 0x00, 0xfe, 0xfd, 0xfd, 0x03, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x04, 0xc7, 0xb6, 0xaa, 0x94, 0xa5, 0x8b, 0x79, 0xff, 0xa5, 0x8b, 0x78, 0xff, 0xa9, 0x8f, 0x7d, 0xfc, 0xa8, 0x8e, 0x7c, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xab, 0x90, 0x7e, 0xff, 0x9f, 0x87, 0x74, 0xff, 0x84, 0x73, 0x5f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6b, 0x5e, 0x4b, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x70, 0x63, 0x4d, 0xff, 0x6c, 0x5e, 0x4b, 0xf4, 0x6c, 0x60, 0x55, 0xff, 0x84, 0x7c, 0x7d, 0xff, 0xc0, 0xbd, 0xc1, 0x54, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfa, 0xf9, 0xf8, 0x04, 0xaf, 0x9f, 0x91, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x93, 0x7c, 0x6a, 0xff, 0x95, 0x7f, 0x6c, 0xff, 0x93, 0x7e, 0x6c, 0xff, 0x92, 0x7c, 0x6a, 0xff, 0x8a, 0x76, 0x68, 0xff, 0x8c, 0x7d, 0x75, 0xff, 0xf6, 0xf5, 0xf5, 0x04, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0xb6, 0xab, 0xa0, 0x77, 0x90, 0x7e, 0x6d, 0xff, 0x85, 0x72, 0x5f, 0xff, 0x89, 0x76, 0x64, 0xf7, 0x8d, 0x79, 0x67, 0xff, 0x8b, 0x77, 0x66, 0xff, 0x85, 0x72, 0x60, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7d, 0x6d, 0x59, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7d, 0x6b, 0x58, 0xff, 0x7b, 0x6a, 0x58, 0xfb, 0x7a, 0x6a, 0x57, 0xff, 0x7b, 0x6b, 0x59, 0xff, 0x83, 0x74, 0x63, 0xff, 0x83, 0x75, 0x64, 0xff, 0x7a, 0x6b, 0x59, 0xff, 0x73, 0x62, 0x50, 0xff, 0x70, 0x5f, 0x4c, 0xf7, 0x76, 0x66, 0x54, 0xe7, 0x77, 0x67, 0x56, 0xe8, 0x74, 0x65, 0x52, 0xe7, 0x77, 0x69, 0x57, 0xff, 0x9a, 0x90, 0x82, 0xff, 0xf9, 0xf9, 0xf8, 0x07, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf8, 0xf7, 0xf6, 0x10, 0xad, 0x96, 0x86, 0xff, 0xa1, 0x87, 0x75, 0xff, 0xa6, 0x8c, 0x7b, 0xff, 0xaa, 0x91, 0x80, 0xff, 0xa9, 0x8f, 0x7f, 0xe3, 0xa9, 0x91, 0x7f, 0xcc, 0xb5, 0x9f, 0x90, 0xcf, 0xc8, 0xb7, 0xae, 0xac, 0xc0, 0xad, 0xa0, 0xd4, 0xaf, 0x98, 0x87, 0xff, 0xa5, 0x8b, 0x79, 0xff, 0xa6, 0x8c, 0x7b, 0xf8, 0xa8, 0x8e, 0x7c, 0xff, 0xa7, 0x8d, 0x7c, 0xff, 0xa7, 0x8d, 0x7b, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0xa4, 0x8a, 0x78, 0xff, 0x8a, 0x77, 0x63, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6a, 0x5e, 0x4b, 0xff, 0x6f, 0x62, 0x4e, 0xff, 0x71, 0x63, 0x4e, 0xff, 0x6e, 0x60, 0x4d, 0xf4, 0x6a, 0x5e, 0x53, 0xff, 0x85, 0x7e, 0x7e, 0xff, 0xc5, 0xc2, 0xc6, 0x4f, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfa, 0xf9, 0xf8, 0x04, 0xb0, 0x9f, 0x92, 0xff, 0x97, 0x81, 0x70, 0xff, 0x92, 0x7c, 0x6a, 0xff, 0x93, 0x7e, 0x6b, 0xff, 0x93, 0x7e, 0x6b, 0xff, 0x92, 0x7c, 0x6a, 0xff, 0x8a, 0x76, 0x67, 0xff, 0x8c, 0x7e, 0x76, 0xff, 0xf6, 0xf5, 0xf5, 0x04, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0xb5, 0xa9, 0x9d, 0x77, 0x93, 0x81, 0x70, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x8d, 0x79, 0x68, 0xf7, 0x8f, 0x7a, 0x69, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x84, 0x72, 0x5f, 0xff, 0x7e, 0x6d, 0x59, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7c, 0x6a, 0x58, 0xff, 0x7a, 0x6a, 0x58, 0xff, 0x77, 0x67, 0x54, 0xff, 0x74, 0x64, 0x51, 0xff, 0x73, 0x62, 0x4f, 0xff, 0x72, 0x61, 0x4f, 0xff, 0x72, 0x62, 0x50, 0xff, 0x74, 0x64, 0x52, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x66, 0x54, 0xff, 0x75, 0x66, 0x53, 0xff, 0x6c, 0x5d, 0x49, 0xff, 0x84, 0x77, 0x67, 0xff, 0xe8, 0xe6, 0xe4, 0x18, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xdd, 0xd4, 0xcd, 0x50, 0xa8, 0x8f, 0x7e, 0xff, 0xa0, 0x85, 0x72, 0xff, 0xa4, 0x8a, 0x7a, 0xf8, 0xa2, 0x87, 0x76, 0xff, 0xa2, 0x89, 0x77, 0xff, 0xa4, 0x8a, 0x79, 0xff, 0xa8, 0x8e, 0x7d, 0xff, 0xac, 0x93, 0x83, 0xff, 0xab, 0x92, 0x81, 0xff, 0xa7, 0x8c, 0x7b, 0xff, 0xa6, 0x8c, 0x7c, 0xf8, 0xa6, 0x8c, 0x7b, 0xff, 0xa7, 0x8c, 0x7b, 0xff, 0xa5, 0x8c, 0x7b, 0xff, 0xa7, 0x8e, 0x7d, 0xff, 0xa7, 0x8c, 0x7b, 0xff, 0x90, 0x7b, 0x69, 0xff, 0x75, 0x66, 0x53, 0xff, 0x6b, 0x5f, 0x4b, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x71, 0x64, 0x4f, 0xff, 0x6f, 0x60, 0x4c, 0xf8, 0x6c, 0x5f, 0x53, 0xff, 0x82, 0x7b, 0x7a, 0xff, 0xc5, 0xc3, 0xc6, 0x50, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfa, 0xf9, 0xf8, 0x04, 0xaf, 0x9e, 0x91, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x92, 0x7c, 0x6a, 0xff, 0x92, 0x7d, 0x6c, 0xff, 0x92, 0x7d, 0x6b, 0xff, 0x92, 0x7b, 0x69, 0xff, 0x8a, 0x76, 0x66, 0xff, 0x8b, 0x7d, 0x75, 0xff, 0xf6, 0xf5, 0xf5, 0x04, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0xb8, 0xaa, 0xa0, 0x74, 0x92, 0x7d, 0x6d, 0xff, 0x8c, 0x77, 0x65, 0xff, 0x91, 0x7b, 0x6a, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x82, 0x71, 0x5e, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7b, 0x6a, 0x58, 0xff, 0x7a, 0x6a, 0x58, 0xff, 0x78, 0x68, 0x57, 0xff, 0x78, 0x68, 0x56, 0xff, 0x78, 0x67, 0x55, 0xff, 0x77, 0x67, 0x56, 0xff, 0x77, 0x67, 0x56, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x6d, 0x5e, 0x49, 0xff, 0x75, 0x67, 0x54, 0xff, 0xb8, 0xb1, 0xa8, 0x88, 0xfe, 0xfe, 0xfe, 0x04, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf7, 0xf5, 0xf4, 0x10, 0xab, 0x95, 0x85, 0xff, 0xa3, 0x89, 0x78, 0xff, 0xa4, 0x8a, 0x78, 0xff, 0xa5, 0x8b, 0x7a, 0xff, 0xa5, 0x8c, 0x7a, 0xff, 0xa5, 0x8c, 0x7a, 0xff, 0xa5, 0x8b, 0x7a, 0xff, 0xa4, 0x89, 0x78, 0xff, 0xa3, 0x88, 0x76, 0xff, 0xa3, 0x89, 0x77, 0xff, 0xa4, 0x8b, 0x7a, 0xff, 0xa6, 0x8c, 0x7b, 0xff, 0xa6, 0x8c, 0x7b, 0xff, 0xa6, 0x8b, 0x79, 0xff, 0xa6, 0x8c, 0x7a, 0xff, 0xa6, 0x8c, 0x7b, 0xff, 0x9d, 0x85, 0x73, 0xff, 0x7e, 0x6d, 0x5b, 0xff, 0x6b, 0x5e, 0x4b, 0xff, 0x6d, 0x61, 0x4e, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x70, 0x62, 0x4c, 0xfc, 0x6c, 0x5f, 0x51, 0xff, 0x79, 0x70, 0x6e, 0xff, 0xbe, 0xbb, 0xbd, 0x57, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfa, 0xf9, 0xf8, 0x04, 0xaf, 0x9f, 0x91, 0xff, 0x96, 0x81, 0x6f, 0xff, 0x92, 0x7c, 0x6a, 0xff, 0x92, 0x7c, 0x6c, 0xff, 0x91, 0x7c, 0x6a, 0xff, 0x92, 0x7b, 0x68, 0xff, 0x8a, 0x75, 0x66, 0xff, 0x8b, 0x7c, 0x75, 0xff, 0xf6, 0xf5, 0xf5, 0x04, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfc, 0xfc, 0x03, 0xa7, 0x96, 0x88, 0xf3, 0x8d, 0x76, 0x64, 0xff, 0x91, 0x7b, 0x68, 0xff, 0x95, 0x7f, 0x6e, 0xff, 0x94, 0x7e, 0x6d, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x7b, 0x6a, 0x58, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x7a, 0x6a, 0x58, 0xff, 0x78, 0x69, 0x56, 0xff, 0x78, 0x68, 0x56, 0xff, 0x78, 0x68, 0x56, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x66, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x65, 0x53, 0xff, 0x71, 0x62, 0x4e, 0xff, 0x72, 0x64, 0x51, 0xff, 0x87, 0x7b, 0x6c, 0xff, 0xf1, 0xf0, 0xee, 0x0b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xef, 0xeb, 0xe7, 0x1f, 0x9f, 0x86, 0x74, 0xff, 0x9f, 0x86, 0x74, 0xff, 0xa3, 0x8a, 0x79, 0xff, 0xa4, 0x8b, 0x79, 0xff, 0xa5, 0x8b, 0x79, 0xff, 0xa5, 0x8b, 0x79, 0xff, 0xa5, 0x8b, 0x7a, 0xff, 0xa5, 0x8a, 0x7a, 0xff, 0xa4, 0x8b, 0x7a, 0xff, 0xa5, 0x8b, 0x7a, 0xff, 0xa5, 0x8c, 0x7a, 0xff, 0xa5, 0x8b, 0x7a, 0xff, 0xa5, 0x8b, 0x7a, 0xff, 0xa4, 0x8a, 0x79, 0xff, 0xa8, 0x8d, 0x7b, 0xff, 0xa1, 0x87, 0x76, 0xff, 0x89, 0x75, 0x63, 0xff, 0x72, 0x64, 0x52, 0xff, 0x6b, 0x5f, 0x4c, 0xff, 0x70, 0x63, 0x4e, 0xff, 0x72, 0x64, 0x4e, 0xff, 0x6a, 0x5d, 0x4c, 0xff, 0x74, 0x6a, 0x65, 0xff, 0xaa, 0xa6, 0xa9, 0x87, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfa, 0xf9, 0xf8, 0x04, 0xae, 0x9e, 0x91, 0xff, 0x95, 0x80, 0x6e, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x92, 0x7d, 0x6c, 0xff, 0x91, 0x7c, 0x6a, 0xff, 0x92, 0x7b, 0x68, 0xff, 0x8a, 0x75, 0x66, 0xff, 0x8b, 0x7c, 0x74, 0xff, 0xf6, 0xf5, 0xf4, 0x04, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe3, 0xde, 0xd9, 0x2f, 0xa2, 0x8f, 0x7f, 0xff, 0x92, 0x7b, 0x68, 0xff, 0x94, 0x7d, 0x6b, 0xfb, 0x99, 0x82, 0x71, 0xff, 0x93, 0x7d, 0x6c, 0xff, 0x85, 0x72, 0x60, 0xff, 0x7d, 0x6b, 0x59, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x7a, 0x6a, 0x58, 0xff, 0x78, 0x69, 0x56, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x66, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x74, 0x66, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x53, 0xff, 0x73, 0x64, 0x50, 0xff, 0x71, 0x62, 0x4e, 0xff, 0x76, 0x69, 0x59, 0xff, 0xef, 0xed, 0xec, 0x0b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x04, 0xd3, 0xc8, 0xc0, 0x7b, 0x9d, 0x84, 0x72, 0xff, 0x9e, 0x84, 0x72, 0xff, 0xa2, 0x89, 0x78, 0xff, 0xa2, 0x89, 0x78, 0xff, 0xa3, 0x8a, 0x79, 0xff, 0xa3, 0x8a, 0x79, 0xff, 0xa4, 0x8a, 0x79, 0xff, 0xa4, 0x8a, 0x79, 0xff, 0xa4, 0x8a, 0x79, 0xff, 0xa5, 0x8b, 0x79, 0xff, 0xa4, 0x8b, 0x79, 0xff, 0xa4, 0x8a, 0x79, 0xff, 0xa4, 0x8a, 0x79, 0xff, 0xa4, 0x8a, 0x79, 0xff, 0xa7, 0x8c, 0x7a, 0xff, 0x97, 0x80, 0x6e, 0xff, 0x75, 0x66, 0x53, 0xff, 0x6b, 0x5f, 0x4c, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x71, 0x63, 0x4e, 0xff, 0x6f, 0x60, 0x4c, 0xff, 0x6f, 0x65, 0x5d, 0xff, 0x92, 0x8c, 0x8f, 0xff, 0xf9, 0xf9, 0xfa, 0x0f, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfa, 0xf9, 0xf9, 0x04, 0xaf, 0x9f, 0x92, 0xff, 0x95, 0x7f, 0x6e, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x92, 0x7c, 0x6a, 0xff, 0x91, 0x7b, 0x68, 0xff, 0x89, 0x74, 0x66, 0xff, 0x8a, 0x7b, 0x74, 0xff, 0xf6, 0xf5, 0xf5, 0x04, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xd3, 0xca, 0xc3, 0x44, 0x98, 0x82, 0x70, 0xff, 0x94, 0x7d, 0x6a, 0xff, 0x9a, 0x82, 0x71, 0xff, 0x99, 0x82, 0x71, 0xff, 0x90, 0x7b, 0x69, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x79, 0x69, 0x56, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x79, 0x69, 0x57, 0xff, 0x78, 0x68, 0x56, 0xff, 0x78, 0x68, 0x56, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x66, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x73, 0x64, 0x51, 0xff, 0x6f, 0x60, 0x4b, 0xff, 0x72, 0x64, 0x53, 0xff, 0x90, 0x87, 0x7d, 0xff, 0xf4, 0xf3, 0xf3, 0x0b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x03, 0xd2, 0xc6, 0xbe, 0x78, 0x9f, 0x86, 0x74, 0xff, 0x9d, 0x84, 0x71, 0xff, 0xa0, 0x88, 0x76, 0xff, 0xa1, 0x88, 0x77, 0xff, 0xa1, 0x89, 0x78, 0xff, 0xa2, 0x8a, 0x78, 0xff, 0xa2, 0x8a, 0x78, 0xff, 0xa3, 0x8a, 0x79, 0xff, 0xa3, 0x8a, 0x79, 0xff, 0xa3, 0x8a, 0x79, 0xff, 0xa3, 0x8a, 0x79, 0xff, 0xa2, 0x8a, 0x78, 0xff, 0xa3, 0x8a, 0x78, 0xff, 0xa4, 0x8b, 0x79, 0xff, 0x9e, 0x87, 0x74, 0xff, 0x89, 0x75, 0x62, 0xff, 0x70, 0x61, 0x4e, 0xff, 0x6c, 0x5f, 0x4b, 0xff, 0x72, 0x64, 0x4f, 0xff, 0x6f, 0x60, 0x4c, 0xfc, 0x6d, 0x60, 0x52, 0xff, 0x89, 0x81, 0x80, 0xff, 0xdd, 0xdc, 0xde, 0x37, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xfc, 0xfb, 0x03, 0xaf, 0x9f, 0x92, 0xff, 0x95, 0x80, 0x6f, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x91, 0x7b, 0x6a, 0xff, 0x92, 0x7c, 0x69, 0xff, 0x91, 0x7a, 0x68, 0xff, 0x88, 0x74, 0x66, 0xff, 0x89, 0x7b, 0x74, 0xff, 0xf9, 0xf9, 0xf9, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xfc, 0xfb, 0x03, 0xaf, 0x9f, 0x91, 0xfb, 0x9a, 0x84, 0x72, 0xff, 0x97, 0x80, 0x6e, 0xff, 0x9c, 0x85, 0x73, 0xff, 0x99, 0x82, 0x70, 0xff, 0x86, 0x74, 0x61, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x79, 0x69, 0x57, 0xff, 0x79, 0x69, 0x57, 0xff, 0x78, 0x68, 0x56, 0xff, 0x78, 0x68, 0x56, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x64, 0x50, 0xff, 0x71, 0x61, 0x4d, 0xff, 0x71, 0x64, 0x57, 0xff, 0x8a, 0x81, 0x7c, 0xff, 0xce, 0xca, 0xc9, 0x4f, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfc, 0xfc, 0x08, 0xbf, 0xaf, 0xa4, 0x93, 0xa0, 0x88, 0x77, 0xff, 0x99, 0x80, 0x6d, 0xff, 0x9d, 0x85, 0x72, 0xff, 0xa0, 0x88, 0x76, 0xfc, 0xa1, 0x89, 0x77, 0xff, 0xa1, 0x89, 0x77, 0xff, 0xa1, 0x89, 0x77, 0xff, 0xa1, 0x88, 0x77, 0xff, 0xa1, 0x89, 0x77, 0xff, 0xa1, 0x89, 0x77, 0xff, 0xa0, 0x88, 0x76, 0xff, 0xa1, 0x8a, 0x77, 0xff, 0xa4, 0x8c, 0x7a, 0xff, 0x92, 0x7d, 0x6b, 0xff, 0x77, 0x67, 0x55, 0xff, 0x6e, 0x60, 0x4d, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x72, 0x63, 0x4e, 0xff, 0x6f, 0x60, 0x4f, 0xff, 0x74, 0x69, 0x65, 0xff, 0xc3, 0xbf, 0xc1, 0x4b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe8, 0xe3, 0xdf, 0x20, 0xa4, 0x91, 0x83, 0xff, 0x91, 0x7c, 0x6b, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x90, 0x7a, 0x68, 0xff, 0x88, 0x74, 0x64, 0xff, 0x8d, 0x7c, 0x70, 0xff, 0xcf, 0xc8, 0xc4, 0x37, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe4, 0xde, 0xda, 0x2c, 0xa2, 0x8d, 0x7d, 0xff, 0x95, 0x7c, 0x69, 0xff, 0x9e, 0x86, 0x74, 0xff, 0x9e, 0x86, 0x74, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x78, 0x68, 0x56, 0xff, 0x78, 0x68, 0x56, 0xff, 0x78, 0x68, 0x56, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x74, 0x64, 0x51, 0xfb, 0x6d, 0x5e, 0x50, 0xff, 0x75, 0x69, 0x61, 0xff, 0x98, 0x91, 0x8f, 0xac, 0xdd, 0xdb, 0xdc, 0x28, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfd, 0xfd, 0x04, 0xdd, 0xd5, 0xcf, 0x40, 0xb6, 0xa3, 0x96, 0xd8, 0xa4, 0x8d, 0x7c, 0xff, 0x9b, 0x82, 0x6f, 0xff, 0x9d, 0x84, 0x71, 0xff, 0x9f, 0x87, 0x75, 0xfc, 0xa0, 0x88, 0x76, 0xff, 0xa0, 0x88, 0x76, 0xff, 0xa0, 0x88, 0x76, 0xff, 0xa0, 0x88, 0x76, 0xff, 0x9f, 0x88, 0x76, 0xff, 0xa1, 0x89, 0x77, 0xff, 0xa1, 0x88, 0x77, 0xff, 0x88, 0x74, 0x62, 0xff, 0x6c, 0x5f, 0x4c, 0xff, 0x6e, 0x60, 0x4d, 0xff, 0x72, 0x64, 0x50, 0xff, 0x6f, 0x61, 0x4c, 0xfc, 0x72, 0x65, 0x59, 0xff, 0x89, 0x81, 0x83, 0xff, 0xf8, 0xf8, 0xf8, 0x08, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf1, 0xef, 0xec, 0x10, 0xd3, 0xca, 0xc3, 0x44, 0xac, 0x9a, 0x8d, 0xff, 0x95, 0x80, 0x6f, 0xff, 0x8f, 0x79, 0x68, 0xff, 0x91, 0x7b, 0x6a, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x8f, 0x7b, 0x69, 0xff, 0x8e, 0x79, 0x68, 0xff, 0x8b, 0x76, 0x65, 0xfb, 0x8e, 0x79, 0x69, 0xff, 0x9c, 0x8b, 0x7d, 0xff, 0xce, 0xc6, 0xbe, 0x47, 0xfc, 0xfc, 0xfb, 0x07, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfd, 0x03, 0xbe, 0xad, 0xa1, 0xa7, 0x9b, 0x82, 0x70, 0xff, 0x9e, 0x86, 0x74, 0xff, 0xa0, 0x88, 0x76, 0xff, 0x9c, 0x84, 0x72, 0xff, 0x87, 0x74, 0x62, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x78, 0x68, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x77, 0x67, 0x54, 0xff, 0x71, 0x62, 0x51, 0xfb, 0x6a, 0x5d, 0x52, 0xff, 0x7b, 0x70, 0x6e, 0xff, 0xa1, 0x9b, 0x9d, 0x83, 0xfc, 0xfc, 0xfc, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfd, 0xfd, 0x0b, 0xc8, 0xb9, 0xb0, 0x7f, 0xa8, 0x91, 0x81, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x9f, 0x87, 0x77, 0xf8, 0x9f, 0x87, 0x76, 0xff, 0xa0, 0x88, 0x76, 0xff, 0xa0, 0x88, 0x76, 0xff, 0xa0, 0x88, 0x76, 0xff, 0xa1, 0x88, 0x76, 0xff, 0xa0, 0x88, 0x76, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x7f, 0x6e, 0x5c, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x74, 0x65, 0x50, 0xff, 0x6e, 0x60, 0x50, 0xff, 0x79, 0x6e, 0x69, 0xff, 0xc9, 0xc6, 0xc7, 0x44, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xd8, 0xd0, 0xc9, 0x2b, 0xa3, 0x90, 0x80, 0xff, 0x9b, 0x87, 0x76, 0xff, 0x93, 0x7c, 0x6a, 0xff, 0x91, 0x7c, 0x6a, 0xfb, 0x91, 0x7b, 0x6a, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x8e, 0x79, 0x68, 0xff, 0x8e, 0x79, 0x68, 0xff, 0x8e, 0x79, 0x68, 0xf7, 0x8d, 0x78, 0x67, 0xff, 0x95, 0x82, 0x72, 0xff, 0xa3, 0x92, 0x84, 0xff, 0xe0, 0xda, 0xd6, 0x1c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xec, 0xe7, 0xe3, 0x1b, 0xaa, 0x95, 0x85, 0xff, 0x9e, 0x85, 0x73, 0xff, 0xa2, 0x89, 0x77, 0xff, 0xa5, 0x8c, 0x7a, 0xff, 0x90, 0x7b, 0x69, 0xff, 0x79, 0x69, 0x57, 0xff, 0x77, 0x67, 0x55, 0xff, 0x78, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x78, 0x69, 0x53, 0xff, 0x68, 0x5b, 0x4f, 0xf4, 0x6c, 0x63, 0x65, 0xff, 0xa4, 0xa0, 0xa4, 0x84, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x03, 0xf4, 0xf1, 0xef, 0x17, 0xc5, 0xb6, 0xac, 0x78, 0xa6, 0x8f, 0x7f, 0xff, 0x9c, 0x84, 0x73, 0xf8, 0x9e, 0x86, 0x74, 0xff, 0xa0, 0x88, 0x76, 0xff, 0x9f, 0x87, 0x75, 0xff, 0xa1, 0x89, 0x77, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x8b, 0x78, 0x65, 0xff, 0x76, 0x67, 0x54, 0xff, 0x6f, 0x62, 0x4e, 0xff, 0x72, 0x64, 0x4f, 0xff, 0x73, 0x63, 0x4e, 0xff, 0x6f, 0x62, 0x56, 0xff, 0x88, 0x81, 0x82, 0xff, 0xf6, 0xf5, 0xf6, 0x0f, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xec, 0xe8, 0xe5, 0x18, 0xba, 0xab, 0x9f, 0x8c, 0x9a, 0x84, 0x72, 0xff, 0x8f, 0x77, 0x64, 0xff, 0x8f, 0x78, 0x65, 0xf3, 0x91, 0x7b, 0x6a, 0xff, 0x91, 0x7c, 0x6b, 0xff, 0x91, 0x7c, 0x6a, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x8e, 0x79, 0x68, 0xff, 0x8d, 0x79, 0x68, 0xff, 0x8e, 0x79, 0x68, 0xff, 0x8c, 0x77, 0x65, 0xfb, 0x85, 0x70, 0x5d, 0xf7, 0x88, 0x72, 0x5f, 0xff, 0x92, 0x7e, 0x6d, 0xff, 0xbc, 0xb0, 0xa6, 0x5b, 0xec, 0xe9, 0xe6, 0x14, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0xc9, 0xbb, 0xb0, 0x6c, 0x9f, 0x85, 0x73, 0xff, 0xa3, 0x89, 0x78, 0xff, 0xa8, 0x8e, 0x7d, 0xff, 0x99, 0x82, 0x70, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x78, 0x68, 0x56, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x77, 0x68, 0x53, 0xf7, 0x6d, 0x5f, 0x54, 0xff, 0x91, 0x89, 0x8b, 0x8b, 0xfd, 0xfd, 0xfe, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xdc, 0xd2, 0xcc, 0x44, 0xa7, 0x91, 0x81, 0xff, 0x9c, 0x84, 0x72, 0xf3, 0x9d, 0x85, 0x73, 0xff, 0x9f, 0x86, 0x75, 0xff, 0x9e, 0x86, 0x74, 0xff, 0xa1, 0x88, 0x76, 0xff, 0x9c, 0x85, 0x73, 0xff, 0x81, 0x6f, 0x5c, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x73, 0x65, 0x50, 0xff, 0x70, 0x61, 0x4e, 0xff, 0x72, 0x67, 0x5f, 0xff, 0xa8, 0xa3, 0xa7, 0xb8, 0xfc, 0xfc, 0xfd, 0x08, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xeb, 0xe7, 0xe3, 0x1c, 0xa7, 0x96, 0x87, 0xff, 0x8c, 0x77, 0x64, 0xff, 0x86, 0x71, 0x5e, 0xf7, 0x8f, 0x79, 0x67, 0xf7, 0x93, 0x7d, 0x6b, 0xff, 0x92, 0x7d, 0x6d, 0xff, 0x91, 0x7c, 0x6b, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x90, 0x7b, 0x6a, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x8f, 0x79, 0x68, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x8c, 0x78, 0x67, 0xff, 0x8c, 0x79, 0x67, 0xff, 0x8d, 0x79, 0x66, 0xff, 0x89, 0x76, 0x62, 0xef, 0x7f, 0x6b, 0x57, 0xfb, 0x87, 0x75, 0x63, 0xff, 0xa2, 0x94, 0x86, 0xff, 0xeb, 0xe8, 0xe5, 0x18, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe6, 0xe0, 0xda, 0x18, 0xa3, 0x8a, 0x77, 0xff, 0xa5, 0x8a, 0x78, 0xff, 0xa9, 0x8f, 0x7e, 0xff, 0xa1, 0x89, 0x77, 0xff, 0x8e, 0x79, 0x67, 0xff, 0x7a, 0x69, 0x57, 0xff, 0x76, 0x66, 0x54, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x65, 0x54, 0xff, 0x77, 0x67, 0x53, 0xf0, 0x75, 0x67, 0x59, 0xff, 0xbe, 0xb9, 0xb5, 0x37, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xcf, 0xc4, 0xbb, 0x4c, 0x9f, 0x89, 0x76, 0xff, 0x9d, 0x85, 0x73, 0xf3, 0x9e, 0x86, 0x74, 0xff, 0x9e, 0x86, 0x74, 0xff, 0x9d, 0x86, 0x73, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x6c, 0x5f, 0x4b, 0xff, 0x72, 0x64, 0x50, 0xff, 0x73, 0x64, 0x50, 0xff, 0x6e, 0x60, 0x51, 0xff, 0x82, 0x78, 0x75, 0xff, 0xe3, 0xe1, 0xe2, 0x28, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfc, 0xfc, 0x08, 0xad, 0x9a, 0x8b, 0xe8, 0x87, 0x72, 0x5e, 0xff, 0x7e, 0x6d, 0x5b, 0xe3, 0x86, 0x76, 0x65, 0xff, 0x92, 0x80, 0x6f, 0xff, 0x93, 0x7e, 0x6d, 0xff, 0x8f, 0x79, 0x68, 0xff, 0x8f, 0x79, 0x67, 0xfb, 0x8b, 0x75, 0x63, 0xff, 0x88, 0x73, 0x61, 0xff, 0x88, 0x74, 0x61, 0xff, 0x88, 0x73, 0x60, 0xff, 0x89, 0x72, 0x60, 0xff, 0x8a, 0x75, 0x64, 0xff, 0x8c, 0x77, 0x65, 0xff, 0x8b, 0x77, 0x64, 0xf7, 0x87, 0x74, 0x62, 0xff, 0x82, 0x72, 0x61, 0xff, 0x79, 0x6b, 0x58, 0xff, 0x7a, 0x69, 0x56, 0xdf, 0x82, 0x70, 0x5e, 0xff, 0xaa, 0x9d, 0x90, 0xb7, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xec, 0xe7, 0xe3, 0x13, 0xae, 0x96, 0x85, 0xff, 0xa7, 0x8d, 0x7b, 0xff, 0xaa, 0x90, 0x7e, 0xff, 0xa9, 0x8f, 0x7d, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x7a, 0x69, 0x58, 0xff, 0x74, 0x65, 0x53, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x65, 0x53, 0xff, 0x76, 0x66, 0x53, 0xf7, 0x71, 0x62, 0x52, 0xff, 0xa2, 0x9a, 0x92, 0x90, 0xfe, 0xfe, 0xfe, 0x04, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xca, 0xbe, 0xb4, 0x4c, 0x99, 0x81, 0x6e, 0xff, 0x9d, 0x86, 0x74, 0xf3, 0x9c, 0x85, 0x72, 0xff, 0x9d, 0x85, 0x73, 0xff, 0x9d, 0x86, 0x73, 0xff, 0x9b, 0x85, 0x72, 0xff, 0x8f, 0x7b, 0x68, 0xff, 0x78, 0x68, 0x55, 0xff, 0x6e, 0x60, 0x4d, 0xff, 0x74, 0x64, 0x50, 0xff, 0x73, 0x63, 0x50, 0xff, 0x6d, 0x60, 0x56, 0xff, 0x9e, 0x98, 0x97, 0xc7, 0xfc, 0xfc, 0xfc, 0x0b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x04, 0xbf, 0xb1, 0xa5, 0x94, 0x92, 0x7b, 0x69, 0xff, 0x78, 0x66, 0x52, 0xf4, 0x78, 0x6c, 0x5a, 0xff, 0x9d, 0x94, 0x88, 0xd8, 0xad, 0xa2, 0x96, 0xcc, 0x9d, 0x8b, 0x7c, 0xff, 0x8e, 0x78, 0x66, 0xff, 0x86, 0x70, 0x5d, 0xff, 0x82, 0x70, 0x5d, 0xff, 0x81, 0x71, 0x5f, 0xff, 0x82, 0x72, 0x60, 0xff, 0x87, 0x75, 0x64, 0xff, 0x8b, 0x78, 0x68, 0xff, 0x8a, 0x76, 0x65, 0xff, 0x87, 0x72, 0x5f, 0xff, 0x86, 0x72, 0x5f, 0xff, 0x89, 0x7a, 0x6d, 0xff, 0x87, 0x7c, 0x73, 0xeb, 0x85, 0x7a, 0x6c, 0xcf, 0x7b, 0x6c, 0x5b, 0xfb, 0x7b, 0x67, 0x54, 0xf7, 0x8b, 0x78, 0x67, 0xff, 0xcd, 0xc5, 0xbe, 0x4b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xd9, 0xcd, 0xc5, 0x3c, 0xac, 0x92, 0x81, 0xff, 0xa9, 0x8e, 0x7c, 0xff, 0xb0, 0x95, 0x83, 0xff, 0x9e, 0x87, 0x74, 0xff, 0x7b, 0x6a, 0x58, 0xff, 0x73, 0x63, 0x51, 0xff, 0x77, 0x67, 0x54, 0xff, 0x76, 0x67, 0x54, 0xff, 0x75, 0x66, 0x53, 0xff, 0x76, 0x67, 0x53, 0xff, 0x6c, 0x5d, 0x4a, 0xfb, 0x8c, 0x82, 0x78, 0xff, 0xe7, 0xe6, 0xe5, 0x1f, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x03, 0xbf, 0xb0, 0xa4, 0x78, 0x95, 0x7d, 0x69, 0xff, 0x9c, 0x85, 0x72, 0xf7, 0x9b, 0x84, 0x71, 0xff, 0x9b, 0x84, 0x72, 0xff, 0x9c, 0x85, 0x73, 0xff, 0x98, 0x82, 0x6f, 0xff, 0x89, 0x76, 0x63, 0xff, 0x77, 0x68, 0x54, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x74, 0x64, 0x50, 0xff, 0x74, 0x64, 0x51, 0xff, 0x72, 0x68, 0x63, 0xff, 0xd4, 0xd2, 0xd4, 0x33, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xda, 0xd1, 0xcb, 0x3f, 0x9c, 0x86, 0x75, 0xff, 0x8d, 0x75, 0x62, 0xff, 0x7c, 0x6d, 0x59, 0xff, 0x8a, 0x82, 0x71, 0xd4, 0xfa, 0xfa, 0xf9, 0x04, 0xff, 0xff, 0xff, 0x00, 0xf2, 0xf0, 0xee, 0x0f, 0x9c, 0x8d, 0x7e, 0xff, 0x92, 0x85, 0x75, 0xff, 0x9a, 0x8f, 0x82, 0xe8, 0xa3, 0x9b, 0x91, 0xaf, 0xa2, 0x98, 0x90, 0xb4, 0xaa, 0xa0, 0x97, 0xb4, 0xb1, 0xa6, 0x9c, 0xaf, 0xa5, 0x96, 0x87, 0xe7, 0x94, 0x81, 0x71, 0xff, 0x94, 0x85, 0x79, 0xff, 0xa8, 0xa0, 0x9b, 0xb3, 0xfb, 0xfa, 0xfb, 0x03, 0xfd, 0xfc, 0xfc, 0x00, 0x9c, 0x8d, 0x7f, 0xcb, 0x82, 0x70, 0x5d, 0xff, 0x7f, 0x6c, 0x59, 0xff, 0x93, 0x83, 0x73, 0xff, 0xe3, 0xdf, 0xdb, 0x23, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xeb, 0xe5, 0xe1, 0x18, 0xb1, 0x96, 0x85, 0xff, 0xaa, 0x8d, 0x7b, 0xff, 0xb3, 0x96, 0x85, 0xff, 0xa5, 0x8b, 0x79, 0xff, 0x83, 0x71, 0x5e, 0xff, 0x75, 0x65, 0x54, 0xff, 0x76, 0x65, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x76, 0x67, 0x54, 0xff, 0x6f, 0x5f, 0x4b, 0xf7, 0x81, 0x75, 0x68, 0xff, 0xcd, 0xc9, 0xc7, 0x3c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfb, 0xfa, 0xf9, 0x18, 0xae, 0x9d, 0x8e, 0xec, 0x93, 0x7a, 0x67, 0xff, 0x9b, 0x83, 0x71, 0xfc, 0x9a, 0x83, 0x71, 0xff, 0x9b, 0x84, 0x72, 0xff, 0x9c, 0x85, 0x73, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x83, 0x71, 0x5e, 0xff, 0x74, 0x66, 0x51, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x73, 0x64, 0x4f, 0xff, 0x72, 0x64, 0x52, 0xff, 0x7c, 0x73, 0x70, 0xff, 0xe3, 0xe2, 0xe3, 0x20, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe7, 0xe1, 0xdd, 0x23, 0xa3, 0x8f, 0x80, 0xff, 0x93, 0x7c, 0x6a, 0xff, 0x91, 0x7a, 0x69, 0xf8, 0x85, 0x71, 0x5f, 0xff, 0x9b, 0x8f, 0x82, 0xdc, 0xfe, 0xfe, 0xfe, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0xef, 0xed, 0x14, 0xc6, 0xc2, 0xbb, 0x78, 0xf8, 0xf8, 0xf7, 0x0c, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf9, 0xf9, 0xf8, 0x0b, 0xc7, 0xbe, 0xb6, 0x77, 0xdb, 0xd6, 0xd3, 0x3b, 0xfe, 0xfe, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xfe, 0xfe, 0x03, 0xa8, 0x99, 0x8b, 0xdf, 0x84, 0x71, 0x5e, 0xff, 0x7e, 0x6b, 0x59, 0xf3, 0x82, 0x70, 0x5e, 0xff, 0xaa, 0x9e, 0x93, 0xcb, 0xfc, 0xfb, 0xfb, 0x04, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xed, 0xe8, 0xe4, 0x18, 0xb6, 0x9c, 0x8c, 0xff, 0xac, 0x8d, 0x7b, 0xff, 0xb5, 0x97, 0x86, 0xff, 0xab, 0x8f, 0x7e, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x7a, 0x69, 0x58, 0xff, 0x74, 0x64, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x54, 0xff, 0x71, 0x62, 0x4e, 0xff, 0x75, 0x67, 0x55, 0xff, 0x94, 0x8a, 0x80, 0xff, 0xda, 0xd6, 0xd3, 0x27, 0xfd, 0xfd, 0xfd, 0x00, 0xfb, 0xfb, 0xfa, 0x03, 0xfb, 0xfb, 0xfa, 0x03, 0xfa, 0xfa, 0xf9, 0x03, 0xfc, 0xfc, 0xfc, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x03, 0xdf, 0xd8, 0xd3, 0x4f, 0xa8, 0x94, 0x85, 0xff, 0x95, 0x7c, 0x69, 0xff, 0x9a, 0x83, 0x71, 0xff, 0x9a, 0x83, 0x71, 0xff, 0x9a, 0x83, 0x72, 0xff, 0x9d, 0x85, 0x73, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x7d, 0x6c, 0x5a, 0xff, 0x72, 0x64, 0x50, 0xff, 0x73, 0x65, 0x51, 0xff, 0x73, 0x64, 0x51, 0xff, 0x72, 0x63, 0x54, 0xff, 0x86, 0x7e, 0x7b, 0xff, 0xe9, 0xe9, 0xea, 0x1b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xd3, 0xca, 0xc3, 0x3f, 0x96, 0x80, 0x6f, 0xff, 0x92, 0x7b, 0x69, 0xf4, 0x93, 0x7d, 0x6c, 0xff, 0x8d, 0x76, 0x64, 0xff, 0x9a, 0x88, 0x78, 0xff, 0xce, 0xc8, 0xc1, 0x60, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xc2, 0xb6, 0xad, 0x88, 0x96, 0x84, 0x74, 0xff, 0x81, 0x6f, 0x5c, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x81, 0x6e, 0x5c, 0xf7, 0x8b, 0x7a, 0x6a, 0xff, 0xd3, 0xcc, 0xc6, 0x30, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf7, 0xf4, 0xf3, 0x0c, 0xb8, 0x9f, 0x90, 0xff, 0xaa, 0x8b, 0x79, 0xff, 0xb4, 0x97, 0x86, 0xff, 0xad, 0x91, 0x80, 0xff, 0x96, 0x7f, 0x6e, 0xff, 0x7d, 0x6b, 0x5a, 0xff, 0x74, 0x64, 0x52, 0xff, 0x74, 0x65, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x73, 0x65, 0x50, 0xf7, 0x75, 0x67, 0x54, 0xff, 0x74, 0x67, 0x54, 0xff, 0x75, 0x68, 0x54, 0xd4, 0x76, 0x69, 0x57, 0xdc, 0x7a, 0x6c, 0x5b, 0xdf, 0x79, 0x6d, 0x5c, 0xff, 0x8f, 0x85, 0x75, 0xe7, 0xf0, 0xee, 0xec, 0x0c, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfd, 0xfc, 0x08, 0xf9, 0xf8, 0xf7, 0x10, 0xfa, 0xf9, 0xf8, 0x0b, 0xf4, 0xf1, 0xf0, 0x1b, 0xe3, 0xdd, 0xd8, 0x50, 0xc0, 0xb3, 0xa8, 0xb4, 0xa6, 0x92, 0x83, 0xff, 0x9b, 0x84, 0x73, 0xff, 0x98, 0x81, 0x6f, 0xff, 0x99, 0x83, 0x71, 0xff, 0x99, 0x83, 0x71, 0xff, 0x9a, 0x83, 0x71, 0xff, 0x9c, 0x84, 0x73, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x81, 0x6f, 0x5c, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7c, 0x6a, 0x58, 0xff, 0x7a, 0x6a, 0x5c, 0xff, 0x8d, 0x82, 0x7d, 0xff, 0xd6, 0xd2, 0xd1, 0x43, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0x04, 0xfe, 0xfe, 0xfe, 0x04, 0xfe, 0xfe, 0xff, 0x04, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0x04, 0xfe, 0xfe, 0xfe, 0x04, 0xff, 0xff, 0xff, 0x03, 0xfe, 0xfe, 0xfe, 0x04, 0xf8, 0xf7, 0xf6, 0x13, 0xbc, 0xae, 0xa3, 0x80, 0x8f, 0x79, 0x66, 0xff, 0x90, 0x7b, 0x6a, 0xff, 0x93, 0x7d, 0x6c, 0xff, 0x93, 0x7b, 0x6a, 0xfb, 0x8b, 0x76, 0x64, 0xff, 0x91, 0x82, 0x72, 0xff, 0xf0, 0xee, 0xed, 0x17, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf8, 0xf7, 0xf6, 0x0b, 0x9a, 0x88, 0x79, 0xff, 0x85, 0x71, 0x5f, 0xff, 0x83, 0x71, 0x5f, 0xfb, 0x85, 0x74, 0x62, 0xff, 0x83, 0x70, 0x5e, 0xfb, 0x7d, 0x6a, 0x57, 0xff, 0xa6, 0x9a, 0x8d, 0xb0, 0xf4, 0xf3, 0xf2, 0x10, 0xfc, 0xfc, 0xfc, 0x03, 0xfb, 0xfb, 0xfa, 0x04, 0xfa, 0xfa, 0xf9, 0x04, 0xfa, 0xf9, 0xf9, 0x04, 0xfa, 0xfa, 0xf9, 0x04, 0xfa, 0xfa, 0xf9, 0x04, 0xfa, 0xfa, 0xf9, 0x04, 0xfa, 0xfa, 0xf9, 0x04, 0xfa, 0xfa, 0xf9, 0x04, 0xfa, 0xfa, 0xf9, 0x04, 0xfa, 0xfa, 0xf9, 0x04, 0xfa, 0xfa, 0xf9, 0x04, 0xfd, 0xfd, 0xfd, 0x03, 0xdd, 0xd6, 0xcf, 0x33, 0xa7, 0x8f, 0x7e, 0xff, 0x9e, 0x83, 0x71, 0xff, 0xa5, 0x8c, 0x7b, 0xff, 0xa1, 0x88, 0x76, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x7d, 0x6b, 0x59, 0xff, 0x74, 0x65, 0x53, 0xff, 0x74, 0x65, 0x53, 0xff, 0x74, 0x65, 0x53, 0xff, 0x74, 0x64, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x72, 0x65, 0x50, 0xff, 0x6e, 0x5f, 0x4a, 0xf8, 0x6b, 0x5c, 0x47, 0xff, 0x6c, 0x5e, 0x4a, 0xff, 0x6b, 0x5e, 0x4a, 0xff, 0x6c, 0x5f, 0x4c, 0xff, 0x6c, 0x5e, 0x4b, 0xff, 0x73, 0x67, 0x54, 0xff, 0x85, 0x7b, 0x69, 0xe3, 0xfd, 0xfd, 0xfc, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xed, 0xe9, 0xe6, 0x20, 0xb7, 0xa8, 0x9a, 0xdf, 0xaf, 0x9e, 0x90, 0xff, 0xab, 0x99, 0x8a, 0xff, 0xa1, 0x8d, 0x7d, 0xff, 0x9c, 0x87, 0x75, 0xff, 0x99, 0x83, 0x72, 0xff, 0x96, 0x7f, 0x6d, 0xff, 0x96, 0x7f, 0x6e, 0xfc, 0x99, 0x82, 0x71, 0xff, 0x99, 0x82, 0x71, 0xff, 0x99, 0x82, 0x71, 0xff, 0x98, 0x82, 0x70, 0xff, 0x99, 0x83, 0x71, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x8f, 0x7a, 0x68, 0xff, 0x8c, 0x79, 0x67, 0xff, 0x8e, 0x7a, 0x68, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x8c, 0x78, 0x69, 0xff, 0x93, 0x80, 0x74, 0xff, 0xa5, 0x94, 0x89, 0xff, 0xc7, 0xba, 0xb1, 0x98, 0xd7, 0xce, 0xc7, 0x64, 0xce, 0xc3, 0xbb, 0x80, 0xcd, 0xc3, 0xbb, 0x80, 0xcc, 0xc1, 0xb9, 0x88, 0xca, 0xc0, 0xb8, 0x8b, 0xcb, 0xc1, 0xb7, 0x88, 0xcb, 0xc0, 0xb7, 0x88, 0xcb, 0xc0, 0xb7, 0x87, 0xca, 0xc0, 0xb7, 0x88, 0xcf, 0xc6, 0xbe, 0x78, 0xbf, 0xb2, 0xa7, 0xaf, 0xa7, 0x96, 0x88, 0xff, 0x98, 0x85, 0x74, 0xff, 0x90, 0x7b, 0x69, 0xfc, 0x91, 0x7c, 0x6a, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x94, 0x7d, 0x6c, 0xff, 0x80, 0x6b, 0x57, 0xff, 0x7f, 0x70, 0x5e, 0xff, 0xc8, 0xc3, 0xbc, 0x6c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf3, 0xf0, 0xee, 0x14, 0x93, 0x7f, 0x6e, 0xff, 0x82, 0x6d, 0x5a, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x85, 0x73, 0x61, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x7f, 0x6d, 0x5a, 0xfb, 0x88, 0x78, 0x67, 0xff, 0x9b, 0x8d, 0x80, 0xff, 0xa7, 0x9a, 0x8d, 0xff, 0xa8, 0x9b, 0x8f, 0xff, 0xa5, 0x98, 0x8c, 0xff, 0xa5, 0x98, 0x8b, 0xff, 0xa4, 0x98, 0x8a, 0xff, 0xa3, 0x98, 0x8a, 0xff, 0xa3, 0x97, 0x8a, 0xff, 0xa3, 0x97, 0x8a, 0xff, 0xa3, 0x97, 0x8a, 0xff, 0xa2, 0x97, 0x8a, 0xff, 0xa2, 0x96, 0x89, 0xff, 0xa2, 0x96, 0x89, 0xff, 0xa4, 0x99, 0x8c, 0xff, 0x98, 0x8a, 0x7c, 0xff, 0x87, 0x74, 0x62, 0xff, 0x86, 0x72, 0x60, 0xff, 0x88, 0x75, 0x63, 0xff, 0x86, 0x73, 0x61, 0xff, 0x81, 0x6e, 0x5c, 0xff, 0x78, 0x68, 0x56, 0xff, 0x74, 0x66, 0x53, 0xff, 0x74, 0x66, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x64, 0x52, 0xff, 0x73, 0x65, 0x51, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x6e, 0x62, 0x4f, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6b, 0x5d, 0x4b, 0xfb, 0x65, 0x58, 0x44, 0xff, 0x6c, 0x61, 0x4c, 0xff, 0xf6, 0xf6, 0xf4, 0x08,
-  0xf9, 0xf8, 0xf7, 0x0f, 0x96, 0x81, 0x6f, 0xff, 0x92, 0x7c, 0x69, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x7f, 0x6d, 0xff, 0x95, 0x7d, 0x6b, 0xff, 0x95, 0x7e, 0x6c, 0xff, 0x95, 0x7f, 0x6d, 0xfc, 0x97, 0x80, 0x6f, 0xff, 0x97, 0x81, 0x70, 0xff, 0x98, 0x81, 0x70, 0xff, 0x98, 0x81, 0x70, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x99, 0x82, 0x71, 0xff, 0x9a, 0x83, 0x72, 0xff, 0x9a, 0x83, 0x71, 0xff, 0x9a, 0x83, 0x72, 0xff, 0x9a, 0x83, 0x71, 0xff, 0x98, 0x80, 0x6e, 0xfc, 0x96, 0x7e, 0x6c, 0xff, 0x95, 0x7e, 0x6c, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6c, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x93, 0x7d, 0x6b, 0xff, 0x93, 0x7d, 0x6b, 0xff, 0x93, 0x7d, 0x6b, 0xff, 0x92, 0x7c, 0x6a, 0xff, 0x92, 0x7c, 0x6a, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x90, 0x7b, 0x69, 0xff, 0x91, 0x7c, 0x6a, 0xfc, 0x91, 0x7c, 0x6a, 0xff, 0x92, 0x7c, 0x6a, 0xff, 0x93, 0x7c, 0x6a, 0xff, 0x7e, 0x6b, 0x57, 0xff, 0x7d, 0x71, 0x61, 0xff, 0xe3, 0xe1, 0xdf, 0x37, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0xa7, 0x91, 0x81, 0xb7, 0x8b, 0x76, 0x63, 0xff, 0x80, 0x6f, 0x5d, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x82, 0x71, 0x5f, 0xfb, 0x80, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5a, 0xff, 0x80, 0x6e, 0x5b, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x7e, 0x6b, 0x5a, 0xff, 0x7d, 0x6b, 0x59, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7c, 0x6a, 0x57, 0xff, 0x7c, 0x6a, 0x57, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7a, 0x69, 0x56, 0xff, 0x7a, 0x69, 0x56, 0xff, 0x7a, 0x69, 0x55, 0xff, 0x79, 0x67, 0x55, 0xff, 0x78, 0x67, 0x55, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x65, 0x53, 0xfb, 0x75, 0x66, 0x54, 0xff, 0x73, 0x64, 0x52, 0xff, 0x73, 0x64, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x73, 0x64, 0x51, 0xff, 0x72, 0x64, 0x4f, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x66, 0x58, 0x43, 0xff, 0x71, 0x66, 0x52, 0xec, 0xdf, 0xdd, 0xda, 0x3b,
-  0xe4, 0xde, 0xda, 0x50, 0x96, 0x80, 0x6e, 0xff, 0x8e, 0x76, 0x63, 0xff, 0x93, 0x7d, 0x6a, 0xfc, 0x94, 0x7e, 0x6c, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x96, 0x7f, 0x6d, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x96, 0x81, 0x6f, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x98, 0x82, 0x70, 0xff, 0x98, 0x82, 0x70, 0xff, 0x98, 0x82, 0x70, 0xff, 0x98, 0x82, 0x70, 0xff, 0x98, 0x81, 0x70, 0xff, 0x97, 0x80, 0x6e, 0xff, 0x94, 0x7e, 0x6b, 0xff, 0x93, 0x7c, 0x6a, 0xff, 0x93, 0x7c, 0x6a, 0xff, 0x93, 0x7c, 0x6a, 0xff, 0x92, 0x7c, 0x69, 0xff, 0x92, 0x7b, 0x69, 0xff, 0x92, 0x7b, 0x69, 0xff, 0x92, 0x7b, 0x69, 0xff, 0x91, 0x7b, 0x68, 0xff, 0x91, 0x7a, 0x68, 0xff, 0x90, 0x7a, 0x68, 0xff, 0x90, 0x79, 0x68, 0xff, 0x8f, 0x79, 0x67, 0xff, 0x8f, 0x79, 0x67, 0xff, 0x90, 0x7b, 0x68, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x91, 0x7b, 0x6a, 0xff, 0x90, 0x7a, 0x68, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x80, 0x75, 0x68, 0xff, 0xe9, 0xe8, 0xe7, 0x2c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0xb6, 0x9f, 0x91, 0xb3, 0x91, 0x7c, 0x6a, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7e, 0x6c, 0x59, 0xff, 0x7c, 0x6a, 0x57, 0xff, 0x7b, 0x69, 0x56, 0xff, 0x7b, 0x68, 0x56, 0xff, 0x7b, 0x68, 0x56, 0xff, 0x7a, 0x67, 0x55, 0xff, 0x7a, 0x68, 0x55, 0xff, 0x7a, 0x68, 0x55, 0xff, 0x79, 0x67, 0x54, 0xff, 0x78, 0x66, 0x53, 0xff, 0x77, 0x66, 0x52, 0xff, 0x77, 0x65, 0x51, 0xff, 0x75, 0x64, 0x52, 0xff, 0x74, 0x63, 0x51, 0xff, 0x74, 0x64, 0x52, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x65, 0x53, 0xff, 0x74, 0x64, 0x52, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x73, 0x65, 0x51, 0xff, 0x73, 0x64, 0x51, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x6f, 0x62, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x67, 0x58, 0x43, 0xff, 0x70, 0x63, 0x50, 0xfb, 0xb6, 0xaf, 0xaa, 0xaf,
-  0xe0, 0xd9, 0xd5, 0x60, 0x99, 0x83, 0x73, 0xf3, 0x90, 0x79, 0x67, 0xff, 0x96, 0x7f, 0x6d, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x95, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x96, 0x81, 0x6f, 0xff, 0x96, 0x81, 0x6f, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x96, 0x81, 0x6f, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x92, 0x7d, 0x6c, 0xff, 0x92, 0x7c, 0x6c, 0xff, 0x91, 0x7c, 0x6b, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x90, 0x7b, 0x69, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x8d, 0x79, 0x66, 0xff, 0x7f, 0x6c, 0x5b, 0xff, 0x84, 0x78, 0x6d, 0xff, 0xec, 0xeb, 0xeb, 0x28, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0xbf, 0xaa, 0x9c, 0xb7, 0x95, 0x80, 0x6e, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7e, 0x6d, 0x5b, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7b, 0x6b, 0x57, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x7a, 0x69, 0x58, 0xff, 0x79, 0x69, 0x57, 0xff, 0x78, 0x68, 0x56, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x73, 0x65, 0x51, 0xff, 0x73, 0x65, 0x51, 0xff, 0x73, 0x64, 0x51, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6f, 0x61, 0x4d, 0xff, 0x69, 0x5a, 0x45, 0xfb, 0x6e, 0x61, 0x4e, 0xff, 0x92, 0x89, 0x83, 0xff,
-  0xec, 0xe8, 0xe5, 0x3b, 0x99, 0x85, 0x73, 0xec, 0x90, 0x79, 0x66, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6c, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x93, 0x7e, 0x6c, 0xff, 0x93, 0x7e, 0x6c, 0xff, 0x93, 0x7d, 0x6c, 0xff, 0x92, 0x7c, 0x6c, 0xff, 0x91, 0x7c, 0x6b, 0xff, 0x91, 0x7b, 0x6a, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x8f, 0x7a, 0x68, 0xff, 0x8d, 0x78, 0x66, 0xff, 0x81, 0x6e, 0x5d, 0xff, 0x87, 0x79, 0x6e, 0xff, 0xf1, 0xf0, 0xf0, 0x20, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0xbc, 0xa5, 0x98, 0xb8, 0x93, 0x7d, 0x6c, 0xff, 0x7d, 0x6b, 0x59, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x59, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7a, 0x6a, 0x58, 0xff, 0x79, 0x69, 0x57, 0xff, 0x79, 0x69, 0x57, 0xff, 0x78, 0x68, 0x56, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x65, 0x54, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x73, 0x64, 0x51, 0xff, 0x73, 0x64, 0x51, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x62, 0x4f, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x66, 0x59, 0x43, 0xfb, 0x6a, 0x5e, 0x4a, 0xff, 0x8c, 0x85, 0x7e, 0xff,
-  0xeb, 0xe7, 0xe4, 0x3c, 0x96, 0x81, 0x6f, 0xec, 0x8e, 0x77, 0x64, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x94, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x97, 0x80, 0x6e, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x97, 0x80, 0x6f, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x97, 0x81, 0x6e, 0xff, 0x96, 0x7f, 0x6c, 0xff, 0x93, 0x7d, 0x6a, 0xff, 0x90, 0x7a, 0x68, 0xff, 0x90, 0x79, 0x67, 0xff, 0x90, 0x7a, 0x68, 0xff, 0x8f, 0x79, 0x67, 0xff, 0x8f, 0x78, 0x66, 0xff, 0x8e, 0x78, 0x66, 0xff, 0x8e, 0x77, 0x65, 0xff, 0x8e, 0x77, 0x65, 0xff, 0x8d, 0x77, 0x64, 0xff, 0x8d, 0x76, 0x63, 0xff, 0x8d, 0x76, 0x63, 0xff, 0x8e, 0x77, 0x65, 0xff, 0x8f, 0x79, 0x68, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x8e, 0x79, 0x68, 0xff, 0x8f, 0x79, 0x68, 0xff, 0x8e, 0x7a, 0x68, 0xff, 0x83, 0x70, 0x5e, 0xff, 0x8a, 0x7c, 0x6e, 0xff, 0xf1, 0xf0, 0xef, 0x24, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xaf, 0x99, 0x8a, 0xb3, 0x8d, 0x78, 0x65, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x80, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5c, 0xff, 0x7f, 0x6d, 0x5a, 0xff, 0x7d, 0x6a, 0x57, 0xff, 0x7a, 0x68, 0x55, 0xff, 0x79, 0x67, 0x54, 0xff, 0x79, 0x67, 0x53, 0xff, 0x79, 0x67, 0x53, 0xff, 0x78, 0x66, 0x52, 0xff, 0x78, 0x66, 0x52, 0xff, 0x77, 0x65, 0x51, 0xff, 0x76, 0x64, 0x51, 0xff, 0x75, 0x64, 0x51, 0xff, 0x73, 0x62, 0x50, 0xff, 0x73, 0x62, 0x4f, 0xff, 0x74, 0x64, 0x51, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x65, 0x54, 0xff, 0x74, 0x64, 0x52, 0xff, 0x74, 0x64, 0x52, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x74, 0x66, 0x52, 0xff, 0x73, 0x65, 0x51, 0xff, 0x73, 0x64, 0x51, 0xff, 0x72, 0x63, 0x50, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x72, 0x63, 0x4f, 0xff, 0x70, 0x62, 0x4d, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x6a, 0x5c, 0x47, 0xff, 0x68, 0x5b, 0x46, 0xff, 0x69, 0x5d, 0x48, 0xff, 0x66, 0x59, 0x46, 0xff, 0x72, 0x67, 0x56, 0xff, 0xb9, 0xb5, 0xb0, 0x8f,
-  0xf0, 0xed, 0xeb, 0x2c, 0x93, 0x7d, 0x6c, 0xff, 0x8b, 0x74, 0x61, 0xff, 0x90, 0x7a, 0x68, 0xfc, 0x91, 0x7c, 0x6a, 0xff, 0x91, 0x7c, 0x6a, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x94, 0x7d, 0x6c, 0xff, 0x95, 0x7e, 0x6c, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x95, 0x7e, 0x6c, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x94, 0x7f, 0x6d, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x95, 0x7f, 0x6e, 0xff, 0x96, 0x7f, 0x6d, 0xff, 0x94, 0x7e, 0x6b, 0xfc, 0x92, 0x7b, 0x69, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x93, 0x7e, 0x6d, 0xff, 0x93, 0x7e, 0x6d, 0xff, 0x92, 0x7f, 0x6c, 0xff, 0x92, 0x7e, 0x6c, 0xff, 0x92, 0x7d, 0x6c, 0xff, 0x92, 0x7c, 0x6c, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x91, 0x7c, 0x6a, 0xff, 0x91, 0x7c, 0x6a, 0xff, 0x91, 0x7c, 0x6a, 0xff, 0x91, 0x7c, 0x6a, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x8e, 0x79, 0x68, 0xff, 0x8e, 0x79, 0x68, 0xfc, 0x8e, 0x79, 0x68, 0xff, 0x8e, 0x79, 0x68, 0xff, 0x8e, 0x79, 0x67, 0xff, 0x85, 0x70, 0x5d, 0xff, 0x8f, 0x7e, 0x6d, 0xff, 0xe8, 0xe5, 0xe3, 0x38, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfb, 0xfa, 0xf9, 0x0c, 0x9f, 0x8a, 0x7a, 0xdc, 0x85, 0x71, 0x5e, 0xff, 0x7f, 0x6e, 0x5c, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6f, 0x5c, 0xff, 0x7f, 0x6d, 0x5a, 0xfb, 0x7f, 0x6c, 0x5a, 0xff, 0x7f, 0x6e, 0x5c, 0xff, 0x7e, 0x6e, 0x5c, 0xff, 0x7e, 0x6d, 0x5c, 0xff, 0x7e, 0x6d, 0x5b, 0xff, 0x7e, 0x6d, 0x5b, 0xff, 0x7d, 0x6c, 0x5a, 0xff, 0x7d, 0x6b, 0x59, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7b, 0x6b, 0x58, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x79, 0x69, 0x57, 0xff, 0x78, 0x69, 0x57, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xfb, 0x75, 0x66, 0x54, 0xff, 0x74, 0x65, 0x53, 0xff, 0x74, 0x66, 0x52, 0xff, 0x75, 0x66, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x73, 0x65, 0x51, 0xff, 0x73, 0x65, 0x51, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x6d, 0x5f, 0x4b, 0xfb, 0x6d, 0x5f, 0x4c, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6e, 0x62, 0x50, 0xff, 0x70, 0x64, 0x54, 0xff, 0x7a, 0x6f, 0x64, 0xff, 0x8d, 0x86, 0x80, 0xff, 0xf8, 0xf7, 0xf7, 0x0b,
-  0xfb, 0xfb, 0xfa, 0x0b, 0x9e, 0x8a, 0x7b, 0xf7, 0x8f, 0x7a, 0x68, 0xff, 0x8c, 0x76, 0x64, 0xff, 0x8f, 0x79, 0x69, 0xff, 0x90, 0x7b, 0x69, 0xff, 0x8f, 0x79, 0x67, 0xff, 0x8f, 0x78, 0x66, 0xff, 0x91, 0x7c, 0x69, 0xfc, 0x93, 0x7d, 0x6c, 0xff, 0x93, 0x7d, 0x6c, 0xff, 0x93, 0x7d, 0x6c, 0xff, 0x93, 0x7e, 0x6c, 0xff, 0x94, 0x7e, 0x6d, 0xff, 0x95, 0x7f, 0x6e, 0xff, 0x8f, 0x7c, 0x6a, 0xff, 0x83, 0x72, 0x5f, 0xff, 0x81, 0x6f, 0x5c, 0xff, 0x82, 0x70, 0x5c, 0xff, 0x81, 0x6f, 0x5c, 0xff, 0x7d, 0x6b, 0x5b, 0xff, 0x79, 0x67, 0x5d, 0xff, 0x84, 0x74, 0x6e, 0xff, 0x9a, 0x8c, 0x84, 0xff, 0xc3, 0xb9, 0xb3, 0x93, 0xdc, 0xd6, 0xd2, 0x57, 0xd8, 0xd2, 0xcc, 0x5b, 0xd8, 0xd2, 0xcc, 0x5b, 0xd6, 0xcf, 0xca, 0x63, 0xd6, 0xcf, 0xca, 0x63, 0xd8, 0xd1, 0xcd, 0x5b, 0xd8, 0xd1, 0xcb, 0x5c, 0xd5, 0xce, 0xc8, 0x64, 0xdc, 0xd6, 0xd1, 0x53, 0xc5, 0xba, 0xb4, 0x90, 0xa4, 0x95, 0x8b, 0xff, 0x93, 0x80, 0x71, 0xff, 0x8b, 0x76, 0x64, 0xfc, 0x8d, 0x79, 0x67, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x8c, 0x78, 0x67, 0xff, 0x85, 0x70, 0x5c, 0xff, 0x92, 0x7f, 0x6d, 0xff, 0xd0, 0xca, 0xc5, 0x73, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xdd, 0xd7, 0xd2, 0x4c, 0x90, 0x7e, 0x6d, 0xff, 0x7c, 0x68, 0x55, 0xff, 0x80, 0x6f, 0x5d, 0xfb, 0x81, 0x6f, 0x5d, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x81, 0x6e, 0x5b, 0xff, 0x7a, 0x69, 0x59, 0xfb, 0x75, 0x68, 0x5f, 0xff, 0x80, 0x73, 0x6d, 0xff, 0x91, 0x85, 0x7d, 0xff, 0xa0, 0x95, 0x8c, 0xff, 0xb8, 0xaf, 0xa7, 0x9f, 0xc2, 0xbb, 0xb4, 0x78, 0xbe, 0xb6, 0xaf, 0x84, 0xbf, 0xb7, 0xb0, 0x83, 0xbe, 0xb7, 0xaf, 0x83, 0xbe, 0xb7, 0xb0, 0x83, 0xbe, 0xb7, 0xaf, 0x83, 0xbf, 0xb9, 0xb0, 0x7f, 0xbc, 0xb4, 0xad, 0x8b, 0xa7, 0x9e, 0x96, 0xdf, 0x91, 0x84, 0x78, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7e, 0x6c, 0x59, 0xff, 0x7f, 0x6e, 0x5c, 0xff, 0x7e, 0x6d, 0x5b, 0xff, 0x7a, 0x6a, 0x58, 0xff, 0x76, 0x66, 0x53, 0xff, 0x73, 0x64, 0x51, 0xff, 0x73, 0x64, 0x51, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x72, 0x64, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x64, 0x57, 0x4a, 0xf8, 0x67, 0x5b, 0x54, 0xff, 0x7b, 0x72, 0x6c, 0xff, 0x94, 0x8c, 0x86, 0xff, 0xc2, 0xbe, 0xb9, 0x60, 0xe8, 0xe6, 0xe3, 0x17, 0xed, 0xec, 0xeb, 0x0c, 0xf5, 0xf5, 0xf5, 0x08, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xf5, 0xf3, 0xf2, 0x17, 0xc2, 0xb8, 0xae, 0xa0, 0xa8, 0x98, 0x8a, 0xff, 0xa3, 0x91, 0x84, 0xff, 0xa1, 0x8f, 0x81, 0xf8, 0x9e, 0x8d, 0x7e, 0xff, 0x98, 0x87, 0x78, 0xff, 0x90, 0x7d, 0x6d, 0xff, 0x90, 0x7c, 0x6b, 0xf8, 0x92, 0x7d, 0x6c, 0xff, 0x91, 0x7c, 0x6b, 0xff, 0x91, 0x7c, 0x6b, 0xff, 0x93, 0x7d, 0x6c, 0xff, 0x95, 0x7f, 0x6e, 0xff, 0x8b, 0x78, 0x66, 0xff, 0x75, 0x67, 0x54, 0xff, 0x6e, 0x60, 0x4c, 0xff, 0x6f, 0x62, 0x4d, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x67, 0x5a, 0x4c, 0xff, 0x76, 0x6b, 0x6a, 0xff, 0xb3, 0xad, 0xb0, 0x94, 0xf3, 0xf2, 0xf2, 0x1c, 0xfe, 0xfe, 0xfe, 0x04, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x03, 0xfe, 0xfe, 0xfe, 0x04, 0xfa, 0xfa, 0xf9, 0x10, 0xbb, 0xb0, 0xa6, 0x70, 0x88, 0x73, 0x61, 0xff, 0x8b, 0x76, 0x64, 0xfc, 0x8d, 0x79, 0x67, 0xff, 0x8c, 0x77, 0x65, 0xfc, 0x87, 0x72, 0x60, 0xff, 0x93, 0x82, 0x76, 0xff, 0xe0, 0xdc, 0xd9, 0x4b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf8, 0xf7, 0xf6, 0x0c, 0x95, 0x85, 0x77, 0xf8, 0x82, 0x70, 0x5e, 0xff, 0x7e, 0x6c, 0x59, 0xfb, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6e, 0x5c, 0xff, 0x81, 0x6e, 0x5a, 0xf7, 0x7a, 0x6b, 0x61, 0xff, 0x83, 0x7b, 0x7d, 0xff, 0xd0, 0xcd, 0xce, 0x2b, 0xfb, 0xfb, 0xfb, 0x03, 0xf9, 0xf9, 0xf8, 0x07, 0xfe, 0xfe, 0xfe, 0x03, 0xff, 0xff, 0xff, 0x03, 0xfe, 0xfe, 0xfe, 0x03, 0xfe, 0xfe, 0xfe, 0x03, 0xfe, 0xfe, 0xfe, 0x03, 0xfe, 0xfe, 0xfe, 0x03, 0xfe, 0xfe, 0xfe, 0x03, 0xfe, 0xfe, 0xff, 0x03, 0xfe, 0xfe, 0xfe, 0x03, 0xfe, 0xfe, 0xfe, 0x03, 0xd1, 0xca, 0xc6, 0x37, 0x91, 0x7e, 0x6e, 0xff, 0x86, 0x71, 0x5e, 0xff, 0x8b, 0x78, 0x66, 0xff, 0x88, 0x74, 0x63, 0xff, 0x81, 0x6e, 0x5d, 0xff, 0x77, 0x67, 0x54, 0xff, 0x72, 0x64, 0x50, 0xff, 0x72, 0x64, 0x50, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x73, 0x65, 0x4f, 0xff, 0x6c, 0x5e, 0x4c, 0xff, 0x5f, 0x53, 0x50, 0xff, 0x80, 0x78, 0x7c, 0xff, 0xd0, 0xce, 0xd0, 0x33, 0xfc, 0xfc, 0xfc, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x04, 0xfb, 0xfb, 0xfa, 0x0c, 0xfb, 0xfa, 0xfa, 0x0b, 0xfc, 0xfb, 0xfb, 0x07, 0xf7, 0xf6, 0xf5, 0x18, 0xc6, 0xbe, 0xb8, 0x90, 0x9d, 0x8d, 0x81, 0xff, 0x93, 0x7e, 0x6d, 0xff, 0x90, 0x7a, 0x68, 0xf8, 0x91, 0x7b, 0x6a, 0xff, 0x91, 0x7b, 0x6a, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x93, 0x7e, 0x6c, 0xff, 0x8c, 0x77, 0x65, 0xff, 0x79, 0x69, 0x56, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x68, 0x5b, 0x45, 0xff, 0x68, 0x5c, 0x4a, 0xff, 0x95, 0x8d, 0x8b, 0xff, 0xf4, 0xf4, 0xf5, 0x23, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xd5, 0xce, 0xc8, 0x43, 0x91, 0x7e, 0x6d, 0xff, 0x89, 0x74, 0x62, 0xf7, 0x8c, 0x78, 0x65, 0xff, 0x88, 0x73, 0x60, 0xff, 0x8b, 0x79, 0x6c, 0xff, 0xa4, 0x9b, 0x97, 0xb3, 0xfe, 0xfe, 0xfe, 0x04, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xdf, 0xdc, 0xd8, 0x3b, 0x90, 0x81, 0x72, 0xff, 0x7a, 0x68, 0x55, 0xff, 0x7f, 0x6d, 0x5a, 0xff, 0x80, 0x6d, 0x5a, 0xf8, 0x7e, 0x6e, 0x5e, 0xff, 0x89, 0x7e, 0x79, 0xff, 0xcf, 0xcd, 0xcf, 0x30, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xeb, 0xe7, 0xe4, 0x14, 0x99, 0x86, 0x76, 0xff, 0x88, 0x72, 0x5f, 0xff, 0x90, 0x7b, 0x69, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x81, 0x6f, 0x5c, 0xff, 0x76, 0x67, 0x54, 0xff, 0x72, 0x64, 0x50, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x71, 0x63, 0x4e, 0xff, 0x6a, 0x5c, 0x4c, 0xff, 0x73, 0x6b, 0x6b, 0xff, 0xc3, 0xc0, 0xc4, 0x3f, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xda, 0xd4, 0xcf, 0x50, 0x9d, 0x8b, 0x7b, 0xff, 0x8a, 0x73, 0x60, 0xfc, 0x91, 0x7b, 0x6a, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x92, 0x7c, 0x6a, 0xff, 0x8e, 0x78, 0x66, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x70, 0x62, 0x4d, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x69, 0x5c, 0x45, 0xff, 0x6b, 0x5e, 0x4a, 0xff, 0x92, 0x8a, 0x86, 0xff, 0xee, 0xed, 0xee, 0x20, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe9, 0xe5, 0xe1, 0x2f, 0xa3, 0x93, 0x85, 0xff, 0x8a, 0x75, 0x63, 0xff, 0x87, 0x73, 0x60, 0xf8, 0x80, 0x6d, 0x5a, 0xff, 0x8d, 0x80, 0x73, 0xff, 0xed, 0xec, 0xed, 0x28, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x03, 0xcc, 0xc4, 0xbd, 0x78, 0xac, 0x9d, 0x8f, 0xec, 0xdf, 0xd9, 0xd4, 0x40, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x03, 0xfe, 0xfe, 0xfe, 0x03, 0xff, 0xff, 0xff, 0x00, 0xf6, 0xf2, 0xf0, 0x20, 0xc7, 0xb8, 0xae, 0x9f, 0xef, 0xeb, 0xe8, 0x23, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x03, 0xa3, 0x95, 0x88, 0xd8, 0x80, 0x6d, 0x5a, 0xff, 0x7b, 0x68, 0x54, 0xfb, 0x7b, 0x68, 0x56, 0xff, 0x85, 0x78, 0x6d, 0xff, 0xce, 0xc9, 0xc9, 0x33, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe7, 0xe2, 0xdf, 0x18, 0x98, 0x85, 0x73, 0xff, 0x8a, 0x74, 0x62, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x7c, 0x6c, 0x59, 0xff, 0x74, 0x65, 0x52, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x64, 0x50, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4e, 0xff, 0x6e, 0x60, 0x4b, 0xff, 0x69, 0x5d, 0x4e, 0xfb, 0x86, 0x80, 0x80, 0xff, 0xe0, 0xdf, 0xe2, 0x1f, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xb6, 0xa8, 0x9d, 0x7c, 0x89, 0x72, 0x61, 0xff, 0x91, 0x7b, 0x6a, 0xf7, 0x90, 0x7a, 0x69, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x91, 0x7b, 0x6a, 0xff, 0x8f, 0x79, 0x68, 0xff, 0x83, 0x70, 0x5e, 0xff, 0x72, 0x63, 0x4f, 0xff, 0x6b, 0x5e, 0x4a, 0xff, 0x6a, 0x5d, 0x47, 0xff, 0x6b, 0x5e, 0x48, 0xff, 0x84, 0x7a, 0x72, 0xff, 0xe2, 0xe0, 0xe1, 0x2b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xdd, 0xd7, 0xd2, 0x47, 0x94, 0x82, 0x72, 0xff, 0x84, 0x6e, 0x5c, 0xff, 0x7e, 0x6c, 0x59, 0xff, 0x8c, 0x7f, 0x70, 0xff, 0xd9, 0xd4, 0xd1, 0x58, 0xff, 0xff, 0xff, 0x07, 0xea, 0xe6, 0xe3, 0x2f, 0x95, 0x85, 0x75, 0xff, 0x8d, 0x7a, 0x69, 0xff, 0x9c, 0x8a, 0x7c, 0xff, 0xb2, 0xa3, 0x97, 0xbc, 0xb4, 0xa5, 0x96, 0xbf, 0xb5, 0xa6, 0x99, 0xc0, 0xba, 0xa9, 0x9c, 0xbc, 0xa9, 0x94, 0x84, 0xfc, 0x95, 0x80, 0x6f, 0xff, 0x96, 0x86, 0x77, 0xff, 0xe3, 0xe0, 0xdd, 0x37, 0xff, 0xff, 0xff, 0x03, 0xfc, 0xfb, 0xfa, 0x07, 0xaf, 0x9c, 0x8d, 0xd8, 0x8d, 0x77, 0x65, 0xff, 0x77, 0x64, 0x52, 0xff, 0x87, 0x78, 0x6a, 0xff, 0xc9, 0xc3, 0xbf, 0x47, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xd2, 0xca, 0xc2, 0x47, 0x95, 0x81, 0x6f, 0xff, 0x8d, 0x78, 0x65, 0xff, 0x93, 0x7d, 0x6c, 0xff, 0x8b, 0x77, 0x64, 0xff, 0x78, 0x69, 0x54, 0xff, 0x72, 0x63, 0x50, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x63, 0x50, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x6c, 0x5e, 0x4a, 0xff, 0x6b, 0x5e, 0x51, 0xff, 0x96, 0x90, 0x8f, 0xff, 0xf2, 0xf2, 0xf3, 0x13, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xc7, 0xbc, 0xb4, 0x48, 0x8c, 0x76, 0x65, 0xff, 0x90, 0x7b, 0x6a, 0xf3, 0x8f, 0x7a, 0x69, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x8f, 0x79, 0x69, 0xff, 0x87, 0x74, 0x62, 0xff, 0x74, 0x65, 0x50, 0xff, 0x6a, 0x5e, 0x49, 0xff, 0x6b, 0x5e, 0x48, 0xff, 0x6b, 0x5e, 0x49, 0xff, 0x79, 0x6f, 0x62, 0xff, 0xe1, 0xdf, 0xdd, 0x24, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x03, 0xc9, 0xc0, 0xb8, 0x68, 0x87, 0x74, 0x62, 0xff, 0x7d, 0x6a, 0x57, 0xff, 0x8a, 0x78, 0x67, 0xff, 0x9e, 0x8d, 0x7f, 0xff, 0xa7, 0x97, 0x8a, 0xe8, 0x95, 0x84, 0x74, 0xfc, 0x80, 0x6d, 0x5a, 0xff, 0x80, 0x6e, 0x5a, 0xf8, 0x85, 0x73, 0x61, 0xff, 0x8d, 0x79, 0x68, 0xff, 0x90, 0x7c, 0x69, 0xff, 0x91, 0x7d, 0x6b, 0xff, 0x91, 0x7d, 0x6b, 0xff, 0x89, 0x75, 0x62, 0xff, 0x7c, 0x69, 0x56, 0xff, 0x7b, 0x68, 0x56, 0xff, 0x8f, 0x81, 0x71, 0xff, 0xa7, 0x9b, 0x8e, 0xdb, 0xac, 0x9b, 0x8c, 0xd8, 0xa3, 0x8c, 0x7c, 0xf8, 0x8a, 0x74, 0x61, 0xff, 0x7d, 0x6c, 0x5b, 0xff, 0xb9, 0xb1, 0xaa, 0x80, 0xfe, 0xfe, 0xfe, 0x08, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xee, 0xea, 0xe8, 0x14, 0xaa, 0x99, 0x8a, 0xff, 0x93, 0x7d, 0x6b, 0xff, 0x91, 0x7b, 0x69, 0xff, 0x94, 0x7d, 0x6c, 0xff, 0x89, 0x75, 0x62, 0xff, 0x75, 0x66, 0x52, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x72, 0x64, 0x51, 0xff, 0x71, 0x63, 0x50, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x69, 0x5b, 0x49, 0xfb, 0x74, 0x69, 0x5f, 0xff, 0xc0, 0xbc, 0xbb, 0x54, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xc9, 0xbf, 0xb7, 0x54, 0x94, 0x81, 0x71, 0xff, 0x8d, 0x79, 0x67, 0xf3, 0x8d, 0x79, 0x67, 0xff, 0x8e, 0x79, 0x68, 0xff, 0x8e, 0x79, 0x68, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x75, 0x67, 0x53, 0xff, 0x6a, 0x5e, 0x49, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x6b, 0x5e, 0x49, 0xff, 0x6f, 0x63, 0x53, 0xff, 0xda, 0xd7, 0xd3, 0x2f, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x03, 0xb9, 0xad, 0xa3, 0x8c, 0x87, 0x74, 0x63, 0xff, 0x86, 0x72, 0x60, 0xe8, 0x8c, 0x78, 0x65, 0xff, 0x8c, 0x79, 0x68, 0xff, 0x85, 0x73, 0x61, 0xff, 0x83, 0x71, 0x5f, 0xfc, 0x84, 0x72, 0x61, 0xfc, 0x83, 0x71, 0x5e, 0xff, 0x81, 0x6e, 0x5c, 0xff, 0x82, 0x6f, 0x5c, 0xff, 0x81, 0x6f, 0x5c, 0xff, 0x80, 0x6d, 0x5b, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x80, 0x6e, 0x5c, 0xfc, 0x7e, 0x6b, 0x59, 0xfc, 0x7f, 0x6c, 0x5b, 0xff, 0x87, 0x76, 0x64, 0xff, 0x8c, 0x79, 0x67, 0xff, 0x86, 0x72, 0x5f, 0xef, 0x86, 0x75, 0x64, 0xff, 0xbb, 0xb3, 0xaa, 0x6c, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xe1, 0xdc, 0x13, 0x98, 0x83, 0x71, 0xff, 0x93, 0x7d, 0x6a, 0xff, 0x95, 0x7f, 0x6e, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x85, 0x72, 0x5f, 0xff, 0x74, 0x66, 0x52, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x71, 0x64, 0x50, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x67, 0x5a, 0x48, 0xf8, 0x7d, 0x74, 0x6b, 0xff, 0xde, 0xdb, 0xdb, 0x23, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe7, 0xe3, 0xdf, 0x3f, 0xa4, 0x95, 0x87, 0xff, 0x87, 0x74, 0x61, 0xff, 0x8b, 0x78, 0x66, 0xff, 0x8e, 0x7a, 0x68, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x8c, 0x7a, 0x66, 0xff, 0x7a, 0x6b, 0x58, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6c, 0x60, 0x4a, 0xff, 0x6a, 0x5d, 0x48, 0xff, 0x68, 0x5a, 0x46, 0xff, 0xaa, 0xa3, 0x9a, 0xa0, 0xff, 0xff, 0xff, 0x08, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfb, 0xfb, 0xfa, 0x17, 0xae, 0xa1, 0x94, 0xef, 0x8b, 0x78, 0x67, 0xff, 0x80, 0x6c, 0x59, 0xfc, 0x83, 0x71, 0x5d, 0xf3, 0x83, 0x72, 0x5f, 0xff, 0x84, 0x73, 0x62, 0xff, 0x84, 0x72, 0x61, 0xff, 0x84, 0x72, 0x60, 0xff, 0x83, 0x72, 0x60, 0xff, 0x82, 0x71, 0x5f, 0xff, 0x81, 0x70, 0x5e, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x80, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5e, 0xff, 0x7f, 0x6c, 0x5a, 0xff, 0x7d, 0x6a, 0x57, 0xf4, 0x7a, 0x68, 0x53, 0xf8, 0x83, 0x73, 0x62, 0xff, 0xab, 0x9f, 0x96, 0xd8, 0xfe, 0xfe, 0xfe, 0x0b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xd7, 0xd0, 0xc9, 0x2b, 0x92, 0x7b, 0x69, 0xff, 0x94, 0x7e, 0x6c, 0xff, 0x97, 0x81, 0x6f, 0xff, 0x8e, 0x7a, 0x68, 0xff, 0x80, 0x6e, 0x5b, 0xff, 0x73, 0x65, 0x51, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x6f, 0x61, 0x4f, 0xff, 0x69, 0x5b, 0x48, 0xfb, 0x76, 0x6b, 0x5b, 0xff, 0xb4, 0xaf, 0xa7, 0x6b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xee, 0xeb, 0xe9, 0x30, 0xa1, 0x92, 0x82, 0xff, 0x87, 0x74, 0x61, 0xff, 0x8b, 0x78, 0x65, 0xfc, 0x8d, 0x79, 0x67, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x8e, 0x7a, 0x67, 0xff, 0x8c, 0x79, 0x67, 0xff, 0x81, 0x70, 0x5d, 0xff, 0x73, 0x65, 0x51, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x6a, 0x5e, 0x48, 0xff, 0x67, 0x59, 0x44, 0xff, 0x86, 0x7b, 0x6e, 0xff, 0xe0, 0xde, 0xdc, 0x3c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf6, 0xf4, 0xf3, 0x20, 0xc2, 0xb9, 0xb0, 0x6c, 0x92, 0x82, 0x72, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x79, 0x65, 0x52, 0xfc, 0x80, 0x6d, 0x5b, 0xf8, 0x84, 0x72, 0x60, 0xff, 0x84, 0x72, 0x61, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5c, 0xff, 0x80, 0x6c, 0x58, 0xf8, 0x7c, 0x69, 0x57, 0xff, 0x81, 0x71, 0x62, 0xff, 0xb8, 0xb0, 0xa7, 0x77, 0xf4, 0xf3, 0xf2, 0x1b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfa, 0xf9, 0xf8, 0x07, 0xb0, 0x9e, 0x90, 0xff, 0x94, 0x7d, 0x6b, 0xff, 0x97, 0x80, 0x6e, 0xff, 0x99, 0x82, 0x70, 0xff, 0x8a, 0x76, 0x64, 0xff, 0x78, 0x68, 0x54, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x50, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x6e, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4f, 0xff, 0x6d, 0x5f, 0x4c, 0xff, 0x6d, 0x60, 0x4b, 0xfb, 0x82, 0x77, 0x66, 0xff, 0xb3, 0xad, 0xa2, 0x53, 0xf1, 0xef, 0xed, 0x08, 0xfd, 0xfd, 0xfd, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x07, 0xed, 0xeb, 0xe8, 0x28, 0xb1, 0xa4, 0x98, 0x90, 0x8f, 0x7b, 0x6a, 0xff, 0x8b, 0x78, 0x65, 0xf8, 0x8b, 0x77, 0x65, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x8d, 0x78, 0x66, 0xff, 0x88, 0x75, 0x63, 0xff, 0x79, 0x69, 0x56, 0xff, 0x6b, 0x5f, 0x4a, 0xff, 0x6b, 0x5e, 0x49, 0xff, 0x6a, 0x5d, 0x49, 0xff, 0x6f, 0x62, 0x52, 0xff, 0xa1, 0x99, 0x8f, 0xec, 0xfb, 0xfb, 0xfa, 0x10, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe5, 0xe2, 0xde, 0x30, 0xad, 0xa1, 0x95, 0xa4, 0x94, 0x85, 0x76, 0xff, 0x8e, 0x7d, 0x6d, 0xff, 0x84, 0x72, 0x5f, 0xfc, 0x82, 0x70, 0x5e, 0xfc, 0x82, 0x70, 0x5e, 0xff, 0x82, 0x70, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7d, 0x6b, 0x5a, 0xf8, 0x7c, 0x6b, 0x5b, 0xff, 0x88, 0x7a, 0x6d, 0xff, 0xcb, 0xc6, 0xc1, 0x48, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xda, 0xd1, 0xca, 0x37, 0xa0, 0x8a, 0x79, 0xff, 0x97, 0x80, 0x6f, 0xff, 0x99, 0x82, 0x70, 0xff, 0x98, 0x82, 0x70, 0xff, 0x84, 0x72, 0x5f, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x71, 0x63, 0x50, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x6e, 0x62, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4c, 0xfb, 0x6b, 0x5f, 0x4a, 0xff, 0x6a, 0x5d, 0x47, 0xff, 0x7b, 0x70, 0x5d, 0xff, 0xb2, 0xab, 0xa1, 0x84, 0xec, 0xeb, 0xe9, 0x18, 0xfe, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfa, 0xf9, 0xf9, 0x13, 0xb7, 0xab, 0xa1, 0x90, 0x9a, 0x89, 0x7a, 0xff, 0x8b, 0x78, 0x66, 0xff, 0x8a, 0x76, 0x64, 0xfc, 0x8b, 0x77, 0x65, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6c, 0x5f, 0x4b, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x68, 0x5a, 0x47, 0xff, 0x87, 0x7b, 0x6c, 0xff, 0xf6, 0xf5, 0xf4, 0x13, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x08, 0xe9, 0xe6, 0xe3, 0x34, 0xc5, 0xbc, 0xb4, 0x64, 0x8a, 0x79, 0x68, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x81, 0x6f, 0x5c, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x82, 0x6f, 0x5d, 0xff, 0x7e, 0x6d, 0x5b, 0xff, 0x79, 0x68, 0x58, 0xf8, 0x76, 0x68, 0x5e, 0xff, 0x86, 0x7c, 0x78, 0xff, 0xcd, 0xc9, 0xc8, 0x4b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfb, 0xfa, 0xf9, 0x07, 0xaf, 0x9c, 0x8d, 0xff, 0x97, 0x7f, 0x6c, 0xff, 0x9a, 0x83, 0x70, 0xff, 0x9a, 0x83, 0x71, 0xff, 0x92, 0x7c, 0x6b, 0xff, 0x7e, 0x6d, 0x5b, 0xff, 0x70, 0x61, 0x4e, 0xff, 0x6f, 0x62, 0x4e, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x61, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6a, 0x5e, 0x49, 0xfb, 0x68, 0x5a, 0x44, 0xff, 0x69, 0x5c, 0x47, 0xff, 0x74, 0x67, 0x54, 0xff, 0x86, 0x7b, 0x6a, 0xff, 0xf3, 0xf2, 0xf1, 0x0b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x03, 0xd0, 0xc9, 0xc2, 0x57, 0x9f, 0x8f, 0x81, 0xff, 0x8d, 0x7a, 0x68, 0xff, 0x83, 0x6e, 0x5b, 0xff, 0x87, 0x73, 0x60, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x8a, 0x76, 0x64, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x84, 0x71, 0x5f, 0xff, 0x75, 0x66, 0x53, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6a, 0x5c, 0x47, 0xff, 0x7a, 0x6d, 0x5a, 0xff, 0xc1, 0xbb, 0xb3, 0x64, 0xfe, 0xfe, 0xfe, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xfb, 0xfb, 0x0b, 0x99, 0x8a, 0x7c, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x7f, 0x6d, 0x5a, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x82, 0x6f, 0x5c, 0xff, 0x7a, 0x69, 0x58, 0xfc, 0x71, 0x63, 0x5a, 0xff, 0x7b, 0x72, 0x71, 0xff, 0xcd, 0xcb, 0xcd, 0x40, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0xce, 0xc1, 0xb7, 0x4c, 0xa1, 0x8a, 0x79, 0xff, 0x99, 0x81, 0x6e, 0xff, 0x9f, 0x87, 0x74, 0xff, 0x9b, 0x84, 0x71, 0xff, 0x87, 0x74, 0x61, 0xff, 0x75, 0x66, 0x53, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x62, 0x4d, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x64, 0x56, 0x40, 0xff, 0x65, 0x57, 0x41, 0xff, 0xb8, 0xb2, 0xa8, 0x5b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfd, 0xfd, 0x04, 0xb8, 0xad, 0xa3, 0x87, 0x8c, 0x7a, 0x69, 0xff, 0x7f, 0x6b, 0x58, 0xff, 0x87, 0x73, 0x61, 0xff, 0x89, 0x76, 0x64, 0xff, 0x89, 0x76, 0x64, 0xff, 0x89, 0x75, 0x63, 0xff, 0x8a, 0x75, 0x63, 0xff, 0x89, 0x75, 0x63, 0xff, 0x89, 0x75, 0x63, 0xff, 0x8a, 0x75, 0x63, 0xff, 0x89, 0x75, 0x63, 0xff, 0x8a, 0x76, 0x64, 0xff, 0x8a, 0x76, 0x64, 0xff, 0x88, 0x75, 0x63, 0xff, 0x7e, 0x6d, 0x5b, 0xff, 0x70, 0x63, 0x50, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6f, 0x61, 0x4d, 0xfc, 0x73, 0x64, 0x51, 0xff, 0x8a, 0x7e, 0x6e, 0xff, 0xf6, 0xf5, 0xf3, 0x14, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfa, 0xf9, 0xf8, 0x10, 0xa2, 0x94, 0x87, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x7e, 0x6c, 0x59, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x81, 0x6e, 0x5b, 0xff, 0x76, 0x65, 0x55, 0xff, 0x76, 0x69, 0x64, 0xff, 0xa4, 0x9e, 0xa0, 0xc4, 0xfe, 0xfe, 0xfe, 0x04, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf8, 0xf7, 0xf5, 0x07, 0xa8, 0x92, 0x81, 0xff, 0x9e, 0x85, 0x73, 0xff, 0x9e, 0x86, 0x74, 0xfb, 0xa0, 0x88, 0x76, 0xff, 0x97, 0x81, 0x6e, 0xff, 0x7d, 0x6c, 0x58, 0xff, 0x6f, 0x61, 0x4d, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x6f, 0x62, 0x4e, 0xff, 0x6e, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x60, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x61, 0x4c, 0xff, 0x68, 0x5a, 0x45, 0xfb, 0x69, 0x5c, 0x47, 0xff, 0x9a, 0x92, 0x85, 0xff, 0xf8, 0xf8, 0xf7, 0x08, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xee, 0xeb, 0xe9, 0x1b, 0x8c, 0x7a, 0x69, 0xff, 0x82, 0x6f, 0x5d, 0xff, 0x85, 0x72, 0x60, 0xfc, 0x86, 0x73, 0x61, 0xff, 0x86, 0x74, 0x62, 0xff, 0x87, 0x75, 0x63, 0xff, 0x88, 0x75, 0x63, 0xff, 0x88, 0x75, 0x63, 0xff, 0x87, 0x75, 0x63, 0xff, 0x88, 0x75, 0x63, 0xff, 0x88, 0x75, 0x63, 0xff, 0x88, 0x75, 0x63, 0xff, 0x88, 0x75, 0x63, 0xff, 0x88, 0x75, 0x63, 0xff, 0x89, 0x76, 0x64, 0xff, 0x83, 0x72, 0x60, 0xff, 0x76, 0x67, 0x55, 0xff, 0x70, 0x63, 0x50, 0xff, 0x73, 0x64, 0x50, 0xff, 0x70, 0x61, 0x4d, 0xff, 0x74, 0x65, 0x52, 0xff, 0xb4, 0xac, 0xa3, 0x7b, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf9, 0xf9, 0xf8, 0x13, 0xa0, 0x92, 0x84, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x7f, 0x6d, 0x5a, 0xff, 0x77, 0x66, 0x56, 0xff, 0x7d, 0x71, 0x6a, 0xff, 0xea, 0xe8, 0xe8, 0x27, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0xcc, 0xbf, 0xb6, 0x58, 0xa1, 0x89, 0x77, 0xff, 0x9e, 0x85, 0x72, 0xff, 0xa2, 0x8a, 0x78, 0xff, 0x9d, 0x85, 0x74, 0xff, 0x8b, 0x77, 0x64, 0xff, 0x76, 0x66, 0x52, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6e, 0x62, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x69, 0x5c, 0x46, 0xff, 0x6d, 0x61, 0x4c, 0xff, 0xa7, 0xa0, 0x98, 0xd0, 0xfd, 0xfd, 0xfd, 0x04, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf3, 0xf1, 0xef, 0x17, 0x94, 0x84, 0x74, 0xff, 0x86, 0x74, 0x62, 0xff, 0x85, 0x73, 0x61, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x87, 0x75, 0x63, 0xff, 0x86, 0x74, 0x62, 0xff, 0x7f, 0x6f, 0x5b, 0xff, 0x75, 0x67, 0x53, 0xff, 0x72, 0x64, 0x51, 0xff, 0x73, 0x64, 0x51, 0xfc, 0x72, 0x63, 0x4f, 0xff, 0x81, 0x73, 0x63, 0xff, 0xba, 0xb2, 0xa9, 0x7c, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf9, 0xf8, 0xf8, 0x13, 0x9e, 0x91, 0x83, 0xff, 0x81, 0x6f, 0x5e, 0xff, 0x7d, 0x6a, 0x58, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x59, 0xff, 0x79, 0x69, 0x59, 0xff, 0x80, 0x73, 0x6b, 0xff, 0xf8, 0xf8, 0xf8, 0x0c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xd9, 0xcf, 0xc8, 0x4b, 0xaa, 0x91, 0x81, 0xff, 0xa2, 0x88, 0x76, 0xff, 0xa2, 0x8a, 0x78, 0xfb, 0xa4, 0x8c, 0x7a, 0xff, 0x95, 0x7f, 0x6d, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x6f, 0x62, 0x4e, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x6f, 0x61, 0x4e, 0xff, 0x6e, 0x60, 0x4e, 0xff, 0x6e, 0x60, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6d, 0x61, 0x4c, 0xff, 0x6c, 0x60, 0x4b, 0xff, 0x6b, 0x5f, 0x4a, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6d, 0x60, 0x4a, 0xff, 0x6a, 0x5c, 0x47, 0xff, 0x72, 0x66, 0x58, 0xff, 0xca, 0xc6, 0xc3, 0x58, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x07, 0xc8, 0xc0, 0xb8, 0x84, 0x8a, 0x78, 0x67, 0xff, 0x80, 0x6d, 0x5b, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x86, 0x74, 0x62, 0xff, 0x85, 0x73, 0x60, 0xff, 0x7b, 0x6b, 0x58, 0xff, 0x74, 0x65, 0x52, 0xff, 0x76, 0x67, 0x54, 0xff, 0x76, 0x66, 0x54, 0xf8, 0x70, 0x5f, 0x4c, 0xff, 0x8b, 0x7e, 0x6e, 0xff, 0xc5, 0xbf, 0xb7, 0x78, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf9, 0xf8, 0xf8, 0x13, 0x9f, 0x91, 0x83, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x7c, 0x6a, 0x58, 0xff, 0x7e, 0x6c, 0x5b, 0xff, 0x7f, 0x6c, 0x5b, 0xff, 0x7e, 0x6c, 0x59, 0xff, 0x79, 0x69, 0x59, 0xff, 0x80, 0x74, 0x6c, 0xff, 0xf5, 0xf4, 0xf4, 0x10, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe7, 0xdf, 0xdb, 0x34, 0xb2, 0x9b, 0x8c, 0xff, 0xa0, 0x84, 0x72, 0xff, 0xa6, 0x8b, 0x7a, 0xfb, 0xa8, 0x8e, 0x7d, 0xff, 0x9e, 0x86, 0x75, 0xff, 0x86, 0x74, 0x61, 0xff, 0x70, 0x63, 0x50, 0xff, 0x6d, 0x61, 0x4e, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x6f, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6d, 0x60, 0x4e, 0xff, 0x6e, 0x60, 0x4e, 0xff, 0x6d, 0x60, 0x4a, 0xff, 0x69, 0x5c, 0x45, 0xfb, 0x65, 0x58, 0x42, 0xff, 0x66, 0x58, 0x42, 0xff, 0x67, 0x5a, 0x43, 0xff, 0x6b, 0x5d, 0x48, 0xff, 0x6d, 0x60, 0x4a, 0xff, 0x6a, 0x5c, 0x45, 0xfb, 0x6a, 0x5c, 0x48, 0xff, 0x7e, 0x74, 0x6d, 0xff, 0xea, 0xe8, 0xe9, 0x14, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xed, 0xea, 0xe7, 0x27, 0x92, 0x81, 0x71, 0xff, 0x7f, 0x6c, 0x59, 0xff, 0x86, 0x74, 0x62, 0xff, 0x86, 0x74, 0x62, 0xff, 0x85, 0x74, 0x61, 0xff, 0x85, 0x73, 0x60, 0xff, 0x84, 0x72, 0x5f, 0xff, 0x84, 0x72, 0x5e, 0xff, 0x84, 0x70, 0x5d, 0xff, 0x84, 0x72, 0x5f, 0xff, 0x85, 0x73, 0x62, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x86, 0x73, 0x62, 0xff, 0x85, 0x73, 0x62, 0xff, 0x80, 0x6e, 0x5d, 0xff, 0x79, 0x68, 0x56, 0xff, 0x75, 0x66, 0x54, 0xff, 0x76, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xf8, 0x79, 0x69, 0x57, 0xff, 0x8c, 0x7f, 0x6f, 0xff, 0xfc, 0xfb, 0xfb, 0x08, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf9, 0xf8, 0xf8, 0x13, 0x9f, 0x91, 0x83, 0xff, 0x81, 0x70, 0x5d, 0xff, 0x7c, 0x6a, 0x58, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x7e, 0x6c, 0x58, 0xff, 0x79, 0x69, 0x58, 0xff, 0x80, 0x75, 0x6c, 0xff, 0xf6, 0xf5, 0xf5, 0x10, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xfb, 0xfb, 0x07, 0xb3, 0x9c, 0x8c, 0xec, 0xa6, 0x8b, 0x78, 0xff, 0xa7, 0x8c, 0x7a, 0xff, 0xa9, 0x8f, 0x7e, 0xff, 0xa7, 0x8d, 0x7b, 0xff, 0x8f, 0x7b, 0x68, 0xff, 0x76, 0x68, 0x54, 0xff, 0x6e, 0x62, 0x4e, 0xff, 0x6e, 0x62, 0x4e, 0xff, 0x6e, 0x61, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6b, 0x5e, 0x4b, 0xf8, 0x68, 0x5c, 0x4c, 0xff, 0x71, 0x66, 0x58, 0xff, 0x7d, 0x72, 0x63, 0xff, 0x80, 0x76, 0x64, 0xff, 0x7a, 0x6e, 0x5b, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x69, 0x5b, 0x46, 0xff, 0x67, 0x59, 0x44, 0xff, 0x75, 0x69, 0x5a, 0xff, 0x97, 0x90, 0x8d, 0xff, 0xf9, 0xf9, 0xf9, 0x07, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf7, 0xf6, 0xf5, 0x14, 0x9e, 0x90, 0x82, 0xff, 0x83, 0x70, 0x5e, 0xff, 0x7f, 0x6c, 0x59, 0xfc, 0x80, 0x6e, 0x5b, 0xff, 0x81, 0x6e, 0x5b, 0xff, 0x81, 0x6e, 0x5b, 0xfc, 0x80, 0x6d, 0x5b, 0xff, 0x81, 0x6f, 0x5e, 0xff, 0x84, 0x71, 0x61, 0xff, 0x82, 0x6f, 0x5d, 0xff, 0x82, 0x70, 0x5e, 0xf8, 0x84, 0x72, 0x60, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x85, 0x73, 0x61, 0xff, 0x84, 0x72, 0x60, 0xff, 0x84, 0x72, 0x60, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x78, 0x68, 0x56, 0xff, 0x77, 0x67, 0x55, 0xff, 0x79, 0x69, 0x57, 0xff, 0x77, 0x67, 0x53, 0xff, 0x7a, 0x69, 0x55, 0xff, 0xa8, 0x9d, 0x90, 0x93, 0xfd, 0xfd, 0xfd, 0x0b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf9, 0xf8, 0xf8, 0x13, 0x9e, 0x91, 0x83, 0xff, 0x80, 0x6f, 0x5d, 0xff, 0x7c, 0x6a, 0x57, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x58, 0xff, 0x78, 0x68, 0x58, 0xff, 0x80, 0x75, 0x6b, 0xff, 0xf6, 0xf5, 0xf5, 0x10, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfd, 0xfc, 0x07, 0xbf, 0xab, 0x9e, 0x8c, 0xa6, 0x8c, 0x79, 0xff, 0xa8, 0x8d, 0x7b, 0xff, 0xab, 0x91, 0x7f, 0xff, 0xa9, 0x8e, 0x7d, 0xff, 0x99, 0x83, 0x70, 0xff, 0x7e, 0x6e, 0x5a, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6f, 0x61, 0x4e, 0xff, 0x6e, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x60, 0x4b, 0xff, 0x65, 0x58, 0x49, 0xff, 0x65, 0x5b, 0x57, 0xff, 0x88, 0x82, 0x83, 0xe8, 0xcc, 0xc9, 0xc8, 0x54, 0xdf, 0xdd, 0xd9, 0x34, 0xa1, 0x9a, 0x8f, 0xcb, 0x83, 0x78, 0x69, 0xd7, 0x74, 0x68, 0x56, 0xcb, 0x73, 0x68, 0x57, 0xdc, 0x8b, 0x82, 0x7a, 0xf8, 0xe8, 0xe7, 0xe6, 0x18, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xec, 0xea, 0xe7, 0x24, 0x91, 0x80, 0x71, 0xff, 0x80, 0x6d, 0x5b, 0xff, 0x82, 0x71, 0x5e, 0xff, 0x85, 0x74, 0x62, 0xff, 0x88, 0x78, 0x6a, 0xff, 0x8b, 0x7d, 0x73, 0xff, 0x90, 0x85, 0x7e, 0xe8, 0x9a, 0x90, 0x8b, 0xc7, 0x8c, 0x7e, 0x72, 0xff, 0x82, 0x6f, 0x5d, 0xff, 0x83, 0x70, 0x5d, 0xfc, 0x84, 0x72, 0x60, 0xfc, 0x84, 0x72, 0x60, 0xff, 0x84, 0x72, 0x60, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x84, 0x72, 0x60, 0xff, 0x83, 0x72, 0x60, 0xff, 0x7e, 0x6d, 0x5b, 0xff, 0x7a, 0x69, 0x58, 0xff, 0x7a, 0x69, 0x57, 0xff, 0x7c, 0x6c, 0x58, 0xf8, 0x7b, 0x69, 0x56, 0xff, 0x82, 0x70, 0x5e, 0xff, 0xa6, 0x99, 0x8e, 0xc8, 0xf8, 0xf7, 0xf6, 0x20, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf9, 0xf8, 0xf8, 0x13, 0x9d, 0x90, 0x83, 0xff, 0x80, 0x6f, 0x5c, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x59, 0xff, 0x7d, 0x6b, 0x57, 0xff, 0x78, 0x67, 0x57, 0xff, 0x80, 0x74, 0x6b, 0xff, 0xf6, 0xf5, 0xf5, 0x10, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf8, 0xf5, 0xf4, 0x17, 0xbf, 0xa7, 0x9a, 0xcf, 0xab, 0x8f, 0x7d, 0xff, 0xaa, 0x8f, 0x7d, 0xff, 0xab, 0x91, 0x80, 0xf7, 0xab, 0x91, 0x7f, 0xff, 0x9e, 0x86, 0x74, 0xff, 0x80, 0x6f, 0x5c, 0xff, 0x6f, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4b, 0xff, 0x69, 0x5c, 0x47, 0xf8, 0x6e, 0x63, 0x5b, 0xff, 0x91, 0x8b, 0x8f, 0xab, 0xfc, 0xfc, 0xfd, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfc, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xfd, 0xfd, 0xfd, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe8, 0xe4, 0xe1, 0x28, 0xa7, 0x99, 0x8c, 0xbc, 0xad, 0xa1, 0x95, 0x9b, 0xb0, 0xa6, 0x9c, 0x98, 0xb0, 0xa7, 0xa1, 0xa3, 0xbd, 0xb6, 0xb4, 0x93, 0xf3, 0xf2, 0xf3, 0x24, 0xfd, 0xfd, 0xfd, 0x0b, 0xc7, 0xc1, 0xbd, 0x74, 0x9b, 0x8c, 0x7e, 0xf7, 0x81, 0x70, 0x5d, 0xf8, 0x80, 0x6d, 0x5a, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x81, 0x70, 0x5e, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7e, 0x6d, 0x5a, 0xf8, 0x7a, 0x68, 0x55, 0xff, 0x83, 0x72, 0x60, 0xff, 0xa3, 0x96, 0x89, 0xd4, 0xf0, 0xee, 0xec, 0x2b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf9, 0xf8, 0xf8, 0x13, 0x9d, 0x90, 0x82, 0xff, 0x80, 0x6f, 0x5c, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7c, 0x6a, 0x56, 0xff, 0x77, 0x67, 0x56, 0xff, 0x7f, 0x74, 0x6b, 0xff, 0xf6, 0xf5, 0xf5, 0x13, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfa, 0xf8, 0xf7, 0x0f, 0xc0, 0xa9, 0x9c, 0xb0, 0xae, 0x91, 0x7f, 0xff, 0xac, 0x8f, 0x7d, 0xff, 0xae, 0x92, 0x81, 0xf7, 0xae, 0x93, 0x81, 0xff, 0xa1, 0x89, 0x77, 0xff, 0x87, 0x74, 0x61, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x6c, 0x5f, 0x4c, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6f, 0x61, 0x4c, 0xff, 0x6c, 0x5f, 0x48, 0xfb, 0x67, 0x5b, 0x4e, 0xff, 0x82, 0x7b, 0x7a, 0xff, 0xd9, 0xd7, 0xda, 0x37, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xee, 0xec, 0xea, 0x2c, 0x8e, 0x7e, 0x6e, 0xff, 0x7d, 0x6b, 0x58, 0xff, 0x80, 0x6e, 0x5c, 0xfc, 0x82, 0x70, 0x5e, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xfc, 0x7f, 0x6c, 0x5a, 0xff, 0x7e, 0x6b, 0x59, 0xff, 0x93, 0x84, 0x75, 0xff, 0xc5, 0xbe, 0xb5, 0x7f, 0xfe, 0xfe, 0xfe, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf9, 0xf8, 0xf8, 0x13, 0x9c, 0x90, 0x82, 0xff, 0x7e, 0x6e, 0x5b, 0xff, 0x7a, 0x69, 0x56, 0xff, 0x7d, 0x6b, 0x58, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7b, 0x6a, 0x56, 0xff, 0x76, 0x67, 0x56, 0xff, 0x7f, 0x74, 0x6b, 0xff, 0xf6, 0xf5, 0xf5, 0x13, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x03, 0xe2, 0xd7, 0xd1, 0x48, 0xb6, 0x9b, 0x8c, 0xff, 0xab, 0x8c, 0x7b, 0xff, 0xaf, 0x92, 0x81, 0xff, 0xb0, 0x94, 0x82, 0xfb, 0xb1, 0x93, 0x82, 0xff, 0xa7, 0x8b, 0x7a, 0xff, 0x8b, 0x76, 0x65, 0xff, 0x71, 0x63, 0x50, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6e, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6d, 0x60, 0x4a, 0xff, 0x67, 0x5b, 0x49, 0xff, 0x71, 0x68, 0x65, 0xff, 0xb3, 0xaf, 0xb2, 0x74, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x03, 0xb5, 0xab, 0xa0, 0x87, 0x88, 0x77, 0x66, 0xff, 0x7e, 0x6c, 0x59, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x83, 0x71, 0x5f, 0xfc, 0x81, 0x6f, 0x5c, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x90, 0x7f, 0x6e, 0xff, 0xbb, 0xb0, 0xa7, 0x7b, 0xfe, 0xfe, 0xfe, 0x08, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf9, 0xf8, 0xf7, 0x13, 0x9b, 0x90, 0x81, 0xff, 0x7e, 0x6d, 0x5b, 0xff, 0x79, 0x68, 0x54, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7a, 0x6a, 0x56, 0xff, 0x75, 0x66, 0x57, 0xff, 0x7f, 0x73, 0x6b, 0xff, 0xf6, 0xf5, 0xf5, 0x13, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfb, 0xfa, 0xf9, 0x13, 0xc9, 0xb7, 0xac, 0x93, 0xb2, 0x97, 0x86, 0xff, 0xae, 0x91, 0x7f, 0xff, 0xb0, 0x92, 0x81, 0xff, 0xb3, 0x96, 0x84, 0xfb, 0xb2, 0x95, 0x83, 0xff, 0xa8, 0x8d, 0x7b, 0xff, 0x8b, 0x77, 0x64, 0xff, 0x73, 0x64, 0x51, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6e, 0x62, 0x4f, 0xff, 0x6e, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x62, 0x4c, 0xff, 0x68, 0x5c, 0x48, 0xfb, 0x68, 0x5d, 0x54, 0xff, 0x83, 0x7b, 0x7d, 0xff, 0xf9, 0xf9, 0xfa, 0x08, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfd, 0xfd, 0x08, 0xaa, 0x9e, 0x91, 0xc8, 0x80, 0x6e, 0x5c, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x81, 0x6f, 0x5d, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x85, 0x73, 0x61, 0xff, 0x83, 0x72, 0x60, 0xf8, 0x7f, 0x6c, 0x59, 0xff, 0x8d, 0x7c, 0x6a, 0xff, 0xae, 0xa2, 0x95, 0xcc, 0xe4, 0xdf, 0xdb, 0x38, 0xfd, 0xfc, 0xfc, 0x0b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf9, 0xf8, 0xf7, 0x13, 0x9b, 0x8e, 0x81, 0xff, 0x7e, 0x6c, 0x5a, 0xff, 0x78, 0x68, 0x54, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7a, 0x69, 0x56, 0xff, 0x75, 0x66, 0x57, 0xff, 0x7f, 0x73, 0x6b, 0xff, 0xf5, 0xf4, 0xf4, 0x13, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x04, 0xe2, 0xda, 0xd4, 0x3f, 0xba, 0xa6, 0x97, 0xf7, 0xad, 0x91, 0x80, 0xff, 0xaa, 0x8c, 0x7a, 0xff, 0xae, 0x91, 0x7f, 0xff, 0xb4, 0x96, 0x86, 0xff, 0xb5, 0x97, 0x85, 0xff, 0xa5, 0x8b, 0x7a, 0xff, 0x89, 0x75, 0x63, 0xff, 0x73, 0x64, 0x51, 0xff, 0x6c, 0x60, 0x4c, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4f, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x65, 0x58, 0x45, 0xff, 0x71, 0x66, 0x5c, 0xff, 0xbb, 0xb7, 0xb8, 0x73, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x04, 0xbb, 0xb3, 0xa9, 0xa8, 0x7f, 0x6d, 0x5b, 0xff, 0x7d, 0x6b, 0x58, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x80, 0x6f, 0x5c, 0xff, 0x83, 0x71, 0x5f, 0xff, 0x85, 0x73, 0x61, 0xff, 0x87, 0x75, 0x63, 0xff, 0x88, 0x75, 0x63, 0xfc, 0x88, 0x75, 0x62, 0xff, 0x87, 0x72, 0x5f, 0xff, 0x8e, 0x7a, 0x68, 0xff, 0xb5, 0xa8, 0x9c, 0xac, 0xea, 0xe5, 0xe2, 0x30, 0xf0, 0xed, 0xeb, 0x23, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf9, 0xf8, 0xf8, 0x13, 0x9c, 0x8f, 0x81, 0xff, 0x7d, 0x6c, 0x5a, 0xff, 0x78, 0x67, 0x54, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x79, 0x68, 0x55, 0xff, 0x74, 0x65, 0x56, 0xff, 0x7d, 0x72, 0x6a, 0xff, 0xf7, 0xf7, 0xf6, 0x0f, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x04, 0xf1, 0xed, 0xea, 0x1f, 0xf0, 0xeb, 0xe8, 0x23, 0xc8, 0xb8, 0xac, 0x87, 0xa7, 0x8d, 0x7a, 0xff, 0xa6, 0x8b, 0x78, 0xff, 0xab, 0x90, 0x7e, 0xff, 0xb0, 0x93, 0x82, 0xfb, 0xb3, 0x95, 0x84, 0xff, 0xaf, 0x92, 0x82, 0xff, 0xa1, 0x88, 0x77, 0xff, 0x87, 0x74, 0x62, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x6b, 0x5f, 0x4c, 0xff, 0x6e, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x67, 0x59, 0x44, 0xff, 0x75, 0x69, 0x58, 0xff, 0xcb, 0xc7, 0xc1, 0x4f, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf7, 0xf6, 0xf5, 0x20, 0x99, 0x8c, 0x7d, 0xff, 0x7a, 0x68, 0x55, 0xff, 0x7e, 0x6b, 0x59, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x80, 0x6f, 0x5d, 0xff, 0x84, 0x72, 0x60, 0xff, 0x88, 0x75, 0x63, 0xff, 0x8b, 0x77, 0x66, 0xff, 0x8c, 0x78, 0x65, 0xff, 0x8a, 0x76, 0x64, 0xff, 0x8c, 0x76, 0x65, 0xff, 0x8f, 0x7a, 0x69, 0xff, 0x94, 0x7f, 0x6e, 0xff, 0xa1, 0x8e, 0x7f, 0xff, 0xd4, 0xcc, 0xc5, 0x57, 0xfa, 0xf9, 0xf8, 0x1b, 0xff, 0xff, 0xff, 0x08, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfa, 0xfa, 0xf9, 0x0f, 0x9b, 0x8e, 0x80, 0xff, 0x7d, 0x6d, 0x5b, 0xff, 0x77, 0x67, 0x54, 0xff, 0x78, 0x68, 0x57, 0xff, 0x78, 0x68, 0x56, 0xff, 0x77, 0x67, 0x54, 0xff, 0x72, 0x63, 0x53, 0xff, 0x7d, 0x71, 0x69, 0xff, 0xf1, 0xf0, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfd, 0xfd, 0x0f, 0xf1, 0xed, 0xeb, 0x28, 0xd2, 0xc6, 0xbe, 0x68, 0xad, 0x96, 0x86, 0xff, 0xa7, 0x8e, 0x7c, 0xff, 0xa7, 0x8d, 0x7c, 0xff, 0xa7, 0x8d, 0x7a, 0xff, 0xaa, 0x8f, 0x7c, 0xff, 0xae, 0x92, 0x81, 0xff, 0xb0, 0x93, 0x82, 0xff, 0xac, 0x90, 0x7f, 0xff, 0x9a, 0x83, 0x71, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x6d, 0x5f, 0x4c, 0xff, 0x6d, 0x5f, 0x4c, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6e, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6e, 0x60, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6a, 0x5d, 0x47, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x85, 0x7b, 0x69, 0xff, 0xe6, 0xe4, 0xe1, 0x1c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x03, 0xb2, 0xa7, 0x9e, 0x9f, 0x84, 0x72, 0x61, 0xff, 0x7c, 0x69, 0x56, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x80, 0x6e, 0x5c, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x80, 0x6f, 0x5c, 0xff, 0x84, 0x71, 0x5f, 0xff, 0x89, 0x76, 0x65, 0xff, 0x8d, 0x79, 0x67, 0xff, 0x8f, 0x7a, 0x68, 0xff, 0x90, 0x7a, 0x69, 0xff, 0x8e, 0x78, 0x66, 0xff, 0x8c, 0x76, 0x63, 0xff, 0x90, 0x7a, 0x67, 0xff, 0x9e, 0x8b, 0x7a, 0xff, 0xad, 0x9b, 0x8d, 0xff, 0xc6, 0xba, 0xb0, 0x74, 0xd9, 0xd1, 0xcb, 0x3b, 0xe6, 0xe1, 0xdd, 0x33, 0xff, 0xfe, 0xfe, 0x13, 0xf4, 0xf3, 0xf2, 0x27, 0x91, 0x84, 0x75, 0xff, 0x7a, 0x69, 0x58, 0xff, 0x77, 0x67, 0x55, 0xff, 0x78, 0x68, 0x56, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x66, 0x54, 0xff, 0x72, 0x62, 0x51, 0xff, 0x7d, 0x70, 0x65, 0xff, 0xbf, 0xb7, 0xb2, 0x97, 0xea, 0xe6, 0xe3, 0x3b, 0xe7, 0xe2, 0xde, 0x2c, 0xdc, 0xd4, 0xcd, 0x38, 0xbd, 0xae, 0xa2, 0xa3, 0xad, 0x99, 0x89, 0xff, 0xa5, 0x8d, 0x7c, 0xff, 0x9f, 0x85, 0x74, 0xff, 0xa1, 0x86, 0x74, 0xff, 0xa5, 0x8b, 0x79, 0xff, 0xaa, 0x8f, 0x7e, 0xff, 0xad, 0x92, 0x80, 0xff, 0xac, 0x90, 0x7f, 0xff, 0xa1, 0x87, 0x76, 0xff, 0x8c, 0x78, 0x65, 0xff, 0x7a, 0x6b, 0x57, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6c, 0x5f, 0x4c, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6a, 0x5d, 0x47, 0xf8, 0x6f, 0x62, 0x4c, 0xff, 0x91, 0x88, 0x7a, 0xff, 0xe9, 0xe8, 0xe5, 0x1f, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xce, 0xc8, 0xc1, 0x4c, 0x81, 0x6f, 0x5e, 0xff, 0x78, 0x66, 0x53, 0xff, 0x7e, 0x6d, 0x5a, 0xfc, 0x7f, 0x6d, 0x5b, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7f, 0x6d, 0x5b, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7e, 0x6e, 0x5a, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x86, 0x74, 0x62, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x92, 0x7c, 0x6a, 0xff, 0x94, 0x7e, 0x6d, 0xff, 0x95, 0x80, 0x6e, 0xff, 0x95, 0x80, 0x6e, 0xff, 0x93, 0x7d, 0x6a, 0xff, 0x91, 0x79, 0x67, 0xff, 0x91, 0x78, 0x66, 0xff, 0x96, 0x7f, 0x6d, 0xff, 0xa6, 0x92, 0x82, 0xff, 0xc2, 0xb2, 0xa7, 0xc7, 0xbb, 0xad, 0xa2, 0xac, 0x85, 0x75, 0x64, 0xfc, 0x76, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xfc, 0x80, 0x6f, 0x5f, 0xfc, 0x9a, 0x89, 0x7b, 0xff, 0xaa, 0x98, 0x8b, 0xff, 0xa5, 0x90, 0x80, 0xff, 0x99, 0x81, 0x6e, 0xff, 0x95, 0x7c, 0x69, 0xff, 0x9a, 0x81, 0x6e, 0xff, 0x9e, 0x86, 0x73, 0xff, 0xa3, 0x8a, 0x79, 0xff, 0xa7, 0x8e, 0x7d, 0xff, 0xaa, 0x90, 0x7f, 0xff, 0xa8, 0x8e, 0x7d, 0xff, 0x9f, 0x87, 0x75, 0xff, 0x91, 0x7c, 0x69, 0xff, 0x82, 0x70, 0x5d, 0xff, 0x73, 0x66, 0x52, 0xff, 0x6c, 0x61, 0x4c, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x61, 0x4c, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x66, 0x58, 0x42, 0xf8, 0x74, 0x68, 0x54, 0xff, 0x9b, 0x93, 0x86, 0xb3, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xda, 0xd6, 0xd1, 0x4c, 0x91, 0x83, 0x73, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7c, 0x6b, 0x58, 0xf8, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x84, 0x72, 0x5f, 0xff, 0x8b, 0x76, 0x64, 0xff, 0x90, 0x7a, 0x68, 0xff, 0x94, 0x7f, 0x6c, 0xff, 0x97, 0x81, 0x70, 0xff, 0x9a, 0x83, 0x71, 0xff, 0x9a, 0x83, 0x72, 0xff, 0x9b, 0x83, 0x72, 0xff, 0x9b, 0x84, 0x72, 0xff, 0x9b, 0x83, 0x70, 0xff, 0x9e, 0x84, 0x71, 0xff, 0x96, 0x7f, 0x6c, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x76, 0x67, 0x54, 0xfc, 0x77, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x75, 0x65, 0x53, 0xff, 0x78, 0x68, 0x56, 0xff, 0x85, 0x71, 0x5f, 0xff, 0x92, 0x7c, 0x69, 0xff, 0x97, 0x80, 0x6e, 0xff, 0x98, 0x81, 0x6f, 0xff, 0x9b, 0x84, 0x72, 0xff, 0x9e, 0x86, 0x74, 0xff, 0xa1, 0x88, 0x76, 0xff, 0xa3, 0x8a, 0x78, 0xff, 0xa2, 0x89, 0x77, 0xff, 0xa0, 0x88, 0x76, 0xff, 0x9d, 0x85, 0x73, 0xff, 0x93, 0x7e, 0x6c, 0xff, 0x86, 0x73, 0x60, 0xff, 0x75, 0x67, 0x53, 0xff, 0x6d, 0x61, 0x4c, 0xff, 0x6e, 0x62, 0x4e, 0xff, 0x6f, 0x62, 0x4e, 0xff, 0x6e, 0x62, 0x4e, 0xff, 0x6e, 0x62, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x63, 0x56, 0x3f, 0xff, 0x82, 0x78, 0x66, 0xbb, 0xfc, 0xfb, 0xfb, 0x0b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x04, 0xa2, 0x95, 0x88, 0xe8, 0x7f, 0x6e, 0x5b, 0xff, 0x7a, 0x69, 0x55, 0xf8, 0x7f, 0x6e, 0x5b, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7d, 0x6d, 0x59, 0xff, 0x7e, 0x6d, 0x59, 0xff, 0x7d, 0x6c, 0x58, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7e, 0x6d, 0x5a, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7b, 0x6b, 0x58, 0xff, 0x7b, 0x6b, 0x57, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x83, 0x70, 0x5e, 0xff, 0x8c, 0x78, 0x66, 0xff, 0x93, 0x7d, 0x6b, 0xff, 0x98, 0x81, 0x70, 0xff, 0x99, 0x84, 0x71, 0xff, 0x9b, 0x85, 0x72, 0xff, 0x9d, 0x86, 0x74, 0xff, 0x9f, 0x86, 0x74, 0xff, 0xa3, 0x89, 0x77, 0xff, 0x9a, 0x82, 0x70, 0xff, 0x80, 0x6f, 0x5c, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x74, 0x64, 0x52, 0xff, 0x78, 0x67, 0x56, 0xff, 0x85, 0x71, 0x60, 0xff, 0x94, 0x7d, 0x6b, 0xff, 0x9a, 0x82, 0x70, 0xff, 0x99, 0x82, 0x71, 0xff, 0x9b, 0x84, 0x72, 0xff, 0x9d, 0x85, 0x73, 0xff, 0x9f, 0x86, 0x74, 0xff, 0x9d, 0x86, 0x74, 0xff, 0x96, 0x80, 0x6e, 0xff, 0x8d, 0x79, 0x66, 0xff, 0x7f, 0x6e, 0x5b, 0xff, 0x74, 0x66, 0x52, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4e, 0xff, 0x6e, 0x62, 0x4e, 0xff, 0x6e, 0x62, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6b, 0x5e, 0x49, 0xfb, 0x69, 0x5c, 0x48, 0xff, 0x68, 0x5b, 0x46, 0xff, 0x69, 0x5c, 0x47, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x61, 0x4c, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x60, 0x52, 0x3b, 0xff, 0x7d, 0x72, 0x60, 0xff, 0xe1, 0xdf, 0xdc, 0x40, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfd, 0xfd, 0x0c, 0x94, 0x86, 0x77, 0xef, 0x78, 0x66, 0x53, 0xff, 0x79, 0x68, 0x54, 0xfc, 0x7d, 0x6c, 0x59, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7d, 0x6c, 0x59, 0xff, 0x7c, 0x6b, 0x59, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7c, 0x6a, 0x56, 0xff, 0x7a, 0x67, 0x54, 0xff, 0x79, 0x67, 0x54, 0xff, 0x7a, 0x69, 0x56, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7c, 0x6b, 0x58, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7a, 0x6a, 0x58, 0xff, 0x79, 0x69, 0x57, 0xff, 0x78, 0x68, 0x56, 0xff, 0x7b, 0x6a, 0x58, 0xff, 0x7e, 0x6d, 0x5b, 0xff, 0x80, 0x6f, 0x5c, 0xff, 0x84, 0x72, 0x60, 0xff, 0x8b, 0x78, 0x65, 0xff, 0x92, 0x7e, 0x6b, 0xff, 0x98, 0x82, 0x70, 0xff, 0x9f, 0x87, 0x75, 0xff, 0xa8, 0x8e, 0x7c, 0xff, 0x9f, 0x88, 0x76, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x75, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x65, 0x53, 0xff, 0x74, 0x64, 0x52, 0xff, 0x78, 0x67, 0x55, 0xff, 0x85, 0x71, 0x60, 0xff, 0x96, 0x7f, 0x6d, 0xff, 0x9b, 0x84, 0x73, 0xff, 0x97, 0x80, 0x70, 0xff, 0x92, 0x7d, 0x6c, 0xff, 0x90, 0x7b, 0x69, 0xff, 0x89, 0x76, 0x63, 0xff, 0x80, 0x6f, 0x5d, 0xff, 0x7b, 0x6b, 0x58, 0xff, 0x77, 0x68, 0x55, 0xff, 0x72, 0x64, 0x50, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x6e, 0x62, 0x4d, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6d, 0x60, 0x4e, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6e, 0x60, 0x4c, 0xff, 0x6d, 0x60, 0x4a, 0xff, 0x68, 0x5b, 0x48, 0xfb, 0x67, 0x5c, 0x50, 0xff, 0x6f, 0x65, 0x5a, 0xff, 0x6d, 0x62, 0x51, 0xff, 0x68, 0x5b, 0x44, 0xff, 0x6a, 0x5d, 0x47, 0xf8, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x69, 0x5c, 0x45, 0xf8, 0x69, 0x5c, 0x49, 0xff, 0x85, 0x7b, 0x6e, 0xe3, 0xf9, 0xf8, 0xf8, 0x0c, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x07, 0xa4, 0x99, 0x8c, 0xd3, 0x7e, 0x6e, 0x5c, 0xff, 0x76, 0x63, 0x50, 0xff, 0x7c, 0x6a, 0x57, 0xf8, 0x7b, 0x6b, 0x58, 0xff, 0x7b, 0x6b, 0x58, 0xff, 0x7b, 0x6b, 0x58, 0xff, 0x7b, 0x6a, 0x57, 0xff, 0x7c, 0x6a, 0x55, 0xfc, 0x77, 0x66, 0x53, 0xfc, 0x72, 0x63, 0x58, 0xff, 0x7a, 0x6c, 0x62, 0xff, 0x7e, 0x6f, 0x5f, 0xff, 0x78, 0x67, 0x53, 0xff, 0x75, 0x64, 0x4f, 0xff, 0x7a, 0x69, 0x56, 0xf8, 0x7b, 0x6b, 0x59, 0xff, 0x7a, 0x6a, 0x58, 0xff, 0x7a, 0x6a, 0x57, 0xff, 0x79, 0x69, 0x58, 0xff, 0x79, 0x6a, 0x58, 0xff, 0x79, 0x6a, 0x57, 0xff, 0x79, 0x69, 0x57, 0xff, 0x77, 0x68, 0x56, 0xff, 0x76, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x7c, 0x6c, 0x59, 0xff, 0x82, 0x70, 0x5e, 0xff, 0x86, 0x73, 0x61, 0xff, 0x8b, 0x77, 0x65, 0xff, 0x90, 0x7c, 0x6a, 0xff, 0x8d, 0x78, 0x66, 0xff, 0x7d, 0x6b, 0x59, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x65, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x77, 0x66, 0x54, 0xff, 0x7e, 0x6c, 0x59, 0xff, 0x86, 0x73, 0x60, 0xff, 0x87, 0x75, 0x62, 0xff, 0x84, 0x72, 0x5f, 0xff, 0x80, 0x6f, 0x5c, 0xff, 0x7d, 0x6c, 0x5a, 0xff, 0x77, 0x67, 0x54, 0xff, 0x70, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6f, 0x62, 0x4e, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x71, 0x64, 0x50, 0xff, 0x70, 0x63, 0x50, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6c, 0x5e, 0x4a, 0xf8, 0x69, 0x5c, 0x4b, 0xff, 0x6f, 0x65, 0x5d, 0xff, 0x81, 0x79, 0x78, 0xff, 0xb5, 0xb0, 0xb0, 0x8b, 0xc3, 0xbf, 0xb8, 0x73, 0x8b, 0x81, 0x70, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x66, 0x58, 0x42, 0xff, 0x6d, 0x60, 0x4b, 0xfb, 0x6d, 0x60, 0x4b, 0xff, 0x69, 0x5c, 0x45, 0xf8, 0x65, 0x58, 0x42, 0xff, 0x7e, 0x74, 0x69, 0xff, 0xaf, 0xa9, 0xa7, 0x8b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf5, 0xf4, 0xf2, 0x1b, 0x92, 0x84, 0x75, 0xeb, 0x7e, 0x6d, 0x5a, 0xff, 0x75, 0x63, 0x50, 0xff, 0x7a, 0x69, 0x56, 0xfc, 0x7c, 0x6c, 0x59, 0xff, 0x7b, 0x69, 0x56, 0xff, 0x78, 0x66, 0x51, 0xfc, 0x75, 0x65, 0x52, 0xff, 0x78, 0x6b, 0x61, 0xff, 0x7d, 0x74, 0x75, 0xff, 0x94, 0x8d, 0x8d, 0xdc, 0x9f, 0x95, 0x8a, 0xd3, 0x8e, 0x80, 0x72, 0xe3, 0x82, 0x73, 0x61, 0xff, 0x78, 0x68, 0x55, 0xff, 0x75, 0x64, 0x51, 0xfc, 0x79, 0x69, 0x57, 0xfc, 0x7a, 0x6a, 0x58, 0xff, 0x79, 0x69, 0x57, 0xff, 0x79, 0x69, 0x57, 0xff, 0x79, 0x69, 0x57, 0xff, 0x78, 0x68, 0x56, 0xff, 0x78, 0x68, 0x56, 0xff, 0x78, 0x68, 0x56, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x67, 0x54, 0xff, 0x76, 0x67, 0x54, 0xff, 0x76, 0x66, 0x53, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x66, 0x54, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x72, 0x64, 0x50, 0xff, 0x72, 0x64, 0x50, 0xff, 0x72, 0x65, 0x51, 0xff, 0x72, 0x64, 0x50, 0xff, 0x72, 0x63, 0x50, 0xff, 0x72, 0x63, 0x50, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x70, 0x62, 0x4f, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6e, 0x61, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x6a, 0x5e, 0x4c, 0xf7, 0x69, 0x5c, 0x4f, 0xff, 0x73, 0x68, 0x63, 0xff, 0x8e, 0x87, 0x89, 0xfc, 0xd2, 0xd0, 0xd3, 0x4f, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x00, 0xdd, 0xdb, 0xd6, 0x38, 0x8e, 0x85, 0x75, 0xff, 0x72, 0x65, 0x52, 0xff, 0x69, 0x5c, 0x46, 0xff, 0x65, 0x58, 0x42, 0xff, 0x6c, 0x60, 0x4c, 0xff, 0x80, 0x75, 0x68, 0xff, 0xa3, 0x9b, 0x98, 0xbc, 0xfb, 0xfb, 0xfb, 0x0b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf8, 0xf7, 0xf6, 0x10, 0x92, 0x84, 0x75, 0xe7, 0x7f, 0x6f, 0x5e, 0xff, 0x74, 0x62, 0x4f, 0xff, 0x76, 0x64, 0x51, 0xf8, 0x75, 0x63, 0x4f, 0xff, 0x7a, 0x6b, 0x5a, 0xff, 0x82, 0x77, 0x6d, 0xff, 0x8d, 0x87, 0x87, 0xe8, 0xdc, 0xda, 0xdc, 0x43, 0xfd, 0xfd, 0xfd, 0x08, 0xfe, 0xfe, 0xfe, 0x03, 0xfc, 0xfb, 0xfb, 0x0c, 0xb8, 0xaf, 0xa5, 0x93, 0x8b, 0x7e, 0x6e, 0xff, 0x74, 0x64, 0x51, 0xff, 0x76, 0x66, 0x53, 0xff, 0x78, 0x68, 0x56, 0xff, 0x78, 0x68, 0x56, 0xff, 0x78, 0x68, 0x56, 0xff, 0x78, 0x68, 0x56, 0xff, 0x78, 0x68, 0x56, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x65, 0x53, 0xff, 0x74, 0x65, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x73, 0x64, 0x51, 0xff, 0x72, 0x63, 0x50, 0xff, 0x72, 0x63, 0x50, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x71, 0x64, 0x50, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x6f, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6d, 0x60, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6f, 0x62, 0x4c, 0xff, 0x69, 0x5d, 0x49, 0xf8, 0x63, 0x58, 0x4e, 0xff, 0x75, 0x6d, 0x6d, 0xff, 0xb0, 0xac, 0xae, 0x73, 0xfd, 0xfd, 0xfd, 0x07, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xfc, 0xfb, 0x10, 0xb7, 0xb1, 0xa7, 0x67, 0x70, 0x64, 0x51, 0xf7, 0x71, 0x64, 0x50, 0xd8, 0x80, 0x76, 0x69, 0xe7, 0xb8, 0xb3, 0xaf, 0x8b, 0xfc, 0xfb, 0xfc, 0x0b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfb, 0xfa, 0xfa, 0x0f, 0xa4, 0x9a, 0x8d, 0xd0, 0x84, 0x75, 0x64, 0xff, 0x79, 0x68, 0x56, 0xff, 0x85, 0x77, 0x69, 0xff, 0x96, 0x8c, 0x84, 0xf7, 0xd9, 0xd7, 0xd6, 0x4f, 0xfe, 0xfe, 0xfe, 0x0b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xeb, 0xe9, 0xe6, 0x37, 0x97, 0x8a, 0x7c, 0xff, 0x79, 0x6a, 0x57, 0xff, 0x73, 0x63, 0x50, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x74, 0x66, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x73, 0x65, 0x51, 0xff, 0x73, 0x65, 0x51, 0xff, 0x73, 0x64, 0x51, 0xff, 0x73, 0x64, 0x50, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x6f, 0x63, 0x4f, 0xff, 0x6f, 0x61, 0x4f, 0xff, 0x6f, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6e, 0x60, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6d, 0x61, 0x4b, 0xff, 0x63, 0x57, 0x48, 0xff, 0x70, 0x67, 0x65, 0xff, 0xb3, 0xaf, 0xb3, 0x7b, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfb, 0xfb, 0xfa, 0x0c, 0xfa, 0xfa, 0xfa, 0x0f, 0xfd, 0xfd, 0xfd, 0x07, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfa, 0xf9, 0xf9, 0x13, 0xb5, 0xac, 0xa1, 0x9b, 0xa7, 0x9d, 0x92, 0xa0, 0xbc, 0xb5, 0xb0, 0x90, 0xf5, 0xf4, 0xf4, 0x1f, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x07, 0xb4, 0xaa, 0xa1, 0xdc, 0x80, 0x71, 0x60, 0xff, 0x6f, 0x5f, 0x4c, 0xff, 0x76, 0x66, 0x54, 0xff, 0x77, 0x67, 0x55, 0xff, 0x77, 0x67, 0x55, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x66, 0x54, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x73, 0x65, 0x51, 0xff, 0x72, 0x65, 0x50, 0xff, 0x72, 0x64, 0x50, 0xff, 0x72, 0x64, 0x50, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x63, 0x50, 0xff, 0x70, 0x63, 0x50, 0xff, 0x70, 0x63, 0x50, 0xff, 0x70, 0x63, 0x50, 0xff, 0x6f, 0x62, 0x50, 0xff, 0x6e, 0x61, 0x4f, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6b, 0x5f, 0x48, 0xff, 0x68, 0x5c, 0x4e, 0xff, 0x87, 0x7f, 0x7c, 0xc7, 0xfe, 0xfe, 0xfe, 0x0b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfd, 0xfd, 0x08, 0xa8, 0x9d, 0x91, 0xe7, 0x7f, 0x70, 0x5f, 0xff, 0x70, 0x5f, 0x4c, 0xff, 0x75, 0x65, 0x53, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x53, 0xff, 0x76, 0x65, 0x53, 0xff, 0x75, 0x65, 0x52, 0xff, 0x74, 0x65, 0x51, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x73, 0x64, 0x51, 0xff, 0x73, 0x64, 0x51, 0xff, 0x73, 0x64, 0x51, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x71, 0x63, 0x50, 0xff, 0x71, 0x63, 0x50, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x60, 0x4c, 0xff, 0x6d, 0x5f, 0x4b, 0xff, 0x6b, 0x5e, 0x4b, 0xfc, 0x6d, 0x60, 0x4d, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6d, 0x60, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6d, 0x61, 0x4d, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6b, 0x5d, 0x47, 0xff, 0x6d, 0x61, 0x50, 0xff, 0x93, 0x8b, 0x82, 0xa7, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfb, 0xfa, 0xfa, 0x0c, 0x8a, 0x7d, 0x6d, 0xef, 0x79, 0x69, 0x57, 0xff, 0x73, 0x62, 0x50, 0xff, 0x75, 0x65, 0x53, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x65, 0x53, 0xff, 0x75, 0x65, 0x53, 0xff, 0x75, 0x66, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x76, 0x66, 0x53, 0xff, 0x74, 0x65, 0x51, 0xff, 0x73, 0x64, 0x50, 0xf8, 0x72, 0x63, 0x4f, 0xf8, 0x72, 0x63, 0x50, 0xf8, 0x73, 0x64, 0x51, 0xfc, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x73, 0x65, 0x51, 0xff, 0x73, 0x65, 0x51, 0xff, 0x73, 0x64, 0x51, 0xff, 0x72, 0x64, 0x50, 0xff, 0x72, 0x63, 0x50, 0xff, 0x72, 0x63, 0x50, 0xff, 0x71, 0x63, 0x50, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x6f, 0x61, 0x4e, 0xff, 0x6e, 0x60, 0x4c, 0xf8, 0x6c, 0x5f, 0x4a, 0xf8, 0x6c, 0x5e, 0x4b, 0xf7, 0x6a, 0x5d, 0x49, 0xff, 0x69, 0x5d, 0x4a, 0xff, 0x6b, 0x5e, 0x4c, 0xfc, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6d, 0x61, 0x4c, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6b, 0x5e, 0x48, 0xff, 0x6c, 0x5f, 0x4b, 0xff, 0x8e, 0x85, 0x77, 0xa7, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfa, 0xf9, 0xf8, 0x10, 0x79, 0x6a, 0x58, 0xf0, 0x74, 0x63, 0x51, 0xff, 0x75, 0x66, 0x53, 0xff, 0x76, 0x67, 0x54, 0xff, 0x76, 0x66, 0x54, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x53, 0xff, 0x76, 0x67, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x6d, 0x5e, 0x4f, 0xf8, 0x68, 0x5b, 0x50, 0xff, 0x76, 0x6a, 0x61, 0xff, 0x82, 0x76, 0x6a, 0xff, 0x7f, 0x72, 0x63, 0xff, 0x74, 0x66, 0x54, 0xff, 0x72, 0x63, 0x50, 0xfc, 0x74, 0x65, 0x51, 0xfc, 0x73, 0x65, 0x51, 0xff, 0x72, 0x64, 0x50, 0xff, 0x72, 0x63, 0x4f, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x63, 0x50, 0xff, 0x71, 0x63, 0x50, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6b, 0x5d, 0x4b, 0xf8, 0x69, 0x5b, 0x4c, 0xff, 0x72, 0x66, 0x5b, 0xff, 0x7a, 0x6f, 0x67, 0xff, 0x82, 0x79, 0x73, 0xff, 0x90, 0x88, 0x81, 0xff, 0x94, 0x8b, 0x81, 0xff, 0x79, 0x6d, 0x5d, 0xff, 0x66, 0x58, 0x43, 0xfc, 0x6d, 0x60, 0x4b, 0xfc, 0x6e, 0x61, 0x4d, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x6b, 0x5e, 0x49, 0xff, 0x67, 0x5a, 0x44, 0xff, 0x86, 0x7b, 0x6c, 0xcf, 0xfa, 0xfa, 0xfa, 0x17, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xd5, 0xd1, 0xcb, 0x53, 0x76, 0x67, 0x54, 0xff, 0x70, 0x60, 0x4d, 0xff, 0x76, 0x67, 0x54, 0xff, 0x76, 0x67, 0x54, 0xff, 0x75, 0x66, 0x53, 0xff, 0x74, 0x66, 0x52, 0xff, 0x75, 0x66, 0x53, 0xff, 0x75, 0x66, 0x52, 0xff, 0x6f, 0x5f, 0x4d, 0xfc, 0x68, 0x5b, 0x55, 0xff, 0x7f, 0x76, 0x77, 0xff, 0xb8, 0xb4, 0xb4, 0x67, 0xd6, 0xd4, 0xd1, 0x3b, 0xcd, 0xc9, 0xc4, 0x50, 0xa5, 0x9c, 0x91, 0xaf, 0x78, 0x6b, 0x58, 0xff, 0x70, 0x63, 0x4e, 0xff, 0x72, 0x64, 0x50, 0xff, 0x71, 0x63, 0x50, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x6e, 0x60, 0x4d, 0xff, 0x67, 0x5a, 0x4b, 0xf8, 0x6e, 0x64, 0x5a, 0xff, 0x81, 0x78, 0x74, 0xff, 0xbd, 0xb8, 0xb7, 0x58, 0xd3, 0xcf, 0xd0, 0x40, 0xcf, 0xcc, 0xce, 0x4f, 0xe4, 0xe2, 0xe4, 0x3f, 0xf2, 0xf1, 0xf1, 0x2f, 0xa9, 0xa2, 0x97, 0x7f, 0x6c, 0x5f, 0x4b, 0xff, 0x6b, 0x5e, 0x4a, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4c, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x65, 0x57, 0x40, 0xff, 0x7d, 0x72, 0x60, 0xff, 0xc6, 0xc2, 0xbc, 0x7b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x08, 0xa1, 0x97, 0x8a, 0xff, 0x74, 0x65, 0x52, 0xff, 0x6e, 0x5e, 0x4a, 0xf8, 0x75, 0x66, 0x54, 0xff, 0x75, 0x66, 0x53, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x72, 0x63, 0x4e, 0xfc, 0x6e, 0x60, 0x51, 0xff, 0x78, 0x6f, 0x6e, 0xff, 0xca, 0xc7, 0xcb, 0x58, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf4, 0xf3, 0xf1, 0x24, 0x83, 0x78, 0x66, 0xff, 0x70, 0x64, 0x50, 0xff, 0x6f, 0x61, 0x4d, 0xff, 0x71, 0x63, 0x4f, 0xff, 0x70, 0x63, 0x4f, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x6b, 0x5d, 0x4b, 0xff, 0x65, 0x5a, 0x51, 0xff, 0x7f, 0x78, 0x77, 0xff, 0xd9, 0xd7, 0xd8, 0x47, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xed, 0xec, 0xe9, 0x28, 0x8c, 0x82, 0x72, 0xff, 0x69, 0x5c, 0x47, 0xff, 0x6a, 0x5c, 0x47, 0xff, 0x6e, 0x61, 0x4c, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6b, 0x5e, 0x48, 0xff, 0x66, 0x59, 0x41, 0xfb, 0x76, 0x6a, 0x59, 0xff, 0x9b, 0x93, 0x8d, 0xc3, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x04, 0xb2, 0xaa, 0xa0, 0xc0, 0x73, 0x63, 0x51, 0xff, 0x6b, 0x5a, 0x47, 0xff, 0x73, 0x64, 0x51, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x74, 0x65, 0x52, 0xff, 0x73, 0x64, 0x50, 0xff, 0x6d, 0x5f, 0x4c, 0xff, 0x77, 0x6c, 0x63, 0xff, 0xae, 0xaa, 0xab, 0xa0, 0xfe, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfb, 0xfb, 0xfa, 0x0c, 0x8b, 0x81, 0x71, 0xf8, 0x74, 0x67, 0x54, 0xff, 0x6d, 0x5f, 0x4a, 0xff, 0x70, 0x62, 0x4e, 0xff, 0x6f, 0x62, 0x4f, 0xff, 0x6e, 0x62, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6f, 0x61, 0x4d, 0xff, 0x69, 0x5c, 0x4a, 0xff, 0x6e, 0x65, 0x5d, 0xff, 0xa2, 0x9d, 0x9d, 0xcf, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x08, 0xb6, 0xb0, 0xa5, 0x83, 0x6f, 0x62, 0x4d, 0xff, 0x65, 0x57, 0x40, 0xff, 0x6d, 0x60, 0x4b, 0xff, 0x6c, 0x5f, 0x49, 0xff, 0x6b, 0x5d, 0x48, 0xff, 0x68, 0x5a, 0x44, 0xff, 0x66, 0x59, 0x43, 0xff, 0x7e, 0x73, 0x65, 0xff, 0xd5, 0xd1, 0xd0, 0x54, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf0, 0xef, 0xed, 0x28, 0x92, 0x86, 0x78, 0xff, 0x7a, 0x6c, 0x5b, 0xff, 0x6d, 0x5d, 0x4a, 0xff, 0x6b, 0x5c, 0x47, 0xff, 0x6e, 0x5f, 0x4a, 0xff, 0x70, 0x61, 0x4c, 0xfc, 0x6d, 0x5d, 0x47, 0xff, 0x70, 0x63, 0x55, 0xff, 0x8c, 0x85, 0x83, 0xff, 0xf1, 0xf0, 0xf0, 0x28, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfb, 0xfb, 0xfa, 0x10, 0x9b, 0x91, 0x84, 0xff, 0x77, 0x6a, 0x57, 0xff, 0x69, 0x5c, 0x48, 0xff, 0x6e, 0x61, 0x4d, 0xff, 0x6e, 0x62, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4e, 0xff, 0x6d, 0x5f, 0x4b, 0xff, 0x6a, 0x5d, 0x4b, 0xff, 0x75, 0x6b, 0x63, 0xff, 0xdb, 0xd8, 0xd8, 0x53, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xeb, 0xe9, 0xe6, 0x2f, 0x8c, 0x81, 0x71, 0xff, 0x65, 0x57, 0x41, 0xff, 0x63, 0x55, 0x3f, 0xff, 0x67, 0x59, 0x44, 0xff, 0x6c, 0x5f, 0x4d, 0xff, 0x74, 0x68, 0x5b, 0xff, 0x86, 0x7d, 0x73, 0xff, 0xcc, 0xc9, 0xc4, 0x68, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xf3, 0xf2, 0xf1, 0x23, 0xbe, 0xb7, 0xaf, 0x94, 0x92, 0x88, 0x7a, 0xff, 0x84, 0x77, 0x66, 0xff, 0x78, 0x6b, 0x58, 0xff, 0x72, 0x64, 0x51, 0xff, 0x7a, 0x6c, 0x5a, 0xff, 0x90, 0x87, 0x7e, 0xff, 0xd2, 0xd0, 0xd0, 0x50, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfb, 0xfb, 0xfa, 0x13, 0xa5, 0x9d, 0x91, 0xff, 0x78, 0x6c, 0x5a, 0xff, 0x67, 0x5a, 0x46, 0xfc, 0x6e, 0x61, 0x4e, 0xff, 0x6e, 0x61, 0x4f, 0xff, 0x6e, 0x61, 0x4f, 0xff, 0x6e, 0x62, 0x4f, 0xff, 0x6d, 0x60, 0x4a, 0xff, 0x6e, 0x60, 0x4e, 0xff, 0x77, 0x6c, 0x66, 0xff, 0xf7, 0xf6, 0xf7, 0x17, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfe, 0xfe, 0x08, 0xd1, 0xcd, 0xc7, 0x68, 0x93, 0x89, 0x7a, 0xff, 0x81, 0x75, 0x64, 0xff, 0x8c, 0x81, 0x73, 0xff, 0x9b, 0x93, 0x89, 0xff, 0xc9, 0xc6, 0xc3, 0x6b, 0xf1, 0xf0, 0xf1, 0x24, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x0b, 0xf8, 0xf8, 0xf7, 0x17, 0xe7, 0xe4, 0xe1, 0x38, 0xa4, 0x9b, 0x90, 0xeb, 0x8b, 0x80, 0x72, 0xff, 0xc1, 0xbb, 0xb3, 0x63, 0xf8, 0xf8, 0xf8, 0x17, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfd, 0xfc, 0x0f, 0xab, 0xa2, 0x97, 0xef, 0x75, 0x68, 0x56, 0xff, 0x64, 0x56, 0x41, 0xff, 0x6b, 0x5e, 0x4a, 0xff, 0x6b, 0x5e, 0x4a, 0xff, 0x6b, 0x5e, 0x4a, 0xff, 0x6c, 0x5f, 0x4a, 0xff, 0x69, 0x5b, 0x44, 0xfc, 0x6d, 0x60, 0x4e, 0xff, 0x81, 0x78, 0x73, 0xff, 0xf9, 0xf9, 0xf9, 0x10, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x04, 0xf7, 0xf6, 0xf5, 0x1f, 0xf4, 0xf3, 0xf2, 0x1f, 0xf5, 0xf4, 0xf3, 0x1f, 0xf9, 0xf9, 0xf8, 0x1c, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfb, 0xfb, 0xfa, 0x13, 0xf4, 0xf4, 0xf2, 0x1b, 0xfe, 0xfe, 0xfe, 0x04, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xe7, 0xe6, 0xe2, 0x2f, 0x7b, 0x6f, 0x5c, 0xff, 0x67, 0x5a, 0x44, 0xff, 0x6b, 0x5e, 0x49, 0xff, 0x6b, 0x5e, 0x4a, 0xff, 0x6b, 0x5e, 0x4a, 0xff, 0x6b, 0x5d, 0x48, 0xff, 0x67, 0x59, 0x44, 0xff, 0x74, 0x68, 0x59, 0xff, 0x97, 0x90, 0x8c, 0xff, 0xfb, 0xfb, 0xfc, 0x10, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xfd, 0xfd, 0x0b, 0xb1, 0xab, 0xa0, 0xb8, 0x8a, 0x80, 0x6f, 0xff, 0x89, 0x7e, 0x6f, 0xe7, 0x89, 0x7f, 0x6f, 0xe3, 0x89, 0x7e, 0x6f, 0xe4, 0x87, 0x7b, 0x6d, 0xe7, 0x83, 0x78, 0x6a, 0xff, 0x94, 0x8b, 0x81, 0xf7, 0xee, 0xec, 0xec, 0x28, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x03, 0xfe, 0xfe, 0xfe, 0x08, 0xfc, 0xfc, 0xfc, 0x0c, 0xfc, 0xfc, 0xfc, 0x0c, 0xfc, 0xfc, 0xfc, 0x0b, 0xfb, 0xfb, 0xfb, 0x10, 0xfa, 0xf9, 0xf9, 0x18, 0xfb, 0xfa, 0xfa, 0x13, 0xfd, 0xfd, 0xfd, 0x0b, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00,
-#endif
-};
-
-const lv_img_dsc_t img_cogwheel_argb = {
-  .header.always_zero = 0,
-  .header.w = 100,
-  .header.h = 100,
-  .data_size = 10000 * LV_IMG_PX_SIZE_ALPHA_BYTE,
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
-  .data = img_cogwheel_argb_map,
-};
-
-#endif /* LV_BUILD_EXAMPLES */
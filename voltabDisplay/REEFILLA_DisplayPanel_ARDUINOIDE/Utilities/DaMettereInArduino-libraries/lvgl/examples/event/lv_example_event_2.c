@@ -1,46 +0,0 @@
-#include "../lv_examples.h"
-#if LV_BUILD_EXAMPLES && LV_USE_SWITCH
-
-static void event_cb(lv_event_t * e)
-{
-    lv_event_code_t code = lv_event_get_code(e);
-    lv_obj_t * label = lv_event_get_user_data(e);
-
-    switch(code) {
-        case LV_EVENT_PRESSED:
-            lv_label_set_text(label, "The last button event:\nLV_EVENT_PRESSED");
-            break;
-        case LV_EVENT_CLICKED:
-            lv_label_set_text(label, "The last button event:\nLV_EVENT_CLICKED");
-            break;
-        case LV_EVENT_LONG_PRESSED:
-            lv_label_set_text(label, "The last button event:\nLV_EVENT_LONG_PRESSED");
-            break;
-        case LV_EVENT_LONG_PRESSED_REPEAT:
-            lv_label_set_text(label, "The last button event:\nLV_EVENT_LONG_PRESSED_REPEAT");
-            break;
-        default:
-            break;
-    }
-}
-
-/**
- * Handle multiple events
- */
-void lv_example_event_2(void)
-{
-    lv_obj_t * btn = lv_btn_create(lv_scr_act());
-    lv_obj_set_size(btn, 100, 50);
-    lv_obj_center(btn);
-
-    lv_obj_t * btn_label = lv_label_create(btn);
-    lv_label_set_text(btn_label, "Click me!");
-    lv_obj_center(btn_label);
-
-    lv_obj_t * info_label = lv_label_create(lv_scr_act());
-    lv_label_set_text(info_label, "The last button event:\nNone");
-
-    lv_obj_add_event_cb(btn, event_cb, LV_EVENT_ALL, info_label);
-}
-
-#endif
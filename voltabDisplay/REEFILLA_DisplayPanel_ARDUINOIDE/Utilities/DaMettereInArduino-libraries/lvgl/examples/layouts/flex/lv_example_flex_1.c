@@ -1,44 +0,0 @@
-#include "../../lv_examples.h"
-#if LV_USE_FLEX && LV_BUILD_EXAMPLES
-
-/**
- * A simple row and a column layout with flexbox
- */
-void lv_example_flex_1(void)
-{
-    /*Create a container with ROW flex direction*/
-    lv_obj_t * cont_row = lv_obj_create(lv_scr_act());
-    lv_obj_set_size(cont_row, 300, 75);
-    lv_obj_align(cont_row, LV_ALIGN_TOP_MID, 0, 5);
-    lv_obj_set_flex_flow(cont_row, LV_FLEX_FLOW_ROW);
-
-    /*Create a container with COLUMN flex direction*/
-    lv_obj_t * cont_col = lv_obj_create(lv_scr_act());
-    lv_obj_set_size(cont_col, 200, 150);
-    lv_obj_align_to(cont_col, cont_row, LV_ALIGN_OUT_BOTTOM_MID, 0, 5);
-    lv_obj_set_flex_flow(cont_col, LV_FLEX_FLOW_COLUMN);
-
-    uint32_t i;
-    for(i = 0; i < 10; i++) {
-        lv_obj_t * obj;
-        lv_obj_t * label;
-
-        /*Add items to the row*/
-        obj = lv_btn_create(cont_row);
-        lv_obj_set_size(obj, 100, LV_PCT(100));
-
-        label = lv_label_create(obj);
-        lv_label_set_text_fmt(label, "Item: %"LV_PRIu32, i);
-        lv_obj_center(label);
-
-        /*Add items to the column*/
-        obj = lv_btn_create(cont_col);
-        lv_obj_set_size(obj, LV_PCT(100), LV_SIZE_CONTENT);
-
-        label = lv_label_create(obj);
-        lv_label_set_text_fmt(label, "Item: %"LV_PRIu32, i);
-        lv_obj_center(label);
-    }
-}
-
-#endif
@@ -1,30 +0,0 @@
-#include "../../lv_examples.h"
-#if LV_USE_FLEX && LV_BUILD_EXAMPLES
-
-/**
- * Demonstrate flex grow.
- */
-void lv_example_flex_3(void)
-{
-    lv_obj_t * cont = lv_obj_create(lv_scr_act());
-    lv_obj_set_size(cont, 300, 220);
-    lv_obj_center(cont);
-    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW);
-
-    lv_obj_t * obj;
-    obj = lv_obj_create(cont);
-    lv_obj_set_size(obj, 40, 40);           /*Fix size*/
-
-    obj = lv_obj_create(cont);
-    lv_obj_set_height(obj, 40);
-    lv_obj_set_flex_grow(obj, 1);           /*1 portion from the free space*/
-
-    obj = lv_obj_create(cont);
-    lv_obj_set_height(obj, 40);
-    lv_obj_set_flex_grow(obj, 2);           /*2 portion from the free space*/
-
-    obj = lv_obj_create(cont);
-    lv_obj_set_size(obj, 40, 40);           /*Fix size. It is flushed to the right by the "grow" items*/
-}
-
-#endif
@@ -1,40 +0,0 @@
-#include "../../lv_examples.h"
-#if LV_USE_GRID && LV_BUILD_EXAMPLES
-
-/**
- * Demonstrate track placement
- */
-void lv_example_grid_4(void)
-{
-    static lv_coord_t col_dsc[] = {60, 60, 60, LV_GRID_TEMPLATE_LAST};
-    static lv_coord_t row_dsc[] = {45, 45, 45, LV_GRID_TEMPLATE_LAST};
-
-    /*Add space between the columns and move the rows to the bottom (end)*/
-
-    /*Create a container with grid*/
-    lv_obj_t * cont = lv_obj_create(lv_scr_act());
-    lv_obj_set_grid_align(cont, LV_GRID_ALIGN_SPACE_BETWEEN, LV_GRID_ALIGN_END);
-    lv_obj_set_grid_dsc_array(cont, col_dsc, row_dsc);
-    lv_obj_set_size(cont, 300, 220);
-    lv_obj_center(cont);
-
-    lv_obj_t * label;
-    lv_obj_t * obj;
-    uint32_t i;
-    for(i = 0; i < 9; i++) {
-        uint8_t col = i % 3;
-        uint8_t row = i / 3;
-
-        obj = lv_obj_create(cont);
-        /*Stretch the cell horizontally and vertically too
-         *Set span to 1 to make the cell 1 column/row sized*/
-        lv_obj_set_grid_cell(obj, LV_GRID_ALIGN_STRETCH, col, 1,
-                             LV_GRID_ALIGN_STRETCH, row, 1);
-
-        label = lv_label_create(obj);
-        lv_label_set_text_fmt(label, "%d,%d", col, row);
-        lv_obj_center(label);
-    }
-}
-
-#endif
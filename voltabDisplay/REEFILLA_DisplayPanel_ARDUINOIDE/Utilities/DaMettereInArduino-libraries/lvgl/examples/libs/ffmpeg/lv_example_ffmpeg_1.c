@@ -1,28 +0,0 @@
-#include "../../lv_examples.h"
-#if LV_BUILD_EXAMPLES
-#if LV_USE_FFMPEG
-
-/**
- * Open an image from a file
- */
-void lv_example_ffmpeg_1(void)
-{
-    lv_obj_t * img = lv_img_create(lv_scr_act());
-    lv_img_set_src(img, "./lvgl/examples/libs/ffmpeg/ffmpeg.png");
-    lv_obj_center(img);
-}
-
-#else
-
-void lv_example_ffmpeg_1(void)
-{
-    /*TODO
-     *fallback for online examples*/
-
-    lv_obj_t * label = lv_label_create(lv_scr_act());
-    lv_label_set_text(label, "FFmpeg is not installed");
-    lv_obj_center(label);
-}
-
-#endif
-#endif
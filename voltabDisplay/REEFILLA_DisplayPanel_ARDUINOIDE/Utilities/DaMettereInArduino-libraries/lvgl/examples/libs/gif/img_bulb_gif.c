@@ -1,1127 +0,0 @@
-#include "../../../lvgl.h"
-
-#ifndef LV_ATTRIBUTE_MEM_ALIGN
-    #define LV_ATTRIBUTE_MEM_ALIGN
-#endif
-
-#ifndef LV_ATTRIBUTE_IMG_BULB_GIF
-    #define LV_ATTRIBUTE_IMG_BULB_GIF
-#endif
-
-static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_BULB_GIF uint8_t img_blub_gif_map[] = {
-    0x47, 0x49, 0x46, 0x38, 0x39, 0x61, 0x3c, 0x00, 0x50, 0x00, 0xf7, 0x00, 0x00, 0xfa, 0xfb, 0xfb,
-    0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xd9, 0xec, 0xfe, 0x1e, 0x93, 0xfe, 0x23, 0x95, 0xfd, 0x5f,
-    0xb2, 0xff, 0x52, 0xac, 0xfe, 0xb1, 0xd8, 0xff, 0xce, 0xe7, 0xff, 0xa3, 0xd2, 0xff, 0x80, 0xc0,
-    0xfe, 0xe2, 0xf1, 0xfe, 0xca, 0xe5, 0xff, 0xf4, 0xf7, 0xf9, 0x8b, 0xc4, 0xff, 0x7e, 0xbe, 0xff,
-    0xe0, 0xee, 0xff, 0xc6, 0xe4, 0xff, 0xbc, 0xde, 0xff, 0xec, 0xf5, 0xff, 0x1d, 0x92, 0xfd, 0x3f,
-    0x9f, 0xfe, 0x71, 0xbb, 0xff, 0x9f, 0xcf, 0xfe, 0xf2, 0xf9, 0xff, 0x31, 0x9c, 0xfe, 0x98, 0xcb,
-    0xff, 0x49, 0xa8, 0xfe, 0xbe, 0xe0, 0xff, 0x6d, 0xb3, 0xfe, 0x4c, 0xa9, 0xfe, 0xc4, 0xe2, 0xff,
-    0x4a, 0xa8, 0xfe, 0x45, 0xa3, 0xfa, 0xd2, 0xe7, 0xfc, 0xbd, 0xde, 0xff, 0xf9, 0xf9, 0xf9, 0xf7,
-    0xf8, 0xf8, 0xe2, 0xe2, 0xe2, 0xdd, 0xde, 0xdd, 0xe5, 0xea, 0xef, 0xff, 0xb7, 0x50, 0xff, 0xba,
-    0x56, 0xfd, 0xb7, 0x51, 0xff, 0xb7, 0x4f, 0xff, 0xb8, 0x50, 0xc5, 0xc4, 0xc1, 0xfa, 0xb7, 0x55,
-    0xee, 0xb3, 0x5b, 0xf7, 0xb5, 0x57, 0xf1, 0xb5, 0x5e, 0xf5, 0xb6, 0x5b, 0xfd, 0xb7, 0x54, 0xcd,
-    0xcd, 0xcc, 0xe5, 0xe8, 0xea, 0xcf, 0xb2, 0x85, 0xf5, 0xb8, 0x5f, 0xee, 0xef, 0xf0, 0xc0, 0xbf,
-    0xbe, 0xe4, 0xb1, 0x66, 0xff, 0xb7, 0x51, 0xda, 0xda, 0xda, 0xec, 0xed, 0xee, 0xdf, 0xdf, 0xdf,
-    0xd1, 0xd2, 0xd1, 0xe4, 0xe5, 0xe5, 0xff, 0xe5, 0xbf, 0xff, 0xc5, 0x73, 0xff, 0xeb, 0xce, 0xf0,
-    0xf3, 0xf5, 0xc8, 0xc8, 0xc8, 0xed, 0xb4, 0x61, 0xd8, 0xd8, 0xd7, 0xff, 0xdb, 0xa7, 0xff, 0xe1,
-    0xb7, 0xff, 0xc1, 0x68, 0xfc, 0xf7, 0xee, 0xff, 0xc9, 0x7c, 0xff, 0xd2, 0x92, 0xfa, 0xba, 0x5e,
-    0xff, 0xcc, 0x84, 0xff, 0xe8, 0xc6, 0xff, 0xfb, 0xf6, 0xff, 0xf5, 0xe8, 0xff, 0xf9, 0xf1, 0xff,
-    0xed, 0xd5, 0xc9, 0xba, 0xa0, 0xf1, 0xf1, 0xf1, 0xf6, 0xf6, 0xf6, 0xeb, 0xb7, 0x6a, 0xe3, 0xb5,
-    0x6f, 0xff, 0xbd, 0x5f, 0xa9, 0xa9, 0xa9, 0xd6, 0xd6, 0xd6, 0xb2, 0xb2, 0xb2, 0xb9, 0xb9, 0xb9,
-    0x97, 0x98, 0x96, 0x9e, 0x9e, 0x9e, 0xa5, 0xa5, 0xa5, 0x45, 0x45, 0x45, 0x46, 0x46, 0x46, 0x47,
-    0x47, 0x47, 0x4a, 0x4a, 0x4a, 0x4d, 0x4d, 0x4d, 0x50, 0x50, 0x50, 0x53, 0x53, 0x53, 0x58, 0x58,
-    0x58, 0x5a, 0x5a, 0x5a, 0x5d, 0x5d, 0x5d, 0x5f, 0x5f, 0x5f, 0x63, 0x63, 0x63, 0x66, 0x66, 0x66,
-    0x6a, 0x6a, 0x6a, 0x6d, 0x6d, 0x6d, 0x70, 0x70, 0x70, 0x75, 0x75, 0x75, 0x79, 0x79, 0x79, 0x7c,
-    0x7c, 0x7c, 0x80, 0x80, 0x80, 0x84, 0x84, 0x84, 0x88, 0x88, 0x88, 0x8b, 0x8b, 0x8b, 0x8f, 0x8f,
-    0x8f, 0xd5, 0xd5, 0xd5, 0xe7, 0xe7, 0xe7, 0xea, 0xea, 0xea, 0xf4, 0xf4, 0xf4, 0xf2, 0xf4, 0xf5,
-    0xff, 0xd6, 0x9b, 0xff, 0xde, 0xaf, 0xff, 0xfe, 0xfc, 0xff, 0xf1, 0xde, 0xff, 0xd6, 0x9c, 0xff,
-    0xcf, 0x8b, 0xfa, 0xd6, 0xa1, 0xf7, 0xc4, 0x7b, 0xf8, 0xbd, 0x67, 0xeb, 0xb5, 0x65, 0xf9, 0xf9,
-    0xf8, 0xf1, 0xdb, 0xbb, 0xdb, 0xd7, 0xce, 0xe3, 0xdb, 0xcc, 0xda, 0xd2, 0xc3, 0xe3, 0xd6, 0xc0,
-    0xae, 0xae, 0xae, 0xe4, 0xcb, 0xa6, 0xe5, 0xe2, 0xdc, 0xd0, 0xb8, 0x90, 0x56, 0x56, 0x56, 0xcd,
-    0xcb, 0xc6, 0xcf, 0xc4, 0xaf, 0xcf, 0xc9, 0xbc, 0xd0, 0xbe, 0xa0, 0xd8, 0xbb, 0x8e, 0xd8, 0xbf,
-    0x98, 0xd8, 0xc5, 0xa5, 0xd8, 0xd4, 0xcb, 0xda, 0xb7, 0x82, 0xdb, 0xca, 0xaf, 0xdb, 0xcd, 0xb6,
-    0xdd, 0xbe, 0x8e, 0xdd, 0xc3, 0x9b, 0xdd, 0xdb, 0xd5, 0xde, 0xc8, 0xa5, 0xe0, 0xbb, 0x82, 0xe2,
-    0xb8, 0x79, 0xe4, 0xc2, 0x8e, 0xe4, 0xc6, 0x99, 0xe4, 0xd1, 0xb3, 0xe5, 0xbe, 0x84, 0xe5, 0xdf,
-    0xd4, 0xe9, 0xdb, 0xc5, 0xe9, 0xde, 0xce, 0xea, 0xbe, 0x7b, 0xea, 0xc1, 0x85, 0xea, 0xd3, 0xb0,
-    0xea, 0xd8, 0xbc, 0xeb, 0xba, 0x71, 0xeb, 0xc5, 0x8e, 0xeb, 0xcb, 0x9a, 0xeb, 0xe4, 0xd9, 0xec,
-    0xd0, 0xa5, 0xec, 0xe9, 0xe3, 0xed, 0xec, 0xea, 0xef, 0xe7, 0xd9, 0xf0, 0xbc, 0x71, 0xf0, 0xc0,
-    0x7a, 0xf1, 0xb9, 0x68, 0xf3, 0xf0, 0xea, 0xf4, 0xc7, 0x86, 0xf4, 0xcb, 0x8e, 0xf7, 0xc0, 0x71,
-    0xf9, 0xf7, 0xf4, 0xfd, 0xf5, 0xeb, 0xf5, 0xd0, 0x99, 0xda, 0xcf, 0xbd, 0xdc, 0xb1, 0x6f, 0xf2,
-    0xd7, 0xb0, 0xed, 0xdf, 0xca, 0xc8, 0xb3, 0x8f, 0xd9, 0xb3, 0x78, 0xd2, 0xb0, 0x7c, 0xf3, 0xed,
-    0xe4, 0xf4, 0xf3, 0xf1, 0xf5, 0xea, 0xd8, 0xf5, 0xe3, 0xc9, 0xc1, 0xb7, 0xa3, 0xc5, 0xbe, 0xaf,
-    0xd7, 0xac, 0x6b, 0xc1, 0xb2, 0x95, 0xd2, 0xd6, 0xd6, 0xcf, 0xa9, 0x70, 0xbc, 0xb9, 0xb1, 0xc7,
-    0xa8, 0x76, 0x41, 0x84, 0xd5, 0xb0, 0xa2, 0x86, 0x39, 0x81, 0xd9, 0x78, 0x92, 0xad, 0x88, 0xa0,
-    0xb5, 0xb9, 0xcf, 0xe9, 0xbf, 0xa5, 0x7b, 0x40, 0x83, 0xd4, 0x80, 0x95, 0xa8, 0x80, 0x96, 0xa9,
-    0x49, 0x86, 0xcf, 0x87, 0x96, 0xa2, 0x48, 0x85, 0xcd, 0x60, 0x8c, 0xbe, 0x2e, 0x7e, 0xdf, 0x18,
-    0x78, 0xee, 0x9e, 0xbd, 0xe1, 0x06, 0x74, 0xfc, 0x00, 0x72, 0xff, 0x01, 0x73, 0xff, 0x47, 0xa1,
-    0xfe, 0x0e, 0x76, 0xf7, 0x16, 0x7d, 0xfc, 0x32, 0x8d, 0xfe, 0x61, 0xa7, 0xfe, 0x24, 0x85, 0xfc,
-    0x55, 0xa1, 0xff, 0x54, 0xa1, 0xff, 0x1e, 0x88, 0xfa, 0x20, 0x7b, 0xea, 0x9e, 0x9c, 0x93, 0x61,
-    0x9c, 0xdc, 0x6f, 0x90, 0xb3, 0x84, 0xaf, 0xe1, 0x54, 0x89, 0xc6, 0x24, 0x7c, 0xe7, 0xa7, 0x9f,
-    0x8c, 0x68, 0x8e, 0xb7, 0x8f, 0x98, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xff, 0x0b,
-    0x4e, 0x45, 0x54, 0x53, 0x43, 0x41, 0x50, 0x45, 0x32, 0x2e, 0x30, 0x03, 0x01, 0x00, 0x00, 0x00,
-    0x21, 0xf9, 0x04, 0x05, 0x25, 0x00, 0x04, 0x00, 0x21, 0xfe, 0x23, 0x52, 0x65, 0x73, 0x69, 0x7a,
-    0x65, 0x64, 0x20, 0x6f, 0x6e, 0x20, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x65, 0x7a,
-    0x67, 0x69, 0x66, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x72, 0x65, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x2c,
-    0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x50, 0x00, 0x00, 0x08, 0xff, 0x00, 0x03, 0x08, 0x1c, 0x48,
-    0xb0, 0xa0, 0xc1, 0x83, 0x08, 0x13, 0x2a, 0x5c, 0xc8, 0xb0, 0xa1, 0xc3, 0x87, 0x10, 0x23, 0x4a,
-    0x9c, 0x48, 0xb1, 0xa2, 0xc5, 0x8b, 0x18, 0x33, 0x6a, 0xdc, 0xc8, 0xb1, 0xa3, 0xc7, 0x8f, 0x20,
-    0x43, 0x8a, 0x1c, 0x49, 0xb2, 0xa4, 0xc9, 0x93, 0x28, 0x53, 0xaa, 0x5c, 0xc9, 0xb2, 0xa5, 0xcb,
-    0x97, 0x30, 0x63, 0xca, 0x9c, 0x49, 0xb3, 0xa6, 0xcd, 0x9b, 0x38, 0x63, 0x52, 0x50, 0xf0, 0xae,
-    0x5d, 0x3a, 0x75, 0xf1, 0x36, 0x44, 0x88, 0x99, 0xe1, 0x81, 0xba, 0x74, 0x48, 0x93, 0x22, 0x7d,
-    0xc7, 0xc0, 0x65, 0x04, 0x77, 0x48, 0xdd, 0x61, 0x18, 0x81, 0x41, 0x69, 0xba, 0x76, 0x0d, 0x58,
-    0x46, 0x80, 0xf7, 0x13, 0x41, 0x86, 0x06, 0x0f, 0xe2, 0x59, 0xfd, 0x99, 0x35, 0x65, 0x06, 0xa8,
-    0xed, 0x06, 0x8c, 0x80, 0x3a, 0x36, 0x69, 0xbb, 0xa6, 0x28, 0x37, 0x20, 0x8d, 0x47, 0xe2, 0x68,
-    0x5b, 0xa5, 0x1e, 0x50, 0x52, 0x38, 0xea, 0xce, 0xee, 0x5d, 0xab, 0x43, 0x4d, 0x22, 0x40, 0x1a,
-    0xc1, 0xc3, 0xdf, 0xb1, 0x18, 0x4e, 0x1a, 0x4e, 0x17, 0xcf, 0xef, 0xe1, 0xa5, 0x27, 0xd9, 0x3e,
-    0x1e, 0x0b, 0xef, 0xa4, 0xcf, 0xc9, 0x63, 0xd5, 0x45, 0xc6, 0x4c, 0x59, 0x31, 0x67, 0xab, 0xef,
-    0x4e, 0x0e, 0xfe, 0x9c, 0x54, 0xc1, 0xc9, 0xbd, 0xa4, 0x7f, 0xc2, 0x35, 0xf9, 0x20, 0x35, 0x04,
-    0xb3, 0x92, 0x27, 0xc3, 0xa3, 0xa0, 0x32, 0xc2, 0xe5, 0xc7, 0xea, 0x06, 0xb0, 0x1c, 0xe1, 0xb8,
-    0xad, 0xba, 0xb2, 0x2c, 0xe5, 0x1e, 0xde, 0xf0, 0x32, 0x03, 0xd7, 0xbb, 0xed, 0x32, 0xc0, 0x14,
-    0xde, 0xf6, 0x41, 0xcc, 0x11, 0x7f, 0x47, 0x10, 0xed, 0x8d, 0x54, 0x9d, 0xf2, 0x98, 0x08, 0x7a,
-    0xab, 0x43, 0x40, 0x93, 0xc2, 0x88, 0xef, 0xdf, 0x57, 0xe7, 0x9c, 0xa4, 0xf9, 0xe7, 0x8b, 0xf9,
-    0xf3, 0xe6, 0xb3, 0xc8, 0xec, 0xc3, 0xa6, 0xbd, 0xfb, 0xf6, 0x7d, 0x64, 0x9a, 0x78, 0xff, 0x1e,
-    0xcb, 0xcc, 0x3d, 0xf4, 0xd9, 0xe4, 0xa1, 0x29, 0x44, 0x4d, 0x99, 0xff, 0x65, 0xa4, 0x01, 0x44,
-    0x4d, 0x7d, 0xec, 0x71, 0x86, 0x19, 0x7a, 0x9c, 0x80, 0x13, 0x00, 0x00, 0x8c, 0xe7, 0xe0, 0x83,
-    0x30, 0x99, 0xf0, 0x07, 0x16, 0x3a, 0xfc, 0x80, 0x8b, 0x1f, 0x7e, 0xf4, 0xa1, 0xe1, 0x86, 0x1c,
-    0xf6, 0x81, 0xa1, 0x1f, 0xb8, 0xfc, 0xa0, 0x03, 0x16, 0x7f, 0x98, 0xf0, 0xd1, 0x0f, 0x7d, 0x08,
-    0x71, 0x02, 0x10, 0x28, 0xf8, 0xe0, 0x43, 0x12, 0x49, 0x78, 0xc1, 0xc7, 0x8c, 0x34, 0xce, 0xe8,
-    0x05, 0x8c, 0x2e, 0xa2, 0x00, 0xc4, 0x09, 0x42, 0xf4, 0xf1, 0x03, 0x84, 0x40, 0x06, 0x29, 0xe4,
-    0x90, 0x44, 0x16, 0x69, 0xe4, 0x91, 0x48, 0x56, 0x74, 0x5d, 0x00, 0x4b, 0xce, 0x94, 0x01, 0x03,
-    0x14, 0x30, 0x00, 0x00, 0x94, 0x51, 0x52, 0x40, 0x1b, 0x4c, 0x03, 0x50, 0x99, 0xc1, 0x00, 0x19,
-    0x58, 0x49, 0x41, 0x93, 0x2d, 0x05, 0x04, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x06, 0x00, 0x00, 0x00,
-    0x2c, 0x19, 0x00, 0x33, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x08, 0x0c, 0x00, 0xb9, 0xd9, 0x43,
-    0x07, 0x00, 0x80, 0xb0, 0x5b, 0x00, 0x02, 0x02, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x04, 0x00, 0x00,
-    0x00, 0x2c, 0x19, 0x00, 0x32, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x08, 0x16, 0x00, 0xe9, 0xa9,
-    0x03, 0x40, 0x90, 0xa0, 0xb3, 0x19, 0x57, 0xf0, 0xb1, 0x2b, 0x08, 0xc0, 0x8a, 0x95, 0x66, 0x29,
-    0x00, 0x04, 0x04, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x02, 0x00, 0x2c, 0x18, 0x00, 0x32,
-    0x00, 0x09, 0x00, 0x03, 0x00, 0x00, 0x08, 0x19, 0x00, 0x4b, 0x94, 0xba, 0xb2, 0xcd, 0x9c, 0x80,
-    0x83, 0x08, 0x55, 0xb4, 0xe8, 0x61, 0xea, 0x8b, 0x3d, 0x74, 0x08, 0x0f, 0x5a, 0x99, 0x28, 0x2c,
-    0x20, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x00, 0x00, 0x2c, 0x18, 0x00, 0x31, 0x00, 0x0a,
-    0x00, 0x04, 0x00, 0x00, 0x08, 0x20, 0x00, 0x53, 0x6c, 0xb3, 0x47, 0x4f, 0x1d, 0x80, 0x83, 0x07,
-    0x17, 0xd5, 0x68, 0xd1, 0x42, 0xcb, 0x33, 0x7b, 0xec, 0x10, 0x22, 0x64, 0xd8, 0x42, 0x86, 0x26,
-    0x6e, 0x12, 0x33, 0x02, 0x08, 0x08, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x07, 0x00, 0x00, 0x00, 0x2c,
-    0x18, 0x00, 0x30, 0x00, 0x0a, 0x00, 0x04, 0x00, 0x00, 0x08, 0x20, 0x00, 0x01, 0xa0, 0x53, 0x07,
-    0xa0, 0xa0, 0x41, 0x00, 0xcb, 0x64, 0xc8, 0xd0, 0x42, 0x69, 0x9b, 0xb9, 0x83, 0x06, 0x5b, 0x48,
-    0x34, 0xf5, 0xc5, 0x1e, 0xc4, 0x82, 0x2d, 0x54, 0x30, 0x0a, 0x08, 0x00, 0x21, 0xf9, 0x04, 0x05,
-    0x03, 0x00, 0x00, 0x00, 0x2c, 0x18, 0x00, 0x30, 0x00, 0x0b, 0x00, 0x03, 0x00, 0x00, 0x08, 0x1d,
-    0x00, 0xb9, 0x7d, 0x19, 0x18, 0xc9, 0x1e, 0x3a, 0x00, 0x08, 0x01, 0x10, 0x6a, 0xc1, 0x90, 0xa1,
-    0x0c, 0x4a, 0xdb, 0xcc, 0x25, 0x9c, 0x08, 0x80, 0x61, 0x8d, 0x60, 0x01, 0x01, 0x00, 0x21, 0xf9,
-    0x04, 0x05, 0x04, 0x00, 0x00, 0x00, 0x2c, 0x18, 0x00, 0x2f, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x00,
-    0x08, 0x22, 0x00, 0x01, 0xb0, 0xd3, 0x67, 0xcf, 0x1e, 0x3b, 0x00, 0x08, 0x11, 0xc6, 0xaa, 0xd1,
-    0xa2, 0x21, 0x0b, 0x2d, 0x5f, 0xec, 0xa1, 0x4b, 0x48, 0xb1, 0x61, 0x0b, 0x1a, 0xb7, 0x28, 0x6a,
-    0xec, 0x01, 0x20, 0x20, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x00, 0x00, 0x2c, 0x18, 0x00,
-    0x2f, 0x00, 0x0b, 0x00, 0x03, 0x00, 0x00, 0x08, 0x1f, 0x00, 0xed, 0x7d, 0xd1, 0xa4, 0x45, 0x91,
-    0x16, 0x4a, 0x91, 0xec, 0xa9, 0x03, 0x60, 0xac, 0x05, 0x80, 0x87, 0x2d, 0x22, 0xb6, 0x40, 0x12,
-    0xe4, 0xa1, 0xc5, 0x8b, 0x2d, 0x9a, 0x05, 0x04, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x07, 0x00, 0x00,
-    0x00, 0x2c, 0x17, 0x00, 0x2e, 0x00, 0x0d, 0x00, 0x03, 0x00, 0x00, 0x08, 0x20, 0x00, 0x01, 0x00,
-    0x40, 0x67, 0x2f, 0xd2, 0x97, 0x83, 0xdb, 0xe8, 0xa9, 0x13, 0x08, 0xe0, 0x8a, 0x8c, 0x16, 0x10,
-    0x23, 0xb6, 0xd8, 0xf2, 0x85, 0xa1, 0x45, 0x8b, 0x2d, 0x0e, 0x01, 0x08, 0x08, 0x00, 0x21, 0xf9,
-    0x04, 0x05, 0x03, 0x00, 0x00, 0x00, 0x2c, 0x17, 0x00, 0x2d, 0x00, 0x0d, 0x00, 0x03, 0x00, 0x00,
-    0x08, 0x23, 0x00, 0x01, 0x08, 0x04, 0xc0, 0xce, 0x9e, 0x41, 0x7b, 0xec, 0x06, 0x02, 0xa0, 0x17,
-    0xc9, 0x13, 0x8c, 0x16, 0x10, 0x5b, 0xb0, 0x30, 0xf5, 0x85, 0xdb, 0x22, 0x28, 0x2d, 0x14, 0x0e,
-    0x6c, 0xc1, 0x25, 0x58, 0x40, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x00, 0x00, 0x2c, 0x17,
-    0x00, 0x2c, 0x00, 0x0d, 0x00, 0x04, 0x00, 0x00, 0x08, 0x27, 0x00, 0x01, 0x08, 0x1c, 0xa8, 0x8e,
-    0x1d, 0xbb, 0x81, 0x03, 0xd1, 0xd9, 0xfb, 0x62, 0x0a, 0x46, 0x8b, 0x16, 0x32, 0x3c, 0x7d, 0xb1,
-    0xc7, 0xed, 0x4a, 0x8e, 0x87, 0x08, 0x1f, 0xb6, 0x30, 0x06, 0x80, 0x0b, 0xc2, 0x8f, 0x02, 0x03,
-    0x02, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x04, 0x00, 0x00, 0x00, 0x2c, 0x17, 0x00, 0x2c, 0x00, 0x0e,
-    0x00, 0x03, 0x00, 0x00, 0x08, 0x24, 0x00, 0x01, 0x08, 0x04, 0xc0, 0x0e, 0xdf, 0x33, 0x4f, 0xa6,
-    0x4c, 0x51, 0xfa, 0x62, 0xaf, 0x1d, 0x3a, 0x7b, 0x91, 0x3c, 0xd5, 0x68, 0xd1, 0x42, 0x20, 0xc5,
-    0x16, 0x2a, 0x9a, 0x19, 0xa3, 0x38, 0xb0, 0x63, 0xc7, 0x80, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x06,
-    0x00, 0x00, 0x00, 0x2c, 0x16, 0x00, 0x2b, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x08, 0x2b, 0x00,
-    0x01, 0x08, 0x1c, 0xa8, 0x4e, 0xdf, 0xb6, 0x2f, 0xcf, 0xbe, 0x44, 0xb2, 0x87, 0x6e, 0x20, 0x00,
-    0x76, 0xf6, 0x9e, 0x69, 0x69, 0x41, 0xb1, 0x62, 0x8b, 0x1c, 0x29, 0x52, 0x5c, 0x31, 0x05, 0x83,
-    0xa2, 0xc3, 0x8f, 0x02, 0x05, 0x81, 0x1c, 0x09, 0x20, 0x20, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x04,
-    0x00, 0x00, 0x00, 0x2c, 0x15, 0x00, 0x2a, 0x00, 0x12, 0x00, 0x04, 0x00, 0x00, 0x08, 0x31, 0x00,
-    0x01, 0x08, 0x1c, 0x38, 0x90, 0x9d, 0xbd, 0x6d, 0xdb, 0xf0, 0xd9, 0x43, 0x47, 0x70, 0xa0, 0x3a,
-    0x7a, 0x91, 0x3c, 0xc1, 0x68, 0x41, 0x91, 0xa2, 0x8c, 0x4c, 0x02, 0xbf, 0x44, 0x8a, 0xf4, 0x4c,
-    0x8b, 0x8a, 0x16, 0x0d, 0x05, 0xae, 0x20, 0x24, 0xb0, 0x59, 0x0f, 0x8a, 0x21, 0x53, 0x06, 0x04,
-    0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x01, 0x00, 0x2c, 0x14, 0x00, 0x29, 0x00, 0x13, 0x00,
-    0x04, 0x00, 0x00, 0x08, 0x32, 0x00, 0x03, 0x08, 0x1c, 0x48, 0x30, 0x80, 0x3a, 0x76, 0xf6, 0xec,
-    0xe9, 0x43, 0x57, 0xb0, 0x20, 0xc2, 0x67, 0x5a, 0x54, 0xb4, 0x98, 0x08, 0xc3, 0xd3, 0x11, 0x07,
-    0x60, 0xb6, 0x25, 0xb4, 0x17, 0x89, 0x92, 0x8c, 0x89, 0x05, 0x5b, 0x70, 0x69, 0x12, 0x80, 0xd0,
-    0x8a, 0x89, 0x28, 0x1b, 0x16, 0x0c, 0x08, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x00, 0x00,
-    0x2c, 0x14, 0x00, 0x28, 0x00, 0x14, 0x00, 0x04, 0x00, 0x00, 0x08, 0x35, 0x00, 0x01, 0x08, 0x1c,
-    0x48, 0x90, 0x20, 0x3b, 0x76, 0xea, 0x06, 0xa2, 0x2b, 0x38, 0x50, 0x9d, 0xbe, 0x2f, 0x9e, 0x68,
-    0xa8, 0x50, 0x01, 0xc3, 0xd4, 0x17, 0x0a, 0xc6, 0xae, 0x6c, 0xb3, 0x77, 0x50, 0x1f, 0xbe, 0x67,
-    0x5a, 0x5a, 0x88, 0x1c, 0x28, 0xf2, 0x10, 0x80, 0x60, 0x4c, 0x44, 0xaa, 0x1c, 0xc9, 0x90, 0x60,
-    0x40, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x07, 0x00, 0x00, 0x00, 0x2c, 0x13, 0x00, 0x28, 0x00, 0x15,
-    0x00, 0x03, 0x00, 0x00, 0x08, 0x34, 0x00, 0xb9, 0xb1, 0x03, 0x40, 0xb0, 0xa0, 0x41, 0x76, 0xdb,
-    0x9e, 0x99, 0x52, 0xa4, 0xc5, 0xd3, 0x33, 0x6e, 0x4d, 0x60, 0x68, 0x8a, 0xa4, 0x0f, 0x1d, 0x00,
-    0x75, 0xec, 0xec, 0x45, 0xf2, 0x54, 0xa3, 0x85, 0xc7, 0x8f, 0x3d, 0x84, 0x01, 0x38, 0xf4, 0xb1,
-    0x06, 0x0d, 0x1a, 0x2c, 0x3c, 0x1a, 0x5c, 0x09, 0x20, 0x20, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03,
-    0x00, 0x01, 0x00, 0x2c, 0x13, 0x00, 0x27, 0x00, 0x15, 0x00, 0x04, 0x00, 0x00, 0x08, 0x38, 0x00,
-    0xcf, 0x99, 0x0b, 0x40, 0xb0, 0xa0, 0xc1, 0x00, 0xe8, 0xec, 0x7d, 0xb9, 0xa2, 0x89, 0xd2, 0xb3,
-    0x73, 0x43, 0x54, 0x98, 0xfa, 0x62, 0x0f, 0x9d, 0x41, 0x73, 0xf8, 0x28, 0xd1, 0x68, 0xc1, 0xb1,
-    0xe3, 0x92, 0x00, 0x3d, 0x3a, 0xc2, 0x30, 0xe5, 0xc9, 0x14, 0x2f, 0x15, 0x1c, 0x0f, 0xaa, 0x24,
-    0xd8, 0xb1, 0xc5, 0xca, 0x83, 0x01, 0x01, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x04, 0x00, 0x00, 0x00,
-    0x2c, 0x13, 0x00, 0x26, 0x00, 0x15, 0x00, 0x04, 0x00, 0x00, 0x08, 0x36, 0x00, 0xcf, 0xd9, 0x43,
-    0x07, 0xa0, 0xa0, 0xc1, 0x83, 0x00, 0xd4, 0xd1, 0xdb, 0xf6, 0xa5, 0xe1, 0x97, 0x61, 0x2d, 0x78,
-    0x3d, 0xc3, 0xc7, 0x0e, 0x21, 0x3a, 0x7b, 0x5f, 0xb4, 0xb4, 0xd8, 0xb8, 0xd1, 0x10, 0x00, 0x8e,
-    0x2d, 0x6a, 0x98, 0xba, 0x42, 0xd2, 0x93, 0x8c, 0x8d, 0x08, 0x53, 0x7e, 0x04, 0xd9, 0x42, 0xa5,
-    0xc1, 0x80, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x00, 0x00, 0x2c, 0x13, 0x00, 0x25, 0x00,
-    0x15, 0x00, 0x04, 0x00, 0x00, 0x08, 0x35, 0x00, 0xf1, 0xd9, 0x43, 0x07, 0xa0, 0xa0, 0xc1, 0x83,
-    0x06, 0xd9, 0xd9, 0xfb, 0xf2, 0x65, 0x1b, 0xb0, 0x16, 0x30, 0x34, 0x7d, 0xa1, 0x87, 0x10, 0x80,
-    0x3a, 0x7d, 0x5f, 0x4a, 0xb1, 0x68, 0xc1, 0x31, 0x51, 0x41, 0x8e, 0x1c, 0xb5, 0x5c, 0x61, 0xf8,
-    0xe5, 0x0a, 0x2f, 0x8e, 0x15, 0x11, 0x82, 0x5c, 0x99, 0xb2, 0x60, 0x40, 0x00, 0x21, 0xf9, 0x04,
-    0x05, 0x07, 0x00, 0x00, 0x00, 0x2c, 0x13, 0x00, 0x24, 0x00, 0x15, 0x00, 0x04, 0x00, 0x00, 0x08,
-    0x38, 0x00, 0xf1, 0xd9, 0x63, 0x07, 0xa0, 0xa0, 0xc1, 0x83, 0x07, 0xd1, 0xe9, 0xb3, 0x87, 0x0f,
-    0x4a, 0x0b, 0x16, 0xa6, 0xbe, 0xd8, 0x43, 0x87, 0xb0, 0xa0, 0xb9, 0x6d, 0x94, 0x64, 0xb4, 0x68,
-    0x01, 0xa3, 0xe0, 0xc6, 0x8d, 0x34, 0x28, 0x45, 0xda, 0x86, 0x6f, 0xdb, 0x17, 0x53, 0x2c, 0x36,
-    0x56, 0x3c, 0xf8, 0xb1, 0xe5, 0x4a, 0x00, 0x01, 0x01, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00,
-    0x00, 0x00, 0x2c, 0x13, 0x00, 0x23, 0x00, 0x15, 0x00, 0x04, 0x00, 0x00, 0x08, 0x35, 0x00, 0xcf,
-    0xe9, 0x63, 0x07, 0xa0, 0xa0, 0xc1, 0x83, 0x08, 0xd5, 0xb1, 0xc3, 0x07, 0xac, 0x45, 0x0b, 0x5e,
-    0x57, 0xf0, 0x11, 0x44, 0x58, 0x90, 0x9d, 0xbd, 0x67, 0x5a, 0x54, 0x40, 0x29, 0xe8, 0xd0, 0x61,
-    0x0d, 0x4f, 0x5f, 0xf0, 0xd9, 0x1b, 0x19, 0x89, 0x12, 0x0c, 0x87, 0x14, 0x0d, 0x76, 0x5c, 0x89,
-    0x12, 0x61, 0x40, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x00, 0x00, 0x2c, 0x13, 0x00, 0x22,
-    0x00, 0x15, 0x00, 0x04, 0x00, 0x00, 0x08, 0x34, 0x00, 0x01, 0xb0, 0x43, 0x07, 0xa0, 0xa0, 0xc1,
-    0x83, 0x08, 0x0d, 0x0e, 0x53, 0xa1, 0xc2, 0x89, 0xa6, 0x2f, 0xfa, 0xd4, 0x25, 0x2c, 0x88, 0xce,
-    0xde, 0x17, 0x4f, 0xbf, 0x0c, 0xb6, 0xd8, 0xd8, 0x82, 0xd7, 0x33, 0x7c, 0xfa, 0xd8, 0xb1, 0xd3,
-    0x87, 0xef, 0x59, 0x0e, 0x8e, 0x13, 0x39, 0xaa, 0x44, 0x79, 0x30, 0x20, 0x00, 0x21, 0xf9, 0x04,
-    0x05, 0x04, 0x00, 0x00, 0x00, 0x2c, 0x13, 0x00, 0x22, 0x00, 0x15, 0x00, 0x03, 0x00, 0x00, 0x08,
-    0x34, 0x00, 0x8f, 0x69, 0x41, 0xb2, 0x2c, 0xd5, 0x17, 0x7b, 0xe8, 0x00, 0x28, 0x5c, 0xc8, 0x90,
-    0xde, 0x36, 0x47, 0x00, 0x5a, 0xb4, 0x00, 0xe0, 0x42, 0xa2, 0x0c, 0x4a, 0xdb, 0xf4, 0x25, 0x54,
-    0xc7, 0xce, 0xde, 0x97, 0x2d, 0x2a, 0x5a, 0x44, 0x61, 0xb8, 0x50, 0xa2, 0x44, 0x18, 0x34, 0x64,
-    0xb0, 0x90, 0xc8, 0x30, 0x20, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x06, 0x00, 0x00, 0x00, 0x2c, 0x13,
-    0x00, 0x21, 0x00, 0x15, 0x00, 0x04, 0x00, 0x00, 0x08, 0x39, 0x00, 0x83, 0x55, 0xd3, 0xb4, 0x49,
-    0x53, 0x35, 0x7c, 0xec, 0x00, 0x28, 0x5c, 0xc8, 0x10, 0x00, 0x3b, 0x1d, 0xce, 0x5a, 0xb4, 0x20,
-    0xf4, 0x44, 0x22, 0x0b, 0x53, 0x5f, 0xec, 0xa1, 0x5b, 0xa8, 0x8e, 0xde, 0x17, 0x4d, 0x35, 0x04,
-    0x35, 0x54, 0x28, 0x51, 0x22, 0x0c, 0x59, 0xa6, 0x4c, 0xc9, 0x28, 0x39, 0xb2, 0x65, 0xc9, 0x16,
-    0x23, 0x03, 0x02, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x04, 0x00, 0x00, 0x00, 0x2c, 0x13, 0x00, 0x20,
-    0x00, 0x15, 0x00, 0x04, 0x00, 0x00, 0x08, 0x38, 0x00, 0x01, 0x70, 0x8b, 0xf4, 0xe5, 0x92, 0xb3,
-    0x6d, 0xfa, 0xd4, 0x01, 0x58, 0xc8, 0xb0, 0xe1, 0xc2, 0x26, 0x35, 0x5a, 0x30, 0x59, 0xd1, 0xa2,
-    0xa2, 0x96, 0x67, 0xf6, 0xd8, 0x39, 0x64, 0x87, 0xef, 0x4a, 0x2f, 0x87, 0x0b, 0x2b, 0x56, 0x84,
-    0x61, 0x0a, 0xd9, 0x15, 0x4a, 0xa6, 0x22, 0xb6, 0x00, 0x09, 0x52, 0x64, 0x45, 0x87, 0x01, 0x01,
-    0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x01, 0x00, 0x2c, 0x14, 0x00, 0x1f, 0x00, 0x14, 0x00,
-    0x04, 0x00, 0x00, 0x08, 0x38, 0x00, 0x03, 0xe0, 0xc3, 0xf7, 0x25, 0xc0, 0x32, 0x7c, 0xe8, 0x02,
-    0x28, 0x5c, 0xc8, 0x50, 0xa1, 0x31, 0x15, 0x2d, 0x88, 0x48, 0x71, 0xd1, 0x42, 0xc6, 0x95, 0x6d,
-    0xe6, 0x1a, 0x06, 0x40, 0x77, 0x4e, 0xa3, 0xc2, 0x16, 0x20, 0x7b, 0x98, 0x7a, 0xf6, 0xa5, 0x24,
-    0xa5, 0x1c, 0x2a, 0x96, 0x79, 0x5c, 0x08, 0xb2, 0x25, 0xc8, 0x85, 0x01, 0x01, 0x00, 0x21, 0xf9,
-    0x04, 0x05, 0x03, 0x00, 0x01, 0x00, 0x2c, 0x14, 0x00, 0x1e, 0x00, 0x13, 0x00, 0x04, 0x00, 0x00,
-    0x08, 0x33, 0x00, 0x03, 0x08, 0xd4, 0x67, 0x2f, 0x00, 0x80, 0x11, 0x02, 0x13, 0x2a, 0x14, 0xb8,
-    0xe8, 0x14, 0x0c, 0x2e, 0x84, 0x08, 0x11, 0x81, 0xe1, 0x29, 0x92, 0x3e, 0x75, 0x0b, 0x13, 0xb6,
-    0x58, 0xd8, 0xa2, 0x63, 0x0b, 0x2d, 0xcf, 0xb6, 0xe1, 0xc3, 0xb7, 0xed, 0x8b, 0xa4, 0x8c, 0x0a,
-    0x3d, 0xaa, 0xdc, 0x18, 0x10, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x07, 0x00, 0x00, 0x00, 0x2c, 0x15,
-    0x00, 0x1d, 0x00, 0x12, 0x00, 0x04, 0x00, 0x00, 0x08, 0x30, 0x00, 0x01, 0x08, 0x44, 0x67, 0x4e,
-    0xa0, 0xc1, 0x83, 0x07, 0x85, 0x5d, 0xd1, 0x02, 0x65, 0xc8, 0x14, 0x2b, 0x4a, 0xa0, 0xd9, 0x43,
-    0x87, 0x50, 0x20, 0x91, 0x16, 0x07, 0x5b, 0x68, 0x6c, 0x31, 0xe3, 0xca, 0x36, 0x7b, 0xf4, 0xe8,
-    0xd9, 0x63, 0x56, 0x31, 0xe3, 0xc6, 0x8d, 0xc3, 0x02, 0x02, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03,
-    0x00, 0x00, 0x00, 0x2c, 0x15, 0x00, 0x1d, 0x00, 0x12, 0x00, 0x03, 0x00, 0x00, 0x08, 0x2b, 0x00,
-    0x01, 0x60, 0x01, 0x43, 0x69, 0xcb, 0x2b, 0x56, 0x29, 0xb8, 0xd9, 0x43, 0x07, 0xa0, 0xa1, 0xc3,
-    0x86, 0x5c, 0x5a, 0xac, 0x78, 0xe8, 0xa4, 0x85, 0x0c, 0x4a, 0xdb, 0xe8, 0x31, 0x7c, 0xc8, 0xd1,
-    0x61, 0x8b, 0x8f, 0x2d, 0x60, 0xd0, 0xc8, 0x21, 0x2c, 0x20, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x04,
-    0x00, 0x02, 0x00, 0x2c, 0x16, 0x00, 0x1c, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x08, 0x2f, 0x00,
-    0x05, 0x98, 0x08, 0xf2, 0xe5, 0x0a, 0xb2, 0x2b, 0x5f, 0xec, 0xb1, 0x13, 0xc0, 0xb0, 0xa1, 0x30,
-    0x22, 0x2d, 0x5a, 0x10, 0x59, 0x62, 0x45, 0x50, 0x0b, 0x18, 0x94, 0xb6, 0xd1, 0x6b, 0xc8, 0xb1,
-    0x63, 0xc4, 0x88, 0x33, 0x3c, 0x35, 0xeb, 0x48, 0x92, 0x61, 0xc4, 0x15, 0x01, 0x01, 0x00, 0x21,
-    0xf9, 0x04, 0x05, 0x03, 0x00, 0x00, 0x00, 0x2c, 0x17, 0x00, 0x1b, 0x00, 0x0f, 0x00, 0x04, 0x00,
-    0x00, 0x08, 0x29, 0x00, 0x01, 0x00, 0xf8, 0xe3, 0x63, 0xc7, 0x97, 0x6d, 0xf6, 0xde, 0x09, 0x5c,
-    0x08, 0x60, 0xca, 0xa1, 0x1a, 0x2d, 0x22, 0x46, 0x84, 0xa1, 0xe9, 0xcb, 0x39, 0x86, 0x18, 0x05,
-    0x4a, 0x54, 0xa1, 0xab, 0x59, 0xc6, 0x8f, 0x2d, 0x7a, 0x00, 0x08, 0x08, 0x00, 0x21, 0xf9, 0x04,
-    0x05, 0x07, 0x00, 0x03, 0x00, 0x2c, 0x0e, 0x00, 0x1a, 0x00, 0x20, 0x00, 0x29, 0x00, 0x00, 0x08,
-    0xff, 0x00, 0x07, 0x08, 0x1c, 0x48, 0x70, 0x20, 0xa1, 0x22, 0x52, 0x8a, 0x10, 0x02, 0x50, 0xb0,
-    0xa1, 0xc3, 0x82, 0x4d, 0x04, 0x41, 0x69, 0x41, 0x91, 0xe2, 0x8a, 0x43, 0xc2, 0x1e, 0x6a, 0x1c,
-    0xe8, 0x8c, 0x4b, 0x0b, 0x81, 0x5c, 0xb8, 0x0c, 0xa8, 0xd8, 0xc3, 0x18, 0xc3, 0x8d, 0x0d, 0x0f,
-    0x7d, 0xe4, 0xb2, 0x44, 0xd8, 0xa0, 0x21, 0x04, 0x29, 0x46, 0x99, 0x82, 0x92, 0xa0, 0xb1, 0x8f,
-    0x86, 0xaa, 0x58, 0x79, 0xb2, 0xe2, 0x63, 0xc1, 0x16, 0x86, 0x6a, 0x0a, 0x6c, 0xa6, 0x62, 0xc0,
-    0xcc, 0x42, 0x3e, 0x1f, 0xb6, 0x58, 0x52, 0x13, 0x00, 0x30, 0x81, 0x4c, 0xa2, 0x24, 0xd5, 0xb8,
-    0x22, 0x18, 0x4a, 0x67, 0x1f, 0x0b, 0x89, 0x14, 0xda, 0x02, 0xe6, 0xc6, 0x61, 0x03, 0x5c, 0x08,
-    0x23, 0x22, 0x54, 0x60, 0x14, 0x94, 0x50, 0x04, 0xba, 0x98, 0x8a, 0xb2, 0xc6, 0x49, 0x87, 0xc1,
-    0x8a, 0x96, 0x25, 0xa8, 0xa2, 0x89, 0xc6, 0xb8, 0x73, 0xe9, 0xda, 0x7d, 0xb8, 0xc8, 0x45, 0xde,
-    0x81, 0x3d, 0x16, 0x6d, 0x7c, 0xfa, 0x77, 0x00, 0x61, 0x8d, 0xc6, 0x0a, 0x0f, 0x38, 0x84, 0x72,
-    0x99, 0xdc, 0xb9, 0x2a, 0x96, 0xd5, 0x04, 0x9b, 0x97, 0x32, 0xca, 0xbd, 0x8a, 0x33, 0x6b, 0xde,
-    0x5c, 0x36, 0xf1, 0x46, 0xc6, 0x85, 0x83, 0xad, 0xa0, 0xaa, 0x19, 0x34, 0xe7, 0x86, 0xcd, 0x34,
-    0x16, 0xd1, 0xdc, 0xc4, 0x6f, 0x43, 0x17, 0x98, 0x15, 0x33, 0xea, 0x51, 0xd0, 0xf5, 0xe9, 0xdb,
-    0xb8, 0x51, 0x62, 0x79, 0xb8, 0x5b, 0x33, 0x8a, 0x87, 0x40, 0x36, 0xeb, 0x78, 0xe8, 0x87, 0xf3,
-    0x9d, 0x86, 0x74, 0xde, 0x66, 0x4e, 0x72, 0x86, 0xa0, 0x99, 0x20, 0xb7, 0x7d, 0xd4, 0x29, 0x53,
-    0x66, 0x0e, 0x9f, 0xdc, 0x03, 0xb0, 0xf4, 0xc6, 0xce, 0xbd, 0x3b, 0x67, 0x00, 0x59, 0x08, 0x16,
-    0x23, 0xaf, 0xd9, 0x47, 0xe0, 0x78, 0x81, 0x59, 0x18, 0x96, 0xc0, 0x35, 0xe0, 0x04, 0x90, 0xdf,
-    0x03, 0x92, 0x0c, 0xf0, 0xb2, 0x91, 0xbe, 0xfc, 0x01, 0x28, 0x80, 0x9c, 0x18, 0x80, 0xab, 0x84,
-    0xf7, 0x01, 0x01, 0x01, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x03, 0x00, 0x2c, 0x0e, 0x00,
-    0x19, 0x00, 0x20, 0x00, 0x2a, 0x00, 0x00, 0x08, 0xff, 0x00, 0x07, 0x08, 0x1c, 0x48, 0x50, 0x20,
-    0x00, 0x42, 0x45, 0xa4, 0x14, 0x21, 0x04, 0xa0, 0xa0, 0xc3, 0x87, 0x05, 0x85, 0x1d, 0x82, 0xd2,
-    0xa2, 0x62, 0xc5, 0x1a, 0x87, 0x08, 0x41, 0xdc, 0x38, 0x90, 0x51, 0x8d, 0x8a, 0x03, 0x5c, 0xb8,
-    0x10, 0x58, 0x51, 0xc5, 0xa1, 0x45, 0x1c, 0x1d, 0x02, 0x18, 0x56, 0x91, 0x8b, 0x20, 0x42, 0x53,
-    0x86, 0x10, 0xac, 0x88, 0xa8, 0x49, 0x4a, 0x82, 0x2c, 0x07, 0x18, 0x6a, 0x42, 0x45, 0x09, 0x91,
-    0x15, 0x0e, 0x5b, 0x10, 0x99, 0x72, 0x73, 0x00, 0xa3, 0x16, 0x03, 0x9e, 0x4c, 0x51, 0xe2, 0x02,
-    0xe4, 0xc3, 0x16, 0x87, 0x6e, 0x0a, 0xfb, 0x38, 0xa0, 0xd0, 0x13, 0xa4, 0x29, 0x55, 0x34, 0x4b,
-    0x79, 0xa8, 0x85, 0x0a, 0x22, 0x4e, 0x53, 0xb6, 0x18, 0xc6, 0x71, 0x51, 0x8d, 0x01, 0x51, 0xaa,
-    0x8c, 0x2c, 0x3a, 0xa0, 0x46, 0xb0, 0x8d, 0xcd, 0x54, 0x0c, 0x58, 0xe1, 0x04, 0x6b, 0xd1, 0x16,
-    0x5b, 0x21, 0x3a, 0xc3, 0x6a, 0xf7, 0xae, 0xb3, 0x8d, 0x47, 0xd9, 0x16, 0x6c, 0xb1, 0x64, 0xe3,
-    0x90, 0xbe, 0x82, 0x5b, 0xfc, 0x85, 0xd8, 0x0c, 0x31, 0x5b, 0xbc, 0x1b, 0x9b, 0xc8, 0x15, 0x3c,
-    0x50, 0x85, 0xcd, 0x8d, 0x88, 0x28, 0x0f, 0xf4, 0x95, 0x72, 0xaf, 0xe6, 0x01, 0x79, 0x39, 0x46,
-    0xd1, 0x6c, 0xa8, 0xa8, 0x30, 0x2e, 0x82, 0x99, 0x50, 0x46, 0x7d, 0x93, 0x35, 0xe5, 0xc9, 0x9f,
-    0x53, 0x92, 0x8d, 0x9d, 0x52, 0x18, 0x6c, 0x87, 0x2e, 0x84, 0xd1, 0xfe, 0xb5, 0x91, 0x37, 0xed,
-    0xc2, 0x10, 0x65, 0xd2, 0x26, 0x74, 0xbb, 0xf2, 0x32, 0xda, 0x02, 0x8d, 0x15, 0xef, 0x61, 0x0c,
-    0xf9, 0xc0, 0x26, 0x84, 0xa2, 0x47, 0xbf, 0xec, 0xbc, 0xfa, 0xc6, 0x3e, 0x10, 0xfd, 0x38, 0x3f,
-    0x02, 0xd1, 0x86, 0x73, 0x14, 0x10, 0xbd, 0x38, 0x58, 0xff, 0xf3, 0xc6, 0x61, 0x1b, 0x2c, 0xd5,
-    0xbf, 0x94, 0x21, 0x58, 0x26, 0x92, 0xf5, 0x01, 0x5f, 0xce, 0x08, 0x3c, 0x13, 0xa9, 0xe1, 0x7b,
-    0x1d, 0x41, 0x82, 0xfc, 0x78, 0xcf, 0xbf, 0xbf, 0xff, 0x82, 0x26, 0xfc, 0x81, 0x85, 0x0e, 0x3f,
-    0x68, 0x37, 0x00, 0x76, 0x03, 0x08, 0xa1, 0xe0, 0x82, 0x0a, 0x0a, 0x84, 0xa0, 0x1f, 0x3f, 0xe8,
-    0x80, 0xc5, 0x1f, 0x26, 0x0c, 0x80, 0x45, 0x1f, 0x42, 0x0c, 0xe4, 0x43, 0x12, 0x03, 0x78, 0xc1,
-    0x07, 0x1f, 0x10, 0x7d, 0x28, 0x5e, 0x12, 0x3e, 0x0c, 0x24, 0x44, 0x1f, 0x3a, 0xfc, 0x37, 0x50,
-    0x40, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x03, 0x00, 0x2c, 0x0d, 0x00, 0x18, 0x00, 0x22,
-    0x00, 0x2b, 0x00, 0x00, 0x08, 0xff, 0x00, 0x07, 0x08, 0x1c, 0x48, 0x70, 0xa0, 0x30, 0x67, 0x82,
-    0x94, 0x08, 0x72, 0xb6, 0xac, 0xa0, 0xc3, 0x87, 0x0f, 0x9d, 0x21, 0x52, 0xd1, 0xa2, 0xa2, 0x45,
-    0x60, 0xce, 0x00, 0x40, 0xdc, 0x68, 0x30, 0x8a, 0x45, 0x17, 0x5c, 0xb8, 0x08, 0xb4, 0x48, 0xa4,
-    0x21, 0xc7, 0x87, 0x84, 0xb8, 0x54, 0x64, 0x32, 0xa4, 0x49, 0x80, 0x21, 0x04, 0x2b, 0xae, 0x68,
-    0x76, 0xb2, 0xa0, 0x30, 0x95, 0x2a, 0x04, 0x4d, 0xb1, 0x52, 0x88, 0x89, 0x0b, 0x87, 0x2d, 0x5c,
-    0xd0, 0xac, 0x39, 0x60, 0x11, 0x91, 0x16, 0x03, 0x96, 0x4c, 0x79, 0x62, 0x11, 0x29, 0x50, 0x2e,
-    0xc1, 0x88, 0x1a, 0x73, 0x3a, 0xc4, 0x49, 0xc5, 0x93, 0x2d, 0x0e, 0xd5, 0x0c, 0x56, 0x23, 0xe8,
-    0x8a, 0xab, 0x35, 0x5b, 0xd4, 0x68, 0x72, 0xd2, 0x19, 0xd2, 0x25, 0x45, 0x88, 0x0e, 0x6c, 0xe1,
-    0xec, 0xe4, 0x30, 0xa4, 0x86, 0x3c, 0xaa, 0x1d, 0xd0, 0x62, 0xd8, 0x49, 0x28, 0x48, 0xc1, 0xce,
-    0x05, 0xc6, 0x11, 0x40, 0x8d, 0xb9, 0x0e, 0xa1, 0xf4, 0xfd, 0x0b, 0x98, 0xa0, 0x60, 0x8e, 0x89,
-    0x0a, 0x13, 0x44, 0xe4, 0x56, 0xf1, 0x40, 0xad, 0x1c, 0xcd, 0x3a, 0x6e, 0x91, 0x96, 0x63, 0xb0,
-    0xc3, 0x85, 0xb9, 0x68, 0x3c, 0xb9, 0x44, 0x31, 0x5b, 0xa2, 0x00, 0x18, 0x03, 0x8e, 0xe2, 0xb8,
-    0x74, 0xcd, 0x15, 0x6a, 0x85, 0x29, 0x96, 0x6c, 0xfa, 0x24, 0x69, 0x8e, 0x76, 0x4b, 0x37, 0x73,
-    0xfa, 0x50, 0x05, 0x21, 0xd3, 0x00, 0x30, 0x3b, 0xe4, 0xdb, 0x1a, 0xf2, 0x43, 0xdf, 0xa5, 0x59,
-    0x17, 0xa4, 0xdc, 0x5a, 0xe0, 0xa1, 0x1e, 0x0e, 0x81, 0x17, 0x17, 0xc6, 0x9c, 0x79, 0xd4, 0xe2,
-    0xd0, 0x6b, 0x02, 0x01, 0x43, 0xbd, 0x3a, 0x75, 0x20, 0xd0, 0xbb, 0x40, 0x8c, 0x04, 0xfd, 0x05,
-    0x44, 0x30, 0xd0, 0x51, 0xb0, 0x65, 0x71, 0xc8, 0xc6, 0x4b, 0xf4, 0x3b, 0x0e, 0xe9, 0x6c, 0x2e,
-    0xae, 0xa3, 0x4e, 0x19, 0x81, 0x65, 0xe6, 0xf8, 0x89, 0x2e, 0xb0, 0x84, 0x8d, 0x31, 0x63, 0x8e,
-    0x98, 0xa0, 0xcf, 0xbf, 0xbf, 0xff, 0x87, 0x25, 0x64, 0x81, 0x85, 0x0e, 0x3f, 0xcc, 0xd7, 0x47,
-    0x1f, 0x03, 0x08, 0x21, 0xc4, 0x00, 0x27, 0x34, 0xe8, 0x60, 0x82, 0x0b, 0x1e, 0x38, 0x80, 0x1f,
-    0x3f, 0xe8, 0x80, 0x45, 0x16, 0x25, 0x0c, 0x90, 0x85, 0x1f, 0x42, 0x9c, 0x00, 0x04, 0x0a, 0x3e,
-    0x24, 0xe1, 0x05, 0x1f, 0x7c, 0xd4, 0x44, 0xa2, 0x17, 0x49, 0xf8, 0x80, 0x02, 0x10, 0x27, 0x08,
-    0xe1, 0x47, 0x16, 0xa0, 0x01, 0x20, 0xe3, 0x8c, 0x6a, 0x05, 0x04, 0x00, 0x21, 0xf9, 0x04, 0x05,
-    0x04, 0x00, 0x03, 0x00, 0x2c, 0x0c, 0x00, 0x17, 0x00, 0x24, 0x00, 0x2c, 0x00, 0x00, 0x08, 0xff,
-    0x00, 0x07, 0x08, 0x1c, 0x48, 0x90, 0xe0, 0x32, 0x67, 0x82, 0x12, 0x3a, 0x5b, 0x56, 0xb0, 0xa1,
-    0xc3, 0x87, 0x00, 0x9c, 0x21, 0x6a, 0x41, 0xb1, 0xa2, 0x0a, 0x60, 0x43, 0x16, 0x3d, 0xdc, 0x58,
-    0x70, 0xd9, 0x44, 0x8a, 0x03, 0x5c, 0xb8, 0x18, 0x48, 0x91, 0x49, 0x33, 0x8e, 0x1c, 0x9b, 0xad,
-    0x68, 0x31, 0x80, 0xc9, 0x12, 0x2a, 0x53, 0x86, 0x14, 0x6c, 0xd1, 0xc3, 0x19, 0x4a, 0x87, 0xcd,
-    0x5c, 0xb4, 0x70, 0xa1, 0x64, 0x0a, 0x15, 0x41, 0x51, 0xb8, 0x34, 0x6c, 0xa1, 0xc2, 0xe6, 0xcd,
-    0x81, 0xc2, 0x56, 0xba, 0x90, 0x32, 0xa5, 0x90, 0x4e, 0x90, 0x43, 0x6b, 0x30, 0x3c, 0x3a, 0x20,
-    0x0a, 0x4b, 0x2e, 0x54, 0x9c, 0xb0, 0x44, 0xd9, 0x02, 0x11, 0xd5, 0x66, 0x5b, 0x07, 0x40, 0xbd,
-    0xd9, 0xe2, 0xe4, 0xcd, 0x61, 0x2c, 0xa5, 0x14, 0xa2, 0x2a, 0xb0, 0xc5, 0xb0, 0x9b, 0xc1, 0x6a,
-    0x08, 0x2c, 0xe2, 0x84, 0xad, 0xc0, 0x1a, 0x00, 0x50, 0x82, 0x6d, 0x1b, 0x96, 0xaa, 0x0b, 0x61,
-    0x28, 0x9d, 0xf5, 0xb5, 0x2b, 0xd6, 0xec, 0xc6, 0x63, 0x83, 0xed, 0xaa, 0x30, 0xec, 0x90, 0x02,
-    0xbe, 0xc4, 0x6c, 0x55, 0x10, 0x42, 0xb9, 0x4c, 0x05, 0x61, 0x82, 0x2e, 0x9a, 0xa0, 0x04, 0x00,
-    0xe5, 0xf2, 0x40, 0x60, 0x47, 0x0f, 0x79, 0x16, 0xb8, 0xe4, 0xe8, 0xb2, 0x1e, 0x9e, 0x6b, 0x68,
-    0x0e, 0xed, 0xd9, 0x18, 0xdb, 0x60, 0x44, 0x08, 0x23, 0xca, 0x6b, 0x97, 0x09, 0xdb, 0xd8, 0xa9,
-    0x47, 0xeb, 0x76, 0xd8, 0xc2, 0xa8, 0x67, 0x00, 0xa0, 0x39, 0x46, 0xd9, 0x3d, 0xc0, 0x37, 0x6f,
-    0xc6, 0x9e, 0x9b, 0xa0, 0x7e, 0x88, 0x97, 0xf8, 0x00, 0xaf, 0x0f, 0x7f, 0x39, 0x1f, 0xe0, 0xfa,
-    0xa1, 0x71, 0xdd, 0x8b, 0xde, 0x4e, 0xe7, 0x18, 0xac, 0x89, 0x77, 0xef, 0x1a, 0xb7, 0x8b, 0x78,
-    0xe7, 0x98, 0x64, 0x87, 0xf9, 0xf3, 0xe6, 0x93, 0x6c, 0xdf, 0xd3, 0xa6, 0xbd, 0xfb, 0xf6, 0x61,
-    0xb6, 0x77, 0x79, 0xff, 0x5e, 0xcc, 0xf6, 0x17, 0xf4, 0xdd, 0x83, 0xd9, 0x8e, 0x65, 0x4d, 0xc3,
-    0x34, 0x3f, 0x88, 0xe7, 0x45, 0x1a, 0x04, 0xa1, 0x11, 0xc4, 0x78, 0x03, 0xf4, 0x31, 0xc6, 0x1c,
-    0x72, 0x88, 0x21, 0x04, 0x82, 0x10, 0x46, 0x28, 0xa1, 0x40, 0x00, 0x64, 0xf1, 0x87, 0x0e, 0x3f,
-    0xf8, 0x91, 0xe0, 0x00, 0x42, 0x3c, 0x78, 0xc2, 0x09, 0x0d, 0x7d, 0xc8, 0xe1, 0x83, 0x7d, 0x0c,
-    0x80, 0x4b, 0x80, 0x7f, 0x64, 0x41, 0xdb, 0x0f, 0x7d, 0x9c, 0x00, 0x04, 0x0a, 0x3e, 0x24, 0xe1,
-    0x05, 0x1f, 0x76, 0xf1, 0xe1, 0x45, 0x12, 0x3e, 0xa0, 0x00, 0xc4, 0x09, 0x7d, 0x04, 0x78, 0x13,
-    0x00, 0xb4, 0x15, 0x04, 0xe4, 0x51, 0x01, 0x01, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x06, 0x00, 0x07,
-    0x00, 0x2c, 0x0c, 0x00, 0x16, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x00, 0x08, 0xff, 0x00, 0x0f, 0x08,
-    0x1c, 0x48, 0xb0, 0xa0, 0x40, 0x00, 0x06, 0x13, 0x2a, 0x5c, 0x78, 0xa0, 0xd9, 0x21, 0x44, 0x30,
-    0x54, 0xc0, 0x40, 0x74, 0xa8, 0x19, 0xc3, 0x8b, 0x04, 0x9b, 0x21, 0x6a, 0x61, 0xb0, 0x45, 0x0b,
-    0x60, 0xce, 0x30, 0x2e, 0x04, 0x70, 0x48, 0x85, 0x40, 0x17, 0x4e, 0x94, 0x38, 0x29, 0xd8, 0x62,
-    0x58, 0x30, 0x91, 0x05, 0x17, 0xfd, 0xe2, 0xb8, 0x42, 0x50, 0x93, 0x00, 0xc2, 0x94, 0x74, 0x44,
-    0xd4, 0x04, 0xe6, 0xc0, 0x99, 0x07, 0x88, 0x50, 0xa9, 0x22, 0x88, 0x89, 0xc7, 0x84, 0x2d, 0x10,
-    0x21, 0x84, 0xc9, 0x88, 0x23, 0x93, 0x26, 0x56, 0xb8, 0x70, 0x64, 0xd8, 0xc2, 0x18, 0x4c, 0x61,
-    0x35, 0x06, 0x2e, 0x59, 0x01, 0xb3, 0x86, 0x30, 0x91, 0x87, 0x04, 0x32, 0x71, 0xe1, 0x53, 0x60,
-    0xd8, 0x8b, 0x8b, 0xa0, 0x1c, 0x70, 0x51, 0xe5, 0x49, 0xd9, 0x03, 0x50, 0x96, 0x2e, 0x6c, 0xc6,
-    0xd1, 0x85, 0x20, 0xae, 0x65, 0x55, 0x2c, 0xbb, 0x38, 0xe4, 0x2d, 0xcb, 0x90, 0x0c, 0xad, 0xfa,
-    0x25, 0x08, 0x58, 0x21, 0x00, 0xc1, 0x83, 0x0f, 0xb4, 0x28, 0x9c, 0x90, 0x44, 0xe2, 0x81, 0x8b,
-    0x2f, 0xd2, 0x7d, 0xac, 0xf7, 0x62, 0xb0, 0xac, 0x89, 0xe3, 0x62, 0x1c, 0xf6, 0xf8, 0xac, 0x64,
-    0x93, 0x83, 0xbf, 0x8a, 0xe4, 0xfc, 0xb8, 0xb4, 0x69, 0xd3, 0x2f, 0x4f, 0xab, 0x2e, 0xc8, 0x68,
-    0x35, 0x43, 0x26, 0x17, 0x11, 0x99, 0x5e, 0x72, 0x91, 0x71, 0x68, 0xd0, 0x0a, 0x53, 0x97, 0x4e,
-    0xb4, 0x50, 0xf6, 0x69, 0xcf, 0x06, 0x5b, 0xaf, 0x26, 0x4b, 0x30, 0xab, 0xdc, 0xd3, 0x8b, 0x82,
-    0x29, 0x57, 0xee, 0xba, 0x39, 0x43, 0x3e, 0x0a, 0xbd, 0xac, 0xb6, 0xa3, 0x10, 0xcf, 0x6a, 0x31,
-    0x0a, 0xf7, 0xac, 0x06, 0xa3, 0xf0, 0xcb, 0x6a, 0x3f, 0x68, 0x0c, 0x9a, 0x3c, 0x11, 0xe2, 0xfa,
-    0x88, 0x19, 0x82, 0x65, 0x76, 0x38, 0x47, 0xb1, 0x47, 0x8d, 0x1a, 0x3d, 0x49, 0x9c, 0x0f, 0x04,
-    0x70, 0x5c, 0xbe, 0x7d, 0xd7, 0x58, 0x14, 0x9e, 0x60, 0xb8, 0x9f, 0xa0, 0x9f, 0x03, 0x3a, 0xe4,
-    0x27, 0x50, 0x09, 0x7e, 0x90, 0x77, 0x80, 0x0f, 0xa7, 0x21, 0x78, 0x80, 0x10, 0x7e, 0x94, 0x50,
-    0x56, 0x09, 0x10, 0x42, 0x78, 0x10, 0x46, 0x01, 0x01, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x04, 0x00,
-    0x0d, 0x00, 0x2c, 0x0c, 0x00, 0x16, 0x00, 0x24, 0x00, 0x2d, 0x00, 0x00, 0x08, 0xff, 0x00, 0x1b,
-    0x08, 0x1c, 0x48, 0xb0, 0xa0, 0xc0, 0x00, 0x06, 0x13, 0x2a, 0x5c, 0xd8, 0x20, 0x40, 0x09, 0x42,
-    0x45, 0x8a, 0x34, 0x23, 0xb4, 0x08, 0x21, 0xc3, 0x8b, 0x03, 0x03, 0x2c, 0x3b, 0x54, 0xa3, 0x60,
-    0x8d, 0x61, 0xcd, 0x2c, 0x62, 0x4c, 0x18, 0x20, 0xd8, 0x21, 0x15, 0x0d, 0x5a, 0xa8, 0x6c, 0x41,
-    0x50, 0xc5, 0x2f, 0x61, 0x22, 0x47, 0x1e, 0x14, 0x46, 0x24, 0xa5, 0x8b, 0x27, 0x45, 0xa8, 0x08,
-    0x32, 0xc8, 0x25, 0xa4, 0xcc, 0x81, 0xc2, 0xb8, 0xa4, 0x34, 0x44, 0x65, 0x4a, 0x11, 0x25, 0x35,
-    0x0d, 0xae, 0x20, 0x14, 0x93, 0x61, 0x06, 0x1d, 0x35, 0x5b, 0x28, 0x19, 0x34, 0x44, 0x28, 0x43,
-    0x2e, 0x4d, 0x64, 0x0e, 0x00, 0x23, 0x70, 0xc5, 0x94, 0x42, 0x32, 0x87, 0x35, 0x55, 0x28, 0xcc,
-    0x45, 0xca, 0x16, 0x2b, 0x7e, 0xaa, 0x58, 0x86, 0x31, 0xc0, 0xa1, 0x94, 0x3b, 0x7f, 0x0a, 0x34,
-    0x36, 0xb6, 0x60, 0x00, 0x28, 0x29, 0xad, 0x3c, 0x91, 0xdb, 0x20, 0x51, 0x5d, 0x82, 0xc2, 0x50,
-    0xf2, 0x1d, 0xa8, 0x22, 0x2b, 0xc3, 0x66, 0x83, 0x09, 0xba, 0x60, 0xbb, 0x30, 0x43, 0xae, 0xc4,
-    0x03, 0x5d, 0x10, 0x5a, 0x08, 0xe0, 0x1d, 0xe4, 0xc8, 0xbd, 0x2e, 0x06, 0xbe, 0xcc, 0x22, 0xd8,
-    0xc5, 0x00, 0x89, 0x2e, 0x23, 0xfa, 0x4b, 0xd0, 0xd8, 0xe5, 0x25, 0x23, 0x85, 0xf5, 0x48, 0xbc,
-    0xc2, 0x30, 0xc6, 0xb7, 0x83, 0x51, 0xcb, 0x5c, 0x74, 0xb9, 0xf6, 0x45, 0xd7, 0xb6, 0x73, 0x17,
-    0x74, 0x86, 0x51, 0x30, 0xe4, 0x00, 0x88, 0x2e, 0x46, 0xb1, 0xcd, 0xfb, 0xb0, 0xed, 0x60, 0x1d,
-    0x15, 0x42, 0x01, 0x90, 0x3b, 0xb8, 0xc2, 0x5f, 0xba, 0x65, 0x27, 0x2c, 0x6e, 0x9b, 0xb9, 0x6f,
-    0x81, 0xab, 0x49, 0x0f, 0x0e, 0xd6, 0xa4, 0x7b, 0x77, 0xcf, 0xba, 0xc3, 0x63, 0x5c, 0x4c, 0xa2,
-    0xd0, 0x47, 0xf8, 0x30, 0x0a, 0xd1, 0xeb, 0x8e, 0xa4, 0x70, 0x4c, 0xf8, 0x23, 0x0a, 0x5f, 0x84,
-    0xff, 0xe3, 0xc6, 0xe0, 0x1a, 0x2c, 0xe2, 0x7d, 0x54, 0x22, 0x98, 0xc6, 0x8b, 0x78, 0x81, 0x3f,
-    0x44, 0x62, 0x87, 0x1d, 0x5d, 0xf8, 0xf1, 0x1f, 0x41, 0x01, 0x68, 0x77, 0xe0, 0x82, 0x97, 0x05,
-    0x60, 0xc2, 0x1f, 0xf8, 0xe1, 0x52, 0x90, 0x10, 0x0c, 0x51, 0x48, 0x90, 0x84, 0x58, 0xfc, 0x61,
-    0x02, 0x42, 0x01, 0xfc, 0xd0, 0x87, 0x40, 0x28, 0xe4, 0x16, 0x62, 0x03, 0x7d, 0xfc, 0xa0, 0x60,
-    0x43, 0x03, 0x01, 0xa0, 0xa2, 0x8a, 0x07, 0x61, 0x14, 0x10, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03,
-    0x00, 0x06, 0x00, 0x2c, 0x0c, 0x00, 0x17, 0x00, 0x24, 0x00, 0x2c, 0x00, 0x00, 0x08, 0xff, 0x00,
-    0x0d, 0x08, 0x1c, 0x48, 0x90, 0x60, 0x80, 0x83, 0x08, 0x03, 0x14, 0x5c, 0xc8, 0xb0, 0xa1, 0x81,
-    0x84, 0x10, 0x0f, 0x3a, 0x9c, 0x68, 0xf0, 0xa0, 0xb0, 0x25, 0x86, 0x12, 0x71, 0x49, 0x64, 0x68,
-    0xc9, 0x32, 0x84, 0x14, 0x1d, 0x1e, 0x6c, 0x32, 0xcc, 0x40, 0x8b, 0x93, 0x2d, 0x06, 0xaa, 0xf8,
-    0xf5, 0x51, 0x61, 0xc8, 0x82, 0x07, 0x9b, 0x71, 0x39, 0xb9, 0xe2, 0xc9, 0x92, 0x27, 0x05, 0x7b,
-    0x30, 0x92, 0xf8, 0xd2, 0xc0, 0x08, 0x0a, 0x01, 0x9c, 0xf5, 0x68, 0xe1, 0x42, 0x50, 0x95, 0x2a,
-    0x56, 0x0a, 0x2d, 0x54, 0x61, 0x8c, 0x67, 0x48, 0x10, 0x24, 0x9a, 0x0d, 0xe5, 0x42, 0x48, 0x58,
-    0x21, 0x17, 0x0e, 0x55, 0x38, 0x73, 0x19, 0x32, 0x40, 0x30, 0x26, 0x02, 0x8b, 0x58, 0xe1, 0x12,
-    0x72, 0x85, 0x30, 0xae, 0x13, 0x03, 0x18, 0x33, 0xd9, 0x82, 0xc9, 0x8a, 0x9e, 0x87, 0xd0, 0x3a,
-    0x5c, 0xf4, 0x96, 0xc9, 0x92, 0x9e, 0x02, 0x6b, 0x04, 0xeb, 0xda, 0x4c, 0x60, 0xa1, 0x22, 0x78,
-    0x05, 0x36, 0x93, 0xbb, 0x50, 0x6d, 0xe0, 0x82, 0x82, 0x08, 0x0f, 0x04, 0x60, 0x20, 0x43, 0xc9,
-    0xc3, 0x03, 0x87, 0x29, 0x16, 0xb8, 0x21, 0x1e, 0x84, 0x5f, 0x90, 0x23, 0x4f, 0x1e, 0x18, 0xe0,
-    0x50, 0x66, 0x81, 0x71, 0x43, 0xde, 0xfd, 0x3c, 0xe4, 0x25, 0xa1, 0xcf, 0x2a, 0x96, 0xbd, 0x0c,
-    0x00, 0x16, 0x32, 0xa2, 0xcd, 0x05, 0x9d, 0x65, 0x96, 0xdd, 0x33, 0x00, 0xa2, 0xc3, 0x51, 0x60,
-    0x33, 0x24, 0xdb, 0xb3, 0x35, 0xe4, 0xb7, 0x9f, 0xf1, 0xaa, 0x08, 0xd9, 0x37, 0xf8, 0x63, 0x87,
-    0xc7, 0x3f, 0xab, 0xce, 0x4a, 0x25, 0xb8, 0x40, 0xdb, 0x0e, 0x5f, 0x3b, 0x17, 0x28, 0xc8, 0x61,
-    0xf5, 0xe9, 0x06, 0x8a, 0x33, 0xd4, 0xee, 0xbc, 0xf3, 0x42, 0x17, 0x6b, 0xb1, 0x0f, 0x7f, 0x6c,
-    0x42, 0xa5, 0x7c, 0xf9, 0x26, 0xe2, 0xd3, 0xbf, 0x14, 0x02, 0xa6, 0xbd, 0xfb, 0xf6, 0x42, 0xd2,
-    0xef, 0x68, 0x38, 0x5f, 0x7c, 0x10, 0x36, 0xf8, 0xf3, 0xe3, 0xb7, 0x91, 0xde, 0x8f, 0x01, 0xfd,
-    0xf9, 0xc5, 0x27, 0x5e, 0x00, 0x62, 0x2c, 0x14, 0x86, 0x6e, 0x81, 0x99, 0x10, 0x06, 0x41, 0x7b,
-    0x64, 0xa1, 0xde, 0x73, 0x27, 0xec, 0xb0, 0x03, 0x10, 0x08, 0x3e, 0x68, 0xe1, 0x85, 0xe9, 0x01,
-    0x90, 0xc5, 0x1f, 0x58, 0xe8, 0xf0, 0x83, 0x1f, 0x7e, 0xf4, 0x21, 0xa2, 0x10, 0x24, 0x96, 0x68,
-    0xa2, 0x88, 0x7d, 0x80, 0xf8, 0x83, 0x0e, 0x58, 0xfc, 0x91, 0x05, 0x63, 0x02, 0x01, 0xf0, 0x43,
-    0x1f, 0x27, 0x00, 0x81, 0x82, 0x0f, 0x3e, 0x24, 0xe1, 0x45, 0x4f, 0x5e, 0x24, 0x81, 0x23, 0x0a,
-    0x40, 0x9c, 0xd0, 0xc7, 0x0f, 0x30, 0x76, 0x95, 0xd0, 0x43, 0x20, 0x85, 0x14, 0x10, 0x00, 0x21,
-    0xf9, 0x04, 0x05, 0x03, 0x00, 0x10, 0x00, 0x2c, 0x0d, 0x00, 0x17, 0x00, 0x22, 0x00, 0x2c, 0x00,
-    0x00, 0x08, 0xff, 0x00, 0x21, 0x08, 0x1c, 0x48, 0x90, 0x02, 0x08, 0x82, 0x08, 0x13, 0x2a, 0x5c,
-    0x28, 0x30, 0xc3, 0x00, 0x86, 0x10, 0x23, 0x12, 0x0c, 0x40, 0xb1, 0x62, 0x45, 0x89, 0x11, 0x2d,
-    0x02, 0x10, 0x46, 0x45, 0x18, 0x00, 0x8b, 0x18, 0x15, 0x56, 0x6c, 0x36, 0xac, 0x46, 0x8b, 0x16,
-    0x10, 0x6a, 0x44, 0x71, 0xb6, 0x88, 0x62, 0x48, 0x0a, 0x1b, 0x04, 0x52, 0xa4, 0x82, 0xe8, 0xa4,
-    0x4d, 0x82, 0x4c, 0x9a, 0xb9, 0xc4, 0x48, 0x02, 0x02, 0xc5, 0x22, 0x2b, 0x5a, 0xb8, 0x78, 0x52,
-    0x44, 0xd8, 0x10, 0x84, 0x2a, 0x8c, 0xed, 0x94, 0x48, 0xb1, 0x99, 0x8b, 0x16, 0x4c, 0x08, 0x35,
-    0x59, 0x12, 0x85, 0x8b, 0x42, 0x41, 0x4b, 0x21, 0x06, 0x10, 0xb6, 0x42, 0x60, 0x93, 0x21, 0x5d,
-    0x19, 0xaa, 0xd0, 0xc9, 0x34, 0xc0, 0xaf, 0x93, 0x44, 0x94, 0x60, 0x24, 0x92, 0x55, 0x24, 0x21,
-    0x15, 0x2d, 0x9c, 0x58, 0xc5, 0x38, 0x36, 0x40, 0x46, 0xb5, 0x10, 0x84, 0x45, 0x09, 0x09, 0xe1,
-    0x90, 0xdd, 0x84, 0x00, 0x32, 0xc8, 0x44, 0x24, 0x70, 0x6e, 0xc8, 0x44, 0x7f, 0x11, 0x22, 0x88,
-    0x27, 0xb3, 0x06, 0x5f, 0x82, 0x35, 0x4a, 0x44, 0x2c, 0xc1, 0xe2, 0xf1, 0x40, 0x16, 0x8b, 0x32,
-    0x3a, 0xb6, 0x9c, 0x12, 0x40, 0xc6, 0xbd, 0x9c, 0x11, 0x25, 0x66, 0xb8, 0x84, 0x33, 0x04, 0x41,
-    0x18, 0x85, 0xf5, 0xb0, 0xec, 0x42, 0x58, 0xc8, 0x43, 0x96, 0x87, 0xf1, 0x6d, 0xc2, 0x84, 0xaf,
-    0x61, 0xd3, 0x10, 0x57, 0x10, 0xe2, 0xdc, 0x6c, 0x35, 0x44, 0xdf, 0xa6, 0x8d, 0x45, 0x84, 0x8d,
-    0x3b, 0xd8, 0x6d, 0x84, 0x2b, 0x82, 0xe1, 0x16, 0x48, 0x5c, 0x61, 0x73, 0xdc, 0xcd, 0x18, 0x46,
-    0x5f, 0x0e, 0x21, 0xd8, 0x66, 0x84, 0x3d, 0x9a, 0x50, 0x17, 0xb8, 0x04, 0xb8, 0x40, 0x15, 0x8c,
-    0xb6, 0x0f, 0x83, 0x14, 0x66, 0xa5, 0x7c, 0x79, 0xd7, 0xe2, 0xd3, 0x43, 0xc4, 0xf2, 0xa5, 0xbd,
-    0xfb, 0xf6, 0x7f, 0xc4, 0x9f, 0x60, 0x43, 0xbf, 0x3e, 0xfd, 0x13, 0xe2, 0xe3, 0x2b, 0xfc, 0x21,
-    0x3e, 0x40, 0x9e, 0x84, 0x77, 0x8c, 0xb6, 0x1c, 0x10, 0x68, 0x10, 0x74, 0x86, 0x0f, 0xea, 0x05,
-    0x00, 0x04, 0x1e, 0x66, 0x98, 0x71, 0x87, 0x0f, 0x02, 0x6e, 0x17, 0xc0, 0x1f, 0x7f, 0x44, 0xa8,
-    0xde, 0x85, 0x18, 0x66, 0x28, 0x13, 0x00, 0x26, 0xfc, 0x81, 0x85, 0x0e, 0x3f, 0xe0, 0xe2, 0x87,
-    0x1f, 0x10, 0xf4, 0x61, 0xe2, 0x89, 0x28, 0x42, 0x30, 0x22, 0x2e, 0x3f, 0xe8, 0x80, 0xc5, 0x1f,
-    0x26, 0x7c, 0xe4, 0x13, 0x00, 0x3f, 0xf4, 0x21, 0xc4, 0x09, 0x40, 0xa0, 0xe0, 0x83, 0x0f, 0x49,
-    0x78, 0xe1, 0xc5, 0x42, 0x3e, 0x26, 0xb1, 0x23, 0x0a, 0x40, 0x00, 0x21, 0x44, 0x1f, 0x3f, 0xc8,
-    0xf8, 0x98, 0x85, 0x0c, 0x05, 0x04, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x07, 0x00, 0x0d, 0x00, 0x2c,
-    0x0d, 0x00, 0x17, 0x00, 0x21, 0x00, 0x2c, 0x00, 0x00, 0x08, 0xff, 0x00, 0x1b, 0x08, 0x1c, 0x48,
-    0x10, 0x04, 0x02, 0x82, 0x08, 0x13, 0x2a, 0x5c, 0xc8, 0xb0, 0xa1, 0xc3, 0x87, 0x10, 0x23, 0x0a,
-    0x0c, 0x40, 0x91, 0xa2, 0xc4, 0x81, 0x00, 0x14, 0x56, 0xdc, 0x58, 0x51, 0xe2, 0x83, 0x07, 0x04,
-    0x2b, 0x12, 0x5a, 0x72, 0xc8, 0xd0, 0x30, 0x41, 0xcd, 0x00, 0x58, 0x84, 0x98, 0x71, 0x20, 0xc5,
-    0x66, 0x88, 0x5a, 0xc8, 0x6c, 0x31, 0x90, 0x89, 0xb3, 0x95, 0x12, 0x29, 0x1a, 0x53, 0xd1, 0x62,
-    0xc5, 0x93, 0x21, 0x87, 0x10, 0x1a, 0x0a, 0x16, 0x20, 0x67, 0x80, 0x43, 0x32, 0x0b, 0x35, 0x19,
-    0x69, 0x28, 0x21, 0x22, 0xa2, 0x11, 0x03, 0x0c, 0x69, 0xd0, 0x62, 0x89, 0xb0, 0xa6, 0x0c, 0x87,
-    0x15, 0x7d, 0x18, 0x40, 0xd8, 0x8a, 0x16, 0x2a, 0xa4, 0x30, 0x79, 0xd8, 0x6c, 0x6b, 0xc3, 0xa3,
-    0x0d, 0x56, 0x10, 0x89, 0x18, 0xc5, 0x2c, 0xc1, 0x0c, 0x04, 0x01, 0xd4, 0x68, 0x20, 0x48, 0x4a,
-    0x44, 0x15, 0xc2, 0x12, 0x82, 0x88, 0x47, 0x90, 0x90, 0xc0, 0x15, 0x2b, 0x24, 0x16, 0x71, 0x9b,
-    0x30, 0x80, 0xb3, 0x8b, 0x03, 0x87, 0x10, 0x4e, 0x78, 0x18, 0x71, 0x83, 0x25, 0x8b, 0x11, 0x5a,
-    0x71, 0xdc, 0xa0, 0x71, 0x43, 0x61, 0x2a, 0x10, 0xab, 0xf0, 0xeb, 0x30, 0x00, 0x30, 0xc4, 0x5c,
-    0x5a, 0x3a, 0xb4, 0x1c, 0x71, 0x49, 0x44, 0x00, 0x6b, 0x23, 0x32, 0x59, 0x44, 0xd9, 0x61, 0x8d,
-    0x66, 0x8e, 0x5d, 0x3c, 0x2c, 0x42, 0xd9, 0x74, 0x43, 0x41, 0xad, 0x03, 0xa4, 0x56, 0xc8, 0x64,
-    0x4a, 0xeb, 0xca, 0x0c, 0x6d, 0xb7, 0x0e, 0x26, 0x3b, 0x21, 0xde, 0xdf, 0x0d, 0x02, 0x20, 0x52,
-    0x98, 0x28, 0xf2, 0x45, 0xd8, 0x8c, 0x91, 0x13, 0x2c, 0x42, 0x9d, 0x3a, 0x15, 0xe9, 0xd8, 0x3b,
-    0x47, 0xea, 0xc2, 0xbd, 0x7b, 0x72, 0xe9, 0x00, 0xde, 0xb4, 0x6a, 0x19, 0x4f, 0xde, 0x8d, 0xf3,
-    0x9c, 0x78, 0xc8, 0x93, 0xaf, 0x73, 0x5e, 0xe2, 0x8e, 0x34, 0xf0, 0xe3, 0x7f, 0xc9, 0x6e, 0x22,
-    0x0f, 0xc1, 0x3b, 0x59, 0xb2, 0x37, 0x00, 0x70, 0x24, 0x4c, 0x98, 0x17, 0x25, 0xe8, 0xe7, 0x52,
-    0x7b, 0x02, 0x16, 0x68, 0x20, 0x72, 0x01, 0x00, 0x60, 0xc2, 0x1f, 0x58, 0xe8, 0xf0, 0xc3, 0x0f,
-    0x0d, 0xf8, 0x21, 0x61, 0x42, 0x12, 0xfa, 0xd1, 0xc0, 0x83, 0x3a, 0x60, 0xf1, 0x87, 0x09, 0x2a,
-    0x4d, 0x54, 0x02, 0x2e, 0x7d, 0x08, 0x71, 0x02, 0x10, 0x28, 0x34, 0xe0, 0x83, 0x0f, 0x49, 0x24,
-    0xe1, 0xc5, 0x8a, 0x2c, 0xa6, 0x78, 0x62, 0x03, 0x28, 0x00, 0x71, 0x82, 0x10, 0x7d, 0xe0, 0x52,
-    0x02, 0x81, 0xc8, 0x05, 0x04, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x0a, 0x00, 0x2c, 0x0c,
-    0x00, 0x15, 0x00, 0x21, 0x00, 0x2d, 0x00, 0x00, 0x08, 0xff, 0x00, 0x15, 0x08, 0x1c, 0x48, 0xb0,
-    0xe0, 0xc0, 0x0c, 0x08, 0x0c, 0x2a, 0x5c, 0x38, 0x70, 0x00, 0x80, 0x82, 0x00, 0x06, 0x30, 0x9c,
-    0x58, 0x10, 0x03, 0xc5, 0x8b, 0x18, 0x33, 0x6a, 0xdc, 0xc8, 0xb1, 0xe3, 0xc2, 0x08, 0x12, 0x3d,
-    0x52, 0x8c, 0xf0, 0x6e, 0x61, 0x80, 0x00, 0xc1, 0x9a, 0x04, 0x3b, 0x19, 0x40, 0xe4, 0xc0, 0x00,
-    0xc2, 0x0e, 0x25, 0x52, 0x21, 0x10, 0xca, 0xa1, 0x66, 0x2d, 0x45, 0x4e, 0x39, 0xd4, 0xa3, 0x45,
-    0x0b, 0x17, 0x2e, 0x08, 0x46, 0x11, 0x96, 0x73, 0x63, 0x30, 0x27, 0x0a, 0x5c, 0x14, 0x52, 0x30,
-    0x65, 0x48, 0x41, 0x2e, 0x84, 0x8a, 0x62, 0x9c, 0x82, 0x48, 0x01, 0x17, 0x2b, 0x54, 0x0a, 0x71,
-    0x51, 0xc8, 0x45, 0x98, 0xc6, 0x00, 0x87, 0x14, 0xb4, 0xb0, 0x32, 0x24, 0x28, 0x43, 0x44, 0x52,
-    0x27, 0x0a, 0xeb, 0xd9, 0x82, 0x09, 0x4d, 0x8a, 0xce, 0x14, 0x66, 0x28, 0x08, 0x56, 0x01, 0x11,
-    0x8d, 0x51, 0xd2, 0x8e, 0x88, 0x37, 0xf0, 0x81, 0x82, 0x00, 0x89, 0xec, 0x2e, 0xc5, 0xd8, 0x23,
-    0xd8, 0xc5, 0x26, 0x1d, 0x55, 0x2c, 0xbb, 0xe8, 0xb5, 0x23, 0xa1, 0xc3, 0x89, 0x1f, 0x53, 0x04,
-    0x50, 0xa3, 0xa3, 0xe1, 0x8b, 0x4f, 0x38, 0xa2, 0xc5, 0xd8, 0x8c, 0x63, 0x5c, 0x8c, 0x01, 0xaa,
-    0x6a, 0x7c, 0x98, 0x91, 0x4a, 0x46, 0xb3, 0x2e, 0x17, 0xaa, 0xf8, 0xec, 0x39, 0x35, 0xc5, 0x28,
-    0x0c, 0x89, 0x90, 0xf6, 0xd8, 0x79, 0x21, 0x6b, 0x8f, 0x00, 0xa0, 0x28, 0x2c, 0xec, 0xda, 0x90,
-    0x42, 0xd1, 0xae, 0x2b, 0x13, 0xec, 0xe1, 0xba, 0xa0, 0x94, 0xe3, 0xc5, 0x93, 0x5f, 0xfc, 0x32,
-    0xa6, 0xb9, 0x73, 0x30, 0xc5, 0x03, 0xd8, 0x71, 0xf3, 0x86, 0x3a, 0x75, 0x3b, 0xc9, 0xc5, 0x18,
-    0xdc, 0x93, 0xdc, 0xc6, 0x99, 0xef, 0xe0, 0x8f, 0x24, 0x42, 0x0f, 0x30, 0x86, 0xa0, 0x98, 0xd9,
-    0xae, 0x03, 0xf8, 0xf8, 0xf2, 0xc5, 0x47, 0x5a, 0xe5, 0xf0, 0xe3, 0xcb, 0x9f, 0xff, 0xb2, 0x84,
-    0x02, 0x66, 0x58, 0x74, 0x28, 0xf8, 0x31, 0xd0, 0x8f, 0xff, 0xff, 0x03, 0xf1, 0xa7, 0x03, 0x16,
-    0xcc, 0x64, 0xb1, 0x88, 0x54, 0x01, 0xe8, 0x47, 0x10, 0x0a, 0x02, 0xf9, 0xa0, 0x40, 0x12, 0x10,
-    0x46, 0xa8, 0x80, 0x83, 0x0a, 0x30, 0xd8, 0x9f, 0x0e, 0x01, 0x04, 0x04, 0x00, 0x21, 0xf9, 0x04,
-    0x05, 0x04, 0x00, 0x07, 0x00, 0x2c, 0x0b, 0x00, 0x14, 0x00, 0x22, 0x00, 0x2e, 0x00, 0x00, 0x08,
-    0xff, 0x00, 0x0f, 0x08, 0x1c, 0x48, 0xb0, 0x60, 0x41, 0x00, 0x06, 0x13, 0x2a, 0x5c, 0x28, 0x90,
-    0x82, 0x07, 0x86, 0x10, 0x07, 0x02, 0x88, 0x97, 0x21, 0xa2, 0x45, 0x85, 0x0a, 0x2e, 0x6a, 0xdc,
-    0xc8, 0xb1, 0xa3, 0xc7, 0x8f, 0x09, 0x23, 0x3c, 0x04, 0x09, 0x71, 0x04, 0xc3, 0x26, 0xcd, 0xac,
-    0x58, 0x11, 0x46, 0xb2, 0xa0, 0x33, 0x44, 0x2a, 0x5a, 0x08, 0x6c, 0xc1, 0x64, 0x49, 0x30, 0x92,
-    0xc2, 0x9c, 0xc8, 0x74, 0xe1, 0x84, 0x08, 0x41, 0x2e, 0xcd, 0x3e, 0x12, 0xe2, 0x72, 0x80, 0xcb,
-    0x90, 0x2a, 0xc2, 0x96, 0x14, 0x54, 0x31, 0xa4, 0xa3, 0x30, 0xa2, 0x4e, 0x84, 0x15, 0x21, 0x22,
-    0xd3, 0xa0, 0x8a, 0xa0, 0x1b, 0xa3, 0x08, 0x24, 0x54, 0xa8, 0xaa, 0x42, 0x2e, 0x37, 0x2f, 0x36,
-    0xab, 0xea, 0xc2, 0xeb, 0x42, 0xa5, 0x06, 0x2b, 0x4a, 0x14, 0x68, 0xe8, 0x40, 0x94, 0x22, 0x17,
-    0x99, 0x18, 0x1c, 0x11, 0x8f, 0x20, 0x89, 0x03, 0x8b, 0x6a, 0x1c, 0x60, 0xa2, 0xd5, 0x62, 0x0b,
-    0x96, 0x11, 0x09, 0x79, 0xc4, 0x0a, 0x91, 0xf0, 0x46, 0xb8, 0x11, 0xa9, 0x0c, 0xb6, 0xb8, 0xa8,
-    0x07, 0xc7, 0xbf, 0x17, 0xfb, 0x6a, 0xf4, 0x79, 0xd1, 0x19, 0xc7, 0xa6, 0x2d, 0x17, 0x2e, 0xca,
-    0x9c, 0x50, 0xaf, 0x47, 0xcf, 0x9c, 0x43, 0x6b, 0x44, 0x24, 0xda, 0x20, 0xe2, 0xd2, 0x03, 0xf3,
-    0x2a, 0x6c, 0x92, 0x59, 0x32, 0x41, 0x60, 0xa1, 0x5d, 0x2c, 0x45, 0x5d, 0xa4, 0x36, 0xea, 0xdb,
-    0x10, 0xbf, 0x84, 0x9e, 0x73, 0xc0, 0x4d, 0xef, 0xde, 0xbc, 0x39, 0xef, 0x31, 0x98, 0x27, 0xf4,
-    0x11, 0x34, 0xc8, 0x93, 0xef, 0x10, 0x2d, 0x86, 0x60, 0x18, 0xd4, 0x7c, 0xba, 0x74, 0x09, 0x82,
-    0xbb, 0xba, 0xf5, 0xeb, 0x9c, 0x4d, 0x1c, 0xc0, 0x32, 0x10, 0x57, 0xc1, 0x3e, 0x7d, 0x0a, 0x7a,
-    0x14, 0x17, 0x88, 0xe5, 0x8f, 0x76, 0x83, 0x3f, 0x14, 0x26, 0x19, 0xe8, 0xc5, 0xcb, 0xc0, 0xf5,
-    0x06, 0xfb, 0xa4, 0x0f, 0x08, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x1f, 0x00, 0x2c, 0x0a,
-    0x00, 0x14, 0x00, 0x23, 0x00, 0x2e, 0x00, 0x00, 0x08, 0xff, 0x00, 0x3f, 0x08, 0x1c, 0x48, 0xb0,
-    0x60, 0xc1, 0x0c, 0x24, 0x0c, 0x2a, 0x5c, 0x48, 0x70, 0xc4, 0x08, 0x83, 0x0c, 0x18, 0x4a, 0x54,
-    0x18, 0x71, 0xa2, 0xc5, 0x8b, 0x17, 0x3d, 0x60, 0xdc, 0x78, 0x90, 0xa3, 0xc7, 0x8b, 0x0f, 0x3f,
-    0x62, 0x04, 0x00, 0xe1, 0x9d, 0xc8, 0x93, 0x04, 0x01, 0x34, 0x3b, 0x14, 0x85, 0x08, 0xa2, 0x43,
-    0xce, 0x82, 0x9d, 0x04, 0x41, 0xd0, 0x19, 0x93, 0x16, 0x2d, 0x08, 0xb6, 0x58, 0xb1, 0x64, 0x11,
-    0x4a, 0x00, 0x87, 0x72, 0x72, 0x51, 0x52, 0x44, 0x90, 0x4e, 0x44, 0xc2, 0x4e, 0x3e, 0x69, 0xe1,
-    0x42, 0x50, 0x15, 0x2b, 0x82, 0x9c, 0x14, 0x6c, 0xc1, 0xa4, 0xc9, 0x47, 0x63, 0x4c, 0xa5, 0x50,
-    0x71, 0x92, 0x53, 0x61, 0x8b, 0x28, 0x1e, 0x09, 0xf5, 0xf8, 0xe0, 0x62, 0x08, 0x97, 0x89, 0x2d,
-    0x9c, 0x71, 0x1c, 0xf6, 0x81, 0x0b, 0xd7, 0x8b, 0x88, 0x14, 0x66, 0x28, 0x18, 0xe0, 0x43, 0xb0,
-    0x1a, 0x1f, 0x04, 0x0d, 0xc1, 0xa8, 0x22, 0x29, 0xc1, 0x01, 0xf1, 0x08, 0x7a, 0xa8, 0xdb, 0x2c,
-    0xa7, 0x0b, 0x17, 0x1b, 0xd5, 0x5e, 0x54, 0xcc, 0xb1, 0xc5, 0x12, 0x8c, 0x8c, 0x39, 0x3e, 0xbe,
-    0x58, 0xe4, 0x63, 0x5a, 0x8c, 0xc2, 0xba, 0x6e, 0x54, 0x41, 0x68, 0x23, 0x30, 0x8f, 0x5c, 0x00,
-    0x6c, 0xdc, 0x2b, 0x99, 0x23, 0x00, 0x22, 0x1c, 0x65, 0x72, 0xec, 0x8c, 0x12, 0x23, 0x62, 0x89,
-    0x3d, 0x2a, 0x9f, 0x9c, 0xdc, 0x7a, 0x22, 0xea, 0x85, 0x4c, 0x7c, 0xb6, 0x8e, 0x5c, 0x90, 0x36,
-    0xca, 0x60, 0xaf, 0xa7, 0xfa, 0xad, 0x1d, 0xd7, 0x20, 0x94, 0xda, 0x03, 0x65, 0x23, 0xdf, 0x38,
-    0x7c, 0xb9, 0x73, 0x86, 0x91, 0xba, 0x48, 0x9f, 0xfe, 0xbc, 0x84, 0x9b, 0x36, 0xd8, 0xb3, 0xb7,
-    0x11, 0xbd, 0xfc, 0x8e, 0x41, 0x3a, 0xcf, 0xc1, 0xa8, 0x4c, 0x19, 0x4f, 0xfe, 0xcb, 0x73, 0x13,
-    0x78, 0x08, 0xda, 0xf9, 0xf3, 0xfc, 0x43, 0x89, 0x17, 0x7b, 0xf6, 0xec, 0x30, 0xd1, 0xbe, 0xbe,
-    0xfd, 0xfb, 0xf8, 0x17, 0x02, 0xc8, 0x22, 0x50, 0xc7, 0x8f, 0x0f, 0x7e, 0x0c, 0xd4, 0x47, 0x1f,
-    0x02, 0x0d, 0x38, 0x50, 0x80, 0x3f, 0xe8, 0x20, 0x50, 0x16, 0xdc, 0x11, 0xb4, 0x48, 0x80, 0x27,
-    0x0c, 0xe4, 0xc3, 0x07, 0x49, 0x08, 0xe4, 0x85, 0x17, 0x16, 0x62, 0x48, 0xe1, 0x07, 0x13, 0x0a,
-    0x14, 0xa1, 0x1f, 0x8b, 0x04, 0x04, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x07, 0x00, 0x0c, 0x00, 0x2c,
-    0x09, 0x00, 0x13, 0x00, 0x24, 0x00, 0x2f, 0x00, 0x00, 0x08, 0xff, 0x00, 0x19, 0x08, 0x1c, 0x48,
-    0xb0, 0xa0, 0x41, 0x06, 0x11, 0x0e, 0x2a, 0x5c, 0x28, 0x10, 0xc4, 0xc1, 0x08, 0x1e, 0x18, 0x4a,
-    0x2c, 0x08, 0xc1, 0xe1, 0xc4, 0x8b, 0x18, 0x19, 0x52, 0xc8, 0xc8, 0x91, 0xe0, 0xba, 0x0c, 0x1d,
-    0x43, 0x8a, 0x1c, 0xa9, 0xd0, 0x03, 0x09, 0x92, 0x17, 0x37, 0x4a, 0x5c, 0x56, 0x44, 0x8a, 0x33,
-    0x42, 0x00, 0x50, 0x82, 0x1c, 0x18, 0x6c, 0x09, 0x97, 0x16, 0x38, 0x71, 0xae, 0x38, 0x24, 0x6c,
-    0xa4, 0x4a, 0x06, 0xcd, 0x6e, 0x32, 0x70, 0x41, 0x84, 0xc9, 0xc0, 0x16, 0x35, 0x96, 0xa0, 0x74,
-    0xe6, 0x82, 0x01, 0x93, 0x21, 0x55, 0xaa, 0x28, 0x25, 0xd8, 0xe2, 0xd0, 0x48, 0x67, 0x2a, 0x18,
-    0x18, 0xaa, 0x52, 0xc4, 0x09, 0x4e, 0x83, 0x55, 0x43, 0x36, 0x59, 0xc1, 0x80, 0x4b, 0x95, 0x27,
-    0x2d, 0x18, 0xaa, 0x68, 0xd6, 0xf1, 0x50, 0x5a, 0x15, 0x4c, 0xd2, 0x4a, 0x44, 0xc4, 0xb1, 0x49,
-    0x0d, 0x06, 0x4a, 0x0a, 0x61, 0x6c, 0xb1, 0xcc, 0xe0, 0xcc, 0x81, 0x01, 0x04, 0x3a, 0x4b, 0xab,
-    0x24, 0xca, 0xde, 0xa9, 0x03, 0x23, 0xc4, 0x23, 0xf8, 0x6e, 0xa6, 0x55, 0x06, 0x5f, 0x31, 0x3e,
-    0xbe, 0x38, 0x4c, 0xa4, 0xa1, 0x8c, 0x93, 0x39, 0x56, 0xc6, 0x28, 0x48, 0x64, 0x66, 0x89, 0x6c,
-    0x3b, 0xb6, 0x70, 0x96, 0x71, 0x11, 0x97, 0x8e, 0x35, 0x82, 0x71, 0xec, 0xcc, 0xf1, 0xf3, 0xc4,
-    0x45, 0x46, 0x31, 0x9e, 0x46, 0x29, 0x71, 0x05, 0x21, 0xda, 0x0c, 0x5d, 0x84, 0xc6, 0xad, 0xd0,
-    0x18, 0x6d, 0x00, 0xb1, 0x0f, 0xce, 0xa6, 0x8d, 0xd8, 0x20, 0x6b, 0xda, 0xc2, 0xb2, 0x1e, 0xbc,
-    0xcd, 0x1b, 0xca, 0xc1, 0x15, 0x31, 0x79, 0x93, 0x36, 0x38, 0x84, 0x37, 0x41, 0x2b, 0xd8, 0xb1,
-    0x5b, 0xdf, 0x3e, 0xb1, 0x04, 0x83, 0x48, 0xe0, 0xc3, 0x33, 0x58, 0xf0, 0xce, 0x1b, 0x0b, 0x9b,
-    0xf3, 0xe8, 0xcf, 0x63, 0xd9, 0x0e, 0x27, 0xfd, 0x79, 0x37, 0xd1, 0x79, 0x8f, 0x59, 0x43, 0xbf,
-    0xbe, 0x18, 0xee, 0x3a, 0xe2, 0x10, 0x7c, 0x83, 0x8b, 0x3b, 0x03, 0x2c, 0x5d, 0xcc, 0x21, 0x47,
-    0x17, 0x3a, 0xf8, 0x67, 0xe0, 0x81, 0x08, 0x26, 0xa8, 0x90, 0x77, 0xcc, 0x0c, 0xd4, 0x9f, 0x40,
-    0x7d, 0x18, 0x14, 0xa1, 0x40, 0x0f, 0x32, 0xd0, 0x20, 0x79, 0x05, 0x35, 0x28, 0x04, 0x03, 0x40,
-    0xa0, 0x50, 0x90, 0x17, 0x02, 0xf1, 0x21, 0x22, 0x03, 0x20, 0x12, 0x84, 0x02, 0x10, 0x0c, 0x6c,
-    0xc8, 0x4c, 0x40, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x1d, 0x00, 0x2c, 0x08, 0x00, 0x12,
-    0x00, 0x26, 0x00, 0x30, 0x00, 0x00, 0x08, 0xff, 0x00, 0x3b, 0x08, 0x1c, 0x48, 0xb0, 0xa0, 0x41,
-    0x81, 0x00, 0x0e, 0x2a, 0x5c, 0x38, 0x30, 0x03, 0x85, 0x83, 0x0c, 0x3c, 0x30, 0x9c, 0x68, 0x70,
-    0x84, 0x44, 0x83, 0x0c, 0x28, 0x6a, 0xdc, 0xc8, 0xb1, 0xa3, 0x46, 0x10, 0x03, 0x3c, 0x16, 0x44,
-    0xb0, 0xf1, 0xa1, 0xc8, 0x93, 0x13, 0x23, 0x64, 0x40, 0xd9, 0x11, 0x81, 0x3c, 0x96, 0x1d, 0x33,
-    0x2e, 0x5c, 0xe4, 0xec, 0x10, 0x22, 0x22, 0x88, 0x86, 0x39, 0x6b, 0x02, 0x13, 0x43, 0x00, 0x82,
-    0x4b, 0xb8, 0xb4, 0x28, 0xd8, 0xa2, 0xc6, 0xa1, 0x60, 0x07, 0x11, 0x44, 0x98, 0xc8, 0xe0, 0x67,
-    0x87, 0x26, 0x51, 0x86, 0x72, 0x29, 0x24, 0x45, 0x09, 0xc1, 0x16, 0x4c, 0x08, 0x19, 0x34, 0xa9,
-    0xb1, 0x09, 0x91, 0x16, 0x2e, 0x04, 0x4d, 0x21, 0xb4, 0x24, 0x8a, 0xc1, 0x15, 0x5a, 0x51, 0x46,
-    0x5d, 0x61, 0x85, 0x4a, 0xd4, 0x85, 0x4c, 0x90, 0x8a, 0x1c, 0x32, 0x94, 0x88, 0x15, 0x2e, 0x13,
-    0x5b, 0x1c, 0x12, 0xb9, 0x08, 0xef, 0x0a, 0x17, 0x43, 0x29, 0xf6, 0x10, 0xe6, 0xd1, 0xd9, 0x50,
-    0x2b, 0x1d, 0x97, 0x1c, 0x5c, 0x49, 0xd0, 0x69, 0x87, 0xbd, 0x1d, 0x0c, 0xad, 0xe0, 0x68, 0xc8,
-    0x20, 0x80, 0x77, 0x04, 0xdf, 0x01, 0x70, 0x8a, 0xe8, 0x24, 0x30, 0x8f, 0x89, 0x4e, 0x42, 0xf1,
-    0xd8, 0x59, 0xe4, 0xe7, 0x8e, 0xc3, 0x4e, 0x56, 0xee, 0xe8, 0xec, 0xa4, 0xe2, 0x8e, 0x4d, 0x6a,
-    0x78, 0x74, 0x41, 0xd8, 0x23, 0x64, 0x98, 0x1a, 0xe5, 0x72, 0xe4, 0x89, 0xbb, 0xb7, 0xe0, 0x89,
-    0x3d, 0x7c, 0x1b, 0xf3, 0x4d, 0xb1, 0x2f, 0x43, 0xdd, 0xb8, 0x05, 0x2d, 0xbc, 0xdd, 0x3b, 0xed,
-    0xc1, 0x66, 0xc4, 0x3b, 0x2c, 0x92, 0x6d, 0xb0, 0x06, 0x72, 0xdf, 0xc1, 0x0b, 0x32, 0x8a, 0xce,
-    0xbd, 0x3b, 0xcb, 0x3f, 0x5f, 0x0e, 0x66, 0x60, 0xe1, 0xde, 0x47, 0xa1, 0x1f, 0xee, 0x25, 0xda,
-    0x18, 0x64, 0xf3, 0xa7, 0x7b, 0x18, 0x36, 0xf0, 0xe3, 0xeb, 0xf1, 0xde, 0x67, 0x0d, 0x41, 0x35,
-    0x27, 0xbc, 0x77, 0xe8, 0x13, 0x26, 0x4d, 0x9a, 0x3d, 0x42, 0xe8, 0x37, 0x10, 0x00, 0x09, 0x09,
-    0x68, 0xe0, 0x81, 0x08, 0x0a, 0x64, 0xc2, 0x1f, 0x58, 0xe8, 0xf0, 0x03, 0x2e, 0xe7, 0xed, 0xa7,
-    0x50, 0x79, 0x1d, 0xf8, 0x81, 0xcb, 0x0f, 0x3a, 0x60, 0xf1, 0x87, 0x09, 0x0b, 0xe9, 0x40, 0xa1,
-    0x40, 0x3e, 0x74, 0x90, 0x44, 0x07, 0x5e, 0x74, 0xc0, 0x07, 0x1f, 0x03, 0xa1, 0x58, 0xe2, 0x88,
-    0x21, 0x0e, 0xd4, 0x87, 0x0e, 0x1d, 0x04, 0x04, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x24,
-    0x00, 0x2c, 0x08, 0x00, 0x11, 0x00, 0x26, 0x00, 0x31, 0x00, 0x00, 0x08, 0xff, 0x00, 0x49, 0x08,
-    0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x83, 0x08, 0x13, 0x1a, 0xcc, 0x80, 0x90, 0x02, 0x04, 0x85, 0x10,
-    0x0d, 0xbe, 0x1b, 0x10, 0xb1, 0xa2, 0xc5, 0x8b, 0x18, 0x33, 0x16, 0x64, 0xa0, 0x51, 0x23, 0x82,
-    0x0d, 0x1d, 0x43, 0x86, 0x04, 0x00, 0x40, 0x24, 0x41, 0x10, 0x18, 0x4c, 0x5a, 0xcc, 0x90, 0x52,
-    0xa5, 0x4b, 0x12, 0xc2, 0x96, 0x44, 0x81, 0xd2, 0xa2, 0x06, 0x22, 0x41, 0xcb, 0x44, 0x7a, 0x28,
-    0x39, 0x70, 0xca, 0xa1, 0x1e, 0x07, 0x5b, 0xfc, 0x12, 0x76, 0x50, 0x81, 0x02, 0x85, 0x01, 0x02,
-    0x0c, 0x14, 0x46, 0x44, 0x20, 0x91, 0x25, 0x56, 0x04, 0x15, 0x5c, 0xd1, 0xec, 0x20, 0xcf, 0x88,
-    0xc2, 0xb8, 0x90, 0x58, 0x31, 0x84, 0x84, 0x15, 0x25, 0x4e, 0x0c, 0xf6, 0xa8, 0xda, 0x71, 0x51,
-    0x53, 0x2e, 0x84, 0x08, 0x35, 0x4d, 0xb8, 0x82, 0xa8, 0x46, 0x63, 0x03, 0xa5, 0xb8, 0x88, 0x38,
-    0x4c, 0x63, 0x93, 0x1a, 0x24, 0x98, 0xac, 0xb0, 0xa8, 0x22, 0x67, 0x47, 0x42, 0x4f, 0x2e, 0x4a,
-    0x2d, 0x78, 0x55, 0xa0, 0xd2, 0x81, 0x75, 0x49, 0x38, 0x99, 0x6b, 0x31, 0x8a, 0xc1, 0x0d, 0xf1,
-    0x06, 0x7a, 0x48, 0x3a, 0x10, 0x58, 0x47, 0x28, 0x19, 0x31, 0x6b, 0x84, 0x91, 0xd1, 0xb2, 0xc6,
-    0x44, 0x2f, 0x43, 0x13, 0xec, 0x2a, 0x5a, 0x21, 0x50, 0x8c, 0xa7, 0x4b, 0xab, 0x5e, 0xcd, 0xba,
-    0xb4, 0x8a, 0x97, 0x83, 0x5b, 0xcb, 0x4e, 0x08, 0x77, 0xf6, 0xc0, 0x16, 0xb6, 0x4d, 0xaf, 0x7e,
-    0x9d, 0xbb, 0xb7, 0x6f, 0x81, 0x5f, 0x82, 0x0b, 0xff, 0xdd, 0xa7, 0xb4, 0x09, 0x36, 0x07, 0xb1,
-    0xa8, 0xde, 0x63, 0x30, 0xcf, 0x6a, 0x21, 0x6a, 0x08, 0xa6, 0x01, 0xd2, 0x7a, 0xcf, 0x19, 0x33,
-    0x7a, 0x4e, 0xfc, 0xde, 0xce, 0xbd, 0x7b, 0xc7, 0xe2, 0xa2, 0x7f, 0x28, 0x08, 0xe4, 0x63, 0x90,
-    0x7c, 0x42, 0xf1, 0x01, 0x01, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x04, 0x00, 0x26, 0x00, 0x2c, 0x07,
-    0x00, 0x11, 0x00, 0x28, 0x00, 0x14, 0x00, 0x00, 0x08, 0x67, 0x00, 0x4d, 0x08, 0x1c, 0x48, 0xb0,
-    0xa0, 0x41, 0x81, 0x14, 0x1e, 0x1c, 0x5c, 0xc8, 0x90, 0xe0, 0x88, 0x0d, 0x0b, 0x19, 0x78, 0x68,
-    0x48, 0xf1, 0x20, 0x80, 0x8a, 0x18, 0x33, 0x6a, 0xdc, 0xc8, 0xb1, 0x21, 0x80, 0x77, 0x14, 0x3a,
-    0x56, 0x8c, 0x70, 0x50, 0xa1, 0xc8, 0x81, 0x24, 0x42, 0x9e, 0x34, 0xa8, 0x72, 0x61, 0x80, 0x00,
-    0x2b, 0x0b, 0x52, 0x90, 0x17, 0xb3, 0xa6, 0x4d, 0x8d, 0x19, 0x6e, 0x9a, 0x60, 0x40, 0x71, 0x00,
-    0x00, 0x98, 0x36, 0xdf, 0x5d, 0xd4, 0x49, 0xb4, 0xa8, 0xd1, 0xa3, 0x48, 0x93, 0x2a, 0x2d, 0x98,
-    0x53, 0xe0, 0x4f, 0xa4, 0x24, 0x22, 0x44, 0x88, 0x37, 0xf0, 0x01, 0x50, 0xa3, 0x14, 0x32, 0x04,
-    0x04, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x06, 0x00, 0x24, 0x00, 0x2c, 0x07, 0x00, 0x10, 0x00, 0x28,
-    0x00, 0x15, 0x00, 0x00, 0x06, 0x54, 0x40, 0x92, 0x70, 0x48, 0x2c, 0x1a, 0x85, 0x94, 0xc7, 0x71,
-    0xc9, 0x24, 0x62, 0x28, 0x4b, 0x86, 0xa7, 0x49, 0x3d, 0x22, 0x94, 0xd5, 0xac, 0x76, 0xcb, 0xed,
-    0x32, 0x47, 0x13, 0x2f, 0x95, 0x02, 0x59, 0x0e, 0xc4, 0xc3, 0x47, 0xa0, 0x18, 0x58, 0xa3, 0x9b,
-    0xed, 0x77, 0x71, 0xc2, 0x90, 0x73, 0x41, 0xf6, 0xbc, 0x9e, 0xfa, 0xa0, 0xb8, 0xf3, 0x03, 0x78,
-    0x4c, 0x71, 0x7b, 0x67, 0x7b, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x44, 0x00, 0x43, 0x00,
-    0x7f, 0x8a, 0x08, 0x08, 0x43, 0x08, 0x93, 0x89, 0x0c, 0x41, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x04,
-    0x00, 0x25, 0x00, 0x2c, 0x07, 0x00, 0x0f, 0x00, 0x29, 0x00, 0x16, 0x00, 0x00, 0x08, 0x67, 0x00,
-    0x4b, 0x08, 0x1c, 0x48, 0xb0, 0xa0, 0x41, 0x81, 0x14, 0x36, 0x1c, 0x5c, 0xc8, 0x90, 0x60, 0x86,
-    0x11, 0x0c, 0x19, 0x78, 0x68, 0x48, 0xf1, 0x60, 0x86, 0x75, 0x15, 0x33, 0x6a, 0xdc, 0xc8, 0xb1,
-    0xa3, 0x46, 0x04, 0x00, 0x3c, 0x8a, 0x14, 0x38, 0x71, 0xa4, 0xc0, 0x01, 0x06, 0x01, 0x40, 0x34,
-    0xc9, 0x30, 0x40, 0x00, 0x96, 0x30, 0x1b, 0xca, 0xab, 0x18, 0xe1, 0x41, 0x4c, 0x8e, 0x24, 0x6e,
-    0x8a, 0xa4, 0xa0, 0x33, 0x23, 0x05, 0x97, 0x3d, 0x4b, 0xbc, 0x5b, 0x19, 0x94, 0x21, 0xd1, 0xa2,
-    0x48, 0x93, 0x2a, 0x5d, 0xca, 0xb4, 0x69, 0x4c, 0x00, 0x2f, 0x97, 0x3e, 0x48, 0x28, 0x90, 0x44,
-    0x54, 0xa5, 0x03, 0x00, 0x04, 0x04, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x26, 0x00, 0x2c,
-    0x09, 0x00, 0x0e, 0x00, 0x28, 0x00, 0x17, 0x00, 0x00, 0x06, 0x57, 0x40, 0x93, 0x70, 0x48, 0x2c,
-    0x1a, 0x29, 0x0a, 0xa3, 0x72, 0xc9, 0x5c, 0x32, 0x3c, 0xcd, 0xa8, 0x11, 0x81, 0x90, 0x5a, 0xad,
-    0x94, 0xab, 0x76, 0xab, 0xa5, 0x44, 0xb8, 0xe0, 0x21, 0x04, 0x14, 0x36, 0x3d, 0x94, 0x19, 0x52,
-    0xb9, 0x09, 0x08, 0x18, 0x03, 0xee, 0xb5, 0x7c, 0x1e, 0x3e, 0x37, 0x11, 0x10, 0xba, 0x30, 0x6e,
-    0x05, 0xe8, 0xad, 0x08, 0x14, 0x7c, 0x7f, 0x26, 0x0d, 0x7e, 0x45, 0x83, 0x84, 0x10, 0x19, 0x84,
-    0x8d, 0x8e, 0x8f, 0x90, 0x91, 0x92, 0x93, 0x94, 0x42, 0x6d, 0x95, 0x1b, 0x26, 0x08, 0x89, 0x90,
-    0x5f, 0x41, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x26, 0x00, 0x2c, 0x08, 0x00, 0x0d, 0x00,
-    0x29, 0x00, 0x18, 0x00, 0x00, 0x08, 0x6e, 0x00, 0x4d, 0x08, 0x1c, 0x48, 0xb0, 0xa0, 0x41, 0x13,
-    0x19, 0x48, 0x1c, 0x5c, 0xc8, 0xb0, 0x61, 0x41, 0x06, 0x1e, 0x1c, 0x4a, 0x2c, 0x08, 0x02, 0xc0,
-    0xc4, 0x8b, 0x12, 0x37, 0x60, 0xdc, 0xc8, 0xf1, 0x22, 0x83, 0x8e, 0x20, 0x05, 0x32, 0x90, 0x67,
-    0x11, 0x24, 0x85, 0x83, 0x09, 0x19, 0x2a, 0x04, 0x19, 0x20, 0xc0, 0xc1, 0x96, 0x21, 0x1d, 0xba,
-    0x8c, 0x49, 0x53, 0xe2, 0xca, 0x86, 0x25, 0x6b, 0x0a, 0xa4, 0x90, 0xc1, 0xa1, 0x46, 0x9d, 0x1d,
-    0x23, 0xcc, 0x04, 0xea, 0x10, 0x00, 0x4c, 0xa2, 0x04, 0x49, 0xbc, 0x43, 0x3a, 0xf1, 0x23, 0xd3,
-    0xa7, 0x50, 0xa3, 0x4a, 0x9d, 0x4a, 0xb5, 0xaa, 0xd5, 0xa1, 0x54, 0x1f, 0x20, 0x78, 0x80, 0x75,
-    0xea, 0x00, 0x06, 0x01, 0x01, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x07, 0x00, 0x24, 0x00, 0x2c, 0x07,
-    0x00, 0x0c, 0x00, 0x2b, 0x00, 0x19, 0x00, 0x00, 0x08, 0x69, 0x00, 0x49, 0x08, 0x1c, 0x48, 0xb0,
-    0xa0, 0xc1, 0x81, 0x0c, 0x0e, 0x2a, 0x5c, 0xc8, 0xf0, 0x20, 0x03, 0x0f, 0x0d, 0x23, 0x4a, 0x9c,
-    0x48, 0x51, 0x21, 0x84, 0x8a, 0x18, 0x33, 0x6a, 0xdc, 0x88, 0x11, 0xc3, 0x04, 0x8e, 0x08, 0x14,
-    0x02, 0x18, 0xc1, 0x30, 0xc3, 0xc6, 0x00, 0x28, 0x0f, 0xa6, 0xe4, 0xc8, 0xb2, 0xa5, 0xcb, 0x97,
-    0x1a, 0x33, 0x7c, 0x84, 0x39, 0x71, 0xa5, 0x44, 0x0a, 0x34, 0x27, 0x82, 0x18, 0x10, 0x20, 0x67,
-    0xc1, 0x0c, 0x24, 0x0b, 0xf6, 0xf4, 0x49, 0x50, 0x5e, 0x48, 0xa2, 0x48, 0x33, 0x36, 0x48, 0xca,
-    0xd0, 0x26, 0xd3, 0xa7, 0x50, 0xa3, 0x4a, 0x9d, 0x2a, 0x94, 0xea, 0x83, 0x8f, 0x03, 0xa8, 0x0e,
-    0xa0, 0x10, 0x10, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x25, 0x00, 0x2c, 0x07, 0x00, 0x0c,
-    0x00, 0x2c, 0x00, 0x19, 0x00, 0x00, 0x06, 0x56, 0xc0, 0x92, 0x70, 0x48, 0x2c, 0x1a, 0x85, 0x14,
-    0xcc, 0x71, 0xc9, 0x6c, 0x3a, 0x9f, 0xd0, 0xa8, 0x74, 0x3a, 0x04, 0x78, 0xa8, 0xd8, 0xac, 0x33,
-    0xb3, 0xd1, 0x0a, 0x01, 0xcb, 0x40, 0xa4, 0xa9, 0xf0, 0x02, 0x02, 0x61, 0xb4, 0x77, 0xcd, 0x6e,
-    0xbb, 0xd7, 0x01, 0xd2, 0xf8, 0x1d, 0x0d, 0xa8, 0xe9, 0x78, 0xe1, 0xe6, 0x9e, 0x6f, 0x52, 0xf8,
-    0x7d, 0x25, 0x18, 0x65, 0x81, 0x4d, 0x18, 0x19, 0x85, 0x89, 0x53, 0x01, 0x5d, 0x8a, 0x8e, 0x8f,
-    0x90, 0x91, 0x92, 0x93, 0x4d, 0x80, 0x8f, 0x0f, 0x20, 0x76, 0x93, 0x03, 0x14, 0x41, 0x00, 0x21,
-    0xf9, 0x04, 0x05, 0x04, 0x00, 0x1c, 0x00, 0x2c, 0x0a, 0x00, 0x0b, 0x00, 0x2a, 0x00, 0x1a, 0x00,
-    0x00, 0x08, 0x69, 0x00, 0x39, 0x08, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x0c, 0x06, 0x13, 0x2a, 0x5c,
-    0xc8, 0x90, 0x81, 0x07, 0x86, 0x10, 0x23, 0x4a, 0x9c, 0x48, 0xb1, 0xa2, 0xc5, 0x8b, 0x0c, 0x23,
-    0x20, 0xc4, 0xa8, 0x30, 0xc0, 0x46, 0x85, 0xf2, 0x28, 0x58, 0xcc, 0x40, 0x21, 0xc0, 0x42, 0x93,
-    0x1c, 0x4f, 0xa6, 0x5c, 0xc9, 0xb2, 0x65, 0x44, 0x00, 0x1b, 0x5c, 0x52, 0x0c, 0x80, 0x52, 0xa6,
-    0xcd, 0x9b, 0x12, 0x47, 0xe0, 0x54, 0x48, 0x41, 0x24, 0x87, 0x9a, 0x3b, 0x09, 0xca, 0x1b, 0x10,
-    0xb4, 0xe8, 0xc4, 0x8f, 0x46, 0x0b, 0x02, 0x20, 0x9a, 0xb4, 0xa9, 0xd3, 0xa7, 0x50, 0xa3, 0x4a,
-    0x35, 0x1a, 0x81, 0xe0, 0x03, 0x10, 0x4d, 0x91, 0x0e, 0xa0, 0x10, 0x10, 0x00, 0x21, 0xf9, 0x04,
-    0x05, 0x03, 0x00, 0x1d, 0x00, 0x2c, 0x0a, 0x00, 0x0b, 0x00, 0x2b, 0x00, 0x1a, 0x00, 0x00, 0x06,
-    0x54, 0xc0, 0x8e, 0x70, 0x48, 0x2c, 0x1a, 0x19, 0xc6, 0xa4, 0x72, 0xc9, 0x6c, 0x3a, 0x9f, 0xd0,
-    0xa8, 0xd4, 0x48, 0x99, 0x5a, 0x93, 0x01, 0x00, 0x13, 0x04, 0xb2, 0x92, 0x32, 0xcc, 0xc0, 0xb5,
-    0x19, 0x10, 0x8f, 0xcf, 0xe8, 0xb4, 0x75, 0xd4, 0x50, 0x4b, 0xcb, 0xee, 0xb8, 0x7c, 0x6c, 0x9e,
-    0x3b, 0xe1, 0xf6, 0x24, 0xe3, 0x01, 0xce, 0x33, 0x49, 0x7e, 0x81, 0x6f, 0x11, 0x0f, 0x82, 0x58,
-    0x75, 0x86, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8c, 0x01, 0x08, 0x44, 0x0f, 0x6d, 0x86, 0x01,
-    0x48, 0x43, 0x03, 0x14, 0x41, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x07, 0x00, 0x12, 0x00, 0x2c, 0x13,
-    0x00, 0x0d, 0x00, 0x23, 0x00, 0x18, 0x00, 0x00, 0x06, 0x47, 0x40, 0x89, 0x70, 0x48, 0x2c, 0x1a,
-    0x8f, 0xc8, 0xa4, 0x24, 0x90, 0x51, 0x4a, 0x9a, 0xca, 0x40, 0x54, 0x49, 0xda, 0x28, 0x29, 0x52,
-    0xa7, 0x76, 0xcb, 0xed, 0x7a, 0x8f, 0x01, 0xeb, 0xb7, 0x1b, 0xc8, 0x8e, 0xcf, 0xe8, 0xb4, 0x7a,
-    0xcd, 0x06, 0xb0, 0x93, 0x10, 0xf1, 0x7b, 0xee, 0x8c, 0xd0, 0x8d, 0x4c, 0xca, 0x7d, 0xcf, 0xef,
-    0xfb, 0xff, 0x80, 0x81, 0x73, 0x01, 0x18, 0x44, 0x0f, 0x03, 0x74, 0x01, 0x76, 0x43, 0x03, 0x19,
-    0x41, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x1d, 0x00, 0x2c, 0x12, 0x00, 0x0c, 0x00, 0x25,
-    0x00, 0x19, 0x00, 0x00, 0x05, 0x42, 0x60, 0x27, 0x8e, 0x64, 0x69, 0x9e, 0x68, 0x4a, 0x02, 0x91,
-    0xea, 0xbe, 0x63, 0xe0, 0x52, 0x6e, 0x20, 0xc3, 0xe9, 0xf3, 0xde, 0x78, 0xef, 0xbb, 0x03, 0xc4,
-    0x6f, 0x68, 0x1b, 0x1a, 0x8f, 0xc8, 0xa4, 0x72, 0xc9, 0x44, 0x0e, 0x00, 0xcd, 0x94, 0x27, 0x13,
-    0xad, 0xee, 0x18, 0x0a, 0x6b, 0xa9, 0xa8, 0xed, 0x7a, 0xbf, 0xe0, 0xb0, 0x78, 0xdc, 0x0c, 0x60,
-    0x48, 0x0f, 0x5a, 0x35, 0xd0, 0x1a, 0x3d, 0x43, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x0c,
-    0x00, 0x2c, 0x1e, 0x00, 0x0c, 0x00, 0x19, 0x00, 0x19, 0x00, 0x00, 0x06, 0x38, 0x40, 0xca, 0x86,
-    0x41, 0x2c, 0x1a, 0x8f, 0x48, 0x62, 0x20, 0x90, 0x6c, 0x3a, 0x9f, 0xd0, 0xa8, 0x74, 0x1a, 0xf0,
-    0x4c, 0x9d, 0xcb, 0xab, 0x76, 0xcb, 0xed, 0x7a, 0xbf, 0xe0, 0xe7, 0x28, 0x12, 0x66, 0x90, 0xb9,
-    0x81, 0xf3, 0x77, 0x09, 0x28, 0xbb, 0xdf, 0xf0, 0xb8, 0x7c, 0x4e, 0x2f, 0x06, 0x10, 0xc6, 0xe1,
-    0x36, 0x6d, 0x8c, 0x04, 0x01, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x04, 0x00, 0x0e, 0x00, 0x2c, 0x1e,
-    0x00, 0x0b, 0x00, 0x1a, 0x00, 0x1a, 0x00, 0x00, 0x06, 0x39, 0x40, 0x47, 0xc0, 0x41, 0x2c, 0x1a,
-    0x8f, 0xc8, 0x62, 0x60, 0x98, 0x6c, 0x3a, 0x9f, 0xd0, 0xa8, 0x74, 0x5a, 0x04, 0x51, 0x9f, 0x94,
-    0xcc, 0x75, 0xcb, 0xed, 0x7a, 0xbf, 0xe0, 0xb0, 0xf8, 0x39, 0x02, 0x53, 0xc4, 0x01, 0x86, 0x35,
-    0xcc, 0x1c, 0xbb, 0xdf, 0xf0, 0xb8, 0x7c, 0x4e, 0x57, 0xae, 0x1d, 0x8f, 0x32, 0x37, 0x70, 0x26,
-    0x0e, 0x32, 0x41, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x06, 0x00, 0x0f, 0x00, 0x2c, 0x2a, 0x00, 0x0e,
-    0x00, 0x0e, 0x00, 0x17, 0x00, 0x00, 0x06, 0x29, 0xc0, 0x87, 0x70, 0x48, 0x24, 0x46, 0x36, 0xc5,
-    0xe4, 0x23, 0x10, 0x50, 0x3a, 0x9f, 0xd0, 0xa8, 0x74, 0x4a, 0xad, 0x5a, 0x85, 0x01, 0x92, 0x34,
-    0x00, 0xb8, 0x7a, 0xbf, 0xe0, 0xb0, 0x58, 0x1c, 0x18, 0x0c, 0x15, 0xce, 0x40, 0x66, 0x18, 0x09,
-    0x02, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x04, 0x00, 0x0c, 0x00, 0x2c, 0x2a, 0x00, 0x0e, 0x00, 0x0e,
-    0x00, 0x17, 0x00, 0x00, 0x05, 0x22, 0x20, 0x13, 0x30, 0x64, 0x69, 0x92, 0xc1, 0x78, 0xae, 0x6c,
-    0xeb, 0xbe, 0x70, 0x2c, 0xcf, 0x74, 0x7d, 0x06, 0x58, 0xac, 0xda, 0x7c, 0xef, 0xff, 0xc0, 0x5f,
-    0x20, 0x42, 0xda, 0xb8, 0x02, 0x99, 0x52, 0x08, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x08,
-    0x00, 0x2c, 0x33, 0x00, 0x17, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, 0x05, 0x11, 0x60, 0x84, 0x8c,
-    0x08, 0x43, 0x9e, 0x68, 0xaa, 0xae, 0x6c, 0x4b, 0x06, 0xe2, 0x18, 0x64, 0x63, 0x08, 0x00, 0x21,
-    0xf9, 0x04, 0x05, 0x03, 0x00, 0x10, 0x00, 0x2c, 0x33, 0x00, 0x17, 0x00, 0x04, 0x00, 0x0e, 0x00,
-    0x00, 0x06, 0x12, 0xc0, 0x40, 0x00, 0x02, 0x11, 0x12, 0x8f, 0xc8, 0xa4, 0x72, 0xc9, 0x6c, 0x06,
-    0x48, 0xc4, 0x00, 0x25, 0x08, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x07, 0x00, 0x0b, 0x00, 0x2c, 0x36,
-    0x00, 0x23, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x05, 0x05, 0x60, 0xb6, 0x04, 0x4b, 0x08, 0x00,
-    0x21, 0xf9, 0x04, 0x05, 0xed, 0x00, 0x03, 0x00, 0x2c, 0x36, 0x00, 0x23, 0x00, 0x02, 0x00, 0x02,
-    0x00, 0x00, 0x02, 0x03, 0x4c, 0x16, 0x05, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x03, 0x00,
-    0x2c, 0x13, 0x00, 0x1a, 0x00, 0x16, 0x00, 0x23, 0x00, 0x00, 0x08, 0xff, 0x00, 0x07, 0x08, 0x1c,
-    0x48, 0xb0, 0xa0, 0xc1, 0x83, 0x00, 0x9a, 0x1d, 0x4a, 0x54, 0xc3, 0x45, 0xa2, 0x61, 0xce, 0x16,
-    0x1d, 0x1c, 0x18, 0xa0, 0x19, 0xb0, 0x89, 0x5c, 0x9c, 0x4d, 0x0c, 0x60, 0x4c, 0xc5, 0x00, 0x17,
-    0x85, 0xa4, 0x10, 0x8a, 0x42, 0xb0, 0xc5, 0xb0, 0x29, 0x05, 0x03, 0x1c, 0x1a, 0xd0, 0xc2, 0x90,
-    0x30, 0x2a, 0x4b, 0x0a, 0x71, 0x29, 0xd8, 0x22, 0x0a, 0x00, 0x8a, 0x1a, 0x5b, 0x14, 0x9a, 0xa2,
-    0xc4, 0xc5, 0x44, 0x96, 0x2b, 0x05, 0x0a, 0x5b, 0xc1, 0xb2, 0x10, 0xc9, 0x9f, 0x02, 0x7b, 0x10,
-    0x1a, 0xa0, 0xf2, 0xe3, 0x13, 0xa4, 0x25, 0x57, 0x2e, 0xaa, 0x31, 0xc0, 0x10, 0x15, 0xa8, 0x04,
-    0x6b, 0x2c, 0x6a, 0x26, 0x50, 0x05, 0x51, 0xac, 0x02, 0x5b, 0x34, 0xd3, 0x08, 0x96, 0xa6, 0x33,
-    0xb2, 0x65, 0x07, 0xb6, 0x38, 0x9b, 0xb6, 0xa4, 0xb3, 0xa5, 0x6d, 0xc3, 0x12, 0x9a, 0x1a, 0x77,
-    0x00, 0x17, 0x00, 0x4d, 0xdb, 0xb6, 0x08, 0x2a, 0x8c, 0x6a, 0xda, 0x1a, 0xc2, 0x04, 0x06, 0x58,
-    0x92, 0xb6, 0x05, 0x61, 0x8a, 0xc3, 0xc0, 0xee, 0x35, 0x38, 0x05, 0x11, 0x54, 0x93, 0x13, 0x09,
-    0x79, 0xfc, 0x49, 0x44, 0xe2, 0xc1, 0x00, 0xbf, 0x7e, 0xaa, 0xe0, 0xfa, 0x13, 0xad, 0x41, 0xc7,
-    0x48, 0x9b, 0x4c, 0x36, 0xe8, 0xf9, 0xf2, 0x45, 0x83, 0x2a, 0xae, 0x42, 0x6d, 0xf6, 0x55, 0x6d,
-    0x50, 0xac, 0xc1, 0x08, 0xc1, 0x2d, 0x02, 0xb7, 0x6e, 0x5b, 0x1d, 0x62, 0xc6, 0x8c, 0x89, 0x34,
-    0x00, 0x0c, 0x98, 0x17, 0x25, 0xb0, 0x9e, 0x68, 0xd3, 0xc6, 0x20, 0x2e, 0xac, 0x58, 0x0e, 0xb6,
-    0x31, 0x01, 0x16, 0xcf, 0x9a, 0x35, 0x04, 0xc3, 0x94, 0x45, 0x81, 0x86, 0x60, 0x25, 0x21, 0x69,
-    0x81, 0xe4, 0x19, 0x80, 0x66, 0x0f, 0xf6, 0xb8, 0xc1, 0x91, 0x06, 0x01, 0x04, 0x00, 0x21, 0xf9,
-    0x04, 0x05, 0x03, 0x00, 0x03, 0x00, 0x2c, 0x13, 0x00, 0x1a, 0x00, 0x17, 0x00, 0x23, 0x00, 0x00,
-    0x08, 0xff, 0x00, 0x07, 0x08, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x83, 0x03, 0x02, 0x04, 0x20, 0xa4,
-    0x04, 0x11, 0x94, 0x1a, 0x44, 0x86, 0x39, 0x5b, 0x84, 0x70, 0x60, 0x00, 0x2a, 0x51, 0x0e, 0xb6,
-    0xe0, 0xb2, 0xa4, 0x62, 0x00, 0x67, 0x35, 0x5a, 0xb4, 0x70, 0xb2, 0xc4, 0x8a, 0x15, 0x17, 0x03,
-    0x5b, 0x44, 0x09, 0x66, 0x30, 0x00, 0xa3, 0x01, 0x2d, 0x88, 0x58, 0xa9, 0x22, 0x45, 0xc9, 0x13,
-    0x15, 0x04, 0x5b, 0x20, 0x62, 0x69, 0xb1, 0x99, 0x8a, 0x8d, 0x55, 0x86, 0xac, 0xa8, 0xd8, 0x62,
-    0x98, 0xc5, 0x60, 0x5c, 0x60, 0xba, 0x70, 0x52, 0x51, 0x60, 0x0b, 0x15, 0xcd, 0x04, 0x06, 0x58,
-    0x22, 0x52, 0x0a, 0xd3, 0xa6, 0x4e, 0x33, 0x2a, 0x04, 0xf6, 0x74, 0x48, 0x52, 0xac, 0x30, 0x55,
-    0x08, 0x0b, 0x20, 0x0c, 0x66, 0x0b, 0xb0, 0x39, 0x9d, 0x05, 0x88, 0x8a, 0xb6, 0x60, 0x8b, 0x25,
-    0x6b, 0xdb, 0xba, 0x15, 0x14, 0x57, 0x6e, 0x4a, 0xb8, 0xc2, 0x70, 0xda, 0x85, 0xa9, 0x36, 0x00,
-    0x93, 0xbd, 0x4f, 0x9b, 0x24, 0xec, 0x68, 0xb7, 0xc5, 0x2f, 0xa9, 0x48, 0xe5, 0x8a, 0x64, 0x9b,
-    0xd0, 0x99, 0xe2, 0x43, 0x05, 0x03, 0x40, 0x06, 0xab, 0x72, 0x4a, 0xe4, 0xc4, 0x4d, 0x5b, 0x18,
-    0xb2, 0xdc, 0x52, 0x50, 0x66, 0x43, 0x00, 0x2a, 0xe6, 0x45, 0xd8, 0x82, 0x09, 0x4f, 0x84, 0x01,
-    0xa0, 0x20, 0x84, 0x8a, 0x35, 0x80, 0x21, 0x84, 0x44, 0xd0, 0x7a, 0x36, 0xf8, 0x16, 0xed, 0xa2,
-    0x61, 0x7a, 0x07, 0x32, 0x11, 0x8c, 0x36, 0xc0, 0x14, 0x61, 0x84, 0x8a, 0x0c, 0x71, 0xc6, 0x7b,
-    0xaf, 0x71, 0x20, 0x72, 0xf0, 0x84, 0x19, 0x03, 0xe6, 0x08, 0x1f, 0x21, 0x01, 0xd0, 0x7a, 0x61,
-    0x33, 0xa0, 0x4d, 0x41, 0x13, 0x68, 0x51, 0x1c, 0xa4, 0x13, 0x1d, 0xac, 0x09, 0x36, 0x68, 0x2a,
-    0x11, 0x14, 0x8c, 0x24, 0xd7, 0x86, 0x19, 0x82, 0x71, 0xb0, 0xd8, 0xe5, 0x73, 0x67, 0x80, 0x1a,
-    0x31, 0x3a, 0x8c, 0xb7, 0x0d, 0x08, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x07, 0x00, 0x03, 0x00, 0x2c,
-    0x14, 0x00, 0x1a, 0x00, 0x17, 0x00, 0x23, 0x00, 0x00, 0x08, 0xff, 0x00, 0x07, 0x08, 0x1c, 0x48,
-    0xb0, 0xa0, 0xc1, 0x83, 0x02, 0x03, 0x00, 0x68, 0x26, 0xc8, 0x10, 0xa2, 0x28, 0x4a, 0x8a, 0x2c,
-    0x42, 0x38, 0x30, 0x40, 0x00, 0x67, 0x4c, 0x0c, 0xb6, 0xe0, 0xb2, 0x64, 0xe2, 0xc1, 0x00, 0x4d,
-    0xa2, 0x0c, 0x68, 0xe1, 0xc2, 0xd0, 0x12, 0x29, 0x4b, 0x54, 0x08, 0x6c, 0x41, 0x44, 0x98, 0xc1,
-    0x00, 0xc2, 0x98, 0xb4, 0x50, 0x51, 0x48, 0x98, 0xb0, 0x22, 0x4b, 0x52, 0x0e, 0xdc, 0xe8, 0xb2,
-    0xe2, 0x22, 0x22, 0x2d, 0x5a, 0x44, 0x69, 0xf2, 0xc4, 0x05, 0x42, 0x96, 0x1e, 0x2d, 0x1e, 0x1a,
-    0x99, 0xd1, 0x28, 0xc5, 0xa0, 0x82, 0x12, 0x0a, 0xab, 0x21, 0xb4, 0x27, 0xc5, 0x95, 0x35, 0x82,
-    0x0d, 0x08, 0xb0, 0x24, 0xe8, 0x0a, 0x22, 0x57, 0x77, 0xb6, 0x70, 0x66, 0xd1, 0x57, 0xd8, 0x83,
-    0x2d, 0x86, 0x59, 0x84, 0x72, 0x56, 0x23, 0x22, 0x85, 0x2c, 0xda, 0x16, 0x6c, 0x91, 0xc8, 0x62,
-    0x0d, 0xb9, 0x04, 0x5b, 0x00, 0xb3, 0x88, 0x08, 0xef, 0x4e, 0x43, 0x5b, 0x97, 0xfa, 0x0d, 0xba,
-    0x64, 0x2b, 0x21, 0x95, 0x78, 0x67, 0xba, 0xb4, 0x28, 0x32, 0xf1, 0xb0, 0x8a, 0x84, 0x9c, 0x9e,
-    0xe5, 0x49, 0x30, 0x80, 0xe0, 0xb0, 0x24, 0x9b, 0x15, 0x84, 0xd9, 0x03, 0xf3, 0x0a, 0xcd, 0x2f,
-    0x1b, 0x1f, 0x6d, 0x89, 0x30, 0x40, 0xd4, 0xa3, 0x88, 0xb4, 0x52, 0x74, 0x76, 0x94, 0x4b, 0x93,
-    0xb0, 0xac, 0xd1, 0xc6, 0xbe, 0x3a, 0xf5, 0x20, 0x13, 0x00, 0x67, 0x03, 0x34, 0x73, 0xb2, 0x22,
-    0xef, 0xec, 0xdc, 0x00, 0xa8, 0x0c, 0x10, 0x74, 0xe8, 0xf7, 0x55, 0x13, 0x42, 0x4c, 0xf8, 0x25,
-    0x78, 0x84, 0x4d, 0x9b, 0x3b, 0x62, 0x76, 0xf8, 0xd0, 0x11, 0x40, 0xee, 0x8b, 0x01, 0x6c, 0x06,
-    0xb4, 0x19, 0x98, 0xa7, 0xfa, 0xd9, 0x23, 0x02, 0xd7, 0x10, 0x1f, 0x0c, 0x23, 0xd7, 0x8f, 0x99,
-    0x32, 0x68, 0x08, 0xda, 0xc0, 0xfb, 0xa5, 0x0c, 0xc1, 0x3c, 0xb8, 0xf1, 0x1e, 0xa1, 0x33, 0xe0,
-    0xcd, 0x17, 0xe5, 0xcb, 0x07, 0x00, 0xf0, 0x7e, 0x35, 0x20, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03,
-    0x00, 0x03, 0x00, 0x2c, 0x15, 0x00, 0x1b, 0x00, 0x18, 0x00, 0x22, 0x00, 0x00, 0x08, 0xff, 0x00,
-    0x07, 0x08, 0x1c, 0x38, 0x20, 0x40, 0x80, 0x60, 0xcd, 0x96, 0x28, 0x11, 0xe4, 0x8c, 0x0a, 0xc1,
-    0x87, 0x0f, 0x03, 0x08, 0x3b, 0x54, 0xe3, 0xa1, 0x0a, 0x44, 0xce, 0x20, 0x12, 0x34, 0xb8, 0xc4,
-    0x45, 0x8b, 0x16, 0x2b, 0xa2, 0x14, 0x2a, 0xc4, 0x44, 0x60, 0x0b, 0x43, 0x4d, 0x34, 0x06, 0x00,
-    0x30, 0xec, 0x23, 0x13, 0x29, 0x53, 0x84, 0x11, 0x22, 0x24, 0x68, 0x60, 0x0b, 0x22, 0x29, 0x37,
-    0x06, 0x38, 0x34, 0xe0, 0x63, 0x11, 0x29, 0x44, 0x34, 0xf6, 0x44, 0x34, 0x65, 0x63, 0xc6, 0x16,
-    0x4e, 0x98, 0xa8, 0x10, 0x6a, 0xb3, 0xa6, 0xc0, 0x95, 0x4c, 0x3e, 0x52, 0x31, 0xc4, 0xd4, 0xe6,
-    0x8a, 0x9c, 0x01, 0x8a, 0xf4, 0x04, 0x59, 0x95, 0x60, 0x8b, 0x21, 0x4f, 0x79, 0x76, 0x85, 0x78,
-    0xf2, 0x29, 0xa2, 0xb1, 0x64, 0xa1, 0x14, 0x0c, 0x90, 0x08, 0xed, 0xc3, 0x16, 0x2c, 0x00, 0x14,
-    0x04, 0xe6, 0xd6, 0x6b, 0x0d, 0xb9, 0x01, 0xa2, 0xd4, 0xb5, 0x49, 0xb7, 0xa0, 0xd3, 0xbd, 0x2d,
-    0xc4, 0x06, 0x20, 0xb4, 0xb4, 0xee, 0xc7, 0x66, 0x03, 0xf3, 0x02, 0xee, 0xfb, 0x94, 0xb0, 0xdb,
-    0x16, 0x2a, 0x10, 0x6f, 0xd4, 0x3b, 0xf6, 0xa3, 0x58, 0xa3, 0x95, 0x03, 0x0b, 0x25, 0xd4, 0xb5,
-    0x05, 0x97, 0x8c, 0x42, 0x83, 0x55, 0x6d, 0x11, 0x25, 0x67, 0xe8, 0xc2, 0x64, 0x0d, 0x15, 0xad,
-    0x1a, 0x0c, 0xf5, 0x43, 0x26, 0xa2, 0xbb, 0x06, 0xf8, 0xa5, 0x31, 0xb2, 0xdb, 0x60, 0x82, 0x82,
-    0x12, 0xa4, 0x5c, 0x57, 0xe2, 0x80, 0x43, 0x88, 0x0e, 0x99, 0xee, 0xea, 0xe7, 0x85, 0x90, 0xbd,
-    0x0f, 0xc1, 0x0c, 0x60, 0x13, 0x67, 0xc0, 0x91, 0x3e, 0x01, 0xf6, 0x46, 0x12, 0xc8, 0x86, 0x8d,
-    0xc0, 0x39, 0xca, 0xdd, 0x7e, 0xa1, 0x4e, 0x70, 0xba, 0xdb, 0x24, 0x65, 0x06, 0x9c, 0x17, 0x19,
-    0xb8, 0xe6, 0xc4, 0x5e, 0x31, 0x0f, 0xbb, 0x44, 0xaf, 0x0b, 0x60, 0xc7, 0x00, 0x34, 0x74, 0x5e,
-    0xac, 0x47, 0x5e, 0xb0, 0x6e, 0x40, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x04, 0x00, 0x03, 0x00, 0x2c,
-    0x17, 0x00, 0x1b, 0x00, 0x16, 0x00, 0x22, 0x00, 0x00, 0x08, 0xf8, 0x00, 0x07, 0x08, 0x1c, 0x38,
-    0x20, 0x40, 0x93, 0x66, 0xce, 0x86, 0x10, 0x5c, 0xc8, 0x30, 0x40, 0xb3, 0x28, 0x2a, 0x08, 0xb6,
-    0x60, 0xb2, 0x64, 0x11, 0xc3, 0x81, 0xc2, 0xa2, 0x08, 0x6c, 0xb1, 0xc2, 0x49, 0x14, 0x22, 0x2e,
-    0x04, 0x32, 0x69, 0xd6, 0x90, 0x10, 0x97, 0x01, 0x2d, 0x0c, 0x59, 0x99, 0xd2, 0x44, 0xd8, 0x14,
-    0x8d, 0x02, 0x6b, 0x38, 0x5b, 0x28, 0xec, 0xe4, 0x00, 0x2e, 0xc2, 0x04, 0x31, 0x11, 0x18, 0x92,
-    0x60, 0x0d, 0x92, 0x02, 0x01, 0x20, 0x1a, 0xe0, 0xa2, 0x50, 0x8b, 0x88, 0x17, 0x07, 0x32, 0xb1,
-    0x18, 0x60, 0xe6, 0x00, 0x43, 0x84, 0x90, 0x26, 0xdd, 0xb8, 0xa4, 0xe0, 0x50, 0x94, 0x3d, 0xa7,
-    0x2a, 0x1d, 0x20, 0x4c, 0xaa, 0xd6, 0x85, 0x2a, 0x84, 0x59, 0xf9, 0x9a, 0xb4, 0x85, 0x33, 0xa7,
-    0x64, 0x17, 0xb6, 0x18, 0x82, 0x36, 0xed, 0xc0, 0xb5, 0x40, 0xdd, 0xbe, 0x2d, 0xd2, 0xc4, 0xab,
-    0xdb, 0xb0, 0x01, 0xae, 0xca, 0x1d, 0x70, 0xb5, 0x6d, 0x5a, 0xb3, 0x02, 0x03, 0x10, 0x91, 0xdb,
-    0x02, 0x11, 0x80, 0x81, 0x0a, 0xdd, 0xae, 0xa0, 0x42, 0x50, 0x98, 0x5b, 0x2e, 0x71, 0x83, 0xd6,
-    0xf8, 0x5a, 0xd8, 0xf1, 0xc2, 0x00, 0x89, 0xb4, 0xae, 0xf0, 0x3b, 0x30, 0x00, 0x94, 0xa9, 0x5c,
-    0x08, 0x4d, 0xf5, 0x9c, 0xb4, 0x86, 0x68, 0xad, 0x87, 0x2e, 0xb6, 0xa8, 0xfa, 0x15, 0xc0, 0x12,
-    0x27, 0x59, 0x07, 0x30, 0x99, 0x22, 0xb7, 0xc9, 0xcc, 0x44, 0x51, 0x18, 0x7f, 0x3d, 0xf1, 0x05,
-    0x45, 0x89, 0xbd, 0x0b, 0xe1, 0x08, 0xfc, 0x21, 0x57, 0x0c, 0xc3, 0x3b, 0x36, 0xd2, 0x76, 0xb9,
-    0x08, 0x26, 0x6d, 0x10, 0x86, 0x6c, 0xfa, 0xb8, 0x0d, 0xb3, 0xb0, 0x39, 0x70, 0x35, 0xc8, 0x81,
-    0x6b, 0x0f, 0x08, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x03, 0x00, 0x2c, 0x16, 0x00, 0x1b,
-    0x00, 0x17, 0x00, 0x22, 0x00, 0x00, 0x08, 0xff, 0x00, 0x07, 0x08, 0x1c, 0x28, 0x50, 0x98, 0x33,
-    0x41, 0x87, 0x0e, 0x49, 0x11, 0x46, 0xb0, 0x61, 0xc3, 0x66, 0x51, 0x54, 0xb4, 0x20, 0xa8, 0xc2,
-    0x49, 0xb3, 0x00, 0x0e, 0x07, 0x06, 0x1b, 0xa6, 0x42, 0x20, 0x93, 0x27, 0x4a, 0x0a, 0x71, 0x99,
-    0xa8, 0xe2, 0xd0, 0x94, 0x8c, 0x4d, 0x88, 0x4c, 0x8c, 0x42, 0x68, 0x0a, 0x21, 0x2b, 0x84, 0xa2,
-    0x4c, 0x14, 0x18, 0x65, 0x51, 0xc3, 0x29, 0x88, 0x26, 0xae, 0x10, 0x26, 0x68, 0xa4, 0xc0, 0x99,
-    0x03, 0x87, 0x61, 0x1c, 0x78, 0x68, 0xa5, 0x0b, 0x89, 0x19, 0x09, 0x3a, 0x1b, 0x2a, 0xac, 0xc6,
-    0x00, 0x26, 0x55, 0x7c, 0x26, 0x1d, 0x08, 0x6c, 0xa8, 0xa0, 0x99, 0x2b, 0x80, 0x4e, 0x15, 0xd8,
-    0x4c, 0x60, 0xce, 0xad, 0x49, 0x05, 0x05, 0x00, 0xe0, 0x14, 0x6c, 0x46, 0x43, 0x01, 0x82, 0x75,
-    0x34, 0xeb, 0x10, 0x51, 0xda, 0xb5, 0x6c, 0x09, 0x46, 0xc1, 0x08, 0x25, 0x6e, 0xc3, 0x43, 0x18,
-    0x0d, 0x69, 0x8d, 0xbb, 0x74, 0x80, 0xb3, 0xbd, 0x66, 0x5d, 0x30, 0x1c, 0xb0, 0x88, 0x8b, 0x5d,
-    0x81, 0x42, 0x07, 0xfe, 0xb5, 0xbb, 0x73, 0xe8, 0x00, 0x00, 0x4c, 0xe2, 0xaa, 0xe8, 0x4b, 0x50,
-    0x10, 0xdb, 0x1e, 0x94, 0x09, 0x36, 0x03, 0xdc, 0x90, 0x08, 0x21, 0xc7, 0x04, 0x85, 0x71, 0x26,
-    0x6a, 0x33, 0x69, 0x93, 0xd1, 0x03, 0xf0, 0x6e, 0x3d, 0x9d, 0x14, 0x11, 0x00, 0xb3, 0x88, 0x32,
-    0xaa, 0x20, 0xc4, 0xb6, 0xc9, 0x21, 0x26, 0x5a, 0xd1, 0x1e, 0x16, 0x56, 0x64, 0x40, 0x94, 0x43,
-    0xc1, 0xd8, 0xfe, 0x38, 0xe2, 0x07, 0xb4, 0xdd, 0x1d, 0x02, 0xe5, 0x0c, 0x78, 0x21, 0xe4, 0x75,
-    0xdc, 0x2f, 0x0e, 0xe3, 0x40, 0x67, 0x0b, 0x26, 0x63, 0xa4, 0xb8, 0x3e, 0x32, 0xa2, 0xb0, 0x2b,
-    0xa6, 0xe1, 0x98, 0xc3, 0x01, 0x5e, 0x0c, 0x09, 0x40, 0x33, 0x47, 0xfc, 0xe1, 0xf3, 0x02, 0x03,
-    0x02, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x07, 0x00, 0x03, 0x00, 0x2c, 0x15, 0x00, 0x1a, 0x00, 0x17,
-    0x00, 0x23, 0x00, 0x00, 0x08, 0xff, 0x00, 0x07, 0x08, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x83, 0x03,
-    0x00, 0x34, 0x3b, 0x84, 0x28, 0x11, 0x13, 0x43, 0x82, 0x08, 0x05, 0x40, 0x48, 0xd0, 0x19, 0x93,
-    0x16, 0x18, 0x09, 0xaa, 0xf8, 0x25, 0x6c, 0xe2, 0xc1, 0x29, 0xc3, 0x30, 0xba, 0x78, 0x32, 0xc4,
-    0xca, 0x10, 0x8c, 0x2d, 0x06, 0xac, 0x70, 0x16, 0xc0, 0xe3, 0xc0, 0x45, 0x51, 0x30, 0x3e, 0x11,
-    0x26, 0x6c, 0x88, 0x92, 0x27, 0x28, 0x05, 0xaa, 0x60, 0xe9, 0x72, 0x40, 0xc8, 0x16, 0x86, 0xaa,
-    0x14, 0x72, 0x91, 0xd1, 0xa0, 0x0b, 0x89, 0x03, 0x9d, 0x65, 0x74, 0xc1, 0xa5, 0x28, 0x42, 0x22,
-    0x2d, 0x05, 0x5e, 0x64, 0x42, 0x85, 0x68, 0x4a, 0x8a, 0x03, 0x54, 0x14, 0x99, 0xd8, 0x0c, 0x23,
-    0x97, 0x42, 0x03, 0xae, 0x62, 0xf5, 0xd9, 0x52, 0x90, 0xd3, 0xb1, 0x03, 0xa1, 0xb4, 0xfc, 0x89,
-    0xb6, 0xa0, 0x8b, 0x26, 0x01, 0x0c, 0x9d, 0x6d, 0xab, 0xa2, 0x23, 0xdb, 0xb6, 0x03, 0xdf, 0x06,
-    0x30, 0x2b, 0x16, 0xaf, 0xda, 0x00, 0x5d, 0xfb, 0xb6, 0x7d, 0xd2, 0x12, 0x40, 0x53, 0xbc, 0x49,
-    0xa3, 0x2e, 0x99, 0x8b, 0x95, 0x08, 0x00, 0x8f, 0x00, 0x10, 0x09, 0xa6, 0xd8, 0xa3, 0x59, 0x54,
-    0x81, 0x55, 0x27, 0x1b, 0x54, 0xb1, 0xe4, 0xf2, 0xc0, 0x43, 0x9a, 0x09, 0xba, 0xe0, 0x69, 0x70,
-    0x99, 0x0a, 0xac, 0x2b, 0x2c, 0xf7, 0x24, 0x98, 0x88, 0xe2, 0x4e, 0xcf, 0x06, 0x87, 0x51, 0x3c,
-    0xb4, 0xda, 0xa0, 0x12, 0x84, 0x35, 0xe0, 0x8e, 0x55, 0x7a, 0x70, 0x58, 0xed, 0x83, 0x82, 0x0e,
-    0x0f, 0xac, 0x41, 0x08, 0xf1, 0x80, 0x60, 0xc5, 0x97, 0x2c, 0xa1, 0xf2, 0xdb, 0x60, 0x80, 0x2c,
-    0xcd, 0xd1, 0xf2, 0x19, 0x30, 0x47, 0xcf, 0x18, 0x30, 0x36, 0x4e, 0x30, 0xc3, 0x6b, 0x43, 0x60,
-    0x9b, 0x81, 0x6c, 0xe0, 0xe0, 0x21, 0x9d, 0x3e, 0x60, 0x0d, 0xc1, 0x3c, 0x78, 0xb1, 0xa4, 0x31,
-    0xa3, 0x86, 0xe0, 0x0e, 0xc4, 0xef, 0x09, 0xd2, 0xc9, 0x62, 0x3c, 0x48, 0x9d, 0x33, 0x6b, 0xba,
-    0xfc, 0x31, 0x3e, 0xb0, 0x04, 0xde, 0x80, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x03, 0x00,
-    0x2c, 0x13, 0x00, 0x1a, 0x00, 0x18, 0x00, 0x23, 0x00, 0x00, 0x08, 0xff, 0x00, 0x07, 0x08, 0x1c,
-    0x48, 0xb0, 0xa0, 0xc1, 0x83, 0x02, 0x85, 0x2d, 0x89, 0x02, 0xa5, 0x45, 0x0d, 0x44, 0x82, 0x96,
-    0x05, 0x08, 0x80, 0x70, 0xe0, 0x94, 0x43, 0x3d, 0x5a, 0xb4, 0x30, 0xf8, 0x4b, 0xd8, 0x44, 0x84,
-    0xc2, 0x88, 0x68, 0x24, 0xb2, 0xc4, 0x8a, 0x20, 0x8d, 0x1b, 0x07, 0xac, 0x68, 0xf6, 0xb1, 0xa0,
-    0x30, 0x2e, 0x2d, 0x56, 0x0c, 0x99, 0x62, 0x45, 0x89, 0x13, 0x94, 0x03, 0x7b, 0xb0, 0xa4, 0x38,
-    0x70, 0x91, 0x48, 0x2e, 0x84, 0x08, 0x89, 0xd4, 0x78, 0x70, 0x85, 0x47, 0x9e, 0x03, 0x8c, 0x8d,
-    0x94, 0xe2, 0x82, 0x68, 0xc5, 0x61, 0x2d, 0x9b, 0xd4, 0xd8, 0xb8, 0x02, 0x67, 0xc5, 0x01, 0x2a,
-    0x24, 0x52, 0x74, 0xa6, 0x91, 0xd0, 0x13, 0xa7, 0x57, 0x07, 0x08, 0xfa, 0x38, 0x4c, 0xa3, 0x13,
-    0x17, 0x61, 0x09, 0x46, 0xf9, 0x08, 0x0c, 0x6c, 0x5a, 0x81, 0x50, 0x26, 0x06, 0x68, 0x98, 0xf2,
-    0xad, 0x40, 0x18, 0x72, 0xdb, 0xd6, 0xb5, 0x9b, 0x48, 0x6e, 0xd9, 0xbd, 0x6f, 0x0d, 0x7d, 0x1c,
-    0xe2, 0xf6, 0xed, 0x92, 0x8f, 0x4d, 0x32, 0x02, 0xbe, 0xda, 0xe3, 0xa8, 0xc0, 0x43, 0x85, 0xaf,
-    0x1e, 0x92, 0x2b, 0x30, 0x18, 0x93, 0xc8, 0x07, 0xb9, 0x34, 0x69, 0x29, 0x90, 0x50, 0xd5, 0xc5,
-    0x05, 0x57, 0x10, 0xe2, 0x3c, 0xb0, 0x59, 0xc6, 0xab, 0x2a, 0x76, 0x22, 0x3c, 0x09, 0x5a, 0xa0,
-    0x31, 0xd2, 0x05, 0x17, 0xc1, 0x44, 0xc8, 0x25, 0x18, 0x52, 0x84, 0x4a, 0x11, 0x4e, 0x4e, 0x4b,
-    0xa8, 0x35, 0xcb, 0xb4, 0x8b, 0x6a, 0x1c, 0xec, 0x11, 0xcc, 0xae, 0x33, 0x15, 0x7b, 0x55, 0x30,
-    0xba, 0x1d, 0x56, 0x98, 0x95, 0xe7, 0xcf, 0x3d, 0xda, 0x15, 0xc8, 0x7c, 0xba, 0xc0, 0x3f, 0x5f,
-    0xb2, 0x6b, 0xcf, 0x9e, 0xc5, 0x6e, 0x1f, 0x81, 0x6c, 0x08, 0xb2, 0x26, 0xf9, 0xfe, 0xd6, 0x04,
-    0x78, 0xf1, 0x58, 0xec, 0x06, 0xd8, 0xc3, 0x26, 0xfc, 0xc0, 0x3c, 0xd6, 0x85, 0xa8, 0x21, 0x98,
-    0x06, 0x88, 0xf5, 0x01, 0x7d, 0xf6, 0x0c, 0x30, 0xa3, 0xe7, 0xc4, 0xfd, 0x81, 0x00, 0x00, 0x90,
-    0x56, 0x40, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x03, 0x00, 0x2c, 0x10, 0x00, 0x1a, 0x00,
-    0x18, 0x00, 0x23, 0x00, 0x00, 0x08, 0xff, 0x00, 0x07, 0x08, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x83,
-    0x03, 0x83, 0x39, 0x3b, 0x64, 0x08, 0xd1, 0x13, 0x41, 0xcd, 0x00, 0x04, 0x08, 0x80, 0x70, 0xe0,
-    0x22, 0x41, 0x2b, 0x5a, 0xb4, 0x28, 0xc8, 0xc4, 0xd9, 0x44, 0x8a, 0x07, 0x85, 0x11, 0xd1, 0xc8,
-    0xa5, 0xd0, 0x00, 0x8d, 0x1b, 0x05, 0x46, 0x09, 0x36, 0xd1, 0xa0, 0x30, 0x2e, 0x2d, 0x56, 0x2c,
-    0x99, 0x42, 0xc8, 0x10, 0x4a, 0x82, 0x44, 0x9a, 0xb4, 0xb4, 0x38, 0x92, 0x0b, 0x21, 0x42, 0x4e,
-    0x34, 0x22, 0x8c, 0xf2, 0x71, 0xe0, 0xa1, 0x16, 0x2e, 0x08, 0x15, 0x71, 0x21, 0xb4, 0xa2, 0x47,
-    0x90, 0xc2, 0x6a, 0xc4, 0x94, 0x92, 0xb1, 0xe2, 0x40, 0x26, 0x12, 0x29, 0x2e, 0xd1, 0xe8, 0xe2,
-    0x64, 0x4a, 0xab, 0x03, 0x9a, 0xb5, 0x44, 0xd4, 0xc2, 0x10, 0x21, 0xaf, 0x60, 0x05, 0x1a, 0x9b,
-    0x08, 0x40, 0x2a, 0x13, 0x43, 0x69, 0x09, 0x0e, 0x9b, 0x18, 0x4c, 0x45, 0xd3, 0xb8, 0x02, 0x11,
-    0xd1, 0xb5, 0xfb, 0x15, 0xaf, 0xa1, 0x96, 0x50, 0xee, 0xe2, 0x3d, 0xd4, 0xf2, 0x89, 0xe0, 0xb8,
-    0x4f, 0x07, 0x38, 0xbb, 0x89, 0xb7, 0x06, 0x4b, 0x8a, 0x00, 0x98, 0x1c, 0xb6, 0x4a, 0x18, 0x64,
-    0x58, 0xbe, 0x71, 0x99, 0x3c, 0x26, 0x68, 0x8c, 0x71, 0x45, 0x15, 0x62, 0x2d, 0x0f, 0x34, 0x86,
-    0xb9, 0xe2, 0x5c, 0xd1, 0x04, 0x9d, 0xf5, 0xe8, 0x6b, 0x50, 0xac, 0x55, 0x67, 0x76, 0x11, 0x42,
-    0x91, 0x08, 0x76, 0x18, 0xeb, 0x81, 0x7f, 0xd3, 0x36, 0xa9, 0x81, 0x90, 0x70, 0xdc, 0xa3, 0x07,
-    0x87, 0xa0, 0x46, 0x48, 0x88, 0x29, 0x41, 0x15, 0xc3, 0x00, 0xe0, 0x0d, 0x7b, 0xe8, 0xd0, 0x92,
-    0x22, 0x84, 0x58, 0x2e, 0xaf, 0x98, 0x65, 0x79, 0x00, 0x2c, 0x27, 0x6c, 0x80, 0x19, 0xa3, 0x67,
-    0x0e, 0x1b, 0x2f, 0x78, 0x01, 0xbc, 0x2d, 0x21, 0xd8, 0x46, 0xe0, 0x11, 0xbc, 0x01, 0xf4, 0x10,
-    0x5c, 0x23, 0xd0, 0xc6, 0xf2, 0x17, 0x04, 0xd5, 0x98, 0x39, 0xf3, 0x63, 0xf9, 0xa2, 0x3b, 0x04,
-    0xcb, 0x80, 0x99, 0x3e, 0x20, 0x4b, 0xa4, 0x36, 0x67, 0xd4, 0xe1, 0x1e, 0x7f, 0x02, 0x05, 0x50,
-    0x42, 0x45, 0x01, 0x01, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x04, 0x00, 0x03, 0x00, 0x2c, 0x0f, 0x00,
-    0x1b, 0x00, 0x17, 0x00, 0x22, 0x00, 0x00, 0x08, 0xff, 0x00, 0x07, 0x08, 0x1c, 0x28, 0x90, 0x4a,
-    0x11, 0x67, 0xce, 0x9a, 0x05, 0x0b, 0xc0, 0x90, 0xa0, 0x43, 0x81, 0xc1, 0x96, 0x40, 0x69, 0x41,
-    0xb0, 0xc6, 0xb0, 0x66, 0x0d, 0x1f, 0x0a, 0x6c, 0xc6, 0x85, 0xe2, 0x80, 0x16, 0x20, 0x09, 0x0e,
-    0x5b, 0x18, 0xe0, 0xa1, 0xb3, 0x1e, 0x2d, 0xb8, 0x0c, 0xa1, 0xb2, 0x22, 0x24, 0x41, 0x22, 0x4d,
-    0x32, 0x6e, 0x44, 0x19, 0xa5, 0x8a, 0x95, 0x28, 0x1e, 0x1f, 0x22, 0x9a, 0x52, 0x12, 0x62, 0xc7,
-    0x28, 0x53, 0x0a, 0xb9, 0xd4, 0x38, 0xc0, 0x58, 0x46, 0x63, 0x2d, 0x56, 0x08, 0x53, 0x32, 0x94,
-    0x68, 0x0d, 0x61, 0x0c, 0x17, 0xb5, 0x64, 0x32, 0x44, 0x05, 0xd1, 0x87, 0x82, 0x18, 0x36, 0x0b,
-    0xd9, 0xf4, 0xea, 0x00, 0x44, 0x0c, 0x05, 0xa5, 0xa4, 0xe2, 0x22, 0xa7, 0xd7, 0x01, 0x2c, 0x16,
-    0x05, 0x18, 0x96, 0x54, 0xd0, 0xd9, 0x87, 0x50, 0x9f, 0x74, 0x7d, 0xab, 0x02, 0xea, 0xa1, 0xb9,
-    0x67, 0x7b, 0xa8, 0x75, 0x86, 0xd7, 0x2b, 0xd8, 0x00, 0xc2, 0x54, 0x98, 0x7d, 0x3b, 0x20, 0x6b,
-    0x49, 0x43, 0x7d, 0x35, 0x3e, 0xed, 0x49, 0x08, 0xe5, 0xe0, 0xab, 0x87, 0x64, 0x2e, 0x49, 0x5c,
-    0x31, 0xa6, 0x43, 0xa4, 0x94, 0x07, 0x0c, 0xeb, 0xe9, 0xd0, 0x59, 0xcb, 0xc7, 0x04, 0x9d, 0x71,
-    0x76, 0x28, 0xcc, 0x49, 0x62, 0x42, 0xa3, 0x1d, 0x2e, 0xc2, 0x49, 0x54, 0x05, 0x95, 0xb3, 0xc1,
-    0x98, 0x80, 0x56, 0x41, 0xe8, 0xed, 0x56, 0x8d, 0x5c, 0x16, 0x11, 0x66, 0xfd, 0x12, 0x23, 0x61,
-    0x61, 0x88, 0x54, 0x10, 0x39, 0x34, 0x00, 0x2a, 0x61, 0x82, 0x00, 0x1c, 0xfa, 0x39, 0xf2, 0xe3,
-    0x78, 0x00, 0x00, 0x42, 0x5e, 0x88, 0x91, 0xc3, 0x66, 0xc0, 0x0e, 0xc2, 0x01, 0xbe, 0xc4, 0x11,
-    0xd8, 0xa6, 0xfa, 0x80, 0x2e, 0xc7, 0x23, 0x11, 0x1f, 0xf4, 0x2e, 0x9e, 0xb0, 0x10, 0x82, 0x67,
-    0xca, 0x94, 0xf1, 0xe2, 0xbc, 0xfc, 0x40, 0x31, 0xc7, 0x05, 0x06, 0x38, 0x52, 0x07, 0xcd, 0x9c,
-    0x1d, 0xc9, 0xe3, 0x0f, 0x4c, 0x2d, 0x30, 0x20, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x06, 0x00, 0x03,
-    0x00, 0x2c, 0x0e, 0x00, 0x1b, 0x00, 0x17, 0x00, 0x22, 0x00, 0x00, 0x08, 0xff, 0x00, 0x07, 0x08,
-    0x1c, 0x38, 0xb0, 0x09, 0x21, 0x42, 0xc2, 0x02, 0x04, 0x20, 0xc8, 0x90, 0x21, 0x95, 0x43, 0x4c,
-    0x54, 0x0c, 0x84, 0x72, 0x88, 0xd0, 0xc2, 0x86, 0x03, 0x01, 0x1c, 0xea, 0x81, 0x51, 0xe0, 0xb0,
-    0x26, 0x17, 0x19, 0x06, 0x8b, 0xd2, 0x62, 0x80, 0x93, 0x01, 0x2b, 0x4a, 0x32, 0x64, 0x62, 0x91,
-    0x21, 0x00, 0x92, 0x2e, 0x86, 0x4c, 0x19, 0xb2, 0xa2, 0x23, 0x97, 0x84, 0x04, 0x05, 0xb5, 0x70,
-    0x51, 0x84, 0x10, 0x91, 0x8e, 0x03, 0x9d, 0x84, 0x14, 0x56, 0x63, 0x80, 0x20, 0x2a, 0x5c, 0x80,
-    0x12, 0x74, 0x76, 0x51, 0xa7, 0x8b, 0x26, 0x24, 0x95, 0x0e, 0x44, 0x74, 0x31, 0x91, 0xc0, 0xa4,
-    0x52, 0x07, 0xaa, 0x10, 0x36, 0x40, 0x98, 0xc4, 0x27, 0x4c, 0x54, 0x66, 0x1d, 0xc0, 0xb4, 0x59,
-    0x49, 0x42, 0x86, 0xc6, 0x0e, 0x5c, 0x12, 0xa0, 0x48, 0x49, 0x17, 0x6a, 0xd7, 0x06, 0x30, 0x1b,
-    0x77, 0x69, 0x00, 0xaf, 0x75, 0x07, 0x12, 0x12, 0x08, 0x4c, 0xac, 0x5a, 0x28, 0x00, 0x04, 0x0e,
-    0xf1, 0x3b, 0x56, 0xd0, 0xc5, 0x45, 0x61, 0xe3, 0xae, 0x68, 0x42, 0xb0, 0x19, 0x47, 0xb5, 0x87,
-    0x42, 0x0a, 0x74, 0x26, 0x71, 0x6c, 0x33, 0x8c, 0x45, 0xb8, 0x10, 0x6e, 0xa8, 0x82, 0x31, 0xc6,
-    0x26, 0x87, 0x2a, 0x77, 0xac, 0x11, 0x18, 0xa8, 0x33, 0xb8, 0xa3, 0x25, 0x63, 0xa4, 0xdc, 0xb1,
-    0xc7, 0xa2, 0xac, 0x87, 0x3a, 0x52, 0xcd, 0x1a, 0x0c, 0xeb, 0x40, 0x17, 0x51, 0xb8, 0x5a, 0x4e,
-    0x99, 0xd4, 0x99, 0xe7, 0xb8, 0x8b, 0x84, 0x95, 0x1e, 0x50, 0x02, 0xc5, 0x17, 0x21, 0x71, 0x03,
-    0xfc, 0x38, 0x32, 0x00, 0x8e, 0xc0, 0x2f, 0x6a, 0x8f, 0xdc, 0x11, 0xc8, 0x66, 0x60, 0x18, 0xb5,
-    0xd0, 0x1b, 0x8a, 0x51, 0xab, 0x03, 0xa3, 0x8d, 0xb8, 0x3b, 0x18, 0xee, 0x0c, 0x19, 0x3e, 0x36,
-    0x08, 0x9e, 0x4a, 0x74, 0x88, 0xe7, 0x05, 0x1a, 0x10, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x04, 0x00,
-    0x03, 0x00, 0x2c, 0x0e, 0x00, 0x1b, 0x00, 0x17, 0x00, 0x22, 0x00, 0x00, 0x08, 0xff, 0x00, 0x07,
-    0x08, 0x1c, 0x38, 0x90, 0x8a, 0xb3, 0x21, 0x43, 0x8a, 0x08, 0x23, 0xc8, 0x90, 0xe1, 0x94, 0x25,
-    0x89, 0x5a, 0x0c, 0x6c, 0xa1, 0x02, 0x91, 0x33, 0x00, 0x0d, 0x07, 0x06, 0x20, 0x44, 0x44, 0xa0,
-    0x8a, 0x86, 0x2d, 0x88, 0x50, 0xc9, 0x18, 0xa0, 0xd9, 0x8a, 0x01, 0x2b, 0x96, 0x34, 0x31, 0x04,
-    0x72, 0x45, 0x33, 0x86, 0x01, 0x84, 0xad, 0x08, 0x29, 0x8c, 0x90, 0x21, 0x17, 0x19, 0x5b, 0xac,
-    0x58, 0xa8, 0x11, 0x51, 0x0b, 0x26, 0x55, 0x96, 0xe0, 0xcc, 0x28, 0xb0, 0x05, 0x22, 0x8d, 0xce,
-    0x06, 0xb4, 0xb0, 0x22, 0x85, 0x28, 0xc3, 0x16, 0x49, 0x07, 0x04, 0xf0, 0xd9, 0x42, 0xd0, 0x49,
-    0xa7, 0x13, 0x7d, 0x09, 0x14, 0xf6, 0xf1, 0x2a, 0xd6, 0x89, 0x2c, 0x82, 0x05, 0x48, 0xda, 0x82,
-    0x8a, 0x93, 0xaf, 0x04, 0x55, 0x34, 0x0b, 0xb0, 0x44, 0xe9, 0x13, 0xaf, 0x68, 0x5b, 0x14, 0x61,
-    0xab, 0x14, 0xed, 0xd3, 0xb9, 0x51, 0xed, 0x12, 0x6c, 0x41, 0x28, 0xc0, 0x32, 0xbd, 0x0c, 0x6b,
-    0x04, 0x93, 0x9a, 0x08, 0x70, 0xd1, 0x5f, 0x02, 0xe9, 0x1a, 0x56, 0x9b, 0x78, 0x11, 0x13, 0xc0,
-    0x2d, 0x58, 0x6a, 0x6c, 0x36, 0x14, 0xad, 0x0a, 0x42, 0x30, 0x8b, 0xc0, 0x75, 0x7a, 0xb4, 0xe1,
-    0xc6, 0x8e, 0x58, 0x5b, 0xb4, 0x25, 0x39, 0xe5, 0x50, 0xe8, 0x22, 0x58, 0x03, 0x98, 0x26, 0xda,
-    0xe2, 0x25, 0x56, 0x00, 0x9d, 0x41, 0x62, 0xfe, 0x4a, 0xa8, 0x32, 0xc1, 0x15, 0x83, 0xbf, 0x06,
-    0x18, 0xf6, 0x94, 0x89, 0x6b, 0xb4, 0x4d, 0x7e, 0xd5, 0xe8, 0xa8, 0xd0, 0xb0, 0xd4, 0x00, 0x01,
-    0x34, 0xfe, 0x08, 0x82, 0x05, 0x30, 0x80, 0x13, 0x2f, 0x06, 0xcc, 0x11, 0x18, 0xdd, 0x6e, 0x97,
-    0x37, 0x0d, 0x23, 0xe9, 0xed, 0x92, 0xf1, 0x8b, 0x5e, 0x20, 0x19, 0x7d, 0x00, 0x0f, 0x1e, 0xc3,
-    0x50, 0x4c, 0x72, 0xc0, 0x2f, 0xe8, 0xa0, 0x99, 0x8e, 0xd1, 0x38, 0xd1, 0x80, 0x00, 0x21, 0xf9,
-    0x04, 0x05, 0x03, 0x00, 0x03, 0x00, 0x2c, 0x0f, 0x00, 0x1b, 0x00, 0x18, 0x00, 0x22, 0x00, 0x00,
-    0x08, 0xff, 0x00, 0x07, 0x08, 0x1c, 0x28, 0x30, 0x40, 0xb3, 0x43, 0x51, 0x88, 0x20, 0x1a, 0xb6,
-    0x84, 0x0a, 0xc1, 0x87, 0x03, 0x03, 0x18, 0x24, 0x42, 0xb0, 0x85, 0x45, 0x15, 0x51, 0x08, 0x41,
-    0x8c, 0x18, 0xe0, 0xd0, 0x80, 0x16, 0x2e, 0x0c, 0x2d, 0xe1, 0x32, 0xd0, 0xa2, 0x0b, 0x67, 0x1b,
-    0x25, 0x1e, 0xb2, 0xf8, 0x44, 0x98, 0x30, 0x29, 0x24, 0x4b, 0xb6, 0x50, 0xc1, 0xe8, 0xa1, 0x44,
-    0x46, 0x16, 0x05, 0x55, 0x39, 0xe4, 0x62, 0xe3, 0xc5, 0x66, 0x04, 0x03, 0x08, 0x73, 0xd1, 0xe2,
-    0x49, 0x15, 0x27, 0x1b, 0x65, 0x32, 0x59, 0x54, 0x30, 0xc0, 0x30, 0x8b, 0x4e, 0xa2, 0x24, 0xad,
-    0xd8, 0x02, 0xe5, 0x80, 0x00, 0xc1, 0x6a, 0xb4, 0x70, 0x12, 0x73, 0xaa, 0x40, 0x8b, 0x88, 0xae,
-    0x06, 0x70, 0xd6, 0x62, 0x00, 0xa1, 0x27, 0x5e, 0x65, 0xaa, 0x08, 0x26, 0x51, 0x90, 0x45, 0x2e,
-    0x3d, 0xd3, 0x7e, 0x9c, 0x49, 0x48, 0xa5, 0x45, 0xb9, 0x54, 0x9b, 0x49, 0x34, 0x86, 0xf7, 0xa1,
-    0xc5, 0xba, 0x63, 0xfb, 0x56, 0x5c, 0x2b, 0x51, 0xa3, 0xe0, 0xb9, 0x61, 0xc5, 0x02, 0x3b, 0x6c,
-    0x71, 0x49, 0x53, 0xab, 0x78, 0xdf, 0x06, 0x6b, 0x1a, 0x40, 0x6a, 0xe4, 0xaa, 0x41, 0x03, 0x34,
-    0x61, 0x22, 0xd7, 0xe2, 0x30, 0x88, 0x12, 0x85, 0x51, 0xf4, 0xda, 0x82, 0xcb, 0x64, 0xd0, 0x58,
-    0x13, 0x27, 0x6d, 0x21, 0x68, 0xaa, 0xc4, 0x26, 0x5d, 0x21, 0xb6, 0x70, 0xe8, 0x35, 0x70, 0x52,
-    0x28, 0x72, 0x25, 0x72, 0xde, 0x68, 0x39, 0x6d, 0x00, 0xc7, 0xb2, 0x3d, 0xe2, 0x15, 0x16, 0xfb,
-    0x23, 0xa2, 0x26, 0x7d, 0x85, 0x0a, 0x12, 0x34, 0xc4, 0x2c, 0xf2, 0xc3, 0x29, 0x25, 0x0a, 0xee,
-    0xe3, 0xe5, 0x08, 0x98, 0x31, 0x61, 0xee, 0xc0, 0x01, 0xd2, 0x37, 0x0b, 0x1b, 0x36, 0x03, 0xdb,
-    0xb4, 0x24, 0x19, 0x10, 0x44, 0xf0, 0x9d, 0x8d, 0x5e, 0x04, 0x83, 0x21, 0x58, 0xe9, 0x8c, 0x9a,
-    0x3f, 0x82, 0xff, 0xd0, 0x79, 0xf8, 0x02, 0x3a, 0xb3, 0x31, 0x6b, 0xce, 0xd8, 0x09, 0x12, 0x00,
-    0xfa, 0xc0, 0x12, 0x49, 0x05, 0x04, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x03, 0x00, 0x2c,
-    0x11, 0x00, 0x1a, 0x00, 0x18, 0x00, 0x23, 0x00, 0x00, 0x08, 0xff, 0x00, 0x07, 0x08, 0x1c, 0x48,
-    0xb0, 0xa0, 0xc1, 0x83, 0x03, 0x03, 0x04, 0x73, 0x66, 0x08, 0x8a, 0x8a, 0x1a, 0xc0, 0x0e, 0x35,
-    0x43, 0x48, 0x30, 0x40, 0x00, 0x67, 0x5c, 0x0a, 0xb6, 0xd8, 0x48, 0x64, 0x22, 0x42, 0x85, 0x86,
-    0x36, 0x72, 0x51, 0x52, 0xc4, 0x8a, 0x0b, 0x81, 0x1b, 0x55, 0x18, 0x3b, 0x18, 0x60, 0x8a, 0x93,
-    0x16, 0x2a, 0x94, 0x54, 0x21, 0x24, 0xc8, 0x10, 0xc1, 0x8d, 0x2d, 0x56, 0x56, 0x0c, 0x30, 0x6c,
-    0xe3, 0x10, 0x61, 0x36, 0x0f, 0xa6, 0x74, 0x96, 0x30, 0x40, 0x33, 0x15, 0x3e, 0x99, 0x50, 0x1c,
-    0x20, 0x72, 0x91, 0x40, 0x8b, 0x88, 0x5a, 0x70, 0x21, 0xb2, 0x74, 0xe0, 0x46, 0xa2, 0x16, 0x09,
-    0x6d, 0x5c, 0x22, 0xa5, 0x2a, 0xca, 0x16, 0x88, 0x06, 0x58, 0x5c, 0x22, 0x72, 0x85, 0x57, 0xa6,
-    0x2d, 0x7a, 0x2c, 0xb2, 0x78, 0x68, 0xe3, 0xd9, 0xaf, 0x2a, 0x84, 0x59, 0x1c, 0xf6, 0xf6, 0xa6,
-    0x0a, 0x42, 0x6c, 0xeb, 0x5a, 0x8d, 0x6b, 0x71, 0x88, 0x5e, 0xb4, 0x35, 0x4a, 0x64, 0xfd, 0xbb,
-    0x31, 0xa8, 0x45, 0xaa, 0x75, 0xaf, 0x3e, 0xbd, 0x98, 0xb8, 0x05, 0x11, 0x00, 0x45, 0x83, 0x7a,
-    0x4d, 0xeb, 0x71, 0x71, 0x30, 0xc4, 0x4b, 0x61, 0x12, 0x2d, 0x68, 0x51, 0x58, 0x46, 0x8a, 0x5b,
-    0x3f, 0x32, 0x06, 0x2d, 0x99, 0x65, 0x80, 0xb0, 0x08, 0x7b, 0x08, 0xab, 0x1a, 0xc0, 0xaf, 0x50,
-    0xba, 0x5e, 0x85, 0xa9, 0x10, 0xba, 0xb9, 0x2a, 0x00, 0x28, 0x07, 0xe3, 0x9e, 0xbd, 0x58, 0xa3,
-    0xa0, 0xca, 0xba, 0x01, 0x9a, 0x10, 0xb2, 0x42, 0xdc, 0xca, 0xb2, 0xbf, 0xc8, 0x0b, 0x62, 0x19,
-    0xd3, 0xa5, 0x4b, 0xa4, 0x2f, 0xd0, 0xc1, 0x98, 0x78, 0x2b, 0xa4, 0x20, 0x1b, 0x36, 0x03, 0xfc,
-    0xbc, 0xfd, 0x83, 0xdd, 0xe0, 0x9f, 0xba, 0x7a, 0xd6, 0x0c, 0x18, 0xbc, 0xbe, 0x27, 0x40, 0x5d,
-    0x20, 0x69, 0x08, 0xaa, 0x39, 0xf1, 0xf7, 0x84, 0x9e, 0x33, 0x03, 0xf6, 0x54, 0x4f, 0x0e, 0x00,
-    0x32, 0xc5, 0x80, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x07, 0x00, 0x03, 0x00, 0x2c, 0x13, 0x00, 0x1a,
-    0x00, 0x17, 0x00, 0x23, 0x00, 0x00, 0x08, 0xff, 0x00, 0x07, 0x08, 0x1c, 0x48, 0xb0, 0xa0, 0xc1,
-    0x83, 0x03, 0x02, 0x04, 0x73, 0x66, 0x08, 0xca, 0x80, 0x15, 0x88, 0x0e, 0x35, 0x43, 0x48, 0x10,
-    0xc0, 0x92, 0x15, 0x07, 0x5b, 0x20, 0x22, 0x84, 0x30, 0x40, 0x93, 0x28, 0x03, 0x5a, 0x70, 0x51,
-    0x52, 0x84, 0x10, 0x48, 0x81, 0x2d, 0x5c, 0x38, 0x33, 0xe8, 0x91, 0x48, 0x4a, 0x41, 0x53, 0x08,
-    0x09, 0x2a, 0xc4, 0xa5, 0xa0, 0x8a, 0x95, 0x04, 0x03, 0x80, 0x6c, 0x31, 0x44, 0xd8, 0xc9, 0x8c,
-    0x2e, 0x38, 0x0a, 0x0c, 0x80, 0xb3, 0x45, 0x94, 0x9a, 0x14, 0x43, 0x22, 0x1a, 0xb8, 0x88, 0x4b,
-    0x0b, 0x27, 0x4a, 0x92, 0x12, 0x54, 0x31, 0x31, 0xc0, 0xc4, 0x16, 0x87, 0x04, 0x49, 0x1d, 0xd8,
-    0x62, 0x58, 0xc2, 0x43, 0x21, 0x5b, 0x6c, 0xe5, 0xea, 0x30, 0xc0, 0xaf, 0xb1, 0x05, 0x53, 0x06,
-    0x0b, 0xb0, 0x14, 0x2d, 0x57, 0x17, 0x4d, 0xcc, 0xba, 0xe5, 0xda, 0x63, 0x2d, 0xd8, 0xb9, 0x21,
-    0x13, 0x25, 0x2c, 0x82, 0x37, 0xe4, 0xdd, 0xa6, 0x78, 0x5b, 0x4c, 0x4c, 0xb8, 0x64, 0xae, 0xd1,
-    0x8a, 0x6d, 0xb7, 0xb6, 0x58, 0x41, 0x25, 0xa7, 0x30, 0xa4, 0x49, 0x5b, 0xf4, 0xc0, 0x99, 0x93,
-    0x32, 0xc5, 0x1a, 0x7c, 0x0f, 0xb2, 0x4d, 0x7a, 0x33, 0xa9, 0xe5, 0xb4, 0x77, 0x29, 0x36, 0x71,
-    0x81, 0xb0, 0x86, 0x30, 0xa9, 0x01, 0xf4, 0x1e, 0xf4, 0x8a, 0x9a, 0x75, 0xda, 0xcf, 0x08, 0x85,
-    0x25, 0x46, 0x89, 0x68, 0x11, 0x5a, 0x8f, 0x54, 0x38, 0x4a, 0x29, 0x32, 0xa5, 0xaf, 0x6f, 0x21,
-    0x78, 0xf6, 0x88, 0xe9, 0x32, 0x60, 0x87, 0x0d, 0x2f, 0x01, 0xc6, 0xfa, 0x68, 0xc3, 0xbc, 0xe0,
-    0x9f, 0xb1, 0x42, 0x0e, 0xc6, 0x49, 0xbe, 0x15, 0x40, 0x1c, 0x35, 0x6b, 0x08, 0x8e, 0x71, 0xcb,
-    0xc7, 0x0c, 0x41, 0x37, 0x3f, 0xe6, 0xfa, 0x0b, 0xc0, 0x33, 0x20, 0x4d, 0x18, 0x5c, 0xbe, 0x4b,
-    0x6c, 0x0d, 0x08, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x03, 0x00, 0x2c, 0x13, 0x00, 0x1a,
-    0x00, 0x17, 0x00, 0x23, 0x00, 0x00, 0x08, 0xdf, 0x00, 0x07, 0x08, 0x1c, 0x48, 0xb0, 0xa0, 0xc1,
-    0x83, 0x02, 0x9b, 0x2c, 0x89, 0x32, 0x80, 0x85, 0x40, 0x41, 0x84, 0x10, 0x12, 0x5c, 0x64, 0xac,
-    0xc6, 0x41, 0x15, 0xbf, 0x84, 0x49, 0x14, 0x46, 0x44, 0x20, 0x13, 0x41, 0x56, 0x06, 0x30, 0x21,
-    0xb8, 0xa2, 0xc8, 0x41, 0x61, 0x5c, 0x06, 0xac, 0x58, 0x32, 0x20, 0xe4, 0x13, 0x17, 0x05, 0x5d,
-    0x98, 0x24, 0x38, 0xa5, 0x63, 0x4b, 0x42, 0x36, 0x11, 0xae, 0xd0, 0x38, 0xd0, 0xd8, 0xc0, 0x27,
-    0x2b, 0x24, 0x0e, 0xfc, 0x35, 0xb0, 0x89, 0x45, 0x43, 0x4f, 0x84, 0x16, 0x5c, 0x26, 0x70, 0x88,
-    0xc0, 0x25, 0x85, 0x94, 0x12, 0x14, 0x24, 0x30, 0xa9, 0x54, 0x83, 0x88, 0x04, 0x02, 0xbb, 0x6a,
-    0x10, 0x4a, 0x80, 0x01, 0x50, 0xb8, 0x16, 0xac, 0x01, 0x60, 0xc0, 0x56, 0xb1, 0x03, 0xbd, 0x0e,
-    0x18, 0x86, 0x76, 0x20, 0xc3, 0x01, 0x4e, 0xdb, 0x0e, 0x60, 0x39, 0xc0, 0x68, 0xdb, 0x1e, 0x3c,
-    0x07, 0x1c, 0x6a, 0xcb, 0x76, 0x60, 0xb0, 0x91, 0x5c, 0xb9, 0x34, 0x29, 0x48, 0x28, 0xa8, 0xd4,
-    0x15, 0x11, 0xe5, 0xaa, 0x6c, 0x26, 0x31, 0xe7, 0x41, 0x17, 0x8c, 0x15, 0x5f, 0x15, 0xa6, 0x42,
-    0x67, 0x30, 0xa9, 0x61, 0x0f, 0xee, 0x95, 0x3c, 0x20, 0xb2, 0x54, 0xc7, 0x02, 0x9d, 0x94, 0xe5,
-    0x9a, 0xb7, 0x48, 0xb3, 0xd1, 0x9c, 0xb9, 0xf6, 0xd1, 0x53, 0xf0, 0x48, 0x10, 0xae, 0x28, 0x10,
-    0x62, 0xb9, 0xda, 0xe7, 0x20, 0x1c, 0xd4, 0x4a, 0xe5, 0xa4, 0xf6, 0x72, 0xa6, 0x20, 0x2e, 0xc5,
-    0x68, 0x06, 0xf8, 0x49, 0x2d, 0x34, 0x20, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x04, 0x00, 0x03, 0x00,
-    0x2c, 0x13, 0x00, 0x1a, 0x00, 0x17, 0x00, 0x23, 0x00, 0x00, 0x08, 0xf6, 0x00, 0x07, 0x08, 0x1c,
-    0x48, 0xb0, 0xa0, 0xc1, 0x83, 0x02, 0x09, 0x1d, 0x42, 0x54, 0xc3, 0x05, 0x14, 0x43, 0x4b, 0x9a,
-    0x20, 0x24, 0x28, 0xec, 0x57, 0x8b, 0x83, 0x35, 0x0e, 0x05, 0x9b, 0xe8, 0x6c, 0x85, 0xc0, 0x28,
-    0x43, 0x06, 0x0c, 0xb9, 0x38, 0x90, 0x88, 0xb0, 0x83, 0xce, 0x7a, 0x0c, 0x60, 0x62, 0xa5, 0x8a,
-    0x94, 0x42, 0x4e, 0x48, 0x0e, 0xe4, 0x72, 0x92, 0x20, 0xa1, 0x1a, 0x03, 0x88, 0xb8, 0xe4, 0x32,
-    0x71, 0x00, 0x22, 0x00, 0x04, 0x11, 0x09, 0x64, 0x52, 0x48, 0xe6, 0xc4, 0x90, 0x02, 0x8b, 0x5c,
-    0x2c, 0xc4, 0xb3, 0xe7, 0x40, 0x26, 0x40, 0x07, 0x18, 0x1a, 0xe0, 0x82, 0x0a, 0x13, 0xa7, 0x04,
-    0x9b, 0x0d, 0x00, 0x80, 0x13, 0xab, 0xc1, 0x25, 0x03, 0x84, 0x19, 0xf5, 0x2a, 0xf0, 0xd0, 0x80,
-    0x65, 0x63, 0xc9, 0x0e, 0x0b, 0x20, 0x96, 0x6c, 0x41, 0xb3, 0x5c, 0xdd, 0x12, 0x04, 0x2b, 0x55,
-    0xee, 0x40, 0x42, 0x02, 0x9d, 0xa5, 0x75, 0x0a, 0x2c, 0x80, 0x40, 0x00, 0x44, 0xe4, 0xaa, 0x70,
-    0x96, 0x55, 0x25, 0x59, 0x43, 0x7e, 0x09, 0xea, 0xf5, 0x4a, 0x64, 0xa3, 0xc1, 0x61, 0x58, 0x89,
-    0x48, 0x3c, 0xd8, 0xc4, 0xe3, 0x44, 0x9a, 0x3d, 0xcd, 0x72, 0x74, 0x4a, 0x68, 0xef, 0xca, 0xa8,
-    0x13, 0x17, 0x75, 0x35, 0x28, 0xc8, 0xab, 0x50, 0xbb, 0x36, 0x9b, 0x12, 0x44, 0x4c, 0x16, 0x00,
-    0x15, 0x42, 0x56, 0x06, 0x26, 0x46, 0x6d, 0xd7, 0x4f, 0x18, 0x31, 0x63, 0x04, 0x82, 0x79, 0x71,
-    0x04, 0x74, 0x4f, 0x20, 0x08, 0x75, 0x78, 0xc5, 0xb5, 0xc6, 0xa0, 0x9b, 0x12, 0x5e, 0x03, 0xd4,
-    0x29, 0x4e, 0x30, 0x8c, 0x5b, 0x1f, 0x05, 0xd9, 0xf4, 0x91, 0x8b, 0x82, 0xe0, 0x74, 0xda, 0x58,
-    0x03, 0x02, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x03, 0x00, 0x2c, 0x13, 0x00, 0x1a, 0x00,
-    0x16, 0x00, 0x23, 0x00, 0x00, 0x08, 0xf8, 0x00, 0x07, 0x08, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x83,
-    0x00, 0x9c, 0x0d, 0x4b, 0xc4, 0x62, 0x40, 0xa2, 0x61, 0xce, 0x00, 0x1c, 0x24, 0xe8, 0x8c, 0xc9,
-    0x44, 0x26, 0xce, 0x02, 0x4c, 0x3c, 0xd4, 0x62, 0xc0, 0x8a, 0x42, 0x45, 0x08, 0x11, 0x29, 0x78,
-    0x48, 0x62, 0xc1, 0x61, 0x1d, 0x9f, 0x34, 0xa1, 0xb2, 0xc4, 0xa3, 0xc1, 0x61, 0x1a, 0x07, 0x1a,
-    0xeb, 0xa8, 0x64, 0x40, 0x21, 0x15, 0x13, 0x05, 0x2e, 0x89, 0x49, 0xc5, 0x85, 0x40, 0x25, 0x4e,
-    0x72, 0x0e, 0xac, 0x21, 0x4c, 0xe0, 0x30, 0x8f, 0x86, 0x3a, 0x0a, 0x1d, 0x78, 0x28, 0x40, 0xb0,
-    0x1a, 0x36, 0x09, 0x29, 0x5d, 0x3a, 0x00, 0x4a, 0x80, 0x66, 0x1d, 0x5d, 0xac, 0xa0, 0x4a, 0x90,
-    0x25, 0xd7, 0x83, 0xcd, 0x18, 0x7d, 0x35, 0x58, 0x64, 0xc8, 0xd8, 0x82, 0xcd, 0xb0, 0x9e, 0x15,
-    0xa8, 0x42, 0x58, 0xb0, 0x1e, 0x6b, 0x07, 0x30, 0xd1, 0x78, 0x74, 0xad, 0x20, 0x81, 0x84, 0xe0,
-    0x8e, 0x5d, 0xd1, 0x84, 0xe9, 0x54, 0xaa, 0xce, 0x08, 0x02, 0x30, 0xf4, 0xb5, 0x69, 0xc1, 0x60,
-    0x23, 0x97, 0x1a, 0x36, 0xd8, 0x0c, 0x67, 0x4e, 0x44, 0x26, 0x0f, 0x46, 0xc9, 0xa9, 0x82, 0x90,
-    0xd0, 0xc0, 0x13, 0xa3, 0xc4, 0x9c, 0xd8, 0xc4, 0xb1, 0x41, 0xcc, 0x42, 0x13, 0x1d, 0x6c, 0x4b,
-    0xb5, 0xd9, 0x56, 0x82, 0x2a, 0x0e, 0x7d, 0x0d, 0x66, 0x59, 0xa0, 0x95, 0xd6, 0x71, 0xcf, 0xea,
-    0x10, 0x33, 0xa6, 0x4b, 0xa4, 0x01, 0x5f, 0xc0, 0xec, 0x58, 0x44, 0xf5, 0xc4, 0x00, 0x36, 0x6c,
-    0x0a, 0xfa, 0xa1, 0x8a, 0x25, 0x78, 0xc1, 0x36, 0x59, 0xb8, 0xe6, 0xf9, 0x1d, 0x1b, 0x48, 0x1a,
-    0x82, 0x6a, 0x84, 0x8c, 0x3d, 0xa1, 0x67, 0xc0, 0x99, 0x3d, 0xd2, 0x63, 0x0b, 0x0d, 0x08, 0x00,
-    0x21, 0xf9, 0x04, 0x05, 0x07, 0x00, 0x03, 0x00, 0x2c, 0x13, 0x00, 0x1a, 0x00, 0x16, 0x00, 0x23,
-    0x00, 0x00, 0x08, 0xf8, 0x00, 0x07, 0x08, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x83, 0x4d, 0x86, 0xfc,
-    0x82, 0xa2, 0xa2, 0x06, 0xa2, 0x43, 0xcd, 0x02, 0x1c, 0x1c, 0x08, 0x40, 0x50, 0x8d, 0x89, 0x88,
-    0x08, 0x4d, 0x6c, 0x82, 0x48, 0x20, 0x13, 0x41, 0x56, 0xa4, 0xb4, 0x20, 0xe8, 0xc2, 0x99, 0x44,
-    0x82, 0x4d, 0x88, 0x0c, 0x70, 0xb1, 0x64, 0x8a, 0x15, 0x41, 0x51, 0x46, 0x12, 0x54, 0xe1, 0xac,
-    0x60, 0x94, 0x95, 0x56, 0xa8, 0x38, 0x91, 0x79, 0xd0, 0x85, 0x46, 0x81, 0xce, 0x46, 0x72, 0x91,
-    0xc2, 0x65, 0x22, 0x41, 0x44, 0x12, 0x17, 0x15, 0x65, 0x52, 0xd4, 0xe8, 0xcc, 0x66, 0x03, 0x8a,
-    0x8c, 0x2c, 0x22, 0xc8, 0x69, 0xc1, 0x43, 0x03, 0xb0, 0x0e, 0x60, 0x62, 0xb5, 0x60, 0xa2, 0x00,
-    0x37, 0xbb, 0x1a, 0x54, 0xb1, 0xa8, 0xa3, 0xd8, 0x82, 0x2a, 0x82, 0x85, 0x3d, 0x3b, 0x90, 0xac,
-    0x56, 0xb6, 0x02, 0x81, 0x05, 0x90, 0x0a, 0x57, 0x20, 0x56, 0xa5, 0x75, 0x55, 0x40, 0x1d, 0xb0,
-    0x84, 0xa7, 0xd8, 0x28, 0x27, 0x01, 0x98, 0x15, 0xbb, 0x42, 0x18, 0x41, 0x61, 0x5c, 0xbb, 0xba,
-    0xd8, 0x4b, 0x90, 0xd0, 0x0a, 0xab, 0x34, 0x27, 0xf6, 0x75, 0x7a, 0xe8, 0xa4, 0x41, 0x00, 0x89,
-    0x0f, 0xd6, 0x68, 0xe2, 0x74, 0x89, 0xd1, 0xb7, 0x13, 0x7f, 0x1e, 0x64, 0x3c, 0x11, 0xc0, 0x63,
-    0x83, 0x3d, 0x38, 0x5b, 0x75, 0xd6, 0xc3, 0xa0, 0xb1, 0xb3, 0x4d, 0xac, 0x58, 0x19, 0x68, 0xb8,
-    0xae, 0xed, 0x3f, 0x91, 0x72, 0x0f, 0xfc, 0xf2, 0x25, 0x4b, 0x57, 0x21, 0x6c, 0x6c, 0x0b, 0xf4,
-    0x6d, 0x90, 0x0d, 0x33, 0xb1, 0x7b, 0x82, 0x13, 0xd4, 0x73, 0xf6, 0x84, 0x1a, 0x82, 0x69, 0x80,
-    0xb0, 0x15, 0xb2, 0x47, 0xa0, 0x9e, 0x13, 0xb6, 0x01, 0x58, 0x0d, 0x08, 0x00, 0x21, 0xf9, 0x04,
-    0x05, 0x35, 0x00, 0x03, 0x00, 0x2c, 0x13, 0x00, 0x1a, 0x00, 0x16, 0x00, 0x23, 0x00, 0x00, 0x08,
-    0xd2, 0x00, 0x07, 0x08, 0x1c, 0x48, 0xb0, 0xa0, 0xc1, 0x83, 0xc2, 0x96, 0x44, 0x19, 0xd0, 0x42,
-    0xa0, 0xa0, 0x65, 0x07, 0x09, 0x4e, 0x39, 0xd4, 0x23, 0xe2, 0x2f, 0x61, 0x11, 0x85, 0x11, 0x11,
-    0x48, 0x64, 0xc9, 0x00, 0x41, 0x05, 0x57, 0x34, 0x33, 0x28, 0x8c, 0xcb, 0x80, 0x15, 0x43, 0x04,
-    0x2a, 0x71, 0x62, 0xb0, 0xc7, 0xc8, 0x81, 0x8b, 0x36, 0x72, 0x21, 0x44, 0x68, 0x63, 0xc4, 0x93,
-    0x18, 0x05, 0x1a, 0xe3, 0x38, 0xc0, 0xc5, 0xcd, 0x81, 0xc3, 0x04, 0x36, 0xa9, 0x21, 0x70, 0xc5,
-    0xcf, 0x82, 0x10, 0x9d, 0x09, 0x24, 0xf4, 0xe4, 0x28, 0x41, 0x90, 0x41, 0x07, 0x38, 0xf1, 0xe9,
-    0x54, 0xe0, 0x42, 0x60, 0x55, 0x0d, 0x42, 0x09, 0x00, 0x25, 0x6b, 0x41, 0x18, 0x01, 0xb0, 0x7a,
-    0x1d, 0x98, 0x28, 0x40, 0xd4, 0xb1, 0x03, 0x0c, 0x0d, 0x48, 0x89, 0x76, 0x80, 0xc7, 0x26, 0x15,
-    0xc7, 0xf6, 0xc8, 0x79, 0x08, 0x6d, 0x5d, 0x81, 0xc1, 0x98, 0x78, 0xe5, 0xd2, 0x84, 0x20, 0x21,
-    0xa3, 0x4e, 0x57, 0x10, 0x32, 0xd8, 0x2c, 0xee, 0xcf, 0x97, 0x06, 0x41, 0xfe, 0xdc, 0x19, 0x71,
-    0x91, 0xc9, 0x88, 0x5c, 0x82, 0x2d, 0x6e, 0x4b, 0xb0, 0x21, 0xe5, 0x45, 0x44, 0x0f, 0x4a, 0x76,
-    0xaa, 0xc2, 0x20, 0xa3, 0xac, 0x39, 0x29, 0x8b, 0x16, 0xf8, 0xa5, 0xf4, 0x17, 0xb4, 0x7d, 0x22,
-    0xa6, 0x3e, 0x6a, 0x22, 0x22, 0x16, 0xd1, 0x79, 0xb2, 0x0a, 0x19, 0x3d, 0x60, 0xb5, 0x19, 0xda,
-    0x3f, 0x03, 0x02, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x00, 0x00, 0x2c, 0x1a, 0x00, 0x1b,
-    0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x02, 0x02, 0x04, 0x0a, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x04,
-    0x00, 0x04, 0x00, 0x2c, 0x16, 0x00, 0x1a, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x00, 0x08, 0x23, 0x00,
-    0x09, 0x08, 0x1c, 0x48, 0xb0, 0x20, 0x05, 0x05, 0xef, 0xda, 0x99, 0xb3, 0x77, 0x8e, 0x0f, 0x2e,
-    0x02, 0x19, 0x1e, 0xa0, 0xb3, 0xf7, 0x45, 0x8b, 0x0a, 0x82, 0xbd, 0xc0, 0x50, 0xa2, 0x51, 0x70,
-    0x60, 0x40, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x06, 0x00, 0x03, 0x00, 0x2c, 0x15, 0x00, 0x1b, 0x00,
-    0x10, 0x00, 0x04, 0x00, 0x00, 0x08, 0x32, 0x00, 0x07, 0x08, 0x1c, 0x28, 0x30, 0x9d, 0xba, 0x78,
-    0x1b, 0x22, 0x10, 0x1c, 0xa8, 0x2e, 0x9d, 0xc3, 0x74, 0xe8, 0xe8, 0xe9, 0xa3, 0xe7, 0x81, 0x81,
-    0xc0, 0x08, 0xee, 0x1c, 0xba, 0xc3, 0x30, 0xa2, 0x11, 0x8c, 0x81, 0x30, 0x4a, 0x0d, 0xc0, 0x82,
-    0xcf, 0x1e, 0x3e, 0x6e, 0x00, 0x16, 0x2e, 0x0c, 0x08, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x04, 0x00,
-    0x04, 0x00, 0x2c, 0x14, 0x00, 0x1c, 0x00, 0x12, 0x00, 0x04, 0x00, 0x00, 0x08, 0x38, 0x00, 0x09,
-    0x08, 0x1c, 0x48, 0x30, 0x9d, 0xc1, 0x74, 0xef, 0x08, 0x2a, 0x1c, 0x88, 0xc1, 0x20, 0x3a, 0x74,
-    0xea, 0xda, 0x35, 0x10, 0x18, 0x01, 0x5e, 0x3a, 0x75, 0x08, 0x32, 0x34, 0xc0, 0x00, 0xe6, 0xd9,
-    0x16, 0x19, 0x30, 0x68, 0x98, 0xfa, 0xd2, 0x87, 0x00, 0x3e, 0x76, 0xed, 0x06, 0xe0, 0x02, 0xe3,
-    0xa9, 0xc6, 0xc2, 0x81, 0x01, 0x01, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x02, 0x00, 0x2c,
-    0x14, 0x00, 0x1d, 0x00, 0x13, 0x00, 0x05, 0x00, 0x00, 0x08, 0x3e, 0x00, 0x05, 0x08, 0x1c, 0x48,
-    0x50, 0x60, 0xba, 0x83, 0x05, 0x13, 0x0a, 0x78, 0x10, 0xef, 0xa0, 0xc3, 0x74, 0xea, 0x1a, 0x08,
-    0xc8, 0xe0, 0x2e, 0x9d, 0xc0, 0x11, 0x15, 0x21, 0xda, 0x8b, 0x74, 0xc5, 0x93, 0x27, 0x4a, 0x5f,
-    0xf0, 0x19, 0x99, 0x66, 0x4e, 0x5d, 0x3c, 0x12, 0xea, 0xd8, 0xd9, 0x7b, 0xa6, 0x45, 0x21, 0x41,
-    0x5d, 0xa6, 0x4c, 0x69, 0x61, 0xe1, 0x92, 0x60, 0x40, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00,
-    0x00, 0x00, 0x2c, 0x13, 0x00, 0x1f, 0x00, 0x15, 0x00, 0x04, 0x00, 0x00, 0x08, 0x39, 0x00, 0x01,
-    0x08, 0x1c, 0x48, 0x30, 0x9d, 0xc1, 0x83, 0x06, 0xdb, 0x31, 0x10, 0xb8, 0xc1, 0xe0, 0x40, 0x84,
-    0xe9, 0xd0, 0xd9, 0xfb, 0x42, 0xf1, 0x8b, 0x3d, 0x0f, 0x00, 0x82, 0x7d, 0x31, 0xe7, 0x4e, 0x1d,
-    0x42, 0x73, 0xdb, 0x28, 0xc1, 0x20, 0x28, 0xb0, 0xc6, 0x40, 0x15, 0xcb, 0x88, 0x3d, 0x7b, 0x46,
-    0x49, 0x96, 0x0a, 0x92, 0x30, 0x03, 0x02, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x07, 0x00, 0x01, 0x00,
-    0x2c, 0x13, 0x00, 0x20, 0x00, 0x15, 0x00, 0x04, 0x00, 0x00, 0x08, 0x39, 0x00, 0x03, 0x08, 0x1c,
-    0x48, 0x50, 0x60, 0xba, 0x83, 0x08, 0xd3, 0x09, 0xa4, 0xa0, 0x4e, 0x61, 0xc1, 0x84, 0xe9, 0xd8,
-    0xd9, 0x9b, 0xa8, 0x0f, 0x5d, 0x84, 0x55, 0xdb, 0xcc, 0x45, 0xf0, 0x00, 0x51, 0x9d, 0xbd, 0x2f,
-    0xa6, 0x6a, 0x10, 0x94, 0x11, 0x4b, 0x20, 0x0b, 0x5f, 0x5f, 0xb6, 0xe1, 0xc3, 0x17, 0xe9, 0x19,
-    0x92, 0x82, 0x05, 0x03, 0x02, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x00, 0x00, 0x2c, 0x13,
-    0x00, 0x21, 0x00, 0x15, 0x00, 0x04, 0x00, 0x00, 0x08, 0x3b, 0x00, 0x01, 0x08, 0x1c, 0x48, 0x90,
-    0x60, 0xba, 0x83, 0x08, 0x01, 0x20, 0x38, 0x58, 0x50, 0x20, 0x42, 0x84, 0xea, 0xd8, 0xa1, 0x4b,
-    0x87, 0x01, 0xd3, 0x36, 0x73, 0xf1, 0xd4, 0x3d, 0x44, 0x88, 0xce, 0xde, 0x17, 0x53, 0x32, 0x6a,
-    0xc0, 0xd0, 0xf2, 0x49, 0x20, 0x0b, 0x4f, 0x5f, 0xec, 0x99, 0x63, 0xc7, 0xce, 0xde, 0x36, 0x4a,
-    0x32, 0x1a, 0x0a, 0x0c, 0x08, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x04, 0x00, 0x00, 0x00, 0x2c, 0x13,
-    0x00, 0x22, 0x00, 0x15, 0x00, 0x05, 0x00, 0x00, 0x08, 0x3c, 0x00, 0x01, 0x08, 0x1c, 0x48, 0xb0,
-    0x20, 0x80, 0x74, 0x08, 0x05, 0x7a, 0x48, 0x68, 0x50, 0x20, 0xc2, 0x87, 0x0f, 0xdf, 0x81, 0xc1,
-    0xc7, 0x0e, 0xa2, 0x45, 0x84, 0xec, 0xf0, 0x7d, 0xa1, 0xe4, 0x49, 0x53, 0x35, 0x81, 0x2c, 0x3c,
-    0x7d, 0xb1, 0xa7, 0xee, 0xa1, 0x3a, 0x7d, 0x5f, 0x3c, 0xd5, 0x68, 0x58, 0x50, 0x86, 0xa9, 0x52,
-    0xa6, 0x64, 0xb0, 0x14, 0x18, 0x10, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x00, 0x00, 0x2c,
-    0x13, 0x00, 0x24, 0x00, 0x15, 0x00, 0x04, 0x00, 0x00, 0x08, 0x36, 0x00, 0xdd, 0xa5, 0x4b, 0x07,
-    0xa0, 0xa0, 0xc1, 0x83, 0x00, 0x06, 0x2a, 0x4c, 0x07, 0x6f, 0x9b, 0x3d, 0x76, 0x0b, 0x0d, 0x2e,
-    0x1c, 0x68, 0x0e, 0x5f, 0xa4, 0x48, 0xdb, 0x0a, 0xd6, 0xf0, 0x14, 0x89, 0xde, 0xc4, 0x74, 0xe8,
-    0xec, 0x7d, 0x31, 0xa5, 0x02, 0x21, 0x42, 0x2d, 0x57, 0xbe, 0xa8, 0xa4, 0x94, 0xc3, 0x64, 0xc1,
-    0x80, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x07, 0x00, 0x01, 0x00, 0x2c, 0x13, 0x00, 0x25, 0x00, 0x15,
-    0x00, 0x04, 0x00, 0x00, 0x08, 0x36, 0x00, 0xdb, 0xa5, 0x4b, 0x17, 0xa0, 0xa0, 0xc1, 0x83, 0x06,
-    0x07, 0x0e, 0x54, 0x87, 0x8f, 0x1e, 0x3a, 0x85, 0x08, 0x03, 0x28, 0x5c, 0xc8, 0x4e, 0x9f, 0xbd,
-    0x82, 0x32, 0x34, 0x6d, 0xa3, 0x37, 0x71, 0x22, 0x3b, 0x7b, 0xcf, 0xb4, 0xa8, 0x88, 0x18, 0x40,
-    0x85, 0xa9, 0x2f, 0xdb, 0xec, 0xa9, 0x8c, 0x44, 0x49, 0x46, 0xc4, 0x80, 0x00, 0x21, 0xf9, 0x04,
-    0x05, 0x03, 0x00, 0x01, 0x00, 0x2c, 0x13, 0x00, 0x26, 0x00, 0x15, 0x00, 0x04, 0x00, 0x00, 0x08,
-    0x34, 0x00, 0xdd, 0xa5, 0x4b, 0x17, 0xa0, 0xa0, 0xc1, 0x83, 0x07, 0x07, 0xa6, 0x83, 0xe7, 0x41,
-    0xe1, 0x40, 0x84, 0x06, 0x1d, 0x0e, 0x7c, 0xe7, 0x4c, 0x86, 0x2c, 0x4a, 0x5f, 0xcc, 0x49, 0x94,
-    0x68, 0x6e, 0xdb, 0x15, 0x59, 0x8c, 0x20, 0x9a, 0xfa, 0x62, 0x8f, 0x9d, 0xba, 0x74, 0xec, 0xec,
-    0x7d, 0x31, 0x85, 0x30, 0x20, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x00, 0x00, 0x2c, 0x13,
-    0x00, 0x28, 0x00, 0x15, 0x00, 0x04, 0x00, 0x00, 0x08, 0x38, 0x00, 0x11, 0xa4, 0x1b, 0x38, 0x10,
-    0x80, 0xc1, 0x83, 0x08, 0x09, 0xa6, 0x53, 0x60, 0x84, 0x12, 0xa5, 0x67, 0xdb, 0xe8, 0x29, 0x4c,
-    0x07, 0x60, 0x22, 0x3a, 0x7b, 0x91, 0x8c, 0x20, 0x04, 0xa0, 0x62, 0xcb, 0x17, 0x7b, 0xe8, 0x14,
-    0xb2, 0xb3, 0xf7, 0x6c, 0xc6, 0xc6, 0x93, 0x00, 0x60, 0x98, 0xf2, 0xe4, 0x49, 0x0b, 0x8b, 0x93,
-    0x01, 0x01, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x04, 0x00, 0x01, 0x00, 0x2c, 0x13, 0x00, 0x29, 0x00,
-    0x15, 0x00, 0x04, 0x00, 0x00, 0x08, 0x3a, 0x00, 0x29, 0xa8, 0x4b, 0x47, 0x30, 0x5d, 0x80, 0x83,
-    0x08, 0x13, 0x06, 0x20, 0xa8, 0x8e, 0x41, 0x00, 0x6e, 0x91, 0x22, 0x6d, 0xa3, 0x37, 0x90, 0x60,
-    0xc2, 0x82, 0x04, 0x21, 0x28, 0x3c, 0xa8, 0xe5, 0x8b, 0x3d, 0x74, 0x18, 0xd3, 0xa9, 0xa3, 0x17,
-    0x49, 0x53, 0xb0, 0x8d, 0x09, 0x65, 0x78, 0x7a, 0xf6, 0xe5, 0x0b, 0x25, 0x2d, 0x2a, 0x12, 0x06,
-    0x04, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x06, 0x00, 0x04, 0x00, 0x2c, 0x14, 0x00, 0x2a, 0x00, 0x13,
-    0x00, 0x04, 0x00, 0x00, 0x08, 0x30, 0x00, 0x1f, 0xa4, 0x1b, 0x38, 0x90, 0x80, 0xc1, 0x83, 0x08,
-    0x0f, 0x66, 0xc0, 0x87, 0xcf, 0x1e, 0x3d, 0x74, 0x04, 0x13, 0x12, 0x84, 0x47, 0x21, 0x21, 0x8d,
-    0x2b, 0xf8, 0xd8, 0x11, 0xdc, 0xd8, 0x6e, 0x40, 0x42, 0x84, 0x30, 0x3c, 0x7d, 0xd9, 0x86, 0x6f,
-    0xdb, 0x17, 0x4f, 0x07, 0x03, 0x02, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x04, 0x00, 0x01, 0x00, 0x2c,
-    0x15, 0x00, 0x2b, 0x00, 0x11, 0x00, 0x04, 0x00, 0x00, 0x08, 0x2c, 0x00, 0xdd, 0xa5, 0x1b, 0x98,
-    0x2e, 0x80, 0xc1, 0x83, 0x08, 0x0d, 0x46, 0xa0, 0xa7, 0x8f, 0x1e, 0x3a, 0x82, 0x09, 0x0d, 0xaa,
-    0x4b, 0x08, 0xc3, 0x53, 0x24, 0x7d, 0xea, 0x08, 0x0e, 0x54, 0xd7, 0x20, 0xe2, 0x41, 0x2d, 0xcf,
-    0xb6, 0xd9, 0x1b, 0xc9, 0xcd, 0x60, 0x40, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x00, 0x00,
-    0x2c, 0x16, 0x00, 0x2c, 0x00, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x08, 0x27, 0x00, 0xdb, 0xa5, 0x1b,
-    0x08, 0xa0, 0xa0, 0xc1, 0x83, 0x23, 0xd8, 0x99, 0x43, 0x37, 0x90, 0xe0, 0xc1, 0x83, 0x35, 0xb4,
-    0x3c, 0xb3, 0xc7, 0xae, 0xe1, 0xc0, 0x0d, 0x0f, 0x0b, 0xc2, 0xa0, 0x14, 0xc9, 0x1e, 0x3d, 0x73,
-    0x19, 0x02, 0x02, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x00, 0x00, 0x2c, 0x17, 0x00, 0x2d,
-    0x00, 0x0c, 0x00, 0x04, 0x00, 0x00, 0x08, 0x24, 0x00, 0xd5, 0xa5, 0x4b, 0x07, 0xa0, 0xa0, 0x41,
-    0x83, 0x1b, 0xd8, 0xb1, 0x1b, 0x38, 0xf0, 0x60, 0x41, 0x28, 0x2a, 0x64, 0x78, 0xfa, 0x62, 0x0f,
-    0x1d, 0xc3, 0x76, 0x0e, 0x0b, 0xe6, 0x78, 0x86, 0x4f, 0xdf, 0x86, 0x80, 0x00, 0x21, 0xf9, 0x04,
-    0x05, 0x07, 0x00, 0x00, 0x00, 0x2c, 0x17, 0x00, 0x2e, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x00, 0x08,
-    0x23, 0x00, 0x01, 0xa4, 0x4b, 0x07, 0xa0, 0xa0, 0x41, 0x83, 0x19, 0xe0, 0xb1, 0x63, 0xa7, 0x6e,
-    0x20, 0xc1, 0x83, 0x06, 0x69, 0x78, 0xfa, 0xa2, 0xaf, 0x61, 0xba, 0x07, 0x10, 0x0d, 0x6a, 0x79,
-    0x86, 0x6f, 0x44, 0x40, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x00, 0x00, 0x2c, 0x18, 0x00,
-    0x2f, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x00, 0x08, 0x23, 0x00, 0x01, 0xa4, 0x1b, 0x08, 0xa0, 0xa0,
-    0x41, 0x00, 0x1b, 0xd8, 0xd1, 0x33, 0x87, 0x6e, 0x60, 0x3a, 0x83, 0xcd, 0x54, 0x14, 0x84, 0x61,
-    0xea, 0x8b, 0x3d, 0x75, 0x0f, 0x0f, 0x1e, 0xe4, 0xf5, 0xcc, 0x41, 0x40, 0x00, 0x21, 0xf9, 0x04,
-    0x05, 0x04, 0x00, 0x00, 0x00, 0x2c, 0x18, 0x00, 0x30, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x00, 0x08,
-    0x1e, 0x00, 0x01, 0xa4, 0x1b, 0x98, 0x0e, 0x80, 0xc1, 0x83, 0x23, 0xcc, 0xd9, 0x5b, 0x68, 0x4e,
-    0xdd, 0xc0, 0x83, 0x10, 0x01, 0x20, 0x79, 0x66, 0x8f, 0x5d, 0x86, 0x88, 0x18, 0x03, 0x02, 0x00,
-    0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x00, 0x00, 0x2c, 0x18, 0x00, 0x31, 0x00, 0x0a, 0x00, 0x03,
-    0x00, 0x00, 0x08, 0x1a, 0x00, 0x01, 0xa4, 0x1b, 0x48, 0x10, 0x80, 0xc1, 0x0c, 0xf4, 0xf0, 0x45,
-    0x5a, 0x68, 0x8f, 0x5d, 0x3a, 0x75, 0x06, 0x23, 0x1a, 0x64, 0x61, 0x8a, 0x5b, 0x40, 0x00, 0x21,
-    0xf9, 0x04, 0x05, 0x07, 0x00, 0x00, 0x00, 0x2c, 0x19, 0x00, 0x32, 0x00, 0x09, 0x00, 0x02, 0x00,
-    0x00, 0x08, 0x14, 0x00, 0xd5, 0xa5, 0x1b, 0x48, 0x10, 0x00, 0x00, 0x12, 0x91, 0x28, 0x99, 0x32,
-    0xe5, 0xe9, 0x0b, 0x3e, 0x04, 0x01, 0x01, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x00, 0x00,
-    0x2c, 0x19, 0x00, 0x33, 0x00, 0x09, 0x00, 0x02, 0x00, 0x00, 0x08, 0x15, 0x00, 0x11, 0xa8, 0x53,
-    0x67, 0xce, 0x9e, 0x3d, 0x73, 0xe8, 0x00, 0x00, 0xa0, 0x70, 0x4b, 0xa1, 0x42, 0x66, 0x00, 0x02,
-    0x02, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x03, 0x00, 0x00, 0x00, 0x2c, 0x1a, 0x00, 0x33, 0x00, 0x07,
-    0x00, 0x02, 0x00, 0x00, 0x08, 0x0e, 0x00, 0x01, 0xa4, 0x1b, 0x38, 0x50, 0x1d, 0x80, 0x11, 0x08,
-    0x11, 0x32, 0x08, 0x08, 0x00, 0x21, 0xf9, 0x04, 0x05, 0x21, 0x00, 0x00, 0x00, 0x2c, 0x1d, 0x00,
-    0x34, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x02, 0x02, 0x84, 0x0b, 0x00, 0x3b,
-};
-
-const lv_img_dsc_t img_bulb_gif = {
-    .header.always_zero = 0,
-    .header.w = 0,
-    .header.h = 0,
-    .data_size = 0,
-    .header.cf = LV_IMG_CF_RAW,
-    .data = img_blub_gif_map,
-};
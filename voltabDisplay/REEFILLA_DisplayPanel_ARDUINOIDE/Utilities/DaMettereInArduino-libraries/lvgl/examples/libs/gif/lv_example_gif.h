@@ -1,38 +0,0 @@
-/**
- * @file lv_example_gif.h
- *
- */
-
-#ifndef LV_EXAMPLE_GIF_H
-#define LV_EXAMPLE_GIF_H
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-/*********************
- *      INCLUDES
- *********************/
-
-/*********************
- *      DEFINES
- *********************/
-
-/**********************
- *      TYPEDEFS
- **********************/
-
-/**********************
- * GLOBAL PROTOTYPES
- **********************/
-void lv_example_gif_1(void);
-
-/**********************
- *      MACROS
- **********************/
-
-#ifdef __cplusplus
-} /*extern "C"*/
-#endif
-
-#endif /*LV_EXAMPLE_GIF_H*/
@@ -1,38 +0,0 @@
-/**
- * @file lv_example_qrcode.h
- *
- */
-
-#ifndef LV_EXAMPLE_QRCODE_H
-#define LV_EXAMPLE_QRCODE_H
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-/*********************
- *      INCLUDES
- *********************/
-
-/*********************
- *      DEFINES
- *********************/
-
-/**********************
- *      TYPEDEFS
- **********************/
-
-/**********************
- * GLOBAL PROTOTYPES
- **********************/
-void lv_example_qrcode_1(void);
-
-/**********************
- *      MACROS
- **********************/
-
-#ifdef __cplusplus
-} /*extern "C"*/
-#endif
-
-#endif /*LV_EXAMPLE_QRCODE_H*/
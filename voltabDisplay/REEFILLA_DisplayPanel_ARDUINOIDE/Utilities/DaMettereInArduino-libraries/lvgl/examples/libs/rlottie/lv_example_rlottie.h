@@ -1,39 +0,0 @@
-/**
- * @file lv_example_rlottie.h
- *
- */
-
-#ifndef LV_EXAMPLE_RLOTTIE_H
-#define LV_EXAMPLE_RLOTTIE_H
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-/*********************
- *      INCLUDES
- *********************/
-
-/*********************
- *      DEFINES
- *********************/
-
-/**********************
- *      TYPEDEFS
- **********************/
-
-/**********************
- * GLOBAL PROTOTYPES
- **********************/
-void lv_example_rlottie_1(void);
-void lv_example_rlottie_2(void);
-
-/**********************
- *      MACROS
- **********************/
-
-#ifdef __cplusplus
-} /*extern "C"*/
-#endif
-
-#endif /*LV_EXAMPLE_SJPG_H*/
@@ -1,28 +0,0 @@
-#include "../../lv_examples.h"
-#if LV_BUILD_EXAMPLES
-#if LV_USE_RLOTTIE
-
-/**
- * Load an lottie animation from file
- */
-void lv_example_rlottie_2(void)
-{
-    /*The rlottie library uses STDIO file API, so there is no driver letter for LVGL*/
-    lv_obj_t * lottie = lv_rlottie_create_from_file(lv_scr_act(), 100, 100,
-                                                    "lvgl/examples/libs/rlottie/lv_example_rlottie_approve.json");
-    lv_obj_center(lottie);
-}
-
-#else
-void lv_example_rlottie_2(void)
-{
-    /*TODO
-     *fallback for online examples*/
-
-    lv_obj_t * label = lv_label_create(lv_scr_act());
-    lv_label_set_text(label, "Rlottie is not installed");
-    lv_obj_center(label);
-}
-
-#endif
-#endif
@@ -1,49 +0,0 @@
-/**
- * @file lv_examples.h
- *
- */
-
-#ifndef LV_EXAMPLES_H
-#define LV_EXAMPLES_H
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-/*********************
- *      INCLUDES
- *********************/
-#include "../lvgl.h"
-
-#include "styles/lv_example_style.h"
-#include "get_started/lv_example_get_started.h"
-#include "widgets/lv_example_widgets.h"
-#include "layouts/lv_example_layout.h"
-#include "scroll/lv_example_scroll.h"
-#include "anim/lv_example_anim.h"
-#include "event/lv_example_event.h"
-#include "styles/lv_example_style.h"
-#include "others/lv_example_others.h"
-#include "libs/lv_example_libs.h"
-
-/*********************
- *      DEFINES
- *********************/
-
-/**********************
- *      TYPEDEFS
- **********************/
-
-/**********************
- * GLOBAL PROTOTYPES
- **********************/
-
-/**********************
- *      MACROS
- **********************/
-
-#ifdef __cplusplus
-} /*extern "C"*/
-#endif
-
-#endif /*LV_EXAMPLES_H*/
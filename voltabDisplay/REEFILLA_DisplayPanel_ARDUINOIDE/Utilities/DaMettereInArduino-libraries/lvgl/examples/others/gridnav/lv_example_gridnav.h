@@ -1,41 +0,0 @@
-/**
- * @file lv_example_gridnav.h
- *
- */
-
-#ifndef LV_EXAMPLE_GRIDNAV_H
-#define LV_EXAMPLE_GRIDNAV_H
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-/*********************
- *      INCLUDES
- *********************/
-
-/*********************
- *      DEFINES
- *********************/
-
-/**********************
- *      TYPEDEFS
- **********************/
-
-/**********************
- * GLOBAL PROTOTYPES
- **********************/
-void lv_example_gridnav_1(void);
-void lv_example_gridnav_2(void);
-void lv_example_gridnav_3(void);
-void lv_example_gridnav_4(void);
-
-/**********************
- *      MACROS
- **********************/
-
-#ifdef __cplusplus
-} /*extern "C"*/
-#endif
-
-#endif /*LV_EXAMPLE_GRIDNAV_H*/
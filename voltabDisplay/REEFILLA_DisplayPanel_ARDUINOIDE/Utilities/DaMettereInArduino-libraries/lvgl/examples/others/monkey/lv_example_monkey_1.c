@@ -1,18 +0,0 @@
-#include "../../lv_examples.h"
-#if LV_USE_MONKEY && LV_BUILD_EXAMPLES
-
-void lv_example_monkey_1(void)
-{
-    /*Create pointer monkey test*/
-    lv_monkey_config_t config;
-    lv_monkey_config_init(&config);
-    config.type = LV_INDEV_TYPE_POINTER;
-    config.period_range.min = 10;
-    config.period_range.max = 100;
-    lv_monkey_t * monkey = lv_monkey_create(&config);
-
-    /*Start monkey test*/
-    lv_monkey_set_enable(monkey, true);
-}
-
-#endif
@@ -1,25 +0,0 @@
-#include "../../lv_examples.h"
-#if LV_USE_MONKEY && LV_BUILD_EXAMPLES
-
-void lv_example_monkey_2(void)
-{
-    /*Create encoder monkey test*/
-    lv_monkey_config_t config;
-    lv_monkey_config_init(&config);
-    config.type = LV_INDEV_TYPE_ENCODER;
-    config.period_range.min = 50;
-    config.period_range.max = 500;
-    config.input_range.min = -5;
-    config.input_range.max = 5;
-    lv_monkey_t * monkey = lv_monkey_create(&config);
-
-    /*Set the default group*/
-    lv_group_t * group = lv_group_create();
-    lv_indev_set_group(lv_monkey_get_indev(monkey), group);
-    lv_group_set_default(group);
-
-    /*Start monkey test*/
-    lv_monkey_set_enable(monkey, true);
-}
-
-#endif
@@ -1,33 +0,0 @@
-#include "../../lv_examples.h"
-#if LV_USE_MONKEY && LV_BUILD_EXAMPLES
-
-void lv_example_monkey_3(void)
-{
-    static lv_point_t btn_points[3];
-    lv_coord_t hor_res = LV_HOR_RES;
-
-    /*Create button monkey test*/
-    lv_monkey_config_t config;
-    lv_monkey_config_init(&config);
-    config.type = LV_INDEV_TYPE_BUTTON;
-    config.period_range.min = 50;
-    config.period_range.max = 500;
-    config.input_range.min = 0;
-    config.input_range.max = sizeof(btn_points) / sizeof(lv_point_t) - 1;
-    lv_monkey_t * monkey = lv_monkey_create(&config);
-
-    /*Set the coordinates bound to the button*/
-    btn_points[0].x = hor_res / 4;
-    btn_points[0].y = 10;
-    btn_points[1].x = hor_res / 2;
-    btn_points[1].y = 10;
-    btn_points[2].x = hor_res * 3 / 4;
-    btn_points[2].y = 10;
-
-    lv_indev_set_button_points(lv_monkey_get_indev(monkey), btn_points);
-
-    /*Start monkey test*/
-    lv_monkey_set_enable(monkey, true);
-}
-
-#endif
@@ -1,38 +0,0 @@
-/**
- * @file lv_example_snapshot.h
- *
- */
-
-#ifndef LV_EX_SNAPSHOT_H
-#define LV_EX_SNAPSHOT_H
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-/*********************
- *      INCLUDES
- *********************/
-
-/*********************
- *      DEFINES
- *********************/
-
-/**********************
- *      TYPEDEFS
- **********************/
-
-/**********************
- * GLOBAL PROTOTYPES
- **********************/
-void lv_example_snapshot_1(void);
-
-/**********************
- *      MACROS
- **********************/
-
-#ifdef __cplusplus
-} /*extern "C"*/
-#endif
-
-#endif /*LV_EX_GET_STARTED_H*/
@@ -1,50 +0,0 @@
-#include "../lv_examples.h"
-#if LV_BUILD_EXAMPLES && LV_USE_IMG
-
-/**
- * Using multiple styles
- */
-void lv_example_style_11(void)
-{
-    /*A base style*/
-    static lv_style_t style_base;
-    lv_style_init(&style_base);
-    lv_style_set_bg_color(&style_base, lv_palette_main(LV_PALETTE_LIGHT_BLUE));
-    lv_style_set_border_color(&style_base, lv_palette_darken(LV_PALETTE_LIGHT_BLUE, 3));
-    lv_style_set_border_width(&style_base, 2);
-    lv_style_set_radius(&style_base, 10);
-    lv_style_set_shadow_width(&style_base, 10);
-    lv_style_set_shadow_ofs_y(&style_base, 5);
-    lv_style_set_shadow_opa(&style_base, LV_OPA_50);
-    lv_style_set_text_color(&style_base, lv_color_white());
-    lv_style_set_width(&style_base, 100);
-    lv_style_set_height(&style_base, LV_SIZE_CONTENT);
-
-    /*Set only the properties that should be different*/
-    static lv_style_t style_warning;
-    lv_style_init(&style_warning);
-    lv_style_set_bg_color(&style_warning, lv_palette_main(LV_PALETTE_YELLOW));
-    lv_style_set_border_color(&style_warning, lv_palette_darken(LV_PALETTE_YELLOW, 3));
-    lv_style_set_text_color(&style_warning, lv_palette_darken(LV_PALETTE_YELLOW, 4));
-
-    /*Create an object with the base style only*/
-    lv_obj_t * obj_base = lv_obj_create(lv_scr_act());
-    lv_obj_add_style(obj_base, &style_base, 0);
-    lv_obj_align(obj_base, LV_ALIGN_LEFT_MID, 20, 0);
-
-    lv_obj_t * label = lv_label_create(obj_base);
-    lv_label_set_text(label, "Base");
-    lv_obj_center(label);
-
-    /*Create another object with the base style and earnings style too*/
-    lv_obj_t * obj_warning = lv_obj_create(lv_scr_act());
-    lv_obj_add_style(obj_warning, &style_base, 0);
-    lv_obj_add_style(obj_warning, &style_warning, 0);
-    lv_obj_align(obj_warning, LV_ALIGN_RIGHT_MID, -20, 0);
-
-    label = lv_label_create(obj_warning);
-    lv_label_set_text(label, "Warning");
-    lv_obj_center(label);
-}
-
-#endif
@@ -1,29 +0,0 @@
-#include "../lv_examples.h"
-#if LV_BUILD_EXAMPLES
-
-/**
- * Using the border style properties
- */
-void lv_example_style_3(void)
-{
-    static lv_style_t style;
-    lv_style_init(&style);
-
-    /*Set a background color and a radius*/
-    lv_style_set_radius(&style, 10);
-    lv_style_set_bg_opa(&style, LV_OPA_COVER);
-    lv_style_set_bg_color(&style, lv_palette_lighten(LV_PALETTE_GREY, 1));
-
-    /*Add border to the bottom+right*/
-    lv_style_set_border_color(&style, lv_palette_main(LV_PALETTE_BLUE));
-    lv_style_set_border_width(&style, 5);
-    lv_style_set_border_opa(&style, LV_OPA_50);
-    lv_style_set_border_side(&style, LV_BORDER_SIDE_BOTTOM | LV_BORDER_SIDE_RIGHT);
-
-    /*Create an object with the new style*/
-    lv_obj_t * obj = lv_obj_create(lv_scr_act());
-    lv_obj_add_style(obj, &style, 0);
-    lv_obj_center(obj);
-}
-
-#endif
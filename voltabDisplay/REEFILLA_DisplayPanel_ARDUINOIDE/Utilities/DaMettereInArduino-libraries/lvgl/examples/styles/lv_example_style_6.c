@@ -1,33 +0,0 @@
-#include "../lv_examples.h"
-#if LV_BUILD_EXAMPLES && LV_USE_IMG
-
-/**
- * Using the Image style properties
- */
-void lv_example_style_6(void)
-{
-    static lv_style_t style;
-    lv_style_init(&style);
-
-    /*Set a background color and a radius*/
-    lv_style_set_radius(&style, 5);
-    lv_style_set_bg_opa(&style, LV_OPA_COVER);
-    lv_style_set_bg_color(&style, lv_palette_lighten(LV_PALETTE_GREY, 3));
-    lv_style_set_border_width(&style, 2);
-    lv_style_set_border_color(&style, lv_palette_main(LV_PALETTE_BLUE));
-
-    lv_style_set_img_recolor(&style, lv_palette_main(LV_PALETTE_BLUE));
-    lv_style_set_img_recolor_opa(&style, LV_OPA_50);
-    lv_style_set_transform_angle(&style, 300);
-
-    /*Create an object with the new style*/
-    lv_obj_t * obj = lv_img_create(lv_scr_act());
-    lv_obj_add_style(obj, &style, 0);
-
-    LV_IMG_DECLARE(img_cogwheel_argb);
-    lv_img_set_src(obj, &img_cogwheel_argb);
-
-    lv_obj_center(obj);
-}
-
-#endif
@@ -1,26 +0,0 @@
-#include "../lv_examples.h"
-#if LV_BUILD_EXAMPLES && LV_USE_LINE
-
-/**
- * Using the line style properties
- */
-void lv_example_style_9(void)
-{
-    static lv_style_t style;
-    lv_style_init(&style);
-
-    lv_style_set_line_color(&style, lv_palette_main(LV_PALETTE_GREY));
-    lv_style_set_line_width(&style, 6);
-    lv_style_set_line_rounded(&style, true);
-
-    /*Create an object with the new style*/
-    lv_obj_t * obj = lv_line_create(lv_scr_act());
-    lv_obj_add_style(obj, &style, 0);
-
-    static lv_point_t p[] = {{10, 30}, {30, 50}, {100, 0}};
-    lv_line_set_points(obj, p, 3);
-
-    lv_obj_center(obj);
-}
-
-#endif
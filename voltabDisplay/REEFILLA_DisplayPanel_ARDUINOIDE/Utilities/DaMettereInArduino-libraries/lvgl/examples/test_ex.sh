@@ -1,4 +0,0 @@
-#!/bin/sh
-cat ../../header.py $1 > test.py
-chmod +x test.py
-./test.py
@@ -1,35 +0,0 @@
-#include "../../lv_examples.h"
-
-#if LV_USE_ARC && LV_BUILD_EXAMPLES
-
-static void set_angle(void * obj, int32_t v)
-{
-    lv_arc_set_value(obj, v);
-}
-
-/**
- * Create an arc which acts as a loader.
- */
-void lv_example_arc_2(void)
-{
-    /*Create an Arc*/
-    lv_obj_t * arc = lv_arc_create(lv_scr_act());
-    lv_arc_set_rotation(arc, 270);
-    lv_arc_set_bg_angles(arc, 0, 360);
-    lv_obj_remove_style(arc, NULL, LV_PART_KNOB);   /*Be sure the knob is not displayed*/
-    lv_obj_clear_flag(arc, LV_OBJ_FLAG_CLICKABLE);  /*To not allow adjusting by click*/
-    lv_obj_center(arc);
-
-    lv_anim_t a;
-    lv_anim_init(&a);
-    lv_anim_set_var(&a, arc);
-    lv_anim_set_exec_cb(&a, set_angle);
-    lv_anim_set_time(&a, 1000);
-    lv_anim_set_repeat_count(&a, LV_ANIM_REPEAT_INFINITE);    /*Just for the demo*/
-    lv_anim_set_repeat_delay(&a, 500);
-    lv_anim_set_values(&a, 0, 100);
-    lv_anim_start(&a);
-
-}
-
-#endif
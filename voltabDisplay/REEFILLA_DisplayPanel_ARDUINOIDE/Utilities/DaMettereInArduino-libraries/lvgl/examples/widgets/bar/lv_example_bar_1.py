@@ -1,5 +0,0 @@
-bar1 = lv.bar(lv.scr_act())
-bar1.set_size(200, 20)
-bar1.center()
-bar1.set_value(70, lv.ANIM.OFF)
-
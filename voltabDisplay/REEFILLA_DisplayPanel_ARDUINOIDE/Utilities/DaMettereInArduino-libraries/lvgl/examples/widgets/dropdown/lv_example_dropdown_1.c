@@ -1,35 +0,0 @@
-#include "../../lv_examples.h"
-#if LV_USE_DROPDOWN && LV_BUILD_EXAMPLES
-
-static void event_handler(lv_event_t * e)
-{
-    lv_event_code_t code = lv_event_get_code(e);
-    lv_obj_t * obj = lv_event_get_target(e);
-    if(code == LV_EVENT_VALUE_CHANGED) {
-        char buf[32];
-        lv_dropdown_get_selected_str(obj, buf, sizeof(buf));
-        LV_LOG_USER("Option: %s", buf);
-    }
-}
-
-void lv_example_dropdown_1(void)
-{
-
-    /*Create a normal drop down list*/
-    lv_obj_t * dd = lv_dropdown_create(lv_scr_act());
-    lv_dropdown_set_options(dd, "Apple\n"
-                            "Banana\n"
-                            "Orange\n"
-                            "Cherry\n"
-                            "Grape\n"
-                            "Raspberry\n"
-                            "Melon\n"
-                            "Orange\n"
-                            "Lemon\n"
-                            "Nuts");
-
-    lv_obj_align(dd, LV_ALIGN_TOP_MID, 0, 20);
-    lv_obj_add_event_cb(dd, event_handler, LV_EVENT_ALL, NULL);
-}
-
-#endif
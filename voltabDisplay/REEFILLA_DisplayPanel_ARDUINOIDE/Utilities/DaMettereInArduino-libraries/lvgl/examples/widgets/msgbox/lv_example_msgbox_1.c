@@ -1,19 +0,0 @@
-#include "../../lv_examples.h"
-#if LV_USE_MSGBOX && LV_BUILD_EXAMPLES
-
-static void event_cb(lv_event_t * e)
-{
-    lv_obj_t * obj = lv_event_get_current_target(e);
-    LV_LOG_USER("Button %s clicked", lv_msgbox_get_active_btn_text(obj));
-}
-
-void lv_example_msgbox_1(void)
-{
-    static const char * btns[] = {"Apply", "Close", ""};
-
-    lv_obj_t * mbox1 = lv_msgbox_create(NULL, "Hello", "This is a message box with two buttons.", btns, true);
-    lv_obj_add_event_cb(mbox1, event_cb, LV_EVENT_VALUE_CHANGED, NULL);
-    lv_obj_center(mbox1);
-}
-
-#endif
@@ -1,14 +0,0 @@
-obj1 = lv.obj(lv.scr_act())
-obj1.set_size(100, 50)
-obj1.align(lv.ALIGN.CENTER, -60, -30)
-
-style_shadow = lv.style_t()
-style_shadow.init()
-style_shadow.set_shadow_width(10)
-style_shadow.set_shadow_spread(5)
-style_shadow.set_shadow_color(lv.palette_main(lv.PALETTE.BLUE))
-
-obj2 = lv.obj(lv.scr_act())
-obj2.add_style(style_shadow, 0)
-obj2.align(lv.ALIGN.CENTER, 60, 30)
-
@@ -1,55 +0,0 @@
-#include "../../lv_examples.h"
-#if LV_USE_SLIDER && LV_BUILD_EXAMPLES
-
-/**
- * Show how to style a slider.
- */
-void lv_example_slider_2(void)
-{
-    /*Create a transition*/
-    static const lv_style_prop_t props[] = {LV_STYLE_BG_COLOR, 0};
-    static lv_style_transition_dsc_t transition_dsc;
-    lv_style_transition_dsc_init(&transition_dsc, props, lv_anim_path_linear, 300, 0, NULL);
-
-    static lv_style_t style_main;
-    static lv_style_t style_indicator;
-    static lv_style_t style_knob;
-    static lv_style_t style_pressed_color;
-    lv_style_init(&style_main);
-    lv_style_set_bg_opa(&style_main, LV_OPA_COVER);
-    lv_style_set_bg_color(&style_main, lv_color_hex3(0xbbb));
-    lv_style_set_radius(&style_main, LV_RADIUS_CIRCLE);
-    lv_style_set_pad_ver(&style_main, -2); /*Makes the indicator larger*/
-
-    lv_style_init(&style_indicator);
-    lv_style_set_bg_opa(&style_indicator, LV_OPA_COVER);
-    lv_style_set_bg_color(&style_indicator, lv_palette_main(LV_PALETTE_CYAN));
-    lv_style_set_radius(&style_indicator, LV_RADIUS_CIRCLE);
-    lv_style_set_transition(&style_indicator, &transition_dsc);
-
-    lv_style_init(&style_knob);
-    lv_style_set_bg_opa(&style_knob, LV_OPA_COVER);
-    lv_style_set_bg_color(&style_knob, lv_palette_main(LV_PALETTE_CYAN));
-    lv_style_set_border_color(&style_knob, lv_palette_darken(LV_PALETTE_CYAN, 3));
-    lv_style_set_border_width(&style_knob, 2);
-    lv_style_set_radius(&style_knob, LV_RADIUS_CIRCLE);
-    lv_style_set_pad_all(&style_knob, 6); /*Makes the knob larger*/
-    lv_style_set_transition(&style_knob, &transition_dsc);
-
-    lv_style_init(&style_pressed_color);
-    lv_style_set_bg_color(&style_pressed_color, lv_palette_darken(LV_PALETTE_CYAN, 2));
-
-    /*Create a slider and add the style*/
-    lv_obj_t * slider = lv_slider_create(lv_scr_act());
-    lv_obj_remove_style_all(slider);        /*Remove the styles coming from the theme*/
-
-    lv_obj_add_style(slider, &style_main, LV_PART_MAIN);
-    lv_obj_add_style(slider, &style_indicator, LV_PART_INDICATOR);
-    lv_obj_add_style(slider, &style_pressed_color, LV_PART_INDICATOR | LV_STATE_PRESSED);
-    lv_obj_add_style(slider, &style_knob, LV_PART_KNOB);
-    lv_obj_add_style(slider, &style_pressed_color, LV_PART_KNOB | LV_STATE_PRESSED);
-
-    lv_obj_center(slider);
-}
-
-#endif
@@ -1,56 +0,0 @@
-#include "../../lv_examples.h"
-#if LV_USE_SLIDER && LV_BUILD_EXAMPLES
-
-static void slider_event_cb(lv_event_t * e);
-
-/**
- * Show the current value when the slider is pressed by extending the drawer
- *
- */
-void lv_example_slider_3(void)
-{
-    /*Create a slider in the center of the display*/
-    lv_obj_t * slider;
-    slider = lv_slider_create(lv_scr_act());
-    lv_obj_center(slider);
-
-    lv_slider_set_mode(slider, LV_SLIDER_MODE_RANGE);
-    lv_slider_set_value(slider, 70, LV_ANIM_OFF);
-    lv_slider_set_left_value(slider, 20, LV_ANIM_OFF);
-
-    lv_obj_add_event_cb(slider, slider_event_cb, LV_EVENT_ALL, NULL);
-    lv_obj_refresh_ext_draw_size(slider);
-}
-
-static void slider_event_cb(lv_event_t * e)
-{
-    lv_event_code_t code = lv_event_get_code(e);
-    lv_obj_t * obj = lv_event_get_target(e);
-
-    /*Provide some extra space for the value*/
-    if(code == LV_EVENT_REFR_EXT_DRAW_SIZE) {
-        lv_event_set_ext_draw_size(e, 50);
-    }
-    else if(code == LV_EVENT_DRAW_PART_END) {
-        lv_obj_draw_part_dsc_t * dsc = lv_event_get_draw_part_dsc(e);
-        if(dsc->part == LV_PART_INDICATOR) {
-            char buf[16];
-            lv_snprintf(buf, sizeof(buf), "%d - %d", (int)lv_slider_get_left_value(obj), (int)lv_slider_get_value(obj));
-
-            lv_point_t label_size;
-            lv_txt_get_size(&label_size, buf, LV_FONT_DEFAULT, 0, 0, LV_COORD_MAX, 0);
-            lv_area_t label_area;
-            label_area.x1 = dsc->draw_area->x1 + lv_area_get_width(dsc->draw_area) / 2 - label_size.x / 2;
-            label_area.x2 = label_area.x1 + label_size.x;
-            label_area.y2 = dsc->draw_area->y1 - 10;
-            label_area.y1 = label_area.y2 - label_size.y;
-
-            lv_draw_label_dsc_t label_draw_dsc;
-            lv_draw_label_dsc_init(&label_draw_dsc);
-            label_draw_dsc.color = lv_color_hex3(0x888);
-            lv_draw_label(dsc->draw_ctx, &label_draw_dsc, &label_area, buf, NULL);
-        }
-    }
-}
-
-#endif
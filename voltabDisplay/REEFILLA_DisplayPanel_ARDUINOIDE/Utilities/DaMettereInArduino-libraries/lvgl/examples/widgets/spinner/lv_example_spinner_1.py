@@ -1,6 +0,0 @@
-# Create a spinner
-spinner = lv.spinner(lv.scr_act(), 1000, 60)
-spinner.set_size(100, 100)
-spinner.center()
-
-
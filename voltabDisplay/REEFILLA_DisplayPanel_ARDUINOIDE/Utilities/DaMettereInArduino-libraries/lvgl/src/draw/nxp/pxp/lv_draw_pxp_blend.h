@@ -1,130 +0,0 @@
-/**
- * @file lv_draw_pxp_blend.h
- *
- */
-
-/**
- * MIT License
- *
- * Copyright 2020-2023 NXP
- *
- * Permission is hereby granted, free of charge, to any person obtaining a copy
- * of this software and associated documentation files (the "Software"), to deal
- * in the Software without restriction, including without limitation the rights to
- * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
- * the Software, and to permit persons to whom the Software is furnished to do so,
- * subject to the following conditions:
- *
- * The above copyright notice and this permission notice (including the next paragraph)
- * shall be included in all copies or substantial portions of the Software.
- *
- * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
- * INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
- * PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
- * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
- * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
- * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
- *
- */
-
-#ifndef LV_DRAW_PXP_BLEND_H
-#define LV_DRAW_PXP_BLEND_H
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-/*********************
- *      INCLUDES
- *********************/
-
-#include "../../../lv_conf_internal.h"
-
-#if LV_USE_GPU_NXP_PXP
-#include "lv_gpu_nxp_pxp.h"
-#include "../../sw/lv_draw_sw.h"
-
-/*********************
- *      DEFINES
- *********************/
-
-/**********************
- *      TYPEDEFS
- **********************/
-
-/**********************
- * GLOBAL PROTOTYPES
- **********************/
-
-/**
- * Fill area, with optional opacity.
- *
- * @param[in/out] dest_buf Destination buffer
- * @param[in] dest_area Area with relative coordinates of destination buffer
- * @param[in] dest_stride Stride of destination buffer in pixels
- * @param[in] color Color
- * @param[in] opa Opacity
- */
-void lv_gpu_nxp_pxp_fill(lv_color_t * dest_buf, const lv_area_t * dest_area, lv_coord_t dest_stride,
-                         lv_color_t color, lv_opa_t opa);
-
-/**
- * BLock Image Transfer - copy rectangular image from src_buf to dst_buf with effects.
- * By default, image is copied directly, with optional opacity. This function can also
- * rotate the display output buffer to a specified angle (90x step).
- *
- * @param[in/out] dest_buf Destination buffer
- * @param[in] dest_area Area with relative coordinates of destination buffer
- * @param[in] dest_stride Stride of destination buffer in pixels
- * @param[in] src_buf Source buffer
- * @param[in] src_area Source area with relative coordinates of source buffer
- * @param[in] src_stride Stride of source buffer in pixels
- * @param[in] opa Opacity
- * @param[in] angle Display rotation angle (90x)
- */
-void lv_gpu_nxp_pxp_blit(lv_color_t * dest_buf, const lv_area_t * dest_area, lv_coord_t dest_stride,
-                         const lv_color_t * src_buf, const lv_area_t * src_area, lv_coord_t src_stride,
-                         lv_opa_t opa, lv_disp_rot_t angle);
-
-/**
- * BLock Image Transfer - copy rectangular image from src_buf to dst_buf with transformation.
- *
- *
- * @param[in/out] dest_buf Destination buffer
- * @param[in] dest_area Area with relative coordinates of destination buffer
- * @param[in] dest_stride Stride of destination buffer in pixels
- * @param[in] src_buf Source buffer
- * @param[in] src_area Area with relative coordinates of source buffer
- * @param[in] src_stride Stride of source buffer in pixels
- * @param[in] dsc Image descriptor
- * @param[in] cf Color format
- */
-void lv_gpu_nxp_pxp_blit_transform(lv_color_t * dest_buf, lv_area_t * dest_area, lv_coord_t dest_stride,
-                                   const lv_color_t * src_buf, const lv_area_t * src_area, lv_coord_t src_stride,
-                                   const lv_draw_img_dsc_t * dsc, lv_img_cf_t cf);
-
-/**
- * BLock Image Transfer - copy rectangular image from src_buf to dst_buf, no transformation or blending.
- *
- *
- * @param[in/out] dest_buf Destination buffer
- * @param[in] dest_area Area with relative coordinates of destination buffer
- * @param[in] dest_stride Stride of destination buffer in pixels
- * @param[in] src_buf Source buffer
- * @param[in] src_area Area with relative coordinates of source buffer
- * @param[in] src_stride Stride of source buffer in pixels
- */
-void lv_gpu_nxp_pxp_buffer_copy(lv_color_t * dest_buf, const lv_area_t * dest_area, lv_coord_t dest_stride,
-                                const lv_color_t * src_buf, const lv_area_t * src_area, lv_coord_t src_stride);
-
-/**********************
- *      MACROS
- **********************/
-
-#endif /*LV_USE_GPU_NXP_PXP*/
-
-#ifdef __cplusplus
-} /*extern "C"*/
-#endif
-
-#endif /*LV_DRAW_PXP_BLEND_H*/
@@ -1,40 +0,0 @@
-/**
- * @file lv_themes.h
- *
- */
-
-#ifndef LV_THEMES_H
-#define LV_THEMES_H
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-/*********************
- *      INCLUDES
- *********************/
-#include "default/lv_theme_default.h"
-#include "mono/lv_theme_mono.h"
-#include "basic/lv_theme_basic.h"
-
-/*********************
- *      DEFINES
- *********************/
-
-/**********************
- *      TYPEDEFS
- **********************/
-
-/**********************
- * GLOBAL PROTOTYPES
- **********************/
-
-/**********************
- *      MACROS
- **********************/
-
-#ifdef __cplusplus
-} /*extern "C"*/
-#endif
-
-#endif /*LV_THEMES_H*/
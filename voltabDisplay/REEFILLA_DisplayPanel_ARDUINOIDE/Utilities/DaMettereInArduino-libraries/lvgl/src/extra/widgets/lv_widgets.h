@@ -1,56 +0,0 @@
-/**
- * @file lv_widgets.h
- *
- */
-
-#ifndef LV_WIDGETS_H
-#define LV_WIDGETS_H
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-/*********************
- *      INCLUDES
- *********************/
-#include "animimg/lv_animimg.h"
-#include "calendar/lv_calendar.h"
-#include "calendar/lv_calendar_header_arrow.h"
-#include "calendar/lv_calendar_header_dropdown.h"
-#include "chart/lv_chart.h"
-#include "keyboard/lv_keyboard.h"
-#include "list/lv_list.h"
-#include "menu/lv_menu.h"
-#include "msgbox/lv_msgbox.h"
-#include "meter/lv_meter.h"
-#include "spinbox/lv_spinbox.h"
-#include "spinner/lv_spinner.h"
-#include "tabview/lv_tabview.h"
-#include "tileview/lv_tileview.h"
-#include "win/lv_win.h"
-#include "colorwheel/lv_colorwheel.h"
-#include "led/lv_led.h"
-#include "imgbtn/lv_imgbtn.h"
-#include "span/lv_span.h"
-
-/*********************
- *      DEFINES
- *********************/
-
-/**********************
- *      TYPEDEFS
- **********************/
-
-/**********************
- * GLOBAL PROTOTYPES
- **********************/
-
-/**********************
- *      MACROS
- **********************/
-
-#ifdef __cplusplus
-} /*extern "C"*/
-#endif
-
-#endif /*LV_WIDGETS_H*/
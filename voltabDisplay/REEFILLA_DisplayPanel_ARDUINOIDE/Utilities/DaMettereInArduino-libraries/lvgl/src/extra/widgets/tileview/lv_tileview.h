@@ -1,72 +0,0 @@
-/**
- * @file lv_tileview.h
- *
- */
-
-#ifndef LV_TILEVIEW_H
-#define LV_TILEVIEW_H
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-/*********************
- *      INCLUDES
- *********************/
-#include "../../../core/lv_obj.h"
-
-#if LV_USE_TILEVIEW
-
-/*********************
- *      DEFINES
- *********************/
-
-/**********************
- *      TYPEDEFS
- **********************/
-typedef struct {
-    lv_obj_t obj;
-    lv_obj_t * tile_act;
-} lv_tileview_t;
-
-typedef struct {
-    lv_obj_t obj;
-    lv_dir_t dir;
-} lv_tileview_tile_t;
-
-extern const lv_obj_class_t lv_tileview_class;
-extern const lv_obj_class_t lv_tileview_tile_class;
-
-/**********************
- * GLOBAL PROTOTYPES
- **********************/
-
-/**
- * Create a Tileview object
- * @param parent pointer to an object, it will be the parent of the new tileview
- * @return pointer to the created tileview
- */
-lv_obj_t * lv_tileview_create(lv_obj_t * parent);
-
-lv_obj_t * lv_tileview_add_tile(lv_obj_t * tv, uint8_t col_id, uint8_t row_id, lv_dir_t dir);
-
-void lv_obj_set_tile(lv_obj_t * tv, lv_obj_t * tile_obj, lv_anim_enable_t anim_en);
-void lv_obj_set_tile_id(lv_obj_t * tv, uint32_t col_id, uint32_t row_id, lv_anim_enable_t anim_en);
-
-lv_obj_t * lv_tileview_get_tile_act(lv_obj_t * obj);
-
-/*=====================
- * Other functions
- *====================*/
-
-/**********************
- *      MACROS
- **********************/
-
-#endif /*LV_USE_TILEVIEW*/
-
-#ifdef __cplusplus
-} /*extern "C"*/
-#endif
-
-#endif /*LV_TILEVIEW_H*/
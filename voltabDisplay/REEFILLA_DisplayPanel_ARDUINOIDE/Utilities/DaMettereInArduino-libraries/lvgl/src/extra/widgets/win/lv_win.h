@@ -1,50 +0,0 @@
-/**
- * @file lv_win.h
- *
- */
-
-#ifndef LV_WIN_H
-#define LV_WIN_H
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-/*********************
- *      INCLUDES
- *********************/
-#include "../../../lvgl.h"
-
-/*********************
- *      DEFINES
- *********************/
-
-/**********************
- *      TYPEDEFS
- **********************/
-typedef struct {
-    lv_obj_t obj;
-} lv_win_t;
-
-extern const lv_obj_class_t lv_win_class;
-
-/**********************
- * GLOBAL PROTOTYPES
- **********************/
-
-lv_obj_t * lv_win_create(lv_obj_t * parent, lv_coord_t header_height);
-
-lv_obj_t * lv_win_add_title(lv_obj_t * win, const char * txt);
-lv_obj_t * lv_win_add_btn(lv_obj_t * win, const void * icon, lv_coord_t btn_w);
-
-lv_obj_t * lv_win_get_header(lv_obj_t * win);
-lv_obj_t * lv_win_get_content(lv_obj_t * win);
-/**********************
- *      MACROS
- **********************/
-
-#ifdef __cplusplus
-} /*extern "C"*/
-#endif
-
-#endif /*LV_WIN_H*/